@@ -0,0 +1,60 @@
+# Enables link-time optimization for the targets that are created in the calling directory
+# and its subdirectories, after this is called.
+function(centurion_enable_lto)
+  include(CheckIPOSupported)
+  check_ipo_supported(RESULT supported OUTPUT output LANGUAGES CXX)
+
+  if (NOT supported)
+    message(FATAL_ERROR "CEN_LTO is not supported by this toolchain: ${output}")
+  endif ()
+
+  message("Enabling link-time optimization...")
+  set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON PARENT_SCOPE)
+endfunction()
+
+# Adds the profile-guided optimization flags to an interface library, so that every target
+# that uses the library is either instrumented or optimized with the recorded profiles.
+#   target: the interface library target.
+#   phase: one of OFF, GENERATE or USE.
+#   directory: the directory that the profiles are written to and read from.
+function(centurion_enable_pgo target phase directory)
+  if (NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+    message(FATAL_ERROR "CEN_PGO requires GCC or Clang")
+  endif ()
+
+  if (phase STREQUAL "GENERATE")
+    message("Instrumenting for profile-guided optimization, profiles: ${directory}")
+    file(MAKE_DIRECTORY ${directory})
+
+    set(flags -fprofile-generate=${directory})
+    if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+      list(APPEND flags -fprofile-update=prefer-atomic)
+    endif ()
+
+    target_compile_options(${target} INTERFACE ${flags})
+    target_link_options(${target} INTERFACE ${flags})
+
+  elseif (phase STREQUAL "USE")
+    message("Using profile-guided optimization, profiles: ${directory}")
+
+    if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+      set(flags -fprofile-use=${directory} -fprofile-correction -Wno-missing-profile)
+    else ()
+      set(profile ${directory}/centurion.profdata)
+      if (NOT EXISTS ${profile})
+        message(FATAL_ERROR "Could not find ${profile}, run the pgo-train target first")
+      endif ()
+
+      set(flags
+          -fprofile-use=${profile}
+          -Wno-profile-instr-unprofiled
+          -Wno-profile-instr-out-of-date)
+    endif ()
+
+    target_compile_options(${target} INTERFACE ${flags})
+    target_link_options(${target} INTERFACE ${flags})
+
+  elseif (NOT phase STREQUAL "OFF")
+    message(FATAL_ERROR "CEN_PGO must be one of OFF, GENERATE or USE, was: ${phase}")
+  endif ()
+endfunction()
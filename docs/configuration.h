@@ -28,6 +28,22 @@
  * \section no-debug-log-macros CENTURION_NO_DEBUG_LOG_MACROS
  * Entirely excludes all debug-only logging macros if defined, e.g. `CENTURION_LOG_INFO`.
  *
+ * \section enable-profiler CENTURION_ENABLE_PROFILER
+ * Enables the `CENTURION_PROFILE_ZONE` macro, which otherwise expands to nothing, and the
+ * profiling zones in the hot paths of the library, e.g. `renderer::present()`. Unlike the
+ * other macros, this one opts in, and it must be defined for all source files. See
+ * `profiler` for more information.
+ *
+ * \section log-min-priority CENTURION_LOG_MIN_PRIORITY
+ * Sets the lowest priority of the messages that are logged by the logging macros, e.g.
+ * `SDL_LOG_PRIORITY_WARN` or `cen::log_priority::warn`. Macros with a lower priority are
+ * compiled out, and their arguments aren't evaluated. By default, all macros are enabled,
+ * unless `NDEBUG` is defined, in which case all of them are excluded. The minimum priority
+ * can be overridden for a single category with the corresponding macro, e.g.
+ * `CENTURION_LOG_MIN_PRIORITY_RENDER`, which is used by `CENTURION_LOG(priority, category,
+ * fmt, ...)`. The other logging macros, such as `CENTURION_LOG_INFO`, use the minimum
+ * priority of the app category.
+ *
  * \section no-sdl-image CENTURION_NO_SDL_IMAGE
  * Excludes all library components that rely on SDL_image if defined.
  *
@@ -42,4 +58,14 @@
  *
  * \section no-opengl-support CENTURION_NO_OPENGL
  * Excludes all library components related to the OpenGL API if defined.
+ *
+ * \section headless CENTURION_HEADLESS
+ * Configures the library for processes without a display or audio device, e.g. dedicated
+ * servers, if defined. This implies `CENTURION_NO_SDL_IMAGE`, `CENTURION_NO_SDL_MIXER`,
+ * `CENTURION_NO_SDL_TTF`, `CENTURION_NO_OPENGL` and `CENTURION_NO_VULKAN`, and owning
+ * windows and renderers can't be created. The `library` only initializes the timer and
+ * event subsystems by default, and ignores the video, audio and input flags in
+ * `config::coreFlags`. Like `CENTURION_ENABLE_PROFILER`, this macro must be defined for all
+ * source files, which the `CEN_HEADLESS` CMake option takes care of. See
+ * `headless_config()` for the runtime equivalent.
  */
\ No newline at end of file
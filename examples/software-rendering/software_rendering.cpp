@@ -0,0 +1,94 @@
+#include <centurion.hpp>
+#include <iostream>  // cout
+#include <random>    // mt19937, uniform_real_distribution
+#include <vector>    // vector
+
+namespace {
+
+constexpr cen::iarea size{800, 600};
+constexpr int sprite_count = 500;
+constexpr int frame_count = 100;
+
+// Returns the average time of a frame in milliseconds
+template <typename Frame>
+auto measure(Frame&& frame) -> double
+{
+  const auto start = cen::counter::now();
+
+  for (auto index = 0; index < frame_count; ++index) {
+    frame();
+  }
+
+  const auto elapsed = static_cast<double>(cen::counter::now() - start);
+  return (elapsed * 1'000.0) / static_cast<double>(cen::counter::frequency() * frame_count);
+}
+
+}  // namespace
+
+int main(int, char**)
+{
+  cen::library centurion;
+
+  // Here we assume the existence of an image
+  const cen::surface image{RESOURCE_DIR "panda.png"};
+  const auto panda = image.convert(cen::pixel_format::argb8888);
+
+  cen::surface background{size, cen::pixel_format::argb8888};
+  background.set_blend_mode(cen::blend_mode::none);
+
+  // The same sprites are drawn by both the surface batch and the software renderer
+  std::mt19937 engine{42};
+  std::uniform_real_distribution<float> x{-32, 800};
+  std::uniform_real_distribution<float> y{-32, 600};
+
+  std::vector<cen::frect> sprites;
+  for (auto index = 0; index < sprite_count; ++index) {
+    sprites.emplace_back(x(engine), y(engine), 64.0f, 64.0f);
+  }
+
+  // Blend the sprites into a surface with a surface batch
+  cen::surface batchTarget{size, cen::pixel_format::argb8888};
+  cen::surface_batch batch;
+
+  const auto batchTime = measure([&] {
+    batch.add(background, cen::frect{{0, 0}, cen::cast<cen::farea>(size)});
+    for (const auto& sprite : sprites) {
+      batch.add(panda, sprite);
+    }
+
+    batch.flush(batchTarget);
+  });
+
+  // Draw the same sprites with the SDL software renderer
+  cen::surface rendererTarget{size, cen::pixel_format::argb8888};
+  cen::renderer renderer{SDL_CreateSoftwareRenderer(rendererTarget.get())};
+
+  const cen::texture pandaTexture{renderer, panda};
+  const cen::texture backgroundTexture{renderer, background};
+
+  const auto rendererTime = measure([&] {
+    renderer.render(backgroundTexture, cen::frect{{0, 0}, cen::cast<cen::farea>(size)});
+    for (const auto& sprite : sprites) {
+      renderer.render(pandaTexture, sprite);
+    }
+
+    renderer.present();
+  });
+
+  std::cout << "surface_batch:     " << batchTime << " ms per frame\n";
+  std::cout << "software renderer: " << rendererTime << " ms per frame\n";
+
+  // Show the result by blending it into the surface of a window, without a renderer
+  cen::window window{"Software rendering", size};
+  window.show();
+
+  batchTarget.set_blend_mode(cen::blend_mode::none);
+  batch.add(batchTarget, cen::frect{{0, 0}, cen::cast<cen::farea>(size)});
+  batch.flush(window);
+
+  using namespace cen::literals;  // For _ms literal
+  cen::thread::sleep(2000_ms);    // Wait for 2 seconds so that we can see the result
+  window.hide();
+
+  return 0;
+}
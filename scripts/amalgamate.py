@@ -94,7 +94,7 @@ class Amalgamation(object):
             t = TranslationUnit(file_path, self, True)
             amalgamation += t.content
 
-        with open(self.target, 'w') as f:
+        with open(self.actual_path(self.target), 'w') as f:
             f.write(amalgamation)
 
         print("...done!\n")
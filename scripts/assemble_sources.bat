@@ -1 +1,6 @@
-python amalgamate.py -c config.json -s ..
\ No newline at end of file
+python amalgamate.py -c config.json -s ..
+python amalgamate.py -c config_core.json -s ..
+python amalgamate.py -c config_video.json -s ..
+python amalgamate.py -c config_events.json -s ..
+python amalgamate.py -c config_input.json -s ..
+python amalgamate.py -c config_audio.json -s ..
\ No newline at end of file
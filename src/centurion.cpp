@@ -0,0 +1,23 @@
+// The translation unit of the optional compiled library, see the CEN_COMPILED_LIBRARY
+// CMake option and compiler/linkage.hpp. Including everything here emits the definitions
+// of the functions marked with CENTURION_LIB_INLINE exactly once.
+
+#define CENTURION_BUILDING_LIBRARY
+
+#include "centurion.hpp"
+
+namespace cen {
+
+template class basic_renderer<detail::owning_type>;
+template class basic_renderer<detail::handle_type>;
+
+template class basic_texture<detail::owning_type>;
+template class basic_texture<detail::handle_type>;
+
+template class basic_window<detail::owning_type>;
+template class basic_window<detail::handle_type>;
+
+template class basic_surface<detail::owning_type>;
+template class basic_surface<detail::handle_type>;
+
+}  // namespace cen
@@ -0,0 +1,179 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019-2021 Albin Johansson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Optional C++20 module interface unit, enabled with the CEN_MODULE CMake option.
+//
+// The headers are included in the global module fragment, which only makes the exported
+// names below available to importers. Macros, such as the profiler and logging macros,
+// are not exported, so translation units that need them must include the headers.
+
+module;
+
+#include "centurion.hpp"
+
+export module centurion;
+
+export namespace cen {
+
+// core
+using cen::result;
+using cen::library;
+using cen::error_info;
+using cen::sdl_string;
+using cen::config;
+using cen::subsystem_timing;
+using cen::version;
+using cen::expected;
+using cen::basic_area;
+using cen::basic_point;
+using cen::basic_rect;
+using cen::iarea;
+using cen::farea;
+using cen::darea;
+using cen::ipoint;
+using cen::fpoint;
+using cen::irect;
+using cen::frect;
+
+// video
+using cen::color;
+using cen::font;
+using cen::font_cache;
+using cen::font_pool;
+using cen::message_box;
+using cen::palette;
+using cen::renderer_info;
+using cen::rich_text;
+using cen::text_batch;
+using cen::text_layout;
+using cen::texture_atlas;
+using cen::unicode_string;
+using cen::utf8_view;
+using cen::basic_window;
+using cen::basic_renderer;
+using cen::basic_texture;
+using cen::basic_surface;
+using cen::basic_cursor;
+using cen::basic_pixel_format_info;
+using cen::window;
+using cen::window_handle;
+using cen::renderer;
+using cen::renderer_handle;
+using cen::texture;
+using cen::texture_handle;
+using cen::surface;
+using cen::surface_handle;
+using cen::cursor;
+using cen::cursor_handle;
+using cen::pixel_format_info;
+using cen::pixel_format_info_handle;
+
+// events
+using cen::event;
+using cen::event_view;
+using cen::common_event;
+using cen::audio_device_event;
+using cen::controller_axis_event;
+using cen::controller_button_event;
+using cen::controller_device_event;
+using cen::controller_sensor_event;
+using cen::controller_touchpad_event;
+using cen::display_event;
+using cen::dollar_gesture_event;
+using cen::drop_event;
+using cen::joy_axis_event;
+using cen::joy_ball_event;
+using cen::joy_button_event;
+using cen::joy_device_event;
+using cen::joy_hat_event;
+using cen::keyboard_event;
+using cen::mouse_button_event;
+using cen::mouse_motion_event;
+using cen::mouse_wheel_event;
+using cen::multi_gesture_event;
+using cen::quit_event;
+using cen::sensor_event;
+using cen::text_editing_event;
+using cen::text_input_event;
+using cen::touch_finger_event;
+using cen::user_event;
+using cen::window_event;
+using cen::event_dispatcher;
+using cen::event_channel;
+
+// input
+using cen::action_map;
+using cen::controller_manager;
+using cen::key_code;
+using cen::key_set;
+using cen::keyboard;
+using cen::keyboard_tracker;
+using cen::mouse;
+using cen::mouse_tracker;
+using cen::scan_code;
+using cen::touch_tracker;
+using cen::basic_controller;
+using cen::basic_joystick;
+using cen::basic_haptic;
+using cen::basic_sensor;
+using cen::controller;
+using cen::controller_handle;
+using cen::joystick;
+using cen::joystick_handle;
+using cen::haptic;
+using cen::haptic_handle;
+using cen::sensor;
+using cen::sensor_handle;
+
+// audio
+using cen::music;
+using cen::music_playlist;
+using cen::music_stream;
+using cen::sound_bank;
+using cen::sound_cache;
+using cen::voice_manager;
+using cen::basic_sound_effect;
+using cen::sound_effect;
+using cen::sound_effect_handle;
+
+// enumerations
+using cen::blend_mode;
+using cen::controller_axis;
+using cen::controller_button;
+using cen::event_type;
+using cen::key_modifier;
+using cen::library_subsystem;
+using cen::log_priority;
+using cen::mouse_button;
+using cen::pixel_format;
+using cen::texture_access;
+using cen::window_event_id;
+
+// free functions and operators, including all of their overloads
+using cen::operator<<;
+using cen::operator==;
+using cen::operator!=;
+using cen::to_string;
+
+}  // namespace cen
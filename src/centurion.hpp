@@ -29,19 +29,42 @@
 #pragma once
 #endif  // CENTURION_NO_PRAGMA_ONCE
 
+// Applies the headless configuration before any of the optional components are included
+#ifdef CENTURION_HEADLESS
+#include "centurion/compiler/features.hpp"
+#endif  // CENTURION_HEADLESS
+
+#include "centurion/audio/audio_fwd.hpp"
+#include "centurion/audio/audio_meter.hpp"
+#include "centurion/audio/audio_monitor.hpp"
+#include "centurion/audio/capture_device.hpp"
 #include "centurion/audio/channels.hpp"
 #include "centurion/audio/fade_status.hpp"
+#include "centurion/audio/mixer_hook.hpp"
+#include "centurion/audio/mixer_latency.hpp"
 #include "centurion/audio/music.hpp"
+#include "centurion/audio/music_playlist.hpp"
+#include "centurion/audio/music_stream.hpp"
 #include "centurion/audio/music_type.hpp"
+#include "centurion/audio/resample_quality.hpp"
+#include "centurion/audio/sound_bank.hpp"
+#include "centurion/audio/sound_cache.hpp"
 #include "centurion/audio/sound_effect.hpp"
 #include "centurion/audio/sound_fonts.hpp"
+#include "centurion/audio/spatial_audio.hpp"
+#include "centurion/audio/voice_manager.hpp"
 #include "centurion/compiler/compiler.hpp"
 #include "centurion/compiler/features.hpp"
+#include "centurion/compiler/linkage.hpp"
+#include "centurion/core/async_log_sink.hpp"
 #include "centurion/core/cast.hpp"
+#include "centurion/core/core_fwd.hpp"
 #include "centurion/core/exception.hpp"
+#include "centurion/core/expected.hpp"
 #include "centurion/core/integers.hpp"
 #include "centurion/core/is_stateless_callable.hpp"
 #include "centurion/core/library.hpp"
+#include "centurion/core/library_subsystem.hpp"
 #include "centurion/core/log.hpp"
 #include "centurion/core/log_category.hpp"
 #include "centurion/core/log_macros.hpp"
@@ -61,21 +84,48 @@
 #include "centurion/detail/address_of.hpp"
 #include "centurion/detail/any_eq.hpp"
 #include "centurion/detail/array_utils.hpp"
+#include "centurion/detail/axis_kernels.hpp"
+#include "centurion/detail/byte_swap_kernels.hpp"
 #include "centurion/detail/clamp.hpp"
+#include "centurion/detail/color_kernels.hpp"
+#include "centurion/detail/concurrent_utils.hpp"
 #include "centurion/detail/convert_bool.hpp"
 #include "centurion/detail/czstring_compare.hpp"
 #include "centurion/detail/czstring_eq.hpp"
 #include "centurion/detail/from_string.hpp"
+#include "centurion/detail/geometry_kernels.hpp"
+#include "centurion/detail/hex.hpp"
 #include "centurion/detail/hints_impl.hpp"
+#include "centurion/detail/json_string.hpp"
+#include "centurion/detail/key_names.hpp"
 #include "centurion/detail/lerp.hpp"
+#include "centurion/detail/lz4_codec.hpp"
 #include "centurion/detail/max.hpp"
+#include "centurion/detail/meter_kernels.hpp"
 #include "centurion/detail/min.hpp"
+#include "centurion/detail/mix_kernels.hpp"
 #include "centurion/detail/owner_handle_api.hpp"
+#include "centurion/detail/ownership_tags.hpp"
+#include "centurion/detail/particle_kernels.hpp"
+#include "centurion/detail/pcm_conversion.hpp"
+#include "centurion/detail/perfect_hash_map.hpp"
+#include "centurion/detail/pixel_kernels.hpp"
+#include "centurion/detail/qoi_codec.hpp"
+#include "centurion/detail/radix_sort.hpp"
+#include "centurion/detail/resample_kernels.hpp"
+#include "centurion/detail/row_bands.hpp"
+#include "centurion/detail/sdf_kernels.hpp"
 #include "centurion/detail/sdl_deleter.hpp"
 #include "centurion/detail/sdl_version_at_least.hpp"
+#include "centurion/detail/spin_backoff.hpp"
+#include "centurion/detail/spsc_byte_ring.hpp"
 #include "centurion/detail/stack_resource.hpp"
 #include "centurion/detail/static_bimap.hpp"
+#include "centurion/detail/static_string_map.hpp"
+#include "centurion/detail/transform_kernels.hpp"
 #include "centurion/detail/tuple_type_index.hpp"
+#include "centurion/detail/utf_kernels.hpp"
+#include "centurion/detail/vector_kernels.hpp"
 #include "centurion/events/audio_device_event.hpp"
 #include "centurion/events/common_event.hpp"
 #include "centurion/events/controller_axis_event.hpp"
@@ -83,13 +133,22 @@
 #include "centurion/events/controller_device_event.hpp"
 #include "centurion/events/controller_sensor_event.hpp"
 #include "centurion/events/controller_touchpad_event.hpp"
+#include "centurion/events/dispatch_stats.hpp"
 #include "centurion/events/display_event.hpp"
 #include "centurion/events/display_event_id.hpp"
 #include "centurion/events/dollar_gesture_event.hpp"
 #include "centurion/events/drop_event.hpp"
 #include "centurion/events/event.hpp"
+#include "centurion/events/event_channel.hpp"
+#include "centurion/events/event_coalescer.hpp"
 #include "centurion/events/event_dispatcher.hpp"
+#include "centurion/events/event_listeners.hpp"
+#include "centurion/events/event_prefilter.hpp"
+#include "centurion/events/event_recording.hpp"
 #include "centurion/events/event_type.hpp"
+#include "centurion/events/event_view.hpp"
+#include "centurion/events/events_fwd.hpp"
+#include "centurion/events/frame_pacer.hpp"
 #include "centurion/events/joy_axis_event.hpp"
 #include "centurion/events/joy_ball_event.hpp"
 #include "centurion/events/joy_button_event.hpp"
@@ -110,11 +169,22 @@
 #include "centurion/events/window_event.hpp"
 #include "centurion/events/window_event_id.hpp"
 #include "centurion/filesystem/base_path.hpp"
+#include "centurion/filesystem/binary_archive.hpp"
+#include "centurion/filesystem/buffered_reader.hpp"
+#include "centurion/filesystem/buffered_writer.hpp"
 #include "centurion/filesystem/file.hpp"
 #include "centurion/filesystem/file_mode.hpp"
 #include "centurion/filesystem/file_type.hpp"
+#include "centurion/filesystem/file_watcher.hpp"
+#include "centurion/filesystem/image_format.hpp"
+#include "centurion/filesystem/io_service.hpp"
+#include "centurion/filesystem/lz4_reader.hpp"
+#include "centurion/filesystem/lz4_writer.hpp"
+#include "centurion/filesystem/mapped_file.hpp"
 #include "centurion/filesystem/preferred_path.hpp"
+#include "centurion/filesystem/save_writer.hpp"
 #include "centurion/filesystem/seek_mode.hpp"
+#include "centurion/filesystem/virtual_filesystem.hpp"
 #include "centurion/hints/android_hints.hpp"
 #include "centurion/hints/apple_tv_hints.hpp"
 #include "centurion/hints/common_hints.hpp"
@@ -123,6 +193,7 @@
 #include "centurion/hints/emscripten_hints.hpp"
 #include "centurion/hints/enum_hint.hpp"
 #include "centurion/hints/hint_priority.hpp"
+#include "centurion/hints/hint_profile.hpp"
 #include "centurion/hints/hints.hpp"
 #include "centurion/hints/joystick_hints.hpp"
 #include "centurion/hints/mac_hints.hpp"
@@ -133,9 +204,13 @@
 #include "centurion/hints/winrt_hints.hpp"
 #include "centurion/hints/x11_hints.hpp"
 #include "centurion/hints/xinput_hints.hpp"
+#include "centurion/input/action_map.hpp"
+#include "centurion/input/axis_filter.hpp"
 #include "centurion/input/button_state.hpp"
 #include "centurion/input/controller.hpp"
 #include "centurion/input/controller_axis.hpp"
+#include "centurion/input/controller_manager.hpp"
+#include "centurion/input/controller_mapping_loader.hpp"
 #include "centurion/input/controller_type.hpp"
 #include "centurion/input/haptic.hpp"
 #include "centurion/input/haptic_condition.hpp"
@@ -148,74 +223,170 @@
 #include "centurion/input/haptic_left_right.hpp"
 #include "centurion/input/haptic_periodic.hpp"
 #include "centurion/input/haptic_ramp.hpp"
+#include "centurion/input/haptic_scheduler.hpp"
 #include "centurion/input/hat_state.hpp"
+#include "centurion/input/input_fwd.hpp"
 #include "centurion/input/joystick.hpp"
 #include "centurion/input/joystick_power.hpp"
 #include "centurion/input/joystick_type.hpp"
 #include "centurion/input/key_code.hpp"
 #include "centurion/input/key_modifier.hpp"
+#include "centurion/input/key_set.hpp"
 #include "centurion/input/keyboard.hpp"
+#include "centurion/input/keyboard_tracker.hpp"
 #include "centurion/input/keycodes.hpp"
 #include "centurion/input/mouse.hpp"
+#include "centurion/input/mouse_tracker.hpp"
 #include "centurion/input/scan_code.hpp"
 #include "centurion/input/scancodes.hpp"
 #include "centurion/input/sensor.hpp"
+#include "centurion/input/sensor_stream.hpp"
 #include "centurion/input/sensor_type.hpp"
+#include "centurion/input/text_input_buffer.hpp"
 #include "centurion/input/touch.hpp"
 #include "centurion/input/touch_device_type.hpp"
+#include "centurion/input/touch_tracker.hpp"
+#include "centurion/input/virtual_joystick_swarm.hpp"
+#include "centurion/math/affine_transform.hpp"
 #include "centurion/math/area.hpp"
+#include "centurion/math/fixed.hpp"
+#include "centurion/math/packed_point.hpp"
+#include "centurion/math/packed_rect.hpp"
 #include "centurion/math/point.hpp"
+#include "centurion/math/point_array.hpp"
 #include "centurion/math/rect.hpp"
+#include "centurion/math/rect_array.hpp"
+#include "centurion/math/spatial_grid.hpp"
 #include "centurion/math/vector3.hpp"
+#include "centurion/math/vector4.hpp"
+#include "centurion/math/vector_utils.hpp"
+#include "centurion/system/allocation_tracker.hpp"
 #include "centurion/system/battery.hpp"
 #include "centurion/system/byte_order.hpp"
 #include "centurion/system/clipboard.hpp"
 #include "centurion/system/counter.hpp"
 #include "centurion/system/cpu.hpp"
+#include "centurion/system/cpu_dispatch.hpp"
+#include "centurion/system/fixed_timestep.hpp"
+#include "centurion/system/frame_histogram.hpp"
+#include "centurion/system/game_loop.hpp"
+#include "centurion/system/input_latency_tracker.hpp"
 #include "centurion/system/locale.hpp"
+#include "centurion/system/memory_budget.hpp"
 #include "centurion/system/open_url.hpp"
 #include "centurion/system/platform.hpp"
+#include "centurion/system/power_mode.hpp"
+#include "centurion/system/power_profile.hpp"
 #include "centurion/system/power_state.hpp"
+#include "centurion/system/profiler.hpp"
+#include "centurion/system/profiler_macros.hpp"
 #include "centurion/system/ram.hpp"
+#include "centurion/system/shared_memory.hpp"
 #include "centurion/system/shared_object.hpp"
+#include "centurion/system/simd_arena.hpp"
+#include "centurion/system/simd_level.hpp"
+#include "centurion/system/startup_tracer.hpp"
+#include "centurion/system/timer_wheel.hpp"
+#include "centurion/thread/adaptive_mutex.hpp"
+#include "centurion/thread/blocking_queue.hpp"
 #include "centurion/thread/condition.hpp"
+#include "centurion/thread/coroutine.hpp"
+#include "centurion/thread/deadline.hpp"
+#include "centurion/thread/future.hpp"
 #include "centurion/thread/lock_status.hpp"
+#include "centurion/thread/main_thread_queue.hpp"
+#include "centurion/thread/mpmc_queue.hpp"
 #include "centurion/thread/mutex.hpp"
 #include "centurion/thread/scoped_lock.hpp"
 #include "centurion/thread/semaphore.hpp"
+#include "centurion/thread/shared_lock.hpp"
+#include "centurion/thread/shared_mutex.hpp"
+#include "centurion/thread/spsc_queue.hpp"
+#include "centurion/thread/task_scheduler.hpp"
 #include "centurion/thread/thread.hpp"
+#include "centurion/thread/thread_attributes.hpp"
 #include "centurion/thread/thread_priority.hpp"
+#include "centurion/thread/thread_registry.hpp"
 #include "centurion/thread/try_lock.hpp"
+#include "centurion/video/animated_image_player.hpp"
 #include "centurion/video/blend_mode.hpp"
 #include "centurion/video/button_order.hpp"
 #include "centurion/video/color.hpp"
+#include "centurion/video/color_gradient.hpp"
+#include "centurion/video/color_utils.hpp"
 #include "centurion/video/colors.hpp"
+#include "centurion/video/converted_texture_cache.hpp"
 #include "centurion/video/cursor.hpp"
+#include "centurion/video/damage_tracker.hpp"
+#include "centurion/video/debug_overlay.hpp"
+#include "centurion/video/dirty_region.hpp"
+#include "centurion/video/dpi_scale_mode.hpp"
+#include "centurion/video/dpi_scaler.hpp"
 #include "centurion/video/flash_op.hpp"
 #include "centurion/video/font.hpp"
 #include "centurion/video/font_cache.hpp"
+#include "centurion/video/font_pool.hpp"
+#include "centurion/video/frame_recorder.hpp"
+#include "centurion/video/geometry_batch.hpp"
 #include "centurion/video/graphics_drivers.hpp"
+#include "centurion/video/image_loader.hpp"
+#include "centurion/video/image_saver.hpp"
+#include "centurion/video/indexed_texture.hpp"
 #include "centurion/video/message_box.hpp"
 #include "centurion/video/message_box_type.hpp"
+#include "centurion/video/multi_window_presenter.hpp"
 #include "centurion/video/opengl/gl_attribute.hpp"
+#include "centurion/video/opengl/gl_compressed_texture.hpp"
 #include "centurion/video/opengl/gl_context.hpp"
 #include "centurion/video/opengl/gl_core.hpp"
+#include "centurion/video/opengl/gl_gpu_profiler.hpp"
 #include "centurion/video/opengl/gl_library.hpp"
+#include "centurion/video/opengl/gl_loader.hpp"
+#include "centurion/video/opengl/gl_upload_worker.hpp"
 #include "centurion/video/palette.hpp"
+#include "centurion/video/particle_system.hpp"
+#include "centurion/video/pixel_conversion.hpp"
 #include "centurion/video/pixel_format.hpp"
 #include "centurion/video/pixel_format_info.hpp"
+#include "centurion/video/pixel_view.hpp"
+#include "centurion/video/render_command_list.hpp"
+#include "centurion/video/render_driver_calibration.hpp"
+#include "centurion/video/render_graph.hpp"
+#include "centurion/video/render_queue.hpp"
 #include "centurion/video/renderer.hpp"
 #include "centurion/video/renderer_info.hpp"
+#include "centurion/video/resize_coordinator.hpp"
+#include "centurion/video/rich_text.hpp"
 #include "centurion/video/scale_mode.hpp"
 #include "centurion/video/screen.hpp"
+#include "centurion/video/sdf_glyph_atlas.hpp"
+#include "centurion/video/sdf_text_batch.hpp"
+#include "centurion/video/shared_frame_exporter.hpp"
+#include "centurion/video/sprite_batch.hpp"
 #include "centurion/video/surface.hpp"
+#include "centurion/video/surface_batch.hpp"
 #include "centurion/video/system_cursor.hpp"
+#include "centurion/video/text_batch.hpp"
+#include "centurion/video/text_layout.hpp"
 #include "centurion/video/texture.hpp"
 #include "centurion/video/texture_access.hpp"
+#include "centurion/video/texture_atlas.hpp"
+#include "centurion/video/texture_lock.hpp"
+#include "centurion/video/texture_memory.hpp"
+#include "centurion/video/texture_pool.hpp"
+#include "centurion/video/texture_streamer.hpp"
+#include "centurion/video/tile_map.hpp"
 #include "centurion/video/unicode_string.hpp"
+#include "centurion/video/utf8_view.hpp"
+#include "centurion/video/vertex_buffer.hpp"
+#include "centurion/video/video_fwd.hpp"
+#include "centurion/video/vsync_mode.hpp"
 #include "centurion/video/vulkan/vk_core.hpp"
 #include "centurion/video/vulkan/vk_library.hpp"
+#include "centurion/video/vulkan/vk_present_mode.hpp"
+#include "centurion/video/vulkan/vk_presenter.hpp"
 #include "centurion/video/window.hpp"
+#include "centurion/video/window_state.hpp"
 #include "centurion/video/window_utils.hpp"
 
 #endif  // CENTURION_CENTURION_HEADER
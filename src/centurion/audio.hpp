@@ -0,0 +1,54 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019-2021 Albin Johansson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CENTURION_AUDIO_MODULE_HEADER
+#define CENTURION_AUDIO_MODULE_HEADER
+
+#ifndef CENTURION_NO_PRAGMA_ONCE
+#pragma once
+#endif  // CENTURION_NO_PRAGMA_ONCE
+
+// Audio components, requires SDL_mixer.
+
+#include "audio/audio_fwd.hpp"
+#include "audio/audio_meter.hpp"
+#include "audio/audio_monitor.hpp"
+#include "audio/capture_device.hpp"
+#include "audio/channels.hpp"
+#include "audio/fade_status.hpp"
+#include "audio/mixer_hook.hpp"
+#include "audio/mixer_latency.hpp"
+#include "audio/music.hpp"
+#include "audio/music_playlist.hpp"
+#include "audio/music_stream.hpp"
+#include "audio/music_type.hpp"
+#include "audio/resample_quality.hpp"
+#include "audio/sound_bank.hpp"
+#include "audio/sound_cache.hpp"
+#include "audio/sound_effect.hpp"
+#include "audio/sound_fonts.hpp"
+#include "audio/spatial_audio.hpp"
+#include "audio/voice_manager.hpp"
+
+#endif  // CENTURION_AUDIO_MODULE_HEADER
@@ -0,0 +1,33 @@
+#ifndef CENTURION_AUDIO_FWD_HEADER
+#define CENTURION_AUDIO_FWD_HEADER
+
+#include "../detail/ownership_tags.hpp"
+
+/**
+ * \file audio_fwd.hpp
+ *
+ * \brief Provides forward declarations of the audio components.
+ *
+ * \details Include this header instead of the full headers in headers that only refer
+ * to these types by reference or pointer. Unlike the full headers, this header is
+ * usable without SDL_mixer.
+ */
+
+namespace cen {
+
+class music;
+class music_playlist;
+class music_stream;
+class sound_bank;
+class sound_cache;
+class voice_manager;
+
+template <typename T>
+class basic_sound_effect;
+
+using sound_effect = basic_sound_effect<detail::owning_type>;
+using sound_effect_handle = basic_sound_effect<detail::handle_type>;
+
+}  // namespace cen
+
+#endif  // CENTURION_AUDIO_FWD_HEADER
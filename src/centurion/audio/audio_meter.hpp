@@ -0,0 +1,583 @@
+#ifndef CENTURION_AUDIO_METER_HEADER
+#define CENTURION_AUDIO_METER_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <array>    // array
+#include <atomic>   // atomic, memory_order
+#include <cassert>  // assert
+#include <cmath>    // sqrt, log10
+#include <memory>   // unique_ptr, make_unique
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/meter_kernels.hpp"
+#include "channels.hpp"
+#include "mixer_latency.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct meter_levels
+ *
+ * \brief Provides the levels measured by an audio meter, for each output channel.
+ *
+ * \details The levels are linear amplitudes, where 1 corresponds to a full scale signal.
+ * Use `to_decibels()` to convert them to a logarithmic scale, e.g. for meters.
+ *
+ * \see `audio_meter`
+ *
+ * \since 6.4.0
+ */
+struct meter_levels final
+{
+  /// The maximum amount of measured output channels, i.e. 7.1 surround.
+  inline constexpr static int max_channels = 8;
+
+  int channels{};                          ///< The amount of measured output channels.
+  std::array<float, max_channels> peak{};  ///< The peak amplitude in the latest buffer.
+  std::array<float, max_channels> rms{};   ///< The RMS amplitude of the latest buffer.
+  std::array<float, max_channels> held{};  ///< The highest peak since the last reset.
+
+  /**
+   * \brief Returns the highest peak amplitude in the latest buffer, of all channels.
+   *
+   * \return the peak amplitude.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto max_peak() const noexcept -> float
+  {
+    return max_of(peak);
+  }
+
+  /**
+   * \brief Returns the highest RMS amplitude of the latest buffer, of all channels.
+   *
+   * \return the RMS amplitude.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto max_rms() const noexcept -> float
+  {
+    return max_of(rms);
+  }
+
+ private:
+  [[nodiscard]] auto max_of(const std::array<float, max_channels>& values) const noexcept
+      -> float
+  {
+    auto result = 0.0f;
+    for (auto channel = 0; channel < channels; ++channel) {
+      const auto value = values[static_cast<usize>(channel)];
+      result = (value > result) ? value : result;
+    }
+
+    return result;
+  }
+};
+
+/**
+ * \brief Converts a linear amplitude to decibels relative to full scale.
+ *
+ * \param amplitude the linear amplitude, e.g. a level reported by an audio meter.
+ *
+ * \return the level in dBFS, which is at least -100 dB, for silent signals.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto to_decibels(const float amplitude) noexcept -> float
+{
+  return (amplitude > 1e-5f) ? 20.0f * std::log10(amplitude) : -100.0f;
+}
+
+/**
+ * \class audio_meter
+ *
+ * \brief Measures the peak and RMS levels of groups of channels, in the audio callback.
+ *
+ * \details An audio meter computes levels for a fixed amount of buses, e.g. one for each
+ * channel group, and for the mixed output. Channels are attached to a bus, which
+ * registers an effect that measures the samples of the channel, after scaling them with
+ * the channel and chunk volumes. Once per buffer, a post effect measures the mixed output
+ * and publishes the levels of all buses through atomics. The measurements use vectorized
+ * kernels, and the audio thread neither allocates memory nor takes any locks.
+ *
+ * \details The levels of a bus combine the levels of its channels, by using the highest
+ * peak and adding the power of the channels, which assumes uncorrelated sounds. Buses
+ * without playing channels report silence.
+ *
+ * \code{cpp}
+ *   cen::audio_meter meter{2};  // Dialogue and effects
+ *   meter.install();
+ *
+ *   if (const auto channel = dialogue.play(line)) {
+ *     meter.attach(*channel, 0);
+ *   }
+ *
+ *   // Once per frame, duck the music while dialogue is playing
+ *   const auto dialogueLevel = cen::to_decibels(meter.levels(0).max_rms());
+ *   music.set_volume(dialogueLevel > -30.0f ? quiet : normal);
+ * \endcode
+ *
+ * \note The mixer removes the effects of a channel once it stops playing, so channels must
+ * be attached each time something is played on them.
+ *
+ * \note Only 16-bit and floating-point output formats in native byte order are measured,
+ * for all other formats the meter reports silence.
+ *
+ * \note Only one meter may be installed at a time, and a channel may only be attached to
+ * a single bus. The levels are updated individually, so a snapshot may mix values from
+ * two subsequent buffers.
+ *
+ * \since 6.4.0
+ */
+class audio_meter final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Creates an audio meter, without installing it.
+   *
+   * \pre The audio device must be open.
+   * \pre `buses` must be greater than zero.
+   *
+   * \param buses the amount of buses that channels can be attached to.
+   *
+   * \since 6.4.0
+   */
+  explicit audio_meter(const size_type buses = 1)
+      : m_spec{query_mixer_spec().value_or(mixer_spec{})}
+      , m_buses{std::make_unique<bus[]>(buses + 1)}
+      , m_busCount{buses}
+  {
+    assert(buses > 0);
+
+    if (m_spec.channels <= meter_levels::max_channels) {
+      m_channels = static_cast<size_type>(m_spec.channels);
+    }
+
+    for (size_type index = 0; index <= buses; ++index) {
+      m_buses[index].meter = this;
+      m_buses[index].index = index;
+    }
+  }
+
+  audio_meter(const audio_meter&) = delete;
+  audio_meter(audio_meter&&) = delete;
+
+  auto operator=(const audio_meter&) -> audio_meter& = delete;
+  auto operator=(audio_meter&&) -> audio_meter& = delete;
+
+  ~audio_meter() noexcept
+  {
+    uninstall();
+  }
+
+  /**
+   * \brief Installs the post effect, which measures the output and publishes the levels.
+   *
+   * \return `success` if the post effect was registered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto install() noexcept -> result
+  {
+    if (m_installed) {
+      return success;
+    }
+
+    m_installed = Mix_RegisterEffect(MIX_CHANNEL_POST,
+                                     &audio_meter::on_post_effect,
+                                     nullptr,
+                                     this) != 0;
+    return m_installed;
+  }
+
+  /**
+   * \brief Detaches all channels, and removes the post effect.
+   *
+   * \details The audio callback is guaranteed not to use the meter once this function
+   * returns.
+   *
+   * \since 6.4.0
+   */
+  void uninstall() noexcept
+  {
+    for (size_type channel = 0; channel < m_attachments.size(); ++channel) {
+      if (m_attachments[channel]) {
+        detach(static_cast<channel_index>(channel));
+      }
+    }
+
+    if (m_installed) {
+      Mix_UnregisterEffect(MIX_CHANNEL_POST, &audio_meter::on_post_effect);
+      m_installed = false;
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the post effect is installed.
+   *
+   * \return `true` if the meter is installed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_installed() const noexcept -> bool
+  {
+    return m_installed;
+  }
+
+  /**
+   * \brief Starts measuring a channel as a part of a bus.
+   *
+   * \details This replaces a previous attachment of the channel, if the channel is still
+   * playing.
+   *
+   * \pre `bus` must be less than `bus_count()`.
+   *
+   * \param channel the channel that will be measured, usually right after a sound was
+   * started on it.
+   * \param bus the index of the bus that the channel contributes to.
+   *
+   * \return `success` if the channel effect was registered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto attach(const channel_index channel, const size_type bus = 0) -> result
+  {
+    assert(bus < m_busCount);
+
+    if (channel < 0) {
+      return failure;
+    }
+
+    const auto index = static_cast<size_type>(channel);
+    if (index >= m_attachments.size()) {
+      m_attachments.resize(index + 1);
+    }
+
+    if (m_attachments[index]) {
+      detach(channel);
+    }
+
+    if (Mix_RegisterEffect(channel,
+                           &audio_meter::on_channel_effect,
+                           &audio_meter::on_channel_done,
+                           &m_buses[bus]) == 0)
+    {
+      return failure;
+    }
+
+    m_attachments[index] = true;
+    m_attached.fetch_add(1, std::memory_order_relaxed);
+
+    return success;
+  }
+
+  /**
+   * \brief Stops measuring a channel.
+   *
+   * \param channel the channel that will no longer be measured.
+   *
+   * \return `success` if the channel effect was removed; `failure` if it was already
+   * removed by the mixer, or if the channel was never attached.
+   *
+   * \since 6.4.0
+   */
+  auto detach(const channel_index channel) noexcept -> result
+  {
+    const auto index = static_cast<size_type>(channel);
+    if (channel < 0 || index >= m_attachments.size() || !m_attachments[index]) {
+      return failure;
+    }
+
+    m_attachments[index] = false;
+    return Mix_UnregisterEffect(channel, &audio_meter::on_channel_effect) != 0;
+  }
+
+  /**
+   * \brief Returns the latest levels of a bus.
+   *
+   * \pre `bus` must be less than `bus_count()`.
+   *
+   * \param bus the index of the bus.
+   *
+   * \return the levels of the channels attached to the bus.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto levels(const size_type bus) const noexcept -> meter_levels
+  {
+    assert(bus < m_busCount);
+    return m_buses[bus].load(m_channels);
+  }
+
+  /**
+   * \brief Returns the latest levels of the mixed output, including music.
+   *
+   * \return the levels of the output.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto output_levels() const noexcept -> meter_levels
+  {
+    return m_buses[m_busCount].load(m_channels);
+  }
+
+  /**
+   * \brief Clears the held peaks of all buses and the output.
+   *
+   * \since 6.4.0
+   */
+  void reset_held() noexcept
+  {
+    for (size_type index = 0; index <= m_busCount; ++index) {
+      for (auto& held : m_buses[index].held) {
+        held.store(0.0f, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * \brief Measures samples of a channel, this is done by the channel effects.
+   *
+   * \details This function may be used to drive the meter manually, e.g. in tests. It
+   * must not be called while the meter is installed.
+   *
+   * \pre `bus` must be less than `bus_count()`.
+   *
+   * \param bus the index of the bus that the samples contribute to.
+   * \param stream the samples, in the format of the audio device.
+   * \param size the size of the samples, in bytes.
+   * \param gain the volume that the samples are played at.
+   *
+   * \since 6.4.0
+   */
+  void measure(const size_type bus,
+               const void* stream,
+               const size_type size,
+               const float gain = 1.0f) noexcept
+  {
+    assert(bus < m_busCount);
+    m_buses[bus].accumulate(stream, size, gain);
+  }
+
+  /**
+   * \brief Measures the mixed output and publishes the levels, this is done by the post
+   * effect once per buffer.
+   *
+   * \details This has the same requirements as `measure()`.
+   *
+   * \param stream the mixed output, in the format of the audio device.
+   * \param size the size of the output, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void process(const void* stream, const size_type size) noexcept
+  {
+    auto& output = m_buses[m_busCount];
+    output.accumulate(stream, size, 1.0f);
+
+    for (size_type index = 0; index <= m_busCount; ++index) {
+      m_buses[index].publish();
+    }
+
+    m_buffers.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of channels that are currently attached.
+   *
+   * \details This decreases when the mixer removes the effects of finished channels.
+   *
+   * \return the number of attached channels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto attached() const noexcept -> size_type
+  {
+    return m_attached.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of buffers that have been measured.
+   *
+   * \return the number of published levels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffers() const noexcept -> size_type
+  {
+    return m_buffers.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of buses, excluding the output.
+   *
+   * \return the number of buses.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bus_count() const noexcept -> size_type
+  {
+    return m_busCount;
+  }
+
+  /**
+   * \brief Returns the format of the audio device.
+   *
+   * \return the format that was queried when the meter was created.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto spec() const noexcept -> const mixer_spec&
+  {
+    return m_spec;
+  }
+
+ private:
+  struct bus final
+  {
+    using levels_type = std::array<std::atomic<float>, meter_levels::max_channels>;
+    using values_type = std::array<float, meter_levels::max_channels>;
+
+    audio_meter* meter{};
+    size_type index{};
+
+    // Only accessed by the audio thread
+    values_type peaks{};
+    values_type power{};
+    size_type frames{};
+
+    levels_type peak{};
+    levels_type rms{};
+    levels_type held{};
+
+    void accumulate(const void* stream, const size_type size, const float gain) noexcept
+    {
+      const auto channels = meter->m_channels;
+      if (channels == 0) {
+        return;
+      }
+
+      const auto format = meter->m_spec.format;
+      const auto count = size / static_cast<size_type>(meter->m_spec.frame_size());
+
+      values_type bufferPeaks{};
+      values_type bufferPower{};
+
+      if (format == AUDIO_S16SYS) {
+        const auto* samples = static_cast<const i16*>(stream);
+        detail::measure_s16(samples, count, channels, bufferPeaks.data(), bufferPower.data());
+      }
+      else if (format == AUDIO_F32SYS) {
+        const auto* samples = static_cast<const float*>(stream);
+        detail::measure_f32(samples, count, channels, bufferPeaks.data(), bufferPower.data());
+      }
+      else {
+        return;
+      }
+
+      for (size_type channel = 0; channel < channels; ++channel) {
+        const auto scaled = bufferPeaks[channel] * gain;
+        peaks[channel] = (scaled > peaks[channel]) ? scaled : peaks[channel];
+        power[channel] += bufferPower[channel] * gain * gain;
+      }
+
+      frames = count;
+    }
+
+    void publish() noexcept
+    {
+      for (size_type channel = 0; channel < meter->m_channels; ++channel) {
+        const auto mean = (frames != 0) ? power[channel] / static_cast<float>(frames) : 0.0f;
+        const auto level = std::sqrt(mean);
+
+        peak[channel].store(peaks[channel], std::memory_order_relaxed);
+        rms[channel].store(level, std::memory_order_relaxed);
+
+        auto max = held[channel].load(std::memory_order_relaxed);
+        while (peaks[channel] > max &&
+               !held[channel].compare_exchange_weak(max,
+                                                    peaks[channel],
+                                                    std::memory_order_relaxed))
+        {}
+
+        peaks[channel] = 0.0f;
+        power[channel] = 0.0f;
+      }
+
+      frames = 0;
+    }
+
+    [[nodiscard]] auto load(const size_type channels) const noexcept -> meter_levels
+    {
+      meter_levels result;
+      result.channels = static_cast<int>(channels);
+
+      for (size_type channel = 0; channel < channels; ++channel) {
+        result.peak[channel] = peak[channel].load(std::memory_order_relaxed);
+        result.rms[channel] = rms[channel].load(std::memory_order_relaxed);
+        result.held[channel] = held[channel].load(std::memory_order_relaxed);
+      }
+
+      return result;
+    }
+  };
+
+  mixer_spec m_spec;
+  size_type m_channels{};           ///< Zero if there are too many output channels.
+  std::unique_ptr<bus[]> m_buses;   ///< The output is measured by the last bus.
+  size_type m_busCount{};
+  std::vector<bool> m_attachments;  ///< Only accessed by the thread that owns the meter.
+  std::atomic<size_type> m_attached{};
+  std::atomic<size_type> m_buffers{};
+  bool m_installed{};
+
+  static void SDLCALL on_channel_effect(const int channel,
+                                        void* stream,
+                                        const int len,
+                                        void* data) noexcept
+  {
+    auto* target = static_cast<bus*>(data);
+
+    // The effects see the samples before the volumes are applied by the mixer
+    auto gain = static_cast<float>(Mix_Volume(channel, -1)) / MIX_MAX_VOLUME;
+    if (auto* chunk = Mix_GetChunk(channel)) {
+      gain *= static_cast<float>(Mix_VolumeChunk(chunk, -1)) / MIX_MAX_VOLUME;
+    }
+
+    target->accumulate(stream, static_cast<size_type>(len), gain);
+  }
+
+  static void SDLCALL on_channel_done(const int, void* data) noexcept
+  {
+    auto* target = static_cast<bus*>(data);
+    target->meter->m_attached.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  static void SDLCALL on_post_effect(const int,
+                                     void* stream,
+                                     const int len,
+                                     void* data) noexcept
+  {
+    auto* self = static_cast<audio_meter*>(data);
+    self->process(stream, static_cast<size_type>(len));
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_AUDIO_METER_HEADER
@@ -0,0 +1,274 @@
+#ifndef CENTURION_AUDIO_MONITOR_HEADER
+#define CENTURION_AUDIO_MONITOR_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+
+#include <atomic>  // atomic, memory_order
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct audio_stats
+ *
+ * \brief Provides the statistics collected by an audio monitor.
+ *
+ * \details This is a plain struct, which can be forwarded to telemetry systems as is.
+ *
+ * \see `audio_monitor::stats()`
+ *
+ * \since 6.4.0
+ */
+struct audio_stats final
+{
+  usize callbacks{};                ///< The amount of audio callbacks.
+  nanoseconds<u64> totalTime{};     ///< The time spent in all audio callbacks.
+  nanoseconds<u64> maxTime{};       ///< The longest audio callback.
+  nanoseconds<u64> lastTime{};      ///< The most recent audio callback.
+  usize underruns{};                ///< The amount of callbacks that ran out of data.
+  usize lastFill{};                 ///< The buffered bytes after the latest callback.
+  usize minFill{};                  ///< The fewest buffered bytes after a callback.
+  usize capacity{};                 ///< The capacity of the monitored buffer, in bytes.
+  usize finished{};                 ///< The amount of channel finished callbacks.
+  nanoseconds<u64> finishedTime{};  ///< The time spent in channel finished callbacks.
+
+  /**
+   * \brief Returns the mean duration of the audio callbacks.
+   *
+   * \return the mean duration; zero if no callbacks have been recorded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto mean_time() const noexcept -> nanoseconds<u64>
+  {
+    return callbacks != 0 ? totalTime / callbacks : nanoseconds<u64>{};
+  }
+
+  /**
+   * \brief Returns the fill level of the monitored buffer after the latest callback.
+   *
+   * \return the fill level, in the range [0, 1]; zero if there is no monitored buffer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto fill_ratio() const noexcept -> double
+  {
+    return capacity != 0 ? static_cast<double>(lastFill) / static_cast<double>(capacity)
+                         : 0.0;
+  }
+};
+
+/**
+ * \class audio_monitor
+ *
+ * \brief Records the timing of audio callbacks, without locks.
+ *
+ * \details Crackling audio is usually caused by audio callbacks that take too long, or by
+ * streams that run out of decoded data. An audio monitor can be attached to the hooks
+ * provided by the library, e.g. `music_stream` and `mixer_hook`, and to the channel
+ * finished callback, which then record their durations, fill levels and underruns. The
+ * recorded statistics can be read from any thread at any time.
+ *
+ * \code{cpp}
+ *   cen::audio_monitor monitor;
+ *   stream.set_monitor(&monitor);
+ *
+ *   // Once per frame, on the main thread
+ *   const auto stats = monitor.stats();
+ *   overlay.show("Audio: %zu underruns", stats.underruns);
+ * \endcode
+ *
+ * \note The statistics are updated individually, so a snapshot may mix values from two
+ * subsequent callbacks. The monitor must outlive the hooks that it is attached to.
+ *
+ * \since 6.4.0
+ */
+class audio_monitor final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \class scope
+   *
+   * \brief Records the duration of an audio callback, when it goes out of scope.
+   *
+   * \details A scope without a monitor doesn't do anything, so hooks can use scopes
+   * unconditionally.
+   *
+   * \since 6.4.0
+   */
+  class scope final
+  {
+   public:
+    /**
+     * \brief Starts timing an audio callback.
+     *
+     * \param monitor the monitor that records the callback, can safely be null.
+     *
+     * \since 6.4.0
+     */
+    explicit scope(audio_monitor* monitor) noexcept
+        : m_monitor{monitor}
+        , m_start{monitor ? SDL_GetPerformanceCounter() : 0}
+    {}
+
+    scope(const scope&) = delete;
+    auto operator=(const scope&) -> scope& = delete;
+
+    ~scope() noexcept
+    {
+      if (m_monitor) {
+        m_monitor->record_callback(SDL_GetPerformanceCounter() - m_start);
+      }
+    }
+
+   private:
+    audio_monitor* m_monitor{};
+    u64 m_start{};
+  };
+
+  audio_monitor() noexcept : m_frequency{SDL_GetPerformanceFrequency()}
+  {}
+
+  audio_monitor(const audio_monitor&) = delete;
+  auto operator=(const audio_monitor&) -> audio_monitor& = delete;
+
+  /**
+   * \brief Records the fill level of a buffer, after an audio callback consumed from it.
+   *
+   * \param buffered the amount of bytes left in the buffer.
+   * \param capacity the capacity of the buffer, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void record_fill(const size_type buffered, const size_type capacity) noexcept
+  {
+    m_lastFill.store(buffered, std::memory_order_relaxed);
+    m_capacity.store(capacity, std::memory_order_relaxed);
+
+    auto min = m_minFill.load(std::memory_order_relaxed);
+    while (buffered < min &&
+           !m_minFill.compare_exchange_weak(min, buffered, std::memory_order_relaxed))
+    {}
+  }
+
+  /**
+   * \brief Records an audio callback that ran out of data.
+   *
+   * \since 6.4.0
+   */
+  void record_underrun() noexcept
+  {
+    m_underruns.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Records the duration of a channel finished callback.
+   *
+   * \param ticks the duration, in performance counter ticks.
+   *
+   * \since 6.4.0
+   */
+  void record_finished(const u64 ticks) noexcept
+  {
+    m_finished.fetch_add(1, std::memory_order_relaxed);
+    m_finishedTicks.fetch_add(ticks, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns a snapshot of the recorded statistics.
+   *
+   * \return the current statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> audio_stats
+  {
+    audio_stats result;
+
+    result.callbacks = m_callbacks.load(std::memory_order_relaxed);
+    result.totalTime = to_ns(m_totalTicks.load(std::memory_order_relaxed));
+    result.maxTime = to_ns(m_maxTicks.load(std::memory_order_relaxed));
+    result.lastTime = to_ns(m_lastTicks.load(std::memory_order_relaxed));
+    result.underruns = m_underruns.load(std::memory_order_relaxed);
+    result.lastFill = m_lastFill.load(std::memory_order_relaxed);
+    result.capacity = m_capacity.load(std::memory_order_relaxed);
+    result.finished = m_finished.load(std::memory_order_relaxed);
+    result.finishedTime = to_ns(m_finishedTicks.load(std::memory_order_relaxed));
+
+    const auto min = m_minFill.load(std::memory_order_relaxed);
+    result.minFill = min != no_fill ? min : 0;
+
+    return result;
+  }
+
+  /**
+   * \brief Clears the recorded statistics.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_callbacks.store(0, std::memory_order_relaxed);
+    m_totalTicks.store(0, std::memory_order_relaxed);
+    m_maxTicks.store(0, std::memory_order_relaxed);
+    m_lastTicks.store(0, std::memory_order_relaxed);
+    m_underruns.store(0, std::memory_order_relaxed);
+    m_lastFill.store(0, std::memory_order_relaxed);
+    m_minFill.store(no_fill, std::memory_order_relaxed);
+    m_capacity.store(0, std::memory_order_relaxed);
+    m_finished.store(0, std::memory_order_relaxed);
+    m_finishedTicks.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  inline constexpr static size_type no_fill = static_cast<size_type>(-1);
+
+  u64 m_frequency{};
+  std::atomic<size_type> m_callbacks{};
+  std::atomic<u64> m_totalTicks{};
+  std::atomic<u64> m_maxTicks{};
+  std::atomic<u64> m_lastTicks{};
+  std::atomic<size_type> m_underruns{};
+  std::atomic<size_type> m_lastFill{};
+  std::atomic<size_type> m_minFill{no_fill};
+  std::atomic<size_type> m_capacity{};
+  std::atomic<size_type> m_finished{};
+  std::atomic<u64> m_finishedTicks{};
+
+  void record_callback(const u64 ticks) noexcept
+  {
+    m_callbacks.fetch_add(1, std::memory_order_relaxed);
+    m_totalTicks.fetch_add(ticks, std::memory_order_relaxed);
+    m_lastTicks.store(ticks, std::memory_order_relaxed);
+
+    auto max = m_maxTicks.load(std::memory_order_relaxed);
+    while (ticks > max &&
+           !m_maxTicks.compare_exchange_weak(max, ticks, std::memory_order_relaxed))
+    {}
+  }
+
+  [[nodiscard]] auto to_ns(const u64 ticks) const noexcept -> nanoseconds<u64>
+  {
+    // Split the conversion to avoid overflowing for long total durations
+    const auto seconds = ticks / m_frequency;
+    const auto remainder = ticks % m_frequency;
+    return nanoseconds<u64>{seconds * 1'000'000'000 +
+                            remainder * 1'000'000'000 / m_frequency};
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_AUDIO_MONITOR_HEADER
@@ -0,0 +1,427 @@
+#ifndef CENTURION_CAPTURE_DEVICE_HEADER
+#define CENTURION_CAPTURE_DEVICE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <atomic>    // atomic, memory_order
+#include <cassert>   // assert
+#include <optional>  // optional, nullopt
+#include <string>    // string
+#include <utility>   // move
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/spsc_byte_ring.hpp"
+#include "../events/audio_device_event.hpp"
+#include "../events/event_type.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct capture_spec
+ *
+ * \brief Describes the format of the samples recorded by a `capture_device`.
+ *
+ * \details The defaults describe mono floating-point samples at 48 kHz, delivered in
+ * blocks of 256 frames, i.e. about 5 ms, which is a common choice for voice chat.
+ *
+ * \since 6.4.0
+ */
+struct capture_spec final
+{
+  int frequency{48'000};                 ///< The sample rate, in Hz.
+  SDL_AudioFormat format{AUDIO_F32SYS};  ///< The sample format.
+  u8 channels{1};                        ///< The amount of channels.
+  u16 samples{256};                      ///< The size of the device buffer, in frames.
+};
+
+/**
+ * \class capture_device
+ *
+ * \brief Records samples from an audio capture device, such as a microphone.
+ *
+ * \details The recorded samples are written to a lock-free ring buffer by the audio
+ * thread, and can be read from any other thread without blocking, e.g. by a voice chat
+ * encoder. The device is opened with the requested format, and SDL converts the recorded
+ * samples if the hardware uses a different format.
+ * \code{cpp}
+ *   cen::capture_device microphone;  // The default capture device
+ *   microphone.resume();
+ *
+ *   // On the encoder thread
+ *   std::array<float, 960> frame;
+ *   if (microphone.available() >= frame.size()) {
+ *     microphone.read(frame.data(), frame.size());
+ *   }
+ * \endcode
+ *
+ * \details Capture devices that are unplugged are closed when the corresponding audio
+ * device event is passed to `handle()`, and reopened when a matching device is plugged in
+ * again. Samples that are still in the ring buffer are kept when the device is reopened.
+ *
+ * \note Only a single thread may read samples at a time. All other functions must be
+ * called on the thread that created the device.
+ *
+ * \since 6.4.0
+ */
+class capture_device final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Opens a capture device, which starts out paused.
+   *
+   * \param device the name of the device, as reported by `device_name()`; an empty
+   * string for the default capture device.
+   * \param spec the format of the recorded samples.
+   * \param bufferFrames the minimum amount of frames that the ring buffer can hold, which
+   * determines how long samples can stay unread before they are dropped.
+   *
+   * \throws sdl_error if the device couldn't be opened.
+   *
+   * \since 6.4.0
+   */
+  explicit capture_device(std::string device = {},
+                          const capture_spec& spec = {},
+                          const size_type bufferFrames = 9'600)
+      : m_name{std::move(device)}
+      , m_spec{spec}
+      , m_frameSize{static_cast<size_type>(SDL_AUDIO_BITSIZE(spec.format) / 8) *
+                    spec.channels}
+      , m_ring{bufferFrames * m_frameSize}
+  {
+    assert(spec.channels > 0);
+
+    if (!open()) {
+      throw sdl_error{};
+    }
+  }
+
+  capture_device(const capture_device&) = delete;
+
+  auto operator=(const capture_device&) -> capture_device& = delete;
+
+  /**
+   * \brief Closes the capture device.
+   *
+   * \since 6.4.0
+   */
+  ~capture_device() noexcept
+  {
+    close();
+  }
+
+  /**
+   * \brief Starts recording samples.
+   *
+   * \since 6.4.0
+   */
+  void resume() noexcept
+  {
+    m_paused = false;
+    if (m_id != 0) {
+      SDL_PauseAudioDevice(m_id, 0);
+    }
+  }
+
+  /**
+   * \brief Stops recording samples, keeping the samples that haven't been read.
+   *
+   * \since 6.4.0
+   */
+  void pause() noexcept
+  {
+    m_paused = true;
+    if (m_id != 0) {
+      SDL_PauseAudioDevice(m_id, 1);
+    }
+  }
+
+  /**
+   * \brief Reads recorded samples, without blocking.
+   *
+   * \details This may be called from any thread, but only one thread may read at a time.
+   *
+   * \param data the buffer that the samples will be copied to, with room for at least
+   * `frames` frames of the format described by `spec()`.
+   * \param frames the maximum amount of frames to read.
+   *
+   * \return the amount of frames that were read, which is less than requested if there
+   * aren't enough recorded samples.
+   *
+   * \since 6.4.0
+   */
+  auto read(void* data, const size_type frames) noexcept -> size_type
+  {
+    const auto available = m_ring.size() / m_frameSize;
+    const auto count = (frames < available) ? frames : available;
+
+    return m_ring.read(static_cast<u8*>(data), count * m_frameSize) / m_frameSize;
+  }
+
+  /**
+   * \brief Discards recorded samples, e.g. to catch up after falling behind.
+   *
+   * \details This has the same threading requirements as `read()`.
+   *
+   * \param frames the maximum amount of frames to discard.
+   *
+   * \return the amount of frames that were discarded.
+   *
+   * \since 6.4.0
+   */
+  auto skip(const size_type frames) noexcept -> size_type
+  {
+    const auto available = m_ring.size() / m_frameSize;
+    const auto count = (frames < available) ? frames : available;
+
+    return m_ring.skip(count * m_frameSize) / m_frameSize;
+  }
+
+  /**
+   * \brief Updates the device in response to an audio device event.
+   *
+   * \details The device is closed if it was removed, and reopened if a matching capture
+   * device is added while the device is disconnected. Events for output devices, and for
+   * other capture devices, are ignored.
+   *
+   * \param event the audio device event.
+   *
+   * \return `true` if the device was closed or reopened; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto handle(const audio_device_event& event) noexcept -> bool
+  {
+    if (!event.capture()) {
+      return false;
+    }
+
+    // Removal events use device IDs, but addition events use device indices
+    if (event.type() == event_type::audio_device_removed) {
+      if (m_id != 0 && event.which() == m_id) {
+        close();
+        return true;
+      }
+    }
+    else if (event.type() == event_type::audio_device_added && m_id == 0) {
+      const auto* name = SDL_GetAudioDeviceName(static_cast<int>(event.which()), 1);
+      if (m_name.empty() || (name && m_name == name)) {
+        return open();
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Returns the amount of recorded frames that can be read.
+   *
+   * \return the amount of unread frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto available() const noexcept -> size_type
+  {
+    return m_ring.size() / m_frameSize;
+  }
+
+  /**
+   * \brief Returns the amount of frames that can be stored in the ring buffer.
+   *
+   * \return the ring buffer capacity, in frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_ring.capacity() / m_frameSize;
+  }
+
+  /**
+   * \brief Returns the amount of recorded frames that were dropped, because the ring
+   * buffer was full.
+   *
+   * \return the amount of dropped frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> u64
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Indicates whether or not the device is open.
+   *
+   * \return `true` if the device is connected; `false` if it has been unplugged.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_connected() const noexcept -> bool
+  {
+    return m_id != 0;
+  }
+
+  /**
+   * \brief Indicates whether or not the device is paused.
+   *
+   * \return `true` if recording is paused; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_paused() const noexcept -> bool
+  {
+    return m_paused;
+  }
+
+  /**
+   * \brief Returns the SDL audio device ID of the open device.
+   *
+   * \return the device ID; zero if the device is disconnected.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto id() const noexcept -> SDL_AudioDeviceID
+  {
+    return m_id;
+  }
+
+  /**
+   * \brief Returns the name of the requested device.
+   *
+   * \return the device name; an empty string for the default device.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto name() const noexcept -> const std::string&
+  {
+    return m_name;
+  }
+
+  /**
+   * \brief Returns the format of the recorded samples.
+   *
+   * \return the capture format.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto spec() const noexcept -> const capture_spec&
+  {
+    return m_spec;
+  }
+
+  /**
+   * \brief Returns the size of a frame, i.e. a sample for each channel.
+   *
+   * \return the frame size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto frame_size() const noexcept -> size_type
+  {
+    return m_frameSize;
+  }
+
+  /**
+   * \brief Returns the amount of available capture devices.
+   *
+   * \return the amount of capture devices; `std::nullopt` if the amount is unknown.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto device_count() noexcept -> std::optional<int>
+  {
+    const auto count = SDL_GetNumAudioDevices(1);
+    if (count != -1) {
+      return count;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Returns the name of a capture device.
+   *
+   * \param index the index of the capture device, in the range [0, `device_count()`).
+   *
+   * \return the device name; `std::nullopt` if the index is invalid.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto device_name(const int index) -> std::optional<std::string>
+  {
+    if (const auto* name = SDL_GetAudioDeviceName(index, 1)) {
+      return std::string{name};
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+ private:
+  std::string m_name;
+  capture_spec m_spec;
+  size_type m_frameSize{};
+  detail::spsc_byte_ring m_ring;
+  std::atomic<u64> m_dropped{};
+  SDL_AudioDeviceID m_id{};
+  bool m_paused{true};
+
+  auto open() noexcept -> bool
+  {
+    SDL_AudioSpec desired{};
+    desired.freq = m_spec.frequency;
+    desired.format = m_spec.format;
+    desired.channels = m_spec.channels;
+    desired.samples = m_spec.samples;
+    desired.callback = &capture_device::callback;
+    desired.userdata = this;
+
+    // Any differences from the requested format are converted by SDL
+    SDL_AudioSpec obtained{};
+    const auto* device = m_name.empty() ? nullptr : m_name.c_str();
+    m_id = SDL_OpenAudioDevice(device, 1, &desired, &obtained, 0);
+
+    if (m_id != 0 && !m_paused) {
+      SDL_PauseAudioDevice(m_id, 0);
+    }
+
+    return m_id != 0;
+  }
+
+  void close() noexcept
+  {
+    if (m_id != 0) {
+      SDL_CloseAudioDevice(m_id);  // Waits for a running callback to finish
+      m_id = 0;
+    }
+  }
+
+  static void callback(void* data, Uint8* stream, const int length) noexcept
+  {
+    auto& self = *static_cast<capture_device*>(data);
+
+    // Only whole frames are written, so that the reader never sees a partial frame
+    const auto size = static_cast<size_type>(length);
+    const auto room = self.m_ring.capacity() - self.m_ring.size();
+    const auto count = (size < room) ? size : room;
+    const auto written = self.m_ring.write(stream, count - count % self.m_frameSize);
+
+    if (written != size) {
+      const auto frames = (size - written) / self.m_frameSize;
+      self.m_dropped.fetch_add(frames, std::memory_order_relaxed);
+    }
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_CAPTURE_DEVICE_HEADER
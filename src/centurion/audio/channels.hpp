@@ -6,10 +6,12 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 
+#include <atomic>    // atomic, memory_order
 #include <optional>  // optional
 
 #include "../core/result.hpp"
 #include "../core/time.hpp"
+#include "audio_monitor.hpp"
 
 namespace cen {
 
@@ -24,6 +26,28 @@ using channel_finished_callback = void(SDLCALL*)(channel_index) noexcept;
 
 /// \} End of group audio
 
+/// \cond FALSE
+namespace detail {
+
+inline std::atomic<channel_finished_callback> finished_callback{};
+inline std::atomic<audio_monitor*> finished_monitor{};
+
+inline void SDLCALL on_monitored_finished(const channel_index channel) noexcept
+{
+  const auto start = SDL_GetPerformanceCounter();
+
+  if (auto* callback = finished_callback.load(std::memory_order_acquire)) {
+    callback(channel);
+  }
+
+  if (auto* monitor = finished_monitor.load(std::memory_order_acquire)) {
+    monitor->record_finished(SDL_GetPerformanceCounter() - start);
+  }
+}
+
+}  // namespace detail
+/// \endcond
+
 /// \namespace cen::channels
 /// \brief Contains functions related to audio channels.
 /// \ingroup audio
@@ -48,9 +72,32 @@ namespace channels {
  */
 inline void on_finished(channel_finished_callback callback) noexcept
 {
+  detail::finished_monitor.store(nullptr, std::memory_order_release);
   Mix_ChannelFinished(callback);
 }
 
+/**
+ * \brief Assigns a callback for when a channel finishes its playback, which is timed by a
+ * monitor.
+ *
+ * \details The monitor records the amount of invocations of the callback, and the time
+ * spent in the callback.
+ *
+ * \param callback the callback that will be used; can safely be null to only count the
+ * finished channels.
+ * \param monitor the monitor that records the callbacks, must outlive the callback.
+ *
+ * \see `audio_monitor`
+ *
+ * \since 6.4.0
+ */
+inline void on_finished(channel_finished_callback callback, audio_monitor& monitor) noexcept
+{
+  detail::finished_callback.store(callback, std::memory_order_release);
+  detail::finished_monitor.store(&monitor, std::memory_order_release);
+  Mix_ChannelFinished(&detail::on_monitored_finished);
+}
+
 /**
  * \brief Changes the amount of channels managed by the mixer.
  *
@@ -0,0 +1,374 @@
+#ifndef CENTURION_MIXER_HOOK_HEADER
+#define CENTURION_MIXER_HOOK_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <atomic>       // atomic, memory_order
+#include <memory>       // unique_ptr, make_unique
+#include <type_traits>  // is_nothrow_copy_assignable_v, is_nothrow_default_constructible_v
+
+#include "../core/integers.hpp"
+#include "../detail/concurrent_utils.hpp"
+#include "../detail/mix_kernels.hpp"
+#include "audio_monitor.hpp"
+#include "music.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/// \name Sample functions
+/// \{
+
+/**
+ * \brief Scales 16-bit samples in place, saturating the results.
+ *
+ * \param samples the samples that will be scaled.
+ * \param count the amount of samples.
+ * \param gain the factor that the samples are multiplied with.
+ *
+ * \since 6.4.0
+ */
+inline void apply_gain(i16* samples, const usize count, const float gain) noexcept
+{
+  detail::gain_s16(samples, static_cast<int>(count), gain);
+}
+
+/// \copydoc apply_gain(i16*, usize, float)
+inline void apply_gain(float* samples, const usize count, const float gain) noexcept
+{
+  detail::gain_f32(samples, static_cast<int>(count), gain);
+}
+
+/**
+ * \brief Adds scaled 16-bit samples to a buffer, saturating the results.
+ *
+ * \param target the buffer that the samples are added to.
+ * \param source the samples that will be added.
+ * \param count the amount of samples.
+ * \param gain the factor that the source samples are multiplied with.
+ *
+ * \since 6.4.0
+ */
+inline void mix_samples(i16* target,
+                        const i16* source,
+                        const usize count,
+                        const float gain = 1.0f) noexcept
+{
+  detail::mix_s16(target, source, static_cast<int>(count), gain);
+}
+
+/**
+ * \brief Adds scaled floating-point samples to a buffer.
+ *
+ * \details The results are not clamped, use `clamp_samples()` once all sources have been
+ * mixed.
+ *
+ * \param target the buffer that the samples are added to.
+ * \param source the samples that will be added.
+ * \param count the amount of samples.
+ * \param gain the factor that the source samples are multiplied with.
+ *
+ * \since 6.4.0
+ */
+inline void mix_samples(float* target,
+                        const float* source,
+                        const usize count,
+                        const float gain = 1.0f) noexcept
+{
+  detail::mix_f32(target, source, static_cast<int>(count), gain);
+}
+
+/**
+ * \brief Clamps floating-point samples to the range [-1, 1].
+ *
+ * \param samples the samples that will be clamped.
+ * \param count the amount of samples.
+ *
+ * \since 6.4.0
+ */
+inline void clamp_samples(float* samples, const usize count) noexcept
+{
+  detail::clamp_f32(samples, static_cast<int>(count));
+}
+
+/// \} End of sample functions
+
+/**
+ * \class mixer_hook
+ *
+ * \brief Installs a custom mixer as the music hook, which receives commands without locks.
+ *
+ * \details A mixer hook owns a lock-free queue of commands, which are sent by the game
+ * thread and applied by the audio thread right before each buffer is mixed. This makes it
+ * possible to change the parameters of a custom mixer, e.g. volume, filters or ducking,
+ * without any locks in the audio callback.
+ *
+ * \details The mixer type must provide a `command_type` alias, and the following member
+ * functions, which are called on the audio thread.
+ * \code{cpp}
+ *   void apply(const command_type& command) noexcept;
+ *   void mix(u8* stream, usize size) noexcept;
+ * \endcode
+ *
+ * \details The mixer receives the buffer of the audio callback, which contains silence
+ * in the format of the opened audio device. The sample functions, e.g. `mix_samples()`,
+ * are vectorized and are suitable for use in the mixer.
+ *
+ * \code{cpp}
+ *   struct ducking_mixer final
+ *   {
+ *     using command_type = float;  // The new music volume
+ *
+ *     void apply(const float volume) noexcept { m_volume = volume; }
+ *
+ *     void mix(cen::u8* stream, const cen::usize size) noexcept
+ *     {
+ *       auto* samples = reinterpret_cast<cen::i16*>(stream);
+ *       m_source.render(m_scratch, size / 2);
+ *       cen::mix_samples(samples, m_scratch, size / 2, m_volume);
+ *     }
+ *     // ...
+ *   };
+ *
+ *   ducking_mixer mixer;
+ *   cen::mixer_hook hook{mixer};
+ *   hook.install();
+ *
+ *   hook.send(0.25f);  // Duck the music during dialogue
+ * \endcode
+ *
+ * \note Commands must be sent by a single thread at a time. The mixer must outlive the
+ * hook. Only one hook can be installed at a time, since the mixer only supports a single
+ * music hook.
+ *
+ * \tparam Mixer the type of the custom mixer.
+ *
+ * \see `music::set_hook()`
+ *
+ * \since 6.4.0
+ */
+template <typename Mixer>
+class mixer_hook final
+{
+ public:
+  using mixer_type = Mixer;
+  using command_type = typename Mixer::command_type;
+  using size_type = usize;
+
+  static_assert(std::is_nothrow_default_constructible_v<command_type>);
+  static_assert(std::is_nothrow_copy_assignable_v<command_type>);
+
+  /**
+   * \brief Creates a mixer hook, without installing it.
+   *
+   * \param mixer the custom mixer that will be invoked by the hook.
+   * \param capacity the maximum amount of pending commands, which is rounded up to the
+   * nearest power of two.
+   *
+   * \since 6.4.0
+   */
+  explicit mixer_hook(Mixer& mixer, const size_type capacity = default_capacity())
+      : m_mixer{&mixer}
+      , m_capacity{detail::ring_capacity(capacity)}
+      , m_mask{m_capacity - 1}
+      , m_commands{std::make_unique<command_type[]>(m_capacity)}
+  {}
+
+  mixer_hook(const mixer_hook&) = delete;
+  mixer_hook(mixer_hook&&) = delete;
+
+  auto operator=(const mixer_hook&) -> mixer_hook& = delete;
+  auto operator=(mixer_hook&&) -> mixer_hook& = delete;
+
+  ~mixer_hook() noexcept
+  {
+    uninstall();
+  }
+
+  /**
+   * \brief Installs the hook, replacing the regular music player.
+   *
+   * \since 6.4.0
+   */
+  void install() noexcept
+  {
+    music::set_hook(&mixer_hook::on_hook, this);
+  }
+
+  /**
+   * \brief Uninstalls the hook, if it is installed, and restores the music player.
+   *
+   * \details The audio callback is guaranteed not to use the mixer once this function
+   * returns.
+   *
+   * \since 6.4.0
+   */
+  void uninstall() noexcept
+  {
+    if (is_installed()) {
+      music::reset_hook();
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the hook is installed.
+   *
+   * \return `true` if the hook is the current music hook; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_installed() const noexcept -> bool
+  {
+    return music::get_hook_data() == this;
+  }
+
+  /**
+   * \brief Sends a command to the mixer, which is applied before the next buffer is mixed.
+   *
+   * \param command the command that will be sent.
+   *
+   * \return `true` if the command was enqueued; `false` if the queue is full.
+   *
+   * \since 6.4.0
+   */
+  auto send(const command_type& command) noexcept -> bool
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+
+    if (head - tail == m_capacity) {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    m_commands[head & m_mask] = command;
+    m_head.store(head + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /**
+   * \brief Applies the pending commands and mixes a buffer, this is done by the hook.
+   *
+   * \details This function may be used to drive the mixer manually, e.g. in tests. It
+   * must not be called while the hook is installed.
+   *
+   * \param stream the buffer that will be mixed into.
+   * \param size the size of the buffer, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void process(u8* stream, const size_type size) noexcept
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    auto tail = m_tail.load(std::memory_order_relaxed);
+
+    for (; tail != head; ++tail) {
+      m_mixer->apply(m_commands[tail & m_mask]);
+    }
+
+    m_tail.store(tail, std::memory_order_release);
+    m_mixer->mix(stream, size);
+  }
+
+  /**
+   * \brief Returns the amount of commands that haven't been applied yet.
+   *
+   * \return the number of pending commands.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> size_type
+  {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    const auto head = m_head.load(std::memory_order_acquire);
+    return head - tail;
+  }
+
+  /**
+   * \brief Returns the amount of commands that were dropped, due to a full queue.
+   *
+   * \return the number of dropped commands.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> size_type
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Sets the monitor that records the timing of the hook.
+   *
+   * \details The monitor records the duration of each audio callback, including the time
+   * spent applying commands, and the amount of pending commands after each callback.
+   *
+   * \param monitor the monitor that will be used, can safely be null to disable the
+   * instrumentation.
+   *
+   * \since 6.4.0
+   */
+  void set_monitor(audio_monitor* monitor) noexcept
+  {
+    m_monitor.store(monitor, std::memory_order_release);
+  }
+
+  /**
+   * \brief Returns the capacity of the command queue.
+   *
+   * \return the maximum amount of pending commands.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the default command queue capacity.
+   *
+   * \return the default capacity.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_capacity() noexcept -> size_type
+  {
+    return 256;
+  }
+
+ private:
+  Mixer* m_mixer{};
+  size_type m_capacity{};
+  size_type m_mask{};
+  std::unique_ptr<command_type[]> m_commands;
+  std::atomic<size_type> m_dropped{};
+  std::atomic<audio_monitor*> m_monitor{};
+  alignas(64) std::atomic<size_type> m_head{};  ///< Written by the sending thread.
+  alignas(64) std::atomic<size_type> m_tail{};  ///< Written by the audio thread.
+
+  static void SDLCALL on_hook(void* data, u8* stream, const int len) noexcept
+  {
+    auto* self = static_cast<mixer_hook*>(data);
+    auto* monitor = self->m_monitor.load(std::memory_order_acquire);
+    const audio_monitor::scope scope{monitor};
+
+    self->process(stream, static_cast<size_type>(len));
+
+    if (monitor) {
+      monitor->record_fill(self->pending(), self->m_capacity);
+    }
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_MIXER_HOOK_HEADER
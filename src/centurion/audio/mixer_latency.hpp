@@ -0,0 +1,237 @@
+#ifndef CENTURION_MIXER_LATENCY_HEADER
+#define CENTURION_MIXER_LATENCY_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <atomic>    // atomic, memory_order
+#include <optional>  // optional, nullopt
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct mixer_spec
+ *
+ * \brief Describes the format of the opened audio device, which may differ from the
+ * requested format.
+ *
+ * \since 6.4.0
+ */
+struct mixer_spec final
+{
+  int frequency{};  ///< The sample rate, in Hz.
+  u16 format{};     ///< The sample format, e.g. `AUDIO_S16SYS`.
+  int channels{};   ///< The amount of output channels.
+
+  /**
+   * \brief Returns the size of a sample frame, i.e. one sample for every channel.
+   *
+   * \return the frame size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto frame_size() const noexcept -> int
+  {
+    return SDL_AUDIO_BITSIZE(format) / 8 * channels;
+  }
+};
+
+/**
+ * \brief Returns the format that the audio device was actually opened with.
+ *
+ * \return the format of the audio device; `std::nullopt` if the audio device isn't open.
+ *
+ * \see `Mix_QuerySpec`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto query_mixer_spec() noexcept -> std::optional<mixer_spec>
+{
+  mixer_spec spec;
+  if (Mix_QuerySpec(&spec.frequency, &spec.format, &spec.channels) != 0) {
+    return spec;
+  }
+  else {
+    return std::nullopt;
+  }
+}
+
+/**
+ * \class mixer_latency_probe
+ *
+ * \brief Measures the buffer size and callback rate of the opened audio device.
+ *
+ * \details The chunk size requested when opening the audio device is only a hint, and
+ * drivers frequently pick different buffer sizes. A latency probe installs a post-mix
+ * callback that records the size of each mixed buffer, and the time between subsequent
+ * callbacks, which reveals the latency that is actually introduced by the mixer.
+ *
+ * \code{cpp}
+ *   cen::config cfg;
+ *   cfg.mixerChunkSize = 256;
+ *
+ *   cen::library centurion{cfg};
+ *   cen::mixer_latency_probe probe;
+ *
+ *   // Later...
+ *   cen::log_info("Buffer latency: %f ms", probe.buffer_latency().count());
+ * \endcode
+ *
+ * \note The reported latency doesn't include the latency of the operating system and
+ * the output hardware, which is outside of the control of SDL.
+ *
+ * \note The mixer only supports a single post-mix callback, so the probe replaces any
+ * previously installed callback and removes it when destroyed.
+ *
+ * \see `config::mixerChunkSize`
+ *
+ * \since 6.4.0
+ */
+class mixer_latency_probe final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Queries the device format, and starts measuring.
+   *
+   * \pre The audio device must be open.
+   *
+   * \since 6.4.0
+   */
+  mixer_latency_probe() noexcept
+      : m_spec{query_mixer_spec().value_or(mixer_spec{})}
+      , m_frequency{SDL_GetPerformanceFrequency()}
+  {
+    Mix_SetPostMix(&mixer_latency_probe::on_post_mix, this);
+  }
+
+  mixer_latency_probe(const mixer_latency_probe&) = delete;
+  mixer_latency_probe(mixer_latency_probe&&) = delete;
+
+  auto operator=(const mixer_latency_probe&) -> mixer_latency_probe& = delete;
+  auto operator=(mixer_latency_probe&&) -> mixer_latency_probe& = delete;
+
+  ~mixer_latency_probe() noexcept
+  {
+    Mix_SetPostMix(nullptr, nullptr);
+  }
+
+  /**
+   * \brief Returns the size of the most recently mixed buffer.
+   *
+   * \return the buffer size in sample frames; zero if no buffer has been mixed yet.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffer_frames() const noexcept -> size_type
+  {
+    const auto frameSize = m_spec.frame_size();
+    return frameSize > 0 ? m_bufferSize.load(std::memory_order_relaxed) /
+                               static_cast<size_type>(frameSize)
+                         : 0;
+  }
+
+  /**
+   * \brief Returns the duration of audio that is held in a single buffer.
+   *
+   * \details This is the minimum latency introduced by the mixer, since a sound effect
+   * that is played right after a buffer has been mixed is heard once the next buffer is
+   * output.
+   *
+   * \return the duration of a buffer; zero if no buffer has been mixed yet.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffer_latency() const noexcept -> milliseconds<double>
+  {
+    if (m_spec.frequency > 0) {
+      const auto frames = static_cast<double>(buffer_frames());
+      return milliseconds<double>{1'000.0 * frames / m_spec.frequency};
+    }
+    else {
+      return milliseconds<double>::zero();
+    }
+  }
+
+  /**
+   * \brief Returns the average time between two subsequent audio callbacks.
+   *
+   * \details This should be close to `buffer_latency()`. Larger values indicate that the
+   * audio callbacks are delayed, e.g. due to an overloaded audio thread.
+   *
+   * \return the smoothed callback interval; zero if fewer than two buffers have been mixed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto callback_interval() const noexcept -> milliseconds<double>
+  {
+    const auto ticks = static_cast<double>(m_interval.load(std::memory_order_relaxed));
+    return milliseconds<double>{1'000.0 * ticks / static_cast<double>(m_frequency)};
+  }
+
+  /**
+   * \brief Returns the amount of buffers that have been mixed since the probe was created.
+   *
+   * \return the number of audio callbacks.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto callback_count() const noexcept -> size_type
+  {
+    return m_callbacks.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the format of the audio device.
+   *
+   * \return the format that was queried when the probe was created.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto spec() const noexcept -> const mixer_spec&
+  {
+    return m_spec;
+  }
+
+ private:
+  mixer_spec m_spec;
+  u64 m_frequency{};
+  std::atomic<size_type> m_bufferSize{};
+  std::atomic<size_type> m_callbacks{};
+  std::atomic<u64> m_interval{};  ///< Exponential moving average, in counter ticks.
+  u64 m_previous{};               ///< Only accessed by the audio thread.
+
+  static void SDLCALL on_post_mix(void* data, u8*, const int len) noexcept
+  {
+    auto* self = static_cast<mixer_latency_probe*>(data);
+    const auto now = SDL_GetPerformanceCounter();
+
+    if (self->m_previous != 0) {
+      const auto elapsed = static_cast<i64>(now - self->m_previous);
+      const auto average = static_cast<i64>(self->m_interval.load(std::memory_order_relaxed));
+      const auto updated = average == 0 ? elapsed : average + (elapsed - average) / 8;
+
+      self->m_interval.store(static_cast<u64>(updated), std::memory_order_relaxed);
+    }
+
+    self->m_previous = now;
+    self->m_bufferSize.store(static_cast<size_type>(len), std::memory_order_relaxed);
+    self->m_callbacks.fetch_add(1, std::memory_order_relaxed);
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_MIXER_LATENCY_HEADER
@@ -3,6 +3,7 @@
 
 #ifndef CENTURION_NO_SDL_MIXER
 
+#include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 
 #include <cassert>   // assert
@@ -20,6 +21,8 @@
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
 #include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/not_null.hpp"
 #include "../core/result.hpp"
 #include "../core/str.hpp"
@@ -28,6 +31,7 @@
 #include "../detail/any_eq.hpp"
 #include "../detail/clamp.hpp"
 #include "../detail/max.hpp"
+#include "../filesystem/file.hpp"
 #include "fade_status.hpp"
 #include "music_type.hpp"
 
@@ -83,8 +87,11 @@ class music final
    *
    * \since 3.0.0
    */
-  explicit music(const not_null<str> file) : m_music{Mix_LoadMUS(file)}
+  explicit music(const not_null<str> file)
   {
+    library::ensure(library_subsystem::mixer);
+
+    m_music.reset(Mix_LoadMUS(file));
     if (!m_music) {
       throw mix_error{};
     }
@@ -102,6 +109,53 @@ class music final
   explicit music(const std::string& file) : music{file.c_str()}
   {}
 
+  /**
+   * \brief Creates a `music` instance that streams from an open file.
+   *
+   * \details Music is decoded while it is played, so the music instance takes ownership of
+   * the file, which makes it possible to stream music from files in packed archives.
+   *
+   * \param source the file that the music is streamed from, must be valid.
+   *
+   * \throws mix_error if the music cannot be loaded.
+   *
+   * \see `Mix_LoadMUS_RW`
+   *
+   * \since 6.4.0
+   */
+  explicit music(file source)
+  {
+    library::ensure(library_subsystem::mixer);
+
+    m_music.reset(Mix_LoadMUS_RW(source.release(), 1));
+    if (!m_music) {
+      throw mix_error{};
+    }
+  }
+
+  /**
+   * \brief Creates a `music` instance that streams from encoded data in memory.
+   *
+   * \details The data is not copied, but decoded while the music is played, so the
+   * supplied buffer must outlive the music instance.
+   *
+   * \param data the encoded music data, e.g. the contents of an OGG file.
+   * \param size the size of the music data, in bytes.
+   *
+   * \throws mix_error if the music cannot be loaded.
+   *
+   * \since 6.4.0
+   */
+  music(const void* data, const usize size)
+  {
+    library::ensure(library_subsystem::mixer);
+
+    m_music.reset(Mix_LoadMUS_RW(SDL_RWFromConstMem(data, static_cast<int>(size)), 1));
+    if (!m_music) {
+      throw mix_error{};
+    }
+  }
+
   /// \} End of construction
 
   /// \name Playback functions
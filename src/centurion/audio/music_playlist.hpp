@@ -0,0 +1,590 @@
+#ifndef CENTURION_MUSIC_PLAYLIST_HEADER
+#define CENTURION_MUSIC_PLAYLIST_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <algorithm>  // min
+#include <atomic>     // atomic, memory_order
+#include <cstring>    // memset
+#include <memory>     // unique_ptr, make_unique
+#include <optional>   // optional, nullopt
+#include <string>     // string
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../filesystem/file.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "audio_monitor.hpp"
+#include "mixer_hook.hpp"
+#include "mixer_latency.hpp"
+#include "music.hpp"
+#include "music_stream.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class music_playlist
+ *
+ * \brief Plays a list of tracks without gaps, and crossfades between them on request.
+ *
+ * \details Switching tracks with the regular music API stops the current track before the
+ * next file is opened, which produces an audible gap. A playlist opens the upcoming track
+ * on a worker thread while the current track is playing, so that its first chunks are
+ * already decoded when the current track ends. The tracks are played by the music hook,
+ * which continues with the upcoming track within the same audio buffer, and which blends
+ * the two tracks when `skip()` is called, so that no file I/O happens on the audio thread.
+ *
+ * \details Each track is streamed with a `music_stream`, so the decoder has the same
+ * requirements as the decoder of a music stream.
+ *
+ * \code{cpp}
+ *   cen::music_playlist playlist{decoder, cen::milliseconds<cen::u32>{3'000}};
+ *   playlist.add("music/intro.pcm");
+ *   playlist.add("music/battle.pcm");
+ *   playlist.set_looping(true);
+ *   playlist.play();
+ *
+ *   // Later, e.g. when the boss appears
+ *   playlist.skip();
+ * \endcode
+ *
+ * \note The audio device must be opened before the playlist is created, and must use
+ * either 16-bit signed or 32-bit floating-point samples in native byte order, otherwise
+ * `play()` fails. Only one playlist, or music hook, can be active at a time.
+ *
+ * \see `music_stream`
+ * \see `music::set_hook()`
+ *
+ * \since 6.4.0
+ */
+class music_playlist final
+{
+ public:
+  using size_type = usize;
+  using decoder_type = music_stream::decoder_type;
+  using ms_type = milliseconds<u32>;
+
+  /**
+   * \brief Creates an empty playlist, and starts the worker thread.
+   *
+   * \param decoder the decoder used by the streams of all tracks, copies the files as is
+   * if it is empty.
+   * \param crossfade the duration of the crossfade performed by `skip()`.
+   * \param capacity the size of the ring buffer of each track, in bytes.
+   *
+   * \throws sdl_error if the worker thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit music_playlist(decoder_type decoder = {},
+                          const ms_type crossfade = ms_type{2'000},
+                          const size_type capacity = music_stream::default_capacity())
+      : m_decoder{std::move(decoder)}
+      , m_spec{query_mixer_spec().value_or(mixer_spec{})}
+      , m_float{m_spec.format == AUDIO_F32SYS}
+      , m_supported{m_float || m_spec.format == AUDIO_S16SYS}
+      , m_capacity{capacity}
+      , m_scratch{std::make_unique<u8[]>(2 * scratch_size)}
+  {
+    set_crossfade(crossfade);
+    m_worker = std::make_unique<thread>(&music_playlist::run, "music_playlist", this);
+  }
+
+  music_playlist(const music_playlist&) = delete;
+  music_playlist(music_playlist&&) = delete;
+
+  auto operator=(const music_playlist&) -> music_playlist& = delete;
+  auto operator=(music_playlist&&) -> music_playlist& = delete;
+
+  /**
+   * \brief Stops the playlist, if it is playing, and stops the worker thread.
+   *
+   * \since 6.4.0
+   */
+  ~music_playlist() noexcept
+  {
+    stop();
+
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.signal();
+    m_worker.reset();
+
+    delete m_current;
+    delete m_next.load(std::memory_order_acquire);
+    delete m_retired.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Appends a track to the playlist.
+   *
+   * \param path the file path of the track.
+   *
+   * \since 6.4.0
+   */
+  void add(std::string path)
+  {
+    {
+      const scoped_lock lock{m_mutex};
+      m_tracks.push_back(std::move(path));
+    }
+
+    m_wake.signal();
+  }
+
+  /**
+   * \brief Starts playing the playlist, by installing it as the music hook.
+   *
+   * \return `success` if the playlist was installed; `failure` if the audio device uses a
+   * sample format other than `AUDIO_S16SYS` or `AUDIO_F32SYS`.
+   *
+   * \since 6.4.0
+   */
+  auto play() noexcept -> result
+  {
+    if (!m_supported) {
+      return failure;
+    }
+
+    music::set_hook(&music_playlist::on_hook, this);
+    return success;
+  }
+
+  /**
+   * \brief Stops playing the playlist, if it is playing, and restores the music player.
+   *
+   * \details The playlist resumes where it was stopped.
+   *
+   * \since 6.4.0
+   */
+  void stop() noexcept
+  {
+    if (is_playing()) {
+      music::reset_hook();
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the playlist is installed as the music hook.
+   *
+   * \return `true` if the playlist is playing; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_playing() const noexcept -> bool
+  {
+    return music::get_hook_data() == this;
+  }
+
+  /**
+   * \brief Crossfades from the current track to the upcoming track.
+   *
+   * \details The crossfade starts as soon as the upcoming track has been opened, which is
+   * usually at the next audio callback.
+   *
+   * \since 6.4.0
+   */
+  void skip() noexcept
+  {
+    m_skip.store(true, std::memory_order_release);
+  }
+
+  /**
+   * \brief Sets the duration of the crossfades performed by `skip()`.
+   *
+   * \param duration the crossfade duration, zero results in immediate transitions.
+   *
+   * \since 6.4.0
+   */
+  void set_crossfade(const ms_type duration) noexcept
+  {
+    const auto frameSize = static_cast<u64>(m_spec.frame_size());
+    const auto frames = static_cast<u64>(m_spec.frequency) * duration.count() / 1'000;
+    m_fadeSize.store(static_cast<size_type>(frames * frameSize), std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Sets whether or not the playlist restarts with the first track after the last.
+   *
+   * \param looping `true` if the playlist should loop; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  void set_looping(const bool looping) noexcept
+  {
+    m_looping.store(looping, std::memory_order_relaxed);
+    m_wake.signal();
+  }
+
+  /**
+   * \brief Indicates whether or not the playlist loops.
+   *
+   * \return `true` if the playlist loops; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_looping() const noexcept -> bool
+  {
+    return m_looping.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the index of the track that is currently played.
+   *
+   * \return the index of the current track; `std::nullopt` if no track has been started.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto current_track() const noexcept -> std::optional<size_type>
+  {
+    const auto index = m_playing.load(std::memory_order_acquire);
+    if (index != npos) {
+      return index;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not a crossfade is in progress.
+   *
+   * \return `true` if two tracks are being blended; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_crossfading() const noexcept -> bool
+  {
+    return m_fading.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the amount of tracks that have been started.
+   *
+   * \return the number of started tracks.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto transitions() const noexcept -> size_type
+  {
+    return m_transitions.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of tracks that couldn't be opened, and were skipped.
+   *
+   * \return the number of failed tracks.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto failures() const noexcept -> size_type
+  {
+    return m_failures.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Sets the monitor that records the timing of the music hook of the playlist.
+   *
+   * \details The monitor records the duration of each audio callback, the amount of
+   * buffered data of the current track after each callback, and underruns.
+   *
+   * \param monitor the monitor that will be used, can safely be null to disable the
+   * instrumentation.
+   *
+   * \since 6.4.0
+   */
+  void set_monitor(audio_monitor* monitor) noexcept
+  {
+    m_monitor.store(monitor, std::memory_order_release);
+  }
+
+  /**
+   * \brief Returns the amount of tracks in the playlist.
+   *
+   * \return the number of tracks.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const -> size_type
+  {
+    const scoped_lock lock{m_mutex};
+    return m_tracks.size();
+  }
+
+  /**
+   * \brief Mixes the tracks into an audio buffer, this is done by the music hook.
+   *
+   * \details This function may be used to drive the playlist manually, e.g. in tests. It
+   * must not be called while the playlist is playing.
+   *
+   * \param stream the buffer that will be filled, which must contain silence.
+   * \param size the size of the buffer, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void process(u8* stream, const size_type size) noexcept
+  {
+    size_type offset = 0;
+    while (offset < size) {
+      const auto block = std::min(size - offset, scratch_size);
+      render(stream + offset, block);
+      offset += block;
+    }
+  }
+
+ private:
+  inline constexpr static size_type npos = static_cast<size_type>(-1);
+  inline constexpr static size_type scratch_size = 4'096;
+  inline constexpr static size_type ramp_size = 256;  ///< Bytes mixed with the same gain.
+  inline constexpr static u32 poll_interval = 5;      ///< In milliseconds.
+
+  struct deck final
+  {
+    std::unique_ptr<music_stream> stream;
+    size_type index{};
+  };
+
+  decoder_type m_decoder;
+  mixer_spec m_spec;
+  bool m_float{};
+  bool m_supported{};  ///< Indicates whether the samples are 16-bit integers or floats.
+  size_type m_capacity{};
+  std::unique_ptr<u8[]> m_scratch;  ///< Only accessed by the audio callback.
+  std::vector<std::string> m_tracks;
+  size_type m_cursor{};                ///< The next track to open, guarded by the mutex.
+  deck* m_current{};                   ///< Only accessed by the audio callback.
+  std::atomic<deck*> m_next{};         ///< Written by the worker when null.
+  std::atomic<deck*> m_retired{};      ///< Written by the audio callback when null.
+  size_type m_fadePosition{};          ///< Only accessed by the audio callback.
+  size_type m_fadeLength{};            ///< Only accessed by the audio callback.
+  std::atomic<size_type> m_fadeSize{};
+  std::atomic<size_type> m_playing{npos};
+  std::atomic<size_type> m_transitions{};
+  std::atomic<size_type> m_failures{};
+  std::atomic<audio_monitor*> m_monitor{};
+  std::atomic<bool> m_skip{};
+  std::atomic<bool> m_fading{};
+  std::atomic<bool> m_looping{};
+  mutable mutex m_mutex;
+  condition m_wake;
+  bool m_stop{};
+  std::unique_ptr<thread> m_worker;  // Last, so that the worker stops first
+
+  static void SDLCALL on_hook(void* data, u8* stream, const int len) noexcept
+  {
+    auto* self = static_cast<music_playlist*>(data);
+    auto* monitor = self->m_monitor.load(std::memory_order_acquire);
+    const audio_monitor::scope scope{monitor};
+
+    // The mixer fills the stream with silence before invoking the hook
+    self->process(stream, static_cast<size_type>(len));
+
+    if (monitor && self->m_current) {
+      const auto& current = *self->m_current->stream;
+      monitor->record_fill(current.buffered(), current.capacity());
+    }
+  }
+
+  // Replaces the current track with the upcoming track, if it has been opened
+  auto promote() noexcept -> bool
+  {
+    auto* next = m_next.load(std::memory_order_acquire);
+    if (!next || (m_current && m_retired.load(std::memory_order_acquire))) {
+      return false;
+    }
+
+    if (m_current) {
+      m_retired.store(m_current, std::memory_order_release);
+    }
+
+    m_current = next;
+    m_next.store(nullptr, std::memory_order_release);
+
+    m_playing.store(next->index, std::memory_order_release);
+    m_transitions.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+  }
+
+  void mix(u8* target, const u8* source, const size_type size, const float gain) noexcept
+  {
+    if (m_float) {
+      mix_samples(reinterpret_cast<float*>(target),
+                  reinterpret_cast<const float*>(source),
+                  size / sizeof(float),
+                  gain);
+    }
+    else if (m_supported) {
+      mix_samples(reinterpret_cast<i16*>(target),
+                  reinterpret_cast<const i16*>(source),
+                  size / sizeof(i16),
+                  gain);
+    }
+  }
+
+  void render(u8* stream, const size_type size) noexcept
+  {
+    if (!m_current && !promote()) {
+      return;
+    }
+
+    if (m_skip.load(std::memory_order_acquire) && !m_fading.load(std::memory_order_relaxed) &&
+        m_next.load(std::memory_order_acquire))
+    {
+      m_skip.store(false, std::memory_order_relaxed);
+      m_fadePosition = 0;
+      m_fadeLength = m_fadeSize.load(std::memory_order_relaxed);
+
+      if (m_fadeLength != 0) {
+        m_fading.store(true, std::memory_order_release);
+      }
+      else if (!promote()) {
+        m_skip.store(true, std::memory_order_relaxed);  // Retry at the next buffer
+      }
+    }
+
+    if (m_fading.load(std::memory_order_relaxed)) {
+      crossfade(stream, size);
+      return;
+    }
+
+    // Gapless transitions continue with the upcoming track in the same buffer
+    const auto amount = m_current->stream->read(stream, size);
+    if (amount < size && m_current->stream->is_finished() && promote()) {
+      m_current->stream->read(stream + amount, size - amount);
+    }
+    else if (amount < size && !m_current->stream->is_finished()) {
+      if (auto* monitor = m_monitor.load(std::memory_order_acquire)) {
+        monitor->record_underrun();
+      }
+    }
+  }
+
+  void crossfade(u8* stream, const size_type size) noexcept
+  {
+    auto* outgoing = m_scratch.get();
+    auto* incoming = m_scratch.get() + scratch_size;
+    auto* next = m_next.load(std::memory_order_acquire);
+
+    const auto outgoingSize = m_current->stream->read(outgoing, size);
+    const auto incomingSize = next->stream->read(incoming, size);
+
+    std::memset(outgoing + outgoingSize, 0, size - outgoingSize);
+    std::memset(incoming + incomingSize, 0, size - incomingSize);
+    std::memset(stream, 0, size);
+
+    for (size_type offset = 0; offset < size; offset += ramp_size) {
+      const auto amount = std::min(ramp_size, size - offset);
+      const auto position = std::min(m_fadePosition + offset, m_fadeLength);
+      const auto t = static_cast<float>(position) / static_cast<float>(m_fadeLength);
+
+      mix(stream + offset, outgoing + offset, amount, 1.0f - t);
+      mix(stream + offset, incoming + offset, amount, t);
+    }
+
+    m_fadePosition += size;
+    if (m_fadePosition >= m_fadeLength && promote()) {
+      m_fading.store(false, std::memory_order_release);
+    }
+  }
+
+  // Only called by the worker, with the mutex locked
+  [[nodiscard]] auto next_track() -> std::optional<std::string>
+  {
+    if (m_cursor == m_tracks.size() && m_looping.load(std::memory_order_relaxed)) {
+      m_cursor = 0;
+    }
+
+    if (m_cursor < m_tracks.size()) {
+      return m_tracks[m_cursor++];
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  // Only called by the worker, opens the upcoming track if there is none
+  void prepare()
+  {
+    std::unique_ptr<deck> retired{m_retired.exchange(nullptr, std::memory_order_acq_rel)};
+    retired.reset();  // Joins the decoder thread of the finished track
+
+    if (m_next.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    std::optional<std::string> path;
+    size_type index{};
+    {
+      const scoped_lock lock{m_mutex};
+      path = next_track();
+      index = m_cursor - 1;
+    }
+
+    if (!path) {
+      return;
+    }
+
+    file source{*path, file_mode::read_existing_binary};
+    if (!source) {
+      m_failures.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    auto upcoming = std::make_unique<deck>();
+    upcoming->stream =
+        std::make_unique<music_stream>(std::move(source), m_decoder, m_capacity);
+    upcoming->index = index;
+
+    m_next.store(upcoming.release(), std::memory_order_release);
+  }
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<music_playlist*>(data);
+
+    self.m_mutex.lock();
+
+    while (!self.m_stop) {
+      self.m_mutex.unlock();
+
+      try {
+        self.prepare();
+      }
+      catch (...) {
+        self.m_failures.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      self.m_mutex.lock();
+
+      // The audio callback must not block, so the worker polls for finished tracks
+      if (!self.m_stop) {
+        self.m_wake.wait(self.m_mutex, milliseconds<u32>{poll_interval});
+      }
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_MUSIC_PLAYLIST_HEADER
@@ -0,0 +1,441 @@
+#ifndef CENTURION_MUSIC_STREAM_HEADER
+#define CENTURION_MUSIC_STREAM_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <algorithm>   // min
+#include <atomic>      // atomic, memory_order
+#include <cassert>     // assert
+#include <cstring>     // memcpy
+#include <functional>  // function
+#include <memory>      // unique_ptr, make_unique
+#include <utility>     // move
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../detail/concurrent_utils.hpp"
+#include "../filesystem/file.hpp"
+#include "../filesystem/seek_mode.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "audio_monitor.hpp"
+#include "music.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class music_stream
+ *
+ * \brief Streams music from a file, without loading the entire file into memory.
+ *
+ * \details Some music formats are read into memory in their entirety by `Mix_LoadMUS()`,
+ * which is a problem for long tracks on devices with little memory. A music stream
+ * decodes a file in fixed-size chunks on a worker thread, into a lock-free ring buffer
+ * that is consumed by the music hook of the mixer, so that only the ring buffer and a
+ * single chunk are resident at any time.
+ *
+ * \details The decoder is a function object that fills a buffer with PCM data in the
+ * format of the opened audio device, and returns the amount of written bytes, where zero
+ * indicates the end of the stream. The default decoder copies the file as is, which is
+ * suitable for raw PCM files. Decoders for compressed formats, e.g. a FLAC decoder that
+ * reads from the file, can be supplied instead.
+ *
+ * \code{cpp}
+ *   cen::music_stream stream{cen::file{"theme.pcm", cen::file_mode::read_existing_binary}};
+ *   stream.set_looping(true);
+ *   stream.play();
+ * \endcode
+ *
+ * \note The audio device must be opened before the stream starts playing. Only one
+ * stream, or music hook, can be active at a time, since the mixer only supports a single
+ * music hook. Streams replace the regular music player while playing.
+ *
+ * \see `music::set_hook()`
+ *
+ * \since 6.4.0
+ */
+class music_stream final
+{
+ public:
+  using size_type = usize;
+
+  /// Decodes at most `size` bytes of PCM data into `buffer`, must not throw.
+  using decoder_type = std::function<size_type(file& source, u8* buffer, size_type size)>;
+
+  /**
+   * \brief Creates a music stream, and starts decoding into the ring buffer.
+   *
+   * \pre `source` must be a valid file.
+   * \pre `chunkSize` must be greater than zero, and not greater than `capacity`.
+   *
+   * \param source the file that will be streamed.
+   * \param decoder the function object used to decode chunks, copies the file as is if
+   * it is empty.
+   * \param capacity the size of the ring buffer in bytes, rounded up to the nearest
+   * power of two.
+   * \param chunkSize the maximum amount of bytes decoded at once.
+   *
+   * \throws sdl_error if the worker thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit music_stream(file source,
+                        decoder_type decoder = {},
+                        const size_type capacity = default_capacity(),
+                        const size_type chunkSize = default_chunk_size())
+      : m_source{std::move(source)}
+      , m_decoder{std::move(decoder)}
+      , m_capacity{detail::ring_capacity(capacity)}
+      , m_mask{m_capacity - 1}
+      , m_chunkSize{chunkSize}
+      , m_buffer{std::make_unique<u8[]>(m_capacity)}
+      , m_chunk{std::make_unique<u8[]>(m_chunkSize)}
+  {
+    assert(m_source);
+    assert(chunkSize > 0);
+    assert(chunkSize <= m_capacity);
+
+    if (!m_decoder) {
+      m_decoder = [](file& stream, u8* buffer, const size_type size) {
+        return stream.read_to(buffer, size);
+      };
+    }
+
+    m_worker = std::make_unique<thread>(&music_stream::run, "music_stream", this);
+  }
+
+  music_stream(const music_stream&) = delete;
+  music_stream(music_stream&&) = delete;
+
+  auto operator=(const music_stream&) -> music_stream& = delete;
+  auto operator=(music_stream&&) -> music_stream& = delete;
+
+  /**
+   * \brief Stops the stream, if it is playing, and stops the worker thread.
+   *
+   * \since 6.4.0
+   */
+  ~music_stream() noexcept
+  {
+    stop();
+
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.signal();
+    m_worker.reset();
+  }
+
+  /**
+   * \brief Starts playing the stream, by installing it as the music hook.
+   *
+   * \since 6.4.0
+   */
+  void play() noexcept
+  {
+    music::set_hook(&music_stream::on_hook, this);
+  }
+
+  /**
+   * \brief Stops playing the stream, if it is playing, and restores the music player.
+   *
+   * \details The buffered data is kept, so the stream resumes where it was stopped.
+   *
+   * \since 6.4.0
+   */
+  void stop() noexcept
+  {
+    if (is_playing()) {
+      music::reset_hook();
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the stream is installed as the music hook.
+   *
+   * \return `true` if the stream is playing; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_playing() const noexcept -> bool
+  {
+    return music::get_hook_data() == this;
+  }
+
+  /**
+   * \brief Sets whether or not the stream restarts from the beginning of the file.
+   *
+   * \details Decoders are expected to handle the file being rewound to its beginning,
+   * when the end of the stream is reached.
+   *
+   * \param looping `true` if the stream should loop; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  void set_looping(const bool looping) noexcept
+  {
+    m_looping.store(looping, std::memory_order_relaxed);
+    m_wake.signal();
+  }
+
+  /**
+   * \brief Indicates whether or not the stream loops.
+   *
+   * \return `true` if the stream loops; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_looping() const noexcept -> bool
+  {
+    return m_looping.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Indicates whether or not the entire stream has been played.
+   *
+   * \return `true` if the end of the stream has been reached, and all decoded data has
+   * been consumed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_finished() const noexcept -> bool
+  {
+    return m_exhausted.load(std::memory_order_acquire) && buffered() == 0;
+  }
+
+  /**
+   * \brief Returns the amount of decoded data that hasn't been played yet.
+   *
+   * \return the number of buffered bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffered() const noexcept -> size_type
+  {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    const auto head = m_head.load(std::memory_order_acquire);
+    return head - tail;
+  }
+
+  /**
+   * \brief Returns the amount of audio callbacks that couldn't be filled entirely.
+   *
+   * \details Underruns result in silence, and indicate that the decoder is too slow or
+   * that the ring buffer is too small. Underruns after the end of the stream are not
+   * counted.
+   *
+   * \return the number of underruns.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto underruns() const noexcept -> size_type
+  {
+    return m_underruns.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Copies buffered data into an audio buffer, this is done by the music hook.
+   *
+   * \details This function may be used to drive the stream manually, e.g. when mixing
+   * the stream with a custom callback. It must not be called while the stream is playing.
+   *
+   * \param stream the buffer that will be filled with PCM data.
+   * \param size the size of the buffer, in bytes.
+   *
+   * \return the amount of bytes that were copied.
+   *
+   * \since 6.4.0
+   */
+  auto read(u8* stream, const size_type size) noexcept -> size_type
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto amount = std::min(size, head - tail);
+
+    copy_out(tail, stream, amount);
+    m_tail.store(tail + amount, std::memory_order_release);
+
+    if (amount < size && !m_exhausted.load(std::memory_order_acquire)) {
+      m_underruns.fetch_add(1, std::memory_order_relaxed);
+
+      if (auto* monitor = m_monitor.load(std::memory_order_acquire)) {
+        monitor->record_underrun();
+      }
+    }
+
+    return amount;
+  }
+
+  /**
+   * \brief Sets the monitor that records the timing of the music hook of the stream.
+   *
+   * \details The monitor records the duration of each audio callback, the amount of
+   * buffered data after each callback, and underruns.
+   *
+   * \param monitor the monitor that will be used, can safely be null to disable the
+   * instrumentation.
+   *
+   * \since 6.4.0
+   */
+  void set_monitor(audio_monitor* monitor) noexcept
+  {
+    m_monitor.store(monitor, std::memory_order_release);
+  }
+
+  /**
+   * \brief Returns the capacity of the ring buffer.
+   *
+   * \return the maximum amount of buffered bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the default ring buffer capacity, roughly 1.5 seconds of CD audio.
+   *
+   * \return the default capacity, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_capacity() noexcept -> size_type
+  {
+    return 256 * 1'024;
+  }
+
+  /**
+   * \brief Returns the default chunk size.
+   *
+   * \return the default chunk size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_chunk_size() noexcept -> size_type
+  {
+    return 16 * 1'024;
+  }
+
+ private:
+  file m_source;
+  decoder_type m_decoder;
+  size_type m_capacity{};
+  size_type m_mask{};
+  size_type m_chunkSize{};
+  std::unique_ptr<u8[]> m_buffer;
+  std::unique_ptr<u8[]> m_chunk;  ///< Only accessed by the worker.
+  std::atomic<bool> m_looping{};
+  std::atomic<bool> m_exhausted{};
+  std::atomic<size_type> m_underruns{};
+  std::atomic<audio_monitor*> m_monitor{};
+  alignas(64) std::atomic<size_type> m_head{};  ///< Written by the worker.
+  alignas(64) std::atomic<size_type> m_tail{};  ///< Written by the audio callback.
+  mutex m_mutex;
+  condition m_wake;
+  bool m_stop{};
+  std::unique_ptr<thread> m_worker;  // Last, so that the worker stops first
+
+  static void SDLCALL on_hook(void* data, u8* stream, const int len) noexcept
+  {
+    auto* self = static_cast<music_stream*>(data);
+    auto* monitor = self->m_monitor.load(std::memory_order_acquire);
+    const audio_monitor::scope scope{monitor};
+
+    // The mixer fills the stream with silence before invoking the hook
+    self->read(stream, static_cast<size_type>(len));
+
+    if (monitor) {
+      monitor->record_fill(self->buffered(), self->m_capacity);
+    }
+  }
+
+  void copy_out(const size_type tail, u8* stream, const size_type amount) const noexcept
+  {
+    const auto offset = tail & m_mask;
+    const auto first = std::min(amount, m_capacity - offset);
+
+    std::memcpy(stream, m_buffer.get() + offset, first);
+    std::memcpy(stream + first, m_buffer.get(), amount - first);
+  }
+
+  void copy_in(const size_type head, const u8* chunk, const size_type amount) noexcept
+  {
+    const auto offset = head & m_mask;
+    const auto first = std::min(amount, m_capacity - offset);
+
+    std::memcpy(m_buffer.get() + offset, chunk, first);
+    std::memcpy(m_buffer.get(), chunk + first, amount - first);
+  }
+
+  // Only called by the worker, decodes a chunk if there is room for it
+  auto produce() -> bool
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+
+    if (m_capacity - (head - tail) < m_chunkSize) {
+      return false;
+    }
+
+    auto amount = m_decoder(m_source, m_chunk.get(), m_chunkSize);
+
+    if (amount == 0 && m_looping.load(std::memory_order_relaxed) &&
+        m_source.seek(0, seek_mode::from_beginning))
+    {
+      amount = m_decoder(m_source, m_chunk.get(), m_chunkSize);
+    }
+
+    if (amount == 0) {
+      m_exhausted.store(true, std::memory_order_release);
+      return false;
+    }
+
+    m_exhausted.store(false, std::memory_order_release);
+
+    copy_in(head, m_chunk.get(), std::min(amount, m_chunkSize));
+    m_head.store(head + std::min(amount, m_chunkSize), std::memory_order_release);
+
+    return true;
+  }
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<music_stream*>(data);
+
+    self.m_mutex.lock();
+
+    while (!self.m_stop) {
+      self.m_mutex.unlock();
+      const auto produced = self.produce();
+      self.m_mutex.lock();
+
+      // The audio callback must not block, so the worker polls for free space
+      if (!produced && !self.m_stop) {
+        self.m_wake.wait(self.m_mutex, milliseconds<u32>{poll_interval});
+      }
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+
+  inline constexpr static u32 poll_interval = 5;  ///< In milliseconds.
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_MUSIC_STREAM_HEADER
@@ -0,0 +1,112 @@
+#ifndef CENTURION_RESAMPLE_QUALITY_HEADER
+#define CENTURION_RESAMPLE_QUALITY_HEADER
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "../core/exception.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \enum resample_quality
+ *
+ * \brief Provides values that represent the quality of sample rate conversions.
+ *
+ * \details Higher qualities use longer filters, which suppress more of the aliasing and
+ * imaging artifacts caused by resampling, at the cost of longer conversion times.
+ *
+ * \see `sound_bank`
+ * \see `resample_quality_count()`
+ *
+ * \since 6.4.0
+ */
+enum class resample_quality
+{
+  none,      ///< No explicit conversion, the conversion is left to SDL_mixer.
+  fast,      ///< Linear interpolation.
+  balanced,  ///< A 16-tap windowed sinc filter.
+  best       ///< A 48-tap windowed sinc filter.
+};
+
+/**
+ * \brief Returns the number of enumerators for the `resample_quality` enum.
+ *
+ * \return the number of enumerators.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto resample_quality_count() noexcept -> int
+{
+  return 4;
+}
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied resample quality.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(resample_quality::best) == "best"`.
+ *
+ * \param quality the resample quality that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const resample_quality quality) -> std::string_view
+{
+  switch (quality) {
+    case resample_quality::none:
+      return "none";
+
+    case resample_quality::fast:
+      return "fast";
+
+    case resample_quality::balanced:
+      return "balanced";
+
+    case resample_quality::best:
+      return "best";
+
+    default:
+      throw cen_error{"Did not recognize resample quality!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a resample quality enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param quality the resample quality that will be printed.
+ *
+ * \see `to_string(resample_quality)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const resample_quality quality) -> std::ostream&
+{
+  return stream << to_string(quality);
+}
+
+/// \} End of streaming
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_RESAMPLE_QUALITY_HEADER
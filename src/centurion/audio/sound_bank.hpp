@@ -0,0 +1,624 @@
+#ifndef CENTURION_SOUND_BANK_HEADER
+#define CENTURION_SOUND_BANK_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <algorithm>      // min
+#include <atomic>         // atomic, memory_order
+#include <cassert>        // assert
+#include <cstring>        // memcpy
+#include <deque>          // deque
+#include <memory>         // unique_ptr, make_unique
+#include <optional>       // optional, nullopt
+#include <string>         // string
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../detail/pcm_conversion.hpp"
+#include "../detail/resample_kernels.hpp"
+#include "../detail/sdl_deleter.hpp"
+#include "../system/power_profile.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/coroutine.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "resample_quality.hpp"
+#include "sound_effect.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class sound_bank
+ *
+ * \brief Decodes sound effects on worker threads, and shares them by file path.
+ *
+ * \details Loading a sound effect decodes the entire file to PCM data, which is slow for
+ * compressed formats. A sound bank decodes enqueued files on a pool of worker threads,
+ * and only decodes each file once, no matter how many times it is enqueued. The decoded
+ * sound effects are accessed through non-owning `sound_effect_handle` instances, which
+ * all share the same `Mix_Chunk`.
+ *
+ * \details WAV files are converted to the format, sample rate and channel layout of the
+ * mixer by the worker threads, with a filter of the configured `resample_quality`. The
+ * common conversions are vectorized, and the resulting sound effects need no further
+ * conversion, unlike the conversion done by `Mix_LoadWAV()`, which uses a generic
+ * converter. Other file formats are decoded and converted by SDL_mixer.
+ *
+ * \details The amount of memory used by the decoded PCM data is reported by
+ * `resident_bytes()`, and sounds can be released individually with `release()`, e.g. when
+ * a level is unloaded.
+ *
+ * \note All functions, except for the destructor, must be called on the same thread.
+ *
+ * \warning Releasing a sound effect, or destroying the bank, halts all channels that are
+ * playing the affected sound effects, and invalidates their handles.
+ *
+ * \see `image_loader`
+ *
+ * \since 6.4.0
+ */
+class sound_bank final
+{
+ public:
+  using id_type = usize;
+
+  /**
+   * \enum load_status
+   *
+   * \brief Represents the different states of an enqueued sound effect.
+   *
+   * \since 6.4.0
+   */
+  enum class load_status
+  {
+    unknown,  ///< The ID is unknown, or the sound effect has been released.
+    loading,  ///< The sound effect is being decoded.
+    ready,    ///< The sound effect is ready to be played.
+    failed    ///< The sound effect couldn't be decoded.
+  };
+
+  /**
+   * \brief Creates a sound bank and starts its worker threads.
+   *
+   * \param workers the amount of worker threads, must be greater than zero.
+   * \param quality the quality of the sample rate conversion of WAV files.
+   *
+   * \throws sdl_error if the worker threads cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit sound_bank(const usize workers = 2,
+                      const resample_quality quality = resample_quality::balanced)
+      : m_quality{quality}
+  {
+    assert(workers > 0);
+
+    m_workers.reserve(workers);
+    for (usize index = 0; index < workers; ++index) {
+      m_workers.push_back(std::make_unique<thread>(&sound_bank::run, "sound_bank", this));
+    }
+  }
+
+  sound_bank(const sound_bank&) = delete;
+
+  auto operator=(const sound_bank&) -> sound_bank& = delete;
+
+  /**
+   * \brief Stops the worker threads, and frees all sound effects.
+   *
+   * \details Sound effects that are currently being decoded are finished, but sound
+   * effects that are still waiting in the queue are discarded.
+   *
+   * \since 6.4.0
+   */
+  ~sound_bank() noexcept
+  {
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.broadcast();
+    m_workers.clear();
+  }
+
+  /**
+   * \brief Enqueues a sound effect that will be decoded by a worker thread.
+   *
+   * \details Enqueuing a path that has already been enqueued returns the existing ID,
+   * without decoding the file again.
+   *
+   * \param path the file path of the sound effect.
+   *
+   * \return the ID associated with the sound effect.
+   *
+   * \since 6.4.0
+   */
+  auto enqueue(std::string path) -> id_type
+  {
+    id_type id{};
+
+    {
+      scoped_lock lock{m_mutex};
+
+      if (const auto it = m_ids.find(path); it != m_ids.end()) {
+        return it->second;
+      }
+
+      id = m_entries.size();
+      m_ids.try_emplace(path, id);
+      m_entries.push_back(entry{std::move(path), std::nullopt});
+      m_queue.push_back(id);
+    }
+
+    m_wake.signal();
+    return id;
+  }
+
+  /**
+   * \brief Returns a handle to a decoded sound effect.
+   *
+   * \param id the ID of the sound effect, obtained from `enqueue()`.
+   *
+   * \return a handle to the sound effect, which holds a null pointer if it isn't ready.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get(const id_type id) -> sound_effect_handle
+  {
+    scoped_lock lock{m_mutex};
+
+    if (id < m_entries.size() && m_entries[id].sound) {
+      return sound_effect_handle{m_entries[id].sound->get()};
+    }
+    else {
+      return sound_effect_handle{nullptr};
+    }
+  }
+
+  /**
+   * \brief Returns the ID of an enqueued sound effect.
+   *
+   * \param path the file path of the sound effect.
+   *
+   * \return the ID associated with the path; `std::nullopt` if it hasn't been enqueued.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto find(const std::string& path) -> std::optional<id_type>
+  {
+    scoped_lock lock{m_mutex};
+
+    if (const auto it = m_ids.find(path); it != m_ids.end()) {
+      return it->second;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Returns the status of an enqueued sound effect.
+   *
+   * \param id the ID of the sound effect, obtained from `enqueue()`.
+   *
+   * \return the current status of the sound effect.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto status(const id_type id) -> load_status
+  {
+    scoped_lock lock{m_mutex};
+    return id < m_entries.size() ? m_entries[id].status : load_status::unknown;
+  }
+
+  /**
+   * \brief Frees a sound effect, and forgets its path.
+   *
+   * \details A sound effect that is still being decoded is freed once it is decoded.
+   * Enqueuing the same path again decodes the file again, with a new ID.
+   *
+   * \param id the ID of the sound effect, obtained from `enqueue()`.
+   *
+   * \return `true` if the sound effect was released; `false` if the ID is unknown.
+   *
+   * \since 6.4.0
+   */
+  auto release(const id_type id) -> bool
+  {
+    scoped_lock lock{m_mutex};
+
+    if (id >= m_entries.size() || m_entries[id].status == load_status::unknown) {
+      return false;
+    }
+
+    forget(m_entries[id]);
+    return true;
+  }
+
+  /**
+   * \brief Releases sound effects that aren't playing, until a certain amount of memory
+   * has been freed.
+   *
+   * \details The sound effects that were enqueued first are released first, as if by
+   * `release()`. This is used when the bank is registered with a `memory_budget`.
+   *
+   * \warning Handles to released sound effects are invalidated, so handles should be
+   * obtained with `get()` each time a sound effect is played if the bank is trimmed.
+   *
+   * \param bytes the amount of memory that should be freed, in bytes.
+   *
+   * \return the amount of freed memory.
+   *
+   * \since 6.4.0
+   */
+  auto free_memory(const usize bytes) -> usize
+  {
+    scoped_lock lock{m_mutex};
+
+    const auto channels = Mix_AllocateChannels(-1);
+    const auto is_playing = [channels](const Mix_Chunk* chunk) noexcept {
+      for (int channel = 0; channel < channels; ++channel) {
+        if (Mix_Playing(channel) && Mix_GetChunk(channel) == chunk) {
+          return true;
+        }
+      }
+
+      return false;
+    };
+
+    usize freed = 0;
+    for (auto& entry : m_entries) {
+      if (freed >= bytes) {
+        break;
+      }
+
+      if (entry.sound && !is_playing(entry.sound->get())) {
+        freed += entry.sound->get()->alen;
+        forget(entry);
+      }
+    }
+
+    return freed;
+  }
+
+  /**
+   * \brief Blocks until all enqueued sound effects have been decoded.
+   *
+   * \since 6.4.0
+   */
+  void wait()
+  {
+    scoped_lock lock{m_mutex};
+    while (!m_queue.empty() || m_busy != 0) {
+      m_idle.wait(m_mutex);
+    }
+  }
+
+  /**
+   * \brief Returns the amount of memory used by the decoded sound effects.
+   *
+   * \return the total size of the PCM data of all decoded sound effects, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto resident_bytes() -> usize
+  {
+    scoped_lock lock{m_mutex};
+    return m_residentBytes;
+  }
+
+  /**
+   * \brief Returns the amount of sound effects that are ready to be played.
+   *
+   * \return the number of decoded sound effects.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() -> usize
+  {
+    scoped_lock lock{m_mutex};
+    return m_ready;
+  }
+
+  /**
+   * \brief Returns the amount of sound effects that were converted by the bank.
+   *
+   * \details This excludes sound effects that were decoded and converted by SDL_mixer,
+   * i.e. files that aren't WAV files, or all files if the resample quality is `none`.
+   *
+   * \return the number of sound effects converted by the worker threads.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto converted_count() -> usize
+  {
+    scoped_lock lock{m_mutex};
+    return m_converted;
+  }
+
+  /**
+   * \brief Sets the quality of the sample rate conversion of WAV files.
+   *
+   * \details Only files that are decoded after the call are affected, sound effects that
+   * are already resident keep their quality.
+   *
+   * \param quality the resample quality.
+   *
+   * \since 6.4.0
+   */
+  void set_quality(const resample_quality quality) noexcept
+  {
+    m_quality.store(quality, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Lowers or raises the audio quality according to the settings of a power mode.
+   *
+   * \param change the power change, with the audio quality of the new power mode.
+   *
+   * \see `set_quality()`
+   *
+   * \since 6.4.0
+   */
+  void handle(const power_change& change) noexcept
+  {
+    set_quality(change.settings.audio_quality);
+  }
+
+  /**
+   * \brief Returns the quality of the sample rate conversion of WAV files.
+   *
+   * \return the resample quality.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto quality() const noexcept -> resample_quality
+  {
+    return m_quality.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of worker threads.
+   *
+   * \return the number of worker threads.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto worker_count() const noexcept -> usize
+  {
+    return m_workers.size();
+  }
+
+ private:
+  struct entry final
+  {
+    std::string path;
+    std::optional<sound_effect> sound;
+    load_status status{load_status::loading};
+  };
+
+  std::vector<entry> m_entries;
+  std::unordered_map<std::string, id_type> m_ids;
+  std::deque<id_type> m_queue;
+  mutex m_mutex;
+  condition m_wake;
+  condition m_idle;
+  std::atomic<resample_quality> m_quality;
+  usize m_residentBytes{};
+  usize m_converted{};
+  usize m_ready{};
+  usize m_busy{};
+  bool m_stop{};
+  std::vector<std::unique_ptr<thread>> m_workers;  // Last, so that workers stop first
+
+  // Frees the sound effect of an entry and forgets its path, the mutex must be locked
+  void forget(entry& entry) noexcept
+  {
+    m_ids.erase(entry.path);
+
+    if (entry.sound) {
+      m_residentBytes -= entry.sound->get()->alen;
+      entry.sound.reset();
+      --m_ready;
+    }
+
+    entry.path.clear();
+    entry.status = load_status::unknown;
+  }
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<sound_bank*>(data);
+
+    self.m_mutex.lock();
+
+    while (true) {
+      while (!self.m_stop && self.m_queue.empty()) {
+        self.m_wake.wait(self.m_mutex);
+      }
+
+      if (self.m_stop) {
+        break;
+      }
+
+      const auto id = self.m_queue.front();
+      self.m_queue.pop_front();
+
+      if (self.m_entries[id].status != load_status::loading) {
+        continue;  // Released before it was decoded
+      }
+
+      const auto path = self.m_entries[id].path;
+      ++self.m_busy;
+
+      self.m_mutex.unlock();
+
+      auto* chunk = load_converted(path, self.quality());
+      const auto converted = chunk != nullptr;
+
+      if (!chunk) {
+        chunk = Mix_LoadWAV(path.c_str());
+      }
+
+      self.m_mutex.lock();
+
+      auto& entry = self.m_entries[id];
+      if (entry.status != load_status::loading) {
+        if (chunk) {
+          Mix_FreeChunk(chunk);
+        }
+      }
+      else if (chunk) {
+        entry.sound.emplace(chunk);
+        entry.status = load_status::ready;
+        self.m_residentBytes += chunk->alen;
+        self.m_converted += converted ? 1u : 0u;
+        ++self.m_ready;
+      }
+      else {
+        entry.status = load_status::failed;
+      }
+
+      --self.m_busy;
+      self.m_idle.broadcast();
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+
+  // Loads a WAV file and converts it to the mixer format, returns null for other files
+  [[nodiscard]] static auto load_converted(const std::string& path,
+                                           const resample_quality quality) noexcept
+      -> Mix_Chunk*
+  {
+    detail::pcm_format target;
+    if (quality == resample_quality::none ||
+        Mix_QuerySpec(&target.rate, &target.format, &target.channels) == 0)
+    {
+      return nullptr;
+    }
+
+    SDL_AudioSpec spec{};
+    u8* buffer{};
+    u32 length{};
+    if (!SDL_LoadWAV(path.c_str(), &spec, &buffer, &length)) {
+      return nullptr;
+    }
+
+    const std::unique_ptr<u8, detail::sdl_deleter<u8>> wav{buffer};
+
+    const detail::pcm_format source{spec.freq, spec.format, spec.channels};
+    if (!detail::is_convertible(source) || !detail::is_convertible(target)) {
+      return nullptr;
+    }
+
+    const auto frames = length / source.frame_size();
+    const auto targetFrames = detail::resampled_frames(frames, source.rate, target.rate);
+    const auto bytes = targetFrames * target.frame_size();
+    if (bytes == 0) {
+      return nullptr;
+    }
+
+    std::unique_ptr<u8, detail::sdl_deleter<u8>> data{static_cast<u8*>(SDL_malloc(bytes))};
+    if (!data) {
+      return nullptr;
+    }
+
+    if (source == target) {
+      std::memcpy(data.get(), wav.get(), bytes);
+    }
+    else {
+      try {
+        const auto filter = make_filter(quality, source.rate, target.rate);
+        detail::convert_pcm(wav.get(),
+                            frames,
+                            source,
+                            data.get(),
+                            targetFrames,
+                            target,
+                            filter ? &*filter : nullptr);
+      }
+      catch (...) {
+        return nullptr;
+      }
+    }
+
+    auto* chunk = Mix_QuickLoad_RAW(data.get(), static_cast<u32>(bytes));
+    if (!chunk) {
+      return nullptr;
+    }
+
+    // Makes Mix_FreeChunk() free the converted data
+    chunk->allocated = 1;
+    data.release();
+
+    return chunk;
+  }
+
+  [[nodiscard]] static auto make_filter(const resample_quality quality,
+                                        const int sourceRate,
+                                        const int targetRate)
+      -> std::optional<detail::sinc_filter>
+  {
+    if (sourceRate == targetRate || quality == resample_quality::fast) {
+      return std::nullopt;
+    }
+
+    // The cutoff is lowered when downsampling, to suppress aliasing
+    const auto ratio =
+        std::min(1.0, static_cast<double>(targetRate) / static_cast<double>(sourceRate));
+
+    if (quality == resample_quality::best) {
+      return detail::sinc_filter{48, 512, 0.95 * ratio};
+    }
+    else {
+      return detail::sinc_filter{16, 128, 0.9 * ratio};
+    }
+  }
+};
+
+#if CENTURION_HAS_FEATURE_COROUTINES
+
+/**
+ * \brief Loads a sound effect with a sound bank, for use in coroutines.
+ *
+ * \details The sound effect is enqueued immediately, and the awaiting coroutine is resumed
+ * once it has been decoded. Sound effects that have already been loaded by the bank are
+ * available without suspending.
+ *
+ * \param bank the sound bank that will load the sound effect, must outlive the awaitable.
+ * \param path the file path of the sound effect.
+ *
+ * \return an awaitable that yields a handle to the sound effect, which holds a null
+ * pointer if the sound effect couldn't be loaded.
+ *
+ * \see `coroutine`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto load_sound(sound_bank& bank, std::string path)
+{
+  const auto id = bank.enqueue(std::move(path));
+  return detail::poll_awaitable{
+      [&bank, id] { return bank.status(id) != sound_bank::load_status::loading; },
+      [&bank, id] { return bank.get(id); }};
+}
+
+#endif  // CENTURION_HAS_FEATURE_COROUTINES
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_SOUND_BANK_HEADER
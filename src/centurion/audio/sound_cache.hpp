@@ -0,0 +1,322 @@
+#ifndef CENTURION_SOUND_CACHE_HEADER
+#define CENTURION_SOUND_CACHE_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <array>     // array
+#include <cstdio>    // remove
+#include <ios>       // hex
+#include <optional>  // optional, nullopt
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <utility>   // move
+
+#include "../core/integers.hpp"
+#include "../filesystem/file.hpp"
+#include "../filesystem/preferred_path.hpp"
+#include "mixer_latency.hpp"
+#include "sound_effect.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class sound_cache
+ *
+ * \brief Persists decoded sound effects, so that they don't have to be decoded again.
+ *
+ * \details Loading a compressed sound effect, e.g. an OGG file, decodes the entire file
+ * and converts it to the format of the audio device, which is a large part of the startup
+ * time of games with many sound effects. A sound cache stores the converted PCM data of
+ * each loaded sound effect in a small binary file, and subsequent loads of the same file
+ * read the PCM data directly, using `Mix_QuickLoad_RAW()`.
+ *
+ * \details Cache entries are validated by a fingerprint of the source file, i.e. its size
+ * and a hash of its first and last four kilobytes, and by the format of the audio device.
+ * Stale entries are replaced by decoding the source file again.
+ *
+ * \code{cpp}
+ *   if (auto cache = cen::sound_cache::in_preferred_path("studio", "game")) {
+ *     auto sound = cache->load("resources/explosion.ogg");  // Only decoded once
+ *   }
+ * \endcode
+ *
+ * \note SDL doesn't expose file modification times, which is why the fingerprint is based
+ * on the contents of the source file.
+ *
+ * \see `preferred_path()`
+ *
+ * \since 6.4.0
+ */
+class sound_cache final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Creates a sound cache that stores entries in an existing directory.
+   *
+   * \param directory the path of the cache directory, including a trailing separator.
+   *
+   * \since 6.4.0
+   */
+  explicit sound_cache(std::string directory) : m_directory{std::move(directory)}
+  {}
+
+  /**
+   * \brief Creates a sound cache in the preferred path of an application.
+   *
+   * \param org the name of the organization.
+   * \param app the name of the application.
+   *
+   * \return a sound cache; `std::nullopt` if the preferred path couldn't be obtained.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto in_preferred_path(const std::string& org,
+                                              const std::string& app)
+      -> std::optional<sound_cache>
+  {
+    const auto path = preferred_path(org, app);
+    if (path) {
+      return sound_cache{path.copy()};
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Loads a sound effect, from the cache if possible.
+   *
+   * \details The sound effect is decoded, and added to the cache, if there is no valid
+   * cache entry for the source file.
+   *
+   * \pre The audio device must be open.
+   *
+   * \param path the file path of the source audio file.
+   *
+   * \return the loaded sound effect; `std::nullopt` if it couldn't be loaded.
+   *
+   * \since 6.4.0
+   */
+  auto load(const std::string& path) -> std::optional<sound_effect>
+  {
+    const auto spec = query_mixer_spec();
+    const auto key = fingerprint(path);
+    if (!spec || !key) {
+      return std::nullopt;
+    }
+
+    const auto entry = entry_path(path);
+
+    if (auto* chunk = read_entry(entry, *key, *spec)) {
+      ++m_hits;
+      return sound_effect{chunk};
+    }
+
+    ++m_misses;
+    if (auto* chunk = Mix_LoadWAV(path.c_str())) {
+      write_entry(entry, *key, *spec, *chunk);
+      return sound_effect{chunk};
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Removes the cache entry of a source file.
+   *
+   * \param path the file path of the source audio file.
+   *
+   * \return `true` if an entry was removed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto remove(const std::string& path) -> bool
+  {
+    return std::remove(entry_path(path).c_str()) == 0;
+  }
+
+  /**
+   * \brief Returns the path of the file that holds the cache entry of a source file.
+   *
+   * \param path the file path of the source audio file.
+   *
+   * \return the path of the cache entry, which might not exist.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto entry_path(const std::string& path) const -> std::string
+  {
+    std::stringstream stream;
+    stream << m_directory << "sound_" << std::hex << hash(path.data(), path.size())
+           << ".pcm";
+    return stream.str();
+  }
+
+  /**
+   * \brief Returns the amount of sound effects that were loaded from the cache.
+   *
+   * \return the number of cache hits.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto hits() const noexcept -> size_type
+  {
+    return m_hits;
+  }
+
+  /**
+   * \brief Returns the amount of sound effects that had to be decoded.
+   *
+   * \return the number of cache misses.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto misses() const noexcept -> size_type
+  {
+    return m_misses;
+  }
+
+  /**
+   * \brief Returns the directory that holds the cache entries.
+   *
+   * \return the cache directory.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto directory() const noexcept -> const std::string&
+  {
+    return m_directory;
+  }
+
+ private:
+  inline constexpr static u32 magic = 0x444E5343;  // "CSND"
+  inline constexpr static u32 version = 1;
+  inline constexpr static size_type sample_size = 4'096;
+
+  std::string m_directory;
+  size_type m_hits{};
+  size_type m_misses{};
+
+  // FNV-1a, which is stable across runs and platforms, unlike std::hash
+  [[nodiscard]] static auto hash(const void* data,
+                                 const size_type size,
+                                 u64 seed = 0xCBF29CE484222325) noexcept -> u64
+  {
+    const auto* bytes = static_cast<const u8*>(data);
+    for (size_type index = 0; index < size; ++index) {
+      seed ^= bytes[index];
+      seed *= 0x100000001B3;
+    }
+
+    return seed;
+  }
+
+  [[nodiscard]] static auto fingerprint(const std::string& path) -> std::optional<u64>
+  {
+    file source{path, file_mode::read_existing_binary};
+    if (!source) {
+      return std::nullopt;
+    }
+
+    const auto size = static_cast<u64>(source.size().value_or(0));
+    auto key = hash(&size, sizeof size);
+
+    std::array<u8, sample_size> buffer{};
+    key = hash(buffer.data(), source.read_to(buffer.data(), buffer.size()), key);
+
+    if (size > sample_size) {
+      const auto tail = size - sample_size;
+      if (source.seek(static_cast<i64>(tail), seek_mode::from_beginning)) {
+        key = hash(buffer.data(), source.read_to(buffer.data(), buffer.size()), key);
+      }
+    }
+
+    return key;
+  }
+
+  [[nodiscard]] static auto read_entry(const std::string& entry,
+                                       const u64 key,
+                                       const mixer_spec& spec) noexcept -> Mix_Chunk*
+  {
+    file cached{entry, file_mode::read_existing_binary};
+    if (!cached) {
+      return nullptr;
+    }
+
+    const auto entryMagic = cached.read_little_endian_u32();
+    const auto entryVersion = cached.read_little_endian_u32();
+    const auto entryKey = cached.read_little_endian_u64();
+    const auto frequency = cached.read_little_endian_u32();
+    const auto format = cached.read_little_endian_u16();
+    const auto channels = cached.read_little_endian_u16();
+    const auto size = cached.read_little_endian_u32();
+
+    if (entryMagic != magic || entryVersion != version || entryKey != key ||
+        frequency != static_cast<u32>(spec.frequency) || format != spec.format ||
+        channels != static_cast<u16>(spec.channels) || size == 0)
+    {
+      return nullptr;
+    }
+
+    auto* data = static_cast<u8*>(SDL_malloc(size));
+    if (!data) {
+      return nullptr;
+    }
+
+    Mix_Chunk* chunk{};
+    if (cached.read_to(data, size) == size) {
+      chunk = Mix_QuickLoad_RAW(data, size);
+    }
+
+    if (chunk) {
+      chunk->allocated = 1;  // Transfers ownership of the samples to the chunk
+    }
+    else {
+      SDL_free(data);
+    }
+
+    return chunk;
+  }
+
+  static void write_entry(const std::string& entry,
+                          const u64 key,
+                          const mixer_spec& spec,
+                          const Mix_Chunk& chunk) noexcept
+  {
+    file cached{entry, file_mode::write_binary};
+    if (!cached) {
+      return;
+    }
+
+    auto written = cached.write_as_little_endian(magic) &&
+                   cached.write_as_little_endian(version) &&
+                   cached.write_as_little_endian(key) &&
+                   cached.write_as_little_endian(static_cast<u32>(spec.frequency)) &&
+                   cached.write_as_little_endian(spec.format) &&
+                   cached.write_as_little_endian(static_cast<u16>(spec.channels)) &&
+                   cached.write_as_little_endian(static_cast<u32>(chunk.alen));
+
+    written = written && cached.write(chunk.abuf, chunk.alen) == chunk.alen;
+
+    if (!written) {
+      cached = file{nullptr};  // Closes the file, so that the partial entry can be removed
+      std::remove(entry.c_str());
+    }
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_SOUND_CACHE_HEADER
@@ -3,6 +3,7 @@
 
 #ifndef CENTURION_NO_SDL_MIXER
 
+#include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 
 #include <cassert>   // assert
@@ -20,6 +21,9 @@
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
 #include "../core/exception.hpp"
+#include "../core/expected.hpp"
+#include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
@@ -29,6 +33,7 @@
 #include "../detail/clamp.hpp"
 #include "../detail/max.hpp"
 #include "../detail/owner_handle_api.hpp"
+#include "../filesystem/file.hpp"
 
 namespace cen {
 
@@ -132,8 +137,11 @@ class basic_sound_effect final
    * \since 3.0.0
    */
   template <typename TT = T, detail::is_owner<TT> = 0>
-  explicit basic_sound_effect(const not_null<str> file) : m_chunk{Mix_LoadWAV(file)}
+  explicit basic_sound_effect(const not_null<str> file)
   {
+    library::ensure(library_subsystem::mixer);
+
+    m_chunk.reset(Mix_LoadWAV(file));
     if (!m_chunk) {
       throw mix_error{};
     }
@@ -152,6 +160,91 @@ class basic_sound_effect final
   explicit basic_sound_effect(const std::string& file) : basic_sound_effect{file.c_str()}
   {}
 
+  /**
+   * \brief Creates a sound effect by decoding the audio data of an open file.
+   *
+   * \details The audio data is read from the current offset of the file, which makes it
+   * possible to load sound effects from files in packed archives. The file is not closed,
+   * and can be used, or closed, right after the sound effect has been created.
+   *
+   * \param source the file that the audio data is read from, must be valid.
+   *
+   * \throws mix_error if the audio data cannot be loaded.
+   *
+   * \see `Mix_LoadWAV_RW`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  explicit basic_sound_effect(file& source)
+  {
+    library::ensure(library_subsystem::mixer);
+
+    m_chunk.reset(Mix_LoadWAV_RW(source.get(), 0));
+    if (!m_chunk) {
+      throw mix_error{};
+    }
+  }
+
+  /**
+   * \brief Attempts to load a sound effect based on an audio file, without throwing.
+   *
+   * \param file the file path of the audio file, cannot be null.
+   *
+   * \return the loaded sound effect; an `error_code::mix` error if the audio file couldn't
+   * be loaded.
+   *
+   * \see `expected`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto try_load(const not_null<str> file) noexcept
+      -> expected<basic_sound_effect>
+  {
+    assert(file);
+
+    if (auto* loaded = Mix_LoadWAV(file)) {
+      return basic_sound_effect{loaded};
+    }
+    else {
+      return error_info{error_code::mix};
+    }
+  }
+
+  /// \copydoc try_load()
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto try_load(const std::string& file) noexcept
+      -> expected<basic_sound_effect>
+  {
+    return try_load(file.c_str());
+  }
+
+  /**
+   * \brief Creates a sound effect by decoding audio data in memory.
+   *
+   * \details The audio data is decoded into a new buffer, so the supplied buffer can be
+   * discarded right after the sound effect has been created. Use `from_raw()` for PCM data
+   * that already is in the format of the audio device, to avoid the copy.
+   *
+   * \param data the encoded audio data, e.g. the contents of a WAV or OGG file.
+   * \param size the size of the audio data, in bytes.
+   *
+   * \throws mix_error if the audio data cannot be loaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  basic_sound_effect(const void* data, const usize size)
+  {
+    library::ensure(library_subsystem::mixer);
+
+    m_chunk.reset(Mix_LoadWAV_RW(SDL_RWFromConstMem(data, static_cast<int>(size)), 1));
+    if (!m_chunk) {
+      throw mix_error{};
+    }
+  }
+
   /**
    * \brief Creates a sound effect handle to on an existing sound effect.
    *
@@ -163,6 +256,30 @@ class basic_sound_effect final
   explicit basic_sound_effect(const sound_effect& owner) noexcept : m_chunk{owner.get()}
   {}
 
+  /**
+   * \brief Creates a sound effect that plays PCM data in memory, without copying it.
+   *
+   * \details The sound effect references the supplied buffer, which must use the format of
+   * the opened audio device, and which must outlive the sound effect.
+   *
+   * \param samples the PCM data that will be played.
+   * \param size the size of the PCM data, in bytes.
+   *
+   * \return a sound effect that references the supplied buffer.
+   *
+   * \throws mix_error if the sound effect cannot be created.
+   *
+   * \see `Mix_QuickLoad_RAW`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_raw(u8* samples, const u32 size) -> basic_sound_effect
+  {
+    library::ensure(library_subsystem::mixer);
+    return basic_sound_effect{Mix_QuickLoad_RAW(samples, size)};
+  }
+
   /// \} End of construction
 
   /// \name Playback functions
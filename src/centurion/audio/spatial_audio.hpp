@@ -0,0 +1,331 @@
+#ifndef CENTURION_SPATIAL_AUDIO_HEADER
+#define CENTURION_SPATIAL_AUDIO_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <cassert>  // assert
+#include <cmath>    // atan2, sqrt, lrint, abs
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../math/point.hpp"
+#include "../math/vector3.hpp"
+#include "channels.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class spatial_audio
+ *
+ * \brief Pans and attenuates channels according to the positions of sound emitters.
+ *
+ * \details Each emitter is associated with a channel, and has a position in the same
+ * space as the listener. Once per frame, `update()` computes the angle and distance of
+ * every emitter relative to the listener, and forwards them to `Mix_SetPosition()`.
+ * Since every such call locks the audio device, channels are only updated when their
+ * angle or distance changed by at least a threshold, so emitters and listeners that move
+ * slightly, or not at all, don't touch the mixer.
+ *
+ * \details Distances are mapped linearly to the attenuation of the mixer, where emitters
+ * closer than the minimum distance are played at full volume, and emitters farther away
+ * than the maximum distance are nearly silent.
+ *
+ * \code{cpp}
+ *   cen::spatial_audio spatial{32};
+ *   spatial.set_range(64, 1'024);
+ *
+ *   // Once per frame
+ *   spatial.set_listener(camera.center());
+ *   for (const auto& enemy : enemies) {
+ *     spatial.set_emitter(enemy.channel, enemy.position);
+ *   }
+ *
+ *   spatial.update();
+ * \endcode
+ *
+ * \note Two-dimensional positions are interpreted as screen coordinates, i.e. the
+ * listener faces the top of the screen, and emitters to the right are played on the
+ * right speaker.
+ *
+ * \see `Mix_SetPosition`
+ *
+ * \since 6.4.0
+ */
+class spatial_audio final
+{
+ public:
+  using size_type = usize;
+  using vector_type = vector3<float>;
+
+  /**
+   * \brief Creates a spatial audio layer, without any emitters.
+   *
+   * \param channelCount the amount of channels that may have emitters.
+   *
+   * \since 6.4.0
+   */
+  explicit spatial_audio(const size_type channelCount)
+      : m_emitters(channelCount)
+  {}
+
+  /**
+   * \brief Sets the position and orientation of the listener.
+   *
+   * \param position the position of the listener.
+   * \param forward the normalized direction that the listener faces.
+   * \param right the normalized direction to the right of the listener, perpendicular to
+   * `forward`.
+   *
+   * \since 6.4.0
+   */
+  void set_listener(const vector_type& position,
+                    const vector_type& forward,
+                    const vector_type& right) noexcept
+  {
+    m_listener = position;
+    m_forward = forward;
+    m_right = right;
+  }
+
+  /**
+   * \brief Sets the position of a listener in a two-dimensional space.
+   *
+   * \param position the position of the listener, in screen coordinates.
+   *
+   * \since 6.4.0
+   */
+  void set_listener(const fpoint position) noexcept
+  {
+    set_listener(to_vector(position), vector_type{0, -1, 0}, vector_type{1, 0, 0});
+  }
+
+  /**
+   * \brief Sets the position of the emitter that is played on a channel.
+   *
+   * \pre `channel` must be less than the channel count.
+   *
+   * \param channel the channel of the emitter.
+   * \param position the position of the emitter.
+   *
+   * \since 6.4.0
+   */
+  void set_emitter(const channel_index channel, const vector_type& position) noexcept
+  {
+    auto& emitter = at(channel);
+    emitter.position = position;
+    emitter.active = true;
+  }
+
+  /// \copydoc set_emitter(channel_index, const vector_type&)
+  void set_emitter(const channel_index channel, const fpoint position) noexcept
+  {
+    set_emitter(channel, to_vector(position));
+  }
+
+  /**
+   * \brief Removes the emitter of a channel, and stops positioning the channel.
+   *
+   * \param channel the channel of the emitter.
+   *
+   * \since 6.4.0
+   */
+  void remove_emitter(const channel_index channel) noexcept
+  {
+    auto& emitter = at(channel);
+
+    if (emitter.applied) {
+      Mix_SetPosition(channel, 0, 0);  // Unregisters the position effect
+    }
+
+    emitter = emitter_state{};
+  }
+
+  /**
+   * \brief Indicates whether or not a channel has an emitter.
+   *
+   * \param channel the channel that will be checked.
+   *
+   * \return `true` if the channel has an emitter; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto has_emitter(const channel_index channel) const noexcept -> bool
+  {
+    return channel >= 0 && static_cast<size_type>(channel) < m_emitters.size() &&
+           m_emitters[static_cast<size_type>(channel)].active;
+  }
+
+  /**
+   * \brief Computes the positions of all emitters, and updates the channels that changed.
+   *
+   * \return the amount of channels that were updated.
+   *
+   * \since 6.4.0
+   */
+  auto update() noexcept -> size_type
+  {
+    size_type updated = 0;
+
+    for (size_type index = 0; index < m_emitters.size(); ++index) {
+      auto& emitter = m_emitters[index];
+      if (!emitter.active) {
+        continue;
+      }
+
+      const auto angle = compute_angle(emitter.position);
+      const auto distance = compute_distance(emitter.position);
+
+      if (emitter.applied && angle_delta(angle, emitter.angle) < m_angleThreshold &&
+          std::abs(distance - emitter.distance) < m_distanceThreshold)
+      {
+        continue;
+      }
+
+      if (Mix_SetPosition(static_cast<channel_index>(index),
+                          static_cast<Sint16>(angle),
+                          static_cast<Uint8>(distance)) != 0)
+      {
+        emitter.angle = angle;
+        emitter.distance = distance;
+        emitter.applied = true;
+        ++updated;
+      }
+    }
+
+    return updated;
+  }
+
+  /**
+   * \brief Sets the distances that are mapped to the attenuation of the mixer.
+   *
+   * \pre `min` must be less than `max`.
+   *
+   * \param min the distance up to which emitters are played at full volume.
+   * \param max the distance at which emitters reach the maximum attenuation.
+   *
+   * \since 6.4.0
+   */
+  void set_range(const float min, const float max) noexcept
+  {
+    assert(min < max);
+    m_minDistance = min;
+    m_maxDistance = max;
+  }
+
+  /**
+   * \brief Sets the minimum changes that cause a channel to be updated.
+   *
+   * \param angle the minimum change of the angle, in degrees.
+   * \param distance the minimum change of the attenuation, in the range [0, 255].
+   *
+   * \since 6.4.0
+   */
+  void set_thresholds(const int angle, const int distance) noexcept
+  {
+    m_angleThreshold = angle;
+    m_distanceThreshold = distance;
+  }
+
+  /**
+   * \brief Returns the amount of channels that may have emitters.
+   *
+   * \return the channel count.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto channel_count() const noexcept -> size_type
+  {
+    return m_emitters.size();
+  }
+
+ private:
+  inline constexpr static float pi = 3.14159265f;
+
+  struct emitter_state final
+  {
+    vector_type position;
+    int angle{};         ///< The last applied angle, in degrees.
+    int distance{};      ///< The last applied attenuation.
+    bool active{};
+    bool applied{};      ///< Whether the position effect has been registered.
+  };
+
+  std::vector<emitter_state> m_emitters;
+  vector_type m_listener;
+  vector_type m_forward{0, -1, 0};  ///< Matches the screen space basis of set_listener().
+  vector_type m_right{1, 0, 0};
+  float m_minDistance{0};
+  float m_maxDistance{1'000};
+  int m_angleThreshold{2};
+  int m_distanceThreshold{2};
+
+  [[nodiscard]] static auto to_vector(const fpoint point) noexcept -> vector_type
+  {
+    return vector_type{point.x(), point.y(), 0};
+  }
+
+  [[nodiscard]] static auto dot(const vector_type& a, const vector_type& b) noexcept
+      -> float
+  {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+  }
+
+  [[nodiscard]] static auto angle_delta(const int a, const int b) noexcept -> int
+  {
+    const auto delta = std::abs(a - b);
+    return delta > 180 ? 360 - delta : delta;
+  }
+
+  [[nodiscard]] auto offset_of(const vector_type& position) const noexcept -> vector_type
+  {
+    return vector_type{position.x - m_listener.x,
+                       position.y - m_listener.y,
+                       position.z - m_listener.z};
+  }
+
+  // Returns the clockwise angle from the front of the listener, in [0, 360)
+  [[nodiscard]] auto compute_angle(const vector_type& position) const noexcept -> int
+  {
+    const auto offset = offset_of(position);
+    const auto side = dot(offset, m_right);
+    const auto front = dot(offset, m_forward);
+
+    if (side == 0 && front == 0) {
+      return 0;
+    }
+
+    const auto degrees = static_cast<int>(std::lrint(std::atan2(side, front) * 180 / pi));
+    return (degrees + 360) % 360;
+  }
+
+  // Returns the attenuation in [0, 255], where 0 is the loudest
+  [[nodiscard]] auto compute_distance(const vector_type& position) const noexcept -> int
+  {
+    const auto offset = offset_of(position);
+    const auto length = std::sqrt(dot(offset, offset));
+
+    auto t = (length - m_minDistance) / (m_maxDistance - m_minDistance);
+    t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+
+    return static_cast<int>(std::lrint(t * 255));
+  }
+
+  [[nodiscard]] auto at(const channel_index channel) noexcept -> emitter_state&
+  {
+    assert(channel >= 0 && static_cast<size_type>(channel) < m_emitters.size());
+    return m_emitters[static_cast<size_type>(channel)];
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_SPATIAL_AUDIO_HEADER
@@ -0,0 +1,390 @@
+#ifndef CENTURION_VOICE_MANAGER_HEADER
+#define CENTURION_VOICE_MANAGER_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include <cassert>        // assert
+#include <limits>         // numeric_limits
+#include <optional>       // optional, nullopt
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../detail/max.hpp"
+#include "channels.hpp"
+#include "sound_effect.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class voice_manager
+ *
+ * \brief Plays sound effects on a group of channels, stealing voices by priority.
+ *
+ * \details Playing a sound effect directly fails when all channels are busy, regardless of
+ * how important the sound effect is. A voice manager plays sound effects on a fixed range
+ * of channels, which are assigned to a channel group, and remembers the priority of the
+ * sound effect playing on each channel. When all channels are busy, the voice with the
+ * lowest priority is stopped to make room for the new sound effect, preferring the oldest
+ * voice when priorities are equal. Sound effects with a lower priority than all playing
+ * voices are rejected.
+ *
+ * \details The number of concurrent instances of a sound effect can also be limited, in
+ * which case the oldest instance of the sound effect is replaced once the limit is
+ * reached, e.g. to avoid a wall of identical footstep sounds.
+ *
+ * \code{cpp}
+ *   cen::channels::allocate(32);
+ *   cen::voice_manager voices{0, 32, 1};
+ *
+ *   voices.set_instance_limit(footstep, 4);
+ *   voices.play(explosion, 10);
+ * \endcode
+ *
+ * \note The channels must have been allocated before the manager is created, and should
+ * not be used to play sound effects by other means.
+ *
+ * \see `channels::set_group()`
+ *
+ * \since 6.4.0
+ */
+class voice_manager final
+{
+ public:
+  using size_type = usize;
+  using priority_type = int;
+
+  /**
+   * \brief Creates a voice manager, and assigns its channels to a channel group.
+   *
+   * \pre `first` must not be negative.
+   * \pre `count` must be greater than zero.
+   *
+   * \param first the index of the first channel used by the manager.
+   * \param count the amount of consecutive channels used by the manager.
+   * \param group the channel group that the channels will be assigned to.
+   *
+   * \since 6.4.0
+   */
+  voice_manager(const channel_index first, const int count, const group_index group)
+      : m_first{first}
+      , m_group{group}
+      , m_voices(static_cast<size_type>(count))
+  {
+    assert(first >= 0);
+    assert(count > 0);
+
+    for (auto channel = first; channel < first + count; ++channel) {
+      channels::set_group(channel, group);
+    }
+  }
+
+  /**
+   * \brief Plays a sound effect, stopping a less important voice if necessary.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param sound the sound effect that will be played.
+   * \param priority the priority of the sound effect, higher values are more important.
+   * \param nLoops the number of times to loop the sound effect, see
+   * `basic_sound_effect::play()`.
+   *
+   * \return the channel that the sound effect is played on; `std::nullopt` if the sound
+   * effect was rejected.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto play(const basic_sound_effect<T>& sound,
+            const priority_type priority = 0,
+            const int nLoops = 0) -> std::optional<channel_index>
+  {
+    auto* chunk = sound.get();
+    assert(chunk);
+
+    refresh();
+
+    std::optional<size_type> target;
+    auto steal = false;
+
+    if (count_instances(chunk) >= instance_limit(sound)) {
+      target = find_victim(chunk);
+      steal = true;
+    }
+    else if (const auto available = channels::first_available(m_group)) {
+      target = to_index(*available);
+    }
+
+    if (!target && !steal) {
+      target = find_victim(nullptr);
+      steal = true;
+    }
+
+    if (!target || (steal && m_voices[*target].priority > priority)) {
+      ++m_rejections;
+      return std::nullopt;
+    }
+
+    const auto channel = static_cast<channel_index>(m_first + static_cast<int>(*target));
+
+    if (steal) {
+      Mix_HaltChannel(channel);
+      m_voices[*target].chunk = nullptr;
+      ++m_steals;
+    }
+
+    if (Mix_PlayChannel(channel, chunk, detail::max(nLoops, sound_effect::forever)) == -1) {
+      ++m_rejections;
+      return std::nullopt;
+    }
+
+    auto& voice = m_voices[*target];
+    voice.chunk = chunk;
+    voice.priority = priority;
+    voice.sequence = ++m_sequence;
+
+    return channel;
+  }
+
+  /**
+   * \brief Stops all voices of the manager.
+   *
+   * \since 6.4.0
+   */
+  void stop_all() noexcept
+  {
+    Mix_HaltGroup(m_group);
+    for (auto& voice : m_voices) {
+      voice.chunk = nullptr;
+    }
+  }
+
+  /**
+   * \brief Limits the amount of concurrent instances of a sound effect.
+   *
+   * \pre `limit` must be greater than zero.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param sound the sound effect that will be limited.
+   * \param limit the maximum amount of concurrent instances of the sound effect.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void set_instance_limit(const basic_sound_effect<T>& sound, const size_type limit)
+  {
+    assert(limit > 0);
+    m_limits[sound.get()] = limit;
+  }
+
+  /**
+   * \brief Removes the instance limit of a sound effect.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param sound the sound effect that will no longer be limited.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void reset_instance_limit(const basic_sound_effect<T>& sound)
+  {
+    m_limits.erase(sound.get());
+  }
+
+  /**
+   * \brief Returns the maximum amount of concurrent instances of a sound effect.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param sound the sound effect that will be queried.
+   *
+   * \return the instance limit of the sound effect, which is the maximum `size_type`
+   * value if the sound effect isn't limited.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  [[nodiscard]] auto instance_limit(const basic_sound_effect<T>& sound) const -> size_type
+  {
+    if (const auto it = m_limits.find(sound.get()); it != m_limits.end()) {
+      return it->second;
+    }
+    else {
+      return std::numeric_limits<size_type>::max();
+    }
+  }
+
+  /**
+   * \brief Returns the amount of voices that are currently playing.
+   *
+   * \return the number of playing voices.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto voice_count() noexcept -> size_type
+  {
+    refresh();
+
+    size_type count = 0;
+    for (const auto& voice : m_voices) {
+      if (voice.chunk) {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Returns the amount of voices that were stopped to make room for other voices.
+   *
+   * \return the number of stolen voices.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto steal_count() const noexcept -> size_type
+  {
+    return m_steals;
+  }
+
+  /**
+   * \brief Returns the amount of sound effects that couldn't be played.
+   *
+   * \return the number of rejected sound effects.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto rejection_count() const noexcept -> size_type
+  {
+    return m_rejections;
+  }
+
+  /**
+   * \brief Resets the steal and rejection counters.
+   *
+   * \since 6.4.0
+   */
+  void reset_counters() noexcept
+  {
+    m_steals = 0;
+    m_rejections = 0;
+  }
+
+  /**
+   * \brief Returns the channel group used by the manager.
+   *
+   * \return the channel group index.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto group() const noexcept -> group_index
+  {
+    return m_group;
+  }
+
+  /**
+   * \brief Returns the amount of channels used by the manager.
+   *
+   * \return the number of channels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto channel_count() const noexcept -> size_type
+  {
+    return m_voices.size();
+  }
+
+ private:
+  struct voice final
+  {
+    Mix_Chunk* chunk{};  ///< Null if the channel is idle.
+    priority_type priority{};
+    u64 sequence{};      ///< Increases with each played voice, used to find the oldest.
+  };
+
+  channel_index m_first{};
+  group_index m_group{};
+  std::vector<voice> m_voices;
+  std::unordered_map<Mix_Chunk*, size_type> m_limits;
+  u64 m_sequence{};
+  size_type m_steals{};
+  size_type m_rejections{};
+
+  [[nodiscard]] auto to_index(const channel_index channel) const noexcept
+      -> std::optional<size_type>
+  {
+    const auto index = channel - m_first;
+    if (index >= 0 && static_cast<size_type>(index) < m_voices.size()) {
+      return static_cast<size_type>(index);
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /// Marks the voices whose channels have finished playing as idle.
+  void refresh() noexcept
+  {
+    for (size_type index = 0; index < m_voices.size(); ++index) {
+      auto& voice = m_voices[index];
+      if (voice.chunk && !Mix_Playing(m_first + static_cast<int>(index))) {
+        voice.chunk = nullptr;
+      }
+    }
+  }
+
+  [[nodiscard]] auto count_instances(const Mix_Chunk* chunk) const noexcept -> size_type
+  {
+    size_type count = 0;
+    for (const auto& voice : m_voices) {
+      if (voice.chunk == chunk) {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /// Returns the oldest voice with the lowest priority, optionally of a specific chunk.
+  [[nodiscard]] auto find_victim(const Mix_Chunk* chunk) const noexcept
+      -> std::optional<size_type>
+  {
+    std::optional<size_type> victim;
+
+    for (size_type index = 0; index < m_voices.size(); ++index) {
+      const auto& voice = m_voices[index];
+      if (!voice.chunk || (chunk && voice.chunk != chunk)) {
+        continue;
+      }
+
+      if (!victim) {
+        victim = index;
+        continue;
+      }
+
+      const auto& current = m_voices[*victim];
+      if (voice.priority < current.priority ||
+          (voice.priority == current.priority && voice.sequence < current.sequence))
+      {
+        victim = index;
+      }
+    }
+
+    return victim;
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_VOICE_MANAGER_HEADER
@@ -60,14 +60,91 @@
 #define CENTURION_HAS_FEATURE_CHRONO_TIME_ZONES 0
 #endif  // __cpp_lib_chrono >= 201907L
 
+#ifdef __cpp_lib_span
+#define CENTURION_HAS_FEATURE_SPAN 1
+#else
+#define CENTURION_HAS_FEATURE_SPAN 0
+#endif  // __cpp_lib_span
+
 #if __cpp_lib_to_array >= 201907L
 #define CENTURION_HAS_FEATURE_TO_ARRAY 1
 #else
 #define CENTURION_HAS_FEATURE_TO_ARRAY 0
 #endif  // __cpp_lib_to_array >= 201907L
 
+// Floating-point std::from_chars, which older versions of libstdc++ and libc++ lack
+#ifdef __cpp_lib_to_chars
+#define CENTURION_HAS_FEATURE_FLOAT_CHARCONV 1
+#else
+#define CENTURION_HAS_FEATURE_FLOAT_CHARCONV 0
+#endif  // __cpp_lib_to_chars
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+#define CENTURION_HAS_FEATURE_COROUTINES 1
+#else
+#define CENTURION_HAS_FEATURE_COROUTINES 0
+#endif  // defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+
 #endif  // __has_include
 
+// SSE2 intrinsics, which are always available on x86-64
+#if !defined(CENTURION_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define CENTURION_HAS_FEATURE_SSE2 1
+#else
+#define CENTURION_HAS_FEATURE_SSE2 0
+#endif  // SSE2
+
+// NEON intrinsics, which are always available on AArch64
+#if !defined(CENTURION_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define CENTURION_HAS_FEATURE_NEON 1
+#else
+#define CENTURION_HAS_FEATURE_NEON 0
+#endif  // NEON
+
+// AVX2 intrinsics, which are compiled for individual functions and selected at runtime
+#if !defined(CENTURION_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define CENTURION_HAS_FEATURE_AVX2 1
+#else
+#define CENTURION_HAS_FEATURE_AVX2 0
+#endif  // AVX2
+
+// Enables AVX2 code generation for a single function, which isn't needed by MSVC
+#if CENTURION_HAS_FEATURE_AVX2 && (defined(__GNUC__) || defined(__clang__))
+#define CENTURION_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define CENTURION_TARGET_AVX2
+#endif  // CENTURION_HAS_FEATURE_AVX2 && (defined(__GNUC__) || defined(__clang__))
+
+// Headless builds, e.g. dedicated servers, exclude the SDL extensions and graphics APIs
+#ifdef CENTURION_HEADLESS
+
+#ifndef CENTURION_NO_SDL_IMAGE
+#define CENTURION_NO_SDL_IMAGE
+#endif  // CENTURION_NO_SDL_IMAGE
+
+#ifndef CENTURION_NO_SDL_MIXER
+#define CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_NO_SDL_MIXER
+
+#ifndef CENTURION_NO_SDL_TTF
+#define CENTURION_NO_SDL_TTF
+#endif  // CENTURION_NO_SDL_TTF
+
+#ifndef CENTURION_NO_OPENGL
+#define CENTURION_NO_OPENGL
+#endif  // CENTURION_NO_OPENGL
+
+#ifndef CENTURION_NO_VULKAN
+#define CENTURION_NO_VULKAN
+#endif  // CENTURION_NO_VULKAN
+
+#define CENTURION_HAS_FEATURE_HEADLESS 1
+#else
+#define CENTURION_HAS_FEATURE_HEADLESS 0
+#endif  // CENTURION_HEADLESS
+
 /// \} End of group compiler
 
 #endif  // CENTURION_FEATURES_HEADER
@@ -0,0 +1,54 @@
+#ifndef CENTURION_LINKAGE_HEADER
+#define CENTURION_LINKAGE_HEADER
+
+/// \addtogroup compiler
+/// \{
+
+/*
+ * By default, the library is header-only and all functions are inline. When the
+ * CEN_COMPILED_LIBRARY CMake option is enabled, consumers are built with
+ * CENTURION_COMPILED_LIBRARY, in which case the heavy non-template functions marked with
+ * CENTURION_LIB_INLINE are only declared by the headers. These are instead defined once,
+ * along with the common template instantiations, by src/centurion.cpp, which is compiled
+ * with CENTURION_BUILDING_LIBRARY.
+ *
+ * Functions that use operating system APIs are defined in the detail/<name>_impl.hpp
+ * headers, which are the only headers that include platform headers such as <windows.h>.
+ * These are included at the end of the corresponding public headers, and only when the
+ * definitions are seen, so consumers of the compiled library never see the platform
+ * headers. No platform macros, such as NOMINMAX, are left defined in either mode.
+ */
+
+#ifdef CENTURION_COMPILED_LIBRARY
+#define CENTURION_LIB_INLINE
+#define CENTURION_EXTERN_TEMPLATES 1
+#else
+#define CENTURION_LIB_INLINE inline
+#define CENTURION_EXTERN_TEMPLATES 0
+#endif  // CENTURION_COMPILED_LIBRARY
+
+// Whether or not the definitions of the functions marked with CENTURION_LIB_INLINE are seen
+#if !defined(CENTURION_COMPILED_LIBRARY) || defined(CENTURION_BUILDING_LIBRARY)
+#define CENTURION_LIB_DEFINITIONS 1
+#else
+#define CENTURION_LIB_DEFINITIONS 0
+#endif  // !defined(CENTURION_COMPILED_LIBRARY) || defined(CENTURION_BUILDING_LIBRARY)
+
+// Symbol visibility of the compiled functions, only relevant for shared libraries
+#if defined(CENTURION_COMPILED_LIBRARY) && defined(CENTURION_SHARED_LIBRARY)
+#ifdef _WIN32
+#ifdef CENTURION_BUILDING_LIBRARY
+#define CENTURION_API __declspec(dllexport)
+#else
+#define CENTURION_API __declspec(dllimport)
+#endif  // CENTURION_BUILDING_LIBRARY
+#else
+#define CENTURION_API __attribute__((visibility("default")))
+#endif  // _WIN32
+#else
+#define CENTURION_API
+#endif  // defined(CENTURION_COMPILED_LIBRARY) && defined(CENTURION_SHARED_LIBRARY)
+
+/// \} End of group compiler
+
+#endif  // CENTURION_LINKAGE_HEADER
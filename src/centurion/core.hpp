@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019-2021 Albin Johansson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CENTURION_CORE_MODULE_HEADER
+#define CENTURION_CORE_MODULE_HEADER
+
+#ifndef CENTURION_NO_PRAGMA_ONCE
+#pragma once
+#endif  // CENTURION_NO_PRAGMA_ONCE
+
+// Core utilities, math, filesystem, system and threading components.
+
+#include "compiler/compiler.hpp"
+#include "compiler/features.hpp"
+#include "compiler/linkage.hpp"
+#include "core/async_log_sink.hpp"
+#include "core/cast.hpp"
+#include "core/core_fwd.hpp"
+#include "core/exception.hpp"
+#include "core/expected.hpp"
+#include "core/integers.hpp"
+#include "core/is_stateless_callable.hpp"
+#include "core/library.hpp"
+#include "core/library_subsystem.hpp"
+#include "core/log.hpp"
+#include "core/log_category.hpp"
+#include "core/log_macros.hpp"
+#include "core/log_priority.hpp"
+#include "core/macros.hpp"
+#include "core/not_null.hpp"
+#include "core/owner.hpp"
+#include "core/result.hpp"
+#include "core/sdl_log_category_workaround.hpp"
+#include "core/sdl_string.hpp"
+#include "core/sfinae.hpp"
+#include "core/str.hpp"
+#include "core/str_or_na.hpp"
+#include "core/time.hpp"
+#include "core/to_underlying.hpp"
+#include "core/version.hpp"
+#include "filesystem/base_path.hpp"
+#include "filesystem/buffered_reader.hpp"
+#include "filesystem/buffered_writer.hpp"
+#include "filesystem/file.hpp"
+#include "filesystem/file_mode.hpp"
+#include "filesystem/file_type.hpp"
+#include "filesystem/file_watcher.hpp"
+#include "filesystem/image_format.hpp"
+#include "filesystem/io_service.hpp"
+#include "filesystem/lz4_reader.hpp"
+#include "filesystem/lz4_writer.hpp"
+#include "filesystem/mapped_file.hpp"
+#include "filesystem/preferred_path.hpp"
+#include "filesystem/save_writer.hpp"
+#include "filesystem/seek_mode.hpp"
+#include "filesystem/virtual_filesystem.hpp"
+#include "math/affine_transform.hpp"
+#include "math/area.hpp"
+#include "math/fixed.hpp"
+#include "math/packed_point.hpp"
+#include "math/packed_rect.hpp"
+#include "math/point.hpp"
+#include "math/point_array.hpp"
+#include "math/rect.hpp"
+#include "math/rect_array.hpp"
+#include "math/spatial_grid.hpp"
+#include "math/vector3.hpp"
+#include "math/vector4.hpp"
+#include "math/vector_utils.hpp"
+#include "system/allocation_tracker.hpp"
+#include "system/battery.hpp"
+#include "system/byte_order.hpp"
+#include "system/clipboard.hpp"
+#include "system/counter.hpp"
+#include "system/cpu.hpp"
+#include "system/fixed_timestep.hpp"
+#include "system/frame_histogram.hpp"
+#include "system/game_loop.hpp"
+#include "system/locale.hpp"
+#include "system/open_url.hpp"
+#include "system/platform.hpp"
+#include "system/power_state.hpp"
+#include "system/profiler.hpp"
+#include "system/profiler_macros.hpp"
+#include "system/ram.hpp"
+#include "system/shared_object.hpp"
+#include "system/simd_arena.hpp"
+#include "system/startup_tracer.hpp"
+#include "thread/adaptive_mutex.hpp"
+#include "thread/blocking_queue.hpp"
+#include "thread/condition.hpp"
+#include "thread/coroutine.hpp"
+#include "thread/deadline.hpp"
+#include "thread/future.hpp"
+#include "thread/lock_status.hpp"
+#include "thread/main_thread_queue.hpp"
+#include "thread/mpmc_queue.hpp"
+#include "thread/mutex.hpp"
+#include "thread/scoped_lock.hpp"
+#include "thread/semaphore.hpp"
+#include "thread/shared_lock.hpp"
+#include "thread/shared_mutex.hpp"
+#include "thread/spsc_queue.hpp"
+#include "thread/task_scheduler.hpp"
+#include "thread/thread.hpp"
+#include "thread/thread_attributes.hpp"
+#include "thread/thread_priority.hpp"
+#include "thread/thread_registry.hpp"
+#include "thread/try_lock.hpp"
+
+#endif  // CENTURION_CORE_MODULE_HEADER
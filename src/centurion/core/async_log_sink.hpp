@@ -0,0 +1,589 @@
+#ifndef CENTURION_ASYNC_LOG_SINK_HEADER
+#define CENTURION_ASYNC_LOG_SINK_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // min
+#include <atomic>       // atomic, atomic_thread_fence, memory_order
+#include <cstring>      // memcpy, strlen
+#include <functional>   // function
+#include <iostream>     // clog
+#include <memory>       // unique_ptr, make_unique
+#include <string>       // string
+#include <string_view>  // string_view
+#include <thread>       // this_thread::yield
+#include <tuple>        // tuple, apply
+#include <type_traits>  // decay_t, is_same_v, conditional_t, is_trivially_copyable_v, ...
+#include <utility>      // move, forward
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_FORMAT
+
+#include <format>  // format_string, format_to_n, vformat, make_format_args, format_error
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+
+#include "../system/counter.hpp"
+#include "../thread/mpmc_queue.hpp"
+#include "../thread/semaphore.hpp"
+#include "../thread/thread.hpp"
+#include "integers.hpp"
+#include "log.hpp"
+#include "log_category.hpp"
+#include "log_priority.hpp"
+#include "time.hpp"
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \enum log_overflow
+ *
+ * \brief Represents what happens to log messages when the buffer of a sink is full.
+ *
+ * \since 6.4.0
+ */
+enum class log_overflow
+{
+  drop,  ///< The message is discarded, and counted as dropped.
+  block  ///< The logging thread waits until the writer has made room for the message.
+};
+
+/**
+ * \struct log_record
+ *
+ * \brief A log message that has been enqueued by an asynchronous log sink.
+ *
+ * \since 6.4.0
+ */
+struct log_record final
+{
+  using formatter_type = std::string (*)(std::string_view pattern, const char* args);
+
+  inline constexpr static usize text_capacity = 208;
+
+  u64 ticks{};                 ///< The value of `counter::now()` when enqueued.
+  formatter_type formatter{};  ///< Formats the captured arguments, if the text is deferred.
+  std::string_view pattern;    ///< The format string of a deferred message.
+  log_category category{};     ///< The category of the message.
+  log_priority priority{};     ///< The priority of the message.
+  u32 length{};                ///< The length of the text, in bytes.
+  char text[text_capacity]{};  ///< The (possibly truncated) text, not null-terminated.
+
+  /**
+   * \brief Returns the text of the message.
+   *
+   * \details Records that are passed to the writer function of a sink are always
+   * formatted, i.e. the captured arguments of deferred messages have been replaced with
+   * the formatted text.
+   *
+   * \return a view of the message text.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto message() const noexcept -> std::string_view
+  {
+    return std::string_view{text, length};
+  }
+};
+
+/// \cond FALSE
+namespace detail {
+
+/* Deferred messages store their arguments in the text of the record. Strings are copied
+   with their length, and everything else is copied as raw bytes, so that the arguments
+   can be formatted by the writer thread after the caller has moved on. */
+
+template <typename T>
+inline constexpr bool is_log_string_v =
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+    std::is_same_v<T, const char*> || std::is_same_v<T, char*>;
+
+template <typename T>
+inline constexpr bool is_log_argument_v =
+    is_log_string_v<T> || (std::is_trivially_copyable_v<T> &&
+                           std::is_default_constructible_v<T> && !std::is_pointer_v<T>);
+
+template <typename T>
+using log_argument_t = std::conditional_t<is_log_string_v<T>, std::string_view, T>;
+
+template <typename T>
+[[nodiscard]] auto capture_log_argument(char* buffer, usize& offset, const T& value) noexcept
+    -> bool
+{
+  if constexpr (is_log_string_v<T>) {
+    const std::string_view str{value};
+    const auto length = static_cast<u32>(str.size());
+
+    if (log_record::text_capacity - offset < sizeof length ||
+        log_record::text_capacity - offset - sizeof length < str.size()) {
+      return false;
+    }
+
+    std::memcpy(buffer + offset, &length, sizeof length);
+    std::memcpy(buffer + offset + sizeof length, str.data(), str.size());
+    offset += sizeof length + str.size();
+  }
+  else {
+    if (log_record::text_capacity - offset < sizeof(T)) {
+      return false;
+    }
+
+    std::memcpy(buffer + offset, &value, sizeof(T));
+    offset += sizeof(T);
+  }
+
+  return true;
+}
+
+template <typename T>
+[[nodiscard]] auto restore_log_argument(const char* buffer, usize& offset) noexcept
+    -> log_argument_t<T>
+{
+  if constexpr (is_log_string_v<T>) {
+    u32 length{};
+    std::memcpy(&length, buffer + offset, sizeof length);
+
+    const std::string_view str{buffer + offset + sizeof length, length};
+    offset += sizeof length + length;
+
+    return str;
+  }
+  else {
+    T value;
+    std::memcpy(&value, buffer + offset, sizeof(T));
+    offset += sizeof(T);
+
+    return value;
+  }
+}
+
+#if CENTURION_HAS_FEATURE_FORMAT
+
+template <typename... Args>
+[[nodiscard]] auto format_log_record(const std::string_view pattern, const char* buffer)
+    -> std::string
+{
+  usize offset = 0;
+
+  // Braced initialization restores the arguments from left to right
+  std::tuple<log_argument_t<Args>...> args{restore_log_argument<Args>(buffer, offset)...};
+
+  return std::apply(
+      [pattern](auto&... values) {
+        return std::vformat(pattern, std::make_format_args(values...));
+      },
+      args);
+}
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class async_log_sink
+ *
+ * \brief Writes log messages on a background thread.
+ *
+ * \details By default, every call to `log::msg()` and friends outputs the message on the
+ * calling thread, which can be surprisingly expensive. An asynchronous sink replaces the
+ * SDL log output function while it's alive, and copies each message into a fixed-size
+ * record in a lock-free ring buffer. A background thread writes the records, either to
+ * `std::clog` or with a custom writer function.
+ * \code{cpp}
+ *   cen::async_log_sink sink{4'096};
+ *
+ *   cen::log::set_priority(cen::log_priority::verbose);
+ *   cen::log::verbose("Rendered %i sprites", count);  // Only copies the message
+ * \endcode
+ *
+ * \details Messages longer than `log_record::text_capacity` bytes are truncated. When the
+ * buffer is full, messages are either dropped or the logging thread waits, depending on
+ * the overflow policy. Dropped and truncated messages are counted.
+ *
+ * \details When `std::format` is available, `submit()` goes one step further, and only
+ * copies the format arguments into the record, leaving the formatting to the writer
+ * thread.
+ * \code{cpp}
+ *   sink.submit(cen::log_priority::debug, cen::log_category::app, "{} at {}", name, pos.x);
+ * \endcode
+ *
+ * \note Only one sink should be alive at a time, and the writer function must not log
+ * messages itself, since it's invoked by the thread that empties the buffer.
+ *
+ * \see `log::set_output_function()`
+ *
+ * \since 6.4.0
+ */
+class async_log_sink final
+{
+ public:
+  using size_type = usize;
+  using writer_type = std::function<void(const log_record&)>;
+
+  /**
+   * \brief Creates a sink, starts its writer thread, and installs it as the SDL log
+   * output function.
+   *
+   * \param capacity the minimum number of records the buffer can hold, which is rounded
+   * up to a power of two.
+   * \param overflow what happens to messages when the buffer is full.
+   * \param writer the function that writes records, invoked on the writer thread; an
+   * empty function writes formatted records to `std::clog`.
+   *
+   * \throws sdl_error if the writer thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit async_log_sink(const size_type capacity = 1'024,
+                          const log_overflow overflow = log_overflow::drop,
+                          writer_type writer = {})
+      : m_records{capacity}
+      , m_wake{0}
+      , m_writer{std::move(writer)}
+      , m_start{counter::now()}
+      , m_frequency{counter::frequency()}
+      , m_overflow{overflow}
+  {
+    m_thread = std::make_unique<thread>(&async_log_sink::run, "log", this);
+
+    SDL_LogGetOutputFunction(&m_previous, &m_previousData);
+    SDL_LogSetOutputFunction(&async_log_sink::output, this);
+  }
+
+  async_log_sink(const async_log_sink&) = delete;
+
+  auto operator=(const async_log_sink&) -> async_log_sink& = delete;
+
+  /**
+   * \brief Restores the previous output function, and writes the remaining records before
+   * stopping the writer thread.
+   *
+   * \since 6.4.0
+   */
+  ~async_log_sink() noexcept
+  {
+    SDL_LogSetOutputFunction(m_previous, m_previousData);
+
+    m_stop.store(true, std::memory_order_release);
+    m_wake.release();
+
+    m_thread.reset();
+  }
+
+  /**
+   * \brief Enqueues a message, without going through SDL.
+   *
+   * \note This function may be called from any thread.
+   *
+   * \param category the category of the message.
+   * \param priority the priority of the message.
+   * \param message the text of the message, truncated if it doesn't fit in a record.
+   *
+   * \return `true` if the message was enqueued; `false` if it was dropped.
+   *
+   * \since 6.4.0
+   */
+  auto write(const log_category category,
+             const log_priority priority,
+             const std::string_view message) noexcept -> bool
+  {
+    log_record record;
+    record.ticks = counter::now();
+    record.category = category;
+    record.priority = priority;
+    record.length = static_cast<u32>(std::min(message.size(), log_record::text_capacity));
+    std::memcpy(record.text, message.data(), record.length);
+
+    if (record.length < message.size()) {
+      m_truncated.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return push(record);
+  }
+
+#if CENTURION_HAS_FEATURE_FORMAT
+
+  /**
+   * \brief Enqueues a message that is formatted with `std::format` by the writer thread.
+   *
+   * \details The format string is validated at compile time, and nothing is copied if the
+   * priority isn't enabled for the category. Otherwise, the arguments are copied into the
+   * record in binary form, and are formatted just before the writer function is invoked.
+   * Messages with arguments that don't fit in a record are formatted immediately instead.
+   *
+   * \details The format arguments may be strings (which are copied), or trivially copyable
+   * values that aren't pointers, e.g. integers, floating-point numbers and points.
+   *
+   * \note The format string must outlive the sink, which is the case for string literals.
+   *
+   * \note This function may be called from any thread.
+   *
+   * \tparam Args the types of the format arguments.
+   *
+   * \param priority the priority of the message.
+   * \param category the category of the message.
+   * \param fmt the format string, which is checked at compile time.
+   * \param args the arguments that will be used by the format string.
+   *
+   * \return `true` if the message was enqueued; `false` if it was filtered out by its
+   * priority or dropped.
+   *
+   * \see `log::enabled()`
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  auto submit(const log_priority priority,
+              const log_category category,
+              const std::format_string<Args...> fmt,
+              Args&&... args) -> bool
+  {
+    static_assert((detail::is_log_argument_v<std::decay_t<Args>> && ...),
+                  "Deferred log arguments must be strings or trivially copyable values!");
+
+    if (!log::enabled(category, priority)) {
+      return false;
+    }
+
+    log_record record;
+    record.ticks = counter::now();
+    record.category = category;
+    record.priority = priority;
+
+    usize offset = 0;
+    if ((detail::capture_log_argument<std::decay_t<Args>>(record.text, offset, args) && ...)) {
+      record.formatter = &detail::format_log_record<std::decay_t<Args>...>;
+      record.pattern = fmt.get();
+      record.length = static_cast<u32>(offset);
+    }
+    else {
+      const auto result = std::format_to_n(record.text,
+                                           log_record::text_capacity,
+                                           fmt,
+                                           std::forward<Args>(args)...);
+      record.length = static_cast<u32>(result.out - record.text);
+
+      if (static_cast<usize>(result.size) > log_record::text_capacity) {
+        m_truncated.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    return push(record);
+  }
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+
+  /**
+   * \brief Blocks until all messages that were enqueued before the call have been
+   * written.
+   *
+   * \note This function must not be called by the writer function.
+   *
+   * \since 6.4.0
+   */
+  void flush() noexcept
+  {
+    const auto target = m_enqueued.load(std::memory_order_acquire);
+
+    while (m_written.load(std::memory_order_acquire) < target) {
+      notify();
+      thread::sleep(milliseconds<u32>{1});
+    }
+  }
+
+  /**
+   * \brief Returns the amount of messages that were discarded because the buffer was full.
+   *
+   * \return the number of dropped messages.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> u64
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of messages that were too long to fit in a record.
+   *
+   * \return the number of truncated messages.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto truncated() const noexcept -> u64
+  {
+    return m_truncated.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of messages that have been written.
+   *
+   * \return the number of written messages.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto written() const noexcept -> u64
+  {
+    return m_written.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the maximum number of records in the buffer.
+   *
+   * \return the capacity of the buffer, which is a power of two.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_records.capacity();
+  }
+
+ private:
+  inline constexpr static u32 idle_timeout_ms = 50;
+
+  mpmc_queue<log_record> m_records;
+  semaphore m_wake;
+  writer_type m_writer;
+  u64 m_start{};
+  u64 m_frequency{1};
+  log_overflow m_overflow{};
+  SDL_LogOutputFunction m_previous{};
+  void* m_previousData{};
+
+  std::atomic<u64> m_enqueued{};
+  std::atomic<u64> m_written{};
+  std::atomic<u64> m_dropped{};
+  std::atomic<u64> m_truncated{};
+  std::atomic<bool> m_idle{};  ///< Set while the writer waits for records.
+  std::atomic<bool> m_stop{};
+
+  std::unique_ptr<thread> m_thread;  // Last, so that the writer stops first
+
+  // Only wakes the writer if it's idle, so that logging usually avoids a system call
+  void notify() noexcept
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_idle.load(std::memory_order_relaxed) &&
+        m_idle.exchange(false, std::memory_order_acq_rel)) {
+      m_wake.release();
+    }
+  }
+
+  auto push(const log_record& record) noexcept -> bool
+  {
+    while (!m_records.try_push(record)) {
+      if (m_overflow == log_overflow::drop) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+
+      notify();
+      std::this_thread::yield();
+    }
+
+    m_enqueued.fetch_add(1, std::memory_order_release);
+    notify();
+
+    return true;
+  }
+
+  void emit(const log_record& record)
+  {
+    if (record.formatter) {
+      log_record formatted;
+      formatted.ticks = record.ticks;
+      formatted.category = record.category;
+      formatted.priority = record.priority;
+
+      const auto text = format(record);
+      formatted.length = static_cast<u32>(std::min(text.size(), log_record::text_capacity));
+      std::memcpy(formatted.text, text.data(), formatted.length);
+
+      if (formatted.length < text.size()) {
+        m_truncated.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      emit(formatted);
+    }
+    else if (m_writer) {
+      m_writer(record);
+    }
+    else {
+      const auto elapsed = static_cast<double>(record.ticks - m_start) /
+                           static_cast<double>(m_frequency);
+      std::clog << "LOG " << elapsed << " [" << to_string(record.priority) << "] > "
+                << record.message() << '\n';
+    }
+  }
+
+  [[nodiscard]] static auto format(const log_record& record) -> std::string
+  {
+#if CENTURION_HAS_FEATURE_FORMAT
+    try {
+      return record.formatter(record.pattern, record.text);
+    }
+    catch (const std::format_error&) {
+      return std::string{record.pattern};  // Invalid arguments, e.g. a negative width
+    }
+#else
+    return record.formatter(record.pattern, record.text);
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+  }
+
+  static void output(void* data,
+                     const int category,
+                     const SDL_LogPriority priority,
+                     const char* message)
+  {
+    auto* self = static_cast<async_log_sink*>(data);
+    self->write(static_cast<log_category>(category),
+                static_cast<log_priority>(priority),
+                std::string_view{message, std::strlen(message)});
+  }
+
+  static auto run(void* data) -> int
+  {
+    auto& self = *static_cast<async_log_sink*>(data);
+
+    while (true) {
+      while (auto record = self.m_records.try_pop()) {
+        self.emit(*record);
+        self.m_written.fetch_add(1, std::memory_order_release);
+      }
+
+      if (self.m_stop.load(std::memory_order_acquire)) {
+        if (self.m_records.empty()) {
+          break;
+        }
+
+        continue;
+      }
+
+      self.m_idle.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      if (self.m_records.empty()) {
+        self.m_wake.acquire(milliseconds<u32>{idle_timeout_ms});
+      }
+
+      self.m_idle.store(false, std::memory_order_relaxed);
+    }
+
+    self.m_idle.store(false, std::memory_order_relaxed);
+    std::clog.flush();
+
+    return 0;
+  }
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_ASYNC_LOG_SINK_HEADER
@@ -0,0 +1,50 @@
+#ifndef CENTURION_CORE_FWD_HEADER
+#define CENTURION_CORE_FWD_HEADER
+
+#include "../detail/ownership_tags.hpp"
+
+/**
+ * \file core_fwd.hpp
+ *
+ * \brief Provides forward declarations of the core and math components.
+ *
+ * \details Include this header instead of the full headers in headers that only refer
+ * to these types by reference or pointer.
+ */
+
+namespace cen {
+
+class result;
+class library;
+class error_info;
+class sdl_string;
+
+struct config;
+struct subsystem_timing;
+struct version;
+
+template <typename T>
+class expected;
+
+template <typename T>
+struct basic_area;
+
+template <typename T>
+class basic_point;
+
+template <typename T>
+class basic_rect;
+
+using iarea = basic_area<int>;
+using farea = basic_area<float>;
+using darea = basic_area<double>;
+
+using ipoint = basic_point<int>;
+using fpoint = basic_point<float>;
+
+using irect = basic_rect<int>;
+using frect = basic_rect<float>;
+
+}  // namespace cen
+
+#endif  // CENTURION_CORE_FWD_HEADER
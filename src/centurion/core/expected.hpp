@@ -0,0 +1,379 @@
+#ifndef CENTURION_EXPECTED_HEADER
+#define CENTURION_EXPECTED_HEADER
+
+#include <SDL2/SDL.h>
+
+#ifndef CENTURION_NO_SDL_IMAGE
+#include <SDL2/SDL_image.h>
+#endif  // CENTURION_NO_SDL_IMAGE
+
+#ifndef CENTURION_NO_SDL_MIXER
+#include <SDL2/SDL_mixer.h>
+#endif  // CENTURION_NO_SDL_MIXER
+
+#ifndef CENTURION_NO_SDL_TTF
+#include <SDL2/SDL_ttf.h>
+#endif  // CENTURION_NO_SDL_TTF
+
+#include <cassert>      // assert
+#include <optional>     // optional
+#include <ostream>      // ostream
+#include <string>       // string
+#include <string_view>  // string_view
+#include <type_traits>  // is_nothrow_move_constructible_v
+#include <utility>      // move, in_place_index
+#include <variant>      // variant, get_if
+
+#include "exception.hpp"
+#include "str.hpp"
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \enum error_code
+ *
+ * \brief Represents the origin of an error reported by an `expected` value.
+ *
+ * \since 6.4.0
+ */
+enum class error_code
+{
+  sdl,          ///< The error was reported by SDL2.
+  img,          ///< The error was reported by SDL2_image.
+  ttf,          ///< The error was reported by SDL2_ttf.
+  mix,          ///< The error was reported by SDL2_mixer.
+  bad_argument  ///< An invalid argument was supplied to the library.
+};
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied error code.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(error_code::ttf) == "ttf"`.
+ *
+ * \param code the error code that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const error_code code) -> std::string_view
+{
+  switch (code) {
+    case error_code::sdl:
+      return "sdl";
+
+    case error_code::img:
+      return "img";
+
+    case error_code::ttf:
+      return "ttf";
+
+    case error_code::mix:
+      return "mix";
+
+    case error_code::bad_argument:
+      return "bad_argument";
+
+    default:
+      throw cen_error{"Did not recognize error code!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of an error code enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param code the error code that will be printed.
+ *
+ * \see `to_string(error_code)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const error_code code) -> std::ostream&
+{
+  return stream << to_string(code);
+}
+
+/// \} End of streaming
+
+/**
+ * \class error_info
+ *
+ * \brief Describes why an operation that returned an `expected` value failed.
+ *
+ * \details Creating an error is cheap, since the error message of the library that
+ * reported the error isn't copied until `message()` is called for the first time. The
+ * error message is cached after that.
+ *
+ * \note The messages of SDL and its extension libraries are overwritten by later errors on
+ * the same thread, so `message()` should be called before any other function that might
+ * fail.
+ *
+ * \since 6.4.0
+ */
+class error_info final
+{
+ public:
+  /**
+   * \brief Creates an error reported by a library, with a lazily fetched message.
+   *
+   * \param code the origin of the error.
+   *
+   * \since 6.4.0
+   */
+  explicit error_info(const error_code code) noexcept : m_code{code}
+  {}
+
+  /**
+   * \brief Creates an error with a static message.
+   *
+   * \param code the origin of the error.
+   * \param what the message of the error, must outlive the error; can safely be null.
+   *
+   * \since 6.4.0
+   */
+  error_info(const error_code code, const str what) noexcept : m_code{code}, m_what{what}
+  {}
+
+  /**
+   * \brief Returns the origin of the error.
+   *
+   * \return the error code.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto code() const noexcept -> error_code
+  {
+    return m_code;
+  }
+
+  /**
+   * \brief Returns the message associated with the error.
+   *
+   * \details The first call fetches and caches the error message of the library that
+   * reported the error. The fetched message is whatever the library reports at the time of
+   * that call, e.g. the current result of `SDL_GetError()`, which is not necessarily the
+   * message of the original failure if another error occurred in between.
+   *
+   * \return the error message, or `"n/a"` if there is none.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto message() const -> str
+  {
+    if (m_what) {
+      return m_what;
+    }
+
+    if (!m_message) {
+      const auto fetched = fetch();
+      m_message.emplace(fetched ? fetched : "n/a");
+    }
+
+    return m_message->c_str();
+  }
+
+ private:
+  error_code m_code{};
+  str m_what{};
+  mutable std::optional<std::string> m_message;
+
+  [[nodiscard]] auto fetch() const noexcept -> str
+  {
+    switch (m_code) {
+      case error_code::sdl:
+        return SDL_GetError();
+
+#ifndef CENTURION_NO_SDL_IMAGE
+      case error_code::img:
+        return IMG_GetError();
+#endif  // CENTURION_NO_SDL_IMAGE
+
+#ifndef CENTURION_NO_SDL_TTF
+      case error_code::ttf:
+        return TTF_GetError();
+#endif  // CENTURION_NO_SDL_TTF
+
+#ifndef CENTURION_NO_SDL_MIXER
+      case error_code::mix:
+        return Mix_GetError();
+#endif  // CENTURION_NO_SDL_MIXER
+
+      default:
+        return nullptr;
+    }
+  }
+};
+
+/**
+ * \class expected
+ *
+ * \brief Holds either the result of an operation or the reason it failed.
+ *
+ * \details This is returned by factories such as `surface::try_load()`, which report
+ * failures without throwing exceptions. This makes failures cheap, which is useful in
+ * loading code that expects some resources to be missing, and in builds that don't use
+ * exceptions.
+ * \code{cpp}
+ *   auto image = cen::surface::try_load("missing.png");
+ *   if (!image) {
+ *     cen::log::warn("Could not load image: %s", image.error().message());
+ *   }
+ * \endcode
+ *
+ * \note Accessing the value of an expected value that holds an error, or vice versa, is
+ * undefined behavior.
+ *
+ * \tparam T the type of the expected value.
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class expected final
+{
+ public:
+  using value_type = T;
+
+  /**
+   * \brief Creates an expected value that holds a value.
+   *
+   * \param value the value that will be stored.
+   *
+   * \since 6.4.0
+   */
+  expected(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)  // NOLINT
+      : m_data{std::in_place_index<0>, std::move(value)}
+  {}
+
+  /**
+   * \brief Creates an expected value that holds an error.
+   *
+   * \param error the error that will be stored.
+   *
+   * \since 6.4.0
+   */
+  expected(error_info error) noexcept  // NOLINT implicit
+      : m_data{std::in_place_index<1>, std::move(error)}
+  {}
+
+  /**
+   * \brief Indicates whether or not a value is stored.
+   *
+   * \return `true` if a value is stored; `false` if an error is stored.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto has_value() const noexcept -> bool
+  {
+    return m_data.index() == 0;
+  }
+
+  /**
+   * \brief Returns the stored value.
+   *
+   * \pre A value must be stored.
+   *
+   * \return the stored value.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto value() & noexcept -> T&
+  {
+    assert(has_value());
+    return *std::get_if<0>(&m_data);
+  }
+
+  /// \copydoc value()
+  [[nodiscard]] auto value() const& noexcept -> const T&
+  {
+    assert(has_value());
+    return *std::get_if<0>(&m_data);
+  }
+
+  /// \copydoc value()
+  [[nodiscard]] auto value() && noexcept -> T&&
+  {
+    assert(has_value());
+    return std::move(*std::get_if<0>(&m_data));
+  }
+
+  /**
+   * \brief Returns the stored error.
+   *
+   * \pre An error must be stored.
+   *
+   * \return the stored error.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto error() const noexcept -> const error_info&
+  {
+    assert(!has_value());
+    return *std::get_if<1>(&m_data);
+  }
+
+  /// \copydoc value()
+  [[nodiscard]] auto operator*() & noexcept -> T&
+  {
+    return value();
+  }
+
+  /// \copydoc value()
+  [[nodiscard]] auto operator*() const& noexcept -> const T&
+  {
+    return value();
+  }
+
+  /// \copydoc value()
+  [[nodiscard]] auto operator*() && noexcept -> T&&
+  {
+    return std::move(*this).value();
+  }
+
+  [[nodiscard]] auto operator->() noexcept -> T*
+  {
+    return &value();
+  }
+
+  [[nodiscard]] auto operator->() const noexcept -> const T*
+  {
+    return &value();
+  }
+
+  /**
+   * \brief Indicates whether or not a value is stored.
+   *
+   * \return `true` if a value is stored; `false` if an error is stored.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] explicit operator bool() const noexcept
+  {
+    return has_value();
+  }
+
+ private:
+  std::variant<T, error_info> m_data;
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_EXPECTED_HEADER
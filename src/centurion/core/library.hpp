@@ -63,11 +63,26 @@
 #include <SDL2/SDL_ttf.h>
 #endif  // CENTURION_NO_SDL_TTF
 
+#include <atomic>    // atomic, memory_order
 #include <cassert>   // assert
+#include <iomanip>   // setprecision
+#include <memory>    // unique_ptr, make_unique
 #include <optional>  // optional
-
+#include <sstream>   // stringstream
+#include <string>    // string
+#include <vector>    // vector
+
+#include "../system/counter.hpp"
+#include "../system/ram.hpp"
+#include "../system/startup_tracer.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
 #include "exception.hpp"
 #include "integers.hpp"
+#include "library_subsystem.hpp"
+#include "time.hpp"
+#include "to_underlying.hpp"
 
 /**
  * \namespace cen
@@ -101,7 +116,9 @@ namespace cen {
  * Indicates whether or not SDL2_ttf is initialized.
  *
  * \var config::coreFlags
- * Flags passed on to `SDL_Init()`, if \ref config.initCore is `true`.
+ * Flags passed on to `SDL_Init()`, if \ref config.initCore is `true`. In headless builds,
+ * i.e. if `CENTURION_HEADLESS` is defined, this is `SDL_INIT_TIMER | SDL_INIT_EVENTS` by
+ * default, and the video, audio and input flags are ignored.
  *
  * \var config::imageFlags
  * Flags passed on to `IMG_Init()`, if \ref config.initImage is `true`.
@@ -119,7 +136,20 @@ namespace cen {
  * The amount of channels used by SDL2_mixer, if \ref config.initMixer is `true`.
  *
  * \var config::mixerChunkSize
- * The chunk size used by SDL2_mixer, if \ref config.initMixer is `true`.
+ * The chunk size used by SDL2_mixer, if \ref config.initMixer is `true`. This is the size
+ * of the audio buffer in sample frames, smaller values reduce the output latency at the
+ * cost of more frequent audio callbacks, e.g. 256 or 512 for rhythm games, and larger
+ * values save power.
+ *
+ * \var config::mixerDevice
+ * The name of the audio device opened by SDL2_mixer, if \ref config.initMixer is `true`,
+ * as reported by `SDL_GetAudioDeviceName()`. The default device is used if this is null.
+ *
+ * \var config::lazy
+ * Indicates whether or not the audio, input and SDL extension subsystems are initialized
+ * on first use, rather than by the `library` constructor. The SDL2 core, including the
+ * video subsystem, is always initialized eagerly. Note, only the subsystems that are enabled
+ * by the other fields are initialized lazily.
  */
 struct config final
 {
@@ -127,8 +157,13 @@ struct config final
   bool initImage{true};
   bool initMixer{true};
   bool initTTF{true};
+  bool lazy{};
 
+#if CENTURION_HAS_FEATURE_HEADLESS
+  u32 coreFlags{SDL_INIT_TIMER | SDL_INIT_EVENTS};
+#else
   u32 coreFlags{SDL_INIT_EVERYTHING};
+#endif  // CENTURION_HAS_FEATURE_HEADLESS
 
 #ifndef CENTURION_NO_SDL_IMAGE
   int imageFlags{IMG_INIT_PNG | IMG_INIT_JPG | IMG_INIT_TIF | IMG_INIT_WEBP};
@@ -141,9 +176,60 @@ struct config final
   u16 mixerFormat{MIX_DEFAULT_FORMAT};
   int mixerChannels{MIX_DEFAULT_CHANNELS};
   int mixerChunkSize{4096};
+  const char* mixerDevice{};
 #endif  // CENTURION_NO_SDL_MIXER
 };
 
+/**
+ * \brief Returns a configuration that only initializes the timer and event subsystems.
+ *
+ * \details This is intended for processes without a display or audio device, such as
+ * dedicated servers, that still use e.g. timers, threads, files, logging and user events.
+ * The SDL extension libraries are not initialized, and neither are the video, audio and
+ * input subsystems, which saves most of the startup time and memory of the library, see
+ * `library::timing_report()`.
+ *
+ * \details Defining `CENTURION_HEADLESS` enforces this configuration at compile-time, by
+ * excluding the SDL extension libraries and the graphics APIs, and by rejecting owning
+ * windows and renderers. Without the macro, this configuration can be selected at runtime,
+ * e.g. by a command-line option, by programs that can also run with a window.
+ * \code{cpp}
+ *   const cen::library centurion{cen::headless_config()};
+ *   cen::log::info("%s", centurion.timing_report().c_str());
+ * \endcode
+ *
+ * \return a configuration for headless processes.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto headless_config() noexcept -> config
+{
+  config cfg;
+  cfg.initImage = false;
+  cfg.initMixer = false;
+  cfg.initTTF = false;
+  cfg.coreFlags = SDL_INIT_TIMER | SDL_INIT_EVENTS;
+  return cfg;
+}
+
+/**
+ * \struct subsystem_timing
+ *
+ * \brief Describes how long it took to initialize a library subsystem.
+ *
+ * \see `library::timings()`
+ *
+ * \since 6.4.0
+ */
+struct subsystem_timing final
+{
+  library_subsystem subsystem{};  ///< The initialized subsystem.
+  nanoseconds<u64> duration{};    ///< The time it took to initialize the subsystem.
+  bool deferred{};                ///< Initialized after the `library` constructor.
+  bool async{};                   ///< Initialized by the background thread.
+  i64 memory{};                   ///< The change in resident process memory, in bytes.
+};
+
 /**
  * \class library
  *
@@ -163,6 +249,28 @@ struct config final
  *   }
  * \endcode
  *
+ * \details Opening the audio device and enumerating input devices can make up most of the
+ * startup time of an application. With lazy initialization, see `config::lazy`, these
+ * subsystems are instead initialized when they are first used, e.g. by the first
+ * `sound_effect`, `music`, `controller` or `font`. Alternatively, the deferred audio and
+ * SDL extension subsystems can be initialized on a background thread, while the main
+ * thread shows a splash screen.
+ * \code{cpp}
+ *   cen::config cfg;
+ *   cfg.lazy = true;
+ *
+ *   cen::library centurion{cfg};
+ *   centurion.init_async();
+ *
+ *   // ...
+ *
+ *   cen::log::info("%s", centurion.timing_report().c_str());
+ * \endcode
+ *
+ * \details Processes without a display or audio device, such as dedicated servers, should
+ * use `headless_config()`, or define `CENTURION_HEADLESS`, to only initialize the timer
+ * and event subsystems.
+ *
  * \note The signature of the main-function must be `ìnt(int, char**)` when
  * using the Centurion library!
  *
@@ -221,7 +329,168 @@ class library final
 
   auto operator=(library&&) -> library& = delete;
 
+  /**
+   * \brief Waits for the background initialization to finish, if there is any, and
+   * de-initializes the library.
+   *
+   * \since 6.4.0
+   */
+  ~library() noexcept
+  {
+    m_worker.reset();
+    s_instance.store(nullptr, std::memory_order_release);
+  }
+
+  /**
+   * \brief Initializes a subsystem, if it was deferred and hasn't been initialized yet.
+   *
+   * \details This function is invoked by the components that depend on lazily initialized
+   * subsystems, e.g. the first `sound_effect` initializes SDL2_mixer and the first
+   * `controller` initializes the game controller subsystem. It can also be called in
+   * advance, which is required by applications that react to device events, since these
+   * aren't emitted before the associated subsystem has been initialized.
+   *
+   * \details This function does nothing if there is no `library` instance, if the library
+   * isn't initialized lazily, or if the subsystem isn't enabled by the library
+   * configuration.
+   *
+   * \note This function may be called from any thread, but SDL2 requires the input
+   * subsystems to be initialized by the main thread on some platforms.
+   *
+   * \param subsystem the subsystem that will be initialized.
+   *
+   * \throws sdl_error if an SDL2 subsystem can't be initialized.
+   * \throws img_error if the SDL2_image library can't be initialized.
+   * \throws ttf_error if the SDL2_ttf library can't be initialized.
+   * \throws mix_error if the SDL2_mixer library can't be initialized.
+   *
+   * \since 6.4.0
+   */
+  static void ensure(const library_subsystem subsystem)
+  {
+    if (auto* instance = s_instance.load(std::memory_order_acquire)) {
+      instance->init_subsystem(subsystem, false);
+    }
+  }
+
+  /**
+   * \brief Initializes the deferred audio and SDL extension subsystems on a background
+   * thread.
+   *
+   * \details This is intended to be called right after the library has been created, e.g.
+   * before a splash screen is shown, so that the audio device is opened while the main
+   * thread does other work. A subsystem that is used before the background thread has
+   * initialized it is instead initialized by the using thread, which only blocks if the
+   * background thread is busy initializing a subsystem.
+   *
+   * \details The input subsystems are not initialized by the background thread, since
+   * SDL2 requires them to be initialized by the main thread on some platforms.
+   *
+   * \note Errors that occur on the background thread are not reported, instead, the
+   * subsystem is initialized again on first use, which throws the error.
+   *
+   * \throws sdl_error if the background thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  void init_async()
+  {
+    if (m_cfg.lazy && !m_worker) {
+      m_worker = std::make_unique<thread>(&library::run_async, "library", this);
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not a subsystem has been initialized.
+   *
+   * \param subsystem the subsystem that will be checked.
+   *
+   * \return `true` if the subsystem has been initialized; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_initialized(const library_subsystem subsystem) const noexcept
+      -> bool
+  {
+    return is_settled(subsystem) && is_enabled(subsystem);
+  }
+
+  /**
+   * \brief Returns the time it took to initialize each subsystem.
+   *
+   * \details The timings are listed in the order that the subsystems were initialized in.
+   * Subsystems that haven't been initialized are not included.
+   *
+   * \return the initialization timings.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto timings() const -> std::vector<subsystem_timing>
+  {
+    if (m_mutex) {
+      scoped_lock lock{*m_mutex};
+      return m_timings;
+    }
+    else {
+      return m_timings;
+    }
+  }
+
+  /**
+   * \brief Returns a summary of the subsystem initialization timings.
+   *
+   * \details The summary features one line per initialized subsystem, e.g.
+   * `"mixer: 212.40 ms, 3.52 MB (async)"`, followed by the total initialization time and
+   * memory. The memory is the change in resident process memory while the subsystem was
+   * initialized, which is only approximate for subsystems that are initialized while other
+   * threads are running, e.g. by `init_async()`.
+   *
+   * \return a textual summary of the initialization timings.
+   *
+   * \see `timings()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto timing_report() const -> std::string
+  {
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(2);
+
+    constexpr double megabyte = 1'024.0 * 1'024.0;
+
+    nanoseconds<u64> total{};
+    i64 memory{};
+
+    for (const auto& timing : timings()) {
+      total += timing.duration;
+      memory += timing.memory;
+
+      stream << to_string(timing.subsystem) << ": "
+             << milliseconds<double>{timing.duration}.count() << " ms, "
+             << static_cast<double>(timing.memory) / megabyte << " MB";
+      if (timing.deferred) {
+        stream << (timing.async ? " (async)" : " (deferred)");
+      }
+
+      stream << '\n';
+    }
+
+    stream << "total: " << milliseconds<double>{total}.count() << " ms, "
+           << static_cast<double>(memory) / megabyte << " MB";
+    return stream.str();
+  }
+
  private:
+  // The SDL2 subsystems that are left out of SDL_Init() by lazily initialized libraries
+  inline constexpr static u32 deferred_flags = SDL_INIT_AUDIO | SDL_INIT_JOYSTICK |
+                                               SDL_INIT_HAPTIC | SDL_INIT_GAMECONTROLLER |
+                                               SDL_INIT_SENSOR;
+
+  // The SDL2 subsystems that are never initialized by headless builds
+  inline constexpr static u32 headless_excluded_flags = SDL_INIT_VIDEO | deferred_flags;
+
+  inline static std::atomic<library*> s_instance{};
+
   struct sdl final
   {
     explicit sdl(const u32 flags)
@@ -264,13 +533,22 @@ class library final
               const int freq,
               const u16 format,
               const int nChannels,
-              const int chunkSize)
+              const int chunkSize,
+              const char* device)
     {
       if (!Mix_Init(flags)) {
         throw mix_error{};
       }
 
-      if (Mix_OpenAudio(freq, format, nChannels, chunkSize) == -1) {
+      if (device) {
+        // These are the changes allowed by Mix_OpenAudio
+        constexpr auto changes = SDL_AUDIO_ALLOW_FREQUENCY_CHANGE |
+                                 SDL_AUDIO_ALLOW_CHANNELS_CHANGE;
+        if (Mix_OpenAudioDevice(freq, format, nChannels, chunkSize, device, changes) == -1) {
+          throw mix_error{};
+        }
+      }
+      else if (Mix_OpenAudio(freq, format, nChannels, chunkSize) == -1) {
         throw mix_error{};
       }
     }
@@ -318,33 +596,183 @@ class library final
   std::optional<sdl_mixer> m_mixer;
 #endif  // CENTURION_NO_SDL_MIXER
 
+  mutable std::optional<mutex> m_mutex;     ///< Only used by lazily initialized libraries.
+  std::atomic<u32> m_settled{};             ///< Subsystems that need no initialization.
+  std::vector<subsystem_timing> m_timings;  ///< Guarded by the mutex, if there is one.
+  std::unique_ptr<thread> m_worker;         ///< Declared last, to be joined first.
+
   void init()
   {
-    if (m_cfg.initCore) {
-      m_sdl.emplace(m_cfg.coreFlags);
+    const startup_scope trace{"library"};
+
+    if (m_cfg.lazy) {
+      m_mutex.emplace();
+    }
+
+    for (usize index = 0; index < library_subsystem_count; ++index) {
+      const auto subsystem = static_cast<library_subsystem>(index);
+      if (!is_deferred(subsystem)) {
+        init_subsystem(subsystem, false);
+      }
+    }
+
+    s_instance.store(this, std::memory_order_release);
+  }
+
+  void init_subsystem(const library_subsystem subsystem, const bool async)
+  {
+    if (is_settled(subsystem)) {
+      return;
     }
 
-#ifndef CENTURION_NO_SDL_IMAGE
-    if (m_cfg.initImage) {
-      m_img.emplace(m_cfg.imageFlags);
+    // SDL2_mixer opens the audio device, which depends on the audio subsystem
+    if (subsystem == library_subsystem::mixer) {
+      init_subsystem(library_subsystem::audio, async);
+    }
+
+    std::optional<scoped_lock> lock;
+    if (m_mutex) {
+      lock.emplace(*m_mutex);
+    }
+
+    // The subsystem might have been initialized while we were waiting for the lock
+    if (is_settled(subsystem)) {
+      return;
+    }
+
+    // Without lazy initialization, the SDL2 subsystems are initialized along with the core
+    const auto separate = m_cfg.lazy || detail::subsystem_flag(subsystem) == 0;
+
+    if (separate && is_enabled(subsystem)) {
+      const auto residentBefore = ram::process_resident_bytes();
+
+      const auto start = counter::now();
+      emplace(subsystem);
+      const auto end = counter::now();
+
+      const auto residentAfter = ram::process_resident_bytes();
+
+      startup_tracer::record(to_string(subsystem).data(), start, end);
+
+      const auto ticks = static_cast<double>(end - start);
+      const auto freq = static_cast<double>(counter::frequency());
+
+      subsystem_timing timing;
+      timing.subsystem = subsystem;
+      timing.duration = nanoseconds<u64>{freq > 0 ? static_cast<u64>(ticks * 1e9 / freq) : 0u};
+      timing.deferred = is_deferred(subsystem);
+      timing.async = async;
+      timing.memory = static_cast<i64>(residentAfter) - static_cast<i64>(residentBefore);
+
+      m_timings.push_back(timing);
     }
+
+    m_settled.fetch_or(u32{1} << to_underlying(subsystem), std::memory_order_release);
+  }
+
+  void emplace(const library_subsystem subsystem)
+  {
+    switch (subsystem) {
+      case library_subsystem::core:
+        m_sdl.emplace(m_cfg.lazy ? (core_flags() & ~deferred_flags) : core_flags());
+        break;
+
+#ifndef CENTURION_NO_SDL_IMAGE
+      case library_subsystem::image:
+        m_img.emplace(m_cfg.imageFlags);
+        break;
 #endif  // CENTURION_NO_SDL_IMAGE
 
 #ifndef CENTURION_NO_SDL_TTF
-    if (m_cfg.initTTF) {
-      m_ttf.emplace();
-    }
+      case library_subsystem::ttf:
+        m_ttf.emplace();
+        break;
 #endif  // CENTURION_NO_SDL_TTF
 
 #ifndef CENTURION_NO_SDL_MIXER
-    if (m_cfg.initMixer) {
-      m_mixer.emplace(m_cfg.mixerFlags,
-                      m_cfg.mixerFreq,
-                      m_cfg.mixerFormat,
-                      m_cfg.mixerChannels,
-                      m_cfg.mixerChunkSize);
+      case library_subsystem::mixer:
+        m_mixer.emplace(m_cfg.mixerFlags,
+                        m_cfg.mixerFreq,
+                        m_cfg.mixerFormat,
+                        m_cfg.mixerChannels,
+                        m_cfg.mixerChunkSize,
+                        m_cfg.mixerDevice);
+        break;
+#endif  // CENTURION_NO_SDL_MIXER
+
+      default:
+        // These are shut down by SDL_Quit(), along with the core
+        if (SDL_InitSubSystem(detail::subsystem_flag(subsystem)) < 0) {
+          throw sdl_error{};
+        }
+        break;
     }
+  }
+
+  [[nodiscard]] auto is_settled(const library_subsystem subsystem) const noexcept -> bool
+  {
+    const auto mask = u32{1} << to_underlying(subsystem);
+    return m_settled.load(std::memory_order_acquire) & mask;
+  }
+
+  [[nodiscard]] auto is_enabled(const library_subsystem subsystem) const noexcept -> bool
+  {
+    switch (subsystem) {
+      case library_subsystem::core:
+        return m_cfg.initCore;
+
+#ifndef CENTURION_NO_SDL_IMAGE
+      case library_subsystem::image:
+        return m_cfg.initImage;
+#endif  // CENTURION_NO_SDL_IMAGE
+
+#ifndef CENTURION_NO_SDL_TTF
+      case library_subsystem::ttf:
+        return m_cfg.initTTF;
+#endif  // CENTURION_NO_SDL_TTF
+
+#ifndef CENTURION_NO_SDL_MIXER
+      case library_subsystem::mixer:
+        return m_cfg.initMixer;
 #endif  // CENTURION_NO_SDL_MIXER
+
+      default:
+        return m_cfg.initCore && (core_flags() & detail::subsystem_flag(subsystem));
+    }
+  }
+
+  [[nodiscard]] auto core_flags() const noexcept -> u32
+  {
+#if CENTURION_HAS_FEATURE_HEADLESS
+    return m_cfg.coreFlags & ~headless_excluded_flags;
+#else
+    return m_cfg.coreFlags;
+#endif  // CENTURION_HAS_FEATURE_HEADLESS
+  }
+
+  [[nodiscard]] auto is_deferred(const library_subsystem subsystem) const noexcept -> bool
+  {
+    return m_cfg.lazy && subsystem != library_subsystem::core;
+  }
+
+  static auto run_async(void* data) -> int
+  {
+    auto* self = static_cast<library*>(data);
+
+    // The input subsystems are left to the main thread
+    for (const auto subsystem : {library_subsystem::audio,
+                                 library_subsystem::image,
+                                 library_subsystem::ttf,
+                                 library_subsystem::mixer}) {
+      try {
+        self->init_subsystem(subsystem, true);
+      }
+      catch (...) {
+        // The subsystem is initialized again, and the error reported, on first use
+      }
+    }
+
+    return 0;
   }
 };
 
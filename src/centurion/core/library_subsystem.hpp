@@ -0,0 +1,156 @@
+#ifndef CENTURION_LIBRARY_SUBSYSTEM_HEADER
+#define CENTURION_LIBRARY_SUBSYSTEM_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "exception.hpp"
+#include "integers.hpp"
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \enum library_subsystem
+ *
+ * \brief Represents the subsystems that are initialized by the `library` class.
+ *
+ * \details The enumerators are listed in the order that the subsystems are initialized in,
+ * when they are initialized eagerly.
+ *
+ * \see `library`
+ * \see `config::lazy`
+ *
+ * \since 6.4.0
+ */
+enum class library_subsystem
+{
+  core,        ///< The SDL2 core, along with the subsystems that aren't deferred.
+  audio,       ///< The SDL2 audio subsystem.
+  joystick,    ///< The SDL2 joystick subsystem.
+  haptic,      ///< The SDL2 haptic subsystem.
+  controller,  ///< The SDL2 game controller subsystem.
+  sensor,      ///< The SDL2 sensor subsystem.
+  image,       ///< The SDL2_image library.
+  ttf,         ///< The SDL2_ttf library.
+  mixer        ///< The SDL2_mixer library, including the audio device.
+};
+
+/// The amount of `library_subsystem` enumerators.
+inline constexpr usize library_subsystem_count = 9;
+
+namespace detail {
+
+/// Returns the `SDL_Init()` flag of a subsystem, zero for the core and SDL extensions.
+[[nodiscard]] constexpr auto subsystem_flag(const library_subsystem subsystem) noexcept
+    -> u32
+{
+  switch (subsystem) {
+    case library_subsystem::audio:
+      return SDL_INIT_AUDIO;
+
+    case library_subsystem::joystick:
+      return SDL_INIT_JOYSTICK;
+
+    case library_subsystem::haptic:
+      return SDL_INIT_HAPTIC;
+
+    case library_subsystem::controller:
+      return SDL_INIT_GAMECONTROLLER;
+
+    case library_subsystem::sensor:
+      return SDL_INIT_SENSOR;
+
+    default:
+      return 0;
+  }
+}
+
+}  // namespace detail
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied library subsystem.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(library_subsystem::mixer) == "mixer"`.
+ *
+ * \param subsystem the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const library_subsystem subsystem) -> std::string_view
+{
+  switch (subsystem) {
+    case library_subsystem::core:
+      return "core";
+
+    case library_subsystem::audio:
+      return "audio";
+
+    case library_subsystem::joystick:
+      return "joystick";
+
+    case library_subsystem::haptic:
+      return "haptic";
+
+    case library_subsystem::controller:
+      return "controller";
+
+    case library_subsystem::sensor:
+      return "sensor";
+
+    case library_subsystem::image:
+      return "image";
+
+    case library_subsystem::ttf:
+      return "ttf";
+
+    case library_subsystem::mixer:
+      return "mixer";
+
+    default:
+      throw cen_error{"Did not recognize library subsystem!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a library subsystem enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param subsystem the enumerator that will be printed.
+ *
+ * \see `to_string(library_subsystem)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const library_subsystem subsystem)
+    -> std::ostream&
+{
+  return stream << to_string(subsystem);
+}
+
+/// \} End of streaming
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_LIBRARY_SUBSYSTEM_HEADER
@@ -15,7 +15,7 @@
 
 #if CENTURION_HAS_FEATURE_FORMAT
 
-#include <format>  // format_to_n
+#include <format>  // format_string, format_to_n
 
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
@@ -356,6 +356,25 @@ inline void set_priority(const log_category category, const log_priority priorit
   return static_cast<log_priority>(SDL_LogGetPriority(to_underlying(category)));
 }
 
+/**
+ * \brief Indicates whether messages with a priority would be output for a category.
+ *
+ * \details This can be used to avoid computing expensive log arguments for messages that
+ * would be discarded anyway.
+ *
+ * \param category the category of the message.
+ * \param priority the priority of the message.
+ *
+ * \return `true` if the message would be output; `false` otherwise.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto enabled(const log_category category,
+                                  const log_priority priority) noexcept -> bool
+{
+  return to_underlying(priority) >= to_underlying(get_priority(category));
+}
+
 /**
  * \brief Returns the maximum size, i.e the maximum amount of characters that a string can
  * contain and successfully be logged without being truncated.
@@ -373,6 +392,76 @@ inline void set_priority(const log_category category, const log_priority priorit
   return SDL_MAX_LOG_MESSAGE;
 }
 
+#if CENTURION_HAS_FEATURE_FORMAT
+
+/**
+ * \brief Logs a message formatted with `std::format`, with the specified priority and
+ * category.
+ *
+ * \details Unlike `msg()`, the format string is validated at compile time, and the
+ * message is only formatted if its priority is enabled for the category.
+ * \code{cpp}
+ *   cen::log::print(cen::log_priority::debug,
+ *                   cen::log_category::render,
+ *                   "Drew {} sprites in {:.2f} ms",
+ *                   count,
+ *                   ms);
+ * \endcode
+ *
+ * \details Messages longer than `max_message_size()` are truncated.
+ *
+ * \tparam Args the types of the format arguments.
+ *
+ * \param priority the priority that will be used.
+ * \param category the category that will be used.
+ * \param fmt the format string, which is checked at compile time.
+ * \param args the arguments that will be used by the format string.
+ *
+ * \see `enabled()`
+ * \see `async_log_sink::submit()`
+ *
+ * \since 6.4.0
+ */
+template <typename... Args>
+void print(const log_priority priority,
+           const log_category category,
+           const std::format_string<Args...> fmt,
+           Args&&... args)
+{
+  if (!log::enabled(category, priority)) {
+    return;
+  }
+
+  std::array<char, SDL_MAX_LOG_MESSAGE> buffer;  // NOLINT
+  const auto result =
+      std::format_to_n(buffer.data(), buffer.size() - 1, fmt, std::forward<Args>(args)...);
+  *result.out = '\0';
+
+  SDL_LogMessage(to_underlying(category),
+                 static_cast<SDL_LogPriority>(priority),
+                 "%s",
+                 buffer.data());
+}
+
+/**
+ * \brief Logs a message formatted with `std::format`, with `log_priority::info` and
+ * `log_category::app`.
+ *
+ * \tparam Args the types of the format arguments.
+ *
+ * \param fmt the format string, which is checked at compile time.
+ * \param args the arguments that will be used by the format string.
+ *
+ * \since 6.4.0
+ */
+template <typename... Args>
+void print(const std::format_string<Args...> fmt, Args&&... args)
+{
+  log::print(log_priority::info, log_category::app, fmt, std::forward<Args>(args)...);
+}
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+
 #if CENTURION_HAS_FEATURE_CONCEPTS
 
 /**
@@ -5,44 +5,186 @@
 
 #include "../compiler/features.hpp"
 #include "log.hpp"
+#include "log_category.hpp"
+#include "log_priority.hpp"
+#include "to_underlying.hpp"
 
 #ifndef CENTURION_NO_DEBUG_LOG_MACROS
-#ifdef NDEBUG
+#if defined(NDEBUG) && !defined(CENTURION_LOG_MIN_PRIORITY)
 
-#define CENTURION_LOG_INFO(fmt, ...)
-#define CENTURION_LOG_WARN(fmt, ...)
-#define CENTURION_LOG_VERBOSE(fmt, ...)
-#define CENTURION_LOG_DEBUG(fmt, ...)
-#define CENTURION_LOG_CRITICAL(fmt, ...)
-#define CENTURION_LOG_ERROR(fmt, ...)
+#define CENTURION_LOG(priority, category, ...)
+#define CENTURION_LOG_INFO(...)
+#define CENTURION_LOG_WARN(...)
+#define CENTURION_LOG_VERBOSE(...)
+#define CENTURION_LOG_DEBUG(...)
+#define CENTURION_LOG_CRITICAL(...)
+#define CENTURION_LOG_ERROR(...)
 
 #else
 
-#if CENTURION_HAS_FEATURE_CPP20
+/* The minimum priorities may be either `log_priority` or `SDL_LogPriority` values, which is
+   why they are only used in constant expressions, rather than by the preprocessor. They are
+   read where the macros are expanded, so that they may differ between source files. */
 
-// clang-format off
-#define CENTURION_LOG_INFO(fmt, ...) cen::log::info(fmt __VA_OPT__(,) __VA_ARGS__)
-#define CENTURION_LOG_WARN(fmt, ...) cen::log::warn(fmt __VA_OPT__(,) __VA_ARGS__)
-#define CENTURION_LOG_VERBOSE(fmt, ...) cen::log::verbose(fmt __VA_OPT__(,) __VA_ARGS__)
-#define CENTURION_LOG_DEBUG(fmt, ...) cen::log::debug(fmt __VA_OPT__(,) __VA_ARGS__)
-#define CENTURION_LOG_CRITICAL(fmt, ...) cen::log::critical(fmt __VA_OPT__(,) __VA_ARGS__)
-#define CENTURION_LOG_ERROR(fmt, ...) cen::log::error(fmt __VA_OPT__(,) __VA_ARGS__)
-// clang-format on
+#ifndef CENTURION_LOG_MIN_PRIORITY
+#define CENTURION_LOG_MIN_PRIORITY SDL_LOG_PRIORITY_VERBOSE
+#endif  // CENTURION_LOG_MIN_PRIORITY
 
-#else
+#ifndef CENTURION_LOG_MIN_PRIORITY_APP
+#define CENTURION_LOG_MIN_PRIORITY_APP CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_APP
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_ERROR
+#define CENTURION_LOG_MIN_PRIORITY_ERROR CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_ERROR
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_ASSERT
+#define CENTURION_LOG_MIN_PRIORITY_ASSERT CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_ASSERT
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_SYSTEM
+#define CENTURION_LOG_MIN_PRIORITY_SYSTEM CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_SYSTEM
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_AUDIO
+#define CENTURION_LOG_MIN_PRIORITY_AUDIO CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_AUDIO
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_VIDEO
+#define CENTURION_LOG_MIN_PRIORITY_VIDEO CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_VIDEO
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_RENDER
+#define CENTURION_LOG_MIN_PRIORITY_RENDER CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_RENDER
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_INPUT
+#define CENTURION_LOG_MIN_PRIORITY_INPUT CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_INPUT
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_TEST
+#define CENTURION_LOG_MIN_PRIORITY_TEST CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_TEST
+
+#ifndef CENTURION_LOG_MIN_PRIORITY_MISC
+#define CENTURION_LOG_MIN_PRIORITY_MISC CENTURION_LOG_MIN_PRIORITY
+#endif  // CENTURION_LOG_MIN_PRIORITY_MISC
+
+/// \cond FALSE
+namespace cen::log::detail {
+
+struct log_thresholds final
+{
+  int app;
+  int error;
+  int assert;
+  int system;
+  int audio;
+  int video;
+  int render;
+  int input;
+  int test;
+  int misc;
+};
+
+[[nodiscard]] constexpr auto is_compiled_in(const log_priority priority,
+                                            const log_category category,
+                                            const log_thresholds& thresholds) noexcept
+    -> bool
+{
+  auto threshold = thresholds.misc;
+  switch (category) {
+    case log_category::app:
+      threshold = thresholds.app;
+      break;
+
+    case log_category::error:
+      threshold = thresholds.error;
+      break;
+
+    case log_category::assert:
+      threshold = thresholds.assert;
+      break;
+
+    case log_category::system:
+      threshold = thresholds.system;
+      break;
+
+    case log_category::audio:
+      threshold = thresholds.audio;
+      break;
+
+    case log_category::video:
+      threshold = thresholds.video;
+      break;
+
+    case log_category::render:
+      threshold = thresholds.render;
+      break;
+
+    case log_category::input:
+      threshold = thresholds.input;
+      break;
+
+    case log_category::test:
+      threshold = thresholds.test;
+      break;
+
+    default:
+      break;
+  }
+
+  return to_underlying(priority) >= threshold;
+}
+
+}  // namespace cen::log::detail
+/// \endcond
 
 // clang-format off
-#define CENTURION_LOG_INFO(fmt, ...) cen::log::info(fmt, __VA_ARGS__)
-#define CENTURION_LOG_WARN(fmt, ...) cen::log::warn(fmt, __VA_ARGS__)
-#define CENTURION_LOG_VERBOSE(fmt, ...) cen::log::verbose(fmt, __VA_ARGS__)
-#define CENTURION_LOG_DEBUG(fmt, ...) cen::log::debug(fmt, __VA_ARGS__)
-#define CENTURION_LOG_CRITICAL(fmt, ...) cen::log::critical(fmt, __VA_ARGS__)
-#define CENTURION_LOG_ERROR(fmt, ...) cen::log::error(fmt, __VA_ARGS__)
+#define CENTURION_DETAIL_LOG_THRESHOLDS                                               \
+  cen::log::detail::log_thresholds                                                    \
+  {                                                                                   \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_APP),                                 \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_ERROR),                               \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_ASSERT),                              \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_SYSTEM),                              \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_AUDIO),                               \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_VIDEO),                               \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_RENDER),                              \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_INPUT),                               \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_TEST),                                \
+    static_cast<int>(CENTURION_LOG_MIN_PRIORITY_MISC)                                 \
+  }
 // clang-format on
 
-#endif  // CENTURION_HAS_FEATURE_CPP20
+// The arguments of messages below the minimum priority aren't evaluated
+#define CENTURION_LOG(priority, category, ...)                                        \
+  do {                                                                                \
+    if constexpr (cen::log::detail::is_compiled_in(priority,                          \
+                                                   category,                          \
+                                                   CENTURION_DETAIL_LOG_THRESHOLDS)) { \
+      cen::log::msg(priority, category, __VA_ARGS__);                                 \
+    }                                                                                 \
+  } while (false)
+
+// Uses the minimum priority of the app category, even if a category is supplied
+#define CENTURION_DETAIL_LOG_APP(level, ...)                                          \
+  do {                                                                                \
+    if constexpr (cen::log::detail::is_compiled_in(cen::log_priority::level,          \
+                                                   cen::log_category::app,            \
+                                                   CENTURION_DETAIL_LOG_THRESHOLDS)) { \
+      cen::log::level(__VA_ARGS__);                                                   \
+    }                                                                                 \
+  } while (false)
+
+#define CENTURION_LOG_INFO(...) CENTURION_DETAIL_LOG_APP(info, __VA_ARGS__)
+#define CENTURION_LOG_WARN(...) CENTURION_DETAIL_LOG_APP(warn, __VA_ARGS__)
+#define CENTURION_LOG_VERBOSE(...) CENTURION_DETAIL_LOG_APP(verbose, __VA_ARGS__)
+#define CENTURION_LOG_DEBUG(...) CENTURION_DETAIL_LOG_APP(debug, __VA_ARGS__)
+#define CENTURION_LOG_CRITICAL(...) CENTURION_DETAIL_LOG_APP(critical, __VA_ARGS__)
+#define CENTURION_LOG_ERROR(...) CENTURION_DETAIL_LOG_APP(error, __VA_ARGS__)
 
-#endif  // NDEBUG
+#endif  // defined(NDEBUG) && !defined(CENTURION_LOG_MIN_PRIORITY)
 #endif  // CENTURION_NO_DEBUG_LOG_MACROS
 
 #endif  // CENTURION_LOG_MACROS_HEADER
@@ -0,0 +1,319 @@
+#ifndef CENTURION_DETAIL_AXIS_KERNELS_HEADER
+#define CENTURION_DETAIL_AXIS_KERNELS_HEADER
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include <cmath>  // sqrt, fabs, copysign
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// The precomputed parameters of a dead zone, response curve and smoothing filter
+struct axis_params final
+{
+  float inner{};     // The dead zone, as a fraction of the full axis range
+  float invRange{};  // The reciprocal of the distance between the dead zone and saturation
+  float alpha{};     // The weight of new values in the exponential smoothing
+  int power{};       // The exponent of the response curve, 1 is linear
+};
+
+inline constexpr float axis_scale = 1.0f / 32'767.0f;
+inline constexpr float min_magnitude = 1e-12f;
+
+[[nodiscard]] inline auto normalize_axis(const i16 raw) noexcept -> float
+{
+  const auto value = static_cast<float>(raw) * axis_scale;
+  return value < -1.0f ? -1.0f : value;
+}
+
+// Maps a magnitude in [0, 1] through the dead zone and response curve
+[[nodiscard]] inline auto shape_magnitude(const float magnitude,
+                                          const axis_params& params) noexcept -> float
+{
+  auto t = (magnitude - params.inner) * params.invRange;
+  t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+
+  auto result = t;
+  for (auto i = 1; i < params.power; ++i) {
+    result *= t;
+  }
+
+  return result;
+}
+
+inline void filter_axial_scalar(const i16* raw,
+                                float* values,
+                                const int count,
+                                const axis_params& params) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    const auto value = normalize_axis(raw[index]);
+    const auto shaped = std::copysign(shape_magnitude(std::fabs(value), params), value);
+
+    values[index] += params.alpha * (shaped - values[index]);
+  }
+}
+
+inline void filter_radial_scalar(const i16* rawX,
+                                 const i16* rawY,
+                                 float* valuesX,
+                                 float* valuesY,
+                                 const int count,
+                                 const axis_params& params) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    const auto x = normalize_axis(rawX[index]);
+    const auto y = normalize_axis(rawY[index]);
+
+    const auto magnitude = std::sqrt(x * x + y * y);
+    const auto scale = shape_magnitude(magnitude, params) /
+                       (magnitude > min_magnitude ? magnitude : min_magnitude);
+
+    valuesX[index] += params.alpha * (x * scale - valuesX[index]);
+    valuesY[index] += params.alpha * (y * scale - valuesY[index]);
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+[[nodiscard]] inline auto load_axes_sse2(const i16* raw) noexcept -> __m128
+{
+  // Sign-extend four 16-bit values to 32 bits, by shifting them down from the upper half
+  const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(raw));
+  const auto wide = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+
+  const auto value = _mm_mul_ps(_mm_cvtepi32_ps(wide), _mm_set1_ps(axis_scale));
+  return _mm_max_ps(value, _mm_set1_ps(-1.0f));
+}
+
+[[nodiscard]] inline auto shape_magnitude_sse2(const __m128 magnitude,
+                                               const axis_params& params) noexcept -> __m128
+{
+  auto t = _mm_mul_ps(_mm_sub_ps(magnitude, _mm_set1_ps(params.inner)),
+                      _mm_set1_ps(params.invRange));
+  t = _mm_min_ps(_mm_max_ps(t, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+
+  auto result = t;
+  for (auto i = 1; i < params.power; ++i) {
+    result = _mm_mul_ps(result, t);
+  }
+
+  return result;
+}
+
+inline void filter_axial_sse2(const i16* raw,
+                              float* values,
+                              const int count,
+                              const axis_params& params) noexcept
+{
+  const auto signMask = _mm_set1_ps(-0.0f);
+  const auto alpha = _mm_set1_ps(params.alpha);
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto value = load_axes_sse2(raw + index);
+    const auto sign = _mm_and_ps(value, signMask);
+    const auto shaped =
+        _mm_or_ps(shape_magnitude_sse2(_mm_andnot_ps(signMask, value), params), sign);
+
+    const auto previous = _mm_loadu_ps(values + index);
+    const auto delta = _mm_mul_ps(alpha, _mm_sub_ps(shaped, previous));
+    _mm_storeu_ps(values + index, _mm_add_ps(previous, delta));
+  }
+
+  filter_axial_scalar(raw + index, values + index, count - index, params);
+}
+
+inline void filter_radial_sse2(const i16* rawX,
+                               const i16* rawY,
+                               float* valuesX,
+                               float* valuesY,
+                               const int count,
+                               const axis_params& params) noexcept
+{
+  const auto alpha = _mm_set1_ps(params.alpha);
+  const auto minMagnitude = _mm_set1_ps(min_magnitude);
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto x = load_axes_sse2(rawX + index);
+    const auto y = load_axes_sse2(rawY + index);
+
+    const auto magnitude = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+    const auto scale = _mm_div_ps(shape_magnitude_sse2(magnitude, params),
+                                  _mm_max_ps(magnitude, minMagnitude));
+
+    const auto previousX = _mm_loadu_ps(valuesX + index);
+    const auto previousY = _mm_loadu_ps(valuesY + index);
+
+    const auto deltaX = _mm_mul_ps(alpha, _mm_sub_ps(_mm_mul_ps(x, scale), previousX));
+    const auto deltaY = _mm_mul_ps(alpha, _mm_sub_ps(_mm_mul_ps(y, scale), previousY));
+
+    _mm_storeu_ps(valuesX + index, _mm_add_ps(previousX, deltaX));
+    _mm_storeu_ps(valuesY + index, _mm_add_ps(previousY, deltaY));
+  }
+
+  filter_radial_scalar(rawX + index,
+                       rawY + index,
+                       valuesX + index,
+                       valuesY + index,
+                       count - index,
+                       params);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+[[nodiscard]] inline auto load_axes_neon(const i16* raw) noexcept -> float32x4_t
+{
+  const auto wide = vmovl_s16(vld1_s16(raw));
+  const auto value = vmulq_n_f32(vcvtq_f32_s32(wide), axis_scale);
+  return vmaxq_f32(value, vdupq_n_f32(-1.0f));
+}
+
+[[nodiscard]] inline auto shape_magnitude_neon(const float32x4_t magnitude,
+                                               const axis_params& params) noexcept
+    -> float32x4_t
+{
+  auto t = vmulq_n_f32(vsubq_f32(magnitude, vdupq_n_f32(params.inner)), params.invRange);
+  t = vminq_f32(vmaxq_f32(t, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+
+  auto result = t;
+  for (auto i = 1; i < params.power; ++i) {
+    result = vmulq_f32(result, t);
+  }
+
+  return result;
+}
+
+inline void filter_axial_neon(const i16* raw,
+                              float* values,
+                              const int count,
+                              const axis_params& params) noexcept
+{
+  const auto signMask = vdupq_n_u32(0x8000'0000u);
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto value = load_axes_neon(raw + index);
+    const auto sign = vandq_u32(vreinterpretq_u32_f32(value), signMask);
+    const auto magnitude = shape_magnitude_neon(vabsq_f32(value), params);
+    const auto shaped =
+        vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(magnitude), sign));
+
+    const auto previous = vld1q_f32(values + index);
+    const auto delta = vsubq_f32(shaped, previous);
+    vst1q_f32(values + index, vmlaq_n_f32(previous, delta, params.alpha));
+  }
+
+  filter_axial_scalar(raw + index, values + index, count - index, params);
+}
+
+inline void filter_radial_neon(const i16* rawX,
+                               const i16* rawY,
+                               float* valuesX,
+                               float* valuesY,
+                               const int count,
+                               const axis_params& params) noexcept
+{
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto x = load_axes_neon(rawX + index);
+    const auto y = load_axes_neon(rawY + index);
+
+    // Compute the reciprocal magnitude with an estimate refined by two Newton steps
+    const auto squared = vmaxq_f32(vmlaq_f32(vmulq_f32(x, x), y, y),
+                                   vdupq_n_f32(min_magnitude * min_magnitude));
+    auto inverse = vrsqrteq_f32(squared);
+    inverse = vmulq_f32(inverse, vrsqrtsq_f32(vmulq_f32(squared, inverse), inverse));
+    inverse = vmulq_f32(inverse, vrsqrtsq_f32(vmulq_f32(squared, inverse), inverse));
+
+    const auto magnitude = vmulq_f32(squared, inverse);
+    const auto scale = vmulq_f32(shape_magnitude_neon(magnitude, params), inverse);
+
+    const auto previousX = vld1q_f32(valuesX + index);
+    const auto previousY = vld1q_f32(valuesY + index);
+
+    const auto deltaX = vsubq_f32(vmulq_f32(x, scale), previousX);
+    const auto deltaY = vsubq_f32(vmulq_f32(y, scale), previousY);
+
+    vst1q_f32(valuesX + index, vmlaq_n_f32(previousX, deltaX, params.alpha));
+    vst1q_f32(valuesY + index, vmlaq_n_f32(previousY, deltaY, params.alpha));
+  }
+
+  filter_radial_scalar(rawX + index,
+                       rawY + index,
+                       valuesX + index,
+                       valuesY + index,
+                       count - index,
+                       params);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+// Applies an axial dead zone, response curve and smoothing to a set of axis values
+inline void filter_axial(const i16* raw,
+                         float* values,
+                         const int count,
+                         const axis_params& params) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    filter_axial_sse2(raw, values, count, params);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    filter_axial_neon(raw, values, count, params);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  filter_axial_scalar(raw, values, count, params);
+}
+
+// Applies a radial dead zone, response curve and smoothing to a set of stick positions
+inline void filter_radial(const i16* rawX,
+                          const i16* rawY,
+                          float* valuesX,
+                          float* valuesY,
+                          const int count,
+                          const axis_params& params) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    filter_radial_sse2(rawX, rawY, valuesX, valuesY, count, params);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    filter_radial_neon(rawX, rawY, valuesX, valuesY, count, params);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  filter_radial_scalar(rawX, rawY, valuesX, valuesY, count, params);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_AXIS_KERNELS_HEADER
@@ -0,0 +1,196 @@
+#ifndef CENTURION_DETAIL_BYTE_SWAP_KERNELS_HEADER
+#define CENTURION_DETAIL_BYTE_SWAP_KERNELS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+inline void swap_u16_scalar(u16* values, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    values[index] = SDL_Swap16(values[index]);
+  }
+}
+
+inline void swap_u32_scalar(u32* values, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    values[index] = SDL_Swap32(values[index]);
+  }
+}
+
+inline void swap_u64_scalar(u64* values, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    values[index] = SDL_Swap64(values[index]);
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+// Swaps the two bytes of every 16-bit lane, SSE2 lacks a byte shuffle
+[[nodiscard]] inline auto swap_lanes_sse2(const __m128i values) noexcept -> __m128i
+{
+  return _mm_or_si128(_mm_slli_epi16(values, 8), _mm_srli_epi16(values, 8));
+}
+
+inline void swap_u16_sse2(u16* values, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    auto* block = reinterpret_cast<__m128i*>(values + index);
+    _mm_storeu_si128(block, swap_lanes_sse2(_mm_loadu_si128(block)));
+  }
+
+  swap_u16_scalar(values + index, count - index);
+}
+
+inline void swap_u32_sse2(u32* values, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto* block = reinterpret_cast<__m128i*>(values + index);
+    const auto swapped = swap_lanes_sse2(_mm_loadu_si128(block));
+
+    // Swap the two 16-bit halves of every 32-bit value
+    const auto low = _mm_shufflelo_epi16(swapped, _MM_SHUFFLE(2, 3, 0, 1));
+    _mm_storeu_si128(block, _mm_shufflehi_epi16(low, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+
+  swap_u32_scalar(values + index, count - index);
+}
+
+inline void swap_u64_sse2(u64* values, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 2 <= count; index += 2) {
+    auto* block = reinterpret_cast<__m128i*>(values + index);
+    const auto swapped = swap_lanes_sse2(_mm_loadu_si128(block));
+
+    // Reverse the four 16-bit lanes of every 64-bit value
+    const auto low = _mm_shufflelo_epi16(swapped, _MM_SHUFFLE(0, 1, 2, 3));
+    _mm_storeu_si128(block, _mm_shufflehi_epi16(low, _MM_SHUFFLE(0, 1, 2, 3)));
+  }
+
+  swap_u64_scalar(values + index, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline void swap_u16_neon(u16* values, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto bytes = vreinterpretq_u8_u16(vld1q_u16(values + index));
+    vst1q_u16(values + index, vreinterpretq_u16_u8(vrev16q_u8(bytes)));
+  }
+
+  swap_u16_scalar(values + index, count - index);
+}
+
+inline void swap_u32_neon(u32* values, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto bytes = vreinterpretq_u8_u32(vld1q_u32(values + index));
+    vst1q_u32(values + index, vreinterpretq_u32_u8(vrev32q_u8(bytes)));
+  }
+
+  swap_u32_scalar(values + index, count - index);
+}
+
+inline void swap_u64_neon(u64* values, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 2 <= count; index += 2) {
+    const auto bytes = vreinterpretq_u8_u64(vld1q_u64(values + index));
+    vst1q_u64(values + index, vreinterpretq_u64_u8(vrev64q_u8(bytes)));
+  }
+
+  swap_u64_scalar(values + index, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+// Swaps the byte order of 16-bit values in place
+inline void swap_u16(u16* values, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    swap_u16_sse2(values, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    swap_u16_neon(values, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  swap_u16_scalar(values, count);
+}
+
+// Swaps the byte order of 32-bit values in place
+inline void swap_u32(u32* values, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    swap_u32_sse2(values, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    swap_u32_neon(values, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  swap_u32_scalar(values, count);
+}
+
+// Swaps the byte order of 64-bit values in place
+inline void swap_u64(u64* values, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    swap_u64_sse2(values, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    swap_u64_neon(values, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  swap_u64_scalar(values, count);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_BYTE_SWAP_KERNELS_HEADER
@@ -0,0 +1,475 @@
+#ifndef CENTURION_DETAIL_COLOR_KERNELS_HEADER
+#define CENTURION_DETAIL_COLOR_KERNELS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+static_assert(sizeof(SDL_Color) == 4);
+
+// Rounds a channel value in the range [0, 255], matching the conversions of the SIMD kernels
+[[nodiscard]] inline auto to_channel(const float value) noexcept -> u8
+{
+  const auto clamped = value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value);
+  return static_cast<u8>(static_cast<int>(clamped + 0.5f));
+}
+
+[[nodiscard]] inline auto lerp_channel(const u8 from, const u8 to, const float bias) noexcept
+    -> u8
+{
+  const auto a = static_cast<float>(from);
+  const auto b = static_cast<float>(to);
+  return to_channel(a + (b - a) * bias);
+}
+
+[[nodiscard]] inline auto lerp_color(const SDL_Color& from,
+                                     const SDL_Color& to,
+                                     const float bias) noexcept -> SDL_Color
+{
+  return {lerp_channel(from.r, to.r, bias),
+          lerp_channel(from.g, to.g, bias),
+          lerp_channel(from.b, to.b, bias),
+          lerp_channel(from.a, to.a, bias)};
+}
+
+[[nodiscard]] inline auto clamp_float(const float value,
+                                      const float min,
+                                      const float max) noexcept -> float
+{
+  return value < min ? min : (value > max ? max : value);
+}
+
+// Blends pairs of colors with a shared bias
+inline void blend_colors_scalar(const SDL_Color* from,
+                                const SDL_Color* to,
+                                const float bias,
+                                SDL_Color* out,
+                                const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    out[index] = lerp_color(from[index], to[index], bias);
+  }
+}
+
+// Blends two colors with a bias for each output color, i.e. samples a two-color gradient
+inline void blend_ramp_scalar(const SDL_Color from,
+                              const SDL_Color to,
+                              const float* biases,
+                              SDL_Color* out,
+                              const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    out[index] = lerp_color(from, to, biases[index]);
+  }
+}
+
+// Converts HSV values, using the same ranges as color::from_hsv(), to opaque RGB colors
+inline void hsv_to_rgb_scalar(const float* hue,
+                              const float* saturation,
+                              const float* value,
+                              SDL_Color* out,
+                              const usize count) noexcept
+{
+  // Uses f(n) = v - v * s * max(0, min(k, 4 - k, 1)), where k = (n + h) mod 6
+  const auto channel = [](const float n, const float h, const float s, const float v) {
+    auto k = n + h;
+    k = (k >= 6.0f) ? k - 6.0f : k;
+
+    auto t = (k < 4.0f - k) ? k : 4.0f - k;
+    t = (t < 1.0f) ? t : 1.0f;
+    t = (t > 0.0f) ? t : 0.0f;
+
+    return to_channel((v - v * s * t) * 255.0f);
+  };
+
+  for (usize index = 0; index < count; ++index) {
+    const auto h = clamp_float(hue[index], 0.0f, 360.0f) * (1.0f / 60.0f);
+    const auto s = clamp_float(saturation[index], 0.0f, 100.0f) * 0.01f;
+    const auto v = clamp_float(value[index], 0.0f, 100.0f) * 0.01f;
+    out[index] = {channel(5, h, s, v), channel(3, h, s, v), channel(1, h, s, v), 255};
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+// Widens four colors to four vectors of floats, one for each color
+struct colors_sse2 final
+{
+  __m128 c0;
+  __m128 c1;
+  __m128 c2;
+  __m128 c3;
+};
+
+[[nodiscard]] inline auto load_colors_sse2(const SDL_Color* colors) noexcept -> colors_sse2
+{
+  const auto zero = _mm_setzero_si128();
+  const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors));
+
+  const auto lo = _mm_unpacklo_epi8(bytes, zero);
+  const auto hi = _mm_unpackhi_epi8(bytes, zero);
+
+  return {_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)),
+          _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)),
+          _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)),
+          _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero))};
+}
+
+[[nodiscard]] inline auto to_channels_sse2(const __m128 value) noexcept -> __m128i
+{
+  const auto clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+  return _mm_cvttps_epi32(_mm_add_ps(clamped, _mm_set1_ps(0.5f)));
+}
+
+inline void store_colors_sse2(const colors_sse2& colors, SDL_Color* out) noexcept
+{
+  const auto lo = _mm_packs_epi32(to_channels_sse2(colors.c0), to_channels_sse2(colors.c1));
+  const auto hi = _mm_packs_epi32(to_channels_sse2(colors.c2), to_channels_sse2(colors.c3));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(lo, hi));
+}
+
+[[nodiscard]] inline auto lerp_sse2(const __m128 from,
+                                    const __m128 to,
+                                    const __m128 bias) noexcept -> __m128
+{
+  return _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), bias));
+}
+
+inline void blend_colors_sse2(const SDL_Color* from,
+                              const SDL_Color* to,
+                              const float bias,
+                              SDL_Color* out,
+                              const usize count) noexcept
+{
+  const auto t = _mm_set1_ps(bias);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto a = load_colors_sse2(from + index);
+    const auto b = load_colors_sse2(to + index);
+
+    store_colors_sse2({lerp_sse2(a.c0, b.c0, t),
+                       lerp_sse2(a.c1, b.c1, t),
+                       lerp_sse2(a.c2, b.c2, t),
+                       lerp_sse2(a.c3, b.c3, t)},
+                      out + index);
+  }
+
+  blend_colors_scalar(from + index, to + index, bias, out + index, count - index);
+}
+
+inline void blend_ramp_sse2(const SDL_Color from,
+                            const SDL_Color to,
+                            const float* biases,
+                            SDL_Color* out,
+                            const usize count) noexcept
+{
+  const auto a = _mm_setr_ps(from.r, from.g, from.b, from.a);
+  const auto delta = _mm_sub_ps(_mm_setr_ps(to.r, to.g, to.b, to.a), a);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto t = _mm_loadu_ps(biases + index);
+
+    // Broadcast the bias of each output color to all of its channels
+    const auto t0 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0));
+    const auto t1 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1));
+    const auto t2 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2));
+    const auto t3 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 3, 3));
+
+    store_colors_sse2({_mm_add_ps(a, _mm_mul_ps(delta, t0)),
+                       _mm_add_ps(a, _mm_mul_ps(delta, t1)),
+                       _mm_add_ps(a, _mm_mul_ps(delta, t2)),
+                       _mm_add_ps(a, _mm_mul_ps(delta, t3))},
+                      out + index);
+  }
+
+  blend_ramp_scalar(from, to, biases + index, out + index, count - index);
+}
+
+// Clamps values to [0, max], and multiplies them by a factor
+[[nodiscard]] inline auto scale_sse2(const __m128 value,
+                                     const float max,
+                                     const float factor) noexcept -> __m128
+{
+  const auto clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(max));
+  return _mm_mul_ps(clamped, _mm_set1_ps(factor));
+}
+
+[[nodiscard]] inline auto hsv_channel_sse2(const float n,
+                                           const __m128 h,
+                                           const __m128 s,
+                                           const __m128 v) noexcept -> __m128
+{
+  const auto six = _mm_set1_ps(6.0f);
+  const auto four = _mm_set1_ps(4.0f);
+  const auto one = _mm_set1_ps(1.0f);
+
+  auto k = _mm_add_ps(_mm_set1_ps(n), h);
+  k = _mm_sub_ps(k, _mm_and_ps(_mm_cmpge_ps(k, six), six));
+
+  auto t = _mm_min_ps(k, _mm_sub_ps(four, k));
+  t = _mm_max_ps(_mm_min_ps(t, one), _mm_setzero_ps());
+
+  const auto result = _mm_sub_ps(v, _mm_mul_ps(_mm_mul_ps(v, s), t));
+  return _mm_mul_ps(result, _mm_set1_ps(255.0f));
+}
+
+inline void hsv_to_rgb_sse2(const float* hue,
+                            const float* saturation,
+                            const float* value,
+                            SDL_Color* out,
+                            const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto h = scale_sse2(_mm_loadu_ps(hue + index), 360.0f, 1.0f / 60.0f);
+    const auto s = scale_sse2(_mm_loadu_ps(saturation + index), 100.0f, 0.01f);
+    const auto v = scale_sse2(_mm_loadu_ps(value + index), 100.0f, 0.01f);
+
+    // Compute the channels of four colors, and transpose them into four colors
+    auto r = hsv_channel_sse2(5, h, s, v);
+    auto g = hsv_channel_sse2(3, h, s, v);
+    auto b = hsv_channel_sse2(1, h, s, v);
+    auto a = _mm_set1_ps(255.0f);
+
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+    store_colors_sse2({r, g, b, a}, out + index);
+  }
+
+  hsv_to_rgb_scalar(hue + index,
+                    saturation + index,
+                    value + index,
+                    out + index,
+                    count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+// Widens four colors to four vectors of floats, one for each color
+[[nodiscard]] inline auto load_colors_neon(const SDL_Color* colors) noexcept -> float32x4x4_t
+{
+  const auto bytes = vld1q_u8(reinterpret_cast<const u8*>(colors));
+
+  const auto lo = vmovl_u8(vget_low_u8(bytes));
+  const auto hi = vmovl_u8(vget_high_u8(bytes));
+
+  return {{vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))),
+           vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))),
+           vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))),
+           vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi)))}};
+}
+
+[[nodiscard]] inline auto to_channels_neon(const float32x4_t value) noexcept -> uint16x4_t
+{
+  const auto clamped = vminq_f32(vmaxq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f));
+  return vmovn_u32(vcvtq_u32_f32(vaddq_f32(clamped, vdupq_n_f32(0.5f))));
+}
+
+inline void store_colors_neon(const float32x4x4_t& colors, SDL_Color* out) noexcept
+{
+  const auto lo = vcombine_u16(to_channels_neon(colors.val[0]),
+                               to_channels_neon(colors.val[1]));
+  const auto hi = vcombine_u16(to_channels_neon(colors.val[2]),
+                               to_channels_neon(colors.val[3]));
+  vst1q_u8(reinterpret_cast<u8*>(out), vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+}
+
+inline void blend_colors_neon(const SDL_Color* from,
+                              const SDL_Color* to,
+                              const float bias,
+                              SDL_Color* out,
+                              const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto a = load_colors_neon(from + index);
+    const auto b = load_colors_neon(to + index);
+
+    float32x4x4_t result;
+    for (auto lane = 0; lane < 4; ++lane) {
+      result.val[lane] = vmlaq_n_f32(a.val[lane], vsubq_f32(b.val[lane], a.val[lane]), bias);
+    }
+
+    store_colors_neon(result, out + index);
+  }
+
+  blend_colors_scalar(from + index, to + index, bias, out + index, count - index);
+}
+
+inline void blend_ramp_neon(const SDL_Color from,
+                            const SDL_Color to,
+                            const float* biases,
+                            SDL_Color* out,
+                            const usize count) noexcept
+{
+  const float fromValues[4]{from.r, from.g, from.b, from.a};
+  const float toValues[4]{to.r, to.g, to.b, to.a};
+
+  const auto a = vld1q_f32(fromValues);
+  const auto delta = vsubq_f32(vld1q_f32(toValues), a);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const float32x4x4_t result{{vmlaq_n_f32(a, delta, biases[index]),
+                                vmlaq_n_f32(a, delta, biases[index + 1]),
+                                vmlaq_n_f32(a, delta, biases[index + 2]),
+                                vmlaq_n_f32(a, delta, biases[index + 3])}};
+    store_colors_neon(result, out + index);
+  }
+
+  blend_ramp_scalar(from, to, biases + index, out + index, count - index);
+}
+
+// Clamps values to [0, max], and multiplies them by a factor
+[[nodiscard]] inline auto scale_neon(const float32x4_t value,
+                                     const float max,
+                                     const float factor) noexcept -> float32x4_t
+{
+  const auto clamped = vminq_f32(vmaxq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(max));
+  return vmulq_n_f32(clamped, factor);
+}
+
+[[nodiscard]] inline auto hsv_channel_neon(const float n,
+                                           const float32x4_t h,
+                                           const float32x4_t s,
+                                           const float32x4_t v) noexcept -> float32x4_t
+{
+  const auto six = vdupq_n_f32(6.0f);
+
+  auto k = vaddq_f32(vdupq_n_f32(n), h);
+  k = vbslq_f32(vcgeq_f32(k, six), vsubq_f32(k, six), k);
+
+  auto t = vminq_f32(k, vsubq_f32(vdupq_n_f32(4.0f), k));
+  t = vmaxq_f32(vminq_f32(t, vdupq_n_f32(1.0f)), vdupq_n_f32(0.0f));
+
+  const auto result = vmlsq_f32(v, vmulq_f32(v, s), t);
+  return vmulq_n_f32(result, 255.0f);
+}
+
+inline void hsv_to_rgb_neon(const float* hue,
+                            const float* saturation,
+                            const float* value,
+                            SDL_Color* out,
+                            const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto h = scale_neon(vld1q_f32(hue + index), 360.0f, 1.0f / 60.0f);
+    const auto s = scale_neon(vld1q_f32(saturation + index), 100.0f, 0.01f);
+    const auto v = scale_neon(vld1q_f32(value + index), 100.0f, 0.01f);
+
+    // Interleaving the channel vectors produces four colors
+    const uint16x4x4_t channels{{to_channels_neon(hsv_channel_neon(5, h, s, v)),
+                                 to_channels_neon(hsv_channel_neon(3, h, s, v)),
+                                 to_channels_neon(hsv_channel_neon(1, h, s, v)),
+                                 vdup_n_u16(255)}};
+
+    u16 wide[16];
+    vst4_u16(wide, channels);
+
+    const auto lo = vld1q_u16(wide);
+    const auto hi = vld1q_u16(wide + 8);
+    vst1q_u8(reinterpret_cast<u8*>(out + index), vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+  }
+
+  hsv_to_rgb_scalar(hue + index,
+                    saturation + index,
+                    value + index,
+                    out + index,
+                    count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+inline void blend_colors(const SDL_Color* from,
+                         const SDL_Color* to,
+                         const float bias,
+                         SDL_Color* out,
+                         const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    blend_colors_sse2(from, to, bias, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    blend_colors_neon(from, to, bias, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  blend_colors_scalar(from, to, bias, out, count);
+}
+
+inline void blend_ramp(const SDL_Color from,
+                       const SDL_Color to,
+                       const float* biases,
+                       SDL_Color* out,
+                       const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    blend_ramp_sse2(from, to, biases, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    blend_ramp_neon(from, to, biases, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  blend_ramp_scalar(from, to, biases, out, count);
+}
+
+inline void hsv_to_rgb(const float* hue,
+                       const float* saturation,
+                       const float* value,
+                       SDL_Color* out,
+                       const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    hsv_to_rgb_sse2(hue, saturation, value, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    hsv_to_rgb_neon(hue, saturation, value, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  hsv_to_rgb_scalar(hue, saturation, value, out, count);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_COLOR_KERNELS_HEADER
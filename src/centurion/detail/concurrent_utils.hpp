@@ -0,0 +1,47 @@
+#ifndef CENTURION_DETAIL_CONCURRENT_UTILS_HEADER
+#define CENTURION_DETAIL_CONCURRENT_UTILS_HEADER
+
+#include <cstddef>  // byte
+#include <new>      // launder
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/* The padding used to keep data written by different threads on separate cache lines.
+   Layouts need a constant, so this is an upper bound of what cpu::cache_line_size()
+   reports on common hardware, where Apple CPUs use 128 byte lines. */
+#if defined(__APPLE__) && defined(__aarch64__)
+inline constexpr usize cache_line = 128;
+#else
+inline constexpr usize cache_line = 64;
+#endif  // defined(__APPLE__) && defined(__aarch64__)
+
+// Rounds a ring buffer capacity up to a power of two, so that indices can be masked
+[[nodiscard]] constexpr auto ring_capacity(const usize requested) noexcept -> usize
+{
+  usize capacity = 2;
+  while (capacity < requested) {
+    capacity *= 2;
+  }
+
+  return capacity;
+}
+
+// Uninitialized storage for a single element of a ring buffer
+template <typename T>
+struct ring_storage final
+{
+  alignas(T) std::byte data[sizeof(T)];
+
+  [[nodiscard]] auto get() noexcept -> T*
+  {
+    return std::launder(reinterpret_cast<T*>(data));
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_CONCURRENT_UTILS_HEADER
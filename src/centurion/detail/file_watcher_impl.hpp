@@ -0,0 +1,385 @@
+#ifndef CENTURION_DETAIL_FILE_WATCHER_IMPL_HEADER
+#define CENTURION_DETAIL_FILE_WATCHER_IMPL_HEADER
+
+#include <memory>         // unique_ptr, make_unique
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#if defined(_WIN32)
+
+#include "windows_include.hpp"
+
+#elif defined(__linux__)
+
+#include <dirent.h>       // opendir, readdir, closedir
+#include <fcntl.h>        // O_NONBLOCK, O_CLOEXEC
+#include <poll.h>         // poll
+#include <sys/inotify.h>  // inotify_init1, inotify_add_watch
+#include <unistd.h>       // read, write, pipe2, close
+
+#include <cerrno>  // errno, EINTR
+
+#endif  // defined(_WIN32)
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../filesystem/file_watcher.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+#if defined(_WIN32)
+
+struct directory_monitor final
+{
+  inline constexpr static DWORD buffer_size = 64 * 1'024;
+  inline constexpr static DWORD notify_filter =
+      FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+      FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+
+  std::string root;
+  HANDLE directory{INVALID_HANDLE_VALUE};
+  HANDLE stop{};
+  OVERLAPPED overlapped{};
+  std::unique_ptr<DWORD[]> buffer;  ///< Aligned storage for FILE_NOTIFY_INFORMATION.
+
+  auto issue_read() noexcept -> bool
+  {
+    ResetEvent(overlapped.hEvent);
+    return ReadDirectoryChangesW(directory,
+                                 buffer.get(),
+                                 buffer_size,
+                                 TRUE,
+                                 notify_filter,
+                                 nullptr,
+                                 &overlapped,
+                                 nullptr);
+  }
+
+  void read_changes(std::vector<file_change>& changes)
+  {
+    DWORD bytes{};
+    if (!GetOverlappedResult(directory, &overlapped, &bytes, FALSE) || bytes == 0) {
+      return;  // The buffer overflowed, so the changes are lost
+    }
+
+    const auto* data = reinterpret_cast<const char*>(buffer.get());
+
+    while (true) {
+      const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(data);
+      const auto length = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+
+      const auto size = WideCharToMultiByte(CP_UTF8,
+                                            0,
+                                            info->FileName,
+                                            length,
+                                            nullptr,
+                                            0,
+                                            nullptr,
+                                            nullptr);
+
+      std::string path(static_cast<usize>(size), '\0');
+      WideCharToMultiByte(CP_UTF8,
+                          0,
+                          info->FileName,
+                          length,
+                          path.data(),
+                          size,
+                          nullptr,
+                          nullptr);
+
+      for (auto& ch : path) {
+        if (ch == '\\') {
+          ch = '/';
+        }
+      }
+
+      const auto attributes = GetFileAttributesA((root + path).c_str());
+      const auto isDirectory = attributes != INVALID_FILE_ATTRIBUTES &&
+                               (attributes & FILE_ATTRIBUTE_DIRECTORY);
+
+      if (!isDirectory) {
+        switch (info->Action) {
+          case FILE_ACTION_ADDED:
+            changes.push_back({std::move(path), file_action::added});
+            break;
+
+          case FILE_ACTION_REMOVED:
+          case FILE_ACTION_RENAMED_OLD_NAME:
+            changes.push_back({std::move(path), file_action::removed});
+            break;
+
+          case FILE_ACTION_MODIFIED:
+          case FILE_ACTION_RENAMED_NEW_NAME:
+            changes.push_back({std::move(path), file_action::modified});
+            break;
+
+          default:
+            break;
+        }
+      }
+
+      if (info->NextEntryOffset == 0) {
+        break;
+      }
+
+      data += info->NextEntryOffset;
+    }
+  }
+};
+
+CENTURION_LIB_INLINE auto open_directory_monitor(const std::string& root)
+    -> directory_monitor*
+{
+  auto monitor = std::make_unique<directory_monitor>();
+  monitor->root = root;
+
+  monitor->directory = CreateFileA(root.c_str(),
+                                   FILE_LIST_DIRECTORY,
+                                   FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                   nullptr,
+                                   OPEN_EXISTING,
+                                   FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+                                   nullptr);
+  if (monitor->directory == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  monitor->stop = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+  monitor->overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+  monitor->buffer = std::make_unique<DWORD[]>(directory_monitor::buffer_size / sizeof(DWORD));
+
+  // Changes are only recorded once the first read has been issued
+  if (monitor->stop && monitor->overlapped.hEvent && monitor->issue_read()) {
+    return monitor.release();
+  }
+  else {
+    close_directory_monitor(monitor.release());
+    return nullptr;
+  }
+}
+
+CENTURION_LIB_INLINE void close_directory_monitor(directory_monitor* monitor) noexcept
+{
+  if (!monitor) {
+    return;
+  }
+
+  if (monitor->directory != INVALID_HANDLE_VALUE) {
+    CancelIo(monitor->directory);
+
+    DWORD bytes{};
+    GetOverlappedResult(monitor->directory, &monitor->overlapped, &bytes, TRUE);
+
+    CloseHandle(monitor->directory);
+  }
+
+  if (monitor->overlapped.hEvent) {
+    CloseHandle(monitor->overlapped.hEvent);
+  }
+
+  if (monitor->stop) {
+    CloseHandle(monitor->stop);
+  }
+
+  delete monitor;
+}
+
+CENTURION_LIB_INLINE void stop_directory_monitor(directory_monitor& monitor) noexcept
+{
+  SetEvent(monitor.stop);
+}
+
+CENTURION_LIB_INLINE auto poll_directory_monitor(directory_monitor& monitor,
+                                                 const u32 timeout,
+                                                 std::vector<file_change>& changes) -> bool
+{
+  const HANDLE handles[] = {monitor.overlapped.hEvent, monitor.stop};
+
+  const auto result = WaitForMultipleObjects(2, handles, FALSE, timeout);
+  if (result == WAIT_OBJECT_0) {
+    monitor.read_changes(changes);
+    return monitor.issue_read();
+  }
+  else {
+    return result == WAIT_TIMEOUT;
+  }
+}
+
+#elif defined(__linux__)
+
+struct directory_monitor final
+{
+  inline constexpr static u32 watch_mask = IN_CREATE | IN_DELETE | IN_MODIFY |
+                                           IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO |
+                                           IN_ONLYDIR | IN_DONT_FOLLOW;
+
+  std::string root;
+  int inotify{-1};
+  int stop[2]{-1, -1};  ///< A pipe that wakes the worker when the watcher is stopped.
+  std::unordered_map<int, std::string> directories;  ///< Relative paths of the watches.
+
+  // Watches a directory, relative to the root, and all of its subdirectories
+  void add_watches(const std::string& directory)
+  {
+    const auto path = root + directory;
+
+    const auto watch = inotify_add_watch(inotify, path.c_str(), watch_mask);
+    if (watch == -1) {
+      return;
+    }
+
+    directories[watch] = directory;
+
+    if (auto* stream = opendir(path.c_str())) {
+      while (const auto* entry = readdir(stream)) {
+        const std::string_view name{entry->d_name};
+        if (entry->d_type == DT_DIR && name != "." && name != "..") {
+          add_watches(directory + entry->d_name + '/');
+        }
+      }
+
+      closedir(stream);
+    }
+  }
+
+  void read_changes(std::vector<file_change>& changes)
+  {
+    alignas(inotify_event) char buffer[16 * 1'024];
+
+    ssize_t length;
+    while ((length = ::read(inotify, buffer, sizeof buffer)) > 0) {
+      for (auto* data = buffer; data < buffer + length;) {
+        const auto* event = reinterpret_cast<const inotify_event*>(data);
+        data += sizeof(inotify_event) + event->len;
+
+        const auto directory = directories.find(event->wd);
+        if (directory == directories.end()) {
+          continue;
+        }
+        else if (event->mask & IN_IGNORED) {
+          directories.erase(directory);  // The directory was removed
+          continue;
+        }
+        else if (event->len == 0) {
+          continue;  // The watched directory itself changed
+        }
+
+        auto path = directory->second + event->name;
+
+        if (event->mask & IN_ISDIR) {
+          if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+            add_watches(path + '/');
+          }
+        }
+        else if (event->mask & IN_CREATE) {
+          changes.push_back({std::move(path), file_action::added});
+        }
+        else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+          changes.push_back({std::move(path), file_action::removed});
+        }
+        else {
+          changes.push_back({std::move(path), file_action::modified});
+        }
+      }
+    }
+  }
+};
+
+CENTURION_LIB_INLINE auto open_directory_monitor(const std::string& root)
+    -> directory_monitor*
+{
+  auto monitor = std::make_unique<directory_monitor>();
+  monitor->root = root;
+
+  monitor->inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (monitor->inotify != -1 && pipe2(monitor->stop, O_CLOEXEC) != -1) {
+    monitor->add_watches("");
+  }
+
+  if (!monitor->directories.empty()) {
+    return monitor.release();
+  }
+  else {
+    close_directory_monitor(monitor.release());
+    return nullptr;
+  }
+}
+
+CENTURION_LIB_INLINE void close_directory_monitor(directory_monitor* monitor) noexcept
+{
+  if (!monitor) {
+    return;
+  }
+
+  for (const auto descriptor : {monitor->inotify, monitor->stop[0], monitor->stop[1]}) {
+    if (descriptor != -1) {
+      ::close(descriptor);
+    }
+  }
+
+  delete monitor;
+}
+
+CENTURION_LIB_INLINE void stop_directory_monitor(directory_monitor& monitor) noexcept
+{
+  const char byte{};
+  [[maybe_unused]] const auto written = ::write(monitor.stop[1], &byte, 1);
+}
+
+CENTURION_LIB_INLINE auto poll_directory_monitor(directory_monitor& monitor,
+                                                 const u32 timeout,
+                                                 std::vector<file_change>& changes) -> bool
+{
+  pollfd descriptors[] = {{monitor.inotify, POLLIN, 0}, {monitor.stop[0], POLLIN, 0}};
+
+  const auto milliseconds = (timeout == infinite_timeout) ? -1 : static_cast<int>(timeout);
+  if (::poll(descriptors, 2, milliseconds) == -1) {
+    return errno == EINTR;
+  }
+
+  if (descriptors[1].revents != 0) {
+    return false;
+  }
+
+  if (descriptors[0].revents & POLLIN) {
+    monitor.read_changes(changes);
+  }
+
+  return true;
+}
+
+#else
+
+struct directory_monitor final
+{};
+
+CENTURION_LIB_INLINE auto open_directory_monitor(const std::string&) -> directory_monitor*
+{
+  return nullptr;
+}
+
+CENTURION_LIB_INLINE void close_directory_monitor(directory_monitor*) noexcept
+{}
+
+CENTURION_LIB_INLINE void stop_directory_monitor(directory_monitor&) noexcept
+{}
+
+CENTURION_LIB_INLINE auto poll_directory_monitor(directory_monitor&,
+                                                 const u32,
+                                                 std::vector<file_change>&) -> bool
+{
+  return false;
+}
+
+#endif  // defined(_WIN32)
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_FILE_WATCHER_IMPL_HEADER
@@ -1,21 +1,67 @@
 #ifndef CENTURION_DETAIL_FROM_STRING_HEADER
 #define CENTURION_DETAIL_FROM_STRING_HEADER
 
+#include <array>         // array
+#include <cctype>        // isspace
+#include <cerrno>        // errno, ERANGE
 #include <charconv>      // from_chars
+#include <cstdlib>       // strtof, strtod, strtold
 #include <optional>      // optional
-#include <string>        // string, stof
 #include <string_view>   // string_view
 #include <system_error>  // errc
-#include <type_traits>   // is_floating_point_v
+#include <type_traits>   // is_floating_point_v, is_same_v
 
-#include "../compiler/compiler.hpp"
+#include "../compiler/features.hpp"
+#include "../core/integers.hpp"
 
 /// \cond FALSE
 namespace cen::detail {
 
+// The longest floating-point string that can be parsed without std::from_chars
+inline constexpr usize max_float_string_length = 127;
+
 template <typename T>
-[[nodiscard]] auto from_string(const std::string_view str,
-                               const int base = 10) noexcept(on_msvc()) -> std::optional<T>
+[[nodiscard]] auto parse_float(const std::string_view str) noexcept -> std::optional<T>
+{
+  // Reject what std::from_chars would reject, but the strto* functions accept
+  if (str.empty() || str.size() > max_float_string_length || str.front() == '+' ||
+      std::isspace(static_cast<unsigned char>(str.front()))) {
+    return std::nullopt;
+  }
+
+  // The strto* functions need a null-terminated string, so we copy it to the stack
+  std::array<char, max_float_string_length + 1> buffer;
+  str.copy(buffer.data(), str.size());
+  buffer[str.size()] = '\0';
+
+  char* last{};
+  T value{};
+
+  errno = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    value = std::strtof(buffer.data(), &last);
+  }
+  else if constexpr (std::is_same_v<T, double>) {
+    value = std::strtod(buffer.data(), &last);
+  }
+  else {
+    value = std::strtold(buffer.data(), &last);
+  }
+
+  if (last == buffer.data() + str.size() && errno != ERANGE) {
+    return value;
+  }
+  else {
+    return std::nullopt;
+  }
+}
+
+/* Parses a number without allocating, the entire string must be a valid number. Floats
+   are parsed with std::strtof and friends if std::from_chars doesn't support them, in
+   which case strings longer than max_float_string_length are rejected. */
+template <typename T>
+[[nodiscard]] auto from_string(const std::string_view str, const int base = 10) noexcept
+    -> std::optional<T>
 {
   T value{};
 
@@ -26,19 +72,13 @@ template <typename T>
   std::errc error{};
 
   if constexpr (std::is_floating_point_v<T>) {
-    if constexpr (on_gcc() || on_clang()) {
-      try {
-        value = std::stof(std::string{str});
-      }
-      catch (...) {
-        return std::nullopt;
-      }
-    }
-    else {
-      const auto [ptr, err] = std::from_chars(begin, end, value);
-      mismatch = ptr;
-      error = err;
-    }
+#if CENTURION_HAS_FEATURE_FLOAT_CHARCONV
+    const auto [ptr, err] = std::from_chars(begin, end, value);
+    mismatch = ptr;
+    error = err;
+#else
+    return parse_float<T>(str);
+#endif  // CENTURION_HAS_FEATURE_FLOAT_CHARCONV
   }
   else {
     const auto [ptr, err] = std::from_chars(begin, end, value, base);
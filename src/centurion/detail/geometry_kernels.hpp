@@ -0,0 +1,1079 @@
+#ifndef CENTURION_DETAIL_GEOMETRY_KERNELS_HEADER
+#define CENTURION_DETAIL_GEOMETRY_KERNELS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include <limits>  // numeric_limits
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+static_assert(sizeof(SDL_FRect) == 4 * sizeof(float));
+static_assert(sizeof(SDL_FPoint) == 2 * sizeof(float));
+
+// The bounds of a set of coordinates, as minimum and maximum values
+struct geometry_bounds final
+{
+  float minX{std::numeric_limits<float>::infinity()};
+  float minY{std::numeric_limits<float>::infinity()};
+  float maxX{-std::numeric_limits<float>::infinity()};
+  float maxY{-std::numeric_limits<float>::infinity()};
+
+  [[nodiscard]] auto valid() const noexcept -> bool
+  {
+    return minX <= maxX && minY <= maxY;
+  }
+};
+
+inline void add_scalar(float* values, const usize count, const float delta) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    values[index] += delta;
+  }
+}
+
+inline void multiply_scalar(float* values, const usize count, const float factor) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    values[index] *= factor;
+  }
+}
+
+// Writes 1 to the mask for each rectangle that intersects the area, i.e. like intersects()
+inline auto rects_intersect_scalar(const float* x,
+                                   const float* y,
+                                   const float* w,
+                                   const float* h,
+                                   const usize count,
+                                   const SDL_FRect& area,
+                                   u8* mask) noexcept -> usize
+{
+  const auto areaMaxX = area.x + area.w;
+  const auto areaMaxY = area.y + area.h;
+
+  usize hits = 0;
+  for (usize index = 0; index < count; ++index) {
+    const auto hit = x[index] < areaMaxX && x[index] + w[index] > area.x &&
+                     y[index] < areaMaxY && y[index] + h[index] > area.y;
+    mask[index] = hit ? 1 : 0;
+    hits += hit ? 1 : 0;
+  }
+
+  return hits;
+}
+
+// Writes 1 to the mask for each rectangle that contains the point, i.e. like contains()
+inline auto rects_contain_scalar(const float* x,
+                                 const float* y,
+                                 const float* w,
+                                 const float* h,
+                                 const usize count,
+                                 const SDL_FPoint& point,
+                                 u8* mask) noexcept -> usize
+{
+  usize hits = 0;
+  for (usize index = 0; index < count; ++index) {
+    const auto hit = point.x >= x[index] && point.y >= y[index] &&
+                     point.x <= x[index] + w[index] && point.y <= y[index] + h[index];
+    mask[index] = hit ? 1 : 0;
+    hits += hit ? 1 : 0;
+  }
+
+  return hits;
+}
+
+// Writes 1 to the mask for each point that is contained in the area
+inline auto points_within_scalar(const float* x,
+                                 const float* y,
+                                 const usize count,
+                                 const SDL_FRect& area,
+                                 u8* mask) noexcept -> usize
+{
+  const auto areaMaxX = area.x + area.w;
+  const auto areaMaxY = area.y + area.h;
+
+  usize hits = 0;
+  for (usize index = 0; index < count; ++index) {
+    const auto hit = x[index] >= area.x && y[index] >= area.y && x[index] <= areaMaxX &&
+                     y[index] <= areaMaxY;
+    mask[index] = hit ? 1 : 0;
+    hits += hit ? 1 : 0;
+  }
+
+  return hits;
+}
+
+// Accumulates the bounds of rectangles with an area, i.e. like get_union()
+inline void rect_bounds_scalar(const float* x,
+                               const float* y,
+                               const float* w,
+                               const float* h,
+                               const usize count,
+                               geometry_bounds& bounds) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    if (w[index] > 0 && h[index] > 0) {
+      bounds.minX = (x[index] < bounds.minX) ? x[index] : bounds.minX;
+      bounds.minY = (y[index] < bounds.minY) ? y[index] : bounds.minY;
+
+      const auto maxX = x[index] + w[index];
+      const auto maxY = y[index] + h[index];
+      bounds.maxX = (maxX > bounds.maxX) ? maxX : bounds.maxX;
+      bounds.maxY = (maxY > bounds.maxY) ? maxY : bounds.maxY;
+    }
+  }
+}
+
+inline void point_bounds_scalar(const float* x,
+                                const float* y,
+                                const usize count,
+                                geometry_bounds& bounds) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    bounds.minX = (x[index] < bounds.minX) ? x[index] : bounds.minX;
+    bounds.minY = (y[index] < bounds.minY) ? y[index] : bounds.minY;
+    bounds.maxX = (x[index] > bounds.maxX) ? x[index] : bounds.maxX;
+    bounds.maxY = (y[index] > bounds.maxY) ? y[index] : bounds.maxY;
+  }
+}
+
+inline void interleave_rects_scalar(const float* x,
+                                    const float* y,
+                                    const float* w,
+                                    const float* h,
+                                    const usize count,
+                                    SDL_FRect* rects) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    rects[index] = SDL_FRect{x[index], y[index], w[index], h[index]};
+  }
+}
+
+inline void deinterleave_rects_scalar(const SDL_FRect* rects,
+                                      const usize count,
+                                      float* x,
+                                      float* y,
+                                      float* w,
+                                      float* h) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    x[index] = rects[index].x;
+    y[index] = rects[index].y;
+    w[index] = rects[index].w;
+    h[index] = rects[index].h;
+  }
+}
+
+inline void interleave_points_scalar(const float* x,
+                                     const float* y,
+                                     const usize count,
+                                     SDL_FPoint* points) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    points[index] = SDL_FPoint{x[index], y[index]};
+  }
+}
+
+inline void deinterleave_points_scalar(const SDL_FPoint* points,
+                                       const usize count,
+                                       float* x,
+                                       float* y) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    x[index] = points[index].x;
+    y[index] = points[index].y;
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+inline auto store_mask_sse2(const __m128 hit, u8* mask) noexcept -> usize
+{
+  const auto bits = _mm_movemask_ps(hit);
+  for (auto lane = 0; lane < 4; ++lane) {
+    mask[lane] = static_cast<u8>((bits >> lane) & 1);
+  }
+
+  return static_cast<usize>(mask[0] + mask[1] + mask[2] + mask[3]);
+}
+
+[[nodiscard]] inline auto horizontal_min_sse2(__m128 value) noexcept -> float
+{
+  value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+  value = _mm_min_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(value);
+}
+
+[[nodiscard]] inline auto horizontal_max_sse2(__m128 value) noexcept -> float
+{
+  value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+  value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(value);
+}
+
+inline void add_sse2(float* values, const usize count, const float delta) noexcept
+{
+  const auto offset = _mm_set1_ps(delta);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    _mm_storeu_ps(values + index, _mm_add_ps(_mm_loadu_ps(values + index), offset));
+  }
+
+  add_scalar(values + index, count - index, delta);
+}
+
+inline void multiply_sse2(float* values, const usize count, const float factor) noexcept
+{
+  const auto scale = _mm_set1_ps(factor);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    _mm_storeu_ps(values + index, _mm_mul_ps(_mm_loadu_ps(values + index), scale));
+  }
+
+  multiply_scalar(values + index, count - index, factor);
+}
+
+inline auto rects_intersect_sse2(const float* x,
+                                 const float* y,
+                                 const float* w,
+                                 const float* h,
+                                 const usize count,
+                                 const SDL_FRect& area,
+                                 u8* mask) noexcept -> usize
+{
+  const auto areaX = _mm_set1_ps(area.x);
+  const auto areaY = _mm_set1_ps(area.y);
+  const auto areaMaxX = _mm_set1_ps(area.x + area.w);
+  const auto areaMaxY = _mm_set1_ps(area.y + area.h);
+
+  usize hits = 0;
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto rx = _mm_loadu_ps(x + index);
+    const auto ry = _mm_loadu_ps(y + index);
+    const auto rmaxX = _mm_add_ps(rx, _mm_loadu_ps(w + index));
+    const auto rmaxY = _mm_add_ps(ry, _mm_loadu_ps(h + index));
+
+    const auto hitX = _mm_and_ps(_mm_cmplt_ps(rx, areaMaxX), _mm_cmpgt_ps(rmaxX, areaX));
+    const auto hitY = _mm_and_ps(_mm_cmplt_ps(ry, areaMaxY), _mm_cmpgt_ps(rmaxY, areaY));
+
+    hits += store_mask_sse2(_mm_and_ps(hitX, hitY), mask + index);
+  }
+
+  return hits + rects_intersect_scalar(x + index,
+                                       y + index,
+                                       w + index,
+                                       h + index,
+                                       count - index,
+                                       area,
+                                       mask + index);
+}
+
+inline auto rects_contain_sse2(const float* x,
+                               const float* y,
+                               const float* w,
+                               const float* h,
+                               const usize count,
+                               const SDL_FPoint& point,
+                               u8* mask) noexcept -> usize
+{
+  const auto px = _mm_set1_ps(point.x);
+  const auto py = _mm_set1_ps(point.y);
+
+  usize hits = 0;
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto rx = _mm_loadu_ps(x + index);
+    const auto ry = _mm_loadu_ps(y + index);
+    const auto rmaxX = _mm_add_ps(rx, _mm_loadu_ps(w + index));
+    const auto rmaxY = _mm_add_ps(ry, _mm_loadu_ps(h + index));
+
+    const auto hitX = _mm_and_ps(_mm_cmpge_ps(px, rx), _mm_cmple_ps(px, rmaxX));
+    const auto hitY = _mm_and_ps(_mm_cmpge_ps(py, ry), _mm_cmple_ps(py, rmaxY));
+
+    hits += store_mask_sse2(_mm_and_ps(hitX, hitY), mask + index);
+  }
+
+  return hits + rects_contain_scalar(x + index,
+                                     y + index,
+                                     w + index,
+                                     h + index,
+                                     count - index,
+                                     point,
+                                     mask + index);
+}
+
+inline auto points_within_sse2(const float* x,
+                               const float* y,
+                               const usize count,
+                               const SDL_FRect& area,
+                               u8* mask) noexcept -> usize
+{
+  const auto areaX = _mm_set1_ps(area.x);
+  const auto areaY = _mm_set1_ps(area.y);
+  const auto areaMaxX = _mm_set1_ps(area.x + area.w);
+  const auto areaMaxY = _mm_set1_ps(area.y + area.h);
+
+  usize hits = 0;
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto px = _mm_loadu_ps(x + index);
+    const auto py = _mm_loadu_ps(y + index);
+
+    const auto hitX = _mm_and_ps(_mm_cmpge_ps(px, areaX), _mm_cmple_ps(px, areaMaxX));
+    const auto hitY = _mm_and_ps(_mm_cmpge_ps(py, areaY), _mm_cmple_ps(py, areaMaxY));
+
+    hits += store_mask_sse2(_mm_and_ps(hitX, hitY), mask + index);
+  }
+
+  return hits +
+         points_within_scalar(x + index, y + index, count - index, area, mask + index);
+}
+
+inline void rect_bounds_sse2(const float* x,
+                             const float* y,
+                             const float* w,
+                             const float* h,
+                             const usize count,
+                             geometry_bounds& bounds) noexcept
+{
+  const auto zero = _mm_setzero_ps();
+  const auto positive = _mm_set1_ps(std::numeric_limits<float>::infinity());
+  const auto negative = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+
+  auto minX = positive;
+  auto minY = positive;
+  auto maxX = negative;
+  auto maxY = negative;
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto rx = _mm_loadu_ps(x + index);
+    const auto ry = _mm_loadu_ps(y + index);
+    const auto rw = _mm_loadu_ps(w + index);
+    const auto rh = _mm_loadu_ps(h + index);
+
+    // Rectangles without an area are replaced by values that don't affect the bounds
+    const auto valid = _mm_and_ps(_mm_cmpgt_ps(rw, zero), _mm_cmpgt_ps(rh, zero));
+
+    const auto select = [valid](const __m128 value, const __m128 fallback) noexcept {
+      return _mm_or_ps(_mm_and_ps(valid, value), _mm_andnot_ps(valid, fallback));
+    };
+
+    minX = _mm_min_ps(minX, select(rx, positive));
+    minY = _mm_min_ps(minY, select(ry, positive));
+    maxX = _mm_max_ps(maxX, select(_mm_add_ps(rx, rw), negative));
+    maxY = _mm_max_ps(maxY, select(_mm_add_ps(ry, rh), negative));
+  }
+
+  geometry_bounds partial{horizontal_min_sse2(minX),
+                          horizontal_min_sse2(minY),
+                          horizontal_max_sse2(maxX),
+                          horizontal_max_sse2(maxY)};
+  rect_bounds_scalar(x + index, y + index, w + index, h + index, count - index, partial);
+
+  bounds = partial;
+}
+
+inline void point_bounds_sse2(const float* x,
+                              const float* y,
+                              const usize count,
+                              geometry_bounds& bounds) noexcept
+{
+  auto minX = _mm_set1_ps(std::numeric_limits<float>::infinity());
+  auto minY = minX;
+  auto maxX = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+  auto maxY = maxX;
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto px = _mm_loadu_ps(x + index);
+    const auto py = _mm_loadu_ps(y + index);
+
+    minX = _mm_min_ps(minX, px);
+    minY = _mm_min_ps(minY, py);
+    maxX = _mm_max_ps(maxX, px);
+    maxY = _mm_max_ps(maxY, py);
+  }
+
+  geometry_bounds partial{horizontal_min_sse2(minX),
+                          horizontal_min_sse2(minY),
+                          horizontal_max_sse2(maxX),
+                          horizontal_max_sse2(maxY)};
+  point_bounds_scalar(x + index, y + index, count - index, partial);
+
+  bounds = partial;
+}
+
+inline void interleave_rects_sse2(const float* x,
+                                  const float* y,
+                                  const float* w,
+                                  const float* h,
+                                  const usize count,
+                                  SDL_FRect* rects) noexcept
+{
+  auto* out = reinterpret_cast<float*>(rects);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto r0 = _mm_loadu_ps(x + index);
+    auto r1 = _mm_loadu_ps(y + index);
+    auto r2 = _mm_loadu_ps(w + index);
+    auto r3 = _mm_loadu_ps(h + index);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(out + 4 * index, r0);
+    _mm_storeu_ps(out + 4 * index + 4, r1);
+    _mm_storeu_ps(out + 4 * index + 8, r2);
+    _mm_storeu_ps(out + 4 * index + 12, r3);
+  }
+
+  interleave_rects_scalar(x + index,
+                          y + index,
+                          w + index,
+                          h + index,
+                          count - index,
+                          rects + index);
+}
+
+inline void deinterleave_rects_sse2(const SDL_FRect* rects,
+                                    const usize count,
+                                    float* x,
+                                    float* y,
+                                    float* w,
+                                    float* h) noexcept
+{
+  const auto* in = reinterpret_cast<const float*>(rects);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto r0 = _mm_loadu_ps(in + 4 * index);
+    auto r1 = _mm_loadu_ps(in + 4 * index + 4);
+    auto r2 = _mm_loadu_ps(in + 4 * index + 8);
+    auto r3 = _mm_loadu_ps(in + 4 * index + 12);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(x + index, r0);
+    _mm_storeu_ps(y + index, r1);
+    _mm_storeu_ps(w + index, r2);
+    _mm_storeu_ps(h + index, r3);
+  }
+
+  deinterleave_rects_scalar(rects + index,
+                            count - index,
+                            x + index,
+                            y + index,
+                            w + index,
+                            h + index);
+}
+
+inline void interleave_points_sse2(const float* x,
+                                   const float* y,
+                                   const usize count,
+                                   SDL_FPoint* points) noexcept
+{
+  auto* out = reinterpret_cast<float*>(points);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto px = _mm_loadu_ps(x + index);
+    const auto py = _mm_loadu_ps(y + index);
+
+    _mm_storeu_ps(out + 2 * index, _mm_unpacklo_ps(px, py));
+    _mm_storeu_ps(out + 2 * index + 4, _mm_unpackhi_ps(px, py));
+  }
+
+  interleave_points_scalar(x + index, y + index, count - index, points + index);
+}
+
+inline void deinterleave_points_sse2(const SDL_FPoint* points,
+                                     const usize count,
+                                     float* x,
+                                     float* y) noexcept
+{
+  const auto* in = reinterpret_cast<const float*>(points);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto lo = _mm_loadu_ps(in + 2 * index);
+    const auto hi = _mm_loadu_ps(in + 2 * index + 4);
+
+    _mm_storeu_ps(x + index, _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(y + index, _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+
+  deinterleave_points_scalar(points + index, count - index, x + index, y + index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline auto store_mask_neon(const uint32x4_t hit, u8* mask) noexcept -> usize
+{
+  const auto bits = vshrq_n_u32(hit, 31);
+  mask[0] = static_cast<u8>(vgetq_lane_u32(bits, 0));
+  mask[1] = static_cast<u8>(vgetq_lane_u32(bits, 1));
+  mask[2] = static_cast<u8>(vgetq_lane_u32(bits, 2));
+  mask[3] = static_cast<u8>(vgetq_lane_u32(bits, 3));
+
+  return static_cast<usize>(mask[0] + mask[1] + mask[2] + mask[3]);
+}
+
+[[nodiscard]] inline auto horizontal_min_neon(const float32x4_t value) noexcept -> float
+{
+  auto pair = vpmin_f32(vget_low_f32(value), vget_high_f32(value));
+  pair = vpmin_f32(pair, pair);
+  return vget_lane_f32(pair, 0);
+}
+
+[[nodiscard]] inline auto horizontal_max_neon(const float32x4_t value) noexcept -> float
+{
+  auto pair = vpmax_f32(vget_low_f32(value), vget_high_f32(value));
+  pair = vpmax_f32(pair, pair);
+  return vget_lane_f32(pair, 0);
+}
+
+inline void add_neon(float* values, const usize count, const float delta) noexcept
+{
+  const auto offset = vdupq_n_f32(delta);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(values + index, vaddq_f32(vld1q_f32(values + index), offset));
+  }
+
+  add_scalar(values + index, count - index, delta);
+}
+
+inline void multiply_neon(float* values, const usize count, const float factor) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(values + index, vmulq_n_f32(vld1q_f32(values + index), factor));
+  }
+
+  multiply_scalar(values + index, count - index, factor);
+}
+
+inline auto rects_intersect_neon(const float* x,
+                                 const float* y,
+                                 const float* w,
+                                 const float* h,
+                                 const usize count,
+                                 const SDL_FRect& area,
+                                 u8* mask) noexcept -> usize
+{
+  const auto areaX = vdupq_n_f32(area.x);
+  const auto areaY = vdupq_n_f32(area.y);
+  const auto areaMaxX = vdupq_n_f32(area.x + area.w);
+  const auto areaMaxY = vdupq_n_f32(area.y + area.h);
+
+  usize hits = 0;
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto rx = vld1q_f32(x + index);
+    const auto ry = vld1q_f32(y + index);
+    const auto rmaxX = vaddq_f32(rx, vld1q_f32(w + index));
+    const auto rmaxY = vaddq_f32(ry, vld1q_f32(h + index));
+
+    const auto hitX = vandq_u32(vcltq_f32(rx, areaMaxX), vcgtq_f32(rmaxX, areaX));
+    const auto hitY = vandq_u32(vcltq_f32(ry, areaMaxY), vcgtq_f32(rmaxY, areaY));
+
+    hits += store_mask_neon(vandq_u32(hitX, hitY), mask + index);
+  }
+
+  return hits + rects_intersect_scalar(x + index,
+                                       y + index,
+                                       w + index,
+                                       h + index,
+                                       count - index,
+                                       area,
+                                       mask + index);
+}
+
+inline auto rects_contain_neon(const float* x,
+                               const float* y,
+                               const float* w,
+                               const float* h,
+                               const usize count,
+                               const SDL_FPoint& point,
+                               u8* mask) noexcept -> usize
+{
+  const auto px = vdupq_n_f32(point.x);
+  const auto py = vdupq_n_f32(point.y);
+
+  usize hits = 0;
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto rx = vld1q_f32(x + index);
+    const auto ry = vld1q_f32(y + index);
+    const auto rmaxX = vaddq_f32(rx, vld1q_f32(w + index));
+    const auto rmaxY = vaddq_f32(ry, vld1q_f32(h + index));
+
+    const auto hitX = vandq_u32(vcgeq_f32(px, rx), vcleq_f32(px, rmaxX));
+    const auto hitY = vandq_u32(vcgeq_f32(py, ry), vcleq_f32(py, rmaxY));
+
+    hits += store_mask_neon(vandq_u32(hitX, hitY), mask + index);
+  }
+
+  return hits + rects_contain_scalar(x + index,
+                                     y + index,
+                                     w + index,
+                                     h + index,
+                                     count - index,
+                                     point,
+                                     mask + index);
+}
+
+inline auto points_within_neon(const float* x,
+                               const float* y,
+                               const usize count,
+                               const SDL_FRect& area,
+                               u8* mask) noexcept -> usize
+{
+  const auto areaX = vdupq_n_f32(area.x);
+  const auto areaY = vdupq_n_f32(area.y);
+  const auto areaMaxX = vdupq_n_f32(area.x + area.w);
+  const auto areaMaxY = vdupq_n_f32(area.y + area.h);
+
+  usize hits = 0;
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto px = vld1q_f32(x + index);
+    const auto py = vld1q_f32(y + index);
+
+    const auto hitX = vandq_u32(vcgeq_f32(px, areaX), vcleq_f32(px, areaMaxX));
+    const auto hitY = vandq_u32(vcgeq_f32(py, areaY), vcleq_f32(py, areaMaxY));
+
+    hits += store_mask_neon(vandq_u32(hitX, hitY), mask + index);
+  }
+
+  return hits +
+         points_within_scalar(x + index, y + index, count - index, area, mask + index);
+}
+
+inline void rect_bounds_neon(const float* x,
+                             const float* y,
+                             const float* w,
+                             const float* h,
+                             const usize count,
+                             geometry_bounds& bounds) noexcept
+{
+  const auto zero = vdupq_n_f32(0.0f);
+  const auto positive = vdupq_n_f32(std::numeric_limits<float>::infinity());
+  const auto negative = vdupq_n_f32(-std::numeric_limits<float>::infinity());
+
+  auto minX = positive;
+  auto minY = positive;
+  auto maxX = negative;
+  auto maxY = negative;
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto rx = vld1q_f32(x + index);
+    const auto ry = vld1q_f32(y + index);
+    const auto rw = vld1q_f32(w + index);
+    const auto rh = vld1q_f32(h + index);
+
+    // Rectangles without an area are replaced by values that don't affect the bounds
+    const auto valid = vandq_u32(vcgtq_f32(rw, zero), vcgtq_f32(rh, zero));
+
+    minX = vminq_f32(minX, vbslq_f32(valid, rx, positive));
+    minY = vminq_f32(minY, vbslq_f32(valid, ry, positive));
+    maxX = vmaxq_f32(maxX, vbslq_f32(valid, vaddq_f32(rx, rw), negative));
+    maxY = vmaxq_f32(maxY, vbslq_f32(valid, vaddq_f32(ry, rh), negative));
+  }
+
+  geometry_bounds partial{horizontal_min_neon(minX),
+                          horizontal_min_neon(minY),
+                          horizontal_max_neon(maxX),
+                          horizontal_max_neon(maxY)};
+  rect_bounds_scalar(x + index, y + index, w + index, h + index, count - index, partial);
+
+  bounds = partial;
+}
+
+inline void point_bounds_neon(const float* x,
+                              const float* y,
+                              const usize count,
+                              geometry_bounds& bounds) noexcept
+{
+  auto minX = vdupq_n_f32(std::numeric_limits<float>::infinity());
+  auto minY = minX;
+  auto maxX = vdupq_n_f32(-std::numeric_limits<float>::infinity());
+  auto maxY = maxX;
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto px = vld1q_f32(x + index);
+    const auto py = vld1q_f32(y + index);
+
+    minX = vminq_f32(minX, px);
+    minY = vminq_f32(minY, py);
+    maxX = vmaxq_f32(maxX, px);
+    maxY = vmaxq_f32(maxY, py);
+  }
+
+  geometry_bounds partial{horizontal_min_neon(minX),
+                          horizontal_min_neon(minY),
+                          horizontal_max_neon(maxX),
+                          horizontal_max_neon(maxY)};
+  point_bounds_scalar(x + index, y + index, count - index, partial);
+
+  bounds = partial;
+}
+
+inline void interleave_rects_neon(const float* x,
+                                  const float* y,
+                                  const float* w,
+                                  const float* h,
+                                  const usize count,
+                                  SDL_FRect* rects) noexcept
+{
+  auto* out = reinterpret_cast<float*>(rects);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const float32x4x4_t lanes{{vld1q_f32(x + index),
+                               vld1q_f32(y + index),
+                               vld1q_f32(w + index),
+                               vld1q_f32(h + index)}};
+    vst4q_f32(out + 4 * index, lanes);
+  }
+
+  interleave_rects_scalar(x + index,
+                          y + index,
+                          w + index,
+                          h + index,
+                          count - index,
+                          rects + index);
+}
+
+inline void deinterleave_rects_neon(const SDL_FRect* rects,
+                                    const usize count,
+                                    float* x,
+                                    float* y,
+                                    float* w,
+                                    float* h) noexcept
+{
+  const auto* in = reinterpret_cast<const float*>(rects);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto lanes = vld4q_f32(in + 4 * index);
+    vst1q_f32(x + index, lanes.val[0]);
+    vst1q_f32(y + index, lanes.val[1]);
+    vst1q_f32(w + index, lanes.val[2]);
+    vst1q_f32(h + index, lanes.val[3]);
+  }
+
+  deinterleave_rects_scalar(rects + index,
+                            count - index,
+                            x + index,
+                            y + index,
+                            w + index,
+                            h + index);
+}
+
+inline void interleave_points_neon(const float* x,
+                                   const float* y,
+                                   const usize count,
+                                   SDL_FPoint* points) noexcept
+{
+  auto* out = reinterpret_cast<float*>(points);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const float32x4x2_t lanes{{vld1q_f32(x + index), vld1q_f32(y + index)}};
+    vst2q_f32(out + 2 * index, lanes);
+  }
+
+  interleave_points_scalar(x + index, y + index, count - index, points + index);
+}
+
+inline void deinterleave_points_neon(const SDL_FPoint* points,
+                                     const usize count,
+                                     float* x,
+                                     float* y) noexcept
+{
+  const auto* in = reinterpret_cast<const float*>(points);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto lanes = vld2q_f32(in + 2 * index);
+    vst1q_f32(x + index, lanes.val[0]);
+    vst1q_f32(y + index, lanes.val[1]);
+  }
+
+  deinterleave_points_scalar(points + index, count - index, x + index, y + index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+inline void add(float* values, const usize count, const float delta) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    add_sse2(values, count, delta);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    add_neon(values, count, delta);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  add_scalar(values, count, delta);
+}
+
+inline void multiply(float* values, const usize count, const float factor) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    multiply_sse2(values, count, factor);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    multiply_neon(values, count, factor);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  multiply_scalar(values, count, factor);
+}
+
+inline auto rects_intersect(const float* x,
+                            const float* y,
+                            const float* w,
+                            const float* h,
+                            const usize count,
+                            const SDL_FRect& area,
+                            u8* mask) noexcept -> usize
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    return rects_intersect_sse2(x, y, w, h, count, area, mask);
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    return rects_intersect_neon(x, y, w, h, count, area, mask);
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  return rects_intersect_scalar(x, y, w, h, count, area, mask);
+}
+
+inline auto rects_contain(const float* x,
+                          const float* y,
+                          const float* w,
+                          const float* h,
+                          const usize count,
+                          const SDL_FPoint& point,
+                          u8* mask) noexcept -> usize
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    return rects_contain_sse2(x, y, w, h, count, point, mask);
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    return rects_contain_neon(x, y, w, h, count, point, mask);
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  return rects_contain_scalar(x, y, w, h, count, point, mask);
+}
+
+inline auto points_within(const float* x,
+                          const float* y,
+                          const usize count,
+                          const SDL_FRect& area,
+                          u8* mask) noexcept -> usize
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    return points_within_sse2(x, y, count, area, mask);
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    return points_within_neon(x, y, count, area, mask);
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  return points_within_scalar(x, y, count, area, mask);
+}
+
+inline void rect_bounds(const float* x,
+                        const float* y,
+                        const float* w,
+                        const float* h,
+                        const usize count,
+                        geometry_bounds& bounds) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    rect_bounds_sse2(x, y, w, h, count, bounds);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    rect_bounds_neon(x, y, w, h, count, bounds);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  rect_bounds_scalar(x, y, w, h, count, bounds);
+}
+
+inline void point_bounds(const float* x,
+                         const float* y,
+                         const usize count,
+                         geometry_bounds& bounds) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    point_bounds_sse2(x, y, count, bounds);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    point_bounds_neon(x, y, count, bounds);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  point_bounds_scalar(x, y, count, bounds);
+}
+
+inline void interleave_rects(const float* x,
+                             const float* y,
+                             const float* w,
+                             const float* h,
+                             const usize count,
+                             SDL_FRect* rects) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    interleave_rects_sse2(x, y, w, h, count, rects);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    interleave_rects_neon(x, y, w, h, count, rects);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  interleave_rects_scalar(x, y, w, h, count, rects);
+}
+
+inline void deinterleave_rects(const SDL_FRect* rects,
+                               const usize count,
+                               float* x,
+                               float* y,
+                               float* w,
+                               float* h) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    deinterleave_rects_sse2(rects, count, x, y, w, h);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    deinterleave_rects_neon(rects, count, x, y, w, h);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  deinterleave_rects_scalar(rects, count, x, y, w, h);
+}
+
+inline void interleave_points(const float* x,
+                              const float* y,
+                              const usize count,
+                              SDL_FPoint* points) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    interleave_points_sse2(x, y, count, points);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    interleave_points_neon(x, y, count, points);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  interleave_points_scalar(x, y, count, points);
+}
+
+inline void deinterleave_points(const SDL_FPoint* points,
+                                const usize count,
+                                float* x,
+                                float* y) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    deinterleave_points_sse2(points, count, x, y);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    deinterleave_points_neon(points, count, x, y);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  deinterleave_points_scalar(points, count, x, y);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_GEOMETRY_KERNELS_HEADER
@@ -0,0 +1,55 @@
+#ifndef CENTURION_DETAIL_HEX_HEADER
+#define CENTURION_DETAIL_HEX_HEADER
+
+#include <string_view>  // string_view
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// Returns the value of a hexadecimal digit, or -1 if the character isn't a digit
+[[nodiscard]] constexpr auto hex_digit(const char c) noexcept -> int
+{
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  else if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  else if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  else {
+    return -1;
+  }
+}
+
+// Returns the value of the two hexadecimal digits at the offset, or -1 if either is invalid
+[[nodiscard]] constexpr auto hex_byte(const std::string_view str, const usize offset) noexcept
+    -> int
+{
+  const auto high = hex_digit(str[offset]);
+  const auto low = hex_digit(str[offset + 1]);
+  return (high < 0 || low < 0) ? -1 : (high << 4) | low;
+}
+
+// Branchless version of hex_byte(), the digits must be valid: '0'-'9' have bit 6 cleared,
+// whilst 'A'-'F' and 'a'-'f' have it set and share their low nibble (1-6)
+[[nodiscard]] constexpr auto hex_byte_unchecked(const std::string_view str,
+                                                const usize offset) noexcept -> u8
+{
+  const auto digit = [](const char c) noexcept {
+    const auto value = static_cast<unsigned>(static_cast<unsigned char>(c));
+    return (value & 0xFu) + 9u * (value >> 6u);
+  };
+
+  return static_cast<u8>((digit(str[offset]) << 4u) | digit(str[offset + 1]));
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_HEX_HEADER
@@ -2,15 +2,14 @@
 #define CENTURION_DETAIL_HINTS_IMPL_HEADER
 
 #include <optional>     // optional
-#include <string>       // string, stoi, stoul, stof
+#include <string>       // string, to_string
 #include <type_traits>  // enable_if_t, is_same_v, is_convertible_v
 
 #include "../core/integers.hpp"
 #include "../core/str.hpp"
-#include "czstring_compare.hpp"
 #include "czstring_eq.hpp"
 #include "from_string.hpp"
-#include "static_bimap.hpp"
+#include "static_string_map.hpp"
 
 /// \cond FALSE
 
@@ -20,7 +19,7 @@ template <typename Hint, typename T>
 using enable_if_hint_arg_t = std::enable_if_t<Hint::template valid_arg<T>(), int>;
 
 template <typename Key, usize Size>
-using string_map = static_bimap<Key, str, czstring_compare, Size>;
+using string_map = static_string_map<Key, Size>;
 
 template <typename Derived, typename Arg>
 struct crtp_hint
@@ -48,6 +47,11 @@ struct bool_hint : crtp_hint<bool_hint<Hint>, bool>
     return czstring_eq(str, "1") ? true : false;
   }
 
+  [[nodiscard]] static auto try_from_string(const str str) noexcept -> std::optional<bool>
+  {
+    return from_string(str);
+  }
+
   [[nodiscard]] static auto to_string(const bool value) -> std::string
   {
     return value ? "1" : "0";
@@ -73,6 +77,11 @@ struct string_hint : crtp_hint<string_hint<Hint>, str>
     return value;
   }
 
+  [[nodiscard]] static auto try_from_string(const str value) noexcept -> std::optional<str>
+  {
+    return value;
+  }
+
   [[nodiscard]] static auto to_string(const str value) -> std::string
   {
     return value;
@@ -83,14 +92,9 @@ struct string_hint : crtp_hint<string_hint<Hint>, str>
 template <typename Hint>
 struct int_hint : crtp_hint<int_hint<Hint>, int>
 {
-  [[nodiscard]] static auto current_value() -> std::optional<int>
+  [[nodiscard]] static auto current_value() noexcept -> std::optional<int>
   {
-    if (const str value = SDL_GetHint(Hint::name())) {
-      return std::stoi(value);
-    }
-    else {
-      return std::nullopt;
-    }
+    return try_from_string(SDL_GetHint(Hint::name()));
   }
 
   [[nodiscard]] static auto from_string(const str value) -> int
@@ -98,6 +102,16 @@ struct int_hint : crtp_hint<int_hint<Hint>, int>
     return detail::from_string<int>(value).value();
   }
 
+  [[nodiscard]] static auto try_from_string(const str value) noexcept -> std::optional<int>
+  {
+    if (value) {
+      return detail::from_string<int>(value);
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
   [[nodiscard]] static auto to_string(const int value) -> std::string
   {
     return std::to_string(value);
@@ -108,14 +122,9 @@ struct int_hint : crtp_hint<int_hint<Hint>, int>
 template <typename Hint>
 struct uint_hint : crtp_hint<uint_hint<Hint>, uint>
 {
-  [[nodiscard]] static auto current_value() -> std::optional<uint>
+  [[nodiscard]] static auto current_value() noexcept -> std::optional<uint>
   {
-    if (const str value = SDL_GetHint(Hint::name())) {
-      return static_cast<uint>(std::stoul(value));
-    }
-    else {
-      return std::nullopt;
-    }
+    return try_from_string(SDL_GetHint(Hint::name()));
   }
 
   [[nodiscard]] static auto from_string(const str value) -> uint
@@ -123,6 +132,16 @@ struct uint_hint : crtp_hint<uint_hint<Hint>, uint>
     return detail::from_string<uint>(value).value();
   }
 
+  [[nodiscard]] static auto try_from_string(const str value) noexcept -> std::optional<uint>
+  {
+    if (value) {
+      return detail::from_string<uint>(value);
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
   [[nodiscard]] static auto to_string(const uint value) -> std::string
   {
     return std::to_string(value);
@@ -133,14 +152,9 @@ struct uint_hint : crtp_hint<uint_hint<Hint>, uint>
 template <typename Hint>
 struct float_hint : crtp_hint<float_hint<Hint>, float>
 {
-  [[nodiscard]] static auto current_value() -> std::optional<float>
+  [[nodiscard]] static auto current_value() noexcept -> std::optional<float>
   {
-    if (const str value = SDL_GetHint(Hint::name())) {
-      return std::stof(value);
-    }
-    else {
-      return std::nullopt;
-    }
+    return try_from_string(SDL_GetHint(Hint::name()));
   }
 
   [[nodiscard]] static auto from_string(const str value) -> float
@@ -148,6 +162,16 @@ struct float_hint : crtp_hint<float_hint<Hint>, float>
     return detail::from_string<float>(value).value();
   }
 
+  [[nodiscard]] static auto try_from_string(const str value) noexcept -> std::optional<float>
+  {
+    if (value) {
+      return detail::from_string<float>(value);
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
   [[nodiscard]] static auto to_string(const float value) -> std::string
   {
     return std::to_string(value);
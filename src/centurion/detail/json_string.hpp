@@ -0,0 +1,30 @@
+#ifndef CENTURION_DETAIL_JSON_STRING_HEADER
+#define CENTURION_DETAIL_JSON_STRING_HEADER
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Writes a quoted JSON string, escaping quotes and backslashes and dropping control characters
+inline void write_json_string(std::ostream& stream, const std::string_view str)
+{
+  stream << '"';
+
+  for (const auto ch : str) {
+    if (ch == '"' || ch == '\\') {
+      stream << '\\' << ch;
+    }
+    else if (static_cast<unsigned char>(ch) >= 0x20) {
+      stream << ch;
+    }
+  }
+
+  stream << '"';
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_JSON_STRING_HEADER
@@ -0,0 +1,154 @@
+#ifndef CENTURION_DETAIL_KEY_NAMES_HEADER
+#define CENTURION_DETAIL_KEY_NAMES_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <utility>  // pair
+
+#include "perfect_hash_map.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// The names of the constants in scancodes.hpp, which are the same as SDL_GetScancodeName()
+inline constexpr perfect_hash_map<SDL_Scancode, 66> scan_code_names{
+    std::pair{SDL_SCANCODE_A, "A"},
+    std::pair{SDL_SCANCODE_B, "B"},
+    std::pair{SDL_SCANCODE_C, "C"},
+    std::pair{SDL_SCANCODE_D, "D"},
+    std::pair{SDL_SCANCODE_E, "E"},
+    std::pair{SDL_SCANCODE_F, "F"},
+    std::pair{SDL_SCANCODE_G, "G"},
+    std::pair{SDL_SCANCODE_H, "H"},
+    std::pair{SDL_SCANCODE_I, "I"},
+    std::pair{SDL_SCANCODE_J, "J"},
+    std::pair{SDL_SCANCODE_K, "K"},
+    std::pair{SDL_SCANCODE_L, "L"},
+    std::pair{SDL_SCANCODE_M, "M"},
+    std::pair{SDL_SCANCODE_N, "N"},
+    std::pair{SDL_SCANCODE_O, "O"},
+    std::pair{SDL_SCANCODE_P, "P"},
+    std::pair{SDL_SCANCODE_Q, "Q"},
+    std::pair{SDL_SCANCODE_R, "R"},
+    std::pair{SDL_SCANCODE_S, "S"},
+    std::pair{SDL_SCANCODE_T, "T"},
+    std::pair{SDL_SCANCODE_U, "U"},
+    std::pair{SDL_SCANCODE_V, "V"},
+    std::pair{SDL_SCANCODE_W, "W"},
+    std::pair{SDL_SCANCODE_X, "X"},
+    std::pair{SDL_SCANCODE_Y, "Y"},
+    std::pair{SDL_SCANCODE_Z, "Z"},
+    std::pair{SDL_SCANCODE_1, "1"},
+    std::pair{SDL_SCANCODE_2, "2"},
+    std::pair{SDL_SCANCODE_3, "3"},
+    std::pair{SDL_SCANCODE_4, "4"},
+    std::pair{SDL_SCANCODE_5, "5"},
+    std::pair{SDL_SCANCODE_6, "6"},
+    std::pair{SDL_SCANCODE_7, "7"},
+    std::pair{SDL_SCANCODE_8, "8"},
+    std::pair{SDL_SCANCODE_9, "9"},
+    std::pair{SDL_SCANCODE_0, "0"},
+    std::pair{SDL_SCANCODE_F1, "F1"},
+    std::pair{SDL_SCANCODE_F2, "F2"},
+    std::pair{SDL_SCANCODE_F3, "F3"},
+    std::pair{SDL_SCANCODE_F4, "F4"},
+    std::pair{SDL_SCANCODE_F5, "F5"},
+    std::pair{SDL_SCANCODE_F6, "F6"},
+    std::pair{SDL_SCANCODE_F7, "F7"},
+    std::pair{SDL_SCANCODE_F8, "F8"},
+    std::pair{SDL_SCANCODE_F9, "F9"},
+    std::pair{SDL_SCANCODE_F10, "F10"},
+    std::pair{SDL_SCANCODE_F11, "F11"},
+    std::pair{SDL_SCANCODE_F12, "F12"},
+    std::pair{SDL_SCANCODE_LEFT, "Left"},
+    std::pair{SDL_SCANCODE_RIGHT, "Right"},
+    std::pair{SDL_SCANCODE_UP, "Up"},
+    std::pair{SDL_SCANCODE_DOWN, "Down"},
+    std::pair{SDL_SCANCODE_SPACE, "Space"},
+    std::pair{SDL_SCANCODE_RETURN, "Return"},
+    std::pair{SDL_SCANCODE_ESCAPE, "Escape"},
+    std::pair{SDL_SCANCODE_BACKSPACE, "Backspace"},
+    std::pair{SDL_SCANCODE_TAB, "Tab"},
+    std::pair{SDL_SCANCODE_CAPSLOCK, "CapsLock"},
+    std::pair{SDL_SCANCODE_LSHIFT, "Left Shift"},
+    std::pair{SDL_SCANCODE_RSHIFT, "Right Shift"},
+    std::pair{SDL_SCANCODE_LCTRL, "Left Ctrl"},
+    std::pair{SDL_SCANCODE_RCTRL, "Right Ctrl"},
+    std::pair{SDL_SCANCODE_LALT, "Left Alt"},
+    std::pair{SDL_SCANCODE_RALT, "Right Alt"},
+    std::pair{SDL_SCANCODE_LGUI, "Left GUI"},
+    std::pair{SDL_SCANCODE_RGUI, "Right GUI"}};
+
+// The names of the constants in keycodes.hpp, which are the same as SDL_GetKeyName()
+inline constexpr perfect_hash_map<SDL_KeyCode, 66> key_code_names{
+    std::pair{SDLK_a, "A"},
+    std::pair{SDLK_b, "B"},
+    std::pair{SDLK_c, "C"},
+    std::pair{SDLK_d, "D"},
+    std::pair{SDLK_e, "E"},
+    std::pair{SDLK_f, "F"},
+    std::pair{SDLK_g, "G"},
+    std::pair{SDLK_h, "H"},
+    std::pair{SDLK_i, "I"},
+    std::pair{SDLK_j, "J"},
+    std::pair{SDLK_k, "K"},
+    std::pair{SDLK_l, "L"},
+    std::pair{SDLK_m, "M"},
+    std::pair{SDLK_n, "N"},
+    std::pair{SDLK_o, "O"},
+    std::pair{SDLK_p, "P"},
+    std::pair{SDLK_q, "Q"},
+    std::pair{SDLK_r, "R"},
+    std::pair{SDLK_s, "S"},
+    std::pair{SDLK_t, "T"},
+    std::pair{SDLK_u, "U"},
+    std::pair{SDLK_v, "V"},
+    std::pair{SDLK_w, "W"},
+    std::pair{SDLK_x, "X"},
+    std::pair{SDLK_y, "Y"},
+    std::pair{SDLK_z, "Z"},
+    std::pair{SDLK_1, "1"},
+    std::pair{SDLK_2, "2"},
+    std::pair{SDLK_3, "3"},
+    std::pair{SDLK_4, "4"},
+    std::pair{SDLK_5, "5"},
+    std::pair{SDLK_6, "6"},
+    std::pair{SDLK_7, "7"},
+    std::pair{SDLK_8, "8"},
+    std::pair{SDLK_9, "9"},
+    std::pair{SDLK_0, "0"},
+    std::pair{SDLK_F1, "F1"},
+    std::pair{SDLK_F2, "F2"},
+    std::pair{SDLK_F3, "F3"},
+    std::pair{SDLK_F4, "F4"},
+    std::pair{SDLK_F5, "F5"},
+    std::pair{SDLK_F6, "F6"},
+    std::pair{SDLK_F7, "F7"},
+    std::pair{SDLK_F8, "F8"},
+    std::pair{SDLK_F9, "F9"},
+    std::pair{SDLK_F10, "F10"},
+    std::pair{SDLK_F11, "F11"},
+    std::pair{SDLK_F12, "F12"},
+    std::pair{SDLK_LEFT, "Left"},
+    std::pair{SDLK_RIGHT, "Right"},
+    std::pair{SDLK_UP, "Up"},
+    std::pair{SDLK_DOWN, "Down"},
+    std::pair{SDLK_SPACE, "Space"},
+    std::pair{SDLK_RETURN, "Return"},
+    std::pair{SDLK_ESCAPE, "Escape"},
+    std::pair{SDLK_BACKSPACE, "Backspace"},
+    std::pair{SDLK_TAB, "Tab"},
+    std::pair{SDLK_CAPSLOCK, "CapsLock"},
+    std::pair{SDLK_LSHIFT, "Left Shift"},
+    std::pair{SDLK_RSHIFT, "Right Shift"},
+    std::pair{SDLK_LCTRL, "Left Ctrl"},
+    std::pair{SDLK_RCTRL, "Right Ctrl"},
+    std::pair{SDLK_LALT, "Left Alt"},
+    std::pair{SDLK_RALT, "Right Alt"},
+    std::pair{SDLK_LGUI, "Left GUI"},
+    std::pair{SDLK_RGUI, "Right GUI"}};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_KEY_NAMES_HEADER
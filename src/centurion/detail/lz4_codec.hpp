@@ -0,0 +1,326 @@
+#ifndef CENTURION_DETAIL_LZ4_CODEC_HEADER
+#define CENTURION_DETAIL_LZ4_CODEC_HEADER
+
+#include <cstring>   // memcpy
+#include <optional>  // optional, nullopt
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// See https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md
+inline constexpr u32 lz4_frame_magic = 0x184D2204;
+inline constexpr u32 lz4_skippable_magic = 0x184D2A50;  // Lower four bits are ignored
+inline constexpr u32 lz4_uncompressed_flag = 0x80000000;
+
+inline constexpr usize lz4_min_match = 4;
+inline constexpr usize lz4_last_literals = 5;  // The last bytes of a block are literals
+inline constexpr usize lz4_match_limit = 12;   // Matches start at least this far from the end
+inline constexpr usize lz4_max_offset = 65'535;
+inline constexpr int lz4_hash_log = 12;
+
+[[nodiscard]] inline auto load_u32(const u8* data) noexcept -> u32
+{
+  u32 value;
+  std::memcpy(&value, data, sizeof value);
+  return value;
+}
+
+[[nodiscard]] inline auto load_little_endian_u32(const u8* data) noexcept -> u32
+{
+  return static_cast<u32>(data[0]) | (static_cast<u32>(data[1]) << 8) |
+         (static_cast<u32>(data[2]) << 16) | (static_cast<u32>(data[3]) << 24);
+}
+
+inline void store_little_endian_u32(u8* data, const u32 value) noexcept
+{
+  data[0] = static_cast<u8>(value);
+  data[1] = static_cast<u8>(value >> 8);
+  data[2] = static_cast<u8>(value >> 16);
+  data[3] = static_cast<u8>(value >> 24);
+}
+
+[[nodiscard]] constexpr auto rotate_left(const u32 value, const int bits) noexcept -> u32
+{
+  return (value << bits) | (value >> (32 - bits));
+}
+
+// Incremental XXH32 with a zero seed, which is the checksum used by LZ4 frames
+class xxh32 final
+{
+ public:
+  void update(const u8* data, usize size) noexcept
+  {
+    m_total += size;
+
+    if (m_pending != 0) {
+      const auto amount = size < 16 - m_pending ? size : 16 - m_pending;
+      std::memcpy(m_stripe + m_pending, data, amount);
+
+      m_pending += amount;
+      data += amount;
+      size -= amount;
+
+      if (m_pending != 16) {
+        return;
+      }
+
+      consume(m_stripe);
+      m_pending = 0;
+    }
+
+    for (; size >= 16; data += 16, size -= 16) {
+      consume(data);
+    }
+
+    std::memcpy(m_stripe, data, size);
+    m_pending = size;
+  }
+
+  [[nodiscard]] auto digest() const noexcept -> u32
+  {
+    u32 hash = m_total >= 16 ? rotate_left(m_lanes[0], 1) + rotate_left(m_lanes[1], 7) +
+                                   rotate_left(m_lanes[2], 12) + rotate_left(m_lanes[3], 18)
+                             : prime5;
+    hash += static_cast<u32>(m_total);
+
+    usize index = 0;
+    for (; index + 4 <= m_pending; index += 4) {
+      hash += load_little_endian_u32(m_stripe + index) * prime3;
+      hash = rotate_left(hash, 17) * prime4;
+    }
+
+    for (; index < m_pending; ++index) {
+      hash += m_stripe[index] * prime5;
+      hash = rotate_left(hash, 11) * prime1;
+    }
+
+    hash ^= hash >> 15;
+    hash *= prime2;
+    hash ^= hash >> 13;
+    hash *= prime3;
+    hash ^= hash >> 16;
+
+    return hash;
+  }
+
+  [[nodiscard]] static auto of(const u8* data, const usize size) noexcept -> u32
+  {
+    xxh32 state;
+    state.update(data, size);
+    return state.digest();
+  }
+
+ private:
+  inline constexpr static u32 prime1 = 2'654'435'761u;
+  inline constexpr static u32 prime2 = 2'246'822'519u;
+  inline constexpr static u32 prime3 = 3'266'489'917u;
+  inline constexpr static u32 prime4 = 668'265'263u;
+  inline constexpr static u32 prime5 = 374'761'393u;
+
+  u32 m_lanes[4]{prime1 + prime2, prime2, 0, 0 - prime1};
+  u8 m_stripe[16]{};
+  usize m_pending{};
+  u64 m_total{};
+
+  void consume(const u8* stripe) noexcept
+  {
+    for (auto index = 0; index < 4; ++index) {
+      const auto lane = load_little_endian_u32(stripe + index * 4);
+      m_lanes[index] = rotate_left(m_lanes[index] + lane * prime2, 13) * prime1;
+    }
+  }
+};
+
+// Returns the maximum size of a compressed block
+[[nodiscard]] constexpr auto lz4_compress_bound(const usize size) noexcept -> usize
+{
+  return size + size / 255 + 16;
+}
+
+[[nodiscard]] inline auto lz4_write_length(u8* out, usize length) noexcept -> u8*
+{
+  for (; length >= 255; length -= 255) {
+    *out++ = 255;
+  }
+
+  *out++ = static_cast<u8>(length);
+  return out;
+}
+
+[[nodiscard]] inline auto lz4_write_literals(u8* out,
+                                             const u8* literals,
+                                             const usize length) noexcept -> u8*
+{
+  auto* token = out++;
+  *token = static_cast<u8>((length < 15 ? length : 15) << 4);
+
+  if (length >= 15) {
+    out = lz4_write_length(out, length - 15);
+  }
+
+  std::memcpy(out, literals, length);
+  return out + length;
+}
+
+/* Compresses a block of at most 64 KiB into the LZ4 block format, with a greedy single
+   probe hash table. The output must have room for lz4_compress_bound(size) bytes. The
+   table holds positions of previous blocks, which are harmless since candidates are
+   verified against the current block. */
+[[nodiscard]] inline auto lz4_compress(const u8* data,
+                                       const usize size,
+                                       u8* out,
+                                       u32* table) noexcept -> usize
+{
+  auto* next = out;
+  usize anchor = 0;
+
+  if (size > lz4_match_limit) {
+    const auto limit = size - lz4_match_limit;
+    const auto matchEnd = size - lz4_last_literals;
+
+    usize position = 0;
+    usize misses = 0;
+
+    while (position < limit) {
+      const auto sequence = load_u32(data + position);
+      const auto hash = (sequence * 2'654'435'761u) >> (32 - lz4_hash_log);
+
+      const usize candidate = table[hash];
+      table[hash] = static_cast<u32>(position);
+
+      if (candidate >= position || position - candidate > lz4_max_offset ||
+          load_u32(data + candidate) != sequence)
+      {
+        // Skip faster through incompressible data
+        position += 1 + (misses++ >> 6);
+        continue;
+      }
+
+      auto length = lz4_min_match;
+      while (position + length < matchEnd &&
+             data[candidate + length] == data[position + length])
+      {
+        ++length;
+      }
+
+      auto* token = next;
+      next = lz4_write_literals(next, data + anchor, position - anchor);
+
+      const auto offset = position - candidate;
+      *next++ = static_cast<u8>(offset);
+      *next++ = static_cast<u8>(offset >> 8);
+
+      const auto extra = length - lz4_min_match;
+      *token |= static_cast<u8>(extra < 15 ? extra : 15);
+      if (extra >= 15) {
+        next = lz4_write_length(next, extra - 15);
+      }
+
+      position += length;
+      anchor = position;
+      misses = 0;
+    }
+  }
+
+  next = lz4_write_literals(next, data + anchor, size - anchor);
+  return static_cast<usize>(next - out);
+}
+
+[[nodiscard]] inline auto lz4_read_length(const u8*& in, const u8* end, usize& length) noexcept
+    -> bool
+{
+  u8 byte;
+  do {
+    if (in == end) {
+      return false;
+    }
+
+    byte = *in++;
+    length += byte;
+  } while (byte == 255);
+
+  return true;
+}
+
+/* Decompresses an LZ4 block to base + offset, where the first offset bytes of the output
+   are the history that matches may refer to. Returns the decompressed size, or nothing if
+   the block is malformed or doesn't fit in the capacity. */
+[[nodiscard]] inline auto lz4_decompress(const u8* data,
+                                         const usize size,
+                                         u8* base,
+                                         const usize offset,
+                                         const usize capacity) noexcept -> std::optional<usize>
+{
+  const auto* in = data;
+  const auto* inEnd = data + size;
+
+  auto* out = base + offset;
+  auto* outEnd = base + capacity;
+
+  while (in != inEnd) {
+    const auto token = *in++;
+
+    usize literals = token >> 4;
+    if (literals == 15 && !lz4_read_length(in, inEnd, literals)) {
+      return std::nullopt;
+    }
+
+    if (literals > static_cast<usize>(inEnd - in) ||
+        literals > static_cast<usize>(outEnd - out))
+    {
+      return std::nullopt;
+    }
+
+    std::memcpy(out, in, literals);
+    in += literals;
+    out += literals;
+
+    // The last sequence only contains literals
+    if (in == inEnd) {
+      return static_cast<usize>(out - (base + offset));
+    }
+
+    if (inEnd - in < 2) {
+      return std::nullopt;
+    }
+
+    const auto distance = static_cast<usize>(in[0]) | (static_cast<usize>(in[1]) << 8);
+    in += 2;
+
+    usize length = token & 15u;
+    if (length == 15 && !lz4_read_length(in, inEnd, length)) {
+      return std::nullopt;
+    }
+
+    length += lz4_min_match;
+
+    if (distance == 0 || distance > static_cast<usize>(out - base) ||
+        length > static_cast<usize>(outEnd - out))
+    {
+      return std::nullopt;
+    }
+
+    const auto* match = out - distance;
+    if (distance >= length) {
+      std::memcpy(out, match, length);
+      out += length;
+    }
+    else {
+      // Overlapping matches repeat the most recent bytes
+      for (usize index = 0; index < length; ++index) {
+        *out++ = match[index];
+      }
+    }
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_LZ4_CODEC_HEADER
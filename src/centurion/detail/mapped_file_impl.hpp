@@ -0,0 +1,107 @@
+#ifndef CENTURION_DETAIL_MAPPED_FILE_IMPL_HEADER
+#define CENTURION_DETAIL_MAPPED_FILE_IMPL_HEADER
+
+#ifdef _WIN32
+#include "windows_include.hpp"
+#else
+#include <fcntl.h>     // open, O_RDONLY
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+#endif  // _WIN32
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../core/str.hpp"
+#include "../filesystem/mapped_file.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+#ifdef _WIN32
+
+CENTURION_LIB_INLINE auto map_file(const str path) noexcept -> mapped_view
+{
+  auto* handle = CreateFileA(path,
+                             GENERIC_READ,
+                             FILE_SHARE_READ,
+                             nullptr,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    return {};
+  }
+
+  LARGE_INTEGER size{};
+  if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+    CloseHandle(handle);
+    return {};
+  }
+
+  auto* mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(handle);
+
+  if (!mapping) {
+    return {};
+  }
+
+  // The view keeps the mapping alive, so the handle can be closed right away
+  auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+
+  if (view) {
+    return {static_cast<const u8*>(view), static_cast<usize>(size.QuadPart)};
+  }
+  else {
+    return {};
+  }
+}
+
+CENTURION_LIB_INLINE void unmap_file(const mapped_view view) noexcept
+{
+  UnmapViewOfFile(view.data);
+}
+
+#else
+
+CENTURION_LIB_INLINE auto map_file(const str path) noexcept -> mapped_view
+{
+  const auto descriptor = ::open(path, O_RDONLY);
+  if (descriptor == -1) {
+    return {};
+  }
+
+  struct stat info;
+  if (fstat(descriptor, &info) != 0 || info.st_size <= 0) {
+    ::close(descriptor);
+    return {};
+  }
+
+  const auto size = static_cast<usize>(info.st_size);
+
+  // The mapping stays valid after the descriptor has been closed
+  auto* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  ::close(descriptor);
+
+  if (view != MAP_FAILED) {
+    return {static_cast<const u8*>(view), size};
+  }
+  else {
+    return {};
+  }
+}
+
+CENTURION_LIB_INLINE void unmap_file(const mapped_view view) noexcept
+{
+  munmap(const_cast<u8*>(view.data), view.size);
+}
+
+#endif  // _WIN32
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_MAPPED_FILE_IMPL_HEADER
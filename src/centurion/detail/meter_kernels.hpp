@@ -0,0 +1,262 @@
+#ifndef CENTURION_DETAIL_METER_KERNELS_HEADER
+#define CENTURION_DETAIL_METER_KERNELS_HEADER
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include <cmath>  // fabs
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+inline constexpr float s16_scale = 1.0f / 32'768.0f;
+
+/* The kernels measure interleaved samples, and accumulate the peak amplitude and the sum of
+   squares of each channel, so that several buffers can be combined. */
+
+inline void measure_f32_scalar(const float* samples,
+                               const usize frames,
+                               const usize channels,
+                               float* peaks,
+                               float* power) noexcept
+{
+  for (usize frame = 0; frame < frames; ++frame) {
+    for (usize channel = 0; channel < channels; ++channel) {
+      const auto sample = samples[frame * channels + channel];
+      const auto amplitude = std::fabs(sample);
+
+      peaks[channel] = (amplitude > peaks[channel]) ? amplitude : peaks[channel];
+      power[channel] += sample * sample;
+    }
+  }
+}
+
+inline void measure_s16_scalar(const i16* samples,
+                               const usize frames,
+                               const usize channels,
+                               float* peaks,
+                               float* power) noexcept
+{
+  for (usize frame = 0; frame < frames; ++frame) {
+    for (usize channel = 0; channel < channels; ++channel) {
+      const auto sample = static_cast<float>(samples[frame * channels + channel]) * s16_scale;
+      const auto amplitude = std::fabs(sample);
+
+      peaks[channel] = (amplitude > peaks[channel]) ? amplitude : peaks[channel];
+      power[channel] += sample * sample;
+    }
+  }
+}
+
+// Lane i of the vector kernels holds channel i % channels, so the lanes are combined here
+inline void fold_meter_lanes(const float* lanePeaks,
+                             const float* lanePower,
+                             const usize channels,
+                             float* peaks,
+                             float* power) noexcept
+{
+  for (usize lane = 0; lane < 4; ++lane) {
+    const auto channel = lane % channels;
+
+    peaks[channel] = (lanePeaks[lane] > peaks[channel]) ? lanePeaks[lane] : peaks[channel];
+    power[channel] += lanePower[lane];
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+inline void measure_f32_sse2(const float* samples,
+                             const usize frames,
+                             const usize channels,
+                             float* peaks,
+                             float* power) noexcept
+{
+  const auto mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFF'FFFF));
+  const auto count = frames * channels;
+
+  auto peak = _mm_setzero_ps();
+  auto sum = _mm_setzero_ps();
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto sample = _mm_loadu_ps(samples + index);
+    peak = _mm_max_ps(peak, _mm_and_ps(sample, mask));
+    sum = _mm_add_ps(sum, _mm_mul_ps(sample, sample));
+  }
+
+  alignas(16) float lanePeaks[4];
+  alignas(16) float lanePower[4];
+  _mm_store_ps(lanePeaks, peak);
+  _mm_store_ps(lanePower, sum);
+
+  fold_meter_lanes(lanePeaks, lanePower, channels, peaks, power);
+  measure_f32_scalar(samples + index, (count - index) / channels, channels, peaks, power);
+}
+
+inline void measure_s16_sse2(const i16* samples,
+                             const usize frames,
+                             const usize channels,
+                             float* peaks,
+                             float* power) noexcept
+{
+  const auto mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFF'FFFF));
+  const auto scale = _mm_set1_ps(s16_scale);
+  const auto count = frames * channels;
+
+  auto peak = _mm_setzero_ps();
+  auto sum = _mm_setzero_ps();
+
+  // Both halves of a block start at a multiple of four, so they share the lane layout
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + index));
+    const auto low = _mm_srai_epi32(_mm_unpacklo_epi16(block, block), 16);
+    const auto high = _mm_srai_epi32(_mm_unpackhi_epi16(block, block), 16);
+
+    const auto first = _mm_mul_ps(_mm_cvtepi32_ps(low), scale);
+    const auto second = _mm_mul_ps(_mm_cvtepi32_ps(high), scale);
+
+    peak = _mm_max_ps(peak, _mm_max_ps(_mm_and_ps(first, mask), _mm_and_ps(second, mask)));
+    sum = _mm_add_ps(sum, _mm_add_ps(_mm_mul_ps(first, first), _mm_mul_ps(second, second)));
+  }
+
+  alignas(16) float lanePeaks[4];
+  alignas(16) float lanePower[4];
+  _mm_store_ps(lanePeaks, peak);
+  _mm_store_ps(lanePower, sum);
+
+  fold_meter_lanes(lanePeaks, lanePower, channels, peaks, power);
+  measure_s16_scalar(samples + index, (count - index) / channels, channels, peaks, power);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline void measure_f32_neon(const float* samples,
+                             const usize frames,
+                             const usize channels,
+                             float* peaks,
+                             float* power) noexcept
+{
+  const auto count = frames * channels;
+
+  auto peak = vdupq_n_f32(0.0f);
+  auto sum = vdupq_n_f32(0.0f);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto sample = vld1q_f32(samples + index);
+    peak = vmaxq_f32(peak, vabsq_f32(sample));
+    sum = vmlaq_f32(sum, sample, sample);
+  }
+
+  float lanePeaks[4];
+  float lanePower[4];
+  vst1q_f32(lanePeaks, peak);
+  vst1q_f32(lanePower, sum);
+
+  fold_meter_lanes(lanePeaks, lanePower, channels, peaks, power);
+  measure_f32_scalar(samples + index, (count - index) / channels, channels, peaks, power);
+}
+
+inline void measure_s16_neon(const i16* samples,
+                             const usize frames,
+                             const usize channels,
+                             float* peaks,
+                             float* power) noexcept
+{
+  const auto count = frames * channels;
+
+  auto peak = vdupq_n_f32(0.0f);
+  auto sum = vdupq_n_f32(0.0f);
+
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto block = vld1q_s16(samples + index);
+    const auto first = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(block))), s16_scale);
+    const auto second = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(block))), s16_scale);
+
+    peak = vmaxq_f32(peak, vmaxq_f32(vabsq_f32(first), vabsq_f32(second)));
+    sum = vmlaq_f32(vmlaq_f32(sum, first, first), second, second);
+  }
+
+  float lanePeaks[4];
+  float lanePower[4];
+  vst1q_f32(lanePeaks, peak);
+  vst1q_f32(lanePower, sum);
+
+  fold_meter_lanes(lanePeaks, lanePower, channels, peaks, power);
+  measure_s16_scalar(samples + index, (count - index) / channels, channels, peaks, power);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+// Measures floating-point samples, the vector kernels require a layout that fits four lanes
+inline void measure_f32(const float* samples,
+                        const usize frames,
+                        const usize channels,
+                        float* peaks,
+                        float* power) noexcept
+{
+  if (4 % channels == 0) {
+#if CENTURION_HAS_FEATURE_SSE2
+    if (cpu::has_sse2()) {
+      measure_f32_sse2(samples, frames, channels, peaks, power);
+      return;
+    }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+    if (cpu::has_neon()) {
+      measure_f32_neon(samples, frames, channels, peaks, power);
+      return;
+    }
+#endif  // CENTURION_HAS_FEATURE_NEON
+  }
+
+  measure_f32_scalar(samples, frames, channels, peaks, power);
+}
+
+// Measures 16-bit samples, normalized to the range [-1, 1)
+inline void measure_s16(const i16* samples,
+                        const usize frames,
+                        const usize channels,
+                        float* peaks,
+                        float* power) noexcept
+{
+  if (4 % channels == 0) {
+#if CENTURION_HAS_FEATURE_SSE2
+    if (cpu::has_sse2()) {
+      measure_s16_sse2(samples, frames, channels, peaks, power);
+      return;
+    }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+    if (cpu::has_neon()) {
+      measure_s16_neon(samples, frames, channels, peaks, power);
+      return;
+    }
+#endif  // CENTURION_HAS_FEATURE_NEON
+  }
+
+  measure_s16_scalar(samples, frames, channels, peaks, power);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_METER_KERNELS_HEADER
@@ -0,0 +1,378 @@
+#ifndef CENTURION_DETAIL_MIX_KERNELS_HEADER
+#define CENTURION_DETAIL_MIX_KERNELS_HEADER
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#if CENTURION_HAS_FEATURE_AVX2
+#include <immintrin.h>
+#endif  // CENTURION_HAS_FEATURE_AVX2
+
+#include <cmath>  // lrint
+
+#include "../core/integers.hpp"
+#include "../system/cpu_dispatch.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+[[nodiscard]] inline auto saturate_s16(const long value) noexcept -> i16
+{
+  return static_cast<i16>(value < -32'768 ? -32'768 : (value > 32'767 ? 32'767 : value));
+}
+
+[[nodiscard]] inline auto scale_s16(const i16 sample, const float gain) noexcept -> long
+{
+  return std::lrint(static_cast<float>(sample) * gain);
+}
+
+inline void gain_s16_scalar(i16* samples, const int count, const float gain) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    samples[index] = saturate_s16(scale_s16(samples[index], gain));
+  }
+}
+
+inline void mix_s16_scalar(i16* target,
+                           const i16* source,
+                           const int count,
+                           const float gain) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    const auto scaled = saturate_s16(scale_s16(source[index], gain));
+    target[index] = saturate_s16(static_cast<long>(target[index]) + scaled);
+  }
+}
+
+inline void gain_f32_scalar(float* samples, const int count, const float gain) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    samples[index] *= gain;
+  }
+}
+
+inline void mix_f32_scalar(float* target,
+                           const float* source,
+                           const int count,
+                           const float gain) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    target[index] += source[index] * gain;
+  }
+}
+
+inline void clamp_f32_scalar(float* samples, const int count) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    const auto sample = samples[index];
+    samples[index] = sample < -1.0f ? -1.0f : (sample > 1.0f ? 1.0f : sample);
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+// Scales eight samples, the results saturate when they are packed back to 16 bits
+[[nodiscard]] inline auto scale_s16_sse2(const __m128i samples, const __m128 gain) noexcept
+    -> __m128i
+{
+  const auto low = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+  const auto high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+
+  const auto scaledLow = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(low), gain));
+  const auto scaledHigh = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(high), gain));
+
+  return _mm_packs_epi32(scaledLow, scaledHigh);
+}
+
+inline void gain_s16_sse2(i16* samples, const int count, const float gain) noexcept
+{
+  const auto factor = _mm_set1_ps(gain);
+
+  auto index = 0;
+  for (; index + 8 <= count; index += 8) {
+    auto* block = reinterpret_cast<__m128i*>(samples + index);
+    _mm_storeu_si128(block, scale_s16_sse2(_mm_loadu_si128(block), factor));
+  }
+
+  gain_s16_scalar(samples + index, count - index, gain);
+}
+
+inline void mix_s16_sse2(i16* target,
+                         const i16* source,
+                         const int count,
+                         const float gain) noexcept
+{
+  const auto factor = _mm_set1_ps(gain);
+
+  auto index = 0;
+  for (; index + 8 <= count; index += 8) {
+    auto* block = reinterpret_cast<__m128i*>(target + index);
+    const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+
+    const auto scaled = scale_s16_sse2(input, factor);
+    _mm_storeu_si128(block, _mm_adds_epi16(_mm_loadu_si128(block), scaled));
+  }
+
+  mix_s16_scalar(target + index, source + index, count - index, gain);
+}
+
+inline void gain_f32_sse2(float* samples, const int count, const float gain) noexcept
+{
+  const auto factor = _mm_set1_ps(gain);
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    _mm_storeu_ps(samples + index, _mm_mul_ps(_mm_loadu_ps(samples + index), factor));
+  }
+
+  gain_f32_scalar(samples + index, count - index, gain);
+}
+
+inline void mix_f32_sse2(float* target,
+                         const float* source,
+                         const int count,
+                         const float gain) noexcept
+{
+  const auto factor = _mm_set1_ps(gain);
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto scaled = _mm_mul_ps(_mm_loadu_ps(source + index), factor);
+    _mm_storeu_ps(target + index, _mm_add_ps(_mm_loadu_ps(target + index), scaled));
+  }
+
+  mix_f32_scalar(target + index, source + index, count - index, gain);
+}
+
+inline void clamp_f32_sse2(float* samples, const int count) noexcept
+{
+  const auto lower = _mm_set1_ps(-1.0f);
+  const auto upper = _mm_set1_ps(1.0f);
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto sample = _mm_loadu_ps(samples + index);
+    _mm_storeu_ps(samples + index, _mm_min_ps(_mm_max_ps(sample, lower), upper));
+  }
+
+  clamp_f32_scalar(samples + index, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+// Rounds to nearest even, like lrint and the SSE2 conversion
+[[nodiscard]] inline auto round_f32_neon(const float32x4_t values) noexcept -> int32x4_t
+{
+#if defined(__aarch64__)
+  return vcvtnq_s32_f32(values);
+#else
+  // ARMv7 lacks a round-to-nearest conversion, but adding and subtracting 1.5 * 2^23 rounds
+  // to nearest even. Larger values are inexact, but saturate when narrowed to 16 bits.
+  const auto magic = vdupq_n_f32(12'582'912.0f);
+  return vcvtq_s32_f32(vsubq_f32(vaddq_f32(values, magic), magic));
+#endif  // defined(__aarch64__)
+}
+
+// Scales eight samples, the results saturate when they are narrowed to 16 bits
+[[nodiscard]] inline auto scale_s16_neon(const int16x8_t samples, const float gain) noexcept
+    -> int16x8_t
+{
+  const auto low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples)));
+  const auto high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples)));
+
+  const auto roundedLow = round_f32_neon(vmulq_n_f32(low, gain));
+  const auto roundedHigh = round_f32_neon(vmulq_n_f32(high, gain));
+
+  return vcombine_s16(vqmovn_s32(roundedLow), vqmovn_s32(roundedHigh));
+}
+
+inline void gain_s16_neon(i16* samples, const int count, const float gain) noexcept
+{
+  auto index = 0;
+  for (; index + 8 <= count; index += 8) {
+    vst1q_s16(samples + index, scale_s16_neon(vld1q_s16(samples + index), gain));
+  }
+
+  gain_s16_scalar(samples + index, count - index, gain);
+}
+
+inline void mix_s16_neon(i16* target,
+                         const i16* source,
+                         const int count,
+                         const float gain) noexcept
+{
+  auto index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto scaled = scale_s16_neon(vld1q_s16(source + index), gain);
+    vst1q_s16(target + index, vqaddq_s16(vld1q_s16(target + index), scaled));
+  }
+
+  mix_s16_scalar(target + index, source + index, count - index, gain);
+}
+
+inline void gain_f32_neon(float* samples, const int count, const float gain) noexcept
+{
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(samples + index, vmulq_n_f32(vld1q_f32(samples + index), gain));
+  }
+
+  gain_f32_scalar(samples + index, count - index, gain);
+}
+
+inline void mix_f32_neon(float* target,
+                         const float* source,
+                         const int count,
+                         const float gain) noexcept
+{
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto input = vld1q_f32(source + index);
+    vst1q_f32(target + index, vmlaq_n_f32(vld1q_f32(target + index), input, gain));
+  }
+
+  mix_f32_scalar(target + index, source + index, count - index, gain);
+}
+
+inline void clamp_f32_neon(float* samples, const int count) noexcept
+{
+  const auto lower = vdupq_n_f32(-1.0f);
+  const auto upper = vdupq_n_f32(1.0f);
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto sample = vld1q_f32(samples + index);
+    vst1q_f32(samples + index, vminq_f32(vmaxq_f32(sample, lower), upper));
+  }
+
+  clamp_f32_scalar(samples + index, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#if CENTURION_HAS_FEATURE_AVX2
+
+// The floating-point kernels process eight samples at a time, the others stay at SSE2
+CENTURION_TARGET_AVX2 inline void gain_f32_avx2(float* samples,
+                                                const int count,
+                                                const float gain) noexcept
+{
+  const auto factor = _mm256_set1_ps(gain);
+
+  auto index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto sample = _mm256_loadu_ps(samples + index);
+    _mm256_storeu_ps(samples + index, _mm256_mul_ps(sample, factor));
+  }
+
+  gain_f32_scalar(samples + index, count - index, gain);
+}
+
+CENTURION_TARGET_AVX2 inline void mix_f32_avx2(float* target,
+                                               const float* source,
+                                               const int count,
+                                               const float gain) noexcept
+{
+  const auto factor = _mm256_set1_ps(gain);
+
+  auto index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto scaled = _mm256_mul_ps(_mm256_loadu_ps(source + index), factor);
+    _mm256_storeu_ps(target + index, _mm256_add_ps(_mm256_loadu_ps(target + index), scaled));
+  }
+
+  mix_f32_scalar(target + index, source + index, count - index, gain);
+}
+
+CENTURION_TARGET_AVX2 inline void clamp_f32_avx2(float* samples, const int count) noexcept
+{
+  const auto lower = _mm256_set1_ps(-1.0f);
+  const auto upper = _mm256_set1_ps(1.0f);
+
+  auto index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto sample = _mm256_loadu_ps(samples + index);
+    _mm256_storeu_ps(samples + index, _mm256_min_ps(_mm256_max_ps(sample, lower), upper));
+  }
+
+  clamp_f32_scalar(samples + index, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_AVX2
+
+inline kernel_table<void(i16*, int, float)> gain_s16_kernels{
+    gain_s16_scalar,
+    CENTURION_SSE2_KERNEL(gain_s16_sse2),
+    CENTURION_NEON_KERNEL(gain_s16_neon)};
+
+inline kernel_table<void(i16*, const i16*, int, float)> mix_s16_kernels{
+    mix_s16_scalar,
+    CENTURION_SSE2_KERNEL(mix_s16_sse2),
+    CENTURION_NEON_KERNEL(mix_s16_neon)};
+
+inline kernel_table<void(float*, int, float)> gain_f32_kernels{
+    gain_f32_scalar,
+    CENTURION_SSE2_KERNEL(gain_f32_sse2),
+    CENTURION_NEON_KERNEL(gain_f32_neon),
+    CENTURION_AVX2_KERNEL(gain_f32_avx2)};
+
+inline kernel_table<void(float*, const float*, int, float)> mix_f32_kernels{
+    mix_f32_scalar,
+    CENTURION_SSE2_KERNEL(mix_f32_sse2),
+    CENTURION_NEON_KERNEL(mix_f32_neon),
+    CENTURION_AVX2_KERNEL(mix_f32_avx2)};
+
+inline kernel_table<void(float*, int)> clamp_f32_kernels{
+    clamp_f32_scalar,
+    CENTURION_SSE2_KERNEL(clamp_f32_sse2),
+    CENTURION_NEON_KERNEL(clamp_f32_neon),
+    CENTURION_AVX2_KERNEL(clamp_f32_avx2)};
+
+// Scales 16-bit samples, saturating the results
+inline void gain_s16(i16* samples, const int count, const float gain) noexcept
+{
+  gain_s16_kernels(samples, count, gain);
+}
+
+// Adds scaled 16-bit samples to a buffer, saturating the results
+inline void mix_s16(i16* target, const i16* source, const int count, const float gain) noexcept
+{
+  mix_s16_kernels(target, source, count, gain);
+}
+
+// Scales floating-point samples
+inline void gain_f32(float* samples, const int count, const float gain) noexcept
+{
+  gain_f32_kernels(samples, count, gain);
+}
+
+// Adds scaled floating-point samples to a buffer
+inline void mix_f32(float* target,
+                    const float* source,
+                    const int count,
+                    const float gain) noexcept
+{
+  mix_f32_kernels(target, source, count, gain);
+}
+
+// Clamps floating-point samples to [-1, 1]
+inline void clamp_f32(float* samples, const int count) noexcept
+{
+  clamp_f32_kernels(samples, count);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_MIX_KERNELS_HEADER
@@ -6,13 +6,11 @@
 #include <type_traits>  // enable_if_t, is_same_v, true_type, false_type
 
 #include "../core/exception.hpp"
+#include "ownership_tags.hpp"
 
 /// \cond FALSE
 namespace cen::detail {
 
-using owning_type = std::true_type;
-using handle_type = std::false_type;
-
 template <typename T>
 using is_owner = std::enable_if_t<std::is_same_v<T, owning_type>, int>;
 
@@ -0,0 +1,15 @@
+#ifndef CENTURION_DETAIL_OWNERSHIP_TAGS_HEADER
+#define CENTURION_DETAIL_OWNERSHIP_TAGS_HEADER
+
+#include <type_traits>  // true_type, false_type
+
+/// \cond FALSE
+namespace cen::detail {
+
+using owning_type = std::true_type;
+using handle_type = std::false_type;
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_OWNERSHIP_TAGS_HEADER
@@ -0,0 +1,265 @@
+#ifndef CENTURION_DETAIL_PARTICLE_KERNELS_HEADER
+#define CENTURION_DETAIL_PARTICLE_KERNELS_HEADER
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include "../core/integers.hpp"
+#include "../system/cpu_dispatch.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// The vectorized kernels perform the same operations in the same order as the scalar
+// kernels, without fused multiply-adds, so that all kernels produce identical results
+
+// Updates one axis, velocity = velocity * damping + acceleration * dt and then
+// position = position + velocity * dt
+inline void integrate_particles_scalar(float* positions,
+                                       float* velocities,
+                                       const usize count,
+                                       const float acceleration,
+                                       const float damping,
+                                       const float dt) noexcept
+{
+  const auto dv = acceleration * dt;
+  for (usize index = 0; index < count; ++index) {
+    const auto velocity = (velocities[index] * damping) + dv;
+    velocities[index] = velocity;
+    positions[index] += velocity * dt;
+  }
+}
+
+// Advances the ages, and computes the progress as age / lifetime, clamped to at most 1
+inline void age_particles_scalar(float* ages,
+                                 const float* inverseLifetimes,
+                                 float* progress,
+                                 const usize count,
+                                 const float dt) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    const auto age = ages[index] + dt;
+    const auto value = age * inverseLifetimes[index];
+
+    ages[index] = age;
+    progress[index] = (value < 1.0f) ? value : 1.0f;
+  }
+}
+
+// Computes out = start + (end - start) * t
+inline void lerp_particles_scalar(float* out,
+                                  const float* t,
+                                  const usize count,
+                                  const float start,
+                                  const float end) noexcept
+{
+  const auto delta = end - start;
+  for (usize index = 0; index < count; ++index) {
+    out[index] = start + (delta * t[index]);
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+inline void integrate_particles_sse2(float* positions,
+                                     float* velocities,
+                                     const usize count,
+                                     const float acceleration,
+                                     const float damping,
+                                     const float dt) noexcept
+{
+  const auto dv = _mm_set1_ps(acceleration * dt);
+  const auto drag = _mm_set1_ps(damping);
+  const auto step = _mm_set1_ps(dt);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto velocity = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(velocities + index), drag), dv);
+    const auto position = _mm_loadu_ps(positions + index);
+
+    _mm_storeu_ps(velocities + index, velocity);
+    _mm_storeu_ps(positions + index, _mm_add_ps(position, _mm_mul_ps(velocity, step)));
+  }
+
+  integrate_particles_scalar(positions + index,
+                             velocities + index,
+                             count - index,
+                             acceleration,
+                             damping,
+                             dt);
+}
+
+inline void age_particles_sse2(float* ages,
+                               const float* inverseLifetimes,
+                               float* progress,
+                               const usize count,
+                               const float dt) noexcept
+{
+  const auto step = _mm_set1_ps(dt);
+  const auto one = _mm_set1_ps(1.0f);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto age = _mm_add_ps(_mm_loadu_ps(ages + index), step);
+    const auto value = _mm_mul_ps(age, _mm_loadu_ps(inverseLifetimes + index));
+
+    _mm_storeu_ps(ages + index, age);
+    _mm_storeu_ps(progress + index, _mm_min_ps(value, one));
+  }
+
+  age_particles_scalar(ages + index,
+                       inverseLifetimes + index,
+                       progress + index,
+                       count - index,
+                       dt);
+}
+
+inline void lerp_particles_sse2(float* out,
+                                const float* t,
+                                const usize count,
+                                const float start,
+                                const float end) noexcept
+{
+  const auto from = _mm_set1_ps(start);
+  const auto delta = _mm_set1_ps(end - start);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    _mm_storeu_ps(out + index, _mm_add_ps(from, _mm_mul_ps(delta, _mm_loadu_ps(t + index))));
+  }
+
+  lerp_particles_scalar(out + index, t + index, count - index, start, end);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline void integrate_particles_neon(float* positions,
+                                     float* velocities,
+                                     const usize count,
+                                     const float acceleration,
+                                     const float damping,
+                                     const float dt) noexcept
+{
+  const auto dv = vdupq_n_f32(acceleration * dt);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto velocity = vaddq_f32(vmulq_n_f32(vld1q_f32(velocities + index), damping), dv);
+    const auto position = vld1q_f32(positions + index);
+
+    vst1q_f32(velocities + index, velocity);
+    vst1q_f32(positions + index, vaddq_f32(position, vmulq_n_f32(velocity, dt)));
+  }
+
+  integrate_particles_scalar(positions + index,
+                             velocities + index,
+                             count - index,
+                             acceleration,
+                             damping,
+                             dt);
+}
+
+inline void age_particles_neon(float* ages,
+                               const float* inverseLifetimes,
+                               float* progress,
+                               const usize count,
+                               const float dt) noexcept
+{
+  const auto step = vdupq_n_f32(dt);
+  const auto one = vdupq_n_f32(1.0f);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto age = vaddq_f32(vld1q_f32(ages + index), step);
+    const auto value = vmulq_f32(age, vld1q_f32(inverseLifetimes + index));
+
+    vst1q_f32(ages + index, age);
+    vst1q_f32(progress + index, vminq_f32(value, one));
+  }
+
+  age_particles_scalar(ages + index,
+                       inverseLifetimes + index,
+                       progress + index,
+                       count - index,
+                       dt);
+}
+
+inline void lerp_particles_neon(float* out,
+                                const float* t,
+                                const usize count,
+                                const float start,
+                                const float end) noexcept
+{
+  const auto from = vdupq_n_f32(start);
+  const auto delta = end - start;
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(out + index, vaddq_f32(from, vmulq_n_f32(vld1q_f32(t + index), delta)));
+  }
+
+  lerp_particles_scalar(out + index, t + index, count - index, start, end);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+using integrate_particles_kernel = void(float*, float*, usize, float, float, float);
+
+inline kernel_table<integrate_particles_kernel> integrate_particles_kernels{
+    integrate_particles_scalar,
+    CENTURION_SSE2_KERNEL(integrate_particles_sse2),
+    CENTURION_NEON_KERNEL(integrate_particles_neon)};
+
+inline void integrate_particles(float* positions,
+                                float* velocities,
+                                const usize count,
+                                const float acceleration,
+                                const float damping,
+                                const float dt) noexcept
+{
+  integrate_particles_kernels(positions, velocities, count, acceleration, damping, dt);
+}
+
+inline kernel_table<void(float*, const float*, float*, usize, float)> age_particles_kernels{
+    age_particles_scalar,
+    CENTURION_SSE2_KERNEL(age_particles_sse2),
+    CENTURION_NEON_KERNEL(age_particles_neon)};
+
+inline void age_particles(float* ages,
+                          const float* inverseLifetimes,
+                          float* progress,
+                          const usize count,
+                          const float dt) noexcept
+{
+  age_particles_kernels(ages, inverseLifetimes, progress, count, dt);
+}
+
+inline kernel_table<void(float*, const float*, usize, float, float)> lerp_particles_kernels{
+    lerp_particles_scalar,
+    CENTURION_SSE2_KERNEL(lerp_particles_sse2),
+    CENTURION_NEON_KERNEL(lerp_particles_neon)};
+
+inline void lerp_particles(float* out,
+                           const float* t,
+                           const usize count,
+                           const float start,
+                           const float end) noexcept
+{
+  lerp_particles_kernels(out, t, count, start, end);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_PARTICLE_KERNELS_HEADER
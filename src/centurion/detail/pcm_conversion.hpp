@@ -0,0 +1,230 @@
+#ifndef CENTURION_DETAIL_PCM_CONVERSION_HEADER
+#define CENTURION_DETAIL_PCM_CONVERSION_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // fill, copy
+#include <cmath>      // lrint
+#include <cstring>    // memcpy
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "resample_kernels.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+struct pcm_format final
+{
+  int rate{};
+  u16 format{};
+  int channels{};
+
+  [[nodiscard]] auto frame_size() const noexcept -> usize
+  {
+    return static_cast<usize>(SDL_AUDIO_BITSIZE(format) / 8) * static_cast<usize>(channels);
+  }
+
+  [[nodiscard]] auto operator==(const pcm_format& other) const noexcept -> bool
+  {
+    return rate == other.rate && format == other.format && channels == other.channels;
+  }
+};
+
+[[nodiscard]] inline auto is_convertible(const pcm_format& format) noexcept -> bool
+{
+  const auto bits = SDL_AUDIO_BITSIZE(format.format);
+  const auto valid = SDL_AUDIO_ISFLOAT(format.format)
+                         ? (bits == 32)
+                         : (bits == 8 || bits == 16 || bits == 32);
+  return valid && format.rate > 0 && format.channels > 0;
+}
+
+[[nodiscard]] inline auto resampled_frames(const usize frames,
+                                           const int sourceRate,
+                                           const int targetRate) noexcept -> usize
+{
+  return static_cast<usize>(static_cast<u64>(frames) * static_cast<u64>(targetRate) /
+                            static_cast<u64>(sourceRate));
+}
+
+[[nodiscard]] inline auto read_bits(const u8* data, const usize bytes, const bool big) noexcept
+    -> u32
+{
+  u32 value = 0;
+  for (usize index = 0; index < bytes; ++index) {
+    const auto byte = big ? data[index] : data[bytes - 1 - index];
+    value = (value << 8) | byte;
+  }
+
+  return value;
+}
+
+inline void write_bits(u8* data, const usize bytes, const bool big, u32 value) noexcept
+{
+  for (usize index = 0; index < bytes; ++index) {
+    data[big ? bytes - 1 - index : index] = static_cast<u8>(value & 0xFFu);
+    value >>= 8;
+  }
+}
+
+// Decodes interleaved samples of any supported format to floating-point samples
+inline void decode_pcm(const u8* source, const u16 format, float* target, const usize count)
+{
+  if (format == AUDIO_S16SYS) {
+    s16_to_f32(reinterpret_cast<const i16*>(source), target, count);
+    return;
+  }
+  else if (format == AUDIO_F32SYS) {
+    std::memcpy(target, source, count * sizeof(float));
+    return;
+  }
+
+  const auto bytes = static_cast<usize>(SDL_AUDIO_BITSIZE(format) / 8);
+  const auto big = SDL_AUDIO_ISBIGENDIAN(format) != 0;
+  const auto isSigned = SDL_AUDIO_ISSIGNED(format) != 0;
+  const auto isFloat = SDL_AUDIO_ISFLOAT(format) != 0;
+  const auto scale = 1.0 / static_cast<double>(u64{1} << (bytes * 8 - 1));
+
+  for (usize index = 0; index < count; ++index) {
+    auto bits = read_bits(source + index * bytes, bytes, big);
+
+    if (isFloat) {
+      float value{};
+      std::memcpy(&value, &bits, sizeof value);
+      target[index] = value;
+    }
+    else {
+      // Unsigned samples are offset by half of the range
+      const auto shift = static_cast<u32>(32 - bytes * 8);
+      if (!isSigned) {
+        bits ^= u32{1} << (bytes * 8 - 1);
+      }
+
+      const auto value = static_cast<i32>(bits << shift) >> shift;
+      target[index] = static_cast<float>(static_cast<double>(value) * scale);
+    }
+  }
+}
+
+// Encodes floating-point samples to interleaved samples of any supported format
+inline void encode_pcm(const float* source, const u16 format, u8* target, const usize count)
+{
+  if (format == AUDIO_S16SYS) {
+    f32_to_s16(source, reinterpret_cast<i16*>(target), count);
+    return;
+  }
+  else if (format == AUDIO_F32SYS) {
+    std::memcpy(target, source, count * sizeof(float));
+    return;
+  }
+
+  const auto bytes = static_cast<usize>(SDL_AUDIO_BITSIZE(format) / 8);
+  const auto big = SDL_AUDIO_ISBIGENDIAN(format) != 0;
+  const auto isSigned = SDL_AUDIO_ISSIGNED(format) != 0;
+  const auto isFloat = SDL_AUDIO_ISFLOAT(format) != 0;
+
+  const auto range = static_cast<double>(u64{1} << (bytes * 8 - 1));
+  const auto max = range - 1.0;
+
+  for (usize index = 0; index < count; ++index) {
+    u32 bits{};
+
+    if (isFloat) {
+      std::memcpy(&bits, source + index, sizeof bits);
+    }
+    else {
+      const auto scaled = static_cast<double>(source[index]) * range;
+      const auto clamped = scaled < -range ? -range : (scaled > max ? max : scaled);
+
+      bits = static_cast<u32>(static_cast<i32>(std::lrint(clamped)));
+      if (!isSigned) {
+        bits ^= u32{1} << (bytes * 8 - 1);
+      }
+    }
+
+    write_bits(target + index * bytes, bytes, big, bits);
+  }
+}
+
+/**
+ * Converts interleaved PCM data between formats, sample rates and channel layouts.
+ *
+ * Mono sources are copied to all target channels, and multichannel sources are averaged
+ * for mono targets. Otherwise, channels are matched by index, and additional target
+ * channels are silent. The sample rate is converted with the filter, or with linear
+ * interpolation if there is no filter.
+ *
+ * The target buffer must provide room for `targetFrames` frames, as obtained with
+ * `resampled_frames()`.
+ */
+inline void convert_pcm(const u8* source,
+                        const usize frames,
+                        const pcm_format& from,
+                        u8* target,
+                        const usize targetFrames,
+                        const pcm_format& to,
+                        const sinc_filter* filter)
+{
+  const auto inChannels = static_cast<usize>(from.channels);
+  const auto outChannels = static_cast<usize>(to.channels);
+
+  std::vector<float> decoded(frames * inChannels);
+  decode_pcm(source, from.format, decoded.data(), decoded.size());
+
+  // Zero padding on both sides of the channel, so that the filters don't need bounds checks
+  const auto padding = filter ? filter->taps() / 2 : usize{1};
+  std::vector<float> plane(padding + frames + padding + 1, 0.0f);
+  std::vector<float> resampled(targetFrames);
+  std::vector<float> output(targetFrames * outChannels);
+
+  for (usize channel = 0; channel < outChannels; ++channel) {
+    auto* samples = plane.data() + padding;
+
+    if (outChannels == 1 && inChannels > 1) {
+      for (usize frame = 0; frame < frames; ++frame) {
+        auto sum = 0.0f;
+        for (usize input = 0; input < inChannels; ++input) {
+          sum += decoded[frame * inChannels + input];
+        }
+
+        samples[frame] = sum / static_cast<float>(inChannels);
+      }
+    }
+    else if (inChannels == 1 || channel < inChannels) {
+      const auto input = (inChannels == 1) ? usize{0} : channel;
+      for (usize frame = 0; frame < frames; ++frame) {
+        samples[frame] = decoded[frame * inChannels + input];
+      }
+    }
+    else {
+      std::fill(samples, samples + frames, 0.0f);
+    }
+
+    const auto sourceRate = static_cast<u64>(from.rate);
+    const auto targetRate = static_cast<u64>(to.rate);
+
+    if (sourceRate == targetRate) {
+      std::copy(samples, samples + targetFrames, resampled.begin());
+    }
+    else if (filter) {
+      resample_sinc(*filter, samples, resampled.data(), targetFrames, sourceRate, targetRate);
+    }
+    else {
+      resample_linear(samples, resampled.data(), targetFrames, sourceRate, targetRate);
+    }
+
+    for (usize frame = 0; frame < targetFrames; ++frame) {
+      output[frame * outChannels + channel] = resampled[frame];
+    }
+  }
+
+  encode_pcm(output.data(), to.format, target, output.size());
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_PCM_CONVERSION_HEADER
@@ -0,0 +1,304 @@
+#ifndef CENTURION_DETAIL_PERFECT_HASH_MAP_HEADER
+#define CENTURION_DETAIL_PERFECT_HASH_MAP_HEADER
+
+#include <array>        // array
+#include <string_view>  // string_view
+#include <type_traits>  // is_enum_v
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/str.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+[[nodiscard]] constexpr auto to_lower_ascii(const char c) noexcept -> char
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// Case-insensitive FNV-1a, with a final avalanche since the low bits are used as indices
+[[nodiscard]] constexpr auto hash_name(const std::string_view name, const u32 seed) noexcept
+    -> u32
+{
+  u32 hash = 2'166'136'261u ^ (seed * 16'777'619u);
+
+  for (const auto c : name) {
+    hash ^= static_cast<unsigned char>(to_lower_ascii(c));
+    hash *= 16'777'619u;
+  }
+
+  hash ^= hash >> 15u;
+  hash *= 0x2C1B'3C6Du;
+  hash ^= hash >> 12u;
+
+  return hash;
+}
+
+[[nodiscard]] constexpr auto equal_names(const std::string_view lhs,
+                                         const std::string_view rhs) noexcept -> bool
+{
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+
+  for (usize index = 0; index < lhs.size(); ++index) {
+    if (to_lower_ascii(lhs[index]) != to_lower_ascii(rhs[index])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+[[nodiscard]] constexpr auto next_power_of_two(const usize value) noexcept -> usize
+{
+  usize result = 1;
+  while (result < value) {
+    result *= 2;
+  }
+  return result;
+}
+
+/**
+ * \class perfect_hash_map
+ *
+ * \brief A bidirectional map between enumerators and case-insensitive names, with a
+ * perfect hash that is computed at compile-time.
+ *
+ * \details The names are first hashed into `Size` buckets. Each bucket then stores either
+ * the slot of its only name, or the seed of a second hash that places all of its names in
+ * distinct slots, which are found with the "hash and displace" approach. As such, a name
+ * is found with two hashes and a single comparison, regardless of the size of the map.
+ * Enumerators are looked up with a binary search over an array sorted at compile-time.
+ *
+ * \note This class is only meant to be used in constexpr contexts.
+ *
+ * \tparam Key the enum type of the keys.
+ * \tparam Size the amount of key-name pairs.
+ *
+ * \see `static_string_map`
+ *
+ * \since 6.4.0
+ */
+template <typename Key, usize Size>
+class perfect_hash_map final
+{
+  static_assert(std::is_enum_v<Key>);
+  static_assert(Size > 0);
+
+ public:
+  template <typename... Pairs>
+  constexpr perfect_hash_map(const Pairs&... pairs)  // NOLINT implicit
+      : m_keys{pairs.first...}
+      , m_names{std::string_view{pairs.second}...}
+  {
+    static_assert(sizeof...(Pairs) == Size);
+
+    for (usize i = 0; i < Size; ++i) {
+      if (m_names[i].empty()) {
+        throw cen_error{"Perfect hash map names cannot be empty!"};
+      }
+
+      for (usize j = 0; j < i; ++j) {
+        if (equal_names(m_names[i], m_names[j])) {
+          throw cen_error{"Perfect hash map names must be unique!"};
+        }
+      }
+    }
+
+    build_table();
+    sort_keys();
+  }
+
+  [[nodiscard]] constexpr auto find(const std::string_view name) const noexcept -> const Key*
+  {
+    const auto displacement = m_displacements[bucket_of(name)];
+    if (displacement == 0) {
+      return nullptr;
+    }
+
+    const auto slot = (displacement < 0) ? static_cast<usize>(-displacement - 1)
+                                         : slot_of(name, static_cast<u32>(displacement));
+
+    const auto index = m_slots[slot];
+    if (index != Size && equal_names(name, m_names[index])) {
+      return &m_keys[index];
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] constexpr auto name_of(const Key key) const noexcept -> std::string_view
+  {
+    const auto value = static_cast<i64>(key);
+
+    usize first = 0;
+    usize last = Size;
+
+    while (first < last) {
+      const auto middle = first + (last - first) / 2;
+      const auto index = m_order[middle];
+      const auto current = static_cast<i64>(m_keys[index]);
+
+      if (current == value) {
+        return m_names[index];
+      }
+      else if (value < current) {
+        last = middle;
+      }
+      else {
+        first = middle + 1;
+      }
+    }
+
+    return {};
+  }
+
+  [[nodiscard]] constexpr static auto size() noexcept -> usize
+  {
+    return Size;
+  }
+
+ private:
+  inline constexpr static usize slot_count = next_power_of_two(Size * 2);
+  inline constexpr static u32 max_seed = 10'000;
+
+  std::array<Key, Size> m_keys{};
+  std::array<std::string_view, Size> m_names{};
+  std::array<i32, Size> m_displacements{};  ///< Per bucket, 0 if empty, < 0 for a direct slot.
+  std::array<usize, slot_count> m_slots{};  ///< Indices of the names, Size if unused.
+  std::array<usize, Size> m_order{};        ///< Indices of the keys, sorted by key.
+
+  [[nodiscard]] constexpr static auto bucket_of(const std::string_view name) noexcept
+      -> usize
+  {
+    return hash_name(name, 0) % Size;
+  }
+
+  [[nodiscard]] constexpr static auto slot_of(const std::string_view name,
+                                              const u32 seed) noexcept -> usize
+  {
+    return hash_name(name, seed) & (slot_count - 1);
+  }
+
+  constexpr void build_table()
+  {
+    std::array<usize, Size> buckets{};
+    std::array<usize, Size> bucketSizes{};
+
+    for (usize index = 0; index < Size; ++index) {
+      buckets[index] = bucket_of(m_names[index]);
+      ++bucketSizes[buckets[index]];
+    }
+
+    // Largest buckets first, since they are the hardest to place
+    std::array<usize, Size> order{};
+    for (usize index = 0; index < Size; ++index) {
+      order[index] = index;
+    }
+
+    for (usize i = 1; i < Size; ++i) {
+      for (usize j = i; j > 0 && bucketSizes[order[j]] > bucketSizes[order[j - 1]]; --j) {
+        const auto tmp = order[j];
+        order[j] = order[j - 1];
+        order[j - 1] = tmp;
+      }
+    }
+
+    for (auto& slot : m_slots) {
+      slot = Size;
+    }
+
+    for (const auto bucket : order) {
+      if (bucketSizes[bucket] == 0) {
+        break;
+      }
+      else if (bucketSizes[bucket] == 1) {
+        place_single(bucket, buckets);
+      }
+      else {
+        place_multiple(bucket, buckets);
+      }
+    }
+  }
+
+  constexpr void place_single(const usize bucket, const std::array<usize, Size>& buckets)
+  {
+    usize slot = 0;
+    while (m_slots[slot] != Size) {
+      ++slot;
+    }
+
+    for (usize index = 0; index < Size; ++index) {
+      if (buckets[index] == bucket) {
+        m_slots[slot] = index;
+        m_displacements[bucket] = -static_cast<i32>(slot) - 1;
+        return;
+      }
+    }
+  }
+
+  constexpr void place_multiple(const usize bucket, const std::array<usize, Size>& buckets)
+  {
+    for (u32 seed = 1; seed <= max_seed; ++seed) {
+      std::array<usize, Size> slots{};
+      usize count = 0;
+      bool ok = true;
+
+      for (usize index = 0; ok && index < Size; ++index) {
+        if (buckets[index] != bucket) {
+          continue;
+        }
+
+        const auto slot = slot_of(m_names[index], seed);
+        ok = m_slots[slot] == Size;
+
+        for (usize prev = 0; ok && prev < count; ++prev) {
+          ok = slots[prev] != slot;
+        }
+
+        slots[count++] = slot;
+      }
+
+      if (ok) {
+        count = 0;
+        for (usize index = 0; index < Size; ++index) {
+          if (buckets[index] == bucket) {
+            m_slots[slots[count++]] = index;
+          }
+        }
+
+        m_displacements[bucket] = static_cast<i32>(seed);
+        return;
+      }
+    }
+
+    throw cen_error{"Failed to find perfect hash!"};
+  }
+
+  constexpr void sort_keys() noexcept
+  {
+    for (usize index = 0; index < Size; ++index) {
+      m_order[index] = index;
+    }
+
+    // Insertion sort, since std::sort isn't constexpr in C++17
+    for (usize i = 1; i < Size; ++i) {
+      for (usize j = i; j > 0; --j) {
+        if (static_cast<i64>(m_keys[m_order[j]]) >= static_cast<i64>(m_keys[m_order[j - 1]])) {
+          break;
+        }
+
+        const auto tmp = m_order[j];
+        m_order[j] = m_order[j - 1];
+        m_order[j - 1] = tmp;
+      }
+    }
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_PERFECT_HASH_MAP_HEADER
@@ -0,0 +1,651 @@
+#ifndef CENTURION_DETAIL_PIXEL_KERNELS_HEADER
+#define CENTURION_DETAIL_PIXEL_KERNELS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include <optional>  // optional, nullopt
+
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../system/cpu_dispatch.hpp"
+#include "../video/pixel_format.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// The bit offsets of the channels of a 32-bit pixel format with 8-bit channels
+struct channel_layout final
+{
+  int red{};
+  int green{};
+  int blue{};
+  int alpha{};
+  bool hasAlpha{};
+};
+
+// The byte offsets of the channels of a 24-bit pixel format
+struct byte_layout final
+{
+  int red{};
+  int green{};
+  int blue{};
+};
+
+[[nodiscard]] inline auto shift_of(const u32 mask) noexcept -> std::optional<int>
+{
+  for (auto shift = 0; shift <= 24; shift += 8) {
+    if (mask == (0xFFu << shift)) {
+      return shift;
+    }
+  }
+
+  return std::nullopt;
+}
+
+[[nodiscard]] inline auto packed_layout(const pixel_format format) noexcept
+    -> std::optional<channel_layout>
+{
+  int bpp{};
+  u32 r{};
+  u32 g{};
+  u32 b{};
+  u32 a{};
+
+  if (SDL_BYTESPERPIXEL(to_underlying(format)) != 4 ||
+      !SDL_PixelFormatEnumToMasks(to_underlying(format), &bpp, &r, &g, &b, &a))
+  {
+    return std::nullopt;
+  }
+
+  const auto red = shift_of(r);
+  const auto green = shift_of(g);
+  const auto blue = shift_of(b);
+  const auto alpha = shift_of(a);
+
+  if (!red || !green || !blue || (a != 0 && !alpha)) {
+    return std::nullopt;
+  }
+
+  return channel_layout{*red, *green, *blue, alpha.value_or(0), alpha.has_value()};
+}
+
+[[nodiscard]] inline auto array_layout(const pixel_format format) noexcept
+    -> std::optional<byte_layout>
+{
+  switch (format) {
+    case pixel_format::rgb24:
+      return byte_layout{0, 1, 2};
+
+    case pixel_format::bgr24:
+      return byte_layout{2, 1, 0};
+
+    default:
+      return std::nullopt;
+  }
+}
+
+// The alpha bits that are added when the source format has no alpha channel
+[[nodiscard]] inline auto opaque_bits(const bool hasAlpha, const channel_layout& to) noexcept
+    -> u32
+{
+  return (!hasAlpha && to.hasAlpha) ? (0xFFu << to.alpha) : 0u;
+}
+
+inline void shuffle_row_scalar(const u32* src,
+                               u32* dst,
+                               const int count,
+                               const channel_layout& from,
+                               const channel_layout& to) noexcept
+{
+  const auto copyAlpha = from.hasAlpha && to.hasAlpha;
+  const auto opaque = opaque_bits(from.hasAlpha, to);
+
+  for (auto index = 0; index < count; ++index) {
+    const auto pixel = src[index];
+
+    auto result = opaque;
+    result |= ((pixel >> from.red) & 0xFFu) << to.red;
+    result |= ((pixel >> from.green) & 0xFFu) << to.green;
+    result |= ((pixel >> from.blue) & 0xFFu) << to.blue;
+
+    if (copyAlpha) {
+      result |= ((pixel >> from.alpha) & 0xFFu) << to.alpha;
+    }
+
+    dst[index] = result;
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+inline void shuffle_row_sse2(const u32* src,
+                             u32* dst,
+                             const int count,
+                             const channel_layout& from,
+                             const channel_layout& to) noexcept
+{
+  const auto copyAlpha = from.hasAlpha && to.hasAlpha;
+
+  const auto byteMask = _mm_set1_epi32(0xFF);
+  const auto opaque = _mm_set1_epi32(static_cast<int>(opaque_bits(from.hasAlpha, to)));
+
+  const auto extract = [&](const __m128i pixels, const int fromShift, const int toShift) {
+    const auto channel = _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(fromShift)),
+                                       byteMask);
+    return _mm_sll_epi32(channel, _mm_cvtsi32_si128(toShift));
+  };
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+
+    auto result = opaque;
+    result = _mm_or_si128(result, extract(pixels, from.red, to.red));
+    result = _mm_or_si128(result, extract(pixels, from.green, to.green));
+    result = _mm_or_si128(result, extract(pixels, from.blue, to.blue));
+
+    if (copyAlpha) {
+      result = _mm_or_si128(result, extract(pixels, from.alpha, to.alpha));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index), result);
+  }
+
+  shuffle_row_scalar(src + index, dst + index, count - index, from, to);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline void shuffle_row_neon(const u32* src,
+                             u32* dst,
+                             const int count,
+                             const channel_layout& from,
+                             const channel_layout& to) noexcept
+{
+  const auto copyAlpha = from.hasAlpha && to.hasAlpha;
+
+  const auto byteMask = vdupq_n_u32(0xFF);
+  const auto opaque = vdupq_n_u32(opaque_bits(from.hasAlpha, to));
+
+  // Negative shift amounts shift to the right
+  const auto extract = [&](const uint32x4_t pixels, const int fromShift, const int toShift) {
+    const auto channel = vandq_u32(vshlq_u32(pixels, vdupq_n_s32(-fromShift)), byteMask);
+    return vshlq_u32(channel, vdupq_n_s32(toShift));
+  };
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto pixels = vld1q_u32(src + index);
+
+    auto result = opaque;
+    result = vorrq_u32(result, extract(pixels, from.red, to.red));
+    result = vorrq_u32(result, extract(pixels, from.green, to.green));
+    result = vorrq_u32(result, extract(pixels, from.blue, to.blue));
+
+    if (copyAlpha) {
+      result = vorrq_u32(result, extract(pixels, from.alpha, to.alpha));
+    }
+
+    vst1q_u32(dst + index, result);
+  }
+
+  shuffle_row_scalar(src + index, dst + index, count - index, from, to);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+using shuffle_row_kernel =
+    void(const u32*, u32*, int, const channel_layout&, const channel_layout&);
+
+inline kernel_table<shuffle_row_kernel> shuffle_row_kernels{
+    shuffle_row_scalar,
+    CENTURION_SSE2_KERNEL(shuffle_row_sse2),
+    CENTURION_NEON_KERNEL(shuffle_row_neon)};
+
+inline void shuffle_row(const u32* src,
+                        u32* dst,
+                        const int count,
+                        const channel_layout& from,
+                        const channel_layout& to) noexcept
+{
+  shuffle_row_kernels(src, dst, count, from, to);
+}
+
+inline void unpack_row(const u8* src,
+                       u32* dst,
+                       const int count,
+                       const byte_layout& from,
+                       const channel_layout& to) noexcept
+{
+  const auto opaque = opaque_bits(false, to);
+
+  for (auto index = 0; index < count; ++index, src += 3) {
+    dst[index] = opaque | (u32{src[from.red]} << to.red) |
+                 (u32{src[from.green]} << to.green) | (u32{src[from.blue]} << to.blue);
+  }
+}
+
+inline void pack_row(const u32* src,
+                     u8* dst,
+                     const int count,
+                     const channel_layout& from,
+                     const byte_layout& to) noexcept
+{
+  for (auto index = 0; index < count; ++index, dst += 3) {
+    const auto pixel = src[index];
+    dst[to.red] = static_cast<u8>(pixel >> from.red);
+    dst[to.green] = static_cast<u8>(pixel >> from.green);
+    dst[to.blue] = static_cast<u8>(pixel >> from.blue);
+  }
+}
+
+// Computes (value * alpha) / 255, rounded to the nearest integer
+[[nodiscard]] constexpr auto multiply_alpha(const u32 value, const u32 alpha) noexcept -> u32
+{
+  const auto product = value * alpha + 128u;
+  return (product + (product >> 8u)) >> 8u;
+}
+
+inline void premultiply_row_scalar(u32* pixels,
+                                   const int count,
+                                   const channel_layout& layout) noexcept
+{
+  for (auto index = 0; index < count; ++index) {
+    const auto pixel = pixels[index];
+    const auto alpha = (pixel >> layout.alpha) & 0xFFu;
+
+    auto result = alpha << layout.alpha;
+    result |= multiply_alpha((pixel >> layout.red) & 0xFFu, alpha) << layout.red;
+    result |= multiply_alpha((pixel >> layout.green) & 0xFFu, alpha) << layout.green;
+    result |= multiply_alpha((pixel >> layout.blue) & 0xFFu, alpha) << layout.blue;
+
+    pixels[index] = result;
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+inline void premultiply_row_sse2(u32* pixels,
+                                 const int count,
+                                 const channel_layout& layout) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+  const auto bias = _mm_set1_epi16(128);
+  const auto byteMask = _mm_set1_epi32(0xFF);
+  const auto alphaMask = _mm_set1_epi32(static_cast<int>(0xFFu << layout.alpha));
+  const auto alphaShift = _mm_cvtsi32_si128(layout.alpha);
+
+  // Multiplies eight 16-bit channels with their alpha values, and divides by 255
+  const auto multiply = [&](const __m128i channels, const __m128i alpha) {
+    const auto product = _mm_add_epi16(_mm_mullo_epi16(channels, alpha), bias);
+    return _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+  };
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto* address = reinterpret_cast<__m128i*>(pixels + index);
+    const auto source = _mm_loadu_si128(address);
+
+    // Copy the alpha value of each pixel to all four bytes of the pixel
+    auto alpha = _mm_and_si128(_mm_srl_epi32(source, alphaShift), byteMask);
+    alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+    alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+
+    const auto low = multiply(_mm_unpacklo_epi8(source, zero),
+                              _mm_unpacklo_epi8(alpha, zero));
+    const auto high = multiply(_mm_unpackhi_epi8(source, zero),
+                               _mm_unpackhi_epi8(alpha, zero));
+    const auto result = _mm_packus_epi16(low, high);
+
+    _mm_storeu_si128(address,
+                     _mm_or_si128(_mm_and_si128(source, alphaMask),
+                                  _mm_andnot_si128(alphaMask, result)));
+  }
+
+  premultiply_row_scalar(pixels + index, count - index, layout);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline void premultiply_row_neon(u32* pixels,
+                                 const int count,
+                                 const channel_layout& layout) noexcept
+{
+  const auto bias = vdupq_n_u16(128);
+  const auto byteMask = vdupq_n_u32(0xFF);
+  const auto alphaMask = vdupq_n_u32(0xFFu << layout.alpha);
+  const auto alphaShift = vdupq_n_s32(-layout.alpha);
+
+  // Divides eight 16-bit products by 255, and narrows the results to bytes
+  const auto divide = [&](const uint16x8_t product) {
+    const auto biased = vaddq_u16(product, bias);
+    return vshrn_n_u16(vaddq_u16(biased, vshrq_n_u16(biased, 8)), 8);
+  };
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto source = vld1q_u32(pixels + index);
+
+    // Copy the alpha value of each pixel to all four bytes of the pixel
+    auto alpha = vandq_u32(vshlq_u32(source, alphaShift), byteMask);
+    alpha = vorrq_u32(alpha, vshlq_n_u32(alpha, 8));
+    alpha = vorrq_u32(alpha, vshlq_n_u32(alpha, 16));
+
+    const auto bytes = vreinterpretq_u8_u32(source);
+    const auto alphaBytes = vreinterpretq_u8_u32(alpha);
+
+    const auto low = divide(vmull_u8(vget_low_u8(bytes), vget_low_u8(alphaBytes)));
+    const auto high = divide(vmull_u8(vget_high_u8(bytes), vget_high_u8(alphaBytes)));
+    const auto result = vreinterpretq_u32_u8(vcombine_u8(low, high));
+
+    vst1q_u32(pixels + index, vbslq_u32(alphaMask, source, result));
+  }
+
+  premultiply_row_scalar(pixels + index, count - index, layout);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+inline kernel_table<void(u32*, int, const channel_layout&)> premultiply_row_kernels{
+    premultiply_row_scalar,
+    CENTURION_SSE2_KERNEL(premultiply_row_sse2),
+    CENTURION_NEON_KERNEL(premultiply_row_neon)};
+
+inline void premultiply_row(u32* pixels,
+                            const int count,
+                            const channel_layout& layout) noexcept
+{
+  premultiply_row_kernels(pixels, count, layout);
+}
+
+inline void unpremultiply_row(u32* pixels,
+                              const int count,
+                              const channel_layout& layout) noexcept
+{
+  const auto divide = [](const u32 value, const u32 alpha) noexcept {
+    const auto result = (value * 255u + alpha / 2u) / alpha;
+    return (result > 255u) ? 255u : result;
+  };
+
+  for (auto index = 0; index < count; ++index) {
+    const auto pixel = pixels[index];
+    const auto alpha = (pixel >> layout.alpha) & 0xFFu;
+
+    // Fully transparent and fully opaque pixels are left untouched
+    if (alpha == 0u || alpha == 255u) {
+      continue;
+    }
+
+    auto result = alpha << layout.alpha;
+    result |= divide((pixel >> layout.red) & 0xFFu, alpha) << layout.red;
+    result |= divide((pixel >> layout.green) & 0xFFu, alpha) << layout.green;
+    result |= divide((pixel >> layout.blue) & 0xFFu, alpha) << layout.blue;
+
+    pixels[index] = result;
+  }
+}
+
+// Places the alpha channel in the unused byte of formats without an alpha channel
+[[nodiscard]] constexpr auto blend_layout(const channel_layout& layout) noexcept
+    -> channel_layout
+{
+  if (layout.hasAlpha) {
+    return layout;
+  }
+
+  // The shifts of the four channels always add up to 0 + 8 + 16 + 24
+  return {layout.red, layout.green, layout.blue, 48 - layout.red - layout.green - layout.blue,
+          true};
+}
+
+// Multiplies the channels of each pixel with the corresponding channels of the tint
+inline void modulate_row(u32* pixels,
+                         const int count,
+                         const channel_layout& layout,
+                         const u32 tint) noexcept
+{
+  const auto channel = [&](const u32 pixel, const int shift) noexcept {
+    return multiply_alpha((pixel >> shift) & 0xFFu, (tint >> shift) & 0xFFu) << shift;
+  };
+
+  for (auto index = 0; index < count; ++index) {
+    const auto pixel = pixels[index];
+    pixels[index] = channel(pixel, layout.red) | channel(pixel, layout.green) |
+                    channel(pixel, layout.blue) | channel(pixel, layout.alpha);
+  }
+}
+
+// Blends straight alpha pixels onto the destination, i.e. dst = src * a + dst * (1 - a)
+// for the color channels and dst = a + dst * (1 - a) for the alpha channel, after the
+// source has been modulated with the tint. Both rows must use the same blend layout.
+inline void blend_row_scalar(const u32* src,
+                             u32* dst,
+                             const int count,
+                             const channel_layout& layout,
+                             const u32 tint) noexcept
+{
+  const auto blend = [](const u32 from, const u32 to, const u32 alpha) noexcept {
+    const auto sum = from * alpha + to * (255u - alpha) + 128u;
+    return (sum + (sum >> 8u)) >> 8u;
+  };
+
+  const auto tinted = tint != 0xFFFFFFFFu;
+
+  for (auto index = 0; index < count; ++index) {
+    auto pixel = src[index];
+    if (tinted) {
+      modulate_row(&pixel, 1, layout, tint);
+    }
+
+    const auto alpha = (pixel >> layout.alpha) & 0xFFu;
+    if (alpha == 0u) {
+      continue;
+    }
+
+    if (alpha == 255u) {
+      dst[index] = pixel;
+      continue;
+    }
+
+    const auto target = dst[index];
+    const auto channel = [&](const int shift) noexcept {
+      return blend((pixel >> shift) & 0xFFu, (target >> shift) & 0xFFu, alpha) << shift;
+    };
+
+    dst[index] = channel(layout.red) | channel(layout.green) | channel(layout.blue) |
+                 (blend(255u, (target >> layout.alpha) & 0xFFu, alpha) << layout.alpha);
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+inline void blend_row_sse2(const u32* src,
+                           u32* dst,
+                           const int count,
+                           const channel_layout& layout,
+                           const u32 tint) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+  const auto bias = _mm_set1_epi16(128);
+  const auto full = _mm_set1_epi16(255);
+  const auto byteMask = _mm_set1_epi32(0xFF);
+  const auto alphaMask = _mm_set1_epi32(static_cast<int>(0xFFu << layout.alpha));
+  const auto alphaShift = _mm_cvtsi32_si128(layout.alpha);
+  const auto tint16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(tint)), zero);
+  const auto tinted = tint != 0xFFFFFFFFu;
+
+  // Divides eight 16-bit values by 255, rounded to the nearest integer
+  const auto divide = [&](const __m128i value) {
+    const auto biased = _mm_add_epi16(value, bias);
+    return _mm_srli_epi16(_mm_add_epi16(biased, _mm_srli_epi16(biased, 8)), 8);
+  };
+
+  // Computes from * alpha + to * (255 - alpha) for eight 16-bit channels, divided by 255
+  const auto blend = [&](const __m128i from, const __m128i to, const __m128i alpha) {
+    const auto inverse = _mm_sub_epi16(full, alpha);
+    return divide(_mm_add_epi16(_mm_mullo_epi16(from, alpha), _mm_mullo_epi16(to, inverse)));
+  };
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+
+    if (tinted) {
+      const auto low = divide(_mm_mullo_epi16(_mm_unpacklo_epi8(source, zero), tint16));
+      const auto high = divide(_mm_mullo_epi16(_mm_unpackhi_epi8(source, zero), tint16));
+      source = _mm_packus_epi16(low, high);
+    }
+
+    const auto opaque = _mm_cmpeq_epi32(_mm_and_si128(source, alphaMask), alphaMask);
+    const auto transparent = _mm_cmpeq_epi32(_mm_and_si128(source, alphaMask), zero);
+
+    auto* address = reinterpret_cast<__m128i*>(dst + index);
+
+    // Skip the arithmetic when all four pixels are either fully opaque or fully transparent
+    if (_mm_movemask_epi8(transparent) == 0xFFFF) {
+      continue;
+    }
+
+    if (_mm_movemask_epi8(opaque) == 0xFFFF) {
+      _mm_storeu_si128(address, source);
+      continue;
+    }
+
+    const auto target = _mm_loadu_si128(address);
+
+    // Copy the alpha value of each pixel to all four bytes of the pixel
+    auto alpha = _mm_and_si128(_mm_srl_epi32(source, alphaShift), byteMask);
+    alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+    alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+
+    // The alpha channel is blended as if the source alpha channel was fully opaque
+    source = _mm_or_si128(source, alphaMask);
+
+    const auto low = blend(_mm_unpacklo_epi8(source, zero),
+                           _mm_unpacklo_epi8(target, zero),
+                           _mm_unpacklo_epi8(alpha, zero));
+    const auto high = blend(_mm_unpackhi_epi8(source, zero),
+                            _mm_unpackhi_epi8(target, zero),
+                            _mm_unpackhi_epi8(alpha, zero));
+
+    _mm_storeu_si128(address, _mm_packus_epi16(low, high));
+  }
+
+  blend_row_scalar(src + index, dst + index, count - index, layout, tint);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline void blend_row_neon(const u32* src,
+                           u32* dst,
+                           const int count,
+                           const channel_layout& layout,
+                           const u32 tint) noexcept
+{
+  const auto bias = vdupq_n_u16(128);
+  const auto byteMask = vdupq_n_u32(0xFF);
+  const auto alphaMask = vdupq_n_u32(0xFFu << layout.alpha);
+  const auto alphaShift = vdupq_n_s32(-layout.alpha);
+  const auto tintBytes = vreinterpret_u8_u32(vdup_n_u32(tint));
+  const auto tinted = tint != 0xFFFFFFFFu;
+
+  // Divides eight 16-bit values by 255, and narrows the results to bytes
+  const auto divide = [&](const uint16x8_t value) {
+    const auto biased = vaddq_u16(value, bias);
+    return vshrn_n_u16(vaddq_u16(biased, vshrq_n_u16(biased, 8)), 8);
+  };
+
+  // Reinterprets two 32-bit lanes as a single 64-bit value, which also works on ARMv7
+  const auto lanes = [](const uint32x2_t value) {
+    return vget_lane_u64(vreinterpret_u64_u32(value), 0);
+  };
+
+  // Computes from * alpha + to * (255 - alpha) for eight channels, divided by 255
+  const auto blend = [&](const uint8x8_t from, const uint8x8_t to, const uint8x8_t alpha) {
+    return divide(vmlal_u8(vmull_u8(from, alpha), to, vmvn_u8(alpha)));
+  };
+
+  auto index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto source = vld1q_u32(src + index);
+
+    if (tinted) {
+      const auto bytes = vreinterpretq_u8_u32(source);
+      const auto low = divide(vmull_u8(vget_low_u8(bytes), tintBytes));
+      const auto high = divide(vmull_u8(vget_high_u8(bytes), tintBytes));
+      source = vreinterpretq_u32_u8(vcombine_u8(low, high));
+    }
+
+    const auto alphaBits = vandq_u32(source, alphaMask);
+    const auto opaque = vceqq_u32(alphaBits, alphaMask);
+
+    // Skip the arithmetic when all four pixels are either fully opaque or fully transparent
+    if (lanes(vorr_u32(vget_low_u32(alphaBits), vget_high_u32(alphaBits))) == 0u) {
+      continue;
+    }
+
+    if (lanes(vand_u32(vget_low_u32(opaque), vget_high_u32(opaque))) == ~u64{}) {
+      vst1q_u32(dst + index, source);
+      continue;
+    }
+
+    const auto target = vreinterpretq_u8_u32(vld1q_u32(dst + index));
+
+    // Copy the alpha value of each pixel to all four bytes of the pixel
+    auto alpha = vandq_u32(vshlq_u32(source, alphaShift), byteMask);
+    alpha = vorrq_u32(alpha, vshlq_n_u32(alpha, 8));
+    alpha = vorrq_u32(alpha, vshlq_n_u32(alpha, 16));
+
+    // The alpha channel is blended as if the source alpha channel was fully opaque
+    const auto bytes = vreinterpretq_u8_u32(vorrq_u32(source, alphaMask));
+    const auto alphaBytes = vreinterpretq_u8_u32(alpha);
+
+    const auto low =
+        blend(vget_low_u8(bytes), vget_low_u8(target), vget_low_u8(alphaBytes));
+    const auto high =
+        blend(vget_high_u8(bytes), vget_high_u8(target), vget_high_u8(alphaBytes));
+
+    vst1q_u32(dst + index, vreinterpretq_u32_u8(vcombine_u8(low, high)));
+  }
+
+  blend_row_scalar(src + index, dst + index, count - index, layout, tint);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+inline kernel_table<void(const u32*, u32*, int, const channel_layout&, u32)> blend_row_kernels{
+    blend_row_scalar,
+    CENTURION_SSE2_KERNEL(blend_row_sse2),
+    CENTURION_NEON_KERNEL(blend_row_neon)};
+
+inline void blend_row(const u32* src,
+                      u32* dst,
+                      const int count,
+                      const channel_layout& layout,
+                      const u32 tint) noexcept
+{
+  blend_row_kernels(src, dst, count, layout, tint);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_PIXEL_KERNELS_HEADER
@@ -0,0 +1,269 @@
+#ifndef CENTURION_DETAIL_QOI_CODEC_HEADER
+#define CENTURION_DETAIL_QOI_CODEC_HEADER
+
+#include <cstring>   // memcpy, memset
+#include <optional>  // optional, nullopt
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// See https://qoiformat.org/qoi-specification.pdf
+inline constexpr u32 qoi_magic = 0x716F6966;  // "qoif", stored big-endian
+inline constexpr usize qoi_header_size = 14;
+inline constexpr usize qoi_padding_size = 8;  // Seven zero bytes followed by a one
+inline constexpr u32 qoi_max_pixels = 400'000'000;
+
+inline constexpr u8 qoi_op_index = 0x00;
+inline constexpr u8 qoi_op_diff = 0x40;
+inline constexpr u8 qoi_op_luma = 0x80;
+inline constexpr u8 qoi_op_run = 0xC0;
+inline constexpr u8 qoi_op_rgb = 0xFE;
+inline constexpr u8 qoi_op_rgba = 0xFF;
+inline constexpr u8 qoi_mask = 0xC0;
+
+struct qoi_header final
+{
+  u32 width{};
+  u32 height{};
+  u8 channels{};    ///< Either 3 (RGB) or 4 (RGBA).
+  u8 colorspace{};  ///< Zero for sRGB with linear alpha, one for all channels linear.
+};
+
+[[nodiscard]] inline auto load_big_endian_u32(const u8* data) noexcept -> u32
+{
+  return (static_cast<u32>(data[0]) << 24) | (static_cast<u32>(data[1]) << 16) |
+         (static_cast<u32>(data[2]) << 8) | static_cast<u32>(data[3]);
+}
+
+inline void store_big_endian_u32(u8* data, const u32 value) noexcept
+{
+  data[0] = static_cast<u8>(value >> 24);
+  data[1] = static_cast<u8>(value >> 16);
+  data[2] = static_cast<u8>(value >> 8);
+  data[3] = static_cast<u8>(value);
+}
+
+[[nodiscard]] constexpr auto qoi_hash(const u8 r, const u8 g, const u8 b, const u8 a) noexcept
+    -> usize
+{
+  return (r * 3u + g * 5u + b * 7u + a * 11u) % 64u;
+}
+
+// Returns the worst case size of an encoded image, i.e. one RGBA operation per pixel
+[[nodiscard]] constexpr auto qoi_max_size(const u32 width, const u32 height) noexcept
+    -> usize
+{
+  return qoi_header_size + static_cast<usize>(width) * static_cast<usize>(height) * 5u +
+         qoi_padding_size;
+}
+
+[[nodiscard]] inline auto qoi_read_header(const u8* data, const usize size) noexcept
+    -> std::optional<qoi_header>
+{
+  if (size < qoi_header_size + qoi_padding_size || load_big_endian_u32(data) != qoi_magic) {
+    return std::nullopt;
+  }
+
+  qoi_header header;
+  header.width = load_big_endian_u32(data + 4);
+  header.height = load_big_endian_u32(data + 8);
+  header.channels = data[12];
+  header.colorspace = data[13];
+
+  if (header.width == 0 || header.height == 0 || header.channels < 3 ||
+      header.channels > 4 || header.colorspace > 1 ||
+      header.height >= qoi_max_pixels / header.width)
+  {
+    return std::nullopt;
+  }
+
+  return header;
+}
+
+// Decodes an image to RGBA bytes, with rows that are `pitch` bytes apart. Returns false if
+// the data is truncated, in which case the remaining pixels are left unspecified.
+[[nodiscard]] inline auto qoi_decode(const u8* data,
+                                     const usize size,
+                                     const qoi_header& header,
+                                     u8* pixels,
+                                     const usize pitch) noexcept -> bool
+{
+  u8 index[64][4];
+  std::memset(index, 0, sizeof index);
+
+  u8 px[4] = {0, 0, 0, 255};
+  u32 run = 0;
+
+  const auto* in = data + qoi_header_size;
+  const auto* end = data + size - qoi_padding_size;
+
+  for (u32 y = 0; y < header.height; ++y) {
+    auto* row = pixels + static_cast<usize>(y) * pitch;
+
+    for (u32 x = 0; x < header.width; ++x, row += 4) {
+      if (run != 0) {
+        --run;
+      }
+      else {
+        if (in >= end) {
+          return false;
+        }
+
+        const auto op = *in++;
+
+        if (op == qoi_op_rgb) {
+          if (end - in < 3) {
+            return false;
+          }
+
+          px[0] = in[0];
+          px[1] = in[1];
+          px[2] = in[2];
+          in += 3;
+        }
+        else if (op == qoi_op_rgba) {
+          if (end - in < 4) {
+            return false;
+          }
+
+          std::memcpy(px, in, 4);
+          in += 4;
+        }
+        else if ((op & qoi_mask) == qoi_op_index) {
+          std::memcpy(px, index[op], 4);
+        }
+        else if ((op & qoi_mask) == qoi_op_diff) {
+          px[0] = static_cast<u8>(px[0] + ((op >> 4) & 0x03) - 2);
+          px[1] = static_cast<u8>(px[1] + ((op >> 2) & 0x03) - 2);
+          px[2] = static_cast<u8>(px[2] + (op & 0x03) - 2);
+        }
+        else if ((op & qoi_mask) == qoi_op_luma) {
+          if (in >= end) {
+            return false;
+          }
+
+          const auto next = *in++;
+          const auto dg = (op & 0x3F) - 32;
+          px[0] = static_cast<u8>(px[0] + dg - 8 + ((next >> 4) & 0x0F));
+          px[1] = static_cast<u8>(px[1] + dg);
+          px[2] = static_cast<u8>(px[2] + dg - 8 + (next & 0x0F));
+        }
+        else {
+          run = op & 0x3Fu;
+        }
+
+        std::memcpy(index[qoi_hash(px[0], px[1], px[2], px[3])], px, 4);
+      }
+
+      std::memcpy(row, px, 4);
+    }
+  }
+
+  return true;
+}
+
+// Encodes RGBA bytes, with rows that are `pitch` bytes apart. The output must hold at least
+// `qoi_max_size()` bytes. Returns the size of the encoded image.
+[[nodiscard]] inline auto qoi_encode(const u8* pixels,
+                                     const usize pitch,
+                                     const qoi_header& header,
+                                     u8* out) noexcept -> usize
+{
+  auto* begin = out;
+
+  store_big_endian_u32(out, qoi_magic);
+  store_big_endian_u32(out + 4, header.width);
+  store_big_endian_u32(out + 8, header.height);
+  out[12] = header.channels;
+  out[13] = header.colorspace;
+  out += qoi_header_size;
+
+  u8 index[64][4];
+  std::memset(index, 0, sizeof index);
+
+  u8 previous[4] = {0, 0, 0, 255};
+  u8 run = 0;
+
+  const auto withAlpha = header.channels == 4;
+
+  for (u32 y = 0; y < header.height; ++y) {
+    const auto* row = pixels + static_cast<usize>(y) * pitch;
+
+    for (u32 x = 0; x < header.width; ++x, row += 4) {
+      const u8 px[4] = {row[0], row[1], row[2], withAlpha ? row[3] : u8{255}};
+
+      if (std::memcmp(px, previous, 4) == 0) {
+        ++run;
+        if (run == 62) {
+          *out++ = static_cast<u8>(qoi_op_run | (run - 1));
+          run = 0;
+        }
+
+        continue;
+      }
+
+      if (run != 0) {
+        *out++ = static_cast<u8>(qoi_op_run | (run - 1));
+        run = 0;
+      }
+
+      const auto hash = qoi_hash(px[0], px[1], px[2], px[3]);
+
+      if (std::memcmp(index[hash], px, 4) == 0) {
+        *out++ = static_cast<u8>(qoi_op_index | hash);
+      }
+      else {
+        std::memcpy(index[hash], px, 4);
+
+        if (px[3] == previous[3]) {
+          const auto dr = static_cast<signed char>(px[0] - previous[0]);
+          const auto dg = static_cast<signed char>(px[1] - previous[1]);
+          const auto db = static_cast<signed char>(px[2] - previous[2]);
+
+          const auto drdg = dr - dg;
+          const auto dbdg = db - dg;
+
+          if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2) {
+            *out++ = static_cast<u8>(qoi_op_diff | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+          }
+          else if (drdg > -9 && drdg < 8 && dg > -33 && dg < 32 && dbdg > -9 && dbdg < 8) {
+            *out++ = static_cast<u8>(qoi_op_luma | (dg + 32));
+            *out++ = static_cast<u8>((drdg + 8) << 4 | (dbdg + 8));
+          }
+          else {
+            *out++ = qoi_op_rgb;
+            *out++ = px[0];
+            *out++ = px[1];
+            *out++ = px[2];
+          }
+        }
+        else {
+          *out++ = qoi_op_rgba;
+          std::memcpy(out, px, 4);
+          out += 4;
+        }
+      }
+
+      std::memcpy(previous, px, 4);
+    }
+  }
+
+  if (run != 0) {
+    *out++ = static_cast<u8>(qoi_op_run | (run - 1));
+  }
+
+  std::memset(out, 0, qoi_padding_size - 1);
+  out[qoi_padding_size - 1] = 1;
+  out += qoi_padding_size;
+
+  return static_cast<usize>(out - begin);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_QOI_CODEC_HEADER
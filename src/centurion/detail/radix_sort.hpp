@@ -0,0 +1,83 @@
+#ifndef CENTURION_DETAIL_RADIX_SORT_HEADER
+#define CENTURION_DETAIL_RADIX_SORT_HEADER
+
+#include <array>        // array
+#include <type_traits>  // is_unsigned_v, invoke_result_t
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * \brief Sorts elements by an unsigned integer key, with a stable LSD radix sort.
+ *
+ * \details The keys are sorted one byte at a time, and the histograms of all bytes are
+ * computed in a single pass. Bytes that are the same for every key are skipped, so keys
+ * that only use a few of their bits are cheap to sort.
+ *
+ * \param values the elements that will be sorted.
+ * \param scratch a buffer with the same element type, which keeps its capacity between
+ * calls.
+ * \param key a function object that returns the key of an element.
+ */
+template <typename T, typename Key>
+void radix_sort(std::vector<T>& values, std::vector<T>& scratch, Key key)
+{
+  using key_type = std::invoke_result_t<Key, const T&>;
+  static_assert(std::is_unsigned_v<key_type>);
+
+  constexpr usize passes = sizeof(key_type);
+
+  const auto count = values.size();
+  if (count < 2) {
+    return;
+  }
+
+  std::array<std::array<usize, 256>, passes> histograms{};
+  for (const auto& value : values) {
+    const auto k = key(value);
+    for (usize pass = 0; pass < passes; ++pass) {
+      ++histograms[pass][(k >> (pass * 8)) & 0xFFu];
+    }
+  }
+
+  scratch.resize(count);
+
+  auto* source = &values;
+  auto* target = &scratch;
+
+  for (usize pass = 0; pass < passes; ++pass) {
+    auto& offsets = histograms[pass];
+    const auto shift = pass * 8;
+
+    if (offsets[(key((*source)[0]) >> shift) & 0xFFu] == count) {
+      continue;
+    }
+
+    usize offset = 0;
+    for (auto& bucket : offsets) {
+      const auto size = bucket;
+      bucket = offset;
+      offset += size;
+    }
+
+    for (const auto& value : *source) {
+      (*target)[offsets[(key(value) >> shift) & 0xFFu]++] = value;
+    }
+
+    const auto tmp = source;
+    source = target;
+    target = tmp;
+  }
+
+  if (source != &values) {
+    values.swap(scratch);
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_RADIX_SORT_HEADER
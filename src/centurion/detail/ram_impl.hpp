@@ -0,0 +1,72 @@
+#ifndef CENTURION_DETAIL_RAM_IMPL_HEADER
+#define CENTURION_DETAIL_RAM_IMPL_HEADER
+
+#if defined(_WIN32)
+
+#include "windows_include.hpp"
+
+#include <psapi.h>  // K32GetProcessMemoryInfo, PROCESS_MEMORY_COUNTERS
+
+#elif defined(__APPLE__)
+
+#include <mach/mach.h>  // task_info, mach_task_self, mach_task_basic_info
+
+#elif defined(__linux__)
+
+#include <unistd.h>  // sysconf
+
+#include <cstdio>  // FILE, fopen, fscanf, fclose
+
+#endif  // defined(_WIN32)
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../system/ram.hpp"
+
+namespace cen::ram {
+
+CENTURION_LIB_INLINE auto process_resident_bytes() noexcept -> usize
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof counters)) {
+    return static_cast<usize>(counters.WorkingSetSize);
+  }
+
+  return 0;
+#elif defined(__APPLE__)
+  mach_task_basic_info info{};
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(),
+                MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info),
+                &count) == KERN_SUCCESS) {
+    return static_cast<usize>(info.resident_size);
+  }
+
+  return 0;
+#elif defined(__linux__)
+  std::FILE* file = std::fopen("/proc/self/statm", "r");
+  if (!file) {
+    return 0;
+  }
+
+  unsigned long pages{};
+  unsigned long resident{};
+  const auto matched = std::fscanf(file, "%lu %lu", &pages, &resident);
+  std::fclose(file);
+
+  const auto pageSize = sysconf(_SC_PAGESIZE);
+  if (matched != 2 || pageSize <= 0) {
+    return 0;
+  }
+
+  return static_cast<usize>(resident) * static_cast<usize>(pageSize);
+#else
+  return 0;
+#endif  // defined(_WIN32)
+}
+
+}  // namespace cen::ram
+
+#endif  // CENTURION_DETAIL_RAM_IMPL_HEADER
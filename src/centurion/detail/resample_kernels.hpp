@@ -0,0 +1,346 @@
+#ifndef CENTURION_DETAIL_RESAMPLE_KERNELS_HEADER
+#define CENTURION_DETAIL_RESAMPLE_KERNELS_HEADER
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include <cassert>  // assert
+#include <cmath>    // lrint, sin, cos
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+inline void s16_to_f32_scalar(const i16* source, float* target, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    target[index] = static_cast<float>(source[index]) * (1.0f / 32'768.0f);
+  }
+}
+
+inline void f32_to_s16_scalar(const float* source, i16* target, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    const auto value = std::lrint(source[index] * 32'768.0f);
+    target[index] =
+        static_cast<i16>(value < -32'768 ? -32'768 : (value > 32'767 ? 32'767 : value));
+  }
+}
+
+[[nodiscard]] inline auto dot_f32_scalar(const float* a,
+                                         const float* b,
+                                         const usize count) noexcept -> float
+{
+  auto sum = 0.0f;
+  for (usize index = 0; index < count; ++index) {
+    sum += a[index] * b[index];
+  }
+
+  return sum;
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+inline void s16_to_f32_sse2(const i16* source, float* target, const usize count) noexcept
+{
+  const auto scale = _mm_set1_ps(1.0f / 32'768.0f);
+
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+    const auto low = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+    const auto high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+
+    _mm_storeu_ps(target + index, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+    _mm_storeu_ps(target + index + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+  }
+
+  s16_to_f32_scalar(source + index, target + index, count - index);
+}
+
+// The conversion saturates at INT32_MIN, and the pack saturates to 16 bits
+inline void f32_to_s16_sse2(const float* source, i16* target, const usize count) noexcept
+{
+  const auto scale = _mm_set1_ps(32'768.0f);
+  const auto limit = _mm_set1_ps(65'536.0f);
+
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto low = _mm_min_ps(_mm_mul_ps(_mm_loadu_ps(source + index), scale), limit);
+    const auto high = _mm_min_ps(_mm_mul_ps(_mm_loadu_ps(source + index + 4), scale), limit);
+
+    const auto packed = _mm_packs_epi32(_mm_cvtps_epi32(low), _mm_cvtps_epi32(high));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(target + index), packed);
+  }
+
+  f32_to_s16_scalar(source + index, target + index, count - index);
+}
+
+[[nodiscard]] inline auto dot_f32_sse2(const float* a,
+                                       const float* b,
+                                       const usize count) noexcept -> float
+{
+  auto sum = _mm_setzero_ps();
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + index), _mm_loadu_ps(b + index)));
+  }
+
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, sum);
+
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+         dot_f32_scalar(a + index, b + index, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline void s16_to_f32_neon(const i16* source, float* target, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto samples = vld1q_s16(source + index);
+    const auto low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples)));
+    const auto high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples)));
+
+    vst1q_f32(target + index, vmulq_n_f32(low, 1.0f / 32'768.0f));
+    vst1q_f32(target + index + 4, vmulq_n_f32(high, 1.0f / 32'768.0f));
+  }
+
+  s16_to_f32_scalar(source + index, target + index, count - index);
+}
+
+// Rounds half away from zero, since ARMv7 lacks a round-to-nearest conversion
+inline void f32_to_s16_neon(const float* source, i16* target, const usize count) noexcept
+{
+  const auto half = vdupq_n_f32(0.5f);
+  const auto signMask = vdupq_n_u32(0x8000'0000u);
+
+  const auto round = [&](const float32x4_t scaled) noexcept {
+    const auto bias = vreinterpretq_f32_u32(
+        vorrq_u32(vandq_u32(vreinterpretq_u32_f32(scaled), signMask),
+                  vreinterpretq_u32_f32(half)));
+    return vcvtq_s32_f32(vaddq_f32(scaled, bias));
+  };
+
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto low = round(vmulq_n_f32(vld1q_f32(source + index), 32'768.0f));
+    const auto high = round(vmulq_n_f32(vld1q_f32(source + index + 4), 32'768.0f));
+
+    vst1q_s16(target + index, vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+  }
+
+  f32_to_s16_scalar(source + index, target + index, count - index);
+}
+
+[[nodiscard]] inline auto dot_f32_neon(const float* a,
+                                       const float* b,
+                                       const usize count) noexcept -> float
+{
+  auto sum = vdupq_n_f32(0.0f);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    sum = vmlaq_f32(sum, vld1q_f32(a + index), vld1q_f32(b + index));
+  }
+
+  const auto pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+  return vget_lane_f32(vpadd_f32(pair, pair), 0) +
+         dot_f32_scalar(a + index, b + index, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+// Converts 16-bit samples to floating-point samples in [-1, 1)
+inline void s16_to_f32(const i16* source, float* target, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    s16_to_f32_sse2(source, target, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    s16_to_f32_neon(source, target, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  s16_to_f32_scalar(source, target, count);
+}
+
+// Converts floating-point samples to 16-bit samples, saturating the results
+inline void f32_to_s16(const float* source, i16* target, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    f32_to_s16_sse2(source, target, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    f32_to_s16_neon(source, target, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  f32_to_s16_scalar(source, target, count);
+}
+
+// Returns the dot product of two floating-point vectors
+[[nodiscard]] inline auto dot_f32(const float* a, const float* b, const usize count) noexcept
+    -> float
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    return dot_f32_sse2(a, b, count);
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    return dot_f32_neon(a, b, count);
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  return dot_f32_scalar(a, b, count);
+}
+
+/**
+ * A polyphase windowed sinc filter, which stores the filter kernels for a fixed amount of
+ * fractional positions (phases) between two input samples.
+ *
+ * The kernel of a phase covers `taps` input samples, centered on the fractional position,
+ * so the output sample at input position `i + phase / phases` is the dot product of the
+ * kernel with the input samples `[i - taps / 2 + 1, i + taps / 2]`.
+ */
+class sinc_filter final
+{
+ public:
+  /// \param taps the length of each kernel, must be an even number.
+  /// \param phases the amount of fractional positions, must be greater than zero.
+  /// \param cutoff the cutoff frequency, relative to the input Nyquist frequency.
+  sinc_filter(const usize taps, const usize phases, const double cutoff)
+      : m_taps{taps}
+      , m_phases{phases}
+      , m_kernels((phases + 1) * taps)
+  {
+    assert(taps % 2 == 0);
+    assert(phases > 0);
+    assert(cutoff > 0 && cutoff <= 1);
+
+    constexpr auto pi = 3.14159265358979323846;
+    const auto half = static_cast<double>(taps / 2);
+
+    // An extra phase, equal to the first phase shifted by one sample, avoids a special case
+    for (usize phase = 0; phase <= phases; ++phase) {
+      auto* kernel = m_kernels.data() + phase * taps;
+      const auto fraction = static_cast<double>(phase) / static_cast<double>(phases);
+
+      auto sum = 0.0;
+      for (usize tap = 0; tap < taps; ++tap) {
+        const auto x = static_cast<double>(tap) - half + 1.0 - fraction;
+        const auto arg = pi * cutoff * x;
+        const auto sinc = (x == 0.0) ? 1.0 : std::sin(arg) / arg;
+
+        // Blackman window, spanning the kernel
+        const auto window =
+            0.42 + 0.5 * std::cos(pi * x / half) + 0.08 * std::cos(2 * pi * x / half);
+        const auto value = (x > -half && x < half) ? sinc * window : 0.0;
+
+        kernel[tap] = static_cast<float>(value);
+        sum += value;
+      }
+
+      // Normalized to unity gain, so that constant signals are unaffected
+      for (usize tap = 0; tap < taps; ++tap) {
+        kernel[tap] = static_cast<float>(kernel[tap] / sum);
+      }
+    }
+  }
+
+  [[nodiscard]] auto kernel(const usize phase) const noexcept -> const float*
+  {
+    assert(phase <= m_phases);
+    return m_kernels.data() + phase * m_taps;
+  }
+
+  [[nodiscard]] auto taps() const noexcept -> usize
+  {
+    return m_taps;
+  }
+
+  [[nodiscard]] auto phases() const noexcept -> usize
+  {
+    return m_phases;
+  }
+
+ private:
+  usize m_taps;
+  usize m_phases;
+  std::vector<float> m_kernels;
+};
+
+// Resamples a channel with linear interpolation, the input must be followed by a sample
+inline void resample_linear(const float* source,
+                            float* target,
+                            const usize targetCount,
+                            const u64 sourceRate,
+                            const u64 targetRate) noexcept
+{
+  for (usize index = 0; index < targetCount; ++index) {
+    const auto position = static_cast<u64>(index) * sourceRate;
+    const auto sample = static_cast<usize>(position / targetRate);
+    const auto fraction =
+        static_cast<float>(position % targetRate) / static_cast<float>(targetRate);
+
+    target[index] = source[sample] + (source[sample + 1] - source[sample]) * fraction;
+  }
+}
+
+// Resamples a channel with a sinc filter, the input must be padded by taps / 2 samples on
+// both sides, i.e. source points to the first sample after the padding
+inline void resample_sinc(const sinc_filter& filter,
+                          const float* source,
+                          float* target,
+                          const usize targetCount,
+                          const u64 sourceRate,
+                          const u64 targetRate) noexcept
+{
+  const auto taps = filter.taps();
+  const auto phases = static_cast<u64>(filter.phases());
+
+  for (usize index = 0; index < targetCount; ++index) {
+    const auto position = static_cast<u64>(index) * sourceRate;
+    const auto sample = static_cast<usize>(position / targetRate);
+    const auto phase = (position % targetRate * phases + targetRate / 2) / targetRate;
+
+    const auto* window = source + sample - (taps / 2 - 1);
+    target[index] = dot_f32(filter.kernel(static_cast<usize>(phase)), window, taps);
+  }
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_RESAMPLE_KERNELS_HEADER
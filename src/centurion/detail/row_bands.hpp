@@ -0,0 +1,56 @@
+#ifndef CENTURION_DETAIL_ROW_BANDS_HEADER
+#define CENTURION_DETAIL_ROW_BANDS_HEADER
+
+#include <algorithm>  // min
+#include <atomic>     // atomic, memory_order
+
+#include "../core/integers.hpp"
+#include "../thread/task_scheduler.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// Blocks of pixels smaller than this aren't worth splitting up, since waking the workers
+// costs more than processing the pixels on the calling thread
+inline constexpr usize parallel_pixel_threshold = 512 * 512;
+
+// Invokes function(first, last) for bands of rows that cover [0, height), in parallel if
+// a scheduler is supplied and the block is large enough. The function returns whether the
+// band was processed successfully, and all bands are processed even if one fails.
+template <typename Function>
+auto for_each_row_band(task_scheduler* scheduler,
+                       const int width,
+                       const int height,
+                       Function function) -> bool
+{
+  const auto pixels = static_cast<usize>(width) * static_cast<usize>(height);
+  if (!scheduler || height < 2 || pixels < parallel_pixel_threshold) {
+    return static_cast<bool>(function(0, height));
+  }
+
+  // A few bands per thread, including the calling thread, to balance uneven progress
+  const auto bands = std::min(static_cast<usize>(height), (scheduler->worker_count() + 1) * 4);
+  const auto rows = static_cast<int>((static_cast<usize>(height) + bands - 1) / bands);
+
+  std::atomic<bool> ok{true};
+  scheduler->parallel_for(
+      0,
+      bands,
+      [&](const usize band) {
+        const auto first = static_cast<int>(band) * rows;
+        const auto last = std::min(first + rows, height);
+        if (first < last && !function(first, last)) {
+          ok.store(false, std::memory_order_relaxed);
+        }
+      },
+      1);
+
+  return ok.load(std::memory_order_relaxed);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_ROW_BANDS_HEADER
@@ -0,0 +1,147 @@
+#ifndef CENTURION_DETAIL_SAVE_WRITER_IMPL_HEADER
+#define CENTURION_DETAIL_SAVE_WRITER_IMPL_HEADER
+
+#include <cstddef>  // byte
+#include <string>   // string, to_string
+#include <vector>   // vector
+
+#ifdef _WIN32
+#include "windows_include.hpp"
+#else
+#include <fcntl.h>   // open, O_WRONLY, O_CREAT, O_TRUNC
+#include <unistd.h>  // write, fsync, close
+
+#include <cerrno>   // errno, EINTR
+#include <cstdio>   // rename
+#include <cstring>  // strerror
+#endif  // _WIN32
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../filesystem/save_writer.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+#ifdef _WIN32
+
+CENTURION_LIB_INLINE auto write_atomically(const std::string& path,
+                                           const std::vector<std::byte>& contents,
+                                           std::string& error) -> bool
+{
+  const auto temporary = path + ".tmp";
+
+  auto* handle = CreateFileA(temporary.c_str(),
+                             GENERIC_WRITE,
+                             0,
+                             nullptr,
+                             CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_NORMAL,
+                             nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    error = "Failed to create " + temporary + ": " + std::to_string(GetLastError());
+    return false;
+  }
+
+  const auto* data = reinterpret_cast<const char*>(contents.data());
+  auto remaining = contents.size();
+
+  while (remaining != 0) {
+    const auto chunk = static_cast<DWORD>(remaining < 0x4000'0000 ? remaining : 0x4000'0000);
+
+    DWORD written{};
+    if (!WriteFile(handle, data, chunk, &written, nullptr)) {
+      error = "Failed to write " + temporary + ": " + std::to_string(GetLastError());
+      CloseHandle(handle);
+      return false;
+    }
+
+    data += written;
+    remaining -= written;
+  }
+
+  // The data must reach the device before the rename, or a crash could leave an empty file
+  const auto flushed = FlushFileBuffers(handle);
+  CloseHandle(handle);
+
+  if (!flushed ||
+      !MoveFileExA(temporary.c_str(),
+                   path.c_str(),
+                   MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+  {
+    error = "Failed to replace " + path + ": " + std::to_string(GetLastError());
+    return false;
+  }
+
+  return true;
+}
+
+#else
+
+CENTURION_LIB_INLINE auto write_atomically(const std::string& path,
+                                           const std::vector<std::byte>& contents,
+                                           std::string& error) -> bool
+{
+  const auto temporary = path + ".tmp";
+
+  const auto descriptor = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (descriptor == -1) {
+    error = "Failed to create " + temporary + ": " + std::strerror(errno);
+    return false;
+  }
+
+  const auto* data = reinterpret_cast<const char*>(contents.data());
+  auto remaining = contents.size();
+
+  while (remaining != 0) {
+    const auto written = ::write(descriptor, data, remaining);
+    if (written == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      error = "Failed to write " + temporary + ": " + std::strerror(errno);
+      ::close(descriptor);
+      return false;
+    }
+
+    data += written;
+    remaining -= static_cast<usize>(written);
+  }
+
+  // The data must reach the device before the rename, or a crash could leave an empty file
+  if (::fsync(descriptor) != 0) {
+    error = "Failed to flush " + temporary + ": " + std::strerror(errno);
+    ::close(descriptor);
+    return false;
+  }
+
+  ::close(descriptor);
+
+  if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+    error = "Failed to replace " + path + ": " + std::strerror(errno);
+    return false;
+  }
+
+  // Makes the rename itself durable, which is best effort
+  const auto separator = path.find_last_of('/');
+  if (separator != std::string::npos) {
+    const auto parent = path.substr(0, separator + 1);
+    const auto directory = ::open(parent.c_str(), O_RDONLY);
+    if (directory != -1) {
+      ::fsync(directory);
+      ::close(directory);
+    }
+  }
+
+  return true;
+}
+
+#endif  // _WIN32
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SAVE_WRITER_IMPL_HEADER
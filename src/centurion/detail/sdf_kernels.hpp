@@ -0,0 +1,93 @@
+#ifndef CENTURION_DETAIL_SDF_KERNELS_HEADER
+#define CENTURION_DETAIL_SDF_KERNELS_HEADER
+
+#include <algorithm>  // sort, clamp
+#include <cassert>    // assert
+#include <cmath>      // sqrt, lround
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// An offset to a neighbouring pixel, and its squared distance
+struct sdf_offset final
+{
+  int dx{};
+  int dy{};
+  int distance{};
+};
+
+// Returns the offsets within the spread, ordered from the nearest to the farthest
+[[nodiscard]] inline auto make_sdf_offsets(const int spread) -> std::vector<sdf_offset>
+{
+  assert(spread > 0);
+
+  std::vector<sdf_offset> offsets;
+  offsets.reserve(static_cast<usize>((2 * spread + 1) * (2 * spread + 1)));
+
+  for (auto dy = -spread; dy <= spread; ++dy) {
+    for (auto dx = -spread; dx <= spread; ++dx) {
+      const auto distance = dx * dx + dy * dy;
+      if (distance != 0 && distance <= spread * spread) {
+        offsets.push_back({dx, dy, distance});
+      }
+    }
+  }
+
+  std::sort(offsets.begin(), offsets.end(), [](const auto& a, const auto& b) {
+    return a.distance < b.distance;
+  });
+
+  return offsets;
+}
+
+// Computes the signed distance field of a coverage mask with a tight pitch. The field is
+// padded by the spread on every side, i.e. its size is (width + 2 * spread) by
+// (height + 2 * spread). Edges are mapped to 127.5, and distances of at least the spread
+// are clamped to 0 (outside) and 255 (inside). The offsets must be obtained with
+// make_sdf_offsets() for the same spread.
+inline void make_distance_field(const u8* coverage,
+                                const int width,
+                                const int height,
+                                const int spread,
+                                const std::vector<sdf_offset>& offsets,
+                                u8* field) noexcept
+{
+  const auto inside = [=](const int x, const int y) noexcept {
+    return x >= 0 && y >= 0 && x < width && y < height && coverage[y * width + x] >= 128u;
+  };
+
+  const auto fieldWidth = width + 2 * spread;
+  const auto fieldHeight = height + 2 * spread;
+  const auto scale = 127.5f / static_cast<float>(spread);
+
+  for (auto fy = 0; fy < fieldHeight; ++fy) {
+    for (auto fx = 0; fx < fieldWidth; ++fx) {
+      const auto x = fx - spread;
+      const auto y = fy - spread;
+      const auto state = inside(x, y);
+
+      // The nearest pixel of the opposite state determines the distance to the edge
+      auto distance = static_cast<float>(spread);
+      for (const auto& offset : offsets) {
+        if (inside(x + offset.dx, y + offset.dy) != state) {
+          distance = std::sqrt(static_cast<float>(offset.distance)) - 0.5f;
+          break;
+        }
+      }
+
+      const auto signedDistance = state ? distance : -distance;
+      const auto value = std::lround(127.5f + signedDistance * scale);
+      field[fy * fieldWidth + fx] = static_cast<u8>(std::clamp(value, 0l, 255l));
+    }
+  }
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SDF_KERNELS_HEADER
@@ -0,0 +1,163 @@
+#ifndef CENTURION_DETAIL_SHARED_MEMORY_IMPL_HEADER
+#define CENTURION_DETAIL_SHARED_MEMORY_IMPL_HEADER
+
+#include <cstdint>  // intptr_t
+#include <string>   // string
+
+#ifdef _WIN32
+#include "windows_include.hpp"
+#else
+#include <fcntl.h>     // O_CREAT, O_EXCL, O_RDWR
+#include <sys/mman.h>  // mmap, munmap, shm_open, shm_unlink
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close, ftruncate
+
+#include <cerrno>  // errno, EEXIST
+#endif  // _WIN32
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../system/shared_memory.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+#ifdef _WIN32
+
+[[nodiscard]] inline auto map_shared_view(HANDLE handle, const usize size) noexcept
+    -> shared_mapping
+{
+  if (!handle) {
+    return {};
+  }
+
+  if (auto* view = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, size)) {
+    MEMORY_BASIC_INFORMATION info{};
+    VirtualQuery(view, &info, sizeof info);
+
+    return {static_cast<u8*>(view),
+            (size != 0) ? size : static_cast<usize>(info.RegionSize),
+            reinterpret_cast<std::intptr_t>(handle)};
+  }
+  else {
+    CloseHandle(handle);
+    return {};
+  }
+}
+
+CENTURION_LIB_INLINE auto create_shared_mapping(const std::string& name,
+                                                const usize size) noexcept -> shared_mapping
+{
+  const auto value = static_cast<u64>(size);
+  auto* handle = CreateFileMappingA(INVALID_HANDLE_VALUE,
+                                    nullptr,
+                                    PAGE_READWRITE,
+                                    static_cast<DWORD>(value >> 32u),
+                                    static_cast<DWORD>(value & 0xFFFF'FFFFu),
+                                    name.c_str());
+  return map_shared_view(handle, size);
+}
+
+CENTURION_LIB_INLINE auto open_shared_mapping(const std::string& name) noexcept
+    -> shared_mapping
+{
+  return map_shared_view(OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str()), 0);
+}
+
+CENTURION_LIB_INLINE void close_shared_mapping(const std::string&,
+                                               const shared_mapping& mapping,
+                                               const bool) noexcept
+{
+  if (mapping.data) {
+    UnmapViewOfFile(mapping.data);
+  }
+
+  // The mapping is removed once every process has closed its handle
+  if (mapping.handle) {
+    CloseHandle(reinterpret_cast<HANDLE>(mapping.handle));
+  }
+}
+
+#else
+
+[[nodiscard]] inline auto map_shared_view(const int descriptor, const usize size) noexcept
+    -> shared_mapping
+{
+  // The mapping stays valid after the descriptor has been closed
+  auto* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  ::close(descriptor);
+
+  if (view != MAP_FAILED) {
+    return {static_cast<u8*>(view), size};
+  }
+  else {
+    return {};
+  }
+}
+
+CENTURION_LIB_INLINE auto create_shared_mapping(const std::string& name,
+                                                const usize size) noexcept -> shared_mapping
+{
+  auto descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (descriptor == -1 && errno == EEXIST) {
+    // Left behind by a process that didn't exit cleanly
+    shm_unlink(name.c_str());
+    descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  }
+
+  if (descriptor == -1) {
+    return {};
+  }
+
+  if (ftruncate(descriptor, static_cast<off_t>(size)) != 0) {
+    ::close(descriptor);
+    shm_unlink(name.c_str());
+    return {};
+  }
+
+  const auto mapping = map_shared_view(descriptor, size);
+  if (!mapping.data) {
+    shm_unlink(name.c_str());
+  }
+
+  return mapping;
+}
+
+CENTURION_LIB_INLINE auto open_shared_mapping(const std::string& name) noexcept
+    -> shared_mapping
+{
+  const auto descriptor = shm_open(name.c_str(), O_RDWR, 0);
+  if (descriptor == -1) {
+    return {};
+  }
+
+  struct stat info;
+  if (fstat(descriptor, &info) != 0 || info.st_size <= 0) {
+    ::close(descriptor);
+    return {};
+  }
+
+  return map_shared_view(descriptor, static_cast<usize>(info.st_size));
+}
+
+CENTURION_LIB_INLINE void close_shared_mapping(const std::string& name,
+                                               const shared_mapping& mapping,
+                                               const bool owner) noexcept
+{
+  if (mapping.data) {
+    munmap(mapping.data, mapping.size);
+  }
+
+  if (owner) {
+    shm_unlink(name.c_str());
+  }
+}
+
+#endif  // _WIN32
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SHARED_MEMORY_IMPL_HEADER
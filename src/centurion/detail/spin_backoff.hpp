@@ -0,0 +1,55 @@
+#ifndef CENTURION_DETAIL_SPIN_BACKOFF_HEADER
+#define CENTURION_DETAIL_SPIN_BACKOFF_HEADER
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>  // _mm_pause
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>  // _mm_pause
+#endif
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// Tells the CPU that the calling thread is busy waiting
+inline void cpu_relax() noexcept
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+  _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || defined(__arm__))
+  __asm__ __volatile__("yield");
+#endif
+}
+
+// Exponential backoff for spin loops, which doubles the pauses between attempts
+class spin_backoff final
+{
+ public:
+  // Returns false once the spin budget has been used up, and the caller should park
+  auto pause() noexcept -> bool
+  {
+    if (m_pauses > max_pauses) {
+      return false;
+    }
+
+    for (u32 index = 0; index < m_pauses; ++index) {
+      cpu_relax();
+    }
+
+    m_pauses *= 2;
+    return true;
+  }
+
+ private:
+  inline constexpr static u32 max_pauses = 64;  // 127 pauses in total before parking
+
+  u32 m_pauses{1};
+};
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SPIN_BACKOFF_HEADER
@@ -0,0 +1,109 @@
+#ifndef CENTURION_DETAIL_SPSC_BYTE_RING_HEADER
+#define CENTURION_DETAIL_SPSC_BYTE_RING_HEADER
+
+#include <algorithm>  // min
+#include <atomic>     // atomic, memory_order
+#include <cstring>    // memcpy
+#include <memory>     // unique_ptr, make_unique
+
+#include "../core/integers.hpp"
+#include "concurrent_utils.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/* A lock-free byte ring buffer for a single producer and a single consumer, which reads
+   and writes blocks of bytes instead of individual elements, like spsc_queue. */
+class spsc_byte_ring final
+{
+ public:
+  explicit spsc_byte_ring(const usize capacity)
+      : m_data{std::make_unique<u8[]>(ring_capacity(capacity))}
+      , m_mask{ring_capacity(capacity) - 1}
+  {}
+
+  spsc_byte_ring(const spsc_byte_ring&) = delete;
+
+  auto operator=(const spsc_byte_ring&) -> spsc_byte_ring& = delete;
+
+  // Writes as many bytes as there is room for, only called by the producer
+  auto write(const u8* data, const usize size) noexcept -> usize
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto head = m_head.load(std::memory_order_acquire);
+
+    const auto count = std::min(size, capacity() - (tail - head));
+    copy_in(tail, data, count);
+
+    m_tail.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  // Reads up to the requested amount of bytes, only called by the consumer
+  auto read(u8* data, const usize size) noexcept -> usize
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+
+    const auto count = std::min(size, tail - head);
+    copy_out(head, data, count);
+
+    m_head.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  // Discards up to the requested amount of bytes, only called by the consumer
+  auto skip(const usize size) noexcept -> usize
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+
+    const auto count = std::min(size, tail - head);
+    m_head.store(head + count, std::memory_order_release);
+
+    return count;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  [[nodiscard]] auto capacity() const noexcept -> usize
+  {
+    return m_mask + 1;
+  }
+
+ private:
+  std::unique_ptr<u8[]> m_data;
+  usize m_mask{};
+
+  alignas(cache_line) std::atomic<usize> m_head{};  // Written by the consumer
+  alignas(cache_line) std::atomic<usize> m_tail{};  // Written by the producer
+
+  // The copies are split in two where they wrap around the end of the buffer
+  void copy_in(const usize index, const u8* data, const usize count) noexcept
+  {
+    const auto offset = index & m_mask;
+    const auto first = std::min(count, capacity() - offset);
+
+    std::memcpy(m_data.get() + offset, data, first);
+    std::memcpy(m_data.get(), data + first, count - first);
+  }
+
+  void copy_out(const usize index, u8* data, const usize count) const noexcept
+  {
+    const auto offset = index & m_mask;
+    const auto first = std::min(count, capacity() - offset);
+
+    std::memcpy(data, m_data.get() + offset, first);
+    std::memcpy(data + first, m_data.get(), count - first);
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SPSC_BYTE_RING_HEADER
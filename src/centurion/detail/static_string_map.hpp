@@ -0,0 +1,179 @@
+#ifndef CENTURION_DETAIL_STATIC_STRING_MAP_HEADER
+#define CENTURION_DETAIL_STATIC_STRING_MAP_HEADER
+
+#include <array>        // array
+#include <type_traits>  // is_enum_v
+#include <utility>      // pair
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/str.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+[[nodiscard]] constexpr auto compare_czstrings(const str lhs, const str rhs) noexcept -> int
+{
+  usize index = 0;
+  while (lhs[index] != '\0' && lhs[index] == rhs[index]) {
+    ++index;
+  }
+
+  const auto a = static_cast<unsigned char>(lhs[index]);
+  const auto b = static_cast<unsigned char>(rhs[index]);
+
+  return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+/**
+ * \class static_string_map
+ *
+ * \brief A bidirectional map between enumerators and strings, known at compile-time.
+ *
+ * \details This is a faster alternative to `static_bimap` for enum hints, which are looked
+ * up whenever a hint is read or changes. Strings are looked up with a binary search over
+ * an array that is sorted at compile-time, and enumerators are looked up by indexing an
+ * array with their underlying value. The latter falls back to a linear search if the
+ * underlying values aren't all in the range [0, Size).
+ *
+ * \note This class is only meant to be used in constexpr contexts.
+ *
+ * \tparam Key the enum type of the keys.
+ * \tparam Size the amount of key-value pairs.
+ *
+ * \since 6.4.0
+ */
+template <typename Key, usize Size>
+class static_string_map final
+{
+  static_assert(std::is_enum_v<Key>);
+  static_assert(Size > 0);
+
+ public:
+  template <typename... Pairs>
+  constexpr static_string_map(const Pairs&... pairs)  // NOLINT implicit
+      : m_keys{pairs.first...}
+      , m_values{pairs.second...}
+  {
+    static_assert(sizeof...(Pairs) == Size);
+
+    for (usize index = 0; index < Size; ++index) {
+      if (!m_values[index]) {
+        throw cen_error{"Static string map values cannot be null!"};
+      }
+
+      m_order[index] = index;
+
+      if (!is_index(m_keys[index])) {
+        m_dense = false;
+      }
+    }
+
+    // Insertion sort, since std::sort isn't constexpr in C++17
+    for (usize i = 1; i < Size; ++i) {
+      for (usize j = i; j > 0; --j) {
+        const auto cmp = compare_czstrings(m_values[m_order[j]], m_values[m_order[j - 1]]);
+        if (cmp == 0) {
+          throw cen_error{"Static string map values must be unique!"};
+        }
+        else if (cmp > 0) {
+          break;
+        }
+
+        const auto tmp = m_order[j];
+        m_order[j] = m_order[j - 1];
+        m_order[j - 1] = tmp;
+      }
+    }
+
+    if (m_dense) {
+      std::array<bool, Size> used{};
+      for (usize index = 0; index < Size; ++index) {
+        const auto key = static_cast<usize>(m_keys[index]);
+        if (used[key]) {
+          throw cen_error{"Static string map keys must be unique!"};
+        }
+
+        used[key] = true;
+        m_byKey[key] = index;
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr auto find(const Key key) const -> const str&
+  {
+    if (m_dense) {
+      if (is_index(key)) {
+        return m_values[m_byKey[static_cast<usize>(key)]];
+      }
+    }
+    else {
+      for (usize index = 0; index < Size; ++index) {
+        if (m_keys[index] == key) {
+          return m_values[index];
+        }
+      }
+    }
+
+    throw cen_error{"Failed to find element in static map!"};
+  }
+
+  [[nodiscard]] constexpr auto key_from(const str value) const -> const Key&
+  {
+    if (const auto* key = find_key(value)) {
+      return *key;
+    }
+    else {
+      throw cen_error{"Failed to find key in static map!"};
+    }
+  }
+
+  [[nodiscard]] constexpr auto find_key(const str value) const noexcept -> const Key*
+  {
+    if (value) {
+      usize first = 0;
+      usize last = Size;
+
+      while (first < last) {
+        const auto middle = first + (last - first) / 2;
+        const auto index = m_order[middle];
+
+        const auto cmp = compare_czstrings(value, m_values[index]);
+        if (cmp == 0) {
+          return &m_keys[index];
+        }
+        else if (cmp < 0) {
+          last = middle;
+        }
+        else {
+          first = middle + 1;
+        }
+      }
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] constexpr static auto size() noexcept -> usize
+  {
+    return Size;
+  }
+
+ private:
+  std::array<Key, Size> m_keys{};
+  std::array<str, Size> m_values{};
+  std::array<usize, Size> m_order{};  ///< Indices of the values, sorted by value.
+  std::array<usize, Size> m_byKey{};  ///< Indices of the values, indexed by key.
+  bool m_dense{true};
+
+  [[nodiscard]] constexpr static auto is_index(const Key key) noexcept -> bool
+  {
+    const auto underlying = static_cast<i64>(key);
+    return underlying >= 0 && static_cast<u64>(underlying) < Size;
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_STATIC_STRING_MAP_HEADER
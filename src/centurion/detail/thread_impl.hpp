@@ -0,0 +1,44 @@
+#ifndef CENTURION_DETAIL_THREAD_IMPL_HEADER
+#define CENTURION_DETAIL_THREAD_IMPL_HEADER
+
+#if defined(_WIN32)
+#include "windows_include.hpp"
+#elif defined(__linux__)
+#include <pthread.h>  // pthread_self, pthread_setaffinity_np
+#include <sched.h>    // cpu_set_t, CPU_ZERO, CPU_SET
+#endif  // defined(_WIN32)
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../thread/thread.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+CENTURION_LIB_INLINE auto set_thread_affinity([[maybe_unused]] const u64 mask) noexcept
+    -> bool
+{
+#if defined(_WIN32)
+  return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(mask)) != 0;
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+
+  for (auto cpu = 0; cpu < 64; ++cpu) {
+    if (mask & (u64{1} << cpu)) {
+      CPU_SET(cpu, &set);
+    }
+  }
+
+  return pthread_setaffinity_np(pthread_self(), sizeof set, &set) == 0;
+#else
+  return false;
+#endif  // defined(_WIN32)
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_THREAD_IMPL_HEADER
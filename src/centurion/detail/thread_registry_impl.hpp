@@ -0,0 +1,101 @@
+#ifndef CENTURION_DETAIL_THREAD_REGISTRY_IMPL_HEADER
+#define CENTURION_DETAIL_THREAD_REGISTRY_IMPL_HEADER
+
+#include <cstdint>  // intptr_t
+
+#if defined(_WIN32)
+#include "windows_include.hpp"
+#elif defined(__linux__)
+#include <pthread.h>  // pthread_self, pthread_getcpuclockid
+#include <time.h>     // clockid_t, clock_gettime, timespec
+#endif  // defined(_WIN32)
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../thread/thread_registry.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+#if defined(_WIN32)
+
+CENTURION_LIB_INLINE auto open_thread_clock() noexcept -> thread_clock
+{
+  auto* handle = OpenThread(THREAD_QUERY_LIMITED_INFORMATION, FALSE, GetCurrentThreadId());
+  return {reinterpret_cast<std::intptr_t>(handle), handle != nullptr};
+}
+
+CENTURION_LIB_INLINE auto read_thread_clock(const thread_clock clock) noexcept
+    -> nanoseconds<u64>
+{
+  auto* handle = reinterpret_cast<HANDLE>(clock.handle);
+
+  FILETIME creation, exit, kernel, user;
+  if (clock.valid && GetThreadTimes(handle, &creation, &exit, &kernel, &user)) {
+    const auto ticks = (u64{kernel.dwHighDateTime} << 32 | kernel.dwLowDateTime) +
+                       (u64{user.dwHighDateTime} << 32 | user.dwLowDateTime);
+    return nanoseconds<u64>{ticks * 100};  // FILETIME counts 100 ns intervals
+  }
+
+  return nanoseconds<u64>::zero();
+}
+
+CENTURION_LIB_INLINE void close_thread_clock(const thread_clock clock) noexcept
+{
+  if (clock.valid) {
+    CloseHandle(reinterpret_cast<HANDLE>(clock.handle));
+  }
+}
+
+#elif defined(__linux__)
+
+CENTURION_LIB_INLINE auto open_thread_clock() noexcept -> thread_clock
+{
+  clockid_t clock{};
+  if (pthread_getcpuclockid(pthread_self(), &clock) == 0) {
+    return {static_cast<std::intptr_t>(clock), true};
+  }
+  else {
+    return {};
+  }
+}
+
+CENTURION_LIB_INLINE auto read_thread_clock(const thread_clock clock) noexcept
+    -> nanoseconds<u64>
+{
+  timespec time{};
+  if (clock.valid && clock_gettime(static_cast<clockid_t>(clock.handle), &time) == 0) {
+    return nanoseconds<u64>{static_cast<u64>(time.tv_sec) * 1'000'000'000 +
+                            static_cast<u64>(time.tv_nsec)};
+  }
+
+  return nanoseconds<u64>::zero();
+}
+
+CENTURION_LIB_INLINE void close_thread_clock(const thread_clock) noexcept
+{}
+
+#else
+
+CENTURION_LIB_INLINE auto open_thread_clock() noexcept -> thread_clock
+{
+  return {};
+}
+
+CENTURION_LIB_INLINE auto read_thread_clock(const thread_clock) noexcept -> nanoseconds<u64>
+{
+  return nanoseconds<u64>::zero();
+}
+
+CENTURION_LIB_INLINE void close_thread_clock(const thread_clock) noexcept
+{}
+
+#endif  // defined(_WIN32)
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_THREAD_REGISTRY_IMPL_HEADER
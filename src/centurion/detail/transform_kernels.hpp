@@ -0,0 +1,459 @@
+#ifndef CENTURION_DETAIL_TRANSFORM_KERNELS_HEADER
+#define CENTURION_DETAIL_TRANSFORM_KERNELS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+static_assert(sizeof(SDL_FRect) == 4 * sizeof(float));
+static_assert(sizeof(SDL_FPoint) == 2 * sizeof(float));
+
+// The coefficients of the affine transform [a c tx; b d ty; 0 0 1]
+struct affine_coefficients final
+{
+  float a{1};
+  float b{};
+  float c{};
+  float d{1};
+  float tx{};
+  float ty{};
+};
+
+inline void transform_point_scalar(const affine_coefficients& m, float& x, float& y) noexcept
+{
+  const auto px = x;
+  const auto py = y;
+  x = (m.a * px) + (m.c * py) + m.tx;
+  y = (m.b * px) + (m.d * py) + m.ty;
+}
+
+// Replaces a rectangle with the bounding box of the transformed rectangle
+inline void transform_rect_scalar(const affine_coefficients& m,
+                                  float& x,
+                                  float& y,
+                                  float& w,
+                                  float& h) noexcept
+{
+  const auto aw = m.a * w;
+  const auto bw = m.b * w;
+  const auto ch = m.c * h;
+  const auto dh = m.d * h;
+
+  transform_point_scalar(m, x, y);
+  x += ((aw < 0) ? aw : 0) + ((ch < 0) ? ch : 0);
+  y += ((bw < 0) ? bw : 0) + ((dh < 0) ? dh : 0);
+  w = ((aw < 0) ? -aw : aw) + ((ch < 0) ? -ch : ch);
+  h = ((bw < 0) ? -bw : bw) + ((dh < 0) ? -dh : dh);
+}
+
+inline void transform_points_scalar(const affine_coefficients& m,
+                                    SDL_FPoint* points,
+                                    const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    transform_point_scalar(m, points[index].x, points[index].y);
+  }
+}
+
+inline void transform_point_arrays_scalar(const affine_coefficients& m,
+                                          float* x,
+                                          float* y,
+                                          const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    transform_point_scalar(m, x[index], y[index]);
+  }
+}
+
+inline void transform_rects_scalar(const affine_coefficients& m,
+                                   SDL_FRect* rects,
+                                   const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    auto& rect = rects[index];
+    transform_rect_scalar(m, rect.x, rect.y, rect.w, rect.h);
+  }
+}
+
+inline void transform_rect_arrays_scalar(const affine_coefficients& m,
+                                         float* x,
+                                         float* y,
+                                         float* w,
+                                         float* h,
+                                         const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    transform_rect_scalar(m, x[index], y[index], w[index], h[index]);
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+// Transforms four rectangles, with their components in separate registers
+inline void transform_rects_sse2(const affine_coefficients& m,
+                                 __m128& x,
+                                 __m128& y,
+                                 __m128& w,
+                                 __m128& h) noexcept
+{
+  const auto zero = _mm_setzero_ps();
+  const auto sign = _mm_set1_ps(-0.0f);
+
+  const auto aw = _mm_mul_ps(_mm_set1_ps(m.a), w);
+  const auto bw = _mm_mul_ps(_mm_set1_ps(m.b), w);
+  const auto ch = _mm_mul_ps(_mm_set1_ps(m.c), h);
+  const auto dh = _mm_mul_ps(_mm_set1_ps(m.d), h);
+
+  const auto nx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.a), x),
+                                        _mm_mul_ps(_mm_set1_ps(m.c), y)),
+                             _mm_set1_ps(m.tx));
+  const auto ny = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m.b), x),
+                                        _mm_mul_ps(_mm_set1_ps(m.d), y)),
+                             _mm_set1_ps(m.ty));
+
+  x = _mm_add_ps(nx, _mm_add_ps(_mm_min_ps(aw, zero), _mm_min_ps(ch, zero)));
+  y = _mm_add_ps(ny, _mm_add_ps(_mm_min_ps(bw, zero), _mm_min_ps(dh, zero)));
+  w = _mm_add_ps(_mm_andnot_ps(sign, aw), _mm_andnot_ps(sign, ch));
+  h = _mm_add_ps(_mm_andnot_ps(sign, bw), _mm_andnot_ps(sign, dh));
+}
+
+inline void transform_points_sse2(const affine_coefficients& m,
+                                  SDL_FPoint* points,
+                                  const usize count) noexcept
+{
+  auto* data = reinterpret_cast<float*>(points);
+
+  // Each register holds two points, i.e. [x0, y0, x1, y1]
+  const auto ab = _mm_setr_ps(m.a, m.b, m.a, m.b);
+  const auto cd = _mm_setr_ps(m.c, m.d, m.c, m.d);
+  const auto t = _mm_setr_ps(m.tx, m.ty, m.tx, m.ty);
+
+  const auto transform = [&](const __m128 xy) noexcept {
+    const auto xx = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 2, 0, 0));
+    const auto yy = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 3, 1, 1));
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, ab), _mm_mul_ps(yy, cd)), t);
+  };
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto lo = _mm_loadu_ps(data + 2 * index);
+    const auto hi = _mm_loadu_ps(data + 2 * index + 4);
+
+    _mm_storeu_ps(data + 2 * index, transform(lo));
+    _mm_storeu_ps(data + 2 * index + 4, transform(hi));
+  }
+
+  transform_points_scalar(m, points + index, count - index);
+}
+
+inline void transform_point_arrays_sse2(const affine_coefficients& m,
+                                        float* x,
+                                        float* y,
+                                        const usize count) noexcept
+{
+  const auto a = _mm_set1_ps(m.a);
+  const auto b = _mm_set1_ps(m.b);
+  const auto c = _mm_set1_ps(m.c);
+  const auto d = _mm_set1_ps(m.d);
+  const auto tx = _mm_set1_ps(m.tx);
+  const auto ty = _mm_set1_ps(m.ty);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto px = _mm_loadu_ps(x + index);
+    const auto py = _mm_loadu_ps(y + index);
+
+    const auto nx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, px), _mm_mul_ps(c, py)), tx);
+    const auto ny = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b, px), _mm_mul_ps(d, py)), ty);
+
+    _mm_storeu_ps(x + index, nx);
+    _mm_storeu_ps(y + index, ny);
+  }
+
+  transform_point_arrays_scalar(m, x + index, y + index, count - index);
+}
+
+inline void transform_rects_sse2(const affine_coefficients& m,
+                                 SDL_FRect* rects,
+                                 const usize count) noexcept
+{
+  auto* data = reinterpret_cast<float*>(rects);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto r0 = _mm_loadu_ps(data + 4 * index);
+    auto r1 = _mm_loadu_ps(data + 4 * index + 4);
+    auto r2 = _mm_loadu_ps(data + 4 * index + 8);
+    auto r3 = _mm_loadu_ps(data + 4 * index + 12);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    transform_rects_sse2(m, r0, r1, r2, r3);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(data + 4 * index, r0);
+    _mm_storeu_ps(data + 4 * index + 4, r1);
+    _mm_storeu_ps(data + 4 * index + 8, r2);
+    _mm_storeu_ps(data + 4 * index + 12, r3);
+  }
+
+  transform_rects_scalar(m, rects + index, count - index);
+}
+
+inline void transform_rect_arrays_sse2(const affine_coefficients& m,
+                                       float* x,
+                                       float* y,
+                                       float* w,
+                                       float* h,
+                                       const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto rx = _mm_loadu_ps(x + index);
+    auto ry = _mm_loadu_ps(y + index);
+    auto rw = _mm_loadu_ps(w + index);
+    auto rh = _mm_loadu_ps(h + index);
+
+    transform_rects_sse2(m, rx, ry, rw, rh);
+
+    _mm_storeu_ps(x + index, rx);
+    _mm_storeu_ps(y + index, ry);
+    _mm_storeu_ps(w + index, rw);
+    _mm_storeu_ps(h + index, rh);
+  }
+
+  transform_rect_arrays_scalar(m,
+                               x + index,
+                               y + index,
+                               w + index,
+                               h + index,
+                               count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+// Transforms four points, with their components in separate registers
+inline void transform_points_neon(const affine_coefficients& m,
+                                  float32x4_t& x,
+                                  float32x4_t& y) noexcept
+{
+  const auto nx = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.tx), x, m.a), y, m.c);
+  const auto ny = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.ty), x, m.b), y, m.d);
+  x = nx;
+  y = ny;
+}
+
+// Transforms four rectangles, with their components in separate registers
+inline void transform_rects_neon(const affine_coefficients& m,
+                                 float32x4_t& x,
+                                 float32x4_t& y,
+                                 float32x4_t& w,
+                                 float32x4_t& h) noexcept
+{
+  const auto zero = vdupq_n_f32(0);
+
+  const auto aw = vmulq_n_f32(w, m.a);
+  const auto bw = vmulq_n_f32(w, m.b);
+  const auto ch = vmulq_n_f32(h, m.c);
+  const auto dh = vmulq_n_f32(h, m.d);
+
+  transform_points_neon(m, x, y);
+
+  x = vaddq_f32(x, vaddq_f32(vminq_f32(aw, zero), vminq_f32(ch, zero)));
+  y = vaddq_f32(y, vaddq_f32(vminq_f32(bw, zero), vminq_f32(dh, zero)));
+  w = vaddq_f32(vabsq_f32(aw), vabsq_f32(ch));
+  h = vaddq_f32(vabsq_f32(bw), vabsq_f32(dh));
+}
+
+inline void transform_points_neon(const affine_coefficients& m,
+                                  SDL_FPoint* points,
+                                  const usize count) noexcept
+{
+  auto* data = reinterpret_cast<float*>(points);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto lanes = vld2q_f32(data + 2 * index);
+    transform_points_neon(m, lanes.val[0], lanes.val[1]);
+    vst2q_f32(data + 2 * index, lanes);
+  }
+
+  transform_points_scalar(m, points + index, count - index);
+}
+
+inline void transform_point_arrays_neon(const affine_coefficients& m,
+                                        float* x,
+                                        float* y,
+                                        const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto px = vld1q_f32(x + index);
+    auto py = vld1q_f32(y + index);
+
+    transform_points_neon(m, px, py);
+
+    vst1q_f32(x + index, px);
+    vst1q_f32(y + index, py);
+  }
+
+  transform_point_arrays_scalar(m, x + index, y + index, count - index);
+}
+
+inline void transform_rects_neon(const affine_coefficients& m,
+                                 SDL_FRect* rects,
+                                 const usize count) noexcept
+{
+  auto* data = reinterpret_cast<float*>(rects);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto lanes = vld4q_f32(data + 4 * index);
+    transform_rects_neon(m, lanes.val[0], lanes.val[1], lanes.val[2], lanes.val[3]);
+    vst4q_f32(data + 4 * index, lanes);
+  }
+
+  transform_rects_scalar(m, rects + index, count - index);
+}
+
+inline void transform_rect_arrays_neon(const affine_coefficients& m,
+                                       float* x,
+                                       float* y,
+                                       float* w,
+                                       float* h,
+                                       const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto rx = vld1q_f32(x + index);
+    auto ry = vld1q_f32(y + index);
+    auto rw = vld1q_f32(w + index);
+    auto rh = vld1q_f32(h + index);
+
+    transform_rects_neon(m, rx, ry, rw, rh);
+
+    vst1q_f32(x + index, rx);
+    vst1q_f32(y + index, ry);
+    vst1q_f32(w + index, rw);
+    vst1q_f32(h + index, rh);
+  }
+
+  transform_rect_arrays_scalar(m,
+                               x + index,
+                               y + index,
+                               w + index,
+                               h + index,
+                               count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+inline void transform_points(const affine_coefficients& m,
+                             SDL_FPoint* points,
+                             const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    transform_points_sse2(m, points, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    transform_points_neon(m, points, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  transform_points_scalar(m, points, count);
+}
+
+inline void transform_point_arrays(const affine_coefficients& m,
+                                   float* x,
+                                   float* y,
+                                   const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    transform_point_arrays_sse2(m, x, y, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    transform_point_arrays_neon(m, x, y, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  transform_point_arrays_scalar(m, x, y, count);
+}
+
+inline void transform_rects(const affine_coefficients& m,
+                            SDL_FRect* rects,
+                            const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    transform_rects_sse2(m, rects, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    transform_rects_neon(m, rects, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  transform_rects_scalar(m, rects, count);
+}
+
+inline void transform_rect_arrays(const affine_coefficients& m,
+                                  float* x,
+                                  float* y,
+                                  float* w,
+                                  float* h,
+                                  const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    transform_rect_arrays_sse2(m, x, y, w, h, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    transform_rect_arrays_neon(m, x, y, w, h, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  transform_rect_arrays_scalar(m, x, y, w, h, count);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_TRANSFORM_KERNELS_HEADER
@@ -0,0 +1,324 @@
+#ifndef CENTURION_DETAIL_UTF_KERNELS_HEADER
+#define CENTURION_DETAIL_UTF_KERNELS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include <optional>  // optional, nullopt
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// Widens the leading ASCII characters, and returns the amount of widened characters
+[[nodiscard]] inline auto widen_ascii_scalar(const u8* src,
+                                             const usize count,
+                                             u16* dst) noexcept -> usize
+{
+  usize index = 0;
+  for (; index < count && src[index] < 0x80u; ++index) {
+    dst[index] = src[index];
+  }
+
+  return index;
+}
+
+// Narrows the leading ASCII code units, and returns the amount of narrowed code units
+[[nodiscard]] inline auto narrow_ascii_scalar(const u16* src,
+                                              const usize count,
+                                              u8* dst) noexcept -> usize
+{
+  usize index = 0;
+  for (; index < count && src[index] < 0x80u; ++index) {
+    dst[index] = static_cast<u8>(src[index]);
+  }
+
+  return index;
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+[[nodiscard]] inline auto widen_ascii_sse2(const u8* src, const usize count, u16* dst) noexcept
+    -> usize
+{
+  const auto zero = _mm_setzero_si128();
+
+  usize index = 0;
+  for (; index + 16 <= count; index += 16) {
+    const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+
+    // The most significant bit of every byte is clear for ASCII characters
+    if (_mm_movemask_epi8(bytes) != 0) {
+      break;
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index), _mm_unpacklo_epi8(bytes, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index + 8),
+                     _mm_unpackhi_epi8(bytes, zero));
+  }
+
+  return index + widen_ascii_scalar(src + index, count - index, dst + index);
+}
+
+[[nodiscard]] inline auto narrow_ascii_sse2(const u16* src,
+                                            const usize count,
+                                            u8* dst) noexcept -> usize
+{
+  const auto zero = _mm_setzero_si128();
+  const auto mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+
+    const auto ascii = _mm_cmpeq_epi16(_mm_and_si128(units, mask), zero);
+    if (_mm_movemask_epi8(ascii) != 0xFFFF) {
+      break;
+    }
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + index), _mm_packus_epi16(units, zero));
+  }
+
+  return index + narrow_ascii_scalar(src + index, count - index, dst + index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+[[nodiscard]] inline auto widen_ascii_neon(const u8* src, const usize count, u16* dst) noexcept
+    -> usize
+{
+  usize index = 0;
+  for (; index + 16 <= count; index += 16) {
+    const auto bytes = vld1q_u8(src + index);
+
+    // The most significant bit of every byte is clear for ASCII characters
+    const auto merged = vorr_u8(vget_low_u8(bytes), vget_high_u8(bytes));
+    if ((vget_lane_u64(vreinterpret_u64_u8(merged), 0) & 0x8080808080808080u) != 0) {
+      break;
+    }
+
+    vst1q_u16(dst + index, vmovl_u8(vget_low_u8(bytes)));
+    vst1q_u16(dst + index + 8, vmovl_u8(vget_high_u8(bytes)));
+  }
+
+  return index + widen_ascii_scalar(src + index, count - index, dst + index);
+}
+
+[[nodiscard]] inline auto narrow_ascii_neon(const u16* src,
+                                            const usize count,
+                                            u8* dst) noexcept -> usize
+{
+  usize index = 0;
+  for (; index + 8 <= count; index += 8) {
+    const auto units = vld1q_u16(src + index);
+
+    // Saturating the units shifted by seven bits to bytes leaves zero for ASCII code units
+    const auto high = vqshrn_n_u16(units, 7);
+    if (vget_lane_u64(vreinterpret_u64_u8(high), 0) != 0) {
+      break;
+    }
+
+    vst1_u8(dst + index, vmovn_u16(units));
+  }
+
+  return index + narrow_ascii_scalar(src + index, count - index, dst + index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+[[nodiscard]] inline auto widen_ascii(const u8* src, const usize count, u16* dst) noexcept
+    -> usize
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    return widen_ascii_sse2(src, count, dst);
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    return widen_ascii_neon(src, count, dst);
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  return widen_ascii_scalar(src, count, dst);
+}
+
+[[nodiscard]] inline auto narrow_ascii(const u16* src, const usize count, u8* dst) noexcept
+    -> usize
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    return narrow_ascii_sse2(src, count, dst);
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    return narrow_ascii_neon(src, count, dst);
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  return narrow_ascii_scalar(src, count, dst);
+}
+
+// The result of decoding a single UTF-8 sequence, where length is zero for invalid input
+struct utf8_sequence final
+{
+  u32 code{};
+  usize length{};
+};
+
+// Decodes the first code point of a non-empty UTF-8 string
+[[nodiscard]] inline auto decode_utf8_sequence(const u8* src, const usize count) noexcept
+    -> utf8_sequence
+{
+  const auto continuation = [&](const usize index) noexcept {
+    return index < count && (src[index] & 0xC0u) == 0x80u;
+  };
+
+  const u32 lead = src[0];
+
+  if (lead < 0x80u) {
+    return {lead, 1};
+  }
+  else if (lead >= 0xC2u && lead < 0xE0u) {
+    if (continuation(1)) {
+      return {((lead & 0x1Fu) << 6u) | (src[1] & 0x3Fu), 2};
+    }
+  }
+  else if (lead >= 0xE0u && lead < 0xF0u) {
+    if (continuation(1) && continuation(2)) {
+      const auto code = ((lead & 0x0Fu) << 12u) | ((src[1] & 0x3Fu) << 6u) | (src[2] & 0x3Fu);
+
+      // Reject overlong encodings and encoded surrogates
+      if (code >= 0x800u && (code < 0xD800u || code >= 0xE000u)) {
+        return {code, 3};
+      }
+    }
+  }
+  else if (lead >= 0xF0u && lead < 0xF5u) {
+    if (continuation(1) && continuation(2) && continuation(3)) {
+      const auto code = ((lead & 0x07u) << 18u) | ((src[1] & 0x3Fu) << 12u) |
+                        ((src[2] & 0x3Fu) << 6u) | (src[3] & 0x3Fu);
+
+      if (code >= 0x10000u && code <= 0x10FFFFu) {
+        return {code, 4};
+      }
+    }
+  }
+
+  // Continuation bytes, overlong leads, invalid bytes and truncated sequences
+  return {};
+}
+
+// The high and low surrogates of a code point outside of the BMP
+[[nodiscard]] constexpr auto high_surrogate(const u32 code) noexcept -> u16
+{
+  return static_cast<u16>(0xD800u | ((code - 0x10000u) >> 10u));
+}
+
+[[nodiscard]] constexpr auto low_surrogate(const u32 code) noexcept -> u16
+{
+  return static_cast<u16>(0xDC00u | ((code - 0x10000u) & 0x3FFu));
+}
+
+// Decodes UTF-8 to UTF-16, where dst must hold at least count code units. Returns the
+// amount of written code units, or nothing if the input isn't valid UTF-8.
+[[nodiscard]] inline auto decode_utf8(const u8* src, const usize count, u16* dst) noexcept
+    -> std::optional<usize>
+{
+  usize in = 0;
+  usize out = 0;
+  while (in < count) {
+    if (src[in] < 0x80u) {
+      const auto ascii = widen_ascii(src + in, count - in, dst + out);
+      in += ascii;
+      out += ascii;
+      continue;
+    }
+
+    const auto [code, length] = decode_utf8_sequence(src + in, count - in);
+    if (length == 0) {
+      return std::nullopt;
+    }
+
+    // Code points outside of the BMP are encoded as surrogate pairs
+    if (code >= 0x10000u) {
+      dst[out++] = high_surrogate(code);
+      dst[out++] = low_surrogate(code);
+    }
+    else {
+      dst[out++] = static_cast<u16>(code);
+    }
+
+    in += length;
+  }
+
+  return out;
+}
+
+// Encodes UTF-16 as UTF-8, where dst must hold at least three times count bytes. Returns
+// the amount of written bytes, or nothing if the input has unpaired surrogates.
+[[nodiscard]] inline auto encode_utf8(const u16* src, const usize count, u8* dst) noexcept
+    -> std::optional<usize>
+{
+  usize in = 0;
+  usize out = 0;
+  while (in < count) {
+    const u32 unit = src[in];
+
+    if (unit < 0x80u) {
+      const auto ascii = narrow_ascii(src + in, count - in, dst + out);
+      in += ascii;
+      out += ascii;
+    }
+    else if (unit < 0x800u) {
+      dst[out++] = static_cast<u8>(0xC0u | (unit >> 6u));
+      dst[out++] = static_cast<u8>(0x80u | (unit & 0x3Fu));
+      ++in;
+    }
+    else if (unit < 0xD800u || unit >= 0xE000u) {
+      dst[out++] = static_cast<u8>(0xE0u | (unit >> 12u));
+      dst[out++] = static_cast<u8>(0x80u | ((unit >> 6u) & 0x3Fu));
+      dst[out++] = static_cast<u8>(0x80u | (unit & 0x3Fu));
+      ++in;
+    }
+    else {
+      // A high surrogate must be followed by a low surrogate
+      const u32 next = (in + 1 < count) ? src[in + 1] : 0u;
+      if (unit >= 0xDC00u || next < 0xDC00u || next >= 0xE000u) {
+        return std::nullopt;
+      }
+
+      const auto code = 0x10000u + (((unit & 0x3FFu) << 10u) | (next & 0x3FFu));
+      dst[out++] = static_cast<u8>(0xF0u | (code >> 18u));
+      dst[out++] = static_cast<u8>(0x80u | ((code >> 12u) & 0x3Fu));
+      dst[out++] = static_cast<u8>(0x80u | ((code >> 6u) & 0x3Fu));
+      dst[out++] = static_cast<u8>(0x80u | (code & 0x3Fu));
+      in += 2;
+    }
+  }
+
+  return out;
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_UTF_KERNELS_HEADER
@@ -0,0 +1,604 @@
+#ifndef CENTURION_DETAIL_VECTOR_KERNELS_HEADER
+#define CENTURION_DETAIL_VECTOR_KERNELS_HEADER
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+#include <arm_neon.h>
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+#include <cmath>  // sqrt
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// The vectorized kernels perform the same operations in the same order as the scalar
+// kernels, without fused multiply-adds, so that all kernels produce identical results
+
+inline void dot3_scalar(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    const auto* u = a + 3 * index;
+    const auto* v = b + 3 * index;
+    out[index] = (u[0] * v[0]) + (u[1] * v[1]) + (u[2] * v[2]);
+  }
+}
+
+inline void dot4_scalar(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    const auto* u = a + 4 * index;
+    const auto* v = b + 4 * index;
+    out[index] = (u[0] * v[0]) + (u[1] * v[1]) + (u[2] * v[2]) + (u[3] * v[3]);
+  }
+}
+
+inline void cross3_scalar(const float* a,
+                          const float* b,
+                          float* out,
+                          const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    const auto* u = a + 3 * index;
+    const auto* v = b + 3 * index;
+    auto* r = out + 3 * index;
+
+    const auto x = (u[1] * v[2]) - (u[2] * v[1]);
+    const auto y = (u[2] * v[0]) - (u[0] * v[2]);
+    const auto z = (u[0] * v[1]) - (u[1] * v[0]);
+
+    r[0] = x;
+    r[1] = y;
+    r[2] = z;
+  }
+}
+
+// Computes the lengths of vectors with the specified amount of components
+template <usize Size>
+void lengths_scalar(const float* vectors, float* out, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    const auto* v = vectors + Size * index;
+
+    auto sum = v[0] * v[0];
+    for (usize component = 1; component < Size; ++component) {
+      sum += v[component] * v[component];
+    }
+
+    out[index] = std::sqrt(sum);
+  }
+}
+
+// Normalizes vectors with the specified amount of components, zero vectors are ignored
+template <usize Size>
+void normalize_scalar(float* vectors, const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    auto* v = vectors + Size * index;
+
+    auto sum = v[0] * v[0];
+    for (usize component = 1; component < Size; ++component) {
+      sum += v[component] * v[component];
+    }
+
+    const auto length = std::sqrt(sum);
+    if (length > 0) {
+      for (usize component = 0; component < Size; ++component) {
+        v[component] /= length;
+      }
+    }
+  }
+}
+
+inline void multiply_add_scalar(float* dst,
+                                const float* src,
+                                const float factor,
+                                const usize count) noexcept
+{
+  for (usize index = 0; index < count; ++index) {
+    dst[index] += src[index] * factor;
+  }
+}
+
+#if CENTURION_HAS_FEATURE_SSE2
+
+// Loads four 3D vectors, with each component in a separate register
+inline void load3_sse2(const float* data, __m128& x, __m128& y, __m128& z) noexcept
+{
+  const auto a = _mm_loadu_ps(data);      // x0 y0 z0 x1
+  const auto b = _mm_loadu_ps(data + 4);  // y1 z1 x2 y2
+  const auto c = _mm_loadu_ps(data + 8);  // z2 x3 y3 z3
+
+  const auto bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));  // x2 x2 x3 x3
+  const auto ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));  // y0 y0 y1 y1
+  const auto cb = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));  // y2 y2 y3 y3
+  const auto az = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));  // z0 z0 z1 z1
+
+  x = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+  y = _mm_shuffle_ps(ab, cb, _MM_SHUFFLE(2, 0, 2, 0));
+  z = _mm_shuffle_ps(az, c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// Stores four 3D vectors, with each component in a separate register
+inline void store3_sse2(float* data, const __m128 x, const __m128 y, const __m128 z) noexcept
+{
+  const auto xy0 = _mm_unpacklo_ps(x, y);                          // x0 y0 x1 y1
+  const auto zx0 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));  // z0 z0 x1 x1
+  const auto yz1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));  // y1 y1 z1 z1
+  const auto xy2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));  // x2 x2 y2 y2
+  const auto zx2 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));  // z2 z2 x3 x3
+  const auto yz3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));  // y3 y3 z3 z3
+
+  _mm_storeu_ps(data, _mm_shuffle_ps(xy0, zx0, _MM_SHUFFLE(2, 0, 1, 0)));
+  _mm_storeu_ps(data + 4, _mm_shuffle_ps(yz1, xy2, _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(data + 8, _mm_shuffle_ps(zx2, yz3, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+inline void load4_sse2(const float* data, __m128& x, __m128& y, __m128& z, __m128& w) noexcept
+{
+  x = _mm_loadu_ps(data);
+  y = _mm_loadu_ps(data + 4);
+  z = _mm_loadu_ps(data + 8);
+  w = _mm_loadu_ps(data + 12);
+  _MM_TRANSPOSE4_PS(x, y, z, w);
+}
+
+inline void store4_sse2(float* data, __m128 x, __m128 y, __m128 z, __m128 w) noexcept
+{
+  _MM_TRANSPOSE4_PS(x, y, z, w);
+  _mm_storeu_ps(data, x);
+  _mm_storeu_ps(data + 4, y);
+  _mm_storeu_ps(data + 8, z);
+  _mm_storeu_ps(data + 12, w);
+}
+
+inline auto dot3_sse2(const __m128 ax,
+                      const __m128 ay,
+                      const __m128 az,
+                      const __m128 bx,
+                      const __m128 by,
+                      const __m128 bz) noexcept -> __m128
+{
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+}
+
+// Divides the components by the length, unless the length is zero
+inline auto divide_nonzero_sse2(const __m128 value, const __m128 length) noexcept -> __m128
+{
+  const auto nonzero = _mm_cmpgt_ps(length, _mm_setzero_ps());
+  return _mm_or_ps(_mm_and_ps(nonzero, _mm_div_ps(value, length)),
+                   _mm_andnot_ps(nonzero, value));
+}
+
+inline void dot3_sse2(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 ax, ay, az, bx, by, bz;
+    load3_sse2(a + 3 * index, ax, ay, az);
+    load3_sse2(b + 3 * index, bx, by, bz);
+    _mm_storeu_ps(out + index, dot3_sse2(ax, ay, az, bx, by, bz));
+  }
+
+  dot3_scalar(a + 3 * index, b + 3 * index, out + index, count - index);
+}
+
+inline void dot4_sse2(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 ax, ay, az, aw, bx, by, bz, bw;
+    load4_sse2(a + 4 * index, ax, ay, az, aw);
+    load4_sse2(b + 4 * index, bx, by, bz, bw);
+
+    const auto xyz = dot3_sse2(ax, ay, az, bx, by, bz);
+    _mm_storeu_ps(out + index, _mm_add_ps(xyz, _mm_mul_ps(aw, bw)));
+  }
+
+  dot4_scalar(a + 4 * index, b + 4 * index, out + index, count - index);
+}
+
+inline void cross3_sse2(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 ax, ay, az, bx, by, bz;
+    load3_sse2(a + 3 * index, ax, ay, az);
+    load3_sse2(b + 3 * index, bx, by, bz);
+
+    const auto x = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+    const auto y = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+    const auto z = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+
+    store3_sse2(out + 3 * index, x, y, z);
+  }
+
+  cross3_scalar(a + 3 * index, b + 3 * index, out + 3 * index, count - index);
+}
+
+inline void lengths3_sse2(const float* vectors, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 x, y, z;
+    load3_sse2(vectors + 3 * index, x, y, z);
+    _mm_storeu_ps(out + index, _mm_sqrt_ps(dot3_sse2(x, y, z, x, y, z)));
+  }
+
+  lengths_scalar<3>(vectors + 3 * index, out + index, count - index);
+}
+
+inline void lengths4_sse2(const float* vectors, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 x, y, z, w;
+    load4_sse2(vectors + 4 * index, x, y, z, w);
+
+    const auto sum = _mm_add_ps(dot3_sse2(x, y, z, x, y, z), _mm_mul_ps(w, w));
+    _mm_storeu_ps(out + index, _mm_sqrt_ps(sum));
+  }
+
+  lengths_scalar<4>(vectors + 4 * index, out + index, count - index);
+}
+
+inline void normalize3_sse2(float* vectors, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 x, y, z;
+    load3_sse2(vectors + 3 * index, x, y, z);
+
+    const auto length = _mm_sqrt_ps(dot3_sse2(x, y, z, x, y, z));
+    store3_sse2(vectors + 3 * index,
+                divide_nonzero_sse2(x, length),
+                divide_nonzero_sse2(y, length),
+                divide_nonzero_sse2(z, length));
+  }
+
+  normalize_scalar<3>(vectors + 3 * index, count - index);
+}
+
+inline void normalize4_sse2(float* vectors, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    __m128 x, y, z, w;
+    load4_sse2(vectors + 4 * index, x, y, z, w);
+
+    const auto sum = _mm_add_ps(dot3_sse2(x, y, z, x, y, z), _mm_mul_ps(w, w));
+    const auto length = _mm_sqrt_ps(sum);
+    store4_sse2(vectors + 4 * index,
+                divide_nonzero_sse2(x, length),
+                divide_nonzero_sse2(y, length),
+                divide_nonzero_sse2(z, length),
+                divide_nonzero_sse2(w, length));
+  }
+
+  normalize_scalar<4>(vectors + 4 * index, count - index);
+}
+
+inline void multiply_add_sse2(float* dst,
+                              const float* src,
+                              const float factor,
+                              const usize count) noexcept
+{
+  const auto f = _mm_set1_ps(factor);
+
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto product = _mm_mul_ps(_mm_loadu_ps(src + index), f);
+    _mm_storeu_ps(dst + index, _mm_add_ps(_mm_loadu_ps(dst + index), product));
+  }
+
+  multiply_add_scalar(dst + index, src + index, factor, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+
+inline auto dot3_neon(const float32x4x3_t& a, const float32x4x3_t& b) noexcept -> float32x4_t
+{
+  return vaddq_f32(vaddq_f32(vmulq_f32(a.val[0], b.val[0]), vmulq_f32(a.val[1], b.val[1])),
+                   vmulq_f32(a.val[2], b.val[2]));
+}
+
+inline auto dot4_neon(const float32x4x4_t& a, const float32x4x4_t& b) noexcept -> float32x4_t
+{
+  const auto xy = vaddq_f32(vmulq_f32(a.val[0], b.val[0]), vmulq_f32(a.val[1], b.val[1]));
+  const auto xyz = vaddq_f32(xy, vmulq_f32(a.val[2], b.val[2]));
+  return vaddq_f32(xyz, vmulq_f32(a.val[3], b.val[3]));
+}
+
+inline void dot3_neon(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(out + index, dot3_neon(vld3q_f32(a + 3 * index), vld3q_f32(b + 3 * index)));
+  }
+
+  dot3_scalar(a + 3 * index, b + 3 * index, out + index, count - index);
+}
+
+inline void dot4_neon(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    vst1q_f32(out + index, dot4_neon(vld4q_f32(a + 4 * index), vld4q_f32(b + 4 * index)));
+  }
+
+  dot4_scalar(a + 4 * index, b + 4 * index, out + index, count - index);
+}
+
+inline void cross3_neon(const float* a, const float* b, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto u = vld3q_f32(a + 3 * index);
+    const auto v = vld3q_f32(b + 3 * index);
+
+    float32x4x3_t r;
+    r.val[0] = vsubq_f32(vmulq_f32(u.val[1], v.val[2]), vmulq_f32(u.val[2], v.val[1]));
+    r.val[1] = vsubq_f32(vmulq_f32(u.val[2], v.val[0]), vmulq_f32(u.val[0], v.val[2]));
+    r.val[2] = vsubq_f32(vmulq_f32(u.val[0], v.val[1]), vmulq_f32(u.val[1], v.val[0]));
+
+    vst3q_f32(out + 3 * index, r);
+  }
+
+  cross3_scalar(a + 3 * index, b + 3 * index, out + 3 * index, count - index);
+}
+
+// Division and square roots of vectors are only available on AArch64
+#if defined(__aarch64__)
+
+// Divides the components by the length, unless the length is zero
+inline auto divide_nonzero_neon(const float32x4_t value, const float32x4_t length) noexcept
+    -> float32x4_t
+{
+  const auto nonzero = vcgtq_f32(length, vdupq_n_f32(0));
+  return vbslq_f32(nonzero, vdivq_f32(value, length), value);
+}
+
+inline void lengths3_neon(const float* vectors, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto v = vld3q_f32(vectors + 3 * index);
+    vst1q_f32(out + index, vsqrtq_f32(dot3_neon(v, v)));
+  }
+
+  lengths_scalar<3>(vectors + 3 * index, out + index, count - index);
+}
+
+inline void lengths4_neon(const float* vectors, float* out, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto v = vld4q_f32(vectors + 4 * index);
+    vst1q_f32(out + index, vsqrtq_f32(dot4_neon(v, v)));
+  }
+
+  lengths_scalar<4>(vectors + 4 * index, out + index, count - index);
+}
+
+inline void normalize3_neon(float* vectors, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto v = vld3q_f32(vectors + 3 * index);
+
+    const auto length = vsqrtq_f32(dot3_neon(v, v));
+    for (auto& component : v.val) {
+      component = divide_nonzero_neon(component, length);
+    }
+
+    vst3q_f32(vectors + 3 * index, v);
+  }
+
+  normalize_scalar<3>(vectors + 3 * index, count - index);
+}
+
+inline void normalize4_neon(float* vectors, const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    auto v = vld4q_f32(vectors + 4 * index);
+
+    const auto length = vsqrtq_f32(dot4_neon(v, v));
+    for (auto& component : v.val) {
+      component = divide_nonzero_neon(component, length);
+    }
+
+    vst4q_f32(vectors + 4 * index, v);
+  }
+
+  normalize_scalar<4>(vectors + 4 * index, count - index);
+}
+
+#endif  // defined(__aarch64__)
+
+inline void multiply_add_neon(float* dst,
+                              const float* src,
+                              const float factor,
+                              const usize count) noexcept
+{
+  usize index = 0;
+  for (; index + 4 <= count; index += 4) {
+    const auto product = vmulq_n_f32(vld1q_f32(src + index), factor);
+    vst1q_f32(dst + index, vaddq_f32(vld1q_f32(dst + index), product));
+  }
+
+  multiply_add_scalar(dst + index, src + index, factor, count - index);
+}
+
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+inline void dot3(const float* a, const float* b, float* out, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    dot3_sse2(a, b, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    dot3_neon(a, b, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  dot3_scalar(a, b, out, count);
+}
+
+inline void dot4(const float* a, const float* b, float* out, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    dot4_sse2(a, b, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    dot4_neon(a, b, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  dot4_scalar(a, b, out, count);
+}
+
+inline void cross3(const float* a, const float* b, float* out, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    cross3_sse2(a, b, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    cross3_neon(a, b, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  cross3_scalar(a, b, out, count);
+}
+
+inline void lengths3(const float* vectors, float* out, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    lengths3_sse2(vectors, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+  if (cpu::has_neon()) {
+    lengths3_neon(vectors, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+
+  lengths_scalar<3>(vectors, out, count);
+}
+
+inline void lengths4(const float* vectors, float* out, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    lengths4_sse2(vectors, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+  if (cpu::has_neon()) {
+    lengths4_neon(vectors, out, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+
+  lengths_scalar<4>(vectors, out, count);
+}
+
+inline void normalize3(float* vectors, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    normalize3_sse2(vectors, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+  if (cpu::has_neon()) {
+    normalize3_neon(vectors, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+
+  normalize_scalar<3>(vectors, count);
+}
+
+inline void normalize4(float* vectors, const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    normalize4_sse2(vectors, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+  if (cpu::has_neon()) {
+    normalize4_neon(vectors, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON && defined(__aarch64__)
+
+  normalize_scalar<4>(vectors, count);
+}
+
+inline void multiply_add(float* dst,
+                         const float* src,
+                         const float factor,
+                         const usize count) noexcept
+{
+#if CENTURION_HAS_FEATURE_SSE2
+  if (cpu::has_sse2()) {
+    multiply_add_sse2(dst, src, factor, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#if CENTURION_HAS_FEATURE_NEON
+  if (cpu::has_neon()) {
+    multiply_add_neon(dst, src, factor, count);
+    return;
+  }
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+  multiply_add_scalar(dst, src, factor, count);
+}
+
+}  // namespace cen::detail
+
+/// \endcond
+
+#endif  // CENTURION_DETAIL_VECTOR_KERNELS_HEADER
@@ -0,0 +1,37 @@
+#ifndef CENTURION_DETAIL_WINDOWS_INCLUDE_HEADER
+#define CENTURION_DETAIL_WINDOWS_INCLUDE_HEADER
+
+#ifdef _WIN32
+
+/*
+ * Includes <windows.h> for the platform implementation headers, without leaving any
+ * macros defined. NOMINMAX and WIN32_LEAN_AND_MEAN are only defined for the duration of
+ * the include, unless they were already defined by the consumer, so the min/max macros
+ * and the legacy Winsock declarations are never pulled in.
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#define CENTURION_UNDEF_NOMINMAX
+#endif  // NOMINMAX
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define CENTURION_UNDEF_WIN32_LEAN_AND_MEAN
+#endif  // WIN32_LEAN_AND_MEAN
+
+#include <windows.h>
+
+#ifdef CENTURION_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef CENTURION_UNDEF_NOMINMAX
+#endif  // CENTURION_UNDEF_NOMINMAX
+
+#ifdef CENTURION_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef CENTURION_UNDEF_WIN32_LEAN_AND_MEAN
+#endif  // CENTURION_UNDEF_WIN32_LEAN_AND_MEAN
+
+#endif  // _WIN32
+
+#endif  // CENTURION_DETAIL_WINDOWS_INCLUDE_HEADER
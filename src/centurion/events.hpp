@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019-2021 Albin Johansson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CENTURION_EVENTS_MODULE_HEADER
+#define CENTURION_EVENTS_MODULE_HEADER
+
+#ifndef CENTURION_NO_PRAGMA_ONCE
+#pragma once
+#endif  // CENTURION_NO_PRAGMA_ONCE
+
+// Event types and event dispatching.
+
+#include "events/audio_device_event.hpp"
+#include "events/common_event.hpp"
+#include "events/controller_axis_event.hpp"
+#include "events/controller_button_event.hpp"
+#include "events/controller_device_event.hpp"
+#include "events/controller_sensor_event.hpp"
+#include "events/controller_touchpad_event.hpp"
+#include "events/dispatch_stats.hpp"
+#include "events/display_event.hpp"
+#include "events/display_event_id.hpp"
+#include "events/dollar_gesture_event.hpp"
+#include "events/drop_event.hpp"
+#include "events/event.hpp"
+#include "events/event_channel.hpp"
+#include "events/event_coalescer.hpp"
+#include "events/event_dispatcher.hpp"
+#include "events/event_listeners.hpp"
+#include "events/event_prefilter.hpp"
+#include "events/event_recording.hpp"
+#include "events/event_type.hpp"
+#include "events/event_view.hpp"
+#include "events/events_fwd.hpp"
+#include "events/frame_pacer.hpp"
+#include "events/joy_axis_event.hpp"
+#include "events/joy_ball_event.hpp"
+#include "events/joy_button_event.hpp"
+#include "events/joy_device_event.hpp"
+#include "events/joy_hat_event.hpp"
+#include "events/keyboard_event.hpp"
+#include "events/mouse_button_event.hpp"
+#include "events/mouse_motion_event.hpp"
+#include "events/mouse_wheel_direction.hpp"
+#include "events/mouse_wheel_event.hpp"
+#include "events/multi_gesture_event.hpp"
+#include "events/quit_event.hpp"
+#include "events/sensor_event.hpp"
+#include "events/text_editing_event.hpp"
+#include "events/text_input_event.hpp"
+#include "events/touch_finger_event.hpp"
+#include "events/user_event.hpp"
+#include "events/window_event.hpp"
+#include "events/window_event_id.hpp"
+
+#endif  // CENTURION_EVENTS_MODULE_HEADER
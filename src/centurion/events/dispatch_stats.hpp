@@ -0,0 +1,155 @@
+#ifndef CENTURION_DISPATCH_STATS_HEADER
+#define CENTURION_DISPATCH_STATS_HEADER
+
+#include <array>  // array
+#include <map>    // map
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "event_type.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \struct latency_histogram
+ *
+ * \brief A histogram of durations, using exponentially growing buckets.
+ *
+ * \details The first bucket counts durations shorter than 256 nanoseconds, and the upper
+ * bound of each following bucket is twice the upper bound of the previous bucket. The
+ * last bucket counts all durations that don't fit in the other buckets.
+ *
+ * \since 6.4.0
+ */
+struct latency_histogram final
+{
+  inline constexpr static usize bucket_count = 20;
+
+  std::array<usize, bucket_count> buckets{};  ///< The amount of durations per bucket.
+  usize count{};                               ///< The total amount of durations.
+  nanoseconds<u64> total{};                    ///< The sum of all durations.
+  nanoseconds<u64> max{};                      ///< The longest duration.
+
+  /**
+   * \brief Adds a duration to the histogram.
+   *
+   * \param duration the duration that will be added.
+   *
+   * \since 6.4.0
+   */
+  void record(const nanoseconds<u64> duration) noexcept
+  {
+    usize bucket = 0;
+    while (bucket < bucket_count - 1 && duration.count() >= upper_bound(bucket)) {
+      ++bucket;
+    }
+
+    ++buckets[bucket];
+    ++count;
+    total += duration;
+
+    if (duration > max) {
+      max = duration;
+    }
+  }
+
+  /**
+   * \brief Returns the mean of all recorded durations.
+   *
+   * \return the mean duration; zero if no durations have been recorded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto mean() const noexcept -> nanoseconds<u64>
+  {
+    return count != 0 ? total / count : nanoseconds<u64>{};
+  }
+
+  /**
+   * \brief Returns the exclusive upper bound of a bucket, in nanoseconds.
+   *
+   * \param bucket the index of the bucket, the last bucket has no upper bound.
+   *
+   * \return the upper bound of the bucket.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto upper_bound(const usize bucket) noexcept -> u64
+  {
+    return u64{256} << bucket;
+  }
+};
+
+/**
+ * \struct event_type_stats
+ *
+ * \brief Provides statistics about a single event type handled by an event dispatcher.
+ *
+ * \since 6.4.0
+ */
+struct event_type_stats final
+{
+  usize count{};                  ///< The amount of received events.
+  usize handled{};                ///< The amount of events that were passed to handlers.
+  latency_histogram handlerTime;  ///< The time spent in the handlers of the events.
+};
+
+/**
+ * \struct dispatch_stats
+ *
+ * \brief Provides the statistics collected by an instrumented event dispatcher.
+ *
+ * \details This is a plain struct, which can be forwarded to telemetry systems as is.
+ * Queue depths are sampled with `event::queue_count()` at the start of every poll.
+ *
+ * \see `event_dispatcher::set_instrumented()`
+ *
+ * \since 6.4.0
+ */
+struct dispatch_stats final
+{
+  std::map<event_type, event_type_stats> types;  ///< Statistics per event type.
+  usize polls{};                                 ///< The amount of sampled polls.
+  usize maxQueueDepth{};                         ///< The deepest sampled queue.
+  usize totalQueueDepth{};                       ///< The sum of all sampled queue depths.
+
+  /**
+   * \brief Returns the total amount of received events.
+   *
+   * \return the number of received events, of all types.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto total_events() const noexcept -> usize
+  {
+    usize total = 0;
+
+    for (const auto& [type, stats] : types) {
+      total += stats.count;
+    }
+
+    return total;
+  }
+
+  /**
+   * \brief Returns the average amount of events in the event queue when polling.
+   *
+   * \return the mean sampled queue depth; zero if no polls have been sampled.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto mean_queue_depth() const noexcept -> double
+  {
+    return polls != 0 ? static_cast<double>(totalQueueDepth) / static_cast<double>(polls)
+                      : 0.0;
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_DISPATCH_STATS_HEADER
@@ -3,12 +3,18 @@
 
 #include <SDL2/SDL.h>
 
-#include <optional>  // optional
-#include <utility>   // move
-#include <variant>   // variant, holds_alternative, monostate, get, get_if
-
+#include <cassert>      // assert
+#include <optional>     // optional
+#include <type_traits>  // is_same_v
+#include <utility>      // move
+#include <variant>      // variant, holds_alternative, monostate, get, get_if
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
 #include "../core/result.hpp"
+#include "../core/time.hpp"
 #include "../core/to_underlying.hpp"
+#include "../system/profiler_macros.hpp"
 #include "audio_device_event.hpp"
 #include "common_event.hpp"
 #include "controller_axis_event.hpp"
@@ -43,6 +49,182 @@ namespace cen {
 /// \addtogroup event
 /// \{
 
+/// \cond FALSE
+
+namespace detail {
+
+template <typename T>
+struct event_tag final
+{
+  using type = T;
+};
+
+/* Invokes the visitor with a tag for the event type that corresponds to the supplied SDL
+   event, along with the associated SDL event data, without creating the event. Unknown
+   events are reported as std::monostate, and the visitor isn't invoked at all for known
+   events that don't have a dedicated event type. */
+template <typename Visitor>
+void visit_event(const SDL_Event& event, Visitor&& visitor)
+{
+  switch (static_cast<event_type>(event.type)) {
+    case event_type::quit:
+      visitor(event_tag<quit_event>{}, event.quit);
+      break;
+
+    case event_type::app_terminating:
+    case event_type::app_low_memory:
+    case event_type::app_will_enter_background:
+    case event_type::app_did_enter_background:
+    case event_type::app_will_enter_foreground:
+    case event_type::app_did_enter_foreground:
+      break;
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    case event_type::locale_changed:
+      break;
+
+    case event_type::display:
+      visitor(event_tag<display_event>{}, event.display);
+      break;
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+    case event_type::window:
+      visitor(event_tag<window_event>{}, event.window);
+      break;
+
+    case event_type::system:
+      break;
+
+    case event_type::key_down:
+    case event_type::key_up:
+      visitor(event_tag<keyboard_event>{}, event.key);
+      break;
+
+    case event_type::text_editing:
+      visitor(event_tag<text_editing_event>{}, event.edit);
+      break;
+
+    case event_type::text_input:
+      visitor(event_tag<text_input_event>{}, event.text);
+      break;
+
+    case event_type::keymap_changed:
+      break;
+
+    case event_type::mouse_motion:
+      visitor(event_tag<mouse_motion_event>{}, event.motion);
+      break;
+
+    case event_type::mouse_button_down:
+    case event_type::mouse_button_up:
+      visitor(event_tag<mouse_button_event>{}, event.button);
+      break;
+
+    case event_type::mouse_wheel:
+      visitor(event_tag<mouse_wheel_event>{}, event.wheel);
+      break;
+
+    case event_type::joystick_axis_motion:
+      visitor(event_tag<joy_axis_event>{}, event.jaxis);
+      break;
+
+    case event_type::joystick_ball_motion:
+      visitor(event_tag<joy_ball_event>{}, event.jball);
+      break;
+
+    case event_type::joystick_hat_motion:
+      visitor(event_tag<joy_hat_event>{}, event.jhat);
+      break;
+
+    case event_type::joystick_button_down:
+    case event_type::joystick_button_up:
+      visitor(event_tag<joy_button_event>{}, event.jbutton);
+      break;
+
+    case event_type::joystick_device_added:
+    case event_type::joystick_device_removed:
+      visitor(event_tag<joy_device_event>{}, event.jdevice);
+      break;
+
+    case event_type::controller_axis_motion:
+      visitor(event_tag<controller_axis_event>{}, event.caxis);
+      break;
+
+    case event_type::controller_button_down:
+    case event_type::controller_button_up:
+      visitor(event_tag<controller_button_event>{}, event.cbutton);
+      break;
+
+    case event_type::controller_device_added:
+    case event_type::controller_device_removed:
+    case event_type::controller_device_remapped:
+      visitor(event_tag<controller_device_event>{}, event.cdevice);
+      break;
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    case event_type::controller_touchpad_down:
+    case event_type::controller_touchpad_up:
+    case event_type::controller_touchpad_motion:
+      visitor(event_tag<controller_touchpad_event>{}, event.ctouchpad);
+      break;
+
+    case event_type::controller_sensor_update:
+      visitor(event_tag<controller_sensor_event>{}, event.csensor);
+      break;
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+    case event_type::touch_down:
+    case event_type::touch_up:
+    case event_type::touch_motion:
+      visitor(event_tag<touch_finger_event>{}, event.tfinger);
+      break;
+
+    case event_type::dollar_gesture:
+    case event_type::dollar_record:
+      visitor(event_tag<dollar_gesture_event>{}, event.dgesture);
+      break;
+
+    case event_type::multi_gesture:
+      visitor(event_tag<multi_gesture_event>{}, event.mgesture);
+      break;
+
+    case event_type::clipboard_update:
+      break;
+
+    case event_type::drop_file:
+    case event_type::drop_text:
+    case event_type::drop_begin:
+    case event_type::drop_complete:
+      visitor(event_tag<drop_event>{}, event.drop);
+      break;
+
+    case event_type::audio_device_added:
+    case event_type::audio_device_removed:
+      visitor(event_tag<audio_device_event>{}, event.adevice);
+      break;
+
+    case event_type::sensor_update:
+      visitor(event_tag<sensor_event>{}, event.sensor);
+      break;
+
+    case event_type::render_targets_reset:
+    case event_type::render_device_reset:
+      break;
+
+    case event_type::user:
+      visitor(event_tag<user_event>{}, event.user);
+      break;
+
+    default:
+      visitor(event_tag<std::monostate>{}, event);
+      break;
+  }
+}
+
+}  // namespace detail
+
+/// \endcond
+
 /**
  * \class event
  *
@@ -71,13 +253,13 @@ class event final
    */
   explicit event(const SDL_Event& event) noexcept : m_event{event}
   {
-    update_data(static_cast<event_type>(event.type));
+    update_data();
   }
 
   template <typename T>
   explicit event(const common_event<T>& event) noexcept : m_event{as_sdl_event(event)}
   {
-    update_data(event.type());
+    update_data();
   }
 
   /**
@@ -160,16 +342,78 @@ class event final
    */
   auto poll() noexcept -> bool
   {
-    const bool result = SDL_PollEvent(&m_event);
+    CENTURION_PROFILE_ZONE("event::poll");
 
-    if (result) {
-      update_data(static_cast<event_type>(m_event.type));
-    }
-    else {
-      m_data.emplace<std::monostate>();
-    }
+    return accept(SDL_PollEvent(&m_event));
+  }
+
+  /**
+   * \brief Waits indefinitely for the next available event.
+   *
+   * \details Unlike `poll()`, this function puts the calling thread to sleep until an
+   * event is available, which avoids spinning the CPU while the application is idle.
+   *
+   * \return `true` if an event was obtained; `false` if something went wrong.
+   *
+   * \see `SDL_WaitEvent`
+   *
+   * \since 6.4.0
+   */
+  auto wait() noexcept -> bool
+  {
+    return accept(SDL_WaitEvent(&m_event));
+  }
+
+  /**
+   * \brief Waits for the next available event, until a timeout is reached.
+   *
+   * \param timeout the maximum amount of time to wait for an event.
+   *
+   * \return `true` if an event was obtained; `false` if the timeout was reached or if
+   * something went wrong.
+   *
+   * \see `SDL_WaitEventTimeout`
+   *
+   * \since 6.4.0
+   */
+  auto wait_for(const milliseconds<int> timeout) noexcept(noexcept(timeout.count())) -> bool
+  {
+    return accept(SDL_WaitEventTimeout(&m_event, timeout.count()));
+  }
+
+  /**
+   * \brief Moves a batch of events from the event queue into a buffer.
+   *
+   * \details This function pumps the event loop once, and then removes up to `capacity`
+   * events from the event queue with a single call to `SDL_PeepEvents()`. This is
+   * considerably cheaper than calling `poll()` once per event when there are many pending
+   * events, e.g. during floods of mouse motion or sensor events. Events that don't fit in
+   * the buffer are left in the event queue.
+   *
+   * \param buffer the buffer that the events will be written to.
+   * \param capacity the maximum amount of events that will be written to the buffer.
+   *
+   * \return the number of events that were written to the buffer; zero if there were no
+   * pending events or if something went wrong.
+   *
+   * \see `SDL_PeepEvents`
+   *
+   * \since 6.4.0
+   */
+  static auto poll_batch(SDL_Event* buffer, const usize capacity) noexcept -> usize
+  {
+    CENTURION_PROFILE_ZONE("event::poll");
+
+    assert(buffer || capacity == 0);
 
-    return result;
+    SDL_PumpEvents();
+
+    const auto count = SDL_PeepEvents(buffer,
+                                      static_cast<int>(capacity),
+                                      SDL_GETEVENT,
+                                      SDL_FIRSTEVENT,
+                                      SDL_LASTEVENT);
+    return count > 0 ? static_cast<usize>(count) : 0u;
   }
 
   /**
@@ -409,163 +653,38 @@ class event final
   SDL_Event m_event{};
   data_type m_data{};
 
-  void update_data(const event_type type) noexcept
+  auto accept(const bool obtained) noexcept -> bool
   {
-    switch (type) {
-      case event_type::quit:
-        m_data.emplace<quit_event>(m_event.quit);
-        break;
-
-      case event_type::app_terminating:
-      case event_type::app_low_memory:
-      case event_type::app_will_enter_background:
-      case event_type::app_did_enter_background:
-      case event_type::app_will_enter_foreground:
-      case event_type::app_did_enter_foreground:
-        break;
-
-#if SDL_VERSION_ATLEAST(2, 0, 14)
-      case event_type::locale_changed:
-        break;
-
-      case event_type::display:
-        m_data.emplace<display_event>(m_event.display);
-        break;
-#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
-
-      case event_type::window:
-        m_data.emplace<window_event>(m_event.window);
-        break;
-
-      case event_type::system:
-        break;
-
-      case event_type::key_down:
-      case event_type::key_up:
-        m_data.emplace<keyboard_event>(m_event.key);
-        break;
-
-      case event_type::text_editing:
-        m_data.emplace<text_editing_event>(m_event.edit);
-        break;
-
-      case event_type::text_input:
-        m_data.emplace<text_input_event>(m_event.text);
-        break;
-
-      case event_type::keymap_changed:
-        break;
-
-      case event_type::mouse_motion:
-        m_data.emplace<mouse_motion_event>(m_event.motion);
-        break;
-
-      case event_type::mouse_button_down:
-      case event_type::mouse_button_up:
-        m_data.emplace<mouse_button_event>(m_event.button);
-        break;
-
-      case event_type::mouse_wheel:
-        m_data.emplace<mouse_wheel_event>(m_event.wheel);
-        break;
-
-      case event_type::joystick_axis_motion:
-        m_data.emplace<joy_axis_event>(m_event.jaxis);
-        break;
-
-      case event_type::joystick_ball_motion:
-        m_data.emplace<joy_ball_event>(m_event.jball);
-        break;
-
-      case event_type::joystick_hat_motion:
-        m_data.emplace<joy_hat_event>(m_event.jhat);
-        break;
-
-      case event_type::joystick_button_down:
-      case event_type::joystick_button_up:
-        m_data.emplace<joy_button_event>(m_event.jbutton);
-        break;
-
-      case event_type::joystick_device_added:
-      case event_type::joystick_device_removed:
-        m_data.emplace<joy_device_event>(m_event.jdevice);
-        break;
+    if (obtained) {
+      update_data();
+    }
+    else {
+      m_data.emplace<std::monostate>();
+    }
 
-      case event_type::controller_axis_motion:
-        m_data.emplace<controller_axis_event>(m_event.caxis);
-        break;
+    return obtained;
+  }
 
-      case event_type::controller_button_down:
-      case event_type::controller_button_up:
-        m_data.emplace<controller_button_event>(m_event.cbutton);
-        break;
+  CENTURION_API CENTURION_LIB_INLINE void update_data() noexcept;
+};
 
-      case event_type::controller_device_added:
-      case event_type::controller_device_removed:
-      case event_type::controller_device_remapped:
-        m_data.emplace<controller_device_event>(m_event.cdevice);
-        break;
+#if CENTURION_LIB_DEFINITIONS
 
-#if SDL_VERSION_ATLEAST(2, 0, 14)
-      case event_type::controller_touchpad_down:
-      case event_type::controller_touchpad_up:
-      case event_type::controller_touchpad_motion:
-        m_data.emplace<controller_touchpad_event>(m_event.ctouchpad);
-        break;
-
-      case event_type::controller_sensor_update:
-        m_data.emplace<controller_sensor_event>(m_event.csensor);
-        break;
-#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+CENTURION_LIB_INLINE void event::update_data() noexcept
+{
+  detail::visit_event(m_event, [this](const auto tag, const auto& data) noexcept {
+    using event_t = typename decltype(tag)::type;
 
-      case event_type::touch_down:
-      case event_type::touch_up:
-      case event_type::touch_motion:
-        m_data.emplace<touch_finger_event>(m_event.tfinger);
-        break;
-
-      case event_type::dollar_gesture:
-      case event_type::dollar_record:
-        m_data.emplace<dollar_gesture_event>(m_event.dgesture);
-        break;
-
-      case event_type::multi_gesture:
-        m_data.emplace<multi_gesture_event>(m_event.mgesture);
-        break;
-
-      case event_type::clipboard_update:
-        break;
-
-      case event_type::drop_file:
-      case event_type::drop_text:
-      case event_type::drop_begin:
-      case event_type::drop_complete:
-        m_data.emplace<drop_event>(m_event.drop);
-        break;
-
-      case event_type::audio_device_added:
-      case event_type::audio_device_removed:
-        m_data.emplace<audio_device_event>(m_event.adevice);
-        break;
-
-      case event_type::sensor_update:
-        m_data.emplace<sensor_event>(m_event.sensor);
-        break;
-
-      case event_type::render_targets_reset:
-      case event_type::render_device_reset:
-        break;
-
-      case event_type::user:
-        m_data.emplace<user_event>(m_event.user);
-        break;
-
-      default:
-        m_data.emplace<std::monostate>();
-        break;
+    if constexpr (std::is_same_v<event_t, std::monostate>) {
+      m_data.emplace<std::monostate>();
     }
-  }
-};
+    else {
+      m_data.emplace<event_t>(data);
+    }
+  });
+}
+
+#endif  // CENTURION_LIB_DEFINITIONS
 
 /// \} End of group event
 
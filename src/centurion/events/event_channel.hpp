@@ -0,0 +1,285 @@
+#ifndef CENTURION_EVENT_CHANNEL_HEADER
+#define CENTURION_EVENT_CHANNEL_HEADER
+
+#include <atomic>    // atomic, memory_order
+#include <cstddef>   // ptrdiff_t
+#include <memory>    // unique_ptr, make_unique
+#include <optional>  // optional, nullopt
+#include <utility>   // move, forward
+
+#include "../core/integers.hpp"
+#include "../detail/concurrent_utils.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class event_channel
+ *
+ * \brief A bounded, lock-free queue used to send typed events to the main thread.
+ *
+ * \details Event channels make it possible for worker threads to post events with
+ * arbitrary payloads, e.g. completed network requests, without going through the SDL
+ * event queue, which is protected by a mutex and only supports the two untyped pointers
+ * of `user_event`. Channels can be attached to an event dispatcher, which will deliver
+ * the posted events to the sink and listeners of the event type.
+ *
+ * \details Any number of threads may push events to a channel concurrently, but only a
+ * single thread at a time may pop events from it (multiple producers, single consumer).
+ * Pushing an event never blocks, and fails if the channel is full.
+ *
+ * \tparam T the type of the events, which must be move constructible.
+ *
+ * \see `event_dispatcher::attach()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class event_channel final
+{
+ public:
+  using value_type = T;
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty event channel.
+   *
+   * \param capacity the maximum amount of events in the channel, which is rounded up to
+   * the nearest power of two.
+   *
+   * \since 6.4.0
+   */
+  explicit event_channel(const size_type capacity = default_capacity())
+      : m_capacity{detail::ring_capacity(capacity)}
+      , m_mask{m_capacity - 1}
+      , m_cells{std::make_unique<cell[]>(m_capacity)}
+  {
+    for (size_type index = 0; index < m_capacity; ++index) {
+      m_cells[index].sequence.store(index, std::memory_order_relaxed);
+    }
+  }
+
+  event_channel(const event_channel&) = delete;
+
+  auto operator=(const event_channel&) -> event_channel& = delete;
+
+  /**
+   * \brief Constructs an event in the channel.
+   *
+   * \note This function may be called from any thread.
+   *
+   * \tparam Args the types of the arguments forwarded to the event constructor.
+   *
+   * \param args the arguments that will be forwarded to the event constructor.
+   *
+   * \return `true` if the event was added; `false` if the channel is full.
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  auto try_emplace(Args&&... args) -> bool
+  {
+    auto position = m_head.load(std::memory_order_relaxed);
+    cell* target{};
+
+    while (true) {
+      target = &m_cells[position & m_mask];
+
+      const auto sequence = target->sequence.load(std::memory_order_acquire);
+      const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+      if (difference == 0) {
+        if (m_head.compare_exchange_weak(position,
+                                         position + 1,
+                                         std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if (difference < 0) {
+        return false;
+      }
+      else {
+        position = m_head.load(std::memory_order_relaxed);
+      }
+    }
+
+    target->value.emplace(std::forward<Args>(args)...);
+    target->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /**
+   * \brief Adds an event to the channel.
+   *
+   * \note This function may be called from any thread.
+   *
+   * \param event the event that will be added.
+   *
+   * \return `true` if the event was added; `false` if the channel is full.
+   *
+   * \since 6.4.0
+   */
+  auto try_push(T event) -> bool
+  {
+    return try_emplace(std::move(event));
+  }
+
+  /**
+   * \brief Removes the oldest event from the channel.
+   *
+   * \note Only one thread at a time may remove events from the channel.
+   *
+   * \return the removed event; `std::nullopt` if the channel is empty.
+   *
+   * \since 6.4.0
+   */
+  auto try_pop() -> std::optional<T>
+  {
+    const auto position = m_tail.load(std::memory_order_relaxed);
+    auto& source = m_cells[position & m_mask];
+
+    const auto sequence = source.sequence.load(std::memory_order_acquire);
+    if (sequence != position + 1) {
+      return std::nullopt;
+    }
+
+    std::optional<T> result{std::move(*source.value)};
+    source.value.reset();
+
+    source.sequence.store(position + m_capacity, std::memory_order_release);
+    m_tail.store(position + 1, std::memory_order_relaxed);
+
+    return result;
+  }
+
+  /**
+   * \brief Removes events from the channel, and invokes a function with each event.
+   *
+   * \details Events that are pushed while the channel is drained may or may not be
+   * removed by the same call.
+   *
+   * \note Only one thread at a time may remove events from the channel.
+   *
+   * \tparam Function the type of the function object.
+   *
+   * \param function the function object that will be invoked with each removed event.
+   * \param limit the maximum amount of events that will be removed.
+   *
+   * \return the number of events that were removed.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  auto drain(Function&& function, const size_type limit) -> size_type
+  {
+    size_type count = 0;
+
+    while (count < limit) {
+      if (auto event = try_pop()) {
+        function(*event);
+        ++count;
+      }
+      else {
+        break;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Removes at most `capacity()` events from the channel, and invokes a function
+   * with each event.
+   *
+   * \note Only one thread at a time may remove events from the channel.
+   *
+   * \tparam Function the type of the function object.
+   *
+   * \param function the function object that will be invoked with each removed event.
+   *
+   * \return the number of events that were removed.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  auto drain(Function&& function) -> size_type
+  {
+    return drain(std::forward<Function>(function), m_capacity);
+  }
+
+  /**
+   * \brief Returns an estimate of the amount of events in the channel.
+   *
+   * \details The returned value is only an approximation if events are concurrently added
+   * to or removed from the channel.
+   *
+   * \return the approximate number of events in the channel.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    return head > tail ? head - tail : 0;
+  }
+
+  /**
+   * \brief Indicates whether or not the channel is empty.
+   *
+   * \return `true` if the channel appears to be empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return size() == 0;
+  }
+
+  /**
+   * \brief Returns the maximum amount of events in the channel.
+   *
+   * \return the capacity of the channel.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the default capacity of event channels.
+   *
+   * \return the default capacity.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_capacity() noexcept -> size_type
+  {
+    return 1024;
+  }
+
+ private:
+  struct cell final
+  {
+    std::atomic<size_type> sequence{};
+    std::optional<T> value;
+  };
+
+  size_type m_capacity{};
+  size_type m_mask{};
+  std::unique_ptr<cell[]> m_cells;
+  alignas(64) std::atomic<size_type> m_head{};  ///< Written by producers.
+  alignas(64) std::atomic<size_type> m_tail{};  ///< Written by the consumer.
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_CHANNEL_HEADER
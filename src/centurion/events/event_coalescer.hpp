@@ -0,0 +1,238 @@
+#ifndef CENTURION_EVENT_COALESCER_HEADER
+#define CENTURION_EVENT_COALESCER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class event_coalescer
+ *
+ * \brief Merges consecutive high-frequency events in batches of SDL events.
+ *
+ * \details Mouse motion, joystick axis, controller axis and controller sensor events may
+ * be generated at rates much higher than the frame rate of an application. This class
+ * merges such events, so that each mouse, axis or sensor is represented by a single event
+ * per run of motion events. Merged events use the latest state, e.g. the latest mouse
+ * position or axis value, and mouse motion events accumulate the relative motion of the
+ * merged events.
+ *
+ * \details Any other kind of event ends the current run of motion events, i.e. motion
+ * events are never moved past other events, which preserves the relative order of e.g.
+ * mouse motion and mouse button events.
+ *
+ * \note Coalescing is performed on batches of events that have already been removed from
+ * the event queue. SDL event filters are invoked before events are added to the event
+ * queue, and cannot update events that are already queued, so they can only discard the
+ * latest state.
+ *
+ * \see `event_dispatcher::set_coalescing()`
+ * \see `event::poll_batch()`
+ *
+ * \since 6.4.0
+ */
+class event_coalescer final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Provides the amount of events that have been merged, by event type.
+   *
+   * \since 6.4.0
+   */
+  struct coalescing_stats final
+  {
+    usize mouse_motion{};       ///< Merged mouse motion events.
+    usize joy_axis{};           ///< Merged joystick axis events.
+    usize controller_axis{};    ///< Merged controller axis events.
+    usize controller_sensor{};  ///< Merged controller sensor events.
+
+    /**
+     * \brief Returns the total amount of merged events.
+     *
+     * \return the total number of events that have been merged.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto total() const noexcept -> usize
+    {
+      return mouse_motion + joy_axis + controller_axis + controller_sensor;
+    }
+  };
+
+  /**
+   * \brief Merges the consecutive motion events in a batch of events.
+   *
+   * \details The batch is compacted in place, and the relative order of the remaining
+   * events is preserved.
+   *
+   * \param events the batch of events.
+   * \param count the number of events in the batch.
+   *
+   * \return the number of events in the batch after coalescing.
+   *
+   * \since 6.4.0
+   */
+  auto coalesce(SDL_Event* events, const size_type count) -> size_type
+  {
+    assert(events || count == 0);
+
+    m_runs.clear();
+    size_type size = 0;
+
+    for (size_type index = 0; index < count; ++index) {
+      const auto& event = events[index];
+
+      if (const auto key = key_of(event); key.type != 0) {
+        if (auto* target = find_run(events, key)) {
+          merge(*target, event);
+        }
+        else {
+          m_runs.push_back(run{key, size});
+          events[size++] = event;
+        }
+      }
+      else {
+        m_runs.clear();
+        events[size++] = event;
+      }
+    }
+
+    return size;
+  }
+
+  /**
+   * \brief Returns the amount of events that have been merged.
+   *
+   * \return the coalescing statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto statistics() const noexcept -> const coalescing_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Resets the coalescing statistics.
+   *
+   * \since 6.4.0
+   */
+  void reset_statistics() noexcept
+  {
+    m_stats = coalescing_stats{};
+  }
+
+ private:
+  /* Identifies the source of a motion event, e.g. a specific joystick axis. A zero type
+     indicates that the event cannot be coalesced. */
+  struct run_key final
+  {
+    u32 type{};
+    u32 source{};
+    i32 channel{};
+
+    [[nodiscard]] auto operator==(const run_key& other) const noexcept -> bool
+    {
+      return type == other.type && source == other.source && channel == other.channel;
+    }
+  };
+
+  struct run final
+  {
+    run_key key;
+    size_type index{};
+  };
+
+  std::vector<run> m_runs;  ///< The open runs of the current batch, reused between batches.
+  coalescing_stats m_stats;
+
+  [[nodiscard]] static auto key_of(const SDL_Event& event) noexcept -> run_key
+  {
+    switch (event.type) {
+      case SDL_MOUSEMOTION:
+        return {event.type, event.motion.which, static_cast<i32>(event.motion.windowID)};
+
+      case SDL_JOYAXISMOTION:
+        return {event.type, static_cast<u32>(event.jaxis.which), event.jaxis.axis};
+
+      case SDL_CONTROLLERAXISMOTION:
+        return {event.type, static_cast<u32>(event.caxis.which), event.caxis.axis};
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+      case SDL_CONTROLLERSENSORUPDATE:
+        return {event.type, static_cast<u32>(event.csensor.which), event.csensor.sensor};
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+      default:
+        return {};
+    }
+  }
+
+  [[nodiscard]] auto find_run(SDL_Event* events, const run_key& key) noexcept -> SDL_Event*
+  {
+    for (const auto& run : m_runs) {
+      if (run.key == key) {
+        return events + run.index;
+      }
+    }
+
+    return nullptr;
+  }
+
+  static void merge_motion(SDL_MouseMotionEvent& target,
+                           const SDL_MouseMotionEvent& event) noexcept
+  {
+    const auto xrel = target.xrel + event.xrel;
+    const auto yrel = target.yrel + event.yrel;
+
+    target = event;
+    target.xrel = xrel;
+    target.yrel = yrel;
+  }
+
+  void merge(SDL_Event& target, const SDL_Event& event) noexcept
+  {
+    switch (event.type) {
+      case SDL_MOUSEMOTION:
+        merge_motion(target.motion, event.motion);
+        ++m_stats.mouse_motion;
+        break;
+
+      case SDL_JOYAXISMOTION:
+        target.jaxis = event.jaxis;
+        ++m_stats.joy_axis;
+        break;
+
+      case SDL_CONTROLLERAXISMOTION:
+        target.caxis = event.caxis;
+        ++m_stats.controller_axis;
+        break;
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+      case SDL_CONTROLLERSENSORUPDATE:
+        target.csensor = event.csensor;
+        ++m_stats.controller_sensor;
+        break;
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+      default:
+        break;
+    }
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_COALESCER_HEADER
@@ -1,16 +1,28 @@
 #ifndef CENTURION_EVENT_DISPATCHER_HEADER
 #define CENTURION_EVENT_DISPATCHER_HEADER
 
+#include <SDL2/SDL.h>
+
 #include <array>        // array
-#include <functional>   // function, bind
+#include <cassert>      // assert
+#include <functional>   // function
 #include <ostream>      // ostream
 #include <string>       // string, to_string
 #include <tuple>        // tuple
 #include <type_traits>  // is_same_v, is_invocable_v, is_reference_v, ...
+#include <vector>       // vector
 
 #include "../core/integers.hpp"
+#include "../core/time.hpp"
 #include "../detail/tuple_type_index.hpp"
+#include "../system/counter.hpp"
+#include "../system/input_latency_tracker.hpp"
+#include "../thread/main_thread_queue.hpp"
+#include "dispatch_stats.hpp"
 #include "event.hpp"
+#include "event_channel.hpp"
+#include "event_coalescer.hpp"
+#include "event_listeners.hpp"
 
 namespace cen {
 
@@ -90,7 +102,7 @@ class event_sink final
     static_assert(std::is_invocable_v<decltype(memberFunc), Self*, const event_type&>,
                   "Member function must be invocable with subscribed event!");
 
-    to(std::bind(memberFunc, self, std::placeholders::_1));
+    to([self](const event_type& event) { (self->*memberFunc)(event); });
   }
 
   /**
@@ -210,30 +222,74 @@ class event_dispatcher final
     return std::get<index>(m_sinks);
   }
 
-  /**
-   * \brief Checks for the specified event type in the event handler.
-   *
-   * \tparam Event the event to look for.
-   *
-   * \return `true` if there was a match; `false` otherwise.
-   *
-   * \since 5.1.0
-   */
   template <typename Event>
-  auto check_for() -> bool
+  [[nodiscard]] auto get_listeners() -> event_listeners<Event>&
   {
-    if (const auto* event = m_event.template try_get<Event>()) {
-      if (auto& function = get_sink<Event>().function()) {
-        function(*event);
-      }
+    constexpr auto index = index_of<Event>();
+    return std::get<index>(m_listeners);
+  }
+
+  template <typename Event>
+  [[nodiscard]] auto get_listeners() const -> const event_listeners<Event>&
+  {
+    constexpr auto index = index_of<Event>();
+    return std::get<index>(m_listeners);
+  }
+
+  template <typename Event>
+  void publish(const Event& event)
+  {
+    if (auto& function = get_sink<Event>().function()) {
+      function(event);
+    }
+
+    get_listeners<Event>().publish(event);
+  }
+
+  template <typename Event>
+  static auto drain_channel(void* channel, event_dispatcher& self) -> usize
+  {
+    return static_cast<event_channel<Event>*>(channel)->drain(
+        [&](const Event& event) { self.publish(event); });
+  }
+
+  static auto drain_tasks(void* queue, event_dispatcher&) -> usize
+  {
+    auto* tasks = static_cast<main_thread_queue*>(queue);
+    return tasks->run_pending(tasks->budget());
+  }
+
+  auto drain_channels() -> usize
+  {
+    usize count = 0;
 
-      return true;
+    for (const auto& source : m_channels) {
+      count += source.drain(source.channel, *this);
     }
-    else {
-      return false;
+
+    return count;
+  }
+
+  void sample_queue_depth()
+  {
+    const auto depth = static_cast<usize>(cen::event::queue_count().value_or(0));
+
+    ++m_stats.polls;
+    m_stats.totalQueueDepth += depth;
+
+    if (depth > m_stats.maxQueueDepth) {
+      m_stats.maxQueueDepth = depth;
     }
   }
 
+  // Converts performance counter ticks without overflowing for long durations
+  [[nodiscard]] auto to_nanoseconds(const u64 ticks) const noexcept -> nanoseconds<u64>
+  {
+    constexpr u64 perSecond = 1'000'000'000;
+    return nanoseconds<u64>{(ticks / m_frequency) * perSecond +
+                            (ticks % m_frequency) * perSecond / m_frequency};
+  }
+
  public:
   using size_type = usize;
 
@@ -244,13 +300,311 @@ class event_dispatcher final
    * used to manage events. You should call this function once for every
    * iteration in your game loop.
    *
+   * \details Attached event channels and main thread queues are drained after the SDL
+   * event queue.
+   *
    * \since 5.1.0
    */
   void poll()
   {
-    while (m_event.poll()) {
-      (check_for<E>() || ...);
+    if (m_instrumented) {
+      sample_queue_depth();
+    }
+
+    while (SDL_PollEvent(&m_event)) {
+      dispatch(m_event);
+    }
+
+    drain_channels();
+  }
+
+  /**
+   * \brief Waits indefinitely for an event, and then polls all events.
+   *
+   * \details This is an alternative to `poll()` for applications that only need to do
+   * something in response to events, which sleeps instead of spinning the CPU while there
+   * are no pending events. The first available event is dispatched as soon as it arrives,
+   * followed by any other pending events.
+   *
+   * \note Events posted to attached event channels do not wake up the calling thread, so
+   * use `wait_for()` when channels are attached.
+   *
+   * \return `true` if an event was obtained; `false` if something went wrong.
+   *
+   * \see `event::wait()`
+   *
+   * \since 6.4.0
+   */
+  auto wait() -> bool
+  {
+    const bool obtained = SDL_WaitEvent(&m_event);
+    if (obtained) {
+      dispatch(m_event);
+    }
+
+    poll();
+    return obtained;
+  }
+
+  /**
+   * \brief Waits for an event until a timeout is reached, and then polls all events.
+   *
+   * \details Attached event channels are always drained before this function returns,
+   * i.e. the timeout bounds the latency of channel events.
+   *
+   * \param timeout the maximum amount of time to wait for an event.
+   *
+   * \return `true` if an event was obtained before the timeout; `false` otherwise.
+   *
+   * \see `event::wait_for()`
+   *
+   * \since 6.4.0
+   */
+  auto wait_for(const milliseconds<int> timeout) -> bool
+  {
+    const bool obtained = SDL_WaitEventTimeout(&m_event, timeout.count());
+    if (obtained) {
+      dispatch(m_event);
+    }
+
+    poll();
+    return obtained;
+  }
+
+  /**
+   * \brief Polls a batch of events, checking for subscribed events.
+   *
+   * \details This is an alternative to `poll()` that moves up to `batch_size()` events
+   * from the event queue into an internal buffer with a single call, and then dispatches
+   * the buffered events. Events that don't fit in the batch are left in the event queue,
+   * and are handled by the next call, which bounds the time spent handling events when
+   * the event queue is flooded.
+   *
+   * \details If coalescing is enabled, consecutive motion events in each batch are
+   * merged before they are dispatched, see `set_coalescing()`.
+   *
+   * \details Attached event channels are drained after the batch of SDL events.
+   *
+   * \return the number of events that were handled, including channel events.
+   *
+   * \see `event::poll_batch()`
+   *
+   * \since 6.4.0
+   */
+  auto poll_batch() -> size_type
+  {
+    if (m_instrumented) {
+      sample_queue_depth();
+    }
+
+    if (m_batch.size() != m_batchSize) {
+      m_batch.resize(m_batchSize);
+    }
+
+    auto count = cen::event::poll_batch(m_batch.data(), m_batch.size());
+    if (m_coalesce) {
+      count = m_coalescer.coalesce(m_batch.data(), count);
     }
+
+    for (size_type index = 0; index < count; ++index) {
+      dispatch(m_batch[index]);
+    }
+
+    return count + drain_channels();
+  }
+
+  /**
+   * \brief Sets the maximum amount of events handled by each call to `poll_batch()`.
+   *
+   * \param size the maximum number of events in a batch, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  void set_batch_size(const size_type size)
+  {
+    assert(size > 0);
+    m_batchSize = size;
+  }
+
+  /**
+   * \brief Returns the maximum amount of events handled by each call to `poll_batch()`.
+   *
+   * \return the maximum number of events in a batch.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto batch_size() const noexcept -> size_type
+  {
+    return m_batchSize;
+  }
+
+  /**
+   * \brief Sets whether or not `poll_batch()` merges consecutive motion events.
+   *
+   * \details Coalescing is disabled by default. Note that `poll()` never coalesces events.
+   *
+   * \param coalesce `true` if motion events should be coalesced; `false` otherwise.
+   *
+   * \see `event_coalescer`
+   *
+   * \since 6.4.0
+   */
+  void set_coalescing(const bool coalesce) noexcept
+  {
+    m_coalesce = coalesce;
+  }
+
+  /**
+   * \brief Indicates whether or not `poll_batch()` merges consecutive motion events.
+   *
+   * \return `true` if motion events are coalesced; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_coalescing() const noexcept -> bool
+  {
+    return m_coalesce;
+  }
+
+  /**
+   * \brief Returns the event coalescer used by `poll_batch()`.
+   *
+   * \details This can be used to obtain the amount of events that have been merged.
+   *
+   * \return the associated event coalescer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto coalescer() noexcept -> event_coalescer&
+  {
+    return m_coalescer;
+  }
+
+  [[nodiscard]] auto coalescer() const noexcept -> const event_coalescer&
+  {
+    return m_coalescer;
+  }
+
+  /**
+   * \brief Returns the default maximum amount of events in a batch.
+   *
+   * \return the default batch size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_batch_size() noexcept -> size_type
+  {
+    return 256;
+  }
+
+  /**
+   * \brief Dispatches a single event to the associated sink and listeners.
+   *
+   * \details This function has no effect if the event isn't subscribed, or if it doesn't
+   * have any bound handlers. This function is used by the polling functions, but can also
+   * be used to dispatch events that aren't obtained from the event queue, e.g. recorded
+   * events. Input events are tagged by the `input_latency_tracker`, if it is active.
+   *
+   * \param event the event that will be dispatched.
+   *
+   * \see `event_replayer`
+   * \see `input_latency_tracker`
+   *
+   * \since 6.4.0
+   */
+  void dispatch(const SDL_Event& event)
+  {
+    input_latency_tracker::record_input(event);
+
+    event_type_stats* stats{};
+    if (m_instrumented) {
+      stats = &m_stats.types[static_cast<event_type>(event.type)];
+      ++stats->count;
+    }
+
+    // The switch in visit_event() replaces a linear search through the subscribed events,
+    // and events without handlers are never created
+    detail::visit_event(event, [this, stats](const auto tag, const auto& data) {
+      using event_t = typename decltype(tag)::type;
+
+      if constexpr ((std::is_same_v<event_t, E> || ...)) {
+        auto& function = get_sink<event_t>().function();
+        const auto& listeners = get_listeners<event_t>();
+
+        if (function || !listeners.empty()) {
+          if (stats) {
+            const auto start = counter::now();
+            publish(event_t{data});
+
+            ++stats->handled;
+            stats->handlerTime.record(to_nanoseconds(counter::now() - start));
+          }
+          else {
+            publish(event_t{data});
+          }
+        }
+      }
+    });
+  }
+
+  /**
+   * \brief Sets whether or not statistics are collected about the handled events.
+   *
+   * \details Instrumented dispatchers count the received events per event type, sample
+   * the depth of the event queue at the start of every poll, and measure the time spent
+   * in event handlers with `counter::now()`. Instrumentation is disabled by default, and
+   * has no overhead beyond a branch per event when disabled.
+   *
+   * \note Events received from event channels are not included in the statistics.
+   *
+   * \param instrumented `true` if statistics should be collected; `false` otherwise.
+   *
+   * \see `statistics()`
+   *
+   * \since 6.4.0
+   */
+  void set_instrumented(const bool instrumented) noexcept
+  {
+    m_instrumented = instrumented;
+    if (instrumented) {
+      m_frequency = counter::frequency();
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not statistics are collected about the handled events.
+   *
+   * \return `true` if the dispatcher is instrumented; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_instrumented() const noexcept -> bool
+  {
+    return m_instrumented;
+  }
+
+  /**
+   * \brief Returns the statistics collected while the dispatcher was instrumented.
+   *
+   * \return the collected statistics.
+   *
+   * \see `set_instrumented()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto statistics() const noexcept -> const dispatch_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Resets the collected statistics.
+   *
+   * \since 6.4.0
+   */
+  void reset_statistics() noexcept
+  {
+    m_stats = dispatch_stats{};
   }
 
   /**
@@ -273,6 +627,120 @@ class event_dispatcher final
     return get_sink<Event>();
   }
 
+  /**
+   * \brief Returns the listeners associated with the specified event.
+   *
+   * \details Unlike the event sink returned by `bind()`, which only holds a single
+   * handler, any amount of handlers can be connected to the returned listeners. The
+   * handler of the event sink, if there is one, is invoked before the listeners.
+   *
+   * \tparam Event the subscribed event to obtain the listeners for.
+   *
+   * \return the associated event listeners.
+   *
+   * \since 6.4.0
+   */
+  template <typename Event>
+  auto listen() -> event_listeners<Event>&
+  {
+    static_assert((std::is_same_v<std::decay_t<Event>, E> || ...),
+                  "Can't connect unsubscribed event! Make sure that the "
+                  "event is listed as a class template parameter.");
+    return get_listeners<Event>();
+  }
+
+  /**
+   * \brief Attaches an event channel, which is drained whenever events are polled.
+   *
+   * \details The events posted to the channel are delivered to the event sink and
+   * listeners of the event type, after the events in the SDL event queue. At most
+   * `channel.capacity()` events are removed from the channel by each poll.
+   *
+   * \note The dispatcher doesn't take ownership of the channel, which must be detached or
+   * outlive the dispatcher.
+   *
+   * \tparam Event the subscribed event type of the channel.
+   *
+   * \param channel the event channel that will be attached.
+   *
+   * \see `event_channel`
+   *
+   * \since 6.4.0
+   */
+  template <typename Event>
+  void attach(event_channel<Event>& channel)
+  {
+    static_assert((std::is_same_v<Event, E> || ...),
+                  "Can't attach channel of unsubscribed event! Make sure that the "
+                  "event is listed as a class template parameter.");
+    detach(channel);
+    m_channels.push_back(channel_source{&channel, &drain_channel<Event>});
+  }
+
+  /**
+   * \brief Detaches a previously attached event channel.
+   *
+   * \details This function has no effect if the channel isn't attached.
+   *
+   * \tparam Event the event type of the channel.
+   *
+   * \param channel the event channel that will be detached.
+   *
+   * \since 6.4.0
+   */
+  template <typename Event>
+  void detach(event_channel<Event>& channel) noexcept
+  {
+    for (auto it = m_channels.begin(); it != m_channels.end(); ++it) {
+      if (it->channel == &channel) {
+        m_channels.erase(it);
+        break;
+      }
+    }
+  }
+
+  /**
+   * \brief Attaches a main thread queue, which is drained whenever events are polled.
+   *
+   * \details The tasks submitted to the queue are executed after the events in the SDL
+   * event queue, along with the events of attached channels. This is how continuations
+   * scheduled with `future::then()` on the main thread are executed. At most one budget's
+   * worth of tasks is executed per poll, see `main_thread_queue::set_budget()`.
+   *
+   * \note The dispatcher doesn't take ownership of the queue, which must be detached or
+   * outlive the dispatcher.
+   *
+   * \param queue the main thread queue that will be attached.
+   *
+   * \see `main_thread_queue`
+   *
+   * \since 6.4.0
+   */
+  void attach(main_thread_queue& queue)
+  {
+    detach(queue);
+    m_channels.push_back(channel_source{&queue, &drain_tasks});
+  }
+
+  /**
+   * \brief Detaches a previously attached main thread queue.
+   *
+   * \details This function has no effect if the queue isn't attached.
+   *
+   * \param queue the main thread queue that will be detached.
+   *
+   * \since 6.4.0
+   */
+  void detach(main_thread_queue& queue) noexcept
+  {
+    for (auto it = m_channels.begin(); it != m_channels.end(); ++it) {
+      if (it->channel == &queue) {
+        m_channels.erase(it);
+        break;
+      }
+    }
+  }
+
   /**
    * \brief Removes all set handlers from all of the subscribed events.
    *
@@ -281,6 +749,7 @@ class event_dispatcher final
   void reset() noexcept
   {
     (bind<E>().reset(), ...);
+    (listen<E>().clear(), ...);
   }
 
   /**
@@ -292,7 +761,7 @@ class event_dispatcher final
    */
   [[nodiscard]] auto active_count() const -> size_type
   {
-    return (0u + ... + (get_sink<E>().function() ? 1u : 0u));
+    return (0u + ... + ((get_sink<E>().function() ? 1u : 0u) + get_listeners<E>().size()));
   }
 
   /**
@@ -312,9 +781,25 @@ class event_dispatcher final
 
  private:
   using sink_tuple = std::tuple<event_sink<E>...>;
+  using listeners_tuple = std::tuple<event_listeners<E>...>;
+
+  struct channel_source final
+  {
+    void* channel{};
+    size_type (*drain)(void*, event_dispatcher&){};
+  };
 
-  cen::event m_event;
+  SDL_Event m_event{};
   sink_tuple m_sinks;
+  listeners_tuple m_listeners;
+  std::vector<SDL_Event> m_batch;  ///< Lazily allocated by poll_batch().
+  size_type m_batchSize{default_batch_size()};
+  event_coalescer m_coalescer;
+  std::vector<channel_source> m_channels;
+  dispatch_stats m_stats;
+  u64 m_frequency{1};  ///< Cached performance counter frequency, used by instrumentation.
+  bool m_coalesce{};
+  bool m_instrumented{};
 };
 
 /// \name String conversions
@@ -0,0 +1,405 @@
+#ifndef CENTURION_EVENT_LISTENERS_HEADER
+#define CENTURION_EVENT_LISTENERS_HEADER
+
+#include <array>        // array
+#include <cassert>      // assert
+#include <type_traits>  // decay_t, enable_if_t, is_same_v, is_invocable_v, ...
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class event_delegate
+ *
+ * \brief A lightweight, non-owning reference to an event handler.
+ *
+ * \details An event delegate is simply a function pointer and a context pointer, so unlike
+ * `std::function`, creating a delegate never allocates memory and invoking it is a single
+ * indirect call.
+ *
+ * \tparam E the event type, e.g. `window_event`.
+ *
+ * \see `event_listeners`
+ *
+ * \since 6.4.0
+ */
+template <typename E>
+class event_delegate final
+{
+ public:
+  using event_type = std::decay_t<E>;  ///< Associated event type.
+
+  /**
+   * \brief Creates an empty delegate.
+   *
+   * \since 6.4.0
+   */
+  event_delegate() noexcept = default;
+
+  /**
+   * \brief Creates a delegate to a free function.
+   *
+   * \tparam function a function pointer.
+   *
+   * \return a delegate that invokes the function.
+   *
+   * \since 6.4.0
+   */
+  template <auto function>
+  [[nodiscard]] static auto bind() noexcept -> event_delegate
+  {
+    static_assert(std::is_invocable_v<decltype(function), const event_type&>,
+                  "Function must be invocable with subscribed event!");
+
+    return event_delegate{nullptr,
+                          [](void*, const event_type& event) { function(event); }};
+  }
+
+  /**
+   * \brief Creates a delegate to a member function.
+   *
+   * \note The delegate does *not* take ownership of the supplied pointer.
+   *
+   * \tparam memberFunc a pointer to a member function.
+   * \tparam Self the type of the object that owns the function.
+   *
+   * \param self a pointer to the object that will handle the event.
+   *
+   * \return a delegate that invokes the member function.
+   *
+   * \since 6.4.0
+   */
+  template <auto memberFunc, typename Self>
+  [[nodiscard]] static auto bind(Self* self) noexcept -> event_delegate
+  {
+    static_assert(std::is_member_function_pointer_v<decltype(memberFunc)>,
+                  "\"memberFunc\" must be member function pointer!");
+    static_assert(std::is_invocable_v<decltype(memberFunc), Self*, const event_type&>,
+                  "Member function must be invocable with subscribed event!");
+    assert(self);
+
+    return event_delegate{const_cast<void*>(static_cast<const void*>(self)),
+                          [](void* data, const event_type& event) {
+                            (static_cast<Self*>(data)->*memberFunc)(event);
+                          }};
+  }
+
+  /**
+   * \brief Creates a delegate to a function object.
+   *
+   * \note The delegate does *not* take ownership of the function object, which must
+   * outlive the delegate.
+   *
+   * \tparam Callable the type of the function object.
+   *
+   * \param callable the function object that will handle the event.
+   *
+   * \return a delegate that invokes the function object.
+   *
+   * \since 6.4.0
+   */
+  template <typename Callable>
+  [[nodiscard]] static auto bind(Callable& callable) noexcept -> event_delegate
+  {
+    static_assert(std::is_invocable_v<Callable&, const event_type&>,
+                  "Callable must be invocable with subscribed event!");
+
+    return event_delegate{const_cast<void*>(static_cast<const void*>(&callable)),
+                          [](void* data, const event_type& event) {
+                            (*static_cast<Callable*>(data))(event);
+                          }};
+  }
+
+  /**
+   * \brief Invokes the associated event handler.
+   *
+   * \pre The delegate must not be empty.
+   *
+   * \param event the event that will be forwarded to the handler.
+   *
+   * \since 6.4.0
+   */
+  void operator()(const event_type& event) const
+  {
+    assert(m_function);
+    m_function(m_data, event);
+  }
+
+  /**
+   * \brief Indicates whether or not the delegate references an event handler.
+   *
+   * \return `true` if the delegate isn't empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return m_function != nullptr;
+  }
+
+ private:
+  using function_type = void (*)(void*, const event_type&);
+
+  void* m_data{};
+  function_type m_function{};
+
+  event_delegate(void* data, const function_type function) noexcept
+      : m_data{data}
+      , m_function{function}
+  {}
+};
+
+/**
+ * \class event_listeners
+ *
+ * \brief Manages multiple handlers of an event.
+ *
+ * \details This is an alternative to `event_sink`, which only supports a single handler.
+ * The handlers are stored as `event_delegate` instances in contiguous memory, and the
+ * first few handlers are stored inline, so connecting handlers usually doesn't allocate
+ * any memory, and publishing an event is a tight loop over the delegates.
+ *
+ * \details Handlers are invoked in the order that they were connected. Handlers must not
+ * connect or disconnect handlers of the same listeners while an event is published.
+ *
+ * \tparam E the event type, e.g. `window_event`.
+ * \tparam InlineCapacity the number of handlers that can be stored without allocating.
+ *
+ * \see `event_dispatcher::listen()`
+ *
+ * \since 6.4.0
+ */
+template <typename E, usize InlineCapacity = 4>
+class event_listeners final
+{
+  static_assert(InlineCapacity > 0, "Inline capacity must be greater than zero!");
+
+ public:
+  using event_type = std::decay_t<E>;       ///< Associated event type.
+  using delegate_type = event_delegate<E>;  ///< Type of the stored handlers.
+  using size_type = usize;
+
+  /**
+   * \enum connection
+   *
+   * \brief Identifies a connected handler, used to disconnect it.
+   *
+   * \since 6.4.0
+   */
+  enum class connection : usize
+  {
+  };
+
+  /**
+   * \brief Connects a delegate.
+   *
+   * \param delegate the delegate that will handle published events.
+   *
+   * \return the connection associated with the delegate.
+   *
+   * \since 6.4.0
+   */
+  auto connect(const delegate_type& delegate) -> connection
+  {
+    assert(delegate);
+
+    const auto id = connection{m_nextId++};
+
+    if (m_heap.empty() && m_size < InlineCapacity) {
+      m_inline[m_size] = entry{id, delegate};
+    }
+    else {
+      if (m_heap.empty()) {
+        m_heap.reserve(InlineCapacity * 2);
+        m_heap.assign(m_inline.begin(), m_inline.end());
+      }
+
+      m_heap.push_back(entry{id, delegate});
+    }
+
+    ++m_size;
+    return id;
+  }
+
+  /**
+   * \brief Connects a free function.
+   *
+   * \tparam function a function pointer.
+   *
+   * \return the connection associated with the function.
+   *
+   * \since 6.4.0
+   */
+  template <auto function>
+  auto connect() -> connection
+  {
+    return connect(delegate_type::template bind<function>());
+  }
+
+  /**
+   * \brief Connects a member function.
+   *
+   * \note The listeners do *not* take ownership of the supplied pointer.
+   *
+   * \tparam memberFunc a pointer to a member function.
+   * \tparam Self the type of the object that owns the function.
+   *
+   * \param self a pointer to the object that will handle the event.
+   *
+   * \return the connection associated with the member function.
+   *
+   * \since 6.4.0
+   */
+  template <auto memberFunc, typename Self>
+  auto connect(Self* self) -> connection
+  {
+    return connect(delegate_type::template bind<memberFunc>(self));
+  }
+
+  /**
+   * \brief Connects a function object.
+   *
+   * \note The listeners do *not* take ownership of the function object, which must stay
+   * alive until it is disconnected.
+   *
+   * \tparam Callable the type of the function object.
+   *
+   * \param callable the function object that will handle the event.
+   *
+   * \return the connection associated with the function object.
+   *
+   * \since 6.4.0
+   */
+  template <typename Callable,
+            std::enable_if_t<!std::is_same_v<Callable, delegate_type>, int> = 0>
+  auto connect(Callable& callable) -> connection
+  {
+    return connect(delegate_type::bind(callable));
+  }
+
+  /**
+   * \brief Disconnects a handler.
+   *
+   * \param id the connection associated with the handler.
+   *
+   * \return `true` if a handler was disconnected; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto disconnect(const connection id) noexcept -> bool
+  {
+    auto* entries = data();
+
+    for (size_type index = 0; index < m_size; ++index) {
+      if (entries[index].id == id) {
+        for (auto next = index + 1; next < m_size; ++next) {
+          entries[next - 1] = entries[next];
+        }
+
+        --m_size;
+        if (!m_heap.empty()) {
+          m_heap.pop_back();
+        }
+
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Disconnects all handlers.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_heap.clear();
+    m_size = 0;
+  }
+
+  /**
+   * \brief Invokes all connected handlers with an event.
+   *
+   * \param event the event that will be forwarded to the handlers.
+   *
+   * \since 6.4.0
+   */
+  void publish(const event_type& event) const
+  {
+    const auto* entries = data();
+    for (size_type index = 0; index < m_size; ++index) {
+      entries[index].delegate(event);
+    }
+  }
+
+  /**
+   * \brief Returns the amount of connected handlers.
+   *
+   * \return the number of connected handlers.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Indicates whether or not there are any connected handlers.
+   *
+   * \return `true` if there are no connected handlers; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * \brief Returns the number of handlers that can be stored without allocating memory.
+   *
+   * \return the inline capacity.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto inline_capacity() noexcept -> size_type
+  {
+    return InlineCapacity;
+  }
+
+ private:
+  struct entry final
+  {
+    connection id{};
+    delegate_type delegate;
+  };
+
+  std::array<entry, InlineCapacity> m_inline{};
+  std::vector<entry> m_heap;  ///< Holds all entries once the inline storage is exhausted.
+  size_type m_size{};
+  usize m_nextId{};
+
+  [[nodiscard]] auto data() noexcept -> entry*
+  {
+    return m_heap.empty() ? m_inline.data() : m_heap.data();
+  }
+
+  [[nodiscard]] auto data() const noexcept -> const entry*
+  {
+    return m_heap.empty() ? m_inline.data() : m_heap.data();
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_LISTENERS_HEADER
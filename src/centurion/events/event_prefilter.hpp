@@ -0,0 +1,116 @@
+#ifndef CENTURION_EVENT_PREFILTER_HEADER
+#define CENTURION_EVENT_PREFILTER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <type_traits>  // is_same_v
+#include <variant>      // monostate
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+#include "event.hpp"
+#include "event_dispatcher.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class event_prefilter
+ *
+ * \brief Disables all event types that an event dispatcher doesn't subscribe to.
+ *
+ * \details By default, SDL adds events of every type to the event queue, even though an
+ * event dispatcher simply discards events that it isn't subscribed to. An event
+ * prefilter uses `SDL_EventState()` to make SDL ignore such events at the source, which
+ * reduces the traffic through the event queue.
+ *
+ * \details Only event types that correspond to event wrappers, e.g. `mouse_motion_event`,
+ * are affected, event types that the dispatcher can't subscribe to at all are left as
+ * is. Event types that were disabled by the prefilter are enabled again when the
+ * prefilter is destroyed.
+ *
+ * \note Event states are global, so ignored events will not be delivered to any part of
+ * the application, e.g. other dispatchers or code that calls `event::poll()`.
+ *
+ * \warning Creating a prefilter removes all events of the ignored types that are
+ * currently in the event queue.
+ *
+ * \see `SDL_EventState`
+ *
+ * \since 6.4.0
+ */
+class event_prefilter final
+{
+ public:
+  /**
+   * \brief Disables all event types that aren't subscribed to by an event dispatcher.
+   *
+   * \tparam E the events subscribed to by the dispatcher.
+   *
+   * \param dispatcher the dispatcher that determines which event types are kept.
+   *
+   * \since 6.4.0
+   */
+  template <typename... E>
+  explicit event_prefilter([[maybe_unused]] const event_dispatcher<E...>& dispatcher)
+  {
+    SDL_Event event{};
+
+    for (u32 type = SDL_FIRSTEVENT + 1; type <= SDL_USEREVENT; ++type) {
+      event.type = type;
+
+      bool ignore = false;
+      detail::visit_event(event, [&](const auto tag, const auto&) noexcept {
+        using event_t = typename decltype(tag)::type;
+
+        if constexpr (!std::is_same_v<event_t, std::monostate>) {
+          ignore = !(std::is_same_v<event_t, E> || ...);
+        }
+      });
+
+      if (ignore && SDL_EventState(type, SDL_QUERY) == SDL_ENABLE) {
+        SDL_EventState(type, SDL_IGNORE);
+        m_ignored.push_back(type);
+      }
+    }
+  }
+
+  event_prefilter(const event_prefilter&) = delete;
+
+  auto operator=(const event_prefilter&) -> event_prefilter& = delete;
+
+  /**
+   * \brief Enables the event types that were disabled by the prefilter.
+   *
+   * \since 6.4.0
+   */
+  ~event_prefilter() noexcept
+  {
+    for (const auto type : m_ignored) {
+      SDL_EventState(type, SDL_ENABLE);
+    }
+  }
+
+  /**
+   * \brief Returns the event types that were disabled by the prefilter.
+   *
+   * \return the SDL event types that are ignored because of the prefilter.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto ignored() const noexcept -> const std::vector<u32>&
+  {
+    return m_ignored;
+  }
+
+ private:
+  std::vector<u32> m_ignored;
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_PREFILTER_HEADER
@@ -0,0 +1,373 @@
+#ifndef CENTURION_EVENT_RECORDING_HEADER
+#define CENTURION_EVENT_RECORDING_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cstring>   // memcpy
+#include <optional>  // optional, nullopt
+#include <string>    // string
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../filesystem/file.hpp"
+#include "event.hpp"
+#include "event_dispatcher.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/// \cond FALSE
+
+namespace detail {
+
+inline constexpr u32 event_log_magic = 0x47'4F'4C'45;  // "ELOG" in little endian
+inline constexpr u32 event_log_version = 1;
+
+/* Returns the amount of bytes of an SDL event that are meaningful, i.e. the size of the
+   associated SDL event structure. Events that store pointers, e.g. drop events, yield
+   zero, since such events cannot be restored from a file. */
+[[nodiscard]] inline auto recorded_size(const SDL_Event& event) noexcept -> usize
+{
+  if (event.type == SDL_DROPFILE || event.type == SDL_DROPTEXT ||
+      event.type == SDL_DROPBEGIN || event.type == SDL_DROPCOMPLETE ||
+      event.type == SDL_SYSWMEVENT)
+  {
+    return 0;
+  }
+
+  usize size = sizeof(SDL_CommonEvent);
+  visit_event(event, [&](const auto, const auto& data) noexcept { size = sizeof(data); });
+
+  return size;
+}
+
+}  // namespace detail
+
+/// \endcond
+
+/**
+ * \class event_recorder
+ *
+ * \brief Records SDL events to a binary file, so that they can be replayed later.
+ *
+ * \details Event recordings are intended for load and regression testing, e.g. to replay
+ * input-heavy scenarios deterministically with `event_replayer`. Every recorded event is
+ * written immediately, together with its timestamp relative to the first recorded event.
+ * Only the meaningful part of each event is stored, e.g. a mouse motion event only
+ * occupies the size of `SDL_MouseMotionEvent`.
+ *
+ * \note Events that contain pointers, such as drop events, are not recorded, and the data
+ * pointers of recorded user events are cleared. The format stores events in native byte
+ * order, i.e. recordings are only portable between similar platforms.
+ *
+ * \see `event_replayer`
+ *
+ * \since 6.4.0
+ */
+class event_recorder final
+{
+ public:
+  /**
+   * \brief Creates a new recording, replacing any existing file.
+   *
+   * \param path the file path of the recording.
+   *
+   * \throws cen_error if the file cannot be opened.
+   *
+   * \since 6.4.0
+   */
+  explicit event_recorder(const std::string& path) : m_file{path, file_mode::write_binary}
+  {
+    if (!m_file) {
+      throw cen_error{"Failed to open event recording file!"};
+    }
+
+    m_file.write_as_little_endian(detail::event_log_magic);
+    m_file.write_as_little_endian(detail::event_log_version);
+    m_file.write_as_little_endian(static_cast<u32>(sizeof(SDL_Event)));
+  }
+
+  /**
+   * \brief Records an SDL event.
+   *
+   * \param event the event that will be recorded.
+   *
+   * \return `success` if the event was recorded or intentionally skipped; `failure` if
+   * something went wrong when writing the event.
+   *
+   * \since 6.4.0
+   */
+  auto record(const SDL_Event& event) noexcept -> result
+  {
+    const auto size = detail::recorded_size(event);
+    if (size == 0) {
+      ++m_skipped;
+      return success;
+    }
+
+    if (!m_start) {
+      m_start = event.common.timestamp;
+    }
+
+    SDL_Event copy = event;
+    if (copy.type >= SDL_USEREVENT) {
+      copy.user.data1 = nullptr;
+      copy.user.data2 = nullptr;
+    }
+
+    const auto time = event.common.timestamp - *m_start;
+    if (!m_file.write_as_little_endian(time) ||
+        !m_file.write_as_little_endian(static_cast<u16>(size)) ||
+        m_file.write(reinterpret_cast<const u8*>(&copy), size) != size)
+    {
+      return failure;
+    }
+
+    ++m_count;
+    return success;
+  }
+
+  /**
+   * \brief Records an event.
+   *
+   * \param polled the event that will be recorded, e.g. obtained with `event::poll()`.
+   *
+   * \return `success` if the event was recorded or intentionally skipped; `failure` if
+   * something went wrong when writing the event.
+   *
+   * \since 6.4.0
+   */
+  auto record(const event& polled) noexcept -> result
+  {
+    return record(*polled.data());
+  }
+
+  /**
+   * \brief Returns the amount of events that have been recorded.
+   *
+   * \return the number of recorded events.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto count() const noexcept -> usize
+  {
+    return m_count;
+  }
+
+  /**
+   * \brief Returns the amount of events that couldn't be recorded.
+   *
+   * \return the number of skipped events, e.g. drop events.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto skipped() const noexcept -> usize
+  {
+    return m_skipped;
+  }
+
+ private:
+  file m_file;
+  std::optional<u32> m_start;
+  usize m_count{};
+  usize m_skipped{};
+};
+
+/**
+ * \class event_replayer
+ *
+ * \brief Replays events recorded by an `event_recorder`.
+ *
+ * \details The events are streamed from the recording, i.e. the entire recording is never
+ * loaded into memory. Replayed events are dispatched directly, without going through the
+ * SDL event queue, which makes it possible to replay recordings much faster than in real
+ * time, and to measure the throughput of event dispatchers.
+ *
+ * \see `event_recorder`
+ *
+ * \since 6.4.0
+ */
+class event_replayer final
+{
+ public:
+  using ms_type = milliseconds<u32>;
+
+  /**
+   * \brief Opens a recording.
+   *
+   * \param path the file path of the recording.
+   *
+   * \throws cen_error if the file cannot be opened, or isn't a compatible recording.
+   *
+   * \since 6.4.0
+   */
+  explicit event_replayer(const std::string& path)
+      : m_file{path, file_mode::read_existing_binary}
+  {
+    if (!m_file) {
+      throw cen_error{"Failed to open event recording file!"};
+    }
+
+    const auto magic = m_file.read_little_endian_u32();
+    const auto version = m_file.read_little_endian_u32();
+    const auto eventSize = m_file.read_little_endian_u32();
+
+    if (magic != detail::event_log_magic || version != detail::event_log_version ||
+        eventSize != sizeof(SDL_Event))
+    {
+      throw cen_error{"Invalid or incompatible event recording!"};
+    }
+
+    read_next();
+  }
+
+  /**
+   * \brief Dispatches all remaining events, as fast as possible.
+   *
+   * \tparam E the events subscribed to by the dispatcher.
+   *
+   * \param dispatcher the dispatcher that will handle the events.
+   *
+   * \return the number of events that were replayed.
+   *
+   * \since 6.4.0
+   */
+  template <typename... E>
+  auto replay(event_dispatcher<E...>& dispatcher) -> usize
+  {
+    usize count = 0;
+
+    while (m_next) {
+      dispatcher.dispatch(m_next->event);
+      read_next();
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Dispatches the events recorded up until the specified time.
+   *
+   * \details This function can be used to replay a recording deterministically, in step
+   * with a simulated clock, e.g. by advancing the time by a fixed amount every frame.
+   *
+   * \tparam E the events subscribed to by the dispatcher.
+   *
+   * \param dispatcher the dispatcher that will handle the events.
+   * \param time the time, relative to the first recorded event, up until which events
+   * will be replayed (inclusive).
+   *
+   * \return the number of events that were replayed.
+   *
+   * \since 6.4.0
+   */
+  template <typename... E>
+  auto replay_until(event_dispatcher<E...>& dispatcher, const ms_type time) -> usize
+  {
+    usize count = 0;
+
+    while (m_next && m_next->time <= time.count()) {
+      dispatcher.dispatch(m_next->event);
+      read_next();
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Reads the next event from the recording.
+   *
+   * \return the next recorded event; `std::nullopt` if there are no more events.
+   *
+   * \since 6.4.0
+   */
+  auto next() -> std::optional<SDL_Event>
+  {
+    if (m_next) {
+      const auto event = m_next->event;
+      read_next();
+      return event;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not all events have been replayed.
+   *
+   * \return `true` if there are no more events; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_done() const noexcept -> bool
+  {
+    return !m_next.has_value();
+  }
+
+  /**
+   * \brief Returns the time of the next event.
+   *
+   * \return the time of the next event, relative to the first recorded event;
+   * `std::nullopt` if there are no more events.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto next_time() const noexcept -> std::optional<ms_type>
+  {
+    if (m_next) {
+      return ms_type{m_next->time};
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+ private:
+  struct recorded_event final
+  {
+    u32 time{};
+    SDL_Event event{};
+  };
+
+  file m_file;
+  std::optional<recorded_event> m_next;
+
+  // Reads the event after the current one, truncated recordings simply end early
+  void read_next() noexcept
+  {
+    m_next.reset();
+
+    recorded_event next;
+    u8 size[2]{};
+    u8 time[4]{};
+
+    if (m_file.read_to(time) != sizeof time || m_file.read_to(size) != sizeof size) {
+      return;
+    }
+
+    const auto bytes = static_cast<usize>(size[0] | (size[1] << 8));
+    if (bytes > sizeof(SDL_Event) ||
+        m_file.read_to(reinterpret_cast<u8*>(&next.event), bytes) != bytes)
+    {
+      return;
+    }
+
+    std::memcpy(&next.time, time, sizeof time);
+    next.time = SDL_SwapLE32(next.time);
+
+    m_next = next;
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_RECORDING_HEADER
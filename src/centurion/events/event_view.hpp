@@ -0,0 +1,203 @@
+#ifndef CENTURION_EVENT_VIEW_HEADER
+#define CENTURION_EVENT_VIEW_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <optional>     // optional, nullopt
+#include <type_traits>  // is_same_v
+#include <variant>      // monostate
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "event.hpp"
+#include "event_type.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class event_view
+ *
+ * \brief A lightweight, non-owning view of an SDL event.
+ *
+ * \details Unlike `event`, which stores a copy of the SDL event along with the
+ * corresponding event wrapper, an event view is simply a pointer to an existing SDL event.
+ * Event wrappers are only created on demand, by `get()` and `try_get()`. As a result,
+ * event views are cheap to create and copy, which makes them suitable for processing
+ * large batches of events, e.g. obtained with `event::poll_batch()`.
+ *
+ * \note The viewed event must outlive the view.
+ *
+ * \see `event`
+ *
+ * \since 6.4.0
+ */
+class event_view final
+{
+ public:
+  /**
+   * \brief Creates a view of an SDL event.
+   *
+   * \param event the viewed event.
+   *
+   * \since 6.4.0
+   */
+  explicit event_view(const SDL_Event& event) noexcept : m_event{&event}
+  {}
+
+  /**
+   * \brief Creates a view of the SDL event stored in an event.
+   *
+   * \param source the event that owns the viewed event.
+   *
+   * \since 6.4.0
+   */
+  explicit event_view(const event& source) noexcept : m_event{source.data()}
+  {}
+
+  /**
+   * \brief Indicates whether or not the event is of a particular type.
+   *
+   * \details Events of unknown types are considered to be of type `std::monostate`.
+   *
+   * \tparam T the event type that will be checked, e.g. `window_event`.
+   *
+   * \return `true` if the event is of the specified type; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  [[nodiscard]] auto is() const noexcept -> bool
+  {
+    bool result = false;
+
+    detail::visit_event(*m_event, [&](const auto tag, const auto&) noexcept {
+      result = std::is_same_v<typename decltype(tag)::type, T>;
+    });
+
+    return result;
+  }
+
+  /**
+   * \brief Creates the event wrapper of the viewed event.
+   *
+   * \tparam T the event type to obtain.
+   *
+   * \return an event wrapper based on the viewed event.
+   *
+   * \throws cen_error if the event isn't of the specified type.
+   *
+   * \see `try_get()`
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  [[nodiscard]] auto get() const -> T
+  {
+    if (auto result = try_get<T>()) {
+      return *result;
+    }
+    else {
+      throw cen_error{"Viewed event is not of the requested type!"};
+    }
+  }
+
+  /**
+   * \brief Attempts to create the event wrapper of the viewed event.
+   *
+   * \tparam T the event type to obtain.
+   *
+   * \return an event wrapper based on the viewed event; `std::nullopt` if the event isn't
+   * of the specified type.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  [[nodiscard]] auto try_get() const -> std::optional<T>
+  {
+    std::optional<T> result;
+
+    detail::visit_event(*m_event, [&](const auto tag, const auto& data) {
+      using event_t = typename decltype(tag)::type;
+
+      if constexpr (std::is_same_v<event_t, T> && !std::is_same_v<T, std::monostate>) {
+        result.emplace(data);
+      }
+    });
+
+    return result;
+  }
+
+  /**
+   * \brief Invokes a function object with the event wrapper of the viewed event.
+   *
+   * \details The function object is invoked with a temporary event wrapper of the
+   * appropriate type, e.g. `mouse_motion_event`. The function object isn't invoked at all
+   * for events that don't have a dedicated event type, or events of unknown types.
+   *
+   * \tparam Visitor the type of the function object, which must be invocable with all
+   * event types.
+   *
+   * \param visitor the function object that will be invoked.
+   *
+   * \since 6.4.0
+   */
+  template <typename Visitor>
+  void visit(Visitor&& visitor) const
+  {
+    detail::visit_event(*m_event, [&](const auto tag, const auto& data) {
+      using event_t = typename decltype(tag)::type;
+
+      if constexpr (!std::is_same_v<event_t, std::monostate>) {
+        visitor(event_t{data});
+      }
+    });
+  }
+
+  /**
+   * \brief Returns the type of the viewed event.
+   *
+   * \return the event type.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto type() const noexcept -> event_type
+  {
+    return static_cast<event_type>(m_event->type);
+  }
+
+  /**
+   * \brief Returns the timestamp of the viewed event.
+   *
+   * \return the timestamp of the event, in milliseconds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto time() const noexcept -> u32
+  {
+    return m_event->common.timestamp;
+  }
+
+  /**
+   * \brief Returns a pointer to the viewed event.
+   *
+   * \return a pointer to the viewed event, never null.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const SDL_Event*
+  {
+    return m_event;
+  }
+
+ private:
+  const SDL_Event* m_event{};
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_VIEW_HEADER
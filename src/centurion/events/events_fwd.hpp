@@ -0,0 +1,56 @@
+#ifndef CENTURION_EVENTS_FWD_HEADER
+#define CENTURION_EVENTS_FWD_HEADER
+
+/**
+ * \file events_fwd.hpp
+ *
+ * \brief Provides forward declarations of the event components.
+ *
+ * \details Include this header instead of the full headers in headers that only refer
+ * to these types by reference or pointer, e.g. in the declarations of event handlers.
+ */
+
+namespace cen {
+
+class event;
+class event_view;
+
+template <typename T>
+class common_event;
+
+class audio_device_event;
+class controller_axis_event;
+class controller_button_event;
+class controller_device_event;
+class controller_sensor_event;
+class controller_touchpad_event;
+class display_event;
+class dollar_gesture_event;
+class drop_event;
+class joy_axis_event;
+class joy_ball_event;
+class joy_button_event;
+class joy_device_event;
+class joy_hat_event;
+class keyboard_event;
+class mouse_button_event;
+class mouse_motion_event;
+class mouse_wheel_event;
+class multi_gesture_event;
+class quit_event;
+class sensor_event;
+class text_editing_event;
+class text_input_event;
+class touch_finger_event;
+class user_event;
+class window_event;
+
+template <typename... E>
+class event_dispatcher;
+
+template <typename T>
+class event_channel;
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENTS_FWD_HEADER
@@ -0,0 +1,242 @@
+#ifndef CENTURION_FRAME_PACER_HEADER
+#define CENTURION_FRAME_PACER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // max, min
+#include <cassert>    // assert
+#include <limits>     // numeric_limits
+#include <optional>   // optional
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../system/counter.hpp"
+#include "../system/power_profile.hpp"
+#include "../video/screen.hpp"
+#include "event_dispatcher.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class frame_pacer
+ *
+ * \brief Paces a game loop by sleeping until the next frame deadline, while still
+ * handling events as soon as they arrive.
+ *
+ * \details A frame pacer keeps track of a deadline for each frame, usually based on the
+ * refresh rate of a display. Instead of polling events in a busy loop, `wait()` sleeps in
+ * `SDL_WaitEventTimeout()` until the deadline, and dispatches each event the moment it is
+ * available, so idle applications barely use the CPU without adding input latency.
+ *
+ * \details Deadlines are kept in performance counter ticks and advanced by exactly one
+ * interval per frame, so intervals that aren't a whole amount of milliseconds, e.g. at
+ * 60 Hz, don't drift. If a frame takes longer than the frame interval, the missed
+ * deadlines are skipped, i.e. the pacer never tries to catch up by running frames
+ * back-to-back, but the following deadlines stay on the same schedule.
+ *
+ * \code{cpp}
+ *   auto pacer = cen::frame_pacer::for_display();
+ *   while (running) {
+ *     if (pacer.wait(dispatcher) || animating) {
+ *       render();
+ *     }
+ *   }
+ * \endcode
+ *
+ * \details The frame rate can be limited by a `power_profile`, by subscribing `handle()`
+ * to its change notifications.
+ *
+ * \see `event_dispatcher::wait_for()`
+ * \see `screen::refresh_rate()`
+ *
+ * \since 6.4.0
+ */
+class frame_pacer final
+{
+ public:
+  using ms_type = milliseconds<u32>;
+
+  /**
+   * \brief Creates a frame pacer with a fixed frame interval.
+   *
+   * \param interval the time between frame deadlines, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  explicit frame_pacer(const ms_type interval) noexcept
+      : m_base{to_counter_ticks(interval)}
+      , m_interval{m_base}
+  {
+    assert(interval.count() > 0);
+  }
+
+  /**
+   * \brief Creates a frame pacer based on the refresh rate of a display.
+   *
+   * \param index the index of the display.
+   *
+   * \return a frame pacer that uses the refresh rate of the display; the default refresh
+   * rate is used if the refresh rate of the display is unknown.
+   *
+   * \see `default_refresh_rate()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto for_display(const int index = 0) noexcept -> frame_pacer
+  {
+    auto rate = screen::refresh_rate(index).value_or(0);
+    if (rate <= 0) {
+      rate = default_refresh_rate();
+    }
+
+    frame_pacer pacer{ms_type{1}};
+    pacer.m_base = pacer.m_interval = rate_interval(rate);
+    return pacer;
+  }
+
+  /**
+   * \brief Handles events until the next frame deadline.
+   *
+   * \details The calling thread sleeps while there are no pending events. Attached event
+   * channels are drained every time an SDL event arrives, and at the deadline.
+   *
+   * \tparam E the events subscribed to by the dispatcher.
+   *
+   * \param dispatcher the dispatcher that will handle the events.
+   *
+   * \return `true` if any SDL events were obtained during the frame; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename... E>
+  auto wait(event_dispatcher<E...>& dispatcher) -> bool
+  {
+    auto now = counter::now();
+    if (!m_deadline) {
+      m_deadline = now + m_interval;
+    }
+
+    bool obtained = false;
+
+    while (now < *m_deadline) {
+      obtained |= dispatcher.wait_for(milliseconds<int>{remaining_ms(now)});
+      now = counter::now();
+    }
+
+    // Skip the missed deadlines, without shifting the schedule
+    *m_deadline += m_interval;
+    if (*m_deadline <= now) {
+      *m_deadline += (now - *m_deadline) / m_interval * m_interval + m_interval;
+    }
+
+    return obtained;
+  }
+
+  /**
+   * \brief Resets the frame deadline, so that the next frame starts when `wait()` is
+   * called.
+   *
+   * \details This is useful after intentionally blocking for a long time, e.g. when an
+   * application resumes after being paused.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_deadline.reset();
+  }
+
+  /**
+   * \brief Limits the frame rate according to the settings of a power mode.
+   *
+   * \details The frame interval is never shorter than the configured interval, so this
+   * only lowers the frame rate of displays that are faster than the limit.
+   *
+   * \param change the power change, with the frame rate limit of the new power mode.
+   *
+   * \since 6.4.0
+   */
+  void handle(const power_change& change) noexcept
+  {
+    const auto rate = change.settings.frame_rate;
+    m_limit = (rate > 0) ? rate_interval(rate) : 0u;
+    m_interval = std::max(m_base, m_limit);
+  }
+
+  /**
+   * \brief Sets the time between frame deadlines.
+   *
+   * \details The new interval takes effect after the current frame deadline, and is
+   * still subject to the frame rate limit of the power mode, if there is one.
+   *
+   * \param interval the time between frame deadlines, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  void set_interval(const ms_type interval) noexcept
+  {
+    assert(interval.count() > 0);
+    m_base = to_counter_ticks(interval);
+    m_interval = std::max(m_base, m_limit);
+  }
+
+  /**
+   * \brief Returns the time between frame deadlines.
+   *
+   * \details This is the longer of the configured interval and the interval of the frame
+   * rate limit of the power mode.
+   *
+   * \return the frame interval, rounded down to whole milliseconds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto interval() const noexcept -> ms_type
+  {
+    return ms_type{static_cast<u32>(m_interval * 1'000 / counter::frequency())};
+  }
+
+  /**
+   * \brief Returns the refresh rate used when the refresh rate of a display is unknown.
+   *
+   * \return the default refresh rate, in Hz.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_refresh_rate() noexcept -> int
+  {
+    return 60;
+  }
+
+ private:
+  u64 m_base{};      ///< The configured interval, in counter ticks.
+  u64 m_limit{};     ///< The interval of the power mode frame rate limit, if any.
+  u64 m_interval{};  ///< The effective interval.
+  std::optional<u64> m_deadline;
+
+  [[nodiscard]] static auto to_counter_ticks(const ms_type ms) noexcept -> u64
+  {
+    return std::max(u64{ms.count()} * counter::frequency() / 1'000, u64{1});
+  }
+
+  [[nodiscard]] static auto rate_interval(const int rate) noexcept -> u64
+  {
+    return std::max(counter::frequency() / static_cast<u64>(rate), u64{1});
+  }
+
+  // Rounded up, so that the dispatcher doesn't wake up just before the deadline
+  [[nodiscard]] auto remaining_ms(const u64 now) const noexcept -> int
+  {
+    const auto frequency = counter::frequency();
+    const auto ms = ((*m_deadline - now) * 1'000 + frequency - 1) / frequency;
+    return static_cast<int>(std::min(ms, static_cast<u64>(std::numeric_limits<int>::max())));
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_FRAME_PACER_HEADER
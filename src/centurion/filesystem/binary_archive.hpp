@@ -0,0 +1,514 @@
+#ifndef CENTURION_BINARY_ARCHIVE_HEADER
+#define CENTURION_BINARY_ARCHIVE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // min
+#include <cassert>      // assert
+#include <cstring>      // memcpy
+#include <optional>     // optional, nullopt
+#include <string>       // string
+#include <type_traits>  // is_arithmetic_v, is_enum_v, is_same_v, ...
+#include <utility>      // declval, move
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+#include "../input/key_code.hpp"
+#include "../input/scan_code.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../math/vector3.hpp"
+#include "../system/byte_order.hpp"
+#include "../video/color.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \cond FALSE
+namespace detail {
+
+// The size of the components of a type that is serialized with a single copy, or zero if
+// the type must be serialized field by field
+template <typename T, typename = void>
+inline constexpr usize bulk_word_size = 0;
+
+template <typename T>
+inline constexpr usize
+    bulk_word_size<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>> =
+        sizeof(T);
+
+template <typename T>
+inline constexpr usize bulk_word_size<T, std::enable_if_t<std::is_enum_v<T>>> = sizeof(T);
+
+template <typename T>
+inline constexpr usize bulk_word_size<basic_point<T>> =
+    sizeof(typename basic_point<T>::value_type);
+
+template <typename T>
+inline constexpr usize bulk_word_size<basic_area<T>> = bulk_word_size<T>;
+
+template <typename T>
+inline constexpr usize bulk_word_size<basic_rect<T>> =
+    sizeof(typename basic_rect<T>::value_type);
+
+template <typename T>
+inline constexpr usize bulk_word_size<vector3<T>> = bulk_word_size<T>;
+
+template <>
+inline constexpr usize bulk_word_size<color> = sizeof(u8);
+
+template <>
+inline constexpr usize bulk_word_size<scan_code> = sizeof(SDL_Scancode);
+
+template <>
+inline constexpr usize bulk_word_size<key_code> = sizeof(SDL_KeyCode);
+
+template <usize Size>
+using bulk_word_t =
+    std::conditional_t<Size == 2, u16, std::conditional_t<Size == 4, u32, u64>>;
+
+template <typename T, typename Archive, typename = void>
+inline constexpr bool has_member_serialize = false;
+
+template <typename T, typename Archive>
+inline constexpr bool has_member_serialize<
+    T,
+    Archive,
+    std::void_t<decltype(std::declval<T&>().serialize(std::declval<Archive&>()))>> = true;
+
+template <typename T>
+inline constexpr bool is_vector = false;
+
+template <typename T, typename Allocator>
+inline constexpr bool is_vector<std::vector<T, Allocator>> = true;
+
+// Swaps the components of objects to or from little endian, in place
+template <typename T>
+void swap_bulk(T* data, const usize count) noexcept
+{
+  constexpr auto word_size = bulk_word_size<T>;
+  if constexpr (word_size != 1 && SDL_BYTEORDER == SDL_BIG_ENDIAN) {
+    using word = bulk_word_t<word_size>;
+    static_assert(sizeof(T) <= 4'096, "The objects are too large!");
+
+    // The objects are swapped in blocks of whole objects, to avoid aliasing issues
+    constexpr usize block_objects = 4'096 / sizeof(T);
+    word block[block_objects * sizeof(T) / sizeof(word)];
+
+    auto* bytes = reinterpret_cast<u8*>(data);
+    for (usize index = 0; index < count; index += block_objects) {
+      const auto amount = std::min(block_objects, count - index);
+      const auto size = amount * sizeof(T);
+
+      std::memcpy(block, bytes + index * sizeof(T), size);
+      swap_byte_order(block, size / sizeof(word));
+      std::memcpy(bytes + index * sizeof(T), block, size);
+    }
+  }
+  else {
+    static_cast<void>(data);
+    static_cast<void>(count);
+  }
+}
+
+}  // namespace detail
+/// \endcond
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \brief Indicates whether or not a type is serialized by binary archives as raw memory.
+ *
+ * \details This is the case for arithmetic types except `bool`, enums, points, areas,
+ * rectangles, 3D vectors, colors, scan codes and key codes. Arrays of these types are
+ * written and read with a single file operation, instead of field by field.
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+inline constexpr bool is_bulk_serializable_v = detail::bulk_word_size<T> != 0;
+
+/**
+ * \class binary_output_archive
+ *
+ * \brief A lightweight binary archive that writes serializable types to a file.
+ *
+ * \details The archive is compatible with the `serialize()` functions that are used with
+ * the Cereal library, and can be used with user types that provide such functions. All
+ * values are stored in little endian byte order, without any type information, so the
+ * format is portable between platforms.
+ *
+ * \details Types for which `is_bulk_serializable_v` is `true` are written as raw memory,
+ * so arrays and vectors of them are written with a single file operation on little endian
+ * platforms, whereas big endian platforms swap them in blocks. Vectors and strings are
+ * prefixed with their size, as a 64-bit integer.
+ * \code{cpp}
+ *   cen::file file{"level.bin", cen::file_mode::write_binary};
+ *   cen::binary_output_archive archive{file};
+ *
+ *   archive(level.name, level.size, level.walls, level.palette);
+ *
+ *   if (!archive) {
+ *     // Handle the write error
+ *   }
+ * \endcode
+ *
+ * \note Errors are sticky, so once a write fails, subsequent writes are ignored. The file
+ * must outlive the archive.
+ *
+ * \see `binary_input_archive`
+ *
+ * \since 6.4.0
+ */
+class binary_output_archive final
+{
+ public:
+  /**
+   * \brief Creates an archive that writes to a file.
+   *
+   * \pre `target` must be a valid file.
+   *
+   * \param target the file that will be written to.
+   *
+   * \since 6.4.0
+   */
+  explicit binary_output_archive(file& target) noexcept : m_target{&target}
+  {
+    assert(target);
+  }
+
+  binary_output_archive(const binary_output_archive&) = delete;
+  auto operator=(const binary_output_archive&) -> binary_output_archive& = delete;
+
+  /**
+   * \brief Writes values to the file, in order.
+   *
+   * \details Values that aren't bulk serializable, vectors or strings are written with
+   * their `serialize()` member or free function.
+   *
+   * \tparam Args the types of the values.
+   *
+   * \param values the values that will be written.
+   *
+   * \return the archive.
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  auto operator()(const Args&... values) -> binary_output_archive&
+  {
+    (save(values), ...);
+    return *this;
+  }
+
+  /**
+   * \brief Writes an array of bulk serializable objects, without a size prefix.
+   *
+   * \tparam T the type of the objects.
+   *
+   * \param data the objects that will be written.
+   * \param count the number of objects.
+   *
+   * \return the number of objects that were written.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto write_bulk(const T* data, const usize count) noexcept -> usize
+  {
+    static_assert(is_bulk_serializable_v<T>, "The objects must be bulk serializable!");
+    static_assert(std::is_trivially_copyable_v<T>);
+    static_assert(sizeof(T) % detail::bulk_word_size<T> == 0);
+    assert(data || count == 0);
+
+    if (!m_ok || count == 0) {
+      return 0;
+    }
+
+    usize written = 0;
+    if constexpr (detail::bulk_word_size<T> == 1 || SDL_BYTEORDER == SDL_LIL_ENDIAN) {
+      written = SDL_RWwrite(m_target->get(), data, sizeof(T), count);
+    }
+    else {
+      constexpr usize block_objects = 4'096 / sizeof(T);
+      T block[block_objects];
+
+      while (written < count) {
+        const auto amount = std::min(block_objects, count - written);
+
+        std::memcpy(block, data + written, amount * sizeof(T));
+        detail::swap_bulk(block, amount);
+
+        const auto result = SDL_RWwrite(m_target->get(), block, sizeof(T), amount);
+        written += result;
+
+        if (result != amount) {
+          break;
+        }
+      }
+    }
+
+    m_ok = written == count;
+    return written;
+  }
+
+  /**
+   * \brief Indicates whether or not all writes have succeeded.
+   *
+   * \return `true` if no write has failed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto ok() const noexcept -> bool
+  {
+    return m_ok;
+  }
+
+  /// \copydoc ok()
+  explicit operator bool() const noexcept
+  {
+    return ok();
+  }
+
+ private:
+  file* m_target{};
+  bool m_ok{true};
+
+  template <typename T>
+  void save(const T& value)
+  {
+    if constexpr (std::is_same_v<T, bool>) {
+      const u8 byte = value ? 1 : 0;
+      write_bulk(&byte, 1);
+    }
+    else if constexpr (is_bulk_serializable_v<T>) {
+      write_bulk(&value, 1);
+    }
+    else if constexpr (std::is_same_v<T, std::string>) {
+      save_size(value.size());
+      write_bulk(value.data(), value.size());
+    }
+    else if constexpr (detail::is_vector<T>) {
+      save_size(value.size());
+
+      if constexpr (is_bulk_serializable_v<typename T::value_type>) {
+        write_bulk(value.data(), value.size());
+      }
+      else {
+        for (const auto& element : value) {
+          save(element);
+        }
+      }
+    }
+    else if constexpr (detail::has_member_serialize<T, binary_output_archive>) {
+      const_cast<T&>(value).serialize(*this);
+    }
+    else {
+      serialize(*this, const_cast<T&>(value));
+    }
+  }
+
+  void save_size(const usize size)
+  {
+    const auto value = static_cast<u64>(size);
+    write_bulk(&value, 1);
+  }
+};
+
+/**
+ * \class binary_input_archive
+ *
+ * \brief A lightweight binary archive that reads serializable types from a file.
+ *
+ * \details This is the counterpart of `binary_output_archive`, and reads values in the
+ * same order as they were written. Bulk serializable objects are read directly into the
+ * destination memory, and are swapped in place on big endian platforms.
+ * \code{cpp}
+ *   cen::file file{"level.bin", cen::file_mode::read_existing_binary};
+ *   cen::binary_input_archive archive{file};
+ *
+ *   archive(level.name, level.size, level.walls, level.palette);
+ *
+ *   if (!archive) {
+ *     // Handle the truncated or corrupt file
+ *   }
+ * \endcode
+ *
+ * \note Errors are sticky, so once a read fails, subsequent reads are ignored and leave
+ * their values unchanged. Sizes of vectors and strings that exceed the remaining size of
+ * the file are treated as errors, so corrupt files don't cause huge allocations. The file
+ * must outlive the archive.
+ *
+ * \see `binary_output_archive`
+ *
+ * \since 6.4.0
+ */
+class binary_input_archive final
+{
+ public:
+  /**
+   * \brief Creates an archive that reads from a file.
+   *
+   * \pre `source` must be a valid file.
+   *
+   * \param source the file that will be read from.
+   *
+   * \since 6.4.0
+   */
+  explicit binary_input_archive(file& source) noexcept : m_source{&source}
+  {
+    assert(source);
+  }
+
+  binary_input_archive(const binary_input_archive&) = delete;
+  auto operator=(const binary_input_archive&) -> binary_input_archive& = delete;
+
+  /**
+   * \brief Reads values from the file, in order.
+   *
+   * \details Values that aren't bulk serializable, vectors or strings are read with their
+   * `serialize()` member or free function.
+   *
+   * \tparam Args the types of the values.
+   *
+   * \param[out] values the values that will be read.
+   *
+   * \return the archive.
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  auto operator()(Args&... values) -> binary_input_archive&
+  {
+    (load(values), ...);
+    return *this;
+  }
+
+  /**
+   * \brief Reads an array of bulk serializable objects, that has no size prefix.
+   *
+   * \tparam T the type of the objects.
+   *
+   * \param[out] data the objects that will be read.
+   * \param count the number of objects.
+   *
+   * \return the number of objects that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto read_bulk(T* data, const usize count) noexcept -> usize
+  {
+    static_assert(is_bulk_serializable_v<T>, "The objects must be bulk serializable!");
+    static_assert(std::is_trivially_copyable_v<T>);
+    static_assert(sizeof(T) % detail::bulk_word_size<T> == 0);
+    assert(data || count == 0);
+
+    if (!m_ok || count == 0) {
+      return 0;
+    }
+
+    const auto read = SDL_RWread(m_source->get(), data, sizeof(T), count);
+    detail::swap_bulk(data, read);
+
+    m_ok = read == count;
+    return read;
+  }
+
+  /**
+   * \brief Indicates whether or not all reads have succeeded.
+   *
+   * \return `true` if no read has failed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto ok() const noexcept -> bool
+  {
+    return m_ok;
+  }
+
+  /// \copydoc ok()
+  explicit operator bool() const noexcept
+  {
+    return ok();
+  }
+
+ private:
+  file* m_source{};
+  bool m_ok{true};
+
+  template <typename T>
+  void load(T& value)
+  {
+    if constexpr (std::is_same_v<T, bool>) {
+      u8 byte{};
+      if (read_bulk(&byte, 1) == 1) {
+        value = byte != 0;
+      }
+    }
+    else if constexpr (is_bulk_serializable_v<T>) {
+      read_bulk(&value, 1);
+    }
+    else if constexpr (std::is_same_v<T, std::string>) {
+      if (const auto size = load_size(sizeof(char))) {
+        value.resize(*size);
+        read_bulk(value.data(), *size);
+      }
+    }
+    else if constexpr (detail::is_vector<T>) {
+      using value_type = typename T::value_type;
+
+      if constexpr (is_bulk_serializable_v<value_type>) {
+        if (const auto size = load_size(sizeof(value_type))) {
+          value.resize(*size);
+          read_bulk(value.data(), *size);
+        }
+      }
+      else if (const auto size = load_size(1)) {
+        value.clear();
+        value.reserve(*size);
+
+        for (usize index = 0; index < *size && m_ok; ++index) {
+          value_type element{};
+          load(element);
+          value.push_back(std::move(element));
+        }
+      }
+    }
+    else if constexpr (detail::has_member_serialize<T, binary_input_archive>) {
+      value.serialize(*this);
+    }
+    else {
+      serialize(*this, value);
+    }
+  }
+
+  // Reads a size prefix, which is validated against the remaining size of the file
+  auto load_size(const usize elementSize) noexcept -> std::optional<usize>
+  {
+    u64 size{};
+    if (read_bulk(&size, 1) != 1) {
+      return std::nullopt;
+    }
+
+    const auto total = m_source->size();
+    const auto offset = m_source->offset();
+    if (total && offset >= 0 && *total >= static_cast<usize>(offset)) {
+      const auto remaining = *total - static_cast<usize>(offset);
+      if (size > remaining / elementSize) {
+        m_ok = false;
+        return std::nullopt;
+      }
+    }
+
+    return static_cast<usize>(size);
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_BINARY_ARCHIVE_HEADER
@@ -0,0 +1,415 @@
+#ifndef CENTURION_BUFFERED_READER_HEADER
+#define CENTURION_BUFFERED_READER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // min
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+#include <cstring>    // memcpy, memmove
+#include <memory>     // unique_ptr, make_unique
+#include <optional>   // optional, nullopt
+
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "file.hpp"
+#include "seek_mode.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class buffered_reader
+ *
+ * \brief Reads from a file through an internal buffer.
+ *
+ * \details Every read function of `file` invokes the `SDL_RWops` of the file, which is
+ * slow when parsing binary formats one field at a time. A buffered reader reads large
+ * blocks from the file, and decodes individual values directly from its buffer, so that
+ * reading a field only costs a copy.
+ *
+ * \code{cpp}
+ *   cen::file file{"save.bin", cen::file_mode::read_existing_binary};
+ *   cen::buffered_reader reader{file};
+ *
+ *   const auto version = reader.read_little_endian_u32();
+ *   const auto level = reader.read_byte();
+ *   if (!reader.good()) {
+ *     // The file was truncated
+ *   }
+ * \endcode
+ *
+ * \note The reader reads ahead, so the offset of the underlying file is moved past the
+ * data that has been read through the reader. The file must outlive the reader, and
+ * should not be read from directly while the reader is used.
+ *
+ * \see `buffered_writer`
+ *
+ * \since 6.4.0
+ */
+class buffered_reader final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a buffered reader that reads from a file.
+   *
+   * \pre `source` must be a valid file.
+   * \pre `bufferSize` must be at least 8.
+   *
+   * \param source the file that will be read from.
+   * \param bufferSize the size of the internal buffer, in bytes.
+   *
+   * \since 6.4.0
+   */
+  explicit buffered_reader(file& source, const size_type bufferSize = default_buffer_size())
+      : m_source{&source}
+      , m_capacity{bufferSize}
+      , m_buffer{std::make_unique<u8[]>(bufferSize)}
+  {
+    assert(source);
+    assert(bufferSize >= sizeof(u64));
+  }
+
+  /// \name Read API
+  /// \{
+
+  /**
+   * \brief Reads objects from the file.
+   *
+   * \details Reads that are larger than the buffer bypass the buffer, once the buffered
+   * data has been consumed.
+   *
+   * \tparam T the type of the objects.
+   *
+   * \param[out] data the pointer to which the read objects will be written.
+   * \param maxCount the maximum number of objects that will be read.
+   *
+   * \return the number of objects that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto read_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    const auto bytes = read_bytes(reinterpret_cast<u8*>(data), sizeof(T) * maxCount);
+    return bytes / sizeof(T);
+  }
+
+  /**
+   * \brief Reads objects from the file into an array whose size is known at compile-time.
+   *
+   * \tparam T the type of the objects.
+   * \tparam size the size of the array.
+   *
+   * \param[out] data the array to which the read objects will be written.
+   *
+   * \return the number of objects that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T, usize size>
+  auto read_to(T (&data)[size]) noexcept -> size_type
+  {
+    return read_to(data, size);
+  }
+
+  /**
+   * \brief Reads objects from the file into a container.
+   *
+   * \tparam Container a contiguous container, e.g. `std::vector`, that provides `data()`
+   * and `size()`.
+   *
+   * \param[out] container the container that the read objects will be written to.
+   *
+   * \return the number of objects that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto read_to(Container& container) noexcept(noexcept(container.data()) &&
+                                              noexcept(container.size()))
+      -> size_type
+  {
+    return read_to(container.data(), container.size());
+  }
+
+  /**
+   * \brief Reads a single object from the file.
+   *
+   * \tparam T the type of the object.
+   *
+   * \return the read object; a value-initialized object if it couldn't be read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto read() noexcept(noexcept(T{})) -> T
+  {
+    T value{};
+    read_to(&value, 1);
+    return value;
+  }
+
+  /**
+   * \brief Reads an unsigned byte from the file.
+   *
+   * \return the read byte; zero if there is no more data.
+   *
+   * \since 6.4.0
+   */
+  auto read_byte() noexcept -> u8
+  {
+    return static_cast<u8>(read_value(1, false));
+  }
+
+  /**
+   * \brief Reads an unsigned 16-bit little-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_little_endian_u16() noexcept -> u16
+  {
+    return static_cast<u16>(read_value(sizeof(u16), false));
+  }
+
+  /**
+   * \brief Reads an unsigned 32-bit little-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_little_endian_u32() noexcept -> u32
+  {
+    return static_cast<u32>(read_value(sizeof(u32), false));
+  }
+
+  /**
+   * \brief Reads an unsigned 64-bit little-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_little_endian_u64() noexcept -> u64
+  {
+    return read_value(sizeof(u64), false);
+  }
+
+  /**
+   * \brief Reads an unsigned 16-bit big-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_big_endian_u16() noexcept -> u16
+  {
+    return static_cast<u16>(read_value(sizeof(u16), true));
+  }
+
+  /**
+   * \brief Reads an unsigned 32-bit big-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_big_endian_u32() noexcept -> u32
+  {
+    return static_cast<u32>(read_value(sizeof(u32), true));
+  }
+
+  /**
+   * \brief Reads an unsigned 64-bit big-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_big_endian_u64() noexcept -> u64
+  {
+    return read_value(sizeof(u64), true);
+  }
+
+  /// \} End of read API
+
+  /**
+   * \brief Moves the logical read position, and discards the buffered data.
+   *
+   * \param offset the offset to seek, relative to the seek mode.
+   * \param mode the seek mode, offsets relative to the current position are relative to
+   * the data that has been read through the reader.
+   *
+   * \return the resulting offset; `std::nullopt` if something went wrong.
+   *
+   * \since 6.4.0
+   */
+  auto seek(i64 offset, const seek_mode mode) noexcept -> std::optional<i64>
+  {
+    if (mode == seek_mode::relative_to_current) {
+      offset -= static_cast<i64>(available());
+    }
+
+    m_begin = 0;
+    m_end = 0;
+
+    const auto result = SDL_RWseek(m_source->get(), offset, to_underlying(mode));
+    if (result != -1) {
+      m_good = true;
+      return result;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Returns the logical read position, i.e. the offset of the next byte to read.
+   *
+   * \return the offset of the read position.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto offset() const noexcept -> i64
+  {
+    return m_source->offset() - static_cast<i64>(available());
+  }
+
+  /**
+   * \brief Indicates whether or not all reads could be fulfilled.
+   *
+   * \details This is reset by `seek()`.
+   *
+   * \return `true` if no read ran out of data; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto good() const noexcept -> bool
+  {
+    return m_good;
+  }
+
+  /**
+   * \brief Returns the amount of data that has been read ahead, but not consumed.
+   *
+   * \return the number of buffered bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto available() const noexcept -> size_type
+  {
+    return m_end - m_begin;
+  }
+
+  /**
+   * \brief Returns the size of the internal buffer.
+   *
+   * \return the buffer size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffer_size() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the default buffer size.
+   *
+   * \return the default buffer size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_buffer_size() noexcept -> size_type
+  {
+    return 4'096;
+  }
+
+ private:
+  file* m_source{};
+  size_type m_capacity{};
+  std::unique_ptr<u8[]> m_buffer;
+  size_type m_begin{};  ///< The offset of the first unread byte in the buffer.
+  size_type m_end{};    ///< The offset past the last buffered byte.
+  bool m_good{true};
+
+  // Attempts to buffer at least the specified amount of bytes
+  auto fill(const size_type amount) noexcept -> bool
+  {
+    if (available() >= amount) {
+      return true;
+    }
+
+    const auto remaining = available();
+    std::memmove(m_buffer.get(), m_buffer.get() + m_begin, remaining);
+
+    m_begin = 0;
+    m_end = remaining;
+    m_end += SDL_RWread(m_source->get(), m_buffer.get() + m_end, 1, m_capacity - m_end);
+
+    return available() >= amount;
+  }
+
+  auto read_bytes(u8* data, size_type size) noexcept -> size_type
+  {
+    const auto buffered = std::min(size, available());
+    std::memcpy(data, m_buffer.get() + m_begin, buffered);
+    m_begin += buffered;
+
+    data += buffered;
+    size -= buffered;
+
+    size_type read = buffered;
+
+    if (size >= m_capacity) {
+      read += SDL_RWread(m_source->get(), data, 1, size);
+    }
+    else if (size != 0) {
+      fill(size);
+
+      const auto amount = std::min(size, available());
+      std::memcpy(data, m_buffer.get() + m_begin, amount);
+      m_begin += amount;
+      read += amount;
+    }
+
+    if (read != buffered + size) {
+      m_good = false;
+    }
+
+    return read;
+  }
+
+  auto read_value(const size_type size, const bool bigEndian) noexcept -> u64
+  {
+    if (!fill(size)) {
+      m_begin = m_end;  // Consume the incomplete value, like SDL does
+      m_good = false;
+      return 0;
+    }
+
+    const auto* bytes = m_buffer.get() + m_begin;
+    m_begin += size;
+
+    u64 value = 0;
+    for (size_type index = 0; index < size; ++index) {
+      const auto shift = bigEndian ? (size - 1 - index) * 8 : index * 8;
+      value |= static_cast<u64>(bytes[index]) << shift;
+    }
+
+    return value;
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_BUFFERED_READER_HEADER
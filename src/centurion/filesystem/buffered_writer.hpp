@@ -0,0 +1,325 @@
+#ifndef CENTURION_BUFFERED_WRITER_HEADER
+#define CENTURION_BUFFERED_WRITER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy
+#include <memory>   // unique_ptr, make_unique
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class buffered_writer
+ *
+ * \brief Writes to a file through an internal buffer.
+ *
+ * \details Every write function of `file` invokes the `SDL_RWops` of the file, which is
+ * slow when writing binary formats one field at a time. A buffered writer encodes
+ * individual values directly into its buffer, and writes the buffer to the file once it
+ * is full, when `flush()` is called, or when the writer is destroyed.
+ *
+ * \code{cpp}
+ *   cen::file file{"save.bin", cen::file_mode::write_binary};
+ *   cen::buffered_writer writer{file};
+ *
+ *   writer.write_as_little_endian(version);
+ *   writer.write_byte(level);
+ *
+ *   if (!writer.flush()) {
+ *     // Handle the write error
+ *   }
+ * \endcode
+ *
+ * \note Errors are only detected when the buffer is written to the file, so the write
+ * functions may succeed even though the data is never written. Check the result of
+ * `flush()` to detect errors. The file must outlive the writer.
+ *
+ * \see `buffered_reader`
+ *
+ * \since 6.4.0
+ */
+class buffered_writer final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a buffered writer that writes to a file.
+   *
+   * \pre `target` must be a valid file.
+   * \pre `bufferSize` must be at least 8.
+   *
+   * \param target the file that will be written to.
+   * \param bufferSize the size of the internal buffer, in bytes.
+   *
+   * \since 6.4.0
+   */
+  explicit buffered_writer(file& target, const size_type bufferSize = default_buffer_size())
+      : m_target{&target}
+      , m_capacity{bufferSize}
+      , m_buffer{std::make_unique<u8[]>(bufferSize)}
+  {
+    assert(target);
+    assert(bufferSize >= sizeof(u64));
+  }
+
+  buffered_writer(const buffered_writer&) = delete;
+  auto operator=(const buffered_writer&) -> buffered_writer& = delete;
+
+  /**
+   * \brief Writes the buffered data to the file.
+   *
+   * \since 6.4.0
+   */
+  ~buffered_writer() noexcept
+  {
+    flush();
+  }
+
+  /// \name Write API
+  /// \{
+
+  /**
+   * \brief Writes objects to the file.
+   *
+   * \details Writes that are larger than the buffer bypass the buffer, once the buffered
+   * data has been flushed.
+   *
+   * \tparam T the type of the objects.
+   *
+   * \param data a pointer to the objects that will be written.
+   * \param count the number of objects that will be written.
+   *
+   * \return the number of objects that were written, or buffered.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto write(const T* data, const size_type count) noexcept -> size_type
+  {
+    const auto bytes = write_bytes(reinterpret_cast<const u8*>(data), sizeof(T) * count);
+    return bytes / sizeof(T);
+  }
+
+  /**
+   * \brief Writes the objects of an array whose size is known at compile-time.
+   *
+   * \tparam T the type of the objects.
+   * \tparam size the size of the array.
+   *
+   * \param data the array whose objects will be written.
+   *
+   * \return the number of objects that were written, or buffered.
+   *
+   * \since 6.4.0
+   */
+  template <typename T, usize size>
+  auto write(const T (&data)[size]) noexcept -> size_type
+  {
+    return write(data, size);
+  }
+
+  /**
+   * \brief Writes the objects of a container.
+   *
+   * \tparam Container a contiguous container, e.g. `std::vector`, that provides `data()`
+   * and `size()`.
+   *
+   * \param container the container whose objects will be written.
+   *
+   * \return the number of objects that were written, or buffered.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto write(const Container& container) noexcept(noexcept(container.data()) &&
+                                                 noexcept(container.size()))
+      -> size_type
+  {
+    return write(container.data(), container.size());
+  }
+
+  /**
+   * \brief Writes an unsigned byte to the file.
+   *
+   * \param value the byte that will be written.
+   *
+   * \return `success` if the byte was buffered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto write_byte(const u8 value) noexcept -> result
+  {
+    return write_value(value, 1, false);
+  }
+
+  /**
+   * \brief Writes an unsigned 16-bit integer to the file, as a little-endian value.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto write_as_little_endian(const u16 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u16), false);
+  }
+
+  /// \copydoc write_as_little_endian(u16)
+  auto write_as_little_endian(const u32 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u32), false);
+  }
+
+  /// \copydoc write_as_little_endian(u16)
+  auto write_as_little_endian(const u64 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u64), false);
+  }
+
+  /**
+   * \brief Writes an unsigned 16-bit integer to the file, as a big-endian value.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto write_as_big_endian(const u16 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u16), true);
+  }
+
+  /// \copydoc write_as_big_endian(u16)
+  auto write_as_big_endian(const u32 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u32), true);
+  }
+
+  /// \copydoc write_as_big_endian(u16)
+  auto write_as_big_endian(const u64 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u64), true);
+  }
+
+  /// \} End of write API
+
+  /**
+   * \brief Writes the buffered data to the file.
+   *
+   * \return `success` if all buffered data was written; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto flush() noexcept -> result
+  {
+    if (m_size == 0) {
+      return success;
+    }
+
+    const auto written = SDL_RWwrite(m_target->get(), m_buffer.get(), 1, m_size);
+    const auto flushed = written == m_size;
+
+    m_size = 0;
+    return flushed;
+  }
+
+  /**
+   * \brief Returns the amount of data that hasn't been written to the file yet.
+   *
+   * \return the number of buffered bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffered() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the size of the internal buffer.
+   *
+   * \return the buffer size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffer_size() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the default buffer size.
+   *
+   * \return the default buffer size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_buffer_size() noexcept -> size_type
+  {
+    return 4'096;
+  }
+
+ private:
+  file* m_target{};
+  size_type m_capacity{};
+  std::unique_ptr<u8[]> m_buffer;
+  size_type m_size{};
+
+  auto write_bytes(const u8* data, const size_type size) noexcept -> size_type
+  {
+    if (m_size + size <= m_capacity) {
+      std::memcpy(m_buffer.get() + m_size, data, size);
+      m_size += size;
+      return size;
+    }
+
+    if (!flush()) {
+      return 0;
+    }
+
+    if (size >= m_capacity) {
+      return SDL_RWwrite(m_target->get(), data, 1, size);
+    }
+    else {
+      std::memcpy(m_buffer.get(), data, size);
+      m_size = size;
+      return size;
+    }
+  }
+
+  auto write_value(const u64 value, const size_type size, const bool bigEndian) noexcept
+      -> result
+  {
+    if (m_size + size > m_capacity && !flush()) {
+      return failure;
+    }
+
+    auto* bytes = m_buffer.get() + m_size;
+    for (size_type index = 0; index < size; ++index) {
+      const auto shift = bigEndian ? (size - 1 - index) * 8 : index * 8;
+      bytes[index] = static_cast<u8>(value >> shift);
+    }
+
+    m_size += size;
+    return success;
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_BUFFERED_WRITER_HEADER
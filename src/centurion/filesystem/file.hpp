@@ -7,19 +7,27 @@
 #include <SDL2/SDL_image.h>
 #endif  // CENTURION_NO_SDL_IMAGE
 
-#include <cassert>   // assert
-#include <cstddef>   // size_t
-#include <memory>    // unique_ptr
-#include <optional>  // optional
-#include <string>    // string
+#include <algorithm>    // min
+#include <cassert>      // assert
+#include <cstddef>      // size_t, byte
+#include <cstring>      // memcpy
+#include <memory>       // unique_ptr
+#include <optional>     // optional
+#include <string>       // string
+#include <type_traits>  // is_same_v
+#include <vector>       // vector
 
 #include "../core/integers.hpp"
 #include "../core/not_null.hpp"
+#include "../core/owner.hpp"
 #include "../core/result.hpp"
 #include "../core/str.hpp"
 #include "../core/to_underlying.hpp"
+#include "../system/byte_order.hpp"
+#include "../system/profiler_macros.hpp"
 #include "file_mode.hpp"
 #include "file_type.hpp"
+#include "image_format.hpp"
 #include "seek_mode.hpp"
 
 namespace cen {
@@ -269,6 +277,54 @@ class file final
     return SDL_WriteBE64(m_context.get(), value) == 1;
   }
 
+  /**
+   * \brief Writes an array of unsigned integers to the file, as little endian values.
+   *
+   * \details On little endian platforms the values are written directly, otherwise they
+   * are swapped in blocks with SIMD instructions, if available, before they are written.
+   * The supplied values are never modified.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, must be `u16`, `u32` or `u64`.
+   *
+   * \param data the values that will be written, in the native endianness.
+   * \param count the number of values that will be written.
+   *
+   * \return the number of values that were written.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto write_as_little_endian(const T* data, const size_type count) noexcept -> size_type
+  {
+    return write_swapped<SDL_BIG_ENDIAN>(data, count);
+  }
+
+  /**
+   * \brief Writes an array of unsigned integers to the file, as big endian values.
+   *
+   * \details On big endian platforms the values are written directly, otherwise they are
+   * swapped in blocks with SIMD instructions, if available, before they are written. The
+   * supplied values are never modified.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, must be `u16`, `u32` or `u64`.
+   *
+   * \param data the values that will be written, in the native endianness.
+   * \param count the number of values that will be written.
+   *
+   * \return the number of values that were written.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto write_as_big_endian(const T* data, const size_type count) noexcept -> size_type
+  {
+    return write_swapped<SDL_LIL_ENDIAN>(data, count);
+  }
+
   /// \} End of write API
 
   /// \name Read API
@@ -474,6 +530,151 @@ class file final
     return SDL_ReadBE64(m_context.get());
   }
 
+  /**
+   * \brief Reads an array of little endian unsigned integers from the file.
+   *
+   * \details The values are read with a single read, and are then swapped in place with
+   * SIMD instructions, if available, unless the platform is little endian.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, must be `u16`, `u32` or `u64`.
+   *
+   * \param[out] data the pointer to which the values will be written, in the native
+   * endianness.
+   * \param maxCount the maximum number of values that will be read.
+   *
+   * \return the number of values that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto read_little_endian_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    static_assert(is_swappable<T>, "The values must be u16, u32 or u64!");
+
+    const auto count = read_to(data, maxCount);
+    swap_little_endian(data, count);
+
+    return count;
+  }
+
+  /**
+   * \brief Reads an array of big endian unsigned integers from the file.
+   *
+   * \details The values are read with a single read, and are then swapped in place with
+   * SIMD instructions, if available, unless the platform is big endian.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, must be `u16`, `u32` or `u64`.
+   *
+   * \param[out] data the pointer to which the values will be written, in the native
+   * endianness.
+   * \param maxCount the maximum number of values that will be read.
+   *
+   * \return the number of values that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto read_big_endian_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    static_assert(is_swappable<T>, "The values must be u16, u32 or u64!");
+
+    const auto count = read_to(data, maxCount);
+    swap_big_endian(data, count);
+
+    return count;
+  }
+
+  /**
+   * \brief Reads the remainder of the file into a container, replacing its contents.
+   *
+   * \details The size of the file is only queried once, so that the container can be
+   * resized exactly and filled with a single read. Streams with an unknown size, e.g.
+   * pipes, are read in chunks until no more data is available. The capacity of the
+   * container is reused, which makes this useful for reading many files into a single
+   * scratch buffer.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam Container a contiguous container of bytes that provides `data()`, `size()`
+   * and `resize()`, e.g. `std::vector<std::byte>` or `std::string`.
+   *
+   * \param[out] container the container to which the read data will be written to.
+   *
+   * \return the number of bytes that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto read_all_to(Container& container) -> size_type
+  {
+    CENTURION_PROFILE_ZONE("file::read_all");
+
+    static_assert(sizeof(typename Container::value_type) == 1,
+                  "The container must store bytes!");
+    assert(m_context);
+
+    container.clear();
+
+    size_type read = 0;
+    if (const auto remaining = remaining_size()) {
+      container.resize(*remaining);
+      read = read_chunks(container.data(), *remaining);
+    }
+    else {
+      constexpr size_type chunk = 65'536;
+      size_type count = chunk;
+
+      while (count == chunk) {
+        container.resize(read + chunk);
+        count = read_chunks(container.data() + read, chunk);
+        read += count;
+      }
+    }
+
+    container.resize(read);
+    return read;
+  }
+
+  /**
+   * \brief Reads the remainder of the file.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \return the read bytes, which are empty if nothing could be read.
+   *
+   * \see `read_all_to()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto read_all() -> std::vector<std::byte>
+  {
+    std::vector<std::byte> data;
+    read_all_to(data);
+    return data;
+  }
+
+  /**
+   * \brief Reads the remainder of the file as text.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \return the read text, which is empty if nothing could be read.
+   *
+   * \see `read_all_to()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto read_all_as_string() -> std::string
+  {
+    std::string text;
+    read_all_to(text);
+    return text;
+  }
+
   /// \} End of read API
 
   /// \name File type queries
@@ -665,6 +866,35 @@ class file final
 
 #endif  // CENTURION_NO_SDL_IMAGE
 
+  /**
+   * \brief Detects the image format of the file with a single read.
+   *
+   * \details Each of the `is_*()` functions reads the header of the file again, so
+   * prefer this function when the format of a file is unknown, e.g. when scanning asset
+   * directories. The leading bytes are read from the current offset, which is restored
+   * afterwards. This function doesn't require SDL_image.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \return the detected image format; `image_format::unknown` if the format wasn't
+   * recognized, or if the file couldn't be read.
+   *
+   * \see `detect_image_format(const void*, usize)`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto detect_image_format() const noexcept -> image_format
+  {
+    assert(m_context);
+
+    u8 header[image_header_size()];
+
+    const auto read = SDL_RWread(m_context.get(), header, 1, sizeof header);
+    SDL_RWseek(m_context.get(), -static_cast<i64>(read), RW_SEEK_CUR);
+
+    return cen::detect_image_format(header, read);
+  }
+
   /// \} End of file type queries
 
   /**
@@ -748,6 +978,21 @@ class file final
     return m_context.get();
   }
 
+  /**
+   * \brief Releases ownership of the internal file context.
+   *
+   * \details This is useful for SDL functions that close the supplied context, e.g.
+   * `Mix_LoadMUS_RW()` when `freesrc` is non-zero. The file is null after this call.
+   *
+   * \return the internal file context, which must be closed by the caller.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto release() noexcept -> owner<SDL_RWops*>
+  {
+    return m_context.release();
+  }
+
   /**
    * \brief Indicates whether or not the file holds a non-null pointer.
    *
@@ -770,6 +1015,75 @@ class file final
   };
   std::unique_ptr<SDL_RWops, deleter> m_context;
 
+  template <typename T>
+  inline constexpr static bool is_swappable =
+      std::is_same_v<T, u16> || std::is_same_v<T, u32> || std::is_same_v<T, u64>;
+
+  // Writes values, swapping them first if the native byte order is SwappedOrder
+  template <int SwappedOrder, typename T>
+  auto write_swapped(const T* data, const size_type count) noexcept -> size_type
+  {
+    static_assert(is_swappable<T>, "The values must be u16, u32 or u64!");
+    assert(m_context);
+
+    if constexpr (SDL_BYTEORDER != SwappedOrder) {
+      return SDL_RWwrite(get(), data, sizeof(T), count);
+    }
+    else {
+      constexpr size_type block_size = 4'096 / sizeof(T);
+      T block[block_size];
+
+      size_type written = 0;
+      while (written < count) {
+        const auto amount = std::min(block_size, count - written);
+
+        std::memcpy(block, data + written, amount * sizeof(T));
+        swap_byte_order(block, amount);
+
+        const auto result = SDL_RWwrite(get(), block, sizeof(T), amount);
+        written += result;
+
+        if (result != amount) {
+          break;
+        }
+      }
+
+      return written;
+    }
+  }
+
+  // Returns the amount of bytes between the current offset and the end of the file
+  [[nodiscard]] auto remaining_size() const noexcept -> std::optional<size_type>
+  {
+    const auto size = SDL_RWsize(m_context.get());
+    const auto offset = SDL_RWtell(m_context.get());
+
+    if (size != -1 && offset != -1 && size >= offset) {
+      return static_cast<size_type>(size - offset);
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  // Reads until the requested amount has been read, or no more data is available
+  auto read_chunks(void* data, const size_type size) noexcept -> size_type
+  {
+    auto* bytes = static_cast<char*>(data);
+
+    size_type read = 0;
+    while (read < size) {
+      const auto count = SDL_RWread(m_context.get(), bytes + read, 1, size - read);
+      if (count == 0) {
+        break;
+      }
+
+      read += count;
+    }
+
+    return read;
+  }
+
   [[nodiscard]] static auto to_string(const file_mode mode) noexcept -> str
   {
     switch (mode) {
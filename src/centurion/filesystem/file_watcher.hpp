@@ -0,0 +1,401 @@
+#ifndef CENTURION_FILE_WATCHER_HEADER
+#define CENTURION_FILE_WATCHER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <memory>         // unique_ptr, make_unique
+#include <ostream>        // ostream
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../compiler/linkage.hpp"
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../events/event_channel.hpp"
+#include "../thread/thread.hpp"
+#include "base_path.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \enum file_action
+ *
+ * \brief Represents the different kinds of file changes reported by file watchers.
+ *
+ * \since 6.4.0
+ */
+enum class file_action
+{
+  added,     ///< A file was created.
+  modified,  ///< A file was written to, or replaced by a renamed file.
+  removed    ///< A file was deleted, or renamed to another path.
+};
+
+/**
+ * \struct file_change
+ *
+ * \brief Provides information about a changed file.
+ *
+ * \since 6.4.0
+ */
+struct file_change final
+{
+  std::string path;    ///< The path of the file, relative to the watched directory.
+  file_action action;  ///< The kind of change.
+};
+
+/// \} End of group filesystem
+
+/// \cond FALSE
+
+namespace detail {
+
+// Platform specific state of a watched directory tree, see detail/file_watcher_impl.hpp
+struct directory_monitor;
+
+inline constexpr u32 infinite_timeout = 0xFFFF'FFFF;
+
+// Returns null if the directory can't be watched, or if watching isn't supported
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto open_directory_monitor(
+    const std::string& root) -> directory_monitor*;
+
+CENTURION_API CENTURION_LIB_INLINE void close_directory_monitor(
+    directory_monitor* monitor) noexcept;
+
+// Wakes a thread that is blocked in poll_directory_monitor(), which then returns false
+CENTURION_API CENTURION_LIB_INLINE void stop_directory_monitor(
+    directory_monitor& monitor) noexcept;
+
+// Waits for notifications, and appends them to the changes; false if the monitor stopped
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto poll_directory_monitor(
+    directory_monitor& monitor,
+    u32 timeout,
+    std::vector<file_change>& changes) -> bool;
+
+}  // namespace detail
+
+/// \endcond
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class file_watcher
+ *
+ * \brief Watches a directory tree for changed files, e.g. to hot-reload assets.
+ *
+ * \details A file watcher monitors a directory and all of its subdirectories on a
+ * background thread, using inotify on Linux and `ReadDirectoryChangesW()` on Windows. The
+ * changed files are posted to an event channel, which can be attached to an event
+ * dispatcher, so that caches only reload the files that actually changed.
+ * \code{cpp}
+ *   cen::event_channel<cen::file_change> changes;
+ *   cen::file_watcher watcher{changes};
+ *
+ *   dispatcher.attach(changes);
+ *   dispatcher.bind<cen::file_change>().to<&assets::on_file_changed>(&assets);
+ * \endcode
+ *
+ * \details Saving a file typically triggers a burst of notifications, so changes are
+ * debounced. A change is only posted once its file hasn't changed for the debounce
+ * interval, and the notifications of the burst are merged into one change, e.g. a file
+ * that is created and then written to is reported as added.
+ *
+ * \details Changed paths use slashes as separators, regardless of the platform, and
+ * changes to directories themselves are not reported. Directories created after the
+ * watcher are watched as well, but files that are moved along with a directory are not
+ * reported individually.
+ *
+ * \note On other platforms, the watcher is never active.
+ *
+ * \since 6.4.0
+ */
+class file_watcher final
+{
+ public:
+  using channel_type = event_channel<file_change>;
+  using ms_type = milliseconds<u32>;
+
+  /**
+   * \brief Watches the base path of the application.
+   *
+   * \param channel the event channel that receives the changes, must outlive the watcher.
+   * \param debounce the time that a file must stay unchanged before it is reported.
+   *
+   * \throws sdl_error if the worker thread cannot be created.
+   *
+   * \see `base_path()`
+   *
+   * \since 6.4.0
+   */
+  explicit file_watcher(channel_type& channel, const ms_type debounce = default_debounce())
+      : file_watcher{channel, base_path().copy(), debounce}
+  {}
+
+  /**
+   * \brief Watches a directory and its subdirectories.
+   *
+   * \param channel the event channel that receives the changes, must outlive the watcher.
+   * \param root the path of the watched directory, must end with a path separator.
+   * \param debounce the time that a file must stay unchanged before it is reported.
+   *
+   * \throws sdl_error if the worker thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  file_watcher(channel_type& channel,
+               std::string root,
+               const ms_type debounce = default_debounce())
+      : m_channel{&channel}
+      , m_root{std::move(root)}
+      , m_debounce{debounce}
+  {
+    m_monitor = detail::open_directory_monitor(m_root);
+    if (m_monitor) {
+      m_worker = std::make_unique<thread>(&file_watcher::run, "file_watcher", this);
+    }
+  }
+
+  file_watcher(const file_watcher&) = delete;
+
+  auto operator=(const file_watcher&) -> file_watcher& = delete;
+
+  /**
+   * \brief Stops watching the directory.
+   *
+   * \details Changes that haven't been posted yet are discarded.
+   *
+   * \since 6.4.0
+   */
+  ~file_watcher() noexcept
+  {
+    if (m_worker) {
+      detail::stop_directory_monitor(*m_monitor);
+      m_worker.reset();
+    }
+
+    detail::close_directory_monitor(m_monitor);
+  }
+
+  /**
+   * \brief Returns the path of the watched directory.
+   *
+   * \return the root of the watched directory tree.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto root() const noexcept -> const std::string&
+  {
+    return m_root;
+  }
+
+  /**
+   * \brief Returns the debounce interval.
+   *
+   * \return the time that a file must stay unchanged before it is reported.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto debounce() const noexcept -> ms_type
+  {
+    return m_debounce;
+  }
+
+  /**
+   * \brief Indicates whether or not the directory is being watched.
+   *
+   * \return `true` if the directory is watched; `false` if it couldn't be opened, or if
+   * file watching isn't supported on the platform.
+   *
+   * \since 6.4.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return m_worker != nullptr;
+  }
+
+  /**
+   * \brief Returns the default debounce interval.
+   *
+   * \return the default debounce interval.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_debounce() noexcept -> ms_type
+  {
+    return ms_type{100};
+  }
+
+ private:
+  struct pending_change final
+  {
+    file_action action{};
+    u32 time{};  ///< The time of the latest notification, in milliseconds.
+  };
+
+  channel_type* m_channel{};
+  std::string m_root;
+  ms_type m_debounce;
+  std::unordered_map<std::string, pending_change> m_pending;  ///< Only used by the worker.
+
+  detail::directory_monitor* m_monitor{};
+  std::unique_ptr<thread> m_worker;  // Last, so that the worker stops first
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<file_watcher*>(data);
+    std::vector<file_change> changes;
+
+    while (true) {
+      const auto timeout =
+          self.m_pending.empty() ? detail::infinite_timeout : self.time_until_settled();
+      if (!detail::poll_directory_monitor(*self.m_monitor, timeout, changes)) {
+        break;
+      }
+
+      for (auto& [path, action] : changes) {
+        self.record(std::move(path), action);
+      }
+
+      changes.clear();
+      self.post_settled();
+    }
+
+    return 0;
+  }
+
+  // Merges a notification with the pending change of the same file
+  void record(std::string path, const file_action action)
+  {
+    const auto now = SDL_GetTicks();
+
+    const auto [it, inserted] = m_pending.try_emplace(std::move(path), pending_change{action});
+    auto& change = it->second;
+
+    if (!inserted) {
+      if (change.action == file_action::added && action == file_action::removed) {
+        m_pending.erase(it);  // A temporary file
+        return;
+      }
+      else if (change.action == file_action::removed && action == file_action::added) {
+        change.action = file_action::modified;  // Replaced
+      }
+      else if (change.action != file_action::added) {
+        change.action = action;
+      }
+    }
+
+    change.time = now;
+  }
+
+  [[nodiscard]] auto time_until_settled() const noexcept -> u32
+  {
+    const auto now = SDL_GetTicks();
+    auto remaining = m_debounce.count();
+
+    for (const auto& [path, change] : m_pending) {
+      const auto elapsed = now - change.time;
+      const auto left = elapsed < m_debounce.count() ? m_debounce.count() - elapsed : 0;
+
+      if (left < remaining) {
+        remaining = left;
+      }
+    }
+
+    // Avoids spinning if the channel is full
+    return remaining != 0 ? remaining : 1;
+  }
+
+  void post_settled()
+  {
+    const auto now = SDL_GetTicks();
+
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+      const auto& [path, change] = *it;
+
+      if (now - change.time < m_debounce.count() ||
+          !m_channel->try_emplace(file_change{path, change.action}))
+      {
+        ++it;
+      }
+      else {
+        it = m_pending.erase(it);
+      }
+    }
+  }
+};
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied file action.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(file_action::added) == "added"`.
+ *
+ * \param action the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const file_action action) -> std::string_view
+{
+  switch (action) {
+    case file_action::added:
+      return "added";
+
+    case file_action::modified:
+      return "modified";
+
+    case file_action::removed:
+      return "removed";
+
+    default:
+      throw cen_error{"Did not recognize file action!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a file action enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param action the enumerator that will be printed.
+ *
+ * \see `to_string(file_action)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const file_action action) -> std::ostream&
+{
+  return stream << to_string(action);
+}
+
+/// \} End of streaming
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#if CENTURION_LIB_DEFINITIONS
+#include "../detail/file_watcher_impl.hpp"
+#endif  // CENTURION_LIB_DEFINITIONS
+
+#endif  // CENTURION_FILE_WATCHER_HEADER
@@ -0,0 +1,297 @@
+#ifndef CENTURION_IMAGE_FORMAT_HEADER
+#define CENTURION_IMAGE_FORMAT_HEADER
+
+#include <cstring>      // memcmp
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \enum image_format
+ *
+ * \brief Provides values that represent the image formats recognized by SDL_image.
+ *
+ * \see `detect_image_format()`
+ *
+ * \since 6.4.0
+ */
+enum class image_format
+{
+  unknown,  ///< An unrecognized format.
+  png,      ///< A PNG image.
+  jpg,      ///< A JPEG image.
+  gif,      ///< A GIF image.
+  bmp,      ///< A BMP image.
+  ico,      ///< An ICO icon.
+  cur,      ///< A CUR cursor.
+  webp,     ///< A WebP image.
+  tif,      ///< A TIFF image.
+  pnm,      ///< A PBM, PGM or PPM image.
+  pcx,      ///< A PCX image.
+  lbm,      ///< An IFF ILBM or PBM image.
+  xcf,      ///< A GIMP XCF image.
+  xpm,      ///< An XPM image.
+  xv,       ///< An XV thumbnail.
+  svg,      ///< An SVG image.
+  qoi       ///< A QOI image, which is decoded by the library itself.
+};
+
+/// \name Image format detection
+/// \{
+
+/**
+ * \brief Returns the amount of leading bytes used to detect image formats.
+ *
+ * \details Only SVG images may need this many bytes, since the `<svg` tag can be preceded
+ * by an XML prolog and comments. All other formats are detected from their first 16
+ * bytes.
+ *
+ * \return the maximum number of bytes inspected by `detect_image_format()`.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto image_header_size() noexcept -> usize
+{
+  return 4'096;
+}
+
+/// \cond FALSE
+namespace detail {
+
+[[nodiscard]] inline auto has_magic(const u8* data,
+                                    const usize size,
+                                    const char* magic,
+                                    const usize length) noexcept -> bool
+{
+  return size >= length && std::memcmp(data, magic, length) == 0;
+}
+
+[[nodiscard]] inline auto contains_text(const u8* data,
+                                        const usize size,
+                                        const char* text,
+                                        const usize length) noexcept -> bool
+{
+  for (usize index = 0; index + length <= size; ++index) {
+    if (std::memcmp(data + index, text, length) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+[[nodiscard]] constexpr auto is_pnm_space(const u8 ch) noexcept -> bool
+{
+  return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Detects the format of an image from its leading bytes.
+ *
+ * \details This function classifies an image from a single buffer, using signatures
+ * equivalent to those of the `IMG_is*()` functions of SDL_image, but without reading from
+ * a file for every candidate format. This makes it considerably cheaper to classify large
+ * amounts of files.
+ *
+ * \param data the leading bytes of the image, can be null if `size` is zero.
+ * \param size the amount of available bytes, only the first `image_header_size()` bytes
+ * are inspected.
+ *
+ * \return the detected image format; `image_format::unknown` if it wasn't recognized.
+ *
+ * \see `file::detect_image_format()`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto detect_image_format(const void* data, usize size) noexcept
+    -> image_format
+{
+  using detail::has_magic;
+
+  const auto* bytes = static_cast<const u8*>(data);
+  if (size > image_header_size()) {
+    size = image_header_size();
+  }
+
+  if (has_magic(bytes, size, "\x89PNG", 4)) {
+    return image_format::png;
+  }
+  else if (has_magic(bytes, size, "\xFF\xD8\xFF", 3)) {
+    return image_format::jpg;
+  }
+  else if (has_magic(bytes, size, "GIF87a", 6) || has_magic(bytes, size, "GIF89a", 6)) {
+    return image_format::gif;
+  }
+  else if (has_magic(bytes, size, "BM", 2)) {
+    return image_format::bmp;
+  }
+  else if (size >= 6 && bytes[0] == 0 && bytes[1] == 0 && bytes[3] == 0 &&
+           (bytes[4] != 0 || bytes[5] != 0))
+  {
+    // Icons and cursors share the layout, and must contain at least one image
+    if (bytes[2] == 1) {
+      return image_format::ico;
+    }
+    else if (bytes[2] == 2) {
+      return image_format::cur;
+    }
+  }
+
+  if (has_magic(bytes, size, "RIFF", 4) && size >= 15 &&
+      std::memcmp(bytes + 8, "WEBPVP8", 7) == 0)
+  {
+    return image_format::webp;
+  }
+  else if (has_magic(bytes, size, "II*\0", 4) || has_magic(bytes, size, "MM\0*", 4)) {
+    return image_format::tif;
+  }
+  else if (has_magic(bytes, size, "P7 332", 6)) {
+    return image_format::xv;
+  }
+  else if (size >= 3 && bytes[0] == 'P' && bytes[1] >= '1' && bytes[1] <= '6' &&
+           detail::is_pnm_space(bytes[2]))
+  {
+    return image_format::pnm;
+  }
+  else if (size >= 3 && bytes[0] == 10 && bytes[1] == 5 && bytes[2] == 1) {
+    return image_format::pcx;
+  }
+  else if (has_magic(bytes, size, "FORM", 4) && size >= 12 &&
+           (std::memcmp(bytes + 8, "ILBM", 4) == 0 || std::memcmp(bytes + 8, "PBM ", 4) == 0))
+  {
+    return image_format::lbm;
+  }
+  else if (has_magic(bytes, size, "gimp xcf", 8)) {
+    return image_format::xcf;
+  }
+  else if (has_magic(bytes, size, "/* XPM */", 9)) {
+    return image_format::xpm;
+  }
+  else if (has_magic(bytes, size, "qoif", 4)) {
+    return image_format::qoi;
+  }
+  else if (detail::contains_text(bytes, size, "<svg", 4)) {
+    return image_format::svg;
+  }
+  else {
+    return image_format::unknown;
+  }
+}
+
+/// \} End of image format detection
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied image format.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(image_format::png) == "png"`.
+ *
+ * \param format the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const image_format format) -> std::string_view
+{
+  switch (format) {
+    case image_format::unknown:
+      return "unknown";
+
+    case image_format::png:
+      return "png";
+
+    case image_format::jpg:
+      return "jpg";
+
+    case image_format::gif:
+      return "gif";
+
+    case image_format::bmp:
+      return "bmp";
+
+    case image_format::ico:
+      return "ico";
+
+    case image_format::cur:
+      return "cur";
+
+    case image_format::webp:
+      return "webp";
+
+    case image_format::tif:
+      return "tif";
+
+    case image_format::pnm:
+      return "pnm";
+
+    case image_format::pcx:
+      return "pcx";
+
+    case image_format::lbm:
+      return "lbm";
+
+    case image_format::xcf:
+      return "xcf";
+
+    case image_format::xpm:
+      return "xpm";
+
+    case image_format::xv:
+      return "xv";
+
+    case image_format::svg:
+      return "svg";
+
+    case image_format::qoi:
+      return "qoi";
+
+    default:
+      throw cen_error{"Did not recognize image format!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of an image format enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param format the enumerator that will be printed.
+ *
+ * \see `to_string(image_format)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const image_format format) -> std::ostream&
+{
+  return stream << to_string(format);
+}
+
+/// \} End of streaming
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_IMAGE_FORMAT_HEADER
@@ -0,0 +1,557 @@
+#ifndef CENTURION_IO_SERVICE_HEADER
+#define CENTURION_IO_SERVICE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>     // assert
+#include <cstddef>     // byte
+#include <deque>       // deque
+#include <exception>   // exception
+#include <functional>  // function
+#include <memory>      // unique_ptr, make_unique, shared_ptr, make_shared
+#include <optional>    // optional
+#include <string>      // string
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../events/event_channel.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/coroutine.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "file.hpp"
+#include "file_mode.hpp"
+#include "seek_mode.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \enum io_operation
+ *
+ * \brief Represents the different kinds of asynchronous file operations.
+ *
+ * \since 6.4.0
+ */
+enum class io_operation
+{
+  read,   ///< Reads a file, or a range of a file.
+  write,  ///< Replaces the contents of a file.
+  append  ///< Appends data to a file, which is created if it doesn't exist.
+};
+
+/**
+ * \struct io_completion
+ *
+ * \brief Provides the outcome of an asynchronous file operation.
+ *
+ * \since 6.4.0
+ */
+struct io_completion final
+{
+  usize id{};                   ///< The ID returned when the operation was submitted.
+  io_operation operation{};     ///< The kind of operation.
+  std::string path;             ///< The path of the file.
+  std::vector<std::byte> data;  ///< The read data, or the written buffer.
+  usize transferred{};          ///< The amount of bytes that were read or written.
+  bool succeeded{};             ///< Indicates whether or not the operation succeeded.
+  std::string error;            ///< The error message, if the operation failed.
+};
+
+/**
+ * \class io_service
+ *
+ * \brief Performs file reads and writes on worker threads.
+ *
+ * \details All functions of `file` block the calling thread. An I/O service executes
+ * submitted reads and writes on a pool of worker threads, so that e.g. world chunks can
+ * be streamed from disk without stalling the rendering thread.
+ *
+ * \details Completed operations are reported in one of two ways. Operations submitted
+ * with a callback are delivered by `poll()`, which invokes the callbacks on the calling
+ * thread. Operations submitted without a callback are posted to the attached event
+ * channel, which can in turn be attached to an event dispatcher.
+ * \code{cpp}
+ *   cen::event_channel<cen::io_completion> completions;
+ *   cen::io_service io{completions};
+ *
+ *   dispatcher.attach(completions);
+ *   dispatcher.bind<cen::io_completion>().to<&world::on_chunk_loaded>(&world);
+ *
+ *   io.read("chunks/0_0.bin");
+ * \endcode
+ *
+ * \note All functions, except for the destructor, must be called on the same thread.
+ *
+ * \since 6.4.0
+ */
+class io_service final
+{
+ public:
+  using id_type = usize;
+  using callback_type = std::function<void(io_completion&)>;
+  using channel_type = event_channel<io_completion>;
+
+  /**
+   * \brief Creates an I/O service and starts its worker threads.
+   *
+   * \param workers the amount of worker threads, must be greater than zero.
+   *
+   * \throws sdl_error if the worker threads cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit io_service(const usize workers = 2) : io_service{nullptr, workers}
+  {}
+
+  /**
+   * \brief Creates an I/O service that posts completions to an event channel.
+   *
+   * \param channel the event channel that receives completions without callbacks, must
+   * outlive the service.
+   * \param workers the amount of worker threads, must be greater than zero.
+   *
+   * \throws sdl_error if the worker threads cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit io_service(channel_type& channel, const usize workers = 2)
+      : io_service{&channel, workers}
+  {}
+
+  io_service(const io_service&) = delete;
+
+  auto operator=(const io_service&) -> io_service& = delete;
+
+  /**
+   * \brief Stops the worker threads.
+   *
+   * \details Operations that are currently executing are finished, but operations that
+   * are still waiting in the queue are discarded.
+   *
+   * \since 6.4.0
+   */
+  ~io_service() noexcept
+  {
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.broadcast();
+    m_workers.clear();
+  }
+
+  /**
+   * \brief Submits a read of an entire file.
+   *
+   * \param path the path of the file.
+   * \param callback the function invoked by `poll()` once the file has been read;
+   * completions without a callback are posted to the event channel.
+   *
+   * \return the ID associated with the operation.
+   *
+   * \since 6.4.0
+   */
+  auto read(std::string path, callback_type callback = {}) -> id_type
+  {
+    return submit(io_operation::read, std::move(path), {}, 0, 0, std::move(callback));
+  }
+
+  /**
+   * \brief Submits a read of a range of a file.
+   *
+   * \details The read data is truncated if the range extends past the end of the file.
+   *
+   * \param path the path of the file.
+   * \param offset the offset of the first byte that will be read.
+   * \param size the maximum amount of bytes that will be read, must be greater than zero.
+   * \param callback the function invoked by `poll()` once the range has been read;
+   * completions without a callback are posted to the event channel.
+   *
+   * \return the ID associated with the operation.
+   *
+   * \since 6.4.0
+   */
+  auto read(std::string path,
+            const i64 offset,
+            const usize size,
+            callback_type callback = {}) -> id_type
+  {
+    return submit(io_operation::read, std::move(path), {}, offset, size, std::move(callback));
+  }
+
+  /**
+   * \brief Submits a write that replaces the contents of a file.
+   *
+   * \details The data is moved into the service, and handed back in the completion, so
+   * that the buffer can be reused.
+   *
+   * \param path the path of the file.
+   * \param data the data that will be written.
+   * \param callback the function invoked by `poll()` once the data has been written;
+   * completions without a callback are posted to the event channel.
+   *
+   * \return the ID associated with the operation.
+   *
+   * \since 6.4.0
+   */
+  auto write(std::string path, std::vector<std::byte> data, callback_type callback = {})
+      -> id_type
+  {
+    return submit(io_operation::write,
+                  std::move(path),
+                  std::move(data),
+                  0,
+                  0,
+                  std::move(callback));
+  }
+
+  /**
+   * \brief Submits a write that appends data to a file.
+   *
+   * \param path the path of the file, which is created if it doesn't exist.
+   * \param data the data that will be written.
+   * \param callback the function invoked by `poll()` once the data has been written;
+   * completions without a callback are posted to the event channel.
+   *
+   * \return the ID associated with the operation.
+   *
+   * \since 6.4.0
+   */
+  auto append(std::string path, std::vector<std::byte> data, callback_type callback = {})
+      -> id_type
+  {
+    return submit(io_operation::append,
+                  std::move(path),
+                  std::move(data),
+                  0,
+                  0,
+                  std::move(callback));
+  }
+
+  /**
+   * \brief Delivers completed operations.
+   *
+   * \details Call this function once per frame. The callbacks of completed operations are
+   * invoked on the calling thread. Completions without callbacks that didn't fit in the
+   * event channel are posted again, and are otherwise discarded if there is no channel.
+   *
+   * \param limit the maximum amount of completions that will be delivered, zero means no
+   * limit.
+   *
+   * \return the number of completions that were delivered.
+   *
+   * \since 6.4.0
+   */
+  auto poll(const usize limit = 0) -> usize
+  {
+    usize count = 0;
+
+    while (limit == 0 || count < limit) {
+      std::unique_ptr<request> done;
+
+      {
+        scoped_lock lock{m_mutex};
+
+        if (m_completed.empty()) {
+          break;
+        }
+
+        done = std::move(m_completed.front());
+        m_completed.pop_front();
+      }
+
+      if (done->callback) {
+        done->callback(done->completion);
+      }
+      else if (m_channel && !m_channel->try_emplace(std::move(done->completion))) {
+        scoped_lock lock{m_mutex};
+        m_completed.push_front(std::move(done));
+        break;
+      }
+
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Blocks until all submitted operations have been executed.
+   *
+   * \details The completions still have to be delivered with `poll()`, unless they were
+   * posted to the event channel.
+   *
+   * \since 6.4.0
+   */
+  void wait()
+  {
+    scoped_lock lock{m_mutex};
+    while (!m_queue.empty() || m_busy != 0) {
+      m_idle.wait(m_mutex);
+    }
+  }
+
+  /**
+   * \brief Returns the amount of operations that haven't been delivered yet.
+   *
+   * \return the number of operations that are queued, executing or waiting for `poll()`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pending() -> usize
+  {
+    scoped_lock lock{m_mutex};
+    return m_queue.size() + m_busy + m_completed.size();
+  }
+
+  /**
+   * \brief Returns the amount of worker threads.
+   *
+   * \return the number of worker threads.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto worker_count() const noexcept -> usize
+  {
+    return m_workers.size();
+  }
+
+ private:
+  struct request final
+  {
+    io_completion completion;
+    i64 offset{};
+    usize size{};  ///< The size of the read range, zero means the entire file.
+    callback_type callback;
+  };
+
+  std::deque<std::unique_ptr<request>> m_queue;
+  std::deque<std::unique_ptr<request>> m_completed;
+  channel_type* m_channel{};
+  mutex m_mutex;
+  condition m_wake;
+  condition m_idle;
+  id_type m_nextId{};
+  usize m_busy{};
+  bool m_stop{};
+  std::vector<std::unique_ptr<thread>> m_workers;  // Last, so that workers stop first
+
+  io_service(channel_type* channel, const usize workers) : m_channel{channel}
+  {
+    assert(workers > 0);
+
+    m_workers.reserve(workers);
+    for (usize index = 0; index < workers; ++index) {
+      m_workers.push_back(std::make_unique<thread>(&io_service::run, "io_service", this));
+    }
+  }
+
+  auto submit(const io_operation operation,
+              std::string path,
+              std::vector<std::byte> data,
+              const i64 offset,
+              const usize size,
+              callback_type callback) -> id_type
+  {
+    auto queued = std::make_unique<request>();
+    queued->completion.operation = operation;
+    queued->completion.path = std::move(path);
+    queued->completion.data = std::move(data);
+    queued->offset = offset;
+    queued->size = size;
+    queued->callback = std::move(callback);
+
+    id_type id{};
+
+    {
+      scoped_lock lock{m_mutex};
+
+      id = m_nextId++;
+      queued->completion.id = id;
+
+      m_queue.push_back(std::move(queued));
+    }
+
+    m_wake.signal();
+    return id;
+  }
+
+  static void execute(request& job)
+  {
+    auto& completion = job.completion;
+    const auto* path = completion.path.c_str();
+
+    if (completion.operation == io_operation::read) {
+      file source{path, file_mode::read_existing_binary};
+      if (!source) {
+        return;
+      }
+
+      if (job.size == 0) {
+        completion.transferred = source.read_all_to(completion.data);
+      }
+      else if (source.seek(job.offset, seek_mode::from_beginning)) {
+        completion.data.resize(job.size);
+        completion.transferred = source.read_to(completion.data);
+        completion.data.resize(completion.transferred);
+      }
+      else {
+        return;
+      }
+
+      completion.succeeded = true;
+    }
+    else {
+      const auto mode = completion.operation == io_operation::append
+                            ? file_mode::append_or_create_binary
+                            : file_mode::write_binary;
+
+      file target{path, mode};
+      if (!target) {
+        return;
+      }
+
+      completion.transferred = target.write(completion.data);
+      completion.succeeded = completion.transferred == completion.data.size();
+    }
+  }
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<io_service*>(data);
+
+    self.m_mutex.lock();
+
+    while (true) {
+      while (!self.m_stop && self.m_queue.empty()) {
+        self.m_wake.wait(self.m_mutex);
+      }
+
+      if (self.m_stop) {
+        break;
+      }
+
+      auto job = std::move(self.m_queue.front());
+      self.m_queue.pop_front();
+      ++self.m_busy;
+
+      self.m_mutex.unlock();
+
+      try {
+        execute(*job);
+        if (!job->completion.succeeded) {
+          job->completion.error = SDL_GetError();
+        }
+      }
+      catch (const std::exception& e) {
+        // E.g. a read buffer that couldn't be allocated, the buffer is released first
+        job->completion.data = {};
+        job->completion.transferred = 0;
+        job->completion.succeeded = false;
+        job->completion.error = e.what();
+      }
+
+      // Completions without callbacks bypass the queue, unless the channel is full
+      const auto posted = !job->callback && self.m_channel &&
+                          self.m_channel->try_emplace(std::move(job->completion));
+
+      self.m_mutex.lock();
+
+      if (!posted) {
+        self.m_completed.push_back(std::move(job));
+      }
+
+      --self.m_busy;
+      self.m_idle.broadcast();
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+};
+
+#if CENTURION_HAS_FEATURE_COROUTINES
+
+/// \cond FALSE
+namespace detail {
+
+template <typename Submit>
+[[nodiscard]] auto await_completion(Submit submit)
+{
+  // The completion is shared, since the callback might outlive the awaitable
+  auto done = std::make_shared<std::optional<io_completion>>();
+
+  submit([done](io_completion& completion) { done->emplace(std::move(completion)); });
+
+  return poll_awaitable{[done] { return done->has_value(); },
+                        [done] { return std::move(**done); }};
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Reads an entire file with an I/O service, for use in coroutines.
+ *
+ * \details The read is submitted immediately, and the awaiting coroutine is resumed once
+ * the completion has been delivered by `io_service::poll()`.
+ * \code{cpp}
+ *   const auto chunk = co_await cen::read_file(io, "chunks/0_0.bin");
+ *   if (chunk.succeeded) {
+ *     world.add_chunk(chunk.data);
+ *   }
+ * \endcode
+ *
+ * \param service the I/O service that will read the file.
+ * \param path the path of the file.
+ *
+ * \return an awaitable that yields the completion of the read.
+ *
+ * \see `coroutine`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto read_file(io_service& service, std::string path)
+{
+  return detail::await_completion([&](io_service::callback_type callback) {
+    service.read(std::move(path), std::move(callback));
+  });
+}
+
+/**
+ * \brief Replaces the contents of a file with an I/O service, for use in coroutines.
+ *
+ * \details The write is submitted immediately, and the awaiting coroutine is resumed once
+ * the completion has been delivered by `io_service::poll()`.
+ *
+ * \param service the I/O service that will write the file.
+ * \param path the path of the file.
+ * \param data the data that will be written.
+ *
+ * \return an awaitable that yields the completion of the write.
+ *
+ * \see `coroutine`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto write_file(io_service& service,
+                                     std::string path,
+                                     std::vector<std::byte> data)
+{
+  return detail::await_completion([&](io_service::callback_type callback) {
+    service.write(std::move(path), std::move(data), std::move(callback));
+  });
+}
+
+#endif  // CENTURION_HAS_FEATURE_COROUTINES
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_IO_SERVICE_HEADER
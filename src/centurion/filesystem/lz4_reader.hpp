@@ -0,0 +1,514 @@
+#ifndef CENTURION_LZ4_READER_HEADER
+#define CENTURION_LZ4_READER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy, memmove
+#include <memory>   // unique_ptr
+#include <new>      // nothrow
+
+#include "../core/integers.hpp"
+#include "../detail/lz4_codec.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class lz4_reader
+ *
+ * \brief Reads LZ4 compressed data from a file.
+ *
+ * \details An LZ4 reader has the same read API as `buffered_reader`, but decompresses the
+ * file one block at a time, so that large compressed files can be parsed sequentially
+ * without decompressing them into memory first.
+ *
+ * \details Any file in the standard LZ4 frame format can be read, including files written
+ * by `lz4_writer` and by LZ4 tools, with blocks of up to 4 MiB. Concatenated frames are
+ * read as one stream, and skippable frames are ignored. Block and content checksums are
+ * verified when present.
+ *
+ * \code{cpp}
+ *   cen::file file{"replay.lz4", cen::file_mode::read_existing_binary};
+ *   cen::lz4_reader reader{file};
+ *
+ *   const auto frame = reader.read_little_endian_u32();
+ *   reader.read_to(inputs);
+ *
+ *   if (!reader.good()) {
+ *     // The file was truncated or corrupted
+ *   }
+ * \endcode
+ *
+ * \note Frames that depend on preset dictionaries are not supported. The file must
+ * outlive the reader, and should not be read from directly while the reader is used.
+ *
+ * \see `lz4_writer`
+ * \see `buffered_reader`
+ *
+ * \since 6.4.0
+ */
+class lz4_reader final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an LZ4 reader that reads from a file.
+   *
+   * \details The buffers are allocated when the first frame header is read, since their
+   * size depends on the block size of the frame.
+   *
+   * \pre `source` must be a valid file.
+   *
+   * \param source the file that will be read from.
+   *
+   * \since 6.4.0
+   */
+  explicit lz4_reader(file& source) noexcept : m_source{&source}
+  {
+    assert(source);
+  }
+
+  lz4_reader(const lz4_reader&) = delete;
+  auto operator=(const lz4_reader&) -> lz4_reader& = delete;
+
+  /// \name Read API
+  /// \{
+
+  /**
+   * \brief Reads objects from the file.
+   *
+   * \tparam T the type of the objects.
+   *
+   * \param[out] data the pointer to which the read objects will be written.
+   * \param maxCount the maximum number of objects that will be read.
+   *
+   * \return the number of objects that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto read_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    const auto bytes = read_bytes(reinterpret_cast<u8*>(data), sizeof(T) * maxCount);
+    return bytes / sizeof(T);
+  }
+
+  /**
+   * \brief Reads objects from the file into an array whose size is known at compile-time.
+   *
+   * \tparam T the type of the objects.
+   * \tparam size the size of the array.
+   *
+   * \param[out] data the array to which the read objects will be written.
+   *
+   * \return the number of objects that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T, usize size>
+  auto read_to(T (&data)[size]) noexcept -> size_type
+  {
+    return read_to(data, size);
+  }
+
+  /**
+   * \brief Reads objects from the file into a container.
+   *
+   * \tparam Container a contiguous container, e.g. `std::vector`, that provides `data()`
+   * and `size()`.
+   *
+   * \param[out] container the container that the read objects will be written to.
+   *
+   * \return the number of objects that were read.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto read_to(Container& container) noexcept(noexcept(container.data()) &&
+                                              noexcept(container.size()))
+      -> size_type
+  {
+    return read_to(container.data(), container.size());
+  }
+
+  /**
+   * \brief Reads a single object from the file.
+   *
+   * \tparam T the type of the object.
+   *
+   * \return the read object; a value-initialized object if it couldn't be read.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto read() noexcept(noexcept(T{})) -> T
+  {
+    T value{};
+    read_to(&value, 1);
+    return value;
+  }
+
+  /**
+   * \brief Reads an unsigned byte from the file.
+   *
+   * \return the read byte; zero if there is no more data.
+   *
+   * \since 6.4.0
+   */
+  auto read_byte() noexcept -> u8
+  {
+    return static_cast<u8>(read_value(1, false));
+  }
+
+  /**
+   * \brief Reads an unsigned 16-bit little-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_little_endian_u16() noexcept -> u16
+  {
+    return static_cast<u16>(read_value(sizeof(u16), false));
+  }
+
+  /**
+   * \brief Reads an unsigned 32-bit little-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_little_endian_u32() noexcept -> u32
+  {
+    return static_cast<u32>(read_value(sizeof(u32), false));
+  }
+
+  /**
+   * \brief Reads an unsigned 64-bit little-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_little_endian_u64() noexcept -> u64
+  {
+    return read_value(sizeof(u64), false);
+  }
+
+  /**
+   * \brief Reads an unsigned 16-bit big-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_big_endian_u16() noexcept -> u16
+  {
+    return static_cast<u16>(read_value(sizeof(u16), true));
+  }
+
+  /**
+   * \brief Reads an unsigned 32-bit big-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_big_endian_u32() noexcept -> u32
+  {
+    return static_cast<u32>(read_value(sizeof(u32), true));
+  }
+
+  /**
+   * \brief Reads an unsigned 64-bit big-endian integer from the file.
+   *
+   * \return the read value; zero if there isn't enough data.
+   *
+   * \since 6.4.0
+   */
+  auto read_big_endian_u64() noexcept -> u64
+  {
+    return read_value(sizeof(u64), true);
+  }
+
+  /// \} End of read API
+
+  /**
+   * \brief Indicates whether or not all reads could be fulfilled.
+   *
+   * \return `true` if no read ran out of data, and no corrupted data was encountered;
+   * `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto good() const noexcept -> bool
+  {
+    return m_good;
+  }
+
+  /**
+   * \brief Returns the amount of data that has been decompressed, but not consumed.
+   *
+   * \return the number of buffered bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto available() const noexcept -> size_type
+  {
+    return m_end - m_begin;
+  }
+
+ private:
+  inline constexpr static usize history_size = 65'536;  ///< The window of linked blocks.
+
+  inline constexpr static u8 flag_independent = 0x20;
+  inline constexpr static u8 flag_block_checksum = 0x10;
+  inline constexpr static u8 flag_content_size = 0x08;
+  inline constexpr static u8 flag_content_checksum = 0x04;
+  inline constexpr static u8 flag_dictionary = 0x01;
+
+  file* m_source{};
+  std::unique_ptr<u8[]> m_input;   ///< The current compressed block.
+  std::unique_ptr<u8[]> m_output;  ///< The history, followed by the decompressed block.
+  usize m_blockSize{};             ///< The maximum block size of the current frame.
+  usize m_capacity{};              ///< The maximum block size that fits in the buffers.
+  size_type m_begin{};             ///< The offset of the first unread byte in the output.
+  size_type m_end{};               ///< The offset past the last decompressed byte.
+  detail::xxh32 m_checksum;
+  u8 m_flags{};
+  bool m_inFrame{};
+  bool m_corrupted{};
+  bool m_good{true};
+
+  auto read_exactly(void* data, const usize size) noexcept -> bool
+  {
+    return SDL_RWread(m_source->get(), data, 1, size) == size;
+  }
+
+  auto read_u32(u32& value) noexcept -> bool
+  {
+    u8 bytes[4];
+    if (read_exactly(bytes, sizeof bytes)) {
+      value = detail::load_little_endian_u32(bytes);
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  auto corrupt() noexcept -> bool
+  {
+    m_corrupted = true;
+    m_begin = 0;
+    m_end = 0;
+    return false;
+  }
+
+  // Returns false at the end of the file, or if the frame header is invalid
+  auto read_frame_header() noexcept -> bool
+  {
+    while (true) {
+      u8 magic[4];
+      const auto read = SDL_RWread(m_source->get(), magic, 1, sizeof magic);
+      if (read == 0) {
+        return false;
+      }
+      else if (read != sizeof magic) {
+        return corrupt();
+      }
+
+      const auto value = detail::load_little_endian_u32(magic);
+      if ((value & 0xFFFFFFF0u) == detail::lz4_skippable_magic) {
+        u32 size{};
+        if (!read_u32(size) || SDL_RWseek(m_source->get(), size, RW_SEEK_CUR) == -1) {
+          return corrupt();
+        }
+
+        continue;
+      }
+      else if (value != detail::lz4_frame_magic) {
+        return corrupt();
+      }
+
+      break;
+    }
+
+    // The descriptor is followed by an optional content size and the header checksum
+    u8 descriptor[11];
+    if (!read_exactly(descriptor, 2)) {
+      return corrupt();
+    }
+
+    const auto flags = descriptor[0];
+    const auto sizeCode = (descriptor[1] >> 4) & 7u;
+    if ((flags >> 6) != 1 || (flags & 0x02) || (flags & flag_dictionary) ||
+        (descriptor[1] & 0x8F) || sizeCode < 4)
+    {
+      return corrupt();
+    }
+
+    const usize length = (flags & flag_content_size) ? 10 : 2;
+    u8 checksum{};
+    if (!read_exactly(descriptor + 2, length - 2) || !read_exactly(&checksum, 1) ||
+        checksum != static_cast<u8>(detail::xxh32::of(descriptor, length) >> 8))
+    {
+      return corrupt();
+    }
+
+    m_blockSize = usize{1} << (8 + 2 * sizeCode);
+    if (m_blockSize > m_capacity) {
+      m_input.reset(new (std::nothrow) u8[m_blockSize]);
+      m_output.reset(new (std::nothrow) u8[history_size + m_blockSize]);
+      m_capacity = m_input && m_output ? m_blockSize : 0;
+
+      if (m_capacity == 0) {
+        return corrupt();
+      }
+    }
+
+    m_flags = flags;
+    m_checksum = detail::xxh32{};
+    m_begin = 0;
+    m_end = 0;
+    m_inFrame = true;
+
+    return true;
+  }
+
+  auto read_frame_end() noexcept -> bool
+  {
+    m_inFrame = false;
+
+    if (m_flags & flag_content_checksum) {
+      u32 checksum{};
+      if (!read_u32(checksum) || checksum != m_checksum.digest()) {
+        return corrupt();
+      }
+    }
+
+    return true;
+  }
+
+  // Decompresses the next non-empty block, returns false if there is none
+  auto next_block() noexcept -> bool
+  {
+    while (!m_corrupted) {
+      if (!m_inFrame && !read_frame_header()) {
+        return false;
+      }
+
+      u32 header{};
+      if (!read_u32(header)) {
+        return corrupt();
+      }
+
+      if (header == 0) {
+        if (!read_frame_end()) {
+          return false;
+        }
+
+        continue;
+      }
+
+      const auto size = static_cast<usize>(header & ~detail::lz4_uncompressed_flag);
+      if (size > m_blockSize || !read_exactly(m_input.get(), size)) {
+        return corrupt();
+      }
+
+      if (m_flags & flag_block_checksum) {
+        u32 checksum{};
+        if (!read_u32(checksum) || checksum != detail::xxh32::of(m_input.get(), size)) {
+          return corrupt();
+        }
+      }
+
+      // Linked blocks may refer to the last 64 KiB of the previous blocks
+      usize prefix = 0;
+      if (!(m_flags & flag_independent)) {
+        prefix = m_end < history_size ? m_end : history_size;
+        std::memmove(m_output.get(), m_output.get() + m_end - prefix, prefix);
+      }
+
+      usize decompressed = 0;
+      if (header & detail::lz4_uncompressed_flag) {
+        std::memcpy(m_output.get() + prefix, m_input.get(), size);
+        decompressed = size;
+      }
+      else if (const auto result = detail::lz4_decompress(m_input.get(),
+                                                          size,
+                                                          m_output.get(),
+                                                          prefix,
+                                                          prefix + m_blockSize))
+      {
+        decompressed = *result;
+      }
+      else {
+        return corrupt();
+      }
+
+      m_begin = prefix;
+      m_end = prefix + decompressed;
+
+      if (m_flags & flag_content_checksum) {
+        m_checksum.update(m_output.get() + m_begin, decompressed);
+      }
+
+      if (decompressed != 0) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  auto read_bytes(u8* data, const size_type size) noexcept -> size_type
+  {
+    size_type read = 0;
+
+    while (read != size) {
+      if (available() == 0 && !next_block()) {
+        m_good = false;
+        break;
+      }
+
+      const auto remaining = size - read;
+      const auto amount = remaining < available() ? remaining : available();
+      std::memcpy(data + read, m_output.get() + m_begin, amount);
+
+      m_begin += amount;
+      read += amount;
+    }
+
+    return read;
+  }
+
+  auto read_value(const size_type size, const bool bigEndian) noexcept -> u64
+  {
+    u8 bytes[sizeof(u64)];
+    if (read_bytes(bytes, size) != size) {
+      return 0;
+    }
+
+    u64 value = 0;
+    for (size_type index = 0; index < size; ++index) {
+      const auto shift = bigEndian ? (size - 1 - index) * 8 : index * 8;
+      value |= static_cast<u64>(bytes[index]) << shift;
+    }
+
+    return value;
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_LZ4_READER_HEADER
@@ -0,0 +1,405 @@
+#ifndef CENTURION_LZ4_WRITER_HEADER
+#define CENTURION_LZ4_WRITER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy
+#include <memory>   // unique_ptr, make_unique
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/lz4_codec.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class lz4_writer
+ *
+ * \brief Writes LZ4 compressed data to a file.
+ *
+ * \details An LZ4 writer has the same write API as `buffered_writer`, but compresses the
+ * written data in blocks of 64 KiB before writing them to the file. This reduces the disk
+ * bandwidth used by large sequential outputs, such as save files, event recordings and
+ * frame captures, without keeping the uncompressed data in memory.
+ *
+ * \details The output uses the standard LZ4 frame format, with independent blocks and a
+ * content checksum, so it can be decompressed by an `lz4_reader` or by any LZ4 tool.
+ *
+ * \code{cpp}
+ *   cen::file file{"replay.lz4", cen::file_mode::write_binary};
+ *   cen::lz4_writer writer{file};
+ *
+ *   writer.write_as_little_endian(frame);
+ *   writer.write(inputs);
+ *
+ *   if (!writer.finish()) {
+ *     // Handle the write error
+ *   }
+ * \endcode
+ *
+ * \note Errors are only detected when a block is written to the file, so check the result
+ * of `finish()` to detect errors. The file must outlive the writer.
+ *
+ * \see `lz4_reader`
+ * \see `buffered_writer`
+ *
+ * \since 6.4.0
+ */
+class lz4_writer final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an LZ4 writer that writes a compressed frame to a file.
+   *
+   * \details The frame header is written along with the first block.
+   *
+   * \pre `target` must be a valid file.
+   *
+   * \param target the file that will be written to.
+   *
+   * \since 6.4.0
+   */
+  explicit lz4_writer(file& target)
+      : m_target{&target}
+      , m_buffer{std::make_unique<u8[]>(block_size())}
+      , m_compressed{std::make_unique<u8[]>(detail::lz4_compress_bound(block_size()))}
+      , m_table{std::make_unique<u32[]>(usize{1} << detail::lz4_hash_log)}
+  {
+    assert(target);
+  }
+
+  lz4_writer(const lz4_writer&) = delete;
+  auto operator=(const lz4_writer&) -> lz4_writer& = delete;
+
+  /**
+   * \brief Finishes the frame, unless it has already been finished.
+   *
+   * \since 6.4.0
+   */
+  ~lz4_writer() noexcept
+  {
+    if (m_started || m_size != 0) {
+      finish();
+    }
+  }
+
+  /// \name Write API
+  /// \{
+
+  /**
+   * \brief Writes objects to the file.
+   *
+   * \tparam T the type of the objects.
+   *
+   * \param data a pointer to the objects that will be written.
+   * \param count the number of objects that will be written.
+   *
+   * \return the number of objects that were written, or buffered.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto write(const T* data, const size_type count) noexcept -> size_type
+  {
+    const auto bytes = write_bytes(reinterpret_cast<const u8*>(data), sizeof(T) * count);
+    return bytes / sizeof(T);
+  }
+
+  /**
+   * \brief Writes the objects of an array whose size is known at compile-time.
+   *
+   * \tparam T the type of the objects.
+   * \tparam size the size of the array.
+   *
+   * \param data the array whose objects will be written.
+   *
+   * \return the number of objects that were written, or buffered.
+   *
+   * \since 6.4.0
+   */
+  template <typename T, usize size>
+  auto write(const T (&data)[size]) noexcept -> size_type
+  {
+    return write(data, size);
+  }
+
+  /**
+   * \brief Writes the objects of a container.
+   *
+   * \tparam Container a contiguous container, e.g. `std::vector`, that provides `data()`
+   * and `size()`.
+   *
+   * \param container the container whose objects will be written.
+   *
+   * \return the number of objects that were written, or buffered.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto write(const Container& container) noexcept(noexcept(container.data()) &&
+                                                 noexcept(container.size()))
+      -> size_type
+  {
+    return write(container.data(), container.size());
+  }
+
+  /**
+   * \brief Writes an unsigned byte to the file.
+   *
+   * \param value the byte that will be written.
+   *
+   * \return `success` if the byte was buffered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto write_byte(const u8 value) noexcept -> result
+  {
+    return write_value(value, 1, false);
+  }
+
+  /**
+   * \brief Writes an unsigned 16-bit integer to the file, as a little-endian value.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto write_as_little_endian(const u16 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u16), false);
+  }
+
+  /// \copydoc write_as_little_endian(u16)
+  auto write_as_little_endian(const u32 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u32), false);
+  }
+
+  /// \copydoc write_as_little_endian(u16)
+  auto write_as_little_endian(const u64 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u64), false);
+  }
+
+  /**
+   * \brief Writes an unsigned 16-bit integer to the file, as a big-endian value.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto write_as_big_endian(const u16 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u16), true);
+  }
+
+  /// \copydoc write_as_big_endian(u16)
+  auto write_as_big_endian(const u32 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u32), true);
+  }
+
+  /// \copydoc write_as_big_endian(u16)
+  auto write_as_big_endian(const u64 value) noexcept -> result
+  {
+    return write_value(value, sizeof(u64), true);
+  }
+
+  /// \} End of write API
+
+  /**
+   * \brief Compresses the buffered data, and writes it to the file as a block.
+   *
+   * \details Flushing often reduces the compression ratio, since every block is compressed
+   * on its own.
+   *
+   * \return `success` if all buffered data was written; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto flush() noexcept -> result
+  {
+    if (!write_header()) {
+      return failure;
+    }
+
+    if (m_size == 0) {
+      return success;
+    }
+
+    m_checksum.update(m_buffer.get(), m_size);
+
+    auto* block = m_compressed.get();
+    auto compressed = detail::lz4_compress(m_buffer.get(), m_size, block + 4, m_table.get());
+
+    // Blocks that don't shrink are stored as they are
+    auto header = static_cast<u32>(compressed);
+    if (compressed >= m_size) {
+      std::memcpy(block + 4, m_buffer.get(), m_size);
+      compressed = m_size;
+      header = static_cast<u32>(m_size) | detail::lz4_uncompressed_flag;
+    }
+
+    detail::store_little_endian_u32(block, header);
+
+    const auto written = SDL_RWwrite(m_target->get(), block, 1, compressed + 4);
+    const auto flushed = written == compressed + 4;
+
+    m_written += written;
+    m_size = 0;
+
+    return flushed;
+  }
+
+  /**
+   * \brief Writes the buffered data and the end of the frame to the file.
+   *
+   * \details Subsequent writes start a new frame. Concatenated frames are decompressed as
+   * one stream by LZ4 readers.
+   *
+   * \return `success` if all buffered data and the end of the frame were written;
+   * `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto finish() noexcept -> result
+  {
+    const auto flushed = flush();
+
+    u8 footer[8];
+    detail::store_little_endian_u32(footer, 0);
+    detail::store_little_endian_u32(footer + 4, m_checksum.digest());
+
+    const auto written = SDL_RWwrite(m_target->get(), footer, 1, sizeof footer);
+    m_written += written;
+
+    m_started = false;
+    m_checksum = detail::xxh32{};
+
+    return flushed && written == sizeof footer;
+  }
+
+  /**
+   * \brief Returns the amount of data that hasn't been compressed yet.
+   *
+   * \return the number of buffered bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buffered() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the amount of compressed data that has been written to the file.
+   *
+   * \return the number of bytes written to the file, including frame headers.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto compressed_size() const noexcept -> u64
+  {
+    return m_written;
+  }
+
+  /**
+   * \brief Returns the maximum amount of data that is compressed as one block.
+   *
+   * \return the block size, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto block_size() noexcept -> size_type
+  {
+    return 65'536;
+  }
+
+ private:
+  file* m_target{};
+  std::unique_ptr<u8[]> m_buffer;
+  std::unique_ptr<u8[]> m_compressed;
+  std::unique_ptr<u32[]> m_table;
+  detail::xxh32 m_checksum;
+  size_type m_size{};
+  u64 m_written{};
+  bool m_started{};
+
+  auto write_header() noexcept -> result
+  {
+    if (m_started) {
+      return success;
+    }
+
+    m_started = true;
+
+    // Version 1 with independent blocks and a content checksum, and 64 KiB blocks
+    u8 header[7];
+    detail::store_little_endian_u32(header, detail::lz4_frame_magic);
+    header[4] = 0x64;
+    header[5] = 0x40;
+    header[6] = static_cast<u8>(detail::xxh32::of(header + 4, 2) >> 8);
+
+    const auto written = SDL_RWwrite(m_target->get(), header, 1, sizeof header);
+    m_written += written;
+
+    return written == sizeof header;
+  }
+
+  auto write_bytes(const u8* data, size_type size) noexcept -> size_type
+  {
+    size_type total = 0;
+
+    while (size != 0) {
+      if (m_size == block_size() && !flush()) {
+        break;
+      }
+
+      const auto free = block_size() - m_size;
+      const auto amount = size < free ? size : free;
+      std::memcpy(m_buffer.get() + m_size, data, amount);
+
+      m_size += amount;
+      data += amount;
+      size -= amount;
+      total += amount;
+    }
+
+    return total;
+  }
+
+  auto write_value(const u64 value, const size_type size, const bool bigEndian) noexcept
+      -> result
+  {
+    if (m_size + size > block_size() && !flush()) {
+      return failure;
+    }
+
+    auto* bytes = m_buffer.get() + m_size;
+    for (size_type index = 0; index < size; ++index) {
+      const auto shift = bigEndian ? (size - 1 - index) * 8 : index * 8;
+      bytes[index] = static_cast<u8>(value >> shift);
+    }
+
+    m_size += size;
+    return success;
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_LZ4_WRITER_HEADER
@@ -0,0 +1,240 @@
+#ifndef CENTURION_MAPPED_FILE_HEADER
+#define CENTURION_MAPPED_FILE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <climits>  // INT_MAX
+#include <string>   // string
+#include <utility>  // exchange
+
+#include "../compiler/features.hpp"
+#include "../compiler/linkage.hpp"
+
+#if CENTURION_HAS_FEATURE_SPAN
+
+#include <cstddef>  // byte
+#include <span>     // span
+
+#endif  // CENTURION_HAS_FEATURE_SPAN
+
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../core/str.hpp"
+#include "file.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+struct mapped_view final
+{
+  const u8* data{};
+  usize size{};
+};
+
+// Defined in detail/mapped_file_impl.hpp, which includes the platform headers
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto map_file(str path) noexcept
+    -> mapped_view;
+
+CENTURION_API CENTURION_LIB_INLINE void unmap_file(mapped_view view) noexcept;
+
+}  // namespace cen::detail
+
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class mapped_file
+ *
+ * \brief Represents a read-only file that is mapped into memory.
+ *
+ * \details Mapping a file makes its contents accessible through a pointer, and lets the
+ * operating system load the pages of the file on demand, which is ideal for large packed
+ * archives. Reads are plain memory accesses, and no data is copied into buffers owned by
+ * the application.
+ *
+ * \details The mapped data can be passed to the library loaders through `open()`, which
+ * creates a `file` that reads directly from the mapped memory.
+ * \code{cpp}
+ *   cen::mapped_file pack{"levels.pak"};
+ *   if (pack) {
+ *     auto source = pack.open(entry.offset, entry.size);
+ *     cen::sound_effect sound{source};
+ *   }
+ * \endcode
+ *
+ * \note Like `file`, this class doesn't throw if the file can't be mapped, instead the
+ * mapped file is null. Empty files cannot be mapped.
+ *
+ * \note The files created by `open()` reference the mapped memory, so they must not be
+ * used after the mapped file has been destroyed.
+ *
+ * \since 6.4.0
+ */
+class mapped_file final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Maps the file at the specified file path.
+   *
+   * \param path the path of the file.
+   *
+   * \since 6.4.0
+   */
+  explicit mapped_file(const not_null<str> path) noexcept
+  {
+    assert(path);
+    map(path);
+  }
+
+  /// \copydoc mapped_file(not_null<str>)
+  explicit mapped_file(const std::string& path) noexcept : mapped_file{path.c_str()}
+  {}
+
+  mapped_file(const mapped_file&) = delete;
+  auto operator=(const mapped_file&) -> mapped_file& = delete;
+
+  mapped_file(mapped_file&& other) noexcept
+      : m_data{std::exchange(other.m_data, nullptr)}
+      , m_size{std::exchange(other.m_size, 0)}
+  {}
+
+  auto operator=(mapped_file&& other) noexcept -> mapped_file&
+  {
+    if (this != &other) {
+      unmap();
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+    }
+
+    return *this;
+  }
+
+  ~mapped_file() noexcept
+  {
+    unmap();
+  }
+
+  /**
+   * \brief Creates a file that reads from a range of the mapped data, without copying it.
+   *
+   * \details The created file can be used with all loaders that accept files or
+   * `SDL_RWops` instances.
+   *
+   * \param offset the offset of the first byte in the range.
+   * \param size the size of the range, in bytes; the remainder of the file by default.
+   *
+   * \return a file that reads from the mapped data; a null file if the range is out of
+   * bounds, or larger than `INT_MAX` bytes.
+   *
+   * \see `SDL_RWFromConstMem`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto open(const size_type offset = 0,
+                          size_type size = static_cast<size_type>(-1)) const noexcept -> file
+  {
+    if (!m_data || offset > m_size) {
+      return file{nullptr};
+    }
+
+    if (size > m_size - offset) {
+      size = m_size - offset;
+    }
+
+    if (size > static_cast<size_type>(INT_MAX)) {
+      return file{nullptr};
+    }
+
+    return file{SDL_RWFromConstMem(m_data + offset, static_cast<int>(size))};
+  }
+
+  /**
+   * \brief Returns a pointer to the mapped data.
+   *
+   * \return a pointer to the first byte of the file; null if the file isn't mapped.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const u8*
+  {
+    return m_data;
+  }
+
+  /**
+   * \brief Returns the size of the mapped data.
+   *
+   * \return the size of the file, in bytes; zero if the file isn't mapped.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+#if CENTURION_HAS_FEATURE_SPAN
+
+  /**
+   * \brief Returns a view of the mapped data.
+   *
+   * \return a span of all bytes in the file; an empty span if the file isn't mapped.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bytes() const noexcept -> std::span<const std::byte>
+  {
+    return {reinterpret_cast<const std::byte*>(m_data), m_size};
+  }
+
+#endif  // CENTURION_HAS_FEATURE_SPAN
+
+  /**
+   * \brief Indicates whether or not the file is mapped.
+   *
+   * \return `true` if the file is mapped; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return m_data != nullptr;
+  }
+
+ private:
+  const u8* m_data{};
+  size_type m_size{};
+
+  void map(const str path) noexcept
+  {
+    const auto view = detail::map_file(path);
+    m_data = view.data;
+    m_size = view.size;
+  }
+
+  void unmap() noexcept
+  {
+    if (m_data) {
+      detail::unmap_file({m_data, m_size});
+      m_data = nullptr;
+      m_size = 0;
+    }
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#if CENTURION_LIB_DEFINITIONS
+#include "../detail/mapped_file_impl.hpp"
+#endif  // CENTURION_LIB_DEFINITIONS
+
+#endif  // CENTURION_MAPPED_FILE_HEADER
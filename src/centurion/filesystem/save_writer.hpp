@@ -0,0 +1,288 @@
+#ifndef CENTURION_SAVE_WRITER_HEADER
+#define CENTURION_SAVE_WRITER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>  // byte
+#include <cstring>  // memcpy
+#include <deque>    // deque
+#include <memory>   // unique_ptr, make_unique
+#include <string>   // string, to_string
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// Defined in detail/save_writer_impl.hpp, which includes the platform headers
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto write_atomically(
+    const std::string& path,
+    const std::vector<std::byte>& contents,
+    std::string& error) -> bool;
+
+}  // namespace cen::detail
+
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class save_writer
+ *
+ * \brief Writes save files atomically on a background thread.
+ *
+ * \details Writing a save file with `file` blocks the calling thread until the data has
+ * been written, which causes hitches on slow storage, and a crash during the write leaves
+ * a torn file behind. A save writer takes a snapshot of the data, and writes it on a worker
+ * thread to a temporary file, which is flushed to the storage device and then renamed over
+ * the previous save. The save file therefore always contains either the previous or the
+ * new data.
+ *
+ * \details A new save can be queued while a previous save is still being written. If a
+ * save of the same file is still waiting in the queue, its snapshot is replaced, so the
+ * writer never holds more than one pending snapshot per file.
+ * \code{cpp}
+ *   cen::save_writer saves{cen::preferred_path("studio", "game").copy()};
+ *
+ *   saves.save("slot1.sav", world.serialize());
+ *
+ *   // When quitting
+ *   if (!saves.wait()) {
+ *     cen::log_error("Failed to save: %s", saves.last_error().c_str());
+ *   }
+ * \endcode
+ *
+ * \note Queued saves are written before the writer is destroyed. All functions, except
+ * for the destructor, must be called on the same thread.
+ *
+ * \since 6.4.0
+ */
+class save_writer final
+{
+ public:
+  /**
+   * \brief Creates a save writer and starts its worker thread.
+   *
+   * \param directory the directory of the save files, must end with a path separator,
+   * e.g. a preferred path.
+   *
+   * \throws sdl_error if the worker thread cannot be created.
+   *
+   * \see `preferred_path()`
+   *
+   * \since 6.4.0
+   */
+  explicit save_writer(std::string directory) : m_directory{std::move(directory)}
+  {
+    m_worker = std::make_unique<thread>(&save_writer::run, "save_writer", this);
+  }
+
+  save_writer(const save_writer&) = delete;
+
+  auto operator=(const save_writer&) -> save_writer& = delete;
+
+  /**
+   * \brief Writes the queued saves, and stops the worker thread.
+   *
+   * \since 6.4.0
+   */
+  ~save_writer() noexcept
+  {
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.signal();
+    m_worker.reset();
+  }
+
+  /**
+   * \brief Queues a save file.
+   *
+   * \param name the name of the save file, relative to the save directory.
+   * \param data the contents of the save file, which are moved into the writer.
+   *
+   * \since 6.4.0
+   */
+  void save(const std::string& name, std::vector<std::byte> data)
+  {
+    auto path = m_directory + name;
+
+    {
+      scoped_lock lock{m_mutex};
+
+      bool superseded = false;
+      for (auto& queued : m_queue) {
+        if (queued.path == path) {
+          queued.data = std::move(data);
+          superseded = true;
+          break;
+        }
+      }
+
+      if (!superseded) {
+        m_queue.push_back({std::move(path), std::move(data)});
+      }
+    }
+
+    m_wake.signal();
+  }
+
+  /**
+   * \brief Queues a save file, with a copy of the supplied data.
+   *
+   * \param name the name of the save file, relative to the save directory.
+   * \param data a pointer to the contents of the save file.
+   * \param size the size of the contents, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void save(const std::string& name, const void* data, const usize size)
+  {
+    std::vector<std::byte> snapshot(size);
+    if (size != 0) {
+      std::memcpy(snapshot.data(), data, size);
+    }
+
+    save(name, std::move(snapshot));
+  }
+
+  /**
+   * \brief Blocks until all queued saves have been written.
+   *
+   * \return `success` if all saves that completed since the previous call succeeded;
+   * `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto wait() -> result
+  {
+    scoped_lock lock{m_mutex};
+    while (!m_queue.empty() || m_busy) {
+      m_idle.wait(m_mutex);
+    }
+
+    const auto succeeded = !m_failed;
+    m_failed = false;
+
+    return succeeded;
+  }
+
+  /**
+   * \brief Returns the amount of saves that haven't been completed yet.
+   *
+   * \return the number of saves that are queued or being written.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pending() -> usize
+  {
+    scoped_lock lock{m_mutex};
+    return m_queue.size() + (m_busy ? 1 : 0);
+  }
+
+  /**
+   * \brief Returns a description of the latest failed save.
+   *
+   * \return an error message; an empty string if no save has failed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto last_error() -> std::string
+  {
+    scoped_lock lock{m_mutex};
+    return m_error;
+  }
+
+  /**
+   * \brief Returns the directory of the save files.
+   *
+   * \return the save directory.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto directory() const noexcept -> const std::string&
+  {
+    return m_directory;
+  }
+
+ private:
+  struct request final
+  {
+    std::string path;
+    std::vector<std::byte> data;
+  };
+
+  std::string m_directory;
+  std::deque<request> m_queue;
+  std::string m_error;
+  mutex m_mutex;
+  condition m_wake;
+  condition m_idle;
+  bool m_busy{};
+  bool m_failed{};
+  bool m_stop{};
+  std::unique_ptr<thread> m_worker;  // Last, so that the worker stops first
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<save_writer*>(data);
+
+    self.m_mutex.lock();
+
+    while (true) {
+      while (!self.m_stop && self.m_queue.empty()) {
+        self.m_wake.wait(self.m_mutex);
+      }
+
+      // Queued saves are written even when stopping
+      if (self.m_queue.empty()) {
+        break;
+      }
+
+      auto job = std::move(self.m_queue.front());
+      self.m_queue.pop_front();
+      self.m_busy = true;
+
+      self.m_mutex.unlock();
+
+      std::string error;
+      const auto succeeded = detail::write_atomically(job.path, job.data, error);
+
+      self.m_mutex.lock();
+
+      if (!succeeded) {
+        self.m_error = std::move(error);
+        self.m_failed = true;
+      }
+
+      self.m_busy = false;
+      self.m_idle.broadcast();
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#if CENTURION_LIB_DEFINITIONS
+#include "../detail/save_writer_impl.hpp"
+#endif  // CENTURION_LIB_DEFINITIONS
+
+#endif  // CENTURION_SAVE_WRITER_HEADER
@@ -0,0 +1,468 @@
+#ifndef CENTURION_VIRTUAL_FILESYSTEM_HEADER
+#define CENTURION_VIRTUAL_FILESYSTEM_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>        // assert
+#include <climits>        // INT_MAX
+#include <cstring>        // memcmp
+#include <memory>         // unique_ptr, make_unique
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <utility>        // move, pair
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "file.hpp"
+#include "file_mode.hpp"
+#include "mapped_file.hpp"
+
+namespace cen {
+
+/// \addtogroup filesystem
+/// \{
+
+/**
+ * \class virtual_filesystem
+ *
+ * \brief Resolves virtual asset paths to files in directories, archives and memory.
+ *
+ * \details Loading thousands of small assets from individual files pays the cost of
+ * opening every file. A virtual filesystem instead maps archives into memory, and builds
+ * an index of their contents once, when the archive is mounted. Opening an indexed file
+ * is then a hash table lookup, and reading it is a memory copy.
+ *
+ * \details Three kinds of mount points are supported.
+ * - Directories, whose files are opened on demand, and aren't indexed.
+ * - Archives, which are either ZIP files or Quake-style PAK files. Only uncompressed ZIP
+ *   entries are indexed, so create ZIP archives with compression disabled, e.g. with
+ *   `zip -0`.
+ * - Memory buffers, which are indexed as single files.
+ *
+ * \details Later mounts take precedence over earlier mounts, so that e.g. a patch archive
+ * can override the files of the base archive.
+ *
+ * \details Virtual paths use forward slashes, and are case-sensitive. The opened files
+ * can be used with all loaders that accept files.
+ * \code{cpp}
+ *   cen::virtual_filesystem vfs;
+ *   vfs.mount_archive("assets.pak");
+ *   vfs.mount_directory("mods/");
+ *
+ *   auto source = vfs.open("sprites/player.png");
+ *   cen::texture player{renderer, source};
+ * \endcode
+ *
+ * \note Files opened from archives and memory buffers reference memory owned by the
+ * virtual filesystem, or by the caller, so they must not outlive it. This matters for
+ * fonts and music, which read from their files on demand.
+ *
+ * \since 6.4.0
+ */
+class virtual_filesystem final
+{
+ public:
+  using size_type = usize;
+
+  virtual_filesystem() = default;
+
+  virtual_filesystem(const virtual_filesystem&) = delete;
+  auto operator=(const virtual_filesystem&) -> virtual_filesystem& = delete;
+
+  virtual_filesystem(virtual_filesystem&&) noexcept = default;
+  auto operator=(virtual_filesystem&&) noexcept -> virtual_filesystem& = default;
+
+  /// \name Mount functions
+  /// \{
+
+  /**
+   * \brief Mounts a directory.
+   *
+   * \details Files in the directory aren't indexed, they are opened when requested.
+   *
+   * \param directory the path of the directory.
+   * \param point the virtual directory of the files, the root by default.
+   *
+   * \since 6.4.0
+   */
+  void mount_directory(std::string directory, const std::string_view point = {})
+  {
+    if (!directory.empty() && directory.back() != '/' && directory.back() != '\\') {
+      directory += '/';
+    }
+
+    m_directories.push_back(mounted_directory{std::move(directory),
+                                              make_point(point),
+                                              m_layers++});
+  }
+
+  /**
+   * \brief Mounts a ZIP or PAK archive, and indexes its contents.
+   *
+   * \details The archive is mapped into memory, and isn't read until its files are used.
+   * Compressed ZIP entries and directories are skipped.
+   *
+   * \param path the path of the archive file.
+   * \param point the virtual directory of the files in the archive, the root by default.
+   *
+   * \return `success` if the archive was mounted; `failure` if it couldn't be mapped, or
+   * isn't a valid archive.
+   *
+   * \since 6.4.0
+   */
+  auto mount_archive(const std::string& path, const std::string_view point = {}) -> result
+  {
+    auto archive = std::make_unique<mapped_file>(path);
+    if (!*archive) {
+      return failure;
+    }
+
+    const auto prefix = make_point(point);
+    const auto layer = m_layers;
+
+    std::vector<std::pair<std::string, entry>> entries;
+    if (!read_pak(*archive, entries)) {
+      entries.clear();
+
+      if (!read_zip(*archive, entries)) {
+        return failure;
+      }
+    }
+
+    for (auto& [name, found] : entries) {
+      found.layer = layer;
+      m_index.insert_or_assign(prefix + normalize(name), found);
+    }
+
+    m_archives.push_back(std::move(archive));
+    ++m_layers;
+
+    return success;
+  }
+
+  /**
+   * \brief Mounts a memory buffer as a file.
+   *
+   * \details This is useful for assets that are embedded in the executable.
+   *
+   * \pre `data` must not be null.
+   * \pre `size` must not be greater than `INT_MAX`.
+   *
+   * \param path the virtual path of the file.
+   * \param data the file data, which must outlive the virtual filesystem.
+   * \param size the size of the file data, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void mount_memory(const std::string_view path, const void* data, const size_type size)
+  {
+    assert(data);
+    assert(size <= INT_MAX);
+
+    const auto* bytes = static_cast<const u8*>(data);
+    m_index.insert_or_assign(normalize(path), entry{bytes, size, m_layers});
+    ++m_layers;
+  }
+
+  /**
+   * \brief Unmounts everything, and discards the index.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_index.clear();
+    m_directories.clear();
+    m_archives.clear();
+    m_layers = 0;
+  }
+
+  /// \} End of mount functions
+
+  /// \name Query functions
+  /// \{
+
+  /**
+   * \brief Opens a file for reading.
+   *
+   * \param path the virtual path of the file.
+   *
+   * \return the opened file; a null file if there is no file with the specified path.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto open(const std::string_view path) const -> file
+  {
+    const auto normalized = normalize(path);
+    const auto* indexed = find(normalized);
+
+    for (auto it = m_directories.rbegin(); it != m_directories.rend(); ++it) {
+      if (indexed && it->layer < indexed->layer) {
+        break;
+      }
+
+      if (auto opened = open_in(*it, normalized)) {
+        return opened;
+      }
+    }
+
+    if (indexed) {
+      return file{SDL_RWFromConstMem(indexed->data, static_cast<int>(indexed->size))};
+    }
+    else {
+      return file{nullptr};
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not a file is indexed.
+   *
+   * \details Files in mounted directories aren't indexed, so this function doesn't touch
+   * the filesystem.
+   *
+   * \param path the virtual path of the file.
+   *
+   * \return `true` if the file is in a mounted archive or memory buffer; `false`
+   * otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto contains(const std::string_view path) const -> bool
+  {
+    return find(normalize(path)) != nullptr;
+  }
+
+  /**
+   * \brief Returns the amount of indexed files.
+   *
+   * \return the number of files in mounted archives and memory buffers.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto indexed_count() const noexcept -> size_type
+  {
+    return m_index.size();
+  }
+
+  /// \} End of query functions
+
+ private:
+  struct entry final
+  {
+    const u8* data{};
+    size_type size{};
+    size_type layer{};  ///< The mount order, later mounts take precedence.
+  };
+
+  struct mounted_directory final
+  {
+    std::string directory;
+    std::string point;
+    size_type layer{};
+  };
+
+  std::unordered_map<std::string, entry> m_index;
+  std::vector<mounted_directory> m_directories;
+  std::vector<std::unique_ptr<mapped_file>> m_archives;
+  size_type m_layers{};
+
+  [[nodiscard]] static auto normalize(const std::string_view path) -> std::string
+  {
+    std::string result{path};
+
+    for (auto& ch : result) {
+      if (ch == '\\') {
+        ch = '/';
+      }
+    }
+
+    while (!result.empty() && result.front() == '/') {
+      result.erase(0, 1);
+    }
+
+    while (result.size() >= 2 && result.compare(0, 2, "./") == 0) {
+      result.erase(0, 2);
+    }
+
+    return result;
+  }
+
+  [[nodiscard]] static auto make_point(const std::string_view point) -> std::string
+  {
+    auto result = normalize(point);
+
+    if (!result.empty() && result.back() != '/') {
+      result += '/';
+    }
+
+    return result;
+  }
+
+  [[nodiscard]] auto find(const std::string& path) const -> const entry*
+  {
+    if (const auto it = m_index.find(path); it != m_index.end()) {
+      return &it->second;
+    }
+    else {
+      return nullptr;
+    }
+  }
+
+  [[nodiscard]] static auto open_in(const mounted_directory& mounted, const std::string& path)
+      -> file
+  {
+    if (path.compare(0, mounted.point.size(), mounted.point) != 0) {
+      return file{nullptr};
+    }
+
+    const auto native = mounted.directory + path.substr(mounted.point.size());
+    return file{native, file_mode::read_existing_binary};
+  }
+
+  [[nodiscard]] static auto read_u16(const u8* bytes) noexcept -> u16
+  {
+    return static_cast<u16>(bytes[0] | (bytes[1] << 8));
+  }
+
+  [[nodiscard]] static auto read_u32(const u8* bytes) noexcept -> u32
+  {
+    return static_cast<u32>(bytes[0]) | (static_cast<u32>(bytes[1]) << 8) |
+           (static_cast<u32>(bytes[2]) << 16) | (static_cast<u32>(bytes[3]) << 24);
+  }
+
+  // Reads the directory of a Quake-style PAK file
+  [[nodiscard]] static auto read_pak(const mapped_file& archive,
+                                     std::vector<std::pair<std::string, entry>>& entries)
+      -> bool
+  {
+    constexpr size_type header_size = 12;
+    constexpr size_type record_size = 64;
+    constexpr size_type name_size = 56;
+
+    const auto* data = archive.data();
+    const auto size = archive.size();
+
+    if (size < header_size || std::memcmp(data, "PACK", 4) != 0) {
+      return false;
+    }
+
+    const size_type offset = read_u32(data + 4);
+    const size_type length = read_u32(data + 8);
+
+    if (offset > size || length > size - offset || length % record_size != 0) {
+      return false;
+    }
+
+    for (size_type index = 0; index < length / record_size; ++index) {
+      const auto* record = data + offset + index * record_size;
+      const size_type fileOffset = read_u32(record + name_size);
+      const size_type fileSize = read_u32(record + name_size + 4);
+
+      if (fileOffset > size || fileSize > size - fileOffset || fileSize > INT_MAX) {
+        return false;
+      }
+
+      const auto* name = reinterpret_cast<const char*>(record);
+      size_type nameLength = 0;
+      while (nameLength < name_size && name[nameLength] != '\0') {
+        ++nameLength;
+      }
+
+      entries.emplace_back(std::string{name, nameLength},
+                           entry{data + fileOffset, fileSize, 0});
+    }
+
+    return true;
+  }
+
+  // Reads the central directory of a ZIP file, skipping compressed entries
+  [[nodiscard]] static auto read_zip(const mapped_file& archive,
+                                     std::vector<std::pair<std::string, entry>>& entries)
+      -> bool
+  {
+    constexpr size_type end_size = 22;
+    constexpr size_type central_size = 46;
+    constexpr size_type local_size = 30;
+    constexpr size_type max_comment = 65'535;
+
+    const auto* data = archive.data();
+    const auto size = archive.size();
+
+    if (size < end_size) {
+      return false;
+    }
+
+    // The end of central directory record is followed by a comment of unknown length
+    const u8* end = nullptr;
+    const auto first = size > end_size + max_comment ? size - end_size - max_comment : 0;
+
+    for (auto position = size - end_size + 1; position-- > first;) {
+      if (read_u32(data + position) == 0x06054B50) {
+        end = data + position;
+        break;
+      }
+    }
+
+    if (!end) {
+      return false;
+    }
+
+    const size_type count = read_u16(end + 10);
+    size_type position = read_u32(end + 16);
+
+    for (size_type index = 0; index < count; ++index) {
+      if (position > size || central_size > size - position) {
+        return false;
+      }
+
+      const auto* header = data + position;
+      if (read_u32(header) != 0x02014B50) {
+        return false;
+      }
+
+      const auto method = read_u16(header + 10);
+      const size_type compressedSize = read_u32(header + 20);
+      const size_type nameLength = read_u16(header + 28);
+      const size_type extraLength = read_u16(header + 30);
+      const size_type commentLength = read_u16(header + 32);
+      const size_type localOffset = read_u32(header + 42);
+
+      if (nameLength > size - position - central_size) {
+        return false;
+      }
+
+      const std::string name{reinterpret_cast<const char*>(header + central_size),
+                             nameLength};
+      position += central_size + nameLength + extraLength + commentLength;
+
+      if (method != 0 || name.empty() || name.back() == '/') {
+        continue;
+      }
+
+      if (localOffset > size || local_size > size - localOffset) {
+        return false;
+      }
+
+      // The local header has its own name and extra field lengths
+      const auto* local = data + localOffset;
+      const size_type begin =
+          localOffset + local_size + read_u16(local + 26) + read_u16(local + 28);
+
+      if (begin > size || compressedSize > size - begin || compressedSize > INT_MAX) {
+        return false;
+      }
+
+      entries.emplace_back(name, entry{data + begin, compressedSize, 0});
+    }
+
+    return true;
+  }
+};
+
+/// \} End of group filesystem
+
+}  // namespace cen
+
+#endif  // CENTURION_VIRTUAL_FILESYSTEM_HEADER
@@ -192,12 +192,7 @@ class enum_hint
 
   [[nodiscard]] static auto current_value() noexcept -> std::optional<value_type>
   {
-    if (const str hint = SDL_GetHint(Derived::name())) {
-      return Derived::map.key_from(hint);
-    }
-    else {
-      return std::nullopt;
-    }
+    return try_from_string(SDL_GetHint(Derived::name()));
   }
 
   [[nodiscard]] static auto from_string(const str value) -> value_type
@@ -205,6 +200,17 @@ class enum_hint
     return Derived::map.key_from(value);
   }
 
+  [[nodiscard]] static auto try_from_string(const str value) noexcept
+      -> std::optional<value_type>
+  {
+    if (const auto* key = Derived::map.find_key(value)) {
+      return *key;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
   [[nodiscard]] static auto to_string(const value_type value) -> std::string
   {
     return Derived::map.find(value);
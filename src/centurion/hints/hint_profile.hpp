@@ -0,0 +1,372 @@
+#ifndef CENTURION_HINT_PROFILE_HEADER
+#define CENTURION_HINT_PROFILE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>        // array
+#include <charconv>     // to_chars
+#include <cstdio>       // snprintf
+#include <optional>     // optional
+#include <string>       // string
+#include <string_view>  // string_view
+#include <tuple>        // tuple, apply
+#include <type_traits>  // is_same_v, is_enum_v, disjunction_v
+#include <vector>       // vector
+
+#include "../compiler/features.hpp"
+#include "../core/integers.hpp"
+#include "../core/str.hpp"
+#include "../detail/hints_impl.hpp"
+#include "../filesystem/file.hpp"
+#include "hint_priority.hpp"
+
+namespace cen {
+
+/// \addtogroup hints
+/// \{
+
+/**
+ * \struct hint_setting
+ *
+ * \brief A hint and the value it should be set to, as part of a `hint_profile`.
+ *
+ * \tparam Hint the type of the hint.
+ *
+ * \see `hint_value()`
+ *
+ * \since 6.4.0
+ */
+template <typename Hint>
+struct hint_setting final
+{
+  using hint_type = Hint;
+  using value_type = typename Hint::value_type;
+
+  value_type value{};  ///< The value of the hint.
+};
+
+/**
+ * \brief Creates a hint setting for a hint profile.
+ *
+ * \details Like `set_hint()`, supplying a value of the wrong type causes a compile-time
+ * error.
+ *
+ * \tparam Hint the type of the hint.
+ * \tparam T the type of the value.
+ *
+ * \param value the value of the hint.
+ *
+ * \return a hint setting.
+ *
+ * \since 6.4.0
+ */
+template <typename Hint, typename T, detail::enable_if_hint_arg_t<Hint, T> = 0>
+[[nodiscard]] constexpr auto hint_value(const T& value) noexcept -> hint_setting<Hint>
+{
+  return hint_setting<Hint>{value};
+}
+
+/**
+ * \struct hint_report
+ *
+ * \brief Provides the results of applying a hint profile or hint configuration.
+ *
+ * \since 6.4.0
+ */
+struct hint_report final
+{
+  usize applied{};                    ///< The amount of hints that were set.
+  std::vector<std::string> rejected;  ///< The hints, or config lines, that weren't set.
+
+  /**
+   * \brief Indicates whether all hints were set.
+   *
+   * \return `true` if no hints were rejected; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto ok() const noexcept -> bool
+  {
+    return rejected.empty();
+  }
+};
+
+/// \cond FALSE
+namespace detail {
+
+template <typename... Ts>
+inline constexpr bool are_unique_v = true;
+
+template <typename T, typename... Ts>
+inline constexpr bool are_unique_v<T, Ts...> =
+    !std::disjunction_v<std::is_same<T, Ts>...> && are_unique_v<Ts...>;
+
+using hint_buffer = std::array<char, 32>;
+
+// Converts a hint value without allocating, unlike Hint::to_string()
+template <typename Hint>
+[[nodiscard]] auto hint_to_chars(const typename Hint::value_type& value,
+                                 hint_buffer& buffer) -> str
+{
+  using value_type = typename Hint::value_type;
+
+  if constexpr (std::is_same_v<value_type, bool>) {
+    return value ? "1" : "0";
+  }
+  else if constexpr (std::is_same_v<value_type, str>) {
+    return value;
+  }
+  else if constexpr (std::is_enum_v<value_type>) {
+    return Hint::map.find(value);
+  }
+  else if constexpr (std::is_same_v<value_type, float>) {
+#if CENTURION_HAS_FEATURE_FLOAT_CHARCONV
+    const auto [ptr, err] = std::to_chars(buffer.data(), buffer.data() + buffer.size() - 1,
+                                          value);
+    *(err == std::errc{} ? ptr : buffer.data()) = '\0';
+#else
+    std::snprintf(buffer.data(), buffer.size(), "%f", static_cast<double>(value));
+#endif  // CENTURION_HAS_FEATURE_FLOAT_CHARCONV
+    return buffer.data();
+  }
+  else {
+    const auto [ptr, err] = std::to_chars(buffer.data(), buffer.data() + buffer.size() - 1,
+                                          value);
+    *(err == std::errc{} ? ptr : buffer.data()) = '\0';
+    return buffer.data();
+  }
+}
+
+[[nodiscard]] inline auto trim_hint_text(std::string_view text) noexcept
+    -> std::string_view
+{
+  constexpr std::string_view whitespace{" \t\r"};
+
+  const auto first = text.find_first_not_of(whitespace);
+  if (first == std::string_view::npos) {
+    return {};
+  }
+
+  const auto last = text.find_last_not_of(whitespace);
+  return text.substr(first, last - first + 1);
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class hint_profile
+ *
+ * \brief A list of hints and values, which are applied in a single pass.
+ *
+ * \details Hint profiles are meant to be declared as constants, which makes the hints that
+ * affect performance, such as the render driver, vsync and render batching, easy to review
+ * and reproduce. Each hint may only appear once, and the values must be of the correct
+ * types, which is checked at compile-time. The values are converted to strings without
+ * allocating memory when the profile is applied.
+ * \code{cpp}
+ *   using namespace cen::hint;
+ *
+ *   constexpr auto profile = cen::make_hint_profile(
+ *       cen::hint_value<render_driver>(render_driver::value::opengl),
+ *       cen::hint_value<vsync>(true),
+ *       cen::hint_value<render_batching>(true));
+ *
+ *   const auto report = profile.apply();
+ *   for (const auto& name : report.rejected) {
+ *     cen::log::warn("Hint %s was rejected", name.c_str());
+ *   }
+ * \endcode
+ *
+ * \tparam Hints the types of the hints in the profile.
+ *
+ * \see `make_hint_profile()`
+ * \see `apply_hint_config()`
+ *
+ * \since 6.4.0
+ */
+template <typename... Hints>
+class hint_profile final
+{
+  static_assert(detail::are_unique_v<Hints...>,
+                "A hint may only appear once in a hint profile!");
+
+ public:
+  /**
+   * \brief Creates a hint profile.
+   *
+   * \param settings the hints and their values.
+   *
+   * \since 6.4.0
+   */
+  constexpr explicit hint_profile(const hint_setting<Hints>&... settings) noexcept
+      : m_settings{settings...}
+  {}
+
+  /**
+   * \brief Sets all hints in the profile.
+   *
+   * \details Hints are rejected by SDL if they are already set with a higher priority.
+   *
+   * \param priority the priority that will be used for all hints.
+   *
+   * \return a report of the hints that were set, and the names of the rejected hints.
+   *
+   * \since 6.4.0
+   */
+  auto apply([[maybe_unused]] const hint_priority priority = hint_priority::normal) const
+      -> hint_report
+  {
+    hint_report report;
+
+    std::apply(
+        [&](const auto&... setting) {
+          [[maybe_unused]] detail::hint_buffer buffer{};
+          (apply_setting(setting, priority, buffer, report), ...);
+        },
+        m_settings);
+
+    return report;
+  }
+
+  /**
+   * \brief Returns the amount of hints in the profile.
+   *
+   * \return the amount of hints.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto size() noexcept -> usize
+  {
+    return sizeof...(Hints);
+  }
+
+ private:
+  std::tuple<hint_setting<Hints>...> m_settings;
+
+  template <typename Hint>
+  static void apply_setting(const hint_setting<Hint>& setting,
+                            const hint_priority priority,
+                            detail::hint_buffer& buffer,
+                            hint_report& report)
+  {
+    const auto value = detail::hint_to_chars<Hint>(setting.value, buffer);
+    if (SDL_SetHintWithPriority(Hint::name(),
+                                value,
+                                static_cast<SDL_HintPriority>(priority)) == SDL_TRUE) {
+      ++report.applied;
+    }
+    else {
+      report.rejected.emplace_back(Hint::name());
+    }
+  }
+};
+
+/**
+ * \brief Creates a hint profile.
+ *
+ * \param settings the hints and their values, created with `hint_value()`.
+ *
+ * \return a hint profile.
+ *
+ * \since 6.4.0
+ */
+template <typename... Hints>
+[[nodiscard]] constexpr auto make_hint_profile(const hint_setting<Hints>&... settings) noexcept
+    -> hint_profile<Hints...>
+{
+  return hint_profile<Hints...>{settings...};
+}
+
+/**
+ * \brief Sets the hints in a hint configuration.
+ *
+ * \details The configuration has one `NAME = value` pair per line, where `NAME` is the
+ * name used by SDL, e.g. `SDL_RENDER_DRIVER`. Empty lines and lines that start with `#`
+ * are ignored, and whitespace around names and values is trimmed.
+ * \code{cpp}
+ *   # Performance settings
+ *   SDL_RENDER_DRIVER = opengl
+ *   SDL_RENDER_VSYNC = 1
+ * \endcode
+ *
+ * \note The values aren't validated, since the hint types aren't known at runtime.
+ *
+ * \param config the hint configuration.
+ * \param priority the priority that will be used for all hints.
+ *
+ * \return a report of the hints that were set, and the rejected hint names or malformed
+ * lines.
+ *
+ * \since 6.4.0
+ */
+inline auto apply_hint_config(std::string_view config,
+                              const hint_priority priority = hint_priority::normal)
+    -> hint_report
+{
+  hint_report report;
+  std::string name;
+  std::string value;
+
+  while (!config.empty()) {
+    const auto end = config.find('\n');
+    const auto line = detail::trim_hint_text(config.substr(0, end));
+    config.remove_prefix(end == std::string_view::npos ? config.size() : end + 1);
+
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+
+    const auto separator = line.find('=');
+    if (separator == std::string_view::npos) {
+      report.rejected.emplace_back(line);
+      continue;
+    }
+
+    name = detail::trim_hint_text(line.substr(0, separator));
+    value = detail::trim_hint_text(line.substr(separator + 1));
+
+    if (!name.empty() && SDL_SetHintWithPriority(name.c_str(),
+                                                 value.c_str(),
+                                                 static_cast<SDL_HintPriority>(priority)) ==
+                             SDL_TRUE) {
+      ++report.applied;
+    }
+    else {
+      report.rejected.emplace_back(line);
+    }
+  }
+
+  return report;
+}
+
+/**
+ * \brief Sets the hints in a hint configuration file.
+ *
+ * \param path the file path of the hint configuration.
+ * \param priority the priority that will be used for all hints.
+ *
+ * \return a report of the hints that were set; `std::nullopt` if the file couldn't be
+ * opened.
+ *
+ * \see `apply_hint_config()`
+ *
+ * \since 6.4.0
+ */
+inline auto apply_hint_file(const std::string& path,
+                            const hint_priority priority = hint_priority::normal)
+    -> std::optional<hint_report>
+{
+  file source{path, file_mode::read_existing};
+  if (!source) {
+    return std::nullopt;
+  }
+
+  return apply_hint_config(source.read_all_as_string(), priority);
+}
+
+/// \} End of group hints
+
+}  // namespace cen
+
+#endif  // CENTURION_HINT_PROFILE_HEADER
@@ -3,10 +3,12 @@
 
 #include <SDL2/SDL.h>
 
-#include <optional>  // optional
+#include <optional>     // optional
+#include <type_traits>  // is_same_v
 
 #include "../compiler/features.hpp"
 #include "../core/exception.hpp"
+#include "../core/integers.hpp"
 #include "../core/is_stateless_callable.hpp"
 #include "../core/log.hpp"
 #include "../core/result.hpp"
@@ -262,6 +264,100 @@ auto add_hint_callback_ex([[maybe_unused]] Callable fun, UserData* data = nullpt
 
 #endif  // CENTURION_HAS_FEATURE_CONCEPTS
 
+/**
+ * \class cached_hint
+ *
+ * \brief Caches the parsed value of a hint, which is updated whenever the hint changes.
+ *
+ * \details `get_hint()` looks up and parses the hint string every time it is called, which
+ * adds up for hints that are read every frame. This class instead registers a hint callback
+ * with `SDL_AddHintCallback`, and only parses the hint when its value changes, so reading
+ * the value is as cheap as reading an `std::optional`.
+ * \code{cpp}
+ *   const cen::cached_hint<cen::hint::mouse::normal_speed_scale> speed;
+ *
+ *   // Later, once per frame
+ *   const auto scale = speed.value().value_or(1.0f);
+ * \endcode
+ *
+ * \note The cached value isn't updated by changes to environment variables, or after
+ * `clear_hints()` has been called, since that also removes all hint callbacks.
+ *
+ * \note The value isn't synchronized, so it should only be read on the thread that changes
+ * the hint.
+ *
+ * \tparam Hint the type of the hint, string hints are not supported.
+ *
+ * \since 6.4.0
+ */
+template <typename Hint>
+class cached_hint final
+{
+ public:
+  using value_type = typename Hint::value_type;
+
+  static_assert(!std::is_same_v<value_type, str>,
+                "String hints cannot be cached, since SDL owns the strings!");
+
+  /**
+   * \brief Caches the current value of the hint, and starts observing the hint.
+   *
+   * \since 6.4.0
+   */
+  cached_hint() noexcept
+  {
+    // The callback is immediately invoked with the current value of the hint
+    SDL_AddHintCallback(Hint::name(), on_changed, this);
+  }
+
+  cached_hint(const cached_hint&) = delete;
+  cached_hint(cached_hint&&) = delete;
+
+  auto operator=(const cached_hint&) -> cached_hint& = delete;
+  auto operator=(cached_hint&&) -> cached_hint& = delete;
+
+  ~cached_hint() noexcept
+  {
+    SDL_DelHintCallback(Hint::name(), on_changed, this);
+  }
+
+  /**
+   * \brief Returns the cached value of the hint.
+   *
+   * \return the current value of the hint; `std::nullopt` if the hint isn't set, or if its
+   * value couldn't be parsed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto value() const noexcept -> const std::optional<value_type>&
+  {
+    return m_value;
+  }
+
+  /**
+   * \brief Returns the amount of times the hint has been parsed.
+   *
+   * \return the amount of updates of the cached value, including the initial one.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto updates() const noexcept -> usize
+  {
+    return m_updates;
+  }
+
+ private:
+  std::optional<value_type> m_value;
+  usize m_updates{};
+
+  static void SDLCALL on_changed(void* data, const str, const str, const str value) noexcept
+  {
+    auto* self = static_cast<cached_hint*>(data);
+    self->m_value = Hint::try_from_string(value);
+    ++self->m_updates;
+  }
+};
+
 /**
  * \brief Clears all stored hints.
  *
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019-2021 Albin Johansson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CENTURION_INPUT_MODULE_HEADER
+#define CENTURION_INPUT_MODULE_HEADER
+
+#ifndef CENTURION_NO_PRAGMA_ONCE
+#pragma once
+#endif  // CENTURION_NO_PRAGMA_ONCE
+
+// Keyboard, mouse, controller, joystick, haptic, sensor and touch input.
+
+#include "input/action_map.hpp"
+#include "input/axis_filter.hpp"
+#include "input/button_state.hpp"
+#include "input/controller.hpp"
+#include "input/controller_axis.hpp"
+#include "input/controller_manager.hpp"
+#include "input/controller_mapping_loader.hpp"
+#include "input/controller_type.hpp"
+#include "input/haptic.hpp"
+#include "input/haptic_condition.hpp"
+#include "input/haptic_constant.hpp"
+#include "input/haptic_custom.hpp"
+#include "input/haptic_direction.hpp"
+#include "input/haptic_direction_type.hpp"
+#include "input/haptic_effect.hpp"
+#include "input/haptic_feature.hpp"
+#include "input/haptic_left_right.hpp"
+#include "input/haptic_periodic.hpp"
+#include "input/haptic_ramp.hpp"
+#include "input/haptic_scheduler.hpp"
+#include "input/hat_state.hpp"
+#include "input/input_fwd.hpp"
+#include "input/joystick.hpp"
+#include "input/joystick_power.hpp"
+#include "input/joystick_type.hpp"
+#include "input/key_code.hpp"
+#include "input/key_modifier.hpp"
+#include "input/key_set.hpp"
+#include "input/keyboard.hpp"
+#include "input/keyboard_tracker.hpp"
+#include "input/keycodes.hpp"
+#include "input/mouse.hpp"
+#include "input/mouse_tracker.hpp"
+#include "input/scan_code.hpp"
+#include "input/scancodes.hpp"
+#include "input/sensor.hpp"
+#include "input/sensor_stream.hpp"
+#include "input/sensor_type.hpp"
+#include "input/text_input_buffer.hpp"
+#include "input/touch.hpp"
+#include "input/touch_device_type.hpp"
+#include "input/touch_tracker.hpp"
+#include "input/virtual_joystick_swarm.hpp"
+
+#endif  // CENTURION_INPUT_MODULE_HEADER
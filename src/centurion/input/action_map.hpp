@@ -0,0 +1,479 @@
+#ifndef CENTURION_ACTION_MAP_HEADER
+#define CENTURION_ACTION_MAP_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>        // array
+#include <cassert>      // assert
+#include <functional>   // less
+#include <map>          // map
+#include <optional>     // optional, nullopt
+#include <string>       // string
+#include <string_view>  // string_view
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+#include "controller.hpp"
+#include "controller_axis.hpp"
+#include "controller_button.hpp"
+#include "key_code.hpp"
+#include "key_set.hpp"
+#include "keyboard.hpp"
+#include "mouse.hpp"
+#include "mouse_button.hpp"
+#include "scan_code.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \enum action_id
+ *
+ * \brief Identifies an action in an `action_map`.
+ *
+ * \since 6.4.0
+ */
+enum class action_id : u32
+{
+};
+
+/**
+ * \struct action_state
+ *
+ * \brief Represents the state of an action, as determined by the last update.
+ *
+ * \since 6.4.0
+ */
+struct action_state final
+{
+  u8 bits{};  ///< The packed state flags.
+
+  /**
+   * \brief Indicates whether or not any binding of the action is active.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_active() const noexcept -> bool
+  {
+    return bits & active_bit;
+  }
+
+  /**
+   * \brief Indicates whether or not the action became active in the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_activated() const noexcept -> bool
+  {
+    return bits & activated_bit;
+  }
+
+  /**
+   * \brief Indicates whether or not the action became inactive in the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_deactivated() const noexcept -> bool
+  {
+    return bits & deactivated_bit;
+  }
+
+  inline constexpr static u8 active_bit = 1u << 0u;
+  inline constexpr static u8 activated_bit = 1u << 1u;
+  inline constexpr static u8 deactivated_bit = 1u << 2u;
+};
+
+/**
+ * \struct input_snapshot
+ *
+ * \brief A compact copy of the state of the input devices, used to evaluate actions.
+ *
+ * \since 6.4.0
+ */
+struct input_snapshot final
+{
+  key_set keys;             ///< The pressed keys.
+  u32 mouseButtons{};       ///< The pressed mouse buttons, as an `SDL_BUTTON()` mask.
+  u32 controllerButtons{};  ///< The pressed controller buttons, one bit per button.
+  std::array<i16, SDL_CONTROLLER_AXIS_MAX> controllerAxes{};  ///< The controller axes.
+};
+
+/**
+ * \class action_map
+ *
+ * \brief Maps named actions to keys, mouse buttons, controller buttons and controller
+ * axes.
+ *
+ * \details Instead of querying each binding individually every frame, the bindings of an
+ * action map are stored in flat tables per kind of input, which are evaluated together
+ * against a snapshot of the input devices by `update()`. The results are stored in a
+ * contiguous array of compact action states, indexed by action identifier.
+ *
+ * \details An action is active if any of its bindings are active. Axis bindings are
+ * active when the axis value passes a threshold, where the sign of the threshold
+ * determines the direction of the axis.
+ *
+ * \code{cpp}
+ *   cen::action_map actions;
+ *
+ *   const auto jump = actions.add("jump");
+ *   actions.bind(jump, cen::scancodes::space);
+ *   actions.bind(jump, cen::controller_button::a);
+ *
+ *   // Every frame
+ *   actions.update(keyboard, mouse, controller);
+ *   if (actions.state(jump).just_activated()) {
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \since 6.4.0
+ */
+class action_map final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Adds an action.
+   *
+   * \param name the unique name of the action.
+   *
+   * \return the identifier of the action; the identifier of the existing action if there
+   * already is an action with the same name.
+   *
+   * \since 6.4.0
+   */
+  auto add(std::string name) -> action_id
+  {
+    if (const auto existing = find(name)) {
+      return *existing;
+    }
+
+    const auto id = static_cast<action_id>(m_states.size());
+
+    m_names.emplace(std::move(name), id);
+    m_states.emplace_back();
+    m_next.push_back(0);
+
+    return id;
+  }
+
+  /**
+   * \brief Returns the identifier of an action.
+   *
+   * \param name the name of the action.
+   *
+   * \return the identifier of the action; `std::nullopt` if there is no such action.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto find(const std::string_view name) const -> std::optional<action_id>
+  {
+    if (const auto it = m_names.find(name); it != m_names.end()) {
+      return it->second;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Binds a key to an action.
+   *
+   * \param id the action that the key will be bound to.
+   * \param code the scan code of the key.
+   *
+   * \since 6.4.0
+   */
+  void bind(const action_id id, const scan_code& code)
+  {
+    assert(contains(id));
+    m_keys.push_back(binding<scan_code>{code, index_of(id)});
+  }
+
+  /**
+   * \brief Binds a key to an action.
+   *
+   * \param id the action that the key will be bound to.
+   * \param code the key code of the key.
+   *
+   * \since 6.4.0
+   */
+  void bind(const action_id id, const key_code& code)
+  {
+    bind(id, code.to_scan_code());
+  }
+
+  /**
+   * \brief Binds a mouse button to an action.
+   *
+   * \param id the action that the button will be bound to.
+   * \param button the mouse button.
+   *
+   * \since 6.4.0
+   */
+  void bind(const action_id id, const mouse_button button)
+  {
+    assert(contains(id));
+    m_mouseButtons.push_back(binding<u32>{SDL_BUTTON(static_cast<u32>(button)), index_of(id)});
+  }
+
+  /**
+   * \brief Binds a controller button to an action.
+   *
+   * \param id the action that the button will be bound to.
+   * \param button the controller button, must be a valid button.
+   *
+   * \since 6.4.0
+   */
+  void bind(const action_id id, const controller_button button)
+  {
+    assert(contains(id));
+    assert(static_cast<int>(button) >= 0 && static_cast<int>(button) < 32);
+
+    m_controllerButtons.push_back(binding<u32>{1u << static_cast<u32>(button), index_of(id)});
+  }
+
+  /**
+   * \brief Binds a controller axis to an action.
+   *
+   * \param id the action that the axis will be bound to.
+   * \param axis the controller axis, must be a valid axis.
+   * \param threshold the axis value at which the binding becomes active. A positive
+   * threshold is passed by values greater than or equal to the threshold, and a negative
+   * threshold is passed by values less than or equal to the threshold.
+   *
+   * \since 6.4.0
+   */
+  void bind(const action_id id, const controller_axis axis, const i16 threshold)
+  {
+    assert(contains(id));
+    assert(static_cast<int>(axis) >= 0 && static_cast<int>(axis) < SDL_CONTROLLER_AXIS_MAX);
+    assert(threshold != 0);
+
+    m_axes.push_back(axis_binding{static_cast<u8>(axis), threshold, index_of(id)});
+  }
+
+  /**
+   * \brief Removes all bindings, but keeps the actions.
+   *
+   * \since 6.4.0
+   */
+  void clear_bindings() noexcept
+  {
+    m_keys.clear();
+    m_mouseButtons.clear();
+    m_controllerButtons.clear();
+    m_axes.clear();
+  }
+
+  /**
+   * \brief Evaluates all actions against a snapshot of the input devices.
+   *
+   * \param input the state of the input devices.
+   *
+   * \since 6.4.0
+   */
+  void update(const input_snapshot& input) noexcept
+  {
+    for (const auto& [code, action] : m_keys) {
+      m_next[action] |= input.keys.contains(code);
+    }
+
+    for (const auto& [mask, action] : m_mouseButtons) {
+      m_next[action] |= (input.mouseButtons & mask) != 0;
+    }
+
+    for (const auto& [mask, action] : m_controllerButtons) {
+      m_next[action] |= (input.controllerButtons & mask) != 0;
+    }
+
+    for (const auto& [axis, threshold, action] : m_axes) {
+      const auto value = input.controllerAxes[axis];
+      m_next[action] |= threshold > 0 ? value >= threshold : value <= threshold;
+    }
+
+    for (size_type index = 0; index < m_states.size(); ++index) {
+      const bool active = m_next[index];
+      const bool previous = m_states[index].is_active();
+
+      auto& bits = m_states[index].bits;
+      bits = active ? action_state::active_bit : 0;
+
+      if (active != previous) {
+        bits |= active ? action_state::activated_bit : action_state::deactivated_bit;
+      }
+
+      m_next[index] = 0;
+    }
+  }
+
+  /**
+   * \brief Evaluates all actions against the state of the keyboard and mouse.
+   *
+   * \details Controller bindings are considered to be inactive.
+   *
+   * \param keyboard the keyboard state.
+   * \param mouse the mouse state.
+   *
+   * \since 6.4.0
+   */
+  void update(const keyboard& keyboard, const mouse& mouse) noexcept
+  {
+    update(snapshot(keyboard, mouse));
+  }
+
+  /**
+   * \brief Evaluates all actions against the state of the keyboard, mouse and a
+   * controller.
+   *
+   * \details The controller is only queried if there are any controller bindings.
+   *
+   * \tparam T the ownership semantics of the controller.
+   *
+   * \param keyboard the keyboard state.
+   * \param mouse the mouse state.
+   * \param controller the controller.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void update(const keyboard& keyboard,
+              const mouse& mouse,
+              const basic_controller<T>& controller) noexcept
+  {
+    auto input = snapshot(keyboard, mouse);
+
+    if (!m_controllerButtons.empty() || !m_axes.empty()) {
+      const auto state = controller.snapshot();
+      input.controllerButtons = state.buttons;
+      input.controllerAxes = state.axes;
+    }
+
+    update(input);
+  }
+
+  /**
+   * \brief Returns the state of an action.
+   *
+   * \param id the identifier of the action.
+   *
+   * \return the state of the action.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto state(const action_id id) const noexcept -> action_state
+  {
+    assert(contains(id));
+    return m_states[index_of(id)];
+  }
+
+  /**
+   * \brief Returns the states of all actions, indexed by action identifier.
+   *
+   * \return the action states.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto states() const noexcept -> const std::vector<action_state>&
+  {
+    return m_states;
+  }
+
+  /**
+   * \brief Indicates whether or not an action identifier is valid.
+   *
+   * \param id the action identifier that will be checked.
+   *
+   * \return `true` if the action exists; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto contains(const action_id id) const noexcept -> bool
+  {
+    return index_of(id) < m_states.size();
+  }
+
+  /**
+   * \brief Returns the amount of actions.
+   *
+   * \return the number of actions.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_states.size();
+  }
+
+  /**
+   * \brief Returns the total amount of bindings.
+   *
+   * \return the number of bindings, of all kinds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto binding_count() const noexcept -> size_type
+  {
+    return m_keys.size() + m_mouseButtons.size() + m_controllerButtons.size() +
+           m_axes.size();
+  }
+
+ private:
+  template <typename T>
+  struct binding final
+  {
+    T input{};
+    usize action{};
+  };
+
+  struct axis_binding final
+  {
+    u8 axis{};
+    i16 threshold{};
+    usize action{};
+  };
+
+  std::map<std::string, action_id, std::less<>> m_names;
+  std::vector<action_state> m_states;
+  std::vector<u8> m_next;  ///< Scratch buffer used when evaluating bindings.
+  std::vector<binding<scan_code>> m_keys;
+  std::vector<binding<u32>> m_mouseButtons;
+  std::vector<binding<u32>> m_controllerButtons;
+  std::vector<axis_binding> m_axes;
+
+  [[nodiscard]] static auto index_of(const action_id id) noexcept -> usize
+  {
+    return static_cast<usize>(id);
+  }
+
+  [[nodiscard]] static auto snapshot(const keyboard& keyboard, const mouse& mouse) noexcept
+      -> input_snapshot
+  {
+    input_snapshot input;
+    input.keys = keyboard.pressed_keys();
+
+    for (const auto button : {mouse_button::left,
+                              mouse_button::middle,
+                              mouse_button::right,
+                              mouse_button::x1,
+                              mouse_button::x2})
+    {
+      if (mouse.is_pressed(button)) {
+        input.mouseButtons |= SDL_BUTTON(static_cast<u32>(button));
+      }
+    }
+
+    return input;
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_ACTION_MAP_HEADER
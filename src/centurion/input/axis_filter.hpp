@@ -0,0 +1,345 @@
+#ifndef CENTURION_AXIS_FILTER_HEADER
+#define CENTURION_AXIS_FILTER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>    // array
+#include <cassert>  // assert
+
+#include "../core/integers.hpp"
+#include "../detail/axis_kernels.hpp"
+#include "../detail/clamp.hpp"
+#include "../math/point.hpp"
+#include "controller_axis.hpp"
+#include "controller_manager.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \enum dead_zone_shape
+ *
+ * \brief Provides values that determine how the dead zone of a stick is applied.
+ *
+ * \since 6.4.0
+ */
+enum class dead_zone_shape
+{
+  axial,  ///< The dead zone is applied to each axis of a stick separately.
+  radial  ///< The dead zone is applied to the distance of a stick from its center.
+};
+
+/**
+ * \enum response_curve
+ *
+ * \brief Provides values that determine how axis values are mapped after dead zones.
+ *
+ * \since 6.4.0
+ */
+enum class response_curve
+{
+  linear = 1,     ///< Values are used as is.
+  quadratic = 2,  ///< Values are squared, which gives more precision near the center.
+  cubic = 3       ///< Values are cubed, which gives even more precision near the center.
+};
+
+/**
+ * \struct axis_filter_settings
+ *
+ * \brief Provides the settings of an axis filter for either sticks or triggers.
+ *
+ * \details Values are first normalized to [-1, 1], or [0, 1] for triggers. Magnitudes
+ * below the dead zone are then mapped to zero, and magnitudes above the saturation
+ * point are mapped to one, followed by the response curve and exponential smoothing.
+ *
+ * \since 6.4.0
+ */
+struct axis_filter_settings final
+{
+  float dead_zone{0.1f};                           ///< The dead zone, in [0, 1).
+  float saturation{1.0f};                          ///< The full magnitude point, in (0, 1].
+  float smoothing{0.0f};                           ///< The smoothing factor, in [0, 1).
+  dead_zone_shape shape{dead_zone_shape::radial};  ///< The dead zone shape of sticks.
+  response_curve curve{response_curve::linear};    ///< The response curve.
+};
+
+/**
+ * \class axis_filter
+ *
+ * \brief Applies dead zones, response curves and smoothing to the axes of all
+ * controllers in a controller snapshot.
+ *
+ * \details The filter processes the snapshots provided by a `controller_manager`, which
+ * store each axis of all controllers contiguously. This makes it possible to filter all
+ * axes of all controllers in a few passes, using SSE2 or NEON when available.
+ *
+ * \details The filtered values are stored in the same structure-of-arrays layout, where
+ * stick axes are in [-1, 1], and trigger axes are in [0, 1]. Slots without a connected
+ * controller always have zero values.
+ *
+ * \code{cpp}
+ *   cen::axis_filter filter;
+ *
+ *   // Once per frame, after updating the controller manager
+ *   filter.process(manager.snapshot());
+ *   const auto stick = filter.left_stick(0);
+ * \endcode
+ *
+ * \see `controller_manager`
+ *
+ * \since 6.4.0
+ */
+class axis_filter final
+{
+ public:
+  using size_type = usize;
+
+  inline constexpr static size_type capacity = controller_snapshot::capacity;
+  inline constexpr static size_type axis_count = controller_snapshot::axis_count;
+
+  using values_type = std::array<std::array<float, capacity>, axis_count>;
+
+  /**
+   * \brief Creates an axis filter that uses the default settings.
+   *
+   * \since 6.4.0
+   */
+  axis_filter() noexcept
+  {
+    set_stick_settings({});
+    set_trigger_settings({});
+  }
+
+  /**
+   * \brief Creates an axis filter.
+   *
+   * \param sticks the settings used for the stick axes.
+   * \param triggers the settings used for the trigger axes.
+   *
+   * \since 6.4.0
+   */
+  axis_filter(const axis_filter_settings& sticks,
+              const axis_filter_settings& triggers) noexcept
+  {
+    set_stick_settings(sticks);
+    set_trigger_settings(triggers);
+  }
+
+  /**
+   * \brief Filters the axes of all controllers in a snapshot.
+   *
+   * \details This should be called once per frame, since smoothing is applied per call.
+   *
+   * \param snapshot the controller snapshot that provides the raw axis values.
+   *
+   * \since 6.4.0
+   */
+  void process(const controller_snapshot& snapshot) noexcept
+  {
+    const auto& raw = snapshot.axes;
+
+    process_stick(raw, SDL_CONTROLLER_AXIS_LEFTX, SDL_CONTROLLER_AXIS_LEFTY);
+    process_stick(raw, SDL_CONTROLLER_AXIS_RIGHTX, SDL_CONTROLLER_AXIS_RIGHTY);
+
+    process_trigger(raw, SDL_CONTROLLER_AXIS_TRIGGERLEFT);
+    process_trigger(raw, SDL_CONTROLLER_AXIS_TRIGGERRIGHT);
+
+    for (size_type slot = 0; slot < capacity; ++slot) {
+      if (!snapshot.connected[slot]) {
+        for (auto& values : m_values) {
+          values[slot] = 0;
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Resets all filtered values to zero, which also resets the smoothing.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_values = {};
+  }
+
+  /**
+   * \brief Sets the settings used for the stick axes.
+   *
+   * \details The settings are adjusted to be within their valid ranges. The saturation
+   * point is adjusted to be above the dead zone.
+   *
+   * \param settings the stick settings.
+   *
+   * \since 6.4.0
+   */
+  void set_stick_settings(const axis_filter_settings& settings) noexcept
+  {
+    m_stickSettings = settings;
+    m_sticks = to_params(settings);
+  }
+
+  /**
+   * \brief Sets the settings used for the trigger axes.
+   *
+   * \details The settings are adjusted to be within their valid ranges. The dead zone
+   * shape is ignored, since triggers only have a single axis.
+   *
+   * \param settings the trigger settings.
+   *
+   * \since 6.4.0
+   */
+  void set_trigger_settings(const axis_filter_settings& settings) noexcept
+  {
+    m_triggerSettings = settings;
+    m_triggers = to_params(settings);
+  }
+
+  /**
+   * \brief Returns the filtered value of an axis in a slot.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   * \param axis the axis, must be a valid axis.
+   *
+   * \return the filtered axis value.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto value(const size_type slot, const controller_axis axis) const noexcept
+      -> float
+  {
+    assert(slot < capacity);
+    return values(axis)[slot];
+  }
+
+  /**
+   * \brief Returns the filtered values of an axis in all slots.
+   *
+   * \param axis the axis, must be a valid axis.
+   *
+   * \return the filtered values of the axis, indexed by slot.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto values(const controller_axis axis) const noexcept
+      -> const std::array<float, capacity>&
+  {
+    assert(static_cast<usize>(axis) < axis_count);
+    return m_values[static_cast<usize>(axis)];
+  }
+
+  /**
+   * \brief Returns the filtered values of all axes.
+   *
+   * \return the filtered values, indexed by axis and then by slot.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto values() const noexcept -> const values_type&
+  {
+    return m_values;
+  }
+
+  /**
+   * \brief Returns the filtered position of the left stick in a slot.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   *
+   * \return the filtered stick position.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto left_stick(const size_type slot) const noexcept -> fpoint
+  {
+    return {value(slot, controller_axis::left_x), value(slot, controller_axis::left_y)};
+  }
+
+  /**
+   * \brief Returns the filtered position of the right stick in a slot.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   *
+   * \return the filtered stick position.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto right_stick(const size_type slot) const noexcept -> fpoint
+  {
+    return {value(slot, controller_axis::right_x), value(slot, controller_axis::right_y)};
+  }
+
+  [[nodiscard]] auto stick_settings() const noexcept -> const axis_filter_settings&
+  {
+    return m_stickSettings;
+  }
+
+  [[nodiscard]] auto trigger_settings() const noexcept -> const axis_filter_settings&
+  {
+    return m_triggerSettings;
+  }
+
+ private:
+  values_type m_values{};
+  axis_filter_settings m_stickSettings;
+  axis_filter_settings m_triggerSettings;
+  detail::axis_params m_sticks;
+  detail::axis_params m_triggers;
+
+  [[nodiscard]] static auto to_params(const axis_filter_settings& settings) noexcept
+      -> detail::axis_params
+  {
+    constexpr auto epsilon = 1e-3f;
+
+    const auto deadZone = detail::clamp(settings.dead_zone, 0.0f, 1.0f - epsilon);
+    const auto saturation = detail::clamp(settings.saturation, deadZone + epsilon, 1.0f);
+    const auto smoothing = detail::clamp(settings.smoothing, 0.0f, 1.0f - epsilon);
+
+    detail::axis_params params;
+    params.inner = deadZone;
+    params.invRange = 1.0f / (saturation - deadZone);
+    params.alpha = 1.0f - smoothing;
+    params.power = static_cast<int>(settings.curve);
+
+    return params;
+  }
+
+  void process_stick(const controller_snapshot::axes_type& raw,
+                     const SDL_GameControllerAxis xAxis,
+                     const SDL_GameControllerAxis yAxis) noexcept
+  {
+    constexpr auto count = static_cast<int>(capacity);
+
+    const auto x = static_cast<usize>(xAxis);
+    const auto y = static_cast<usize>(yAxis);
+
+    if (m_stickSettings.shape == dead_zone_shape::radial) {
+      detail::filter_radial(raw[x].data(),
+                            raw[y].data(),
+                            m_values[x].data(),
+                            m_values[y].data(),
+                            count,
+                            m_sticks);
+    }
+    else {
+      detail::filter_axial(raw[x].data(), m_values[x].data(), count, m_sticks);
+      detail::filter_axial(raw[y].data(), m_values[y].data(), count, m_sticks);
+    }
+  }
+
+  void process_trigger(const controller_snapshot::axes_type& raw,
+                       const SDL_GameControllerAxis axis) noexcept
+  {
+    constexpr auto count = static_cast<int>(capacity);
+
+    const auto index = static_cast<usize>(axis);
+    detail::filter_axial(raw[index].data(), m_values[index].data(), count, m_triggers);
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_AXIS_FILTER_HEADER
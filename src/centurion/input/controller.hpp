@@ -20,6 +20,7 @@
 
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
@@ -45,6 +46,55 @@ namespace cen {
 /// \addtogroup input
 /// \{
 
+/**
+ * \struct controller_state
+ *
+ * \brief Represents the state of all buttons and axes of a game controller.
+ *
+ * \details Controller states are obtained with `basic_controller::snapshot()`, which
+ * reads the entire state while holding the joystick lock once.
+ *
+ * \since 6.4.0
+ */
+struct controller_state final
+{
+  inline constexpr static usize axis_count = SDL_CONTROLLER_AXIS_MAX;
+  inline constexpr static usize button_count = SDL_CONTROLLER_BUTTON_MAX;
+
+  std::array<i16, axis_count> axes{};  ///< The axis values, indexed by axis.
+  u32 buttons{};                       ///< The pressed buttons, one bit per button.
+
+  /**
+   * \brief Indicates whether or not a button is pressed.
+   *
+   * \param button the button that will be checked, must be a valid button.
+   *
+   * \return `true` if the button is pressed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pressed(const controller_button button) const noexcept -> bool
+  {
+    assert(static_cast<usize>(button) < button_count);
+    return buttons & (1u << static_cast<u32>(button));
+  }
+
+  /**
+   * \brief Returns the value of an axis.
+   *
+   * \param axis the axis that will be queried, must be a valid axis.
+   *
+   * \return the value of the axis.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto axis(const controller_axis axis) const noexcept -> i16
+  {
+    assert(static_cast<usize>(axis) < axis_count);
+    return axes[static_cast<usize>(axis)];
+  }
+};
+
 template <typename T>
 class basic_controller;
 
@@ -170,8 +220,11 @@ class basic_controller final
    * \since 5.0.0
    */
   template <typename TT = T, detail::is_owner<TT> = 0>
-  explicit basic_controller(const int index = 0) : m_controller{SDL_GameControllerOpen(index)}
+  explicit basic_controller(const int index = 0)
   {
+    library::ensure(library_subsystem::controller);
+
+    m_controller.reset(SDL_GameControllerOpen(index));
     if (!m_controller) {
       throw sdl_error{};
     }
@@ -242,6 +295,40 @@ class basic_controller final
     SDL_GameControllerUpdate();
   }
 
+  /**
+   * \brief Returns the state of all buttons and axes of the controller.
+   *
+   * \details The joystick lock is held while the state is read, which makes this
+   * cheaper than querying each button and axis individually, and ensures that the state
+   * isn't updated by another thread in the middle of the snapshot.
+   *
+   * \return the current controller state.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto snapshot() const noexcept -> controller_state
+  {
+    controller_state state;
+
+    SDL_LockJoysticks();
+
+    for (usize button = 0; button < controller_state::button_count; ++button) {
+      const auto value = static_cast<SDL_GameControllerButton>(button);
+      if (SDL_GameControllerGetButton(m_controller, value) == SDL_PRESSED) {
+        state.buttons |= 1u << static_cast<u32>(button);
+      }
+    }
+
+    for (usize axis = 0; axis < controller_state::axis_count; ++axis) {
+      const auto value = static_cast<SDL_GameControllerAxis>(axis);
+      state.axes[axis] = SDL_GameControllerGetAxis(m_controller, value);
+    }
+
+    SDL_UnlockJoysticks();
+
+    return state;
+  }
+
   /**
    * \brief Indicates whether or not the specified value is usable as a
    * controller index.
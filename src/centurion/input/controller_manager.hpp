@@ -0,0 +1,513 @@
+#ifndef CENTURION_CONTROLLER_MANAGER_HEADER
+#define CENTURION_CONTROLLER_MANAGER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>     // array
+#include <cassert>   // assert
+#include <optional>  // optional, nullopt
+#include <string>    // string
+
+#include "../core/integers.hpp"
+#include "../detail/sdl_version_at_least.hpp"
+#include "../events/controller_device_event.hpp"
+#include "../events/event_type.hpp"
+#include "controller.hpp"
+#include "controller_axis.hpp"
+#include "controller_button.hpp"
+#include "controller_type.hpp"
+#include "joystick.hpp"
+#include "sensor_type.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \struct controller_info
+ *
+ * \brief Provides the static metadata of a game controller.
+ *
+ * \details The metadata is obtained once, when the controller is opened by a
+ * `controller_manager`, and when the controller is remapped.
+ *
+ * \since 6.4.0
+ */
+struct controller_info final
+{
+  SDL_JoystickID id{-1};       ///< The joystick instance ID of the controller.
+  std::string name;            ///< The name of the controller, might be empty.
+  std::optional<u16> vendor;   ///< The USB vendor ID, if available.
+  std::optional<u16> product;  ///< The USB product ID, if available.
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+  controller_type type{controller_type::unknown};  ///< The type of the controller.
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+  std::string serial;       ///< The serial number of the controller, might be empty.
+  int touchpadCount{};      ///< The amount of touchpads.
+  bool hasLed{};            ///< Indicates whether or not the controller has an LED.
+  bool hasGyroscope{};      ///< Indicates whether or not there is a gyroscope.
+  bool hasAccelerometer{};  ///< Indicates whether or not there is an accelerometer.
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+};
+
+/**
+ * \struct controller_snapshot
+ *
+ * \brief Provides the state of all controllers managed by a `controller_manager`.
+ *
+ * \details The snapshot uses a structure-of-arrays layout, where each controller is
+ * identified by a slot index. For instance, the values of a single axis for all
+ * controllers are stored next to each other, which makes it cheap to iterate a specific
+ * input across all players. Buttons are stored as bit masks, with one bit per button.
+ *
+ * \details Slots that are not in use have no pressed buttons and centered axes.
+ *
+ * \since 6.4.0
+ */
+struct controller_snapshot final
+{
+  inline constexpr static usize capacity = 8;
+  inline constexpr static usize axis_count = SDL_CONTROLLER_AXIS_MAX;
+  inline constexpr static usize button_count = SDL_CONTROLLER_BUTTON_MAX;
+
+  using axes_type = std::array<std::array<i16, capacity>, axis_count>;
+
+  std::array<bool, capacity> connected{};  ///< Indicates which slots are in use.
+  std::array<u32, capacity> buttons{};     ///< The pressed buttons in each slot.
+  std::array<u32, capacity> previous{};    ///< The buttons pressed during the last update.
+  axes_type axes{};                        ///< The axis values, indexed by axis and slot.
+
+  /**
+   * \brief Indicates whether or not a button is pressed in a slot.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   * \param button the button that will be checked, must be a valid button.
+   *
+   * \return `true` if the button is pressed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pressed(const usize slot,
+                                const controller_button button) const noexcept -> bool
+  {
+    assert(slot < capacity);
+    return buttons[slot] & mask_of(button);
+  }
+
+  /**
+   * \brief Indicates whether or not a button was pressed since the last update.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   * \param button the button that will be checked, must be a valid button.
+   *
+   * \return `true` if the button became pressed during the last update; `false`
+   * otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_pressed(const usize slot,
+                                  const controller_button button) const noexcept -> bool
+  {
+    assert(slot < capacity);
+    return (buttons[slot] & ~previous[slot]) & mask_of(button);
+  }
+
+  /**
+   * \brief Indicates whether or not a button was released since the last update.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   * \param button the button that will be checked, must be a valid button.
+   *
+   * \return `true` if the button became released during the last update; `false`
+   * otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_released(const usize slot,
+                                   const controller_button button) const noexcept -> bool
+  {
+    assert(slot < capacity);
+    return (previous[slot] & ~buttons[slot]) & mask_of(button);
+  }
+
+  /**
+   * \brief Returns the value of an axis in a slot.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   * \param axis the axis that will be queried, must be a valid axis.
+   *
+   * \return the value of the axis.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto axis(const usize slot, const controller_axis axis) const noexcept
+      -> i16
+  {
+    assert(slot < capacity);
+    assert(static_cast<usize>(axis) < axis_count);
+    return axes[static_cast<usize>(axis)][slot];
+  }
+
+  /**
+   * \brief Returns the values of an axis in all slots.
+   *
+   * \param axis the axis that will be queried, must be a valid axis.
+   *
+   * \return the values of the axis, indexed by slot.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto axis(const controller_axis axis) const noexcept
+      -> const std::array<i16, capacity>&
+  {
+    assert(static_cast<usize>(axis) < axis_count);
+    return axes[static_cast<usize>(axis)];
+  }
+
+  /**
+   * \brief Returns the bit that represents a button in the button masks.
+   *
+   * \param button the button, must be a valid button.
+   *
+   * \return the bit mask of the button.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto mask_of(const controller_button button) noexcept
+      -> u32
+  {
+    return 1u << static_cast<u32>(button);
+  }
+};
+
+/**
+ * \class controller_manager
+ *
+ * \brief Manages the game controllers of a local multiplayer session.
+ *
+ * \details A controller manager opens and closes controllers in response to controller
+ * device events, and assigns each controller to a slot that stays the same as long as
+ * the controller is connected. New controllers are assigned to the first free slot,
+ * which also becomes the player index of the controller.
+ *
+ * \details The static metadata of each controller, such as its name and type, is cached
+ * in a `controller_info` when the controller is opened, so that it isn't queried from
+ * SDL every frame. The button and axis state of all controllers is sampled once per
+ * update into a `controller_snapshot`.
+ *
+ * \details A typical setup looks like this.
+ * \code{cpp}
+ *   cen::controller_manager controllers;
+ *   controllers.open_all();
+ *
+ *   dispatcher.bind<cen::controller_device_event>().to(
+ *       [&](const cen::controller_device_event& event) { controllers.feed(event); });
+ *
+ *   // Once per frame, after polling events
+ *   controllers.update();
+ *   const auto& state = controllers.snapshot();
+ * \endcode
+ *
+ * \since 6.4.0
+ */
+class controller_manager final
+{
+ public:
+  using size_type = usize;
+
+  inline constexpr static size_type capacity = controller_snapshot::capacity;
+
+  /**
+   * \brief Creates a controller manager without any open controllers.
+   *
+   * \see `open_all()`
+   *
+   * \since 6.4.0
+   */
+  controller_manager() noexcept = default;
+
+  controller_manager(const controller_manager&) = delete;
+
+  auto operator=(const controller_manager&) -> controller_manager& = delete;
+
+  /**
+   * \brief Opens all connected game controllers that aren't already managed.
+   *
+   * \details This should be called once after the game controller subsystem has been
+   * initialized, since controllers that are connected at that point might not produce
+   * device events before being polled.
+   *
+   * \return the amount of opened controllers.
+   *
+   * \since 6.4.0
+   */
+  auto open_all() -> size_type
+  {
+    size_type count = 0;
+
+    for (auto index = 0, joysticks = SDL_NumJoysticks(); index < joysticks; ++index) {
+      if (controller::is_supported(index) && open(index)) {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Updates the managed controllers with a controller device event.
+   *
+   * \details Added controllers are opened and assigned a free slot, removed controllers
+   * are closed and the metadata of remapped controllers is refreshed. Added controllers
+   * are ignored if there are no free slots, or if they are already managed.
+   *
+   * \param event the controller device event.
+   *
+   * \return the slot of the affected controller; `std::nullopt` if no controller was
+   * affected.
+   *
+   * \since 6.4.0
+   */
+  auto feed(const controller_device_event& event) -> std::optional<size_type>
+  {
+    switch (event.type()) {
+      case event_type::controller_device_added:
+        return open(event.which());
+
+      case event_type::controller_device_removed: {
+        const auto slot = slot_of(event.which());
+        if (slot) {
+          close(*slot);
+        }
+
+        return slot;
+      }
+
+      case event_type::controller_device_remapped: {
+        const auto slot = slot_of(event.which());
+        if (slot) {
+          load_info(*slot);
+        }
+
+        return slot;
+      }
+
+      default:
+        return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Samples the buttons and axes of all managed controllers.
+   *
+   * \details This should be called once per frame, after the events of the frame have
+   * been polled.
+   *
+   * \since 6.4.0
+   */
+  void update() noexcept
+  {
+    m_snapshot.previous = m_snapshot.buttons;
+
+    for (size_type slot = 0; slot < capacity; ++slot) {
+      const auto& controller = m_controllers[slot];
+      if (!controller) {
+        continue;
+      }
+
+      const auto state = controller->snapshot();
+      m_snapshot.buttons[slot] = state.buttons;
+
+      for (usize axis = 0; axis < controller_snapshot::axis_count; ++axis) {
+        m_snapshot.axes[axis][slot] = state.axes[axis];
+      }
+    }
+  }
+
+  /**
+   * \brief Closes the controller in a slot, if there is one.
+   *
+   * \param slot the index of the slot, must be less than `capacity`.
+   *
+   * \since 6.4.0
+   */
+  void close(const size_type slot) noexcept
+  {
+    assert(slot < capacity);
+
+    m_controllers[slot].reset();
+    m_info[slot] = controller_info{};
+
+    m_snapshot.connected[slot] = false;
+    m_snapshot.buttons[slot] = 0;
+    m_snapshot.previous[slot] = 0;
+
+    for (auto& values : m_snapshot.axes) {
+      values[slot] = 0;
+    }
+  }
+
+  /**
+   * \brief Returns the slot of a managed controller.
+   *
+   * \param id the joystick instance ID of the controller.
+   *
+   * \return the slot of the controller; `std::nullopt` if the controller isn't managed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto slot_of(const SDL_JoystickID id) const noexcept
+      -> std::optional<size_type>
+  {
+    for (size_type slot = 0; slot < capacity; ++slot) {
+      if (m_snapshot.connected[slot] && m_info[slot].id == id) {
+        return slot;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+   * \brief Indicates whether or not a slot is in use.
+   *
+   * \param slot the index of the slot.
+   *
+   * \return `true` if there is a controller in the slot; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_connected(const size_type slot) const noexcept -> bool
+  {
+    return slot < capacity && m_snapshot.connected[slot];
+  }
+
+  /**
+   * \brief Returns the cached metadata of the controller in a slot.
+   *
+   * \param slot the index of the slot.
+   *
+   * \return a pointer to the metadata; a null pointer if the slot isn't in use.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto info(const size_type slot) const noexcept -> const controller_info*
+  {
+    return is_connected(slot) ? &m_info[slot] : nullptr;
+  }
+
+  /**
+   * \brief Returns a handle to the controller in a slot.
+   *
+   * \param slot the index of the slot.
+   *
+   * \return a handle to the controller, which is empty if the slot isn't in use.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get(const size_type slot) const noexcept -> controller_handle
+  {
+    return controller_handle{is_connected(slot) ? m_controllers[slot]->get() : nullptr};
+  }
+
+  /**
+   * \brief Returns the state of all managed controllers, as of the last update.
+   *
+   * \return the controller snapshot.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto snapshot() const noexcept -> const controller_snapshot&
+  {
+    return m_snapshot;
+  }
+
+  /**
+   * \brief Returns the amount of managed controllers.
+   *
+   * \return the number of slots in use.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto count() const noexcept -> size_type
+  {
+    size_type count = 0;
+
+    for (const auto connected : m_snapshot.connected) {
+      count += connected ? 1 : 0;
+    }
+
+    return count;
+  }
+
+ private:
+  std::array<std::optional<controller>, capacity> m_controllers;
+  std::array<controller_info, capacity> m_info;
+  controller_snapshot m_snapshot;
+
+  auto open(const int deviceIndex) -> std::optional<size_type>
+  {
+    const auto id = joystick::instance_id(deviceIndex);
+    if (!id || slot_of(*id)) {
+      return std::nullopt;
+    }
+
+    for (size_type slot = 0; slot < capacity; ++slot) {
+      if (m_snapshot.connected[slot]) {
+        continue;
+      }
+
+      auto* ptr = SDL_GameControllerOpen(deviceIndex);
+      if (!ptr) {
+        return std::nullopt;
+      }
+
+      m_controllers[slot].emplace(ptr);
+      m_snapshot.connected[slot] = true;
+      load_info(slot);
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+      m_controllers[slot]->set_player_index(static_cast<int>(slot));
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+      return slot;
+    }
+
+    return std::nullopt;
+  }
+
+  void load_info(const size_type slot)
+  {
+    auto& controller = *m_controllers[slot];
+    auto& info = m_info[slot];
+
+    info.id = controller.get_joystick().instance_id();
+    const auto name = controller.name();
+    info.name = name ? name : "";
+    info.vendor = controller.vendor();
+    info.product = controller.product();
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+    info.type = controller.type();
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    const auto serial = controller.serial();
+    info.serial = serial ? serial : "";
+    info.touchpadCount = controller.touchpad_count();
+    info.hasLed = controller.has_led();
+    info.hasGyroscope = controller.has_sensor(sensor_type::gyroscope);
+    info.hasAccelerometer = controller.has_sensor(sensor_type::accelerometer);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_CONTROLLER_MANAGER_HEADER
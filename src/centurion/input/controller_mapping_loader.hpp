@@ -0,0 +1,282 @@
+#ifndef CENTURION_CONTROLLER_MAPPING_LOADER_HEADER
+#define CENTURION_CONTROLLER_MAPPING_LOADER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cctype>       // tolower
+#include <cstring>      // memchr
+#include <memory>       // unique_ptr, make_unique
+#include <optional>     // optional, nullopt
+#include <string>       // string
+#include <string_view>  // string_view
+#include <utility>      // move
+
+#include "../core/integers.hpp"
+#include "../events/controller_device_event.hpp"
+#include "../events/joy_device_event.hpp"
+#include "../filesystem/file.hpp"
+#include "controller.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class controller_mapping_loader
+ *
+ * \brief Loads a game controller mapping database from memory.
+ *
+ * \details A loader parses a mapping database such as the community managed
+ * <a href="https://github.com/gabomdq/SDL_GameControllerDB">gamecontrollerdb.txt</a>,
+ * and only hands the mappings of the current platform to SDL, since mappings are
+ * comparatively expensive to add. The database can be any memory buffer, e.g. data that
+ * is embedded in the executable or a memory-mapped file, in which case no copy is made.
+ *
+ * \details Loading can be deferred until the first joystick or controller is connected,
+ * by feeding device events to the loader, which avoids the cost entirely for sessions
+ * without controllers.
+ *
+ * \code{cpp}
+ *   auto loader = cen::controller_mapping_loader::from_memory(embedded_database);
+ *
+ *   dispatcher.bind<cen::joy_device_event>().to(
+ *       [&](const cen::joy_device_event& event) { loader.feed(event); });
+ * \endcode
+ *
+ * \note SDL decides whether a joystick is a game controller when the joystick is added,
+ * so devices that only have a mapping in the deferred database are not reported with a
+ * `controller_device_event`. Use `controller::is_supported()` to check such devices
+ * after the database has been loaded.
+ *
+ * \see `basic_controller::load_mappings()`
+ * \see `basic_controller::add_mapping()`
+ *
+ * \since 6.4.0
+ */
+class controller_mapping_loader final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Creates a loader that uses a database in memory, without copying it.
+   *
+   * \param database the mapping database, which must outlive the loader.
+   *
+   * \return a loader that hasn't loaded any mappings yet.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto from_memory(const std::string_view database)
+      -> controller_mapping_loader
+  {
+    return controller_mapping_loader{nullptr, database};
+  }
+
+  /**
+   * \brief Creates a loader that uses the contents of a database file.
+   *
+   * \details The entire file is read with a single read operation.
+   *
+   * \param path the file path of the mapping database.
+   *
+   * \return a loader that hasn't loaded any mappings yet; `std::nullopt` if the file
+   * couldn't be read.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto from_file(const std::string& path)
+      -> std::optional<controller_mapping_loader>
+  {
+    file source{path, file_mode::read_existing_binary};
+    if (!source) {
+      return std::nullopt;
+    }
+
+    const auto size = source.size();
+    if (!size) {
+      return std::nullopt;
+    }
+
+    auto data = std::make_unique<char[]>(*size);
+    if (source.read_to(data.get(), *size) != *size) {
+      return std::nullopt;
+    }
+
+    const std::string_view database{data.get(), *size};
+    return controller_mapping_loader{std::move(data), database};
+  }
+
+  /**
+   * \brief Adds the mappings of the current platform to SDL, unless already done.
+   *
+   * \return the amount of mappings that were added or updated.
+   *
+   * \since 6.4.0
+   */
+  auto load() -> size_type
+  {
+    if (m_loaded) {
+      return 0;
+    }
+
+    m_loaded = true;
+
+    std::string buffer;
+    size_type count = 0;
+
+    for_each_mapping(m_database, SDL_GetPlatform(), [&](const std::string_view mapping) {
+      buffer.assign(mapping.data(), mapping.size());
+      if (controller::add_mapping(buffer.c_str()) != controller::mapping_result::error) {
+        ++count;
+      }
+    });
+
+    return count;
+  }
+
+  /**
+   * \brief Loads the database, if it hasn't been loaded yet, when a joystick is added.
+   *
+   * \param event the joystick device event.
+   *
+   * \return `true` if the database was loaded by this call; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto feed(const joy_device_event& event) -> bool
+  {
+    return load_on(event.type() == event_type::joystick_device_added);
+  }
+
+  /**
+   * \brief Loads the database, if it hasn't been loaded yet, when a controller is added.
+   *
+   * \param event the controller device event.
+   *
+   * \return `true` if the database was loaded by this call; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto feed(const controller_device_event& event) -> bool
+  {
+    return load_on(event.type() == event_type::controller_device_added);
+  }
+
+  /**
+   * \brief Indicates whether or not the database has been loaded.
+   *
+   * \return `true` if the mappings have been handed to SDL; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_loaded() const noexcept -> bool
+  {
+    return m_loaded;
+  }
+
+  /**
+   * \brief Invokes a function with each mapping of a platform in a database.
+   *
+   * \details Empty lines, comments and mappings without a platform field are skipped,
+   * which mirrors `SDL_GameControllerAddMappingsFromRW()`. Platform names are compared
+   * without regard to case.
+   *
+   * \tparam Function the type of the function object, which is called with each mapping.
+   *
+   * \param database the mapping database.
+   * \param platform the name of the platform, as returned by `SDL_GetPlatform()`.
+   * \param function the function object that will be invoked with each mapping.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  static void for_each_mapping(const std::string_view database,
+                               const std::string_view platform,
+                               Function&& function)
+  {
+    constexpr std::string_view field{"platform:"};
+
+    const auto* position = database.data();
+    const auto* end = position + database.size();
+
+    while (position < end) {
+      const auto remaining = static_cast<size_type>(end - position);
+      const auto* newline = static_cast<const char*>(std::memchr(position, '\n', remaining));
+      const auto* lineEnd = newline ? newline : end;
+
+      std::string_view line{position, static_cast<size_type>(lineEnd - position)};
+      position = newline ? newline + 1 : end;
+
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+
+      if (line.empty() || line.front() == '#') {
+        continue;
+      }
+
+      const auto start = line.find(field);
+      if (start == std::string_view::npos) {
+        continue;
+      }
+
+      const auto valueStart = start + field.size();
+      const auto valueEnd = line.find(',', valueStart);
+      if (valueEnd == std::string_view::npos) {
+        continue;
+      }
+
+      if (equals_ignore_case(line.substr(valueStart, valueEnd - valueStart), platform)) {
+        function(line);
+      }
+    }
+  }
+
+ private:
+  std::unique_ptr<char[]> m_storage;  ///< The database, if it is owned by the loader.
+  std::string_view m_database;
+  bool m_loaded{};
+
+  controller_mapping_loader(std::unique_ptr<char[]> storage,
+                            const std::string_view database) noexcept
+      : m_storage{std::move(storage)}
+      , m_database{database}
+  {}
+
+  auto load_on(const bool added) -> bool
+  {
+    if (added && !m_loaded) {
+      load();
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  [[nodiscard]] static auto equals_ignore_case(const std::string_view a,
+                                               const std::string_view b) noexcept -> bool
+  {
+    if (a.size() != b.size()) {
+      return false;
+    }
+
+    for (size_type index = 0; index < a.size(); ++index) {
+      const auto lhs = std::tolower(static_cast<unsigned char>(a[index]));
+      const auto rhs = std::tolower(static_cast<unsigned char>(b[index]));
+      if (lhs != rhs) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_CONTROLLER_MAPPING_LOADER_HEADER
@@ -18,6 +18,7 @@
 
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
 #include "../core/str.hpp"
@@ -113,8 +114,11 @@ class basic_haptic final
    * \since 5.2.0
    */
   template <typename TT = T, detail::is_owner<TT> = 0>
-  explicit basic_haptic(const int index = 0) : m_haptic{SDL_HapticOpen(index)}
+  explicit basic_haptic(const int index = 0)
   {
+    library::ensure(library_subsystem::haptic);
+
+    m_haptic.reset(SDL_HapticOpen(index));
     if (!m_haptic) {
       throw sdl_error{};
     }
@@ -0,0 +1,424 @@
+#ifndef CENTURION_HAPTIC_SCHEDULER_HEADER
+#define CENTURION_HAPTIC_SCHEDULER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // find, remove, remove_if
+#include <cstring>    // memcmp
+#include <deque>      // deque
+#include <limits>     // numeric_limits
+#include <memory>     // unique_ptr, make_unique
+#include <optional>   // optional, nullopt
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "haptic.hpp"
+#include "haptic_effect.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class haptic_scheduler
+ *
+ * \brief Uploads and plays haptic effects on a dedicated worker thread.
+ *
+ * \details Some haptic drivers block for several milliseconds when effects are uploaded,
+ * run or stopped. A haptic scheduler performs all such calls on a worker thread, so that
+ * playing an effect only enqueues a command on the calling thread.
+ *
+ * \details Effects are uploaded once with `preload()`, which returns a handle to the
+ * cached effect. Preloading an effect with the same properties as a cached effect returns
+ * the existing handle, so effects may be preloaded on demand. The amount of cached
+ * effects is limited by the effect capacity of the device. When more effects than the
+ * concurrent capacity of the device are played, the effect that was started first is
+ * stopped.
+ *
+ * \code{cpp}
+ *   cen::haptic_scheduler scheduler{cen::haptic_handle{device}};
+ *   const auto explosion = scheduler.preload(effect);
+ *
+ *   // During gameplay, doesn't block
+ *   scheduler.play(*explosion);
+ * \endcode
+ *
+ * \note The device must outlive the scheduler, and must not be used directly while the
+ * scheduler exists. All functions, except for the destructor, must be called on the same
+ * thread.
+ *
+ * \see `basic_haptic`
+ *
+ * \since 6.4.0
+ */
+class haptic_scheduler final
+{
+ public:
+  using effect_handle = usize;
+
+  /**
+   * \enum effect_status
+   *
+   * \brief Represents the different states of a preloaded effect.
+   *
+   * \since 6.4.0
+   */
+  enum class effect_status
+  {
+    unknown,  ///< The handle is unknown.
+    pending,  ///< The effect hasn't been uploaded yet.
+    ready,    ///< The effect has been uploaded.
+    failed    ///< The effect couldn't be uploaded.
+  };
+
+  /**
+   * \brief Creates a haptic scheduler and starts its worker thread.
+   *
+   * \details The effect and concurrent capacities of the device are queried once, and are
+   * treated as unlimited if the device doesn't report them.
+   *
+   * \param device the haptic device that will be used.
+   *
+   * \throws sdl_error if the worker thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit haptic_scheduler(const haptic_handle device)
+      : m_device{device}
+      , m_effectLimit{to_limit(device.effect_capacity())}
+      , m_concurrentLimit{to_limit(device.concurrent_capacity())}
+      , m_hasStatus{device.has_feature_status()}
+  {
+    m_worker = std::make_unique<thread>(&haptic_scheduler::run, "haptic_scheduler", this);
+  }
+
+  haptic_scheduler(const haptic_scheduler&) = delete;
+
+  auto operator=(const haptic_scheduler&) -> haptic_scheduler& = delete;
+
+  /**
+   * \brief Stops the worker thread, after stopping and destroying all uploaded effects.
+   *
+   * \details Commands that haven't been issued yet are discarded.
+   *
+   * \since 6.4.0
+   */
+  ~haptic_scheduler() noexcept
+  {
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.signal();
+    m_worker.reset();
+  }
+
+  /**
+   * \brief Caches an effect, and enqueues its upload to the device.
+   *
+   * \details Effects are identified by their properties, so preloading an effect that is
+   * equal to a cached effect returns the handle of the cached effect.
+   *
+   * \tparam D the type of the effect.
+   *
+   * \param effect the effect that will be cached.
+   *
+   * \return a handle to the cached effect; `std::nullopt` if the effect capacity of the
+   * device has been reached.
+   *
+   * \since 6.4.0
+   */
+  template <typename D>
+  auto preload(const haptic_effect<D>& effect) -> std::optional<effect_handle>
+  {
+    const auto& descriptor = effect.get();
+    effect_handle handle{};
+
+    {
+      scoped_lock lock{m_mutex};
+
+      for (; handle < m_effects.size(); ++handle) {
+        const auto& cached = m_effects[handle].descriptor;
+        if (std::memcmp(&cached, &descriptor, sizeof(SDL_HapticEffect)) == 0) {
+          return handle;
+        }
+      }
+
+      if (m_effects.size() >= m_effectLimit) {
+        return std::nullopt;
+      }
+
+      m_effects.push_back(cached_effect{descriptor});
+      m_commands.push_back(command{command_type::upload, handle});
+    }
+
+    m_wake.signal();
+    return handle;
+  }
+
+  /**
+   * \brief Enqueues a command that runs a preloaded effect.
+   *
+   * \details Running an effect that is already playing restarts it. Nothing happens if
+   * the effect couldn't be uploaded.
+   *
+   * \param handle the handle of the effect, obtained from `preload()`.
+   * \param iterations the number of iterations, can be `haptic_infinity`.
+   *
+   * \since 6.4.0
+   */
+  void play(const effect_handle handle, const u32 iterations = 1)
+  {
+    enqueue(command{command_type::run, handle, iterations});
+  }
+
+  /**
+   * \brief Enqueues a command that stops a preloaded effect.
+   *
+   * \param handle the handle of the effect, obtained from `preload()`.
+   *
+   * \since 6.4.0
+   */
+  void stop(const effect_handle handle)
+  {
+    enqueue(command{command_type::stop, handle});
+  }
+
+  /**
+   * \brief Enqueues a command that stops all effects.
+   *
+   * \since 6.4.0
+   */
+  void stop_all()
+  {
+    enqueue(command{command_type::stop_all});
+  }
+
+  /**
+   * \brief Blocks until all enqueued commands have been issued to the device.
+   *
+   * \since 6.4.0
+   */
+  void wait()
+  {
+    scoped_lock lock{m_mutex};
+    while (!m_commands.empty() || m_busy) {
+      m_idle.wait(m_mutex);
+    }
+  }
+
+  /**
+   * \brief Returns the status of a preloaded effect.
+   *
+   * \param handle the handle of the effect, obtained from `preload()`.
+   *
+   * \return the current status of the effect.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto status(const effect_handle handle) -> effect_status
+  {
+    scoped_lock lock{m_mutex};
+    return handle < m_effects.size() ? m_effects[handle].status : effect_status::unknown;
+  }
+
+  /**
+   * \brief Returns the amount of cached effects.
+   *
+   * \return the number of preloaded effects, including effects that failed to upload.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto effect_count() -> usize
+  {
+    scoped_lock lock{m_mutex};
+    return m_effects.size();
+  }
+
+ private:
+  enum class command_type
+  {
+    upload,
+    run,
+    stop,
+    stop_all
+  };
+
+  struct command final
+  {
+    command_type type{};
+    effect_handle handle{};
+    u32 iterations{1};
+  };
+
+  struct cached_effect final
+  {
+    SDL_HapticEffect descriptor{};
+    int id{-1};
+    effect_status status{effect_status::pending};
+  };
+
+  haptic_handle m_device;
+  usize m_effectLimit{};
+  usize m_concurrentLimit{};
+  bool m_hasStatus{};
+  std::vector<cached_effect> m_effects;
+  std::deque<command> m_commands;
+  std::vector<int> m_playing;  ///< Only accessed by the worker, in the order of starting.
+  mutex m_mutex;
+  condition m_wake;
+  condition m_idle;
+  bool m_busy{};
+  bool m_stop{};
+  std::unique_ptr<thread> m_worker;  // Last, so that the worker stops first
+
+  [[nodiscard]] static auto to_limit(const std::optional<int> capacity) noexcept -> usize
+  {
+    if (capacity && *capacity > 0) {
+      return static_cast<usize>(*capacity);
+    }
+    else {
+      return std::numeric_limits<usize>::max();
+    }
+  }
+
+  void enqueue(const command& cmd)
+  {
+    {
+      scoped_lock lock{m_mutex};
+      m_commands.push_back(cmd);
+    }
+
+    m_wake.signal();
+  }
+
+  // Only called by the worker, with the mutex unlocked
+  void start(const int id, const u32 iterations) noexcept
+  {
+    if (m_hasStatus) {
+      m_playing.erase(std::remove_if(m_playing.begin(),
+                                     m_playing.end(),
+                                     [this](const int playing) {
+                                       return !m_device.is_playing(playing);
+                                     }),
+                      m_playing.end());
+    }
+
+    if (const auto it = std::find(m_playing.begin(), m_playing.end(), id);
+        it != m_playing.end())
+    {
+      m_playing.erase(it);
+    }
+    else if (m_playing.size() >= m_concurrentLimit) {
+      m_device.stop(m_playing.front());
+      m_playing.erase(m_playing.begin());
+    }
+
+    if (m_device.run(id, iterations)) {
+      m_playing.push_back(id);
+    }
+  }
+
+  // Only called by the worker, with the mutex unlocked
+  void issue(const command& cmd, const int id) noexcept
+  {
+    switch (cmd.type) {
+      case command_type::upload:
+        break;  // Handled by the worker loop, since it produces an effect ID
+
+      case command_type::run:
+        start(id, cmd.iterations);
+        break;
+
+      case command_type::stop:
+        m_device.stop(id);
+        m_playing.erase(std::remove(m_playing.begin(), m_playing.end(), id),
+                        m_playing.end());
+        break;
+
+      case command_type::stop_all:
+        m_device.stop_all();
+        m_playing.clear();
+        break;
+    }
+  }
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<haptic_scheduler*>(data);
+
+    self.m_mutex.lock();
+
+    while (true) {
+      while (!self.m_stop && self.m_commands.empty()) {
+        self.m_wake.wait(self.m_mutex);
+      }
+
+      if (self.m_stop) {
+        break;
+      }
+
+      const auto cmd = self.m_commands.front();
+      self.m_commands.pop_front();
+      self.m_busy = true;
+
+      SDL_HapticEffect descriptor{};
+      auto id = -1;
+
+      if (cmd.handle < self.m_effects.size()) {
+        descriptor = self.m_effects[cmd.handle].descriptor;
+        id = self.m_effects[cmd.handle].id;
+      }
+
+      self.m_mutex.unlock();
+
+      auto status = effect_status::ready;
+      if (cmd.type == command_type::upload) {
+        id = SDL_HapticNewEffect(self.m_device.get(), &descriptor);
+        status = (id != -1) ? effect_status::ready : effect_status::failed;
+      }
+      else if (cmd.type == command_type::stop_all || id != -1) {
+        self.issue(cmd, id);
+      }
+
+      self.m_mutex.lock();
+
+      if (cmd.type == command_type::upload) {
+        self.m_effects[cmd.handle].id = id;
+        self.m_effects[cmd.handle].status = status;
+      }
+
+      self.m_busy = false;
+      self.m_idle.broadcast();
+    }
+
+    std::vector<int> ids;
+    for (const auto& effect : self.m_effects) {
+      if (effect.id != -1) {
+        ids.push_back(effect.id);
+      }
+    }
+
+    self.m_mutex.unlock();
+
+    if (!ids.empty()) {
+      self.m_device.stop_all();
+      for (const auto id : ids) {
+        self.m_device.destroy(id);
+      }
+    }
+
+    return 0;
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_HAPTIC_SCHEDULER_HEADER
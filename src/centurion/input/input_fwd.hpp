@@ -0,0 +1,54 @@
+#ifndef CENTURION_INPUT_FWD_HEADER
+#define CENTURION_INPUT_FWD_HEADER
+
+#include "../detail/ownership_tags.hpp"
+
+/**
+ * \file input_fwd.hpp
+ *
+ * \brief Provides forward declarations of the input components.
+ *
+ * \details Include this header instead of the full headers in headers that only refer
+ * to these types by reference or pointer.
+ */
+
+namespace cen {
+
+class action_map;
+class controller_manager;
+class key_code;
+class key_set;
+class keyboard;
+class keyboard_tracker;
+class mouse;
+class mouse_tracker;
+class scan_code;
+class touch_tracker;
+
+template <typename T>
+class basic_controller;
+
+template <typename T>
+class basic_joystick;
+
+template <typename T>
+class basic_haptic;
+
+template <typename T>
+class basic_sensor;
+
+using controller = basic_controller<detail::owning_type>;
+using controller_handle = basic_controller<detail::handle_type>;
+
+using joystick = basic_joystick<detail::owning_type>;
+using joystick_handle = basic_joystick<detail::handle_type>;
+
+using haptic = basic_haptic<detail::owning_type>;
+using haptic_handle = basic_haptic<detail::handle_type>;
+
+using sensor = basic_sensor<detail::owning_type>;
+using sensor_handle = basic_sensor<detail::handle_type>;
+
+}  // namespace cen
+
+#endif  // CENTURION_INPUT_FWD_HEADER
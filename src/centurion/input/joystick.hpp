@@ -3,6 +3,7 @@
 
 #include <SDL2/SDL.h>
 
+#include <array>     // array
 #include <cassert>   // assert
 #include <optional>  // optional
 #include <ostream>   // ostream
@@ -18,6 +19,7 @@
 
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
@@ -26,6 +28,7 @@
 #include "../core/time.hpp"
 #include "../core/to_underlying.hpp"
 #include "../detail/address_of.hpp"
+#include "../detail/clamp.hpp"
 #include "../detail/owner_handle_api.hpp"
 #include "../detail/sdl_version_at_least.hpp"
 #include "../video/color.hpp"
@@ -52,6 +55,49 @@ struct ball_axis_change final
   int dy;  ///< Difference in y-axis position since last poll.
 };
 
+/**
+ * \struct joystick_state
+ *
+ * \brief Represents the state of all axes, buttons, hats and balls of a joystick.
+ *
+ * \details Joystick states are obtained with `basic_joystick::snapshot()`, which reads
+ * the entire state while holding the joystick lock once. Joysticks with more inputs than
+ * can be stored in a joystick state have the remaining inputs ignored.
+ *
+ * \since 6.4.0
+ */
+struct joystick_state final
+{
+  inline constexpr static int max_axes = 16;
+  inline constexpr static int max_buttons = 64;
+  inline constexpr static int max_hats = 4;
+  inline constexpr static int max_balls = 4;
+
+  std::array<i16, max_axes> axes{};                 ///< The axis positions.
+  std::array<hat_state, max_hats> hats{};           ///< The hat states.
+  std::array<ball_axis_change, max_balls> balls{};  ///< The ball changes since the last poll.
+  u64 buttons{};                                    ///< The pressed buttons, one bit each.
+  int axisCount{};                                  ///< The amount of stored axes.
+  int buttonCount{};                                ///< The amount of stored buttons.
+  int hatCount{};                                   ///< The amount of stored hats.
+  int ballCount{};                                  ///< The amount of stored balls.
+
+  /**
+   * \brief Indicates whether or not a button is pressed.
+   *
+   * \param button the index of the button.
+   *
+   * \return `true` if the button is pressed; `false` otherwise, or if the button is out
+   * of bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pressed(const int button) const noexcept -> bool
+  {
+    return button >= 0 && button < buttonCount && (buttons & (u64{1} << button)) != 0;
+  }
+};
+
 template <typename T>
 class basic_joystick;
 
@@ -129,8 +175,11 @@ class basic_joystick final
    * \throws sdl_error if the joystick couldn't be opened.
    */
   template <typename TT = T, detail::is_owner<TT> = 0>
-  explicit basic_joystick(const int index = 0) : m_joystick{SDL_JoystickOpen(index)}
+  explicit basic_joystick(const int index = 0)
   {
+    library::ensure(library_subsystem::joystick);
+
+    m_joystick.reset(SDL_JoystickOpen(index));
     if (!m_joystick) {
       throw sdl_error{};
     }
@@ -892,6 +941,55 @@ class basic_joystick final
     return static_cast<hat_state>(SDL_JoystickGetHat(m_joystick, hat));
   }
 
+  /**
+   * \brief Returns the state of all axes, buttons, hats and balls of the joystick.
+   *
+   * \details The joystick lock is held while the state is read, which makes this
+   * cheaper than querying each input individually, and ensures that the state isn't
+   * updated by another thread in the middle of the snapshot.
+   *
+   * \note The ball changes are relative to the last time the balls were queried.
+   *
+   * \return the current joystick state.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto snapshot() const noexcept -> joystick_state
+  {
+    joystick_state state;
+
+    lock();
+
+    state.axisCount = detail::clamp(axis_count(), 0, joystick_state::max_axes);
+    state.buttonCount = detail::clamp(button_count(), 0, joystick_state::max_buttons);
+    state.hatCount = detail::clamp(hat_count(), 0, joystick_state::max_hats);
+    state.ballCount = detail::clamp(trackball_count(), 0, joystick_state::max_balls);
+
+    for (auto axis = 0; axis < state.axisCount; ++axis) {
+      state.axes[static_cast<usize>(axis)] = SDL_JoystickGetAxis(m_joystick, axis);
+    }
+
+    for (auto button = 0; button < state.buttonCount; ++button) {
+      if (SDL_JoystickGetButton(m_joystick, button) == SDL_PRESSED) {
+        state.buttons |= u64{1} << button;
+      }
+    }
+
+    for (auto hat = 0; hat < state.hatCount; ++hat) {
+      state.hats[static_cast<usize>(hat)] =
+          static_cast<hat_state>(SDL_JoystickGetHat(m_joystick, hat));
+    }
+
+    for (auto ball = 0; ball < state.ballCount; ++ball) {
+      auto& change = state.balls[static_cast<usize>(ball)];
+      SDL_JoystickGetBall(m_joystick, ball, &change.dx, &change.dy);
+    }
+
+    unlock();
+
+    return state;
+  }
+
   /**
    * \brief Updates the state of all open joysticks.
    *
@@ -3,9 +3,10 @@
 
 #include <SDL2/SDL.h>
 
-#include <cassert>  // assert
-#include <ostream>  // ostream
-#include <string>   // string
+#include <cassert>      // assert
+#include <ostream>      // ostream
+#include <string>       // string
+#include <string_view>  // string_view
 
 #include "../compiler/features.hpp"
 
@@ -18,6 +19,7 @@
 #include "../core/not_null.hpp"
 #include "../core/str.hpp"
 #include "../core/version.hpp"
+#include "../detail/key_names.hpp"
 
 namespace cen {
 
@@ -103,11 +105,11 @@ class key_code final
    * \param name the name of the key, mustn't be null.
    *
    * \see `SDL_GetKeyFromName`
+   * \see `from_name()`
    *
    * \since 5.0.0
    */
-  explicit key_code(const not_null<str> name) noexcept
-      : m_key{static_cast<SDL_KeyCode>(SDL_GetKeyFromName(name))}
+  explicit key_code(const not_null<str> name) noexcept : m_key{lookup(name)}
   {}
 
   /**
@@ -123,6 +125,38 @@ class key_code final
   explicit key_code(const std::string& name) noexcept : key_code{name.c_str()}
   {}
 
+  /**
+   * \brief Returns the key code of one of the constants in `cen::keycodes`, based on its
+   * name.
+   *
+   * \details The names are the same as those used by SDL, e.g. `"Space"` or `"Left Shift"`,
+   * and are compared case-insensitively. This function finds a name with a perfect hash that
+   * is computed at compile-time, so it can be used for hard-coded bindings in constant
+   * expressions, and only performs a single string comparison at runtime. Names that don't
+   * belong to a constant in `cen::keycodes` aren't recognized, use the constructor that
+   * accepts a string to look those up through SDL.
+   * \code{cpp}
+   *   constexpr auto jump = cen::key_code::from_name("Space");
+   *   static_assert(jump == cen::keycodes::space);
+   * \endcode
+   *
+   * \param name the name of the key.
+   *
+   * \return the associated key code; `SDLK_UNKNOWN` if the name isn't recognized.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto from_name(const std::string_view name) noexcept
+      -> key_code
+  {
+    if (const auto* key = detail::key_code_names.find(name)) {
+      return *key;
+    }
+    else {
+      return SDLK_UNKNOWN;
+    }
+  }
+
   /// \} End of construction
 
   /// \name Assignment operators
@@ -179,7 +213,7 @@ class key_code final
   auto operator=(const not_null<str> name) noexcept -> key_code&
   {
     assert(name);
-    m_key = static_cast<SDL_KeyCode>(SDL_GetKeyFromName(name));
+    m_key = lookup(name);
     return *this;
   }
 
@@ -226,7 +260,12 @@ class key_code final
    */
   [[nodiscard]] auto name() const -> std::string
   {
-    return SDL_GetKeyName(m_key);
+    if (const auto name = detail::key_code_names.name_of(m_key); !name.empty()) {
+      return std::string{name};
+    }
+    else {
+      return SDL_GetKeyName(m_key);
+    }
   }
 
   /**
@@ -322,6 +361,12 @@ class key_code final
 
  private:
   SDL_KeyCode m_key{SDLK_UNKNOWN};
+
+  [[nodiscard]] static auto lookup(const str name) noexcept -> SDL_KeyCode
+  {
+    const auto key = from_name(name);
+    return key.unknown() ? static_cast<SDL_KeyCode>(SDL_GetKeyFromName(name)) : key.get();
+  }
 };
 
 /// \name String conversions
@@ -7,6 +7,7 @@
 #include <sstream>  // stringstream
 #include <string>   // string
 
+#include "../compiler/linkage.hpp"
 #include "../core/integers.hpp"
 #include "../core/str.hpp"
 #include "../core/to_underlying.hpp"
@@ -170,7 +171,12 @@ inline void set_modifiers(const key_mod mods) noexcept
  *
  * \since 6.2.0
  */
-[[nodiscard]] inline auto to_string(const key_mod mods) -> std::string
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto to_string(const key_mod mods)
+    -> std::string;
+
+#if CENTURION_LIB_DEFINITIONS
+
+CENTURION_LIB_INLINE auto to_string(const key_mod mods) -> std::string
 {
   if (mods == key_mod::none) {
     return "none";
@@ -209,6 +215,8 @@ inline void set_modifiers(const key_mod mods) noexcept
   return stream.str();
 }
 
+#endif  // CENTURION_LIB_DEFINITIONS
+
 /// \} End of string conversions
 
 /// \name Streaming
@@ -0,0 +1,410 @@
+#ifndef CENTURION_KEY_SET_HEADER
+#define CENTURION_KEY_SET_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_SSE2
+#include <emmintrin.h>
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+#include <array>     // array
+#include <cassert>   // assert
+#include <cstddef>   // ptrdiff_t
+#include <iterator>  // forward_iterator_tag
+
+#include "../core/integers.hpp"
+#include "scan_code.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/// \cond FALSE
+
+namespace detail {
+
+[[nodiscard]] inline auto lowest_bit_index(const u64 word) noexcept -> int
+{
+  assert(word != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int index = 0;
+  while (!(word & (u64{1} << index))) {
+    ++index;
+  }
+
+  return index;
+#endif  // defined(__GNUC__) || defined(__clang__)
+}
+
+[[nodiscard]] inline auto bit_count(u64 word) noexcept -> int
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(word);
+#else
+  int count = 0;
+  while (word) {
+    word &= word - 1;
+    ++count;
+  }
+
+  return count;
+#endif  // defined(__GNUC__) || defined(__clang__)
+}
+
+}  // namespace detail
+
+/// \endcond
+
+/**
+ * \class key_set
+ *
+ * \brief A compact set of scan codes, where each key is represented by a single bit.
+ *
+ * \details Key sets are used by `keyboard` to represent the state of all keys in 64
+ * bytes, which makes it possible to compute the set of e.g. all keys that were just
+ * pressed with a few word-wide bitwise operations, instead of checking each key
+ * individually.
+ *
+ * \details Iterating a key set yields the contained scan codes in ascending order, and
+ * the cost of iteration is proportional to the amount of contained keys.
+ *
+ * \see `keyboard::just_pressed_keys()`
+ * \see `keyboard::just_released_keys()`
+ *
+ * \since 6.4.0
+ */
+class key_set final
+{
+ public:
+  using size_type = usize;
+
+  inline constexpr static int capacity = scan_code::count();
+  inline constexpr static usize word_count = (static_cast<usize>(capacity) + 63) / 64;
+
+  /**
+   * \class iterator
+   *
+   * \brief Iterates the scan codes in a key set.
+   *
+   * \since 6.4.0
+   */
+  class iterator final
+  {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = scan_code;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const scan_code*;
+    using reference = scan_code;
+
+    iterator() noexcept = default;
+
+    [[nodiscard]] auto operator*() const noexcept -> scan_code
+    {
+      const auto index = m_word * 64 + static_cast<usize>(detail::lowest_bit_index(m_bits));
+      return static_cast<SDL_Scancode>(index);
+    }
+
+    auto operator++() noexcept -> iterator&
+    {
+      m_bits &= m_bits - 1;
+      skip_empty_words();
+      return *this;
+    }
+
+    auto operator++(int) noexcept -> iterator
+    {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    [[nodiscard]] auto operator==(const iterator& other) const noexcept -> bool
+    {
+      return m_word == other.m_word && m_bits == other.m_bits;
+    }
+
+    [[nodiscard]] auto operator!=(const iterator& other) const noexcept -> bool
+    {
+      return !(*this == other);
+    }
+
+   private:
+    friend class key_set;
+
+    const key_set* m_set{};
+    usize m_word{word_count};
+    u64 m_bits{};
+
+    iterator(const key_set* set, const usize word) noexcept
+        : m_set{set}
+        , m_word{word}
+        , m_bits{word < word_count ? set->m_words[word] : 0}
+    {
+      skip_empty_words();
+    }
+
+    void skip_empty_words() noexcept
+    {
+      while (m_bits == 0 && m_word < word_count) {
+        ++m_word;
+        m_bits = m_word < word_count ? m_set->m_words[m_word] : 0;
+      }
+    }
+  };
+
+  /**
+   * \brief Creates an empty key set.
+   *
+   * \since 6.4.0
+   */
+  constexpr key_set() noexcept = default;
+
+  /**
+   * \brief Creates a key set from an array of key states.
+   *
+   * \details Keys with non-zero states are included in the set. This is typically used
+   * with the array returned by `SDL_GetKeyboardState()`, and uses SSE2 to test 16 keys at
+   * a time when available.
+   *
+   * \param states the key states, indexed by scan code.
+   * \param count the amount of key states, values above `capacity` are ignored.
+   *
+   * \return a set of the keys with non-zero states.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto from_states(const u8* states, int count) noexcept -> key_set
+  {
+    assert(states || count <= 0);
+
+    if (count > capacity) {
+      count = capacity;
+    }
+
+    key_set result;
+    int index = 0;
+
+#if CENTURION_HAS_FEATURE_SSE2
+    const auto zero = _mm_setzero_si128();
+    for (; index + 16 <= count; index += 16) {
+      const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(states + index));
+      const auto empty = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero));
+      const auto mask = static_cast<u64>(~empty & 0xFFFF);
+
+      result.m_words[static_cast<usize>(index / 64)] |= mask << (index % 64);
+    }
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+    for (; index < count; ++index) {
+      if (states[index]) {
+        result.m_words[static_cast<usize>(index / 64)] |= u64{1} << (index % 64);
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Adds a key to the set.
+   *
+   * \param code the key that will be added, must be a valid scan code.
+   *
+   * \since 6.4.0
+   */
+  void insert(const scan_code& code) noexcept
+  {
+    assert(code.get() >= 0 && code.get() < capacity);
+    m_words[word_of(code)] |= bit_of(code);
+  }
+
+  /**
+   * \brief Removes a key from the set.
+   *
+   * \param code the key that will be removed, must be a valid scan code.
+   *
+   * \since 6.4.0
+   */
+  void erase(const scan_code& code) noexcept
+  {
+    assert(code.get() >= 0 && code.get() < capacity);
+    m_words[word_of(code)] &= ~bit_of(code);
+  }
+
+  /**
+   * \brief Removes all keys from the set.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_words = {};
+  }
+
+  /**
+   * \brief Indicates whether or not the set contains a key.
+   *
+   * \param code the key that will be checked.
+   *
+   * \return `true` if the key is in the set; `false` otherwise, or if the scan code is
+   * invalid.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto contains(const scan_code& code) const noexcept -> bool
+  {
+    const auto sc = code.get();
+    return sc >= 0 && sc < capacity && (m_words[word_of(code)] & bit_of(code)) != 0;
+  }
+
+  /**
+   * \brief Returns the amount of keys in the set.
+   *
+   * \return the number of contained keys.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    size_type count = 0;
+
+    for (const auto word : m_words) {
+      count += static_cast<size_type>(detail::bit_count(word));
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Indicates whether or not the set is empty.
+   *
+   * \return `true` if there are no keys in the set; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    u64 any = 0;
+
+    for (const auto word : m_words) {
+      any |= word;
+    }
+
+    return any == 0;
+  }
+
+  [[nodiscard]] auto begin() const noexcept -> iterator
+  {
+    return iterator{this, 0};
+  }
+
+  [[nodiscard]] auto end() const noexcept -> iterator
+  {
+    return iterator{this, word_count};
+  }
+
+  /**
+   * \brief Returns the keys that are in both sets.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] friend auto operator&(const key_set& lhs, const key_set& rhs) noexcept
+      -> key_set
+  {
+    key_set result;
+
+    for (usize index = 0; index < word_count; ++index) {
+      result.m_words[index] = lhs.m_words[index] & rhs.m_words[index];
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the keys that are in either set.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] friend auto operator|(const key_set& lhs, const key_set& rhs) noexcept
+      -> key_set
+  {
+    key_set result;
+
+    for (usize index = 0; index < word_count; ++index) {
+      result.m_words[index] = lhs.m_words[index] | rhs.m_words[index];
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the keys that are in exactly one of the sets.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] friend auto operator^(const key_set& lhs, const key_set& rhs) noexcept
+      -> key_set
+  {
+    key_set result;
+
+    for (usize index = 0; index < word_count; ++index) {
+      result.m_words[index] = lhs.m_words[index] ^ rhs.m_words[index];
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the keys in the first set that aren't in the second set.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] friend auto operator-(const key_set& lhs, const key_set& rhs) noexcept
+      -> key_set
+  {
+    key_set result;
+
+    for (usize index = 0; index < word_count; ++index) {
+      result.m_words[index] = lhs.m_words[index] & ~rhs.m_words[index];
+    }
+
+    return result;
+  }
+
+  [[nodiscard]] friend auto operator==(const key_set& lhs, const key_set& rhs) noexcept
+      -> bool
+  {
+    return lhs.m_words == rhs.m_words;
+  }
+
+  [[nodiscard]] friend auto operator!=(const key_set& lhs, const key_set& rhs) noexcept
+      -> bool
+  {
+    return !(lhs == rhs);
+  }
+
+ private:
+  std::array<u64, word_count> m_words{};
+
+  [[nodiscard]] static auto word_of(const scan_code& code) noexcept -> usize
+  {
+    return static_cast<usize>(code.get()) / 64;
+  }
+
+  [[nodiscard]] static auto bit_of(const scan_code& code) noexcept -> u64
+  {
+    return u64{1} << (static_cast<usize>(code.get()) % 64);
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_KEY_SET_HEADER
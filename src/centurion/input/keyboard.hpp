@@ -3,10 +3,8 @@
 
 #include <SDL2/SDL.h>
 
-#include <algorithm>  // copy
-#include <array>      // array
-#include <ostream>    // ostream
-#include <string>     // string, to_string
+#include <ostream>  // ostream
+#include <string>   // string, to_string
 
 #include "../compiler/features.hpp"
 
@@ -20,6 +18,7 @@
 #include "../core/integers.hpp"
 #include "key_code.hpp"
 #include "key_modifier.hpp"
+#include "key_set.hpp"
 #include "scan_code.hpp"
 
 namespace cen {
@@ -62,7 +61,7 @@ class keyboard final
    */
   void update()
   {
-    std::copy(m_states, m_states + m_nKeys, m_previous.begin());
+    m_previous = key_set::from_states(m_states, m_nKeys);
   }
 
   /**
@@ -114,7 +113,7 @@ class keyboard final
   [[nodiscard]] auto is_held(const scan_code& code) const noexcept(on_msvc()) -> bool
   {
     return check_state(code, [this](const SDL_Scancode sc) noexcept(on_msvc()) {
-      return m_states[sc] && m_previous[sc];
+      return m_states[sc] && m_previous.contains(sc);
     });
   }
 
@@ -152,7 +151,7 @@ class keyboard final
   [[nodiscard]] auto just_pressed(const scan_code& code) const noexcept(on_msvc()) -> bool
   {
     return check_state(code, [this](const SDL_Scancode sc) noexcept(on_msvc()) {
-      return m_states[sc] && !m_previous[sc];
+      return m_states[sc] && !m_previous.contains(sc);
     });
   }
 
@@ -190,7 +189,7 @@ class keyboard final
   [[nodiscard]] auto just_released(const scan_code& code) const noexcept(on_msvc()) -> bool
   {
     return check_state(code, [this](const SDL_Scancode sc) noexcept(on_msvc()) {
-      return !m_states[sc] && m_previous[sc];
+      return !m_states[sc] && m_previous.contains(sc);
     });
   }
 
@@ -279,6 +278,70 @@ class keyboard final
     return detail::is_only_any_of_active(modifiers, static_cast<u16>(SDL_GetModState()));
   }
 
+  /**
+   * \brief Returns the set of all currently pressed keys.
+   *
+   * \return the currently pressed keys.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pressed_keys() const noexcept -> key_set
+  {
+    return key_set::from_states(m_states, m_nKeys);
+  }
+
+  /**
+   * \brief Returns the set of all keys that were pressed at the time of the last update.
+   *
+   * \return the keys that were pressed when `update()` was last called.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto previous_keys() const noexcept -> const key_set&
+  {
+    return m_previous;
+  }
+
+  /**
+   * \brief Returns the set of all keys that have been pressed since the last update.
+   *
+   * \details This is equivalent to calling `just_pressed()` for every key, but only
+   * requires a few bitwise operations on the packed key states. Iterate the returned set
+   * to handle each newly pressed key.
+   *
+   * \return the keys that are pressed now, but weren't pressed at the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_pressed_keys() const noexcept -> key_set
+  {
+    return pressed_keys() - m_previous;
+  }
+
+  /**
+   * \brief Returns the set of all keys that have been released since the last update.
+   *
+   * \return the keys that were pressed at the last update, but aren't pressed now.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_released_keys() const noexcept -> key_set
+  {
+    return m_previous - pressed_keys();
+  }
+
+  /**
+   * \brief Returns the set of all keys whose state has changed since the last update.
+   *
+   * \return the keys that have been pressed or released since the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto changed_keys() const noexcept -> key_set
+  {
+    return pressed_keys() ^ m_previous;
+  }
+
   /**
    * \brief Returns the total amount of keys.
    *
@@ -293,7 +356,7 @@ class keyboard final
 
  private:
   const u8* m_states{};
-  std::array<u8, cen::scan_code::count()> m_previous{};
+  key_set m_previous;
   int m_nKeys{};
 
   template <typename Predicate>
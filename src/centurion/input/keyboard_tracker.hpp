@@ -0,0 +1,230 @@
+#ifndef CENTURION_KEYBOARD_TRACKER_HEADER
+#define CENTURION_KEYBOARD_TRACKER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../events/keyboard_event.hpp"
+#include "key_code.hpp"
+#include "key_set.hpp"
+#include "scan_code.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class keyboard_tracker
+ *
+ * \brief Keeps track of the keyboard state using keyboard events.
+ *
+ * \details Unlike `keyboard`, which compares snapshots of the keyboard state taken once
+ * per frame, a keyboard tracker is fed the keyboard events of the frame, e.g. from an
+ * event dispatcher. As a result, keys that are pressed and released again during a
+ * single frame are still reported as pressed, and no SDL functions are called to obtain
+ * the keyboard state.
+ *
+ * \details A typical frame looks like this.
+ * \code{cpp}
+ *   tracker.update();
+ *   dispatcher.bind<cen::keyboard_event>().to(
+ *       [&](const cen::keyboard_event& event) { tracker.feed(event); });
+ *   dispatcher.poll();
+ *
+ *   if (tracker.was_pressed(cen::scancodes::space)) {
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note Repeated key events are ignored.
+ *
+ * \see `keyboard`
+ * \see `mouse_tracker`
+ *
+ * \since 6.4.0
+ */
+class keyboard_tracker final
+{
+ public:
+  /**
+   * \brief Creates a keyboard tracker without any pressed keys.
+   *
+   * \since 6.4.0
+   */
+  keyboard_tracker() noexcept = default;
+
+  /**
+   * \brief Starts a new frame, by forgetting the keys pressed and released so far.
+   *
+   * \details This should be called once per frame, before feeding the events of the
+   * frame. The set of keys that are held down is not affected.
+   *
+   * \since 6.4.0
+   */
+  void update() noexcept
+  {
+    m_pressed.clear();
+    m_released.clear();
+  }
+
+  /**
+   * \brief Updates the tracked state with a keyboard event.
+   *
+   * \param event the keyboard event, repeated events and invalid scan codes are ignored.
+   *
+   * \since 6.4.0
+   */
+  void feed(const keyboard_event& event) noexcept
+  {
+    const auto code = event.scan();
+    const auto sc = code.get();
+
+    if (event.repeated() || sc < 0 || sc >= key_set::capacity) {
+      return;
+    }
+
+    if (event.pressed()) {
+      m_down.insert(code);
+      m_pressed.insert(code);
+    }
+    else {
+      m_down.erase(code);
+      m_released.insert(code);
+    }
+  }
+
+  /**
+   * \brief Forgets all tracked keys, e.g. when the window loses keyboard focus.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_down.clear();
+    m_pressed.clear();
+    m_released.clear();
+  }
+
+  /**
+   * \brief Indicates whether or not a key is currently held down.
+   *
+   * \param code the scan code that will be checked.
+   *
+   * \return `true` if the key is held down; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pressed(const scan_code& code) const noexcept -> bool
+  {
+    return m_down.contains(code);
+  }
+
+  /**
+   * \copydoc is_pressed(const scan_code&)
+   *
+   * \note This function is slightly slower that the `scan_code` version.
+   */
+  [[nodiscard]] auto is_pressed(const key_code& code) const noexcept -> bool
+  {
+    return is_pressed(code.to_scan_code());
+  }
+
+  /**
+   * \brief Indicates whether or not a key was pressed during the current frame.
+   *
+   * \details This is also `true` for keys that were released again in the same frame.
+   *
+   * \param code the scan code that will be checked.
+   *
+   * \return `true` if the key was pressed since the last update; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto was_pressed(const scan_code& code) const noexcept -> bool
+  {
+    return m_pressed.contains(code);
+  }
+
+  /**
+   * \copydoc was_pressed(const scan_code&)
+   *
+   * \note This function is slightly slower that the `scan_code` version.
+   */
+  [[nodiscard]] auto was_pressed(const key_code& code) const noexcept -> bool
+  {
+    return was_pressed(code.to_scan_code());
+  }
+
+  /**
+   * \brief Indicates whether or not a key was released during the current frame.
+   *
+   * \details This is also `true` for keys that were pressed again in the same frame.
+   *
+   * \param code the scan code that will be checked.
+   *
+   * \return `true` if the key was released since the last update; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto was_released(const scan_code& code) const noexcept -> bool
+  {
+    return m_released.contains(code);
+  }
+
+  /**
+   * \copydoc was_released(const scan_code&)
+   *
+   * \note This function is slightly slower that the `scan_code` version.
+   */
+  [[nodiscard]] auto was_released(const key_code& code) const noexcept -> bool
+  {
+    return was_released(code.to_scan_code());
+  }
+
+  /**
+   * \brief Returns the keys that are currently held down.
+   *
+   * \return the held keys.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pressed_keys() const noexcept -> const key_set&
+  {
+    return m_down;
+  }
+
+  /**
+   * \brief Returns the keys that were pressed during the current frame.
+   *
+   * \return the keys pressed since the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_pressed_keys() const noexcept -> const key_set&
+  {
+    return m_pressed;
+  }
+
+  /**
+   * \brief Returns the keys that were released during the current frame.
+   *
+   * \return the keys released since the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto just_released_keys() const noexcept -> const key_set&
+  {
+    return m_released;
+  }
+
+ private:
+  key_set m_down;
+  key_set m_pressed;
+  key_set m_released;
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_KEYBOARD_TRACKER_HEADER
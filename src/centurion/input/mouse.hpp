@@ -16,6 +16,7 @@
 #include "../detail/max.hpp"
 #include "../math/area.hpp"
 #include "../math/point.hpp"
+#include "mouse_button.hpp"
 
 namespace cen {
 
@@ -60,6 +61,7 @@ class mouse final
 
     {
       const u32 mask = SDL_GetMouseState(&m_mouseX, &m_mouseY);
+      m_buttons = mask;
       m_leftPressed = mask & SDL_BUTTON(SDL_BUTTON_LEFT);
       m_rightPressed = mask & SDL_BUTTON(SDL_BUTTON_RIGHT);
     }
@@ -276,6 +278,20 @@ class mouse final
     return m_rightPressed;
   }
 
+  /**
+   * \brief Indicates whether or not a mouse button is currently pressed.
+   *
+   * \param button the mouse button that will be checked.
+   *
+   * \return `true` if the mouse button is pressed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pressed(const mouse_button button) const noexcept -> bool
+  {
+    return m_buttons & SDL_BUTTON(static_cast<u32>(button));
+  }
+
  private:
   int m_mouseX{};
   int m_mouseY{};
@@ -283,6 +299,7 @@ class mouse final
   int m_oldY{};
   int m_logicalWidth{1};
   int m_logicalHeight{1};
+  u32 m_buttons{};
   bool m_leftPressed{};
   bool m_rightPressed{};
   bool m_prevLeftPressed{};
@@ -0,0 +1,249 @@
+#ifndef CENTURION_MOUSE_TRACKER_HEADER
+#define CENTURION_MOUSE_TRACKER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../core/integers.hpp"
+#include "../detail/max.hpp"
+#include "../events/mouse_button_event.hpp"
+#include "../events/mouse_motion_event.hpp"
+#include "../events/mouse_wheel_event.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "mouse_button.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class mouse_tracker
+ *
+ * \brief Keeps track of the mouse state using mouse events.
+ *
+ * \details Unlike `mouse`, which takes a snapshot of the mouse state once per frame, a
+ * mouse tracker is fed the mouse events of the frame, e.g. from an event dispatcher. As
+ * a result, clicks that are shorter than a frame are still reported, the relative motion
+ * of all motion events in the frame is accumulated, and no SDL functions are called to
+ * obtain the mouse state.
+ *
+ * \details The tracked position is in window coordinates. Use `logical_position()` to
+ * convert it to a logical size, which is only computed when requested.
+ *
+ * \see `mouse`
+ * \see `keyboard_tracker`
+ *
+ * \since 6.4.0
+ */
+class mouse_tracker final
+{
+ public:
+  /**
+   * \brief Creates a mouse tracker without any pressed buttons.
+   *
+   * \since 6.4.0
+   */
+  mouse_tracker() noexcept = default;
+
+  /**
+   * \brief Starts a new frame, by forgetting the per-frame clicks, motion and scrolling.
+   *
+   * \details This should be called once per frame, before feeding the events of the
+   * frame. The position and the held buttons are not affected.
+   *
+   * \since 6.4.0
+   */
+  void update() noexcept
+  {
+    m_pressed = 0;
+    m_released = 0;
+    m_motion = {};
+    m_wheel = {};
+  }
+
+  /**
+   * \brief Updates the tracked state with a mouse button event.
+   *
+   * \param event the mouse button event.
+   *
+   * \since 6.4.0
+   */
+  void feed(const mouse_button_event& event) noexcept
+  {
+    const auto mask = button_mask(event.button());
+
+    if (event.pressed()) {
+      m_buttons |= mask;
+      m_pressed |= mask;
+    }
+    else {
+      m_buttons &= ~mask;
+      m_released |= mask;
+    }
+
+    m_position = {event.x(), event.y()};
+  }
+
+  /**
+   * \brief Updates the tracked state with a mouse motion event.
+   *
+   * \param event the mouse motion event, its relative motion is accumulated.
+   *
+   * \since 6.4.0
+   */
+  void feed(const mouse_motion_event& event) noexcept
+  {
+    m_position = {event.x(), event.y()};
+    m_motion = m_motion + ipoint{event.dx(), event.dy()};
+  }
+
+  /**
+   * \brief Updates the tracked state with a mouse wheel event.
+   *
+   * \param event the mouse wheel event, its scroll amounts are accumulated.
+   *
+   * \since 6.4.0
+   */
+  void feed(const mouse_wheel_event& event) noexcept
+  {
+    m_wheel = m_wheel + ipoint{event.x_scroll(), event.y_scroll()};
+  }
+
+  /**
+   * \brief Indicates whether or not a mouse button is currently held down.
+   *
+   * \param button the mouse button that will be checked.
+   *
+   * \return `true` if the button is held down; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pressed(const mouse_button button) const noexcept -> bool
+  {
+    return m_buttons & button_mask(button);
+  }
+
+  /**
+   * \brief Indicates whether or not a mouse button was pressed during the current frame.
+   *
+   * \details This is also `true` for buttons that were released again in the same frame.
+   *
+   * \param button the mouse button that will be checked.
+   *
+   * \return `true` if the button was pressed since the last update; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto was_pressed(const mouse_button button) const noexcept -> bool
+  {
+    return m_pressed & button_mask(button);
+  }
+
+  /**
+   * \brief Indicates whether or not a mouse button was released during the current frame.
+   *
+   * \details This is also `true` for buttons that were pressed again in the same frame.
+   *
+   * \param button the mouse button that will be checked.
+   *
+   * \return `true` if the button was released since the last update; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto was_released(const mouse_button button) const noexcept -> bool
+  {
+    return m_released & button_mask(button);
+  }
+
+  /**
+   * \brief Indicates whether or not the mouse was moved during the current frame.
+   *
+   * \return `true` if the accumulated motion is non-zero; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto was_moved() const noexcept -> bool
+  {
+    return m_motion != ipoint{};
+  }
+
+  /**
+   * \brief Returns the last reported position of the mouse, in window coordinates.
+   *
+   * \return the current position of the mouse cursor.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto position() const noexcept -> ipoint
+  {
+    return m_position;
+  }
+
+  /**
+   * \brief Returns the position of the mouse, scaled to a logical size.
+   *
+   * \details The window and logical sizes are adjusted to be at least 1.
+   *
+   * \param windowSize the current size of the window.
+   * \param logicalSize the logical size to which the position is scaled.
+   *
+   * \return the position of the mouse cursor, in logical coordinates.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto logical_position(const iarea windowSize,
+                                      const iarea logicalSize) const noexcept -> ipoint
+  {
+    const auto scale = [](const int value, const int from, const int to) noexcept {
+      const auto ratio = static_cast<float>(value) / static_cast<float>(detail::max(from, 1));
+      return static_cast<int>(ratio * static_cast<float>(detail::max(to, 1)));
+    };
+
+    return {scale(m_position.x(), windowSize.width, logicalSize.width),
+            scale(m_position.y(), windowSize.height, logicalSize.height)};
+  }
+
+  /**
+   * \brief Returns the relative motion accumulated during the current frame.
+   *
+   * \return the sum of the relative motion of all motion events since the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto motion() const noexcept -> ipoint
+  {
+    return m_motion;
+  }
+
+  /**
+   * \brief Returns the scrolling accumulated during the current frame.
+   *
+   * \return the sum of the scroll amounts of all wheel events since the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto wheel() const noexcept -> ipoint
+  {
+    return m_wheel;
+  }
+
+ private:
+  ipoint m_position;
+  ipoint m_motion;
+  ipoint m_wheel;
+  u32 m_buttons{};
+  u32 m_pressed{};
+  u32 m_released{};
+
+  [[nodiscard]] constexpr static auto button_mask(const mouse_button button) noexcept -> u32
+  {
+    return SDL_BUTTON(static_cast<u32>(button));
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_MOUSE_TRACKER_HEADER
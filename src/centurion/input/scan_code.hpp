@@ -3,9 +3,10 @@
 
 #include <SDL2/SDL.h>
 
-#include <cassert>  // assert
-#include <ostream>  // ostream
-#include <string>   // string
+#include <cassert>      // assert
+#include <ostream>      // ostream
+#include <string>       // string
+#include <string_view>  // string_view
 
 #include "../compiler/features.hpp"
 
@@ -18,6 +19,7 @@
 #include "../core/not_null.hpp"
 #include "../core/str.hpp"
 #include "../core/version.hpp"
+#include "../detail/key_names.hpp"
 
 namespace cen {
 
@@ -95,10 +97,11 @@ class scan_code final
    * \param name the name of the key, mustn't be null.
    *
    * \see `SDL_GetScancodeFromName`
+   * \see `from_name()`
    *
    * \since 5.0.0
    */
-  explicit scan_code(const not_null<str> name) noexcept : m_code{SDL_GetScancodeFromName(name)}
+  explicit scan_code(const not_null<str> name) noexcept : m_code{lookup(name)}
   {}
 
   /**
@@ -114,6 +117,38 @@ class scan_code final
   explicit scan_code(const std::string& name) noexcept : scan_code{name.c_str()}
   {}
 
+  /**
+   * \brief Returns the scan code of one of the constants in `cen::scancodes`, based on its
+   * name.
+   *
+   * \details The names are the same as those used by SDL, e.g. `"Space"` or `"Left Shift"`,
+   * and are compared case-insensitively. This function finds a name with a perfect hash that
+   * is computed at compile-time, so it can be used for hard-coded bindings in constant
+   * expressions, and only performs a single string comparison at runtime. Names that don't
+   * belong to a constant in `cen::scancodes` aren't recognized, use the constructor that
+   * accepts a string to look those up through SDL.
+   * \code{cpp}
+   *   constexpr auto jump = cen::scan_code::from_name("Space");
+   *   static_assert(jump == cen::scancodes::space);
+   * \endcode
+   *
+   * \param name the name of the key.
+   *
+   * \return the associated scan code; `SDL_SCANCODE_UNKNOWN` if the name isn't recognized.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto from_name(const std::string_view name) noexcept
+      -> scan_code
+  {
+    if (const auto* code = detail::scan_code_names.find(name)) {
+      return *code;
+    }
+    else {
+      return SDL_SCANCODE_UNKNOWN;
+    }
+  }
+
   /// \} End of construction
 
   /// \name Assignment operators
@@ -170,7 +205,7 @@ class scan_code final
   auto operator=(const not_null<str> name) noexcept -> scan_code&
   {
     assert(name);
-    m_code = SDL_GetScancodeFromName(name);
+    m_code = lookup(name);
     return *this;
   }
 
@@ -232,7 +267,12 @@ class scan_code final
    */
   [[nodiscard]] auto name() const -> std::string
   {
-    return SDL_GetScancodeName(m_code);
+    if (const auto name = detail::scan_code_names.name_of(m_code); !name.empty()) {
+      return std::string{name};
+    }
+    else {
+      return SDL_GetScancodeName(m_code);
+    }
   }
 
   /**
@@ -315,6 +355,12 @@ class scan_code final
 
  private:
   SDL_Scancode m_code{SDL_SCANCODE_UNKNOWN};
+
+  [[nodiscard]] static auto lookup(const str name) noexcept -> SDL_Scancode
+  {
+    const auto code = from_name(name);
+    return code.unknown() ? SDL_GetScancodeFromName(name) : code.get();
+  }
 };
 
 /// \name String conversions
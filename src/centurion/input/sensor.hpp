@@ -18,6 +18,7 @@
 
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/owner.hpp"
 #include "../core/str.hpp"
 #include "../core/str_or_na.hpp"
@@ -111,8 +112,11 @@ class basic_sensor final
    * \since 5.2.0
    */
   template <typename TT = T, detail::is_owner<TT> = 0>
-  explicit basic_sensor(const int index = 0) : m_sensor{SDL_SensorOpen(index)}
+  explicit basic_sensor(const int index = 0)
   {
+    library::ensure(library_subsystem::sensor);
+
+    m_sensor.reset(SDL_SensorOpen(index));
     if (!m_sensor) {
       throw sdl_error{};
     }
@@ -0,0 +1,457 @@
+#ifndef CENTURION_SENSOR_STREAM_HEADER
+#define CENTURION_SENSOR_STREAM_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>   // array
+#include <atomic>  // atomic, memory_order
+#include <memory>  // unique_ptr, make_unique
+
+#include "../core/integers.hpp"
+#include "../detail/concurrent_utils.hpp"
+#include "../detail/sdl_version_at_least.hpp"
+#include "sensor_type.hpp"
+
+namespace cen {
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \struct sensor_sample
+ *
+ * \brief Represents a single reading of a controller sensor.
+ *
+ * \since 6.4.0
+ */
+struct sensor_sample final
+{
+  sensor_type type{sensor_type::unknown};  ///< The type of the sensor.
+  u64 timestamp{};                         ///< The time of the reading, in microseconds.
+  std::array<float, 3> data{};             ///< The sensor values.
+};
+
+/**
+ * \class sensor_stream
+ *
+ * \brief Records every sensor reading of a single controller, with timestamps.
+ *
+ * \details Controller sensors usually report data at a much higher rate than the frame
+ * rate, so reading the latest values with `get_sensor_data()` once per frame loses most
+ * of the samples. A sensor stream installs an event watch that copies each sensor event
+ * of a controller into a lock-free ring buffer as soon as SDL generates it, so samples
+ * can be read in bulk without going through an event dispatcher.
+ *
+ * \details Samples are added by the thread that pumps the SDL events, and may be read by
+ * any single thread at a time. Samples are dropped if the buffer is full, which is
+ * reported by `dropped()`.
+ *
+ * \code{cpp}
+ *   cen::sensor_stream stream{controller.get_joystick().instance_id()};
+ *   controller.set_sensor_enabled(cen::sensor_type::gyroscope, true);
+ *
+ *   // Once per frame, after polling events
+ *   stream.drain([&](const cen::sensor_sample& sample) { integrator.add(sample); });
+ * \endcode
+ *
+ * \note SDL doesn't invoke event watches for ignored event types, so the
+ * `controller_sensor_event` type must not be disabled, e.g. by an `event_prefilter`.
+ *
+ * \note Sensor events still end up in the SDL event queue. An event dispatcher that
+ * isn't subscribed to `controller_sensor_event` simply discards them.
+ *
+ * \see `gyro_integrator`
+ * \see `SDL_AddEventWatch`
+ *
+ * \since 6.4.0
+ */
+class sensor_stream final
+{
+ public:
+  using value_type = sensor_sample;
+  using size_type = usize;
+
+  /**
+   * \brief Creates a sensor stream and starts recording sensor events.
+   *
+   * \param id the joystick instance ID of the controller.
+   * \param capacity the maximum amount of buffered samples, which is rounded up to the
+   * nearest power of two.
+   *
+   * \since 6.4.0
+   */
+  explicit sensor_stream(const SDL_JoystickID id,
+                         const size_type capacity = default_capacity())
+      : m_capacity{detail::ring_capacity(capacity)}
+      , m_mask{m_capacity - 1}
+      , m_samples{std::make_unique<sensor_sample[]>(m_capacity)}
+      , m_id{id}
+  {
+    SDL_AddEventWatch(on_event, this);
+  }
+
+  sensor_stream(const sensor_stream&) = delete;
+  sensor_stream(sensor_stream&&) = delete;
+
+  auto operator=(const sensor_stream&) -> sensor_stream& = delete;
+  auto operator=(sensor_stream&&) -> sensor_stream& = delete;
+
+  ~sensor_stream() noexcept
+  {
+    SDL_DelEventWatch(on_event, this);
+  }
+
+  /**
+   * \brief Adds a sample to the stream, this is done automatically for sensor events.
+   *
+   * \details This function may be used to inject recorded samples. It must not be called
+   * concurrently with the event watch, i.e. while another thread pumps events.
+   *
+   * \param sample the sample that will be added.
+   *
+   * \return `true` if the sample was added; `false` if the stream is full.
+   *
+   * \since 6.4.0
+   */
+  auto push(const sensor_sample& sample) noexcept -> bool
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+
+    if (head - tail == m_capacity) {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    m_samples[head & m_mask] = sample;
+    m_head.store(head + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /**
+   * \brief Removes the oldest samples from the stream, and copies them to a buffer.
+   *
+   * \note Only one thread at a time may remove samples from the stream.
+   *
+   * \param samples the buffer that the samples will be copied to.
+   * \param count the maximum amount of samples that will be removed.
+   *
+   * \return the number of samples that were copied to the buffer.
+   *
+   * \since 6.4.0
+   */
+  auto read(sensor_sample* samples, const size_type count) noexcept -> size_type
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto head = m_head.load(std::memory_order_acquire);
+
+    const auto available = head - tail;
+    const auto amount = available < count ? available : count;
+
+    for (size_type index = 0; index < amount; ++index) {
+      samples[index] = m_samples[(tail + index) & m_mask];
+    }
+
+    m_tail.store(tail + amount, std::memory_order_release);
+    return amount;
+  }
+
+  /**
+   * \brief Removes all buffered samples, and invokes a function with each sample.
+   *
+   * \details Samples that are added while the stream is drained are left for the next
+   * call.
+   *
+   * \note Only one thread at a time may remove samples from the stream.
+   *
+   * \tparam Function the type of the function object.
+   *
+   * \param function the function object that will be invoked with each removed sample.
+   *
+   * \return the number of samples that were removed.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  auto drain(Function&& function) -> size_type
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto head = m_head.load(std::memory_order_acquire);
+
+    for (auto position = tail; position != head; ++position) {
+      function(static_cast<const sensor_sample&>(m_samples[position & m_mask]));
+    }
+
+    m_tail.store(head, std::memory_order_release);
+    return head - tail;
+  }
+
+  /**
+   * \brief Removes all buffered samples.
+   *
+   * \note Only one thread at a time may remove samples from the stream.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+  }
+
+  /**
+   * \brief Returns an estimate of the amount of buffered samples.
+   *
+   * \return the approximate number of samples in the stream.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto head = m_head.load(std::memory_order_relaxed);
+    return head - tail;
+  }
+
+  /**
+   * \brief Indicates whether or not the stream is empty.
+   *
+   * \return `true` if there appear to be no buffered samples; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return size() == 0;
+  }
+
+  /**
+   * \brief Returns the amount of samples that were dropped because the stream was full.
+   *
+   * \return the number of dropped samples.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> size_type
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the joystick instance ID of the recorded controller.
+   *
+   * \return the associated joystick instance ID.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto id() const noexcept -> SDL_JoystickID
+  {
+    return m_id;
+  }
+
+  /**
+   * \brief Returns the maximum amount of buffered samples.
+   *
+   * \return the capacity of the stream.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the default capacity of sensor streams.
+   *
+   * \details The default capacity fits about a second of gyroscope and accelerometer
+   * samples of common controllers.
+   *
+   * \return the default capacity.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_capacity() noexcept -> size_type
+  {
+    return 2048;
+  }
+
+  /**
+   * \brief Converts a sensor event to a sample.
+   *
+   * \param event the sensor event that will be converted.
+   *
+   * \return a sample with the sensor type, timestamp and data of the event.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto to_sample(const SDL_ControllerSensorEvent& event) noexcept
+      -> sensor_sample
+  {
+    sensor_sample sample;
+    sample.type = static_cast<sensor_type>(event.sensor);
+    sample.timestamp = static_cast<u64>(event.timestamp) * 1'000u;
+
+#if SDL_VERSION_ATLEAST(2, 26, 0)
+    if (event.timestamp_us != 0) {
+      sample.timestamp = event.timestamp_us;
+    }
+#endif  // SDL_VERSION_ATLEAST(2, 26, 0)
+
+    sample.data = {event.data[0], event.data[1], event.data[2]};
+    return sample;
+  }
+
+ private:
+  size_type m_capacity{};
+  size_type m_mask{};
+  std::unique_ptr<sensor_sample[]> m_samples;
+  SDL_JoystickID m_id{};
+  std::atomic<size_type> m_dropped{};
+  alignas(64) std::atomic<size_type> m_head{};  ///< Written by the event watch.
+  alignas(64) std::atomic<size_type> m_tail{};  ///< Written by the reader.
+
+  static auto on_event(void* data, SDL_Event* event) -> int
+  {
+    auto* self = static_cast<sensor_stream*>(data);
+
+    if (event->type == SDL_CONTROLLERSENSORUPDATE && event->csensor.which == self->m_id) {
+      self->push(to_sample(event->csensor));
+    }
+
+    return 0;
+  }
+};
+
+/**
+ * \class gyro_integrator
+ *
+ * \brief Integrates gyroscope samples to the rotation since the last query.
+ *
+ * \details Gyroscope samples report angular velocities in radians per second. Summing
+ * the velocity of every sample multiplied by its duration yields the rotation of the
+ * controller, which is what motion aiming needs, independently of the frame rate.
+ *
+ * \details If a data rate is provided, e.g. from `get_sensor_data_rate()`, each sample
+ * is assumed to last for one period. Otherwise, the duration of a sample is the time
+ * since the previous sample, which is only accurate with microsecond timestamps.
+ *
+ * \see `sensor_stream`
+ *
+ * \since 6.4.0
+ */
+class gyro_integrator final
+{
+ public:
+  using rotation_type = std::array<float, 3>;
+
+  /**
+   * \brief Creates a gyroscope integrator.
+   *
+   * \param dataRate the amount of gyroscope samples per second, or zero if the sample
+   * durations should be computed from the timestamps.
+   *
+   * \since 6.4.0
+   */
+  explicit gyro_integrator(const float dataRate = 0) noexcept
+      : m_period{dataRate > 0 ? 1.0f / dataRate : 0.0f}
+  {}
+
+  /**
+   * \brief Adds the rotation of a sample, other sensor types are ignored.
+   *
+   * \details Without a data rate, the first sample after a reset only provides a
+   * reference timestamp.
+   *
+   * \param sample the sample that will be integrated.
+   *
+   * \since 6.4.0
+   */
+  void add(const sensor_sample& sample) noexcept
+  {
+    if (sample.type != sensor_type::gyroscope) {
+      return;
+    }
+
+    auto duration = m_period;
+    if (duration == 0 && m_hasPrevious && sample.timestamp > m_previous) {
+      duration = static_cast<float>(sample.timestamp - m_previous) * 1e-6f;
+    }
+
+    m_previous = sample.timestamp;
+    m_hasPrevious = true;
+
+    for (usize axis = 0; axis < m_rotation.size(); ++axis) {
+      m_rotation[axis] += sample.data[axis] * duration;
+    }
+  }
+
+  /**
+   * \brief Adds the rotation of a range of samples.
+   *
+   * \param samples the samples that will be integrated.
+   * \param count the amount of samples.
+   *
+   * \since 6.4.0
+   */
+  void add(const sensor_sample* samples, const usize count) noexcept
+  {
+    for (usize index = 0; index < count; ++index) {
+      add(samples[index]);
+    }
+  }
+
+  /**
+   * \brief Returns the accumulated rotation, and starts accumulating from zero again.
+   *
+   * \return the rotation around each axis since the last call, in radians.
+   *
+   * \since 6.4.0
+   */
+  auto take() noexcept -> rotation_type
+  {
+    const auto rotation = m_rotation;
+    m_rotation = {};
+    return rotation;
+  }
+
+  /**
+   * \brief Resets the accumulated rotation and forgets the previous timestamp.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_rotation = {};
+    m_previous = 0;
+    m_hasPrevious = false;
+  }
+
+  /**
+   * \brief Returns the accumulated rotation.
+   *
+   * \return the rotation around each axis since the last call to `take()`, in radians.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto rotation() const noexcept -> const rotation_type&
+  {
+    return m_rotation;
+  }
+
+ private:
+  rotation_type m_rotation{};
+  float m_period{};
+  u64 m_previous{};
+  bool m_hasPrevious{};
+};
+
+/// \} End of group input
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+}  // namespace cen
+
+#endif  // CENTURION_SENSOR_STREAM_HEADER
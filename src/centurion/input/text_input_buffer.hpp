@@ -0,0 +1,728 @@
+#ifndef CENTURION_TEXT_INPUT_BUFFER_HEADER
+#define CENTURION_TEXT_INPUT_BUFFER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // count, max, min
+#include <cassert>      // assert
+#include <cstring>      // memcpy, memmove
+#include <string_view>  // string_view
+#include <utility>      // pair
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+#include "../events/text_editing_event.hpp"
+#include "../events/text_input_event.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class text_input_buffer
+ *
+ * \brief An editable UTF-8 string, that is fed text input and IME composition events.
+ *
+ * \details The text is stored in a gap buffer, i.e. a preallocated buffer with a gap at
+ * the cursor, so typing only copies the text of each event into the gap. The text of the
+ * events is read directly from the events, and no memory is allocated unless the text
+ * outgrows the capacity of the buffer.
+ * \code{cpp}
+ *   cen::text_input_buffer buffer;
+ *
+ *   dispatcher.bind<cen::text_input_event>().to(
+ *       [&](const cen::text_input_event& event) { buffer.feed(event); });
+ *   dispatcher.bind<cen::text_editing_event>().to(
+ *       [&](const cen::text_editing_event& event) { buffer.feed(event); });
+ *   dispatcher.poll();
+ *
+ *   if (buffer.is_dirty()) {
+ *     const auto [first, count] = buffer.dirty_lines();
+ *     for (auto line = first; line < first + count; ++line) {
+ *       layouts.at(line).set_text(cen::utf8_view{buffer.line(line)});
+ *     }
+ *
+ *     buffer.mark_clean();
+ *   }
+ * \endcode
+ *
+ * \details Text that is being composed with an input method editor, as reported by
+ * `text_editing_event`, is stored in the buffer at the cursor, so that it can be rendered
+ * along with the rest of the text, e.g. underlined with the help of `composition()`. The
+ * composition is replaced by the committed text of the next `text_input_event`.
+ *
+ * \details All edits are recorded in a dirty range, which covers every byte that has
+ * changed since the last call to `mark_clean()`. The lines that contain the dirty range,
+ * see `dirty_lines()`, are the only ones that need to be laid out again. Note, if the
+ * amount of lines changed, the lines below the dirty range have moved, but their contents
+ * are unchanged.
+ *
+ * \note All offsets are in bytes, and are expected to be at the start of a code point.
+ *
+ * \see `text_input_event`
+ * \see `text_editing_event`
+ * \see `text_layout`
+ *
+ * \since 6.4.0
+ */
+class text_input_buffer final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \struct range
+   *
+   * \brief Represents a range of bytes in the buffer.
+   *
+   * \since 6.4.0
+   */
+  struct range final
+  {
+    size_type offset{};  ///< The offset of the first byte.
+    size_type length{};  ///< The amount of bytes.
+  };
+
+  /**
+   * \struct line_range
+   *
+   * \brief Represents a range of consecutive lines in the buffer.
+   *
+   * \since 6.4.0
+   */
+  struct line_range final
+  {
+    size_type first{};  ///< The index of the first line.
+    size_type count{};  ///< The amount of lines.
+  };
+
+  /**
+   * \brief Creates an empty buffer.
+   *
+   * \param capacity the amount of bytes that can be stored without allocating memory.
+   *
+   * \since 6.4.0
+   */
+  explicit text_input_buffer(const size_type capacity = default_capacity())
+      : m_data(std::max(capacity, size_type{1}) + 1u)
+      , m_gapEnd{m_data.size()}
+  {}
+
+  /**
+   * \brief Inserts committed text, e.g. from a key press.
+   *
+   * \details If text is being composed, the composition is replaced by the committed
+   * text. Otherwise, the text is inserted at the cursor. The cursor is placed after the
+   * committed text in either case.
+   *
+   * \param event the text input event.
+   *
+   * \since 6.4.0
+   */
+  void feed(const text_input_event& event)
+  {
+    const auto text = event.text_utf8();
+    if (m_composing) {
+      const auto offset = m_composition.offset;
+      replace(offset, m_composition.length, text);
+      end_composition();
+      m_cursor = offset + text.size();
+    }
+    else {
+      insert(text);
+    }
+  }
+
+  /**
+   * \brief Updates the text that is being composed by an input method editor.
+   *
+   * \details The composition replaces the previous composition, or is inserted at the
+   * cursor if there is none. An empty composition ends the composition. The cursor is
+   * placed at the editing position reported by the event.
+   *
+   * \param event the text editing event.
+   *
+   * \since 6.4.0
+   */
+  void feed(const text_editing_event& event)
+  {
+    const auto text = event.text();
+    const auto offset = m_composing ? m_composition.offset : m_cursor;
+
+    replace(offset, m_composing ? m_composition.length : 0u, text);
+
+    // The event describes the editing position in code points
+    const auto start = advance(text, 0, static_cast<size_type>(std::max(event.start(), 0)));
+    const auto end = advance(text, start, static_cast<size_type>(event.length()));
+
+    m_composing = !text.empty();
+    m_composition = {offset, text.size()};
+    m_selection = {offset + start, end - start};
+    m_cursor = offset + start;
+  }
+
+  /**
+   * \brief Inserts text at the cursor, and moves the cursor past the text.
+   *
+   * \details A composition in progress is kept as regular text.
+   *
+   * \param text the UTF-8 text that will be inserted.
+   *
+   * \since 6.4.0
+   */
+  void insert(const std::string_view text)
+  {
+    end_composition();
+    replace(m_cursor, 0, text);
+    m_cursor += text.size();
+  }
+
+  /**
+   * \brief Removes the code point before the cursor, like the backspace key.
+   *
+   * \details A composition in progress is kept as regular text.
+   *
+   * \return `true` if a code point was removed; `false` if the cursor is at the start.
+   *
+   * \since 6.4.0
+   */
+  auto erase_before() -> bool
+  {
+    end_composition();
+    if (m_cursor == 0) {
+      return false;
+    }
+
+    const auto start = previous(m_cursor);
+    replace(start, m_cursor - start, {});
+    m_cursor = start;
+    return true;
+  }
+
+  /**
+   * \brief Removes the code point after the cursor, like the delete key.
+   *
+   * \details A composition in progress is kept as regular text.
+   *
+   * \return `true` if a code point was removed; `false` if the cursor is at the end.
+   *
+   * \since 6.4.0
+   */
+  auto erase_after() -> bool
+  {
+    end_composition();
+    if (m_cursor == size()) {
+      return false;
+    }
+
+    replace(m_cursor, next(m_cursor) - m_cursor, {});
+    return true;
+  }
+
+  /**
+   * \brief Moves the cursor to the previous code point.
+   *
+   * \since 6.4.0
+   */
+  void move_left() noexcept
+  {
+    end_composition();
+    m_cursor = (m_cursor != 0) ? previous(m_cursor) : 0u;
+  }
+
+  /**
+   * \brief Moves the cursor to the next code point.
+   *
+   * \since 6.4.0
+   */
+  void move_right() noexcept
+  {
+    end_composition();
+    m_cursor = (m_cursor != size()) ? next(m_cursor) : m_cursor;
+  }
+
+  /**
+   * \brief Sets the position of the cursor.
+   *
+   * \param offset the byte offset of the cursor, is clamped to the size of the text.
+   *
+   * \since 6.4.0
+   */
+  void set_cursor(const size_type offset) noexcept
+  {
+    end_composition();
+    m_cursor = std::min(offset, size());
+  }
+
+  /**
+   * \brief Removes all text, and marks it as dirty.
+   *
+   * \details The capacity of the buffer is retained.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    if (!empty()) {
+      mark_dirty(0, size(), 0);
+    }
+
+    m_gapBegin = 0;
+    m_gapEnd = m_data.size();
+    m_cursor = 0;
+    m_composing = false;
+    m_composition = {};
+    m_selection = {};
+  }
+
+  /**
+   * \brief Makes sure that the buffer can store a text without allocating memory.
+   *
+   * \param capacity the amount of bytes that can be stored without allocating memory.
+   *
+   * \since 6.4.0
+   */
+  void reserve(const size_type capacity)
+  {
+    if (capacity > this->capacity()) {
+      grow(capacity - size());
+    }
+  }
+
+  /**
+   * \brief Returns the contents of the buffer.
+   *
+   * \details The gap is moved to the end of the buffer, if necessary, which makes the
+   * text contiguous. The text is followed by a null-terminator, so `data()` of the
+   * returned view can be passed to functions that expect a C-string, e.g.
+   * `font::render_blended_utf8()`.
+   *
+   * \return the text in the buffer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto text() noexcept -> std::string_view
+  {
+    const auto length = size();
+    move_gap(length);
+
+    m_data[length] = '\0';
+    return {m_data.data(), length};
+  }
+
+  /**
+   * \brief Returns a line of the buffer.
+   *
+   * \details The gap is only moved if it's inside of the line, i.e. typically to the end of
+   * the edited line.
+   *
+   * \param index the index of the line, lines are separated by `'\n'`.
+   *
+   * \return the line, without the line break; an empty view if there is no such line.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto line(const size_type index) noexcept -> std::string_view
+  {
+    const auto [start, length] = find_line(index);
+    if (m_gapBegin > start && m_gapBegin < start + length) {
+      move_gap(start + length);
+    }
+
+    const auto physical = (m_gapBegin <= start) ? start + gap_size() : start;
+    return {m_data.data() + physical, length};
+  }
+
+  /**
+   * \brief Returns the contents of the buffer, without moving the gap.
+   *
+   * \return the text before and after the gap, respectively.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto segments() const noexcept -> std::pair<std::string_view, std::string_view>
+  {
+    return {{m_data.data(), m_gapBegin},
+            {m_data.data() + m_gapEnd, m_data.size() - m_gapEnd}};
+  }
+
+  /**
+   * \brief Returns the range that has changed since the last call to `mark_clean()`.
+   *
+   * \details The range covers the current contents of all edited parts of the text, which
+   * means that it's empty if text was only removed.
+   *
+   * \return the dirty range; an empty range if nothing has changed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dirty_range() const noexcept -> range
+  {
+    return m_dirty ? range{m_dirtyBegin, m_dirtyEnd - m_dirtyBegin} : range{};
+  }
+
+  /**
+   * \brief Returns the lines that have changed since the last call to `mark_clean()`.
+   *
+   * \return the dirty lines; an empty range if nothing has changed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dirty_lines() const noexcept -> line_range
+  {
+    if (!m_dirty) {
+      return {};
+    }
+
+    const auto first = count_lines(0, m_dirtyBegin);
+    return {first, 1u + count_lines(m_dirtyBegin, m_dirtyEnd)};
+  }
+
+  /**
+   * \brief Indicates whether or not the text has changed since the last call to
+   * `mark_clean()`.
+   *
+   * \return `true` if the text has changed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_dirty() const noexcept -> bool
+  {
+    return m_dirty;
+  }
+
+  /**
+   * \brief Clears the dirty range, e.g. after the changed lines have been laid out.
+   *
+   * \since 6.4.0
+   */
+  void mark_clean() noexcept
+  {
+    m_dirty = false;
+    m_dirtyBegin = 0;
+    m_dirtyEnd = 0;
+  }
+
+  /**
+   * \brief Indicates whether or not text is being composed by an input method editor.
+   *
+   * \return `true` if there is a composition in the buffer; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_composing() const noexcept -> bool
+  {
+    return m_composing;
+  }
+
+  /**
+   * \brief Returns the range of the text that is being composed.
+   *
+   * \return the composition range; an empty range if there is no composition.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto composition() const noexcept -> range
+  {
+    return m_composition;
+  }
+
+  /**
+   * \brief Returns the range of the composition that is selected by the input method.
+   *
+   * \return the selected part of the composition; an empty range if nothing is selected.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto composition_selection() const noexcept -> range
+  {
+    return m_selection;
+  }
+
+  /**
+   * \brief Returns the position of the cursor.
+   *
+   * \return the byte offset of the cursor.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto cursor() const noexcept -> size_type
+  {
+    return m_cursor;
+  }
+
+  /**
+   * \brief Returns the index of the line that a byte belongs to.
+   *
+   * \param offset the byte offset, e.g. `cursor()`.
+   *
+   * \return the index of the line.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto line_of(const size_type offset) const noexcept -> size_type
+  {
+    return count_lines(0, std::min(offset, size()));
+  }
+
+  /**
+   * \brief Returns the amount of lines in the buffer.
+   *
+   * \return the amount of lines, always at least one.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto line_count() const noexcept -> size_type
+  {
+    return 1u + count_lines(0, size());
+  }
+
+  /**
+   * \brief Returns the size of the text.
+   *
+   * \return the amount of bytes in the buffer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_data.size() - gap_size();
+  }
+
+  /**
+   * \brief Returns the amount of bytes that can be stored without allocating memory.
+   *
+   * \return the capacity of the buffer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    // One byte is reserved for the null-terminator
+    return m_data.size() - 1u;
+  }
+
+  /**
+   * \brief Indicates whether or not the buffer is empty.
+   *
+   * \return `true` if there is no text in the buffer; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return size() == 0;
+  }
+
+  /**
+   * \brief Returns the default capacity of text input buffers.
+   *
+   * \return the default capacity, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_capacity() noexcept -> size_type
+  {
+    return 256;
+  }
+
+ private:
+  std::vector<char> m_data;
+  size_type m_gapBegin{};
+  size_type m_gapEnd{};
+  size_type m_cursor{};
+  range m_composition;
+  range m_selection;
+  size_type m_dirtyBegin{};
+  size_type m_dirtyEnd{};
+  bool m_composing{};
+  bool m_dirty{};
+
+  [[nodiscard]] static auto is_continuation(const char byte) noexcept -> bool
+  {
+    return (static_cast<u8>(byte) & 0xC0u) == 0x80u;
+  }
+
+  // Returns the offset of the code point that is `count` code points after `offset`
+  [[nodiscard]] static auto advance(const std::string_view text,
+                                    size_type offset,
+                                    size_type count) noexcept -> size_type
+  {
+    while (count != 0 && offset < text.size()) {
+      ++offset;
+      while (offset < text.size() && is_continuation(text[offset])) {
+        ++offset;
+      }
+
+      --count;
+    }
+
+    return offset;
+  }
+
+  [[nodiscard]] auto gap_size() const noexcept -> size_type
+  {
+    return m_gapEnd - m_gapBegin;
+  }
+
+  [[nodiscard]] auto at(const size_type offset) const noexcept -> char
+  {
+    return m_data[(offset < m_gapBegin) ? offset : offset + gap_size()];
+  }
+
+  [[nodiscard]] auto previous(size_type offset) const noexcept -> size_type
+  {
+    assert(offset > 0);
+    do {
+      --offset;
+    } while (offset > 0 && is_continuation(at(offset)));
+
+    return offset;
+  }
+
+  [[nodiscard]] auto next(size_type offset) const noexcept -> size_type
+  {
+    assert(offset < size());
+    const auto length = size();
+    do {
+      ++offset;
+    } while (offset < length && is_continuation(at(offset)));
+
+    return offset;
+  }
+
+  [[nodiscard]] auto count_lines(const size_type begin, const size_type end) const noexcept
+      -> size_type
+  {
+    const auto [before, after] = segments();
+
+    size_type lines = 0;
+    if (begin < before.size()) {
+      const auto last = std::min(end, before.size());
+      lines += static_cast<size_type>(
+          std::count(before.begin() + begin, before.begin() + last, '\n'));
+    }
+
+    if (end > before.size()) {
+      const auto first = std::max(begin, before.size()) - before.size();
+      lines += static_cast<size_type>(std::count(after.begin() + first,
+                                                 after.begin() + (end - before.size()),
+                                                 '\n'));
+    }
+
+    return lines;
+  }
+
+  [[nodiscard]] auto find_line(const size_type index) const noexcept -> range
+  {
+    const auto length = size();
+
+    size_type start = 0;
+    for (size_type line = 0; line < index; ++line) {
+      while (start < length && at(start) != '\n') {
+        ++start;
+      }
+
+      if (start == length) {
+        return {length, 0};
+      }
+
+      ++start;
+    }
+
+    auto end = start;
+    while (end < length && at(end) != '\n') {
+      ++end;
+    }
+
+    return {start, end - start};
+  }
+
+  void end_composition() noexcept
+  {
+    m_composing = false;
+    m_composition = {};
+    m_selection = {};
+  }
+
+  void move_gap(const size_type offset) noexcept
+  {
+    assert(offset <= size());
+
+    if (offset < m_gapBegin) {
+      const auto count = m_gapBegin - offset;
+      std::memmove(m_data.data() + m_gapEnd - count, m_data.data() + offset, count);
+      m_gapBegin -= count;
+      m_gapEnd -= count;
+    }
+    else if (offset > m_gapBegin) {
+      const auto count = offset - m_gapBegin;
+      std::memmove(m_data.data() + m_gapBegin, m_data.data() + m_gapEnd, count);
+      m_gapBegin += count;
+      m_gapEnd += count;
+    }
+  }
+
+  void grow(const size_type required)
+  {
+    // The gap always keeps room for the null-terminator
+    const auto before = m_gapBegin;
+    const auto after = m_data.size() - m_gapEnd;
+    const auto newSize = std::max(m_data.size() * 2u, before + after + required + 1u);
+
+    std::vector<char> data(newSize);
+    std::memcpy(data.data(), m_data.data(), before);
+    std::memcpy(data.data() + newSize - after, m_data.data() + m_gapEnd, after);
+
+    m_data.swap(data);
+    m_gapEnd = newSize - after;
+  }
+
+  void mark_dirty(const size_type offset, const size_type removed, const size_type inserted)
+  {
+    if (!m_dirty) {
+      m_dirty = true;
+      m_dirtyBegin = offset;
+      m_dirtyEnd = offset + inserted;
+      return;
+    }
+
+    // The end of the previous range is shifted if it's after the edited bytes
+    auto end = m_dirtyEnd;
+    if (end >= offset + removed) {
+      end = end - removed + inserted;
+    }
+    else {
+      end = std::min(end, offset);
+    }
+
+    m_dirtyBegin = std::min(m_dirtyBegin, offset);
+    m_dirtyEnd = std::max(end, offset + inserted);
+  }
+
+  void replace(const size_type offset, const size_type removed, const std::string_view text)
+  {
+    assert(offset + removed <= size());
+
+    move_gap(offset);
+    m_gapEnd += removed;
+
+    if (gap_size() < text.size() + 1u) {
+      grow(text.size());
+    }
+
+    if (!text.empty()) {
+      std::memcpy(m_data.data() + m_gapBegin, text.data(), text.size());
+      m_gapBegin += text.size();
+    }
+
+    mark_dirty(offset, removed, text.size());
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXT_INPUT_BUFFER_HEADER
@@ -0,0 +1,421 @@
+#ifndef CENTURION_TOUCH_TRACKER_HEADER
+#define CENTURION_TOUCH_TRACKER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>     // array
+#include <cmath>     // atan2, sqrt
+#include <optional>  // optional, nullopt
+#include <utility>   // as_const
+
+#include "../core/integers.hpp"
+#include "../events/dollar_gesture_event.hpp"
+#include "../events/touch_finger_event.hpp"
+#include "../math/point.hpp"
+#include "button_state.hpp"
+#include "touch.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \struct touch_gesture
+ *
+ * \brief Represents the movement of the fingers on a touch device during a frame.
+ *
+ * \details Only fingers that were touching the device during the entire frame contribute
+ * to the gesture, so that fingers that are added or lifted don't cause sudden jumps.
+ *
+ * \since 6.4.0
+ */
+struct touch_gesture final
+{
+  fpoint pan;        ///< The movement of the center of the fingers, in normalized units.
+  float scale{1};    ///< The ratio between the new and old spread of the fingers.
+  float rotation{};  ///< The rotation of the fingers around their center, in radians.
+  usize fingers{};   ///< The amount of fingers that contributed to the gesture.
+};
+
+/**
+ * \class touch_tracker
+ *
+ * \brief Keeps track of the active fingers of touch devices, using touch events.
+ *
+ * \details A touch tracker stores the fingers of each touch device in a small fixed-size
+ * table, which is updated with touch finger events without any allocations. The tracker
+ * also computes pinch, pan and rotate gestures from the movement of the fingers during
+ * each frame, which makes it unnecessary to handle `multi_gesture_event`.
+ *
+ * \details Fingers beyond the capacity of a device, and devices beyond the device
+ * capacity, are ignored.
+ *
+ * \code{cpp}
+ *   tracker.update();
+ *   // Feed the touch events of the frame...
+ *
+ *   const auto gesture = tracker.gesture(device);
+ *   zoom *= gesture.scale;
+ * \endcode
+ *
+ * \see `keyboard_tracker`
+ * \see `mouse_tracker`
+ *
+ * \since 6.4.0
+ */
+class touch_tracker final
+{
+ public:
+  using size_type = usize;
+
+  inline constexpr static size_type max_devices = 4;   ///< The maximum amount of devices.
+  inline constexpr static size_type max_fingers = 10;  ///< The maximum fingers per device.
+
+  /**
+   * \brief Creates a touch tracker without any active fingers.
+   *
+   * \since 6.4.0
+   */
+  touch_tracker() noexcept = default;
+
+  /**
+   * \brief Starts a new frame, by resetting the gesture reference positions.
+   *
+   * \details This should be called once per frame, before feeding the events of the
+   * frame. The active fingers are not affected.
+   *
+   * \since 6.4.0
+   */
+  void update() noexcept
+  {
+    for (auto& device : m_devices) {
+      for (size_type index = 0; index < device.count; ++index) {
+        auto& finger = device.fingers[index];
+        finger.previous = finger.position;
+        finger.persistent = true;
+      }
+    }
+
+    m_dollar.reset();
+  }
+
+  /**
+   * \brief Updates the tracked fingers with a touch finger event.
+   *
+   * \param event the touch finger event.
+   *
+   * \since 6.4.0
+   */
+  void feed(const touch_finger_event& event) noexcept
+  {
+    const auto type = event.type();
+    const fpoint position{event.x(), event.y()};
+
+    if (type == event_type::touch_down) {
+      auto* device = find_or_add_device(event.touch_id());
+      if (!device || device->count == max_fingers) {
+        return;
+      }
+
+      if (find_finger(*device, event.finger_id())) {
+        return;
+      }
+
+      auto& finger = device->fingers[device->count++];
+      finger.id = event.finger_id();
+      finger.position = position;
+      finger.previous = position;
+      finger.pressure = event.pressure();
+      finger.persistent = false;
+    }
+    else if (auto* device = find_device(event.touch_id())) {
+      auto* finger = find_finger(*device, event.finger_id());
+      if (!finger) {
+        return;
+      }
+
+      if (type == event_type::touch_up) {
+        *finger = device->fingers[--device->count];
+      }
+      else {
+        finger->position = position;
+        finger->pressure = event.pressure();
+      }
+    }
+  }
+
+  /**
+   * \brief Records a recognized dollar gesture.
+   *
+   * \param event the dollar gesture event.
+   *
+   * \since 6.4.0
+   */
+  void feed(const dollar_gesture_event& event) noexcept
+  {
+    m_dollar = event.gesture_id();
+  }
+
+  /**
+   * \brief Forgets all fingers, e.g. when the window loses focus.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_devices = {};
+    m_dollar.reset();
+  }
+
+  /**
+   * \brief Returns the amount of active fingers on a touch device.
+   *
+   * \param touch the ID of the touch device.
+   *
+   * \return the number of tracked fingers on the device.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto finger_count(const SDL_TouchID touch) const noexcept -> size_type
+  {
+    const auto* device = find_device(touch);
+    return device ? device->count : 0;
+  }
+
+  /**
+   * \brief Returns the state of an active finger.
+   *
+   * \param touch the ID of the touch device.
+   * \param finger the ID of the finger.
+   *
+   * \return the finger state; `std::nullopt` if the finger isn't active.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto find(const SDL_TouchID touch, const SDL_FingerID finger) const noexcept
+      -> std::optional<touch_finger_state>
+  {
+    if (const auto* device = find_device(touch)) {
+      if (const auto* entry = find_finger(*device, finger)) {
+        return touch_finger_state{button_state::pressed,
+                                  entry->position.x(),
+                                  entry->position.y(),
+                                  entry->pressure};
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+   * \brief Invokes a function with each active finger of a touch device.
+   *
+   * \tparam Function the type of the function object, which is called with the finger ID
+   * and a `touch_finger_state`.
+   *
+   * \param touch the ID of the touch device.
+   * \param function the function object that will be invoked with each finger.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  void each_finger(const SDL_TouchID touch, Function&& function) const
+  {
+    if (const auto* device = find_device(touch)) {
+      for (size_type index = 0; index < device->count; ++index) {
+        const auto& entry = device->fingers[index];
+        function(entry.id,
+                 touch_finger_state{button_state::pressed,
+                                    entry.position.x(),
+                                    entry.position.y(),
+                                    entry.pressure});
+      }
+    }
+  }
+
+  /**
+   * \brief Computes the gesture performed on a touch device during the current frame.
+   *
+   * \details The pan is the movement of the center of the fingers. The scale and rotation
+   * require at least two fingers, and are otherwise 1 and 0, respectively.
+   *
+   * \param touch the ID of the touch device.
+   *
+   * \return the gesture performed since the last update.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto gesture(const SDL_TouchID touch) const noexcept -> touch_gesture
+  {
+    touch_gesture result;
+
+    const auto* device = find_device(touch);
+    if (!device) {
+      return result;
+    }
+
+    float previousX = 0;
+    float previousY = 0;
+    float currentX = 0;
+    float currentY = 0;
+
+    for (size_type index = 0; index < device->count; ++index) {
+      const auto& finger = device->fingers[index];
+      if (finger.persistent) {
+        previousX += finger.previous.x();
+        previousY += finger.previous.y();
+        currentX += finger.position.x();
+        currentY += finger.position.y();
+        ++result.fingers;
+      }
+    }
+
+    if (result.fingers == 0) {
+      return result;
+    }
+
+    const auto count = static_cast<float>(result.fingers);
+    const fpoint previousCenter{previousX / count, previousY / count};
+    const fpoint currentCenter{currentX / count, currentY / count};
+
+    result.pan = currentCenter - previousCenter;
+
+    if (result.fingers < 2) {
+      return result;
+    }
+
+    float previousSpread = 0;
+    float currentSpread = 0;
+    float rotation = 0;
+
+    for (size_type index = 0; index < device->count; ++index) {
+      const auto& finger = device->fingers[index];
+      if (finger.persistent) {
+        const auto before = finger.previous - previousCenter;
+        const auto after = finger.position - currentCenter;
+
+        previousSpread += length(before);
+        currentSpread += length(after);
+        rotation += wrap_angle(std::atan2(after.y(), after.x()) -
+                               std::atan2(before.y(), before.x()));
+      }
+    }
+
+    if (previousSpread > epsilon) {
+      result.scale = currentSpread / previousSpread;
+    }
+
+    result.rotation = rotation / count;
+    return result;
+  }
+
+  /**
+   * \brief Returns the dollar gesture that was recognized during the current frame.
+   *
+   * \return the ID of the recognized gesture; `std::nullopt` if there is none.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto recognized_gesture() const noexcept -> std::optional<SDL_GestureID>
+  {
+    return m_dollar;
+  }
+
+ private:
+  inline constexpr static float epsilon = 1e-6f;
+  inline constexpr static float pi = 3.14159265f;
+
+  struct finger_entry final
+  {
+    SDL_FingerID id{};
+    fpoint position;
+    fpoint previous;    ///< The position at the start of the frame.
+    float pressure{};
+    bool persistent{};  ///< Whether the finger was active at the start of the frame.
+  };
+
+  struct device_entry final
+  {
+    SDL_TouchID id{};
+    size_type count{};  ///< Zero for unused entries.
+    std::array<finger_entry, max_fingers> fingers{};
+  };
+
+  std::array<device_entry, max_devices> m_devices{};
+  std::optional<SDL_GestureID> m_dollar;
+
+  [[nodiscard]] static auto length(const fpoint point) noexcept -> float
+  {
+    return std::sqrt(point.x() * point.x() + point.y() * point.y());
+  }
+
+  [[nodiscard]] static auto wrap_angle(const float angle) noexcept -> float
+  {
+    if (angle > pi) {
+      return angle - 2 * pi;
+    }
+    else if (angle < -pi) {
+      return angle + 2 * pi;
+    }
+    else {
+      return angle;
+    }
+  }
+
+  [[nodiscard]] auto find_device(const SDL_TouchID id) const noexcept -> const device_entry*
+  {
+    for (const auto& device : m_devices) {
+      if (device.count != 0 && device.id == id) {
+        return &device;
+      }
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] auto find_device(const SDL_TouchID id) noexcept -> device_entry*
+  {
+    return const_cast<device_entry*>(std::as_const(*this).find_device(id));
+  }
+
+  [[nodiscard]] auto find_or_add_device(const SDL_TouchID id) noexcept -> device_entry*
+  {
+    if (auto* device = find_device(id)) {
+      return device;
+    }
+
+    for (auto& device : m_devices) {
+      if (device.count == 0) {
+        device.id = id;
+        return &device;
+      }
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] static auto find_finger(const device_entry& device,
+                                        const SDL_FingerID id) noexcept -> const finger_entry*
+  {
+    for (size_type index = 0; index < device.count; ++index) {
+      if (device.fingers[index].id == id) {
+        return &device.fingers[index];
+      }
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] static auto find_finger(device_entry& device, const SDL_FingerID id) noexcept
+      -> finger_entry*
+  {
+    return const_cast<finger_entry*>(find_finger(std::as_const(device), id));
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_TOUCH_TRACKER_HEADER
@@ -0,0 +1,435 @@
+#ifndef CENTURION_VIRTUAL_JOYSTICK_SWARM_HEADER
+#define CENTURION_VIRTUAL_JOYSTICK_SWARM_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../detail/sdl_version_at_least.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../system/counter.hpp"
+#include "../system/frame_histogram.hpp"
+#include "../thread/deadline.hpp"
+#include "button_state.hpp"
+#include "controller_manager.hpp"
+#include "joystick.hpp"
+#include "joystick_type.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \struct swarm_config
+ *
+ * \brief Describes the virtual devices attached by a `virtual_joystick_swarm`, and the
+ * rate at which they are driven.
+ *
+ * \details The defaults describe eight game controllers, where every axis changes at
+ * 250 Hz, like a polled analog stick, and a button is toggled at 20 Hz.
+ *
+ * \since 6.4.0
+ */
+struct swarm_config final
+{
+  usize count{8};                                      ///< The amount of devices.
+  joystick_type type{joystick_type::game_controller};  ///< The type of the devices.
+  int axes{SDL_CONTROLLER_AXIS_MAX};                   ///< The amount of axes per device.
+  int buttons{SDL_CONTROLLER_BUTTON_MAX};              ///< The amount of buttons per device.
+  int hats{};                                          ///< The amount of hats per device.
+  double axis_rate{250};   ///< The amount of axis updates per second and device.
+  double button_rate{20};  ///< The amount of button toggles per second and device.
+};                                       ///< The amount of virtual devices.
+  joystick_type type{joystick_type::game_controller};   ///< The type of the devices.
+  int axes{SDL_CONTROLLER_AXIS_MAX};                    ///< The amount of axes per device.
+  int buttons{SDL_CONTROLLER_BUTTON_MAX};               ///< The amount of buttons per device.
+  int hats{};                                           ///< The amount of hats per device.
+  double axis_rate{250};    ///< The amount of axis updates per second and device.
+  double button_rate{20};   ///< The amount of button toggles per second and device.
+};
+
+/**
+ * \struct swarm_report
+ *
+ * \brief Provides the results of a `virtual_joystick_swarm` stress test.
+ *
+ * \details The time spent in the input pipeline is split into pumping, i.e. the time SDL
+ * spends updating joysticks and generating events, dispatching the events, and updating
+ * the controller manager.
+ *
+ * \since 6.4.0
+ */
+struct swarm_report final
+{
+  u64 frames{};                  ///< The amount of simulated frames.
+  u64 inputs{};                  ///< The amount of driven axis and button changes.
+  u64 events{};                  ///< The amount of events that were dispatched.
+  nanoseconds<u64> simulated{};  ///< The simulated duration of the test.
+  nanoseconds<u64> pump{};       ///< The total time spent pumping events.
+  nanoseconds<u64> dispatch{};   ///< The total time spent dispatching events.
+  nanoseconds<u64> update{};     ///< The total time spent updating the controllers.
+  frame_histogram frame_cost{microseconds<u64>{50}};  ///< The input cost of each frame.
+
+  /**
+   * \brief Returns the total time spent in the input pipeline.
+   *
+   * \return the sum of the pump, dispatch and update times.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto total() const noexcept -> nanoseconds<u64>
+  {
+    return pump + dispatch + update;
+  }
+
+  /**
+   * \brief Returns the amount of events that the input pipeline could process per second.
+   *
+   * \return the event throughput; zero if no time was spent in the pipeline.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto events_per_second() const noexcept -> double
+  {
+    const auto ns = total().count();
+    return (ns != 0) ? static_cast<double>(events) * 1e9 / static_cast<double>(ns) : 0.0;
+  }
+
+  /**
+   * \brief Returns the fraction of the simulated duration spent in the input pipeline.
+   *
+   * \details This is the share of a CPU core that an input thread would need to keep up
+   * with the simulated devices.
+   *
+   * \return the CPU load, where 1 corresponds to a fully occupied core.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto load() const noexcept -> double
+  {
+    const auto ns = simulated.count();
+    return (ns != 0) ? static_cast<double>(total().count()) / static_cast<double>(ns) : 0.0;
+  }
+};
+
+/**
+ * \class virtual_joystick_swarm
+ *
+ * \brief Drives a group of virtual joysticks, in order to stress test the input pipeline.
+ *
+ * \details The swarm attaches the configured amount of virtual joysticks when it is
+ * created, and detaches them when it is destroyed. Calls to `drive()` change the axes
+ * and buttons of every device at the configured rates, which produces the same events as
+ * physical devices. The `run()` function combines this with an event dispatcher and an
+ * optional controller manager, and measures the cost of handling the events.
+ * \code{cpp}
+ *   cen::swarm_config config;
+ *   config.count = 16;
+ *
+ *   cen::virtual_joystick_swarm swarm{config};
+ *
+ *   cen::controller_manager controllers;
+ *   controllers.open_all();
+ *
+ *   const auto report = swarm.run(dispatcher, &controllers, cen::seconds<u32>{10});
+ *   std::clog << "Load: " << report.load() * 100.0 << "%\n";
+ * \endcode
+ *
+ * \note Only the first eight game controllers are handled by a `controller_manager`.
+ *
+ * \see `joystick::attach_virtual()`
+ *
+ * \since 6.4.0
+ */
+class virtual_joystick_swarm final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Attaches and opens the virtual devices.
+   *
+   * \param config the description of the devices, and the rate at which they are driven.
+   *
+   * \throws sdl_error if a virtual device couldn't be attached or opened.
+   *
+   * \since 6.4.0
+   */
+  explicit virtual_joystick_swarm(const swarm_config& config = {}) : m_config{config}
+  {
+    assert(config.axis_rate >= 0);
+    assert(config.button_rate >= 0);
+
+    m_devices.reserve(config.count);
+
+    try {
+      for (size_type index = 0; index < config.count; ++index) {
+        const auto device =
+            joystick::attach_virtual(config.type, config.axes, config.buttons, config.hats);
+        if (!device) {
+          throw sdl_error{};
+        }
+
+        try {
+          m_devices.push_back(device_data{joystick{*device}});
+        }
+        catch (...) {
+          joystick::detach_virtual(*device);
+          throw;
+        }
+      }
+    }
+    catch (...) {
+      detach_all();
+      throw;
+    }
+  }
+
+  virtual_joystick_swarm(const virtual_joystick_swarm&) = delete;
+
+  auto operator=(const virtual_joystick_swarm&) -> virtual_joystick_swarm& = delete;
+
+  ~virtual_joystick_swarm() noexcept
+  {
+    detach_all();
+  }
+
+  /**
+   * \brief Advances the simulated time, changing the axes and buttons that are due.
+   *
+   * \details Each axis update assigns new values to all axes of a device, and each button
+   * toggle changes the next button of a device. The values differ between devices, and
+   * always differ from the previous values, so every change produces an event. The events
+   * are generated by SDL the next time events are pumped.
+   *
+   * \param elapsed the simulated time since the previous call.
+   *
+   * \return the amount of changed axes and buttons.
+   *
+   * \since 6.4.0
+   */
+  auto drive(const nanoseconds<u64> elapsed) noexcept -> u64
+  {
+    m_time += elapsed;
+
+    const auto seconds = static_cast<double>(m_time.count()) / 1e9;
+    const auto axisTarget = static_cast<u64>(seconds * m_config.axis_rate);
+    const auto buttonTarget = static_cast<u64>(seconds * m_config.button_rate);
+
+    u64 changes = 0;
+
+    for (size_type index = 0; index < m_devices.size(); ++index) {
+      auto& device = m_devices[index];
+
+      for (; device.axisUpdates < axisTarget; ++device.axisUpdates) {
+        for (auto axis = 0; axis < m_config.axes; ++axis) {
+          const auto value = axis_value(index, axis, device.axisUpdates);
+          if (device.stick.set_virtual_axis(axis, value)) {
+            ++changes;
+          }
+        }
+      }
+
+      for (; device.buttonToggles < buttonTarget; ++device.buttonToggles) {
+        if (m_config.buttons == 0) {
+          continue;
+        }
+
+        // Every button is pressed once, and then released once, in turn
+        const auto cycle = device.buttonToggles % (2u * static_cast<u64>(m_config.buttons));
+        const auto button = static_cast<int>(cycle % static_cast<u64>(m_config.buttons));
+        const auto state = (cycle < static_cast<u64>(m_config.buttons))
+                               ? button_state::pressed
+                               : button_state::released;
+
+        if (device.stick.set_virtual_button(button, state)) {
+          ++changes;
+        }
+      }
+    }
+
+    return changes;
+  }
+
+  /**
+   * \brief Runs a stress test of the input pipeline.
+   *
+   * \details The test simulates frames at the specified frame rate. Each frame drives the
+   * devices, pumps events, dispatches them and updates the controller manager, without
+   * waiting between frames. The time spent in each step is measured with
+   * `counter::now()`, and the simulated time advances by one frame period per frame, so
+   * the test takes as long as the input pipeline needs, rather than the simulated time.
+   *
+   * \details The events are counted while they are in the event queue, so the count
+   * includes events that the dispatcher isn't subscribed to.
+   *
+   * \tparam Dispatcher the type of the event dispatcher.
+   *
+   * \param dispatcher the event dispatcher that will poll and dispatch the events.
+   * \param manager the controller manager that will be updated; may be null.
+   * \param duration the simulated duration of the test.
+   * \param frameRate the simulated frame rate, must be greater than zero.
+   *
+   * \return the test results.
+   *
+   * \since 6.4.0
+   */
+  template <typename Dispatcher>
+  auto run(Dispatcher& dispatcher,
+           controller_manager* manager,
+           const nanoseconds<u64> duration,
+           const u32 frameRate = 60) -> swarm_report
+  {
+    assert(frameRate > 0);
+
+    const nanoseconds<u64> period{1'000'000'000 / frameRate};
+
+    swarm_report report;
+    while (report.simulated < duration) {
+      report.inputs += drive(period);
+
+      const auto start = counter::now();
+      SDL_PumpEvents();
+      const auto pumped = counter::now();
+
+      const auto depth =
+          SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+      if (depth > 0) {
+        report.events += static_cast<u64>(depth);
+      }
+
+      const auto polling = counter::now();
+      dispatcher.poll();
+      const auto polled = counter::now();
+
+      if (manager) {
+        manager->update();
+      }
+
+      const auto updated = counter::now();
+
+      const auto pump = deadline::from_counter_ticks(pumped - start);
+      const auto dispatch = deadline::from_counter_ticks(polled - polling);
+      const auto update = deadline::from_counter_ticks(updated - polled);
+
+      report.pump += pump;
+      report.dispatch += dispatch;
+      report.update += update;
+      report.frame_cost.record(pump + dispatch + update);
+
+      report.simulated += period;
+      ++report.frames;
+    }
+
+    return report;
+  }
+
+  /**
+   * \brief Returns the opened virtual device at the specified index.
+   *
+   * \param index the index of the device, must be less than `size()`.
+   *
+   * \return a handle to the virtual joystick.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get(const size_type index) const noexcept -> joystick_handle
+  {
+    assert(index < m_devices.size());
+    return joystick_handle{m_devices[index].stick.get()};
+  }
+
+  /**
+   * \brief Returns the amount of attached virtual devices.
+   *
+   * \return the device count.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_devices.size();
+  }
+
+  /**
+   * \brief Returns the configuration of the swarm.
+   *
+   * \return the swarm configuration.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto config() const noexcept -> const swarm_config&
+  {
+    return m_config;
+  }
+
+  /**
+   * \brief Returns the total simulated time that has been driven.
+   *
+   * \return the simulated time.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto elapsed() const noexcept -> nanoseconds<u64>
+  {
+    return m_time;
+  }
+
+ private:
+  struct device_data final
+  {
+    joystick stick;
+    u64 axisUpdates{};
+    u64 buttonToggles{};
+  };
+
+  swarm_config m_config;
+  std::vector<device_data> m_devices;
+  nanoseconds<u64> m_time{};
+
+  // Steps through all values with an odd stride, so consecutive values always differ
+  [[nodiscard]] static auto axis_value(const size_type device,
+                                       const int axis,
+                                       const u64 update) noexcept -> i16
+  {
+    const auto offset = static_cast<u64>(device) * 7919u + static_cast<u64>(axis) * 104729u;
+    const auto value = (offset + update * 4099u) % 65536u;
+    return static_cast<i16>(static_cast<i32>(value) - 32768);
+  }
+
+  void detach_all() noexcept
+  {
+    std::vector<SDL_JoystickID> ids;
+    ids.reserve(m_devices.size());
+
+    for (const auto& device : m_devices) {
+      ids.push_back(device.stick.instance_id());
+    }
+
+    // Device indices change as devices are detached, so they are looked up by ID
+    m_devices.clear();
+
+    for (const auto id : ids) {
+      for (auto index = 0, count = SDL_NumJoysticks(); index < count; ++index) {
+        if (SDL_JoystickGetDeviceInstanceID(index) == id) {
+          joystick::detach_virtual(index);
+          break;
+        }
+      }
+    }
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+#endif  // CENTURION_VIRTUAL_JOYSTICK_SWARM_HEADER
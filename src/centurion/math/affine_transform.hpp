@@ -0,0 +1,449 @@
+#ifndef CENTURION_AFFINE_TRANSFORM_HEADER
+#define CENTURION_AFFINE_TRANSFORM_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cmath>        // sin, cos
+#include <optional>     // optional, nullopt
+#include <ostream>      // ostream
+#include <string>       // string, to_string
+#include <type_traits>  // is_same_v
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_FORMAT
+
+#include <format>  // format
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+
+#include "../core/integers.hpp"
+#include "../detail/transform_kernels.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class affine_transform
+ *
+ * \brief A 2D affine transformation, i.e. a combination of translations, rotations,
+ * scalings and shears.
+ *
+ * \details The transform is represented by the matrix `[a c tx; b d ty; 0 0 1]`, which maps
+ * a point `(x, y)` to `(a * x + c * y + tx, b * x + d * y + ty)`. Transforms are composed
+ * with `operator*()`, where `lhs * rhs` applies `rhs` first, or more readably with
+ * `then()`.
+ * \code{cpp}
+ *   const auto camera = cen::affine_transform::translation(cameraOffset)
+ *                           .then(cen::affine_transform::scaling(zoom, zoom))
+ *                           .then(cen::affine_transform::translation(screenCenter));
+ *
+ *   camera.transform(points);  // Four points at a time, using SSE2 or NEON
+ * \endcode
+ *
+ * \note Rectangles are mapped to the bounding box of the transformed rectangle, since an
+ * axis-aligned rectangle is no longer axis-aligned after a rotation or shear.
+ *
+ * \since 6.4.0
+ */
+class affine_transform final
+{
+ public:
+  /**
+   * \brief Creates an identity transform.
+   *
+   * \since 6.4.0
+   */
+  constexpr affine_transform() noexcept = default;
+
+  /**
+   * \brief Creates a transform from its matrix coefficients.
+   *
+   * \param a the horizontal scale factor.
+   * \param b the vertical shear factor.
+   * \param c the horizontal shear factor.
+   * \param d the vertical scale factor.
+   * \param tx the horizontal translation.
+   * \param ty the vertical translation.
+   *
+   * \since 6.4.0
+   */
+  constexpr affine_transform(const float a,
+                             const float b,
+                             const float c,
+                             const float d,
+                             const float tx,
+                             const float ty) noexcept
+      : m_coefficients{a, b, c, d, tx, ty}
+  {}
+
+  /**
+   * \brief Returns a transform that doesn't change anything.
+   *
+   * \return an identity transform.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto identity() noexcept -> affine_transform
+  {
+    return affine_transform{};
+  }
+
+  /**
+   * \brief Returns a transform that moves points.
+   *
+   * \param offset the offset that will be added to points.
+   *
+   * \return a translation transform.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto translation(const fpoint offset) noexcept
+      -> affine_transform
+  {
+    return {1, 0, 0, 1, offset.x(), offset.y()};
+  }
+
+  /**
+   * \brief Returns a transform that scales points, relative to the origin.
+   *
+   * \param xFactor the horizontal scale factor.
+   * \param yFactor the vertical scale factor.
+   *
+   * \return a scaling transform.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto scaling(const float xFactor,
+                                              const float yFactor) noexcept
+      -> affine_transform
+  {
+    return {xFactor, 0, 0, yFactor, 0, 0};
+  }
+
+  /**
+   * \brief Returns a transform that rotates points around the origin.
+   *
+   * \details The rotation is clockwise on the screen, since the y-axis points downwards,
+   * which is consistent with the angles used when rendering textures.
+   *
+   * \param degrees the clockwise rotation, in degrees.
+   *
+   * \return a rotation transform.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto rotation(const double degrees) noexcept -> affine_transform
+  {
+    constexpr double pi = 3.14159265358979323846;
+
+    const auto radians = degrees * pi / 180.0;
+    const auto sin = static_cast<float>(std::sin(radians));
+    const auto cos = static_cast<float>(std::cos(radians));
+
+    return {cos, sin, -sin, cos, 0, 0};
+  }
+
+  /**
+   * \brief Returns a transform that rotates points around a pivot.
+   *
+   * \param degrees the clockwise rotation, in degrees.
+   * \param pivot the point that the rotation is performed around.
+   *
+   * \return a rotation transform.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto rotation(const double degrees, const fpoint pivot) noexcept
+      -> affine_transform
+  {
+    const fpoint origin{-pivot.x(), -pivot.y()};
+    return translation(origin).then(rotation(degrees)).then(translation(pivot));
+  }
+
+  /**
+   * \brief Returns a transform that applies this transform, followed by another transform.
+   *
+   * \param next the transform that is applied after this transform.
+   *
+   * \return the composed transform, i.e. `next * *this`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto then(const affine_transform& next) const noexcept
+      -> affine_transform;
+
+  /**
+   * \brief Returns the inverse of the transform.
+   *
+   * \return the transform that undoes this transform; `std::nullopt` if the transform
+   * isn't invertible, i.e. if it collapses points onto a line or a single point.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto inverse() const noexcept -> std::optional<affine_transform>
+  {
+    const auto det = determinant();
+    if (det == 0) {
+      return std::nullopt;
+    }
+
+    const auto& [a, b, c, d, tx, ty] = m_coefficients;
+    return affine_transform{d / det,
+                            -b / det,
+                            -c / det,
+                            a / det,
+                            ((c * ty) - (d * tx)) / det,
+                            ((b * tx) - (a * ty)) / det};
+  }
+
+  /**
+   * \brief Transforms a point.
+   *
+   * \param point the point that will be transformed.
+   *
+   * \return the transformed point.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto apply(const fpoint point) const noexcept -> fpoint
+  {
+    const auto& m = m_coefficients;
+    return {(m.a * point.x()) + (m.c * point.y()) + m.tx,
+            (m.b * point.x()) + (m.d * point.y()) + m.ty};
+  }
+
+  /**
+   * \brief Transforms a rectangle.
+   *
+   * \param rect the rectangle that will be transformed.
+   *
+   * \return the bounding box of the transformed rectangle.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto apply(const frect& rect) const noexcept -> frect
+  {
+    auto result = rect.get();
+    detail::transform_rect_scalar(m_coefficients, result.x, result.y, result.w, result.h);
+    return frect{result};
+  }
+
+  /**
+   * \brief Transforms an array of points in place.
+   *
+   * \details Four points are transformed at a time using SSE2 or NEON, when available.
+   *
+   * \param points a pointer to the first point, can be null if `count` is zero.
+   * \param count the amount of points.
+   *
+   * \since 6.4.0
+   */
+  void transform(SDL_FPoint* points, const usize count) const noexcept
+  {
+    if (count != 0) {
+      detail::transform_points(m_coefficients, points, count);
+    }
+  }
+
+  /**
+   * \brief Transforms an array of rectangles in place.
+   *
+   * \details Each rectangle is replaced with the bounding box of the transformed rectangle.
+   * Four rectangles are transformed at a time using SSE2 or NEON, when available.
+   *
+   * \param rects a pointer to the first rectangle, can be null if `count` is zero.
+   * \param count the amount of rectangles.
+   *
+   * \since 6.4.0
+   */
+  void transform(SDL_FRect* rects, const usize count) const noexcept
+  {
+    if (count != 0) {
+      detail::transform_rects(m_coefficients, rects, count);
+    }
+  }
+
+  /**
+   * \brief Transforms a collection of points or rectangles in place.
+   *
+   * \warning The container *must* store its data contiguously! The behaviour of this
+   * function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type, e.g. `std::vector<fpoint>` or
+   * `std::vector<frect>`.
+   *
+   * \param values the points or rectangles that will be transformed.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  void transform(Container& values) const noexcept
+  {
+    using value_type = typename Container::value_type;
+    static_assert(std::is_same_v<value_type, fpoint> || std::is_same_v<value_type, frect>);
+
+    if (!values.empty()) {
+      transform(values.front().data(), values.size());
+    }
+  }
+
+  /**
+   * \brief Returns the determinant of the linear part of the transform.
+   *
+   * \return the factor by which the transform scales areas; negative if the transform
+   * mirrors points.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto determinant() const noexcept -> float
+  {
+    return (m_coefficients.a * m_coefficients.d) - (m_coefficients.b * m_coefficients.c);
+  }
+
+  /**
+   * \brief Indicates whether or not the transform is the identity transform.
+   *
+   * \return `true` if the transform doesn't change anything; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto is_identity() const noexcept -> bool
+  {
+    const auto& m = m_coefficients;
+    return m.a == 1 && m.b == 0 && m.c == 0 && m.d == 1 && m.tx == 0 && m.ty == 0;
+  }
+
+  [[nodiscard]] constexpr auto a() const noexcept -> float
+  {
+    return m_coefficients.a;
+  }
+
+  [[nodiscard]] constexpr auto b() const noexcept -> float
+  {
+    return m_coefficients.b;
+  }
+
+  [[nodiscard]] constexpr auto c() const noexcept -> float
+  {
+    return m_coefficients.c;
+  }
+
+  [[nodiscard]] constexpr auto d() const noexcept -> float
+  {
+    return m_coefficients.d;
+  }
+
+  [[nodiscard]] constexpr auto tx() const noexcept -> float
+  {
+    return m_coefficients.tx;
+  }
+
+  [[nodiscard]] constexpr auto ty() const noexcept -> float
+  {
+    return m_coefficients.ty;
+  }
+
+  /// \cond FALSE
+
+  [[nodiscard]] constexpr auto coefficients() const noexcept
+      -> const detail::affine_coefficients&
+  {
+    return m_coefficients;
+  }
+
+  /// \endcond
+
+ private:
+  detail::affine_coefficients m_coefficients;
+};
+
+/**
+ * \brief Composes two transforms.
+ *
+ * \param lhs the transform that is applied last.
+ * \param rhs the transform that is applied first.
+ *
+ * \return a transform that applies `rhs`, followed by `lhs`.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto operator*(const affine_transform& lhs,
+                                       const affine_transform& rhs) noexcept
+    -> affine_transform
+{
+  return {(lhs.a() * rhs.a()) + (lhs.c() * rhs.b()),
+          (lhs.b() * rhs.a()) + (lhs.d() * rhs.b()),
+          (lhs.a() * rhs.c()) + (lhs.c() * rhs.d()),
+          (lhs.b() * rhs.c()) + (lhs.d() * rhs.d()),
+          (lhs.a() * rhs.tx()) + (lhs.c() * rhs.ty()) + lhs.tx(),
+          (lhs.b() * rhs.tx()) + (lhs.d() * rhs.ty()) + lhs.ty()};
+}
+
+constexpr auto affine_transform::then(const affine_transform& next) const noexcept
+    -> affine_transform
+{
+  return next * *this;
+}
+
+/// \name Affine transform comparison operators
+/// \{
+
+[[nodiscard]] constexpr auto operator==(const affine_transform& lhs,
+                                        const affine_transform& rhs) noexcept -> bool
+{
+  return lhs.a() == rhs.a() && lhs.b() == rhs.b() && lhs.c() == rhs.c() &&
+         lhs.d() == rhs.d() && lhs.tx() == rhs.tx() && lhs.ty() == rhs.ty();
+}
+
+[[nodiscard]] constexpr auto operator!=(const affine_transform& lhs,
+                                        const affine_transform& rhs) noexcept -> bool
+{
+  return !(lhs == rhs);
+}
+
+/// \} End of affine transform comparison operators
+
+/// \name String conversions
+/// \{
+
+[[nodiscard]] inline auto to_string(const affine_transform& transform) -> std::string
+{
+#if CENTURION_HAS_FEATURE_FORMAT
+  return std::format("affine_transform{{a: {}, b: {}, c: {}, d: {}, tx: {}, ty: {}}}",
+                     transform.a(),
+                     transform.b(),
+                     transform.c(),
+                     transform.d(),
+                     transform.tx(),
+                     transform.ty());
+#else
+  return "affine_transform{a: " + std::to_string(transform.a()) +
+         ", b: " + std::to_string(transform.b()) + ", c: " + std::to_string(transform.c()) +
+         ", d: " + std::to_string(transform.d()) + ", tx: " + std::to_string(transform.tx()) +
+         ", ty: " + std::to_string(transform.ty()) + "}";
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+inline auto operator<<(std::ostream& stream, const affine_transform& transform)
+    -> std::ostream&
+{
+  return stream << to_string(transform);
+}
+
+/// \} End of streaming
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_AFFINE_TRANSFORM_HEADER
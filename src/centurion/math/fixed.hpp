@@ -0,0 +1,422 @@
+#ifndef CENTURION_FIXED_HEADER
+#define CENTURION_FIXED_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <ostream>      // ostream
+#include <string>       // string, to_string
+#include <type_traits>  // is_integral_v, is_signed_v
+
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class basic_fixed
+ *
+ * \brief A signed fixed-point number.
+ *
+ * \details Fixed-point numbers have the same precision everywhere in their range, unlike
+ * floating-point numbers, whose precision decreases the further they are from zero. This
+ * makes them well suited for positions in large worlds, where `float` coordinates far
+ * from the origin can no longer represent small movements.
+ *
+ * \details The value is stored as an integer, scaled by `2^FractionBits`. Addition,
+ * subtraction and comparisons are exact integer operations. Multiplication rounds towards
+ * negative infinity, and division rounds towards zero.
+ * \code{cpp}
+ *   cen::fixed48_16 x{1'000'000};
+ *   x += cen::fixed48_16{0.25f};  // Exact, unlike 1'000'000.0f + 0.25f
+ * \endcode
+ *
+ * \tparam FractionBits the amount of bits used for the fractional part.
+ * \tparam Storage the signed integer type used to store the value.
+ *
+ * \see `fixed16_16`
+ * \see `fixed48_16`
+ * \see `basic_packed_point`
+ *
+ * \since 6.4.0
+ */
+template <int FractionBits, typename Storage = i32>
+class basic_fixed final
+{
+  static_assert(std::is_integral_v<Storage> && std::is_signed_v<Storage>);
+  static_assert(FractionBits > 0 && FractionBits < static_cast<int>(sizeof(Storage) * 8) - 1);
+
+ public:
+  using storage_type = Storage;
+
+  /// The amount of bits used for the fractional part.
+  inline constexpr static int fractionBits = FractionBits;
+
+  /// The raw representation of the value 1.
+  inline constexpr static storage_type one = storage_type{1} << FractionBits;
+
+  /**
+   * \brief Creates a fixed-point number with the value zero.
+   *
+   * \since 6.4.0
+   */
+  constexpr basic_fixed() noexcept = default;
+
+  /**
+   * \brief Creates a fixed-point number from an integer.
+   *
+   * \param value the integer value, which must be representable by the number.
+   *
+   * \since 6.4.0
+   */
+  constexpr explicit basic_fixed(const int value) noexcept
+      : m_raw{static_cast<storage_type>(static_cast<storage_type>(value) * one)}
+  {}
+
+  /**
+   * \brief Creates a fixed-point number from a floating-point number.
+   *
+   * \details The value is rounded to the nearest representable value.
+   *
+   * \param value the floating-point value, which must be representable by the number.
+   *
+   * \since 6.4.0
+   */
+  constexpr explicit basic_fixed(const double value) noexcept
+      : m_raw{static_cast<storage_type>((value * one) + ((value < 0) ? -0.5 : 0.5))}
+  {}
+
+  /// \copydoc basic_fixed(double)
+  constexpr explicit basic_fixed(const float value) noexcept
+      : basic_fixed{static_cast<double>(value)}
+  {}
+
+  /**
+   * \brief Creates a fixed-point number from its raw representation.
+   *
+   * \param raw the value scaled by `2^FractionBits`.
+   *
+   * \return a fixed-point number.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto from_raw(const storage_type raw) noexcept
+      -> basic_fixed
+  {
+    basic_fixed result;
+    result.m_raw = raw;
+    return result;
+  }
+
+  /**
+   * \brief Returns the raw representation of the number.
+   *
+   * \return the value scaled by `2^FractionBits`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto raw() const noexcept -> storage_type
+  {
+    return m_raw;
+  }
+
+  /**
+   * \brief Returns the integral part of the number.
+   *
+   * \return the largest integer that is less than or equal to the number.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto floor() const noexcept -> storage_type
+  {
+    return m_raw >> FractionBits;
+  }
+
+  /// \name Arithmetic operators
+  /// \{
+
+  [[nodiscard]] constexpr auto operator-() const noexcept -> basic_fixed
+  {
+    return from_raw(static_cast<storage_type>(-m_raw));
+  }
+
+  constexpr auto operator+=(const basic_fixed other) noexcept -> basic_fixed&
+  {
+    m_raw = static_cast<storage_type>(m_raw + other.m_raw);
+    return *this;
+  }
+
+  constexpr auto operator-=(const basic_fixed other) noexcept -> basic_fixed&
+  {
+    m_raw = static_cast<storage_type>(m_raw - other.m_raw);
+    return *this;
+  }
+
+  constexpr auto operator*=(const basic_fixed other) noexcept -> basic_fixed&
+  {
+    if constexpr (sizeof(storage_type) < sizeof(i64)) {
+      m_raw = static_cast<storage_type>((i64{m_raw} * other.m_raw) >> FractionBits);
+    }
+    else {
+      m_raw = wide_multiply(m_raw, other.m_raw);
+    }
+
+    return *this;
+  }
+
+  constexpr auto operator/=(const basic_fixed other) noexcept -> basic_fixed&
+  {
+    if constexpr (sizeof(storage_type) < sizeof(i64)) {
+      m_raw = static_cast<storage_type>((i64{m_raw} * one) / other.m_raw);
+    }
+    else {
+      m_raw = wide_divide(m_raw, other.m_raw);
+    }
+
+    return *this;
+  }
+
+  /// \} End of arithmetic operators
+
+  /// \name Conversions
+  /// \{
+
+  /**
+   * \brief Converts the number to an integer, rounding towards negative infinity.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr explicit operator int() const noexcept
+  {
+    return static_cast<int>(floor());
+  }
+
+  /**
+   * \brief Converts the number to a floating-point number.
+   *
+   * \note Precision is lost for numbers far from zero. Subtract a nearby origin, e.g. the
+   * camera position, before converting coordinates for rendering.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr explicit operator float() const noexcept
+  {
+    return static_cast<float>(static_cast<double>(m_raw) / one);
+  }
+
+  /// \copydoc operator float()
+  [[nodiscard]] constexpr explicit operator double() const noexcept
+  {
+    return static_cast<double>(m_raw) / one;
+  }
+
+  /// \} End of conversions
+
+ private:
+  storage_type m_raw{};
+
+  [[nodiscard]] constexpr static auto magnitude(const storage_type value) noexcept -> u64
+  {
+    return (value < 0) ? u64{0} - static_cast<u64>(value) : static_cast<u64>(value);
+  }
+
+  [[nodiscard]] constexpr static auto with_sign(const u64 value, const bool negative) noexcept
+      -> storage_type
+  {
+    return static_cast<storage_type>(negative ? u64{0} - value : value);
+  }
+
+  // Computes (lhs * rhs) >> FractionBits, with a 128-bit intermediate product
+  [[nodiscard]] constexpr static auto wide_multiply(const storage_type lhs,
+                                                    const storage_type rhs) noexcept
+      -> storage_type
+  {
+    constexpr u64 lowMask = 0xFFFF'FFFFu;
+
+    const auto a = magnitude(lhs);
+    const auto b = magnitude(rhs);
+
+    const auto low = (a & lowMask) * (b & lowMask);
+    const auto crossA = (a >> 32u) * (b & lowMask);
+    const auto crossB = (a & lowMask) * (b >> 32u);
+    const auto high = (a >> 32u) * (b >> 32u);
+
+    const auto middle = (low >> 32u) + (crossA & lowMask) + (crossB & lowMask);
+    const auto productLow = (middle << 32u) | (low & lowMask);
+    const auto productHigh = high + (crossA >> 32u) + (crossB >> 32u) + (middle >> 32u);
+
+    auto result = (productHigh << (64 - FractionBits)) | (productLow >> FractionBits);
+
+    // Round towards negative infinity, like the arithmetic shift of the narrow types
+    const auto negative = (lhs < 0) != (rhs < 0);
+    if (negative && (productLow & static_cast<u64>(one - 1)) != 0) {
+      ++result;
+    }
+
+    return with_sign(result, negative);
+  }
+
+  // Computes (lhs << FractionBits) / rhs, dividing the remainder one bit at a time
+  [[nodiscard]] constexpr static auto wide_divide(const storage_type lhs,
+                                                  const storage_type rhs) noexcept
+      -> storage_type
+  {
+    const auto a = magnitude(lhs);
+    const auto b = magnitude(rhs);
+
+    auto quotient = a / b;
+    auto remainder = a % b;
+
+    for (auto bit = 0; bit < FractionBits; ++bit) {
+      // The remainder is less than the divisor, which is at most 2^63
+      remainder <<= 1u;
+      quotient <<= 1u;
+
+      if (remainder >= b) {
+        remainder -= b;
+        quotient |= 1u;
+      }
+    }
+
+    return with_sign(quotient, (lhs < 0) != (rhs < 0));
+  }
+};
+
+/**
+ * \typedef fixed16_16
+ *
+ * \brief A fixed-point number with 16 integral bits and 16 fractional bits.
+ *
+ * \details The range is roughly [-32768, 32768), with a precision of `1 / 65536`.
+ *
+ * \since 6.4.0
+ */
+using fixed16_16 = basic_fixed<16, i32>;
+
+/**
+ * \typedef fixed48_16
+ *
+ * \brief A fixed-point number with 48 integral bits and 16 fractional bits.
+ *
+ * \details This type is intended for world coordinates, with a precision of `1 / 65536`
+ * regardless of the distance from the origin.
+ *
+ * \details Multiplication and division use 128-bit intermediate results, so they only
+ * overflow if the result itself isn't representable.
+ *
+ * \since 6.4.0
+ */
+using fixed48_16 = basic_fixed<16, i64>;
+
+/// \name Fixed-point arithmetic operators
+/// \{
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator+(basic_fixed<F, S> lhs,
+                                       const basic_fixed<F, S> rhs) noexcept
+    -> basic_fixed<F, S>
+{
+  return lhs += rhs;
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator-(basic_fixed<F, S> lhs,
+                                       const basic_fixed<F, S> rhs) noexcept
+    -> basic_fixed<F, S>
+{
+  return lhs -= rhs;
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator*(basic_fixed<F, S> lhs,
+                                       const basic_fixed<F, S> rhs) noexcept
+    -> basic_fixed<F, S>
+{
+  return lhs *= rhs;
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator/(basic_fixed<F, S> lhs,
+                                       const basic_fixed<F, S> rhs) noexcept
+    -> basic_fixed<F, S>
+{
+  return lhs /= rhs;
+}
+
+/// \} End of fixed-point arithmetic operators
+
+/// \name Fixed-point comparison operators
+/// \{
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator==(const basic_fixed<F, S> lhs,
+                                        const basic_fixed<F, S> rhs) noexcept -> bool
+{
+  return lhs.raw() == rhs.raw();
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator!=(const basic_fixed<F, S> lhs,
+                                        const basic_fixed<F, S> rhs) noexcept -> bool
+{
+  return lhs.raw() != rhs.raw();
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator<(const basic_fixed<F, S> lhs,
+                                       const basic_fixed<F, S> rhs) noexcept -> bool
+{
+  return lhs.raw() < rhs.raw();
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator<=(const basic_fixed<F, S> lhs,
+                                        const basic_fixed<F, S> rhs) noexcept -> bool
+{
+  return lhs.raw() <= rhs.raw();
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator>(const basic_fixed<F, S> lhs,
+                                       const basic_fixed<F, S> rhs) noexcept -> bool
+{
+  return lhs.raw() > rhs.raw();
+}
+
+template <int F, typename S>
+[[nodiscard]] constexpr auto operator>=(const basic_fixed<F, S> lhs,
+                                        const basic_fixed<F, S> rhs) noexcept -> bool
+{
+  return lhs.raw() >= rhs.raw();
+}
+
+/// \} End of fixed-point comparison operators
+
+/// \name String conversions
+/// \{
+
+template <int F, typename S>
+[[nodiscard]] auto to_string(const basic_fixed<F, S> value) -> std::string
+{
+  return std::to_string(static_cast<double>(value));
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+template <int F, typename S>
+auto operator<<(std::ostream& stream, const basic_fixed<F, S> value) -> std::ostream&
+{
+  return stream << to_string(value);
+}
+
+/// \} End of streaming
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_FIXED_HEADER
@@ -0,0 +1,215 @@
+#ifndef CENTURION_PACKED_POINT_HEADER
+#define CENTURION_PACKED_POINT_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../core/cast.hpp"
+#include "../core/integers.hpp"
+#include "fixed.hpp"
+#include "point.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \struct basic_packed_point
+ *
+ * \brief A compact two-dimensional point, for storing large amounts of coordinates.
+ *
+ * \details Unlike `basic_point`, which always uses `int` or `float` in order to match the
+ * SDL point types, this type uses its value type directly. This makes it possible to store
+ * e.g. tile coordinates in 16-bit integers, so that four times as many coordinates fit in
+ * the cache, or world coordinates as fixed-point numbers, which don't lose precision far
+ * from the origin.
+ *
+ * \details Packed points are converted to `ipoint` or `fpoint` using `cast()`, which
+ * should be done when the coordinates are submitted for rendering.
+ * \code{cpp}
+ *   const cen::xpoint player{cen::fixed48_16{1'000'000}, cen::fixed48_16{2'000'000}};
+ *   const auto screen = cen::cast<cen::fpoint>(player - camera);
+ * \endcode
+ *
+ * \tparam T the type of the coordinates, e.g. `i16` or `fixed48_16`.
+ *
+ * \see `spoint`
+ * \see `xpoint`
+ * \see `basic_packed_rect`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+struct basic_packed_point final
+{
+  using value_type = T;
+
+  value_type x{};  ///< The x-coordinate of the point.
+  value_type y{};  ///< The y-coordinate of the point.
+};
+
+/**
+ * \typedef spoint
+ *
+ * \brief Alias for a point with 16-bit integer coordinates, e.g. for tile coordinates.
+ *
+ * \since 6.4.0
+ */
+using spoint = basic_packed_point<i16>;
+
+/**
+ * \typedef xpoint
+ *
+ * \brief Alias for a point with fixed-point coordinates, e.g. for world coordinates.
+ *
+ * \since 6.4.0
+ */
+using xpoint = basic_packed_point<fixed48_16>;
+
+static_assert(sizeof(spoint) == 2 * sizeof(i16));
+
+/**
+ * \brief Serializes a packed point.
+ *
+ * \details This function expects that the archive provides an overloaded `operator()`,
+ * used for serializing data. This API is based on the Cereal serialization library.
+ *
+ * \tparam Archive the type of the archive.
+ * \tparam T the type of the point coordinates.
+ *
+ * \param archive the archive used to serialize the point.
+ * \param point the point that will be serialized.
+ *
+ * \since 6.4.0
+ */
+template <typename Archive, typename T>
+void serialize(Archive& archive, basic_packed_point<T>& point)
+{
+  archive(point.x, point.y);
+}
+
+/// \name Packed point operators
+/// \{
+
+template <typename T>
+[[nodiscard]] constexpr auto operator+(const basic_packed_point<T>& lhs,
+                                       const basic_packed_point<T>& rhs) noexcept
+    -> basic_packed_point<T>
+{
+  return {static_cast<T>(lhs.x + rhs.x), static_cast<T>(lhs.y + rhs.y)};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator-(const basic_packed_point<T>& lhs,
+                                       const basic_packed_point<T>& rhs) noexcept
+    -> basic_packed_point<T>
+{
+  return {static_cast<T>(lhs.x - rhs.x), static_cast<T>(lhs.y - rhs.y)};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator==(const basic_packed_point<T>& lhs,
+                                        const basic_packed_point<T>& rhs) noexcept -> bool
+{
+  return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator!=(const basic_packed_point<T>& lhs,
+                                        const basic_packed_point<T>& rhs) noexcept -> bool
+{
+  return !(lhs == rhs);
+}
+
+/// \} End of packed point operators
+
+/// \name Packed point cast specializations
+/// \{
+
+/**
+ * \brief Converts an `spoint` instance to the corresponding `ipoint`.
+ *
+ * \param from the point that will be converted.
+ *
+ * \return an `ipoint` instance with the same coordinates.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const spoint& from) noexcept -> ipoint
+{
+  return ipoint{from.x, from.y};
+}
+
+/**
+ * \brief Converts an `spoint` instance to the corresponding `fpoint`.
+ *
+ * \param from the point that will be converted.
+ *
+ * \return an `fpoint` instance with the same coordinates.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const spoint& from) noexcept -> fpoint
+{
+  return fpoint{static_cast<float>(from.x), static_cast<float>(from.y)};
+}
+
+/**
+ * \brief Converts an `ipoint` instance to the corresponding `spoint`.
+ *
+ * \pre The coordinates of the point must fit in 16-bit integers.
+ *
+ * \param from the point that will be converted.
+ *
+ * \return an `spoint` instance with the same coordinates.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const ipoint& from) noexcept -> spoint
+{
+  return spoint{static_cast<i16>(from.x()), static_cast<i16>(from.y())};
+}
+
+/**
+ * \brief Converts an `xpoint` instance to the corresponding `fpoint`.
+ *
+ * \note Precision is lost for points far from the origin, so subtract e.g. the camera
+ * position from the point before converting it.
+ *
+ * \param from the point that will be converted.
+ *
+ * \return an `fpoint` instance with the nearest representable coordinates.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const xpoint& from) noexcept -> fpoint
+{
+  return fpoint{static_cast<float>(from.x), static_cast<float>(from.y)};
+}
+
+/**
+ * \brief Converts an `fpoint` instance to the corresponding `xpoint`.
+ *
+ * \param from the point that will be converted.
+ *
+ * \return an `xpoint` instance with the nearest representable coordinates.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const fpoint& from) noexcept -> xpoint
+{
+  return xpoint{fixed48_16{from.x()}, fixed48_16{from.y()}};
+}
+
+/// \} End of packed point cast specializations
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_PACKED_POINT_HEADER
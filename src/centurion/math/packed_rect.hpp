@@ -0,0 +1,286 @@
+#ifndef CENTURION_PACKED_RECT_HEADER
+#define CENTURION_PACKED_RECT_HEADER
+
+#include <SDL2/SDL.h>
+
+#include "../core/cast.hpp"
+#include "../core/integers.hpp"
+#include "fixed.hpp"
+#include "packed_point.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \struct basic_packed_rect
+ *
+ * \brief A compact rectangle, for storing large amounts of rectangles.
+ *
+ * \details This is the rectangle counterpart of `basic_packed_point`, e.g. an `srect`
+ * only occupies 8 bytes, compared to the 16 bytes of an `irect` or `frect`. Packed
+ * rectangles are converted to `irect` or `frect` using `cast()`.
+ * \code{cpp}
+ *   std::vector<cen::srect> tiles;  // Tile bounds, in pixels
+ *   std::vector<cen::frect> visible;
+ *
+ *   for (const auto& tile : tiles) {
+ *     visible.push_back(cen::cast<cen::frect>(tile - cameraOffset));
+ *   }
+ * \endcode
+ *
+ * \tparam T the type of the components, e.g. `i16` or `fixed48_16`.
+ *
+ * \see `srect`
+ * \see `xrect`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+struct basic_packed_rect final
+{
+  using value_type = T;
+  using point_type = basic_packed_point<T>;
+
+  value_type x{};       ///< The x-coordinate of the rectangle.
+  value_type y{};       ///< The y-coordinate of the rectangle.
+  value_type width{};   ///< The width of the rectangle.
+  value_type height{};  ///< The height of the rectangle.
+
+  /**
+   * \brief Returns the position of the rectangle.
+   *
+   * \return the position of the upper-left corner.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto position() const noexcept -> point_type
+  {
+    return {x, y};
+  }
+
+  /**
+   * \brief Indicates whether or not the rectangle contains a point.
+   *
+   * \details The same semantics as `basic_rect::contains()` are used, i.e. points on the
+   * border of the rectangle are contained in it.
+   *
+   * \param point the point that will be checked.
+   *
+   * \return `true` if the rectangle contains the point; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto contains(const point_type& point) const noexcept -> bool
+  {
+    return !(point.x < x || point.y < y || point.x > static_cast<T>(x + width) ||
+             point.y > static_cast<T>(y + height));
+  }
+};
+
+/**
+ * \typedef srect
+ *
+ * \brief Alias for a rectangle with 16-bit integer components, e.g. for tile bounds.
+ *
+ * \since 6.4.0
+ */
+using srect = basic_packed_rect<i16>;
+
+/**
+ * \typedef xrect
+ *
+ * \brief Alias for a rectangle with fixed-point components, e.g. for world bounds.
+ *
+ * \since 6.4.0
+ */
+using xrect = basic_packed_rect<fixed48_16>;
+
+static_assert(sizeof(srect) == 4 * sizeof(i16));
+
+/**
+ * \brief Serializes a packed rectangle.
+ *
+ * \details This function expects that the archive provides an overloaded `operator()`,
+ * used for serializing data. This API is based on the Cereal serialization library.
+ *
+ * \tparam Archive the type of the archive.
+ * \tparam T the type of the rectangle components.
+ *
+ * \param archive the archive used to serialize the rectangle.
+ * \param rect the rectangle that will be serialized.
+ *
+ * \since 6.4.0
+ */
+template <typename Archive, typename T>
+void serialize(Archive& archive, basic_packed_rect<T>& rect)
+{
+  archive(rect.x, rect.y, rect.width, rect.height);
+}
+
+/// \name Packed rectangle operators
+/// \{
+
+/**
+ * \brief Moves a rectangle.
+ *
+ * \param rect the rectangle that will be moved.
+ * \param offset the offset that will be added to the position of the rectangle.
+ *
+ * \return the moved rectangle.
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] constexpr auto operator+(const basic_packed_rect<T>& rect,
+                                       const basic_packed_point<T>& offset) noexcept
+    -> basic_packed_rect<T>
+{
+  return {static_cast<T>(rect.x + offset.x),
+          static_cast<T>(rect.y + offset.y),
+          rect.width,
+          rect.height};
+}
+
+/**
+ * \brief Moves a rectangle, e.g. to make its position relative to a camera.
+ *
+ * \param rect the rectangle that will be moved.
+ * \param offset the offset that will be subtracted from the position of the rectangle.
+ *
+ * \return the moved rectangle.
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] constexpr auto operator-(const basic_packed_rect<T>& rect,
+                                       const basic_packed_point<T>& offset) noexcept
+    -> basic_packed_rect<T>
+{
+  return {static_cast<T>(rect.x - offset.x),
+          static_cast<T>(rect.y - offset.y),
+          rect.width,
+          rect.height};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator==(const basic_packed_rect<T>& lhs,
+                                        const basic_packed_rect<T>& rhs) noexcept -> bool
+{
+  return lhs.x == rhs.x && lhs.y == rhs.y && lhs.width == rhs.width &&
+         lhs.height == rhs.height;
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator!=(const basic_packed_rect<T>& lhs,
+                                        const basic_packed_rect<T>& rhs) noexcept -> bool
+{
+  return !(lhs == rhs);
+}
+
+/// \} End of packed rectangle operators
+
+/// \name Packed rectangle cast specializations
+/// \{
+
+/**
+ * \brief Converts an `srect` instance to the corresponding `irect`.
+ *
+ * \param from the rectangle that will be converted.
+ *
+ * \return an `irect` instance with the same components.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const srect& from) noexcept -> irect
+{
+  return irect{from.x, from.y, from.width, from.height};
+}
+
+/**
+ * \brief Converts an `srect` instance to the corresponding `frect`.
+ *
+ * \param from the rectangle that will be converted.
+ *
+ * \return an `frect` instance with the same components.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const srect& from) noexcept -> frect
+{
+  return frect{static_cast<float>(from.x),
+               static_cast<float>(from.y),
+               static_cast<float>(from.width),
+               static_cast<float>(from.height)};
+}
+
+/**
+ * \brief Converts an `irect` instance to the corresponding `srect`.
+ *
+ * \pre The components of the rectangle must fit in 16-bit integers.
+ *
+ * \param from the rectangle that will be converted.
+ *
+ * \return an `srect` instance with the same components.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const irect& from) noexcept -> srect
+{
+  return srect{static_cast<i16>(from.x()),
+               static_cast<i16>(from.y()),
+               static_cast<i16>(from.width()),
+               static_cast<i16>(from.height())};
+}
+
+/**
+ * \brief Converts an `xrect` instance to the corresponding `frect`.
+ *
+ * \note Precision is lost for rectangles far from the origin, so subtract e.g. the camera
+ * position from the rectangle before converting it.
+ *
+ * \param from the rectangle that will be converted.
+ *
+ * \return an `frect` instance with the nearest representable components.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const xrect& from) noexcept -> frect
+{
+  return frect{static_cast<float>(from.x),
+               static_cast<float>(from.y),
+               static_cast<float>(from.width),
+               static_cast<float>(from.height)};
+}
+
+/**
+ * \brief Converts an `frect` instance to the corresponding `xrect`.
+ *
+ * \param from the rectangle that will be converted.
+ *
+ * \return an `xrect` instance with the nearest representable components.
+ *
+ * \since 6.4.0
+ */
+template <>
+[[nodiscard]] constexpr auto cast(const frect& from) noexcept -> xrect
+{
+  return xrect{fixed48_16{from.x()},
+               fixed48_16{from.y()},
+               fixed48_16{from.width()},
+               fixed48_16{from.height()}};
+}
+
+/// \} End of packed rectangle cast specializations
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_PACKED_RECT_HEADER
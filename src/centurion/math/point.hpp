@@ -9,6 +9,7 @@
 #include <type_traits>  // conditional_t, is_integral_v, is_floating_point_v, ...
 
 #include "../compiler/features.hpp"
+#include "../compiler/linkage.hpp"
 
 #if CENTURION_HAS_FEATURE_FORMAT
 
@@ -374,7 +375,15 @@ template <typename T>
 /// \name String conversions
 /// \{
 
-[[nodiscard]] inline auto to_string(const ipoint point) -> std::string
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto to_string(const ipoint point)
+    -> std::string;
+
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto to_string(const fpoint point)
+    -> std::string;
+
+#if CENTURION_LIB_DEFINITIONS
+
+CENTURION_LIB_INLINE auto to_string(const ipoint point) -> std::string
 {
 #if CENTURION_HAS_FEATURE_FORMAT
   return std::format("ipoint{{x: {}, y: {}}}", point.x(), point.y());
@@ -383,7 +392,7 @@ template <typename T>
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 }
 
-[[nodiscard]] inline auto to_string(const fpoint point) -> std::string
+CENTURION_LIB_INLINE auto to_string(const fpoint point) -> std::string
 {
 #if CENTURION_HAS_FEATURE_FORMAT
   return std::format("fpoint{{x: {}, y: {}}}", point.x(), point.y());
@@ -392,6 +401,8 @@ template <typename T>
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 }
 
+#endif  // CENTURION_LIB_DEFINITIONS
+
 /// \} End of string conversions
 
 /// \name Streaming
@@ -0,0 +1,303 @@
+#ifndef CENTURION_POINT_ARRAY_HEADER
+#define CENTURION_POINT_ARRAY_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../detail/geometry_kernels.hpp"
+#include "../detail/transform_kernels.hpp"
+#include "affine_transform.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class point_array
+ *
+ * \brief A structure-of-arrays container of `float`-based points.
+ *
+ * \details The x-coordinates and y-coordinates are stored in separate arrays, so batch
+ * operations process four points at a time using SSE2 or NEON, when available. The points
+ * can be copied to an array of `SDL_FPoint` or `fpoint`, e.g. for
+ * `basic_renderer::draw_points()`.
+ *
+ * \see `rect_array`
+ *
+ * \since 6.4.0
+ */
+class point_array final
+{
+ public:
+  using value_type = fpoint;
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty point array.
+   *
+   * \since 6.4.0
+   */
+  point_array() = default;
+
+  /**
+   * \brief Creates a point array from an array of SDL points.
+   *
+   * \param points a pointer to the first point, can be null if `count` is zero.
+   * \param count the amount of points.
+   *
+   * \since 6.4.0
+   */
+  point_array(const SDL_FPoint* points, const size_type count)
+  {
+    assign(points, count);
+  }
+
+  /**
+   * \brief Replaces the contents with an array of SDL points.
+   *
+   * \param points a pointer to the first point, can be null if `count` is zero.
+   * \param count the amount of points.
+   *
+   * \since 6.4.0
+   */
+  void assign(const SDL_FPoint* points, const size_type count)
+  {
+    resize(count);
+    if (count != 0) {
+      detail::deinterleave_points(points, count, m_x.data(), m_y.data());
+    }
+  }
+
+  /**
+   * \brief Adds a point to the end of the array.
+   *
+   * \param point the point that will be added.
+   *
+   * \since 6.4.0
+   */
+  void push_back(const fpoint point)
+  {
+    m_x.push_back(point.x());
+    m_y.push_back(point.y());
+  }
+
+  /**
+   * \brief Replaces a point in the array.
+   *
+   * \param index the index of the point.
+   * \param point the new point.
+   *
+   * \since 6.4.0
+   */
+  void set(const size_type index, const fpoint point) noexcept
+  {
+    assert(index < size());
+    m_x[index] = point.x();
+    m_y[index] = point.y();
+  }
+
+  /**
+   * \brief Returns a point in the array.
+   *
+   * \param index the index of the point.
+   *
+   * \return a copy of the point.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> fpoint
+  {
+    assert(index < size());
+    return {m_x[index], m_y[index]};
+  }
+
+  /**
+   * \brief Moves all points.
+   *
+   * \param offset the offset that will be added to the points.
+   *
+   * \since 6.4.0
+   */
+  void translate(const fpoint offset) noexcept
+  {
+    detail::add(m_x.data(), size(), offset.x());
+    detail::add(m_y.data(), size(), offset.y());
+  }
+
+  /**
+   * \brief Scales all points, relative to the origin.
+   *
+   * \param xFactor the horizontal scale factor.
+   * \param yFactor the vertical scale factor.
+   *
+   * \since 6.4.0
+   */
+  void scale(const float xFactor, const float yFactor) noexcept
+  {
+    detail::multiply(m_x.data(), size(), xFactor);
+    detail::multiply(m_y.data(), size(), yFactor);
+  }
+
+  /**
+   * \brief Transforms all points.
+   *
+   * \param transform the transform that will be applied to the points.
+   *
+   * \since 6.4.0
+   */
+  void transform(const affine_transform& transform) noexcept
+  {
+    detail::transform_point_arrays(transform.coefficients(), m_x.data(), m_y.data(), size());
+  }
+
+  /**
+   * \brief Determines which points are contained in an area.
+   *
+   * \details The same semantics as `basic_rect::contains()` are used, i.e. points on the
+   * border of the area are contained in it.
+   *
+   * \param area the area that the points will be tested against.
+   * \param[out] mask a vector that will be resized to the amount of points, where each
+   * element is 1 if the corresponding point is contained in the area and 0 otherwise.
+   *
+   * \return the amount of points that are contained in the area.
+   *
+   * \since 6.4.0
+   */
+  auto within(const frect& area, std::vector<u8>& mask) const -> size_type
+  {
+    mask.resize(size());
+    return empty() ? 0
+                   : detail::points_within(m_x.data(),
+                                           m_y.data(),
+                                           size(),
+                                           area.get(),
+                                           mask.data());
+  }
+
+  /**
+   * \brief Returns the bounding rectangle of all points.
+   *
+   * \return the smallest rectangle that contains all points; an empty rectangle if there
+   * are no points.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bounds() const noexcept -> frect
+  {
+    detail::geometry_bounds bounds;
+    detail::point_bounds(m_x.data(), m_y.data(), size(), bounds);
+
+    if (bounds.valid()) {
+      return {bounds.minX, bounds.minY, bounds.maxX - bounds.minX, bounds.maxY - bounds.minY};
+    }
+    else {
+      return {};
+    }
+  }
+
+  /**
+   * \brief Copies the points to an array of SDL points.
+   *
+   * \param[out] points a pointer to an array of at least `size()` points.
+   *
+   * \since 6.4.0
+   */
+  void copy_to(SDL_FPoint* points) const noexcept
+  {
+    if (!empty()) {
+      assert(points);
+      detail::interleave_points(m_x.data(), m_y.data(), size(), points);
+    }
+  }
+
+  /**
+   * \brief Copies the points to a vector, e.g. for use with
+   * `basic_renderer::draw_points()`.
+   *
+   * \details The vector is resized to the amount of points, so reusing the same vector
+   * avoids allocations.
+   *
+   * \param[out] points the vector that the points will be copied to.
+   *
+   * \since 6.4.0
+   */
+  void copy_to(std::vector<fpoint>& points) const
+  {
+    static_assert(sizeof(fpoint) == sizeof(SDL_FPoint));
+
+    points.resize(size());
+    if (!empty()) {
+      copy_to(points.front().data());
+    }
+  }
+
+  void reserve(const size_type capacity)
+  {
+    m_x.reserve(capacity);
+    m_y.reserve(capacity);
+  }
+
+  void resize(const size_type count)
+  {
+    m_x.resize(count);
+    m_y.resize(count);
+  }
+
+  void clear() noexcept
+  {
+    m_x.clear();
+    m_y.clear();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_x.size();
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_x.empty();
+  }
+
+  /// \name Component arrays
+  /// \{
+
+  [[nodiscard]] auto x_data() noexcept -> float*
+  {
+    return m_x.data();
+  }
+
+  [[nodiscard]] auto x_data() const noexcept -> const float*
+  {
+    return m_x.data();
+  }
+
+  [[nodiscard]] auto y_data() noexcept -> float*
+  {
+    return m_y.data();
+  }
+
+  [[nodiscard]] auto y_data() const noexcept -> const float*
+  {
+    return m_y.data();
+  }
+
+  /// \} End of component arrays
+
+ private:
+  std::vector<float> m_x;
+  std::vector<float> m_y;
+};
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_POINT_ARRAY_HEADER
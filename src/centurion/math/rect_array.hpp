@@ -0,0 +1,406 @@
+#ifndef CENTURION_RECT_ARRAY_HEADER
+#define CENTURION_RECT_ARRAY_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../detail/geometry_kernels.hpp"
+#include "../detail/transform_kernels.hpp"
+#include "affine_transform.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class rect_array
+ *
+ * \brief A structure-of-arrays container of `float`-based rectangles.
+ *
+ * \details Rectangles such as `frect` store their components next to each other, which is
+ * what SDL expects, but makes operations on many rectangles hard to vectorize. This
+ * container stores the x-coordinates, y-coordinates, widths and heights in separate
+ * arrays instead, so batch operations such as translation and culling process four
+ * rectangles at a time using SSE2 or NEON, when available.
+ *
+ * \details The rectangles can be copied to an array of `SDL_FRect` or `frect` when they
+ * are submitted to a renderer, which is also vectorized.
+ * \code{cpp}
+ *   cen::rect_array bullets;
+ *   std::vector<cen::u8> visible;
+ *   std::vector<cen::frect> rects;
+ *
+ *   bullets.translate({0, -speed * dt});
+ *   bullets.intersects(renderer.translation_viewport(), visible);
+ *
+ *   bullets.copy_to(rects);
+ *   renderer.fill_rects(rects);
+ * \endcode
+ *
+ * \see `point_array`
+ *
+ * \since 6.4.0
+ */
+class rect_array final
+{
+ public:
+  using value_type = frect;
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty rectangle array.
+   *
+   * \since 6.4.0
+   */
+  rect_array() = default;
+
+  /**
+   * \brief Creates a rectangle array from an array of SDL rectangles.
+   *
+   * \param rects a pointer to the first rectangle, can be null if `count` is zero.
+   * \param count the amount of rectangles.
+   *
+   * \since 6.4.0
+   */
+  rect_array(const SDL_FRect* rects, const size_type count)
+  {
+    assign(rects, count);
+  }
+
+  /**
+   * \brief Replaces the contents with an array of SDL rectangles.
+   *
+   * \param rects a pointer to the first rectangle, can be null if `count` is zero.
+   * \param count the amount of rectangles.
+   *
+   * \since 6.4.0
+   */
+  void assign(const SDL_FRect* rects, const size_type count)
+  {
+    resize(count);
+    if (count != 0) {
+      detail::deinterleave_rects(rects,
+                                 count,
+                                 m_x.data(),
+                                 m_y.data(),
+                                 m_width.data(),
+                                 m_height.data());
+    }
+  }
+
+  /**
+   * \brief Adds a rectangle to the end of the array.
+   *
+   * \param rect the rectangle that will be added.
+   *
+   * \since 6.4.0
+   */
+  void push_back(const frect& rect)
+  {
+    m_x.push_back(rect.x());
+    m_y.push_back(rect.y());
+    m_width.push_back(rect.width());
+    m_height.push_back(rect.height());
+  }
+
+  /**
+   * \brief Replaces a rectangle in the array.
+   *
+   * \param index the index of the rectangle.
+   * \param rect the new rectangle.
+   *
+   * \since 6.4.0
+   */
+  void set(const size_type index, const frect& rect) noexcept
+  {
+    assert(index < size());
+    m_x[index] = rect.x();
+    m_y[index] = rect.y();
+    m_width[index] = rect.width();
+    m_height[index] = rect.height();
+  }
+
+  /**
+   * \brief Returns a rectangle in the array.
+   *
+   * \param index the index of the rectangle.
+   *
+   * \return a copy of the rectangle.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> frect
+  {
+    assert(index < size());
+    return {m_x[index], m_y[index], m_width[index], m_height[index]};
+  }
+
+  /**
+   * \brief Moves all rectangles.
+   *
+   * \param offset the offset that will be added to the positions of the rectangles.
+   *
+   * \since 6.4.0
+   */
+  void translate(const fpoint offset) noexcept
+  {
+    detail::add(m_x.data(), size(), offset.x());
+    detail::add(m_y.data(), size(), offset.y());
+  }
+
+  /**
+   * \brief Scales the positions and sizes of all rectangles.
+   *
+   * \param xFactor the horizontal scale factor.
+   * \param yFactor the vertical scale factor.
+   *
+   * \since 6.4.0
+   */
+  void scale(const float xFactor, const float yFactor) noexcept
+  {
+    detail::multiply(m_x.data(), size(), xFactor);
+    detail::multiply(m_width.data(), size(), xFactor);
+    detail::multiply(m_y.data(), size(), yFactor);
+    detail::multiply(m_height.data(), size(), yFactor);
+  }
+
+  /**
+   * \brief Transforms all rectangles.
+   *
+   * \details Each rectangle is replaced with the bounding box of the transformed
+   * rectangle.
+   *
+   * \param transform the transform that will be applied to the rectangles.
+   *
+   * \since 6.4.0
+   */
+  void transform(const affine_transform& transform) noexcept
+  {
+    detail::transform_rect_arrays(transform.coefficients(),
+                                  m_x.data(),
+                                  m_y.data(),
+                                  m_width.data(),
+                                  m_height.data(),
+                                  size());
+  }
+
+  /**
+   * \brief Determines which rectangles intersect an area.
+   *
+   * \details The same semantics as `intersects()` are used, i.e. rectangles that only
+   * share a border with the area don't intersect it.
+   *
+   * \param area the area that the rectangles will be tested against.
+   * \param[out] mask a vector that will be resized to the amount of rectangles, where each
+   * element is 1 if the corresponding rectangle intersects the area and 0 otherwise.
+   *
+   * \return the amount of rectangles that intersect the area.
+   *
+   * \since 6.4.0
+   */
+  auto intersects(const frect& area, std::vector<u8>& mask) const -> size_type
+  {
+    mask.resize(size());
+    return empty() ? 0
+                   : detail::rects_intersect(m_x.data(),
+                                             m_y.data(),
+                                             m_width.data(),
+                                             m_height.data(),
+                                             size(),
+                                             area.get(),
+                                             mask.data());
+  }
+
+  /**
+   * \brief Determines which rectangles contain a point.
+   *
+   * \details The same semantics as `basic_rect::contains()` are used, i.e. points on the
+   * border of a rectangle are contained in it.
+   *
+   * \param point the point that the rectangles will be tested against.
+   * \param[out] mask a vector that will be resized to the amount of rectangles, where each
+   * element is 1 if the corresponding rectangle contains the point and 0 otherwise.
+   *
+   * \return the amount of rectangles that contain the point.
+   *
+   * \since 6.4.0
+   */
+  auto contains(const fpoint point, std::vector<u8>& mask) const -> size_type
+  {
+    mask.resize(size());
+    return empty() ? 0
+                   : detail::rects_contain(m_x.data(),
+                                           m_y.data(),
+                                           m_width.data(),
+                                           m_height.data(),
+                                           size(),
+                                           point.get(),
+                                           mask.data());
+  }
+
+  /**
+   * \brief Returns the union of all rectangles.
+   *
+   * \details Like `get_union()`, rectangles without an area are ignored.
+   *
+   * \return the smallest rectangle that contains all rectangles with an area; an empty
+   * rectangle if there are no such rectangles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_union() const noexcept -> frect
+  {
+    detail::geometry_bounds bounds;
+    detail::rect_bounds(m_x.data(),
+                        m_y.data(),
+                        m_width.data(),
+                        m_height.data(),
+                        size(),
+                        bounds);
+
+    if (bounds.valid()) {
+      return {bounds.minX, bounds.minY, bounds.maxX - bounds.minX, bounds.maxY - bounds.minY};
+    }
+    else {
+      return {};
+    }
+  }
+
+  /**
+   * \brief Copies the rectangles to an array of SDL rectangles.
+   *
+   * \param[out] rects a pointer to an array of at least `size()` rectangles.
+   *
+   * \since 6.4.0
+   */
+  void copy_to(SDL_FRect* rects) const noexcept
+  {
+    if (!empty()) {
+      assert(rects);
+      detail::interleave_rects(m_x.data(),
+                               m_y.data(),
+                               m_width.data(),
+                               m_height.data(),
+                               size(),
+                               rects);
+    }
+  }
+
+  /**
+   * \brief Copies the rectangles to a vector, e.g. for use with
+   * `basic_renderer::fill_rects()`.
+   *
+   * \details The vector is resized to the amount of rectangles, so reusing the same vector
+   * avoids allocations.
+   *
+   * \param[out] rects the vector that the rectangles will be copied to.
+   *
+   * \since 6.4.0
+   */
+  void copy_to(std::vector<frect>& rects) const
+  {
+    static_assert(sizeof(frect) == sizeof(SDL_FRect));
+
+    rects.resize(size());
+    if (!empty()) {
+      copy_to(rects.front().data());
+    }
+  }
+
+  void reserve(const size_type capacity)
+  {
+    m_x.reserve(capacity);
+    m_y.reserve(capacity);
+    m_width.reserve(capacity);
+    m_height.reserve(capacity);
+  }
+
+  void resize(const size_type count)
+  {
+    m_x.resize(count);
+    m_y.resize(count);
+    m_width.resize(count);
+    m_height.resize(count);
+  }
+
+  void clear() noexcept
+  {
+    m_x.clear();
+    m_y.clear();
+    m_width.clear();
+    m_height.clear();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_x.size();
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_x.empty();
+  }
+
+  /// \name Component arrays
+  /// \{
+
+  [[nodiscard]] auto x_data() noexcept -> float*
+  {
+    return m_x.data();
+  }
+
+  [[nodiscard]] auto x_data() const noexcept -> const float*
+  {
+    return m_x.data();
+  }
+
+  [[nodiscard]] auto y_data() noexcept -> float*
+  {
+    return m_y.data();
+  }
+
+  [[nodiscard]] auto y_data() const noexcept -> const float*
+  {
+    return m_y.data();
+  }
+
+  [[nodiscard]] auto width_data() noexcept -> float*
+  {
+    return m_width.data();
+  }
+
+  [[nodiscard]] auto width_data() const noexcept -> const float*
+  {
+    return m_width.data();
+  }
+
+  [[nodiscard]] auto height_data() noexcept -> float*
+  {
+    return m_height.data();
+  }
+
+  [[nodiscard]] auto height_data() const noexcept -> const float*
+  {
+    return m_height.data();
+  }
+
+  /// \} End of component arrays
+
+ private:
+  std::vector<float> m_x;
+  std::vector<float> m_y;
+  std::vector<float> m_width;
+  std::vector<float> m_height;
+};
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_RECT_ARRAY_HEADER
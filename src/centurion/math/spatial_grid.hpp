@@ -0,0 +1,452 @@
+#ifndef CENTURION_SPATIAL_GRID_HEADER
+#define CENTURION_SPATIAL_GRID_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>        // assert
+#include <cmath>          // floor
+#include <type_traits>    // is_integral_v
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../detail/max.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class basic_spatial_grid
+ *
+ * \brief A uniform grid that indexes rectangles, used for broad-phase culling and collision
+ * detection.
+ *
+ * \details Each rectangle is stored in every cell of the grid that it overlaps, so range
+ * queries and pair enumeration only have to test rectangles that share a cell, instead of
+ * testing every possible pair. Cells are only allocated when they are occupied, so the
+ * grid is unbounded. Moving a rectangle only touches the cells of the grid if the range of
+ * cells that it overlaps changes, which makes updating slowly moving objects every frame
+ * cheap.
+ *
+ * \details Each rectangle is reported at most once by queries, even if it overlaps
+ * several cells, and each pair of rectangles is reported at most once by `for_each_pair()`.
+ * Like `collides()`, rectangles with overlapping borders are considered to overlap.
+ *
+ * \code{cpp}
+ *   cen::fspatial_grid grid{64};
+ *
+ *   for (const auto& sprite : sprites) {
+ *     grid.insert(sprite.id, sprite.bounds);
+ *   }
+ *
+ *   grid.query(renderer.translation_viewport(), [&](const auto id, const cen::frect&) {
+ *     draw(sprites[id]);
+ *   });
+ * \endcode
+ *
+ * \note The cell size should be roughly the size of a typical rectangle. Rectangles that
+ * are much larger than the cells are stored in many cells, and queries against large
+ * areas visit many cells.
+ *
+ * \tparam T the representation type of the rectangles, i.e. `int` or `float`.
+ *
+ * \see `ispatial_grid`
+ * \see `fspatial_grid`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class basic_spatial_grid final
+{
+ public:
+  using rect_type = basic_rect<T>;
+  using value_type = typename rect_type::value_type;
+  using id_type = u64;
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty spatial grid.
+   *
+   * \pre `cellSize` must be greater than zero.
+   *
+   * \param cellSize the width and height of the cells of the grid.
+   *
+   * \since 6.4.0
+   */
+  explicit basic_spatial_grid(const value_type cellSize) : m_cellSize{cellSize}
+  {
+    assert(cellSize > 0);
+  }
+
+  /**
+   * \brief Adds a rectangle to the grid.
+   *
+   * \param id the user ID associated with the rectangle, must be unique.
+   * \param bounds the rectangle that will be added.
+   *
+   * \return `true` if the rectangle was added; `false` if the ID is already used.
+   *
+   * \since 6.4.0
+   */
+  auto insert(const id_type id, const rect_type& bounds) -> bool
+  {
+    if (m_slots.find(id) != m_slots.end()) {
+      return false;
+    }
+
+    u32 slot{};
+    if (m_free.empty()) {
+      slot = static_cast<u32>(m_entries.size());
+      m_entries.emplace_back();
+    }
+    else {
+      slot = m_free.back();
+      m_free.pop_back();
+    }
+
+    auto& entry = m_entries[slot];
+    entry.id = id;
+    entry.bounds = bounds;
+    entry.cells = cells_of(bounds);
+
+    m_slots.emplace(id, slot);
+    link(slot, entry.cells);
+
+    return true;
+  }
+
+  /**
+   * \brief Moves or resizes a rectangle in the grid.
+   *
+   * \details The cells of the grid are only updated if the range of cells that the
+   * rectangle overlaps changes.
+   *
+   * \param id the ID of the rectangle that will be updated.
+   * \param bounds the new rectangle.
+   *
+   * \return `true` if the rectangle was updated; `false` if there is no such ID.
+   *
+   * \since 6.4.0
+   */
+  auto update(const id_type id, const rect_type& bounds) -> bool
+  {
+    const auto iter = m_slots.find(id);
+    if (iter == m_slots.end()) {
+      return false;
+    }
+
+    const auto slot = iter->second;
+    auto& entry = m_entries[slot];
+    entry.bounds = bounds;
+
+    const auto cells = cells_of(bounds);
+    if (cells != entry.cells) {
+      unlink(slot, entry.cells);
+      link(slot, cells);
+      entry.cells = cells;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Removes a rectangle from the grid.
+   *
+   * \param id the ID of the rectangle that will be removed.
+   *
+   * \return `true` if the rectangle was removed; `false` if there is no such ID.
+   *
+   * \since 6.4.0
+   */
+  auto erase(const id_type id) -> bool
+  {
+    const auto iter = m_slots.find(id);
+    if (iter == m_slots.end()) {
+      return false;
+    }
+
+    const auto slot = iter->second;
+    unlink(slot, m_entries[slot].cells);
+
+    m_free.push_back(slot);
+    m_slots.erase(iter);
+
+    return true;
+  }
+
+  /**
+   * \brief Removes all rectangles from the grid.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_entries.clear();
+    m_free.clear();
+    m_slots.clear();
+    m_cells.clear();
+  }
+
+  /**
+   * \brief Invokes a function for each rectangle that overlaps an area.
+   *
+   * \tparam Callable the type of the function object, with the signature
+   * `void(id_type, const rect_type&)`.
+   *
+   * \param area the area that will be queried, e.g. the translation viewport of a renderer.
+   * \param callable the function object that will be invoked for each overlapping
+   * rectangle.
+   *
+   * \since 6.4.0
+   */
+  template <typename Callable>
+  void query(const rect_type& area, Callable&& callable) const
+  {
+    const auto range = cells_of(area);
+
+    for (auto y = range.minY; y <= range.maxY; ++y) {
+      for (auto x = range.minX; x <= range.maxX; ++x) {
+        const auto iter = m_cells.find(key_of(x, y));
+        if (iter == m_cells.end()) {
+          continue;
+        }
+
+        for (const auto slot : iter->second) {
+          const auto& entry = m_entries[slot];
+
+          // Only report rectangles in the first cell that they share with the area
+          if (x == detail::max(entry.cells.minX, range.minX) &&
+              y == detail::max(entry.cells.minY, range.minY) &&
+              collides(entry.bounds, area)) {
+            callable(entry.id, entry.bounds);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Collects the IDs of the rectangles that overlap an area.
+   *
+   * \param area the area that will be queried.
+   * \param[out] ids the vector that the IDs will be appended to.
+   *
+   * \since 6.4.0
+   */
+  void query(const rect_type& area, std::vector<id_type>& ids) const
+  {
+    query(area, [&](const id_type id, const rect_type&) { ids.push_back(id); });
+  }
+
+  /**
+   * \brief Invokes a function for each pair of overlapping rectangles.
+   *
+   * \tparam Callable the type of the function object, with the signature
+   * `void(id_type, id_type)`.
+   *
+   * \param callable the function object that will be invoked for each overlapping pair.
+   *
+   * \since 6.4.0
+   */
+  template <typename Callable>
+  void for_each_pair(Callable&& callable) const
+  {
+    for (const auto& [key, slots] : m_cells) {
+      const auto x = static_cast<i32>(static_cast<u32>(key >> 32u));
+      const auto y = static_cast<i32>(static_cast<u32>(key));
+
+      const auto count = slots.size();
+      for (size_type i = 0; i < count; ++i) {
+        const auto& fst = m_entries[slots[i]];
+
+        for (auto j = i + 1; j < count; ++j) {
+          const auto& snd = m_entries[slots[j]];
+
+          // Only report pairs in the first cell that the rectangles share
+          if (x == detail::max(fst.cells.minX, snd.cells.minX) &&
+              y == detail::max(fst.cells.minY, snd.cells.minY) &&
+              collides(fst.bounds, snd.bounds)) {
+            callable(fst.id, snd.id);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the grid contains a rectangle.
+   *
+   * \param id the ID of the rectangle.
+   *
+   * \return `true` if there is a rectangle with the ID; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto contains(const id_type id) const -> bool
+  {
+    return m_slots.find(id) != m_slots.end();
+  }
+
+  /**
+   * \brief Returns the rectangle associated with an ID.
+   *
+   * \param id the ID of the rectangle.
+   *
+   * \return a pointer to the rectangle; a null pointer if there is no such ID.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bounds(const id_type id) const -> const rect_type*
+  {
+    const auto iter = m_slots.find(id);
+    return (iter != m_slots.end()) ? &m_entries[iter->second].bounds : nullptr;
+  }
+
+  /**
+   * \brief Returns the amount of rectangles in the grid.
+   *
+   * \return the amount of rectangles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_slots.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the grid is empty.
+   *
+   * \return `true` if there are no rectangles in the grid; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_slots.empty();
+  }
+
+  /**
+   * \brief Returns the size of the cells of the grid.
+   *
+   * \return the width and height of the cells.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto cell_size() const noexcept -> value_type
+  {
+    return m_cellSize;
+  }
+
+ private:
+  struct cell_range final
+  {
+    i32 minX{};
+    i32 minY{};
+    i32 maxX{};
+    i32 maxY{};
+
+    [[nodiscard]] auto operator!=(const cell_range& other) const noexcept -> bool
+    {
+      return minX != other.minX || minY != other.minY || maxX != other.maxX ||
+             maxY != other.maxY;
+    }
+  };
+
+  struct entry final
+  {
+    id_type id{};
+    rect_type bounds;
+    cell_range cells;
+  };
+
+  value_type m_cellSize{};
+  std::vector<entry> m_entries;
+  std::vector<u32> m_free;                            ///< Indices of unused entries.
+  std::unordered_map<id_type, u32> m_slots;           ///< ID -> entry index.
+  std::unordered_map<u64, std::vector<u32>> m_cells;  ///< Cell key -> entry indices.
+
+  [[nodiscard]] auto cell_of(const value_type value) const noexcept -> i32
+  {
+    if constexpr (std::is_integral_v<value_type>) {
+      // Round towards negative infinity, unlike integer division
+      const auto quotient = value / m_cellSize;
+      return static_cast<i32>((value % m_cellSize < 0) ? quotient - 1 : quotient);
+    }
+    else {
+      return static_cast<i32>(std::floor(value / m_cellSize));
+    }
+  }
+
+  [[nodiscard]] auto cells_of(const rect_type& bounds) const noexcept -> cell_range
+  {
+    return {cell_of(bounds.x()),
+            cell_of(bounds.y()),
+            cell_of(bounds.max_x()),
+            cell_of(bounds.max_y())};
+  }
+
+  [[nodiscard]] static auto key_of(const i32 x, const i32 y) noexcept -> u64
+  {
+    return (static_cast<u64>(static_cast<u32>(x)) << 32u) | static_cast<u32>(y);
+  }
+
+  void link(const u32 slot, const cell_range& range)
+  {
+    for (auto y = range.minY; y <= range.maxY; ++y) {
+      for (auto x = range.minX; x <= range.maxX; ++x) {
+        m_cells[key_of(x, y)].push_back(slot);
+      }
+    }
+  }
+
+  void unlink(const u32 slot, const cell_range& range)
+  {
+    for (auto y = range.minY; y <= range.maxY; ++y) {
+      for (auto x = range.minX; x <= range.maxX; ++x) {
+        const auto iter = m_cells.find(key_of(x, y));
+        assert(iter != m_cells.end());
+
+        auto& slots = iter->second;
+        for (auto& elem : slots) {
+          if (elem == slot) {
+            elem = slots.back();
+            slots.pop_back();
+            break;
+          }
+        }
+
+        if (slots.empty()) {
+          m_cells.erase(iter);
+        }
+      }
+    }
+  }
+};
+
+/**
+ * \typedef ispatial_grid
+ *
+ * \brief Alias for a spatial grid of `int`-based rectangles.
+ *
+ * \since 6.4.0
+ */
+using ispatial_grid = basic_spatial_grid<int>;
+
+/**
+ * \typedef fspatial_grid
+ *
+ * \brief Alias for a spatial grid of `float`-based rectangles.
+ *
+ * \since 6.4.0
+ */
+using fspatial_grid = basic_spatial_grid<float>;
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_SPATIAL_GRID_HEADER
@@ -1,8 +1,10 @@
 #ifndef CENTURION_VECTOR3_HEADER
 #define CENTURION_VECTOR3_HEADER
 
-#include <ostream>  // ostream
-#include <string>   // string, to_string
+#include <cmath>        // sqrt
+#include <ostream>      // ostream
+#include <string>       // string, to_string
+#include <type_traits>  // is_floating_point_v
 
 #include "../compiler/features.hpp"
 
@@ -129,6 +131,140 @@ template <typename T>
 
 /// \} End of vector3 comparison operators
 
+/// \name Vector3 arithmetic operators
+/// \{
+
+template <typename T>
+[[nodiscard]] constexpr auto operator+(const vector3<T>& lhs, const vector3<T>& rhs) noexcept
+    -> vector3<T>
+{
+  return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator-(const vector3<T>& lhs, const vector3<T>& rhs) noexcept
+    -> vector3<T>
+{
+  return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator-(const vector3<T>& vector) noexcept -> vector3<T>
+{
+  return {-vector.x, -vector.y, -vector.z};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator*(const vector3<T>& vector, const T factor) noexcept
+    -> vector3<T>
+{
+  return {vector.x * factor, vector.y * factor, vector.z * factor};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator*(const T factor, const vector3<T>& vector) noexcept
+    -> vector3<T>
+{
+  return vector * factor;
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator/(const vector3<T>& vector, const T divisor) noexcept
+    -> vector3<T>
+{
+  return {vector.x / divisor, vector.y / divisor, vector.z / divisor};
+}
+
+/// \} End of vector3 arithmetic operators
+
+/// \name Vector3 functions
+/// \{
+
+/**
+ * \brief Returns the dot product of two 3D vectors.
+ *
+ * \tparam T the representation type used by the vectors.
+ *
+ * \param lhs the left-hand side vector.
+ * \param rhs the right-hand side vector.
+ *
+ * \return the dot product of the vectors.
+ *
+ * \see `dot_products()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] constexpr auto dot(const vector3<T>& lhs, const vector3<T>& rhs) noexcept -> T
+{
+  return (lhs.x * rhs.x) + (lhs.y * rhs.y) + (lhs.z * rhs.z);
+}
+
+/**
+ * \brief Returns the cross product of two 3D vectors.
+ *
+ * \tparam T the representation type used by the vectors.
+ *
+ * \param lhs the left-hand side vector.
+ * \param rhs the right-hand side vector.
+ *
+ * \return a vector that is perpendicular to both vectors.
+ *
+ * \see `cross_products()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] constexpr auto cross(const vector3<T>& lhs, const vector3<T>& rhs) noexcept
+    -> vector3<T>
+{
+  return {(lhs.y * rhs.z) - (lhs.z * rhs.y),
+          (lhs.z * rhs.x) - (lhs.x * rhs.z),
+          (lhs.x * rhs.y) - (lhs.y * rhs.x)};
+}
+
+/**
+ * \brief Returns the length of a 3D vector.
+ *
+ * \tparam T the representation type used by the vector, must be a floating-point type.
+ *
+ * \param vector the vector to obtain the length of.
+ *
+ * \return the length of the vector.
+ *
+ * \see `lengths()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] auto length(const vector3<T>& vector) noexcept -> T
+{
+  static_assert(std::is_floating_point_v<T>);
+  return std::sqrt(dot(vector, vector));
+}
+
+/**
+ * \brief Returns a 3D vector with the same direction and a length of 1.
+ *
+ * \tparam T the representation type used by the vector, must be a floating-point type.
+ *
+ * \param vector the vector that will be normalized.
+ *
+ * \return the normalized vector; the supplied vector if its length is zero.
+ *
+ * \see `normalize_all()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] auto normalize(const vector3<T>& vector) noexcept -> vector3<T>
+{
+  const auto len = length(vector);
+  return (len > 0) ? vector / len : vector;
+}
+
+/// \} End of vector3 functions
+
 /// \name String conversions
 /// \{
 
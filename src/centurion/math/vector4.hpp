@@ -0,0 +1,284 @@
+#ifndef CENTURION_VECTOR4_HEADER
+#define CENTURION_VECTOR4_HEADER
+
+#include <cmath>        // sqrt
+#include <ostream>      // ostream
+#include <string>       // string, to_string
+#include <type_traits>  // is_floating_point_v
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_FORMAT
+
+#include <format>  // format
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \struct vector4
+ *
+ * \brief A simple representation of a 4-dimensional vector, e.g. a quaternion or a
+ * homogeneous coordinate.
+ *
+ * \serializable
+ *
+ * \tparam T the representation type, e.g. `float` or `double`.
+ *
+ * \see `vector3`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+struct vector4 final
+{
+  using value_type = T;  ///< The type of the vector components.
+
+  value_type x{};  ///< The x-coordinate of the vector.
+  value_type y{};  ///< The y-coordinate of the vector.
+  value_type z{};  ///< The z-coordinate of the vector.
+  value_type w{};  ///< The w-coordinate of the vector.
+
+#if CENTURION_HAS_FEATURE_SPACESHIP
+
+  [[nodiscard]] constexpr auto operator<=>(const vector4&) const noexcept = default;
+
+#endif  // CENTURION_HAS_FEATURE_SPACESHIP
+
+  /**
+   * \brief Casts the vector to a vector with another representation type.
+   *
+   * \tparam U the target vector type.
+   *
+   * \return the result vector.
+   *
+   * \since 6.4.0
+   */
+  template <typename U>
+  [[nodiscard]] explicit operator vector4<U>() const noexcept
+  {
+    using target_value_type = typename vector4<U>::value_type;
+    return vector4<U>{static_cast<target_value_type>(x),
+                      static_cast<target_value_type>(y),
+                      static_cast<target_value_type>(z),
+                      static_cast<target_value_type>(w)};
+  }
+};
+
+/**
+ * \brief Serializes a 4D-vector.
+ *
+ * \details This function expects that the archive provides an overloaded `operator()`,
+ * used for serializing data. This API is based on the Cereal serialization library.
+ *
+ * \tparam Archive the type of the archive.
+ * \tparam T the type of the vector components.
+ *
+ * \param archive the archive used to serialize the vector.
+ * \param vector the vector that will be serialized.
+ *
+ * \since 6.4.0
+ */
+template <typename Archive, typename T>
+void serialize(Archive& archive, vector4<T>& vector)
+{
+  archive(vector.x, vector.y, vector.z, vector.w);
+}
+
+/// \name Vector4 comparison operators
+/// \{
+
+#if !CENTURION_HAS_FEATURE_SPACESHIP
+
+template <typename T>
+[[nodiscard]] constexpr auto operator==(const vector4<T>& lhs, const vector4<T>& rhs) noexcept
+    -> bool
+{
+  return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z) && (lhs.w == rhs.w);
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator!=(const vector4<T>& lhs, const vector4<T>& rhs) noexcept
+    -> bool
+{
+  return !(lhs == rhs);
+}
+
+#endif  // CENTURION_HAS_FEATURE_SPACESHIP
+
+/// \} End of vector4 comparison operators
+
+/// \name Vector4 arithmetic operators
+/// \{
+
+template <typename T>
+[[nodiscard]] constexpr auto operator+(const vector4<T>& lhs, const vector4<T>& rhs) noexcept
+    -> vector4<T>
+{
+  return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator-(const vector4<T>& lhs, const vector4<T>& rhs) noexcept
+    -> vector4<T>
+{
+  return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator-(const vector4<T>& vector) noexcept -> vector4<T>
+{
+  return {-vector.x, -vector.y, -vector.z, -vector.w};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator*(const vector4<T>& vector, const T factor) noexcept
+    -> vector4<T>
+{
+  return {vector.x * factor, vector.y * factor, vector.z * factor, vector.w * factor};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator*(const T factor, const vector4<T>& vector) noexcept
+    -> vector4<T>
+{
+  return vector * factor;
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto operator/(const vector4<T>& vector, const T divisor) noexcept
+    -> vector4<T>
+{
+  return {vector.x / divisor, vector.y / divisor, vector.z / divisor, vector.w / divisor};
+}
+
+/// \} End of vector4 arithmetic operators
+
+/// \name Vector4 functions
+/// \{
+
+/**
+ * \brief Returns the dot product of two 4D vectors.
+ *
+ * \tparam T the representation type used by the vectors.
+ *
+ * \param lhs the left-hand side vector.
+ * \param rhs the right-hand side vector.
+ *
+ * \return the dot product of the vectors.
+ *
+ * \see `dot_products()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] constexpr auto dot(const vector4<T>& lhs, const vector4<T>& rhs) noexcept -> T
+{
+  return (lhs.x * rhs.x) + (lhs.y * rhs.y) + (lhs.z * rhs.z) + (lhs.w * rhs.w);
+}
+
+/**
+ * \brief Returns the length of a 4D vector.
+ *
+ * \tparam T the representation type used by the vector, must be a floating-point type.
+ *
+ * \param vector the vector to obtain the length of.
+ *
+ * \return the length of the vector.
+ *
+ * \see `lengths()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] auto length(const vector4<T>& vector) noexcept -> T
+{
+  static_assert(std::is_floating_point_v<T>);
+  return std::sqrt(dot(vector, vector));
+}
+
+/**
+ * \brief Returns a 4D vector with the same direction and a length of 1.
+ *
+ * \tparam T the representation type used by the vector, must be a floating-point type.
+ *
+ * \param vector the vector that will be normalized.
+ *
+ * \return the normalized vector; the supplied vector if its length is zero.
+ *
+ * \see `normalize_all()`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] auto normalize(const vector4<T>& vector) noexcept -> vector4<T>
+{
+  const auto len = length(vector);
+  return (len > 0) ? vector / len : vector;
+}
+
+/// \} End of vector4 functions
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a string that represents a vector.
+ *
+ * \tparam T the representation type used by the vector.
+ *
+ * \param vector the vector that will be converted to a string.
+ *
+ * \return a string that represents the supplied vector.
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+[[nodiscard]] auto to_string(const vector4<T>& vector) -> std::string
+{
+#if CENTURION_HAS_FEATURE_FORMAT
+  return std::format("vector4{{x: {}, y: {}, z: {}, w: {}}}",
+                     vector.x,
+                     vector.y,
+                     vector.z,
+                     vector.w);
+#else
+  return "vector4{x: " + std::to_string(vector.x) + ", y: " + std::to_string(vector.y) +
+         ", z: " + std::to_string(vector.z) + ", w: " + std::to_string(vector.w) + "}";
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a vector.
+ *
+ * \tparam T the representation type used by the vector.
+ *
+ * \param stream the stream that will be used.
+ * \param vector the vector that will be printed.
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+auto operator<<(std::ostream& stream, const vector4<T>& vector) -> std::ostream&
+{
+  return stream << to_string(vector);
+}
+
+/// \} End of streaming
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_VECTOR4_HEADER
@@ -0,0 +1,212 @@
+#ifndef CENTURION_VECTOR_UTILS_HEADER
+#define CENTURION_VECTOR_UTILS_HEADER
+
+#include <cassert>      // assert
+#include <type_traits>  // is_same_v
+
+#include "../core/integers.hpp"
+#include "../detail/vector_kernels.hpp"
+#include "vector3.hpp"
+#include "vector4.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+static_assert(sizeof(vector3<float>) == 3 * sizeof(float));
+static_assert(sizeof(vector4<float>) == 4 * sizeof(float));
+
+/// \cond FALSE
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_float_vector_v =
+    std::is_same_v<T, vector3<float>> || std::is_same_v<T, vector4<float>>;
+
+}  // namespace detail
+
+/// \endcond
+
+/**
+ * \brief Computes the dot products of pairs of vectors.
+ *
+ * \details This is a bulk version of `dot()`, which processes four vectors at a time using
+ * SSE2 or NEON, when available. The results are identical to those of `dot()`.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Vectors the vector container type, e.g. `std::vector<vector3<float>>`.
+ * \tparam Destination the destination container type, e.g. `std::vector<float>`.
+ *
+ * \pre The containers must have the same size.
+ *
+ * \param lhs the left-hand side vectors.
+ * \param rhs the right-hand side vectors.
+ * \param dst the container that the dot products will be written to.
+ *
+ * \since 6.4.0
+ */
+template <typename Vectors, typename Destination>
+void dot_products(const Vectors& lhs, const Vectors& rhs, Destination& dst) noexcept
+{
+  using vector_type = typename Vectors::value_type;
+  static_assert(detail::is_float_vector_v<vector_type>);
+  static_assert(std::is_same_v<typename Destination::value_type, float>);
+  assert(lhs.size() == rhs.size());
+  assert(lhs.size() == dst.size());
+
+  if (!lhs.empty()) {
+    if constexpr (std::is_same_v<vector_type, vector3<float>>) {
+      detail::dot3(&lhs.front().x, &rhs.front().x, dst.data(), lhs.size());
+    }
+    else {
+      detail::dot4(&lhs.front().x, &rhs.front().x, dst.data(), lhs.size());
+    }
+  }
+}
+
+/**
+ * \brief Computes the cross products of pairs of 3D vectors.
+ *
+ * \details This is a bulk version of `cross()`, which processes four vectors at a time
+ * using SSE2 or NEON, when available. The results are identical to those of `cross()`.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Vectors the vector container type, e.g. `std::vector<vector3<float>>`.
+ * \tparam Destination the destination container type, e.g. `std::vector<vector3<float>>`.
+ *
+ * \pre The containers must have the same size.
+ *
+ * \param lhs the left-hand side vectors.
+ * \param rhs the right-hand side vectors.
+ * \param dst the container that the cross products will be written to, may be `lhs` or
+ * `rhs`.
+ *
+ * \since 6.4.0
+ */
+template <typename Vectors, typename Destination>
+void cross_products(const Vectors& lhs, const Vectors& rhs, Destination& dst) noexcept
+{
+  static_assert(std::is_same_v<typename Vectors::value_type, vector3<float>>);
+  static_assert(std::is_same_v<typename Destination::value_type, vector3<float>>);
+  assert(lhs.size() == rhs.size());
+  assert(lhs.size() == dst.size());
+
+  if (!lhs.empty()) {
+    detail::cross3(&lhs.front().x, &rhs.front().x, &dst.front().x, lhs.size());
+  }
+}
+
+/**
+ * \brief Computes the lengths of vectors.
+ *
+ * \details This is a bulk version of `length()`, which processes four vectors at a time
+ * using SSE2 or NEON, when available. The results are identical to those of `length()`.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Vectors the vector container type, e.g. `std::vector<vector3<float>>`.
+ * \tparam Destination the destination container type, e.g. `std::vector<float>`.
+ *
+ * \pre The containers must have the same size.
+ *
+ * \param vectors the vectors to obtain the lengths of.
+ * \param dst the container that the lengths will be written to.
+ *
+ * \since 6.4.0
+ */
+template <typename Vectors, typename Destination>
+void lengths(const Vectors& vectors, Destination& dst) noexcept
+{
+  using vector_type = typename Vectors::value_type;
+  static_assert(detail::is_float_vector_v<vector_type>);
+  static_assert(std::is_same_v<typename Destination::value_type, float>);
+  assert(vectors.size() == dst.size());
+
+  if (!vectors.empty()) {
+    if constexpr (std::is_same_v<vector_type, vector3<float>>) {
+      detail::lengths3(&vectors.front().x, dst.data(), vectors.size());
+    }
+    else {
+      detail::lengths4(&vectors.front().x, dst.data(), vectors.size());
+    }
+  }
+}
+
+/**
+ * \brief Normalizes vectors in place.
+ *
+ * \details This is a bulk version of `normalize()`, which processes four vectors at a time
+ * using SSE2 or NEON, when available. The results are identical to those of
+ * `normalize()`, i.e. vectors with a length of zero are left unchanged.
+ *
+ * \warning The container *must* store its data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Vectors the vector container type, e.g. `std::vector<vector3<float>>`.
+ *
+ * \param vectors the vectors that will be normalized.
+ *
+ * \since 6.4.0
+ */
+template <typename Vectors>
+void normalize_all(Vectors& vectors) noexcept
+{
+  using vector_type = typename Vectors::value_type;
+  static_assert(detail::is_float_vector_v<vector_type>);
+
+  if (!vectors.empty()) {
+    if constexpr (std::is_same_v<vector_type, vector3<float>>) {
+      detail::normalize3(&vectors.front().x, vectors.size());
+    }
+    else {
+      detail::normalize4(&vectors.front().x, vectors.size());
+    }
+  }
+}
+
+/**
+ * \brief Adds scaled vectors to vectors, e.g. to integrate velocities or sensor readings.
+ *
+ * \details Each vector in `dst` is replaced with `dst[i] + src[i] * factor`. The
+ * components are processed four at a time using SSE2 or NEON, when available.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Destination the destination container type, e.g. `std::vector<vector3<float>>`.
+ * \tparam Source the source container type, with the same vector type as `Destination`.
+ *
+ * \pre The containers must have the same size.
+ *
+ * \param dst the vectors that the scaled vectors will be added to.
+ * \param src the vectors that will be scaled.
+ * \param factor the scale factor, e.g. the elapsed time.
+ *
+ * \since 6.4.0
+ */
+template <typename Destination, typename Source>
+void multiply_add(Destination& dst, const Source& src, const float factor) noexcept
+{
+  using vector_type = typename Destination::value_type;
+  static_assert(detail::is_float_vector_v<vector_type>);
+  static_assert(std::is_same_v<typename Source::value_type, vector_type>);
+  assert(dst.size() == src.size());
+
+  if (!dst.empty()) {
+    constexpr usize components = sizeof(vector_type) / sizeof(float);
+    detail::multiply_add(&dst.front().x, &src.front().x, factor, components * dst.size());
+  }
+}
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_VECTOR_UTILS_HEADER
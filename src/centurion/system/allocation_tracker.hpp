@@ -0,0 +1,427 @@
+#ifndef CENTURION_ALLOCATION_TRACKER_HEADER
+#define CENTURION_ALLOCATION_TRACKER_HEADER
+
+#include <array>          // array
+#include <atomic>         // atomic, memory_order_relaxed
+#include <functional>     // hash, equal_to
+#include <list>           // list
+#include <memory>         // allocator
+#include <type_traits>    // true_type, false_type
+#include <unordered_map>  // unordered_map
+#include <utility>        // pair
+#include <vector>         // vector
+
+#include "../compiler/features.hpp"
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+#include <memory_resource>  // memory_resource
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \enum alloc_subsystem
+ *
+ * \brief Represents the subsystems that heap allocations are attributed to.
+ *
+ * \since 6.4.0
+ */
+enum class alloc_subsystem : usize
+{
+  core,    ///< Allocations made by core and utility components.
+  video,   ///< Allocations made by renderers, windows and other video components.
+  text,    ///< Allocations made by strings, font caches and text layouts.
+  events,  ///< Allocations made by event components.
+  input,   ///< Allocations made by input components.
+  audio    ///< Allocations made by audio components.
+};
+
+/// The amount of `alloc_subsystem` enumerators.
+inline constexpr usize alloc_subsystem_count = 6;
+
+/**
+ * \struct allocation_stats
+ *
+ * \brief Provides heap allocation counters for a subsystem.
+ *
+ * \since 6.4.0
+ */
+struct allocation_stats final
+{
+  u64 allocations{};     ///< The amount of allocations since the latest reset.
+  u64 deallocations{};   ///< The amount of deallocations since the latest reset.
+  u64 allocatedBytes{};  ///< The amount of allocated bytes since the latest reset.
+  u64 liveBytes{};       ///< The amount of currently allocated bytes.
+  u64 peakBytes{};       ///< The maximum amount of live bytes since the latest reset.
+};
+
+/**
+ * \class allocation_tracker
+ *
+ * \brief Keeps track of the heap allocations made by containers owned by Centurion types.
+ *
+ * \details Allocation tracking is enabled by defining `CENTURION_TRACK_ALLOCATIONS`, e.g.
+ * with the `CEN_TRACK_ALLOCATIONS` CMake option, in which case the containers of types
+ * such as `unicode_string`, `font_cache` and `basic_renderer` use a `tracking_allocator`.
+ * Otherwise, the containers use `std::allocator` and the counters stay at zero. A typical
+ * use is to reset the counters at the start of each frame, and to check the amount of
+ * allocations at the end of it.
+ * \code{cpp}
+ *   cen::allocation_tracker::reset();
+ *
+ *   // ...
+ *
+ *   const auto text = cen::allocation_tracker::stats(cen::alloc_subsystem::text);
+ *   assert(text.allocations == 0);
+ * \endcode
+ *
+ * \note The counters are updated atomically, so they may be used from any thread. The
+ * statistics of different counters are not captured as a single snapshot.
+ *
+ * \since 6.4.0
+ */
+class allocation_tracker final
+{
+ public:
+  /**
+   * \brief Indicates whether or not Centurion containers are tracked.
+   *
+   * \return `true` if `CENTURION_TRACK_ALLOCATIONS` is defined; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto enabled() noexcept -> bool
+  {
+#ifdef CENTURION_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif  // CENTURION_TRACK_ALLOCATIONS
+  }
+
+  /**
+   * \brief Returns the allocation statistics of a subsystem.
+   *
+   * \param subsystem the subsystem to obtain the statistics of.
+   *
+   * \return the current statistics of the subsystem.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto stats(const alloc_subsystem subsystem) noexcept
+      -> allocation_stats
+  {
+    const auto& counters = get(subsystem);
+
+    allocation_stats stats;
+    stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.deallocations = counters.deallocations.load(std::memory_order_relaxed);
+    stats.allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+
+    return stats;
+  }
+
+  /**
+   * \brief Returns the combined allocation statistics of all subsystems.
+   *
+   * \note The peak is the sum of the subsystem peaks, which may exceed the actual peak.
+   *
+   * \return the sum of the statistics of all subsystems.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto total() noexcept -> allocation_stats
+  {
+    allocation_stats total;
+
+    for (usize index = 0; index < alloc_subsystem_count; ++index) {
+      const auto stats = allocation_tracker::stats(static_cast<alloc_subsystem>(index));
+      total.allocations += stats.allocations;
+      total.deallocations += stats.deallocations;
+      total.allocatedBytes += stats.allocatedBytes;
+      total.liveBytes += stats.liveBytes;
+      total.peakBytes += stats.peakBytes;
+    }
+
+    return total;
+  }
+
+  /**
+   * \brief Resets the counters of all subsystems.
+   *
+   * \details The amount of live bytes is preserved, and the peaks are reset to it.
+   *
+   * \since 6.4.0
+   */
+  static void reset() noexcept
+  {
+    for (auto& counters : all()) {
+      counters.allocations.store(0, std::memory_order_relaxed);
+      counters.deallocations.store(0, std::memory_order_relaxed);
+      counters.allocatedBytes.store(0, std::memory_order_relaxed);
+      counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * \brief Records an allocation.
+   *
+   * \details This is used by `tracking_allocator`, but may also be used to attribute
+   * other allocations to a subsystem.
+   *
+   * \param subsystem the subsystem that made the allocation.
+   * \param bytes the size of the allocation.
+   *
+   * \since 6.4.0
+   */
+  static void record_allocation(const alloc_subsystem subsystem, const usize bytes) noexcept
+  {
+    auto& counters = get(subsystem);
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    const auto live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+    auto peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (peak < live &&
+           !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {}
+  }
+
+  /**
+   * \brief Records a deallocation.
+   *
+   * \param subsystem the subsystem that made the allocation.
+   * \param bytes the size of the allocation.
+   *
+   * \since 6.4.0
+   */
+  static void record_deallocation(const alloc_subsystem subsystem,
+                                  const usize bytes) noexcept
+  {
+    auto& counters = get(subsystem);
+    counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+    counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+  /**
+   * \brief Sets the memory resource used by tracked containers created after the call.
+   *
+   * \details By default, tracked memory is obtained with `operator new`. Containers keep
+   * the resource that was current when they were created, so the resource must outlive
+   * all containers created while it is set.
+   *
+   * \param resource the memory resource that will be used; null to use `operator new`.
+   *
+   * \since 6.4.0
+   */
+  static void set_upstream(std::pmr::memory_resource* resource) noexcept
+  {
+    upstream_ref().store(resource, std::memory_order_release);
+  }
+
+  /**
+   * \brief Returns the memory resource used by tracked containers.
+   *
+   * \return the current memory resource; null if `operator new` is used.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto upstream() noexcept -> std::pmr::memory_resource*
+  {
+    return upstream_ref().load(std::memory_order_acquire);
+  }
+
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+ private:
+  struct counters final
+  {
+    std::atomic<u64> allocations{};
+    std::atomic<u64> deallocations{};
+    std::atomic<u64> allocatedBytes{};
+    std::atomic<u64> liveBytes{};
+    std::atomic<u64> peakBytes{};
+  };
+
+  [[nodiscard]] static auto all() noexcept -> std::array<counters, alloc_subsystem_count>&
+  {
+    static std::array<counters, alloc_subsystem_count> counters;
+    return counters;
+  }
+
+  [[nodiscard]] static auto get(const alloc_subsystem subsystem) noexcept -> counters&
+  {
+    return all()[to_underlying(subsystem)];
+  }
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+  [[nodiscard]] static auto upstream_ref() noexcept
+      -> std::atomic<std::pmr::memory_resource*>&
+  {
+    static std::atomic<std::pmr::memory_resource*> resource{};
+    return resource;
+  }
+
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+};
+
+/**
+ * \class tracking_allocator
+ *
+ * \brief An allocator that attributes its allocations to a subsystem.
+ *
+ * \details The memory is obtained from the upstream resource of `allocation_tracker` that
+ * was set when the allocator was created, or with `operator new` if there was none.
+ *
+ * \tparam T the type of the allocated objects.
+ * \tparam Subsystem the subsystem that the allocations are attributed to.
+ *
+ * \note The allocator isn't final, since standard containers may derive from it.
+ *
+ * \since 6.4.0
+ */
+template <typename T, alloc_subsystem Subsystem>
+class tracking_allocator
+{
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind final
+  {
+    using other = tracking_allocator<U, Subsystem>;
+  };
+
+  tracking_allocator() noexcept
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+      : m_resource{allocation_tracker::upstream()}
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+  {}
+
+  template <typename U>
+  /*implicit*/ tracking_allocator(const tracking_allocator<U, Subsystem>& other) noexcept
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+      : m_resource{other.resource()}
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+  {
+    static_cast<void>(other);
+  }
+
+  [[nodiscard]] auto allocate(const usize count) -> T*
+  {
+    const auto bytes = count * sizeof(T);
+
+    T* ptr{};
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+    if (m_resource) {
+      ptr = static_cast<T*>(m_resource->allocate(bytes, alignof(T)));
+    }
+    else {
+      ptr = std::allocator<T>{}.allocate(count);
+    }
+#else
+    ptr = std::allocator<T>{}.allocate(count);
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+    allocation_tracker::record_allocation(Subsystem, bytes);
+    return ptr;
+  }
+
+  void deallocate(T* ptr, const usize count) noexcept
+  {
+    const auto bytes = count * sizeof(T);
+    allocation_tracker::record_deallocation(Subsystem, bytes);
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+    if (m_resource) {
+      m_resource->deallocate(ptr, bytes, alignof(T));
+      return;
+    }
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+    std::allocator<T>{}.deallocate(ptr, count);
+  }
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+  [[nodiscard]] auto resource() const noexcept -> std::pmr::memory_resource*
+  {
+    return m_resource;
+  }
+
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+  template <typename U>
+  [[nodiscard]] auto operator==(const tracking_allocator<U, Subsystem>& other) const noexcept
+      -> bool
+  {
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+    return m_resource == other.resource();
+#else
+    static_cast<void>(other);
+    return true;
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+  }
+
+  template <typename U>
+  [[nodiscard]] auto operator!=(const tracking_allocator<U, Subsystem>& other) const noexcept
+      -> bool
+  {
+    return !(*this == other);
+  }
+
+ private:
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+  std::pmr::memory_resource* m_resource{};
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+};
+
+/// \} End of group system
+
+/// \cond FALSE
+namespace detail {
+
+// The allocator used by containers owned by Centurion types
+#ifdef CENTURION_TRACK_ALLOCATIONS
+template <typename T, alloc_subsystem Subsystem>
+using tracked_allocator = tracking_allocator<T, Subsystem>;
+#else
+template <typename T, alloc_subsystem Subsystem>
+using tracked_allocator = std::allocator<T>;
+#endif  // CENTURION_TRACK_ALLOCATIONS
+
+template <typename T, alloc_subsystem Subsystem>
+using tracked_vector = std::vector<T, tracked_allocator<T, Subsystem>>;
+
+template <typename T, alloc_subsystem Subsystem>
+using tracked_list = std::list<T, tracked_allocator<T, Subsystem>>;
+
+template <typename Key, typename Value, alloc_subsystem Subsystem>
+using tracked_unordered_map =
+    std::unordered_map<Key,
+                       Value,
+                       std::hash<Key>,
+                       std::equal_to<Key>,
+                       tracked_allocator<std::pair<const Key, Value>, Subsystem>>;
+
+}  // namespace detail
+/// \endcond
+
+}  // namespace cen
+
+#endif  // CENTURION_ALLOCATION_TRACKER_HEADER
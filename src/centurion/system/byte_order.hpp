@@ -4,6 +4,7 @@
 #include <SDL2/SDL.h>
 
 #include "../core/integers.hpp"
+#include "../detail/byte_swap_kernels.hpp"
 
 namespace cen {
 
@@ -45,6 +46,33 @@ namespace cen {
   return SDL_SwapFloat(value);
 }
 
+/**
+ * \brief Swaps the byte order of an array of values, in place.
+ *
+ * \details The values are swapped with SIMD instructions, if available.
+ *
+ * \param values the values that will be swapped.
+ * \param count the amount of values.
+ *
+ * \since 6.4.0
+ */
+inline void swap_byte_order(u16* values, const usize count) noexcept
+{
+  detail::swap_u16(values, count);
+}
+
+/// \copydoc swap_byte_order(u16*, usize)
+inline void swap_byte_order(u32* values, const usize count) noexcept
+{
+  detail::swap_u32(values, count);
+}
+
+/// \copydoc swap_byte_order(u16*, usize)
+inline void swap_byte_order(u64* values, const usize count) noexcept
+{
+  detail::swap_u64(values, count);
+}
+
 /// \} End of byte order swapping
 
 /// \name Swap from big endian to native format
@@ -82,6 +110,49 @@ namespace cen {
   return SDL_SwapFloatBE(value);
 }
 
+/**
+ * \brief Swaps an array of big endian values to native values, or vice versa, in place.
+ *
+ * \details This function has no effect on big endian platforms, and otherwise swaps
+ * the values with SIMD instructions, if available.
+ *
+ * \param values the values that will be swapped.
+ * \param count the amount of values.
+ *
+ * \since 6.4.0
+ */
+inline void swap_big_endian(u16* values, const usize count) noexcept
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+  detail::swap_u16(values, count);
+#else
+  static_cast<void>(values);
+  static_cast<void>(count);
+#endif  // SDL_BYTEORDER == SDL_LIL_ENDIAN
+}
+
+/// \copydoc swap_big_endian(u16*, usize)
+inline void swap_big_endian(u32* values, const usize count) noexcept
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+  detail::swap_u32(values, count);
+#else
+  static_cast<void>(values);
+  static_cast<void>(count);
+#endif  // SDL_BYTEORDER == SDL_LIL_ENDIAN
+}
+
+/// \copydoc swap_big_endian(u16*, usize)
+inline void swap_big_endian(u64* values, const usize count) noexcept
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+  detail::swap_u64(values, count);
+#else
+  static_cast<void>(values);
+  static_cast<void>(count);
+#endif  // SDL_BYTEORDER == SDL_LIL_ENDIAN
+}
+
 /// \} End of swap from big endian to native format
 
 /// \name Swap from little endian to native format
@@ -119,6 +190,49 @@ namespace cen {
   return SDL_SwapFloatLE(value);
 }
 
+/**
+ * \brief Swaps an array of little endian values to native values, or vice versa, in place.
+ *
+ * \details This function has no effect on little endian platforms, and otherwise swaps
+ * the values with SIMD instructions, if available.
+ *
+ * \param values the values that will be swapped.
+ * \param count the amount of values.
+ *
+ * \since 6.4.0
+ */
+inline void swap_little_endian(u16* values, const usize count) noexcept
+{
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+  detail::swap_u16(values, count);
+#else
+  static_cast<void>(values);
+  static_cast<void>(count);
+#endif  // SDL_BYTEORDER == SDL_BIG_ENDIAN
+}
+
+/// \copydoc swap_little_endian(u16*, usize)
+inline void swap_little_endian(u32* values, const usize count) noexcept
+{
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+  detail::swap_u32(values, count);
+#else
+  static_cast<void>(values);
+  static_cast<void>(count);
+#endif  // SDL_BYTEORDER == SDL_BIG_ENDIAN
+}
+
+/// \copydoc swap_little_endian(u16*, usize)
+inline void swap_little_endian(u64* values, const usize count) noexcept
+{
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+  detail::swap_u64(values, count);
+#else
+  static_cast<void>(values);
+  static_cast<void>(count);
+#endif  // SDL_BYTEORDER == SDL_BIG_ENDIAN
+}
+
 /// \} End of swap from little endian to native format
 
 /// \} End of group system
@@ -0,0 +1,385 @@
+#ifndef CENTURION_CPU_DISPATCH_HEADER
+#define CENTURION_CPU_DISPATCH_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>    // array
+#include <atomic>   // atomic, memory_order
+#include <utility>  // forward
+
+#include "../compiler/features.hpp"
+#include "../core/integers.hpp"
+#include "cpu.hpp"
+#include "simd_level.hpp"
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \def CENTURION_SSE2_KERNEL
+ *
+ * \brief Names an SSE2 kernel variant in a kernel table, which is null when the library
+ * is built without SSE2 support, so the variant doesn't have to exist.
+ *
+ * \since 6.4.0
+ */
+#if CENTURION_HAS_FEATURE_SSE2
+#define CENTURION_SSE2_KERNEL(kernel) kernel
+#else
+#define CENTURION_SSE2_KERNEL(kernel) nullptr
+#endif  // CENTURION_HAS_FEATURE_SSE2
+
+/**
+ * \def CENTURION_NEON_KERNEL
+ *
+ * \brief Names a NEON kernel variant in a kernel table, like `CENTURION_SSE2_KERNEL`.
+ *
+ * \since 6.4.0
+ */
+#if CENTURION_HAS_FEATURE_NEON
+#define CENTURION_NEON_KERNEL(kernel) kernel
+#else
+#define CENTURION_NEON_KERNEL(kernel) nullptr
+#endif  // CENTURION_HAS_FEATURE_NEON
+
+/**
+ * \def CENTURION_AVX2_KERNEL
+ *
+ * \brief Names an AVX2 kernel variant in a kernel table, like `CENTURION_SSE2_KERNEL`.
+ *
+ * \details AVX2 variants must be declared with `CENTURION_TARGET_AVX2`, since the rest of
+ * the library is not compiled for AVX2.
+ *
+ * \since 6.4.0
+ */
+#if CENTURION_HAS_FEATURE_AVX2
+#define CENTURION_AVX2_KERNEL(kernel) kernel
+#else
+#define CENTURION_AVX2_KERNEL(kernel) nullptr
+#endif  // CENTURION_HAS_FEATURE_AVX2
+
+/// \} End of group system
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct cpu_features
+ *
+ * \brief Provides the instruction sets that are supported by the processor.
+ *
+ * \see `cpu::features()`
+ *
+ * \since 6.4.0
+ */
+struct cpu_features final
+{
+  bool sse2{};     ///< Indicates whether or not SSE2 is supported.
+  bool sse41{};    ///< Indicates whether or not SSE4.1 is supported.
+  bool avx{};      ///< Indicates whether or not AVX is supported.
+  bool avx2{};     ///< Indicates whether or not AVX2 is supported.
+  bool avx512f{};  ///< Indicates whether or not AVX-512F is supported.
+  bool neon{};     ///< Indicates whether or not NEON is supported.
+};
+
+/// \} End of group system
+
+/// \cond FALSE
+namespace detail {
+
+[[nodiscard]] inline auto simd_bit(const simd_level level) noexcept -> u32
+{
+  return u32{1} << static_cast<u32>(level);
+}
+
+inline std::atomic<u32> disabled_simd_levels{};
+inline std::atomic<u32> simd_generation{1};  // Invalidates the selected kernels
+
+}  // namespace detail
+/// \endcond
+
+}  // namespace cen
+
+namespace cen::cpu {
+
+/// \addtogroup system
+/// \{
+
+/// \name CPU dispatch functions
+/// \{
+
+/**
+ * \brief Returns the instruction sets that are supported by the processor.
+ *
+ * \details The processor is only queried once, later calls return the cached features.
+ *
+ * \return the supported instruction sets.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto features() noexcept -> const cpu_features&
+{
+  static const cpu_features features = [] {
+    cpu_features result;
+    result.sse2 = has_sse2();
+    result.sse41 = has_sse41();
+    result.avx = has_avx();
+    result.avx2 = has_avx2();
+    result.avx512f = has_avx512f();
+    result.neon = has_neon();
+    return result;
+  }();
+
+  return features;
+}
+
+/**
+ * \brief Enables or disables the kernel variants for an instruction set.
+ *
+ * \details Disabling an instruction set makes kernel tables fall back to other variants,
+ * which is useful to test and benchmark the fallbacks. Scalar variants can't be disabled.
+ *
+ * \param level the instruction set that will be enabled or disabled.
+ * \param enabled `true` if the variants may be used; `false` otherwise.
+ *
+ * \since 6.4.0
+ */
+inline void set_simd_enabled(const simd_level level, const bool enabled) noexcept
+{
+  if (level == simd_level::scalar) {
+    return;
+  }
+
+  const auto bit = detail::simd_bit(level);
+  if (enabled) {
+    detail::disabled_simd_levels.fetch_and(~bit, std::memory_order_relaxed);
+  }
+  else {
+    detail::disabled_simd_levels.fetch_or(bit, std::memory_order_relaxed);
+  }
+
+  detail::simd_generation.fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * \brief Indicates whether or not an instruction set is supported and enabled.
+ *
+ * \param level the instruction set that will be checked.
+ *
+ * \return `true` if kernel variants for the instruction set may be used; `false`
+ * otherwise.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto is_simd_available(const simd_level level) noexcept -> bool
+{
+  const auto disabled = detail::disabled_simd_levels.load(std::memory_order_relaxed);
+  if (disabled & detail::simd_bit(level)) {
+    return false;
+  }
+
+  switch (level) {
+    case simd_level::scalar:
+      return true;
+
+    case simd_level::sse2:
+      return CENTURION_HAS_FEATURE_SSE2 && features().sse2;
+
+    case simd_level::neon:
+      return CENTURION_HAS_FEATURE_NEON && features().neon;
+
+    case simd_level::avx2:
+      return CENTURION_HAS_FEATURE_AVX2 && features().avx2;
+
+    default:
+      return false;
+  }
+}
+
+/**
+ * \brief Returns the most preferred instruction set that is supported and enabled.
+ *
+ * \return the best available SIMD level.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto best_simd_level() noexcept -> simd_level
+{
+  for (auto index = simd_level_count() - 1; index > 0; --index) {
+    const auto level = static_cast<simd_level>(index);
+    if (is_simd_available(level)) {
+      return level;
+    }
+  }
+
+  return simd_level::scalar;
+}
+
+/// \} End of CPU dispatch functions
+
+/// \} End of group system
+
+}  // namespace cen::cpu
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+template <typename Signature>
+class kernel_table;
+
+/**
+ * \class kernel_table
+ *
+ * \brief Selects the best variant of a kernel for the processor, and calls it.
+ *
+ * \details A kernel table holds a function pointer for each instruction set, of which only
+ * the scalar variant is mandatory. The first call selects the most preferred variant that
+ * is available, and caches it, so subsequent calls only cost an indirect call and the
+ * check of a generation counter, which is bumped by `cpu::set_simd_enabled()`.
+ *
+ * \details Kernel tables are constant-initialized, so they can be declared as inline
+ * variables in headers, and the variant macros allow naming variants that are only
+ * compiled for some targets.
+ * \code{cpp}
+ *   inline cen::kernel_table<void(float*, int, float)> gain_kernels{
+ *       gain_scalar,
+ *       CENTURION_SSE2_KERNEL(gain_sse2),
+ *       CENTURION_NEON_KERNEL(gain_neon),
+ *       CENTURION_AVX2_KERNEL(gain_avx2)};
+ *
+ *   gain_kernels(samples, count, 0.5f);
+ * \endcode
+ *
+ * \tparam R the return type of the kernel.
+ * \tparam Args the parameter types of the kernel.
+ *
+ * \since 6.4.0
+ */
+template <typename R, typename... Args>
+class kernel_table<R(Args...)> final
+{
+ public:
+  using function_type = R (*)(Args...);
+
+  /**
+   * \brief Creates a kernel table.
+   *
+   * \param scalar the portable variant, which must not be null.
+   * \param sse2 the SSE2 variant, can safely be null.
+   * \param neon the NEON variant, can safely be null.
+   * \param avx2 the AVX2 variant, can safely be null.
+   *
+   * \since 6.4.0
+   */
+  constexpr explicit kernel_table(const function_type scalar,
+                                  const function_type sse2 = nullptr,
+                                  const function_type neon = nullptr,
+                                  const function_type avx2 = nullptr) noexcept
+      : m_variants{scalar, sse2, neon, avx2}
+      , m_selected{scalar}
+  {}
+
+  kernel_table(const kernel_table&) = delete;
+  auto operator=(const kernel_table&) -> kernel_table& = delete;
+
+  /**
+   * \brief Calls the selected variant of the kernel.
+   *
+   * \param args the arguments that will be forwarded to the kernel.
+   *
+   * \return the result of the kernel.
+   *
+   * \since 6.4.0
+   */
+  auto operator()(Args... args) const -> R
+  {
+    return select()(std::forward<Args>(args)...);
+  }
+
+  /**
+   * \brief Returns the variant of the kernel that is used by the table.
+   *
+   * \return the most preferred available variant.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto select() const noexcept -> function_type
+  {
+    const auto generation = detail::simd_generation.load(std::memory_order_acquire);
+
+    if (m_generation.load(std::memory_order_acquire) != generation) {
+      m_selected.store(m_variants[index_of(selected_level())], std::memory_order_relaxed);
+      m_generation.store(generation, std::memory_order_release);
+    }
+
+    return m_selected.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the instruction set of the variant that would be selected.
+   *
+   * \return the most preferred instruction set that has an available variant.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto selected_level() const noexcept -> simd_level
+  {
+    for (auto index = simd_level_count() - 1; index > 0; --index) {
+      const auto level = static_cast<simd_level>(index);
+      if (has_variant(level) && cpu::is_simd_available(level)) {
+        return level;
+      }
+    }
+
+    return simd_level::scalar;
+  }
+
+  /**
+   * \brief Returns the variant of the kernel for an instruction set.
+   *
+   * \param level the instruction set of the variant.
+   *
+   * \return the variant, which is null if the table doesn't provide it.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto variant(const simd_level level) const noexcept
+      -> function_type
+  {
+    return m_variants[index_of(level)];
+  }
+
+  /**
+   * \brief Indicates whether or not the table provides a variant for an instruction set.
+   *
+   * \param level the instruction set of the variant.
+   *
+   * \return `true` if the variant isn't null; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto has_variant(const simd_level level) const noexcept -> bool
+  {
+    return variant(level) != nullptr;
+  }
+
+ private:
+  std::array<function_type, 4> m_variants{};
+  mutable std::atomic<function_type> m_selected{};
+  mutable std::atomic<u32> m_generation{};  ///< Zero until the first selection.
+
+  [[nodiscard]] constexpr static auto index_of(const simd_level level) noexcept -> usize
+  {
+    return static_cast<usize>(level);
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_CPU_DISPATCH_HEADER
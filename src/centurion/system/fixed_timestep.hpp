@@ -0,0 +1,202 @@
+#ifndef CENTURION_FIXED_TIMESTEP_HEADER
+#define CENTURION_FIXED_TIMESTEP_HEADER
+
+#include <cassert>  // assert
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class fixed_timestep
+ *
+ * \brief Converts variable frame times into a whole amount of fixed simulation steps.
+ *
+ * \details The elapsed time of each frame is added to an accumulator, and `advance()`
+ * returns how many steps of the fixed size fit in the accumulated time. The remainder is
+ * kept for the next frame, and `alpha()` returns how far the simulation is between the
+ * last two steps, which should be used to interpolate the rendered state.
+ * \code{cpp}
+ *   auto timestep = cen::fixed_timestep::from_rate(120);
+ *
+ *   const auto steps = timestep.advance(frameTime);
+ *   for (cen::usize step = 0; step < steps; ++step) {
+ *     previous = current;
+ *     current = simulate(current, timestep.delta());
+ *   }
+ *
+ *   render(interpolate(previous, current, timestep.alpha()));
+ * \endcode
+ *
+ * \details The accumulated time is stored in nanoseconds, so the simulation doesn't drift
+ * due to rounding errors. The amount of steps per frame is limited, to avoid a spiral of
+ * death where each frame takes longer than the previous one, in which case the excess time
+ * is discarded.
+ *
+ * \see `game_loop`
+ *
+ * \since 6.4.0
+ */
+class fixed_timestep final
+{
+ public:
+  using duration_type = nanoseconds<u64>;
+
+  /**
+   * \brief Creates a fixed timestep.
+   *
+   * \param step the duration of each simulation step, must be greater than zero.
+   * \param maxSteps the maximum amount of steps per frame, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  explicit fixed_timestep(const duration_type step, const usize maxSteps = 8) noexcept
+      : m_step{step.count()}
+      , m_maxSteps{maxSteps}
+  {
+    assert(m_step > 0);
+    assert(m_maxSteps > 0);
+  }
+
+  /**
+   * \brief Creates a fixed timestep based on a simulation rate.
+   *
+   * \param hz the amount of simulation steps per second, must be greater than zero.
+   * \param maxSteps the maximum amount of steps per frame, must be greater than zero.
+   *
+   * \return a fixed timestep with the corresponding step duration.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto from_rate(const u32 hz, const usize maxSteps = 8) noexcept
+      -> fixed_timestep
+  {
+    assert(hz > 0);
+    return fixed_timestep{duration_type{1'000'000'000u / hz}, maxSteps};
+  }
+
+  /**
+   * \brief Adds the elapsed time of a frame, and returns the amount of steps to simulate.
+   *
+   * \param elapsed the time since the previous frame.
+   *
+   * \return the amount of simulation steps to run, at most the maximum amount of steps.
+   *
+   * \since 6.4.0
+   */
+  auto advance(const duration_type elapsed) noexcept -> usize
+  {
+    m_accumulator += elapsed.count();
+
+    auto steps = static_cast<usize>(m_accumulator / m_step);
+    if (steps > m_maxSteps) {
+      m_droppedSteps += steps - m_maxSteps;
+      steps = m_maxSteps;
+    }
+
+    m_accumulator %= m_step;
+    m_totalSteps += steps;
+
+    return steps;
+  }
+
+  /**
+   * \brief Discards the accumulated time, e.g. after the application was paused.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_accumulator = 0;
+  }
+
+  /**
+   * \brief Returns how far the simulation is between the last step and the next step.
+   *
+   * \return the interpolation factor, in the range [0, 1).
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto alpha() const noexcept -> double
+  {
+    return static_cast<double>(m_accumulator) / static_cast<double>(m_step);
+  }
+
+  /**
+   * \brief Returns the duration of each step, in seconds.
+   *
+   * \return the simulation delta time.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto delta() const noexcept -> double
+  {
+    return static_cast<double>(m_step) / 1'000'000'000.0;
+  }
+
+  /**
+   * \brief Returns the duration of each step.
+   *
+   * \return the step duration.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto step() const noexcept -> duration_type
+  {
+    return duration_type{m_step};
+  }
+
+  /**
+   * \brief Returns the maximum amount of steps per frame.
+   *
+   * \return the step limit.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto max_steps() const noexcept -> usize
+  {
+    return m_maxSteps;
+  }
+
+  /**
+   * \brief Returns the total amount of steps returned by `advance()`.
+   *
+   * \return the amount of simulated steps.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto total_steps() const noexcept -> u64
+  {
+    return m_totalSteps;
+  }
+
+  /**
+   * \brief Returns the amount of steps that were discarded due to the step limit.
+   *
+   * \return the amount of dropped steps, i.e. the amount of time that the simulation has
+   * fallen behind, in steps.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped_steps() const noexcept -> u64
+  {
+    return m_droppedSteps;
+  }
+
+ private:
+  u64 m_step{};
+  usize m_maxSteps{};
+  u64 m_accumulator{};
+  u64 m_totalSteps{};
+  u64 m_droppedSteps{};
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_FIXED_TIMESTEP_HEADER
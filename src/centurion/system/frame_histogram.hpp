@@ -0,0 +1,229 @@
+#ifndef CENTURION_FRAME_HISTOGRAM_HEADER
+#define CENTURION_FRAME_HISTOGRAM_HEADER
+
+#include <algorithm>  // min, max
+#include <array>      // array
+#include <cassert>    // assert
+#include <cmath>      // ceil
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class frame_histogram
+ *
+ * \brief Collects the distribution of frame times.
+ *
+ * \details Frame times are counted in a fixed amount of buckets of equal width, where the
+ * last bucket also counts all longer frame times. Unlike an average frame time, the
+ * histogram reveals stutter, e.g. a frame time of 99th percentile that is twice the
+ * median. Recording a frame time is cheap and never allocates.
+ * \code{cpp}
+ *   cen::frame_histogram histogram;  // 64 buckets of 1 ms each
+ *   histogram.record(frameTime);
+ *
+ *   const auto stutter = histogram.percentile(0.99) > 2 * histogram.percentile(0.5);
+ * \endcode
+ *
+ * \see `game_loop`
+ *
+ * \since 6.4.0
+ */
+class frame_histogram final
+{
+ public:
+  using duration_type = nanoseconds<u64>;
+
+  /// The amount of buckets in the histogram.
+  inline constexpr static usize bucket_count = 64;
+
+  /**
+   * \brief Creates an empty histogram.
+   *
+   * \param bucketWidth the range of frame times covered by each bucket, must be greater
+   * than zero.
+   *
+   * \since 6.4.0
+   */
+  explicit frame_histogram(const duration_type bucketWidth = default_bucket_width()) noexcept
+      : m_width{bucketWidth.count()}
+  {
+    assert(m_width > 0);
+  }
+
+  /**
+   * \brief Adds a frame time to the histogram.
+   *
+   * \param frameTime the duration of a frame.
+   *
+   * \since 6.4.0
+   */
+  void record(const duration_type frameTime) noexcept
+  {
+    const auto ns = frameTime.count();
+    const auto bucket = std::min(static_cast<usize>(ns / m_width), bucket_count - 1u);
+
+    ++m_buckets[bucket];
+
+    m_min = (m_count == 0) ? ns : std::min(m_min, ns);
+    m_max = std::max(m_max, ns);
+    m_total += ns;
+    ++m_count;
+  }
+
+  /**
+   * \brief Removes all recorded frame times.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_buckets.fill(0);
+    m_count = 0;
+    m_total = 0;
+    m_min = 0;
+    m_max = 0;
+  }
+
+  /**
+   * \brief Returns an estimate of a percentile of the recorded frame times.
+   *
+   * \details The estimate is the upper bound of the bucket that contains the percentile,
+   * limited to the longest recorded frame time. Percentiles in the last bucket, which has
+   * no upper bound, are estimated as the longest recorded frame time.
+   *
+   * \param fraction the percentile, in the range [0, 1], e.g. 0.5 for the median.
+   *
+   * \return the frame time that the fraction of frames didn't exceed; zero if nothing has
+   * been recorded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto percentile(const double fraction) const noexcept -> duration_type
+  {
+    assert(fraction >= 0 && fraction <= 1);
+
+    if (m_count == 0) {
+      return duration_type::zero();
+    }
+
+    const auto rank = std::ceil(fraction * static_cast<double>(m_count));
+    const auto target = std::max(static_cast<u64>(rank), u64{1});
+
+    u64 seen = 0;
+    for (usize bucket = 0; bucket < bucket_count; ++bucket) {
+      seen += m_buckets[bucket];
+      if (seen >= target && bucket + 1u < bucket_count) {
+        return duration_type{std::min((bucket + 1u) * m_width, m_max)};
+      }
+    }
+
+    return duration_type{m_max};
+  }
+
+  /**
+   * \brief Returns the amount of recorded frame times.
+   *
+   * \return the frame count.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto count() const noexcept -> u64
+  {
+    return m_count;
+  }
+
+  /**
+   * \brief Returns the shortest recorded frame time.
+   *
+   * \return the minimum frame time; zero if nothing has been recorded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto min() const noexcept -> duration_type
+  {
+    return duration_type{m_min};
+  }
+
+  /**
+   * \brief Returns the longest recorded frame time.
+   *
+   * \return the maximum frame time; zero if nothing has been recorded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto max() const noexcept -> duration_type
+  {
+    return duration_type{m_max};
+  }
+
+  /**
+   * \brief Returns the average of the recorded frame times.
+   *
+   * \return the mean frame time; zero if nothing has been recorded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto mean() const noexcept -> duration_type
+  {
+    return duration_type{(m_count != 0) ? m_total / m_count : 0};
+  }
+
+  /**
+   * \brief Returns the range of frame times covered by each bucket.
+   *
+   * \return the bucket width.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bucket_width() const noexcept -> duration_type
+  {
+    return duration_type{m_width};
+  }
+
+  /**
+   * \brief Returns the amount of frame times in each bucket.
+   *
+   * \details Bucket `i` counts the frame times in `[i * width, (i + 1) * width)`, except
+   * for the last bucket, which counts all frame times of at least `63 * width`.
+   *
+   * \return the bucket counts.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto buckets() const noexcept -> const std::array<u64, bucket_count>&
+  {
+    return m_buckets;
+  }
+
+  /**
+   * \brief Returns the bucket width that is used by default, i.e. one millisecond.
+   *
+   * \return the default bucket width.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_bucket_width() noexcept -> duration_type
+  {
+    return duration_type{1'000'000};
+  }
+
+ private:
+  std::array<u64, bucket_count> m_buckets{};
+  u64 m_width{};
+  u64 m_count{};
+  u64 m_total{};
+  u64 m_min{};
+  u64 m_max{};
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_FRAME_HISTOGRAM_HEADER
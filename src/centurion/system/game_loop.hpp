@@ -0,0 +1,350 @@
+#ifndef CENTURION_GAME_LOOP_HEADER
+#define CENTURION_GAME_LOOP_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>   // assert
+#include <optional>  // optional
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../thread/deadline.hpp"
+#include "../video/screen.hpp"
+#include "counter.hpp"
+#include "fixed_timestep.hpp"
+#include "frame_histogram.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class game_loop
+ *
+ * \brief Paces a game loop, with a fixed simulation timestep and interpolated rendering.
+ *
+ * \details Each frame measures the time since the previous frame with the high-performance
+ * counter, runs the amount of fixed simulation steps that fit in the elapsed time (see
+ * `fixed_timestep`), renders with the interpolation factor, and then waits until the
+ * deadline of the next frame. The wait sleeps until shortly before the deadline and spins
+ * for the remainder, see `sleep_until()`, so frames are paced with sub-millisecond
+ * accuracy without busy-waiting for the entire frame.
+ * \code{cpp}
+ *   auto loop = cen::game_loop::for_display(cen::fixed_timestep::from_rate(120));
+ *
+ *   while (running) {
+ *     loop.run_frame([&](const double dt) { world.update(dt); },
+ *                    [&](const double alpha) {
+ *                      dispatcher.poll();
+ *                      world.render(renderer, alpha);
+ *                      renderer.present();
+ *                    });
+ *   }
+ * \endcode
+ *
+ * \details The frame times are recorded in a histogram, and frames that finish after their
+ * deadline are counted as missed. Missed deadlines are skipped, i.e. the loop never tries
+ * to catch up by running frames back-to-back.
+ *
+ * \note Disable pacing with `set_pacing()` if the renderer uses VSync, in which case
+ * `basic_renderer::present()` already blocks until the next refresh.
+ *
+ * \see `fixed_timestep`
+ * \see `frame_histogram`
+ * \see `frame_pacer`
+ *
+ * \since 6.4.0
+ */
+class game_loop final
+{
+ public:
+  using duration_type = nanoseconds<u64>;
+
+  /**
+   * \brief Creates a game loop with a fixed frame interval.
+   *
+   * \param interval the time between frame deadlines, must be greater than zero.
+   * \param timestep the simulation timestep.
+   *
+   * \since 6.4.0
+   */
+  game_loop(const duration_type interval, const fixed_timestep& timestep) noexcept
+      : m_timestep{timestep}
+      , m_interval{interval}
+      , m_intervalTicks{deadline::to_counter_ticks(interval)}
+  {
+    assert(interval.count() > 0);
+  }
+
+  /**
+   * \brief Creates a game loop that is paced by the refresh rate of a display.
+   *
+   * \param timestep the simulation timestep.
+   * \param index the index of the display.
+   *
+   * \return a game loop with a frame interval based on the refresh rate of the display; 60
+   * Hz is used if the refresh rate is unknown.
+   *
+   * \see `screen::refresh_rate()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto for_display(const fixed_timestep& timestep, const int index = 0)
+      -> game_loop
+  {
+    auto rate = screen::refresh_rate(index).value_or(0);
+    if (rate <= 0) {
+      rate = 60;
+    }
+
+    return game_loop{duration_type{1'000'000'000u / static_cast<u32>(rate)}, timestep};
+  }
+
+  /**
+   * \brief Runs a complete frame.
+   *
+   * \details This is equivalent to calling `begin_frame()`, invoking the update function
+   * for each simulation step, invoking the render function, and calling `end_frame()`.
+   *
+   * \tparam Update the type of the update function object, invoked as `void(double)` with
+   * the simulation timestep in seconds.
+   * \tparam Render the type of the render function object, invoked as `void(double)` with
+   * the interpolation factor.
+   *
+   * \param update the function object that advances the simulation by one step.
+   * \param render the function object that renders the interpolated state.
+   *
+   * \since 6.4.0
+   */
+  template <typename Update, typename Render>
+  void run_frame(Update&& update, Render&& render)
+  {
+    const auto steps = begin_frame();
+    const auto delta = m_timestep.delta();
+
+    for (usize step = 0; step < steps; ++step) {
+      update(delta);
+    }
+
+    render(m_timestep.alpha());
+    end_frame();
+  }
+
+  /**
+   * \brief Starts a frame, and returns the amount of simulation steps to run.
+   *
+   * \details The time since the start of the previous frame is recorded in the frame time
+   * histogram, and is added to the timestep. Nothing is recorded for the first frame.
+   *
+   * \return the amount of fixed simulation steps to run in this frame.
+   *
+   * \since 6.4.0
+   */
+  auto begin_frame() noexcept -> usize
+  {
+    const auto now = counter::now();
+
+    if (!m_frameStart) {
+      m_frameStart = now;
+      return 0;
+    }
+
+    m_frameTime = deadline::from_counter_ticks(now - *m_frameStart);
+    m_frameStart = now;
+
+    m_histogram.record(m_frameTime);
+    ++m_frames;
+
+    return m_timestep.advance(m_frameTime);
+  }
+
+  /**
+   * \brief Ends a frame, by waiting until the deadline of the next frame.
+   *
+   * \details Nothing happens if pacing is disabled. If the frame finished after its
+   * deadline, the deadline is counted as missed, and a new deadline is based on the
+   * current time.
+   *
+   * \since 6.4.0
+   */
+  void end_frame() noexcept
+  {
+    if (!m_pacing) {
+      return;
+    }
+
+    const auto now = counter::now();
+
+    if (!m_deadline) {
+      m_deadline = now + m_intervalTicks;
+    }
+    else if (now > *m_deadline) {
+      // Only re-anchor when late, so that on-time frames don't accumulate drift
+      ++m_missedDeadlines;
+      m_deadline = now + m_intervalTicks;
+    }
+
+    sleep_until(deadline{*m_deadline});
+
+    // The next deadline is exactly one interval after the current one
+    *m_deadline += m_intervalTicks;
+  }
+
+  /**
+   * \brief Resets the frame timing, e.g. after the application was paused.
+   *
+   * \details The next frame is treated as the first frame, and the accumulated time of the
+   * timestep is discarded. The statistics are not affected.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_frameStart.reset();
+    m_deadline.reset();
+    m_timestep.reset();
+  }
+
+  /**
+   * \brief Removes all recorded frame times, and resets the missed deadline count.
+   *
+   * \since 6.4.0
+   */
+  void reset_stats() noexcept
+  {
+    m_histogram.reset();
+    m_missedDeadlines = 0;
+  }
+
+  /**
+   * \brief Sets whether or not `end_frame()` waits until the next frame deadline.
+   *
+   * \details Pacing is enabled by default.
+   *
+   * \param pacing `true` if frames should be paced; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  void set_pacing(const bool pacing) noexcept
+  {
+    m_pacing = pacing;
+    m_deadline.reset();
+  }
+
+  /**
+   * \brief Indicates whether or not frames are paced.
+   *
+   * \return `true` if `end_frame()` waits for the next frame deadline; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pacing() const noexcept -> bool
+  {
+    return m_pacing;
+  }
+
+  /**
+   * \brief Returns the interpolation factor for rendering the current frame.
+   *
+   * \return the interpolation factor, in the range [0, 1).
+   *
+   * \see `fixed_timestep::alpha()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto alpha() const noexcept -> double
+  {
+    return m_timestep.alpha();
+  }
+
+  /**
+   * \brief Returns the time between frame deadlines.
+   *
+   * \return the frame interval.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto interval() const noexcept -> duration_type
+  {
+    return m_interval;
+  }
+
+  /**
+   * \brief Returns the duration of the previous frame.
+   *
+   * \return the most recent frame time; zero before the second frame.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto frame_time() const noexcept -> duration_type
+  {
+    return m_frameTime;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been timed.
+   *
+   * \return the frame count.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto frame_count() const noexcept -> u64
+  {
+    return m_frames;
+  }
+
+  /**
+   * \brief Returns the amount of frames that finished after their deadline.
+   *
+   * \return the missed deadline count.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto missed_deadlines() const noexcept -> u64
+  {
+    return m_missedDeadlines;
+  }
+
+  /**
+   * \brief Returns the histogram of the frame times.
+   *
+   * \return the frame time histogram.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto histogram() const noexcept -> const frame_histogram&
+  {
+    return m_histogram;
+  }
+
+  /**
+   * \brief Returns the simulation timestep.
+   *
+   * \return the fixed timestep.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto timestep() const noexcept -> const fixed_timestep&
+  {
+    return m_timestep;
+  }
+
+ private:
+  fixed_timestep m_timestep;
+  frame_histogram m_histogram;
+  duration_type m_interval{};
+  duration_type m_frameTime{};
+  u64 m_intervalTicks{};
+  u64 m_frames{};
+  u64 m_missedDeadlines{};
+  std::optional<u64> m_frameStart;
+  std::optional<u64> m_deadline;
+  bool m_pacing{true};
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_GAME_LOOP_HEADER
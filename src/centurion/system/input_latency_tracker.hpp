@@ -0,0 +1,356 @@
+#ifndef CENTURION_INPUT_LATENCY_TRACKER_HEADER
+#define CENTURION_INPUT_LATENCY_TRACKER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>  // array
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "counter.hpp"
+#include "frame_histogram.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+struct input_latency_data final
+{
+  inline constexpr static usize capacity = 64;
+
+  std::array<u64, capacity> pending{};  ///< Counter values of the unpresented inputs.
+  usize count{};
+  u64 lost{};
+  u64 presents{};
+  frame_histogram histogram{milliseconds<u64>{2}};
+  bool active{};
+  bool motion{};
+};
+
+[[nodiscard]] inline auto get_input_latency_data() noexcept -> input_latency_data&
+{
+  static input_latency_data data;
+  return data;
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class input_latency_tracker
+ *
+ * \brief Measures the latency between input events and the presentation of the frames
+ * that reflect them.
+ *
+ * \details The tracker is opt-in, and records nothing until `start()` is called. Event
+ * dispatchers then tag every dispatched input event, e.g. key presses and mouse clicks,
+ * and the next call to `renderer::present()` records the time since each tagged event
+ * occurred. The percentiles of the recorded latencies can be used to compare the effect
+ * of vsync modes, frame pacing and event batching on responsiveness.
+ * \code{cpp}
+ *   cen::input_latency_tracker::start();
+ *
+ *   // ...run the game loop for a while
+ *
+ *   const auto median = cen::input_latency_tracker::percentile(0.5);
+ *   const auto worst = cen::input_latency_tracker::percentile(0.99);
+ * \endcode
+ *
+ * \details The time at which an event occurred is derived from its SDL timestamp, which
+ * has millisecond resolution, while the time spent between dispatching the event and the
+ * return of `present()` is measured with `counter::now()`. The measured latency ends when
+ * the frame has been handed over to the driver, so the scanout and display latency is not
+ * included.
+ *
+ * \note The tracker is not thread-safe, so events must be dispatched and presented on the
+ * same thread, which is required by SDL anyway.
+ *
+ * \see `event_dispatcher`
+ * \see `startup_tracer`
+ *
+ * \since 6.4.0
+ */
+class input_latency_tracker final
+{
+ public:
+  using size_type = usize;
+  using duration_type = frame_histogram::duration_type;
+
+  input_latency_tracker() = delete;
+
+  /**
+   * \brief Starts recording latencies, discarding any previously recorded latencies.
+   *
+   * \since 6.4.0
+   */
+  static void start() noexcept
+  {
+    reset();
+    detail::get_input_latency_data().active = true;
+  }
+
+  /**
+   * \brief Stops recording latencies, keeping the latencies that have been recorded.
+   *
+   * \since 6.4.0
+   */
+  static void stop() noexcept
+  {
+    auto& data = detail::get_input_latency_data();
+    data.active = false;
+    data.count = 0;
+  }
+
+  /**
+   * \brief Stops recording and discards all recorded latencies.
+   *
+   * \since 6.4.0
+   */
+  static void reset() noexcept
+  {
+    auto& data = detail::get_input_latency_data();
+    data.active = false;
+    data.count = 0;
+    data.lost = 0;
+    data.presents = 0;
+    data.histogram.reset();
+  }
+
+  /**
+   * \brief Indicates whether or not latencies are currently being recorded.
+   *
+   * \return `true` if the tracker has been started, but not stopped; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto active() noexcept -> bool
+  {
+    return detail::get_input_latency_data().active;
+  }
+
+  /**
+   * \brief Sets whether or not mouse and finger motion events are tracked.
+   *
+   * \details Motion events are ignored by default, since they are usually received at a
+   * high rate and would dominate the recorded latencies.
+   *
+   * \param tracked `true` if motion events should be tracked; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  static void set_motion_tracked(const bool tracked) noexcept
+  {
+    detail::get_input_latency_data().motion = tracked;
+  }
+
+  /**
+   * \brief Indicates whether or not mouse and finger motion events are tracked.
+   *
+   * \return `true` if motion events are tracked; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto is_motion_tracked() noexcept -> bool
+  {
+    return detail::get_input_latency_data().motion;
+  }
+
+  /**
+   * \brief Tags an input event, if the tracker is active.
+   *
+   * \details This is called by event dispatchers for every dispatched event. Events that
+   * aren't input events, such as window events, are ignored.
+   *
+   * \param event the dispatched event.
+   *
+   * \since 6.4.0
+   */
+  static void record_input(const SDL_Event& event) noexcept
+  {
+    const auto& data = detail::get_input_latency_data();
+    if (!data.active || !is_input(event.type, data.motion)) {
+      return;
+    }
+
+    const auto now = counter::now();
+
+    // Events without a timestamp, e.g. pushed events, are assumed to have just occurred
+    const auto timestamp = event.common.timestamp;
+    const auto ticks = SDL_GetTicks();
+    const u64 age = (timestamp != 0 && ticks > timestamp) ? ticks - timestamp : 0;
+
+    const auto ageTicks = age * counter::frequency() / 1'000;
+    record_input(now > ageTicks ? now - ageTicks : 0);
+  }
+
+  /**
+   * \brief Tags an input that occurred at the specified time, if the tracker is active.
+   *
+   * \details This can be used to track inputs that aren't received as events, e.g. polled
+   * keyboard state. Inputs are dropped if too many inputs are tagged between presents.
+   *
+   * \param ticks the value of `counter::now()` when the input occurred.
+   *
+   * \since 6.4.0
+   */
+  static void record_input(const u64 ticks) noexcept
+  {
+    auto& data = detail::get_input_latency_data();
+    if (!data.active) {
+      return;
+    }
+
+    if (data.count < detail::input_latency_data::capacity) {
+      data.pending[data.count] = ticks;
+      ++data.count;
+    }
+    else {
+      ++data.lost;
+    }
+  }
+
+  /**
+   * \brief Records the latency of the inputs that were tagged since the previous present.
+   *
+   * \details This is called by `renderer::present()`, and does nothing if the tracker isn't
+   * active.
+   *
+   * \param ticks the value of `counter::now()` after presenting.
+   *
+   * \since 6.4.0
+   */
+  static void record_present(const u64 ticks) noexcept
+  {
+    auto& data = detail::get_input_latency_data();
+    if (!data.active || data.count == 0) {
+      return;
+    }
+
+    for (usize index = 0; index < data.count; ++index) {
+      const auto input = data.pending[index];
+      data.histogram.record(to_nanoseconds(ticks > input ? ticks - input : 0));
+    }
+
+    data.count = 0;
+    ++data.presents;
+  }
+
+  /**
+   * \brief Returns an estimate of a percentile of the recorded latencies.
+   *
+   * \param fraction the percentile, in the range [0, 1], e.g. 0.99 for the 99th percentile.
+   *
+   * \return the latency that the fraction of inputs didn't exceed; zero if nothing has been
+   * recorded.
+   *
+   * \see `frame_histogram::percentile()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto percentile(const double fraction) noexcept -> duration_type
+  {
+    return histogram().percentile(fraction);
+  }
+
+  /**
+   * \brief Returns the distribution of the recorded latencies.
+   *
+   * \details The histogram uses buckets of 2 ms each.
+   *
+   * \return the latency histogram.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto histogram() noexcept -> const frame_histogram&
+  {
+    return detail::get_input_latency_data().histogram;
+  }
+
+  /**
+   * \brief Returns the amount of inputs that have been tagged but not yet presented.
+   *
+   * \return the amount of pending inputs.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto pending() noexcept -> size_type
+  {
+    return detail::get_input_latency_data().count;
+  }
+
+  /**
+   * \brief Returns the amount of presents that reflected at least one tagged input.
+   *
+   * \return the amount of measured presents.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto presents() noexcept -> u64
+  {
+    return detail::get_input_latency_data().presents;
+  }
+
+  /**
+   * \brief Returns the amount of inputs that were dropped because too many inputs were
+   * tagged between two presents.
+   *
+   * \return the amount of dropped inputs.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto lost() noexcept -> u64
+  {
+    return detail::get_input_latency_data().lost;
+  }
+
+ private:
+  [[nodiscard]] static auto is_input(const u32 type, const bool motion) noexcept -> bool
+  {
+    switch (type) {
+      case SDL_KEYDOWN:
+      case SDL_KEYUP:
+      case SDL_TEXTINPUT:
+      case SDL_MOUSEBUTTONDOWN:
+      case SDL_MOUSEBUTTONUP:
+      case SDL_MOUSEWHEEL:
+      case SDL_JOYBUTTONDOWN:
+      case SDL_JOYBUTTONUP:
+      case SDL_JOYHATMOTION:
+      case SDL_CONTROLLERBUTTONDOWN:
+      case SDL_CONTROLLERBUTTONUP:
+      case SDL_FINGERDOWN:
+      case SDL_FINGERUP:
+        return true;
+
+      case SDL_MOUSEMOTION:
+      case SDL_JOYAXISMOTION:
+      case SDL_CONTROLLERAXISMOTION:
+      case SDL_FINGERMOTION:
+        return motion;
+
+      default:
+        return false;
+    }
+  }
+
+  [[nodiscard]] static auto to_nanoseconds(const u64 ticks) noexcept -> duration_type
+  {
+    const auto frequency = counter::frequency();
+    if (frequency == 0) {
+      return duration_type::zero();
+    }
+
+    return duration_type{ticks / frequency * 1'000'000'000 +
+                         ticks % frequency * 1'000'000'000 / frequency};
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_INPUT_LATENCY_TRACKER_HEADER
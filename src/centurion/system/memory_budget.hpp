@@ -0,0 +1,395 @@
+#ifndef CENTURION_MEMORY_BUDGET_HEADER
+#define CENTURION_MEMORY_BUDGET_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>   // find_if, min, upper_bound
+#include <atomic>      // atomic, memory_order
+#include <functional>  // function
+#include <limits>      // numeric_limits
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "ram.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct memory_budget_stats
+ *
+ * \brief Provides statistics about the trims performed by a memory budget.
+ *
+ * \since 6.4.0
+ */
+struct memory_budget_stats final
+{
+  usize trims{};        ///< The amount of times that caches were trimmed.
+  usize low_memory{};   ///< The amount of handled low memory notifications.
+  usize freed_bytes{};  ///< The total amount of memory freed by trims, in bytes.
+};
+
+/**
+ * \class memory_budget
+ *
+ * \brief Keeps the memory used by a set of caches within a budget, and trims them when
+ * the system runs low on memory.
+ *
+ * \details Caches register with a priority, a function that reports their memory usage,
+ * and a function that frees memory on request. When the combined usage exceeds the
+ * budget, or when the operating system reports that it's low on memory, the caches are
+ * trimmed in priority order, starting with the lowest priority, until enough memory has
+ * been freed. On low memory notifications, every cache is asked to free as much as it can.
+ *
+ * \details Types that provide `resident_bytes()` and `free_memory()`, such as
+ * `texture_pool`, `texture_streamer` and `sound_bank`, can be registered directly, other
+ * caches are registered with a pair of functions.
+ * \code{cpp}
+ *   cen::memory_budget budget;  // A quarter of the system RAM
+ *   budget.add(pool, 0);        // Idle textures are the cheapest to lose
+ *   budget.add(streamer, 1);
+ *   budget.add(2,
+ *              [&] { return cache.atlas_memory_usage(); },
+ *              [&](const cen::usize bytes) { return cache.free_memory(bytes); });
+ *
+ *   while (running) {
+ *     ...
+ *     budget.update();  // After rendering, so that the caches aren't in use
+ *   }
+ * \endcode
+ *
+ * \details The budget installs an event watch for `event_type::app_low_memory`, which
+ * only records the notification, since the watch may be invoked on another thread. The
+ * caches are trimmed by the next call to `update()`.
+ *
+ * \note All functions, except for `notify_low_memory()`, must be called on the thread
+ * that uses the registered caches.
+ *
+ * \see `ram::amount_mb()`
+ *
+ * \since 6.4.0
+ */
+class memory_budget final
+{
+ public:
+  using id_type = usize;
+  using usage_function = std::function<usize()>;
+  using trim_function = std::function<usize(usize)>;
+
+  /**
+   * \brief Creates a memory budget, and starts listening for low memory notifications.
+   *
+   * \param budget the maximum combined memory usage of the caches, in bytes, zero means
+   * that caches are only trimmed when the system is low on memory.
+   *
+   * \see `default_budget()`
+   *
+   * \since 6.4.0
+   */
+  explicit memory_budget(const usize budget = default_budget()) noexcept : m_budget{budget}
+  {
+    SDL_AddEventWatch(on_event, this);
+  }
+
+  memory_budget(const memory_budget&) = delete;
+  memory_budget(memory_budget&&) = delete;
+
+  auto operator=(const memory_budget&) -> memory_budget& = delete;
+  auto operator=(memory_budget&&) -> memory_budget& = delete;
+
+  ~memory_budget() noexcept
+  {
+    SDL_DelEventWatch(on_event, this);
+  }
+
+  /**
+   * \brief Registers a cache.
+   *
+   * \details Caches with lower priorities are trimmed first, and caches with the same
+   * priority are trimmed in the order they were registered in.
+   *
+   * \param priority the priority of the cache.
+   * \param usage a function that returns the amount of memory used by the cache, in bytes.
+   * \param trim a function that tries to free a requested amount of memory, in bytes, and
+   * returns the amount of memory that was actually freed.
+   *
+   * \return the ID of the registration, which can be used to remove the cache.
+   *
+   * \since 6.4.0
+   */
+  auto add(const int priority, usage_function usage, trim_function trim) -> id_type
+  {
+    const auto position =
+        std::upper_bound(m_clients.begin(),
+                         m_clients.end(),
+                         priority,
+                         [](const int value, const client& c) { return value < c.priority; });
+
+    const auto id = m_nextId++;
+    m_clients.insert(position, client{std::move(usage), std::move(trim), id, priority});
+
+    return id;
+  }
+
+  /**
+   * \brief Registers a cache that provides `resident_bytes()` and `free_memory()`.
+   *
+   * \note The cache must be removed before it is destroyed.
+   *
+   * \tparam Cache the type of the cache, e.g. `texture_pool`.
+   *
+   * \param cache the cache that will be trimmed.
+   * \param priority the priority of the cache.
+   *
+   * \return the ID of the registration.
+   *
+   * \since 6.4.0
+   */
+  template <typename Cache>
+  auto add(Cache& cache, const int priority = 0) -> id_type
+  {
+    return add(
+        priority,
+        [&cache] { return static_cast<usize>(cache.resident_bytes()); },
+        [&cache](const usize bytes) { return static_cast<usize>(cache.free_memory(bytes)); });
+  }
+
+  /**
+   * \brief Removes a cache.
+   *
+   * \param id the ID of the registration, obtained from `add()`.
+   *
+   * \return `true` if the cache was removed; `false` if the ID is unknown.
+   *
+   * \since 6.4.0
+   */
+  auto remove(const id_type id) -> bool
+  {
+    const auto it = std::find_if(m_clients.begin(), m_clients.end(), [id](const client& c) {
+      return c.id == id;
+    });
+
+    if (it != m_clients.end()) {
+      m_clients.erase(it);
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Trims the caches if the system is low on memory, or if the budget is exceeded.
+   *
+   * \details This should be called regularly, e.g. once per frame.
+   *
+   * \return the amount of memory that was freed, in bytes.
+   *
+   * \since 6.4.0
+   */
+  auto update() -> usize
+  {
+    if (m_lowMemory.exchange(false, std::memory_order_acquire)) {
+      ++m_stats.low_memory;
+      return trim_all();
+    }
+
+    if (m_budget != 0) {
+      const auto used = usage();
+      if (used > m_budget) {
+        return trim(used - m_budget);
+      }
+    }
+
+    return 0;
+  }
+
+  /**
+   * \brief Trims the caches in priority order until a certain amount of memory is freed.
+   *
+   * \param bytes the amount of memory that should be freed, in bytes.
+   *
+   * \return the amount of memory that was freed, which might be less than requested.
+   *
+   * \since 6.4.0
+   */
+  auto trim(const usize bytes) -> usize
+  {
+    usize freed = 0;
+
+    for (auto& client : m_clients) {
+      if (freed >= bytes) {
+        break;
+      }
+
+      freed += client.trim(bytes - freed);
+    }
+
+    ++m_stats.trims;
+    m_stats.freed_bytes += freed;
+
+    return freed;
+  }
+
+  /**
+   * \brief Asks every cache to free as much memory as it can.
+   *
+   * \return the amount of memory that was freed, in bytes.
+   *
+   * \since 6.4.0
+   */
+  auto trim_all() -> usize
+  {
+    usize freed = 0;
+
+    for (auto& client : m_clients) {
+      freed += client.trim(client.usage());
+    }
+
+    ++m_stats.trims;
+    m_stats.freed_bytes += freed;
+
+    return freed;
+  }
+
+  /**
+   * \brief Records a low memory notification, which is handled by the next `update()`.
+   *
+   * \details This is done automatically for `event_type::app_low_memory` events, and may
+   * be called from any thread, e.g. in response to platform specific memory warnings.
+   *
+   * \since 6.4.0
+   */
+  void notify_low_memory() noexcept
+  {
+    m_lowMemory.store(true, std::memory_order_release);
+  }
+
+  /**
+   * \brief Sets the maximum combined memory usage of the caches.
+   *
+   * \details The caches are trimmed by the next `update()` if the new budget is exceeded.
+   *
+   * \param bytes the memory budget, in bytes, zero means no limit.
+   *
+   * \since 6.4.0
+   */
+  void set_budget(const usize bytes) noexcept
+  {
+    m_budget = bytes;
+  }
+
+  /**
+   * \brief Returns the maximum combined memory usage of the caches.
+   *
+   * \return the memory budget, in bytes, zero if there is no limit.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto budget() const noexcept -> usize
+  {
+    return m_budget;
+  }
+
+  /**
+   * \brief Returns the combined memory usage of the registered caches.
+   *
+   * \return the memory usage, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto usage() const -> usize
+  {
+    usize bytes = 0;
+    for (const auto& client : m_clients) {
+      bytes += client.usage();
+    }
+
+    return bytes;
+  }
+
+  /**
+   * \brief Indicates whether or not a low memory notification hasn't been handled yet.
+   *
+   * \return `true` if the caches will be trimmed by the next `update()`; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_low_memory_pending() const noexcept -> bool
+  {
+    return m_lowMemory.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the amount of registered caches.
+   *
+   * \return the number of caches.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_clients.size();
+  }
+
+  /**
+   * \brief Returns statistics about the performed trims.
+   *
+   * \return the current statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto statistics() const noexcept -> const memory_budget_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Returns the default memory budget, based on the amount of system RAM.
+   *
+   * \return a quarter of the system RAM, or 256 MiB if the amount of RAM is unknown.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto default_budget() noexcept -> usize
+  {
+    const auto megabytes = ram::amount_mb();
+    const auto total = (megabytes > 0) ? static_cast<u64>(megabytes) : u64{1'024};
+    const auto bytes = total / 4u * 1'024u * 1'024u;
+
+    return static_cast<usize>(std::min<u64>(bytes, std::numeric_limits<usize>::max()));
+  }
+
+ private:
+  struct client final
+  {
+    usage_function usage;
+    trim_function trim;
+    id_type id{};
+    int priority{};
+  };
+
+  std::vector<client> m_clients;  ///< Sorted by priority.
+  memory_budget_stats m_stats;
+  usize m_budget{};
+  id_type m_nextId{};
+  std::atomic<bool> m_lowMemory{};
+
+  static auto on_event(void* data, SDL_Event* event) -> int
+  {
+    if (event->type == SDL_APP_LOWMEMORY) {
+      static_cast<memory_budget*>(data)->notify_low_memory();
+    }
+
+    return 0;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_MEMORY_BUDGET_HEADER
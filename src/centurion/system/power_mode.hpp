@@ -0,0 +1,106 @@
+#ifndef CENTURION_POWER_MODE_HEADER
+#define CENTURION_POWER_MODE_HEADER
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "../core/exception.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \enum power_mode
+ *
+ * \brief Provides values that represent how much work an application should do, based on
+ * the power source of the system.
+ *
+ * \see `power_profile`
+ * \see `power_mode_count()`
+ *
+ * \since 6.4.0
+ */
+enum class power_mode
+{
+  performance,  ///< Plugged in, or without a battery, so nothing is held back.
+  balanced,     ///< Running on battery power.
+  power_saving  ///< Running on battery power, with little charge left.
+};
+
+/**
+ * \brief Returns the number of enumerators for the `power_mode` enum.
+ *
+ * \return the number of enumerators.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto power_mode_count() noexcept -> int
+{
+  return 3;
+}
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied power mode.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(power_mode::balanced) == "balanced"`.
+ *
+ * \param mode the power mode that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const power_mode mode) -> std::string_view
+{
+  switch (mode) {
+    case power_mode::performance:
+      return "performance";
+
+    case power_mode::balanced:
+      return "balanced";
+
+    case power_mode::power_saving:
+      return "power_saving";
+
+    default:
+      throw cen_error{"Did not recognize power mode!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a power mode enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param mode the power mode that will be printed.
+ *
+ * \see `to_string(power_mode)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const power_mode mode) -> std::ostream&
+{
+  return stream << to_string(mode);
+}
+
+/// \} End of streaming
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_POWER_MODE_HEADER
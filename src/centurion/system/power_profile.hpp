@@ -0,0 +1,467 @@
+#ifndef CENTURION_POWER_PROFILE_HEADER
+#define CENTURION_POWER_PROFILE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>     // array
+#include <cassert>   // assert
+#include <optional>  // optional, nullopt
+
+#include "../audio/resample_quality.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../events/event_listeners.hpp"
+#include "counter.hpp"
+#include "power_mode.hpp"
+#include "power_state.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct power_settings
+ *
+ * \brief Describes the amount of work that should be done in a power mode.
+ *
+ * \see `power_profile::set_settings()`
+ *
+ * \since 6.4.0
+ */
+struct power_settings final
+{
+  /// The maximum frame rate, in Hz; zero for no limit.
+  int frame_rate{};
+
+  /// The finest level of detail of streamed textures, see `texture_streamer`.
+  int texture_level{};
+
+  /// The quality of the sample rate conversion of sound effects that are loaded later.
+  resample_quality audio_quality{resample_quality::balanced};
+};
+
+/**
+ * \struct power_change
+ *
+ * \brief Describes the power state that was sampled by a `power_profile`.
+ *
+ * \details This is the event published by power profiles, which can be handled directly
+ * by `frame_pacer`, `texture_streamer` and `sound_bank`.
+ *
+ * \since 6.4.0
+ */
+struct power_change final
+{
+  power_mode mode{power_mode::performance};      ///< The current power mode.
+  power_mode previous{power_mode::performance};  ///< The power mode before the change.
+  power_settings settings;                       ///< The settings of the current mode.
+  power_state state{power_state::unknown};       ///< The current power state.
+  std::optional<int> percentage;                 ///< The remaining battery percentage.
+  std::optional<seconds<int>> seconds_left;      ///< The remaining battery life.
+};
+
+/**
+ * \class power_profile
+ *
+ * \brief Selects a power mode based on the battery of the system, and notifies
+ * subscribers when it changes.
+ *
+ * \details Querying the battery is a relatively expensive system call, so a power profile
+ * only samples the power state every few seconds, and the cached values can be queried
+ * freely in between. The power mode is `power_mode::performance` while the system is
+ * plugged in, `power_mode::balanced` on battery power, and `power_mode::power_saving` when
+ * the battery percentage drops to the low battery threshold.
+ *
+ * \details Each mode is associated with a set of `power_settings`, which are published
+ * to the listeners when the power mode or state changes. The frame pacer and the
+ * streaming managers provide `handle()` overloads for power changes, so they can
+ * subscribe directly.
+ * \code{cpp}
+ *   cen::power_profile profile;
+ *   profile.listeners().connect<&cen::frame_pacer::handle>(&pacer);
+ *   profile.listeners().connect<&cen::texture_streamer::handle>(&streamer);
+ *   pacer.handle(profile.current());  // Apply the initial settings
+ *
+ *   while (running) {
+ *     profile.update();  // Cheap unless the sample interval has elapsed
+ *     ...
+ *   }
+ * \endcode
+ *
+ * \since 6.4.0
+ */
+class power_profile final
+{
+ public:
+  using ms_type = milliseconds<u32>;
+  using listeners_type = event_listeners<power_change>;
+
+  /**
+   * \brief Creates a power profile, and samples the initial power state.
+   *
+   * \details No notification is published for the initial sample, use `current()` to
+   * apply it.
+   *
+   * \param interval the minimum time between samples, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  explicit power_profile(const ms_type interval = default_interval()) noexcept
+      : m_interval{interval.count()}
+  {
+    assert(m_interval > 0);
+
+    m_settings[index_of(power_mode::performance)] = {0, 0, resample_quality::balanced};
+    m_settings[index_of(power_mode::balanced)] = {30, 1, resample_quality::fast};
+    m_settings[index_of(power_mode::power_saving)] = {20, 2, resample_quality::fast};
+
+    sample();
+    m_current.mode = evaluate();
+    m_current.previous = m_current.mode;
+    m_current.settings = settings(m_current.mode);
+  }
+
+  power_profile(const power_profile&) = delete;
+
+  auto operator=(const power_profile&) -> power_profile& = delete;
+
+  /**
+   * \brief Samples the power state if the sample interval has elapsed.
+   *
+   * \details This is meant to be called once per frame, and only queries the system
+   * clock unless it's time for a new sample.
+   *
+   * \return `true` if a change was published; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto update() -> bool
+  {
+    const auto now = counter::ticks().count();
+    if (static_cast<i32>(now - m_lastSample) < static_cast<i32>(m_interval)) {
+      return false;
+    }
+
+    return refresh();
+  }
+
+  /**
+   * \brief Samples the power state immediately, regardless of the sample interval.
+   *
+   * \details This is useful in response to events that suggest that the power source has
+   * changed, e.g. when the application is resumed.
+   *
+   * \return `true` if a change was published; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto refresh() -> bool
+  {
+    const auto previousState = m_current.state;
+    sample();
+
+    return apply(m_current.state != previousState);
+  }
+
+  /**
+   * \brief Forces a power mode, regardless of the power state.
+   *
+   * \details This is useful to let users pick a mode in the settings of an application.
+   *
+   * \param mode the forced power mode; `std::nullopt` to select the mode automatically.
+   *
+   * \since 6.4.0
+   */
+  void set_override(const std::optional<power_mode> mode)
+  {
+    m_override = mode;
+    apply(false);
+  }
+
+  /**
+   * \brief Sets the battery percentage at which the power saving mode is selected.
+   *
+   * \details The default threshold is 20 percent.
+   *
+   * \param percentage the low battery threshold, in the range [0, 100].
+   *
+   * \since 6.4.0
+   */
+  void set_low_battery_threshold(const int percentage)
+  {
+    assert(percentage >= 0 && percentage <= 100);
+    m_lowBattery = percentage;
+    apply(false);
+  }
+
+  /**
+   * \brief Sets the settings associated with a power mode.
+   *
+   * \details The defaults are no frame rate limit, full textures and the balanced audio
+   * quality in the performance mode; 30 FPS, half resolution textures and the fast audio
+   * quality in the balanced mode; and 20 FPS, quarter resolution textures and the fast
+   * audio quality in the power saving mode.
+   *
+   * \details A change is published if the settings of the current mode are modified.
+   *
+   * \param mode the power mode that will be configured.
+   * \param settings the settings of the power mode.
+   *
+   * \since 6.4.0
+   */
+  void set_settings(const power_mode mode, const power_settings& settings)
+  {
+    m_settings[index_of(mode)] = settings;
+    apply(mode == m_current.mode);
+  }
+
+  /**
+   * \brief Sets the minimum time between samples.
+   *
+   * \details The default interval is 5 seconds.
+   *
+   * \param interval the sample interval, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  void set_interval(const ms_type interval) noexcept
+  {
+    assert(interval.count() > 0);
+    m_interval = interval.count();
+  }
+
+  /**
+   * \brief Returns the listeners that are notified when the power mode or state changes.
+   *
+   * \return the change listeners.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto listeners() noexcept -> listeners_type&
+  {
+    return m_listeners;
+  }
+
+  /**
+   * \brief Returns the most recently sampled state, in the form of a change.
+   *
+   * \details The previous mode of the returned change is the current mode.
+   *
+   * \return the current power mode, settings and sampled state.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto current() const noexcept -> power_change
+  {
+    auto change = m_current;
+    change.previous = change.mode;
+    return change;
+  }
+
+  /**
+   * \brief Returns the current power mode.
+   *
+   * \return the power mode.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto mode() const noexcept -> power_mode
+  {
+    return m_current.mode;
+  }
+
+  /**
+   * \brief Returns the settings associated with a power mode.
+   *
+   * \param mode the power mode.
+   *
+   * \return the settings of the power mode.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto settings(const power_mode mode) const noexcept -> const power_settings&
+  {
+    return m_settings[index_of(mode)];
+  }
+
+  /**
+   * \brief Returns the cached power state.
+   *
+   * \return the most recently sampled power state.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto state() const noexcept -> power_state
+  {
+    return m_current.state;
+  }
+
+  /**
+   * \brief Returns the cached battery percentage.
+   *
+   * \return the most recently sampled battery percentage; `std::nullopt` if it's unknown.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto percentage() const noexcept -> std::optional<int>
+  {
+    return m_current.percentage;
+  }
+
+  /**
+   * \brief Returns the cached remaining battery life.
+   *
+   * \return the most recently sampled battery life; `std::nullopt` if it's unknown.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto seconds_left() const noexcept -> std::optional<seconds<int>>
+  {
+    return m_current.seconds_left;
+  }
+
+  /**
+   * \brief Returns the forced power mode, if there is one.
+   *
+   * \return the forced power mode; `std::nullopt` if the mode is selected automatically.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_override() const noexcept -> std::optional<power_mode>
+  {
+    return m_override;
+  }
+
+  /**
+   * \brief Returns the battery percentage at which the power saving mode is selected.
+   *
+   * \return the low battery threshold.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto low_battery_threshold() const noexcept -> int
+  {
+    return m_lowBattery;
+  }
+
+  /**
+   * \brief Returns the minimum time between samples.
+   *
+   * \return the sample interval.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto interval() const noexcept -> ms_type
+  {
+    return ms_type{m_interval};
+  }
+
+  /**
+   * \brief Returns the amount of times that the power state has been sampled.
+   *
+   * \return the number of samples.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto sample_count() const noexcept -> u64
+  {
+    return m_samples;
+  }
+
+  /**
+   * \brief Returns the power mode that is selected automatically for a power state.
+   *
+   * \param state the power state.
+   * \param percentage the battery percentage, if it's known.
+   * \param lowBattery the battery percentage at which the power saving mode is selected.
+   *
+   * \return the power mode for the state.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto mode_for(const power_state state,
+                                               const std::optional<int> percentage,
+                                               const int lowBattery) noexcept -> power_mode
+  {
+    if (state != power_state::on_battery) {
+      return power_mode::performance;
+    }
+    else if (percentage && *percentage <= lowBattery) {
+      return power_mode::power_saving;
+    }
+    else {
+      return power_mode::balanced;
+    }
+  }
+
+  /**
+   * \brief Returns the default minimum time between samples.
+   *
+   * \return the default sample interval.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_interval() noexcept -> ms_type
+  {
+    return ms_type{5'000};
+  }
+
+ private:
+  std::array<power_settings, 3> m_settings;
+  power_change m_current;
+  listeners_type m_listeners;
+  std::optional<power_mode> m_override;
+  u64 m_samples{};
+  u32 m_interval{};
+  u32 m_lastSample{};
+  int m_lowBattery{20};
+
+  [[nodiscard]] constexpr static auto index_of(const power_mode mode) noexcept -> usize
+  {
+    return static_cast<usize>(mode);
+  }
+
+  // A single call obtains the state, the percentage and the remaining battery life
+  void sample() noexcept
+  {
+    int secondsLeft{-1};
+    int percentage{-1};
+    const auto state = SDL_GetPowerInfo(&secondsLeft, &percentage);
+
+    m_current.state = static_cast<power_state>(state);
+    m_current.percentage = (percentage != -1) ? std::optional{percentage} : std::nullopt;
+    m_current.seconds_left = (secondsLeft != -1) ? std::optional{seconds<int>{secondsLeft}}
+                                                 : std::nullopt;
+
+    m_lastSample = counter::ticks().count();
+    ++m_samples;
+  }
+
+  [[nodiscard]] auto evaluate() const noexcept -> power_mode
+  {
+    return m_override.value_or(mode_for(m_current.state, m_current.percentage, m_lowBattery));
+  }
+
+  // Selects the mode and publishes a change if the mode changed, or if forced to
+  auto apply(const bool force) -> bool
+  {
+    const auto mode = evaluate();
+    if (mode == m_current.mode && !force) {
+      return false;
+    }
+
+    m_current.previous = m_current.mode;
+    m_current.mode = mode;
+    m_current.settings = settings(mode);
+
+    m_listeners.publish(m_current);
+    return true;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_POWER_PROFILE_HEADER
@@ -0,0 +1,597 @@
+#ifndef CENTURION_PROFILER_HEADER
+#define CENTURION_PROFILER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>      // min, max, sort
+#include <atomic>         // atomic, memory_order
+#include <memory>         // unique_ptr, make_unique
+#include <optional>       // optional, nullopt
+#include <ostream>        // ostream
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../detail/json_string.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread_registry.hpp"
+#include "counter.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct profile_event
+ *
+ * \brief Represents a single execution of a profiled zone.
+ *
+ * \since 6.4.0
+ */
+struct profile_event final
+{
+  const char* name{};  ///< The name of the zone, a string literal.
+  u64 start{};         ///< The value of `counter::now()` when the zone was entered.
+  u64 end{};           ///< The value of `counter::now()` when the zone was left.
+  u32 depth{};         ///< The amount of enclosing zones on the same thread.
+};
+
+/**
+ * \struct profile_zone_stats
+ *
+ * \brief Provides the timings of a profiled zone, aggregated per frame.
+ *
+ * \details The minimum, average and maximum are computed from the total time spent in the
+ * zone in each frame in which the zone was entered at least once.
+ *
+ * \see `profiler::zones()`
+ *
+ * \since 6.4.0
+ */
+struct profile_zone_stats final
+{
+  std::string_view name;       ///< The name of the zone.
+  u64 calls{};                 ///< The amount of times the zone was entered last frame.
+  nanoseconds<u64> last{};     ///< The total time spent in the zone last frame.
+  nanoseconds<u64> min{};      ///< The least time spent in the zone in a frame.
+  nanoseconds<u64> average{};  ///< The average time spent in the zone per frame.
+  nanoseconds<u64> max{};      ///< The most time spent in the zone in a frame.
+  u64 frames{};                ///< The amount of frames in which the zone was entered.
+};
+
+/// \cond FALSE
+namespace detail {
+
+/* Each thread writes its events to its own ring buffer, which is emptied by
+   `profiler::end_frame()`. Buffers are never freed, but the buffer of a thread that has
+   exited is reused by the next thread that enters a zone. */
+
+struct profiler_buffer final
+{
+  inline constexpr static u64 capacity = 4'096;  // Must be a power of two
+
+  std::unique_ptr<profile_event[]> events{std::make_unique<profile_event[]>(capacity)};
+  std::atomic<u64> head{};  ///< Only written by the owning thread.
+  std::atomic<u64> tail{};  ///< Only written by the profiler.
+  std::atomic<u64> lost{};
+  std::atomic<bool> abandoned{};
+  SDL_threadID thread{};
+  u32 depth{};  ///< Only used by the owning thread.
+
+  void push(const profile_event& event) noexcept
+  {
+    const auto index = head.load(std::memory_order_relaxed);
+
+    if (index - tail.load(std::memory_order_acquire) == capacity) {
+      lost.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    events[index & (capacity - 1)] = event;
+    head.store(index + 1, std::memory_order_release);
+  }
+};
+
+struct profiler_zone_data final
+{
+  u64 calls{};
+  u64 frameTicks{};
+  u64 totalTicks{};
+  u64 minTicks{};
+  u64 maxTicks{};
+  u64 frames{};
+};
+
+struct profiler_data final
+{
+  mutex lock;
+  std::vector<std::unique_ptr<profiler_buffer>> buffers;
+  std::unordered_map<std::string_view, profiler_zone_data> zones;
+  std::vector<profile_event> captured;
+  std::vector<SDL_threadID> capturedThreads;
+  usize captureLimit{};
+  u64 captureStart{};
+  bool capturing{};
+  u64 frameStart{};
+  u64 frameTicks{};
+  u64 frames{};
+  u64 lost{};
+};
+
+// Never destroyed, since threads may leave zones during shutdown
+[[nodiscard]] inline auto get_profiler_data() -> profiler_data&
+{
+  static auto* data = new profiler_data{};
+  return *data;
+}
+
+struct profiler_buffer_owner final
+{
+  profiler_buffer* buffer{};
+
+  ~profiler_buffer_owner() noexcept
+  {
+    if (buffer) {
+      buffer->abandoned.store(true, std::memory_order_release);
+    }
+  }
+};
+
+inline thread_local profiler_buffer_owner tls_profiler_buffer;
+
+[[nodiscard]] inline auto acquire_profiler_buffer() noexcept -> profiler_buffer*
+{
+  if (auto* buffer = tls_profiler_buffer.buffer) {
+    return buffer;
+  }
+
+  try {
+    auto& data = get_profiler_data();
+    scoped_lock lock{data.lock};
+
+    profiler_buffer* buffer = nullptr;
+    for (auto& candidate : data.buffers) {
+      if (candidate->abandoned.load(std::memory_order_acquire) &&
+          candidate->head.load(std::memory_order_relaxed) ==
+              candidate->tail.load(std::memory_order_relaxed)) {
+        buffer = candidate.get();
+        buffer->abandoned.store(false, std::memory_order_relaxed);
+        break;
+      }
+    }
+
+    if (!buffer) {
+      buffer = data.buffers.emplace_back(std::make_unique<profiler_buffer>()).get();
+    }
+
+    buffer->thread = SDL_ThreadID();
+    buffer->depth = 0;
+
+    tls_profiler_buffer.buffer = buffer;
+    return buffer;
+  }
+  catch (...) {
+    return nullptr;  // The zones of this thread are ignored
+  }
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class profile_zone
+ *
+ * \brief Measures the time spent in a scope, for use with `profiler`.
+ *
+ * \details Zones are usually created with the `CENTURION_PROFILE_ZONE` macro from
+ * `profiler_macros.hpp`, which expands to nothing unless `CENTURION_ENABLE_PROFILER` is
+ * defined. Entering and leaving
+ * a zone only reads the high-performance counter and writes to a buffer that belongs to
+ * the calling thread, without any locking.
+ * \code{cpp}
+ *   void update_physics()
+ *   {
+ *     CENTURION_PROFILE_ZONE("update_physics");
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note The name of a zone must be a string literal, or otherwise outlive the profiler.
+ *
+ * \see `profiler`
+ *
+ * \since 6.4.0
+ */
+class profile_zone final
+{
+ public:
+  /**
+   * \brief Enters a zone.
+   *
+   * \param name the name of the zone, which must refer to a string with static storage
+   * duration.
+   *
+   * \since 6.4.0
+   */
+  explicit profile_zone(const char* name) noexcept
+      : m_name{name}
+      , m_buffer{detail::acquire_profiler_buffer()}
+  {
+    if (m_buffer) {
+      ++m_buffer->depth;
+    }
+
+    m_start = counter::now();
+  }
+
+  profile_zone(const profile_zone&) = delete;
+
+  auto operator=(const profile_zone&) -> profile_zone& = delete;
+
+  /**
+   * \brief Leaves the zone, and records the time that was spent in it.
+   *
+   * \since 6.4.0
+   */
+  ~profile_zone() noexcept
+  {
+    const auto end = counter::now();
+
+    if (m_buffer) {
+      --m_buffer->depth;
+      m_buffer->push(profile_event{m_name, m_start, end, m_buffer->depth});
+    }
+  }
+
+ private:
+  const char* m_name{};
+  detail::profiler_buffer* m_buffer{};
+  u64 m_start{};
+};
+
+/**
+ * \class profiler
+ *
+ * \brief Aggregates the timings of profiled zones per frame.
+ *
+ * \details Call `end_frame()` once per frame, e.g. right after presenting the renderer. It
+ * collects the zones that were left on every thread since the previous frame, and updates
+ * the per-frame statistics of each zone, which are available through `zones()`.
+ * \code{cpp}
+ *   while (running) {
+ *     // ...
+ *     renderer.present();
+ *     cen::profiler::end_frame();
+ *   }
+ *
+ *   for (const auto& zone : cen::profiler::zones()) {
+ *     std::cout << zone.name << ": " << zone.average.count() << " ns\n";
+ *   }
+ * \endcode
+ *
+ * \details When `CENTURION_ENABLE_PROFILER` is defined, the library profiles its own hot
+ * paths as well, such as presenting and rendering, polling events, rasterizing glyphs in
+ * font caches and reading files. The zones can also be captured and exported in the Chrome
+ * trace event format, which can be opened with `chrome://tracing` or Perfetto.
+ * \code{cpp}
+ *   cen::profiler::start_capture();
+ *   // Run a few frames...
+ *   cen::profiler::stop_capture();
+ *
+ *   std::ofstream stream{"trace.json"};
+ *   cen::profiler::write_chrome_trace(stream);
+ * \endcode
+ *
+ * \note The macro must be defined consistently for all source files, e.g. by the build
+ * system, since it affects the definitions of inline library functions.
+ *
+ * \note Each thread buffers up to 4096 zones between frames, additional zones are lost.
+ *
+ * \see `profile_zone`
+ * \see `CENTURION_PROFILE_ZONE`
+ *
+ * \since 6.4.0
+ */
+class profiler final
+{
+ public:
+  using size_type = usize;
+
+  profiler() = delete;
+
+  /**
+   * \brief Collects the zones that have been left since the previous frame.
+   *
+   * \since 6.4.0
+   */
+  static void end_frame()
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+
+    for (auto& [name, zone] : data.zones) {
+      zone.calls = 0;
+      zone.frameTicks = 0;
+    }
+
+    for (const auto& buffer : data.buffers) {
+      const auto head = buffer->head.load(std::memory_order_acquire);
+      auto tail = buffer->tail.load(std::memory_order_relaxed);
+
+      for (; tail != head; ++tail) {
+        const auto& event = buffer->events[tail & (detail::profiler_buffer::capacity - 1)];
+        auto& zone = data.zones[event.name];
+
+        ++zone.calls;
+        zone.frameTicks += event.end - event.start;
+
+        if (data.capturing && data.captured.size() < data.captureLimit) {
+          data.captured.push_back(event);
+          data.capturedThreads.push_back(buffer->thread);
+        }
+      }
+
+      buffer->tail.store(tail, std::memory_order_release);
+      data.lost += buffer->lost.exchange(0, std::memory_order_relaxed);
+    }
+
+    for (auto& [name, zone] : data.zones) {
+      if (zone.calls != 0) {
+        zone.minTicks = zone.frames != 0 ? std::min(zone.minTicks, zone.frameTicks)
+                                         : zone.frameTicks;
+        zone.maxTicks = std::max(zone.maxTicks, zone.frameTicks);
+        zone.totalTicks += zone.frameTicks;
+        ++zone.frames;
+      }
+    }
+
+    const auto now = counter::now();
+    data.frameTicks = data.frameStart != 0 ? now - data.frameStart : 0;
+    data.frameStart = now;
+    ++data.frames;
+  }
+
+  /**
+   * \brief Returns the statistics of all zones that have been entered.
+   *
+   * \return the statistics of every zone, sorted by name.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto zones() -> std::vector<profile_zone_stats>
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+
+    const auto frequency = counter::frequency();
+    const auto toNanoseconds = [frequency](const u64 ticks) {
+      return nanoseconds<u64>{ticks / frequency * 1'000'000'000 +
+                              ticks % frequency * 1'000'000'000 / frequency};
+    };
+
+    std::vector<profile_zone_stats> result;
+    result.reserve(data.zones.size());
+
+    for (const auto& [name, zone] : data.zones) {
+      auto& stats = result.emplace_back();
+      stats.name = name;
+      stats.calls = zone.calls;
+      stats.last = toNanoseconds(zone.frameTicks);
+      stats.min = toNanoseconds(zone.minTicks);
+      stats.max = toNanoseconds(zone.maxTicks);
+      stats.average = toNanoseconds(zone.frames != 0 ? zone.totalTicks / zone.frames : 0);
+      stats.frames = zone.frames;
+    }
+
+    std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+      return a.name < b.name;
+    });
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the statistics of a zone.
+   *
+   * \param name the name of the zone.
+   *
+   * \return the statistics of the zone; `std::nullopt` if it has never been entered.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto find(const std::string_view name)
+      -> std::optional<profile_zone_stats>
+  {
+    for (const auto& stats : zones()) {
+      if (stats.name == name) {
+        return stats;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+   * \brief Returns the duration of the last frame.
+   *
+   * \return the time between the two latest calls to `end_frame()`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto frame_time() -> nanoseconds<u64>
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+
+    const auto frequency = counter::frequency();
+    return nanoseconds<u64>{data.frameTicks / frequency * 1'000'000'000 +
+                            data.frameTicks % frequency * 1'000'000'000 / frequency};
+  }
+
+  /**
+   * \brief Returns the amount of frames that have ended.
+   *
+   * \return the number of calls to `end_frame()` since the last reset.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto frame_count() -> u64
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+    return data.frames;
+  }
+
+  /**
+   * \brief Returns the amount of zones that were lost because a thread buffer was full.
+   *
+   * \return the number of lost zones, as of the last frame.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto lost() -> u64
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+    return data.lost;
+  }
+
+  /**
+   * \brief Clears the statistics of all zones.
+   *
+   * \details Zones that are buffered by threads are discarded at the next frame.
+   *
+   * \since 6.4.0
+   */
+  static void reset()
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+
+    for (const auto& buffer : data.buffers) {
+      buffer->tail.store(buffer->head.load(std::memory_order_acquire),
+                         std::memory_order_release);
+    }
+
+    data.zones.clear();
+    data.frameStart = 0;
+    data.frameTicks = 0;
+    data.frames = 0;
+    data.lost = 0;
+  }
+
+  /**
+   * \brief Starts recording every zone that is collected, for `write_chrome_trace()`.
+   *
+   * \details Previously captured zones are discarded.
+   *
+   * \param limit the maximum amount of zones that will be captured.
+   *
+   * \since 6.4.0
+   */
+  static void start_capture(const size_type limit = 1'000'000)
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+
+    data.captured.clear();
+    data.capturedThreads.clear();
+    data.captureLimit = limit;
+    data.captureStart = counter::now();
+    data.capturing = true;
+  }
+
+  /**
+   * \brief Stops recording zones, keeping the zones that have been captured.
+   *
+   * \since 6.4.0
+   */
+  static void stop_capture()
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+    data.capturing = false;
+  }
+
+  /**
+   * \brief Returns the amount of captured zones.
+   *
+   * \return the number of captured zones.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto captured() -> size_type
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+    return data.captured.size();
+  }
+
+  /**
+   * \brief Writes the captured zones as JSON in the Chrome trace event format.
+   *
+   * \details Each zone becomes a complete event, with timestamps in microseconds relative
+   * to the start of the capture. Threads that are known by `thread_registry` are named.
+   *
+   * \param stream the stream that the trace will be written to.
+   *
+   * \since 6.4.0
+   */
+  static void write_chrome_trace(std::ostream& stream)
+  {
+    auto& data = detail::get_profiler_data();
+    scoped_lock lock{data.lock};
+
+    const auto frequency = static_cast<double>(counter::frequency());
+    const auto toMicroseconds = [frequency](const u64 ticks) {
+      return static_cast<double>(ticks) * 1e6 / frequency;
+    };
+
+    stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    std::vector<SDL_threadID> threads;
+    auto first = true;
+
+    for (usize index = 0; index < data.captured.size(); ++index) {
+      const auto& event = data.captured[index];
+      const auto thread = data.capturedThreads[index];
+
+      if (std::find(threads.begin(), threads.end(), thread) == threads.end()) {
+        threads.push_back(thread);
+      }
+
+      const auto start = event.start > data.captureStart ? event.start - data.captureStart : 0;
+
+      stream << (first ? "" : ",") << R"({"name":)";
+      detail::write_json_string(stream, event.name);
+      stream << R"(,"ph":"X","pid":0,"tid":)" << thread << R"(,"ts":)"
+             << toMicroseconds(start) << R"(,"dur":)"
+             << toMicroseconds(event.end - event.start) << '}';
+
+      first = false;
+    }
+
+    for (const auto thread : threads) {
+      if (const auto info = thread_registry::find(thread)) {
+        stream << (first ? "" : ",") << R"({"name":"thread_name","ph":"M","pid":0,"tid":)"
+               << thread << R"(,"args":{"name":)";
+        detail::write_json_string(stream, info->name);
+        stream << "}}";
+
+        first = false;
+      }
+    }
+
+    stream << "]}";
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_PROFILER_HEADER
@@ -0,0 +1,22 @@
+#ifndef CENTURION_PROFILER_MACROS_HEADER
+#define CENTURION_PROFILER_MACROS_HEADER
+
+#ifdef CENTURION_ENABLE_PROFILER
+
+#include "profiler.hpp"
+
+#define CENTURION_DETAIL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CENTURION_DETAIL_PROFILE_CONCAT(a, b) CENTURION_DETAIL_PROFILE_CONCAT_IMPL(a, b)
+
+// clang-format off
+#define CENTURION_PROFILE_ZONE(name) \
+  const cen::profile_zone CENTURION_DETAIL_PROFILE_CONCAT(centurionProfileZone, __LINE__){name}
+// clang-format on
+
+#else
+
+#define CENTURION_PROFILE_ZONE(name)
+
+#endif  // CENTURION_ENABLE_PROFILER
+
+#endif  // CENTURION_PROFILER_MACROS_HEADER
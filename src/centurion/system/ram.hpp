@@ -3,6 +3,9 @@
 
 #include <SDL2/SDL.h>
 
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+
 /**
  * \namespace cen::ram
  *
@@ -44,10 +47,31 @@ namespace cen::ram {
   return amount_mb() / 1'000;
 }
 
+/**
+ * \brief Returns the amount of physical memory that is used by the current process.
+ *
+ * \details This is the resident set size on Unix platforms, and the working set size on
+ * Windows. The value is obtained from the operating system, so it includes the memory used
+ * by SDL2, the graphics and audio drivers, and the shared libraries loaded by the process.
+ * It's mainly intended to compare configurations, e.g. `library::timing_report()` lists the
+ * memory used by each initialized subsystem.
+ *
+ * \return the resident memory of the process, in bytes; zero if it's not available on the
+ * current platform.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto process_resident_bytes() noexcept
+    -> usize;
+
 /// \} End of RAM functions
 
 /// \} End of group system
 
 }  // namespace cen::ram
 
+#if CENTURION_LIB_DEFINITIONS
+#include "../detail/ram_impl.hpp"
+#endif  // CENTURION_LIB_DEFINITIONS
+
 #endif  // CENTURION_RAM_HEADER
\ No newline at end of file
@@ -0,0 +1,243 @@
+#ifndef CENTURION_SHARED_MEMORY_HEADER
+#define CENTURION_SHARED_MEMORY_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <cstdint>  // intptr_t
+#include <string>   // string
+#include <utility>  // exchange, move
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+struct shared_mapping final
+{
+  u8* data{};
+  usize size{};
+  std::intptr_t handle{};  ///< The file mapping handle on Windows, unused otherwise.
+};
+
+// Defined in detail/shared_memory_impl.hpp, which includes the platform headers
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto create_shared_mapping(
+    const std::string& name,
+    usize size) noexcept -> shared_mapping;
+
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto open_shared_mapping(
+    const std::string& name) noexcept -> shared_mapping;
+
+// Unmaps the memory, and removes the name of the block if it's owned by the caller
+CENTURION_API CENTURION_LIB_INLINE void close_shared_mapping(const std::string& name,
+                                                             const shared_mapping& mapping,
+                                                             bool owner) noexcept;
+
+}  // namespace cen::detail
+
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class shared_memory
+ *
+ * \brief Represents a named block of memory that is shared between processes.
+ *
+ * \details One process creates the block with `create()`, after which other processes
+ * can map the same memory with `open()`, using the same name. Reads and writes are plain
+ * memory accesses, so no data is copied between the processes. POSIX shared memory
+ * objects are used on Unix platforms, and named file mappings are used on Windows.
+ * \code{cpp}
+ *   // In the producer process
+ *   auto memory = cen::shared_memory::create("/game-frames", size);
+ *
+ *   // In the consumer process
+ *   auto memory = cen::shared_memory::open("/game-frames");
+ * \endcode
+ *
+ * \details The block is removed when the creating instance is destroyed, but processes
+ * that have already opened it can keep using it until they close it.
+ *
+ * \note Like `mapped_file`, this class doesn't throw if the memory can't be created or
+ * mapped, instead the instance is null. Synchronizing access to the memory is up to the
+ * processes, typically with lock-free atomics stored in the block.
+ *
+ * \see `mapped_file`
+ *
+ * \since 6.4.0
+ */
+class shared_memory final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Creates a named block of shared memory.
+   *
+   * \details The memory is zero-initialized. Blocks that were left behind by a process
+   * that didn't exit cleanly are replaced.
+   *
+   * \param name the name of the block, a slash is prepended on Unix platforms if the name
+   * doesn't start with one.
+   * \param size the size of the block, in bytes, must be greater than zero.
+   *
+   * \return the created block; a null block if it couldn't be created.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto create(std::string name, const size_type size) noexcept
+      -> shared_memory
+  {
+    assert(size > 0);
+
+    shared_memory memory{normalize(std::move(name))};
+    memory.m_mapping = detail::create_shared_mapping(memory.m_name, size);
+    memory.m_owner = memory.m_mapping.data != nullptr;
+    return memory;
+  }
+
+  /**
+   * \brief Opens a named block of shared memory that was created by another instance.
+   *
+   * \param name the name of the block.
+   *
+   * \return the opened block; a null block if it doesn't exist or couldn't be mapped.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto open(std::string name) noexcept -> shared_memory
+  {
+    shared_memory memory{normalize(std::move(name))};
+    memory.m_mapping = detail::open_shared_mapping(memory.m_name);
+    return memory;
+  }
+
+  shared_memory(const shared_memory&) = delete;
+  auto operator=(const shared_memory&) -> shared_memory& = delete;
+
+  shared_memory(shared_memory&& other) noexcept
+      : m_name{std::move(other.m_name)}
+      , m_mapping{std::exchange(other.m_mapping, {})}
+      , m_owner{std::exchange(other.m_owner, false)}
+  {}
+
+  auto operator=(shared_memory&& other) noexcept -> shared_memory&
+  {
+    if (this != &other) {
+      unmap();
+      m_name = std::move(other.m_name);
+      m_mapping = std::exchange(other.m_mapping, {});
+      m_owner = std::exchange(other.m_owner, false);
+    }
+
+    return *this;
+  }
+
+  ~shared_memory() noexcept
+  {
+    unmap();
+  }
+
+  /**
+   * \brief Returns a pointer to the shared memory.
+   *
+   * \return a pointer to the first byte of the block; null if the block isn't mapped.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto data() const noexcept -> u8*
+  {
+    return m_mapping.data;
+  }
+
+  /**
+   * \brief Returns the size of the shared memory.
+   *
+   * \return the size of the block, in bytes; zero if the block isn't mapped.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_mapping.size;
+  }
+
+  /**
+   * \brief Returns the name of the shared memory.
+   *
+   * \return the name of the block, as used by the operating system.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto name() const noexcept -> const std::string&
+  {
+    return m_name;
+  }
+
+  /**
+   * \brief Indicates whether or not this instance created the shared memory.
+   *
+   * \return `true` if the block is removed when this instance is destroyed; `false`
+   * otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_owner() const noexcept -> bool
+  {
+    return m_owner;
+  }
+
+  /**
+   * \brief Indicates whether or not the shared memory is mapped.
+   *
+   * \return `true` if the block is mapped; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return m_mapping.data != nullptr;
+  }
+
+ private:
+  std::string m_name;
+  detail::shared_mapping m_mapping;
+  bool m_owner{};
+
+  explicit shared_memory(std::string name) noexcept : m_name{std::move(name)}
+  {}
+
+  [[nodiscard]] static auto normalize(std::string name) noexcept -> std::string
+  {
+#ifndef _WIN32
+    if (name.empty() || name.front() != '/') {
+      name.insert(name.begin(), '/');
+    }
+#endif  // _WIN32
+
+    return name;
+  }
+
+  void unmap() noexcept
+  {
+    detail::close_shared_mapping(m_name, m_mapping, m_owner);
+    m_mapping = {};
+    m_owner = false;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#if CENTURION_LIB_DEFINITIONS
+#include "../detail/shared_memory_impl.hpp"
+#endif  // CENTURION_LIB_DEFINITIONS
+
+#endif  // CENTURION_SHARED_MEMORY_HEADER
@@ -0,0 +1,342 @@
+#ifndef CENTURION_SIMD_ARENA_HEADER
+#define CENTURION_SIMD_ARENA_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // max
+#include <cassert>      // assert
+#include <cstddef>      // byte, max_align_t
+#include <cstdint>      // uintptr_t
+#include <functional>   // less, less_equal
+#include <type_traits>  // is_trivially_destructible_v
+
+#include "../compiler/features.hpp"
+#include "../core/integers.hpp"
+#include "cpu.hpp"
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+#include <memory_resource>  // memory_resource, new_delete_resource
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class simd_arena
+ *
+ * \brief A linear allocator that hands out SIMD-aligned memory from a `simd_block`.
+ *
+ * \details Allocating only bumps an offset, and all allocations are released at once with
+ * `reset()`, which makes arenas a good fit for per-frame scratch memory, e.g. vertices for
+ * batched rendering, converted pixels, or mixing buffers. If an allocation doesn't fit, it
+ * fails by returning null, and the arena grows to the peak demand of the frame the next
+ * time it is reset. The arena therefore stops allocating memory once the demand is stable.
+ * \code{cpp}
+ *   cen::simd_arena arena{1'048'576};
+ *
+ *   while (running) {
+ *     arena.reset();
+ *
+ *     auto* samples = arena.allocate_array<float>(frames * channels);
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note Objects stored in the arena are never destroyed, so only trivially destructible
+ * types can be allocated with `allocate_array()`.
+ *
+ * \see `simd_arena_resource`
+ *
+ * \since 6.4.0
+ */
+class simd_arena final
+{
+ public:
+  using marker = usize;
+
+  /**
+   * \brief Creates an arena.
+   *
+   * \note The allocation of the underlying memory might fail, in which case the capacity
+   * is zero.
+   *
+   * \param capacity the initial capacity of the arena, in bytes.
+   *
+   * \since 6.4.0
+   */
+  explicit simd_arena(const usize capacity) noexcept
+      : m_block{capacity}
+      , m_capacity{m_block ? capacity : 0}
+      , m_alignment{std::max(cpu::simd_alignment(), alignof(std::max_align_t))}
+  {}
+
+  /**
+   * \brief Allocates memory from the arena.
+   *
+   * \param size the size of the allocation, in bytes.
+   * \param alignment the alignment of the allocation, which must be a power of two. The
+   * alignment is never lower than the SIMD alignment of the CPU.
+   *
+   * \return a pointer to the allocated memory; a null pointer if the arena is full.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto allocate(const usize size, const usize alignment = 0) noexcept
+      -> void*
+  {
+    const auto align = std::max(alignment, m_alignment);
+    assert((align & (align - 1)) == 0 && "The alignment must be a power of two!");
+
+    // Align the address rather than the offset, since the block itself is only guaranteed
+    // to be aligned to the SIMD alignment
+    auto* base = static_cast<std::byte*>(m_block.data());
+    const auto address = reinterpret_cast<std::uintptr_t>(base) + m_used;
+    const auto offset = m_used + (((address + align - 1) & ~(align - 1)) - address);
+
+    if (base && offset <= m_capacity && size <= m_capacity - offset) {
+      m_used = offset + size;
+      m_peak = std::max(m_peak, m_used);
+      return base + offset;
+    }
+    else {
+      // Remember how much memory would have been needed, to grow on the next reset
+      ++m_failures;
+      m_peak = std::max(m_peak, offset + size);
+      return nullptr;
+    }
+  }
+
+  /**
+   * \brief Allocates an uninitialized array from the arena.
+   *
+   * \tparam T the type of the elements, which must be trivially destructible.
+   *
+   * \param count the amount of elements.
+   *
+   * \return a pointer to the first element; a null pointer if the arena is full.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  [[nodiscard]] auto allocate_array(const usize count) noexcept -> T*
+  {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "Arenas never destroy the objects they store!");
+    return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+  }
+
+  /**
+   * \brief Returns a marker that can be used to release later allocations.
+   *
+   * \return the current offset of the arena.
+   *
+   * \see `rewind()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto mark() const noexcept -> marker
+  {
+    return m_used;
+  }
+
+  /**
+   * \brief Releases all allocations that were made after a marker was obtained.
+   *
+   * \param position a marker obtained with `mark()` since the last reset.
+   *
+   * \since 6.4.0
+   */
+  void rewind(const marker position) noexcept
+  {
+    assert(position <= m_used);
+    m_used = position;
+  }
+
+  /**
+   * \brief Releases all allocations.
+   *
+   * \details If any allocation failed since the previous reset, the underlying memory is
+   * replaced by a block that is at least large enough for the peak demand. Otherwise, this
+   * doesn't allocate or free any memory.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    if (m_peak > m_capacity) {
+      // Grow geometrically, to avoid growing every frame when the demand creeps up
+      const auto capacity = std::max(m_peak, m_capacity + m_capacity / 2);
+
+      // The old contents are released anyway, so there's no need to reallocate
+      m_block = simd_block{capacity};
+      m_capacity = m_block ? capacity : 0;
+    }
+
+    m_used = 0;
+    m_peak = 0;
+  }
+
+  /**
+   * \brief Returns the amount of bytes that are currently allocated.
+   *
+   * \return the size of the allocated memory, including padding.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto used() const noexcept -> usize
+  {
+    return m_used;
+  }
+
+  /**
+   * \brief Returns the size of the underlying memory block.
+   *
+   * \return the capacity of the arena, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> usize
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the amount of allocations that have failed.
+   *
+   * \return the amount of allocations that didn't fit in the arena.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto failures() const noexcept -> usize
+  {
+    return m_failures;
+  }
+
+  /**
+   * \brief Returns the alignment of the allocations.
+   *
+   * \return the minimum alignment of allocations, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto alignment() const noexcept -> usize
+  {
+    return m_alignment;
+  }
+
+  /**
+   * \brief Indicates whether or not a pointer was allocated from the arena.
+   *
+   * \param ptr the pointer that will be checked.
+   *
+   * \return `true` if the pointer points into the arena; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto owns(const void* ptr) const noexcept -> bool
+  {
+    const auto* base = static_cast<const std::byte*>(m_block.data());
+    const auto* bytes = static_cast<const std::byte*>(ptr);
+    return base && std::less_equal<>{}(base, bytes) && std::less<>{}(bytes, base + m_capacity);
+  }
+
+ private:
+  simd_block m_block;
+  usize m_capacity{};
+  usize m_alignment{};
+  usize m_used{};
+  usize m_peak{};
+  usize m_failures{};
+};
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+/**
+ * \class simd_arena_resource
+ *
+ * \brief A memory resource that allocates from a `simd_arena`.
+ *
+ * \details This makes it possible to use arenas with standard containers, e.g.
+ * `std::pmr::vector`. Allocations that don't fit in the arena are made by an upstream
+ * resource instead, and the arena grows to fit them on its next reset. Deallocations of
+ * arena memory have no effect, the memory is released when the arena is reset.
+ * \code{cpp}
+ *   cen::simd_arena arena{65'536};
+ *   cen::simd_arena_resource resource{arena};
+ *
+ *   std::pmr::vector<SDL_Vertex> vertices{&resource};
+ * \endcode
+ *
+ * \note Containers that use the resource must not outlive the current frame, i.e. they
+ * must be destroyed before the arena is reset.
+ *
+ * \since 6.4.0
+ */
+class simd_arena_resource final : public std::pmr::memory_resource
+{
+ public:
+  /**
+   * \brief Creates a memory resource that allocates from an arena.
+   *
+   * \param arena the arena, which must outlive the resource.
+   * \param upstream the resource used when the arena is full, which must outlive the
+   * resource.
+   *
+   * \since 6.4.0
+   */
+  explicit simd_arena_resource(
+      simd_arena& arena,
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+      : m_arena{&arena}
+      , m_upstream{upstream}
+  {}
+
+  /**
+   * \brief Returns the arena used by the resource.
+   *
+   * \return the associated arena.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto arena() const noexcept -> simd_arena&
+  {
+    return *m_arena;
+  }
+
+ private:
+  simd_arena* m_arena{};
+  std::pmr::memory_resource* m_upstream{};
+
+  auto do_allocate(const usize bytes, const usize alignment) -> void* override
+  {
+    if (auto* ptr = m_arena->allocate(bytes, alignment)) {
+      return ptr;
+    }
+    else {
+      return m_upstream->allocate(bytes, std::max(alignment, m_arena->alignment()));
+    }
+  }
+
+  void do_deallocate(void* ptr, const usize bytes, const usize alignment) override
+  {
+    if (!m_arena->owns(ptr)) {
+      m_upstream->deallocate(ptr, bytes, std::max(alignment, m_arena->alignment()));
+    }
+  }
+
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override
+  {
+    return this == &other;
+  }
+};
+
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_SIMD_ARENA_HEADER
@@ -0,0 +1,112 @@
+#ifndef CENTURION_SIMD_LEVEL_HEADER
+#define CENTURION_SIMD_LEVEL_HEADER
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "../core/exception.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \enum simd_level
+ *
+ * \brief Provides values that represent the instruction sets used by kernel variants.
+ *
+ * \details The enumerators are ordered by preference, i.e. later instruction sets are
+ * preferred over earlier ones when a kernel provides variants for several of them.
+ *
+ * \see `kernel_table`
+ * \see `simd_level_count()`
+ *
+ * \since 6.4.0
+ */
+enum class simd_level
+{
+  scalar,  ///< Portable code, which is always available.
+  sse2,    ///< SSE2 instructions, on x86 processors.
+  neon,    ///< NEON instructions, on ARM processors.
+  avx2     ///< AVX2 instructions, on x86-64 processors.
+};
+
+/**
+ * \brief Returns the number of enumerators for the `simd_level` enum.
+ *
+ * \return the number of enumerators.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto simd_level_count() noexcept -> int
+{
+  return 4;
+}
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied SIMD level.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(simd_level::avx2) == "avx2"`.
+ *
+ * \param level the SIMD level that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const simd_level level) -> std::string_view
+{
+  switch (level) {
+    case simd_level::scalar:
+      return "scalar";
+
+    case simd_level::sse2:
+      return "sse2";
+
+    case simd_level::neon:
+      return "neon";
+
+    case simd_level::avx2:
+      return "avx2";
+
+    default:
+      throw cen_error{"Did not recognize SIMD level!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a SIMD level enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param level the SIMD level that will be printed.
+ *
+ * \see `to_string(simd_level)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const simd_level level) -> std::ostream&
+{
+  return stream << to_string(level);
+}
+
+/// \} End of streaming
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_SIMD_LEVEL_HEADER
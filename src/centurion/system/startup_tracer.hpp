@@ -0,0 +1,434 @@
+#ifndef CENTURION_STARTUP_TRACER_HEADER
+#define CENTURION_STARTUP_TRACER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // sort, find
+#include <array>      // array
+#include <atomic>     // atomic, memory_order
+#include <iomanip>    // setprecision
+#include <optional>   // optional, nullopt
+#include <ostream>    // ostream, fixed
+#include <sstream>    // stringstream
+#include <string>     // string
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../detail/json_string.hpp"
+#include "counter.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct startup_event
+ *
+ * \brief Represents a traced startup phase, such as the creation of a window.
+ *
+ * \see `startup_tracer`
+ *
+ * \since 6.4.0
+ */
+struct startup_event final
+{
+  const char* name{};     ///< The name of the phase, a string literal.
+  u64 start{};            ///< The value of `counter::now()` when the phase started.
+  u64 end{};              ///< The value of `counter::now()` when the phase ended.
+  SDL_threadID thread{};  ///< The thread that the phase was executed by.
+};
+
+/// \cond FALSE
+namespace detail {
+
+struct startup_trace_data final
+{
+  inline constexpr static usize capacity = 256;
+
+  std::array<startup_event, capacity> events{};
+  std::array<std::atomic<bool>, capacity> written{};
+  std::atomic<usize> count{};
+  std::atomic<u64> origin{};
+  std::atomic<u64> firstPresent{};
+  std::atomic<bool> active{};
+};
+
+[[nodiscard]] inline auto get_startup_trace_data() noexcept -> startup_trace_data&
+{
+  static startup_trace_data data;
+  return data;
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class startup_tracer
+ *
+ * \brief Records the duration of the startup phases that are controlled by the library.
+ *
+ * \details The tracer is opt-in, and records nothing until `start()` is called, which
+ * should be done at the very beginning of `main()`. The construction of the `library`
+ * (along with each of its subsystems), windows, renderers and fonts is then recorded,
+ * until the first call to `renderer::present()`, which ends the trace. Applications can
+ * trace their own phases, such as loading assets, with `startup_scope`.
+ * \code{cpp}
+ *   int main(int argc, char** argv)
+ *   {
+ *     cen::startup_tracer::start();
+ *
+ *     cen::library centurion;
+ *     cen::window window;
+ *     cen::renderer renderer{window};
+ *     // ...
+ *     renderer.present();
+ *
+ *     std::cout << cen::startup_tracer::summary() << '\n';
+ *
+ *     std::ofstream stream{"startup.json"};
+ *     cen::startup_tracer::write_chrome_trace(stream);
+ *   }
+ * \endcode
+ *
+ * \details When the tracer isn't active, each traced phase merely checks an atomic flag.
+ *
+ * \note Phases may be recorded by any thread, but `start()` and `reset()` must not be
+ * called while phases are being recorded. At most 256 phases are recorded.
+ *
+ * \see `startup_scope`
+ * \see `profiler`
+ *
+ * \since 6.4.0
+ */
+class startup_tracer final
+{
+ public:
+  using size_type = usize;
+
+  startup_tracer() = delete;
+
+  /**
+   * \brief Starts a new trace, discarding any previously recorded phases.
+   *
+   * \details The time of this call is used as the origin of the trace.
+   *
+   * \since 6.4.0
+   */
+  static void start() noexcept
+  {
+    reset();
+
+    auto& data = detail::get_startup_trace_data();
+    data.origin.store(counter::now(), std::memory_order_relaxed);
+    data.active.store(true, std::memory_order_release);
+  }
+
+  /**
+   * \brief Stops recording phases, keeping the phases that have been recorded.
+   *
+   * \details This is called automatically by the first `present()` of a renderer, but may
+   * be called earlier, e.g. if a splash screen is presented before startup has finished.
+   *
+   * \since 6.4.0
+   */
+  static void stop() noexcept
+  {
+    detail::get_startup_trace_data().active.store(false, std::memory_order_release);
+  }
+
+  /**
+   * \brief Stops recording and discards all recorded phases.
+   *
+   * \since 6.4.0
+   */
+  static void reset() noexcept
+  {
+    auto& data = detail::get_startup_trace_data();
+    data.active.store(false, std::memory_order_relaxed);
+
+    for (auto& written : data.written) {
+      written.store(false, std::memory_order_relaxed);
+    }
+
+    data.count.store(0, std::memory_order_relaxed);
+    data.origin.store(0, std::memory_order_relaxed);
+    data.firstPresent.store(0, std::memory_order_release);
+  }
+
+  /**
+   * \brief Indicates whether or not phases are currently being recorded.
+   *
+   * \return `true` if the tracer has been started, but not stopped; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto active() noexcept -> bool
+  {
+    return detail::get_startup_trace_data().active.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Records a phase, if the tracer is active.
+   *
+   * \param name the name of the phase, which must refer to a string with static storage
+   * duration.
+   * \param start the value of `counter::now()` when the phase started.
+   * \param end the value of `counter::now()` when the phase ended.
+   *
+   * \since 6.4.0
+   */
+  static void record(const char* name, const u64 start, const u64 end) noexcept
+  {
+    auto& data = detail::get_startup_trace_data();
+    if (!data.active.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    const auto index = data.count.fetch_add(1, std::memory_order_relaxed);
+    if (index < detail::startup_trace_data::capacity) {
+      data.events[index] = startup_event{name, start, end, SDL_ThreadID()};
+      data.written[index].store(true, std::memory_order_release);
+    }
+  }
+
+  /**
+   * \brief Records the first present of a renderer and ends the trace.
+   *
+   * \details This is called by `renderer::present()`, and does nothing if the tracer isn't
+   * active.
+   *
+   * \param start the value of `counter::now()` before presenting.
+   * \param end the value of `counter::now()` after presenting.
+   *
+   * \since 6.4.0
+   */
+  static void record_present(const u64 start, const u64 end) noexcept
+  {
+    auto& data = detail::get_startup_trace_data();
+    if (data.active.load(std::memory_order_relaxed)) {
+      record("present", start, end);
+
+      data.firstPresent.store(end, std::memory_order_release);
+      stop();
+    }
+  }
+
+  /**
+   * \brief Returns the recorded phases.
+   *
+   * \return the recorded phases, sorted by their start time.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto events() -> std::vector<startup_event>
+  {
+    const auto& data = detail::get_startup_trace_data();
+
+    const auto count = std::min(data.count.load(std::memory_order_acquire),
+                                detail::startup_trace_data::capacity);
+
+    std::vector<startup_event> result;
+    result.reserve(count);
+
+    for (usize index = 0; index < count; ++index) {
+      if (data.written[index].load(std::memory_order_acquire)) {
+        result.push_back(data.events[index]);
+      }
+    }
+
+    std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+      return a.start < b.start;
+    });
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the amount of phases that weren't recorded because the tracer was full.
+   *
+   * \return the number of lost phases.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto lost() noexcept -> size_type
+  {
+    const auto count = detail::get_startup_trace_data().count.load(std::memory_order_relaxed);
+    const auto capacity = detail::startup_trace_data::capacity;
+    return count > capacity ? count - capacity : 0;
+  }
+
+  /**
+   * \brief Returns the time between the start of the trace and the end of the first
+   * present.
+   *
+   * \return the time to the first present; `std::nullopt` if nothing has been presented.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto time_to_first_present() noexcept
+      -> std::optional<nanoseconds<u64>>
+  {
+    const auto& data = detail::get_startup_trace_data();
+
+    const auto present = data.firstPresent.load(std::memory_order_acquire);
+    if (present == 0) {
+      return std::nullopt;
+    }
+
+    return to_nanoseconds(present - trace_origin());
+  }
+
+  /**
+   * \brief Returns a summary of the recorded phases.
+   *
+   * \details The summary features one line per phase, with the offset of the phase from
+   * the start of the trace and its duration, e.g. `"  12.40 ms  +  31.02 ms  window"`,
+   * followed by the time to the first present, if there was one.
+   *
+   * \return a textual summary of the trace.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto summary() -> std::string
+  {
+    const auto origin = trace_origin();
+
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(2);
+
+    for (const auto& event : events()) {
+      const auto offset = event.start > origin ? event.start - origin : 0;
+
+      stream << std::setw(8) << to_milliseconds(offset) << " ms  +" << std::setw(8)
+             << to_milliseconds(event.end - event.start) << " ms  " << event.name << '\n';
+    }
+
+    if (const auto present = time_to_first_present()) {
+      stream << "first present: " << milliseconds<double>{*present}.count() << " ms";
+    }
+    else {
+      stream << "first present: none";
+    }
+
+    return stream.str();
+  }
+
+  /**
+   * \brief Writes the recorded phases as JSON in the Chrome trace event format.
+   *
+   * \details Each phase becomes a complete event, with timestamps in microseconds relative
+   * to the start of the trace. The trace can be opened with `chrome://tracing` or
+   * Perfetto, and can be merged with traces written by `profiler`.
+   *
+   * \param stream the stream that the trace will be written to.
+   *
+   * \since 6.4.0
+   */
+  static void write_chrome_trace(std::ostream& stream)
+  {
+    const auto origin = trace_origin();
+    const auto frequency = static_cast<double>(counter::frequency());
+
+    stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    auto first = true;
+    for (const auto& event : events()) {
+      const auto offset = event.start > origin ? event.start - origin : 0;
+
+      stream << (first ? "" : ",") << R"({"name":)";
+      detail::write_json_string(stream, event.name);
+      stream << R"(,"cat":"startup","ph":"X","pid":0,"tid":)" << event.thread << R"(,"ts":)"
+             << static_cast<double>(offset) * 1e6 / frequency << R"(,"dur":)"
+             << static_cast<double>(event.end - event.start) * 1e6 / frequency << '}';
+
+      first = false;
+    }
+
+    stream << "]}";
+  }
+
+ private:
+  [[nodiscard]] static auto trace_origin() noexcept -> u64
+  {
+    return detail::get_startup_trace_data().origin.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] static auto to_nanoseconds(const u64 ticks) noexcept -> nanoseconds<u64>
+  {
+    const auto frequency = counter::frequency();
+    if (frequency == 0) {
+      return nanoseconds<u64>::zero();
+    }
+
+    return nanoseconds<u64>{ticks / frequency * 1'000'000'000 +
+                            ticks % frequency * 1'000'000'000 / frequency};
+  }
+
+  [[nodiscard]] static auto to_milliseconds(const u64 ticks) noexcept -> double
+  {
+    return milliseconds<double>{to_nanoseconds(ticks)}.count();
+  }
+};
+
+/**
+ * \class startup_scope
+ *
+ * \brief Records the time spent in a scope as a startup phase, if the tracer is active.
+ *
+ * \details The library uses this to trace its own startup phases, but it can also be used
+ * to trace application phases.
+ * \code{cpp}
+ *   {
+ *     const cen::startup_scope trace{"load_assets"};
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \see `startup_tracer`
+ *
+ * \since 6.4.0
+ */
+class startup_scope final
+{
+ public:
+  /**
+   * \brief Starts a phase.
+   *
+   * \param name the name of the phase, which must refer to a string with static storage
+   * duration.
+   *
+   * \since 6.4.0
+   */
+  explicit startup_scope(const char* name) noexcept
+      : m_name{name}
+      , m_start{startup_tracer::active() ? counter::now() : 0}
+  {}
+
+  startup_scope(const startup_scope&) = delete;
+
+  auto operator=(const startup_scope&) -> startup_scope& = delete;
+
+  /**
+   * \brief Ends the phase, and records it if the tracer is still active.
+   *
+   * \since 6.4.0
+   */
+  ~startup_scope() noexcept
+  {
+    if (m_start != 0) {
+      startup_tracer::record(m_name, m_start, counter::now());
+    }
+  }
+
+ private:
+  const char* m_name{};
+  u64 m_start{};
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_STARTUP_TRACER_HEADER
@@ -0,0 +1,551 @@
+#ifndef CENTURION_TIMER_WHEEL_HEADER
+#define CENTURION_TIMER_WHEEL_HEADER
+
+#include <array>       // array
+#include <cassert>     // assert
+#include <functional>  // function
+#include <optional>    // optional, nullopt
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "counter.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class timer_wheel
+ *
+ * \brief Schedules large amounts of timers, whose callbacks are invoked by the thread that
+ * advances the wheel.
+ *
+ * \details Unlike `SDL_AddTimer()`, which runs callbacks on a dedicated thread, a timer
+ * wheel is advanced explicitly, e.g. once per frame in the main loop, so callbacks can
+ * safely touch game state. Timers are stored in a hierarchy of four wheels with 64 slots
+ * each, where the first wheel has a slot per tick and each subsequent wheel covers 64
+ * times the range of the previous one. Scheduling and cancelling a timer are constant
+ * time operations, and advancing only touches the slots of elapsed ticks, plus the
+ * occasional cascade of a slot into the lower wheels.
+ * \code{cpp}
+ *   cen::timer_wheel timers;
+ *
+ *   const auto cooldown = timers.schedule(1'500_ms, [&] { ability.ready = true; });
+ *   timers.schedule_every(250_ms, [&] { regenerate(player); });
+ *
+ *   while (running) {
+ *     timers.advance();  // Invokes the callbacks of expired timers
+ *     ...
+ *   }
+ * \endcode
+ *
+ * \details Delays are rounded up to whole ticks of the configured resolution, and timers
+ * never fire early. Timers that are further away than the range of the wheels, about 4.6
+ * hours with the default resolution of 1 ms, are parked in the last wheel and rescheduled
+ * when it cascades.
+ *
+ * \note Callbacks may schedule and cancel timers, including their own timer. A timer wheel
+ * isn't thread-safe, so it should only be used by a single thread.
+ *
+ * \see `counter::now()`
+ *
+ * \since 6.4.0
+ */
+class timer_wheel final
+{
+ public:
+  using duration_type = nanoseconds<u64>;
+  using callback_type = std::function<void()>;
+  using size_type = usize;
+
+  /**
+   * \enum timer_id
+   *
+   * \brief Identifies a scheduled timer, used to cancel it.
+   *
+   * \details IDs are never reused, so cancelling a timer that has already fired is safe.
+   *
+   * \since 6.4.0
+   */
+  enum class timer_id : u64
+  {
+  };
+
+  /**
+   * \brief Creates an empty timer wheel.
+   *
+   * \param resolution the duration of a tick, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  explicit timer_wheel(const duration_type resolution = default_resolution()) noexcept
+      : m_resolution{resolution.count()}
+      , m_lastCounter{counter::now()}
+  {
+    assert(m_resolution > 0);
+    m_heads.fill(npos);
+  }
+
+  timer_wheel(const timer_wheel&) = delete;
+
+  auto operator=(const timer_wheel&) -> timer_wheel& = delete;
+
+  /**
+   * \brief Schedules a callback to be invoked once, after a delay.
+   *
+   * \param delay the minimum time until the callback is invoked.
+   * \param callback the function that will be invoked.
+   *
+   * \return the ID of the timer.
+   *
+   * \since 6.4.0
+   */
+  auto schedule(const duration_type delay, callback_type callback) -> timer_id
+  {
+    return insert(to_ticks(delay), 0, std::move(callback));
+  }
+
+  /**
+   * \brief Schedules a callback to be invoked repeatedly, until the timer is cancelled.
+   *
+   * \details The first invocation happens after one interval. If the wheel is advanced by
+   * several intervals at once, the callback is invoked once for each elapsed interval.
+   *
+   * \param interval the time between invocations, which is at least one tick.
+   * \param callback the function that will be invoked.
+   *
+   * \return the ID of the timer.
+   *
+   * \since 6.4.0
+   */
+  auto schedule_every(const duration_type interval, callback_type callback) -> timer_id
+  {
+    const auto ticks = to_ticks(interval);
+    return insert(ticks, ticks, std::move(callback));
+  }
+
+  /**
+   * \brief Cancels a timer, so that its callback isn't invoked again.
+   *
+   * \param id the ID of the timer.
+   *
+   * \return `true` if the timer was cancelled; `false` if it already fired or is unknown.
+   *
+   * \since 6.4.0
+   */
+  auto cancel(const timer_id id) noexcept -> bool
+  {
+    const auto index = find(id);
+    if (!index) {
+      return false;
+    }
+
+    auto& node = m_nodes[*index];
+    if (*index == m_firing) {
+      node.active = false;  // Released once the callback returns
+      --m_count;
+    }
+    else {
+      unlink(*index);
+      release(*index);
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Indicates whether or not a timer will still fire.
+   *
+   * \param id the ID of the timer.
+   *
+   * \return `true` if the timer is scheduled; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_pending(const timer_id id) const noexcept -> bool
+  {
+    return find(id).has_value();
+  }
+
+  /**
+   * \brief Returns the time until a timer fires.
+   *
+   * \param id the ID of the timer.
+   *
+   * \return the remaining time, rounded to whole ticks; `std::nullopt` if the timer isn't
+   * scheduled.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto remaining(const timer_id id) const noexcept
+      -> std::optional<duration_type>
+  {
+    if (const auto index = find(id)) {
+      const auto& node = m_nodes[*index];
+      const auto ticks = (node.expires > m_now) ? node.expires - m_now : u64{0};
+      return duration_type{ticks * m_resolution};
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Advances the wheel by the time that has passed since the previous call.
+   *
+   * \details The elapsed time is obtained from the high-performance counter, where the
+   * first call measures the time since the wheel was created.
+   *
+   * \return the amount of invoked callbacks.
+   *
+   * \since 6.4.0
+   */
+  auto advance() -> size_type
+  {
+    const auto now = counter::now();
+    const auto frequency = counter::frequency();
+
+    // Split into whole seconds and a remainder, so that the conversion can't overflow
+    const auto elapsed = now - m_lastCounter;
+    const auto rest = (elapsed % frequency) * 1'000'000'000u + m_counterRemainder;
+
+    m_lastCounter = now;
+    m_counterRemainder = rest % frequency;
+
+    const auto nanos = (elapsed / frequency) * 1'000'000'000u + rest / frequency;
+    return advance_by(duration_type{nanos});
+  }
+
+  /**
+   * \brief Advances the wheel by a specific amount of time.
+   *
+   * \details This is useful to drive timers with game time, e.g. by the delta of a
+   * `fixed_timestep`, in which case `advance()` shouldn't be used as well. Time that
+   * doesn't add up to a whole tick is kept for the next call.
+   *
+   * \param elapsed the time that has passed.
+   *
+   * \return the amount of invoked callbacks.
+   *
+   * \since 6.4.0
+   */
+  auto advance_by(const duration_type elapsed) -> size_type
+  {
+    m_timeRemainder += elapsed.count();
+
+    const auto ticks = m_timeRemainder / m_resolution;
+    m_timeRemainder %= m_resolution;
+
+    size_type invoked = 0;
+    for (u64 tick = 0; tick < ticks; ++tick) {
+      if (m_count == 0) {
+        m_now += ticks - tick;  // Nothing to fire, so the remaining ticks can be skipped
+        break;
+      }
+
+      invoked += process(++m_now);
+    }
+
+    return invoked;
+  }
+
+  /**
+   * \brief Cancels all timers.
+   *
+   * \note This must not be called from a callback.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    assert(m_firing == npos);
+
+    for (u32 index = 0; index < m_nodes.size(); ++index) {
+      if (m_nodes[index].active) {
+        unlink(index);
+        release(index);
+      }
+    }
+  }
+
+  /**
+   * \brief Returns the amount of scheduled timers.
+   *
+   * \return the number of pending timers.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_count;
+  }
+
+  /**
+   * \brief Indicates whether or not there are no scheduled timers.
+   *
+   * \return `true` if there are no pending timers; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_count == 0;
+  }
+
+  /**
+   * \brief Returns the duration of a tick.
+   *
+   * \return the resolution of the wheel.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto resolution() const noexcept -> duration_type
+  {
+    return duration_type{m_resolution};
+  }
+
+  /**
+   * \brief Returns the time that the wheel has been advanced by.
+   *
+   * \return the elapsed time, in whole ticks.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto elapsed() const noexcept -> duration_type
+  {
+    return duration_type{m_now * m_resolution};
+  }
+
+  /**
+   * \brief Returns the default duration of a tick.
+   *
+   * \return one millisecond.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_resolution() noexcept -> duration_type
+  {
+    return duration_type{1'000'000};
+  }
+
+ private:
+  inline constexpr static u32 npos = 0xFFFF'FFFF;
+  inline constexpr static u32 slot_bits = 6;
+  inline constexpr static u32 slot_count = 1u << slot_bits;
+  inline constexpr static u32 slot_mask = slot_count - 1;
+  inline constexpr static u32 level_count = 4;
+  inline constexpr static u64 max_delta = (u64{1} << (slot_bits * level_count)) - 1;
+
+  struct node final
+  {
+    callback_type callback;
+    u64 expires{};      ///< The tick at which the timer fires.
+    u64 interval{};     ///< The period of repeating timers, in ticks, zero otherwise.
+    u32 prev{npos};     ///< The previous node in the slot list.
+    u32 next{npos};     ///< The next node in the slot list.
+    u32 slot{npos};     ///< The slot that contains the node, if any.
+    u32 generation{1};  ///< Incremented when the node is released.
+    bool active{};
+  };
+
+  std::vector<node> m_nodes;
+  std::vector<u32> m_free;
+  std::array<u32, slot_count * level_count> m_heads{};
+  u64 m_resolution{};  ///< The duration of a tick, in nanoseconds.
+  u64 m_now{};         ///< The most recently processed tick.
+  u64 m_timeRemainder{};
+  u64 m_lastCounter{};
+  u64 m_counterRemainder{};
+  size_type m_count{};
+  u32 m_firing{npos};  ///< The node whose callback is being invoked.
+
+  [[nodiscard]] auto to_ticks(const duration_type duration) const noexcept -> u64
+  {
+    const auto ticks = (duration.count() + m_resolution - 1) / m_resolution;
+    return (ticks > 0) ? ticks : 1;
+  }
+
+  [[nodiscard]] static auto make_id(const u32 index, const u32 generation) noexcept
+      -> timer_id
+  {
+    return timer_id{(u64{generation} << 32) | index};
+  }
+
+  [[nodiscard]] auto find(const timer_id id) const noexcept -> std::optional<u32>
+  {
+    const auto value = static_cast<u64>(id);
+    const auto index = static_cast<u32>(value & 0xFFFF'FFFF);
+    const auto generation = static_cast<u32>(value >> 32);
+
+    if (index < m_nodes.size()) {
+      const auto& node = m_nodes[index];
+      if (node.active && node.generation == generation) {
+        return index;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  auto insert(const u64 delay, const u64 interval, callback_type&& callback) -> timer_id
+  {
+    assert(callback);
+
+    u32 index{};
+    if (!m_free.empty()) {
+      index = m_free.back();
+      m_free.pop_back();
+    }
+    else {
+      index = static_cast<u32>(m_nodes.size());
+      m_nodes.emplace_back();
+    }
+
+    auto& node = m_nodes[index];
+    node.callback = std::move(callback);
+    node.expires = m_now + delay;
+    node.interval = interval;
+    node.active = true;
+
+    link(index);
+    ++m_count;
+
+    return make_id(index, node.generation);
+  }
+
+  // Adds a node to the slot that corresponds to its expiry, relative to the current tick
+  void link(const u32 index) noexcept
+  {
+    auto& node = m_nodes[index];
+
+    const auto delta = node.expires - m_now;
+    const auto target = (delta > max_delta) ? m_now + max_delta : node.expires;
+
+    u32 level = 0;
+    while (level + 1 < level_count && (delta >> (slot_bits * (level + 1))) != 0) {
+      ++level;
+    }
+
+    const auto slot =
+        level * slot_count + static_cast<u32>((target >> (slot_bits * level)) & slot_mask);
+
+    node.slot = slot;
+    node.prev = npos;
+    node.next = m_heads[slot];
+
+    if (node.next != npos) {
+      m_nodes[node.next].prev = index;
+    }
+
+    m_heads[slot] = index;
+  }
+
+  void unlink(const u32 index) noexcept
+  {
+    auto& node = m_nodes[index];
+    if (node.slot == npos) {
+      return;
+    }
+
+    if (node.prev != npos) {
+      m_nodes[node.prev].next = node.next;
+    }
+    else {
+      m_heads[node.slot] = node.next;
+    }
+
+    if (node.next != npos) {
+      m_nodes[node.next].prev = node.prev;
+    }
+
+    node.slot = npos;
+    node.prev = npos;
+    node.next = npos;
+  }
+
+  void release(const u32 index) noexcept
+  {
+    auto& node = m_nodes[index];
+
+    if (node.active) {
+      --m_count;
+    }
+
+    node.callback = nullptr;
+    node.active = false;
+    ++node.generation;
+
+    m_free.push_back(index);
+  }
+
+  // Moves the nodes of a slot into the slots that correspond to the current tick
+  void cascade(const u32 level, const u64 tick) noexcept
+  {
+    const auto slot =
+        level * slot_count + static_cast<u32>((tick >> (slot_bits * level)) & slot_mask);
+
+    auto index = m_heads[slot];
+    m_heads[slot] = npos;
+
+    while (index != npos) {
+      const auto next = m_nodes[index].next;
+      link(index);
+      index = next;
+    }
+  }
+
+  auto process(const u64 tick) -> size_type
+  {
+    // Higher wheels cascade when all of the lower wheels wrap around
+    for (u32 level = 1; level < level_count; ++level) {
+      if (((tick >> (slot_bits * (level - 1))) & slot_mask) != 0) {
+        break;
+      }
+
+      cascade(level, tick);
+    }
+
+    size_type invoked = 0;
+
+    const auto slot = static_cast<u32>(tick & slot_mask);
+    while (m_heads[slot] != npos) {
+      const auto index = m_heads[slot];
+      unlink(index);
+
+      if (m_nodes[index].expires > tick) {
+        link(index);  // Only possible for timers beyond the range of the wheels
+        continue;
+      }
+
+      // The callback is moved out, since it may schedule timers that reallocate the nodes
+      auto callback = std::move(m_nodes[index].callback);
+
+      m_firing = index;
+      callback();
+      m_firing = npos;
+
+      ++invoked;
+
+      auto& node = m_nodes[index];
+      if (node.active && node.interval != 0) {
+        node.callback = std::move(callback);
+        node.expires = tick + node.interval;
+        link(index);
+      }
+      else {
+        release(index);
+      }
+    }
+
+    return invoked;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_TIMER_WHEEL_HEADER
@@ -0,0 +1,157 @@
+#ifndef CENTURION_ADAPTIVE_MUTEX_HEADER
+#define CENTURION_ADAPTIVE_MUTEX_HEADER
+
+#include <atomic>  // atomic, memory_order
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/spin_backoff.hpp"
+#include "condition.hpp"
+#include "lock_status.hpp"
+#include "mutex.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class adaptive_mutex
+ *
+ * \brief A mutex that spins for a short while before blocking.
+ *
+ * \details Locking a `mutex` always calls into SDL, which usually means a system call
+ * when the mutex is contended. An adaptive mutex is locked with a single atomic operation
+ * when it's available, and otherwise spins with an exponential backoff, since short
+ * critical sections such as queue pushes and pops are often released within a few
+ * hundred cycles. Only when the spinning fails, the thread is parked on a condition
+ * variable until the mutex is unlocked.
+ *
+ * \details The interface matches that of `mutex`, so adaptive mutexes can be used with
+ * `scoped_lock` and `try_lock`.
+ * \code{cpp}
+ *   cen::adaptive_mutex mutex;
+ *
+ *   {
+ *     cen::scoped_lock lock{mutex};
+ *     queue.push_back(job);
+ *   }
+ * \endcode
+ *
+ * \note Unlike `mutex`, an adaptive mutex is not recursive, and cannot be used with
+ * `condition`.
+ *
+ * \see `mutex`
+ * \see `shared_mutex`
+ *
+ * \since 6.4.0
+ */
+class adaptive_mutex final
+{
+ public:
+  /**
+   * \brief Creates an unlocked adaptive mutex.
+   *
+   * \throws sdl_error if the underlying mutex or condition variable cannot be created.
+   *
+   * \since 6.4.0
+   */
+  adaptive_mutex() = default;
+
+  adaptive_mutex(const adaptive_mutex&) = delete;
+
+  auto operator=(const adaptive_mutex&) -> adaptive_mutex& = delete;
+
+  /**
+   * \brief Locks the mutex, blocks if the mutex isn't available.
+   *
+   * \return `success` if the mutex was successfully locked; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto lock() noexcept -> result
+  {
+    if (acquire()) {
+      return success;
+    }
+
+    detail::spin_backoff backoff;
+    while (backoff.pause()) {
+      if (m_state.load(std::memory_order_relaxed) == unlocked && acquire()) {
+        return success;
+      }
+    }
+
+    // Marks the mutex as contended, so that the owner wakes us when unlocking it
+    if (!m_parking.lock()) {
+      return failure;
+    }
+
+    while (m_state.exchange(contended, std::memory_order_acquire) != unlocked) {
+      m_wake.wait(m_parking);
+    }
+
+    m_parking.unlock();
+    return success;
+  }
+
+  /**
+   * \brief Attempts to lock the mutex, returns if the mutex isn't available.
+   *
+   * \return `lock_status::success` if the mutex was locked; `lock_status::timed_out` if
+   * the mutex was already locked.
+   *
+   * \since 6.4.0
+   */
+  auto try_lock() noexcept -> lock_status
+  {
+    return acquire() ? lock_status::success : lock_status::timed_out;
+  }
+
+  /**
+   * \brief Unlocks the mutex.
+   *
+   * \return `success` if the mutex was successfully unlocked; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto unlock() noexcept -> result
+  {
+    if (m_state.exchange(unlocked, std::memory_order_release) == contended) {
+      // Locking the parking mutex ensures that the waiter is either waiting or will see
+      // that the mutex is available
+      if (!m_parking.lock()) {
+        return failure;
+      }
+
+      m_wake.signal();
+      m_parking.unlock();
+    }
+
+    return success;
+  }
+
+ private:
+  inline constexpr static u32 unlocked = 0;
+  inline constexpr static u32 locked = 1;
+  inline constexpr static u32 contended = 2;  // Locked, and there might be parked threads
+
+  std::atomic<u32> m_state{unlocked};
+  mutex m_parking;
+  condition m_wake;
+
+  [[nodiscard]] auto acquire() noexcept -> bool
+  {
+    auto expected = unlocked;
+    return m_state.compare_exchange_strong(expected,
+                                           locked,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed);
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_ADAPTIVE_MUTEX_HEADER
@@ -0,0 +1,247 @@
+#ifndef CENTURION_BLOCKING_QUEUE_HEADER
+#define CENTURION_BLOCKING_QUEUE_HEADER
+
+#include <optional>  // optional, nullopt
+#include <utility>   // move, forward
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../detail/spin_backoff.hpp"
+#include "lock_status.hpp"
+#include "mpmc_queue.hpp"
+#include "semaphore.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class blocking_queue
+ *
+ * \brief A bounded queue for any number of producers and consumers, which can wait for
+ * elements and free slots.
+ *
+ * \details A blocking queue stores its elements in an `mpmc_queue`, so pushing and popping
+ * never takes a lock. Two semaphores count the free slots and the queued elements, which
+ * lets producers block while the queue is full and consumers block while it's empty.
+ * \code{cpp}
+ *   cen::blocking_queue<chunk> chunks{64};
+ *
+ *   // Producer thread, which waits if the consumer falls behind
+ *   chunks.push(generate_chunk(position));
+ *
+ *   // Consumer thread
+ *   while (auto chunk = chunks.pop()) {
+ *     upload(*chunk);
+ *   }
+ * \endcode
+ *
+ * \tparam T the type of the elements, which must be move constructible.
+ *
+ * \see `mpmc_queue`
+ * \see `semaphore`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class blocking_queue final
+{
+ public:
+  using value_type = T;
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty queue.
+   *
+   * \param capacity the minimum number of elements the queue can hold, which is rounded
+   * up to a power of two.
+   *
+   * \throws sdl_error if the semaphores cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit blocking_queue(const size_type capacity)
+      : m_queue{capacity}
+      , m_free{static_cast<u32>(m_queue.capacity())}
+      , m_queued{0}
+  {}
+
+  /**
+   * \brief Adds an element to the back of the queue, blocks while the queue is full.
+   *
+   * \param args the arguments forwarded to the constructor of the element.
+   *
+   * \return `success` if the element was added; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  auto emplace(Args&&... args) -> result
+  {
+    if (!m_free.acquire()) {
+      return failure;
+    }
+
+    return publish(std::forward<Args>(args)...);
+  }
+
+  /**
+   * \brief Adds an element to the back of the queue, blocks while the queue is full.
+   *
+   * \param value the element that will be added.
+   *
+   * \return `success` if the element was added; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto push(T value) -> result
+  {
+    return emplace(std::move(value));
+  }
+
+  /**
+   * \brief Adds an element to the back of the queue, unless the queue is full.
+   *
+   * \param value the element that will be added.
+   *
+   * \return `success` if the element was added; `failure` if the queue is full.
+   *
+   * \since 6.4.0
+   */
+  auto try_push(T value) -> result
+  {
+    if (m_free.try_acquire() != lock_status::success) {
+      return failure;
+    }
+
+    return publish(std::move(value));
+  }
+
+  /**
+   * \brief Removes the element at the front of the queue, blocks while the queue is
+   * empty.
+   *
+   * \return the removed element; an empty optional if something went wrong.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pop() -> std::optional<T>
+  {
+    if (!m_queued.acquire()) {
+      return std::nullopt;
+    }
+
+    return take();
+  }
+
+  /**
+   * \brief Removes the element at the front of the queue, blocks for at most the
+   * specified duration while the queue is empty.
+   *
+   * \param ms the maximum amount of time to wait.
+   *
+   * \return the removed element; an empty optional if the queue was still empty.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pop(const milliseconds<u32> ms) -> std::optional<T>
+  {
+    if (m_queued.acquire(ms) != lock_status::success) {
+      return std::nullopt;
+    }
+
+    return take();
+  }
+
+  /**
+   * \brief Removes the element at the front of the queue, unless the queue is empty.
+   *
+   * \return the removed element; an empty optional if the queue is empty.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_pop() -> std::optional<T>
+  {
+    if (m_queued.try_acquire() != lock_status::success) {
+      return std::nullopt;
+    }
+
+    return take();
+  }
+
+  /**
+   * \brief Returns the number of elements in the queue.
+   *
+   * \return the approximate number of elements.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_queue.size();
+  }
+
+  /**
+   * \brief Indicates whether the queue is empty.
+   *
+   * \return `true` if the queue appeared to be empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_queue.empty();
+  }
+
+  /**
+   * \brief Returns the maximum number of elements in the queue.
+   *
+   * \return the capacity, which is a power of two.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_queue.capacity();
+  }
+
+ private:
+  mpmc_queue<T> m_queue;
+  semaphore m_free;
+  semaphore m_queued;
+
+  /* A reserved slot or element is guaranteed to be available, but the slot at the end of
+     the ring might still be in use by a thread that claimed it before us, e.g. a producer
+     that has yet to finish writing its element. Such threads are about to finish, so we
+     only spin until they have. */
+
+  template <typename... Args>
+  auto publish(Args&&... args) -> result
+  {
+    while (!m_queue.try_emplace(std::forward<Args>(args)...)) {
+      detail::cpu_relax();
+    }
+
+    return m_queued.release();
+  }
+
+  [[nodiscard]] auto take() -> std::optional<T>
+  {
+    auto value = m_queue.try_pop();
+    while (!value) {
+      detail::cpu_relax();
+      value = m_queue.try_pop();
+    }
+
+    m_free.release();
+    return value;
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_BLOCKING_QUEUE_HEADER
@@ -3,12 +3,15 @@
 
 #include <SDL2/SDL.h>
 
+#include <chrono>  // duration
 #include <memory>  // unique_ptr
+#include <thread>  // this_thread::yield
 
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../core/result.hpp"
 #include "../core/time.hpp"
+#include "deadline.hpp"
 #include "lock_status.hpp"
 #include "mutex.hpp"
 #include "scoped_lock.hpp"
@@ -98,6 +101,78 @@ class condition final
         SDL_CondWaitTimeout(m_cond.get(), mutex.get(), ms.count()));
   }
 
+  /**
+   * \brief Waits until the condition variable is signaled or a deadline expires.
+   *
+   * \details Unlike the overload that accepts milliseconds, this function returns within
+   * microseconds of the deadline. During the final stretch of the wait, the mutex is
+   * briefly released and the function returns `success` as a spurious wake-up, so the
+   * waited for predicate must always be checked in a loop.
+   * \code{cpp}
+   *   cen::scoped_lock lock{mutex};
+   *   while (!ready && cond.wait(mutex, frameEnd) == cen::lock_status::success) {
+   *   }
+   * \endcode
+   *
+   * \pre The mutex must be locked when the function is called!
+   *
+   * \param mutex the mutex used to coordinate thread access.
+   * \param until the deadline of the wait.
+   *
+   * \return `success` if the condition was signaled, or might have been; `timed_out` if
+   * the deadline expired.
+   *
+   * \see `deadline`
+   *
+   * \since 6.4.0
+   */
+  auto wait(mutex& mutex, const deadline& until) noexcept -> lock_status
+  {
+    const auto remaining = until.remaining().count();
+
+    if (remaining >= detail::deadline_spin_ns) {
+      const auto ms = static_cast<u32>((remaining - detail::deadline_spin_ns) / 1'000'000) + 1;
+      const auto status = wait(mutex, milliseconds<u32>{ms});
+      return status == lock_status::timed_out ? lock_status::success : status;
+    }
+    else if (remaining == 0) {
+      return lock_status::timed_out;
+    }
+
+    mutex.unlock();
+    std::this_thread::yield();
+    mutex.lock();
+
+    return lock_status::success;
+  }
+
+  /**
+   * \brief Waits until the condition variable is signaled or a high-resolution duration
+   * has passed.
+   *
+   * \details The deadline is computed when the function is called, so when waiting in a
+   * loop, create a `deadline` once and use the deadline overload instead.
+   *
+   * \pre The mutex must be locked when the function is called!
+   *
+   * \tparam Rep the representation of the duration.
+   * \tparam Period the period of the duration.
+   *
+   * \param mutex the mutex used to coordinate thread access.
+   * \param timeout the maximum amount of time to wait, e.g. in microseconds.
+   *
+   * \return `success` if the condition was signaled, or might have been; `timed_out` if
+   * the timeout expired.
+   *
+   * \since 6.4.0
+   */
+  template <typename Rep, typename Period>
+  auto wait(mutex& mutex, const std::chrono::duration<Rep, Period>& timeout) noexcept
+      -> lock_status
+  {
+    return wait(mutex, deadline::after(timeout));
+  }
+
  private:
   struct deleter final
   {
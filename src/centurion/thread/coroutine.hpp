@@ -0,0 +1,579 @@
+#ifndef CENTURION_COROUTINE_HEADER
+#define CENTURION_COROUTINE_HEADER
+
+#include "../compiler/features.hpp"
+
+#if CENTURION_HAS_FEATURE_COROUTINES
+
+#include <cassert>     // assert
+#include <coroutine>   // coroutine_handle, suspend_always, noop_coroutine
+#include <exception>   // exception_ptr, current_exception, rethrow_exception
+#include <functional>  // function, ref
+#include <utility>     // move, exchange, swap
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+class coroutine_scheduler;
+
+/// \cond FALSE
+namespace detail {
+
+class timer_awaitable;
+
+template <typename Condition, typename Result>
+class poll_awaitable;
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class coroutine
+ *
+ * \brief The return type of coroutines that are executed by a coroutine scheduler.
+ *
+ * \details A coroutine doesn't start executing until it's spawned by a
+ * `coroutine_scheduler`, which resumes it from the main loop whenever whatever it awaits
+ * is done, e.g. the next frame, a delay, or an asynchronously loaded texture. Coroutines
+ * can also await other coroutines, which lets loading sequences be split into smaller
+ * parts.
+ * \code{cpp}
+ *   auto load_level(cen::image_loader& images) -> cen::coroutine
+ *   {
+ *     auto tiles = cen::load_texture(images, "tiles.png");
+ *     auto player = cen::load_texture(images, "player.png");
+ *
+ *     m_tiles = co_await tiles;
+ *     m_player = co_await player;
+ *
+ *     co_await cen::delay(cen::milliseconds<cen::u32>{500});
+ *     m_state = game_state::playing;
+ *   }
+ * \endcode
+ *
+ * \note Exceptions thrown by a coroutine are rethrown by the coroutine that awaits it, or
+ * by the scheduler if it was spawned directly.
+ *
+ * \see `coroutine_scheduler`
+ *
+ * \since 6.4.0
+ */
+class coroutine final
+{
+ public:
+  /**
+   * \brief The promise type of coroutines, which is used by the compiler.
+   *
+   * \since 6.4.0
+   */
+  class promise_type final
+  {
+   public:
+    [[nodiscard]] auto get_return_object() noexcept -> coroutine
+    {
+      return coroutine{handle_type::from_promise(*this)};
+    }
+
+    [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always
+    {
+      return {};
+    }
+
+    [[nodiscard]] auto final_suspend() const noexcept -> auto
+    {
+      struct final_awaitable final
+      {
+        [[nodiscard]] auto await_ready() const noexcept -> bool
+        {
+          return false;
+        }
+
+        // Transfers control to the awaiting coroutine, if there is one
+        [[nodiscard]] auto await_suspend(handle_type handle) const noexcept
+            -> std::coroutine_handle<>
+        {
+          const auto continuation = handle.promise().m_continuation;
+          return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept
+        {}
+      };
+
+      return final_awaitable{};
+    }
+
+    void return_void() const noexcept
+    {}
+
+    void unhandled_exception() noexcept
+    {
+      m_exception = std::current_exception();
+    }
+
+    /**
+     * \brief Returns the scheduler that executes the coroutine.
+     *
+     * \return the scheduler; a null pointer if the coroutine hasn't been started.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto scheduler() const noexcept -> coroutine_scheduler*
+    {
+      return m_scheduler;
+    }
+
+   private:
+    coroutine_scheduler* m_scheduler{};
+    std::coroutine_handle<> m_continuation;
+    std::exception_ptr m_exception;
+
+    friend class coroutine;
+    friend class coroutine_scheduler;
+  };
+
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  coroutine(const coroutine&) = delete;
+
+  auto operator=(const coroutine&) -> coroutine& = delete;
+
+  coroutine(coroutine&& other) noexcept : m_handle{std::exchange(other.m_handle, nullptr)}
+  {}
+
+  auto operator=(coroutine&& other) noexcept -> coroutine&
+  {
+    if (this != &other) {
+      reset();
+      m_handle = std::exchange(other.m_handle, nullptr);
+    }
+
+    return *this;
+  }
+
+  /**
+   * \brief Destroys the coroutine frame, unless it has been spawned.
+   *
+   * \since 6.4.0
+   */
+  ~coroutine() noexcept
+  {
+    reset();
+  }
+
+  /**
+   * \brief Starts the coroutine from another coroutine, and resumes the awaiting
+   * coroutine once it has finished.
+   *
+   * \details The awaited coroutine is executed by the same scheduler as the awaiting
+   * coroutine.
+   *
+   * \return an awaitable that rethrows the exception thrown by the coroutine, if any.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto operator co_await() && noexcept -> auto
+  {
+    struct child_awaitable final
+    {
+      handle_type child;
+
+      [[nodiscard]] auto await_ready() const noexcept -> bool
+      {
+        return !child || child.done();
+      }
+
+      [[nodiscard]] auto await_suspend(handle_type parent) const noexcept
+          -> std::coroutine_handle<>
+      {
+        child.promise().m_scheduler = parent.promise().m_scheduler;
+        child.promise().m_continuation = parent;
+        return child;
+      }
+
+      void await_resume() const
+      {
+        if (child && child.promise().m_exception) {
+          std::rethrow_exception(child.promise().m_exception);
+        }
+      }
+    };
+
+    return child_awaitable{m_handle};
+  }
+
+  /**
+   * \brief Indicates whether the coroutine has finished.
+   *
+   * \return `true` if the coroutine has finished or is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto done() const noexcept -> bool
+  {
+    return !m_handle || m_handle.done();
+  }
+
+ private:
+  handle_type m_handle;
+
+  explicit coroutine(const handle_type handle) noexcept : m_handle{handle}
+  {}
+
+  void reset() noexcept
+  {
+    if (m_handle) {
+      m_handle.destroy();
+      m_handle = nullptr;
+    }
+  }
+
+  friend class coroutine_scheduler;
+};
+
+/**
+ * \class coroutine_scheduler
+ *
+ * \brief Executes coroutines from the main loop, one step per frame.
+ *
+ * \details Spawned coroutines run until they await something, and are then resumed by
+ * `update()` once it's done. Call `update()` once per frame, after the frame has been
+ * processed, e.g. after `image_loader::upload()` and `io_service::poll()`.
+ * \code{cpp}
+ *   cen::coroutine_scheduler coroutines;
+ *   coroutines.spawn(load_level(images));
+ *
+ *   while (running) {
+ *     dispatcher.poll();
+ *     images.upload(renderer);
+ *
+ *     coroutines.update(pacer.interval());
+ *     render();
+ *   }
+ * \endcode
+ *
+ * \note The scheduler isn't thread-safe, all functions must be called on the same thread.
+ *
+ * \see `coroutine`
+ * \see `next_frame()`
+ * \see `delay()`
+ * \see `wait_until()`
+ *
+ * \since 6.4.0
+ */
+class coroutine_scheduler final
+{
+ public:
+  using ms_type = milliseconds<u32>;
+  using time_type = milliseconds<u64>;
+  using size_type = usize;
+
+  coroutine_scheduler() = default;
+
+  coroutine_scheduler(const coroutine_scheduler&) = delete;
+
+  auto operator=(const coroutine_scheduler&) -> coroutine_scheduler& = delete;
+
+  /**
+   * \brief Destroys all coroutines that haven't finished.
+   *
+   * \since 6.4.0
+   */
+  ~coroutine_scheduler() noexcept
+  {
+    clear();
+  }
+
+  /**
+   * \brief Starts a coroutine, which runs until it first suspends.
+   *
+   * \param routine the coroutine that will be started.
+   *
+   * \throws the exception thrown by the coroutine, if it throws before suspending.
+   *
+   * \since 6.4.0
+   */
+  void spawn(coroutine routine)
+  {
+    auto handle = std::exchange(routine.m_handle, nullptr);
+    if (!handle) {
+      return;
+    }
+
+    handle.promise().m_scheduler = this;
+    m_roots.push_back(handle);
+
+    handle.resume();
+    collect();
+  }
+
+  /**
+   * \brief Advances the scheduler by one frame, and resumes the coroutines that are done
+   * waiting.
+   *
+   * \details Coroutines that suspend while being resumed are resumed no earlier than the
+   * next call.
+   *
+   * \param elapsed the amount of time that has passed since the previous call.
+   *
+   * \throws the first exception thrown by a spawned coroutine, after all coroutines have
+   * been resumed.
+   *
+   * \since 6.4.0
+   */
+  void update(const ms_type elapsed = ms_type::zero())
+  {
+    m_now += time_type{elapsed.count()};
+
+    std::swap(m_waiting, m_resuming);
+
+    for (auto& waiter : m_resuming) {
+      if (waiter.deadline <= m_now && (!waiter.condition || waiter.condition())) {
+        waiter.handle.resume();
+      }
+      else {
+        m_waiting.push_back(std::move(waiter));
+      }
+    }
+
+    m_resuming.clear();
+    collect();
+  }
+
+  /**
+   * \brief Destroys all coroutines that haven't finished.
+   *
+   * \warning This function must not be called from a coroutine.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_waiting.clear();
+
+    for (const auto handle : m_roots) {
+      handle.destroy();
+    }
+
+    m_roots.clear();
+  }
+
+  /**
+   * \brief Returns the amount of spawned coroutines that haven't finished.
+   *
+   * \return the number of running coroutines, excluding those awaited by other coroutines.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_roots.size();
+  }
+
+  /**
+   * \brief Indicates whether all spawned coroutines have finished.
+   *
+   * \return `true` if there are no running coroutines; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_roots.empty();
+  }
+
+  /**
+   * \brief Returns the total amount of time that has been passed to `update()`.
+   *
+   * \return the time of the scheduler, which is used by `delay()`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto now() const noexcept -> time_type
+  {
+    return m_now;
+  }
+
+ private:
+  struct waiter final
+  {
+    std::coroutine_handle<> handle;
+    time_type deadline{};
+    std::function<bool()> condition;
+  };
+
+  std::vector<coroutine::handle_type> m_roots;
+  std::vector<waiter> m_waiting;
+  std::vector<waiter> m_resuming;
+  time_type m_now{};
+
+  void suspend(const std::coroutine_handle<> handle,
+               const time_type deadline,
+               std::function<bool()> condition = {})
+  {
+    m_waiting.push_back(waiter{handle, deadline, std::move(condition)});
+  }
+
+  void collect()
+  {
+    std::exception_ptr exception;
+
+    for (auto it = m_roots.begin(); it != m_roots.end();) {
+      if (it->done()) {
+        if (!exception) {
+          exception = it->promise().m_exception;
+        }
+
+        it->destroy();
+        it = m_roots.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  friend class detail::timer_awaitable;
+
+  template <typename Condition, typename Result>
+  friend class detail::poll_awaitable;
+};
+
+/// \cond FALSE
+namespace detail {
+
+[[nodiscard]] inline auto scheduler_of(const coroutine::handle_type handle) noexcept
+    -> coroutine_scheduler&
+{
+  assert(handle.promise().scheduler() && "Coroutine hasn't been spawned!");
+  return *handle.promise().scheduler();
+}
+
+class timer_awaitable final
+{
+ public:
+  explicit timer_awaitable(const coroutine_scheduler::time_type duration) noexcept
+      : m_duration{duration}
+  {}
+
+  [[nodiscard]] auto await_ready() const noexcept -> bool
+  {
+    return false;
+  }
+
+  void await_suspend(const coroutine::handle_type handle) const
+  {
+    auto& scheduler = scheduler_of(handle);
+    scheduler.suspend(handle, scheduler.now() + m_duration);
+  }
+
+  void await_resume() const noexcept
+  {}
+
+ private:
+  coroutine_scheduler::time_type m_duration;
+};
+
+template <typename Condition, typename Result>
+class poll_awaitable final
+{
+ public:
+  poll_awaitable(Condition condition, Result result)
+      : m_condition{std::move(condition)}
+      , m_result{std::move(result)}
+  {}
+
+  [[nodiscard]] auto await_ready() -> bool
+  {
+    return m_condition();
+  }
+
+  void await_suspend(const coroutine::handle_type handle)
+  {
+    // The awaitable lives in the coroutine frame until the coroutine is resumed
+    scheduler_of(handle).suspend(handle, {}, std::ref(m_condition));
+  }
+
+  [[nodiscard]] auto await_resume() -> decltype(auto)
+  {
+    return m_result();
+  }
+
+ private:
+  Condition m_condition;
+  Result m_result;
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Suspends a coroutine until the next frame.
+ *
+ * \return an awaitable that is resumed by the next call to `coroutine_scheduler::update()`.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto next_frame() noexcept -> detail::timer_awaitable
+{
+  return detail::timer_awaitable{coroutine_scheduler::time_type::zero()};
+}
+
+/**
+ * \brief Suspends a coroutine for at least the specified duration.
+ *
+ * \details The duration is measured with the time that is passed to
+ * `coroutine_scheduler::update()`, so a delay never elapses while the game is paused.
+ *
+ * \param ms the duration of the delay, a zero delay waits for the next frame.
+ *
+ * \return an awaitable that is resumed once the delay has elapsed.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto delay(const milliseconds<u32> ms) noexcept
+    -> detail::timer_awaitable
+{
+  return detail::timer_awaitable{coroutine_scheduler::time_type{ms.count()}};
+}
+
+/**
+ * \brief Suspends a coroutine until a condition is satisfied.
+ *
+ * \details The condition is checked immediately, and then once per frame until it's
+ * satisfied.
+ * \code{cpp}
+ *   auto level = cen::async(scheduler, [] { return load_level("forest"); });
+ *   co_await cen::wait_until([&] { return level.ready(); });
+ * \endcode
+ *
+ * \tparam Condition the type of the condition, which must be invocable as `bool()`.
+ *
+ * \param condition the condition that will be checked.
+ *
+ * \return an awaitable that is resumed once the condition is satisfied.
+ *
+ * \since 6.4.0
+ */
+template <typename Condition>
+[[nodiscard]] auto wait_until(Condition condition)
+{
+  return detail::poll_awaitable{std::move(condition), [] {}};
+}
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_HAS_FEATURE_COROUTINES
+#endif  // CENTURION_COROUTINE_HEADER
@@ -0,0 +1,240 @@
+#ifndef CENTURION_DEADLINE_HEADER
+#define CENTURION_DEADLINE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <chrono>  // duration, duration_cast
+#include <thread>  // this_thread::yield
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../system/counter.hpp"
+#include "lock_status.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class deadline
+ *
+ * \brief Represents a point in time, measured with the high-performance counter.
+ *
+ * \details Deadlines are accepted by the timed waits of `semaphore` and `condition`, which
+ * wake up within microseconds of the deadline, unlike the waits that accept a number of
+ * milliseconds. This is useful for pipeline stages that must hand over their work before
+ * the end of a frame, even at high refresh rates.
+ * \code{cpp}
+ *   const auto frameEnd = cen::deadline::after(cen::microseconds<cen::u32>{4'166});
+ *
+ *   while (jobs.acquire(frameEnd) == cen::lock_status::success) {
+ *     process_job();
+ *   }
+ * \endcode
+ *
+ * \see `semaphore::acquire()`
+ * \see `condition::wait()`
+ *
+ * \since 6.4.0
+ */
+class deadline final
+{
+ public:
+  using duration_type = nanoseconds<u64>;
+
+  /**
+   * \brief Creates a deadline at a value of the high-performance counter.
+   *
+   * \param ticks the value of `counter::now()` at the deadline.
+   *
+   * \since 6.4.0
+   */
+  explicit deadline(const u64 ticks) noexcept : m_ticks{ticks}
+  {}
+
+  /**
+   * \brief Creates a deadline relative to the current time.
+   *
+   * \tparam Rep the representation of the duration.
+   * \tparam Period the period of the duration.
+   *
+   * \param timeout the time until the deadline; negative durations are treated as zero.
+   *
+   * \return a deadline that expires after the timeout.
+   *
+   * \since 6.4.0
+   */
+  template <typename Rep, typename Period>
+  [[nodiscard]] static auto after(const std::chrono::duration<Rep, Period> timeout) noexcept
+      -> deadline
+  {
+    const auto now = counter::now();
+    if (timeout <= timeout.zero()) {
+      return deadline{now};
+    }
+
+    const auto ns = std::chrono::duration_cast<duration_type>(timeout);
+    return deadline{now + to_counter_ticks(ns)};
+  }
+
+  /**
+   * \brief Returns the time left until the deadline.
+   *
+   * \return the remaining time; zero if the deadline has expired.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto remaining() const noexcept -> duration_type
+  {
+    const auto now = counter::now();
+    if (now >= m_ticks) {
+      return duration_type::zero();
+    }
+
+    return from_counter_ticks(m_ticks - now);
+  }
+
+  /**
+   * \brief Indicates whether the deadline has expired.
+   *
+   * \return `true` if the deadline has passed; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto expired() const noexcept -> bool
+  {
+    return counter::now() >= m_ticks;
+  }
+
+  /**
+   * \brief Returns the value of the high-performance counter at the deadline.
+   *
+   * \return the counter value of the deadline.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto ticks() const noexcept -> u64
+  {
+    return m_ticks;
+  }
+
+  /**
+   * \brief Converts a duration to the corresponding amount of high-performance counter
+   * ticks.
+   *
+   * \param duration the duration that will be converted.
+   *
+   * \return the amount of counter ticks, rounded down.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto to_counter_ticks(const duration_type duration) noexcept -> u64
+  {
+    const auto ns = duration.count();
+    const auto frequency = counter::frequency();
+
+    // Split to avoid overflowing for long durations
+    const auto seconds = ns / 1'000'000'000;
+    const auto fraction = ns % 1'000'000'000;
+
+    return seconds * frequency + fraction * frequency / 1'000'000'000;
+  }
+
+  /**
+   * \brief Converts an amount of high-performance counter ticks to a duration.
+   *
+   * \param ticks the amount of counter ticks, e.g. the difference between two values of
+   * `counter::now()`.
+   *
+   * \return the corresponding duration, rounded down.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto from_counter_ticks(const u64 ticks) noexcept -> duration_type
+  {
+    const auto frequency = counter::frequency();
+    return duration_type{ticks / frequency * 1'000'000'000 +
+                         ticks % frequency * 1'000'000'000 / frequency};
+  }
+
+ private:
+  u64 m_ticks{};
+};
+
+/// \cond FALSE
+namespace detail {
+
+/* SDL only waits with a resolution of milliseconds, and may oversleep by another
+   millisecond or so. We therefore let SDL wait until shortly before the deadline, and
+   then yield until the deadline, trying to succeed without blocking in between. */
+
+inline constexpr u64 deadline_spin_ns = 2'000'000;
+
+template <typename Try, typename Wait>
+[[nodiscard]] auto wait_for_deadline(const deadline& until,
+                                     Try try_once,
+                                     Wait wait_ms) noexcept -> lock_status
+{
+  while (true) {
+    const auto remaining = until.remaining().count();
+
+    if (remaining >= deadline_spin_ns) {
+      const auto ms = static_cast<u32>((remaining - deadline_spin_ns) / 1'000'000) + 1;
+      if (const auto status = wait_ms(milliseconds<u32>{ms});
+          status != lock_status::timed_out) {
+        return status;
+      }
+    }
+    else {
+      if (const auto status = try_once(); status != lock_status::timed_out) {
+        return status;
+      }
+      else if (remaining == 0) {
+        return lock_status::timed_out;
+      }
+
+      std::this_thread::yield();
+    }
+  }
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Blocks the calling thread until a deadline has expired.
+ *
+ * \details The thread sleeps with `SDL_Delay()` until shortly before the deadline, and
+ * then yields until the deadline, which makes this function accurate to within a few
+ * microseconds, unlike `thread::sleep()`, which may oversleep by a millisecond or more.
+ * The spinning only lasts for up to two milliseconds, so the CPU usage remains low.
+ *
+ * \param until the deadline to wait for.
+ *
+ * \see `thread::sleep()`
+ *
+ * \since 6.4.0
+ */
+inline void sleep_until(const deadline& until) noexcept
+{
+  while (true) {
+    const auto remaining = until.remaining().count();
+
+    if (remaining >= detail::deadline_spin_ns) {
+      SDL_Delay(static_cast<u32>((remaining - detail::deadline_spin_ns) / 1'000'000) + 1);
+    }
+    else if (remaining != 0) {
+      std::this_thread::yield();
+    }
+    else {
+      return;
+    }
+  }
+}
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_DEADLINE_HEADER
@@ -0,0 +1,662 @@
+#ifndef CENTURION_FUTURE_HEADER
+#define CENTURION_FUTURE_HEADER
+
+#include <atomic>       // atomic, memory_order
+#include <cassert>      // assert
+#include <exception>    // exception_ptr, rethrow_exception
+#include <functional>   // function
+#include <optional>     // optional
+#include <type_traits>  // conditional_t, is_void_v, invoke_result_t, decay_t
+#include <utility>      // move, forward, exchange
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "main_thread_queue.hpp"
+#include "task_scheduler.hpp"
+#include "thread.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+template <typename T>
+class future;
+
+/// \cond FALSE
+namespace detail {
+
+struct future_unit final
+{};
+
+template <typename T>
+using future_value_t = std::conditional_t<std::is_void_v<T>, future_unit, T>;
+
+template <typename T, typename Function>
+using continuation_result_t =
+    typename std::conditional_t<std::is_void_v<T>,
+                                std::invoke_result<Function&>,
+                                std::invoke_result<Function&, T>>::type;
+
+/* The state shared by a future and its producer, which is reference counted by hand,
+   so that tasks can refer to it with a plain pointer. Plain pointers fit in the small
+   buffer of std::function, so submitting a task doesn't allocate. */
+template <typename T>
+class future_state
+{
+ public:
+  inline constexpr static u32 pending = 0;
+  inline constexpr static u32 chained = 1;  // Pending, with a continuation
+  inline constexpr static u32 ready = 2;
+  inline constexpr static u32 broken = 3;
+
+  virtual ~future_state() noexcept = default;
+
+  void retain() noexcept
+  {
+    m_references.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void release() noexcept
+  {
+    if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+  template <typename... Args>
+  void fulfil(Args&&... args)
+  {
+    m_value.emplace(std::forward<Args>(args)...);
+    finish(ready);
+  }
+
+  void abandon()
+  {
+    finish(broken);
+  }
+
+  void fail(std::exception_ptr error)
+  {
+    m_error = std::move(error);
+    finish(broken);
+  }
+
+  // Registers the function invoked once the state is finished, or invokes it immediately
+  void chain(std::function<void()> continuation)
+  {
+    m_continuation = std::move(continuation);
+
+    auto expected = pending;
+    if (!m_status.compare_exchange_strong(expected,
+                                          chained,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire))
+    {
+      const auto invoke = std::move(m_continuation);
+      invoke();
+    }
+  }
+
+  [[nodiscard]] auto finished() const noexcept -> bool
+  {
+    return m_status.load(std::memory_order_acquire) >= ready;
+  }
+
+  [[nodiscard]] auto is_broken() const noexcept -> bool
+  {
+    return m_status.load(std::memory_order_acquire) == broken;
+  }
+
+  [[nodiscard]] auto value() noexcept -> future_value_t<T>&
+  {
+    return *m_value;
+  }
+
+  [[nodiscard]] auto error() const noexcept -> const std::exception_ptr&
+  {
+    return m_error;
+  }
+
+  task_scheduler* scheduler{};  ///< Helps waiting threads, if the value comes from a task.
+
+ private:
+  std::atomic<u32> m_references{1};
+  std::atomic<u32> m_status{pending};
+  std::optional<future_value_t<T>> m_value;
+  std::exception_ptr m_error;
+  std::function<void()> m_continuation;
+
+  void finish(const u32 status)
+  {
+    if (m_status.exchange(status, std::memory_order_acq_rel) == chained) {
+      const auto invoke = std::move(m_continuation);
+      invoke();
+    }
+  }
+};
+
+// Invokes a function with the value of a finished state, and fulfils another state with
+// the result
+template <typename R, typename T, typename Function>
+void fulfil_with(future_state<R>& target, future_state<T>& source, Function& function)
+{
+  if (source.is_broken()) {
+    target.fail(source.error());
+  }
+  else if constexpr (std::is_void_v<T> && std::is_void_v<R>) {
+    function();
+    target.fulfil();
+  }
+  else if constexpr (std::is_void_v<T>) {
+    target.fulfil(function());
+  }
+  else if constexpr (std::is_void_v<R>) {
+    function(std::move(source.value()));
+    target.fulfil();
+  }
+  else {
+    target.fulfil(function(std::move(source.value())));
+  }
+}
+
+// The state of a future obtained from async(), which stores the task
+template <typename T, typename Function>
+class async_state final : public future_state<T>
+{
+ public:
+  explicit async_state(Function function) : m_function{std::move(function)}
+  {}
+
+  void run()
+  {
+    if constexpr (std::is_void_v<T>) {
+      m_function();
+      this->fulfil();
+    }
+    else {
+      this->fulfil(m_function());
+    }
+  }
+
+ private:
+  Function m_function;
+};
+
+// The state of a future obtained from then(), which is fulfilled by an executor
+template <typename R, typename T, typename Function, typename Executor>
+class continuation_state final : public future_state<R>
+{
+ public:
+  continuation_state(future_state<T>* source, Function function, Executor& executor)
+      : m_source{source}
+      , m_function{std::move(function)}
+      , m_executor{&executor}
+  {}
+
+  ~continuation_state() noexcept override
+  {
+    if (m_source) {
+      m_source->release();
+    }
+  }
+
+  [[nodiscard]] auto source() noexcept -> future_state<T>&
+  {
+    return *m_source;
+  }
+
+  // Invoked once the source is finished, with a reference owned by the submitted task
+  void schedule()
+  {
+    m_executor->submit([this] {
+      fulfil_with(*this, *m_source, m_function);
+
+      std::exchange(m_source, nullptr)->release();
+      this->release();
+    });
+  }
+
+ private:
+  future_state<T>* m_source{};
+  Function m_function;
+  Executor* m_executor{};
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class future
+ *
+ * \brief Provides the result of an asynchronous operation.
+ *
+ * \details Futures are obtained from `async()` and `promise::get_future()`. Rather than
+ * blocking on the result with `get()`, a continuation can be attached with `then()`, which
+ * is executed on the worker threads of a task scheduler or on the main thread, through a
+ * `main_thread_queue`, once the result is available.
+ * \code{cpp}
+ *   auto chunk = cen::async(scheduler, [=] { return generate_chunk(x, y); });
+ *
+ *   chunk.then(scheduler, [](chunk_data data) { return build_mesh(data); })
+ *       .then(main_tasks, [&](mesh_data mesh) { world.upload(std::move(mesh)); });
+ * \endcode
+ *
+ * \details A future and its producer share a single allocation, and submitting the tasks
+ * of `async()` and `then()` doesn't allocate, unlike `std::async`, which creates a thread
+ * for every call on common implementations.
+ *
+ * \note Waiting for a future that is fulfilled by a `main_thread_queue` on the main thread
+ * never finishes, since the queue isn't drained while the main thread waits.
+ *
+ * \tparam T the type of the result, may be `void`.
+ *
+ * \see `async()`
+ * \see `promise`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class future final
+{
+ public:
+  using value_type = T;
+
+  /**
+   * \brief Creates an invalid future, which isn't associated with a result.
+   *
+   * \since 6.4.0
+   */
+  future() noexcept = default;
+
+  future(const future&) = delete;
+
+  auto operator=(const future&) -> future& = delete;
+
+  future(future&& other) noexcept : m_state{std::exchange(other.m_state, nullptr)}
+  {}
+
+  auto operator=(future&& other) noexcept -> future&
+  {
+    if (this != &other) {
+      reset();
+      m_state = std::exchange(other.m_state, nullptr);
+    }
+
+    return *this;
+  }
+
+  ~future() noexcept
+  {
+    reset();
+  }
+
+  /**
+   * \brief Blocks until the result is available, and then returns it.
+   *
+   * \details The future is invalid after this call.
+   *
+   * \pre The future must be valid.
+   *
+   * \return the result.
+   *
+   * \throws cen_error if the promise was destroyed without providing a result.
+   * \throws the exception stored by `promise::set_exception()`, if there is one.
+   *
+   * \since 6.4.0
+   */
+  auto get() -> T
+  {
+    wait();
+
+    future consumed{std::move(*this)};
+    if (consumed.m_state->is_broken()) {
+      if (const auto& error = consumed.m_state->error()) {
+        std::rethrow_exception(error);
+      }
+
+      throw cen_error{"Broken promise!"};
+    }
+
+    if constexpr (!std::is_void_v<T>) {
+      return std::move(consumed.m_state->value());
+    }
+  }
+
+  /**
+   * \brief Blocks until the result is available.
+   *
+   * \details If the result comes from a task scheduler, the calling thread executes
+   * queued tasks while it waits.
+   *
+   * \pre The future must be valid.
+   *
+   * \since 6.4.0
+   */
+  void wait() const
+  {
+    assert(valid());
+
+    while (!m_state->finished()) {
+      if (!m_state->scheduler || !m_state->scheduler->run_one()) {
+        thread::sleep(milliseconds<u32>{0});
+      }
+    }
+  }
+
+  /**
+   * \brief Attaches a continuation, which is executed by a task scheduler once the result
+   * is available.
+   *
+   * \details The continuation is invoked with the result, or without arguments if the
+   * result is `void`. The future is invalid after this call.
+   *
+   * \pre The future must be valid.
+   *
+   * \tparam Function the type of the continuation.
+   *
+   * \param scheduler the task scheduler that will execute the continuation.
+   * \param function the continuation.
+   *
+   * \return a future that provides the result of the continuation.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  auto then(task_scheduler& scheduler, Function&& function)
+      -> future<detail::continuation_result_t<T, std::decay_t<Function>>>
+  {
+    auto next = chain(scheduler, std::forward<Function>(function));
+    next.m_state->scheduler = &scheduler;
+    return next;
+  }
+
+  /**
+   * \brief Attaches a continuation, which is executed on the main thread once the result
+   * is available.
+   *
+   * \details The continuation is invoked with the result, or without arguments if the
+   * result is `void`, by the next call to `main_thread_queue::drain()` after the result
+   * is available. The future is invalid after this call.
+   *
+   * \pre The future must be valid.
+   *
+   * \tparam Function the type of the continuation.
+   *
+   * \param queue the queue drained by the main thread.
+   * \param function the continuation.
+   *
+   * \return a future that provides the result of the continuation.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  auto then(main_thread_queue& queue, Function&& function)
+      -> future<detail::continuation_result_t<T, std::decay_t<Function>>>
+  {
+    return chain(queue, std::forward<Function>(function));
+  }
+
+  /**
+   * \brief Indicates whether the result is available.
+   *
+   * \pre The future must be valid.
+   *
+   * \return `true` if the result is available, or the promise was broken or failed with
+   * an exception; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto ready() const noexcept -> bool
+  {
+    assert(valid());
+    return m_state->finished();
+  }
+
+  /**
+   * \brief Indicates whether the future is associated with a result.
+   *
+   * \return `true` if the future is valid; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto valid() const noexcept -> bool
+  {
+    return m_state != nullptr;
+  }
+
+ private:
+  template <typename U>
+  friend class future;
+
+  template <typename U>
+  friend class promise;
+
+  template <typename Function>
+  friend auto async(task_scheduler& scheduler, Function&& function)
+      -> future<std::invoke_result_t<std::decay_t<Function>&>>;
+
+  detail::future_state<T>* m_state{};
+
+  explicit future(detail::future_state<T>* state) noexcept : m_state{state}
+  {}
+
+  void reset() noexcept
+  {
+    if (m_state) {
+      std::exchange(m_state, nullptr)->release();
+    }
+  }
+
+  template <typename Executor, typename Function>
+  auto chain(Executor& executor, Function&& function)
+      -> future<detail::continuation_result_t<T, std::decay_t<Function>>>
+  {
+    assert(valid());
+
+    using function_type = std::decay_t<Function>;
+    using result_type = detail::continuation_result_t<T, function_type>;
+    using state_type = detail::continuation_state<result_type, T, function_type, Executor>;
+
+    // The continuation takes over the reference of this future
+    auto* state = new state_type{std::exchange(m_state, nullptr),
+                                 function_type(std::forward<Function>(function)),
+                                 executor};
+
+    future<result_type> next{state};
+
+    state->retain();  // Owned by the scheduled task
+    state->source().chain([state] { state->schedule(); });
+
+    return next;
+  }
+};
+
+/**
+ * \class promise
+ *
+ * \brief Provides the result of a future, which is set by the producer.
+ *
+ * \details Promises are useful when results are produced by code that isn't a task, e.g.
+ * a callback of a network library or an audio thread.
+ * \code{cpp}
+ *   cen::promise<response> pending;
+ *   auto result = pending.get_future();
+ *
+ *   client.fetch(url, [p = std::move(pending)](response r) mutable {
+ *     p.set_value(std::move(r));
+ *   });
+ * \endcode
+ *
+ * \note If a promise is destroyed before its value is set, the future is broken, and
+ * `future::get()` throws an exception.
+ *
+ * \tparam T the type of the result, may be `void`.
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class promise final
+{
+ public:
+  /**
+   * \brief Creates a promise without a value.
+   *
+   * \since 6.4.0
+   */
+  promise() : m_state{new detail::future_state<T>}
+  {}
+
+  promise(const promise&) = delete;
+
+  auto operator=(const promise&) -> promise& = delete;
+
+  promise(promise&& other) noexcept
+      : m_state{std::exchange(other.m_state, nullptr)}
+      , m_retrieved{other.m_retrieved}
+  {}
+
+  auto operator=(promise&& other) noexcept -> promise&
+  {
+    if (this != &other) {
+      reset();
+      m_state = std::exchange(other.m_state, nullptr);
+      m_retrieved = other.m_retrieved;
+    }
+
+    return *this;
+  }
+
+  /**
+   * \brief Breaks the promise if its value hasn't been set.
+   *
+   * \since 6.4.0
+   */
+  ~promise() noexcept
+  {
+    reset();
+  }
+
+  /**
+   * \brief Returns the future associated with the promise.
+   *
+   * \pre This function may only be called once.
+   *
+   * \return the future that provides the value of the promise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_future() -> future<T>
+  {
+    assert(m_state);
+    assert(!m_retrieved);
+
+    m_retrieved = true;
+    m_state->retain();
+
+    return future<T>{m_state};
+  }
+
+  /**
+   * \brief Sets the value of the promise, which makes the future ready.
+   *
+   * \pre The value may only be set once.
+   *
+   * \tparam Args the types of the arguments forwarded to the constructor of the value.
+   *
+   * \param args the arguments that will be forwarded to the constructor of the value,
+   * nothing if the result is `void`.
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  void set_value(Args&&... args)
+  {
+    assert(m_state);
+    assert(!m_state->finished());
+    m_state->fulfil(std::forward<Args>(args)...);
+  }
+
+  /**
+   * \brief Stores an exception in the promise, which makes the future ready.
+   *
+   * \details The exception is rethrown by `future::get()`, and forwarded to the futures
+   * of attached continuations, which aren't invoked.
+   *
+   * \pre The value may only be set once.
+   *
+   * \param error the exception, e.g. from `std::current_exception()`.
+   *
+   * \since 6.4.0
+   */
+  void set_exception(std::exception_ptr error)
+  {
+    assert(m_state);
+    assert(!m_state->finished());
+    m_state->fail(std::move(error));
+  }
+
+ private:
+  detail::future_state<T>* m_state{};
+  bool m_retrieved{};
+
+  void reset() noexcept
+  {
+    if (m_state) {
+      if (!m_state->finished()) {
+        m_state->abandon();
+      }
+
+      std::exchange(m_state, nullptr)->release();
+    }
+  }
+};
+
+/**
+ * \brief Executes a function as a task, and provides its result through a future.
+ *
+ * \details This is the task scheduler equivalent of `std::async`. The function and the
+ * shared state of the future are stored in a single allocation.
+ * \code{cpp}
+ *   auto texture = cen::async(scheduler, [path] { return cen::surface{path}; });
+ *   // ...
+ *   renderer.make_texture(texture.get());
+ * \endcode
+ *
+ * \tparam Function the type of the function object.
+ *
+ * \param scheduler the scheduler that will execute the function.
+ * \param function the function that will be executed, which must not throw exceptions.
+ *
+ * \return a future that provides the result of the function.
+ *
+ * \since 6.4.0
+ */
+template <typename Function>
+auto async(task_scheduler& scheduler, Function&& function)
+    -> future<std::invoke_result_t<std::decay_t<Function>&>>
+{
+  using function_type = std::decay_t<Function>;
+  using result_type = std::invoke_result_t<function_type&>;
+  using state_type = detail::async_state<result_type, function_type>;
+
+  auto* state = new state_type{function_type(std::forward<Function>(function))};
+  state->scheduler = &scheduler;
+
+  future<result_type> result{state};
+
+  state->retain();  // Owned by the submitted task
+  scheduler.submit([state] {
+    state->run();
+    state->release();
+  });
+
+  return result;
+}
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_FUTURE_HEADER
@@ -0,0 +1,230 @@
+#ifndef CENTURION_MAIN_THREAD_QUEUE_HEADER
+#define CENTURION_MAIN_THREAD_QUEUE_HEADER
+
+#include <atomic>      // atomic, memory_order
+#include <functional>  // function
+#include <memory>      // unique_ptr
+#include <utility>     // move, exchange
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../system/counter.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class main_thread_queue
+ *
+ * \brief A queue of tasks that are executed by the main thread.
+ *
+ * \details Worker threads submit tasks that must run on the main thread, e.g. uploading a
+ * loaded texture or updating the game state, and the main thread executes them in the
+ * order they were submitted when it drains the queue. A queue can be attached to an event
+ * dispatcher, which drains it whenever events are polled.
+ * \code{cpp}
+ *   cen::main_thread_queue tasks;
+ *   dispatcher.attach(tasks);
+ *
+ *   cen::async(scheduler, [] { return load_level("forest"); })
+ *       .then(tasks, [&](level data) { world.replace(std::move(data)); });
+ * \endcode
+ *
+ * \details Submitting a task never takes a lock, since tasks are pushed onto a lock-free
+ * list, which the main thread takes in its entirety when it executes the tasks. Workers can
+ * therefore hand over e.g. decoded images for uploading without waiting for the main
+ * thread, and the main thread can limit the time spent on the tasks with a budget, which
+ * leaves the remaining tasks for the next frame.
+ *
+ * \see `event_dispatcher::attach()`
+ * \see `future::then()`
+ *
+ * \since 6.4.0
+ */
+class main_thread_queue final
+{
+ public:
+  using task_type = std::function<void()>;
+  using budget_type = microseconds<u32>;
+
+  main_thread_queue() = default;
+
+  main_thread_queue(const main_thread_queue&) = delete;
+
+  auto operator=(const main_thread_queue&) -> main_thread_queue& = delete;
+
+  /**
+   * \brief Destroys the tasks that haven't been executed.
+   *
+   * \since 6.4.0
+   */
+  ~main_thread_queue() noexcept
+  {
+    take_submitted();
+
+    while (m_head) {
+      delete std::exchange(m_head, m_head->next);
+    }
+  }
+
+  /**
+   * \brief Submits a task, which is executed by a later call to `run_pending()`.
+   *
+   * \note This function may be called from any thread.
+   *
+   * \param task the task that will be executed.
+   *
+   * \since 6.4.0
+   */
+  void submit(task_type task)
+  {
+    auto* entry = new node{std::move(task), m_submitted.load(std::memory_order_relaxed)};
+    m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    while (!m_submitted.compare_exchange_weak(entry->next,
+                                              entry,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+    }
+  }
+
+  /**
+   * \brief Executes submitted tasks on the calling thread, in the order they were
+   * submitted.
+   *
+   * \details Tasks are executed until the budget is exhausted, and at least one task is
+   * executed per call, if there are any. Tasks submitted by the executed tasks are left for
+   * the next call.
+   *
+   * \param budget the maximum amount of time spent executing tasks, zero means no limit.
+   *
+   * \return the number of tasks that were executed.
+   *
+   * \since 6.4.0
+   */
+  auto run_pending(const budget_type budget = budget_type::zero()) -> usize
+  {
+    take_submitted();
+
+    const auto start = counter::now();
+    const auto limit = static_cast<u64>(budget.count()) * counter::frequency() / 1'000'000;
+
+    usize count = 0;
+    while (m_head) {
+      std::unique_ptr<node> entry{std::exchange(m_head, m_head->next)};
+      if (!m_head) {
+        m_tail = nullptr;
+      }
+
+      m_pending.fetch_sub(1, std::memory_order_relaxed);
+      entry->task();
+      ++count;
+
+      if (budget != budget_type::zero() && counter::now() - start >= limit) {
+        break;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Executes all submitted tasks on the calling thread.
+   *
+   * \details Tasks submitted by the executed tasks are left for the next call.
+   *
+   * \return the number of tasks that were executed.
+   *
+   * \since 6.4.0
+   */
+  auto drain() -> usize
+  {
+    return run_pending();
+  }
+
+  /**
+   * \brief Sets the budget used when the queue is drained by an event dispatcher.
+   *
+   * \param budget the maximum amount of time spent executing tasks per poll, zero means
+   * no limit.
+   *
+   * \see `event_dispatcher::attach()`
+   *
+   * \since 6.4.0
+   */
+  void set_budget(const budget_type budget) noexcept
+  {
+    m_budget = budget;
+  }
+
+  /**
+   * \brief Returns the budget used when the queue is drained by an event dispatcher.
+   *
+   * \return the maximum amount of time spent executing tasks per poll, zero means no
+   * limit.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto budget() const noexcept -> budget_type
+  {
+    return m_budget;
+  }
+
+  /**
+   * \brief Returns the amount of tasks waiting to be executed.
+   *
+   * \return the approximate number of submitted tasks that haven't been executed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> usize
+  {
+    return m_pending.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct node final
+  {
+    task_type task;
+    node* next{};
+  };
+
+  std::atomic<node*> m_submitted{};  ///< Most recently submitted task first.
+  std::atomic<usize> m_pending{};
+  node* m_head{};  ///< Taken tasks, which are only accessed by the main thread.
+  node* m_tail{};
+  budget_type m_budget{};
+
+  // Appends the submitted tasks to the taken tasks, restoring the submission order
+  void take_submitted() noexcept
+  {
+    auto* entry = m_submitted.exchange(nullptr, std::memory_order_acquire);
+    if (!entry) {
+      return;
+    }
+
+    node* first{};
+    auto* last = entry;
+
+    while (entry) {
+      first = std::exchange(entry, std::exchange(entry->next, first));
+    }
+
+    if (m_tail) {
+      m_tail->next = first;
+    }
+    else {
+      m_head = first;
+    }
+
+    m_tail = last;
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_MAIN_THREAD_QUEUE_HEADER
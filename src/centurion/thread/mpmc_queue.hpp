@@ -0,0 +1,245 @@
+#ifndef CENTURION_MPMC_QUEUE_HEADER
+#define CENTURION_MPMC_QUEUE_HEADER
+
+#include <atomic>    // atomic, memory_order
+#include <cstddef>   // ptrdiff_t
+#include <memory>    // unique_ptr, make_unique
+#include <new>       // placement new
+#include <optional>  // optional, nullopt
+#include <utility>   // move, forward
+
+#include "../core/integers.hpp"
+#include "../detail/concurrent_utils.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class mpmc_queue
+ *
+ * \brief A bounded lock-free queue for any number of producers and consumers.
+ *
+ * \details The queue is a ring buffer where every slot has a sequence number, which tells
+ * whether the slot is free to be written or ready to be read in the current lap around
+ * the buffer. Producers and consumers claim slots by advancing the tail and head indices,
+ * which are kept on separate cache lines, so a push or pop costs a single successful
+ * compare-and-swap when there is no contention.
+ * \code{cpp}
+ *   cen::mpmc_queue<job> jobs{1'024};
+ *
+ *   // Any producer thread
+ *   if (!jobs.try_push(std::move(work))) {
+ *     // The queue is full
+ *   }
+ *
+ *   // Any consumer thread
+ *   if (auto work = jobs.try_pop()) {
+ *     work->run();
+ *   }
+ * \endcode
+ *
+ * \note Use `blocking_queue` to wait for elements or free slots.
+ *
+ * \tparam T the type of the elements, which must be move constructible.
+ *
+ * \see `spsc_queue`
+ * \see `blocking_queue`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class mpmc_queue final
+{
+ public:
+  using value_type = T;
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty queue.
+   *
+   * \param capacity the minimum number of elements the queue can hold, which is rounded
+   * up to a power of two.
+   *
+   * \since 6.4.0
+   */
+  explicit mpmc_queue(const size_type capacity)
+      : m_slots{std::make_unique<slot[]>(detail::ring_capacity(capacity))}
+      , m_mask{detail::ring_capacity(capacity) - 1}
+  {
+    for (size_type index = 0; index <= m_mask; ++index) {
+      m_slots[index].sequence.store(index, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue&) = delete;
+
+  auto operator=(const mpmc_queue&) -> mpmc_queue& = delete;
+
+  /**
+   * \brief Destroys the elements that are still in the queue.
+   *
+   * \since 6.4.0
+   */
+  ~mpmc_queue() noexcept
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    for (auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head) {
+      m_slots[head & m_mask].storage.get()->~T();
+    }
+  }
+
+  /**
+   * \brief Constructs an element at the back of the queue, unless the queue is full.
+   *
+   * \param args the arguments forwarded to the constructor of the element.
+   *
+   * \return `true` if the element was added; `false` if the queue is full.
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  [[nodiscard]] auto try_emplace(Args&&... args) -> bool
+  {
+    auto tail = m_tail.load(std::memory_order_relaxed);
+
+    while (true) {
+      auto& entry = m_slots[tail & m_mask];
+      const auto sequence = entry.sequence.load(std::memory_order_acquire);
+      const auto lag = static_cast<std::ptrdiff_t>(sequence - tail);
+
+      if (lag == 0) {
+        // The slot is free in this lap, so try to claim it
+        if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+          new (entry.storage.data) T(std::forward<Args>(args)...);
+          entry.sequence.store(tail + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (lag < 0) {
+        return false;  // The slot still holds an element from the previous lap
+      }
+      else {
+        tail = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * \brief Adds a copy of an element to the back of the queue, unless the queue is full.
+   *
+   * \param value the element that will be added.
+   *
+   * \return `true` if the element was added; `false` if the queue is full.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_push(const T& value) -> bool
+  {
+    return try_emplace(value);
+  }
+
+  /// \copydoc try_push(const T&)
+  [[nodiscard]] auto try_push(T&& value) -> bool
+  {
+    return try_emplace(std::move(value));
+  }
+
+  /**
+   * \brief Removes the element at the front of the queue, unless the queue is empty.
+   *
+   * \return the removed element; an empty optional if the queue is empty.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_pop() -> std::optional<T>
+  {
+    auto head = m_head.load(std::memory_order_relaxed);
+
+    while (true) {
+      auto& entry = m_slots[head & m_mask];
+      const auto sequence = entry.sequence.load(std::memory_order_acquire);
+      const auto lag = static_cast<std::ptrdiff_t>(sequence - (head + 1));
+
+      if (lag == 0) {
+        if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+          auto* element = entry.storage.get();
+
+          std::optional<T> value{std::move(*element)};
+          element->~T();
+
+          // Frees the slot for the next lap
+          entry.sequence.store(head + m_mask + 1, std::memory_order_release);
+          return value;
+        }
+      }
+      else if (lag < 0) {
+        return std::nullopt;  // The slot hasn't been written in this lap yet
+      }
+      else {
+        head = m_head.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * \brief Returns the number of elements in the queue.
+   *
+   * \note The returned value might be outdated by the time it's used, if other threads
+   * are modifying the queue.
+   *
+   * \return the approximate number of elements.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  /**
+   * \brief Indicates whether the queue is empty.
+   *
+   * \return `true` if the queue appeared to be empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return size() == 0;
+  }
+
+  /**
+   * \brief Returns the maximum number of elements in the queue.
+   *
+   * \return the capacity, which is a power of two.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_mask + 1;
+  }
+
+ private:
+  struct slot final
+  {
+    std::atomic<size_type> sequence{};
+    detail::ring_storage<T> storage;
+  };
+
+  std::unique_ptr<slot[]> m_slots;
+  size_type m_mask{};
+
+  alignas(detail::cache_line) std::atomic<size_type> m_head{};
+  alignas(detail::cache_line) std::atomic<size_type> m_tail{};
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_MPMC_QUEUE_HEADER
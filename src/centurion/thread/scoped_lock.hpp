@@ -34,13 +34,39 @@ class scoped_lock final
    *
    * \since 5.0.0
    */
-  CENTURION_NODISCARD_CTOR explicit scoped_lock(mutex& mutex) : m_mutex{&mutex}
+  CENTURION_NODISCARD_CTOR explicit scoped_lock(mutex& mutex)
+      : m_mutex{&mutex}
+      , m_unlock{&unlock<cen::mutex>}
   {
     if (!mutex.lock()) {
       throw sdl_error{};
     }
   }
 
+  /**
+   * \brief Attempts to exclusively lock the supplied mutex.
+   *
+   * \details This constructor accepts other mutex types with the same interface as
+   * `mutex`, such as `adaptive_mutex` and `shared_mutex`.
+   *
+   * \tparam Mutex the type of the mutex.
+   *
+   * \param mutex the mutex that will be locked.
+   *
+   * \throws cen_error if the mutex can't be locked.
+   *
+   * \since 6.4.0
+   */
+  template <typename Mutex>
+  CENTURION_NODISCARD_CTOR explicit scoped_lock(Mutex& mutex)
+      : m_mutex{&mutex}
+      , m_unlock{&unlock<Mutex>}
+  {
+    if (!mutex.lock()) {
+      throw cen_error{"Failed to lock mutex!"};
+    }
+  }
+
   scoped_lock(const scoped_lock&) = delete;
 
   auto operator=(const scoped_lock&) -> scoped_lock& = delete;
@@ -52,11 +78,18 @@ class scoped_lock final
    */
   ~scoped_lock() noexcept
   {
-    m_mutex->unlock();
+    m_unlock(m_mutex);
   }
 
  private:
-  mutex* m_mutex{};
+  void* m_mutex{};
+  void (*m_unlock)(void*) noexcept {};
+
+  template <typename Mutex>
+  static void unlock(void* mutex) noexcept
+  {
+    static_cast<Mutex*>(mutex)->unlock();
+  }
 };
 
 /// \} End of group thread
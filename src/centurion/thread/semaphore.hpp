@@ -3,12 +3,14 @@
 
 #include <SDL2/SDL.h>
 
+#include <chrono>  // duration
 #include <memory>  // unique_ptr
 
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../core/result.hpp"
 #include "../core/time.hpp"
+#include "deadline.hpp"
 #include "lock_status.hpp"
 
 namespace cen {
@@ -71,6 +73,47 @@ class semaphore final
     return static_cast<lock_status>(SDL_SemWaitTimeout(m_semaphore.get(), ms.count()));
   }
 
+  /**
+   * \brief Attempts to acquire a token, waits until a deadline if there are no tokens.
+   *
+   * \details Unlike the overload that accepts milliseconds, this function wakes up within
+   * microseconds of the deadline. The final stretch of the wait is spent yielding.
+   *
+   * \param until the deadline of the wait.
+   *
+   * \return `success` if a token was acquired; `timed_out` if the deadline expired.
+   *
+   * \see `deadline`
+   *
+   * \since 6.4.0
+   */
+  auto acquire(const deadline& until) noexcept -> lock_status
+  {
+    return detail::wait_for_deadline(
+        until,
+        [this] { return try_acquire(); },
+        [this](const milliseconds<u32> ms) { return acquire(ms); });
+  }
+
+  /**
+   * \brief Attempts to acquire a token, waits for at most a high-resolution duration if
+   * there are no tokens.
+   *
+   * \tparam Rep the representation of the duration.
+   * \tparam Period the period of the duration.
+   *
+   * \param timeout the maximum amount of time to wait, e.g. in microseconds.
+   *
+   * \return `success` if a token was acquired; `timed_out` if the timeout expired.
+   *
+   * \since 6.4.0
+   */
+  template <typename Rep, typename Period>
+  auto acquire(const std::chrono::duration<Rep, Period>& timeout) noexcept -> lock_status
+  {
+    return acquire(deadline::after(timeout));
+  }
+
   /**
    * \brief Attempts to acquire a token from the semaphore.
    *
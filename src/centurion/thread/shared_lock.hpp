@@ -0,0 +1,67 @@
+#ifndef CENTURION_SHARED_LOCK_HEADER
+#define CENTURION_SHARED_LOCK_HEADER
+
+#include "../compiler/features.hpp"
+#include "../core/exception.hpp"
+#include "shared_mutex.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class shared_lock
+ *
+ * \brief An RAII-style read lock that locks a shared mutex upon construction and releases
+ * it upon destruction.
+ *
+ * \details Use `scoped_lock` to lock a shared mutex for writing.
+ *
+ * \see `shared_mutex`
+ * \see `scoped_lock`
+ *
+ * \since 6.4.0
+ */
+class shared_lock final
+{
+ public:
+  /**
+   * \brief Attempts to lock the supplied mutex for reading.
+   *
+   * \param mutex the mutex that will be locked for reading.
+   *
+   * \throws cen_error if the mutex cannot be locked.
+   *
+   * \since 6.4.0
+   */
+  CENTURION_NODISCARD_CTOR explicit shared_lock(shared_mutex& mutex) : m_mutex{&mutex}
+  {
+    if (!mutex.lock_shared()) {
+      throw cen_error{"Failed to lock shared mutex!"};
+    }
+  }
+
+  shared_lock(const shared_lock&) = delete;
+
+  auto operator=(const shared_lock&) -> shared_lock& = delete;
+
+  /**
+   * \brief Releases the read lock.
+   *
+   * \since 6.4.0
+   */
+  ~shared_lock() noexcept
+  {
+    m_mutex->unlock_shared();
+  }
+
+ private:
+  shared_mutex* m_mutex{};
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_SHARED_LOCK_HEADER
@@ -0,0 +1,271 @@
+#ifndef CENTURION_SHARED_MUTEX_HEADER
+#define CENTURION_SHARED_MUTEX_HEADER
+
+#include <atomic>  // atomic, memory_order
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/spin_backoff.hpp"
+#include "condition.hpp"
+#include "lock_status.hpp"
+#include "mutex.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class shared_mutex
+ *
+ * \brief A reader-writer lock that spins for a short while before blocking.
+ *
+ * \details A shared mutex can either be locked exclusively by a single writer, or be shared
+ * by any number of readers, which suits read-mostly data such as caches. Like
+ * `adaptive_mutex`, both kinds of locks are acquired with a single atomic operation when
+ * available, and spin with an exponential backoff before the thread is parked.
+ *
+ * \details Writers take precedence over readers, so that a steady stream of readers cannot
+ * starve a writer. Once a writer is waiting, new readers wait until it has finished.
+ * \code{cpp}
+ *   cen::shared_mutex mutex;
+ *
+ *   {  // Any number of threads can read at the same time
+ *     cen::shared_lock lock{mutex};
+ *     const auto iter = cache.find(key);
+ *   }
+ *
+ *   {  // Writing requires exclusive access
+ *     cen::scoped_lock lock{mutex};
+ *     cache.insert_or_assign(key, value);
+ *   }
+ * \endcode
+ *
+ * \note Shared mutexes are not recursive, and a reader cannot upgrade its lock.
+ *
+ * \see `adaptive_mutex`
+ * \see `shared_lock`
+ *
+ * \since 6.4.0
+ */
+class shared_mutex final
+{
+ public:
+  /**
+   * \brief Creates an unlocked shared mutex.
+   *
+   * \throws sdl_error if the underlying mutex or condition variable cannot be created.
+   *
+   * \since 6.4.0
+   */
+  shared_mutex() = default;
+
+  shared_mutex(const shared_mutex&) = delete;
+
+  auto operator=(const shared_mutex&) -> shared_mutex& = delete;
+
+  /// \name Exclusive locking
+  /// \{
+
+  /**
+   * \brief Locks the mutex exclusively, blocks if there are other readers or writers.
+   *
+   * \return `success` if the mutex was successfully locked; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto lock() noexcept -> result
+  {
+    if (acquire_exclusive()) {
+      return success;
+    }
+
+    detail::spin_backoff backoff;
+    while (backoff.pause()) {
+      if (acquire_exclusive()) {
+        return success;
+      }
+    }
+
+    if (!m_parking.lock()) {
+      return failure;
+    }
+
+    m_parked.fetch_add(1);
+
+    auto state = m_state.load();
+    while (true) {
+      if ((state & ~writer_waiting) == 0) {
+        // Claims the mutex, which also clears the waiting writer
+        if (m_state.compare_exchange_weak(state, writer)) {
+          break;
+        }
+      }
+      else if ((state & writer_waiting) == 0) {
+        // Prevents new readers from locking the mutex
+        m_state.compare_exchange_weak(state, state | writer_waiting);
+      }
+      else {
+        m_wake.wait(m_parking);
+        state = m_state.load();
+      }
+    }
+
+    m_parked.fetch_sub(1);
+    m_parking.unlock();
+
+    return success;
+  }
+
+  /**
+   * \brief Attempts to lock the mutex exclusively, returns if the mutex isn't available.
+   *
+   * \return `lock_status::success` if the mutex was locked; `lock_status::timed_out` if
+   * the mutex was already locked by a reader or writer.
+   *
+   * \since 6.4.0
+   */
+  auto try_lock() noexcept -> lock_status
+  {
+    return acquire_exclusive() ? lock_status::success : lock_status::timed_out;
+  }
+
+  /**
+   * \brief Releases an exclusive lock.
+   *
+   * \return `success` if the mutex was successfully unlocked; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto unlock() noexcept -> result
+  {
+    // Other writers might have announced themselves while the mutex was locked
+    m_state.fetch_sub(writer);
+    return wake_parked();
+  }
+
+  /// \} End of exclusive locking
+
+  /// \name Shared locking
+  /// \{
+
+  /**
+   * \brief Locks the mutex for reading, blocks if a writer holds or waits for the mutex.
+   *
+   * \return `success` if the mutex was successfully locked; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto lock_shared() noexcept -> result
+  {
+    if (acquire_shared()) {
+      return success;
+    }
+
+    detail::spin_backoff backoff;
+    while (backoff.pause()) {
+      if (acquire_shared()) {
+        return success;
+      }
+    }
+
+    if (!m_parking.lock()) {
+      return failure;
+    }
+
+    m_parked.fetch_add(1);
+
+    while (!acquire_shared()) {
+      m_wake.wait(m_parking);
+    }
+
+    m_parked.fetch_sub(1);
+    m_parking.unlock();
+
+    return success;
+  }
+
+  /**
+   * \brief Attempts to lock the mutex for reading, returns if the mutex isn't available.
+   *
+   * \return `lock_status::success` if the mutex was locked; `lock_status::timed_out` if
+   * a writer holds or waits for the mutex.
+   *
+   * \since 6.4.0
+   */
+  auto try_lock_shared() noexcept -> lock_status
+  {
+    return acquire_shared() ? lock_status::success : lock_status::timed_out;
+  }
+
+  /**
+   * \brief Releases a shared lock.
+   *
+   * \return `success` if the mutex was successfully unlocked; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto unlock_shared() noexcept -> result
+  {
+    // Only the last reader can unblock a writer
+    if ((m_state.fetch_sub(1) & reader_mask) == 1) {
+      return wake_parked();
+    }
+
+    return success;
+  }
+
+  /// \} End of shared locking
+
+ private:
+  inline constexpr static u32 writer = 1u << 31;
+  inline constexpr static u32 writer_waiting = 1u << 30;
+  inline constexpr static u32 reader_mask = writer_waiting - 1;
+
+  // The state and parked counter are sequentially consistent, so that a thread that is
+  // about to park either sees the released state or is seen by the releasing thread
+  std::atomic<u32> m_state{};
+  std::atomic<u32> m_parked{};
+  mutex m_parking;
+  condition m_wake;
+
+  [[nodiscard]] auto acquire_exclusive() noexcept -> bool
+  {
+    auto state = m_state.load(std::memory_order_relaxed);
+    return (state & ~writer_waiting) == 0 && m_state.compare_exchange_strong(state, writer);
+  }
+
+  [[nodiscard]] auto acquire_shared() noexcept -> bool
+  {
+    auto state = m_state.load(std::memory_order_relaxed);
+    while ((state & (writer | writer_waiting)) == 0) {
+      if (m_state.compare_exchange_weak(state, state + 1)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  auto wake_parked() noexcept -> result
+  {
+    if (m_parked.load() == 0) {
+      return success;
+    }
+
+    if (!m_parking.lock()) {
+      return failure;
+    }
+
+    m_wake.broadcast();
+    m_parking.unlock();
+
+    return success;
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_SHARED_MUTEX_HEADER
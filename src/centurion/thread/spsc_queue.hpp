@@ -0,0 +1,224 @@
+#ifndef CENTURION_SPSC_QUEUE_HEADER
+#define CENTURION_SPSC_QUEUE_HEADER
+
+#include <atomic>    // atomic, memory_order
+#include <memory>    // unique_ptr, make_unique
+#include <new>       // placement new
+#include <optional>  // optional, nullopt
+#include <utility>   // move, forward
+
+#include "../core/integers.hpp"
+#include "../detail/concurrent_utils.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class spsc_queue
+ *
+ * \brief A bounded lock-free queue for a single producer and a single consumer.
+ *
+ * \details The queue is a ring buffer, where the producer only writes the tail index and
+ * the consumer only writes the head index. The indices are kept on separate cache lines,
+ * and each side caches the last seen index of the other side, so that pushes and pops
+ * usually don't touch memory written by the other thread, except for the element itself.
+ * \code{cpp}
+ *   cen::spsc_queue<command> commands{256};
+ *
+ *   // Producer thread
+ *   if (!commands.try_push(cmd)) {
+ *     // The queue is full
+ *   }
+ *
+ *   // Consumer thread
+ *   while (auto cmd = commands.try_pop()) {
+ *     execute(*cmd);
+ *   }
+ * \endcode
+ *
+ * \note Only one thread may push and only one thread may pop at a time. Use `mpmc_queue`
+ * if there are more producers or consumers.
+ *
+ * \tparam T the type of the elements, which must be move constructible.
+ *
+ * \see `mpmc_queue`
+ * \see `blocking_queue`
+ *
+ * \since 6.4.0
+ */
+template <typename T>
+class spsc_queue final
+{
+ public:
+  using value_type = T;
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty queue.
+   *
+   * \param capacity the minimum number of elements the queue can hold, which is rounded
+   * up to a power of two.
+   *
+   * \since 6.4.0
+   */
+  explicit spsc_queue(const size_type capacity)
+      : m_slots{std::make_unique<detail::ring_storage<T>[]>(detail::ring_capacity(capacity))}
+      , m_mask{detail::ring_capacity(capacity) - 1}
+  {}
+
+  spsc_queue(const spsc_queue&) = delete;
+
+  auto operator=(const spsc_queue&) -> spsc_queue& = delete;
+
+  /**
+   * \brief Destroys the elements that are still in the queue.
+   *
+   * \since 6.4.0
+   */
+  ~spsc_queue() noexcept
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    for (auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head) {
+      m_slots[head & m_mask].get()->~T();
+    }
+  }
+
+  /**
+   * \brief Constructs an element at the back of the queue, unless the queue is full.
+   *
+   * \note This function may only be called by the producer thread.
+   *
+   * \param args the arguments forwarded to the constructor of the element.
+   *
+   * \return `true` if the element was added; `false` if the queue is full.
+   *
+   * \since 6.4.0
+   */
+  template <typename... Args>
+  [[nodiscard]] auto try_emplace(Args&&... args) -> bool
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_cachedHead > m_mask) {
+      m_cachedHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_cachedHead > m_mask) {
+        return false;
+      }
+    }
+
+    new (m_slots[tail & m_mask].data) T(std::forward<Args>(args)...);
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /**
+   * \brief Adds a copy of an element to the back of the queue, unless the queue is full.
+   *
+   * \note This function may only be called by the producer thread.
+   *
+   * \param value the element that will be added.
+   *
+   * \return `true` if the element was added; `false` if the queue is full.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_push(const T& value) -> bool
+  {
+    return try_emplace(value);
+  }
+
+  /// \copydoc try_push(const T&)
+  [[nodiscard]] auto try_push(T&& value) -> bool
+  {
+    return try_emplace(std::move(value));
+  }
+
+  /**
+   * \brief Removes the element at the front of the queue, unless the queue is empty.
+   *
+   * \note This function may only be called by the consumer thread.
+   *
+   * \return the removed element; an empty optional if the queue is empty.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_pop() -> std::optional<T>
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_cachedTail) {
+      m_cachedTail = m_tail.load(std::memory_order_acquire);
+      if (head == m_cachedTail) {
+        return std::nullopt;
+      }
+    }
+
+    auto* element = m_slots[head & m_mask].get();
+
+    std::optional<T> value{std::move(*element)};
+    element->~T();
+
+    m_head.store(head + 1, std::memory_order_release);
+    return value;
+  }
+
+  /**
+   * \brief Returns the number of elements in the queue.
+   *
+   * \note The returned value might be outdated by the time it's used, if the other thread
+   * is modifying the queue.
+   *
+   * \return the approximate number of elements.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  /**
+   * \brief Indicates whether the queue is empty.
+   *
+   * \return `true` if the queue appeared to be empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return size() == 0;
+  }
+
+  /**
+   * \brief Returns the maximum number of elements in the queue.
+   *
+   * \return the capacity, which is a power of two.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_mask + 1;
+  }
+
+ private:
+  std::unique_ptr<detail::ring_storage<T>[]> m_slots;
+  size_type m_mask{};
+
+  alignas(detail::cache_line) std::atomic<size_type> m_head{};  // Written by the consumer
+  size_type m_cachedTail{};
+
+  alignas(detail::cache_line) std::atomic<size_type> m_tail{};  // Written by the producer
+  size_type m_cachedHead{};
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_SPSC_QUEUE_HEADER
@@ -0,0 +1,525 @@
+#ifndef CENTURION_TASK_SCHEDULER_HEADER
+#define CENTURION_TASK_SCHEDULER_HEADER
+
+#include <atomic>      // atomic
+#include <cassert>     // assert
+#include <deque>       // deque
+#include <functional>  // function
+#include <memory>      // unique_ptr, make_unique
+#include <optional>    // optional, nullopt
+#include <string>      // string, to_string
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../system/cpu.hpp"
+#include "condition.hpp"
+#include "mutex.hpp"
+#include "scoped_lock.hpp"
+#include "thread.hpp"
+#include "thread_registry.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+class task_scheduler;
+
+/**
+ * \class task_group
+ *
+ * \brief Tracks the completion of a set of tasks submitted to a task scheduler.
+ *
+ * \details Tasks are added to a group with `task_scheduler::submit(task_group&, task)`,
+ * and `task_scheduler::wait(task_group&)` blocks until all of them have finished.
+ * Continuations registered with `task_scheduler::then()` are submitted once the group is
+ * done.
+ *
+ * \note A task group must outlive its tasks and continuations, i.e. wait for the group
+ * before it is destroyed.
+ *
+ * \since 6.4.0
+ */
+class task_group final
+{
+ public:
+  task_group() = default;
+
+  task_group(const task_group&) = delete;
+
+  auto operator=(const task_group&) -> task_group& = delete;
+
+  /**
+   * \brief Indicates whether or not all tasks in the group have finished.
+   *
+   * \return `true` if there are no unfinished tasks in the group; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto done() const noexcept -> bool
+  {
+    return m_pending.load() == 0;
+  }
+
+ private:
+  friend class task_scheduler;
+
+  std::atomic<usize> m_pending{};
+  std::vector<std::function<void()>> m_continuations;
+  mutex m_mutex;  ///< Guards the continuations, and the transition to zero pending tasks.
+  condition m_done;
+};
+
+/**
+ * \class task_scheduler
+ *
+ * \brief A work-stealing job system, that executes tasks on a pool of worker threads.
+ *
+ * \details Every worker has its own task deque. Tasks submitted by a worker, e.g. the
+ * subtasks of a task, are pushed to the deque of that worker, which executes them in
+ * last-in first-out order to keep their data in the cache. Idle workers steal the oldest
+ * tasks from the deques of other workers, so the load stays balanced without a shared
+ * queue becoming a bottleneck.
+ *
+ * \details Unlike `thread`, tasks can be any callable, including lambdas with captures.
+ * Threads that wait for a task group, or run a `parallel_for()`, execute tasks themselves
+ * instead of blocking, so tasks may wait for nested work without deadlocking.
+ * \code{cpp}
+ *   cen::task_scheduler scheduler;
+ *
+ *   cen::task_group group;
+ *   scheduler.submit(group, [&] { build_navigation_mesh(level); });
+ *   scheduler.submit(group, [&] { bake_lighting(level); });
+ *   scheduler.then(group, [&] { level.ready = true; });
+ *
+ *   scheduler.parallel_for(0, particles.size(), [&](cen::usize index) {
+ *     particles[index].update(dt);
+ *   });
+ * \endcode
+ *
+ * \note Tasks must not throw exceptions, and should avoid blocking on I/O for long
+ * periods of time, since that keeps a worker from executing other tasks.
+ *
+ * \since 6.4.0
+ */
+class task_scheduler final
+{
+ public:
+  using task_type = std::function<void()>;
+
+  /**
+   * \brief Creates a task scheduler and starts its worker threads.
+   *
+   * \param workers the amount of worker threads, must be greater than zero.
+   *
+   * \throws sdl_error if the worker threads cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit task_scheduler(const usize workers = default_worker_count())
+  {
+    assert(workers > 0);
+
+    m_workers.reserve(workers);
+    for (usize index = 0; index < workers; ++index) {
+      m_workers.push_back(std::make_unique<worker>(this, index));
+    }
+
+    // Workers may steal from each other, so they are all created before the threads start
+    for (auto& worker : m_workers) {
+      const auto name = "task " + std::to_string(worker->id);
+      worker->runner =
+          std::make_unique<thread>(&task_scheduler::run, name.c_str(), worker.get());
+    }
+  }
+
+  task_scheduler(const task_scheduler&) = delete;
+
+  auto operator=(const task_scheduler&) -> task_scheduler& = delete;
+
+  /**
+   * \brief Executes all submitted tasks, and stops the worker threads.
+   *
+   * \since 6.4.0
+   */
+  ~task_scheduler() noexcept
+  {
+    wait();
+
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.broadcast();
+
+    for (auto& worker : m_workers) {
+      worker->runner.reset();
+    }
+  }
+
+  /**
+   * \brief Submits a task.
+   *
+   * \details Tasks submitted from a worker thread are pushed to the deque of that worker,
+   * other tasks are distributed over the workers.
+   *
+   * \param task the task that will be executed.
+   *
+   * \since 6.4.0
+   */
+  void submit(task_type task)
+  {
+    push(job{std::move(task), nullptr});
+  }
+
+  /**
+   * \brief Submits a task that is part of a task group.
+   *
+   * \param group the group that the task is added to.
+   * \param task the task that will be executed.
+   *
+   * \since 6.4.0
+   */
+  void submit(task_group& group, task_type task)
+  {
+    group.m_pending.fetch_add(1);
+    push(job{std::move(task), &group});
+  }
+
+  /**
+   * \brief Registers a continuation that is submitted once a task group is done.
+   *
+   * \details The continuation is submitted immediately if the group has no unfinished
+   * tasks. The continuation itself is not part of the group.
+   *
+   * \param group the group that the continuation waits for.
+   * \param continuation the task that will be executed after the tasks in the group.
+   *
+   * \since 6.4.0
+   */
+  void then(task_group& group, task_type continuation)
+  {
+    {
+      scoped_lock lock{group.m_mutex};
+      if (group.m_pending.load() != 0) {
+        group.m_continuations.push_back(std::move(continuation));
+        return;
+      }
+    }
+
+    submit(std::move(continuation));
+  }
+
+  /**
+   * \brief Blocks until all tasks in a group have finished.
+   *
+   * \details The calling thread executes submitted tasks while it waits.
+   *
+   * \param group the group that will be waited for.
+   *
+   * \since 6.4.0
+   */
+  void wait(task_group& group)
+  {
+    while (!group.done()) {
+      if (auto job = find_job(current_index())) {
+        execute(*job);
+        continue;
+      }
+
+      // Other threads are executing the remaining tasks, but may submit new ones
+      scoped_lock lock{group.m_mutex};
+      if (!group.done()) {
+        group.m_done.wait(group.m_mutex, milliseconds<u32>{1});
+      }
+    }
+
+    // The last task may still hold the lock, which must be released before the group dies
+    scoped_lock lock{group.m_mutex};
+  }
+
+  /**
+   * \brief Blocks until all submitted tasks have finished.
+   *
+   * \details The calling thread executes submitted tasks while it waits.
+   *
+   * \since 6.4.0
+   */
+  void wait()
+  {
+    while (m_unfinished.load() != 0) {
+      if (auto job = find_job(current_index())) {
+        execute(*job);
+      }
+      else {
+        thread::sleep(milliseconds<u32>{0});
+      }
+    }
+  }
+
+  /**
+   * \brief Executes a single submitted task on the calling thread, if there is one.
+   *
+   * \details This function is useful for threads that wait for the result of a task,
+   * and would otherwise idle while the workers are busy.
+   *
+   * \return `true` if a task was executed; `false` if there were no queued tasks.
+   *
+   * \since 6.4.0
+   */
+  auto run_one() -> bool
+  {
+    if (auto job = find_job(current_index())) {
+      execute(*job);
+      return true;
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Invokes a function for every index in a range, using the worker threads.
+   *
+   * \details The range is split into chunks, which are executed as tasks. The calling
+   * thread executes chunks as well, and the function returns once all indices have been
+   * processed.
+   *
+   * \tparam Function the type of the function object, which is invoked with a `usize`
+   * index.
+   *
+   * \param begin the first index of the range.
+   * \param end the index past the last index of the range.
+   * \param function the function that is invoked for every index.
+   * \param grain the amount of indices in every chunk; zero splits the range into a few
+   * chunks per worker.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  void parallel_for(const usize begin, const usize end, Function function, usize grain = 0)
+  {
+    if (begin >= end) {
+      return;
+    }
+
+    const auto count = end - begin;
+    if (grain == 0) {
+      const auto chunks = m_workers.size() * 4;
+      grain = count / chunks + (count % chunks != 0 ? 1 : 0);
+    }
+
+    task_group group;
+    for (auto first = begin; first < end; first += grain) {
+      const auto last = grain < end - first ? first + grain : end;
+      submit(group, [&function, first, last] {
+        for (auto index = first; index < last; ++index) {
+          function(index);
+        }
+      });
+    }
+
+    wait(group);
+  }
+
+  /**
+   * \brief Returns the amount of worker threads.
+   *
+   * \return the number of worker threads.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto worker_count() const noexcept -> usize
+  {
+    return m_workers.size();
+  }
+
+  /**
+   * \brief Returns the amount of submitted tasks that haven't finished yet.
+   *
+   * \return the number of tasks that are queued or executing.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> usize
+  {
+    return m_unfinished.load();
+  }
+
+  /**
+   * \brief Returns the default amount of worker threads.
+   *
+   * \details One core is left for the thread that creates the scheduler, which usually
+   * renders the frames.
+   *
+   * \return the number of CPU cores minus one, but at least one.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto default_worker_count() noexcept -> usize
+  {
+    const auto cores = cpu::cores();
+    return cores > 1 ? static_cast<usize>(cores - 1) : 1;
+  }
+
+ private:
+  struct job final
+  {
+    task_type task;
+    task_group* group{};
+  };
+
+  struct worker final
+  {
+    worker(task_scheduler* owner, const usize index) noexcept : scheduler{owner}, id{index}
+    {}
+
+    task_scheduler* scheduler{};
+    usize id{};
+    mutex guard;
+    std::deque<job> jobs;  ///< The owner uses the back, thieves steal from the front.
+    std::unique_ptr<thread> runner;
+  };
+
+  inline static thread_local const task_scheduler* tls_scheduler{};
+  inline static thread_local usize tls_index{};
+
+  std::vector<std::unique_ptr<worker>> m_workers;
+  std::atomic<usize> m_queued{};      ///< The amount of tasks in the deques.
+  std::atomic<usize> m_unfinished{};  ///< The amount of queued or executing tasks.
+  std::atomic<usize> m_sleeping{};
+  std::atomic<usize> m_next{};  ///< Round-robin index for tasks from other threads.
+  mutex m_mutex;
+  condition m_wake;
+  bool m_stop{};
+
+  // Returns the index of the calling worker, or the amount of workers for other threads
+  [[nodiscard]] auto current_index() const noexcept -> usize
+  {
+    return tls_scheduler == this ? tls_index : m_workers.size();
+  }
+
+  void push(job queued)
+  {
+    auto index = current_index();
+    if (index == m_workers.size()) {
+      index = m_next.fetch_add(1) % m_workers.size();
+    }
+
+    auto& target = *m_workers[index];
+
+    m_unfinished.fetch_add(1);
+
+    {
+      scoped_lock lock{target.guard};
+      target.jobs.push_back(std::move(queued));
+    }
+
+    m_queued.fetch_add(1);
+
+    // Sleeping workers check the queued tasks after announcing that they sleep
+    if (m_sleeping.load() != 0) {
+      m_mutex.lock();
+      m_mutex.unlock();
+      m_wake.signal();
+    }
+  }
+
+  // Pops from the deque of the worker, or steals from the other workers
+  auto find_job(const usize index) -> std::optional<job>
+  {
+    if (m_queued.load() == 0) {
+      return std::nullopt;
+    }
+
+    const auto count = m_workers.size();
+    if (index < count) {
+      auto& own = *m_workers[index];
+      scoped_lock lock{own.guard};
+
+      if (!own.jobs.empty()) {
+        auto found = std::move(own.jobs.back());
+        own.jobs.pop_back();
+        m_queued.fetch_sub(1);
+        return found;
+      }
+    }
+
+    for (usize offset = 1; offset <= count; ++offset) {
+      auto& victim = *m_workers[(index + offset) % count];
+      scoped_lock lock{victim.guard};
+
+      if (!victim.jobs.empty()) {
+        auto found = std::move(victim.jobs.front());
+        victim.jobs.pop_front();
+        m_queued.fetch_sub(1);
+        return found;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  void execute(job& current)
+  {
+    current.task();
+    thread_registry::note_task();
+
+    if (auto* group = current.group) {
+      std::vector<task_type> continuations;
+
+      {
+        scoped_lock lock{group->m_mutex};
+        if (group->m_pending.fetch_sub(1) == 1) {
+          continuations.swap(group->m_continuations);
+          group->m_done.broadcast();
+        }
+      }
+
+      // The group may be destroyed once it is done, so it's not touched after this point
+      for (auto& continuation : continuations) {
+        submit(std::move(continuation));
+      }
+    }
+
+    m_unfinished.fetch_sub(1);
+  }
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<worker*>(data);
+    auto& scheduler = *self.scheduler;
+
+    tls_scheduler = &scheduler;
+    tls_index = self.id;
+
+    while (true) {
+      if (auto job = scheduler.find_job(self.id)) {
+        scheduler.execute(*job);
+        continue;
+      }
+
+      scoped_lock lock{scheduler.m_mutex};
+
+      scheduler.m_sleeping.fetch_add(1);
+      while (!scheduler.m_stop && scheduler.m_queued.load() == 0) {
+        scheduler.m_wake.wait(scheduler.m_mutex);
+      }
+      scheduler.m_sleeping.fetch_sub(1);
+
+      if (scheduler.m_stop) {
+        break;
+      }
+    }
+
+    tls_scheduler = nullptr;
+    return 0;
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_TASK_SCHEDULER_HEADER
@@ -4,9 +4,11 @@
 #include <SDL2/SDL.h>
 
 #include <cassert>      // assert
+#include <memory>       // addressof
 #include <ostream>      // ostream
 #include <string>       // string, to_string
-#include <type_traits>  // invoke_result_t, declval
+#include <type_traits>  // invoke_result_t, declval, decay_t, remove_reference_t
+#include <utility>      // forward, move
 
 #include "../compiler/features.hpp"
 
@@ -22,6 +24,7 @@
 
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
+#include "../compiler/linkage.hpp"
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../core/is_stateless_callable.hpp"
@@ -30,7 +33,22 @@
 #include "../core/str.hpp"
 #include "../core/time.hpp"
 #include "../detail/address_of.hpp"
+#include "semaphore.hpp"
+#include "thread_attributes.hpp"
 #include "thread_priority.hpp"
+#include "thread_registry.hpp"
+
+/// \cond FALSE
+
+namespace cen::detail {
+
+// Defined in detail/thread_impl.hpp, which includes the platform headers
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto set_thread_affinity(u64 mask) noexcept
+    -> bool;
+
+}  // namespace cen::detail
+
+/// \endcond
 
 namespace cen {
 
@@ -95,11 +113,47 @@ class thread final
   CENTURION_NODISCARD_CTOR explicit thread(task_type task,
                                            const not_null<str> name = "thread",
                                            void* data = nullptr)
-      : m_thread{SDL_CreateThread(task, name, data)}
+      : thread{task, thread_attributes{}, name, data}
+  {}
+
+  /**
+   * \brief Creates a thread with the specified attributes and starts executing it.
+   *
+   * \details The constructor returns once the new thread has registered itself with
+   * `thread_registry`, which lets the thread read its launch information from the stack
+   * of the constructor rather than from the heap.
+   *
+   * \param task the task that will be performed.
+   * \param attributes the stack size, priority and CPU affinity of the thread.
+   * \param name the name of the thread, cannot be null.
+   * \param data a pointer to optional user data that will be supplied to the task
+   * function object.
+   *
+   * \throws sdl_error if the thread cannot be created.
+   *
+   * \see `thread_attributes`
+   *
+   * \since 6.4.0
+   */
+  CENTURION_NODISCARD_CTOR thread(task_type task,
+                                  const thread_attributes& attributes,
+                                  const not_null<str> name = "thread",
+                                  void* data = nullptr)
   {
+    assert(name);
+
+    // The thread registers itself, and applies its priority and affinity when it starts.
+    // It reads its launch information from this stack frame, so wait until it has started.
+    launch_info info{task, data, attributes, name};
+    m_thread = SDL_CreateThreadWithStackSize(&thread::launch,
+                                             name,
+                                             attributes.stackSize,
+                                             &info);
     if (!m_thread) {
       throw sdl_error{};
     }
+
+    info.started.acquire();
   }
 
   thread(const thread&) = delete;
@@ -160,6 +214,45 @@ class thread final
     return thread{wrapper, name};
   }
 
+  /**
+   * \brief Creates a thread with the specified attributes that will execute the supplied
+   * callable.
+   *
+   * \note If you supply a lambda to this function, it must be stateless.
+   *
+   * \tparam Callable the type of the callable.
+   *
+   * \param task the callable that will be invoked when the thread starts running.
+   * \param attributes the stack size, priority and CPU affinity of the thread.
+   * \param name the name of the thread.
+   *
+   * \return the created thread.
+   *
+   * \since 6.4.0
+   */
+  template <is_stateless_callable Callable>
+  [[nodiscard]] static auto init([[maybe_unused]] Callable&& task,
+                                 const thread_attributes& attributes,
+                                 const not_null<str> name = "thread") -> thread
+  {
+    assert(name);
+
+    constexpr bool isNoexcept = noexcept(Callable{}());
+
+    const auto wrapper = [](void* /*data*/) noexcept(isNoexcept) -> int {
+      Callable callable;
+      if constexpr (std::convertible_to<std::invoke_result_t<Callable>, int>) {
+        return callable();
+      }
+      else {
+        callable();
+        return 0;
+      }
+    };
+
+    return thread{wrapper, attributes, name};
+  }
+
   /**
    * \brief Creates a thread that will execute the supplied callable.
    *
@@ -204,6 +297,82 @@ class thread final
     return thread{wrapper, name, userData};
   }
 
+  /**
+   * \brief Creates a thread with the specified attributes that will execute the supplied
+   * callable.
+   *
+   * \note If you supply a lambda to this function, it must be stateless.
+   *
+   * \tparam Callable the type of the callable.
+   *
+   * \param task the callable that will be invoked when the thread starts running.
+   * \param attributes the stack size, priority and CPU affinity of the thread.
+   * \param userData optional user data that will be supplied to the callable.
+   * \param name the name of the thread.
+   *
+   * \return the created thread.
+   *
+   * \since 6.4.0
+   */
+  template <typename T = void, is_stateless_callable<T*> Callable>
+  [[nodiscard]] static auto init([[maybe_unused]] Callable&& task,
+                                 const thread_attributes& attributes,
+                                 T* userData = nullptr,
+                                 const not_null<str> name = "thread") -> thread
+  {
+    assert(name);
+
+    constexpr bool isNoexcept = noexcept(Callable{}(std::declval<T*>()));
+
+    const auto wrapper = [](void* erased) noexcept(isNoexcept) -> int {
+      auto* ptr = static_cast<T*>(erased);
+
+      Callable callable;
+      if constexpr (std::convertible_to<std::invoke_result_t<Callable, T*>, int>) {
+        return callable(ptr);
+      }
+      else {
+        callable(ptr);
+        return 0;
+      }
+    };
+
+    return thread{wrapper, attributes, name, userData};
+  }
+
+  /**
+   * \brief Creates a thread that will execute the supplied stateful callable.
+   *
+   * \details Unlike the other `init()` overloads, this overload accepts callables with
+   * state, such as capturing lambdas. The callable is moved (or copied, if it's an lvalue)
+   * directly onto the stack of the new thread, rather than onto the heap, and this
+   * function returns once that has happened. As a result, the thread may be detached at
+   * any time.
+   * \code{cpp}
+   *   auto thread = cen::thread::init([&level, path] { level.load(path); });
+   * \endcode
+   *
+   * \tparam Callable the type of the callable.
+   *
+   * \param task the callable that will be invoked when the thread starts running.
+   * \param name the name of the thread.
+   *
+   * \return the created thread.
+   *
+   * \throws sdl_error if the thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Callable>
+    requires(!is_stateless_callable<std::decay_t<Callable>> &&
+             std::invocable<std::decay_t<Callable>&>)
+  [[nodiscard]] static auto init(Callable&& task, const not_null<str> name = "thread")
+      -> thread
+  {
+    assert(name);
+    return thread{inline_task{}, std::forward<Callable>(task), name};
+  }
+
 #endif  // CENTURION_HAS_FEATURE_CONCEPTS
 
   /// \} End of construction/destruction
@@ -237,7 +406,33 @@ class thread final
   static auto set_priority(const thread_priority priority) noexcept -> result
   {
     const auto prio = static_cast<SDL_ThreadPriority>(priority);
-    return SDL_SetThreadPriority(prio) == 0;
+    if (SDL_SetThreadPriority(prio) != 0) {
+      return failure;
+    }
+
+    thread_registry::note_priority(priority);
+    return success;
+  }
+
+  /**
+   * \brief Restricts the current thread to a set of CPUs.
+   *
+   * \note This function always fails on platforms other than Windows and Linux.
+   *
+   * \param mask a bit mask of the CPUs that the thread may run on, where the least
+   * significant bit represents the first CPU; must not be zero.
+   *
+   * \return `success` if the affinity was successfully set; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  static auto set_affinity(const u64 mask) noexcept -> result
+  {
+    if (mask == 0) {
+      return failure;
+    }
+
+    return detail::set_thread_affinity(mask);
   }
 
   /// \name Mutators
@@ -391,9 +586,95 @@ class thread final
   /// \} End of queries
 
  private:
+  struct launch_info final
+  {
+    task_type task{};
+    void* data{};
+    thread_attributes attributes;
+    str name{};
+    semaphore started{0};
+  };
+
+  struct inline_task final
+  {};
+
+  template <typename Callable>
+  struct inline_launch final
+  {
+    std::remove_reference_t<Callable>* task{};
+    str name{};
+    semaphore started{0};
+  };
+
   SDL_Thread* m_thread{};
   bool m_joined{false};
   bool m_detached{false};
+
+  template <typename Callable>
+  thread(inline_task, Callable&& task, const not_null<str> name)
+  {
+    // The new thread takes the callable from this stack frame, so wait until it has
+    inline_launch<Callable> launch{std::addressof(task), name};
+
+    m_thread = SDL_CreateThread(&thread::run_inline<Callable>, name, &launch);
+    if (!m_thread) {
+      throw sdl_error{};
+    }
+
+    launch.started.acquire();
+  }
+
+  template <typename Callable>
+  static auto run_inline(void* erased) -> int
+  {
+    using callable_type = std::decay_t<Callable>;
+
+    auto& launch = *static_cast<inline_launch<Callable>*>(erased);
+    callable_type callable{std::forward<Callable>(*launch.task)};
+
+    thread_registry::add_current(launch.name);
+
+    // The launch information may not be accessed after this point
+    launch.started.release();
+
+    int status = 0;
+    if constexpr (std::is_convertible_v<std::invoke_result_t<callable_type&>, int>) {
+      status = callable();
+    }
+    else {
+      callable();
+    }
+
+    thread_registry::remove_current();
+    return status;
+  }
+
+  static auto launch(void* erased) -> int
+  {
+    auto& info = *static_cast<launch_info*>(erased);
+
+    const auto task = info.task;
+    auto* data = info.data;
+    const auto attributes = info.attributes;
+
+    thread_registry::add_current(info.name);
+
+    // The launch information may not be accessed after this point
+    info.started.release();
+
+    if (attributes.priority) {
+      set_priority(*attributes.priority);
+    }
+
+    if (attributes.affinity != 0) {
+      set_affinity(attributes.affinity);
+    }
+
+    const auto status = task(data);
+
+    thread_registry::remove_current();
+    return status;
+  }
 };
 
 /// \name String conversions
@@ -448,4 +729,8 @@ inline auto operator<<(std::ostream& stream, const thread& thread) -> std::ostre
 
 }  // namespace cen
 
+#if CENTURION_LIB_DEFINITIONS
+#include "../detail/thread_impl.hpp"
+#endif  // CENTURION_LIB_DEFINITIONS
+
 #endif  // CENTURION_THREAD_HEADER
@@ -0,0 +1,49 @@
+#ifndef CENTURION_THREAD_ATTRIBUTES_HEADER
+#define CENTURION_THREAD_ATTRIBUTES_HEADER
+
+#include <optional>  // optional
+
+#include "../core/integers.hpp"
+#include "thread_priority.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \struct thread_attributes
+ *
+ * \brief Provides the parameters used when creating a thread.
+ *
+ * \details The default attributes create a thread just like the plain `thread`
+ * constructor. The priority and affinity are applied by the new thread itself, before the
+ * task is invoked.
+ * \code{cpp}
+ *   cen::thread_attributes attributes;
+ *   attributes.stackSize = 64 * 1'024;
+ *   attributes.priority = cen::thread_priority::high;
+ *   attributes.affinity = 0b0100;  // Only the third CPU
+ *
+ *   cen::thread mixer{&mix_audio, attributes, "mixer"};
+ * \endcode
+ *
+ * \note Failing to apply the priority or affinity is not reported, since it's not an
+ * error for the thread itself, e.g. `high` priorities might require elevated privileges.
+ *
+ * \see `thread`
+ *
+ * \since 6.4.0
+ */
+struct thread_attributes final
+{
+  usize stackSize{};                        ///< The stack size in bytes, zero means default.
+  std::optional<thread_priority> priority;  ///< The initial priority of the thread.
+  u64 affinity{};  ///< A bit mask of the CPUs the thread may run on, zero means any CPU.
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_THREAD_ATTRIBUTES_HEADER
@@ -0,0 +1,454 @@
+#ifndef CENTURION_THREAD_REGISTRY_HEADER
+#define CENTURION_THREAD_REGISTRY_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <atomic>    // atomic, memory_order
+#include <cassert>   // assert
+#include <cstdint>   // intptr_t
+#include <new>       // bad_alloc
+#include <optional>  // optional, nullopt
+#include <string>    // string
+#include <vector>    // vector
+
+#include "../compiler/linkage.hpp"
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../core/str.hpp"
+#include "../core/time.hpp"
+#include "../system/counter.hpp"
+#include "thread_priority.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \struct thread_info
+ *
+ * \brief Provides information about a registered thread.
+ *
+ * \see `thread_registry`
+ *
+ * \since 6.4.0
+ */
+struct thread_info final
+{
+  SDL_threadID id{};                        ///< The ID of the thread.
+  std::string name;                         ///< The name of the thread.
+  std::optional<thread_priority> priority;  ///< The last priority set by the thread.
+  nanoseconds<u64> cpuTime{};  ///< The CPU time used by the thread, as of the last sample.
+  double usage{};              ///< The fraction of a core used between the last two samples.
+  u64 tasks{};  ///< The amount of tasks executed by the thread, as of the last sample.
+};
+
+/// \cond FALSE
+namespace detail {
+
+// A handle to the CPU time clock of a thread, see detail/thread_registry_impl.hpp
+struct thread_clock final
+{
+  std::intptr_t handle{};
+  bool valid{};
+};
+
+// Opens the clock of the calling thread, which is invalid if CPU time isn't available
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto open_thread_clock() noexcept
+    -> thread_clock;
+
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto read_thread_clock(
+    thread_clock clock) noexcept -> nanoseconds<u64>;
+
+CENTURION_API CENTURION_LIB_INLINE void close_thread_clock(thread_clock clock) noexcept;
+
+inline constexpr usize thread_name_capacity = 64;
+
+struct thread_record;
+
+struct thread_registry_data final
+{
+  SDL_SpinLock lock{};
+  thread_record* head{};
+  thread_record* tail{};
+  usize count{};
+  std::atomic<void (*)(const thread_info&)> hook{};
+  u64 lastSample{};
+};
+
+// Constant initialized and trivially destructible, so that threads may unregister
+// themselves during shutdown
+inline thread_registry_data registry_data{};
+
+// Holds the registry lock, which must never be held while calling user code
+struct registry_guard final
+{
+  registry_guard() noexcept
+  {
+    SDL_AtomicLock(&registry_data.lock);
+  }
+
+  ~registry_guard() noexcept
+  {
+    SDL_AtomicUnlock(&registry_data.lock);
+  }
+
+  registry_guard(const registry_guard&) = delete;
+  auto operator=(const registry_guard&) -> registry_guard& = delete;
+};
+
+// Only accessed by the owning thread, or by other threads while holding the registry lock
+struct thread_record final
+{
+  thread_record* previous{};
+  thread_record* next{};
+  bool registered{};
+  SDL_threadID id{};
+  char name[thread_name_capacity]{};
+  std::optional<thread_priority> priority;
+  nanoseconds<u64> cpuTime{};
+  double usage{};
+  std::atomic<u64> tasks{};
+  thread_clock clock;
+
+  thread_record() noexcept = default;
+
+  thread_record(const thread_record&) = delete;
+  auto operator=(const thread_record&) -> thread_record& = delete;
+
+  // Threads that exit without unregistering are removed automatically
+  ~thread_record() noexcept
+  {
+    unlink();
+  }
+
+  void set_name(const str source) noexcept
+  {
+    usize length = 0;
+    while (source[length] != '\0' && length < thread_name_capacity - 1) {
+      name[length] = source[length];
+      ++length;
+    }
+
+    name[length] = '\0';
+  }
+
+  void link() noexcept
+  {
+    auto& data = registry_data;
+    registry_guard guard;
+
+    previous = data.tail;
+    next = nullptr;
+
+    if (data.tail) {
+      data.tail->next = this;
+    }
+    else {
+      data.head = this;
+    }
+
+    data.tail = this;
+    ++data.count;
+    registered = true;
+  }
+
+  void unlink() noexcept
+  {
+    if (!registered) {
+      return;
+    }
+
+    {
+      auto& data = registry_data;
+      registry_guard guard;
+
+      (previous ? previous->next : data.head) = next;
+      (next ? next->previous : data.tail) = previous;
+
+      previous = next = nullptr;
+      --data.count;
+      registered = false;
+    }
+
+    close_thread_clock(clock);
+    clock = {};
+  }
+
+  // Only invoked by the thread itself, or while the thread is registered
+  [[nodiscard]] auto cpu_time() const noexcept -> nanoseconds<u64>
+  {
+    return read_thread_clock(clock);
+  }
+
+  // Must be called while holding the registry lock
+  [[nodiscard]] auto info() const -> thread_info
+  {
+    return {id, name, priority, cpuTime, usage, tasks.load(std::memory_order_relaxed)};
+  }
+};
+
+inline thread_local thread_record tls_thread_record;
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class thread_registry
+ *
+ * \brief Keeps track of the running threads, e.g. for an in-game profiler.
+ *
+ * \details Every thread that is created through `thread`, which includes the workers of
+ * `task_scheduler`, `image_loader` and the other asynchronous utilities, registers itself
+ * with its name, ID and priority when it starts, and unregisters itself when its task
+ * returns. Other threads, such as the main thread, can be registered with
+ * `add_current()`.
+ *
+ * \details Registering a thread doesn't allocate memory and never throws. The record of
+ * each thread is stored in thread-local storage and is linked into the registry under a
+ * spin lock, which is only held for a few instructions. Threads that exit while
+ * registered are unregistered automatically.
+ *
+ * \details The CPU time of each thread is only read by `sample()`, which also computes how
+ * much of a core each thread used since the previous sample. Calling it once per frame
+ * (or a few times per second) is enough for profiler overlays.
+ * \code{cpp}
+ *   cen::thread_registry::add_current("main");
+ *
+ *   // Once per frame
+ *   cen::thread_registry::sample();
+ *   for (const auto& info : cen::thread_registry::snapshot()) {
+ *     overlay.add_row(info.name, info.usage * 100.0, info.tasks);
+ *   }
+ * \endcode
+ *
+ * \details External profilers that name threads with a function that must be called by
+ * the thread itself, such as Tracy, can be hooked up with `set_start_hook()`.
+ * \code{cpp}
+ *   cen::thread_registry::set_start_hook(
+ *       [](const cen::thread_info& info) { tracy::SetThreadName(info.name.c_str()); });
+ * \endcode
+ *
+ * \note The CPU time is only available on Windows and Linux, and is zero otherwise.
+ *
+ * \see `thread`
+ *
+ * \since 6.4.0
+ */
+class thread_registry final
+{
+ public:
+  using hook_type = void (*)(const thread_info&);
+
+  /**
+   * \brief The maximum length of a thread name, longer names are truncated.
+   *
+   * \since 6.4.0
+   */
+  inline constexpr static usize max_name_length = detail::thread_name_capacity - 1;
+
+  thread_registry() = delete;
+
+  /**
+   * \brief Registers the calling thread.
+   *
+   * \details This function has no effect if the calling thread is already registered,
+   * except for updating the name. The start hook is invoked on the calling thread, and
+   * is skipped if its information cannot be allocated.
+   *
+   * \param name the name of the thread, truncated to `max_name_length` characters.
+   *
+   * \since 6.4.0
+   */
+  static void add_current(const not_null<str> name) noexcept
+  {
+    assert(name);
+
+    auto& record = detail::tls_thread_record;
+
+    if (record.registered) {
+      detail::registry_guard guard;
+      record.set_name(name);
+      return;
+    }
+
+    record.id = SDL_ThreadID();
+    record.set_name(name);
+    record.priority.reset();
+    record.usage = 0;
+    record.tasks.store(0, std::memory_order_relaxed);
+    record.clock = detail::open_thread_clock();
+    record.cpuTime = record.cpu_time();
+    record.link();
+
+    if (const auto hook = detail::registry_data.hook.load(std::memory_order_acquire)) {
+      try {
+        const auto info = [&record] {
+          detail::registry_guard guard;
+          return record.info();
+        }();
+
+        hook(info);
+      }
+      catch (const std::bad_alloc&) {
+        // The name didn't fit in the small string buffer and couldn't be allocated
+      }
+    }
+  }
+
+  /**
+   * \brief Unregisters the calling thread.
+   *
+   * \details This function has no effect if the calling thread isn't registered.
+   *
+   * \since 6.4.0
+   */
+  static void remove_current() noexcept
+  {
+    detail::tls_thread_record.unlink();
+  }
+
+  /**
+   * \brief Reads the CPU time of all registered threads.
+   *
+   * \details The usage of each thread is the CPU time it used since the previous sample,
+   * divided by the time that elapsed since the previous sample. The first sample reports
+   * no usage.
+   *
+   * \since 6.4.0
+   */
+  static void sample() noexcept
+  {
+    auto& data = detail::registry_data;
+    detail::registry_guard guard;
+
+    const auto now = counter::now();
+    const auto elapsed = data.lastSample != 0 ? now - data.lastSample : 0;
+    const auto seconds = static_cast<double>(elapsed) /
+                         static_cast<double>(counter::frequency());
+
+    for (auto* record = data.head; record; record = record->next) {
+      const auto cpuTime = record->cpu_time();
+      const auto used = static_cast<double>((cpuTime - record->cpuTime).count()) / 1e9;
+
+      record->usage = seconds > 0 ? used / seconds : 0.0;
+      record->cpuTime = cpuTime;
+    }
+
+    data.lastSample = now;
+  }
+
+  /**
+   * \brief Returns information about all registered threads.
+   *
+   * \return a copy of the information of every registered thread, in registration order.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto snapshot() -> std::vector<thread_info>
+  {
+    std::vector<thread_info> infos;
+    infos.reserve(count());
+
+    detail::registry_guard guard;
+    for (auto* record = detail::registry_data.head; record; record = record->next) {
+      infos.push_back(record->info());
+    }
+
+    return infos;
+  }
+
+  /**
+   * \brief Returns information about a registered thread.
+   *
+   * \param id the ID of the thread.
+   *
+   * \return the information about the thread; `std::nullopt` if it isn't registered.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto find(const SDL_threadID id) -> std::optional<thread_info>
+  {
+    detail::registry_guard guard;
+
+    for (auto* record = detail::registry_data.head; record; record = record->next) {
+      if (record->id == id) {
+        return record->info();
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+   * \brief Returns the amount of registered threads.
+   *
+   * \return the number of registered threads.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto count() noexcept -> usize
+  {
+    detail::registry_guard guard;
+    return detail::registry_data.count;
+  }
+
+  /**
+   * \brief Sets the function that is invoked by every thread when it's registered.
+   *
+   * \details The hook is invoked on the registered thread, before its task is executed,
+   * which makes it suitable for profiler APIs that name the calling thread. The hook must
+   * not throw.
+   *
+   * \param hook the function that will be invoked; a null pointer removes the hook.
+   *
+   * \since 6.4.0
+   */
+  static void set_start_hook(const hook_type hook) noexcept
+  {
+    detail::registry_data.hook.store(hook, std::memory_order_release);
+  }
+
+  /**
+   * \brief Records the priority of the calling thread, if it's registered.
+   *
+   * \details This is done automatically by `thread::set_priority()`.
+   *
+   * \param priority the new priority of the thread.
+   *
+   * \since 6.4.0
+   */
+  static void note_priority(const thread_priority priority) noexcept
+  {
+    auto& record = detail::tls_thread_record;
+    if (record.registered) {
+      detail::registry_guard guard;
+      record.priority = priority;
+    }
+  }
+
+  /**
+   * \brief Counts a task executed by the calling thread, if it's registered.
+   *
+   * \details This is done automatically by `task_scheduler`.
+   *
+   * \since 6.4.0
+   */
+  static void note_task() noexcept
+  {
+    auto& record = detail::tls_thread_record;
+    if (record.registered) {
+      record.tasks.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#if CENTURION_LIB_DEFINITIONS
+#include "../detail/thread_registry_impl.hpp"
+#endif  // CENTURION_LIB_DEFINITIONS
+
+#endif  // CENTURION_THREAD_REGISTRY_HEADER
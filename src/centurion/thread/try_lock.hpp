@@ -32,6 +32,26 @@ class try_lock final
    */
   CENTURION_NODISCARD_CTOR explicit try_lock(mutex& mutex) noexcept
       : m_mutex{&mutex}
+      , m_unlock{&unlock<cen::mutex>}
+      , m_status{mutex.try_lock()}
+  {}
+
+  /**
+   * \brief Attempts to exclusively lock the supplied mutex.
+   *
+   * \details This constructor accepts other mutex types with the same interface as
+   * `mutex`, such as `adaptive_mutex` and `shared_mutex`.
+   *
+   * \tparam Mutex the type of the mutex.
+   *
+   * \param mutex the mutex that will be locked.
+   *
+   * \since 6.4.0
+   */
+  template <typename Mutex>
+  CENTURION_NODISCARD_CTOR explicit try_lock(Mutex& mutex) noexcept
+      : m_mutex{&mutex}
+      , m_unlock{&unlock<Mutex>}
       , m_status{mutex.try_lock()}
   {}
 
@@ -47,7 +67,7 @@ class try_lock final
   ~try_lock() noexcept
   {
     if (m_status == lock_status::success) {
-      m_mutex->unlock();
+      m_unlock(m_mutex);
     }
   }
 
@@ -106,8 +126,15 @@ class try_lock final
   }
 
  private:
-  mutex* m_mutex{};
+  void* m_mutex{};
+  void (*m_unlock)(void*) noexcept {};
   lock_status m_status{};
+
+  template <typename Mutex>
+  static void unlock(void* mutex) noexcept
+  {
+    static_cast<Mutex*>(mutex)->unlock();
+  }
 };
 
 /// \} End of group thread
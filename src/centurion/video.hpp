@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019-2021 Albin Johansson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CENTURION_VIDEO_MODULE_HEADER
+#define CENTURION_VIDEO_MODULE_HEADER
+
+#ifndef CENTURION_NO_PRAGMA_ONCE
+#pragma once
+#endif  // CENTURION_NO_PRAGMA_ONCE
+
+// Windows, renderers, textures, fonts and other video components.
+
+#include "video/animated_image_player.hpp"
+#include "video/blend_mode.hpp"
+#include "video/button_order.hpp"
+#include "video/color.hpp"
+#include "video/color_gradient.hpp"
+#include "video/color_utils.hpp"
+#include "video/colors.hpp"
+#include "video/converted_texture_cache.hpp"
+#include "video/cursor.hpp"
+#include "video/damage_tracker.hpp"
+#include "video/debug_overlay.hpp"
+#include "video/dirty_region.hpp"
+#include "video/dpi_scale_mode.hpp"
+#include "video/dpi_scaler.hpp"
+#include "video/flash_op.hpp"
+#include "video/font.hpp"
+#include "video/font_cache.hpp"
+#include "video/font_pool.hpp"
+#include "video/frame_recorder.hpp"
+#include "video/geometry_batch.hpp"
+#include "video/graphics_drivers.hpp"
+#include "video/image_loader.hpp"
+#include "video/image_saver.hpp"
+#include "video/indexed_texture.hpp"
+#include "video/message_box.hpp"
+#include "video/message_box_type.hpp"
+#include "video/multi_window_presenter.hpp"
+#include "video/opengl/gl_attribute.hpp"
+#include "video/opengl/gl_compressed_texture.hpp"
+#include "video/opengl/gl_context.hpp"
+#include "video/opengl/gl_core.hpp"
+#include "video/opengl/gl_gpu_profiler.hpp"
+#include "video/opengl/gl_library.hpp"
+#include "video/opengl/gl_loader.hpp"
+#include "video/opengl/gl_upload_worker.hpp"
+#include "video/palette.hpp"
+#include "video/particle_system.hpp"
+#include "video/pixel_conversion.hpp"
+#include "video/pixel_format.hpp"
+#include "video/pixel_format_info.hpp"
+#include "video/pixel_view.hpp"
+#include "video/render_command_list.hpp"
+#include "video/render_driver_calibration.hpp"
+#include "video/render_graph.hpp"
+#include "video/render_queue.hpp"
+#include "video/renderer.hpp"
+#include "video/renderer_info.hpp"
+#include "video/resize_coordinator.hpp"
+#include "video/rich_text.hpp"
+#include "video/scale_mode.hpp"
+#include "video/screen.hpp"
+#include "video/sdf_glyph_atlas.hpp"
+#include "video/sdf_text_batch.hpp"
+#include "video/shared_frame_exporter.hpp"
+#include "video/sprite_batch.hpp"
+#include "video/surface.hpp"
+#include "video/surface_batch.hpp"
+#include "video/system_cursor.hpp"
+#include "video/text_batch.hpp"
+#include "video/text_layout.hpp"
+#include "video/texture.hpp"
+#include "video/texture_access.hpp"
+#include "video/texture_atlas.hpp"
+#include "video/texture_lock.hpp"
+#include "video/texture_memory.hpp"
+#include "video/texture_pool.hpp"
+#include "video/texture_streamer.hpp"
+#include "video/tile_map.hpp"
+#include "video/unicode_string.hpp"
+#include "video/utf8_view.hpp"
+#include "video/vertex_buffer.hpp"
+#include "video/video_fwd.hpp"
+#include "video/vsync_mode.hpp"
+#include "video/vulkan/vk_core.hpp"
+#include "video/vulkan/vk_library.hpp"
+#include "video/vulkan/vk_present_mode.hpp"
+#include "video/vulkan/vk_presenter.hpp"
+#include "video/window.hpp"
+#include "video/window_state.hpp"
+#include "video/window_utils.hpp"
+
+#endif  // CENTURION_VIDEO_MODULE_HEADER
@@ -0,0 +1,500 @@
+#ifndef CENTURION_ANIMATED_IMAGE_PLAYER_HEADER
+#define CENTURION_ANIMATED_IMAGE_PLAYER_HEADER
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#if (SDL_IMAGE_MAJOR_VERSION > 2) || \
+    ((SDL_IMAGE_MAJOR_VERSION == 2) && (SDL_IMAGE_MINOR_VERSION >= 6))
+
+#include <algorithm>  // min, find_if, fill
+#include <cassert>    // assert
+#include <cstddef>    // byte
+#include <memory>     // shared_ptr, make_shared, unique_ptr
+#include <optional>   // optional
+#include <string>     // string
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../detail/qoi_codec.hpp"
+#include "../detail/sdl_deleter.hpp"
+#include "../math/area.hpp"
+#include "../system/profiler_macros.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/task_scheduler.hpp"
+#include "blend_mode.hpp"
+#include "pixel_format.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class animated_image_player
+ *
+ * \brief Plays animated images, e.g. GIF and WebP files, through a small ring of
+ * streaming textures.
+ *
+ * \details Loading every frame of an animation as a separate texture up front requires
+ * memory proportional to the length of the animation, both for the decoded surfaces and
+ * for the textures. An animated image player instead stores the frames compressed, and
+ * decodes them just ahead of playback on a task scheduler. Only a few frames are decoded
+ * at any time, and they are uploaded to a ring of streaming textures, so the GPU memory
+ * usage is independent of the length of the animation.
+ * \code{cpp}
+ *   cen::animated_image_player spinner{scheduler, "resources/spinner.gif"};
+ *
+ *   // Once per frame
+ *   spinner.update(renderer, delta);
+ *   if (const auto* frame = spinner.current()) {
+ *     renderer.render(*frame, cen::ipoint{10, 10});
+ *   }
+ * \endcode
+ *
+ * \details The animation is loaded with `IMG_LoadAnimation()` on the task scheduler, which
+ * decodes every frame at once, since SDL_image has no incremental decoder. The frames are
+ * then converted to QOI images, which are compact and fast to decode, and the decoded
+ * animation is released.
+ *
+ * \details The animation loops forever. If a frame hasn't finished decoding when it's
+ * due, the previous frame is shown for longer instead of the player blocking.
+ *
+ * \note All functions must be called on the thread that created the renderer. The task
+ * scheduler must outlive the player.
+ *
+ * \see `IMG_LoadAnimation`
+ * \see `task_scheduler`
+ *
+ * \since 6.4.0
+ */
+class animated_image_player final
+{
+ public:
+  /// The delay used for frames without a delay, as used by most browsers.
+  inline constexpr static milliseconds<u32> default_delay{100};
+
+  /**
+   * \brief Creates a player and starts loading the animation.
+   *
+   * \param scheduler the task scheduler that loads and decodes the frames.
+   * \param path the path of the animated image.
+   * \param ringSize the amount of streaming textures, which is also the maximum amount of
+   * frames that are decoded ahead of playback, must be at least two.
+   *
+   * \since 6.4.0
+   */
+  animated_image_player(task_scheduler& scheduler,
+                        std::string path,
+                        const usize ringSize = 3)
+      : m_scheduler{scheduler}
+      , m_state{std::make_shared<shared_state>()}
+      , m_ringSize{ringSize}
+  {
+    assert(ringSize >= 2);
+
+    m_scheduler.submit(m_tasks, [state = m_state, path = std::move(path)] {
+      CENTURION_PROFILE_ZONE("animated_image_player::load");
+      load(*state, path);
+    });
+  }
+
+  animated_image_player(const animated_image_player&) = delete;
+
+  auto operator=(const animated_image_player&) -> animated_image_player& = delete;
+
+  /**
+   * \brief Waits for the tasks of the player to finish.
+   *
+   * \since 6.4.0
+   */
+  ~animated_image_player() noexcept
+  {
+    m_scheduler.wait(m_tasks);
+  }
+
+  /**
+   * \brief Advances the animation, and uploads the next frame when it's due.
+   *
+   * \details Call this function once per frame. At most one frame is uploaded per call,
+   * so long time steps slow the animation down instead of skipping frames.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that is used to create the streaming textures.
+   * \param elapsed the time that has passed since the previous call.
+   *
+   * \return `true` if a new frame was uploaded; `false` otherwise.
+   *
+   * \throws sdl_error if the streaming textures couldn't be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto update(Renderer& renderer, const milliseconds<u32> elapsed) -> bool
+  {
+    if (m_ring.empty() && !start(renderer)) {
+      return false;
+    }
+
+    m_elapsed += elapsed;
+
+    if (m_current && m_elapsed < delay(*m_current)) {
+      return false;
+    }
+
+    std::vector<u8> pixels;
+
+    {
+      scoped_lock lock{m_state->lock};
+
+      auto& ready = m_state->ready;
+      const auto it = std::find_if(ready.begin(), ready.end(), [this](const auto& frame) {
+        return frame.index == m_next;
+      });
+
+      if (it == ready.end()) {
+        return false;  // The frame is still being decoded, so the current one is held
+      }
+
+      pixels = std::move(it->pixels);
+      ready.erase(it);
+    }
+
+    auto& target = m_ring[m_slot];
+    const auto pitch = m_state->size.width * 4;
+
+    if (target.update(std::nullopt, pixels.data(), pitch)) {
+      renderer.record_upload(pixels.size());
+    }
+
+    recycle(std::move(pixels));
+
+    if (m_current) {
+      // Long time steps don't cause several frames to be uploaded in a row
+      m_elapsed = std::min(m_elapsed - delay(*m_current), delay(m_next));
+    }
+    else {
+      m_elapsed = milliseconds<u32>::zero();
+    }
+
+    m_current = m_next;
+    m_shown = m_slot;
+    m_slot = (m_slot + 1) % m_ring.size();
+    m_next = (m_next + 1) % m_state->frames.size();
+
+    --m_decoding;
+    request_decodes();
+
+    return true;
+  }
+
+  /**
+   * \brief Returns the texture of the current frame.
+   *
+   * \return the texture that holds the current frame; a null pointer if no frame has been
+   * uploaded yet.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto current() const noexcept -> const texture*
+  {
+    return m_current ? &m_ring[m_shown] : nullptr;
+  }
+
+  /**
+   * \brief Returns the index of the current frame.
+   *
+   * \return the index of the current frame; `std::nullopt` if no frame has been uploaded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto current_index() const noexcept -> std::optional<usize>
+  {
+    return m_current;
+  }
+
+  /**
+   * \brief Indicates whether or not the animation has been loaded.
+   *
+   * \return `true` if the frames are available; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_loaded() const -> bool
+  {
+    scoped_lock lock{m_state->lock};
+    return m_state->loaded && !m_state->failed;
+  }
+
+  /**
+   * \brief Indicates whether or not the animation failed to load.
+   *
+   * \return `true` if the animation couldn't be loaded; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto has_failed() const -> bool
+  {
+    scoped_lock lock{m_state->lock};
+    return m_state->failed;
+  }
+
+  /**
+   * \brief Returns the amount of frames in the animation.
+   *
+   * \return the number of frames; zero if the animation hasn't been loaded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto frame_count() const -> usize
+  {
+    return is_loaded() ? m_state->frames.size() : 0;
+  }
+
+  /**
+   * \brief Returns the size of the frames.
+   *
+   * \return the size of the animation; a zero area if the animation hasn't been loaded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const -> iarea
+  {
+    return is_loaded() ? m_state->size : iarea{};
+  }
+
+  /**
+   * \brief Returns the total size of the compressed frames.
+   *
+   * \return the amount of memory used by the stored frames, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto compressed_bytes() const -> usize
+  {
+    if (!is_loaded()) {
+      return 0;
+    }
+
+    usize bytes = 0;
+    for (const auto& frame : m_state->frames) {
+      bytes += frame.data.size();
+    }
+
+    return bytes;
+  }
+
+  /**
+   * \brief Returns the amount of streaming textures.
+   *
+   * \return the size of the texture ring.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto ring_size() const noexcept -> usize
+  {
+    return m_ringSize;
+  }
+
+ private:
+  struct compressed_frame final
+  {
+    std::vector<std::byte> data;  ///< The frame, encoded as a QOI image.
+    milliseconds<u32> delay{};
+  };
+
+  struct decoded_frame final
+  {
+    usize index{};
+    std::vector<u8> pixels;  ///< RGBA pixels, without padding.
+  };
+
+  // The frames and the size are written once by the load task, and only read afterwards
+  struct shared_state final
+  {
+    mutex lock;
+    std::vector<compressed_frame> frames;
+    iarea size;
+    std::vector<decoded_frame> ready;
+    std::vector<std::vector<u8>> spare;  ///< Recycled pixel buffers.
+    bool loaded{};
+    bool failed{};
+  };
+
+  task_scheduler& m_scheduler;
+  std::shared_ptr<shared_state> m_state;
+  task_group m_tasks;
+  std::vector<texture> m_ring;
+  usize m_ringSize{};
+  usize m_slot{};     ///< The ring slot that the next frame is uploaded to.
+  usize m_shown{};    ///< The ring slot that holds the current frame.
+  usize m_next{};     ///< The index of the next frame to show.
+  usize m_request{};  ///< The index of the next frame to decode.
+  usize m_decoding{};
+  std::optional<usize> m_current;
+  milliseconds<u32> m_elapsed{};
+
+  template <typename Renderer>
+  [[nodiscard]] auto start(const Renderer& renderer) -> bool
+  {
+    {
+      scoped_lock lock{m_state->lock};
+      if (!m_state->loaded || m_state->failed) {
+        return false;
+      }
+    }
+
+    m_ring.reserve(m_ringSize);
+    for (usize index = 0; index < m_ringSize; ++index) {
+      m_ring.emplace_back(renderer,
+                          pixel_format::rgba32,
+                          texture_access::streaming,
+                          m_state->size);
+      m_ring.back().set_blend_mode(blend_mode::blend);
+    }
+
+    request_decodes();
+    return true;
+  }
+
+  [[nodiscard]] auto delay(const usize index) const noexcept -> milliseconds<u32>
+  {
+    return m_state->frames[index].delay;
+  }
+
+  // Keeps the ring filled with frames that are being decoded or are ready to be uploaded
+  void request_decodes()
+  {
+    const auto frameCount = m_state->frames.size();
+
+    while (m_decoding < m_ringSize) {
+      const auto index = m_request;
+      m_request = (m_request + 1) % frameCount;
+      ++m_decoding;
+
+      m_scheduler.submit(m_tasks, [state = m_state, index] {
+        CENTURION_PROFILE_ZONE("animated_image_player::decode");
+        decode(*state, index);
+      });
+    }
+  }
+
+  void recycle(std::vector<u8> pixels)
+  {
+    scoped_lock lock{m_state->lock};
+    m_state->spare.push_back(std::move(pixels));
+  }
+
+  static void load(shared_state& state, const std::string& path)
+  {
+    std::vector<compressed_frame> frames;
+    iarea size;
+
+    if (auto* animation = IMG_LoadAnimation(path.c_str())) {
+      size = iarea{animation->w, animation->h};
+      frames.reserve(static_cast<usize>(animation->count));
+
+      for (auto index = 0; index < animation->count; ++index) {
+        auto encoded = compress(animation->frames[index]);
+        if (encoded.empty()) {
+          frames.clear();
+          break;
+        }
+
+        const auto delay = animation->delays[index];
+        frames.push_back(compressed_frame{
+            std::move(encoded),
+            delay > 0 ? milliseconds<u32>{static_cast<u32>(delay)} : default_delay});
+      }
+
+      IMG_FreeAnimation(animation);
+    }
+
+    scoped_lock lock{state.lock};
+
+    state.loaded = true;
+    state.failed = frames.empty();
+    state.frames = std::move(frames);
+    state.size = size;
+  }
+
+  [[nodiscard]] static auto compress(SDL_Surface* frame) -> std::vector<std::byte>
+  {
+    std::vector<std::byte> encoded;
+
+    const std::unique_ptr<SDL_Surface, detail::sdl_deleter> converted{
+        SDL_ConvertSurfaceFormat(frame, SDL_PIXELFORMAT_RGBA32, 0)};
+    if (!converted) {
+      return encoded;
+    }
+
+    const bool locked = SDL_MUSTLOCK(converted.get());
+    if (locked && SDL_LockSurface(converted.get()) != 0) {
+      return encoded;
+    }
+
+    detail::qoi_header header;
+    header.width = static_cast<u32>(converted->w);
+    header.height = static_cast<u32>(converted->h);
+    header.channels = 4;
+
+    encoded.resize(detail::qoi_max_size(header.width, header.height));
+    encoded.resize(detail::qoi_encode(static_cast<const u8*>(converted->pixels),
+                                      static_cast<usize>(converted->pitch),
+                                      header,
+                                      reinterpret_cast<u8*>(encoded.data())));
+
+    if (locked) {
+      SDL_UnlockSurface(converted.get());
+    }
+
+    return encoded;
+  }
+
+  static void decode(shared_state& state, const usize index)
+  {
+    std::vector<u8> pixels;
+
+    {
+      scoped_lock lock{state.lock};
+      if (!state.spare.empty()) {
+        pixels = std::move(state.spare.back());
+        state.spare.pop_back();
+      }
+    }
+
+    // The frames are immutable once loaded, so they're read without holding the lock
+    const auto& data = state.frames[index].data;
+    const auto* bytes = reinterpret_cast<const u8*>(data.data());
+    const auto width = static_cast<usize>(state.size.width);
+    const auto height = static_cast<usize>(state.size.height);
+
+    pixels.resize(width * height * 4u);
+
+    const auto header = detail::qoi_read_header(bytes, data.size());
+    if (!header || header->width != width || header->height != height ||
+        !detail::qoi_decode(bytes, data.size(), *header, pixels.data(), width * 4u))
+    {
+      std::fill(pixels.begin(), pixels.end(), u8{0});
+    }
+
+    scoped_lock lock{state.lock};
+    state.ready.push_back(decoded_frame{index, std::move(pixels)});
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_IMAGE_VERSION >= 2.6.0
+#endif  // CENTURION_NO_SDL_IMAGE
+#endif  // CENTURION_ANIMATED_IMAGE_PLAYER_HEADER
@@ -86,6 +86,28 @@ struct blend_task final
   return static_cast<blend_mode>(res);
 }
 
+/**
+ * \brief Returns a blend mode suitable for textures with premultiplied alpha.
+ *
+ * \details The returned blend mode adds the source pixels to the destination pixels scaled
+ * by the inverse source alpha, for both the RGB and alpha components. In other words, the
+ * source color is not multiplied with the source alpha, since that has already been done.
+ *
+ * \return the composed blend mode.
+ *
+ * \see `basic_surface::premultiply_alpha()`
+ * \see `basic_texture::set_premultiplied_blend_mode()`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto premultiplied_blend_mode() noexcept -> blend_mode
+{
+  constexpr blend_task task{blend_factor::one,
+                            blend_factor::one_minus_src_alpha,
+                            blend_op::add};
+  return compose_blend_mode(task, task);
+}
+
 /// \name String conversions
 /// \{
 
@@ -22,10 +22,11 @@
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
 #include "../compiler/compiler.hpp"
+#include "../compiler/linkage.hpp"
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../detail/clamp.hpp"
-#include "../detail/from_string.hpp"
+#include "../detail/hex.hpp"
 #include "../detail/lerp.hpp"
 
 namespace cen {
@@ -249,27 +250,23 @@ class color final
    *
    * \see `from_rgba()`
    * \see `from_argb()`
+   * \see `from_hex()`
    *
    * \since 6.1.0
    */
-  [[nodiscard]] static auto from_rgb(const std::string_view rgb) -> std::optional<color>
+  [[nodiscard]] constexpr static auto from_rgb(const std::string_view rgb) noexcept
+      -> std::optional<color>
   {
-    if (rgb.length() != 7 || rgb.at(0) != '#') {
+    if (rgb.length() != 7 || rgb[0] != '#') {
       return std::nullopt;
     }
 
-    const auto noHash = rgb.substr(1);
+    const auto red = detail::hex_byte(rgb, 1);
+    const auto green = detail::hex_byte(rgb, 3);
+    const auto blue = detail::hex_byte(rgb, 5);
 
-    const auto rr = noHash.substr(0, 2);
-    const auto gg = noHash.substr(2, 2);
-    const auto bb = noHash.substr(4, 2);
-
-    const auto red = detail::from_string<u8>(rr, 16);
-    const auto green = detail::from_string<u8>(gg, 16);
-    const auto blue = detail::from_string<u8>(bb, 16);
-
-    if (red && green && blue) {
-      return cen::color{*red, *green, *blue};
+    if (red >= 0 && green >= 0 && blue >= 0) {
+      return cen::color{static_cast<u8>(red), static_cast<u8>(green), static_cast<u8>(blue)};
     }
     else {
       return std::nullopt;
@@ -288,29 +285,27 @@ class color final
    *
    * \see `from_rgb()`
    * \see `from_argb()`
+   * \see `from_hex()`
    *
    * \since 6.1.0
    */
-  [[nodiscard]] static auto from_rgba(const std::string_view rgba) -> std::optional<color>
+  [[nodiscard]] constexpr static auto from_rgba(const std::string_view rgba) noexcept
+      -> std::optional<color>
   {
-    if (rgba.length() != 9 || rgba.at(0) != '#') {
+    if (rgba.length() != 9 || rgba[0] != '#') {
       return std::nullopt;
     }
 
-    const auto noHash = rgba.substr(1);
-
-    const auto rr = noHash.substr(0, 2);
-    const auto gg = noHash.substr(2, 2);
-    const auto bb = noHash.substr(4, 2);
-    const auto aa = noHash.substr(6, 2);
+    const auto red = detail::hex_byte(rgba, 1);
+    const auto green = detail::hex_byte(rgba, 3);
+    const auto blue = detail::hex_byte(rgba, 5);
+    const auto alpha = detail::hex_byte(rgba, 7);
 
-    const auto red = detail::from_string<u8>(rr, 16);
-    const auto green = detail::from_string<u8>(gg, 16);
-    const auto blue = detail::from_string<u8>(bb, 16);
-    const auto alpha = detail::from_string<u8>(aa, 16);
-
-    if (red && green && blue && alpha) {
-      return cen::color{*red, *green, *blue, *alpha};
+    if (red >= 0 && green >= 0 && blue >= 0 && alpha >= 0) {
+      return cen::color{static_cast<u8>(red),
+                        static_cast<u8>(green),
+                        static_cast<u8>(blue),
+                        static_cast<u8>(alpha)};
     }
     else {
       return std::nullopt;
@@ -332,32 +327,60 @@ class color final
    *
    * \since 6.1.0
    */
-  [[nodiscard]] static auto from_argb(const std::string_view argb) -> std::optional<color>
+  [[nodiscard]] constexpr static auto from_argb(const std::string_view argb) noexcept
+      -> std::optional<color>
   {
-    if (argb.length() != 9 || argb.at(0) != '#') {
+    if (argb.length() != 9 || argb[0] != '#') {
       return std::nullopt;
     }
 
-    const auto noHash = argb.substr(1);
-
-    const auto aa = noHash.substr(0, 2);
-    const auto rr = noHash.substr(2, 2);
-    const auto gg = noHash.substr(4, 2);
-    const auto bb = noHash.substr(6, 2);
+    const auto alpha = detail::hex_byte(argb, 1);
+    const auto red = detail::hex_byte(argb, 3);
+    const auto green = detail::hex_byte(argb, 5);
+    const auto blue = detail::hex_byte(argb, 7);
 
-    const auto alpha = detail::from_string<u8>(aa, 16);
-    const auto red = detail::from_string<u8>(rr, 16);
-    const auto green = detail::from_string<u8>(gg, 16);
-    const auto blue = detail::from_string<u8>(bb, 16);
-
-    if (alpha && red && green && blue) {
-      return cen::color{*red, *green, *blue, *alpha};
+    if (alpha >= 0 && red >= 0 && green >= 0 && blue >= 0) {
+      return cen::color{static_cast<u8>(red),
+                        static_cast<u8>(green),
+                        static_cast<u8>(blue),
+                        static_cast<u8>(alpha)};
     }
     else {
       return std::nullopt;
     }
   }
 
+  /**
+   * \brief Creates a color from a hexadecimal RGB or RGBA color string that is known to be
+   * valid.
+   *
+   * \details This is a faster alternative to `from_rgb()` and `from_rgba()` for input that
+   * has already been validated, e.g. colors read from trusted asset files, since the
+   * digits are decoded without any branches and no `std::optional` is involved.
+   *
+   * \pre `hex` must use either the format "#RRGGBB" or "#RRGGBBAA", where each component
+   * consists of two valid hexadecimal digits.
+   *
+   * \param hex the hexadecimal RGB or RGBA color string.
+   *
+   * \return the corresponding color, which is opaque if `hex` has no alpha component.
+   *
+   * \see `operator""_color()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto from_hex(const std::string_view hex) noexcept -> color
+  {
+    assert(hex.length() == 7 || hex.length() == 9);
+    assert(hex[0] == '#');
+
+    const auto alpha = (hex.length() == 9) ? detail::hex_byte_unchecked(hex, 7) : max();
+    return color{detail::hex_byte_unchecked(hex, 1),
+                 detail::hex_byte_unchecked(hex, 3),
+                 detail::hex_byte_unchecked(hex, 5),
+                 alpha};
+  }
+
   /**
    * \brief Creates a color from normalized color component values.
    *
@@ -779,7 +802,12 @@ class color final
  *
  * \since 5.0.0
  */
-[[nodiscard]] inline auto to_string(const color& color) -> std::string
+[[nodiscard]] CENTURION_API CENTURION_LIB_INLINE auto to_string(const color& color)
+    -> std::string;
+
+#if CENTURION_LIB_DEFINITIONS
+
+CENTURION_LIB_INLINE auto to_string(const color& color) -> std::string
 {
 #if CENTURION_HAS_FEATURE_FORMAT
   return std::format("color{{r: {}, g: {}, b: {}: a: {}}}",
@@ -794,6 +822,8 @@ class color final
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 }
 
+#endif  // CENTURION_LIB_DEFINITIONS
+
 /// \} End of string conversions
 
 /// \name Streaming
@@ -974,6 +1004,46 @@ inline auto operator<<(std::ostream& stream, const color& color) -> std::ostream
 
 /// \} End of color comparison operators
 
+namespace literals {
+
+/**
+ * \brief Creates a color from a hexadecimal RGB or RGBA color literal.
+ *
+ * \details The literal is parsed at compile time when used in a constant expression, in
+ * which case an invalid literal results in a compilation error.
+ * \code{cpp}
+ *   using namespace cen::literals;
+ *
+ *   constexpr auto orange = "#FF8800"_color;
+ *   constexpr auto translucent = "#FF880080"_color;
+ * \endcode
+ *
+ * \param str the hexadecimal color string, using the format "#RRGGBB" or "#RRGGBBAA".
+ * \param length the length of the string.
+ *
+ * \return the corresponding color.
+ *
+ * \throws cen_error if the string isn't a valid hexadecimal color.
+ *
+ * \see `color::from_rgb()`
+ * \see `color::from_rgba()`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto operator""_color(const char* str, const usize length) -> color
+{
+  const std::string_view hex{str, length};
+  const auto result = (length == 9) ? color::from_rgba(hex) : color::from_rgb(hex);
+
+  if (!result) {
+    throw cen_error{"Invalid hexadecimal color literal!"};
+  }
+
+  return *result;
+}
+
+}  // namespace literals
+
 /// \} End of group video
 
 }  // namespace cen
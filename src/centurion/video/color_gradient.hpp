@@ -0,0 +1,219 @@
+#ifndef CENTURION_COLOR_GRADIENT_HEADER
+#define CENTURION_COLOR_GRADIENT_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // stable_sort
+#include <cassert>    // assert
+#include <vector>     // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/color_kernels.hpp"
+#include "color.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct gradient_stop
+ *
+ * \brief A color at a position in a `color_gradient`.
+ *
+ * \since 6.4.0
+ */
+struct gradient_stop final
+{
+  float position{};  ///< The position of the stop, in the range [0, 1].
+  color value;       ///< The color at the position.
+};
+
+/**
+ * \class color_gradient
+ *
+ * \brief A precomputed gradient, which can be sampled in constant time.
+ *
+ * \details The gradient is evaluated once, when it is created, for a fixed amount of
+ * evenly spaced positions. Sampling the gradient is then a single table lookup, which is
+ * much cheaper than blending colors, e.g. when animating the colors of many vertices or
+ * mapping values to a heat map palette. Colors between two stops are linearly
+ * interpolated, and positions before the first stop or after the last stop use the color
+ * of the nearest stop.
+ * \code{cpp}
+ *   const cen::color_gradient heat{{{0.0f, cen::colors::blue},
+ *                                   {0.5f, cen::colors::yellow},
+ *                                   {1.0f, cen::colors::red}}};
+ *
+ *   const auto& color = heat.sample(temperature);
+ * \endcode
+ *
+ * \see `sample_gradient()`
+ *
+ * \since 6.4.0
+ */
+class color_gradient final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Creates a gradient from a set of color stops.
+   *
+   * \param stops the color stops, in any order.
+   * \param resolution the amount of precomputed colors, must be at least 2.
+   *
+   * \throws cen_error if there are no stops, or if the resolution is less than 2.
+   *
+   * \since 6.4.0
+   */
+  explicit color_gradient(std::vector<gradient_stop> stops, const size_type resolution = 256)
+  {
+    if (stops.empty()) {
+      throw cen_error{"Cannot create gradient without color stops!"};
+    }
+
+    if (resolution < 2) {
+      throw cen_error{"Gradient resolution must be at least 2!"};
+    }
+
+    std::stable_sort(stops.begin(),
+                     stops.end(),
+                     [](const gradient_stop& a, const gradient_stop& b) noexcept {
+                       return a.position < b.position;
+                     });
+
+    build(stops, resolution);
+  }
+
+  /**
+   * \brief Creates a gradient between two colors.
+   *
+   * \param from the color at position 0.
+   * \param to the color at position 1.
+   * \param resolution the amount of precomputed colors, must be at least 2.
+   *
+   * \throws cen_error if the resolution is less than 2.
+   *
+   * \since 6.4.0
+   */
+  color_gradient(const color& from, const color& to, const size_type resolution = 256)
+      : color_gradient{{{0.0f, from}, {1.0f, to}}, resolution}
+  {}
+
+  /**
+   * \brief Returns the color at a position in the gradient.
+   *
+   * \param position the position, in the range [0, 1]. Values outside of the range are
+   * clamped.
+   *
+   * \return the precomputed color nearest to the position.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto sample(const float position) const noexcept -> const color&
+  {
+    const auto clamped = (position > 0.0f) ? (position < 1.0f ? position : 1.0f) : 0.0f;
+    return m_table[static_cast<size_type>(clamped * m_scale + 0.5f)];
+  }
+
+  /**
+   * \brief Samples the gradient at several positions.
+   *
+   * \warning The containers *must* store their data contiguously! The behaviour of this
+   * function is undefined if this condition isn't met.
+   *
+   * \tparam Positions the position container type, e.g. `std::vector<float>`.
+   * \tparam Destination the destination container type, e.g. `std::vector<color>`.
+   *
+   * \pre The containers must have the same size.
+   *
+   * \param positions the positions, in the range [0, 1].
+   * \param dst the container that the colors will be written to.
+   *
+   * \since 6.4.0
+   */
+  template <typename Positions, typename Destination>
+  void sample(const Positions& positions, Destination& dst) const noexcept
+  {
+    assert(positions.size() == dst.size());
+
+    const auto count = positions.size();
+    for (size_type index = 0; index < count; ++index) {
+      dst[index] = sample(positions[index]);
+    }
+  }
+
+  /**
+   * \brief Returns the precomputed colors.
+   *
+   * \return the colors of the evenly spaced positions, from position 0 to position 1.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto table() const noexcept -> const std::vector<color>&
+  {
+    return m_table;
+  }
+
+  /**
+   * \brief Returns the amount of precomputed colors.
+   *
+   * \return the resolution of the gradient.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto resolution() const noexcept -> size_type
+  {
+    return m_table.size();
+  }
+
+ private:
+  std::vector<color> m_table;
+  float m_scale{};
+
+  void build(const std::vector<gradient_stop>& stops, const size_type resolution)
+  {
+    m_table.resize(resolution);
+    m_scale = static_cast<float>(resolution - 1);
+
+    std::vector<float> biases(resolution);
+    const auto position_of = [this](const size_type index) noexcept {
+      return static_cast<float>(index) / m_scale;
+    };
+
+    size_type index = 0;
+    for (; index < resolution && position_of(index) <= stops.front().position; ++index) {
+      m_table[index] = stops.front().value;
+    }
+
+    for (size_type stop = 0; stop + 1 < stops.size(); ++stop) {
+      const auto& fst = stops[stop];
+      const auto& snd = stops[stop + 1];
+
+      const auto first = index;
+      for (; index < resolution && position_of(index) <= snd.position; ++index) {
+        biases[index] = (position_of(index) - fst.position) / (snd.position - fst.position);
+      }
+
+      if (index != first) {
+        detail::blend_ramp(fst.value.get(),
+                           snd.value.get(),
+                           biases.data() + first,
+                           m_table[first].data(),
+                           index - first);
+      }
+    }
+
+    for (; index < resolution; ++index) {
+      m_table[index] = stops.back().value;
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_COLOR_GRADIENT_HEADER
@@ -0,0 +1,145 @@
+#ifndef CENTURION_COLOR_UTILS_HEADER
+#define CENTURION_COLOR_UTILS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>      // assert
+#include <type_traits>  // is_same_v
+
+#include "../core/integers.hpp"
+#include "../detail/color_kernels.hpp"
+#include "color.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \brief Blends pairs of colors according to the specified bias.
+ *
+ * \details This is a bulk version of `blend()`, which blends four colors at a time using
+ * SSE2 or NEON, when available. The results may differ from those of `blend()` by one,
+ * due to rounding.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Source the source container type, e.g. `std::vector<color>`.
+ * \tparam Destination the destination container type, e.g. `std::vector<color>`.
+ *
+ * \pre The containers must have the same size.
+ * \pre `bias` should be in the range [0, 1].
+ *
+ * \param from the colors used when the bias is 0.
+ * \param to the colors used when the bias is 1.
+ * \param bias the bias that determines how the colors are blended.
+ * \param dst the container that the blended colors will be written to, may be `from` or
+ * `to`.
+ *
+ * \since 6.4.0
+ */
+template <typename Source, typename Destination>
+void blend(const Source& from, const Source& to, const float bias, Destination& dst) noexcept
+{
+  static_assert(std::is_same_v<typename Source::value_type, color>);
+  static_assert(std::is_same_v<typename Destination::value_type, color>);
+  assert(from.size() == to.size());
+  assert(from.size() == dst.size());
+
+  if (!from.empty()) {
+    detail::blend_colors(from.front().data(),
+                         to.front().data(),
+                         bias,
+                         dst.front().data(),
+                         from.size());
+  }
+}
+
+/**
+ * \brief Samples the gradient between two colors.
+ *
+ * \details This blends the two colors with a different bias for each output color, four
+ * colors at a time using SSE2 or NEON, when available. Use `color_gradient` for gradients
+ * with more than two colors, or when the same gradient is sampled repeatedly.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Biases the bias container type, e.g. `std::vector<float>`.
+ * \tparam Destination the destination container type, e.g. `std::vector<color>`.
+ *
+ * \pre The containers must have the same size.
+ *
+ * \param from the color used when a bias is 0.
+ * \param to the color used when a bias is 1.
+ * \param biases the biases, in the range [0, 1].
+ * \param dst the container that the sampled colors will be written to.
+ *
+ * \since 6.4.0
+ */
+template <typename Biases, typename Destination>
+void sample_gradient(const color& from,
+                     const color& to,
+                     const Biases& biases,
+                     Destination& dst) noexcept
+{
+  static_assert(std::is_same_v<typename Biases::value_type, float>);
+  static_assert(std::is_same_v<typename Destination::value_type, color>);
+  assert(biases.size() == dst.size());
+
+  if (!biases.empty()) {
+    detail::blend_ramp(from.get(), to.get(), biases.data(), dst.front().data(), biases.size());
+  }
+}
+
+/**
+ * \brief Converts HSV-encoded values to colors.
+ *
+ * \details This is a bulk version of `color::from_hsv()`, which converts four colors at a
+ * time using SSE2 or NEON, when available. The results may differ from those of
+ * `color::from_hsv()` by one, due to rounding.
+ *
+ * \note The values will be clamped to be within their respective ranges.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Values the value container type, e.g. `std::vector<float>`.
+ * \tparam Destination the destination container type, e.g. `std::vector<color>`.
+ *
+ * \pre The containers must have the same size.
+ *
+ * \param hues the hues of the colors, in the range [0, 360].
+ * \param saturations the saturations of the colors, in the range [0, 100].
+ * \param values the values of the colors, in the range [0, 100].
+ * \param dst the container that the opaque converted colors will be written to.
+ *
+ * \since 6.4.0
+ */
+template <typename Values, typename Destination>
+void hsv_to_rgb(const Values& hues,
+                const Values& saturations,
+                const Values& values,
+                Destination& dst) noexcept
+{
+  static_assert(std::is_same_v<typename Values::value_type, float>);
+  static_assert(std::is_same_v<typename Destination::value_type, color>);
+  assert(hues.size() == saturations.size());
+  assert(hues.size() == values.size());
+  assert(hues.size() == dst.size());
+
+  if (!hues.empty()) {
+    detail::hsv_to_rgb(hues.data(),
+                       saturations.data(),
+                       values.data(),
+                       dst.front().data(),
+                       hues.size());
+  }
+}
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_COLOR_UTILS_HEADER
@@ -0,0 +1,404 @@
+#ifndef CENTURION_CONVERTED_TEXTURE_CACHE_HEADER
+#define CENTURION_CONVERTED_TEXTURE_CACHE_HEADER
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+#include <SDL2/SDL.h>
+
+#include <cstring>   // memcmp, memcpy
+#include <optional>  // optional, nullopt
+#include <string>    // string
+#include <utility>   // move
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../detail/lz4_codec.hpp"
+#include "../filesystem/file.hpp"
+#include "../filesystem/mapped_file.hpp"
+#include "../filesystem/seek_mode.hpp"
+#include "../math/area.hpp"
+#include "../system/profiler_macros.hpp"
+#include "blend_mode.hpp"
+#include "pixel_format.hpp"
+#include "renderer_info.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class converted_texture_cache
+ *
+ * \brief Caches images that have been decoded and converted to the native pixel format of
+ * a renderer, so that they can be uploaded directly.
+ *
+ * \details Creating a texture from an image file involves decoding the image, e.g. PNG
+ * decompression, and converting the pixels to a format supported by the renderer, which is
+ * done implicitly by `SDL_CreateTextureFromSurface()`. Both steps are repeated every time
+ * the image is loaded. This cache stores the converted pixels in a directory the first time
+ * an image is loaded, and subsequent loads upload the stored pixels as they are, straight
+ * from a memory mapped file.
+ * \code{cpp}
+ *   cen::converted_texture_cache cache{cen::preferred_path("studio", "game").copy()};
+ *
+ *   auto player = cache.load(renderer, "resources/player.png");
+ * \endcode
+ *
+ * \details Entries are keyed by a hash of the contents of the image file, its size, and
+ * the preferred pixel format of the renderer, see `preferred_format()`. As a result,
+ * modified images are converted again, and a cache directory can be shared by several
+ * renderers. Stale entries are never removed, since the cache has no way of knowing
+ * whether they will be used again, so clear the directory when upgrading assets.
+ *
+ * \note The image file is still read in order to compute its hash, which is considerably
+ * cheaper than decoding it.
+ *
+ * \since 6.4.0
+ */
+class converted_texture_cache final
+{
+ public:
+  /**
+   * \struct cache_stats
+   *
+   * \brief Provides statistics about the loads performed by a converted texture cache.
+   *
+   * \since 6.4.0
+   */
+  struct cache_stats final
+  {
+    usize hits{};    ///< The amount of loads that were served with a stored entry.
+    usize misses{};  ///< The amount of loads that decoded and converted the image.
+    usize writes{};  ///< The amount of entries that were successfully stored.
+
+    /**
+     * \brief Returns the ratio of loads that were served with a stored entry.
+     *
+     * \return the hit rate, in the range [0, 1]; zero if there have been no loads.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto hit_rate() const noexcept -> double
+    {
+      const auto total = hits + misses;
+      return (total != 0) ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+    }
+  };
+
+  /**
+   * \brief Creates a converted texture cache.
+   *
+   * \param directory the directory in which the entries are stored, including a trailing
+   * path separator, e.g. the path obtained with `preferred_path()`. The directory must
+   * exist.
+   *
+   * \since 6.4.0
+   */
+  explicit converted_texture_cache(std::string directory) : m_directory{std::move(directory)}
+  {}
+
+  /**
+   * \brief Loads a texture, using a stored entry if there is one.
+   *
+   * \details If there is no matching entry, the image is decoded, converted to the pixel
+   * format chosen by `preferred_format()`, and stored before the texture is created. A
+   * failure to store the entry isn't treated as an error.
+   *
+   * \details Textures are created with `no_lock` access, and use the `blend` blend mode if
+   * the image has an alpha channel or a color key, like textures created from surfaces.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture.
+   * \param path the path of the image file.
+   *
+   * \return the loaded texture.
+   *
+   * \throws cen_error if the image file couldn't be read.
+   * \throws img_error if the image couldn't be decoded.
+   * \throws sdl_error if the image couldn't be converted, or if the texture couldn't be
+   * created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto load(Renderer& renderer, const std::string& path) -> texture
+  {
+    CENTURION_PROFILE_ZONE("converted_texture_cache::load");
+
+    file source{path, file_mode::read_existing_binary};
+    if (!source) {
+      throw cen_error{"Failed to open image file!"};
+    }
+
+    const auto data = source.read_all();
+    if (data.empty()) {
+      throw cen_error{"Failed to read image file!"};
+    }
+
+    const auto info = get_info(renderer);
+    const auto preferred = info ? preferred_format(*info, true) : pixel_format::argb8888;
+
+    const auto hash = detail::xxh32::of(reinterpret_cast<const u8*>(data.data()), data.size());
+    const auto entryPath = m_directory + entry_name(hash, data.size(), preferred);
+
+    if (const mapped_file entry{entryPath}) {
+      if (auto cached = upload_entry(renderer, entry, info, hash, data.size())) {
+        ++m_stats.hits;
+        return std::move(*cached);
+      }
+    }
+
+    ++m_stats.misses;
+
+    if (!source.seek(0, seek_mode::from_beginning)) {
+      throw cen_error{"Failed to rewind image file!"};
+    }
+
+    const surface image{source};
+
+    const auto original = to_underlying(image.format_info().format());
+    const auto blended = SDL_ISPIXELFORMAT_ALPHA(original) || SDL_HasColorKey(image.get());
+    const auto format = info ? preferred_format(*info, blended) : pixel_format::argb8888;
+
+    auto converted = image.convert(format);
+    if (!converted.lock()) {
+      throw sdl_error{};
+    }
+
+    const auto size = converted.size();
+    const auto pitch = converted.pitch();
+    const auto* pixels = converted.pixels();
+
+    if (store_entry(entryPath, hash, data.size(), format, size, pitch, blended, pixels)) {
+      ++m_stats.writes;
+    }
+
+    auto result = create(renderer, format, size, pitch, blended, pixels);
+    converted.unlock();
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the pixel format that a renderer prefers for uploaded images.
+   *
+   * \details The first texture format reported by a renderer is its native format, so the
+   * first format that isn't a FourCC (e.g. YUV) or indexed format is chosen. Images with
+   * transparency use the first such format with an alpha channel.
+   *
+   * \param info the renderer information.
+   * \param alpha `true` if the format must have an alpha channel; `false` otherwise.
+   *
+   * \return the preferred pixel format; `argb8888` if the renderer doesn't report a
+   * suitable format.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto preferred_format(const renderer_info& info,
+                                             const bool alpha) noexcept -> pixel_format
+  {
+    for (u32 index = 0; index < info.format_count(); ++index) {
+      const auto format = info.format(index);
+      const auto raw = to_underlying(format);
+
+      if (!SDL_ISPIXELFORMAT_FOURCC(raw) && !SDL_ISPIXELFORMAT_INDEXED(raw) &&
+          (!alpha || SDL_ISPIXELFORMAT_ALPHA(raw)))
+      {
+        return format;
+      }
+    }
+
+    return pixel_format::argb8888;
+  }
+
+  /**
+   * \brief Resets the load statistics.
+   *
+   * \since 6.4.0
+   */
+  void reset_stats() noexcept
+  {
+    m_stats = cache_stats{};
+  }
+
+  /**
+   * \brief Returns statistics about the performed loads.
+   *
+   * \return the load statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> const cache_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Returns the directory in which the entries are stored.
+   *
+   * \return the cache directory.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto directory() const noexcept -> const std::string&
+  {
+    return m_directory;
+  }
+
+ private:
+  inline constexpr static char entry_magic[8]{'C', 'E', 'N', 'T', 'E', 'X', 'C', 'V'};
+
+  /// The version of the entry format, incremented for incompatible changes.
+  inline constexpr static u32 entry_version = 1;
+
+  struct entry_header final
+  {
+    char magic[8]{};
+    u32 version{};
+    u32 hash{};
+    u64 sourceSize{};
+    u32 format{};
+    i32 width{};
+    i32 height{};
+    i32 pitch{};
+    u32 blended{};
+  };
+
+  std::string m_directory;
+  cache_stats m_stats;
+
+  [[nodiscard]] static auto entry_name(const u32 hash,
+                                       const usize size,
+                                       const pixel_format format) -> std::string
+  {
+    constexpr auto digits = "0123456789abcdef";
+
+    std::string name(8, '0');
+    for (usize index = 0; index < 8; ++index) {
+      name[7 - index] = digits[(hash >> (index * 4)) & 0xFu];
+    }
+
+    name += '_' + std::to_string(size);
+    name += '_' + std::to_string(to_underlying(format));
+
+    return name + ".texture";
+  }
+
+  template <typename Renderer>
+  [[nodiscard]] static auto upload_entry(Renderer& renderer,
+                                         const mapped_file& entry,
+                                         const std::optional<renderer_info>& info,
+                                         const u32 hash,
+                                         const usize sourceSize) -> std::optional<texture>
+  {
+    entry_header header;
+    if (entry.size() < sizeof header) {
+      return std::nullopt;
+    }
+
+    std::memcpy(&header, entry.data(), sizeof header);
+
+    if (std::memcmp(header.magic, entry_magic, sizeof entry_magic) != 0 ||
+        header.version != entry_version || header.hash != hash ||
+        header.sourceSize != sourceSize || header.width <= 0 || header.height <= 0 ||
+        header.pitch < header.width || !is_supported(info, header.format))
+    {
+      return std::nullopt;
+    }
+
+    const auto pixelBytes =
+        static_cast<usize>(header.pitch) * static_cast<usize>(header.height);
+    if (entry.size() - sizeof header != pixelBytes) {
+      return std::nullopt;
+    }
+
+    // The pixels are uploaded straight from the mapped file
+    return create(renderer,
+                  static_cast<pixel_format>(header.format),
+                  iarea{header.width, header.height},
+                  header.pitch,
+                  header.blended != 0,
+                  entry.data() + sizeof header);
+  }
+
+  [[nodiscard]] static auto is_supported(const std::optional<renderer_info>& info,
+                                         const u32 format) noexcept -> bool
+  {
+    if (!info) {
+      return format == to_underlying(pixel_format::argb8888);
+    }
+
+    for (u32 index = 0; index < info->format_count(); ++index) {
+      if (to_underlying(info->format(index)) == format) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  [[nodiscard]] static auto store_entry(const std::string& path,
+                                        const u32 hash,
+                                        const usize sourceSize,
+                                        const pixel_format format,
+                                        const iarea size,
+                                        const int pitch,
+                                        const bool blended,
+                                        const void* pixels) -> bool
+  {
+    entry_header header;
+    std::memcpy(header.magic, entry_magic, sizeof entry_magic);
+    header.version = entry_version;
+    header.hash = hash;
+    header.sourceSize = sourceSize;
+    header.format = to_underlying(format);
+    header.width = size.width;
+    header.height = size.height;
+    header.pitch = pitch;
+    header.blended = blended ? 1u : 0u;
+
+    const auto pixelBytes = static_cast<usize>(pitch) * static_cast<usize>(size.height);
+
+    file target{path, file_mode::write_binary};
+    return target &&
+           target.write(reinterpret_cast<const u8*>(&header), sizeof header) ==
+               sizeof header &&
+           target.write(static_cast<const u8*>(pixels), pixelBytes) == pixelBytes;
+  }
+
+  template <typename Renderer>
+  [[nodiscard]] static auto create(Renderer& renderer,
+                                   const pixel_format format,
+                                   const iarea size,
+                                   const int pitch,
+                                   const bool blended,
+                                   const void* pixels) -> texture
+  {
+    texture result{renderer, format, texture_access::no_lock, size};
+
+    if (!result.update(std::nullopt, pixels, pitch)) {
+      throw sdl_error{};
+    }
+
+    if (blended) {
+      result.set_blend_mode(blend_mode::blend);
+    }
+
+    renderer.record_upload(static_cast<usize>(pitch) * static_cast<usize>(size.height));
+
+    return result;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_IMAGE
+#endif  // CENTURION_CONVERTED_TEXTURE_CACHE_HEADER
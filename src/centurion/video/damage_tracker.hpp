@@ -0,0 +1,294 @@
+#ifndef CENTURION_DAMAGE_TRACKER_HEADER
+#define CENTURION_DAMAGE_TRACKER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <optional>  // nullopt
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "dirty_region.hpp"
+#include "pixel_format.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class damage_tracker
+ *
+ * \brief Only redraws the parts of a mostly static scene that have changed.
+ *
+ * \details A damage tracker owns a persistent render target texture, the canvas, which
+ * holds the result of the previous frames. Changed areas are reported with `mark()`, and
+ * are merged with `get_union()`. When `render()` is called, the damaged area is cleared
+ * and redrawn on the canvas with the clip set to the damaged area, after which the canvas
+ * is copied to the current render target. Frames without any damage only cost a single
+ * texture copy.
+ * \code{cpp}
+ *   cen::damage_tracker damage{renderer, renderer.output_size()};
+ *
+ *   // Whenever a widget changes
+ *   damage.mark(button.bounds());
+ *
+ *   // Every frame
+ *   damage.render(renderer, [&](const cen::irect& area) {
+ *     for (const auto& widget : widgets) {
+ *       if (cen::intersects(widget.bounds(), area)) {
+ *         widget.render(renderer);
+ *       }
+ *     }
+ *   });
+ *   renderer.present();
+ * \endcode
+ *
+ * \details The whole canvas is damaged initially. Call `mark_all()` if the canvas was
+ * lost, e.g. after the `SDL_RENDER_TARGETS_RESET` event, and `resize()` when the size of
+ * the window changes.
+ *
+ * \see `dirty_region`
+ *
+ * \since 6.4.0
+ */
+class damage_tracker final
+{
+ public:
+  /**
+   * \brief Creates a damage tracker, where the entire canvas is damaged.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that is used to create the canvas.
+   * \param size the size of the canvas, usually the output size of the renderer.
+   *
+   * \throws sdl_error if the canvas cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  damage_tracker(const Renderer& renderer, const iarea size)
+      : m_canvas{make_canvas(renderer, size)}
+      , m_damage{size}
+  {
+    m_damage.mark_all();
+  }
+
+  /**
+   * \brief Marks an area as changed, so that it is redrawn by the next `render()` call.
+   *
+   * \details Areas outside of the canvas are ignored.
+   *
+   * \param area the area that has changed.
+   *
+   * \since 6.4.0
+   */
+  void mark(const irect& area) noexcept
+  {
+    m_damage.mark(area);
+  }
+
+  /**
+   * \brief Marks the entire canvas as changed.
+   *
+   * \since 6.4.0
+   */
+  void mark_all() noexcept
+  {
+    m_damage.mark_all();
+  }
+
+  /**
+   * \brief Changes the size of the canvas, which is then entirely damaged.
+   *
+   * \details Nothing happens if the size is unchanged.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that is used to create the canvas.
+   * \param size the new size of the canvas.
+   *
+   * \throws sdl_error if the canvas cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void resize(const Renderer& renderer, const iarea size)
+  {
+    if (size != m_damage.bounds()) {
+      m_canvas = make_canvas(renderer, size);
+      m_damage = dirty_region{size};
+      m_damage.mark_all();
+    }
+  }
+
+  /**
+   * \brief Redraws the damaged area of the canvas, and copies the canvas to the current
+   * render target.
+   *
+   * \details If any area has been damaged, it is filled with the background color, and the
+   * supplied function is invoked with the damaged area as its argument. The function
+   * should render the parts of the scene that intersect the damaged area, anything outside
+   * of it is clipped. Afterwards, the clip is reset and the previous render target is
+   * restored.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   * \tparam Draw the type of the function object, invoked as `void(const irect&)`.
+   *
+   * \param renderer the renderer that will be used.
+   * \param draw the function object that renders the scene.
+   *
+   * \return `success` if the canvas was redrawn and copied; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer, typename Draw>
+  auto render(Renderer& renderer, Draw&& draw) -> result
+  {
+    CENTURION_PROFILE_ZONE("damage_tracker::render");
+
+    m_redrawn = m_damage.area();
+
+    if (m_damage.is_dirty()) {
+      auto previous = renderer.get_render_target();
+      if (!renderer.set_target(m_canvas)) {
+        return failure;
+      }
+
+      const auto oldColor = renderer.get_color();
+      renderer.set_clip(m_redrawn);
+      renderer.set_color(m_background);
+      renderer.fill_rect(m_redrawn);
+      renderer.set_color(oldColor);
+
+      draw(m_redrawn);
+
+      renderer.set_clip(std::nullopt);
+      m_damage.clear();
+
+      if (previous) {
+        renderer.set_target(previous);
+      }
+      else {
+        renderer.reset_target();
+      }
+    }
+
+    return renderer.render(m_canvas, ipoint{0, 0});
+  }
+
+  /**
+   * \brief Sets the color that damaged areas are filled with before they are redrawn.
+   *
+   * \details The background color is opaque black by default.
+   *
+   * \param background the background color.
+   *
+   * \since 6.4.0
+   */
+  void set_background(const color& background) noexcept
+  {
+    m_background = background;
+  }
+
+  /**
+   * \brief Returns the color that damaged areas are filled with before they are redrawn.
+   *
+   * \return the background color.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto background() const noexcept -> const color&
+  {
+    return m_background;
+  }
+
+  /**
+   * \brief Indicates whether or not any area will be redrawn by the next `render()` call.
+   *
+   * \return `true` if some area is damaged; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_damaged() const noexcept -> bool
+  {
+    return m_damage.is_dirty();
+  }
+
+  /**
+   * \brief Returns the area that will be redrawn by the next `render()` call.
+   *
+   * \return the bounding rectangle of all damaged areas; an empty rectangle if nothing has
+   * been damaged.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto damaged_area() const noexcept -> const irect&
+  {
+    return m_damage.area();
+  }
+
+  /**
+   * \brief Returns the area that was redrawn by the most recent `render()` call.
+   *
+   * \return the redrawn area; an empty rectangle if nothing was redrawn.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto redrawn_area() const noexcept -> const irect&
+  {
+    return m_redrawn;
+  }
+
+  /**
+   * \brief Returns the size of the canvas.
+   *
+   * \return the canvas size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_damage.bounds();
+  }
+
+  /**
+   * \brief Returns the canvas texture, which holds the most recently rendered frame.
+   *
+   * \return the canvas texture.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto canvas() const noexcept -> const texture&
+  {
+    return m_canvas;
+  }
+
+ private:
+  texture m_canvas;
+  dirty_region m_damage;
+  irect m_redrawn;
+  color m_background{colors::black};
+
+  template <typename Renderer>
+  [[nodiscard]] static auto make_canvas(const Renderer& renderer, const iarea size) -> texture
+  {
+    texture canvas{renderer, pixel_format::rgba32, texture_access::target, size};
+    canvas.set_blend_mode(blend_mode::none);
+    return canvas;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_DAMAGE_TRACKER_HEADER
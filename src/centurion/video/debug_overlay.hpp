@@ -0,0 +1,585 @@
+#ifndef CENTURION_DEBUG_OVERLAY_HEADER
+#define CENTURION_DEBUG_OVERLAY_HEADER
+
+#include <SDL2/SDL.h>
+
+#ifndef CENTURION_NO_SDL_TTF
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <algorithm>    // min, max, partial_sort
+#include <array>        // array
+#include <cassert>      // assert
+#include <cstddef>      // ptrdiff_t
+#include <cstdio>       // snprintf
+#include <string_view>  // string_view
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../system/counter.hpp"
+#include "../system/frame_histogram.hpp"
+#include "../system/profiler.hpp"
+#include "../thread/deadline.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "font_cache.hpp"
+#include "renderer.hpp"
+#include "text_batch.hpp"
+#include "vertex_buffer.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class debug_overlay
+ *
+ * \brief Draws live performance statistics on top of the rendered frame.
+ *
+ * \details The overlay shows a graph of the recent frame times, the frame time percentiles,
+ * the draw calls, texture switches and primitives of the last frame, the most expensive
+ * profiler zones, and the cost of the overlay itself. The frame times are obtained from
+ * `basic_renderer::get_present_timing()`, the rendering statistics from
+ * `basic_renderer::frame_stats()`, and the zones from `profiler::zones()`.
+ * \code{cpp}
+ *   cen::font_cache cache{"mono.ttf", 12};
+ *   cache.use_atlas();
+ *   cache.add_basic_latin(renderer);
+ *
+ *   renderer.set_stats_collection(true);
+ *   cen::debug_overlay overlay{cache};
+ *
+ *   while (running) {
+ *     cen::profiler::end_frame();
+ *     overlay.update(renderer);
+ *
+ *     // Render the frame...
+ *
+ *     overlay.render(renderer);
+ *     renderer.present();
+ *   }
+ * \endcode
+ *
+ * \details The overlay is designed to stay well below 0.1 ms per frame. The graph is
+ * stored in a `vertex_buffer` that is rendered with a single `SDL_RenderGeometry` call,
+ * and the text is stored in a `text_batch`, which uses the glyph atlas of the font cache,
+ * i.e. one additional call per used atlas page. The text is only rebuilt every few frames,
+ * see `set_refresh_interval()`, and no memory is allocated once the buffers have grown
+ * large enough, except for the list of profiler zones. The draw calls of the overlay are
+ * excluded from the displayed statistics, and the time spent in `update()` and `render()`
+ * is available through `cost()`.
+ *
+ * \note The basic Latin glyphs must be stored in the glyph atlas of the font cache, other
+ * glyphs are ignored, see `font_cache::add_basic_latin()`.
+ *
+ * \note The associated font cache must outlive the overlay.
+ *
+ * \see `render_stats`
+ * \see `profiler`
+ * \see `frame_histogram`
+ *
+ * \since 6.4.0
+ */
+class debug_overlay final
+{
+ public:
+  using duration_type = nanoseconds<u64>;
+
+  /// The amount of frames shown by the frame time graph.
+  inline constexpr static usize history_size = 120;
+
+  /**
+   * \brief Creates a debug overlay.
+   *
+   * \param cache the font cache that provides the glyph atlas.
+   * \param position the position of the top-left corner of the overlay.
+   *
+   * \since 6.4.0
+   */
+  explicit debug_overlay(const font_cache& cache, const fpoint position = {8, 8})
+      : m_text{cache}
+      , m_position{position}
+  {
+    // A background, a budget line and a bar for each frame
+    m_shapes.reserve(4u * (history_size + 2u), 6u * (history_size + 2u));
+  }
+
+  /**
+   * \brief Records the latest frame and rebuilds the overlay.
+   *
+   * \details This should be called once per frame, after `profiler::end_frame()`, and
+   * before the overlay is rendered. The graph is rebuilt every frame, but the text is only
+   * rebuilt every `refresh_interval()` frames.
+   *
+   * \tparam T the ownership semantics of the renderer.
+   *
+   * \param renderer the renderer that the statistics are obtained from.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void update(const basic_renderer<T>& renderer)
+  {
+    const auto start = counter::now();
+
+    const auto& timing = renderer.get_present_timing();
+    if (timing.presents != m_presents) {
+      m_presents = timing.presents;
+      if (timing.interval != duration_type::zero()) {
+        record(timing.interval);
+      }
+    }
+
+    if (m_framesSinceRefresh == 0) {
+      refresh_text(renderer);
+    }
+
+    m_framesSinceRefresh = (m_framesSinceRefresh + 1u) % m_refreshInterval;
+
+    build_shapes();
+
+    m_updateTicks = counter::now() - start;
+  }
+
+  /**
+   * \brief Renders the overlay.
+   *
+   * \details This should be called after everything else has been rendered, right before
+   * `basic_renderer::present()`.
+   *
+   * \tparam T the ownership semantics of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if the overlay was rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto render(basic_renderer<T>& renderer) -> result
+  {
+    const auto start = counter::now();
+    const auto before = renderer.current_stats();
+
+    auto rendered = renderer.render_geometry(m_shapes);
+    if (rendered) {
+      rendered = renderer.render_text(m_text);
+    }
+
+    const auto& after = renderer.current_stats();
+    m_own.drawCalls = after.drawCalls - before.drawCalls;
+    m_own.primitives = after.primitives - before.primitives;
+    m_own.textureSwitches = after.textureSwitches - before.textureSwitches;
+
+    m_cost = deadline::from_counter_ticks(m_updateTicks + (counter::now() - start));
+    return rendered;
+  }
+
+  /**
+   * \brief Sets the frame time budget.
+   *
+   * \details Frames within the budget are drawn in green, frames that exceed it by less
+   * than half of the budget are drawn in orange, and slower frames are drawn in red. The
+   * graph shows frame times up to twice the budget.
+   *
+   * \param budget the target frame time, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  void set_budget(const duration_type budget) noexcept
+  {
+    assert(budget != duration_type::zero());
+    m_budget = budget;
+  }
+
+  /**
+   * \brief Sets the maximum amount of profiler zones that are shown.
+   *
+   * \details The zones that took the most time last frame are shown.
+   *
+   * \param count the maximum amount of zones, zero hides the zones.
+   *
+   * \since 6.4.0
+   */
+  void set_zone_count(const usize count) noexcept
+  {
+    m_zoneCount = count;
+  }
+
+  /**
+   * \brief Sets the amount of frames between two rebuilds of the text.
+   *
+   * \details The text is rebuilt every fourth frame by default, since text that changes
+   * every frame is hard to read, and since rebuilding the text is the most expensive part
+   * of updating the overlay.
+   *
+   * \param frames the amount of frames, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  void set_refresh_interval(const usize frames) noexcept
+  {
+    assert(frames > 0);
+    m_refreshInterval = frames;
+  }
+
+  /**
+   * \brief Sets the position of the overlay.
+   *
+   * \details The text is moved the next time that it is rebuilt.
+   *
+   * \param position the position of the top-left corner of the overlay.
+   *
+   * \since 6.4.0
+   */
+  void set_position(const fpoint position) noexcept
+  {
+    m_position = position;
+  }
+
+  /**
+   * \brief Sets the size of the frame time graph.
+   *
+   * \param size the size of the graph, components must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  void set_graph_size(const farea size) noexcept
+  {
+    assert(size.width > 0 && size.height > 0);
+    m_graphSize = size;
+  }
+
+  /**
+   * \brief Returns the time spent updating and rendering the overlay in the last frame.
+   *
+   * \return the cost of the overlay.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto cost() const noexcept -> duration_type
+  {
+    return m_cost;
+  }
+
+  /**
+   * \brief Returns the histogram of all frame times recorded by the overlay.
+   *
+   * \return the frame time histogram.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto histogram() const noexcept -> const frame_histogram&
+  {
+    return m_histogram;
+  }
+
+  /**
+   * \brief Returns the duration of the latest recorded frame.
+   *
+   * \return the last frame time; zero if no frames have been recorded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto last_frame_time() const noexcept -> duration_type
+  {
+    return duration_type{(m_count != 0) ? m_history[newest_index()] : 0u};
+  }
+
+  /**
+   * \brief Returns the rendering work of the overlay itself in the last frame.
+   *
+   * \details This is subtracted from the rendering statistics shown by the overlay.
+   *
+   * \return the rendering statistics of the last call to `render()`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto own_stats() const noexcept -> const render_stats&
+  {
+    return m_own;
+  }
+
+  /**
+   * \brief Returns the untextured geometry of the overlay, i.e. the background and graph.
+   *
+   * \return the vertex buffer of the overlay.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto shapes() const noexcept -> const vertex_buffer&
+  {
+    return m_shapes;
+  }
+
+  /**
+   * \brief Returns the text of the overlay.
+   *
+   * \return the text batch of the overlay.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto text() const noexcept -> const text_batch&
+  {
+    return m_text;
+  }
+
+  /**
+   * \brief Returns the frame time budget.
+   *
+   * \return the target frame time, 60 FPS by default.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto budget() const noexcept -> duration_type
+  {
+    return m_budget;
+  }
+
+  /**
+   * \brief Returns the maximum amount of profiler zones that are shown.
+   *
+   * \return the maximum amount of shown zones.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto zone_count() const noexcept -> usize
+  {
+    return m_zoneCount;
+  }
+
+  /**
+   * \brief Returns the amount of frames between two rebuilds of the text.
+   *
+   * \return the text refresh interval, in frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto refresh_interval() const noexcept -> usize
+  {
+    return m_refreshInterval;
+  }
+
+  /**
+   * \brief Returns the position of the overlay.
+   *
+   * \return the position of the top-left corner of the overlay.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto position() const noexcept -> fpoint
+  {
+    return m_position;
+  }
+
+  /**
+   * \brief Returns the size of the frame time graph.
+   *
+   * \return the size of the graph.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto graph_size() const noexcept -> farea
+  {
+    return m_graphSize;
+  }
+
+ private:
+  inline constexpr static float padding = 4;
+  inline constexpr static usize line_capacity = 128;
+
+  text_batch m_text;
+  vertex_buffer m_shapes;
+  frame_histogram m_histogram;
+  std::array<u64, history_size> m_history{};
+  std::vector<profile_zone_stats> m_zones;
+  render_stats m_own;
+  fpoint m_position;
+  farea m_graphSize{240, 48};
+  farea m_textSize;
+  duration_type m_budget{16'666'667};
+  duration_type m_cost{};
+  u64 m_updateTicks{};
+  u64 m_presents{};
+  usize m_next{};
+  usize m_count{};
+  usize m_zoneCount{4};
+  usize m_refreshInterval{4};
+  usize m_framesSinceRefresh{};
+
+  [[nodiscard]] static auto to_ms(const duration_type duration) noexcept -> double
+  {
+    return static_cast<double>(duration.count()) / 1'000'000.0;
+  }
+
+  [[nodiscard]] static auto without(const usize total, const usize own) noexcept -> usize
+  {
+    return (total > own) ? total - own : 0u;
+  }
+
+  [[nodiscard]] auto newest_index() const noexcept -> usize
+  {
+    return (m_next + history_size - 1u) % history_size;
+  }
+
+  [[nodiscard]] auto frame_color(const u64 ns) const noexcept -> color
+  {
+    const auto budget = m_budget.count();
+    if (ns <= budget) {
+      return colors::lime_green;
+    }
+    else if (ns <= budget + budget / 2u) {
+      return colors::orange;
+    }
+    else {
+      return colors::red;
+    }
+  }
+
+  void record(const duration_type frameTime) noexcept
+  {
+    m_history[m_next] = frameTime.count();
+    m_next = (m_next + 1u) % history_size;
+    m_count = std::min(m_count + 1u, history_size);
+
+    m_histogram.record(frameTime);
+  }
+
+  void build_shapes()
+  {
+    m_shapes.clear();
+
+    const auto x = m_position.x();
+    const auto y = m_position.y();
+    const auto graphX = x + padding;
+    const auto graphY = y + padding;
+    const auto graphBottom = graphY + m_graphSize.height;
+
+    const auto width = std::max(m_graphSize.width, m_textSize.width) + 2 * padding;
+    const auto height = m_graphSize.height + m_textSize.height + 3 * padding;
+    m_shapes.add_quad({x, y, width, height}, {0, 0, 1, 1}, {0, 0, 0, 0xB0});
+
+    // The graph shows frame times up to twice the budget
+    const auto scale = m_graphSize.height / static_cast<float>(2u * m_budget.count());
+    const auto barWidth = m_graphSize.width / static_cast<float>(history_size);
+
+    // The oldest frame is drawn to the left, and the newest to the right
+    const auto first = (m_next + history_size - m_count) % history_size;
+    for (usize i = 0; i < m_count; ++i) {
+      const auto ns = m_history[(first + i) % history_size];
+      const auto barHeight = std::min(static_cast<float>(ns) * scale, m_graphSize.height);
+      const auto barX = graphX + static_cast<float>(history_size - m_count + i) * barWidth;
+
+      m_shapes.add_quad({barX, graphBottom - barHeight, barWidth, barHeight},
+                        {0, 0, 1, 1},
+                        frame_color(ns));
+    }
+
+    const auto budgetY = graphBottom - static_cast<float>(m_budget.count()) * scale;
+    m_shapes.add_quad({graphX, budgetY, m_graphSize.width, 1},
+                      {0, 0, 1, 1},
+                      {0xFF, 0xFF, 0xFF, 0x80});
+  }
+
+  template <typename T>
+  void refresh_text(const basic_renderer<T>& renderer)
+  {
+    m_text.clear();
+
+    const auto lineSkip = m_text.get_cache().get_font().line_skip();
+    ipoint position{static_cast<int>(m_position.x() + padding),
+                    static_cast<int>(m_position.y() + m_graphSize.height + 2 * padding)};
+
+    std::array<char, line_capacity> line{};
+    const auto addLine = [&](const int length, const color& tint) {
+      if (length > 0) {
+        const auto size = std::min(static_cast<usize>(length), line.size() - 1u);
+        m_text.add(std::string_view{line.data(), size}, position, tint);
+      }
+
+      position.set_y(position.y() + lineSkip);
+    };
+
+    const auto lastFrame = last_frame_time();
+    addLine(std::snprintf(line.data(),
+                           line.size(),
+                           "frame %.2f ms  p50 %.2f  p99 %.2f  max %.2f",
+                           to_ms(lastFrame),
+                           to_ms(m_histogram.percentile(0.5)),
+                           to_ms(m_histogram.percentile(0.99)),
+                           to_ms(m_histogram.max())),
+             frame_color(lastFrame.count()));
+
+    if (renderer.is_collecting_stats()) {
+      const auto& stats = renderer.frame_stats();
+      addLine(std::snprintf(line.data(),
+                             line.size(),
+                             "draws %zu  textures %zu  primitives %zu",
+                             without(stats.drawCalls, m_own.drawCalls),
+                             without(stats.textureSwitches, m_own.textureSwitches),
+                             without(stats.primitives, m_own.primitives)),
+               colors::white);
+    }
+    else {
+      addLine(std::snprintf(line.data(), line.size(), "draws n/a (stats disabled)"),
+               colors::gray);
+    }
+
+    if (m_zoneCount != 0) {
+      m_zones = profiler::zones();
+
+      const auto count = std::min(m_zoneCount, m_zones.size());
+      std::partial_sort(m_zones.begin(),
+                        m_zones.begin() + static_cast<std::ptrdiff_t>(count),
+                        m_zones.end(),
+                        [](const profile_zone_stats& a, const profile_zone_stats& b) {
+                          return a.last > b.last;
+                        });
+
+      for (usize index = 0; index < count; ++index) {
+        const auto& zone = m_zones[index];
+        addLine(std::snprintf(line.data(),
+                               line.size(),
+                               "%.*s %.3f ms x%llu",
+                               static_cast<int>(zone.name.size()),
+                               zone.name.data(),
+                               to_ms(zone.last),
+                               static_cast<unsigned long long>(zone.calls)),
+                 colors::light_sky_blue);
+      }
+    }
+
+    addLine(std::snprintf(line.data(), line.size(), "overlay %.3f ms", to_ms(m_cost)),
+             colors::light_gray);
+
+    update_text_size(position.y());
+  }
+
+  void update_text_size(const int bottom)
+  {
+    const auto left = m_position.x() + padding;
+    const auto top = m_position.y() + m_graphSize.height + 2 * padding;
+
+    auto right = left;
+    for (usize page = 0; page < m_text.page_count(); ++page) {
+      for (const auto& glyphVertex : m_text.vertices(page)) {
+        right = std::max(right, glyphVertex.position.x);
+      }
+    }
+
+    m_textSize = {right - left, std::max(static_cast<float>(bottom) - top, 0.0f)};
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_DEBUG_OVERLAY_HEADER
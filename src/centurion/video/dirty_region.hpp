@@ -0,0 +1,156 @@
+#ifndef CENTURION_DIRTY_REGION_HEADER
+#define CENTURION_DIRTY_REGION_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // min, max
+
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class dirty_region
+ *
+ * \brief Accumulates the modified area of a texture between uploads.
+ *
+ * \details A dirty region keeps track of the smallest rectangle that contains all areas
+ * that have been marked as modified, which makes it possible to only upload the changed
+ * pixels of a streaming texture, instead of the entire texture, see
+ * `basic_texture::upload()`.
+ *
+ * \details Marked areas are clipped to the bounds of the region, which should be the size
+ * of the associated texture.
+ *
+ * \since 6.4.0
+ */
+class dirty_region final
+{
+ public:
+  /**
+   * \brief Creates an empty dirty region.
+   *
+   * \param bounds the size of the tracked area, usually the size of a texture.
+   *
+   * \since 6.4.0
+   */
+  explicit dirty_region(const iarea bounds) noexcept : m_bounds{bounds}
+  {}
+
+  /**
+   * \brief Marks an area as modified.
+   *
+   * \details The area is merged with the previously marked areas, using `get_union()`.
+   * Areas outside of the bounds are ignored.
+   *
+   * \param area the area that has been modified.
+   *
+   * \since 6.4.0
+   */
+  void mark(const irect& area) noexcept
+  {
+    const auto x = std::max(area.x(), 0);
+    const auto y = std::max(area.y(), 0);
+    const auto maxX = std::min(area.max_x(), m_bounds.width);
+    const auto maxY = std::min(area.max_y(), m_bounds.height);
+
+    if (x < maxX && y < maxY) {
+      m_area = get_union(m_area, irect{x, y, maxX - x, maxY - y});
+    }
+  }
+
+  /**
+   * \brief Marks a single pixel as modified.
+   *
+   * \param pixel the pixel that has been modified.
+   *
+   * \since 6.4.0
+   */
+  void mark(const ipoint pixel) noexcept
+  {
+    mark(irect{pixel, {1, 1}});
+  }
+
+  /**
+   * \brief Marks the entire bounds as modified.
+   *
+   * \since 6.4.0
+   */
+  void mark_all() noexcept
+  {
+    m_area = irect{{0, 0}, m_bounds};
+  }
+
+  /**
+   * \brief Resets the region, i.e. nothing is considered to be modified.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_area = irect{};
+  }
+
+  /**
+   * \brief Indicates whether or not any area has been marked as modified.
+   *
+   * \return `true` if there are modified pixels; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_dirty() const noexcept -> bool
+  {
+    return m_area.has_area();
+  }
+
+  /**
+   * \brief Returns the smallest rectangle that contains all modified areas.
+   *
+   * \return the modified area; an empty rectangle if nothing has been modified.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto area() const noexcept -> const irect&
+  {
+    return m_area;
+  }
+
+  /**
+   * \brief Returns the size of the tracked area.
+   *
+   * \return the bounds of the region.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bounds() const noexcept -> iarea
+  {
+    return m_bounds;
+  }
+
+  /**
+   * \brief Returns the amount of pixels in the modified area.
+   *
+   * \return the number of pixels that would be uploaded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pixel_count() const noexcept -> usize
+  {
+    return static_cast<usize>(m_area.width()) * static_cast<usize>(m_area.height());
+  }
+
+ private:
+  iarea m_bounds;
+  irect m_area;
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_DIRTY_REGION_HEADER
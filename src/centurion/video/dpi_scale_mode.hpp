@@ -0,0 +1,88 @@
+#ifndef CENTURION_DPI_SCALE_MODE_HEADER
+#define CENTURION_DPI_SCALE_MODE_HEADER
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "../core/exception.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum dpi_scale_mode
+ *
+ * \brief Represents the ways in which a `dpi_scaler` maps logical content to the output.
+ *
+ * \see `dpi_scaler`
+ *
+ * \since 6.4.0
+ */
+enum class dpi_scale_mode
+{
+  integer,    ///< The renderer scales the logical size by an integer factor.
+  fractional  ///< Content is rendered at output size, with rescaled fonts.
+};
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied DPI scale mode.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(dpi_scale_mode::integer) == "integer"`.
+ *
+ * \param mode the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const dpi_scale_mode mode) -> std::string_view
+{
+  switch (mode) {
+    case dpi_scale_mode::integer:
+      return "integer";
+
+    case dpi_scale_mode::fractional:
+      return "fractional";
+
+    default:
+      throw cen_error{"Did not recognize DPI scale mode!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a DPI scale mode enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param mode the enumerator that will be printed.
+ *
+ * \see `to_string(dpi_scale_mode)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const dpi_scale_mode mode) -> std::ostream&
+{
+  return stream << to_string(mode);
+}
+
+/// \} End of streaming
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_DPI_SCALE_MODE_HEADER
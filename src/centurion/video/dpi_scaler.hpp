@@ -0,0 +1,408 @@
+#ifndef CENTURION_DPI_SCALER_HEADER
+#define CENTURION_DPI_SCALER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // min, max, remove_if
+#include <cassert>    // assert
+#include <cmath>      // round, abs
+#include <optional>   // optional
+#include <string>     // string
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../events/window_event.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "dpi_scale_mode.hpp"
+#include "font.hpp"
+#include "font_cache.hpp"
+#include "renderer.hpp"
+#include "screen.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class dpi_scaler
+ *
+ * \brief Maps content designed for a logical size to the pixels of a high-DPI output.
+ *
+ * \details The scale factor is the largest factor by which the logical size fits in the
+ * output size of the renderer, which on high-DPI displays is larger than the window size.
+ * The scaler then selects one of two scale modes.
+ *
+ * \details If the scale factor is an integer, the integer mode is used, i.e. the logical
+ * size of the renderer is set and integer scaling is enabled, so the renderer scales all
+ * rendering, and content is pixel-exact. Fonts keep their base size.
+ *
+ * \details Otherwise, the fractional mode is used, i.e. the logical size of the renderer
+ * is disabled, so that content is rendered directly at output resolution. Coordinates
+ * should be converted with `to_output()`, and fonts are rendered at their base size
+ * multiplied by the scale factor, which keeps text sharp.
+ * \code{cpp}
+ *   cen::dpi_scaler scaler{window, renderer, {1280, 720}};
+ *   scaler.add_font(labels, "resources/label_font.ttf", 14);
+ *
+ *   dispatcher.bind<cen::window_event>().to([&](const cen::window_event& event) {
+ *     scaler.handle(event);
+ *   });
+ *
+ *   // Every frame
+ *   renderer.fill_rect(scaler.to_output(cen::frect{10, 10, 200, 40}));
+ *   const auto position = scaler.to_output(cen::fpoint{20, 20});
+ *   renderer.render_text(labels, "Hello", cen::cast<cen::ipoint>(position));
+ * \endcode
+ *
+ * \details Registered font caches are rebuilt with a font of the new size whenever the
+ * font scale changes, e.g. when the window is resized or moved to another display, see
+ * `font_cache::rebuild()`.
+ *
+ * \note The window, the renderer and all registered font caches must outlive the scaler,
+ * or be removed before they are destroyed.
+ *
+ * \see `dpi_scale_mode`
+ * \see `basic_renderer::set_logical_integer_scaling()`
+ *
+ * \since 6.4.0
+ */
+class dpi_scaler final
+{
+ public:
+  /**
+   * \brief Creates a DPI scaler, and applies the initial scale mode.
+   *
+   * \tparam W the ownership semantics of the window.
+   * \tparam R the ownership semantics of the renderer.
+   *
+   * \param window the window that is rendered to.
+   * \param renderer the renderer associated with the window.
+   * \param logicalSize the size that content is designed for, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  template <typename W, typename R>
+  dpi_scaler(const basic_window<W>& window,
+             const basic_renderer<R>& renderer,
+             const iarea logicalSize)
+      : m_window{window.get()}
+      , m_renderer{renderer.get()}
+      , m_logicalSize{logicalSize}
+  {
+    assert(m_window.get());
+    assert(m_renderer.get());
+    assert(logicalSize.width > 0 && logicalSize.height > 0);
+    update();
+  }
+
+  /**
+   * \brief Registers a font cache, which is rebuilt whenever the font scale changes.
+   *
+   * \details The font cache is rebuilt immediately if the size of its current font
+   * doesn't match the scaled base size. The style of the current font is preserved.
+   *
+   * \param cache the font cache that will be rescaled.
+   * \param file the path of the font file, used to reopen the font at other sizes.
+   * \param size the base size of the font, i.e. the size at a scale of one.
+   *
+   * \throws ttf_error if the font cannot be reopened.
+   *
+   * \since 6.4.0
+   */
+  void add_font(font_cache& cache, std::string file, const int size)
+  {
+    assert(size > 0);
+
+    remove_font(cache);
+
+    auto& entry = m_fonts.emplace_back(font_entry{&cache, std::move(file), size});
+    rescale(entry);
+  }
+
+  /**
+   * \brief Unregisters a font cache.
+   *
+   * \details Nothing happens if the font cache isn't registered.
+   *
+   * \param cache the font cache that will no longer be rescaled.
+   *
+   * \since 6.4.0
+   */
+  void remove_font(const font_cache& cache) noexcept
+  {
+    const auto iter = std::remove_if(m_fonts.begin(),
+                                     m_fonts.end(),
+                                     [&](const font_entry& entry) {
+                                       return entry.cache == &cache;
+                                     });
+    m_fonts.erase(iter, m_fonts.end());
+  }
+
+  /**
+   * \brief Recomputes the scale, and applies the scale mode if the scale changed.
+   *
+   * \details This is called automatically by `handle()`, but must be called manually if
+   * the window is changed without dispatching window events.
+   *
+   * \return `true` if the scale or scale mode changed; `false` otherwise.
+   *
+   * \throws ttf_error if a registered font cannot be reopened.
+   *
+   * \since 6.4.0
+   */
+  auto update() -> bool
+  {
+    const auto index = m_window.display_index();
+    if (index != m_displayIndex || !m_dpi) {
+      m_displayIndex = index;
+      m_dpi = screen::dpi(index.value_or(0));
+    }
+
+    const auto output = cast<farea>(m_renderer.output_size());
+    const auto logical = cast<farea>(m_logicalSize);
+
+    const auto fit = std::min(output.width / logical.width, output.height / logical.height);
+    auto scale = std::max(fit, min_scale);
+
+    const auto rounded = std::round(scale);
+    const auto mode = (rounded >= 1.0f && std::abs(scale - rounded) < integer_tolerance)
+                          ? dpi_scale_mode::integer
+                          : dpi_scale_mode::fractional;
+
+    if (mode == dpi_scale_mode::integer) {
+      scale = rounded;
+    }
+
+    const fpoint offset{(output.width - logical.width * scale) / 2.0f,
+                        (output.height - logical.height * scale) / 2.0f};
+
+    if (m_initialized && mode == m_mode && scale == m_scale && offset == m_offset) {
+      return false;
+    }
+
+    m_initialized = true;
+    m_mode = mode;
+    m_scale = scale;
+    m_offset = offset;
+
+    if (m_mode == dpi_scale_mode::integer) {
+      m_renderer.set_logical_size(m_logicalSize);
+      m_renderer.set_logical_integer_scaling(true);
+    }
+    else {
+      m_renderer.set_logical_integer_scaling(false);
+      m_renderer.set_logical_size({0, 0});
+    }
+
+    for (auto& entry : m_fonts) {
+      rescale(entry);
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Updates the scale in response to a window event.
+   *
+   * \details The scale is recomputed when the window changes size or is moved, since it
+   * might have been moved to a display with a different DPI. Events for other windows are
+   * ignored.
+   *
+   * \param event the window event.
+   *
+   * \throws ttf_error if a registered font cannot be reopened.
+   *
+   * \since 6.4.0
+   */
+  void handle(const window_event& event)
+  {
+    if (event.get().windowID != m_window.id()) {
+      return;
+    }
+
+    switch (event.event_id()) {
+      case window_event_id::size_changed:
+      case window_event_id::resized:
+      case window_event_id::maximized:
+      case window_event_id::restored:
+      case window_event_id::moved:
+        update();
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  /**
+   * \brief Converts a point in logical coordinates to output coordinates.
+   *
+   * \details In the integer mode, the renderer converts coordinates itself, so the point is
+   * returned unchanged.
+   *
+   * \param point the point in logical coordinates.
+   *
+   * \return the point in the coordinates that should be supplied to the renderer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto to_output(const fpoint& point) const noexcept -> fpoint
+  {
+    if (m_mode == dpi_scale_mode::integer) {
+      return point;
+    }
+
+    return {m_offset.x() + point.x() * m_scale, m_offset.y() + point.y() * m_scale};
+  }
+
+  /**
+   * \brief Converts a rectangle in logical coordinates to output coordinates.
+   *
+   * \param rect the rectangle in logical coordinates.
+   *
+   * \return the rectangle in the coordinates that should be supplied to the renderer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto to_output(const frect& rect) const noexcept -> frect
+  {
+    if (m_mode == dpi_scale_mode::integer) {
+      return rect;
+    }
+
+    const farea size{rect.width() * m_scale, rect.height() * m_scale};
+    return {to_output(rect.position()), size};
+  }
+
+  /**
+   * \brief Returns the size at which a font of the supplied base size should be rendered.
+   *
+   * \param size the base size of the font.
+   *
+   * \return the scaled font size, at least one.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto font_size(const int size) const noexcept -> int
+  {
+    return std::max(1, static_cast<int>(std::round(static_cast<float>(size) * font_scale())));
+  }
+
+  /**
+   * \brief Returns the factor by which fonts are scaled.
+   *
+   * \return the scale factor in the fractional mode; one in the integer mode.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto font_scale() const noexcept -> float
+  {
+    return (m_mode == dpi_scale_mode::integer) ? 1.0f : m_scale;
+  }
+
+  /**
+   * \brief Returns the factor by which logical content is scaled to the output.
+   *
+   * \return the scale factor.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto scale() const noexcept -> float
+  {
+    return m_scale;
+  }
+
+  /**
+   * \brief Returns the current scale mode.
+   *
+   * \return the scale mode.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto mode() const noexcept -> dpi_scale_mode
+  {
+    return m_mode;
+  }
+
+  /**
+   * \brief Returns the size that content is designed for.
+   *
+   * \return the logical size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto logical_size() const noexcept -> iarea
+  {
+    return m_logicalSize;
+  }
+
+  /**
+   * \brief Returns the DPI of the display that the window is on.
+   *
+   * \details The DPI is only queried again when the window moves to another display.
+   *
+   * \return the display DPI; `std::nullopt` if it couldn't be obtained.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dpi() const noexcept -> const std::optional<dpi_info>&
+  {
+    return m_dpi;
+  }
+
+ private:
+  struct font_entry final
+  {
+    font_cache* cache{};
+    std::string file;
+    int size{};
+  };
+
+  /// The smallest scale factor, to avoid degenerate fonts and coordinates.
+  inline constexpr static float min_scale = 0.1f;
+
+  /// The largest difference to an integer, for which a scale factor is considered integral.
+  inline constexpr static float integer_tolerance = 0.01f;
+
+  window_handle m_window;
+  renderer_handle m_renderer;
+  iarea m_logicalSize;
+  fpoint m_offset;
+  float m_scale{1};
+  dpi_scale_mode m_mode{dpi_scale_mode::integer};
+  std::optional<int> m_displayIndex;
+  std::optional<dpi_info> m_dpi;
+  std::vector<font_entry> m_fonts;
+  bool m_initialized{};
+
+  void rescale(font_entry& entry)
+  {
+    const auto size = font_size(entry.size);
+    const auto& current = entry.cache->get_font();
+
+    if (current.size() == size) {
+      return;
+    }
+
+    font scaled{entry.file, size};
+    scaled.set_bold(current.is_bold());
+    scaled.set_italic(current.is_italic());
+    scaled.set_underlined(current.is_underlined());
+    scaled.set_strikethrough(current.is_strikethrough());
+    scaled.set_outline(current.outline());
+    scaled.set_kerning(current.has_kerning());
+
+    entry.cache->rebuild(m_renderer, std::move(scaled));
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_DPI_SCALER_HEADER
@@ -6,11 +6,14 @@
 #include <SDL2/SDL_ttf.h>
 
 #include <cassert>      // assert
-#include <memory>       // unique_ptr
+#include <cstddef>      // byte
+#include <memory>       // unique_ptr, shared_ptr
 #include <optional>     // optional
 #include <ostream>      // ostream
 #include <string>       // string, to_string
 #include <string_view>  // string_view
+#include <utility>      // move
+#include <vector>       // vector
 
 #include "../compiler/features.hpp"
 
@@ -21,13 +24,30 @@
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
 #include "../core/exception.hpp"
+#include "../core/expected.hpp"
+#include "../core/library.hpp"
 #include "../core/not_null.hpp"
+#include "../core/owner.hpp"
+#include "../core/result.hpp"
 #include "../core/str.hpp"
 #include "../core/to_underlying.hpp"
 #include "../detail/address_of.hpp"
+#include "../filesystem/file.hpp"
 #include "../math/area.hpp"
+#include "../system/startup_tracer.hpp"
 #include "unicode_string.hpp"
 
+// Per-font text direction and script, which SDL_ttf uses when shaping with HarfBuzz
+#ifdef SDL_TTF_VERSION_ATLEAST
+#if SDL_TTF_VERSION_ATLEAST(2, 20, 0)
+#define CENTURION_HAS_FEATURE_TTF_SHAPING 1
+#endif  // SDL_TTF_VERSION_ATLEAST(2, 20, 0)
+#endif  // SDL_TTF_VERSION_ATLEAST
+
+#ifndef CENTURION_HAS_FEATURE_TTF_SHAPING
+#define CENTURION_HAS_FEATURE_TTF_SHAPING 0
+#endif  // CENTURION_HAS_FEATURE_TTF_SHAPING
+
 namespace cen {
 
 /// \addtogroup video
@@ -125,6 +145,87 @@ inline auto operator<<(std::ostream& stream, const font_hint hint) -> std::ostre
 
 /// \} End of streaming
 
+#if CENTURION_HAS_FEATURE_TTF_SHAPING
+
+/**
+ * \enum text_direction
+ *
+ * \brief Provides the different directions that text can be shaped in.
+ *
+ * \since 6.4.0
+ */
+enum class text_direction : int
+{
+  left_to_right = TTF_DIRECTION_LTR,
+  right_to_left = TTF_DIRECTION_RTL,
+  top_to_bottom = TTF_DIRECTION_TTB,
+  bottom_to_top = TTF_DIRECTION_BTT
+};
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied text direction.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(text_direction::right_to_left) == "right_to_left"`.
+ *
+ * \param direction the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const text_direction direction) -> std::string_view
+{
+  switch (direction) {
+    case text_direction::left_to_right:
+      return "left_to_right";
+
+    case text_direction::right_to_left:
+      return "right_to_left";
+
+    case text_direction::top_to_bottom:
+      return "top_to_bottom";
+
+    case text_direction::bottom_to_top:
+      return "bottom_to_top";
+
+    default:
+      throw cen_error{"Did not recognize text direction!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a text direction enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param direction the enumerator that will be printed.
+ *
+ * \see `to_string(text_direction)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const text_direction direction)
+    -> std::ostream&
+{
+  return stream << to_string(direction);
+}
+
+/// \} End of streaming
+
+#endif  // CENTURION_HAS_FEATURE_TTF_SHAPING
+
 /**
  * \class font
  *
@@ -156,12 +257,16 @@ class font final
    */
   font(const not_null<str> file, const int size) : m_size{size}
   {
+    const startup_scope trace{"font"};
+
     assert(file);
 
     if (size <= 0) {
       throw cen_error{"Bad font size!"};
     }
 
+    library::ensure(library_subsystem::ttf);
+
     m_font.reset(TTF_OpenFont(file, size));
     if (!m_font) {
       throw ttf_error{};
@@ -182,6 +287,118 @@ class font final
   font(const std::string& file, const int size) : font{file.c_str(), size}
   {}
 
+  /**
+   * \brief Creates a font based on the TrueType data of an open file.
+   *
+   * \details The font reads glyph data from the file on demand, so the font takes
+   * ownership of the file, and closes it when the font is destroyed. Fonts in packed
+   * archives can therefore only be loaded from archives that outlive the font.
+   *
+   * \param source the file that the font data is read from, must be valid.
+   * \param size the font size, must be greater than zero.
+   *
+   * \throws cen_error if the supplied size is not greater than zero.
+   * \throws ttf_error if the font cannot be loaded.
+   *
+   * \see `TTF_OpenFontRW`
+   *
+   * \since 6.4.0
+   */
+  font(file source, const int size) : m_size{size}
+  {
+    const startup_scope trace{"font"};
+
+    assert(source);
+
+    if (size <= 0) {
+      throw cen_error{"Bad font size!"};
+    }
+
+    library::ensure(library_subsystem::ttf);
+
+    m_font.reset(TTF_OpenFontRW(source.release(), 1, size));
+    if (!m_font) {
+      throw ttf_error{};
+    }
+  }
+
+  /**
+   * \brief Creates a font based on TrueType data in memory.
+   *
+   * \details The font reads glyph data from the buffer on demand, so the font shares
+   * ownership of the buffer with other fonts created from it. This makes it possible to
+   * open a font at several sizes, or with different styles, while only reading and storing
+   * the font file once.
+   *
+   * \param data the contents of a TrueType font file, mustn't be null.
+   * \param size the font size, must be greater than zero.
+   *
+   * \throws cen_error if the supplied size is not greater than zero.
+   * \throws ttf_error if the font cannot be loaded.
+   *
+   * \see `font_pool`
+   * \see `TTF_OpenFontRW`
+   *
+   * \since 6.4.0
+   */
+  font(std::shared_ptr<const std::vector<std::byte>> data, const int size)
+      : m_data{std::move(data)}
+      , m_size{size}
+  {
+    const startup_scope trace{"font"};
+
+    assert(m_data);
+
+    if (size <= 0) {
+      throw cen_error{"Bad font size!"};
+    }
+
+    library::ensure(library_subsystem::ttf);
+
+    auto* source = SDL_RWFromConstMem(m_data->data(), static_cast<int>(m_data->size()));
+    m_font.reset(TTF_OpenFontRW(source, 1, size));
+    if (!m_font) {
+      throw ttf_error{};
+    }
+  }
+
+  /**
+   * \brief Attempts to load a font based on a TrueType font file, without throwing.
+   *
+   * \param file the file path of the TrueType font file, cannot be null.
+   * \param size the font size, must be greater than zero.
+   *
+   * \return the loaded font; an `error_code::bad_argument` error if the size is not greater
+   * than zero, or an `error_code::ttf` error if the font couldn't be loaded.
+   *
+   * \see `expected`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto try_load(const not_null<str> file, const int size) noexcept
+      -> expected<font>
+  {
+    assert(file);
+
+    if (size <= 0) {
+      return error_info{error_code::bad_argument, "Bad font size!"};
+    }
+
+    if (auto* loaded = TTF_OpenFont(file, size)) {
+      return font{loaded, size};
+    }
+    else {
+      return error_info{error_code::ttf};
+    }
+  }
+
+  /// \copydoc try_load()
+  [[nodiscard]] static auto try_load(const std::string& file, const int size) noexcept
+      -> expected<font>
+  {
+    return try_load(file.c_str(), size);
+  }
+
   /// \} End of construction
 
   /// \name Style functions
@@ -304,6 +521,57 @@ class font final
     TTF_SetFontKerning(m_font.get(), kerning ? 1 : 0);
   }
 
+#if CENTURION_HAS_FEATURE_TTF_SHAPING
+
+  /**
+   * \brief Sets the direction that strings rendered with the font are shaped in.
+   *
+   * \details Along with the script, the direction is used by SDL_ttf to shape complex
+   * scripts, such as Arabic and Devanagari, when rendering UTF-8 strings.
+   *
+   * \note This requires SDL_ttf to be built with HarfBuzz.
+   *
+   * \param direction the direction of the text.
+   *
+   * \return `success` if the direction was set; `failure` otherwise.
+   *
+   * \see `set_script()`
+   *
+   * \since 6.4.0
+   */
+  auto set_direction(const text_direction direction) noexcept -> result
+  {
+    return TTF_SetFontDirection(m_font.get(),
+                                static_cast<TTF_Direction>(to_underlying(direction))) == 0;
+  }
+
+  /**
+   * \brief Sets the script that strings rendered with the font are shaped as.
+   *
+   * \note This requires SDL_ttf to be built with HarfBuzz.
+   *
+   * \param script an ISO 15924 script code, e.g. `"Arab"` or `"Deva"`.
+   *
+   * \return `success` if the script was set; `failure` otherwise.
+   *
+   * \see `set_direction()`
+   *
+   * \since 6.4.0
+   */
+  auto set_script(const not_null<str> script) noexcept -> result
+  {
+    assert(script);
+    return TTF_SetFontScriptName(m_font.get(), script) == 0;
+  }
+
+  /// \copydoc set_script(not_null<str>)
+  auto set_script(const std::string& script) noexcept -> result
+  {
+    return set_script(script.c_str());
+  }
+
+#endif  // CENTURION_HAS_FEATURE_TTF_SHAPING
+
   /**
    * \brief Indicates whether or not the font is bold.
    *
@@ -602,6 +870,9 @@ class font final
   /**
    * \brief Returns the size of the supplied string, if it was rendered using the font.
    *
+   * \note The width includes trailing spaces, unlike `font_cache::measure()`, which
+   * excludes the trailing spaces of each line.
+   *
    * \param str the string to determine the size of, can't be null.
    *
    * \return the size of the string, if it was rendered using the font; `std::nullopt` if
@@ -626,6 +897,8 @@ class font final
   /**
    * \brief Returns the size of the supplied string, if it was rendered using the font.
    *
+   * \note The width includes trailing spaces, unlike `font_cache::measure()`.
+   *
    * \param str the string to determine the size of.
    *
    * \return the size of the string, if it was rendered using the font; `std::nullopt` if
@@ -766,9 +1039,14 @@ class font final
     }
   };
 
+  std::shared_ptr<const std::vector<std::byte>> m_data;  // Must outlive the font handle
   std::unique_ptr<TTF_Font, deleter> m_font;
   int m_size{};
 
+  // Used by try_load(), the font pointer must not be null
+  font(owner<TTF_Font*> font, const int size) noexcept : m_font{font}, m_size{size}
+  {}
+
   /**
    * \brief Enables the font style associated with the supplied bit mask.
    *
@@ -5,16 +5,35 @@
 
 #include <SDL2/SDL_ttf.h>
 
-#include <cassert>        // assert
-#include <string>         // string
-#include <unordered_map>  // unordered_map
-#include <utility>        // move, forward
+#include <algorithm>  // max, min, all_of, fill_n
+#include <cassert>    // assert
+#include <cstddef>    // byte
+#include <cstring>    // memcmp, memcpy
+#include <optional>   // optional, nullopt
+#include <string>     // string
+#include <tuple>      // tuple
+#include <utility>    // move, forward
+#include <vector>     // vector
 
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
 #include "../core/not_null.hpp"
+#include "../core/result.hpp"
 #include "../core/str.hpp"
+#include "../filesystem/file.hpp"
+#include "../filesystem/mapped_file.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/allocation_tracker.hpp"
+#include "../system/profiler_macros.hpp"
+#include "../thread/task_scheduler.hpp"
+#include "blend_mode.hpp"
 #include "font.hpp"
+#include "font_pool.hpp"
+#include "pixel_format.hpp"
 #include "surface.hpp"
 #include "texture.hpp"
+#include "texture_access.hpp"
 #include "unicode_string.hpp"
 
 namespace cen {
@@ -42,6 +61,11 @@ namespace cen {
  * render at compile-time. Use this option if you know that you're going to render some
  * specific string a lot.
  *
+ * Furthermore, the glyph cache can be configured to use a glyph atlas, see `use_atlas()`.
+ * In this mode, glyphs are packed into a few large textures instead of being stored in
+ * separate textures, which means that rendering a string only binds a single texture
+ * (for most strings), which in turn enables the renderer to batch the glyphs.
+ *
  * \since 5.0.0
  */
 class font_cache final
@@ -62,6 +86,49 @@ class font_cache final
     glyph_metrics metrics;  ///< The metrics of the glyph.
   };
 
+  /**
+   * \struct atlas_glyph
+   *
+   * \brief Describes a glyph that has been packed into a glyph atlas page.
+   *
+   * \since 6.4.0
+   */
+  struct atlas_glyph final
+  {
+    irect source;           ///< The area of the glyph in the atlas page.
+    glyph_metrics metrics;  ///< The metrics of the glyph.
+    usize page{};           ///< The index of the atlas page that contains the glyph.
+  };
+
+  /**
+   * \struct shaped_run
+   *
+   * \brief Describes a shaped string that has been packed into a glyph atlas page.
+   *
+   * \see `store_shaped_utf8()`
+   *
+   * \since 6.4.0
+   */
+  struct shaped_run final
+  {
+    irect source;   ///< The area of the run in the atlas page.
+    usize page{};   ///< The index of the atlas page that contains the run.
+  };
+
+  /**
+   * \struct atlas_stats
+   *
+   * \brief Provides statistics about glyph atlas lookups made with `request_glyph()`.
+   *
+   * \since 6.4.0
+   */
+  struct atlas_stats final
+  {
+    usize hits{};       ///< The amount of requested glyphs that were already in the atlas.
+    usize misses{};     ///< The amount of requested glyphs that were not in the atlas.
+    usize evictions{};  ///< The amount of glyphs that have been evicted from the atlas.
+  };
+
   /// \name Construction
   /// \{
 
@@ -488,6 +555,111 @@ class font_cache final
     store(id, renderer.render_solid_unicode(string, get_font()));
   }
 
+  /**
+   * \brief Updates the cached string texture associated with an ID.
+   *
+   * \details Unlike `store_blended_utf8()`, this function reuses the previous texture
+   * associated with the ID, by uploading the new string into it. A new (streaming)
+   * texture is only created if there is no previous texture, or if the new string doesn't
+   * fit in the previous texture. This makes this function suitable for strings that
+   * change frequently, e.g. every frame.
+   *
+   * \note Since the texture might be larger than the rendered string, the area outside of
+   * the string is fully transparent. Use `get_stored_size()` to obtain the size of the
+   * string itself.
+   *
+   * \tparam Renderer the type of the renderer that will be used.
+   *
+   * \param id the identifier that will be associated with the texture.
+   * \param string the string that will be cached.
+   * \param renderer the renderer that will be used to create the string texture.
+   *
+   * \throws sdl_error if the string couldn't be rendered or uploaded.
+   *
+   * \see `store_blended_utf8()`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void update_blended_utf8(const id_type id, const not_null<str> string, Renderer& renderer)
+  {
+    assert(string);
+    const auto color = renderer.get_color().get();
+    update(id, renderer, surface{TTF_RenderUTF8_Blended(m_font.get(), string, color)});
+  }
+
+  /**
+   * \see update_blended_utf8()
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void update_blended_utf8(const id_type id, const std::string& string, Renderer& renderer)
+  {
+    update_blended_utf8(id, string.c_str(), renderer);
+  }
+
+  /**
+   * \brief Updates the cached string texture associated with an ID.
+   *
+   * \details See `update_blended_utf8()` for details about how textures are reused.
+   *
+   * \tparam Renderer the type of the renderer that will be used.
+   *
+   * \param id the identifier that will be associated with the texture.
+   * \param string the string that will be cached.
+   * \param renderer the renderer that will be used to create the string texture.
+   *
+   * \throws sdl_error if the string couldn't be rendered or uploaded.
+   *
+   * \see `store_blended_latin1()`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void update_blended_latin1(const id_type id, const not_null<str> string, Renderer& renderer)
+  {
+    assert(string);
+    const auto color = renderer.get_color().get();
+    update(id, renderer, surface{TTF_RenderText_Blended(m_font.get(), string, color)});
+  }
+
+  /**
+   * \see update_blended_latin1()
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void update_blended_latin1(const id_type id, const std::string& string, Renderer& renderer)
+  {
+    update_blended_latin1(id, string.c_str(), renderer);
+  }
+
+  /**
+   * \brief Updates the cached string texture associated with an ID.
+   *
+   * \details See `update_blended_utf8()` for details about how textures are reused.
+   *
+   * \tparam Renderer the type of the renderer that will be used.
+   *
+   * \param id the identifier that will be associated with the texture.
+   * \param string the string that will be cached.
+   * \param renderer the renderer that will be used to create the string texture.
+   *
+   * \throws sdl_error if the string couldn't be rendered or uploaded.
+   *
+   * \see `store_blended_unicode()`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void update_blended_unicode(const id_type id,
+                              const unicode_string& string,
+                              Renderer& renderer)
+  {
+    const auto color = renderer.get_color().get();
+    const surface rendered{TTF_RenderUNICODE_Blended(m_font.get(), string.data(), color)};
+    update(id, renderer, rendered);
+  }
+
   /**
    * \brief Indicates whether or not there is a cached string texture associated with the
    * specified key.
@@ -517,7 +689,27 @@ class font_cache final
    */
   [[nodiscard]] auto get_stored(const id_type id) const -> const texture&
   {
-    return m_strings.at(id);
+    return m_strings.at(id).cached;
+  }
+
+  /**
+   * \brief Returns the size of the cached string associated with the specified ID.
+   *
+   * \details The returned size is the same as the texture size for strings cached with
+   * the `store_*()` functions, but might be smaller for strings cached with the
+   * `update_*()` functions, since those reuse larger textures.
+   *
+   * \pre `id` **must** be associated with a cached string texture.
+   *
+   * \param id the key of the cached string.
+   *
+   * \return the size of the rendered string.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_stored_size(const id_type id) const -> iarea
+  {
+    return m_strings.at(id).size;
   }
 
   /**
@@ -537,7 +729,7 @@ class font_cache final
   {
     const auto iterator = m_strings.find(id);
     if (iterator != m_strings.end()) {
-      return &iterator->second;
+      return &iterator->second.cached;
     }
     else {
       return nullptr;
@@ -553,7 +745,8 @@ class font_cache final
    * \brief Adds a glyph to the font cache.
    *
    * \details This function has no effect if the supplied glyph isn't provided by the
-   * associated font, or if the supplied glyph has already been cached.
+   * associated font, or if the supplied glyph has already been cached. If the glyph atlas
+   * is used, the glyph is packed into an atlas page instead of getting its own texture.
    *
    * \tparam Renderer the type of the renderer.
    *
@@ -569,8 +762,16 @@ class font_cache final
       return;
     }
 
-    glyph_data data{create_glyph_texture(renderer, glyph), m_font.get_metrics(glyph).value()};
-    m_glyphs.try_emplace(glyph, std::move(data));
+    CENTURION_PROFILE_ZONE("font_cache::add_glyph");
+
+    if (m_useAtlas) {
+      add_atlas_glyph(renderer, glyph);
+    }
+    else {
+      glyph_data data{create_glyph_texture(renderer, glyph),
+                      m_font.get_metrics(glyph).value()};
+      m_glyphs.try_emplace(glyph, std::move(data));
+    }
   }
 
   /**
@@ -598,6 +799,99 @@ class font_cache final
     }
   }
 
+  /**
+   * \brief Caches the glyphs in the specified range, and rasterizes them in parallel.
+   *
+   * \details This function is equivalent to `add_range(Renderer&, unicode, unicode)`, but
+   * the glyphs are rendered on the worker threads of a task scheduler, which makes warming
+   * up a cache with many glyphs considerably faster. Every worker renders with its own
+   * instance of the font, which is created from the font data of the supplied pool, with
+   * the same style, outline, hinting and kerning as the font of the cache. The rendered
+   * glyphs are then uploaded, or packed into the glyph atlas, on the calling thread.
+   * \code{cpp}
+   *   const cen::font_pool pool{"resources/fira_code.ttf"};
+   *   cen::font_cache cache{pool.make_font(16)};
+   *
+   *   cache.use_atlas();
+   *   cache.add_range(renderer, scheduler, pool, 0x20, 0x3000);
+   * \endcode
+   *
+   * \note This function must be called on the thread that uses the renderer.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the glyph textures.
+   * \param scheduler the scheduler that rasterizes the glyphs.
+   * \param pool the font pool that provides the font data of the font used by the cache.
+   * \param begin the first glyph that will be included.
+   * \param end the "end" glyph in the range, will not be included.
+   *
+   * \throws cen_error if a glyph couldn't be rendered, or doesn't fit in the atlas.
+   * \throws ttf_error if the worker fonts couldn't be created.
+   *
+   * \see `font_pool`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_range(Renderer& renderer,
+                 task_scheduler& scheduler,
+                 const font_pool& pool,
+                 const unicode begin,
+                 const unicode end)
+  {
+    CENTURION_PROFILE_ZONE("font_cache::add_range");
+
+    std::vector<unicode> glyphs;
+    for (auto glyph = begin; glyph < end; ++glyph) {
+      if (!has(glyph) && m_font.is_glyph_provided(glyph)) {
+        glyphs.push_back(glyph);
+      }
+    }
+
+    if (glyphs.empty()) {
+      return;
+    }
+
+    // FreeType faces must not be created or used concurrently, so each worker gets a font
+    // that is created (and destroyed) on this thread
+    const auto workers = std::max(usize{1}, std::min(scheduler.worker_count(), glyphs.size()));
+    std::vector<font> fonts;
+    fonts.reserve(workers);
+    for (usize index = 0; index < workers; ++index) {
+      fonts.push_back(make_worker_font(pool));
+    }
+
+    const auto color = renderer.get_color().get();
+    const auto chunk = glyphs.size() / workers + (glyphs.size() % workers != 0 ? 1 : 0);
+
+    std::vector<std::optional<surface>> rendered(glyphs.size());
+    scheduler.parallel_for(
+        0,
+        workers,
+        [&](const usize worker) {
+          auto* handle = fonts[worker].get();
+
+          const auto first = worker * chunk;
+          const auto last = std::min(first + chunk, glyphs.size());
+          for (auto index = first; index < last; ++index) {
+            if (auto* glyph = TTF_RenderGlyph_Blended(handle, glyphs[index], color)) {
+              rendered[index].emplace(glyph);
+            }
+          }
+        },
+        1);
+
+    for (usize index = 0; index < glyphs.size(); ++index) {
+      if (!rendered[index]) {
+        throw cen_error{"Failed to render glyph!"};
+      }
+
+      add_rendered_glyph(renderer, glyphs[index], *rendered[index]);
+      rendered[index].reset();
+    }
+  }
+
   /**
    * \brief Attempts to cache all printable basic latin characters.
    *
@@ -656,6 +950,8 @@ class font_cache final
   /**
    * \brief Indicates whether or not the specified glyph has been cached.
    *
+   * \note This function checks both individual glyph textures and the glyph atlas.
+   *
    * \param glyph the glyph to check.
    *
    * \return `true` if the specified glyph has been cached; `false` otherwise.
@@ -664,7 +960,35 @@ class font_cache final
    */
   [[nodiscard]] auto has(const unicode glyph) const noexcept -> bool
   {
-    return m_glyphs.count(glyph);
+    return m_glyphs.count(glyph) || m_atlasGlyphs.count(glyph);
+  }
+
+  /**
+   * \brief Indicates whether or not all glyphs in a string have been cached.
+   *
+   * \details Newline characters are ignored, since they aren't rendered.
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters, e.g. `unicode_string` or `utf8_view`.
+   *
+   * \param str the string to check.
+   *
+   * \return `true` if every glyph in the string has been cached; `false` otherwise.
+   *
+   * \see `has()`
+   *
+   * \since 6.4.0
+   */
+  template <typename String>
+  [[nodiscard]] auto has_all(const String& str) const -> bool
+  {
+    for (const unicode glyph : str) {
+      if (glyph != '\n' && !has(glyph)) {
+        return false;
+      }
+    }
+
+    return true;
   }
 
   /**
@@ -727,59 +1051,1556 @@ class font_cache final
     }
   }
 
+  /**
+   * \brief Returns the metrics of a cached glyph.
+   *
+   * \note This function checks both individual glyph textures and the glyph atlas.
+   *
+   * \param glyph the glyph to look up the metrics for.
+   *
+   * \return a pointer to the metrics of the glyph; a null pointer if the glyph hasn't been
+   * cached.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_metrics(const unicode glyph) const -> const glyph_metrics*
+  {
+    if (const auto* atlasData = try_at_atlas(glyph)) {
+      return &atlasData->metrics;
+    }
+    else if (const auto* data = try_at(glyph)) {
+      return &data->metrics;
+    }
+    else {
+      return nullptr;
+    }
+  }
+
   /// \} End of glyph texture caching
 
+  /// \name Glyph atlas
+  /// \{
+
   /**
-   * \brief Returns the font used by the cache.
+   * \brief Makes subsequently added glyphs get packed into a glyph atlas.
    *
-   * \return a reference to the internal font.
+   * \details When the atlas is used, glyphs are rendered into a set of large "pages"
+   * instead of individual textures. Glyphs are packed in rows, and a new page is created
+   * when the current page is full. Glyphs that have already been cached as individual
+   * textures are not affected.
    *
-   * \since 5.0.0
+   * \note The page size only affects pages that are created after this call.
+   *
+   * \param pageSize the size of each atlas page, must be large enough to fit any glyph.
+   *
+   * \since 6.4.0
    */
-  [[nodiscard]] auto get_font() noexcept -> font&
+  void use_atlas(const iarea pageSize = default_atlas_page_size()) noexcept
   {
-    return m_font;
+    assert(pageSize.width > 0);
+    assert(pageSize.height > 0);
+    m_pageSize = pageSize;
+    m_useAtlas = true;
   }
 
   /**
-   * \copydoc get_font
+   * \brief Indicates whether or not added glyphs are packed into the glyph atlas.
+   *
+   * \return `true` if the glyph atlas is used; `false` otherwise.
+   *
+   * \since 6.4.0
    */
-  [[nodiscard]] auto get_font() const noexcept -> const font&
+  [[nodiscard]] auto is_using_atlas() const noexcept -> bool
   {
-    return m_font;
+    return m_useAtlas;
   }
 
- private:
-  font m_font;
-  std::unordered_map<unicode, glyph_data> m_glyphs;
-  std::unordered_map<id_type, texture> m_strings;
+  /**
+   * \brief Returns the atlas data associated with the specified glyph, if it exists.
+   *
+   * \note Do not store the returned pointer for longer than absolutely necessary, it may
+   * get invalidated upon modification of the font cache.
+   *
+   * \param glyph the glyph to look up.
+   *
+   * \return a pointer to the atlas data of the glyph; a null pointer if the glyph hasn't
+   * been packed into the atlas.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_at_atlas(const unicode glyph) const -> const atlas_glyph*
+  {
+    if (const auto it = m_atlasGlyphs.find(glyph); it != m_atlasGlyphs.end()) {
+      return &it->second.glyph;
+    }
+    else {
+      return nullptr;
+    }
+  }
 
   /**
-   * \brief Creates and returns a texture for the specified glyph.
+   * \brief Returns the atlas data associated with a glyph, rasterizing it if necessary.
    *
-   * \details The glyph is rendered with `TTF_RenderGlyph_Blended`.
+   * \details Unlike `try_at_atlas()`, this function marks the glyph as recently used and
+   * updates the atlas statistics. If the glyph isn't in the atlas and on-demand mode is
+   * enabled, the glyph is rendered into the atlas, which might evict the least recently
+   * used glyphs if an atlas budget has been set.
    *
-   * \param renderer the renderer that will be used.
-   * \param glyph the Unicode glyph that will be rendered.
+   * \note The glyph is rendered with the current color of the renderer, in the same way
+   * as with `add_glyph()`.
    *
-   * \return a texture that represents the specified glyph.
+   * \note Evicted glyphs have their atlas area reused, so previously obtained atlas data
+   * (or text batches containing the evicted glyphs) may become stale.
    *
-   * \since 5.0.0
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to rasterize missing glyphs.
+   * \param glyph the requested glyph.
+   *
+   * \return a pointer to the atlas data of the glyph; a null pointer if the glyph isn't
+   * available in the atlas.
+   *
+   * \throws cen_error if the glyph doesn't fit in the atlas, even after evicting glyphs.
+   *
+   * \see `set_on_demand()`
+   * \see `set_atlas_budget()`
+   *
+   * \since 6.4.0
    */
   template <typename Renderer>
-  [[nodiscard]] auto create_glyph_texture(Renderer& renderer, const unicode glyph) -> texture
+  auto request_glyph(Renderer& renderer, const unicode glyph) -> const atlas_glyph*
   {
-    const auto color = renderer.get_color().get();
-    const surface src{TTF_RenderGlyph_Blended(m_font.get(), glyph, color)};
-    return texture{renderer, src};
+    if (const auto it = m_atlasGlyphs.find(glyph); it != m_atlasGlyphs.end()) {
+      ++m_stats.hits;
+      m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+      return &it->second.glyph;
+    }
+
+    ++m_stats.misses;
+
+    if (m_useAtlas && m_onDemand && !m_glyphs.count(glyph) &&
+        m_font.is_glyph_provided(glyph))
+    {
+      add_atlas_glyph(renderer, glyph);
+      return try_at_atlas(glyph);
+    }
+    else {
+      return nullptr;
+    }
   }
 
-  void store(const id_type id, texture&& texture)
+  /**
+   * \brief Sets whether or not missing glyphs are rasterized when requested.
+   *
+   * \details When on-demand mode is enabled, glyphs that are requested with
+   * `request_glyph()` (which is used when rendering with a non-const font cache) are
+   * rendered into the glyph atlas on first use, so the cache doesn't have to be filled up
+   * front.
+   *
+   * \note This has no effect unless the glyph atlas is used.
+   *
+   * \param enabled `true` if missing glyphs should be rasterized; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  void set_on_demand(const bool enabled) noexcept
   {
-    if (const auto it = m_strings.find(id); it != m_strings.end()) {
-      m_strings.erase(it);
+    m_onDemand = enabled;
+  }
+
+  /**
+   * \brief Indicates whether or not missing glyphs are rasterized when requested.
+   *
+   * \return `true` if on-demand mode is enabled; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_on_demand() const noexcept -> bool
+  {
+    return m_onDemand;
+  }
+
+  /**
+   * \brief Sets the maximum amount of texture memory used by the glyph atlas.
+   *
+   * \details When the atlas is full and creating another page would exceed the budget,
+   * the least recently used glyphs are evicted and their areas are reused. At least one
+   * page is always created, regardless of the budget.
+   *
+   * \param bytes the maximum size of all atlas pages, in bytes, zero means no limit.
+   *
+   * \since 6.4.0
+   */
+  void set_atlas_budget(const usize bytes) noexcept
+  {
+    m_budget = bytes;
+  }
+
+  /**
+   * \brief Returns the maximum amount of texture memory used by the glyph atlas.
+   *
+   * \return the atlas budget, in bytes, zero if there is no limit.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto atlas_budget() const noexcept -> usize
+  {
+    return m_budget;
+  }
+
+  /**
+   * \brief Returns the amount of texture memory used by the glyph atlas pages.
+   *
+   * \return the size of all atlas pages, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto atlas_memory_usage() const noexcept -> usize
+  {
+    usize bytes = 0;
+    for (const auto& page : m_pages) {
+      bytes += page_bytes(page.size);
     }
-    m_strings.try_emplace(id, std::move(texture));
+    return bytes;
+  }
+
+  /**
+   * \brief Returns statistics about the glyph requests made to the atlas.
+   *
+   * \return the current atlas statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto atlas_statistics() const noexcept -> const atlas_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Resets the atlas statistics counters to zero.
+   *
+   * \since 6.4.0
+   */
+  void reset_atlas_statistics() noexcept
+  {
+    m_stats = atlas_stats{};
+  }
+
+  /**
+   * \brief Returns the texture of an atlas page.
+   *
+   * \param index the index of the desired atlas page.
+   *
+   * \return the texture associated with the atlas page.
+   *
+   * \throws std::out_of_range if the index is invalid.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto atlas_page(const usize index) const -> const texture&
+  {
+    return m_pages.at(index).sheet;
+  }
+
+  /**
+   * \brief Returns the amount of glyph atlas pages.
+   *
+   * \return the number of atlas pages.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto atlas_page_count() const noexcept -> usize
+  {
+    return m_pages.size();
+  }
+
+  /**
+   * \brief Returns the default size of glyph atlas pages.
+   *
+   * \return the default atlas page size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_atlas_page_size() noexcept -> iarea
+  {
+    return {512, 512};
+  }
+
+  /**
+   * \brief Sets whether or not a copy of the atlas pages is kept in memory.
+   *
+   * \details The atlas pages are static textures, which can't be read back, so the pixels
+   * must be retained in order to save the atlas with `save_atlas()` or
+   * `serialize_atlas()`. This doubles the memory used by the atlas.
+   *
+   * \note This should be enabled before any glyphs are packed into the atlas, since only
+   * pages created afterwards are retained.
+   *
+   * \param enabled `true` if the atlas pixels should be retained; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  void set_atlas_retention(const bool enabled) noexcept
+  {
+    m_retainPixels = enabled;
+  }
+
+  /**
+   * \brief Indicates whether or not a copy of the atlas pages is kept in memory.
+   *
+   * \return `true` if the atlas pixels are retained; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_retaining_atlas() const noexcept -> bool
+  {
+    return m_retainPixels;
+  }
+
+  /**
+   * \brief Discards the glyph atlas, so that glyphs are rasterized again when requested.
+   *
+   * \details The atlas is only discarded in on-demand mode, and if there are no shaped
+   * runs, since those can't be restored automatically. This is used when the cache is
+   * registered with a `memory_budget`.
+   *
+   * \note Previously obtained atlas data, and text batches that use the atlas, become
+   * stale.
+   *
+   * \param bytes the amount of memory that should be freed, in bytes.
+   *
+   * \return the amount of freed memory, which is either zero or the size of the atlas.
+   *
+   * \since 6.4.0
+   */
+  auto free_memory(const usize bytes) noexcept -> usize
+  {
+    if (bytes == 0 || !m_onDemand || !m_runs.empty()) {
+      return 0;
+    }
+
+    const auto freed = atlas_memory_usage();
+
+    m_atlasGlyphs.clear();
+    m_lru.clear();
+    m_freeSlots.clear();
+    m_pages.clear();
+
+    return freed;
+  }
+
+  /// \} End of glyph atlas
+
+  /// \name Shaped text runs
+  /// \{
+
+  /**
+   * \brief Shapes a UTF-8 string and packs the result into the glyph atlas.
+   *
+   * \details Rendering glyph by glyph breaks scripts where glyphs change shape depending
+   * on their neighbours, such as Arabic and Devanagari. This function instead renders the
+   * complete string with `TTF_RenderUTF8_Blended`, which shapes the string with HarfBuzz
+   * when SDL_ttf is built with it, using the direction and script of the font (see
+   * `font::set_direction()` and `font::set_script()`). The shaped run is then stored in an
+   * atlas page, so that it can be added to a `text_batch` along with individual glyphs,
+   * without shaping the string again every frame.
+   * \code{cpp}
+   *   cache.get_font().set_direction(cen::text_direction::right_to_left);
+   *   cache.get_font().set_script("Arab");
+   *   cache.store_shaped_utf8(greeting, arabicGreeting, renderer);
+   *
+   *   batch.add_shaped(greeting, {10, 10});
+   * \endcode
+   *
+   * \details Any previous run associated with the ID is replaced. Shaped runs are never
+   * evicted from the atlas, but the least recently used glyphs might be evicted to make
+   * room for a run when the atlas budget is exhausted.
+   *
+   * \tparam Renderer the type of the renderer that will be used.
+   *
+   * \param id the identifier that will be associated with the run.
+   * \param string the UTF-8 string that will be shaped, must not be empty.
+   * \param renderer the renderer that will be used to create the atlas pages.
+   *
+   * \throws cen_error if the string couldn't be rendered, or if the run is too large to
+   * fit in an atlas page.
+   * \throws sdl_error if the run couldn't be uploaded.
+   *
+   * \see `text_batch::add_shaped()`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void store_shaped_utf8(const id_type id, const not_null<str> string, Renderer& renderer)
+  {
+    assert(string);
+    CENTURION_PROFILE_ZONE("font_cache::store_shaped");
+
+    const auto color = renderer.get_color().get();
+    const surface rendered{TTF_RenderUTF8_Blended(m_font.get(), string, color)};
+
+    remove_shaped(id);
+
+    const auto [page, slot, source] = pack_atlas_surface(renderer, rendered);
+    m_runs.insert_or_assign(id, run_entry{shaped_run{source, page}, slot, string});
+  }
+
+  /// \copydoc store_shaped_utf8()
+  template <typename Renderer>
+  void store_shaped_utf8(const id_type id, const std::string& string, Renderer& renderer)
+  {
+    store_shaped_utf8(id, string.c_str(), renderer);
+  }
+
+  /**
+   * \brief Removes the shaped run associated with an ID, and frees its atlas area.
+   *
+   * \details This function has no effect if there is no run associated with the ID.
+   *
+   * \param id the identifier of the run that will be removed.
+   *
+   * \since 6.4.0
+   */
+  void remove_shaped(const id_type id)
+  {
+    if (const auto it = m_runs.find(id); it != m_runs.end()) {
+      m_freeSlots.push_back({it->second.run.page, it->second.slot});
+      m_runs.erase(it);
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not there is a shaped run associated with an ID.
+   *
+   * \param id the identifier that will be checked.
+   *
+   * \return `true` if there is a shaped run associated with the ID; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto has_shaped(const id_type id) const noexcept -> bool
+  {
+    return m_runs.find(id) != m_runs.end();
+  }
+
+  /**
+   * \brief Returns the shaped run associated with an ID, if it exists.
+   *
+   * \param id the identifier of the run.
+   *
+   * \return a pointer to the shaped run; a null pointer if there is no such run.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_get_shaped(const id_type id) const noexcept -> const shaped_run*
+  {
+    if (const auto it = m_runs.find(id); it != m_runs.end()) {
+      return &it->second.run;
+    }
+    else {
+      return nullptr;
+    }
+  }
+
+  /// \} End of shaped text runs
+
+  /// \name Atlas persistence
+  /// \{
+
+  /**
+   * \brief Returns a file name that identifies the font settings of the glyph atlas.
+   *
+   * \details The name is based on the font family, style, size, hinting and outline,
+   * i.e. the settings that affect the rasterized glyphs, so an atlas saved with one font
+   * is never loaded for another. Characters other than letters and digits are replaced.
+   * \code{cpp}
+   *   const auto path = cen::preferred_path("studio", "game").copy() + cache.atlas_name();
+   *   if (!cache.load_atlas(renderer, path)) {
+   *     cache.add_latin1(renderer);
+   *     cache.save_atlas(path);
+   *   }
+   * \endcode
+   *
+   * \note The glyphs are rendered with the color of the renderer, which isn't part of
+   * the name.
+   *
+   * \return the file name of the atlas, e.g. `"Daniel_Regular_12_s0_h0_o0.atlas"`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto atlas_name() const -> std::string
+  {
+    const auto* family = m_font.family_name();
+    const auto* style = m_font.style_name();
+
+    std::string name = family ? family : "unknown";
+    name += '_';
+    name += style ? style : "unknown";
+    name += '_' + std::to_string(m_font.size());
+    name += "_s" + std::to_string(static_cast<int>(TTF_GetFontStyle(m_font.get())));
+    name += "_h" + std::to_string(static_cast<int>(TTF_GetFontHinting(m_font.get())));
+    name += "_o" + std::to_string(m_font.outline());
+
+    for (auto& ch : name) {
+      const auto alnum = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+                         (ch >= '0' && ch <= '9');
+      if (!alnum) {
+        ch = '_';
+      }
+    }
+
+    return name + ".atlas";
+  }
+
+  /**
+   * \brief Serializes the glyph atlas, i.e. the page pixels and the glyph metrics.
+   *
+   * \details The data can be written with e.g. `save_writer`, and loaded with
+   * `load_atlas()`. The LRU order of the glyphs and the free atlas areas are preserved.
+   *
+   * \note Shaped runs are not serialized, and are discarded when an atlas is loaded.
+   *
+   * \pre The atlas pixels must be retained, see `set_atlas_retention()`.
+   *
+   * \return the serialized atlas; an empty vector if the atlas is empty, or if the atlas
+   * pixels haven't been retained.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto serialize_atlas() const -> std::vector<std::byte>
+  {
+    std::vector<std::byte> data;
+
+    const auto retained = std::all_of(m_pages.begin(), m_pages.end(), [](const auto& page) {
+      return !page.pixels.empty();
+    });
+
+    if (m_pages.empty() || !retained) {
+      return data;
+    }
+
+    const auto name = atlas_name();
+    data.reserve(atlas_memory_usage() + m_atlasGlyphs.size() * 64 + name.size() + 64);
+
+    write_bytes(data, atlas_magic, sizeof atlas_magic);
+    write_value(data, atlas_version);
+    write_value(data, static_cast<u32>(name.size()));
+    write_bytes(data, name.data(), name.size());
+
+    write_value(data, static_cast<u32>(m_pages.size()));
+    write_value(data, static_cast<u32>(m_lru.size()));
+    write_value(data, static_cast<u32>(m_freeSlots.size()));
+
+    for (const auto& page : m_pages) {
+      write_value(data, static_cast<i32>(page.size.width));
+      write_value(data, static_cast<i32>(page.size.height));
+      write_value(data, static_cast<i32>(page.cursorX));
+      write_value(data, static_cast<i32>(page.cursorY));
+      write_value(data, static_cast<i32>(page.rowHeight));
+    }
+
+    // The glyphs are stored from the most to the least recently used
+    for (const auto glyph : m_lru) {
+      const auto& entry = m_atlasGlyphs.at(glyph);
+      const auto& [source, metrics, page] = entry.glyph;
+
+      write_value(data, static_cast<u32>(glyph));
+      write_value(data, static_cast<u32>(page));
+      write_rect(data, source);
+      write_rect(data, entry.slot);
+      write_value(data, static_cast<i32>(metrics.minX));
+      write_value(data, static_cast<i32>(metrics.minY));
+      write_value(data, static_cast<i32>(metrics.maxX));
+      write_value(data, static_cast<i32>(metrics.maxY));
+      write_value(data, static_cast<i32>(metrics.advance));
+    }
+
+    for (const auto& slot : m_freeSlots) {
+      write_value(data, static_cast<u32>(slot.page));
+      write_rect(data, slot.area);
+    }
+
+    for (const auto& page : m_pages) {
+      write_bytes(data, page.pixels.data(), page_bytes(page.size));
+    }
+
+    return data;
+  }
+
+  /**
+   * \brief Saves the glyph atlas to a file.
+   *
+   * \pre The atlas pixels must be retained, see `set_atlas_retention()`.
+   *
+   * \param path the path of the file that will be written.
+   *
+   * \return `success` if the atlas was saved; `failure` otherwise.
+   *
+   * \see `serialize_atlas()`
+   *
+   * \since 6.4.0
+   */
+  auto save_atlas(const std::string& path) const -> result
+  {
+    CENTURION_PROFILE_ZONE("font_cache::save_atlas");
+
+    const auto data = serialize_atlas();
+    if (data.empty()) {
+      return failure;
+    }
+
+    file target{path, file_mode::write_binary};
+    return target && target.write(data) == data.size();
+  }
+
+  /**
+   * \brief Loads a glyph atlas from a file, which is mapped into memory.
+   *
+   * \details The page textures are uploaded straight from the mapped file, so no glyphs
+   * are rasterized. This replaces the current glyph atlas, and enables the use of the
+   * atlas. Nothing is changed if the file doesn't exist, or if it was saved with other
+   * font settings.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the atlas pages.
+   * \param path the path of a file written by `save_atlas()`.
+   *
+   * \return `success` if the atlas was loaded; `failure` otherwise.
+   *
+   * \throws sdl_error if the atlas pages couldn't be created.
+   *
+   * \see `atlas_name()`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto load_atlas(Renderer& renderer, const std::string& path) -> result
+  {
+    const mapped_file source{path};
+    if (!source) {
+      return failure;
+    }
+
+    return load_atlas(renderer, source.data(), source.size());
+  }
+
+  /**
+   * \brief Loads a glyph atlas from serialized data.
+   *
+   * \details This replaces the current glyph atlas, and enables the use of the atlas.
+   * Nothing is changed if the data is malformed, or if it was serialized with other font
+   * settings.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the atlas pages.
+   * \param data the data returned by `serialize_atlas()`.
+   * \param size the size of the data, in bytes.
+   *
+   * \return `success` if the atlas was loaded; `failure` otherwise.
+   *
+   * \throws sdl_error if the atlas pages couldn't be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto load_atlas(Renderer& renderer, const void* data, const usize size) -> result
+  {
+    CENTURION_PROFILE_ZONE("font_cache::load_atlas");
+
+    atlas_reader reader{static_cast<const u8*>(data), size};
+
+    char magic[sizeof atlas_magic]{};
+    u32 version{};
+    u32 nameSize{};
+    if (!reader.read_bytes(magic, sizeof magic) ||
+        std::memcmp(magic, atlas_magic, sizeof magic) != 0 || !reader.read(version) ||
+        version != atlas_version || !reader.read(nameSize))
+    {
+      return failure;
+    }
+
+    const auto name = atlas_name();
+    const auto* storedName = reader.take(nameSize);
+    if (!storedName || nameSize != name.size() ||
+        std::memcmp(storedName, name.data(), name.size()) != 0)
+    {
+      return failure;
+    }
+
+    u32 pageCount{};
+    u32 glyphCount{};
+    u32 slotCount{};
+    if (!reader.read(pageCount) || !reader.read(glyphCount) || !reader.read(slotCount) ||
+        pageCount == 0 || pageCount > reader.remaining() ||
+        glyphCount > reader.remaining() || slotCount > reader.remaining())
+    {
+      return failure;
+    }
+
+    // The page sizes and the positions of the shelf cursors
+    std::vector<std::tuple<iarea, i32, i32, i32>> layouts(pageCount);
+    usize pixelBytes = 0;
+    for (auto& [size, cursorX, cursorY, rowHeight] : layouts) {
+      if (!reader.read(size.width) || !reader.read(size.height) || !reader.read(cursorX) ||
+          !reader.read(cursorY) || !reader.read(rowHeight) || size.width <= 0 ||
+          size.height <= 0 || cursorX < 0 || cursorY < 0 || rowHeight < 0 ||
+          static_cast<usize>(size.width) * static_cast<usize>(size.height) >
+              reader.remaining() / 4u)
+      {
+        return failure;
+      }
+
+      pixelBytes += page_bytes(size);
+    }
+
+    const auto inside = [&](const irect& rect, const u32 page) {
+      if (page >= pageCount) {
+        return false;
+      }
+
+      const auto& size = std::get<0>(layouts[page]);
+      return rect.x() >= 0 && rect.y() >= 0 && rect.width() >= 0 && rect.height() >= 0 &&
+             rect.width() <= size.width - rect.x() && rect.height() <= size.height - rect.y();
+    };
+
+    std::vector<std::pair<unicode, atlas_entry>> entries;
+    entries.reserve(glyphCount);
+    for (u32 index = 0; index < glyphCount; ++index) {
+      u32 glyph{};
+      u32 page{};
+      atlas_entry entry{};
+      auto& metrics = entry.glyph.metrics;
+
+      if (!reader.read(glyph) || !reader.read(page) ||
+          !read_rect(reader, entry.glyph.source) || !read_rect(reader, entry.slot) ||
+          !reader.read(metrics.minX) || !reader.read(metrics.minY) ||
+          !reader.read(metrics.maxX) || !reader.read(metrics.maxY) ||
+          !reader.read(metrics.advance) || glyph > 0xFFFFu ||
+          !inside(entry.glyph.source, page) || !inside(entry.slot, page))
+      {
+        return failure;
+      }
+
+      entry.glyph.page = page;
+      entries.emplace_back(static_cast<unicode>(glyph), std::move(entry));
+    }
+
+    decltype(m_freeSlots) slots(slotCount);
+    for (auto& slot : slots) {
+      u32 page{};
+      if (!reader.read(page) || !read_rect(reader, slot.area) || !inside(slot.area, page)) {
+        return failure;
+      }
+
+      slot.page = page;
+    }
+
+    if (reader.remaining() != pixelBytes) {
+      return failure;
+    }
+
+    std::vector<atlas_page_data> pages;
+    pages.reserve(pageCount);
+
+    for (const auto& [pageSize, cursorX, cursorY, rowHeight] : layouts) {
+      const auto pageBytes = page_bytes(pageSize);
+      const auto* pixels = reader.take(pageBytes);
+
+      texture sheet{renderer, pixel_format::argb8888, texture_access::no_lock, pageSize};
+      sheet.set_blend_mode(blend_mode::blend);
+
+      // The pages are uploaded straight from the source, e.g. a mapped file
+      if (!sheet.update(std::nullopt, pixels, pageSize.width * 4)) {
+        throw sdl_error{};
+      }
+
+      renderer.record_upload(pageBytes);
+
+      auto& page = pages.emplace_back(
+          atlas_page_data{std::move(sheet), pageSize, cursorX, cursorY, rowHeight, {}});
+
+      if (m_retainPixels) {
+        page.pixels.resize(pageBytes / 4u);
+        std::memcpy(page.pixels.data(), pixels, pageBytes);
+      }
+    }
+
+    m_pages = std::move(pages);
+    m_freeSlots = std::move(slots);
+    m_atlasGlyphs.clear();
+    m_runs.clear();
+    m_lru.clear();
+    m_stats = atlas_stats{};
+    m_useAtlas = true;
+
+    for (auto& [glyph, entry] : entries) {
+      entry.lru = m_lru.insert(m_lru.end(), glyph);
+      m_atlasGlyphs.insert_or_assign(glyph, std::move(entry));
+    }
+
+    return success;
+  }
+
+  /// \} End of atlas persistence
+
+  /// \name Text measurement
+  /// \{
+
+  /**
+   * \brief Returns the size of a string, based on the metrics of the cached glyphs.
+   *
+   * \details Unlike `font::string_size()`, the string isn't shaped by SDL_ttf, so this is
+   * considerably faster for strings that are measured repeatedly, e.g. when aligning
+   * labels every frame. The size is computed in the same way as `text_layout::size()`,
+   * i.e. from the glyph advances and kerning, and newline characters start new lines.
+   *
+   * \note Trailing spaces don't contribute to the width of a line, which is consistent
+   * with `text_layout` but differs from `font::string_size()`, which includes them. As a
+   * result, the two functions can report different widths for the same string.
+   *
+   * \details If any glyph in the string hasn't been cached, nothing is returned, in which
+   * case `font::string_size()` can be used instead.
+   * \code{cpp}
+   *   const auto size = cache.measure(label).value_or(iarea{});
+   * \endcode
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters, e.g. `unicode_string` or `utf8_view`.
+   *
+   * \param str the string to measure.
+   *
+   * \return the size of the string; `std::nullopt` if a glyph in the string hasn't been
+   * cached.
+   *
+   * \see `text_layout::size()`
+   *
+   * \since 6.4.0
+   */
+  template <typename String>
+  [[nodiscard]] auto measure(const String& str) const -> std::optional<iarea>
+  {
+    const auto kerning = m_font.has_kerning();
+
+    int width = 0;
+    int lines = 0;
+    int x = 0;
+    unicode previous{};
+
+    for (const unicode glyph : str) {
+      lines = std::max(lines, 1);
+
+      if (glyph == '\n') {
+        x = 0;
+        previous = 0;
+        ++lines;
+        continue;
+      }
+
+      const auto* metrics = try_metrics(glyph);
+      if (!metrics) {
+        return std::nullopt;
+      }
+
+      if (kerning && previous != 0) {
+        x += m_font.kerning_amount(previous, glyph);
+      }
+
+      x += metrics->advance;
+
+      // Trailing spaces don't contribute to the width of a line
+      if (glyph != ' ') {
+        width = std::max(width, x);
+      }
+
+      previous = glyph;
+    }
+
+    if (lines == 0) {
+      return iarea{0, 0};
+    }
+    else {
+      return iarea{width, (lines - 1) * m_font.line_skip() + m_font.height()};
+    }
+  }
+
+  /// \} End of text measurement
+
+  /**
+   * \brief Returns the font used by the cache.
+   *
+   * \return a reference to the internal font.
+   *
+   * \since 5.0.0
+   */
+  [[nodiscard]] auto get_font() noexcept -> font&
+  {
+    return m_font;
+  }
+
+  /**
+   * \copydoc get_font
+   */
+  [[nodiscard]] auto get_font() const noexcept -> const font&
+  {
+    return m_font;
+  }
+
+  /**
+   * \brief Replaces the font, and renders all cached glyphs again with the new font.
+   *
+   * \details This is useful when the size of the font changes, e.g. when a window is moved
+   * to a display with a different DPI. The atlas configuration is kept, and atlas glyphs
+   * are added in their least recently used order, so the LRU order is preserved. Shaped
+   * runs are shaped again with the new font. Cached strings are discarded, since only
+   * their textures are stored, and the atlas statistics are reset.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the glyph textures.
+   * \param font the font that will be used by the cache.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void rebuild(Renderer& renderer, font&& font)
+  {
+    CENTURION_PROFILE_ZONE("font_cache::rebuild");
+
+    std::vector<unicode> glyphs;
+    glyphs.reserve(m_glyphs.size() + m_lru.size());
+
+    for (const auto& [glyph, data] : m_glyphs) {
+      glyphs.push_back(glyph);
+    }
+
+    glyphs.insert(glyphs.end(), m_lru.rbegin(), m_lru.rend());
+
+    std::vector<std::pair<id_type, std::string>> runs;
+    runs.reserve(m_runs.size());
+
+    for (auto& [id, entry] : m_runs) {
+      runs.emplace_back(id, std::move(entry.text));
+    }
+
+    m_font = std::move(font);
+    m_glyphs.clear();
+    m_strings.clear();
+    m_atlasGlyphs.clear();
+    m_runs.clear();
+    m_lru.clear();
+    m_freeSlots.clear();
+    m_pages.clear();
+    m_stats = atlas_stats{};
+
+    for (const auto glyph : glyphs) {
+      add_glyph(renderer, glyph);
+    }
+
+    for (const auto& [id, text] : runs) {
+      store_shaped_utf8(id, text, renderer);
+    }
+  }
+
+ private:
+  using lru_list = detail::tracked_list<unicode, alloc_subsystem::text>;
+
+  struct atlas_page_data final
+  {
+    texture sheet;    ///< The texture that holds the packed glyphs.
+    iarea size{};     ///< The size of the page texture.
+    int cursorX{};    ///< The x-coordinate of the next glyph in the current row.
+    int cursorY{};    ///< The y-coordinate of the current row.
+    int rowHeight{};  ///< The height of the tallest glyph in the current row.
+    std::vector<u32> pixels;  ///< A copy of the page pixels, if retained.
+  };
+
+  struct string_data final
+  {
+    texture cached;  ///< The texture that contains the string.
+    iarea size{};    ///< The size of the string, might be smaller than the texture.
+  };
+
+  struct atlas_entry final
+  {
+    atlas_glyph glyph;         ///< The public glyph data.
+    irect slot;                ///< The allocated area, might exceed the glyph.
+    lru_list::iterator lru{};  ///< The position of the glyph in the LRU list.
+  };
+
+  struct run_entry final
+  {
+    shaped_run run;    ///< The public run data.
+    irect slot;        ///< The allocated area, might exceed the run.
+    std::string text;  ///< The UTF-8 source of the run, used when rebuilding.
+  };
+
+  struct free_slot final
+  {
+    usize page{};  ///< The index of the page that contains the slot.
+    irect area;    ///< The area of the slot.
+  };
+
+  /// The amount of empty pixels between packed glyphs, avoids bleeding when filtering.
+  inline constexpr static int atlas_padding = 1;
+
+  /// Identifies serialized glyph atlases.
+  inline constexpr static char atlas_magic[8]{'C', 'E', 'N', 'A', 'T', 'L', 'A', 'S'};
+
+  /// The version of the serialized atlas format, incremented for incompatible changes.
+  inline constexpr static u32 atlas_version = 1;
+
+  /// Reads values from serialized atlas data, with bounds checking.
+  class atlas_reader final
+  {
+   public:
+    atlas_reader(const u8* data, const usize size) noexcept : m_data{data}, m_size{size}
+    {}
+
+    [[nodiscard]] auto take(const usize count) noexcept -> const u8*
+    {
+      if (count > remaining()) {
+        return nullptr;
+      }
+
+      const auto* data = m_data + m_offset;
+      m_offset += count;
+
+      return data;
+    }
+
+    [[nodiscard]] auto read_bytes(void* dst, const usize count) noexcept -> bool
+    {
+      if (const auto* data = take(count)) {
+        std::memcpy(dst, data, count);
+        return true;
+      }
+      else {
+        return false;
+      }
+    }
+
+    template <typename T>
+    [[nodiscard]] auto read(T& value) noexcept -> bool
+    {
+      return read_bytes(&value, sizeof value);
+    }
+
+    [[nodiscard]] auto remaining() const noexcept -> usize
+    {
+      return m_size - m_offset;
+    }
+
+   private:
+    const u8* m_data{};
+    usize m_size{};
+    usize m_offset{};
+  };
+
+  font m_font;
+  detail::tracked_unordered_map<unicode, glyph_data, alloc_subsystem::text> m_glyphs;
+  detail::tracked_unordered_map<id_type, string_data, alloc_subsystem::text> m_strings;
+  detail::tracked_unordered_map<unicode, atlas_entry, alloc_subsystem::text> m_atlasGlyphs;
+  detail::tracked_unordered_map<id_type, run_entry, alloc_subsystem::text> m_runs;
+  lru_list m_lru;  ///< Atlas glyphs, ordered from most to least recently used.
+  detail::tracked_vector<free_slot, alloc_subsystem::text> m_freeSlots;
+  detail::tracked_vector<u32, alloc_subsystem::text> m_scratch;
+  std::vector<atlas_page_data> m_pages;
+  iarea m_pageSize{default_atlas_page_size()};
+  usize m_budget{};
+  atlas_stats m_stats;
+  bool m_useAtlas{};
+  bool m_onDemand{};
+  bool m_retainPixels{};
+
+  /**
+   * \brief Creates and returns a texture for the specified glyph.
+   *
+   * \details The glyph is rendered with `TTF_RenderGlyph_Blended`.
+   *
+   * \param renderer the renderer that will be used.
+   * \param glyph the Unicode glyph that will be rendered.
+   *
+   * \return a texture that represents the specified glyph.
+   *
+   * \since 5.0.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto create_glyph_texture(Renderer& renderer, const unicode glyph) -> texture
+  {
+    const auto color = renderer.get_color().get();
+    const surface src{TTF_RenderGlyph_Blended(m_font.get(), glyph, color)};
+    return texture{renderer, src};
+  }
+
+  /**
+   * \brief Renders a glyph and packs it into the glyph atlas.
+   *
+   * \param renderer the renderer that will be used.
+   * \param glyph the Unicode glyph that will be rendered.
+   *
+   * \throws cen_error if the glyph is too large to fit in an atlas page.
+   * \throws sdl_error if the glyph couldn't be rendered or uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_atlas_glyph(Renderer& renderer, const unicode glyph)
+  {
+    const auto color = renderer.get_color().get();
+    const surface rendered{TTF_RenderGlyph_Blended(m_font.get(), glyph, color)};
+    pack_atlas_glyph(renderer, glyph, rendered);
+  }
+
+  /**
+   * \brief Caches a glyph that has already been rendered with the font of the cache.
+   *
+   * \param renderer the renderer that will be used.
+   * \param glyph the Unicode glyph that was rendered.
+   * \param rendered the rendered glyph.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_rendered_glyph(Renderer& renderer, const unicode glyph, const surface& rendered)
+  {
+    if (m_useAtlas) {
+      pack_atlas_glyph(renderer, glyph, rendered);
+    }
+    else {
+      glyph_data data{texture{renderer, rendered}, m_font.get_metrics(glyph).value()};
+      m_glyphs.try_emplace(glyph, std::move(data));
+    }
+  }
+
+  /**
+   * \brief Packs a rendered glyph into the glyph atlas.
+   *
+   * \param renderer the renderer that will be used.
+   * \param glyph the Unicode glyph that was rendered.
+   * \param rendered the rendered glyph.
+   *
+   * \throws cen_error if the glyph is too large to fit in an atlas page.
+   * \throws sdl_error if the glyph couldn't be uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void pack_atlas_glyph(Renderer& renderer, const unicode glyph, const surface& rendered)
+  {
+    CENTURION_PROFILE_ZONE("font_cache::pack_glyph");
+
+    const auto [page, slot, source] = pack_atlas_surface(renderer, rendered);
+    const auto metrics = m_font.get_metrics(glyph).value();
+
+    m_lru.push_front(glyph);
+
+    atlas_entry entry{atlas_glyph{source, metrics, page}, slot, m_lru.begin()};
+    m_atlasGlyphs.try_emplace(glyph, std::move(entry));
+  }
+
+  /**
+   * \brief Uploads a rendered surface to an available area in the glyph atlas.
+   *
+   * \param renderer the renderer that will be used.
+   * \param rendered the surface that will be packed.
+   *
+   * \return the index of the page, the allocated area and the area of the surface.
+   *
+   * \throws cen_error if the surface is too large to fit in an atlas page.
+   * \throws sdl_error if the surface couldn't be uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto pack_atlas_surface(Renderer& renderer, const surface& rendered)
+      -> std::tuple<usize, irect, irect>
+  {
+    auto converted = rendered.convert(pixel_format::argb8888);
+
+    const auto [page, slot, reused] = allocate_atlas_area(renderer, converted.size());
+    const irect source{slot.position(), converted.size()};
+
+    auto& sheet = m_pages[page].sheet;
+
+    // Reused slots still contain the pixels of the evicted glyph or run
+    if (reused) {
+      m_scratch.assign(static_cast<usize>(slot.width()) * static_cast<usize>(slot.height()),
+                       0);
+      if (!sheet.update(slot, m_scratch.data(), slot.width() * 4)) {
+        throw sdl_error{};
+      }
+
+      renderer.record_upload(m_scratch.size() * 4);
+    }
+
+    if (!converted.lock()) {
+      throw sdl_error{};
+    }
+
+    const auto uploaded = sheet.update(source, converted.pixels(), converted.pitch());
+
+    if (uploaded && !m_pages[page].pixels.empty()) {
+      retain_pixels(m_pages[page], slot, source, converted.pixels(), converted.pitch());
+    }
+
+    converted.unlock();
+
+    if (!uploaded) {
+      throw sdl_error{};
+    }
+
+    renderer.record_upload(static_cast<usize>(converted.pitch()) *
+                           static_cast<usize>(converted.height()));
+
+    return {page, slot, source};
+  }
+
+  /**
+   * \brief Finds an available area in the glyph atlas.
+   *
+   * \details Areas of evicted glyphs are reused first, then the last page is filled. If
+   * the last page is full, a new page is created, unless that would exceed the atlas
+   * budget, in which case the least recently used glyphs are evicted until an area of
+   * sufficient size is freed.
+   *
+   * \param renderer the renderer that will be used to create new atlas pages.
+   * \param size the size of the area to allocate.
+   *
+   * \return the index of the page, the allocated area (which might be larger than the
+   * requested size), and whether or not the area previously belonged to another glyph.
+   *
+   * \throws cen_error if the size exceeds the atlas page size, or if no area could be
+   * freed within the atlas budget.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto allocate_atlas_area(Renderer& renderer, const iarea size)
+      -> std::tuple<usize, irect, bool>
+  {
+    if (size.width > m_pageSize.width || size.height > m_pageSize.height) {
+      throw cen_error{"Glyph does not fit in a glyph atlas page!"};
+    }
+
+    if (const auto slot = take_free_slot(size)) {
+      return {slot->page, slot->area, true};
+    }
+
+    if (!m_pages.empty()) {
+      auto& page = m_pages.back();
+
+      if (page.cursorX + size.width > page.size.width) {
+        page.cursorX = 0;
+        page.cursorY += page.rowHeight + atlas_padding;
+        page.rowHeight = 0;
+      }
+
+      if (page.cursorY + size.height <= page.size.height &&
+          page.cursorX + size.width <= page.size.width)
+      {
+        const irect area{{page.cursorX, page.cursorY}, size};
+
+        page.cursorX += size.width + atlas_padding;
+        page.rowHeight = std::max(page.rowHeight, size.height);
+
+        return {m_pages.size() - 1, area, false};
+      }
+    }
+
+    if (m_pages.empty() || m_budget == 0 ||
+        atlas_memory_usage() + page_bytes(m_pageSize) <= m_budget)
+    {
+      auto& page = m_pages.emplace_back(create_atlas_page(renderer));
+      page.cursorX = size.width + atlas_padding;
+      page.rowHeight = size.height;
+
+      return {m_pages.size() - 1, irect{{0, 0}, size}, false};
+    }
+
+    while (!m_lru.empty()) {
+      evict(m_lru.back());
+      if (const auto slot = take_free_slot(size)) {
+        return {slot->page, slot->area, true};
+      }
+    }
+
+    throw cen_error{"Glyph does not fit in the glyph atlas budget!"};
+  }
+
+  /**
+   * \brief Removes a glyph from the atlas and makes its area available for reuse.
+   *
+   * \param glyph the glyph that will be evicted, must be in the atlas.
+   *
+   * \since 6.4.0
+   */
+  void evict(const unicode glyph)
+  {
+    const auto it = m_atlasGlyphs.find(glyph);
+    assert(it != m_atlasGlyphs.end());
+
+    m_freeSlots.push_back({it->second.glyph.page, it->second.slot});
+    m_lru.erase(it->second.lru);
+    m_atlasGlyphs.erase(it);
+
+    ++m_stats.evictions;
+  }
+
+  /**
+   * \brief Removes and returns the smallest free slot that can fit the specified size.
+   *
+   * \param size the size that the slot must be able to hold.
+   *
+   * \return the found slot; an empty optional if there is no suitable slot.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto take_free_slot(const iarea size) -> std::optional<free_slot>
+  {
+    auto best = m_freeSlots.end();
+    for (auto it = m_freeSlots.begin(); it != m_freeSlots.end(); ++it) {
+      const auto& area = it->area;
+      if (area.width() >= size.width && area.height() >= size.height &&
+          (best == m_freeSlots.end() || area.area() < best->area.area()))
+      {
+        best = it;
+      }
+    }
+
+    if (best != m_freeSlots.end()) {
+      const auto slot = *best;
+      *best = m_freeSlots.back();
+      m_freeSlots.pop_back();
+      return slot;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Creates a font from a font pool with the same settings as the font of the cache.
+   *
+   * \param pool the font pool that provides the font data.
+   *
+   * \return a font of the same size, style, outline, hinting and kerning.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto make_worker_font(const font_pool& pool) const -> font
+  {
+    auto font = pool.make_font(m_font.size());
+
+    TTF_SetFontStyle(font.get(), TTF_GetFontStyle(m_font.get()));
+    TTF_SetFontOutline(font.get(), TTF_GetFontOutline(m_font.get()));
+    TTF_SetFontHinting(font.get(), TTF_GetFontHinting(m_font.get()));
+    TTF_SetFontKerning(font.get(), TTF_GetFontKerning(m_font.get()));
+
+    return font;
+  }
+
+  static void write_bytes(std::vector<std::byte>& data, const void* src, const usize count)
+  {
+    const auto* bytes = static_cast<const std::byte*>(src);
+    data.insert(data.end(), bytes, bytes + count);
+  }
+
+  template <typename T>
+  static void write_value(std::vector<std::byte>& data, const T value)
+  {
+    write_bytes(data, &value, sizeof value);
+  }
+
+  static void write_rect(std::vector<std::byte>& data, const irect& rect)
+  {
+    write_value(data, static_cast<i32>(rect.x()));
+    write_value(data, static_cast<i32>(rect.y()));
+    write_value(data, static_cast<i32>(rect.width()));
+    write_value(data, static_cast<i32>(rect.height()));
+  }
+
+  [[nodiscard]] static auto read_rect(atlas_reader& reader, irect& rect) noexcept -> bool
+  {
+    i32 x{};
+    i32 y{};
+    i32 width{};
+    i32 height{};
+    if (!reader.read(x) || !reader.read(y) || !reader.read(width) || !reader.read(height)) {
+      return false;
+    }
+
+    rect = irect{x, y, width, height};
+    return true;
+  }
+
+  /**
+   * \brief Copies packed glyph pixels into the retained pixels of an atlas page.
+   *
+   * \param page the atlas page, which must retain its pixels.
+   * \param slot the allocated area, which is cleared first.
+   * \param source the area of the glyph, inside the slot.
+   * \param src the ARGB8888 pixels of the glyph.
+   * \param pitch the pitch of the glyph pixels, in bytes.
+   *
+   * \since 6.4.0
+   */
+  static void retain_pixels(atlas_page_data& page,
+                            const irect& slot,
+                            const irect& source,
+                            const void* src,
+                            const int pitch) noexcept
+  {
+    auto& pixels = page.pixels;
+    const auto stride = static_cast<usize>(page.size.width);
+    const auto rowIndex = [=](const int x, const int y) noexcept {
+      return static_cast<usize>(y) * stride + static_cast<usize>(x);
+    };
+
+    for (auto y = slot.y(); y < slot.max_y(); ++y) {
+      std::fill_n(pixels.begin() + rowIndex(slot.x(), y), slot.width(), u32{0});
+    }
+
+    const auto* bytes = static_cast<const u8*>(src);
+    for (auto row = 0; row < source.height(); ++row) {
+      std::memcpy(pixels.data() + rowIndex(source.x(), source.y() + row),
+                  bytes + static_cast<usize>(row) * static_cast<usize>(pitch),
+                  static_cast<usize>(source.width()) * 4u);
+    }
+  }
+
+  [[nodiscard]] constexpr static auto page_bytes(const iarea size) noexcept -> usize
+  {
+    return static_cast<usize>(size.width) * static_cast<usize>(size.height) * 4u;
+  }
+
+  /**
+   * \brief Creates a fully transparent atlas page.
+   *
+   * \param renderer the renderer that will be used to create the page texture.
+   *
+   * \return the created atlas page.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto create_atlas_page(Renderer& renderer) -> atlas_page_data
+  {
+    texture sheet{renderer, pixel_format::argb8888, texture_access::no_lock, m_pageSize};
+    sheet.set_blend_mode(blend_mode::blend);
+
+    // Static textures have undefined contents, so we clear the page once up front
+    std::vector<u32> blank(static_cast<usize>(m_pageSize.width) *
+                               static_cast<usize>(m_pageSize.height),
+                           0);
+    if (!sheet.update(std::nullopt, blank.data(), m_pageSize.width * 4)) {
+      throw sdl_error{};
+    }
+
+    renderer.record_upload(blank.size() * 4);
+
+    atlas_page_data page{std::move(sheet), m_pageSize, 0, 0, 0, {}};
+    if (m_retainPixels) {
+      page.pixels = std::move(blank);
+    }
+
+    return page;
+  }
+
+  void store(const id_type id, texture&& texture)
+  {
+    if (const auto it = m_strings.find(id); it != m_strings.end()) {
+      m_strings.erase(it);
+    }
+
+    const auto size = texture.size();
+    m_strings.try_emplace(id, string_data{std::move(texture), size});
+  }
+
+  /**
+   * \brief Uploads a rendered string to the texture associated with an ID.
+   *
+   * \details The previous texture is reused if it is a streaming texture that is large
+   * enough to hold the string, otherwise a new texture is created.
+   *
+   * \param id the identifier that will be associated with the texture.
+   * \param renderer the renderer that will be used to create a new texture, if needed.
+   * \param rendered the rendered string.
+   *
+   * \throws sdl_error if a texture couldn't be created or uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void update(const id_type id, Renderer& renderer, const surface& rendered)
+  {
+    auto converted = rendered.convert(pixel_format::argb8888);
+    const auto size = converted.size();
+
+    auto it = m_strings.find(id);
+    if (it == m_strings.end() || !it->second.cached.is_streaming() ||
+        it->second.cached.format() != pixel_format::argb8888 ||
+        it->second.cached.width() < size.width || it->second.cached.height() < size.height)
+    {
+      // Grow from the previous texture to avoid reallocating for every larger string
+      iarea textureSize = size;
+      if (it != m_strings.end()) {
+        textureSize.width = std::max(textureSize.width, it->second.cached.width());
+        textureSize.height = std::max(textureSize.height, it->second.cached.height());
+        m_strings.erase(it);
+      }
+
+      const auto format = pixel_format::argb8888;
+      texture created{renderer, format, texture_access::streaming, textureSize};
+      created.set_blend_mode(blend_mode::blend);
+
+      it = m_strings.try_emplace(id, string_data{std::move(created), iarea{}}).first;
+    }
+
+    auto& [cached, cachedSize] = it->second;
+
+    if (!converted.lock()) {
+      throw sdl_error{};
+    }
+
+    const auto textureSize = cached.size();
+    const auto* pixels = converted.pixels();
+    auto pitch = converted.pitch();
+
+    // The parts of the texture that aren't covered by the string are cleared, so the
+    // string is composed into a cleared buffer that is uploaded at once
+    if (size != textureSize) {
+      const auto rowBytes = static_cast<usize>(size.width) * 4u;
+      const auto texturePitch = static_cast<usize>(textureSize.width) * 4u;
+
+      m_scratch.assign(static_cast<usize>(textureSize.width) *
+                           static_cast<usize>(textureSize.height),
+                       0);
+
+      const auto* source = static_cast<const u8*>(pixels);
+      auto* target = reinterpret_cast<u8*>(m_scratch.data());
+      for (auto row = 0; row < size.height; ++row) {
+        std::memcpy(target + static_cast<usize>(row) * texturePitch,
+                    source + static_cast<usize>(row) * static_cast<usize>(pitch),
+                    rowBytes);
+      }
+
+      pixels = m_scratch.data();
+      pitch = textureSize.width * 4;
+    }
+
+    const auto uploaded = cached.update(irect{{0, 0}, textureSize}, pixels, pitch);
+    converted.unlock();
+
+    if (!uploaded) {
+      throw sdl_error{};
+    }
+
+    renderer.record_upload(static_cast<usize>(pitch) *
+                           static_cast<usize>(textureSize.height));
+
+    cachedSize = size;
   }
 };
 
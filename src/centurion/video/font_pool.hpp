@@ -0,0 +1,176 @@
+#ifndef CENTURION_FONT_POOL_HEADER
+#define CENTURION_FONT_POOL_HEADER
+
+#ifndef CENTURION_NO_SDL_TTF
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // byte
+#include <memory>   // shared_ptr, make_shared
+#include <string>   // string
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../core/str.hpp"
+#include "../filesystem/file.hpp"
+#include "font.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class font_pool
+ *
+ * \brief Creates fonts of different sizes from a single TrueType font file.
+ *
+ * \details Every `font` that is loaded from a file path reads and parses the font file
+ * again, and keeps its own handle to the file for reading glyph data. A font pool reads the
+ * font file into memory once, and creates fonts that share that memory, which makes
+ * opening the same font at many sizes and styles considerably cheaper.
+ * \code{cpp}
+ *   const cen::font_pool pool{"resources/fira_code.ttf"};
+ *
+ *   renderer.add_font(small, pool, 12);
+ *   renderer.add_font(large, pool, 24);
+ *
+ *   auto bold = pool.make_font(24);
+ *   bold.set_bold(true);
+ * \endcode
+ *
+ * \note The created fonts share ownership of the font data, so they may outlive the pool.
+ * Each font still has its own style and size, so fonts that are used with different styles
+ * should be created separately.
+ *
+ * \see `font(std::shared_ptr<const std::vector<std::byte>>, int)`
+ *
+ * \since 6.4.0
+ */
+class font_pool final
+{
+ public:
+  using data_type = std::vector<std::byte>;
+
+  /**
+   * \brief Reads a TrueType font file into memory.
+   *
+   * \param file the file path of the TrueType font file, mustn't be null.
+   *
+   * \throws sdl_error if the file cannot be opened.
+   * \throws cen_error if the file is empty.
+   *
+   * \since 6.4.0
+   */
+  explicit font_pool(const not_null<str> file)
+      : font_pool{cen::file{file, file_mode::read_existing_binary}}
+  {}
+
+  /// \copydoc font_pool(not_null<str>)
+  explicit font_pool(const std::string& file) : font_pool{file.c_str()}
+  {}
+
+  /**
+   * \brief Reads the remainder of an open TrueType font file into memory.
+   *
+   * \details Unlike the `font` constructor that accepts a file, the file isn't needed once
+   * the font pool has been created.
+   *
+   * \param source the file that the font data is read from.
+   *
+   * \throws sdl_error if the file isn't open.
+   * \throws cen_error if the file is empty.
+   *
+   * \since 6.4.0
+   */
+  explicit font_pool(file source)
+  {
+    if (!source) {
+      throw sdl_error{};
+    }
+
+    auto data = std::make_shared<data_type>();
+    source.read_all_to(*data);
+
+    if (data->empty()) {
+      throw cen_error{"Empty font file!"};
+    }
+
+    m_data = std::move(data);
+  }
+
+  /**
+   * \brief Creates a font of the specified size from the pooled font data.
+   *
+   * \details Creating a font doesn't read the font file, but the font face is still parsed
+   * and every font caches its own glyphs.
+   *
+   * \param size the font size, must be greater than zero.
+   *
+   * \return a font that shares the font data of the pool.
+   *
+   * \throws cen_error if the supplied size is not greater than zero.
+   * \throws ttf_error if the font cannot be loaded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto make_font(const int size) const -> font
+  {
+    return font{m_data, size};
+  }
+
+  /**
+   * \brief Returns the shared font data.
+   *
+   * \details The returned data can be used to create fonts directly, e.g. with
+   * `basic_renderer::emplace_font()`.
+   *
+   * \return the contents of the font file.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const std::shared_ptr<const data_type>&
+  {
+    return m_data;
+  }
+
+  /**
+   * \brief Returns the size of the font file.
+   *
+   * \return the amount of bytes that are stored in memory.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_data->size();
+  }
+
+  /**
+   * \brief Returns the amount of fonts that currently share the font data.
+   *
+   * \return the amount of alive fonts created from the pool.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto use_count() const noexcept -> usize
+  {
+    const auto count = m_data.use_count();
+    assert(count > 0);
+    return static_cast<usize>(count - 1);
+  }
+
+ private:
+  std::shared_ptr<const data_type> m_data;
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_FONT_POOL_HEADER
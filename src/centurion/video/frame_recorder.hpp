@@ -0,0 +1,292 @@
+#ifndef CENTURION_FRAME_RECORDER_HEADER
+#define CENTURION_FRAME_RECORDER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>     // assert
+#include <deque>       // deque
+#include <functional>  // function
+#include <optional>    // optional
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class frame_recorder
+ *
+ * \brief Captures rendered frames and hands them to a worker thread.
+ *
+ * \details A frame recorder owns a fixed ring of pre-allocated surfaces. Each call to
+ * `capture()` reads the current rendering target into a free surface and queues it for a
+ * worker thread, which invokes the consumer (e.g. a function that encodes or saves the
+ * frame) and then returns the surface to the ring. As a result, capturing a frame never
+ * allocates memory and never waits for the consumer to finish.
+ *
+ * \details If the consumer can't keep up and all surfaces are in use, the frame is
+ * dropped instead of stalling the rendering thread. Use a larger capacity to tolerate
+ * occasional slow frames.
+ *
+ * \note The read-back of the pixel data still happens on the calling thread, since SDL
+ * renderers may only be used on the thread that created them.
+ *
+ * \note The consumer is invoked on the worker thread and must not throw. The surface
+ * passed to the consumer is only valid for the duration of the call.
+ *
+ * \see `basic_renderer::capture()`
+ *
+ * \since 6.4.0
+ */
+class frame_recorder final
+{
+ public:
+  /**
+   * \typedef consumer_type
+   *
+   * \brief The signature of the function object that consumes captured frames.
+   *
+   * \details The second parameter is the index of the frame, which is incremented for
+   * every call to `capture()`, including calls that dropped the frame.
+   *
+   * \since 6.4.0
+   */
+  using consumer_type = std::function<void(const surface&, u64)>;
+
+  /**
+   * \brief Creates a frame recorder and starts its worker thread.
+   *
+   * \param size the size of the captured frames, i.e. the output size of the renderer.
+   * \param format the pixel format of the captured frames.
+   * \param consumer the function object that will be invoked for each captured frame.
+   * \param capacity the amount of pre-allocated surfaces, must be greater than zero.
+   *
+   * \throws cen_error if the consumer is empty.
+   * \throws sdl_error if the surfaces or the worker thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  frame_recorder(const iarea size,
+                 const pixel_format format,
+                 consumer_type consumer,
+                 const usize capacity = 3)
+      : m_consumer{std::move(consumer)}
+  {
+    assert(capacity > 0);
+
+    if (!m_consumer) {
+      throw cen_error{"Cannot create frame recorder without a consumer!"};
+    }
+
+    m_frames.reserve(capacity);
+    m_free.reserve(capacity);
+
+    for (usize index = 0; index < capacity; ++index) {
+      m_frames.emplace_back(size, format);
+      m_free.push_back(index);
+    }
+
+    m_worker.emplace(&frame_recorder::run, "frame_recorder", this);
+  }
+
+  frame_recorder(const frame_recorder&) = delete;
+
+  auto operator=(const frame_recorder&) -> frame_recorder& = delete;
+
+  /**
+   * \brief Stops the worker thread, after all queued frames have been consumed.
+   *
+   * \since 6.4.0
+   */
+  ~frame_recorder() noexcept
+  {
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.broadcast();
+    m_worker.reset();
+  }
+
+  /**
+   * \brief Captures the current rendering target and queues it for the consumer.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be captured, its output size must match the
+   * size of the recorder.
+   *
+   * \return `success` if the frame was queued; `failure` if the frame was dropped or the
+   * pixels couldn't be read.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto capture(const Renderer& renderer) -> result
+  {
+    usize index{};
+    u64 frame{};
+
+    {
+      scoped_lock lock{m_mutex};
+
+      frame = m_frameIndex++;
+
+      if (m_free.empty()) {
+        ++m_dropped;
+        return failure;
+      }
+
+      index = m_free.back();
+      m_free.pop_back();
+    }
+
+    // The surface is neither free nor queued, so the worker thread won't touch it
+    const auto ok = renderer.capture(m_frames[index]);
+
+    {
+      scoped_lock lock{m_mutex};
+
+      if (ok) {
+        m_queue.push_back({index, frame});
+      }
+      else {
+        m_free.push_back(index);
+        ++m_dropped;
+      }
+    }
+
+    if (ok) {
+      m_wake.signal();
+    }
+
+    return ok;
+  }
+
+  /**
+   * \brief Blocks until all queued frames have been consumed.
+   *
+   * \since 6.4.0
+   */
+  void wait()
+  {
+    scoped_lock lock{m_mutex};
+    while (!m_queue.empty() || m_busy) {
+      m_idle.wait(m_mutex);
+    }
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been consumed.
+   *
+   * \return the number of frames that were passed to the consumer.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto consumed() -> u64
+  {
+    scoped_lock lock{m_mutex};
+    return m_consumed;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been dropped.
+   *
+   * \return the number of frames that were dropped, either because no surface was
+   * available or because the pixels couldn't be read.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped() -> u64
+  {
+    scoped_lock lock{m_mutex};
+    return m_dropped;
+  }
+
+  /**
+   * \brief Returns the amount of pre-allocated surfaces.
+   *
+   * \return the capacity of the recorder.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> usize
+  {
+    return m_frames.size();
+  }
+
+ private:
+  struct queued_frame final
+  {
+    usize index{};  ///< The index of the surface that holds the frame.
+    u64 frame{};    ///< The index of the frame.
+  };
+
+  consumer_type m_consumer;
+  std::vector<surface> m_frames;
+  std::vector<usize> m_free;
+  std::deque<queued_frame> m_queue;
+  mutex m_mutex;
+  condition m_wake;
+  condition m_idle;
+  u64 m_frameIndex{};
+  u64 m_consumed{};
+  u64 m_dropped{};
+  bool m_busy{};
+  bool m_stop{};
+  std::optional<thread> m_worker;  // Last, so that the worker stops before anything else
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<frame_recorder*>(data);
+
+    self.m_mutex.lock();
+
+    while (true) {
+      while (!self.m_stop && self.m_queue.empty()) {
+        self.m_wake.wait(self.m_mutex);
+      }
+
+      // Queued frames are consumed before the worker stops
+      if (self.m_queue.empty()) {
+        break;
+      }
+
+      const auto [index, frame] = self.m_queue.front();
+      self.m_queue.pop_front();
+      self.m_busy = true;
+
+      self.m_mutex.unlock();
+      self.m_consumer(self.m_frames[index], frame);
+      self.m_mutex.lock();
+
+      self.m_free.push_back(index);
+      self.m_busy = false;
+      ++self.m_consumed;
+
+      self.m_idle.broadcast();
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_FRAME_RECORDER_HEADER
@@ -0,0 +1,549 @@
+#ifndef CENTURION_GEOMETRY_BATCH_HEADER
+#define CENTURION_GEOMETRY_BATCH_HEADER
+
+#include <SDL2/SDL.h>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <algorithm>         // min, max, clamp
+#include <cmath>             // sin, cos, sqrt, acos, ceil, abs
+#include <cstddef>           // ptrdiff_t
+#include <initializer_list>  // initializer_list
+#include <iterator>          // size, data
+#include <vector>            // vector
+
+#include "../core/integers.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class geometry_batch
+ *
+ * \brief Tessellates shapes into triangles, that are rendered with a single call.
+ *
+ * \details Shapes such as thick lines, polygons and rounded rectangles are converted into
+ * colored triangles when they are added to the batch. The batch is then submitted with
+ * `basic_renderer::render_geometry()`, which uses a single `SDL_RenderGeometry` call for
+ * all shapes in the batch, rather than many one-pixel primitives for each shape.
+ *
+ * \details The tessellation is only done once, so a batch that contains static shapes
+ * can be kept and rendered repeatedly without any additional cost. The buffers keep their
+ * capacity when the batch is cleared.
+ * \code{cpp}
+ *   cen::geometry_batch shapes;
+ *   shapes.add_rounded_rect({10, 10, 200, 50}, 8, cen::colors::dark_gray);
+ *   shapes.add_polyline(path, 3, cen::colors::red);
+ *
+ *   // Every frame
+ *   renderer.render_geometry(shapes);
+ * \endcode
+ *
+ * \details Angles are specified in degrees, clockwise from the positive x-axis, and
+ * curved shapes use an amount of segments that depends on their radius, unless an
+ * explicit amount is requested.
+ *
+ * \since 6.4.0
+ */
+class geometry_batch final
+{
+ public:
+  /**
+   * \brief Adds a line with a thickness to the batch.
+   *
+   * \param from the start point of the line.
+   * \param to the end point of the line.
+   * \param thickness the width of the line.
+   * \param tint the color of the line.
+   *
+   * \since 6.4.0
+   */
+  void add_line(const fpoint from,
+                const fpoint to,
+                const float thickness,
+                const color& tint = colors::white)
+  {
+    const fpoint points[] = {from, to};
+    add_polyline(points, thickness, tint);
+  }
+
+  /**
+   * \brief Adds a connected sequence of lines with a thickness to the batch.
+   *
+   * \details The joints between the lines are mitered, i.e. the outlines of adjacent lines
+   * are extended until they meet. The miter is limited for sharp angles, so that it extends
+   * no further than twice the thickness from the joint.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the type of the container, must store `fpoint` instances.
+   *
+   * \param points the points of the lines, fewer than two points are ignored.
+   * \param thickness the width of the lines.
+   * \param tint the color of the lines.
+   * \param closed `true` if the last point should be connected to the first point;
+   * `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  void add_polyline(const Container& points,
+                    const float thickness,
+                    const color& tint = colors::white,
+                    const bool closed = false)
+  {
+    const auto count = std::size(points);
+    if (count < 2) {
+      return;
+    }
+
+    const auto first = static_cast<int>(m_vertices.size());
+    const auto half = thickness / 2.0f;
+    const auto* data = std::data(points);
+
+    for (usize index = 0; index < count; ++index) {
+      const auto& point = data[index];
+      const auto hasPrev = closed || index != 0;
+      const auto hasNext = closed || index != count - 1;
+
+      const auto& prev = data[(index + count - 1) % count];
+      const auto& next = data[(index + 1) % count];
+
+      const auto n0 = hasPrev ? normal(prev, point) : SDL_FPoint{};
+      const auto n1 = hasNext ? normal(point, next) : SDL_FPoint{};
+      const auto [x, y] = miter(n0, n1, half);
+
+      add_vertex(point.x() + x, point.y() + y, tint);
+      add_vertex(point.x() - x, point.y() - y, tint);
+    }
+
+    const auto segments = closed ? count : count - 1;
+    for (usize segment = 0; segment < segments; ++segment) {
+      const auto a = first + static_cast<int>(segment * 2u);
+      const auto b = first + static_cast<int>(((segment + 1u) % count) * 2u);
+      add_quad(a, b, b + 1, a + 1);
+    }
+  }
+
+  /**
+   * \brief Adds a filled polygon to the batch.
+   *
+   * \details Both convex and concave polygons are supported, and the points may be in
+   * either clockwise or counter-clockwise order. Convex polygons are triangulated as
+   * triangle fans, concave polygons are triangulated with ear clipping.
+   *
+   * \note Self-intersecting polygons are not supported, and may be filled incorrectly.
+   *
+   * \tparam Container the type of the container, must provide `fpoint` instances.
+   *
+   * \param points the vertices of the polygon, fewer than three points are ignored.
+   * \param tint the color of the polygon.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  void add_polygon(const Container& points, const color& tint = colors::white)
+  {
+    const auto count = std::size(points);
+    if (count < 3) {
+      return;
+    }
+
+    const auto first = static_cast<int>(m_vertices.size());
+    for (const auto& point : points) {
+      add_vertex(point.x(), point.y(), tint);
+    }
+
+    triangulate(first, static_cast<int>(count));
+  }
+
+  /**
+   * \brief Adds a filled circle to the batch.
+   *
+   * \param center the center of the circle.
+   * \param radius the radius of the circle.
+   * \param tint the color of the circle.
+   * \param segments the amount of outline segments, or zero to base it on the radius.
+   *
+   * \since 6.4.0
+   */
+  void add_circle(const fpoint center,
+                  const float radius,
+                  const color& tint = colors::white,
+                  const usize segments = 0)
+  {
+    const auto count =
+        (segments != 0) ? std::max(segments, usize{3}) : circle_segments(radius);
+
+    const auto first = static_cast<int>(m_vertices.size());
+    add_vertex(center.x(), center.y(), tint);
+
+    for (usize index = 0; index < count; ++index) {
+      const auto angle = two_pi * static_cast<double>(index) / static_cast<double>(count);
+      add_vertex(center.x() + (radius * static_cast<float>(std::cos(angle))),
+                 center.y() + (radius * static_cast<float>(std::sin(angle))),
+                 tint);
+    }
+
+    add_fan(first, static_cast<int>(count));
+  }
+
+  /**
+   * \brief Adds an arc with a thickness to the batch, i.e. a part of a circle outline.
+   *
+   * \param center the center of the circle that the arc is a part of.
+   * \param radius the distance from the center to the middle of the arc line.
+   * \param startAngle the angle at which the arc starts, in degrees.
+   * \param endAngle the angle at which the arc ends, in degrees.
+   * \param thickness the width of the arc line.
+   * \param tint the color of the arc.
+   * \param segments the amount of segments, or zero to base it on the radius and angles.
+   *
+   * \since 6.4.0
+   */
+  void add_arc(const fpoint center,
+               const float radius,
+               const double startAngle,
+               const double endAngle,
+               const float thickness,
+               const color& tint = colors::white,
+               const usize segments = 0)
+  {
+    const auto sweep = (endAngle - startAngle) * two_pi / 360.0;
+    const auto count = (segments != 0) ? segments : arc_segments(radius, sweep);
+
+    const auto first = static_cast<int>(m_vertices.size());
+    const auto inner = radius - (thickness / 2.0f);
+    const auto outer = radius + (thickness / 2.0f);
+    const auto start = startAngle * two_pi / 360.0;
+
+    for (usize index = 0; index <= count; ++index) {
+      const auto step = static_cast<double>(index) / static_cast<double>(count);
+      const auto angle = start + (sweep * step);
+      const auto cos = static_cast<float>(std::cos(angle));
+      const auto sin = static_cast<float>(std::sin(angle));
+
+      add_vertex(center.x() + (outer * cos), center.y() + (outer * sin), tint);
+      add_vertex(center.x() + (inner * cos), center.y() + (inner * sin), tint);
+    }
+
+    for (usize index = 0; index < count; ++index) {
+      const auto a = first + static_cast<int>(index * 2u);
+      add_quad(a, a + 2, a + 3, a + 1);
+    }
+  }
+
+  /**
+   * \brief Adds a filled rectangle with rounded corners to the batch.
+   *
+   * \param rect the bounds of the rectangle.
+   * \param radius the radius of the corners, limited to half the width and height.
+   * \param tint the color of the rectangle.
+   * \param segments the amount of segments for each corner, or zero to base it on the
+   * radius.
+   *
+   * \since 6.4.0
+   */
+  void add_rounded_rect(const frect& rect,
+                        float radius,
+                        const color& tint = colors::white,
+                        const usize segments = 0)
+  {
+    radius = std::clamp(radius, 0.0f, std::min(rect.width(), rect.height()) / 2.0f);
+    const auto count = (radius <= 0) ? usize{0}
+                       : (segments != 0) ? segments
+                                         : arc_segments(radius, two_pi / 4.0);
+
+    const auto first = static_cast<int>(m_vertices.size());
+    add_vertex(rect.center_x(), rect.center_y(), tint);
+
+    // The corners, starting with the lower-right corner and proceeding clockwise
+    const SDL_FPoint centers[] = {{rect.max_x() - radius, rect.max_y() - radius},
+                                  {rect.x() + radius, rect.max_y() - radius},
+                                  {rect.x() + radius, rect.y() + radius},
+                                  {rect.max_x() - radius, rect.y() + radius}};
+
+    for (usize corner = 0; corner < 4; ++corner) {
+      for (usize index = 0; index <= count; ++index) {
+        const auto step = (count != 0) ? static_cast<double>(index) / count : 0.0;
+        const auto angle = (static_cast<double>(corner) + step) * two_pi / 4.0;
+        add_vertex(centers[corner].x + (radius * static_cast<float>(std::cos(angle))),
+                   centers[corner].y + (radius * static_cast<float>(std::sin(angle))),
+                   tint);
+      }
+    }
+
+    add_fan(first, static_cast<int>((count + 1u) * 4u));
+  }
+
+  /**
+   * \brief Removes all shapes from the batch.
+   *
+   * \details The capacity of the internal buffers is retained.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_vertices.clear();
+    m_indices.clear();
+  }
+
+  /**
+   * \brief Indicates whether or not the batch contains any triangles.
+   *
+   * \return `true` if the batch is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_indices.empty();
+  }
+
+  /**
+   * \brief Returns the amount of triangles in the batch.
+   *
+   * \return the number of triangles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto triangle_count() const noexcept -> usize
+  {
+    return m_indices.size() / 3u;
+  }
+
+  /**
+   * \brief Returns the vertices of the triangles in the batch.
+   *
+   * \return the vertices of all shapes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto vertices() const noexcept -> const std::vector<SDL_Vertex>&
+  {
+    return m_vertices;
+  }
+
+  /**
+   * \brief Returns the indices of the triangles in the batch.
+   *
+   * \return the vertex indices, three for each triangle.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto indices() const noexcept -> const std::vector<int>&
+  {
+    return m_indices;
+  }
+
+ private:
+  inline constexpr static double two_pi = 6.28318530717958647692;
+  inline constexpr static float miter_limit = 4.0f;  // In multiples of half the thickness
+
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+  std::vector<int> m_remaining;  // Used by the ear clipping
+
+  // The amount of segments for which the error is at most a quarter of a pixel
+  [[nodiscard]] static auto circle_segments(const float radius) noexcept -> usize
+  {
+    if (radius <= 0.25f) {
+      return 8;
+    }
+
+    const auto angle = std::acos(1.0 - (0.25 / static_cast<double>(radius)));
+    const auto segments = static_cast<usize>(std::ceil(two_pi / (2.0 * angle)));
+
+    return std::clamp(segments, usize{8}, usize{512});
+  }
+
+  [[nodiscard]] static auto arc_segments(const float radius, const double sweep) noexcept
+      -> usize
+  {
+    const auto fraction = std::abs(sweep) / two_pi;
+    const auto segments = std::ceil(static_cast<double>(circle_segments(radius)) * fraction);
+    return std::max(static_cast<usize>(segments), usize{1});
+  }
+
+  [[nodiscard]] static auto normal(const fpoint from, const fpoint to) noexcept
+      -> SDL_FPoint
+  {
+    const auto dx = to.x() - from.x();
+    const auto dy = to.y() - from.y();
+    const auto length = std::sqrt((dx * dx) + (dy * dy));
+    return (length > 0) ? SDL_FPoint{-dy / length, dx / length} : SDL_FPoint{};
+  }
+
+  // Returns the offset from a joint to the outer corner of its miter
+  [[nodiscard]] static auto miter(const SDL_FPoint n0, const SDL_FPoint n1, const float half)
+      -> SDL_FPoint
+  {
+    const SDL_FPoint sum{n0.x + n1.x, n0.y + n1.y};
+    const auto length = std::sqrt((sum.x * sum.x) + (sum.y * sum.y));
+
+    // Either an end point of the line, or a joint where the line turns back on itself
+    if (length < 0.0001f) {
+      const auto& n = (n1.x != 0 || n1.y != 0) ? n1 : n0;
+      return {n.x * half, n.y * half};
+    }
+
+    const SDL_FPoint direction{sum.x / length, sum.y / length};
+    const auto cosine = (direction.x * n0.x) + (direction.y * n0.y);
+    const auto cosineOrOne = (n0.x != 0 || n0.y != 0) ? cosine : 1.0f;
+    const auto scale = std::min(half / cosineOrOne, half * miter_limit);
+
+    return {direction.x * scale, direction.y * scale};
+  }
+
+  void add_vertex(const float x, const float y, const color& tint)
+  {
+    m_vertices.push_back({{x, y}, tint.get(), {0, 0}});
+  }
+
+  void add_quad(const int a, const int b, const int c, const int d)
+  {
+    m_indices.push_back(a);
+    m_indices.push_back(b);
+    m_indices.push_back(c);
+    m_indices.push_back(c);
+    m_indices.push_back(d);
+    m_indices.push_back(a);
+  }
+
+  // Adds triangles between a center vertex and the following vertices, in a closed loop
+  void add_fan(const int center, const int count)
+  {
+    for (int index = 0; index < count; ++index) {
+      m_indices.push_back(center);
+      m_indices.push_back(center + 1 + index);
+      m_indices.push_back(center + 1 + ((index + 1) % count));
+    }
+  }
+
+  [[nodiscard]] auto cross(const int a, const int b, const int c) const noexcept -> float
+  {
+    const auto& pa = m_vertices[static_cast<usize>(a)].position;
+    const auto& pb = m_vertices[static_cast<usize>(b)].position;
+    const auto& pc = m_vertices[static_cast<usize>(c)].position;
+    return ((pb.x - pa.x) * (pc.y - pa.y)) - ((pb.y - pa.y) * (pc.x - pa.x));
+  }
+
+  [[nodiscard]] auto contains(const int a, const int b, const int c, const int point) const
+      noexcept -> bool
+  {
+    const auto& p = m_vertices[static_cast<usize>(point)].position;
+    for (const auto corner : {a, b, c}) {
+      const auto& q = m_vertices[static_cast<usize>(corner)].position;
+      if (p.x == q.x && p.y == q.y) {
+        return false;
+      }
+    }
+
+    const auto d0 = cross(a, b, point);
+    const auto d1 = cross(b, c, point);
+    const auto d2 = cross(c, a, point);
+
+    const auto negative = d0 < 0 || d1 < 0 || d2 < 0;
+    const auto positive = d0 > 0 || d1 > 0 || d2 > 0;
+
+    return !(negative && positive);
+  }
+
+  void triangulate(const int first, const int count)
+  {
+    float area = 0;
+    bool convex = true;
+    float sign = 0;
+
+    for (int index = 0; index < count; ++index) {
+      const auto a = first + index;
+      const auto b = first + ((index + 1) % count);
+      const auto c = first + ((index + 2) % count);
+
+      const auto& pa = m_vertices[static_cast<usize>(a)].position;
+      const auto& pb = m_vertices[static_cast<usize>(b)].position;
+      area += (pa.x * pb.y) - (pb.x * pa.y);
+
+      const auto turn = cross(a, b, c);
+      if (turn != 0) {
+        convex = convex && (sign == 0 || (turn > 0) == (sign > 0));
+        sign = turn;
+      }
+    }
+
+    if (convex) {
+      for (int index = 1; index < count - 1; ++index) {
+        m_indices.push_back(first);
+        m_indices.push_back(first + index);
+        m_indices.push_back(first + index + 1);
+      }
+      return;
+    }
+
+    m_remaining.clear();
+    for (int index = 0; index < count; ++index) {
+      m_remaining.push_back(first + index);
+    }
+
+    const auto orientation = (area > 0) ? 1.0f : -1.0f;
+
+    while (m_remaining.size() > 3) {
+      const auto size = m_remaining.size();
+
+      bool clipped = false;
+      for (usize index = 0; index < size; ++index) {
+        const auto a = m_remaining[(index + size - 1) % size];
+        const auto b = m_remaining[index];
+        const auto c = m_remaining[(index + 1) % size];
+
+        // Reflex and degenerate vertices can't be ears
+        if (cross(a, b, c) * orientation <= 0) {
+          continue;
+        }
+
+        bool ear = true;
+        for (const auto other : m_remaining) {
+          if (other != a && other != b && other != c && contains(a, b, c, other)) {
+            ear = false;
+            break;
+          }
+        }
+
+        if (ear) {
+          m_indices.push_back(a);
+          m_indices.push_back(b);
+          m_indices.push_back(c);
+          m_remaining.erase(m_remaining.begin() + static_cast<std::ptrdiff_t>(index));
+          clipped = true;
+          break;
+        }
+      }
+
+      // Only happens for degenerate or self-intersecting polygons
+      if (!clipped) {
+        break;
+      }
+    }
+
+    for (usize index = 1; index + 1 < m_remaining.size(); ++index) {
+      m_indices.push_back(m_remaining.front());
+      m_indices.push_back(m_remaining[index]);
+      m_indices.push_back(m_remaining[index + 1]);
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+#endif  // CENTURION_GEOMETRY_BATCH_HEADER
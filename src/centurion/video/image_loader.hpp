@@ -0,0 +1,458 @@
+#ifndef CENTURION_IMAGE_LOADER_HEADER
+#define CENTURION_IMAGE_LOADER_HEADER
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include <cassert>        // assert
+#include <deque>          // deque
+#include <memory>         // unique_ptr, make_unique
+#include <optional>       // optional, nullopt
+#include <string>         // string
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/coroutine.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class image_loader
+ *
+ * \brief Decodes images on worker threads, and uploads them as textures.
+ *
+ * \details Decoding images, e.g. PNG files, is usually much more expensive than uploading
+ * the decoded pixels to the GPU. An image loader decodes enqueued images into surfaces on
+ * a pool of worker threads, so that the calling thread only has to perform the uploads,
+ * which are done with `upload()`. Since `upload()` accepts a budget, the uploads can be
+ * spread across several frames, e.g. to keep a loading screen responsive.
+ *
+ * \details Each enqueued image is identified by the ID returned by `enqueue()`, and the
+ * uploaded textures are obtained with `take()`.
+ *
+ * \note All functions, except for the destructor, must be called on the same thread, and
+ * `upload()` must be called on the thread that created the renderer.
+ *
+ * \since 6.4.0
+ */
+class image_loader final
+{
+ public:
+  using id_type = usize;
+
+  /**
+   * \enum load_status
+   *
+   * \brief Represents the different states of an enqueued image.
+   *
+   * \since 6.4.0
+   */
+  enum class load_status
+  {
+    unknown,  ///< The ID is unknown, or the texture has already been taken.
+    loading,  ///< The image is being decoded, or is waiting to be uploaded.
+    ready,    ///< The texture has been uploaded and can be taken.
+    failed    ///< The image couldn't be decoded or uploaded.
+  };
+
+  /**
+   * \brief Creates an image loader and starts its worker threads.
+   *
+   * \param workers the amount of worker threads, must be greater than zero.
+   *
+   * \throws sdl_error if the worker threads cannot be created.
+   *
+   * \since 6.4.0
+   */
+  explicit image_loader(const usize workers = 2)
+  {
+    assert(workers > 0);
+
+    m_workers.reserve(workers);
+    for (usize index = 0; index < workers; ++index) {
+      m_workers.push_back(std::make_unique<thread>(&image_loader::run, "image_loader", this));
+    }
+  }
+
+  image_loader(const image_loader&) = delete;
+
+  auto operator=(const image_loader&) -> image_loader& = delete;
+
+  /**
+   * \brief Stops the worker threads.
+   *
+   * \details Images that are currently being decoded are finished, but images that are
+   * still waiting in the queue are discarded.
+   *
+   * \since 6.4.0
+   */
+  ~image_loader() noexcept
+  {
+    m_mutex.lock();
+    m_stop = true;
+    m_mutex.unlock();
+
+    m_wake.broadcast();
+    m_workers.clear();
+  }
+
+  /**
+   * \brief Enqueues an image that will be decoded by a worker thread.
+   *
+   * \param path the file path of the image.
+   *
+   * \return the ID associated with the image.
+   *
+   * \since 6.4.0
+   */
+  auto enqueue(std::string path) -> id_type
+  {
+    const auto id = m_nextId++;
+
+    {
+      scoped_lock lock{m_mutex};
+      m_queue.push_back(queued_image{id, std::move(path)});
+      ++m_loading;
+    }
+
+    m_wake.signal();
+    return id;
+  }
+
+  /**
+   * \brief Uploads decoded images as textures.
+   *
+   * \details Call this function once per frame, on the rendering thread. Images are
+   * uploaded in the order in which they finished decoding, until the budget is exhausted.
+   * At least one image is uploaded per call, if there are any decoded images.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the textures.
+   * \param budget the maximum amount of pixel data uploaded by the call, in bytes, zero
+   * means no limit.
+   *
+   * \return the number of images that were uploaded (or failed to be uploaded).
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto upload(const Renderer& renderer, const usize budget = 0) -> usize
+  {
+    usize count = 0;
+    usize bytes = 0;
+
+    while (budget == 0 || bytes < budget) {
+      std::optional<decoded_image> image;
+
+      {
+        scoped_lock lock{m_mutex};
+
+        if (m_decoded.empty()) {
+          break;
+        }
+
+        image.emplace(std::move(m_decoded.front()));
+        m_decoded.pop_front();
+      }
+
+      const auto& pixels = image->pixels;
+      bytes += static_cast<usize>(pixels.pitch()) * static_cast<usize>(pixels.height());
+
+      auto* uploaded = SDL_CreateTextureFromSurface(renderer.get(), pixels.get());
+
+      if (uploaded) {
+        m_ready.try_emplace(image->id, texture{uploaded});
+      }
+
+      {
+        scoped_lock lock{m_mutex};
+
+        if (!uploaded) {
+          m_errors.try_emplace(image->id, SDL_GetError());
+        }
+
+        --m_loading;
+      }
+
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Takes ownership of an uploaded texture.
+   *
+   * \param id the ID of the image, obtained from `enqueue()`.
+   *
+   * \return the uploaded texture; `std::nullopt` if the texture isn't ready.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto take(const id_type id) -> std::optional<texture>
+  {
+    if (const auto it = m_ready.find(id); it != m_ready.end()) {
+      auto result = std::move(it->second);
+      m_ready.erase(it);
+      return result;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Returns the status of an enqueued image.
+   *
+   * \param id the ID of the image, obtained from `enqueue()`.
+   *
+   * \return the current status of the image.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto status(const id_type id) -> load_status
+  {
+    if (m_ready.find(id) != m_ready.end()) {
+      return load_status::ready;
+    }
+
+    scoped_lock lock{m_mutex};
+
+    if (m_errors.find(id) != m_errors.end()) {
+      return load_status::failed;
+    }
+    else if (is_loading(id)) {
+      return load_status::loading;
+    }
+    else {
+      return load_status::unknown;
+    }
+  }
+
+  /**
+   * \brief Returns the error message associated with an image that failed to load.
+   *
+   * \param id the ID of the image, obtained from `enqueue()`.
+   *
+   * \return the error message; `std::nullopt` if the image hasn't failed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto error(const id_type id) -> std::optional<std::string>
+  {
+    scoped_lock lock{m_mutex};
+
+    if (const auto it = m_errors.find(id); it != m_errors.end()) {
+      return it->second;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Blocks until all enqueued images have been decoded.
+   *
+   * \details The decoded images still have to be uploaded with `upload()`.
+   *
+   * \since 6.4.0
+   */
+  void wait()
+  {
+    scoped_lock lock{m_mutex};
+    while (!m_queue.empty() || m_busy != 0) {
+      m_idle.wait(m_mutex);
+    }
+  }
+
+  /**
+   * \brief Returns the amount of images that haven't been uploaded yet.
+   *
+   * \return the number of images that are being decoded or waiting to be uploaded.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto remaining() -> usize
+  {
+    scoped_lock lock{m_mutex};
+    return m_loading;
+  }
+
+  /**
+   * \brief Indicates whether or not all enqueued images have been processed.
+   *
+   * \return `true` if there are no images left to decode or upload; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_done() -> bool
+  {
+    return remaining() == 0;
+  }
+
+  /**
+   * \brief Returns the amount of worker threads.
+   *
+   * \return the number of worker threads.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto worker_count() const noexcept -> usize
+  {
+    return m_workers.size();
+  }
+
+ private:
+  struct queued_image final
+  {
+    id_type id{};
+    std::string path;
+  };
+
+  struct decoded_image final
+  {
+    id_type id{};
+    surface pixels;
+  };
+
+  std::deque<queued_image> m_queue;
+  std::deque<decoded_image> m_decoded;
+  std::vector<id_type> m_decoding;
+  std::unordered_map<id_type, std::string> m_errors;
+  std::unordered_map<id_type, texture> m_ready;  ///< Only accessed by the calling thread.
+  mutex m_mutex;
+  condition m_wake;
+  condition m_idle;
+  id_type m_nextId{};
+  usize m_loading{};  ///< Images that are queued, decoding or waiting to be uploaded.
+  usize m_busy{};
+  bool m_stop{};
+  std::vector<std::unique_ptr<thread>> m_workers;  // Last, so that workers stop first
+
+  // Must be called with the mutex locked
+  [[nodiscard]] auto is_loading(const id_type id) const noexcept -> bool
+  {
+    for (const auto& image : m_queue) {
+      if (image.id == id) {
+        return true;
+      }
+    }
+
+    for (const auto& image : m_decoded) {
+      if (image.id == id) {
+        return true;
+      }
+    }
+
+    for (const auto decoding : m_decoding) {
+      if (decoding == id) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  static auto run(void* data) noexcept -> int
+  {
+    auto& self = *static_cast<image_loader*>(data);
+
+    self.m_mutex.lock();
+
+    while (true) {
+      while (!self.m_stop && self.m_queue.empty()) {
+        self.m_wake.wait(self.m_mutex);
+      }
+
+      if (self.m_stop) {
+        break;
+      }
+
+      auto image = std::move(self.m_queue.front());
+      self.m_queue.pop_front();
+      self.m_decoding.push_back(image.id);
+      ++self.m_busy;
+
+      self.m_mutex.unlock();
+      auto* decoded = IMG_Load(image.path.c_str());
+      const std::string error = decoded ? "" : IMG_GetError();
+      self.m_mutex.lock();
+
+      if (decoded) {
+        self.m_decoded.push_back(decoded_image{image.id, surface{decoded}});
+      }
+      else {
+        self.m_errors.try_emplace(image.id, error);
+        --self.m_loading;
+      }
+
+      for (auto it = self.m_decoding.begin(); it != self.m_decoding.end(); ++it) {
+        if (*it == image.id) {
+          self.m_decoding.erase(it);
+          break;
+        }
+      }
+
+      --self.m_busy;
+      self.m_idle.broadcast();
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+};
+
+#if CENTURION_HAS_FEATURE_COROUTINES
+
+/**
+ * \brief Loads a texture with an image loader, for use in coroutines.
+ *
+ * \details The image is enqueued immediately, so several images can be loaded in parallel
+ * by awaiting the returned awaitables one after another. The awaiting coroutine is resumed
+ * once the image has been uploaded by `image_loader::upload()`.
+ * \code{cpp}
+ *   if (auto tiles = co_await cen::load_texture(images, "tiles.png")) {
+ *     m_tiles = std::move(*tiles);
+ *   }
+ * \endcode
+ *
+ * \param loader the image loader that will load the image, must outlive the awaitable.
+ * \param path the file path of the image.
+ *
+ * \return an awaitable that yields the texture; `std::nullopt` if the image couldn't be
+ * loaded.
+ *
+ * \see `coroutine`
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto load_texture(image_loader& loader, std::string path)
+{
+  const auto id = loader.enqueue(std::move(path));
+  return detail::poll_awaitable{
+      [&loader, id] { return loader.status(id) != image_loader::load_status::loading; },
+      [&loader, id] { return loader.take(id); }};
+}
+
+#endif  // CENTURION_HAS_FEATURE_COROUTINES
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_IMAGE
+#endif  // CENTURION_IMAGE_LOADER_HEADER
@@ -0,0 +1,462 @@
+#ifndef CENTURION_IMAGE_SAVER_HEADER
+#define CENTURION_IMAGE_SAVER_HEADER
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include <cassert>     // assert
+#include <cstddef>     // byte
+#include <cstring>     // memcpy
+#include <deque>       // deque
+#include <functional>  // function
+#include <memory>      // shared_ptr, make_shared
+#include <optional>    // optional, nullopt
+#include <string>      // string
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../filesystem/io_service.hpp"
+#include "../system/profiler_macros.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/task_scheduler.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct image_save_result
+ *
+ * \brief Provides the outcome of an asynchronous image save.
+ *
+ * \since 6.4.0
+ */
+struct image_save_result final
+{
+  usize id{};        ///< The ID returned when the save was submitted.
+  std::string path;  ///< The path of the saved image.
+  usize bytes{};     ///< The size of the encoded image, in bytes.
+  bool succeeded{};  ///< Indicates whether or not the image was encoded and written.
+};
+
+/// \cond FALSE
+namespace detail {
+
+// An SDL_RWops that appends everything written to it to a byte vector
+class memory_sink final
+{
+ public:
+  explicit memory_sink(std::vector<std::byte>& buffer) noexcept
+      : m_buffer{buffer}
+      , m_context{SDL_AllocRW()}
+  {
+    if (m_context) {
+      m_context->type = SDL_RWOPS_UNKNOWN;
+      m_context->size = &memory_sink::size;
+      m_context->seek = &memory_sink::seek;
+      m_context->read = &memory_sink::read;
+      m_context->write = &memory_sink::write;
+      m_context->close = &memory_sink::close;
+      m_context->hidden.unknown.data1 = this;
+    }
+  }
+
+  memory_sink(const memory_sink&) = delete;
+
+  auto operator=(const memory_sink&) -> memory_sink& = delete;
+
+  ~memory_sink() noexcept
+  {
+    if (m_context) {
+      SDL_FreeRW(m_context);
+    }
+  }
+
+  [[nodiscard]] auto get() const noexcept -> SDL_RWops*
+  {
+    return m_context;
+  }
+
+ private:
+  std::vector<std::byte>& m_buffer;
+  SDL_RWops* m_context{};
+  usize m_position{};
+
+  [[nodiscard]] static auto self(SDL_RWops* context) noexcept -> memory_sink&
+  {
+    return *static_cast<memory_sink*>(context->hidden.unknown.data1);
+  }
+
+  static Sint64 SDLCALL size(SDL_RWops* context) noexcept
+  {
+    return static_cast<Sint64>(self(context).m_buffer.size());
+  }
+
+  static Sint64 SDLCALL seek(SDL_RWops* context,
+                             const Sint64 offset,
+                             const int whence) noexcept
+  {
+    auto& sink = self(context);
+
+    Sint64 base = 0;
+    if (whence == RW_SEEK_CUR) {
+      base = static_cast<Sint64>(sink.m_position);
+    }
+    else if (whence == RW_SEEK_END) {
+      base = static_cast<Sint64>(sink.m_buffer.size());
+    }
+
+    if (base + offset < 0) {
+      return SDL_SetError("Attempted to seek before the start of a memory sink");
+    }
+
+    sink.m_position = static_cast<usize>(base + offset);
+    return static_cast<Sint64>(sink.m_position);
+  }
+
+  static size_t SDLCALL read(SDL_RWops*, void*, size_t, size_t) noexcept
+  {
+    SDL_SetError("Attempted to read from a memory sink");
+    return 0;
+  }
+
+  static size_t SDLCALL write(SDL_RWops* context,
+                              const void* data,
+                              const size_t size,
+                              const size_t count) noexcept
+  {
+    auto& sink = self(context);
+    const auto bytes = size * count;
+
+    try {
+      if (sink.m_buffer.size() < sink.m_position + bytes) {
+        sink.m_buffer.resize(sink.m_position + bytes);
+      }
+    }
+    catch (...) {
+      SDL_OutOfMemory();
+      return 0;
+    }
+
+    if (bytes != 0) {
+      std::memcpy(sink.m_buffer.data() + sink.m_position, data, bytes);
+      sink.m_position += bytes;
+    }
+
+    return count;
+  }
+
+  static int SDLCALL close(SDL_RWops*) noexcept
+  {
+    return 0;  // The context is freed by the destructor
+  }
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class image_saver
+ *
+ * \brief Encodes and writes images without blocking the calling thread.
+ *
+ * \details Saving a screenshot with `surface::save_as_png()` encodes and writes the image
+ * on the calling thread, which can take long enough to cause a visible hitch. An image
+ * saver instead encodes the image on a task scheduler, and writes the encoded image with
+ * an I/O service.
+ * \code{cpp}
+ *   cen::task_scheduler scheduler;
+ *   cen::io_service io;
+ *   cen::image_saver saver{scheduler, io};
+ *
+ *   saver.save_png(renderer.capture(cen::pixel_format::rgba32), "screenshot.png",
+ *                  [](const cen::image_save_result& result) {
+ *                    // ...
+ *                  });
+ *
+ *   // Once per frame
+ *   saver.poll();
+ *   io.poll();
+ * \endcode
+ *
+ * \details The saved surfaces are taken by value, so pass a surface with `std::move()` to
+ * hand it over, or pass it as is to save a copy. Every save that hasn't been completed
+ * holds on to its surface and its encoded image, so the amount of saves in flight is
+ * limited; saves are rejected instead of queued once the limit is reached, because
+ * blocking would defeat the purpose of saving asynchronously.
+ *
+ * \details The callbacks are invoked by `poll()` for images that couldn't be encoded, and
+ * by `io_service::poll()` for images that were handed to the I/O service. Either way,
+ * they are invoked on the thread that calls the poll functions.
+ *
+ * \note All functions must be called on the thread that uses the I/O service. The task
+ * scheduler and the I/O service must outlive the image saver.
+ *
+ * \see `io_service`
+ * \see `task_scheduler`
+ *
+ * \since 6.4.0
+ */
+class image_saver final
+{
+ public:
+  using id_type = usize;
+  using callback_type = std::function<void(const image_save_result&)>;
+
+  /**
+   * \brief Creates an image saver.
+   *
+   * \param scheduler the task scheduler that encodes the images.
+   * \param io the I/O service that writes the encoded images.
+   * \param capacity the maximum amount of saves in flight, must be greater than zero.
+   *
+   * \since 6.4.0
+   */
+  image_saver(task_scheduler& scheduler, io_service& io, const usize capacity = 4)
+      : m_scheduler{scheduler}
+      , m_io{io}
+      , m_state{std::make_shared<shared_state>()}
+      , m_capacity{capacity}
+  {
+    assert(capacity > 0);
+  }
+
+  image_saver(const image_saver&) = delete;
+
+  auto operator=(const image_saver&) -> image_saver& = delete;
+
+  /**
+   * \brief Finishes the pending encodes, and submits their writes.
+   *
+   * \details Saves that have been handed to the I/O service still invoke their callbacks
+   * when the I/O service is polled.
+   *
+   * \since 6.4.0
+   */
+  ~image_saver() noexcept
+  {
+    m_scheduler.wait(m_encodes);
+
+    try {
+      poll();
+    }
+    catch (...) {
+      // The writes of the remaining images are dropped
+    }
+  }
+
+  /**
+   * \brief Submits a surface to be saved as a PNG image.
+   *
+   * \param image the surface that will be saved.
+   * \param path the path of the image file.
+   * \param callback the function invoked once the image has been saved, or has failed to
+   * be saved.
+   *
+   * \return the ID associated with the save; `std::nullopt` if the maximum amount of saves
+   * are in flight.
+   *
+   * \since 6.4.0
+   */
+  auto save_png(surface image, std::string path, callback_type callback = {})
+      -> std::optional<id_type>
+  {
+    return submit(std::move(image), std::move(path), std::move(callback), encoder::png, 0);
+  }
+
+  /**
+   * \brief Submits a surface to be saved as a JPG image.
+   *
+   * \param image the surface that will be saved.
+   * \param path the path of the image file.
+   * \param quality the quality of the JPG image, in the range [0, 100].
+   * \param callback the function invoked once the image has been saved, or has failed to
+   * be saved.
+   *
+   * \return the ID associated with the save; `std::nullopt` if the maximum amount of saves
+   * are in flight.
+   *
+   * \since 6.4.0
+   */
+  auto save_jpg(surface image,
+                std::string path,
+                const int quality,
+                callback_type callback = {}) -> std::optional<id_type>
+  {
+    return submit(std::move(image),
+                  std::move(path),
+                  std::move(callback),
+                  encoder::jpg,
+                  quality);
+  }
+
+  /**
+   * \brief Hands encoded images to the I/O service.
+   *
+   * \details Call this function once per frame. The callbacks of images that couldn't be
+   * encoded are invoked by this function.
+   *
+   * \return the amount of encoded images that were processed.
+   *
+   * \since 6.4.0
+   */
+  auto poll() -> usize
+  {
+    std::deque<encoded> done;
+
+    {
+      scoped_lock lock{m_state->lock};
+      done.swap(m_state->queue);
+    }
+
+    for (auto& image : done) {
+      if (!image.succeeded) {
+        --m_state->inFlight;
+
+        if (image.callback) {
+          image.callback(image_save_result{image.id, std::move(image.path), 0, false});
+        }
+
+        continue;
+      }
+
+      m_io.write(std::move(image.path),
+                 std::move(image.data),
+                 [state = m_state, id = image.id, callback = std::move(image.callback)](
+                     io_completion& completion) {
+                   --state->inFlight;
+
+                   if (callback) {
+                     callback(image_save_result{id,
+                                                completion.path,
+                                                completion.data.size(),
+                                                completion.succeeded});
+                   }
+                 });
+    }
+
+    return done.size();
+  }
+
+  /**
+   * \brief Returns the amount of saves that haven't completed.
+   *
+   * \return the number of saves that are being encoded, written or waiting to be polled.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto in_flight() const noexcept -> usize
+  {
+    return m_state->inFlight;
+  }
+
+  /**
+   * \brief Returns the maximum amount of saves in flight.
+   *
+   * \return the capacity of the saver.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> usize
+  {
+    return m_capacity;
+  }
+
+ private:
+  enum class encoder
+  {
+    png,
+    jpg
+  };
+
+  struct encoded final
+  {
+    id_type id{};
+    std::string path;
+    std::vector<std::byte> data;
+    callback_type callback;
+    bool succeeded{};
+  };
+
+  // Shared with the write callbacks, which may be invoked after the saver is destroyed
+  struct shared_state final
+  {
+    mutex lock;
+    std::deque<encoded> queue;
+    usize inFlight{};  ///< Only accessed on the polling thread.
+  };
+
+  task_scheduler& m_scheduler;
+  io_service& m_io;
+  std::shared_ptr<shared_state> m_state;
+  task_group m_encodes;
+  usize m_capacity{};
+  id_type m_nextId{};
+
+  auto submit(surface image,
+              std::string path,
+              callback_type callback,
+              const encoder format,
+              const int quality) -> std::optional<id_type>
+  {
+    if (m_state->inFlight >= m_capacity) {
+      return std::nullopt;
+    }
+
+    const auto id = m_nextId++;
+    ++m_state->inFlight;
+
+    // The surface is shared, since tasks must be copyable
+    auto pending = std::make_shared<encoded>();
+    pending->id = id;
+    pending->path = std::move(path);
+    pending->callback = std::move(callback);
+
+    auto source = std::make_shared<surface>(std::move(image));
+
+    auto task = [state = m_state, pending, source, format, quality]() mutable {
+      CENTURION_PROFILE_ZONE("image_saver::encode");
+
+      pending->succeeded = encode(*source, pending->data, format, quality);
+      source.reset();
+
+      scoped_lock lock{state->lock};
+      state->queue.push_back(std::move(*pending));
+    };
+
+    m_scheduler.submit(m_encodes, std::move(task));
+
+    return id;
+  }
+
+  [[nodiscard]] static auto encode(const surface& image,
+                                   std::vector<std::byte>& data,
+                                   const encoder format,
+                                   const int quality) noexcept -> bool
+  {
+    detail::memory_sink sink{data};
+    if (!sink.get()) {
+      return false;
+    }
+
+    if (format == encoder::png) {
+      return IMG_SavePNG_RW(image.get(), sink.get(), 0) == 0;
+    }
+    else {
+      return IMG_SaveJPG_RW(image.get(), sink.get(), 0, quality) == 0;
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_IMAGE
+#endif  // CENTURION_IMAGE_SAVER_HEADER
@@ -0,0 +1,448 @@
+#ifndef CENTURION_INDEXED_TEXTURE_HEADER
+#define CENTURION_INDEXED_TEXTURE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // min, max, rotate
+#include <array>      // array
+#include <cassert>    // assert
+#include <cstring>    // memcpy
+#include <vector>     // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../core/to_underlying.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "palette.hpp"
+#include "pixel_format.hpp"
+#include "pixel_format_info.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "texture_lock.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class indexed_texture
+ *
+ * \brief A streaming texture that is based on 8-bit palette indices, which enables cheap
+ * palette animation.
+ *
+ * \details Palette effects, such as color cycling, normally require an 8-bit surface to
+ * be converted to a new texture every time the palette changes, which touches every
+ * pixel. An indexed texture instead keeps the index data, along with a table of the
+ * palette colors in the format of the texture, and records which palette indices are used
+ * by each row. Changing palette colors only marks the colors as dirty, and `update()` only
+ * rewrites the rows that use a changed color.
+ * \code{cpp}
+ *   cen::indexed_texture water{renderer, cen::surface{"water.pcx"}};
+ *
+ *   // Once per frame
+ *   water.cycle(32, 16);
+ *   water.update();
+ *   renderer.render(water.get(), cen::ipoint{0, 0});
+ * \endcode
+ *
+ * \details The indices are looked up on the CPU, since SDL renderers have no support for
+ * palette textures. The cost of palette changes is still proportional to the size of the
+ * palette, plus the amount of pixels that are shown with the changed colors.
+ *
+ * \note The color key of source surfaces is honored, by making the color key index
+ * transparent.
+ *
+ * \see `palette`
+ *
+ * \since 6.4.0
+ */
+class indexed_texture final
+{
+ public:
+  /// The maximum amount of colors in the palette of an indexed texture.
+  inline constexpr static usize max_colors = 256;
+
+  /**
+   * \brief Creates an indexed texture from an 8-bit indexed surface.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture.
+   * \param source a surface that uses the `index8` pixel format.
+   *
+   * \throws cen_error if the surface doesn't use the `index8` pixel format.
+   * \throws sdl_error if the texture couldn't be created or uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  indexed_texture(const Renderer& renderer, const surface& source)
+      : indexed_texture{renderer, source.size()}
+  {
+    auto* image = source.get();
+    if (source.format_info().format() != pixel_format::index8 || !image->format->palette) {
+      throw cen_error{"Indexed textures require an index8 surface!"};
+    }
+
+    const auto* palette = image->format->palette;
+    const auto count = std::min(max_colors, static_cast<usize>(palette->ncolors));
+    for (usize index = 0; index < count; ++index) {
+      set_lookup(index, color{palette->colors[index]});
+    }
+
+    Uint32 key{};
+    if (SDL_GetColorKey(image, &key) == 0 && key < max_colors) {
+      m_colors[key].set_alpha(0);
+      set_lookup(key, m_colors[key]);
+    }
+
+    if (SDL_MUSTLOCK(image) && SDL_LockSurface(image) != 0) {
+      throw sdl_error{};
+    }
+
+    load_indices(static_cast<const u8*>(image->pixels), image->pitch);
+
+    if (SDL_MUSTLOCK(image)) {
+      SDL_UnlockSurface(image);
+    }
+
+    upload(0, m_size.height);
+  }
+
+  /**
+   * \brief Creates an indexed texture from index data and a palette.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture.
+   * \param size the size of the texture.
+   * \param indices the palette indices, cannot be null.
+   * \param pitch the number of bytes in a row of the index data, including padding.
+   * \param palette the palette of the texture, only the first 256 colors are used.
+   *
+   * \throws sdl_error if the texture couldn't be created or uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  indexed_texture(const Renderer& renderer,
+                  const iarea size,
+                  const not_null<const u8*> indices,
+                  const int pitch,
+                  const palette& palette)
+      : indexed_texture{renderer, size}
+  {
+    assert(indices);
+    assert(pitch >= size.width);
+
+    const auto count = std::min(max_colors, static_cast<usize>(palette.size()));
+    for (usize index = 0; index < count; ++index) {
+      set_lookup(index, palette[static_cast<int>(index)]);
+    }
+
+    load_indices(indices, pitch);
+    upload(0, m_size.height);
+  }
+
+  /// \name Palette functions
+  /// \{
+
+  /**
+   * \brief Sets a color in the palette.
+   *
+   * \details The change is uploaded by the next call to `update()`. Setting a color to its
+   * current value doesn't cause any rows to be updated.
+   *
+   * \pre `index` must be less than `max_colors`.
+   *
+   * \param index the palette index of the color.
+   * \param color the new color.
+   *
+   * \since 6.4.0
+   */
+  void set_color(const usize index, const color& color) noexcept
+  {
+    assert(index < max_colors);
+
+    if (m_colors[index] != color) {
+      set_lookup(index, color);
+      m_dirtyColors[index / 64u] |= u64{1} << (index % 64u);
+    }
+  }
+
+  /**
+   * \brief Rotates a range of palette colors, which is the classic color cycling effect.
+   *
+   * \details Each color in the range moves `steps` positions forward, and the colors that
+   * are moved past the end of the range wrap around to the start of the range.
+   *
+   * \pre `first + count` must not be greater than `max_colors`.
+   *
+   * \param first the index of the first color in the range.
+   * \param count the amount of colors in the range.
+   * \param steps the amount of positions that the colors are moved.
+   *
+   * \since 6.4.0
+   */
+  void cycle(const usize first, const usize count, const usize steps = 1) noexcept
+  {
+    assert(first + count <= max_colors);
+
+    if (count < 2 || steps % count == 0) {
+      return;
+    }
+
+    auto colors = m_colors;
+    auto* begin = colors.data() + first;
+    std::rotate(begin, begin + (count - steps % count), begin + count);
+
+    for (auto index = first; index < first + count; ++index) {
+      set_color(index, colors[index]);
+    }
+  }
+
+  /**
+   * \brief Returns a color in the palette.
+   *
+   * \pre `index` must be less than `max_colors`.
+   *
+   * \param index the palette index of the color.
+   *
+   * \return the color associated with the index.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_color(const usize index) const noexcept -> const color&
+  {
+    assert(index < max_colors);
+    return m_colors[index];
+  }
+
+  /// \} End of palette functions
+
+  /// \name Index functions
+  /// \{
+
+  /**
+   * \brief Changes the palette index of a pixel.
+   *
+   * \details The change is uploaded by the next call to `update()`. Pixels outside of the
+   * texture are ignored.
+   *
+   * \param pixel the position of the pixel.
+   * \param index the new palette index of the pixel.
+   *
+   * \since 6.4.0
+   */
+  void set_index(const ipoint pixel, const u8 index) noexcept
+  {
+    if (pixel.x() < 0 || pixel.y() < 0 || pixel.x() >= m_size.width ||
+        pixel.y() >= m_size.height)
+    {
+      return;
+    }
+
+    const auto row = static_cast<usize>(pixel.y());
+    m_indices[row * static_cast<usize>(m_size.width) + static_cast<usize>(pixel.x())] = index;
+
+    // The bit of the previous index is kept, which at worst causes redundant row updates
+    m_rowColors[row][index / 64u] |= u64{1} << (index % 64u);
+
+    m_dirtyBegin = std::min(m_dirtyBegin, pixel.y());
+    m_dirtyEnd = std::max(m_dirtyEnd, pixel.y() + 1);
+  }
+
+  /**
+   * \brief Returns the palette index of a pixel.
+   *
+   * \pre `pixel` must be within the bounds of the texture.
+   *
+   * \param pixel the position of the pixel.
+   *
+   * \return the palette index of the pixel.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_index(const ipoint pixel) const noexcept -> u8
+  {
+    assert(pixel.x() >= 0 && pixel.x() < m_size.width);
+    assert(pixel.y() >= 0 && pixel.y() < m_size.height);
+    return m_indices[static_cast<usize>(pixel.y()) * static_cast<usize>(m_size.width) +
+                     static_cast<usize>(pixel.x())];
+  }
+
+  /// \} End of index functions
+
+  /**
+   * \brief Uploads the pending changes to the texture.
+   *
+   * \details Only rows that use a changed palette color, or that contain a changed index,
+   * are rewritten. Consecutive rows are uploaded with a single texture lock.
+   *
+   * \return the amount of rows that were uploaded.
+   *
+   * \throws sdl_error if the texture couldn't be locked.
+   *
+   * \since 6.4.0
+   */
+  auto update() -> usize
+  {
+    const auto anyColors = (m_dirtyColors[0] | m_dirtyColors[1] | m_dirtyColors[2] |
+                            m_dirtyColors[3]) != 0;
+
+    if (!anyColors && m_dirtyBegin >= m_dirtyEnd) {
+      return 0;
+    }
+
+    usize uploaded = 0;
+    int runBegin = -1;
+
+    for (auto y = 0; y < m_size.height; ++y) {
+      const auto dirty = (y >= m_dirtyBegin && y < m_dirtyEnd) ||
+                         (anyColors && uses_dirty_color(static_cast<usize>(y)));
+
+      if (dirty && runBegin == -1) {
+        runBegin = y;
+      }
+      else if (!dirty && runBegin != -1) {
+        upload(runBegin, y);
+        uploaded += static_cast<usize>(y - runBegin);
+        runBegin = -1;
+      }
+    }
+
+    if (runBegin != -1) {
+      upload(runBegin, m_size.height);
+      uploaded += static_cast<usize>(m_size.height - runBegin);
+    }
+
+    m_dirtyColors.fill(0);
+    m_dirtyBegin = m_size.height;
+    m_dirtyEnd = 0;
+
+    return uploaded;
+  }
+
+  /**
+   * \brief Returns the underlying streaming texture, which is used for rendering.
+   *
+   * \note Don't modify the pixels of the returned texture.
+   *
+   * \return the underlying texture.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get() noexcept -> texture&
+  {
+    return m_texture;
+  }
+
+  /// \copydoc get()
+  [[nodiscard]] auto get() const noexcept -> const texture&
+  {
+    return m_texture;
+  }
+
+  /**
+   * \brief Returns the size of the texture.
+   *
+   * \return the texture size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+ private:
+  using color_mask = std::array<u64, max_colors / 64u>;
+
+  texture m_texture;
+  pixel_format_info m_info;
+  iarea m_size;
+  std::vector<u8> m_indices;
+  std::vector<color_mask> m_rowColors;  ///< The palette indices used by each row.
+  std::array<color, max_colors> m_colors;
+  std::array<u32, max_colors> m_lookup{};
+  color_mask m_dirtyColors{};
+  int m_dirtyBegin{};  ///< The first row with a changed index.
+  int m_dirtyEnd{};    ///< One past the last row with a changed index.
+
+  template <typename Renderer>
+  indexed_texture(const Renderer& renderer, const iarea size)
+      : m_texture{renderer, pixel_format::argb8888, texture_access::streaming, size}
+      , m_info{pixel_format::argb8888}
+      , m_size{size}
+      , m_indices(static_cast<usize>(size.width) * static_cast<usize>(size.height))
+      , m_rowColors(static_cast<usize>(size.height))
+      , m_dirtyBegin{size.height}
+  {
+    m_colors.fill(colors::black);
+    m_lookup.fill(m_info.rgba_to_pixel(colors::black));
+    m_texture.set_blend_mode(blend_mode::blend);
+  }
+
+  void set_lookup(const usize index, const color& color) noexcept
+  {
+    m_colors[index] = color;
+    m_lookup[index] = m_info.rgba_to_pixel(color);
+  }
+
+  void load_indices(const u8* indices, const int pitch) noexcept
+  {
+    const auto width = static_cast<usize>(m_size.width);
+
+    for (usize y = 0; y < m_rowColors.size(); ++y) {
+      const auto* src = indices + y * static_cast<usize>(pitch);
+      auto* dst = m_indices.data() + y * width;
+      std::memcpy(dst, src, width);
+
+      auto& mask = m_rowColors[y];
+      for (usize x = 0; x < width; ++x) {
+        mask[dst[x] / 64u] |= u64{1} << (dst[x] % 64u);
+      }
+    }
+  }
+
+  [[nodiscard]] auto uses_dirty_color(const usize row) const noexcept -> bool
+  {
+    const auto& mask = m_rowColors[row];
+    return ((mask[0] & m_dirtyColors[0]) | (mask[1] & m_dirtyColors[1]) |
+            (mask[2] & m_dirtyColors[2]) | (mask[3] & m_dirtyColors[3])) != 0;
+  }
+
+  // Rewrites the rows in the range [begin, end)
+  void upload(const int begin, const int end)
+  {
+    if (begin >= end) {
+      return;
+    }
+
+    texture_lock lock{m_texture, irect{0, begin, m_size.width, end - begin}};
+
+    const auto width = static_cast<usize>(m_size.width);
+    for (auto y = begin; y < end; ++y) {
+      const auto* src = m_indices.data() + static_cast<usize>(y) * width;
+      auto* dst = lock.row(y - begin);
+
+      for (usize x = 0; x < width; ++x) {
+        dst[x] = m_lookup[src[x]];
+      }
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_INDEXED_TEXTURE_HEADER
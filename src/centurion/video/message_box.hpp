@@ -13,6 +13,7 @@
 #include <vector>       // vector
 
 #include "../compiler/features.hpp"
+#include "../compiler/linkage.hpp"
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../core/to_underlying.hpp"
@@ -466,64 +467,78 @@ class message_box final
     return to_underlying(type) | to_underlying(buttonOrder);
   }
 
-  static void show(SDL_Window* parent,
-                   const std::string& title,
-                   const std::string& message,
-                   const message_box_type type,
-                   const button_order buttonOrder)
+  CENTURION_API CENTURION_LIB_INLINE static void show(SDL_Window* parent,
+                                                     const std::string& title,
+                                                     const std::string& message,
+                                                     message_box_type type,
+                                                     button_order buttonOrder);
+
+  CENTURION_API CENTURION_LIB_INLINE auto show(SDL_Window* parent)
+      -> std::optional<button_id>;
+};
+
+#if CENTURION_LIB_DEFINITIONS
+
+CENTURION_LIB_INLINE void message_box::show(SDL_Window* parent,
+                                             const std::string& title,
+                                             const std::string& message,
+                                             const message_box_type type,
+                                             const button_order buttonOrder)
+{
+  if (-1 == SDL_ShowSimpleMessageBox(to_flags(type, buttonOrder),
+                                     title.c_str(),
+                                     message.c_str(),
+                                     parent))
   {
-    if (-1 == SDL_ShowSimpleMessageBox(to_flags(type, buttonOrder),
-                                       title.c_str(),
-                                       message.c_str(),
-                                       parent))
-    {
-      throw sdl_error{};
-    }
+    throw sdl_error{};
   }
+}
 
-  auto show(SDL_Window* parent) -> std::optional<button_id>
-  {
-    SDL_MessageBoxData data{};
+CENTURION_LIB_INLINE auto message_box::show(SDL_Window* parent)
+    -> std::optional<button_id>
+{
+  SDL_MessageBoxData data{};
 
-    data.window = parent;
-    data.title = m_title.c_str();
-    data.message = m_message.c_str();
-    data.flags = to_flags(m_type, m_buttonOrder);
-    data.colorScheme = m_colorScheme ? m_colorScheme->get() : nullptr;
+  data.window = parent;
+  data.title = m_title.c_str();
+  data.message = m_message.c_str();
+  data.flags = to_flags(m_type, m_buttonOrder);
+  data.colorScheme = m_colorScheme ? m_colorScheme->get() : nullptr;
 
 #if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
-    // Realistically 1-3 buttons, stack buffer for 8 buttons, just in case.
-    detail::stack_resource<8 * sizeof(SDL_MessageBoxButtonData)> resource;
-    std::pmr::vector<SDL_MessageBoxButtonData> buttonData{resource.get()};
+  // Realistically 1-3 buttons, stack buffer for 8 buttons, just in case.
+  detail::stack_resource<8 * sizeof(SDL_MessageBoxButtonData)> resource;
+  std::pmr::vector<SDL_MessageBoxButtonData> buttonData{resource.get()};
 #else
-    std::vector<SDL_MessageBoxButtonData> buttonData;
-    buttonData.reserve(8);
+  std::vector<SDL_MessageBoxButtonData> buttonData;
+  buttonData.reserve(8);
 #endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
 
-    if (m_buttons.empty()) {
-      add_button(0, "OK", default_button::return_key);
-    }
+  if (m_buttons.empty()) {
+    add_button(0, "OK", default_button::return_key);
+  }
 
-    for (const auto& button : m_buttons) {
-      buttonData.emplace_back(button.convert());
-    }
+  for (const auto& button : m_buttons) {
+    buttonData.emplace_back(button.convert());
+  }
 
-    data.buttons = buttonData.data();
-    data.numbuttons = isize(buttonData);
+  data.buttons = buttonData.data();
+  data.numbuttons = isize(buttonData);
 
-    button_id button{-1};
-    if (SDL_ShowMessageBox(&data, &button) == -1) {
-      throw sdl_error{};
-    }
+  button_id button{-1};
+  if (SDL_ShowMessageBox(&data, &button) == -1) {
+    throw sdl_error{};
+  }
 
-    if (button != -1) {
-      return button;
-    }
-    else {
-      return std::nullopt;
-    }
+  if (button != -1) {
+    return button;
   }
-};
+  else {
+    return std::nullopt;
+  }
+}
+
+#endif  // CENTURION_LIB_DEFINITIONS
 
 /// \name String conversions
 /// \{
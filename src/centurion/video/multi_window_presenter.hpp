@@ -0,0 +1,420 @@
+#ifndef CENTURION_MULTI_WINDOW_PRESENTER_HEADER
+#define CENTURION_MULTI_WINDOW_PRESENTER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>   // find_if
+#include <cassert>     // assert
+#include <functional>  // function
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../events/window_event.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "dirty_region.hpp"
+#include "renderer.hpp"
+#include "vsync_mode.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class multi_window_presenter
+ *
+ * \brief Renders and presents a set of windows, each with its own renderer, once per
+ * frame.
+ *
+ * \details Presenting several windows in a row with VSync enabled makes each present wait
+ * for the next display refresh, so the frame rate is divided by the amount of windows. A
+ * multi-window presenter instead enables VSync for a single window, the sync window, and
+ * presents it after all other windows, so that the frame is only paced once.
+ * \code{cpp}
+ *   cen::multi_window_presenter presenter;
+ *
+ *   presenter.add(mainWindow, mainRenderer, [&](cen::renderer_handle& renderer,
+ *                                               const cen::irect& damaged) {
+ *     scene.render(renderer);
+ *   });
+ *
+ *   presenter.add(toolWindow, toolRenderer, [&](cen::renderer_handle& renderer,
+ *                                               const cen::irect& damaged) {
+ *     tools.render(renderer);
+ *   });
+ *
+ *   presenter.set_sync_window(mainWindow.id());
+ *
+ *   while (running) {
+ *     // Forward window events, and mark the windows that changed
+ *     presenter.mark_all(mainWindow.id());
+ *     presenter.present();
+ *   }
+ * \endcode
+ *
+ * \details Each window has a dirty region, which accumulates the areas that have changed
+ * since the window was last presented. Windows without any damage are neither rendered nor
+ * presented, and neither are hidden or minimized windows, whose damage is kept until they
+ * are visible again. The draw function receives the damaged area, which can be forwarded to
+ * a `damage_tracker` to only redraw the changed parts of the window.
+ *
+ * \note The windows and renderers must outlive the presenter, or be removed before they
+ * are destroyed.
+ *
+ * \note If the sync window isn't presented during a frame, e.g. because it is minimized,
+ * nothing waits for VSync, so the caller should pace such frames by other means, see
+ * `was_synchronized()` and `game_loop`.
+ *
+ * \see `damage_tracker`
+ * \see `basic_renderer::set_vsync()`
+ *
+ * \since 6.4.0
+ */
+class multi_window_presenter final
+{
+ public:
+  using draw_type = std::function<void(renderer_handle&, const irect&)>;
+
+  /**
+   * \brief Adds a window that will be rendered and presented by the presenter.
+   *
+   * \details The entire window is damaged initially. Nothing happens if the window has
+   * already been added. If there is a sync window, VSync is disabled for the renderer.
+   *
+   * \tparam W the ownership semantics of the window.
+   * \tparam R the ownership semantics of the renderer.
+   *
+   * \param window the window that will be presented.
+   * \param renderer the renderer associated with the window.
+   * \param draw the function object that renders the window, invoked as
+   * `void(renderer_handle&, const irect&)` with the damaged area.
+   *
+   * \return the ID of the window, which identifies the window in other functions.
+   *
+   * \since 6.4.0
+   */
+  template <typename W, typename R>
+  auto add(const basic_window<W>& window, const basic_renderer<R>& renderer, draw_type draw)
+      -> u32
+  {
+    assert(window.get());
+    assert(renderer.get());
+    assert(draw);
+
+    const auto id = window.id();
+    if (find(id) == m_entries.end()) {
+      renderer_handle handle{renderer.get()};
+      dirty_region damage{handle.output_size()};
+      damage.mark_all();
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+      if (m_syncWindow != 0) {
+        handle.set_vsync(vsync_mode::off);
+      }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+      m_entries.push_back(entry{window_handle{window.get()},
+                                std::move(handle),
+                                std::move(draw),
+                                damage});
+    }
+
+    return id;
+  }
+
+  /**
+   * \brief Removes a window from the presenter.
+   *
+   * \details If the window is the sync window, there will be no sync window afterwards.
+   *
+   * \param id the ID of the window.
+   *
+   * \return `success` if the window was removed; `failure` if it wasn't found.
+   *
+   * \since 6.4.0
+   */
+  auto remove(const u32 id) -> result
+  {
+    const auto iter = find(id);
+    if (iter == m_entries.end()) {
+      return failure;
+    }
+
+    m_entries.erase(iter);
+    if (m_syncWindow == id) {
+      m_syncWindow = 0;
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Marks an area of a window as changed, so that the window is redrawn.
+   *
+   * \details Nothing happens if the window isn't found.
+   *
+   * \param id the ID of the window.
+   * \param area the area that has changed, in renderer output coordinates.
+   *
+   * \since 6.4.0
+   */
+  void mark(const u32 id, const irect& area) noexcept
+  {
+    if (const auto iter = find(id); iter != m_entries.end()) {
+      iter->damage.mark(area);
+    }
+  }
+
+  /**
+   * \brief Marks an entire window as changed.
+   *
+   * \details Nothing happens if the window isn't found.
+   *
+   * \param id the ID of the window.
+   *
+   * \since 6.4.0
+   */
+  void mark_all(const u32 id) noexcept
+  {
+    if (const auto iter = find(id); iter != m_entries.end()) {
+      iter->damage.mark_all();
+    }
+  }
+
+  /**
+   * \brief Marks all windows as changed.
+   *
+   * \since 6.4.0
+   */
+  void mark_all() noexcept
+  {
+    for (auto& entry : m_entries) {
+      entry.damage.mark_all();
+    }
+  }
+
+  /**
+   * \brief Updates the damage of a window in response to a window event.
+   *
+   * \details Windows are entirely damaged when they are exposed, restored, shown or
+   * resized. Events for windows that haven't been added are ignored.
+   *
+   * \param event the window event.
+   *
+   * \since 6.4.0
+   */
+  void handle(const window_event& event) noexcept
+  {
+    const auto iter = find(event.get().windowID);
+    if (iter == m_entries.end()) {
+      return;
+    }
+
+    switch (event.event_id()) {
+      case window_event_id::size_changed:
+      case window_event_id::resized:
+        iter->damage = dirty_region{iter->renderer.output_size()};
+        [[fallthrough]];
+
+      case window_event_id::shown:
+      case window_event_id::exposed:
+      case window_event_id::restored:
+      case window_event_id::maximized:
+        iter->damage.mark_all();
+        break;
+
+      default:
+        break;
+    }
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Sets the window that is synchronized with display refreshes.
+   *
+   * \details VSync is enabled for the renderer of the sync window, and disabled for the
+   * renderers of all other windows. Supply zero to disable VSync for all windows.
+   *
+   * \param id the ID of the sync window; zero for no sync window.
+   * \param mode the VSync mode of the sync window, must not be `vsync_mode::off`.
+   *
+   * \return `success` if the VSync modes of all windows were changed; `failure` otherwise.
+   *
+   * \see `basic_renderer::set_vsync()`
+   *
+   * \since 6.4.0
+   */
+  auto set_sync_window(const u32 id, const vsync_mode mode = vsync_mode::on) noexcept
+      -> result
+  {
+    assert(mode != vsync_mode::off);
+
+    if (id != 0 && find(id) == m_entries.end()) {
+      return failure;
+    }
+
+    bool ok = true;
+    for (auto& entry : m_entries) {
+      const auto sync = entry.window.id() == id;
+      ok = entry.renderer.set_vsync(sync ? mode : vsync_mode::off) && ok;
+    }
+
+    m_syncWindow = id;
+    return ok;
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Renders and presents all damaged, visible windows.
+   *
+   * \details The draw function of each presented window is invoked with the damaged area,
+   * after which the damage of the window is cleared and its renderer is presented. The sync
+   * window is always presented last.
+   *
+   * \return the amount of presented windows.
+   *
+   * \since 6.4.0
+   */
+  auto present() -> usize
+  {
+    CENTURION_PROFILE_ZONE("multi_window_presenter::present");
+
+    usize presented = 0;
+    m_synchronized = false;
+
+    // Presenting the sync window last means that only the final present waits for VSync
+    for (auto& entry : m_entries) {
+      if (entry.window.id() != m_syncWindow && present_entry(entry)) {
+        ++presented;
+      }
+    }
+
+    if (const auto iter = find(m_syncWindow); iter != m_entries.end()) {
+      if (present_entry(*iter)) {
+        m_synchronized = true;
+        ++presented;
+      }
+    }
+
+    return presented;
+  }
+
+  /**
+   * \brief Indicates whether or not the sync window was presented by the latest call to
+   * `present()`.
+   *
+   * \return `true` if the latest frame was paced by the sync window; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto was_synchronized() const noexcept -> bool
+  {
+    return m_synchronized;
+  }
+
+  /**
+   * \brief Indicates whether or not a window has any damage.
+   *
+   * \param id the ID of the window.
+   *
+   * \return `true` if the window will be redrawn when it is visible; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_damaged(const u32 id) const noexcept -> bool
+  {
+    const auto iter = find(id);
+    return iter != m_entries.end() && iter->damage.is_dirty();
+  }
+
+  /**
+   * \brief Indicates whether or not a window has been added to the presenter.
+   *
+   * \param id the ID of the window.
+   *
+   * \return `true` if the window is presented by the presenter; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto contains(const u32 id) const noexcept -> bool
+  {
+    return find(id) != m_entries.end();
+  }
+
+  /**
+   * \brief Returns the ID of the sync window.
+   *
+   * \return the ID of the sync window; zero if there is no sync window.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto sync_window() const noexcept -> u32
+  {
+    return m_syncWindow;
+  }
+
+  /**
+   * \brief Returns the amount of windows in the presenter.
+   *
+   * \return the window count.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_entries.size();
+  }
+
+ private:
+  struct entry final
+  {
+    window_handle window;
+    renderer_handle renderer;
+    draw_type draw;
+    dirty_region damage;
+  };
+
+  std::vector<entry> m_entries;
+  u32 m_syncWindow{};
+  bool m_synchronized{};
+
+  [[nodiscard]] static auto present_entry(entry& entry) -> bool
+  {
+    if (!entry.damage.is_dirty() || entry.window.is_hidden() || entry.window.is_minimized()) {
+      return false;
+    }
+
+    entry.draw(entry.renderer, entry.damage.area());
+    entry.damage.clear();
+    entry.renderer.present();
+
+    return true;
+  }
+
+  [[nodiscard]] auto find(const u32 id) noexcept -> std::vector<entry>::iterator
+  {
+    return std::find_if(m_entries.begin(), m_entries.end(), [id](const entry& entry) {
+      return entry.window.id() == id;
+    });
+  }
+
+  [[nodiscard]] auto find(const u32 id) const noexcept -> std::vector<entry>::const_iterator
+  {
+    return std::find_if(m_entries.begin(), m_entries.end(), [id](const entry& entry) {
+      return entry.window.id() == id;
+    });
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_MULTI_WINDOW_PRESENTER_HEADER
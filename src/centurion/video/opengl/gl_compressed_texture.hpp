@@ -0,0 +1,1233 @@
+#ifndef CENTURION_GL_COMPRESSED_TEXTURE_HEADER
+#define CENTURION_GL_COMPRESSED_TEXTURE_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // max
+#include <array>        // array
+#include <cassert>      // assert
+#include <cstring>      // memcmp
+#include <optional>     // optional, nullopt
+#include <ostream>      // ostream
+#include <string>       // string
+#include <string_view>  // string_view
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "../../core/exception.hpp"
+#include "../../core/expected.hpp"
+#include "../../core/integers.hpp"
+#include "../../core/not_null.hpp"
+#include "../../core/result.hpp"
+#include "../../core/str.hpp"
+#include "../../core/to_underlying.hpp"
+#include "../../filesystem/file.hpp"
+#include "../../math/area.hpp"
+#include "gl_attribute.hpp"
+#include "gl_core.hpp"
+#include "gl_loader.hpp"
+
+namespace cen::gl {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum compressed_format
+ *
+ * \brief Represents block compressed texture formats.
+ *
+ * \details The values of the enumerators are the corresponding OpenGL internal formats,
+ * so they can be passed directly to `glCompressedTexImage2D()`.
+ *
+ * \see `compressed_image`
+ * \see `is_supported(compressed_format)`
+ *
+ * \since 6.4.0
+ */
+enum class compressed_format : u32
+{
+  bc1_rgb = 0x83F0,   ///< BC1 (DXT1) without alpha.
+  bc1_rgba = 0x83F1,  ///< BC1 (DXT1) with 1-bit alpha.
+  bc2 = 0x83F2,       ///< BC2 (DXT3).
+  bc3 = 0x83F3,       ///< BC3 (DXT5).
+
+  bc1_srgb = 0x8C4C,
+  bc1_srgb_alpha = 0x8C4D,
+  bc2_srgb = 0x8C4E,
+  bc3_srgb = 0x8C4F,
+
+  bc4 = 0x8DBB,  ///< BC4 (RGTC1), a single channel.
+  bc4_signed = 0x8DBC,
+  bc5 = 0x8DBD,  ///< BC5 (RGTC2), two channels.
+  bc5_signed = 0x8DBE,
+
+  bc6h_signed = 0x8E8E,    ///< BC6H with signed floating-point values.
+  bc6h_unsigned = 0x8E8F,  ///< BC6H with unsigned floating-point values.
+  bc7 = 0x8E8C,
+  bc7_srgb = 0x8E8D,
+
+  eac_r11 = 0x9270,
+  eac_r11_signed = 0x9271,
+  eac_rg11 = 0x9272,
+  eac_rg11_signed = 0x9273,
+  etc2_rgb8 = 0x9274,
+  etc2_srgb8 = 0x9275,
+  etc2_rgb8_alpha1 = 0x9276,
+  etc2_srgb8_alpha1 = 0x9277,
+  etc2_rgba8 = 0x9278,
+  etc2_srgb8_alpha8 = 0x9279,
+
+  astc_4x4 = 0x93B0,
+  astc_5x4 = 0x93B1,
+  astc_5x5 = 0x93B2,
+  astc_6x5 = 0x93B3,
+  astc_6x6 = 0x93B4,
+  astc_8x5 = 0x93B5,
+  astc_8x6 = 0x93B6,
+  astc_8x8 = 0x93B7,
+  astc_10x5 = 0x93B8,
+  astc_10x6 = 0x93B9,
+  astc_10x8 = 0x93BA,
+  astc_10x10 = 0x93BB,
+  astc_12x10 = 0x93BC,
+  astc_12x12 = 0x93BD,
+
+  astc_4x4_srgb = 0x93D0,
+  astc_5x4_srgb = 0x93D1,
+  astc_5x5_srgb = 0x93D2,
+  astc_6x5_srgb = 0x93D3,
+  astc_6x6_srgb = 0x93D4,
+  astc_8x5_srgb = 0x93D5,
+  astc_8x6_srgb = 0x93D6,
+  astc_8x8_srgb = 0x93D7,
+  astc_10x5_srgb = 0x93D8,
+  astc_10x6_srgb = 0x93D9,
+  astc_10x8_srgb = 0x93DA,
+  astc_10x10_srgb = 0x93DB,
+  astc_12x10_srgb = 0x93DC,
+  astc_12x12_srgb = 0x93DD
+};
+
+/// \cond FALSE
+namespace detail {
+
+// Block dimensions of the ASTC formats, in the order of the enumerators
+inline constexpr std::array<iarea, 14> astc_blocks{{{4, 4},
+                                                    {5, 4},
+                                                    {5, 5},
+                                                    {6, 5},
+                                                    {6, 6},
+                                                    {8, 5},
+                                                    {8, 6},
+                                                    {8, 8},
+                                                    {10, 5},
+                                                    {10, 6},
+                                                    {10, 8},
+                                                    {10, 10},
+                                                    {12, 10},
+                                                    {12, 12}}};
+
+[[nodiscard]] constexpr auto is_astc(const compressed_format format) noexcept -> bool
+{
+  const auto value = to_underlying(format);
+  return (value >= 0x93B0u && value <= 0x93BDu) || (value >= 0x93D0u && value <= 0x93DDu);
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Indicates whether or not a value is a known compressed format.
+ *
+ * \param value the OpenGL internal format that will be checked.
+ *
+ * \return `true` if the value is a `compressed_format` enumerator; `false` otherwise.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto is_compressed_format(const u32 value) noexcept -> bool
+{
+  return (value >= 0x83F0u && value <= 0x83F3u) || (value >= 0x8C4Cu && value <= 0x8C4Fu) ||
+         (value >= 0x8DBBu && value <= 0x8DBEu) || (value >= 0x8E8Cu && value <= 0x8E8Fu) ||
+         (value >= 0x9270u && value <= 0x9279u) ||
+         detail::is_astc(static_cast<compressed_format>(value));
+}
+
+/**
+ * \brief Returns the size of the pixel blocks of a compressed format.
+ *
+ * \param format the compressed format that will be queried.
+ *
+ * \return the width and height of a block, in pixels.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto block_size(const compressed_format format) noexcept -> iarea
+{
+  if (detail::is_astc(format)) {
+    return detail::astc_blocks[to_underlying(format) & 0xFu];
+  }
+  else {
+    return {4, 4};
+  }
+}
+
+/**
+ * \brief Returns the amount of bytes used by a single block of a compressed format.
+ *
+ * \param format the compressed format that will be queried.
+ *
+ * \return the size of a block, either 8 or 16 bytes.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto block_bytes(const compressed_format format) noexcept -> usize
+{
+  switch (format) {
+    case compressed_format::bc1_rgb:
+    case compressed_format::bc1_rgba:
+    case compressed_format::bc1_srgb:
+    case compressed_format::bc1_srgb_alpha:
+    case compressed_format::bc4:
+    case compressed_format::bc4_signed:
+    case compressed_format::eac_r11:
+    case compressed_format::eac_r11_signed:
+    case compressed_format::etc2_rgb8:
+    case compressed_format::etc2_srgb8:
+    case compressed_format::etc2_rgb8_alpha1:
+    case compressed_format::etc2_srgb8_alpha1:
+      return 8;
+
+    default:
+      return 16;
+  }
+}
+
+/**
+ * \brief Returns the amount of bytes used by an image in a compressed format.
+ *
+ * \details Partial blocks at the right and bottom edges are rounded up to complete
+ * blocks.
+ *
+ * \param format the compressed format of the image.
+ * \param size the size of the image, in pixels.
+ *
+ * \return the size of the compressed image data; zero if the size is not positive.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto image_bytes(const compressed_format format,
+                                         const iarea size) noexcept -> usize
+{
+  if (size.width <= 0 || size.height <= 0) {
+    return 0;
+  }
+
+  const auto block = block_size(format);
+  const auto columns = static_cast<usize>((size.width + block.width - 1) / block.width);
+  const auto rows = static_cast<usize>((size.height + block.height - 1) / block.height);
+
+  return columns * rows * block_bytes(format);
+}
+
+/**
+ * \brief Returns the OpenGL extensions that provide support for a compressed format.
+ *
+ * \details A format is supported if either of the extensions is supported. The second
+ * extension is null for formats that are provided by a single extension.
+ *
+ * \param format the compressed format that will be queried.
+ *
+ * \return the names of the desktop and OpenGL ES extensions of the format.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto extensions_of(const compressed_format format) noexcept
+    -> std::array<str, 2>
+{
+  switch (format) {
+    case compressed_format::bc1_rgb:
+    case compressed_format::bc1_rgba:
+    case compressed_format::bc2:
+    case compressed_format::bc3:
+      return {"GL_EXT_texture_compression_s3tc", nullptr};
+
+    case compressed_format::bc1_srgb:
+    case compressed_format::bc1_srgb_alpha:
+    case compressed_format::bc2_srgb:
+    case compressed_format::bc3_srgb:
+      return {"GL_EXT_texture_sRGB", "GL_EXT_texture_compression_s3tc_srgb"};
+
+    case compressed_format::bc4:
+    case compressed_format::bc4_signed:
+    case compressed_format::bc5:
+    case compressed_format::bc5_signed:
+      return {"GL_ARB_texture_compression_rgtc", "GL_EXT_texture_compression_rgtc"};
+
+    case compressed_format::bc6h_signed:
+    case compressed_format::bc6h_unsigned:
+    case compressed_format::bc7:
+    case compressed_format::bc7_srgb:
+      return {"GL_ARB_texture_compression_bptc", "GL_EXT_texture_compression_bptc"};
+
+    case compressed_format::eac_r11:
+    case compressed_format::eac_r11_signed:
+    case compressed_format::eac_rg11:
+    case compressed_format::eac_rg11_signed:
+    case compressed_format::etc2_rgb8:
+    case compressed_format::etc2_srgb8:
+    case compressed_format::etc2_rgb8_alpha1:
+    case compressed_format::etc2_srgb8_alpha1:
+    case compressed_format::etc2_rgba8:
+    case compressed_format::etc2_srgb8_alpha8:
+      return {"GL_ARB_ES3_compatibility", nullptr};
+
+    default:
+      return {"GL_KHR_texture_compression_astc_ldr", nullptr};
+  }
+}
+
+/**
+ * \brief Indicates whether or not the current context can sample a compressed format.
+ *
+ * \details The support is determined with `is_extension_supported()`. The ETC2 and EAC
+ * formats are also considered to be supported by OpenGL ES 3.0 contexts, where they are
+ * core features.
+ *
+ * \pre An OpenGL context must be current on the calling thread.
+ *
+ * \param format the compressed format that will be checked.
+ *
+ * \return `true` if textures of the format can be uploaded; `false` otherwise.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto is_supported(const compressed_format format) noexcept -> bool
+{
+  const auto [primary, secondary] = extensions_of(format);
+
+  if (is_extension_supported(primary) || (secondary && is_extension_supported(secondary))) {
+    return true;
+  }
+
+  if (to_underlying(format) >= 0x9270u && to_underlying(format) <= 0x9279u) {
+    const auto profile = get(gl_attribute::context_profile_mask).value_or(0);
+    const auto major = get(gl_attribute::context_major_version).value_or(0);
+    return profile == SDL_GL_CONTEXT_PROFILE_ES && major >= 3;
+  }
+
+  return false;
+}
+
+/**
+ * \enum compressed_container
+ *
+ * \brief Represents the file formats that compressed images can be loaded from.
+ *
+ * \since 6.4.0
+ */
+enum class compressed_container
+{
+  ktx,   ///< Khronos texture, version 1.
+  ktx2,  ///< Khronos texture, version 2, without supercompression.
+  dds    ///< DirectDraw surface, including the DX10 header extension.
+};
+
+/// \name Compressed container functions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied compressed container.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(compressed_container::dds) == "dds"`.
+ *
+ * \param container the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const compressed_container container)
+    -> std::string_view
+{
+  switch (container) {
+    case compressed_container::ktx:
+      return "ktx";
+
+    case compressed_container::ktx2:
+      return "ktx2";
+
+    case compressed_container::dds:
+      return "dds";
+
+    default:
+      throw cen_error{"Did not recognize compressed container!"};
+  }
+}
+
+/**
+ * \brief Prints a textual representation of a compressed container enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param container the enumerator that will be printed.
+ *
+ * \see `to_string(compressed_container)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const compressed_container container)
+    -> std::ostream&
+{
+  return stream << to_string(container);
+}
+
+/// \} End of compressed container functions
+
+/**
+ * \struct compressed_level
+ *
+ * \brief Describes a single mipmap level of a compressed image.
+ *
+ * \since 6.4.0
+ */
+struct compressed_level final
+{
+  iarea size{};             ///< The size of the level, in pixels.
+  const std::byte* data{};  ///< The compressed data of the level.
+  usize bytes{};            ///< The size of the compressed data.
+};
+
+/**
+ * \class compressed_image
+ *
+ * \brief Holds block compressed image data, with all of its mipmap levels.
+ *
+ * \details Compressed images are loaded from KTX, KTX2 and DDS files, which store data
+ * that was compressed offline, e.g. as BC7 for desktop GPUs or ASTC for mobile GPUs. The
+ * data is kept in its compressed form, so it can be uploaded directly with
+ * `glCompressedTexImage2D()`, which uses a fraction of the memory and bandwidth of
+ * uncompressed pixel data.
+ * \code{cpp}
+ *   auto image = cen::gl::compressed_image::try_load("rocks.ktx2");
+ *   if (image && cen::gl::is_supported(image->format())) {
+ *     const cen::gl::compressed_uploader uploader;
+ *     const auto texture = uploader.create_texture(*image);
+ *   }
+ * \endcode
+ *
+ * \details Only two-dimensional textures are supported, i.e. arrays, cube maps and
+ * volume textures are rejected. The image data is not decoded, so there is no fallback
+ * for formats that the current context doesn't support; pick a format with
+ * `is_supported()` and ship the assets in several formats instead.
+ *
+ * \note The rows of the images are stored top to bottom, as by the common encoders, which
+ * is the opposite of the OpenGL convention. Flip the texture coordinates accordingly.
+ *
+ * \see `compressed_uploader`
+ *
+ * \since 6.4.0
+ */
+class compressed_image final
+{
+ public:
+  /**
+   * \brief Attempts to parse a compressed image in a KTX, KTX2 or DDS container.
+   *
+   * \details The container is detected from the leading identifier of the data.
+   *
+   * \param data the contents of the file, which are kept by the image.
+   *
+   * \return the parsed image; an `error_code::bad_argument` error if the data isn't a
+   * valid two-dimensional compressed image.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto try_parse(std::vector<std::byte> data)
+      -> expected<compressed_image>
+  {
+    compressed_image image;
+    image.m_data = std::move(data);
+
+    if (const auto* error = image.parse()) {
+      return error_info{error_code::bad_argument, error};
+    }
+
+    return image;
+  }
+
+  /**
+   * \brief Attempts to parse a compressed image in a KTX, KTX2 or DDS container.
+   *
+   * \param data the contents of the file, which are copied; cannot be null.
+   * \param size the size of the data, in bytes.
+   *
+   * \return the parsed image; an `error_code::bad_argument` error if the data isn't a
+   * valid two-dimensional compressed image.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto try_parse(const not_null<const void*> data, const usize size)
+      -> expected<compressed_image>
+  {
+    assert(data);
+
+    const auto* bytes = static_cast<const std::byte*>(data);
+    return try_parse(std::vector<std::byte>(bytes, bytes + size));
+  }
+
+  /**
+   * \brief Attempts to load a compressed image from a KTX, KTX2 or DDS file.
+   *
+   * \param path the file path of the image, cannot be null.
+   *
+   * \return the loaded image; an `error_code::sdl` error if the file couldn't be opened, or
+   * an `error_code::bad_argument` error if the file isn't a valid compressed image.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto try_load(const not_null<str> path) -> expected<compressed_image>
+  {
+    assert(path);
+
+    file source{path, file_mode::read_existing_binary};
+    if (!source) {
+      return error_info{error_code::sdl};
+    }
+
+    return try_parse(source.read_all());
+  }
+
+  /// \copydoc try_load()
+  [[nodiscard]] static auto try_load(const std::string& path) -> expected<compressed_image>
+  {
+    return try_load(path.c_str());
+  }
+
+  /**
+   * \brief Returns the compressed format of the image.
+   *
+   * \return the format of all levels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto format() const noexcept -> compressed_format
+  {
+    return m_format;
+  }
+
+  /**
+   * \brief Returns the container that the image was parsed from.
+   *
+   * \return the file format of the image.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto container() const noexcept -> compressed_container
+  {
+    return m_container;
+  }
+
+  /**
+   * \brief Returns the size of the largest level of the image.
+   *
+   * \return the size of the image, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_levels.front().size;
+  }
+
+  /**
+   * \brief Returns the amount of mipmap levels of the image.
+   *
+   * \return the amount of levels, which is always at least one.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto level_count() const noexcept -> usize
+  {
+    return m_levels.size();
+  }
+
+  /**
+   * \brief Returns a mipmap level of the image.
+   *
+   * \param index the index of the level, where zero is the largest level.
+   *
+   * \return the level at the index, whose data is valid as long as the image isn't
+   * modified or destroyed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto level(const usize index) const noexcept -> compressed_level
+  {
+    assert(index < m_levels.size());
+
+    const auto& [size, offset, bytes] = m_levels[index];
+    return {size, m_data.data() + offset, bytes};
+  }
+
+  /**
+   * \brief Returns the amount of compressed data in all levels.
+   *
+   * \return the size of the texture in video memory, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto total_bytes() const noexcept -> usize
+  {
+    usize total = 0;
+    for (const auto& level : m_levels) {
+      total += level.bytes;
+    }
+
+    return total;
+  }
+
+ private:
+  inline constexpr static std::array<u8, 12> ktx_identifier{
+      0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+  inline constexpr static std::array<u8, 12> ktx2_identifier{
+      0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+  inline constexpr static usize ktx_header_size = 64;
+  inline constexpr static usize ktx2_header_size = 80;
+  inline constexpr static usize dds_header_size = 128;
+  inline constexpr static usize dds_dx10_header_size = 20;
+  inline constexpr static usize max_levels = 32;
+
+  // Levels store offsets rather than pointers, so that images can be copied
+  struct level_info final
+  {
+    iarea size{};
+    usize offset{};
+    usize bytes{};
+  };
+
+  std::vector<std::byte> m_data;
+  std::vector<level_info> m_levels;
+  compressed_format m_format{};
+  compressed_container m_container{};
+
+  compressed_image() = default;
+
+  [[nodiscard]] constexpr static auto four_cc(const char (&code)[5]) noexcept -> u32
+  {
+    return static_cast<u32>(static_cast<u8>(code[0])) |
+           static_cast<u32>(static_cast<u8>(code[1])) << 8u |
+           static_cast<u32>(static_cast<u8>(code[2])) << 16u |
+           static_cast<u32>(static_cast<u8>(code[3])) << 24u;
+  }
+
+  [[nodiscard]] auto has(const usize offset, const usize count) const noexcept -> bool
+  {
+    return offset <= m_data.size() && count <= m_data.size() - offset;
+  }
+
+  // Reads a little-endian 32-bit value, the caller checks the bounds
+  [[nodiscard]] auto read_u32(const usize offset) const noexcept -> u32
+  {
+    u32 value = 0;
+    for (usize index = 0; index < 4; ++index) {
+      value |= static_cast<u32>(m_data[offset + index]) << (8u * index);
+    }
+
+    return value;
+  }
+
+  [[nodiscard]] auto read_u64(const usize offset) const noexcept -> u64
+  {
+    return static_cast<u64>(read_u32(offset)) | static_cast<u64>(read_u32(offset + 4)) << 32u;
+  }
+
+  [[nodiscard]] auto starts_with(const std::array<u8, 12>& identifier) const noexcept
+      -> bool
+  {
+    return has(0, identifier.size()) &&
+           std::memcmp(m_data.data(), identifier.data(), identifier.size()) == 0;
+  }
+
+  // Returns an error message, or null if the data was parsed successfully
+  [[nodiscard]] auto parse() -> str
+  {
+    if (starts_with(ktx_identifier)) {
+      m_container = compressed_container::ktx;
+      return parse_ktx();
+    }
+    else if (starts_with(ktx2_identifier)) {
+      m_container = compressed_container::ktx2;
+      return parse_ktx2();
+    }
+    else if (has(0, 4) && read_u32(0) == four_cc("DDS ")) {
+      m_container = compressed_container::dds;
+      return parse_dds();
+    }
+    else {
+      return "Unknown compressed image container!";
+    }
+  }
+
+  [[nodiscard]] auto add_level(const iarea size, const usize offset, const usize bytes)
+      -> str
+  {
+    if (bytes != image_bytes(m_format, size)) {
+      return "Invalid size of compressed image level!";
+    }
+
+    if (!has(offset, bytes)) {
+      return "Compressed image data is truncated!";
+    }
+
+    m_levels.push_back({size, offset, bytes});
+    return nullptr;
+  }
+
+  [[nodiscard]] static auto level_size(const iarea size, const usize level) noexcept
+      -> iarea
+  {
+    return {std::max(size.width >> level, 1), std::max(size.height >> level, 1)};
+  }
+
+  [[nodiscard]] static auto is_valid_size(const u32 width, const u32 height) noexcept
+      -> bool
+  {
+    constexpr u32 max_size = 65'536;
+    return width != 0 && height != 0 && width <= max_size && height <= max_size;
+  }
+
+  [[nodiscard]] auto parse_ktx() -> str
+  {
+    if (!has(0, ktx_header_size)) {
+      return "KTX header is truncated!";
+    }
+
+    // Files with the opposite byte order are swapped, the block data is byte-oriented
+    const auto endianness = read_u32(12);
+    if (endianness != 0x04030201u && endianness != 0x01020304u) {
+      return "Invalid KTX endianness!";
+    }
+
+    const auto swapped = endianness == 0x01020304u;
+    const auto field = [this, swapped](const usize index) noexcept {
+      const auto value = read_u32(12 + (4 * index));
+      return swapped ? SDL_Swap32(value) : value;
+    };
+
+    const auto internalFormat = field(4);
+    const auto width = field(6);
+    const auto height = field(7);
+    const auto depth = field(8);
+    const auto arrayElements = field(9);
+    const auto faces = field(10);
+    const auto levels = std::max(field(11), 1u);
+    const auto keyValueBytes = field(12);
+
+    if (!is_compressed_format(internalFormat)) {
+      return "Unsupported KTX texture format!";
+    }
+
+    if (!is_valid_size(width, height) || depth > 1 || arrayElements > 1 || faces != 1 ||
+        levels > max_levels) {
+      return "Only two-dimensional KTX textures are supported!";
+    }
+
+    m_format = static_cast<compressed_format>(internalFormat);
+
+    const iarea size{static_cast<int>(width), static_cast<int>(height)};
+    auto offset = ktx_header_size + static_cast<usize>(keyValueBytes);
+
+    for (usize level = 0; level < levels; ++level) {
+      if (!has(offset, 4)) {
+        return "Compressed image data is truncated!";
+      }
+
+      auto bytes = static_cast<usize>(read_u32(offset));
+      bytes = swapped ? SDL_Swap32(static_cast<u32>(bytes)) : bytes;
+      offset += 4;
+
+      if (const auto* error = add_level(level_size(size, level), offset, bytes)) {
+        return error;
+      }
+
+      offset += (bytes + 3u) & ~usize{3};
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] static auto from_vulkan(const u32 format) noexcept
+      -> std::optional<compressed_format>
+  {
+    using cf = compressed_format;
+
+    // VK_FORMAT_BC1_RGB_UNORM_BLOCK to VK_FORMAT_EAC_R11G11_SNORM_BLOCK
+    constexpr std::array<cf, 26> formats{cf::bc1_rgb,
+                                         cf::bc1_srgb,
+                                         cf::bc1_rgba,
+                                         cf::bc1_srgb_alpha,
+                                         cf::bc2,
+                                         cf::bc2_srgb,
+                                         cf::bc3,
+                                         cf::bc3_srgb,
+                                         cf::bc4,
+                                         cf::bc4_signed,
+                                         cf::bc5,
+                                         cf::bc5_signed,
+                                         cf::bc6h_unsigned,
+                                         cf::bc6h_signed,
+                                         cf::bc7,
+                                         cf::bc7_srgb,
+                                         cf::etc2_rgb8,
+                                         cf::etc2_srgb8,
+                                         cf::etc2_rgb8_alpha1,
+                                         cf::etc2_srgb8_alpha1,
+                                         cf::etc2_rgba8,
+                                         cf::etc2_srgb8_alpha8,
+                                         cf::eac_r11,
+                                         cf::eac_r11_signed,
+                                         cf::eac_rg11,
+                                         cf::eac_rg11_signed};
+
+    if (format >= 131 && format <= 156) {
+      return formats[format - 131];
+    }
+
+    // VK_FORMAT_ASTC_4x4_UNORM_BLOCK to VK_FORMAT_ASTC_12x12_SRGB_BLOCK, which alternate
+    // between linear and sRGB variants
+    if (format >= 157 && format <= 184) {
+      const auto index = (format - 157) / 2;
+      const auto base = (format % 2 == 1) ? 0x93B0u : 0x93D0u;
+      return static_cast<cf>(base + index);
+    }
+
+    return std::nullopt;
+  }
+
+  [[nodiscard]] auto parse_ktx2() -> str
+  {
+    if (!has(0, ktx2_header_size)) {
+      return "KTX2 header is truncated!";
+    }
+
+    const auto format = from_vulkan(read_u32(12));
+    const auto width = read_u32(20);
+    const auto height = read_u32(24);
+    const auto depth = read_u32(28);
+    const auto layers = read_u32(32);
+    const auto faces = read_u32(36);
+    const auto levels = std::max(read_u32(40), 1u);
+    const auto supercompression = read_u32(44);
+
+    if (!format) {
+      return "Unsupported KTX2 texture format!";
+    }
+
+    if (supercompression != 0) {
+      return "Supercompressed KTX2 textures are not supported!";
+    }
+
+    if (!is_valid_size(width, height) || depth > 1 || layers > 1 || faces != 1 ||
+        levels > max_levels) {
+      return "Only two-dimensional KTX2 textures are supported!";
+    }
+
+    if (!has(ktx2_header_size, levels * 24u)) {
+      return "KTX2 level index is truncated!";
+    }
+
+    m_format = *format;
+
+    const iarea size{static_cast<int>(width), static_cast<int>(height)};
+    for (usize level = 0; level < levels; ++level) {
+      const auto entry = ktx2_header_size + (level * 24u);
+      const auto offset = read_u64(entry);
+      const auto bytes = read_u64(entry + 8);
+
+      if (offset > m_data.size() || bytes > m_data.size()) {
+        return "Compressed image data is truncated!";
+      }
+
+      const auto error = add_level(level_size(size, level),
+                                   static_cast<usize>(offset),
+                                   static_cast<usize>(bytes));
+      if (error) {
+        return error;
+      }
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] static auto from_four_cc(const u32 code) noexcept
+      -> std::optional<compressed_format>
+  {
+    // BC1 is loaded with alpha, since DXT1 files don't indicate whether alpha is used
+    if (code == four_cc("DXT1")) {
+      return compressed_format::bc1_rgba;
+    }
+    else if (code == four_cc("DXT2") || code == four_cc("DXT3")) {
+      return compressed_format::bc2;
+    }
+    else if (code == four_cc("DXT4") || code == four_cc("DXT5")) {
+      return compressed_format::bc3;
+    }
+    else if (code == four_cc("ATI1") || code == four_cc("BC4U")) {
+      return compressed_format::bc4;
+    }
+    else if (code == four_cc("BC4S")) {
+      return compressed_format::bc4_signed;
+    }
+    else if (code == four_cc("ATI2") || code == four_cc("BC5U")) {
+      return compressed_format::bc5;
+    }
+    else if (code == four_cc("BC5S")) {
+      return compressed_format::bc5_signed;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  [[nodiscard]] static auto from_dxgi(const u32 format) noexcept
+      -> std::optional<compressed_format>
+  {
+    switch (format) {
+      case 71:
+        return compressed_format::bc1_rgba;
+
+      case 72:
+        return compressed_format::bc1_srgb_alpha;
+
+      case 74:
+        return compressed_format::bc2;
+
+      case 75:
+        return compressed_format::bc2_srgb;
+
+      case 77:
+        return compressed_format::bc3;
+
+      case 78:
+        return compressed_format::bc3_srgb;
+
+      case 80:
+        return compressed_format::bc4;
+
+      case 81:
+        return compressed_format::bc4_signed;
+
+      case 83:
+        return compressed_format::bc5;
+
+      case 84:
+        return compressed_format::bc5_signed;
+
+      case 95:
+        return compressed_format::bc6h_unsigned;
+
+      case 96:
+        return compressed_format::bc6h_signed;
+
+      case 98:
+        return compressed_format::bc7;
+
+      case 99:
+        return compressed_format::bc7_srgb;
+
+      default:
+        return std::nullopt;
+    }
+  }
+
+  [[nodiscard]] auto parse_dds() -> str
+  {
+    if (!has(0, dds_header_size) || read_u32(4) != 124) {
+      return "DDS header is truncated!";
+    }
+
+    constexpr u32 flag_mipmap_count = 0x20000;
+    constexpr u32 flag_depth = 0x800000;
+    constexpr u32 pixel_flag_four_cc = 0x4;
+    constexpr u32 caps_cubemap = 0x200;
+    constexpr u32 caps_volume = 0x200000;
+
+    const auto flags = read_u32(8);
+    const auto height = read_u32(12);
+    const auto width = read_u32(16);
+    const auto levels = (flags & flag_mipmap_count) ? std::max(read_u32(28), 1u) : 1u;
+    const auto pixelFlags = read_u32(80);
+    const auto code = read_u32(84);
+    const auto caps = read_u32(112);
+
+    if (!(pixelFlags & pixel_flag_four_cc)) {
+      return "Uncompressed DDS textures are not supported!";
+    }
+
+    if (!is_valid_size(width, height) || (flags & flag_depth) ||
+        (caps & (caps_cubemap | caps_volume)) || levels > max_levels) {
+      return "Only two-dimensional DDS textures are supported!";
+    }
+
+    auto offset = dds_header_size;
+    std::optional<compressed_format> format;
+
+    if (code == four_cc("DX10")) {
+      if (!has(offset, dds_dx10_header_size)) {
+        return "DDS header is truncated!";
+      }
+
+      constexpr u32 dimension_texture2d = 3;
+
+      const auto dimension = read_u32(offset + 4);
+      const auto miscFlags = read_u32(offset + 8);
+      const auto arraySize = read_u32(offset + 12);
+
+      if (dimension != dimension_texture2d || (miscFlags & 0x4u) || arraySize > 1) {
+        return "Only two-dimensional DDS textures are supported!";
+      }
+
+      format = from_dxgi(read_u32(offset));
+      offset += dds_dx10_header_size;
+    }
+    else {
+      format = from_four_cc(code);
+    }
+
+    if (!format) {
+      return "Unsupported DDS texture format!";
+    }
+
+    m_format = *format;
+
+    // The levels are stored back to back, without any padding
+    const iarea size{static_cast<int>(width), static_cast<int>(height)};
+    for (usize level = 0; level < levels; ++level) {
+      const auto levelSize = level_size(size, level);
+      const auto bytes = image_bytes(m_format, levelSize);
+
+      if (const auto* error = add_level(levelSize, offset, bytes)) {
+        return error;
+      }
+
+      offset += bytes;
+    }
+
+    return nullptr;
+  }
+};
+
+/// \cond FALSE
+namespace detail {
+
+// The OpenGL declarations needed for compressed uploads, to avoid depending on GL headers
+#if defined(_WIN32) && !defined(_WIN64)
+#define CENTURION_GL_APIENTRY __stdcall
+#else
+#define CENTURION_GL_APIENTRY
+#endif
+
+struct gl_gen_textures final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(int count, unsigned* textures);
+  inline constexpr static str name = "glGenTextures";
+};
+
+struct gl_delete_textures final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(int count, const unsigned* textures);
+  inline constexpr static str name = "glDeleteTextures";
+};
+
+struct gl_bind_texture final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(unsigned target, unsigned texture);
+  inline constexpr static str name = "glBindTexture";
+};
+
+struct gl_tex_parameteri final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(unsigned target, unsigned name, int value);
+  inline constexpr static str name = "glTexParameteri";
+};
+
+struct gl_compressed_tex_image_2d final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(unsigned target,
+                                            int level,
+                                            unsigned internalFormat,
+                                            int width,
+                                            int height,
+                                            int border,
+                                            int bytes,
+                                            const void* data);
+  inline constexpr static str name = "glCompressedTexImage2D";
+};
+
+struct gl_get_error final
+{
+  using type = unsigned(CENTURION_GL_APIENTRY*)();
+  inline constexpr static str name = "glGetError";
+};
+
+#undef CENTURION_GL_APIENTRY
+
+inline constexpr unsigned gl_texture_2d = 0x0DE1;
+inline constexpr unsigned gl_texture_base_level = 0x813C;
+inline constexpr unsigned gl_texture_max_level = 0x813D;
+inline constexpr unsigned gl_no_error = 0;
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class compressed_uploader
+ *
+ * \brief Uploads compressed images to OpenGL textures, without decompressing them.
+ *
+ * \details All mipmap levels of an image are uploaded with `glCompressedTexImage2D()`, and
+ * the maximum level of the texture is set to the last level of the image, so the texture
+ * is complete even if the image doesn't contain a full mipmap chain.
+ * \code{cpp}
+ *   const cen::gl::compressed_uploader uploader;
+ *
+ *   if (const auto texture = uploader.create_texture(image)) {
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note The function pointers are resolved for the context that is current when the
+ * uploader is created, and may be used by an `upload_worker` with a shared context.
+ *
+ * \see `compressed_image`
+ * \see `upload_worker`
+ *
+ * \since 6.4.0
+ */
+class compressed_uploader final
+{
+ public:
+  /**
+   * \brief Resolves the OpenGL functions used for uploads.
+   *
+   * \pre An OpenGL context should be current on the calling thread.
+   *
+   * \since 6.4.0
+   */
+  compressed_uploader() noexcept = default;
+
+  /**
+   * \brief Uploads an image to the texture that is bound to `GL_TEXTURE_2D`.
+   *
+   * \details Any previous OpenGL errors are cleared before the upload.
+   *
+   * \param image the image that will be uploaded.
+   *
+   * \return `success` if all levels were uploaded; `failure` if the format of the image
+   * isn't supported by the current context, or if OpenGL reported an error.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto upload(const compressed_image& image) const noexcept -> result
+  {
+    if (!m_functions.is_complete() || !is_supported(image.format())) {
+      return failure;
+    }
+
+    const auto getError = m_functions.get<detail::gl_get_error>();
+    while (getError() != detail::gl_no_error) {
+    }
+
+    const auto upload = m_functions.get<detail::gl_compressed_tex_image_2d>();
+    const auto internalFormat = to_underlying(image.format());
+
+    for (usize index = 0; index < image.level_count(); ++index) {
+      const auto level = image.level(index);
+      upload(detail::gl_texture_2d,
+             static_cast<int>(index),
+             internalFormat,
+             level.size.width,
+             level.size.height,
+             0,
+             static_cast<int>(level.bytes),
+             level.data);
+    }
+
+    const auto setParameter = m_functions.get<detail::gl_tex_parameteri>();
+    setParameter(detail::gl_texture_2d, detail::gl_texture_base_level, 0);
+    setParameter(detail::gl_texture_2d,
+                 detail::gl_texture_max_level,
+                 static_cast<int>(image.level_count() - 1));
+
+    return getError() == detail::gl_no_error;
+  }
+
+  /**
+   * \brief Creates a texture and uploads an image to it.
+   *
+   * \details The new texture is left bound to `GL_TEXTURE_2D`.
+   *
+   * \param image the image that will be uploaded.
+   *
+   * \return the name of the created texture, which must be deleted with
+   * `glDeleteTextures()`; `std::nullopt` if the upload failed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto create_texture(const compressed_image& image) const noexcept
+      -> std::optional<unsigned>
+  {
+    if (!m_functions.is_complete() || !is_supported(image.format())) {
+      return std::nullopt;
+    }
+
+    unsigned texture = 0;
+    m_functions.get<detail::gl_gen_textures>()(1, &texture);
+    m_functions.get<detail::gl_bind_texture>()(detail::gl_texture_2d, texture);
+
+    if (upload(image)) {
+      return texture;
+    }
+
+    m_functions.get<detail::gl_bind_texture>()(detail::gl_texture_2d, 0);
+    m_functions.get<detail::gl_delete_textures>()(1, &texture);
+    return std::nullopt;
+  }
+
+  /**
+   * \brief Indicates whether or not all required OpenGL functions were resolved.
+   *
+   * \return `true` if the uploader can be used; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_complete() const noexcept -> bool
+  {
+    return m_functions.is_complete();
+  }
+
+ private:
+  function_table<detail::gl_gen_textures,
+                 detail::gl_delete_textures,
+                 detail::gl_bind_texture,
+                 detail::gl_tex_parameteri,
+                 detail::gl_compressed_tex_image_2d,
+                 detail::gl_get_error>
+      m_functions;
+};
+
+/// \} End of group video
+
+}  // namespace cen::gl
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_COMPRESSED_TEXTURE_HEADER
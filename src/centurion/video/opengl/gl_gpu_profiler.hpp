@@ -0,0 +1,509 @@
+#ifndef CENTURION_GL_GPU_PROFILER_HEADER
+#define CENTURION_GL_GPU_PROFILER_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>      // min, max, sort
+#include <cassert>        // assert
+#include <optional>       // optional, nullopt
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../../core/integers.hpp"
+#include "../../core/str.hpp"
+#include "../../core/time.hpp"
+#include "../../system/profiler.hpp"
+#include "gl_loader.hpp"
+
+namespace cen::gl {
+
+/// \addtogroup video
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+// The OpenGL declarations needed for timer queries, to avoid depending on GL headers
+#if defined(_WIN32) && !defined(_WIN64)
+#define CENTURION_GL_APIENTRY __stdcall
+#else
+#define CENTURION_GL_APIENTRY
+#endif
+
+struct gl_gen_queries final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(int count, unsigned* queries);
+  inline constexpr static str name = "glGenQueries";
+};
+
+struct gl_delete_queries final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(int count, const unsigned* queries);
+  inline constexpr static str name = "glDeleteQueries";
+};
+
+struct gl_query_counter final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(unsigned query, unsigned target);
+  inline constexpr static str name = "glQueryCounter";
+};
+
+struct gl_get_query_objectiv final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(unsigned query, unsigned name, int* value);
+  inline constexpr static str name = "glGetQueryObjectiv";
+};
+
+struct gl_get_query_objectui64v final
+{
+  using type = void(CENTURION_GL_APIENTRY*)(unsigned query, unsigned name, u64* value);
+  inline constexpr static str name = "glGetQueryObjectui64v";
+};
+
+#undef CENTURION_GL_APIENTRY
+
+inline constexpr unsigned gl_timestamp = 0x8E28;
+inline constexpr unsigned gl_query_result = 0x8866;
+inline constexpr unsigned gl_query_result_available = 0x8867;
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class gpu_profiler
+ *
+ * \brief Measures the GPU time of render passes with OpenGL timer queries.
+ *
+ * \details CPU zones only measure the time it takes to submit commands, which doesn't
+ * reveal whether a pass is GPU bound. A GPU profiler records a timestamp query at the
+ * start and at the end of each pass, and reads the results a few frames later, once the
+ * GPU has caught up, so it never stalls the pipeline. Frames whose results still aren't
+ * available when their queries are about to be reused are dropped instead of waited for.
+ * \code{cpp}
+ *   cen::gl::gpu_profiler gpu;
+ *
+ *   while (running) {
+ *     {
+ *       cen::gl::gpu_zone zone{gpu, "shadows"};
+ *       render_shadows();
+ *     }
+ *
+ *     {
+ *       cen::gl::gpu_zone zone{gpu, "lighting"};
+ *       render_lighting();
+ *     }
+ *
+ *     window.swap();
+ *     gpu.end_frame();
+ *     cen::profiler::end_frame();
+ *   }
+ * \endcode
+ *
+ * \details The statistics are reported as `profile_zone_stats`, aggregated per frame in
+ * the same way as the zones of the CPU `profiler`, so both can be shown side by side.
+ * Passes may be nested.
+ *
+ * \details The profiler requires timestamp queries, i.e. OpenGL 3.3 or
+ * `ARB_timer_query`. All functions are no-ops if they aren't available, see
+ * `is_complete()`.
+ *
+ * \note The profiler must be used on the thread of the context that was current when it
+ * was created, and be destroyed while that context is current.
+ *
+ * \note The name of a pass must be a string literal, or otherwise outlive the profiler.
+ *
+ * \see `profiler`
+ * \see `gpu_zone`
+ *
+ * \since 6.4.0
+ */
+class gpu_profiler final
+{
+ public:
+  /**
+   * \brief Creates a GPU profiler.
+   *
+   * \pre An OpenGL context should be current on the calling thread.
+   *
+   * \param latency the amount of frames that results are given to become available,
+   * must be greater than zero. Three frames is enough for most drivers.
+   *
+   * \since 6.4.0
+   */
+  explicit gpu_profiler(const usize latency = 3) : m_frames(latency + 1)
+  {
+    assert(latency > 0);
+  }
+
+  gpu_profiler(const gpu_profiler&) = delete;
+
+  auto operator=(const gpu_profiler&) -> gpu_profiler& = delete;
+
+  /**
+   * \brief Deletes the timer queries.
+   *
+   * \since 6.4.0
+   */
+  ~gpu_profiler() noexcept
+  {
+    if (!is_complete()) {
+      return;
+    }
+
+    const auto deleteQueries = m_functions.get<detail::gl_delete_queries>();
+    for (const auto& frame : m_frames) {
+      if (!frame.queries.empty()) {
+        deleteQueries(static_cast<int>(frame.queries.size()), frame.queries.data());
+      }
+    }
+  }
+
+  /**
+   * \brief Starts measuring a pass.
+   *
+   * \details Every call must be matched by a call to `end_pass()` in the same frame.
+   *
+   * \param name the name of the pass, which must refer to a string with static storage
+   * duration.
+   *
+   * \since 6.4.0
+   */
+  void begin_pass(const char* name)
+  {
+    if (!is_complete()) {
+      return;
+    }
+
+    auto& frame = m_frames[m_current];
+    m_open.push_back(frame.passes.size());
+    frame.passes.push_back(pass_record{name, timestamp(frame), 0});
+  }
+
+  /**
+   * \brief Stops measuring the innermost pass.
+   *
+   * \since 6.4.0
+   */
+  void end_pass()
+  {
+    if (!is_complete() || m_open.empty()) {
+      return;
+    }
+
+    auto& frame = m_frames[m_current];
+    frame.passes[m_open.back()].end = timestamp(frame);
+    m_open.pop_back();
+  }
+
+  /**
+   * \brief Ends the current frame, and collects the results of the oldest frame.
+   *
+   * \details Call this function once per frame, e.g. after swapping the window.
+   *
+   * \since 6.4.0
+   */
+  void end_frame()
+  {
+    if (!is_complete()) {
+      return;
+    }
+
+    assert(m_open.empty() && "Unbalanced GPU passes!");
+    m_open.clear();
+
+    m_current = (m_current + 1) % m_frames.size();
+
+    // The oldest frame is about to be reused, so now is the last chance to collect it
+    auto& oldest = m_frames[m_current];
+    if (!oldest.passes.empty()) {
+      if (is_available(oldest)) {
+        collect(oldest);
+      }
+      else {
+        ++m_dropped;
+      }
+    }
+
+    oldest.passes.clear();
+    oldest.used = 0;
+  }
+
+  /**
+   * \brief Returns the statistics of all passes that have been measured.
+   *
+   * \details The statistics refer to the latest collected frame, which lags behind the
+   * current frame by the latency of the profiler.
+   *
+   * \return the statistics of every pass, sorted by name.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto passes() const -> std::vector<profile_zone_stats>
+  {
+    std::vector<profile_zone_stats> result;
+    result.reserve(m_stats.size());
+
+    for (const auto& [name, pass] : m_stats) {
+      auto& stats = result.emplace_back();
+      stats.name = name;
+      stats.calls = pass.calls;
+      stats.last = nanoseconds<u64>{pass.frameTime};
+      stats.min = nanoseconds<u64>{pass.minTime};
+      stats.max = nanoseconds<u64>{pass.maxTime};
+      stats.average = nanoseconds<u64>{pass.frames != 0 ? pass.totalTime / pass.frames : 0};
+      stats.frames = pass.frames;
+    }
+
+    std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+      return a.name < b.name;
+    });
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the statistics of a pass.
+   *
+   * \param name the name of the pass.
+   *
+   * \return the statistics of the pass; `std::nullopt` if it has never been collected.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto find(const std::string_view name) const
+      -> std::optional<profile_zone_stats>
+  {
+    for (const auto& stats : passes()) {
+      if (stats.name == name) {
+        return stats;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+   * \brief Returns the GPU time of the latest collected frame.
+   *
+   * \details This is the time between the start of the first pass and the end of the
+   * last pass, so work outside of passes is only included if it's between passes.
+   *
+   * \return the GPU time of the latest collected frame.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto frame_time() const noexcept -> nanoseconds<u64>
+  {
+    return nanoseconds<u64>{m_frameTime};
+  }
+
+  /**
+   * \brief Returns the amount of frames that were dropped because their results weren't
+   * available in time.
+   *
+   * \details A high amount indicates that the latency of the profiler should be increased.
+   *
+   * \return the number of dropped frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> u64
+  {
+    return m_dropped;
+  }
+
+  /**
+   * \brief Clears the statistics of all passes.
+   *
+   * \since 6.4.0
+   */
+  void reset() noexcept
+  {
+    m_stats.clear();
+    m_frameTime = 0;
+    m_dropped = 0;
+  }
+
+  /**
+   * \brief Returns the amount of frames that results are given to become available.
+   *
+   * \return the latency of the profiler, in frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto latency() const noexcept -> usize
+  {
+    return m_frames.size() - 1;
+  }
+
+  /**
+   * \brief Indicates whether or not timer queries are available.
+   *
+   * \return `true` if the profiler measures passes; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_complete() const noexcept -> bool
+  {
+    return m_functions.is_complete();
+  }
+
+ private:
+  struct pass_record final
+  {
+    const char* name{};
+    usize begin{};  ///< The index of the query at the start of the pass.
+    usize end{};    ///< The index of the query at the end of the pass.
+  };
+
+  struct frame_queries final
+  {
+    std::vector<unsigned> queries;  ///< Reused by later frames, only grows.
+    std::vector<pass_record> passes;
+    usize used{};
+  };
+
+  struct pass_data final
+  {
+    u64 calls{};
+    u64 frameTime{};
+    u64 totalTime{};
+    u64 minTime{};
+    u64 maxTime{};
+    u64 frames{};
+  };
+
+  function_table<detail::gl_gen_queries,
+                 detail::gl_delete_queries,
+                 detail::gl_query_counter,
+                 detail::gl_get_query_objectiv,
+                 detail::gl_get_query_objectui64v>
+      m_functions;
+  std::vector<frame_queries> m_frames;
+  std::vector<usize> m_open;  ///< The indices of the passes that haven't ended.
+  std::unordered_map<std::string_view, pass_data> m_stats;
+  usize m_current{};
+  u64 m_frameTime{};
+  u64 m_dropped{};
+
+  [[nodiscard]] auto timestamp(frame_queries& frame) -> usize
+  {
+    if (frame.used == frame.queries.size()) {
+      const auto count = std::max(frame.queries.size(), usize{8});
+      frame.queries.resize(frame.queries.size() + count);
+      m_functions.get<detail::gl_gen_queries>()(static_cast<int>(count),
+                                                frame.queries.data() + frame.used);
+    }
+
+    const auto index = frame.used++;
+    m_functions.get<detail::gl_query_counter>()(frame.queries[index], detail::gl_timestamp);
+
+    return index;
+  }
+
+  // Queries complete in order, so the results are available if the last one is
+  [[nodiscard]] auto is_available(const frame_queries& frame) const noexcept -> bool
+  {
+    int available = 0;
+    m_functions.get<detail::gl_get_query_objectiv>()(frame.queries[frame.used - 1],
+                                                     detail::gl_query_result_available,
+                                                     &available);
+    return available != 0;
+  }
+
+  void collect(const frame_queries& frame)
+  {
+    const auto getResult = m_functions.get<detail::gl_get_query_objectui64v>();
+
+    std::vector<u64> times(frame.used);
+    for (usize index = 0; index < frame.used; ++index) {
+      getResult(frame.queries[index], detail::gl_query_result, &times[index]);
+    }
+
+    for (auto& [name, pass] : m_stats) {
+      pass.calls = 0;
+      pass.frameTime = 0;
+    }
+
+    u64 first = times[frame.passes.front().begin];
+    u64 last = first;
+
+    for (const auto& record : frame.passes) {
+      const auto begin = times[record.begin];
+      const auto end = times[record.end];
+
+      auto& pass = m_stats[record.name];
+      ++pass.calls;
+      pass.frameTime += end > begin ? end - begin : 0;
+
+      first = std::min(first, begin);
+      last = std::max(last, end);
+    }
+
+    for (auto& [name, pass] : m_stats) {
+      if (pass.calls != 0) {
+        pass.minTime = pass.frames != 0 ? std::min(pass.minTime, pass.frameTime)
+                                        : pass.frameTime;
+        pass.maxTime = std::max(pass.maxTime, pass.frameTime);
+        pass.totalTime += pass.frameTime;
+        ++pass.frames;
+      }
+    }
+
+    m_frameTime = last - first;
+  }
+};
+
+/**
+ * \class gpu_zone
+ *
+ * \brief Measures the GPU time of the commands issued in a scope.
+ *
+ * \see `gpu_profiler`
+ *
+ * \since 6.4.0
+ */
+class gpu_zone final
+{
+ public:
+  /**
+   * \brief Starts measuring a pass.
+   *
+   * \param profiler the profiler that measures the pass, must outlive the zone.
+   * \param name the name of the pass, which must refer to a string with static storage
+   * duration.
+   *
+   * \since 6.4.0
+   */
+  gpu_zone(gpu_profiler& profiler, const char* name) : m_profiler{profiler}
+  {
+    m_profiler.begin_pass(name);
+  }
+
+  gpu_zone(const gpu_zone&) = delete;
+
+  auto operator=(const gpu_zone&) -> gpu_zone& = delete;
+
+  /**
+   * \brief Stops measuring the pass.
+   *
+   * \since 6.4.0
+   */
+  ~gpu_zone() noexcept
+  {
+    m_profiler.end_pass();
+  }
+
+ private:
+  gpu_profiler& m_profiler;
+};
+
+/// \} End of group video
+
+}  // namespace cen::gl
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_GPU_PROFILER_HEADER
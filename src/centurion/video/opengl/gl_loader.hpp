@@ -0,0 +1,305 @@
+#ifndef CENTURION_GL_LOADER_HEADER
+#define CENTURION_GL_LOADER_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // count_if
+#include <array>        // array
+#include <bitset>       // bitset
+#include <cassert>      // assert
+#include <string_view>  // string_view
+#include <tuple>        // tuple
+#include <type_traits>  // is_pointer_v, is_function_v, remove_pointer_t
+
+#include "../../core/integers.hpp"
+#include "../../core/str.hpp"
+#include "../../detail/tuple_type_index.hpp"
+
+namespace cen::gl {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class function_table
+ *
+ * \brief A table of OpenGL function pointers, which are resolved all at once.
+ *
+ * \details Each function is described by a tag type, which provides the function pointer
+ * type as `type` and the name of the function as `name`. All functions are resolved with
+ * `SDL_GL_GetProcAddress()` when the table is created, after which `get()` is a simple
+ * array lookup that returns a pointer of the correct type, without casts at the call
+ * site.
+ * \code{cpp}
+ *   struct gen_buffers final
+ *   {
+ *     using type = PFNGLGENBUFFERSPROC;
+ *     inline constexpr static cen::str name = "glGenBuffers";
+ *   };
+ *
+ *   struct bind_buffer final
+ *   {
+ *     using type = PFNGLBINDBUFFERPROC;
+ *     inline constexpr static cen::str name = "glBindBuffer";
+ *   };
+ *
+ *   const cen::gl::function_table<gen_buffers, bind_buffer> functions;
+ *   if (!functions.is_complete()) {
+ *     // ...
+ *   }
+ *
+ *   GLuint buffer = 0;
+ *   functions.get<gen_buffers>()(1, &buffer);
+ *   functions.get<bind_buffer>()(GL_ARRAY_BUFFER, buffer);
+ * \endcode
+ *
+ * \note Function pointers are only valid for the context that was current when they were
+ * resolved, so create a table for each context, or call `reload()` after the context has
+ * been recreated.
+ *
+ * \tparam Functions the tag types of the functions.
+ *
+ * \see `gl_library::address_of()`
+ *
+ * \since 6.4.0
+ */
+template <typename... Functions>
+class function_table final
+{
+  static_assert(sizeof...(Functions) > 0, "A function table needs at least one function!");
+  static_assert((std::is_pointer_v<typename Functions::type> && ...),
+                "Function types must be function pointers!");
+  static_assert((std::is_function_v<std::remove_pointer_t<typename Functions::type>> && ...),
+                "Function types must be function pointers!");
+
+ public:
+  /// The amount of functions in the table.
+  inline constexpr static usize function_count = sizeof...(Functions);
+
+  /**
+   * \brief Resolves all functions in the table.
+   *
+   * \pre An OpenGL context should be current on the calling thread.
+   *
+   * \since 6.4.0
+   */
+  function_table() noexcept
+  {
+    reload();
+  }
+
+  /**
+   * \brief Resolves all functions in the table again, e.g. after the context was
+   * recreated.
+   *
+   * \since 6.4.0
+   */
+  void reload() noexcept
+  {
+    m_addresses = {SDL_GL_GetProcAddress(Functions::name)...};
+  }
+
+  /**
+   * \brief Returns a function pointer.
+   *
+   * \tparam Function the tag type of the function.
+   *
+   * \return the function pointer; null if the function couldn't be resolved.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  [[nodiscard]] auto get() const noexcept -> typename Function::type
+  {
+    return reinterpret_cast<typename Function::type>(m_addresses[index_of<Function>()]);
+  }
+
+  /**
+   * \brief Indicates whether or not a function was resolved.
+   *
+   * \tparam Function the tag type of the function.
+   *
+   * \return `true` if the function is available; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  [[nodiscard]] auto is_loaded() const noexcept -> bool
+  {
+    return m_addresses[index_of<Function>()] != nullptr;
+  }
+
+  /**
+   * \brief Returns the amount of functions that were resolved.
+   *
+   * \return the amount of available functions.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto loaded_count() const noexcept -> usize
+  {
+    return static_cast<usize>(std::count_if(m_addresses.begin(),
+                                            m_addresses.end(),
+                                            [](const void* address) { return address; }));
+  }
+
+  /**
+   * \brief Indicates whether or not all functions were resolved.
+   *
+   * \return `true` if every function is available; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_complete() const noexcept -> bool
+  {
+    return loaded_count() == function_count;
+  }
+
+ private:
+  std::array<void*, function_count> m_addresses{};
+
+  template <typename Function>
+  [[nodiscard]] constexpr static auto index_of() noexcept -> usize
+  {
+    constexpr auto index = detail::tuple_type_index_v<Function, std::tuple<Functions...>>;
+    static_assert(index != -1, "Function is not in the table!");
+    return static_cast<usize>(index);
+  }
+};
+
+/**
+ * \class extension_set
+ *
+ * \brief Caches whether or not a set of OpenGL extensions is supported.
+ *
+ * \details `is_extension_supported()` scans the extension list of the current context on
+ * every call. An extension set queries each extension once when it is created, and stores
+ * the results in a bitset, so later checks are free.
+ * \code{cpp}
+ *   enum extension : cen::usize
+ *   {
+ *     anisotropic_filtering,
+ *     debug_output
+ *   };
+ *
+ *   const cen::gl::extension_set extensions{
+ *       std::array<cen::str, 2>{"GL_EXT_texture_filter_anisotropic", "GL_KHR_debug"}};
+ *
+ *   if (extensions.supports(anisotropic_filtering)) {
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \tparam N the amount of extensions in the set.
+ *
+ * \see `is_extension_supported()`
+ *
+ * \since 6.4.0
+ */
+template <usize N>
+class extension_set final
+{
+ public:
+  /**
+   * \brief Queries the support of a set of extensions.
+   *
+   * \pre An OpenGL context should be current on the calling thread.
+   *
+   * \param names the names of the extensions, must not contain null strings.
+   *
+   * \since 6.4.0
+   */
+  explicit extension_set(const std::array<str, N>& names) noexcept : m_names{names}
+  {
+    reload();
+  }
+
+  /**
+   * \brief Queries the support of the extensions again, e.g. after the context was
+   * recreated.
+   *
+   * \since 6.4.0
+   */
+  void reload() noexcept
+  {
+    for (usize index = 0; index < N; ++index) {
+      assert(m_names[index]);
+      m_supported.set(index, SDL_GL_ExtensionSupported(m_names[index]) == SDL_TRUE);
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not an extension is supported.
+   *
+   * \param index the index of the extension, in the order of the names.
+   *
+   * \return `true` if the extension is supported; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto supports(const usize index) const noexcept -> bool
+  {
+    assert(index < N);
+    return m_supported.test(index);
+  }
+
+  /**
+   * \brief Indicates whether or not an extension is supported.
+   *
+   * \details This overload compares the name to each extension in the set.
+   *
+   * \param name the name of the extension.
+   *
+   * \return `true` if the extension is in the set and supported; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto supports(const std::string_view name) const noexcept -> bool
+  {
+    for (usize index = 0; index < N; ++index) {
+      if (name == m_names[index]) {
+        return m_supported.test(index);
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Returns the amount of supported extensions.
+   *
+   * \return the amount of supported extensions in the set.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto supported_count() const noexcept -> usize
+  {
+    return m_supported.count();
+  }
+
+  /**
+   * \brief Returns the support of all extensions.
+   *
+   * \return a bitset, where bit `i` indicates whether the extension at index `i` is
+   * supported.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bits() const noexcept -> const std::bitset<N>&
+  {
+    return m_supported;
+  }
+
+ private:
+  std::array<str, N> m_names{};
+  std::bitset<N> m_supported;
+};
+
+/// \} End of group video
+
+}  // namespace cen::gl
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_LOADER_HEADER
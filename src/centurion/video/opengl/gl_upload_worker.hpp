@@ -0,0 +1,317 @@
+#ifndef CENTURION_GL_UPLOAD_WORKER_HEADER
+#define CENTURION_GL_UPLOAD_WORKER_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL2/SDL.h>
+
+#include <cassert>     // assert
+#include <exception>   // current_exception
+#include <functional>  // function
+#include <utility>     // move, forward
+
+#include "../../core/exception.hpp"
+#include "../../core/integers.hpp"
+#include "../../thread/blocking_queue.hpp"
+#include "../../thread/future.hpp"
+#include "../../thread/thread.hpp"
+#include "../window.hpp"
+#include "gl_attribute.hpp"
+#include "gl_context.hpp"
+#include "gl_core.hpp"
+
+namespace cen::gl {
+
+/// \cond FALSE
+namespace detail {
+
+// The few OpenGL 3.2 declarations needed for fences, to avoid depending on GL headers
+#if defined(_WIN32) && !defined(_WIN64)
+#define CENTURION_GL_APIENTRY __stdcall
+#else
+#define CENTURION_GL_APIENTRY
+#endif
+
+using gl_sync = struct gl_sync_object*;
+
+using gl_fence_sync_fn = gl_sync(CENTURION_GL_APIENTRY*)(unsigned condition, unsigned flags);
+using gl_client_wait_sync_fn = unsigned(CENTURION_GL_APIENTRY*)(gl_sync sync,
+                                                                unsigned flags,
+                                                                u64 timeout);
+using gl_delete_sync_fn = void(CENTURION_GL_APIENTRY*)(gl_sync sync);
+using gl_finish_fn = void(CENTURION_GL_APIENTRY*)();
+
+#undef CENTURION_GL_APIENTRY
+
+inline constexpr unsigned gl_sync_gpu_commands_complete = 0x9117;
+inline constexpr unsigned gl_sync_flush_commands_bit = 0x1;
+inline constexpr unsigned gl_timeout_expired = 0x911B;
+
+inline constexpr u64 gl_fence_wait_ns = 100'000'000;
+
+}  // namespace detail
+/// \endcond
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class upload_worker
+ *
+ * \brief Uploads textures and buffers on a worker thread, using a shared OpenGL context.
+ *
+ * \details An upload worker creates an OpenGL context that shares its objects with the
+ * current context, and makes it current on a dedicated `thread`. Upload jobs, e.g. calls to
+ * `glTexSubImage2D()` or `glBufferData()`, are executed in submission order on the worker
+ * thread, so the main thread doesn't stall while large amounts of data are transferred.
+ *
+ * \details After each job, the worker inserts a fence and waits until the GPU has finished
+ * the commands of the job, after which the future returned by `submit()` becomes ready.
+ * The uploaded objects may be used by the main context once the future is ready.
+ * \code{cpp}
+ *   cen::gl::context context{window};
+ *   context.make_current(window);
+ *
+ *   cen::gl::upload_worker uploads{window};
+ *
+ *   GLuint id = 0;
+ *   glGenTextures(1, &id);
+ *
+ *   auto uploaded = uploads.submit([id, pixels = std::move(pixels)] {
+ *     glBindTexture(GL_TEXTURE_2D, id);
+ *     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 512, 512, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+ *                  pixels.data());
+ *   });
+ *
+ *   // Later, on the main thread
+ *   if (uploaded.ready()) {
+ *     draw_with(id);
+ *   }
+ * \endcode
+ *
+ * \details Objects created by a job, e.g. textures, are shared with the main context, but
+ * container objects such as vertex array objects and framebuffers are never shared between
+ * contexts, so they must be created by the main context. If fences aren't supported, i.e.
+ * the OpenGL version is older than 3.2, the worker falls back to `glFinish()`.
+ *
+ * \details If a job throws an exception, the exception is rethrown by `future::get()` of
+ * the future returned by `submit()`, and the worker continues with the next job.
+ *
+ * \note The window must outlive the upload worker.
+ *
+ * \see `basic_context`
+ * \see `future`
+ *
+ * \since 6.4.0
+ */
+class upload_worker final
+{
+ public:
+  using job_type = std::function<void()>;
+
+  /**
+   * \brief Creates a shared OpenGL context, and starts the worker thread.
+   *
+   * \pre An OpenGL context must be current on the calling thread, it will be current
+   * again when the constructor returns.
+   *
+   * \tparam T the ownership semantics of the window.
+   *
+   * \param window the OpenGL window that the current context was created for.
+   * \param capacity the maximum amount of pending jobs, before `submit()` blocks.
+   *
+   * \throws sdl_error if the shared context or the worker thread cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  explicit upload_worker(basic_window<T>& window, const usize capacity = 64)
+      : m_window{window.get()}
+      , m_context{make_shared_context(window)}
+      , m_jobs{capacity}
+      , m_thread{&upload_worker::run, "gl-upload", this}
+  {}
+
+  upload_worker(const upload_worker&) = delete;
+
+  auto operator=(const upload_worker&) -> upload_worker& = delete;
+
+  /**
+   * \brief Finishes the pending jobs, and stops the worker thread.
+   *
+   * \since 6.4.0
+   */
+  ~upload_worker() noexcept
+  {
+    job last;
+    last.stop = true;  // Stops the worker once the pending jobs are finished
+
+    m_jobs.push(std::move(last));
+    m_thread.join();
+  }
+
+  /**
+   * \brief Submits an upload job, which is executed with the shared context current.
+   *
+   * \details This function blocks if the maximum amount of jobs are pending.
+   *
+   * \tparam Function the type of the function object, invoked as `void()`.
+   *
+   * \param function the job, which issues the OpenGL commands of the upload.
+   *
+   * \return a future that becomes ready once the GPU has finished the job; a broken future
+   * if the job couldn't be submitted, e.g. because the function is empty.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  auto submit(Function&& function) -> future<void>
+  {
+    job item{job_type{std::forward<Function>(function)}, promise<void>{}};
+    auto result = item.done.get_future();
+
+    // The promise of a rejected job is broken when the job is destroyed
+    if (item.upload) {
+      m_jobs.push(std::move(item));
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the amount of submitted jobs that the worker hasn't started yet.
+   *
+   * \return the amount of pending jobs.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> usize
+  {
+    return m_jobs.size();
+  }
+
+  /**
+   * \brief Returns the shared context that is used by the worker thread.
+   *
+   * \return a handle to the shared context.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_context() const noexcept -> context_handle
+  {
+    return context_handle{m_context.get()};
+  }
+
+ private:
+  struct job final
+  {
+    job_type upload;
+    promise<void> done;
+    bool stop{};
+  };
+
+  struct fence_api final
+  {
+    detail::gl_fence_sync_fn fence{};
+    detail::gl_client_wait_sync_fn wait{};
+    detail::gl_delete_sync_fn destroy{};
+    detail::gl_finish_fn finish{};
+  };
+
+  SDL_Window* m_window{};
+  context m_context;
+  blocking_queue<job> m_jobs;
+  thread m_thread;
+
+  template <typename T>
+  [[nodiscard]] static auto make_shared_context(basic_window<T>& window) -> context
+  {
+    const auto previous = gl::get_context();
+    assert(previous.get());
+
+    const auto sharing = gl::get(gl_attribute::share_with_current_context).value_or(0);
+    gl::set(gl_attribute::share_with_current_context, 1);
+
+    // Creating a context makes it current, so the previous context is restored afterwards
+    auto* shared = SDL_GL_CreateContext(window.get());
+    SDL_GL_MakeCurrent(window.get(), previous.get());
+
+    gl::set(gl_attribute::share_with_current_context, sharing);
+
+    if (!shared) {
+      throw sdl_error{};
+    }
+
+    return context{shared};
+  }
+
+  [[nodiscard]] static auto load_fence_api() noexcept -> fence_api
+  {
+    fence_api api;
+    api.fence =
+        reinterpret_cast<detail::gl_fence_sync_fn>(SDL_GL_GetProcAddress("glFenceSync"));
+    api.wait = reinterpret_cast<detail::gl_client_wait_sync_fn>(
+        SDL_GL_GetProcAddress("glClientWaitSync"));
+    api.destroy =
+        reinterpret_cast<detail::gl_delete_sync_fn>(SDL_GL_GetProcAddress("glDeleteSync"));
+    api.finish = reinterpret_cast<detail::gl_finish_fn>(SDL_GL_GetProcAddress("glFinish"));
+    return api;
+  }
+
+  static void wait_for_gpu(const fence_api& api) noexcept
+  {
+    if (api.fence && api.wait && api.destroy) {
+      if (auto* sync = api.fence(detail::gl_sync_gpu_commands_complete, 0)) {
+        // The first wait flushes the commands, the job could never finish otherwise
+        auto flags = detail::gl_sync_flush_commands_bit;
+        while (api.wait(sync, flags, detail::gl_fence_wait_ns) ==
+               detail::gl_timeout_expired) {
+          flags = 0;
+        }
+
+        api.destroy(sync);
+        return;
+      }
+    }
+
+    if (api.finish) {
+      api.finish();
+    }
+  }
+
+  static auto run(void* data) -> int
+  {
+    auto& self = *static_cast<upload_worker*>(data);
+
+    const auto current = SDL_GL_MakeCurrent(self.m_window, self.m_context.get()) == 0;
+    const auto api = load_fence_api();
+
+    while (auto item = self.m_jobs.pop()) {
+      if (item->stop) {
+        break;
+      }
+
+      if (current) {
+        try {
+          item->upload();
+          wait_for_gpu(api);
+          item->done.set_value();
+        }
+        catch (...) {
+          item->done.set_exception(std::current_exception());
+        }
+      }
+      // Otherwise, the promise is broken when the job is destroyed
+    }
+
+    SDL_GL_MakeCurrent(self.m_window, nullptr);
+    return current ? 0 : -1;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen::gl
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_UPLOAD_WORKER_HEADER
@@ -0,0 +1,515 @@
+#ifndef CENTURION_PARTICLE_SYSTEM_HEADER
+#define CENTURION_PARTICLE_SYSTEM_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <array>    // array
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/particle_kernels.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class particle_system
+ *
+ * \brief Simulates and renders a fixed-capacity set of textured particles.
+ *
+ * \details The state of the particles is stored as a structure of arrays, i.e. each
+ * attribute, such as the x-coordinates or the ages, is stored in a separate array. As
+ * such, `update()` processes four particles at a time using SSE2 or NEON, when available.
+ * The particles are accelerated by gravity, slowed down by damping, and their colors and
+ * sizes are interpolated over their lifetimes.
+ * \code{cpp}
+ *   cen::particle_system sparks{1'024};
+ *   sparks.set_gravity({0, 200});
+ *   sparks.set_colors(cen::colors::yellow, cen::color{255, 0, 0, 0});
+ *
+ *   sparks.emit(position, velocity, 1.5f);
+ *   sparks.update(dt);
+ *   sparks.render(renderer, texture);
+ * \endcode
+ *
+ * \details Memory for all particles is allocated when the system is created. Dead
+ * particles are removed by moving the remaining particles towards the front of the arrays,
+ * which preserves the order of the live particles and never reallocates.
+ *
+ * \details All live particles are rendered with a single `SDL_RenderGeometry` call.
+ *
+ * \see `sprite_batch`
+ *
+ * \since 6.4.0
+ */
+class particle_system final
+{
+ public:
+  using size_type = usize;
+
+  /**
+   * \brief Creates an empty particle system.
+   *
+   * \param capacity the maximum amount of live particles.
+   *
+   * \since 6.4.0
+   */
+  explicit particle_system(const size_type capacity) : m_capacity{capacity}
+  {
+    for (auto& attribute : m_attributes) {
+      attribute.resize(capacity);
+    }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    m_vertices.resize(capacity * 4);
+    m_indices.resize(capacity * 6);
+
+    for (size_type index = 0; index < capacity; ++index) {
+      const auto first = static_cast<int>(index * 4);
+      auto* indices = m_indices.data() + index * 6;
+
+      indices[0] = first;
+      indices[1] = first + 1;
+      indices[2] = first + 2;
+      indices[3] = first + 2;
+      indices[4] = first + 3;
+      indices[5] = first;
+    }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+  }
+
+  /**
+   * \brief Adds a particle to the system.
+   *
+   * \param position the initial center of the particle.
+   * \param velocity the initial velocity of the particle, in pixels per second.
+   * \param lifetime the lifetime of the particle, in seconds.
+   *
+   * \return `true` if the particle was added; `false` if the system is full or the
+   * lifetime isn't positive.
+   *
+   * \since 6.4.0
+   */
+  auto emit(const fpoint position, const fpoint velocity, const float lifetime) noexcept
+      -> bool
+  {
+    if (m_size == m_capacity || !(lifetime > 0)) {
+      return false;
+    }
+
+    const auto index = m_size++;
+
+    attribute(x)[index] = position.x();
+    attribute(y)[index] = position.y();
+    attribute(velocity_x)[index] = velocity.x();
+    attribute(velocity_y)[index] = velocity.y();
+    attribute(age)[index] = 0;
+    attribute(inverse_lifetime)[index] = 1.0f / lifetime;
+    attribute(progress)[index] = 0;
+
+    interpolate(index, 1);
+
+    return true;
+  }
+
+  /**
+   * \brief Advances the simulation.
+   *
+   * \details Particles that reach the end of their lifetimes are removed, after which
+   * the remaining particles are moved, and their colors and sizes are updated.
+   *
+   * \param dt the elapsed time, in seconds.
+   *
+   * \since 6.4.0
+   */
+  void update(const float dt) noexcept
+  {
+    CENTURION_PROFILE_ZONE("particle_system::update");
+
+    detail::age_particles(attribute(age),
+                          attribute(inverse_lifetime),
+                          attribute(progress),
+                          m_size,
+                          dt);
+    compact();
+
+    detail::integrate_particles(attribute(x),
+                                attribute(velocity_x),
+                                m_size,
+                                m_gravity.x(),
+                                m_damping,
+                                dt);
+    detail::integrate_particles(attribute(y),
+                                attribute(velocity_y),
+                                m_size,
+                                m_gravity.y(),
+                                m_damping,
+                                dt);
+
+    interpolate(0, m_size);
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Renders all live particles with a single draw call.
+   *
+   * \tparam Renderer the type of the renderer.
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param renderer the renderer that will be used.
+   * \param texture the texture of the particles.
+   * \param source the area of the texture that is used by each particle.
+   *
+   * \return `success` if the particles were rendered, or if there were no particles;
+   * `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer, typename T>
+  auto render(Renderer& renderer, const basic_texture<T>& texture, const irect& source)
+      -> result
+  {
+    CENTURION_PROFILE_ZONE("particle_system::render");
+
+    if (m_size == 0) {
+      return success;
+    }
+
+    const auto size = texture.size();
+    const auto width = static_cast<float>(size.width);
+    const auto height = static_cast<float>(size.height);
+
+    const auto u0 = static_cast<float>(source.x()) / width;
+    const auto v0 = static_cast<float>(source.y()) / height;
+    const auto u1 = static_cast<float>(source.max_x()) / width;
+    const auto v1 = static_cast<float>(source.max_y()) / height;
+
+    const auto* xs = attribute(x);
+    const auto* ys = attribute(y);
+    const auto* sizes = attribute(particle_size);
+    const auto* reds = attribute(red);
+    const auto* greens = attribute(green);
+    const auto* blues = attribute(blue);
+    const auto* alphas = attribute(alpha);
+
+    for (size_type index = 0; index < m_size; ++index) {
+      const auto half = sizes[index] * 0.5f;
+      const auto minX = xs[index] - half;
+      const auto minY = ys[index] - half;
+      const auto maxX = xs[index] + half;
+      const auto maxY = ys[index] + half;
+
+      const SDL_Color tint{to_channel(reds[index]),
+                           to_channel(greens[index]),
+                           to_channel(blues[index]),
+                           to_channel(alphas[index])};
+
+      auto* quad = m_vertices.data() + index * 4;
+      quad[0] = {{minX, minY}, tint, {u0, v0}};
+      quad[1] = {{maxX, minY}, tint, {u1, v0}};
+      quad[2] = {{maxX, maxY}, tint, {u1, v1}};
+      quad[3] = {{minX, maxY}, tint, {u0, v1}};
+    }
+
+    renderer.record_draw(m_size, texture.get());
+    return SDL_RenderGeometry(renderer.get(),
+                              texture.get(),
+                              m_vertices.data(),
+                              static_cast<int>(m_size * 4),
+                              m_indices.data(),
+                              static_cast<int>(m_size * 6)) == 0;
+  }
+
+  /**
+   * \brief Renders all live particles with a single draw call, using the entire texture
+   * for each particle.
+   *
+   * \tparam Renderer the type of the renderer.
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param renderer the renderer that will be used.
+   * \param texture the texture of the particles.
+   *
+   * \return `success` if the particles were rendered, or if there were no particles;
+   * `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer, typename T>
+  auto render(Renderer& renderer, const basic_texture<T>& texture) -> result
+  {
+    return render(renderer, texture, irect{{0, 0}, texture.size()});
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Removes all particles.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_size = 0;
+  }
+
+  /**
+   * \brief Sets the acceleration that is applied to all particles.
+   *
+   * \param gravity the acceleration, in pixels per second squared.
+   *
+   * \since 6.4.0
+   */
+  void set_gravity(const fpoint gravity) noexcept
+  {
+    m_gravity = gravity;
+  }
+
+  /**
+   * \brief Sets the factor that the velocities are multiplied with in every update.
+   *
+   * \details The damping is 1 by default, i.e. the particles aren't slowed down.
+   *
+   * \param damping the damping factor, in the range [0, 1].
+   *
+   * \since 6.4.0
+   */
+  void set_damping(const float damping) noexcept
+  {
+    m_damping = damping;
+  }
+
+  /**
+   * \brief Sets the colors that the particles are interpolated between.
+   *
+   * \details The particles are white and opaque by default.
+   *
+   * \param start the color of new particles.
+   * \param end the color of particles at the end of their lifetimes.
+   *
+   * \since 6.4.0
+   */
+  void set_colors(const color& start, const color& end) noexcept
+  {
+    m_startColor = start;
+    m_endColor = end;
+  }
+
+  /**
+   * \brief Sets the sizes that the particles are interpolated between.
+   *
+   * \details The particles are 8 pixels large by default.
+   *
+   * \param start the width and height of new particles.
+   * \param end the width and height of particles at the end of their lifetimes.
+   *
+   * \since 6.4.0
+   */
+  void set_sizes(const float start, const float end) noexcept
+  {
+    m_startSize = start;
+    m_endSize = end;
+  }
+
+  /**
+   * \brief Returns the center of a live particle.
+   *
+   * \param index the index of the particle.
+   *
+   * \return the position of the particle.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto position(const size_type index) const noexcept -> fpoint
+  {
+    assert(index < m_size);
+    return {attribute(x)[index], attribute(y)[index]};
+  }
+
+  /**
+   * \brief Returns the velocity of a live particle.
+   *
+   * \param index the index of the particle.
+   *
+   * \return the velocity of the particle, in pixels per second.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto velocity(const size_type index) const noexcept -> fpoint
+  {
+    assert(index < m_size);
+    return {attribute(velocity_x)[index], attribute(velocity_y)[index]};
+  }
+
+  /**
+   * \brief Returns the color of a live particle.
+   *
+   * \param index the index of the particle.
+   *
+   * \return the current color of the particle.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto color_of(const size_type index) const noexcept -> color
+  {
+    assert(index < m_size);
+    return {to_channel(attribute(red)[index]),
+            to_channel(attribute(green)[index]),
+            to_channel(attribute(blue)[index]),
+            to_channel(attribute(alpha)[index])};
+  }
+
+  /**
+   * \brief Returns the size of a live particle.
+   *
+   * \param index the index of the particle.
+   *
+   * \return the current width and height of the particle.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size_of(const size_type index) const noexcept -> float
+  {
+    assert(index < m_size);
+    return attribute(particle_size)[index];
+  }
+
+  /**
+   * \brief Returns the amount of live particles.
+   *
+   * \return the number of live particles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the maximum amount of live particles.
+   *
+   * \return the capacity of the system.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Indicates whether or not there are any live particles.
+   *
+   * \return `true` if there are no particles; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+ private:
+  enum attribute_id : usize
+  {
+    x,
+    y,
+    velocity_x,
+    velocity_y,
+    age,
+    inverse_lifetime,
+    progress,
+    red,
+    green,
+    blue,
+    alpha,
+    particle_size,
+    attribute_count
+  };
+
+  std::array<std::vector<float>, attribute_count> m_attributes;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+  size_type m_capacity{};
+  size_type m_size{};
+  fpoint m_gravity;
+  float m_damping{1};
+  color m_startColor{colors::white};
+  color m_endColor{colors::white};
+  float m_startSize{8};
+  float m_endSize{8};
+
+  [[nodiscard]] auto attribute(const attribute_id id) noexcept -> float*
+  {
+    return m_attributes[id].data();
+  }
+
+  [[nodiscard]] auto attribute(const attribute_id id) const noexcept -> const float*
+  {
+    return m_attributes[id].data();
+  }
+
+  [[nodiscard]] static auto to_channel(const float value) noexcept -> u8
+  {
+    return static_cast<u8>(value + 0.5f);
+  }
+
+  // Updates the colors and sizes of a range of particles from their progress
+  void interpolate(const size_type first, const size_type count) noexcept
+  {
+    const auto* t = attribute(progress) + first;
+
+    const auto lerp = [&](const attribute_id id, const float start, const float end) {
+      detail::lerp_particles(attribute(id) + first, t, count, start, end);
+    };
+
+    lerp(red, m_startColor.red(), m_endColor.red());
+    lerp(green, m_startColor.green(), m_endColor.green());
+    lerp(blue, m_startColor.blue(), m_endColor.blue());
+    lerp(alpha, m_startColor.alpha(), m_endColor.alpha());
+    lerp(particle_size, m_startSize, m_endSize);
+  }
+
+  // Removes particles that have reached the end of their lifetimes, preserving the order
+  void compact() noexcept
+  {
+    const auto* t = attribute(progress);
+
+    size_type first = 0;
+    while (first < m_size && t[first] < 1.0f) {
+      ++first;
+    }
+
+    auto live = first;
+    for (auto index = first; index < m_size; ++index) {
+      if (t[index] < 1.0f) {
+        for (auto& values : m_attributes) {
+          values[live] = values[index];
+        }
+        ++live;
+      }
+    }
+
+    m_size = live;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_PARTICLE_SYSTEM_HEADER
@@ -0,0 +1,227 @@
+#ifndef CENTURION_PIXEL_CONVERSION_HEADER
+#define CENTURION_PIXEL_CONVERSION_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>  // assert
+#include <cstring>  // memmove
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/to_underlying.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../detail/row_bands.hpp"
+#include "../math/area.hpp"
+#include "../thread/task_scheduler.hpp"
+#include "pixel_format.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \brief Converts a block of pixels from one pixel format to another.
+ *
+ * \details Conversions between 32-bit formats with 8-bit channels (such as `rgba8888`,
+ * `argb8888`, `abgr8888`, `bgra8888` and `rgb888`), and between those formats and the
+ * 24-bit `rgb24` and `bgr24` formats, are performed with dedicated kernels. The 32-bit
+ * kernels use SSE2 or NEON when available. Other conversions are forwarded to
+ * `SDL_ConvertPixels`.
+ *
+ * \details The alpha channel is set to be opaque when converting from a format without an
+ * alpha channel to a format with an alpha channel.
+ *
+ * \pre The source and destination memory must not overlap, unless they are identical.
+ *
+ * \param size the size of the block of pixels.
+ * \param srcFormat the pixel format of the source pixels.
+ * \param src the source pixels.
+ * \param srcPitch the length of a row of source pixels, in bytes.
+ * \param dstFormat the pixel format of the destination pixels.
+ * \param dst the destination pixels.
+ * \param dstPitch the length of a row of destination pixels, in bytes.
+ *
+ * \return `success` if the pixels were converted; `failure` otherwise.
+ *
+ * \see `SDL_ConvertPixels`
+ *
+ * \since 6.4.0
+ */
+inline auto convert_pixels(const iarea size,
+                           const pixel_format srcFormat,
+                           const void* src,
+                           const int srcPitch,
+                           const pixel_format dstFormat,
+                           void* dst,
+                           const int dstPitch) noexcept -> result
+{
+  assert(size.width >= 0);
+  assert(size.height >= 0);
+
+  const auto* srcBytes = static_cast<const u8*>(src);
+  auto* dstBytes = static_cast<u8*>(dst);
+
+  const auto srcPacked = detail::packed_layout(srcFormat);
+  const auto dstPacked = detail::packed_layout(dstFormat);
+
+  if (srcFormat == dstFormat && (srcPacked || detail::array_layout(srcFormat))) {
+    const auto rowSize = static_cast<usize>(size.width * (srcPacked ? 4 : 3));
+    for (auto y = 0; y < size.height; ++y) {
+      std::memmove(dstBytes + y * dstPitch, srcBytes + y * srcPitch, rowSize);
+    }
+
+    return success;
+  }
+  else if (srcPacked && dstPacked) {
+    for (auto y = 0; y < size.height; ++y) {
+      const auto* srcRow = reinterpret_cast<const u32*>(srcBytes + y * srcPitch);
+      auto* dstRow = reinterpret_cast<u32*>(dstBytes + y * dstPitch);
+      detail::shuffle_row(srcRow, dstRow, size.width, *srcPacked, *dstPacked);
+    }
+
+    return success;
+  }
+  else if (const auto srcArray = detail::array_layout(srcFormat); srcArray && dstPacked) {
+    for (auto y = 0; y < size.height; ++y) {
+      auto* dstRow = reinterpret_cast<u32*>(dstBytes + y * dstPitch);
+      detail::unpack_row(srcBytes + y * srcPitch, dstRow, size.width, *srcArray, *dstPacked);
+    }
+
+    return success;
+  }
+  else if (const auto dstArray = detail::array_layout(dstFormat); srcPacked && dstArray) {
+    for (auto y = 0; y < size.height; ++y) {
+      const auto* srcRow = reinterpret_cast<const u32*>(srcBytes + y * srcPitch);
+      detail::pack_row(srcRow, dstBytes + y * dstPitch, size.width, *srcPacked, *dstArray);
+    }
+
+    return success;
+  }
+  else {
+    return SDL_ConvertPixels(size.width,
+                             size.height,
+                             to_underlying(srcFormat),
+                             src,
+                             srcPitch,
+                             to_underlying(dstFormat),
+                             dst,
+                             dstPitch) == 0;
+  }
+}
+
+/**
+ * \brief Converts a block of pixels from one pixel format to another, using the workers of
+ * a task scheduler.
+ *
+ * \details The block is split into bands of rows, which are converted in parallel. Blocks
+ * with fewer pixels than `parallel_pixel_threshold()` are converted on the calling thread,
+ * since splitting them up costs more than it saves. See the other overload for details
+ * about the conversions.
+ *
+ * \pre The source and destination memory must not overlap, unless they are identical.
+ *
+ * \param size the size of the block of pixels.
+ * \param srcFormat the pixel format of the source pixels.
+ * \param src the source pixels.
+ * \param srcPitch the length of a row of source pixels, in bytes.
+ * \param dstFormat the pixel format of the destination pixels.
+ * \param dst the destination pixels.
+ * \param dstPitch the length of a row of destination pixels, in bytes.
+ * \param scheduler the task scheduler that will convert the bands.
+ *
+ * \return `success` if all pixels were converted; `failure` otherwise.
+ *
+ * \since 6.4.0
+ */
+inline auto convert_pixels(const iarea size,
+                           const pixel_format srcFormat,
+                           const void* src,
+                           const int srcPitch,
+                           const pixel_format dstFormat,
+                           void* dst,
+                           const int dstPitch,
+                           task_scheduler& scheduler) -> result
+{
+  const auto* srcBytes = static_cast<const u8*>(src);
+  auto* dstBytes = static_cast<u8*>(dst);
+
+  return detail::for_each_row_band(
+      &scheduler,
+      size.width,
+      size.height,
+      [&](const int first, const int last) {
+        return convert_pixels({size.width, last - first},
+                              srcFormat,
+                              srcBytes + first * srcPitch,
+                              srcPitch,
+                              dstFormat,
+                              dstBytes + first * dstPitch,
+                              dstPitch);
+      });
+}
+
+/**
+ * \brief Converts a row of 32-bit pixels from one pixel format to another.
+ *
+ * \details This is a convenience overload for tightly packed pixel data, see the other
+ * overload for details.
+ *
+ * \warning The containers *must* store their data contiguously! The behaviour of this
+ * function is undefined if this condition isn't met.
+ *
+ * \tparam Source the source container type, e.g. `std::vector<u32>`.
+ * \tparam Destination the destination container type, e.g. `std::vector<u32>`.
+ *
+ * \pre The destination container must be at least as large as the source container.
+ *
+ * \param srcFormat the pixel format of the source pixels, must be a 32-bit format.
+ * \param src the source pixels.
+ * \param dstFormat the pixel format of the destination pixels, must be a 32-bit format.
+ * \param dst the destination pixels.
+ *
+ * \return `success` if the pixels were converted; `failure` otherwise.
+ *
+ * \since 6.4.0
+ */
+template <typename Source, typename Destination>
+auto convert_pixels(const pixel_format srcFormat,
+                    const Source& src,
+                    const pixel_format dstFormat,
+                    Destination& dst) noexcept -> result
+{
+  static_assert(sizeof(typename Source::value_type) == 4, "Expected 32-bit pixels!");
+  static_assert(sizeof(typename Destination::value_type) == 4, "Expected 32-bit pixels!");
+  assert(dst.size() >= src.size());
+
+  const auto count = isize(src);
+  return convert_pixels({count, 1},
+                        srcFormat,
+                        src.data(),
+                        count * 4,
+                        dstFormat,
+                        dst.data(),
+                        count * 4);
+}
+
+/**
+ * \brief Returns the minimum amount of pixels for which whole-image operations are split
+ * across the workers of a task scheduler.
+ *
+ * \details Smaller images are processed on the calling thread, since waking the workers
+ * costs more than it saves.
+ *
+ * \return the amount of pixels in a 512x512 image.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto parallel_pixel_threshold() noexcept -> usize
+{
+  return detail::parallel_pixel_threshold;
+}
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_PIXEL_CONVERSION_HEADER
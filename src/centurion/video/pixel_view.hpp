@@ -0,0 +1,406 @@
+#ifndef CENTURION_PIXEL_VIEW_HEADER
+#define CENTURION_PIXEL_VIEW_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // fill_n, copy_n, max, min
+#include <cassert>      // assert
+#include <type_traits>  // is_invocable_r_v, is_same_v
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "pixel_format_info.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class pixel_view
+ *
+ * \brief Provides efficient access to the pixel data of a surface.
+ *
+ * \details A pixel view locks the surface for the lifetime of the view, and caches the
+ * pixel format information that is used to convert between colors and pixel values. As a
+ * result, the pixel data can be read and modified without the overhead of locking the
+ * surface and looking up the pixel format for every pixel.
+ *
+ * \details Rows are addressed using the pitch of the surface, so padding at the end of
+ * the rows is handled correctly.
+ *
+ * \note Only surfaces with 32-bit pixel formats are supported.
+ *
+ * \note The surface must outlive the view, and must not be locked or unlocked by other
+ * means while the view exists.
+ *
+ * \see `basic_surface::set_pixel()`
+ *
+ * \since 6.4.0
+ */
+class pixel_view final
+{
+ public:
+  /**
+   * \brief Creates a view of the pixels of a surface, and locks the surface.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param surface the surface that will be viewed.
+   *
+   * \throws cen_error if the surface doesn't use a 32-bit pixel format.
+   * \throws sdl_error if the surface cannot be locked.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  explicit pixel_view(basic_surface<T>& surface)
+      : m_surface{surface.get()}
+      , m_info{surface.get()->format}
+  {
+    if (m_surface->format->BytesPerPixel != sizeof(u32)) {
+      throw cen_error{"Pixel views require a 32-bit pixel format!"};
+    }
+
+    if (SDL_MUSTLOCK(m_surface) && SDL_LockSurface(m_surface) != 0) {
+      throw sdl_error{};
+    }
+  }
+
+  pixel_view(const pixel_view&) = delete;
+
+  auto operator=(const pixel_view&) -> pixel_view& = delete;
+
+  /**
+   * \brief Unlocks the associated surface.
+   *
+   * \since 6.4.0
+   */
+  ~pixel_view() noexcept
+  {
+    if (SDL_MUSTLOCK(m_surface)) {
+      SDL_UnlockSurface(m_surface);
+    }
+  }
+
+  /// \name Pixel access
+  /// \{
+
+  /**
+   * \brief Returns a pointer to the first pixel in a row.
+   *
+   * \pre `y` must be in the range [0, `height()`).
+   *
+   * \param y the index of the row.
+   *
+   * \return a pointer to the `width()` pixel values in the row.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto row(const int y) noexcept -> u32*
+  {
+    assert(y >= 0 && y < height());
+    return reinterpret_cast<u32*>(static_cast<u8*>(m_surface->pixels) + y * pitch());
+  }
+
+  /// \copydoc row()
+  [[nodiscard]] auto row(const int y) const noexcept -> const u32*
+  {
+    assert(y >= 0 && y < height());
+    const auto* pixels = static_cast<const u8*>(m_surface->pixels);
+    return reinterpret_cast<const u32*>(pixels + y * pitch());
+  }
+
+  /**
+   * \brief Returns the raw value of a pixel.
+   *
+   * \pre `pixel` must be within the bounds of the surface.
+   *
+   * \param pixel the position of the pixel.
+   *
+   * \return the pixel value, encoded according to the pixel format of the surface.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto at(const ipoint pixel) const noexcept -> u32
+  {
+    assert(in_bounds(pixel));
+    return row(pixel.y())[pixel.x()];
+  }
+
+  /**
+   * \brief Returns the color of a pixel.
+   *
+   * \pre `pixel` must be within the bounds of the surface.
+   *
+   * \param pixel the position of the pixel.
+   *
+   * \return the color of the pixel.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_pixel(const ipoint pixel) const noexcept -> color
+  {
+    return unmap(at(pixel));
+  }
+
+  /**
+   * \brief Sets the color of a pixel.
+   *
+   * \pre `pixel` must be within the bounds of the surface.
+   *
+   * \details Unlike `basic_surface::set_pixel()`, this function doesn't check the
+   * coordinate at runtime (other than with assertions).
+   *
+   * \param pixel the position of the pixel.
+   * \param color the new color of the pixel.
+   *
+   * \since 6.4.0
+   */
+  void set_pixel(const ipoint pixel, const color& color) noexcept
+  {
+    assert(in_bounds(pixel));
+    row(pixel.y())[pixel.x()] = map(color);
+  }
+
+  /// \} End of pixel access
+
+  /// \name Bulk operations
+  /// \{
+
+  /**
+   * \brief Sets the color of all pixels.
+   *
+   * \param color the new color of the pixels.
+   *
+   * \since 6.4.0
+   */
+  void fill(const color& color) noexcept
+  {
+    fill(irect{{}, size()}, color);
+  }
+
+  /**
+   * \brief Sets the color of all pixels in an area.
+   *
+   * \details The area is clamped to the bounds of the surface.
+   *
+   * \param area the area that will be filled.
+   * \param color the new color of the pixels.
+   *
+   * \since 6.4.0
+   */
+  void fill(const irect& area, const color& color) noexcept
+  {
+    const auto value = map(color);
+
+    const auto minX = std::max(area.x(), 0);
+    const auto minY = std::max(area.y(), 0);
+    const auto maxX = std::min(area.max_x(), width());
+    const auto maxY = std::min(area.max_y(), height());
+
+    if (minX >= maxX) {
+      return;
+    }
+
+    for (auto y = minY; y < maxY; ++y) {
+      std::fill_n(row(y) + minX, maxX - minX, value);
+    }
+  }
+
+  /**
+   * \brief Copies raw pixel values into a row.
+   *
+   * \details Pixels that would be outside of the surface are ignored.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type, must store `u32` values contiguously, such as
+   * `std::vector<u32>` or `std::array<u32, N>`.
+   *
+   * \pre `y` must be in the range [0, `height()`).
+   *
+   * \param y the index of the row.
+   * \param pixels the pixel values, encoded according to the pixel format of the surface.
+   * \param x the x-coordinate of the first pixel that will be written.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  void blit_row(const int y, const Container& pixels, const int x = 0) noexcept
+  {
+    static_assert(std::is_same_v<typename Container::value_type, u32>,
+                  "Pixel values must be provided as u32 values!");
+    assert(y >= 0 && y < height());
+
+    // Skip the pixels that are to the left of the surface
+    const auto skip = std::max(0, -x);
+    const auto count = std::min(isize(pixels) - skip, width() - (x + skip));
+
+    if (count > 0) {
+      std::copy_n(pixels.data() + skip, count, row(y) + x + skip);
+    }
+  }
+
+  /**
+   * \brief Invokes a function object for each pixel, row by row.
+   *
+   * \details The function object can either return the new color of the pixel, i.e. have
+   * the signature `color(ipoint)`, or modify the raw pixel value directly, i.e. have the
+   * signature `void(ipoint, u32&)`.
+   *
+   * \tparam Fn the type of the function object.
+   *
+   * \param fn the function object that will be invoked for each pixel.
+   *
+   * \since 6.4.0
+   */
+  template <typename Fn>
+  void for_each_pixel(Fn&& fn)
+  {
+    const auto w = width();
+    const auto h = height();
+
+    for (auto y = 0; y < h; ++y) {
+      auto* pixels = row(y);
+      for (auto x = 0; x < w; ++x) {
+        if constexpr (std::is_invocable_r_v<color, Fn, ipoint>) {
+          pixels[x] = map(fn(ipoint{x, y}));
+        }
+        else {
+          fn(ipoint{x, y}, pixels[x]);
+        }
+      }
+    }
+  }
+
+  /// \} End of bulk operations
+
+  /// \name Conversions
+  /// \{
+
+  /**
+   * \brief Converts a color to a pixel value.
+   *
+   * \param color the color that will be converted.
+   *
+   * \return the pixel value, encoded according to the pixel format of the surface.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto map(const color& color) const noexcept -> u32
+  {
+    return m_info.rgba_to_pixel(color);
+  }
+
+  /**
+   * \brief Converts a pixel value to a color.
+   *
+   * \param pixel the pixel value, encoded according to the pixel format of the surface.
+   *
+   * \return the corresponding color.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto unmap(const u32 pixel) const noexcept -> color
+  {
+    return m_info.pixel_to_rgba(pixel);
+  }
+
+  /// \} End of conversions
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not a point is within the bounds of the surface.
+   *
+   * \param pixel the point that will be checked.
+   *
+   * \return `true` if the point is within the bounds of the surface; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto in_bounds(const ipoint pixel) const noexcept -> bool
+  {
+    return pixel.x() >= 0 && pixel.y() >= 0 && pixel.x() < width() && pixel.y() < height();
+  }
+
+  /**
+   * \brief Returns the width of the surface.
+   *
+   * \return the width of the surface, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto width() const noexcept -> int
+  {
+    return m_surface->w;
+  }
+
+  /**
+   * \brief Returns the height of the surface.
+   *
+   * \return the height of the surface, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto height() const noexcept -> int
+  {
+    return m_surface->h;
+  }
+
+  /**
+   * \brief Returns the size of the surface.
+   *
+   * \return the size of the surface, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return {width(), height()};
+  }
+
+  /**
+   * \brief Returns the pitch of the surface.
+   *
+   * \return the length of a row of pixels, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pitch() const noexcept -> int
+  {
+    return m_surface->pitch;
+  }
+
+  /**
+   * \brief Returns the cached pixel format information of the surface.
+   *
+   * \return a handle to the pixel format information.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto format_info() const noexcept -> const pixel_format_info_handle&
+  {
+    return m_info;
+  }
+
+  /// \} End of queries
+
+ private:
+  SDL_Surface* m_surface{};
+  pixel_format_info_handle m_info;
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_PIXEL_VIEW_HEADER
@@ -0,0 +1,615 @@
+#ifndef CENTURION_RENDER_COMMAND_LIST_HEADER
+#define CENTURION_RENDER_COMMAND_LIST_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // min
+#include <optional>   // nullopt
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "../thread/task_scheduler.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class render_command_list
+ *
+ * \brief Records rendering commands, which are replayed by a renderer later on.
+ *
+ * \details Recording a command doesn't call into SDL, so command lists can be recorded by
+ * any thread, e.g. by workers that cull and compute the destinations of the sprites in a
+ * part of the scene. The commands are then executed, in the order they were recorded, by
+ * `replay()` on the thread that owns the renderer.
+ * \code{cpp}
+ *   cen::render_command_list list;
+ *   list.set_color(cen::colors::red);
+ *   list.fill_rect(cen::frect{10, 10, 50, 50});
+ *   list.render(texture, cen::frect{100, 100, 64, 64});
+ *
+ *   // On the render thread
+ *   list.replay(renderer);
+ * \endcode
+ *
+ * \details A list keeps its capacity when cleared, so a list that is recorded every
+ * frame stops allocating once it has grown large enough.
+ *
+ * \note The recorded textures must outlive the replay of the list. Lists aren't
+ * thread-safe, each thread should record into its own list.
+ *
+ * \see `parallel_render_recorder`
+ *
+ * \since 6.4.0
+ */
+class render_command_list final
+{
+ public:
+  /// \name Recording
+  /// \{
+
+  /**
+   * \brief Records a change of the rendering color.
+   *
+   * \param color the new rendering color.
+   *
+   * \since 6.4.0
+   */
+  void set_color(const color& color)
+  {
+    auto& cmd = push(command_type::set_color);
+    cmd.tint = color;
+  }
+
+  /**
+   * \brief Records a change of the blend mode.
+   *
+   * \param mode the new blend mode.
+   *
+   * \since 6.4.0
+   */
+  void set_blend_mode(const blend_mode mode)
+  {
+    auto& cmd = push(command_type::set_blend_mode);
+    cmd.blend = mode;
+  }
+
+  /**
+   * \brief Records a change of the rendering target.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param target the texture that will be used as the rendering target, which must have
+   * been created with `texture_access::target`.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void set_target(const basic_texture<T>& target)
+  {
+    auto& cmd = push(command_type::set_target);
+    cmd.texture = target.get();
+  }
+
+  /**
+   * \brief Records a reset of the rendering target to the default target.
+   *
+   * \since 6.4.0
+   */
+  void reset_target()
+  {
+    push(command_type::reset_target);
+  }
+
+  /**
+   * \brief Records a change of the clipping area.
+   *
+   * \param area the new clipping area.
+   *
+   * \since 6.4.0
+   */
+  void set_clip(const irect& area)
+  {
+    auto& cmd = push(command_type::set_clip);
+    cmd.source = area;
+  }
+
+  /**
+   * \brief Records that clipping is disabled.
+   *
+   * \since 6.4.0
+   */
+  void reset_clip()
+  {
+    push(command_type::reset_clip);
+  }
+
+  /**
+   * \brief Records that the rendering target is cleared with a color.
+   *
+   * \details The rendering color is not affected by the command.
+   *
+   * \param color the color that the target is cleared with.
+   *
+   * \since 6.4.0
+   */
+  void clear_with(const color& color)
+  {
+    auto& cmd = push(command_type::clear_with);
+    cmd.tint = color;
+  }
+
+  /**
+   * \brief Records the outline of a rectangle, with the current rendering color.
+   *
+   * \param rect the rectangle that will be rendered.
+   *
+   * \since 6.4.0
+   */
+  void draw_rect(const frect& rect)
+  {
+    auto& cmd = push(command_type::draw_rect);
+    cmd.destination = rect;
+  }
+
+  /**
+   * \brief Records a filled rectangle, with the current rendering color.
+   *
+   * \param rect the rectangle that will be rendered.
+   *
+   * \since 6.4.0
+   */
+  void fill_rect(const frect& rect)
+  {
+    auto& cmd = push(command_type::fill_rect);
+    cmd.destination = rect;
+  }
+
+  /**
+   * \brief Records a line, with the current rendering color.
+   *
+   * \param start the start point of the line.
+   * \param end the end point of the line.
+   *
+   * \since 6.4.0
+   */
+  void draw_line(const fpoint& start, const fpoint& end)
+  {
+    auto& cmd = push(command_type::draw_line);
+    cmd.center = start;
+    cmd.end = end;
+  }
+
+  /**
+   * \brief Records an entire texture, rendered to an area of the target.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param destination the area of the rendering target that the texture will cover.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void render(const basic_texture<T>& texture, const frect& destination)
+  {
+    auto& cmd = push(command_type::render);
+    cmd.texture = texture.get();
+    cmd.destination = destination;
+  }
+
+  /**
+   * \brief Records a part of a texture, rendered to an area of the target.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param source the area of the texture that will be rendered.
+   * \param destination the area of the rendering target that the texture will cover.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void render(const basic_texture<T>& texture, const irect& source, const frect& destination)
+  {
+    auto& cmd = push(command_type::render_region);
+    cmd.texture = texture.get();
+    cmd.source = source;
+    cmd.destination = destination;
+  }
+
+  /**
+   * \brief Records a part of a texture, rendered with a rotation and flip.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param source the area of the texture that will be rendered.
+   * \param destination the area of the rendering target that the texture will cover.
+   * \param angle the clockwise rotation of the texture, in degrees.
+   * \param center the point, relative to the destination, that the texture is rotated
+   * around.
+   * \param flip specifies how the texture will be flipped.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void render(const basic_texture<T>& texture,
+              const irect& source,
+              const frect& destination,
+              const double angle,
+              const fpoint& center,
+              const SDL_RendererFlip flip = SDL_FLIP_NONE)
+  {
+    auto& cmd = push(command_type::render_ex);
+    cmd.texture = texture.get();
+    cmd.source = source;
+    cmd.destination = destination;
+    cmd.center = center;
+    cmd.angle = angle;
+    cmd.flip = flip;
+  }
+
+  /// \} End of recording
+
+  /**
+   * \brief Executes the recorded commands, in the order they were recorded.
+   *
+   * \details The list is not cleared by this function, so it may be replayed several
+   * times.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that executes the commands, on the thread that owns it.
+   *
+   * \return `success` if all commands succeeded; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto replay(Renderer& renderer) const -> result
+  {
+    CENTURION_PROFILE_ZONE("render_command_list::replay");
+
+    bool ok = true;
+    for (const auto& cmd : m_commands) {
+      if (!execute(renderer, cmd)) {
+        ok = false;
+      }
+    }
+
+    return ok;
+  }
+
+  /**
+   * \brief Removes all recorded commands, keeping the allocated capacity.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_commands.clear();
+  }
+
+  /**
+   * \brief Reserves capacity for a number of commands.
+   *
+   * \param count the amount of commands to reserve capacity for.
+   *
+   * \since 6.4.0
+   */
+  void reserve(const usize count)
+  {
+    m_commands.reserve(count);
+  }
+
+  /**
+   * \brief Returns the amount of recorded commands.
+   *
+   * \return the number of commands in the list.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_commands.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the list contains any commands.
+   *
+   * \return `true` if the list is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_commands.empty();
+  }
+
+ private:
+  enum class command_type : u8
+  {
+    set_color,
+    set_blend_mode,
+    set_target,
+    reset_target,
+    set_clip,
+    reset_clip,
+    clear_with,
+    draw_rect,
+    fill_rect,
+    draw_line,
+    render,
+    render_region,
+    render_ex
+  };
+
+  // A single flat type keeps the commands contiguous, without any per-command allocations
+  struct command final
+  {
+    command_type type{};
+    blend_mode blend{};
+    SDL_RendererFlip flip{SDL_FLIP_NONE};
+    color tint;
+    SDL_Texture* texture{};
+    irect source;
+    frect destination;
+    fpoint center;  ///< Also used as the start of lines.
+    fpoint end;
+    double angle{};
+  };
+
+  std::vector<command> m_commands;
+
+  auto push(const command_type type) -> command&
+  {
+    auto& cmd = m_commands.emplace_back();
+    cmd.type = type;
+    return cmd;
+  }
+
+  template <typename Renderer>
+  static auto execute(Renderer& renderer, const command& cmd) -> result
+  {
+    switch (cmd.type) {
+      case command_type::set_color:
+        return renderer.set_color(cmd.tint);
+
+      case command_type::set_blend_mode:
+        return renderer.set_blend_mode(cmd.blend);
+
+      case command_type::set_target: {
+        texture_handle target{cmd.texture};
+        return renderer.set_target(target);
+      }
+
+      case command_type::reset_target:
+        return renderer.reset_target();
+
+      case command_type::set_clip:
+        return renderer.set_clip(cmd.source);
+
+      case command_type::reset_clip:
+        return renderer.set_clip(std::nullopt);
+
+      case command_type::clear_with:
+        renderer.clear_with(cmd.tint);
+        return success;
+
+      case command_type::draw_rect:
+        return renderer.draw_rect(cmd.destination);
+
+      case command_type::fill_rect:
+        return renderer.fill_rect(cmd.destination);
+
+      case command_type::draw_line:
+        return renderer.draw_line(cmd.center, cmd.end);
+
+      case command_type::render:
+        return renderer.render(texture_handle{cmd.texture}, cmd.destination);
+
+      case command_type::render_region:
+        return renderer.render(texture_handle{cmd.texture}, cmd.source, cmd.destination);
+
+      case command_type::render_ex:
+        return renderer.render(texture_handle{cmd.texture},
+                               cmd.source,
+                               cmd.destination,
+                               cmd.angle,
+                               cmd.center,
+                               cmd.flip);
+
+      default:
+        return failure;
+    }
+  }
+};
+
+/**
+ * \class parallel_render_recorder
+ *
+ * \brief Records render command lists in parallel with a task scheduler, and replays them
+ * in order on the render thread.
+ *
+ * \details Every call to `record()` splits a range of items, e.g. the chunks of a tile map
+ * or the entities in a scene, into one part per thread, i.e. the workers of the scheduler
+ * and the calling thread, so with the default scheduler the frame is built by all CPU
+ * cores. Each part is recorded into its own command list, and `replay()` executes all
+ * lists in the order of their items, so the result is the same as if every item had been
+ * rendered directly, in order.
+ * \code{cpp}
+ *   cen::task_scheduler scheduler;
+ *   cen::parallel_render_recorder recorder{scheduler};
+ *
+ *   // Every frame
+ *   recorder.clear();
+ *   recorder.record(entities.size(), [&](cen::render_command_list& list, cen::usize i) {
+ *     if (camera.is_visible(entities[i])) {
+ *       list.render(entities[i].texture, entities[i].destination(camera));
+ *     }
+ *   });
+ *
+ *   recorder.replay(renderer);
+ *   renderer.present();
+ * \endcode
+ *
+ * \note The recording function is invoked concurrently, so it must not modify shared
+ * state without synchronization, nor call into SDL.
+ *
+ * \see `render_command_list`
+ * \see `task_scheduler`
+ *
+ * \since 6.4.0
+ */
+class parallel_render_recorder final
+{
+ public:
+  /**
+   * \brief Creates a recorder that records with the workers of a task scheduler.
+   *
+   * \param scheduler the task scheduler that will be used, which must outlive the recorder.
+   *
+   * \since 6.4.0
+   */
+  explicit parallel_render_recorder(task_scheduler& scheduler) noexcept
+      : m_scheduler{&scheduler}
+  {}
+
+  /**
+   * \brief Records the commands for a range of items, in parallel.
+   *
+   * \details The commands are appended to those recorded by earlier calls, so a frame may
+   * be recorded in several passes, e.g. one for the background and one for the sprites.
+   *
+   * \tparam Function the type of the function object, which is invoked with a
+   * `render_command_list&` and a `usize` item index.
+   *
+   * \param count the amount of items.
+   * \param function the function that records the commands of a single item.
+   *
+   * \since 6.4.0
+   */
+  template <typename Function>
+  void record(const usize count, Function function)
+  {
+    CENTURION_PROFILE_ZONE("parallel_render_recorder::record");
+
+    if (count == 0) {
+      return;
+    }
+
+    const auto parts = std::min(count, m_scheduler->worker_count() + 1);
+
+    const auto first = m_used;
+    m_used += parts;
+
+    if (m_lists.size() < m_used) {
+      m_lists.resize(m_used);
+    }
+
+    m_scheduler->parallel_for(
+        0,
+        parts,
+        [&](const usize part) {
+          auto& list = m_lists[first + part];
+
+          const auto begin = part * count / parts;
+          const auto end = (part + 1) * count / parts;
+
+          for (auto index = begin; index < end; ++index) {
+            function(list, index);
+          }
+        },
+        1);
+  }
+
+  /**
+   * \brief Executes all recorded commands, in the order of their items.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that executes the commands, on the thread that owns it.
+   *
+   * \return `success` if all commands succeeded; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto replay(Renderer& renderer) const -> result
+  {
+    CENTURION_PROFILE_ZONE("parallel_render_recorder::replay");
+
+    bool ok = true;
+    for (usize index = 0; index < m_used; ++index) {
+      if (!m_lists[index].replay(renderer)) {
+        ok = false;
+      }
+    }
+
+    return ok;
+  }
+
+  /**
+   * \brief Removes all recorded commands, keeping the allocated lists.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    for (usize index = 0; index < m_used; ++index) {
+      m_lists[index].clear();
+    }
+
+    m_used = 0;
+  }
+
+  /**
+   * \brief Returns the total amount of recorded commands.
+   *
+   * \return the number of commands in all lists.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    usize total = 0;
+    for (usize index = 0; index < m_used; ++index) {
+      total += m_lists[index].size();
+    }
+
+    return total;
+  }
+
+  /**
+   * \brief Returns the amount of command lists that have been recorded since the last clear.
+   *
+   * \return the number of lists that will be replayed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto list_count() const noexcept -> usize
+  {
+    return m_used;
+  }
+
+ private:
+  task_scheduler* m_scheduler{};
+  std::vector<render_command_list> m_lists;
+  usize m_used{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_COMMAND_LIST_HEADER
@@ -0,0 +1,456 @@
+#ifndef CENTURION_RENDER_DRIVER_CALIBRATION_HEADER
+#define CENTURION_RENDER_DRIVER_CALIBRATION_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // min_element, nth_element
+#include <cstddef>      // ptrdiff_t
+#include <cstdio>       // snprintf
+#include <optional>     // optional, nullopt
+#include <string>       // string
+#include <string_view>  // string_view
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../filesystem/file.hpp"
+#include "../hints/hint_priority.hpp"
+#include "../hints/hint_profile.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../system/counter.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "graphics_drivers.hpp"
+#include "pixel_format.hpp"
+#include "renderer.hpp"
+#include "renderer_info.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct render_driver_score
+ *
+ * \brief Provides the result of benchmarking a render driver.
+ *
+ * \since 6.4.0
+ */
+struct render_driver_score final
+{
+  std::string name;        ///< The name of the render driver, e.g. "opengl".
+  renderer_info info;      ///< The capabilities of the benchmarked renderer.
+  double frame_time_ms{};  ///< The median frame time of the benchmark scene.
+};
+
+/**
+ * \struct render_driver_report
+ *
+ * \brief Provides the outcome of selecting a render driver.
+ *
+ * \since 6.4.0
+ */
+struct render_driver_report final
+{
+  std::string driver;                       ///< The selected driver, empty if there is none.
+  std::vector<render_driver_score> scores;  ///< The benchmark results, empty if cached.
+  bool cached{};                            ///< Indicates whether a stored result was used.
+  bool applied{};                           ///< Indicates whether the hint was set.
+};
+
+/**
+ * \class render_driver_calibration
+ *
+ * \brief Selects the fastest render driver on the current machine, and remembers it.
+ *
+ * \details The fastest render driver varies between machines, so instead of hard-coding
+ * the driver with a hint, the first launch benchmarks every available driver. Each driver
+ * renders a short scene of filled rectangles and textures to a hidden window, without
+ * vsync, and the driver with the lowest median frame time is stored in a file. Later
+ * launches read the file and only set the render driver hint, which takes no noticeable
+ * time.
+ * \code{cpp}
+ *   const cen::sdl library;
+ *
+ *   cen::render_driver_calibration calibration{cen::preferred_path("studio", "game").copy()};
+ *   calibration.apply();  // Benchmarks the drivers on the first launch
+ *
+ *   cen::window window;
+ *   cen::renderer renderer{window};  // Uses the selected driver
+ * \endcode
+ *
+ * \details The file uses the hint configuration format, so it can also be applied with
+ * `apply_hint_file()`, and it lists the benchmark results in comments. The stored result is
+ * ignored if the set of available drivers has changed since it was written, e.g. after an
+ * SDL upgrade, in which case the drivers are benchmarked again.
+ *
+ * \note The video subsystem must be initialized, and the hint must be applied before the
+ * renderers are created.
+ *
+ * \see `hint::render_driver`
+ *
+ * \since 6.4.0
+ */
+class render_driver_calibration final
+{
+ public:
+  /**
+   * \brief Creates a render driver calibration.
+   *
+   * \param directory the directory in which the result is stored, including a trailing
+   * path separator, e.g. the path obtained with `preferred_path()`. The directory must
+   * exist.
+   *
+   * \since 6.4.0
+   */
+  explicit render_driver_calibration(std::string directory)
+      : m_path{std::move(directory) + file_name()}
+  {}
+
+  /**
+   * \brief Sets the render driver hint to the fastest driver.
+   *
+   * \details The stored result is used if there is a valid one, otherwise the drivers are
+   * benchmarked and the result is stored. A failure to store the result isn't treated as
+   * an error.
+   *
+   * \param priority the priority of the render driver hint.
+   *
+   * \return a report of the selected driver.
+   *
+   * \see `recalibrate()`
+   *
+   * \since 6.4.0
+   */
+  auto apply(const hint_priority priority = hint_priority::normal) -> render_driver_report
+  {
+    if (auto driver = load()) {
+      render_driver_report report;
+      report.driver = std::move(*driver);
+      report.cached = true;
+      report.applied = set_driver_hint(report.driver, priority);
+      return report;
+    }
+
+    return recalibrate(priority);
+  }
+
+  /**
+   * \brief Benchmarks the drivers, stores the result and sets the render driver hint.
+   *
+   * \details This ignores the stored result, which is useful when graphics settings have
+   * changed, e.g. after a driver update that the available drivers don't reflect.
+   *
+   * \param priority the priority of the render driver hint.
+   *
+   * \return a report of the selected driver, and the benchmark results.
+   *
+   * \since 6.4.0
+   */
+  auto recalibrate(const hint_priority priority = hint_priority::normal)
+      -> render_driver_report
+  {
+    render_driver_report report;
+    report.scores = calibrate();
+
+    const auto fastest =
+        std::min_element(report.scores.begin(),
+                         report.scores.end(),
+                         [](const render_driver_score& a, const render_driver_score& b) {
+                           return a.frame_time_ms < b.frame_time_ms;
+                         });
+
+    if (fastest != report.scores.end()) {
+      report.driver = fastest->name;
+      store(report.driver, report.scores);
+      report.applied = set_driver_hint(report.driver, priority);
+    }
+
+    return report;
+  }
+
+  /**
+   * \brief Benchmarks every available render driver.
+   *
+   * \details Drivers that fail to create a renderer are left out of the results. The
+   * render driver hint is neither read nor modified.
+   *
+   * \return the benchmark results, in the order the drivers are reported by SDL.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto calibrate() const -> std::vector<render_driver_score>
+  {
+    std::vector<render_driver_score> scores;
+
+    const auto count = render_driver_count();
+    for (int index = 0; index < count; ++index) {
+      if (auto score = benchmark(index)) {
+        scores.push_back(std::move(*score));
+      }
+    }
+
+    return scores;
+  }
+
+  /**
+   * \brief Returns the stored driver, if it's still valid.
+   *
+   * \return the name of the stored driver; `std::nullopt` if there is no stored result, or
+   * if the available drivers have changed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto load() const -> std::optional<std::string>
+  {
+    file source{m_path, file_mode::read_existing};
+    if (!source) {
+      return std::nullopt;
+    }
+
+    const auto text = source.read_all_as_string();
+    const auto drivers = std::string{drivers_prefix} + available_drivers();
+
+    std::string_view config{text};
+    std::optional<std::string> driver;
+    bool matches = false;
+
+    while (!config.empty()) {
+      const auto end = config.find('\n');
+      const auto line = detail::trim_hint_text(config.substr(0, end));
+      config.remove_prefix(end == std::string_view::npos ? config.size() : end + 1);
+
+      if (line == drivers) {
+        matches = true;
+      }
+      else if (line.substr(0, hint_prefix.size()) == hint_prefix) {
+        driver = std::string{detail::trim_hint_text(line.substr(hint_prefix.size()))};
+      }
+    }
+
+    if (matches && driver && !driver->empty()) {
+      return driver;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Stores a driver, along with the benchmark results.
+   *
+   * \param driver the name of the selected driver.
+   * \param scores the benchmark results, which are written as comments.
+   *
+   * \return `true` if the result was stored; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto store(const std::string& driver, const std::vector<render_driver_score>& scores) const
+      -> bool
+  {
+    std::string text = "# Generated by cen::render_driver_calibration\n";
+    text.append(drivers_prefix).append(available_drivers()).append("\n");
+
+    char buffer[128]{};
+    for (const auto& score : scores) {
+      const auto size = score.info.max_texture_size();
+      std::snprintf(buffer,
+                    sizeof buffer,
+                    "%.3f ms, %s, %dx%d max texture size",
+                    score.frame_time_ms,
+                    score.info.has_hardware_acceleration() ? "accelerated" : "software",
+                    size.width,
+                    size.height);
+      text.append("# ").append(score.name).append(": ").append(buffer).append("\n");
+    }
+
+    text.append(hint_prefix).append(" ").append(driver).append("\n");
+
+    file target{m_path, file_mode::write};
+    return target && target.write(text) == text.size();
+  }
+
+  /**
+   * \brief Sets the amount of measured frames per driver.
+   *
+   * \param count the amount of frames, which is clamped to at least one.
+   *
+   * \since 6.4.0
+   */
+  void set_frame_count(const usize count) noexcept
+  {
+    m_frameCount = (count > 0) ? count : 1;
+  }
+
+  /**
+   * \brief Returns the amount of measured frames per driver.
+   *
+   * \return the amount of frames, excluding warm-up frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto frame_count() const noexcept -> usize
+  {
+    return m_frameCount;
+  }
+
+  /**
+   * \brief Returns the path of the file that stores the result.
+   *
+   * \return the file path.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto path() const noexcept -> const std::string&
+  {
+    return m_path;
+  }
+
+  /**
+   * \brief Returns the names of the available render drivers, separated by commas.
+   *
+   * \return the available render drivers, in the order they are reported by SDL.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto available_drivers() -> std::string
+  {
+    std::string drivers;
+
+    const auto count = render_driver_count();
+    for (int index = 0; index < count; ++index) {
+      if (const auto info = get_render_driver_info(index); info && info->name) {
+        if (!drivers.empty()) {
+          drivers += ',';
+        }
+
+        drivers += info->name;
+      }
+    }
+
+    return drivers;
+  }
+
+  /**
+   * \brief Returns the name of the file that stores the result.
+   *
+   * \return the file name.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto file_name() noexcept -> const char*
+  {
+    return "render_driver.cfg";
+  }
+
+ private:
+  inline constexpr static std::string_view drivers_prefix{"# drivers = "};
+  inline constexpr static std::string_view hint_prefix{SDL_HINT_RENDER_DRIVER " ="};
+
+  inline constexpr static usize warmup_frames = 10;
+  inline constexpr static int rect_count = 1'000;
+  inline constexpr static int sprite_count = 250;
+  inline constexpr static iarea scene_size{640, 480};
+  inline constexpr static iarea sprite_size{32, 32};
+
+  std::string m_path;
+  usize m_frameCount{60};
+
+  static auto set_driver_hint(const std::string& driver, const hint_priority priority)
+      -> bool
+  {
+    return SDL_SetHintWithPriority(SDL_HINT_RENDER_DRIVER,
+                                   driver.c_str(),
+                                   static_cast<SDL_HintPriority>(priority)) == SDL_TRUE;
+  }
+
+  [[nodiscard]] auto benchmark(const int index) const -> std::optional<render_driver_score>
+  {
+    const auto driver = get_render_driver_info(index);
+    if (!driver || !driver->name) {
+      return std::nullopt;
+    }
+
+    try {
+      // Each driver gets a new window, since drivers may reconfigure it, e.g. for OpenGL
+      const window target{"Centurion render driver calibration", scene_size, window::hidden};
+
+      // No vsync, so that the frame times aren't capped by the refresh rate
+      renderer renderer{SDL_CreateRenderer(target.get(), index, 0)};
+
+      const auto info = get_info(renderer);
+      if (!info) {
+        return std::nullopt;
+      }
+
+      texture sprite{renderer, pixel_format::argb8888, texture_access::no_lock, sprite_size};
+
+      const std::vector<u32> pixels(static_cast<usize>(sprite_size.width * sprite_size.height),
+                                    0xFFFFFFFFu);
+      if (!sprite.update(std::nullopt, pixels.data(), sprite_size.width * 4)) {
+        return std::nullopt;
+      }
+
+      const auto frequency = static_cast<double>(counter::frequency());
+
+      std::vector<double> frameTimes;
+      frameTimes.reserve(m_frameCount);
+
+      for (usize frame = 0; frame < warmup_frames + m_frameCount; ++frame) {
+        const auto start = counter::now();
+        render_scene(renderer, sprite, frame);
+        const auto end = counter::now();
+
+        if (frame >= warmup_frames) {
+          frameTimes.push_back(static_cast<double>(end - start) * 1'000.0 / frequency);
+        }
+      }
+
+      // The median is robust against the occasional hiccup, e.g. a context switch
+      const auto middle = frameTimes.begin() + static_cast<std::ptrdiff_t>(m_frameCount / 2);
+      std::nth_element(frameTimes.begin(), middle, frameTimes.end());
+
+      return render_driver_score{driver->name, *info, *middle};
+    }
+    catch (const cen_error&) {
+      return std::nullopt;  // The driver isn't usable on this machine
+    }
+  }
+
+  static void render_scene(renderer& renderer, const texture& sprite, const usize frame)
+  {
+    renderer.clear_with(colors::black);
+
+    const auto offset = static_cast<int>(frame % 64);
+    for (int i = 0; i < rect_count; ++i) {
+      const auto value = static_cast<u8>(i * 7);
+      renderer.set_color(color{value, static_cast<u8>(255 - value), 128});
+      renderer.fill_rect(irect{(i * 37 + offset) % scene_size.width,
+                               (i * 53) % scene_size.height,
+                               16,
+                               16});
+    }
+
+    for (int i = 0; i < sprite_count; ++i) {
+      const auto x = (i * 41) % scene_size.width;
+      const auto y = (i * 29 + offset) % scene_size.height;
+      renderer.render(sprite, ipoint{x, y});
+    }
+
+    renderer.present();
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_DRIVER_CALIBRATION_HEADER
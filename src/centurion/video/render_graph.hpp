@@ -0,0 +1,691 @@
+#ifndef CENTURION_RENDER_GRAPH_HEADER
+#define CENTURION_RENDER_GRAPH_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>   // max, find
+#include <cassert>     // assert
+#include <functional>  // function
+#include <limits>      // numeric_limits
+#include <optional>    // optional
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../system/profiler_macros.hpp"
+#include "pixel_format.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "texture_pool.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class render_graph
+ *
+ * \brief Executes a graph of render passes, such as a post-processing chain, with
+ * automatically managed intermediate render targets.
+ *
+ * \details Each pass reads a set of input textures and renders to a single output. Outputs
+ * are either transient targets, created with `create_target()`, imported textures, or the
+ * render target that was current when the graph is executed, i.e. `backbuffer`.
+ * \code{cpp}
+ *   cen::texture_pool pool;
+ *   cen::render_graph graph{pool};
+ *
+ *   const auto scene = graph.import_texture(sceneTexture);
+ *   const auto bright = graph.create_target(size / 2);
+ *   const auto blurred = graph.create_target(size / 2);
+ *
+ *   graph.add_pass({scene}, bright, [&](const cen::render_graph::pass_inputs& in) {
+ *     extract_highlights(renderer, in[0]);
+ *   });
+ *
+ *   graph.add_pass({bright}, blurred, [&](const cen::render_graph::pass_inputs& in) {
+ *     blur(renderer, in[0]);
+ *   });
+ *
+ *   graph.add_pass({scene, blurred},
+ *                  cen::render_graph::backbuffer,
+ *                  [&](const cen::render_graph::pass_inputs& in) {
+ *                    renderer.render(in[0], cen::ipoint{0, 0});
+ *                    renderer.render(in[1], cen::irect{{0, 0}, size});
+ *                  });
+ *
+ *   // Every frame, after the scene texture has been updated
+ *   graph.invalidate(scene);
+ *   graph.execute(renderer);
+ * \endcode
+ *
+ * \details When the graph is compiled, the passes are sorted so that each pass runs after
+ * the passes that produce its inputs, regardless of the order in which they were added.
+ * Transient targets with the same size and pixel format whose lifetimes don't overlap
+ * share a single texture, and all textures are acquired from a texture pool, so a graph
+ * only needs as many textures as are simultaneously in use.
+ *
+ * \details A pass is skipped if none of its inputs changed since it last ran, and its
+ * output still holds the result of that run. Imported textures are considered changed
+ * when they are invalidated with `invalidate()`, and outputs are changed whenever their
+ * pass runs. Passes that render to the backbuffer always run. Note that a target that
+ * shares its texture with another target loses its content when the other target is
+ * rendered, so its pass can only be skipped if the other pass was skipped as well.
+ *
+ * \note The graph is compiled again by the next `execute()` call whenever a pass or
+ * resource is added. The texture pool and all imported textures must outlive the graph.
+ *
+ * \see `texture_pool`
+ *
+ * \since 6.4.0
+ */
+class render_graph final
+{
+ public:
+  using resource_id = usize;
+
+  /// The render target that is current when the graph is executed.
+  inline constexpr static resource_id backbuffer = std::numeric_limits<resource_id>::max();
+
+  /**
+   * \class pass_inputs
+   *
+   * \brief Provides access to the input textures of a pass.
+   *
+   * \since 6.4.0
+   */
+  class pass_inputs final
+  {
+   public:
+    /**
+     * \brief Returns an input texture, in the order that the inputs were declared.
+     *
+     * \param index the index of the input.
+     *
+     * \return the input texture.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto operator[](const usize index) const noexcept -> texture&
+    {
+      assert(index < m_textures.size());
+      return *m_textures[index];
+    }
+
+    /**
+     * \brief Returns the amount of inputs.
+     *
+     * \return the input count.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto size() const noexcept -> usize
+    {
+      return m_textures.size();
+    }
+
+   private:
+    std::vector<texture*> m_textures;
+
+    friend class render_graph;
+  };
+
+  /**
+   * \struct graph_stats
+   *
+   * \brief Provides statistics about the passes of the most recent execution.
+   *
+   * \since 6.4.0
+   */
+  struct graph_stats final
+  {
+    usize executed{};  ///< The amount of passes that ran.
+    usize skipped{};   ///< The amount of passes that were skipped.
+  };
+
+  using pass_type = std::function<void(const pass_inputs&)>;
+
+  /**
+   * \brief Creates an empty render graph.
+   *
+   * \param pool the texture pool that transient targets are acquired from.
+   *
+   * \since 6.4.0
+   */
+  explicit render_graph(texture_pool& pool) noexcept : m_pool{&pool}
+  {}
+
+  /**
+   * \brief Declares a transient render target, which is managed by the graph.
+   *
+   * \param size the size of the target.
+   * \param format the pixel format of the target.
+   *
+   * \return the identifier of the target.
+   *
+   * \since 6.4.0
+   */
+  auto create_target(const iarea size, const pixel_format format = pixel_format::rgba32)
+      -> resource_id
+  {
+    assert(size.width > 0 && size.height > 0);
+
+    resource res;
+    res.size = size;
+    res.format = format;
+    return add_resource(std::move(res));
+  }
+
+  /**
+   * \brief Declares a texture that is owned by the caller, e.g. a rendered scene.
+   *
+   * \details The texture must be a render target if a pass renders to it.
+   *
+   * \param texture the imported texture.
+   *
+   * \return the identifier of the texture.
+   *
+   * \since 6.4.0
+   */
+  auto import_texture(texture& texture) -> resource_id
+  {
+    resource res;
+    res.imported = &texture;
+    return add_resource(std::move(res));
+  }
+
+  /**
+   * \brief Adds a render pass.
+   *
+   * \details The function is invoked with the render target set to the output. Passes
+   * don't have to be added in the order in which they should run.
+   *
+   * \param inputs the resources that the pass reads, must not contain the output.
+   * \param output the resource that the pass renders to, which must not be the output of
+   * any other pass.
+   * \param pass the function object that renders the pass, invoked as
+   * `void(const pass_inputs&)`.
+   *
+   * \return the index of the pass.
+   *
+   * \since 6.4.0
+   */
+  auto add_pass(std::vector<resource_id> inputs, const resource_id output, pass_type pass)
+      -> usize
+  {
+    assert(pass);
+    assert(output == backbuffer || output < m_resources.size());
+    assert(std::find(inputs.begin(), inputs.end(), output) == inputs.end());
+
+    pass_data data;
+    data.inputs = std::move(inputs);
+    data.output = output;
+    data.fn = std::move(pass);
+
+    m_passes.push_back(std::move(data));
+    m_compiled = false;
+
+    return m_passes.size() - 1;
+  }
+
+  /**
+   * \brief Marks a resource as changed.
+   *
+   * \details Invalidating an imported texture causes all passes that read it to run again.
+   * Invalidating the output of a pass causes the pass itself to run again, e.g. when the
+   * content rendered by the pass changed.
+   *
+   * \param id the identifier of the resource.
+   *
+   * \since 6.4.0
+   */
+  void invalidate(const resource_id id) noexcept
+  {
+    assert(id < m_resources.size());
+
+    auto& res = m_resources[id];
+    ++res.version;
+    res.stale = true;
+  }
+
+  /**
+   * \brief Marks all resources as changed, so every pass runs during the next execution.
+   *
+   * \since 6.4.0
+   */
+  void invalidate_all() noexcept
+  {
+    for (auto& res : m_resources) {
+      ++res.version;
+      res.stale = true;
+    }
+  }
+
+  /**
+   * \brief Sorts the passes, and assigns textures to the transient targets.
+   *
+   * \details This is done automatically by `execute()` when the graph has changed.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that is used to create textures, if necessary.
+   *
+   * \throws cen_error if the graph contains a cycle, if a resource is the output of
+   * several passes, or if a transient target is read but never rendered to.
+   * \throws sdl_error if a texture cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void compile(const Renderer& renderer)
+  {
+    CENTURION_PROFILE_ZONE("render_graph::compile");
+
+    sort_passes();
+    assign_slots();
+
+    for (usize slot = 0; slot < m_slots.size(); ++slot) {
+      const auto& info = m_slotInfo[slot];
+      m_slots[slot].lease =
+          m_pool->acquire(renderer, info.format, texture_access::target, info.size);
+    }
+
+    for (auto& pass : m_passes) {
+      pass.textures.m_textures.clear();
+      for (const auto input : pass.inputs) {
+        pass.textures.m_textures.push_back(&texture_of(input));
+      }
+
+      pass.seen.assign(pass.inputs.size(), 0);
+      pass.ran = false;
+    }
+
+    m_compiled = true;
+  }
+
+  /**
+   * \brief Runs all passes whose inputs have changed, in dependency order.
+   *
+   * \details The render target that is current when this function is called is used as
+   * the backbuffer, and is restored afterwards.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return the amount of passes that ran.
+   *
+   * \throws cen_error if the graph has changed and cannot be compiled, see `compile()`.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto execute(Renderer& renderer) -> usize
+  {
+    CENTURION_PROFILE_ZONE("render_graph::execute");
+
+    if (!m_compiled) {
+      compile(renderer);
+    }
+
+    m_stats = graph_stats{};
+
+    // The target is only changed when needed, the backbuffer is current initially
+    auto previous = renderer.get_render_target();
+    bool onBackbuffer = true;
+
+    for (const auto index : m_order) {
+      auto& pass = m_passes[index];
+      if (!needs_run(pass)) {
+        ++m_stats.skipped;
+        continue;
+      }
+
+      if (pass.output != backbuffer) {
+        renderer.set_target(texture_of(pass.output));
+        onBackbuffer = false;
+      }
+      else if (!onBackbuffer) {
+        restore_target(renderer, previous);
+        onBackbuffer = true;
+      }
+
+      pass.fn(pass.textures);
+
+      for (usize input = 0; input < pass.inputs.size(); ++input) {
+        pass.seen[input] = m_resources[pass.inputs[input]].version;
+      }
+
+      pass.ran = true;
+
+      if (pass.output != backbuffer) {
+        auto& res = m_resources[pass.output];
+        ++res.version;
+        res.stale = false;
+
+        if (res.slot != no_slot) {
+          m_slots[res.slot].holder = pass.output;
+        }
+      }
+
+      ++m_stats.executed;
+    }
+
+    if (!onBackbuffer) {
+      restore_target(renderer, previous);
+    }
+
+    return m_stats.executed;
+  }
+
+  /**
+   * \brief Removes all passes and resources, and returns the textures to the pool.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_passes.clear();
+    m_resources.clear();
+    m_order.clear();
+    m_slots.clear();
+    m_slotInfo.clear();
+    m_compiled = false;
+  }
+
+  /**
+   * \brief Returns the statistics of the most recent execution.
+   *
+   * \return the pass statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto statistics() const noexcept -> const graph_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Returns the indices of the passes, in the order in which they run.
+   *
+   * \return the pass order; empty if the graph hasn't been compiled.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto order() const noexcept -> const std::vector<usize>&
+  {
+    return m_order;
+  }
+
+  /**
+   * \brief Returns the amount of textures used for the transient targets.
+   *
+   * \details This is smaller than the amount of transient targets if some of them share
+   * a texture.
+   *
+   * \return the amount of textures acquired from the pool.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto texture_count() const noexcept -> usize
+  {
+    return m_slots.size();
+  }
+
+  /**
+   * \brief Returns the amount of passes in the graph.
+   *
+   * \return the pass count.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pass_count() const noexcept -> usize
+  {
+    return m_passes.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the graph has been compiled since it last changed.
+   *
+   * \return `true` if the graph is compiled; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_compiled() const noexcept -> bool
+  {
+    return m_compiled;
+  }
+
+ private:
+  inline constexpr static usize no_slot = std::numeric_limits<usize>::max();
+  inline constexpr static usize no_pass = std::numeric_limits<usize>::max();
+  inline constexpr static resource_id no_resource = std::numeric_limits<resource_id>::max();
+
+  struct resource final
+  {
+    texture* imported{};     ///< The imported texture, null for transient targets.
+    iarea size{};            ///< The size of a transient target.
+    pixel_format format{};   ///< The pixel format of a transient target.
+    usize slot{no_slot};     ///< The index of the texture of a transient target.
+    usize producer{};        ///< The index of the pass that renders to the resource.
+    usize first{};           ///< The position of the producer in the pass order.
+    usize last{};            ///< The position of the last reader in the pass order.
+    u64 version{1};          ///< Incremented whenever the content changes.
+    bool stale{true};        ///< Indicates whether the producer must run again.
+  };
+
+  struct pass_data final
+  {
+    std::vector<resource_id> inputs;
+    resource_id output{};
+    pass_type fn;
+    pass_inputs textures;
+    std::vector<u64> seen;  ///< The input versions that were used by the latest run.
+    bool ran{};
+  };
+
+  struct slot_info final
+  {
+    iarea size{};           ///< The size of the texture.
+    pixel_format format{};  ///< The pixel format of the texture.
+    usize last{};           ///< The position of the last pass that uses the texture.
+  };
+
+  struct slot_data final
+  {
+    std::optional<texture_pool::lease> lease;
+    resource_id holder{no_resource};  ///< The resource whose content is in the texture.
+  };
+
+  texture_pool* m_pool{};
+  std::vector<resource> m_resources;
+  std::vector<pass_data> m_passes;
+  std::vector<usize> m_order;
+  std::vector<slot_data> m_slots;
+  std::vector<slot_info> m_slotInfo;
+  graph_stats m_stats;
+  bool m_compiled{};
+
+  auto add_resource(resource&& res) -> resource_id
+  {
+    m_resources.push_back(std::move(res));
+    m_compiled = false;
+    return m_resources.size() - 1;
+  }
+
+  [[nodiscard]] auto texture_of(const resource_id id) noexcept -> texture&
+  {
+    auto& res = m_resources[id];
+    if (res.imported) {
+      return *res.imported;
+    }
+
+    assert(res.slot < m_slots.size());
+    return m_slots[res.slot].lease->get();
+  }
+
+  [[nodiscard]] auto needs_run(const pass_data& pass) const noexcept -> bool
+  {
+    if (!pass.ran || pass.output == backbuffer) {
+      return true;
+    }
+
+    const auto& output = m_resources[pass.output];
+    if (output.stale) {
+      return true;
+    }
+
+    // The texture might have been used by another target since the pass last ran
+    if (output.slot != no_slot && m_slots[output.slot].holder != pass.output) {
+      return true;
+    }
+
+    for (usize input = 0; input < pass.inputs.size(); ++input) {
+      if (m_resources[pass.inputs[input]].version != pass.seen[input]) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  void sort_passes()
+  {
+    for (auto& res : m_resources) {
+      res.producer = no_pass;
+    }
+
+    for (usize index = 0; index < m_passes.size(); ++index) {
+      const auto output = m_passes[index].output;
+      if (output == backbuffer) {
+        continue;
+      }
+
+      auto& res = m_resources[output];
+      if (res.producer != no_pass) {
+        throw cen_error{"Render graph resource is the output of several passes!"};
+      }
+
+      res.producer = index;
+    }
+
+    // Kahn's algorithm, which picks the earliest added pass whenever there is a choice
+    std::vector<usize> pending(m_passes.size(), 0);
+    for (usize index = 0; index < m_passes.size(); ++index) {
+      for (const auto input : m_passes[index].inputs) {
+        assert(input < m_resources.size());
+
+        const auto& res = m_resources[input];
+        if (res.producer != no_pass) {
+          ++pending[index];
+        }
+        else if (!res.imported) {
+          throw cen_error{"Render graph target is read but never rendered to!"};
+        }
+      }
+    }
+
+    m_order.clear();
+    std::vector<bool> done(m_passes.size(), false);
+
+    while (m_order.size() < m_passes.size()) {
+      usize next = no_pass;
+      for (usize index = 0; index < m_passes.size(); ++index) {
+        if (!done[index] && pending[index] == 0) {
+          next = index;
+          break;
+        }
+      }
+
+      if (next == no_pass) {
+        throw cen_error{"Render graph contains a cycle!"};
+      }
+
+      done[next] = true;
+      m_order.push_back(next);
+
+      const auto output = m_passes[next].output;
+      for (usize index = 0; index < m_passes.size(); ++index) {
+        for (const auto input : m_passes[index].inputs) {
+          if (input == output) {
+            --pending[index];
+          }
+        }
+      }
+    }
+  }
+
+  void assign_slots()
+  {
+    for (auto& res : m_resources) {
+      res.slot = no_slot;
+    }
+
+    for (usize position = 0; position < m_order.size(); ++position) {
+      const auto& pass = m_passes[m_order[position]];
+
+      if (pass.output != backbuffer) {
+        auto& res = m_resources[pass.output];
+        res.first = position;
+        res.last = position;
+      }
+
+      for (const auto input : pass.inputs) {
+        auto& res = m_resources[input];
+        res.last = std::max(res.last, position);
+      }
+    }
+
+    // Targets are visited in the order in which they are produced, and reuse any texture
+    // with a matching size and format that is no longer in use
+    std::vector<slot_info> slots;
+    for (const auto index : m_order) {
+      const auto output = m_passes[index].output;
+      if (output == backbuffer || m_resources[output].imported) {
+        continue;
+      }
+
+      auto& res = m_resources[output];
+      for (usize slot = 0; slot < slots.size(); ++slot) {
+        if (slots[slot].last < res.first && slots[slot].size == res.size &&
+            slots[slot].format == res.format) {
+          res.slot = slot;
+          break;
+        }
+      }
+
+      if (res.slot == no_slot) {
+        res.slot = slots.size();
+        slots.push_back(slot_info{res.size, res.format, res.last});
+      }
+      else {
+        slots[res.slot].last = res.last;
+      }
+    }
+
+    // The old leases are returned first, so that the pool hands the same textures out again
+    m_slots.clear();
+    m_slots.resize(slots.size());
+    m_slotInfo = std::move(slots);
+  }
+
+  template <typename Renderer, typename Target>
+  static void restore_target(Renderer& renderer, Target& previous) noexcept
+  {
+    if (previous) {
+      renderer.set_target(previous);
+    }
+    else {
+      renderer.reset_target();
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_GRAPH_HEADER
@@ -0,0 +1,395 @@
+#ifndef CENTURION_RENDER_QUEUE_HEADER
+#define CENTURION_RENDER_QUEUE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>      // find, min
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "blend_mode.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct render_queue_stats
+ *
+ * \brief Provides statistics about the most recent flush of a render queue.
+ *
+ * \since 6.4.0
+ */
+struct render_queue_stats final
+{
+  usize submitted{};       ///< The amount of submitted entries.
+  usize culled{};          ///< The amount of entries outside of the viewport.
+  usize drawn{};           ///< The amount of rendered entries.
+  usize textureChanges{};  ///< The amount of times the rendered texture changed.
+  usize blendChanges{};    ///< The amount of times the blend mode changed.
+};
+
+/**
+ * \class render_queue
+ *
+ * \brief Collects textured draws and renders them sorted by layer, in an order that
+ * minimizes the amount of texture and blend mode changes.
+ *
+ * \details Each entry is submitted with a layer and a depth. When the queue is flushed,
+ * entries are rendered in ascending order of their layer, then their depth. Entries that
+ * share a layer and depth are grouped by blend mode and texture, so that the amount of
+ * state changes is minimized, but are otherwise rendered in submission order. As such, a
+ * depth of zero should be used for entries whose relative order doesn't matter.
+ * \code{cpp}
+ *   cen::render_queue queue;
+ *
+ *   queue.submit(background, 0, sky, skyDestination);
+ *   for (const auto& sprite : sprites) {
+ *     queue.submit(entities, sprite.depth, atlas, sprite.source, sprite.destination);
+ *   }
+ *
+ *   queue.flush(renderer);
+ * \endcode
+ *
+ * \details Entries whose destination lies outside of the current viewport are dropped
+ * before reaching SDL. The entries are sorted with a radix sort over 64-bit keys, so
+ * flushing is linear in the amount of entries.
+ *
+ * \details The internal buffers keep their capacity between flushes, so a queue that is
+ * used every frame stops allocating once it has grown large enough.
+ *
+ * \details The blend modes of the entries are applied to their textures while the queue
+ * is flushed, and each texture has its previous blend mode restored afterwards.
+ *
+ * \note The textures must outlive the flush of the queue.
+ *
+ * \see `render_queue_stats`
+ * \see `sprite_batch`
+ *
+ * \since 6.4.0
+ */
+class render_queue final
+{
+ public:
+  using layer_type = u16;
+  using depth_type = u16;
+
+  /**
+   * \brief Submits a draw of part of a texture.
+   *
+   * \details The blend mode of the texture is captured when the entry is submitted, and is
+   * applied to the texture when the queue is flushed.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param layer the layer of the entry, lower layers are rendered first.
+   * \param depth the depth of the entry within its layer, lower depths are rendered first.
+   * \param texture the texture that will be rendered.
+   * \param source the area of the texture that will be rendered.
+   * \param destination the area of the rendering target that the entry will cover.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void submit(const layer_type layer,
+              const depth_type depth,
+              const basic_texture<T>& texture,
+              const irect& source,
+              const frect& destination)
+  {
+    submit(layer, depth, texture, source, destination, texture.get_blend_mode());
+  }
+
+  /**
+   * \brief Submits a draw of part of a texture, with an explicit blend mode.
+   *
+   * \details This avoids querying the blend mode of the texture.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param layer the layer of the entry, lower layers are rendered first.
+   * \param depth the depth of the entry within its layer, lower depths are rendered first.
+   * \param texture the texture that will be rendered.
+   * \param source the area of the texture that will be rendered.
+   * \param destination the area of the rendering target that the entry will cover.
+   * \param mode the blend mode that the texture will be rendered with.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void submit(const layer_type layer,
+              const depth_type depth,
+              const basic_texture<T>& texture,
+              const irect& source,
+              const frect& destination,
+              const blend_mode mode)
+  {
+    m_entries.push_back({texture.get(), mode, source, destination, layer, depth});
+  }
+
+  /**
+   * \brief Submits a draw of an entire texture.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param layer the layer of the entry, lower layers are rendered first.
+   * \param depth the depth of the entry within its layer, lower depths are rendered first.
+   * \param texture the texture that will be rendered.
+   * \param destination the area of the rendering target that the entry will cover.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void submit(const layer_type layer,
+              const depth_type depth,
+              const basic_texture<T>& texture,
+              const frect& destination)
+  {
+    submit(layer, depth, texture, irect{{0, 0}, texture.size()}, destination);
+  }
+
+  /**
+   * \brief Renders all entries in the queue and clears the queue.
+   *
+   * \details Entries that are outside of the current viewport of the renderer are culled.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if all visible entries were rendered, and all blend modes were
+   * applied and restored; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto flush(Renderer& renderer) -> result
+  {
+    CENTURION_PROFILE_ZONE("render_queue::flush");
+    return flush(renderer, fpoint{});
+  }
+
+  /**
+   * \brief Renders all entries in the queue, translated by the translation viewport of
+   * the renderer, and clears the queue.
+   *
+   * \details The destinations of the entries are treated as world coordinates, like with
+   * the `_t` rendering functions of the renderer, and entries that aren't visible after
+   * being translated are culled.
+   *
+   * \tparam Renderer the type of the renderer, which must be an owning renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if all visible entries were rendered, and all blend modes were
+   * applied and restored; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto flush_t(Renderer& renderer) -> result
+  {
+    CENTURION_PROFILE_ZONE("render_queue::flush_t");
+    return flush(renderer, renderer.translation_viewport().position());
+  }
+
+  /**
+   * \brief Removes all entries from the queue, without rendering them.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_entries.clear();
+  }
+
+  /**
+   * \brief Reserves memory for a number of entries.
+   *
+   * \param count the amount of entries to reserve memory for.
+   *
+   * \since 6.4.0
+   */
+  void reserve(const usize count)
+  {
+    m_entries.reserve(count);
+    m_items.reserve(count);
+    m_scratch.reserve(count);
+  }
+
+  /**
+   * \brief Returns the amount of entries in the queue.
+   *
+   * \return the number of entries that haven't been flushed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the queue contains any entries.
+   *
+   * \return `true` if the queue is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_entries.empty();
+  }
+
+  /**
+   * \brief Returns statistics about the most recent flush.
+   *
+   * \return the statistics of the last flush.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> const render_queue_stats&
+  {
+    return m_stats;
+  }
+
+ private:
+  struct entry final
+  {
+    SDL_Texture* texture{};
+    blend_mode blend{};
+    irect source;
+    frect destination;
+    layer_type layer{};
+    depth_type depth{};
+  };
+
+  // Sorting keys with indices is cheaper than moving the entries around
+  struct sort_item final
+  {
+    u64 key{};
+    u32 index{};
+  };
+
+  inline constexpr static u64 max_texture_id = 0xFF'FFFF;
+  inline constexpr static u64 max_blend_id = 0xFF;
+
+  std::vector<entry> m_entries;
+  std::vector<sort_item> m_items;
+  std::vector<sort_item> m_scratch;
+  std::unordered_map<SDL_Texture*, u64> m_textureIds;
+  std::vector<SDL_BlendMode> m_restoredModes;  ///< The original blend modes, by texture ID.
+  std::vector<blend_mode> m_blendModes;
+  render_queue_stats m_stats;
+
+  template <typename Renderer>
+  auto flush(Renderer& renderer, const fpoint offset) -> result
+  {
+    m_stats = render_queue_stats{};
+    m_stats.submitted = m_entries.size();
+
+    const auto viewport = renderer.viewport();
+    const auto width = static_cast<float>(viewport.width());
+    const auto height = static_cast<float>(viewport.height());
+
+    m_items.clear();
+    m_textureIds.clear();
+    m_restoredModes.clear();
+    m_blendModes.clear();
+
+    for (usize index = 0; index < m_entries.size(); ++index) {
+      auto& entry = m_entries[index];
+      entry.destination.set_position(entry.destination.position() - offset);
+
+      const auto& dst = entry.destination;
+      if (dst.x() >= width || dst.y() >= height || dst.max_x() <= 0 || dst.max_y() <= 0) {
+        ++m_stats.culled;
+        continue;
+      }
+
+      m_items.push_back({make_key(entry), static_cast<u32>(index)});
+    }
+
+    detail::radix_sort(m_items, m_scratch, [](const sort_item& item) { return item.key; });
+
+    bool ok = true;
+
+    SDL_Texture* texture = nullptr;
+    auto blend = blend_mode::none;
+    bool first = true;
+
+    for (const auto& item : m_items) {
+      const auto& entry = m_entries[item.index];
+
+      const auto textureChanged = first || entry.texture != texture;
+      const auto blendChanged = first || entry.blend != blend;
+
+      if (textureChanged || blendChanged) {
+        const auto mode = static_cast<SDL_BlendMode>(entry.blend);
+        if (SDL_SetTextureBlendMode(entry.texture, mode) != 0) {
+          ok = false;
+        }
+
+        m_stats.textureChanges += textureChanged ? 1u : 0u;
+        m_stats.blendChanges += blendChanged ? 1u : 0u;
+
+        texture = entry.texture;
+        blend = entry.blend;
+        first = false;
+      }
+
+      if (!renderer.render(texture_handle{entry.texture}, entry.source, entry.destination)) {
+        ok = false;
+      }
+
+      ++m_stats.drawn;
+    }
+
+    for (const auto& [handle, id] : m_textureIds) {
+      if (SDL_SetTextureBlendMode(handle, m_restoredModes[id]) != 0) {
+        ok = false;
+      }
+    }
+
+    clear();
+
+    return ok;
+  }
+
+  // Layer (16 bits), depth (16 bits), blend mode (8 bits) and texture (24 bits)
+  [[nodiscard]] auto make_key(const entry& entry) -> u64
+  {
+    const auto [it, inserted] = m_textureIds.try_emplace(entry.texture, m_textureIds.size());
+    if (inserted) {
+      auto mode = SDL_BLENDMODE_NONE;
+      SDL_GetTextureBlendMode(entry.texture, &mode);
+      m_restoredModes.push_back(mode);
+    }
+
+    const auto textureId = it->second;
+
+    auto blendId = static_cast<u64>(
+        std::find(m_blendModes.begin(), m_blendModes.end(), entry.blend) -
+        m_blendModes.begin());
+    if (blendId == m_blendModes.size()) {
+      m_blendModes.push_back(entry.blend);
+    }
+
+    return static_cast<u64>(entry.layer) << 48u | static_cast<u64>(entry.depth) << 32u |
+           std::min(blendId, max_blend_id) << 24u | std::min(textureId, max_texture_id);
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_QUEUE_HEADER
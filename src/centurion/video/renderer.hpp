@@ -3,17 +3,19 @@
 
 #include <SDL2/SDL.h>
 
-#include <cassert>        // assert
-#include <cmath>          // floor, sqrt
-#include <memory>         // unique_ptr
-#include <optional>       // optional
-#include <ostream>        // ostream
-#include <string>         // string
-#include <type_traits>    // conditional_t
-#include <unordered_map>  // unordered_map
-#include <utility>        // move, forward, pair
+#include <array>        // array
+#include <cassert>      // assert
+#include <cmath>        // floor, sqrt
+#include <memory>       // unique_ptr
+#include <optional>     // optional
+#include <ostream>      // ostream
+#include <string>       // string
+#include <string_view>  // string_view
+#include <type_traits>  // conditional_t
+#include <utility>      // move, forward, pair, as_const
 
 #include "../compiler/features.hpp"
+#include "../compiler/linkage.hpp"
 
 #if CENTURION_HAS_FEATURE_FORMAT
 
@@ -21,23 +23,44 @@
 
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
+#if CENTURION_HAS_FEATURE_SPAN
+
+#include <span>  // span
+
+#endif  // CENTURION_HAS_FEATURE_SPAN
+
 #include "../core/integers.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
 #include "../core/str.hpp"
+#include "../core/time.hpp"
 #include "../detail/address_of.hpp"
 #include "../detail/convert_bool.hpp"
 #include "../detail/owner_handle_api.hpp"
 #include "../math/rect.hpp"
+#include "../system/allocation_tracker.hpp"
+#include "../system/counter.hpp"
+#include "../system/input_latency_tracker.hpp"
+#include "../system/profiler_macros.hpp"
+#include "../system/startup_tracer.hpp"
+#include "../thread/deadline.hpp"
 #include "blend_mode.hpp"
 #include "color.hpp"
 #include "colors.hpp"
 #include "font.hpp"
 #include "font_cache.hpp"
+#include "font_pool.hpp"
+#include "geometry_batch.hpp"
+#include "rich_text.hpp"
+#include "sdf_text_batch.hpp"
 #include "surface.hpp"
+#include "text_batch.hpp"
+#include "text_layout.hpp"
 #include "texture.hpp"
 #include "unicode_string.hpp"
+#include "vertex_buffer.hpp"
+#include "vsync_mode.hpp"
 
 namespace cen {
 
@@ -47,6 +70,66 @@ namespace cen {
 template <typename T>
 class basic_renderer;
 
+/**
+ * \struct render_state_stats
+ *
+ * \brief Provides the amount of redundant state changes that were elided by a renderer.
+ *
+ * \see `basic_renderer::set_state_caching()`
+ *
+ * \since 6.4.0
+ */
+struct render_state_stats final
+{
+  usize colors{};      ///< The amount of elided color changes.
+  usize blendModes{};  ///< The amount of elided blend mode changes.
+  usize targets{};     ///< The amount of elided render target changes.
+  usize clips{};       ///< The amount of elided clip changes.
+  usize viewports{};   ///< The amount of elided viewport changes.
+};
+
+/**
+ * \struct render_stats
+ *
+ * \brief Provides the amount of rendering work that a renderer has forwarded to SDL.
+ *
+ * \details Primitives are counted as textured quads, rectangles, line segments, points or
+ * triangles, depending on the function that submitted them.
+ *
+ * \see `basic_renderer::set_stats_collection()`
+ *
+ * \since 6.4.0
+ */
+struct render_stats final
+{
+  usize drawCalls{};        ///< The amount of SDL rendering calls.
+  usize primitives{};       ///< The amount of submitted primitives.
+  usize textureSwitches{};  ///< The amount of times a different texture was rendered.
+  usize stateChanges{};     ///< The amount of state changes, including target changes.
+  usize targetChanges{};    ///< The amount of render target changes.
+  usize uploadedBytes{};    ///< The amount of pixel data uploaded to textures.
+};
+
+/**
+ * \struct present_timing
+ *
+ * \brief Provides the timing of the latest frame presented by a renderer.
+ *
+ * \details The time spent in `basic_renderer::present()` is mostly spent waiting for VSync,
+ * so it reveals how much of the frame interval is left for rendering.
+ *
+ * \see `basic_renderer::get_present_timing()`
+ *
+ * \since 6.4.0
+ */
+struct present_timing final
+{
+  u64 timestamp{};              ///< The value of `counter::now()` after the latest present.
+  nanoseconds<u64> blocked{};   ///< The duration of the latest present.
+  nanoseconds<u64> interval{};  ///< The time between the two latest presents.
+  u64 presents{};               ///< The amount of presented frames.
+};
+
 /**
  * \typedef renderer
  *
@@ -161,8 +244,12 @@ class basic_renderer final
    */
   template <typename Window, typename TT = T, detail::is_owner<TT> = 0>
   explicit basic_renderer(const Window& window, const u32 flags = default_flags())
-      : m_renderer{SDL_CreateRenderer(window.get(), -1, flags)}
+      : m_renderer{create(window.get(), flags)}
   {
+#if CENTURION_HAS_FEATURE_HEADLESS
+    static_assert(!detail::is_owning<TT>(), "Renderers are not available in headless builds!");
+#endif  // CENTURION_HAS_FEATURE_HEADLESS
+
     if (!get()) {
       throw sdl_error{};
     }
@@ -184,6 +271,7 @@ class basic_renderer final
    */
   auto clear() noexcept -> result
   {
+    count_draw(1);
     return SDL_RenderClear(get()) == 0;
   }
 
@@ -212,7 +300,108 @@ class basic_renderer final
    */
   void present() noexcept
   {
-    SDL_RenderPresent(get());
+    CENTURION_PROFILE_ZONE("renderer::present");
+
+    if constexpr (detail::is_owning<T>()) {
+      const auto before = counter::now();
+      SDL_RenderPresent(get());
+      const auto after = counter::now();
+
+      startup_tracer::record_present(before, after);
+      input_latency_tracker::record_present(after);
+
+      auto& timing = m_renderer.timing;
+      timing.blocked = deadline::from_counter_ticks(after - before);
+      timing.interval = (timing.presents != 0)
+                            ? deadline::from_counter_ticks(after - timing.timestamp)
+                            : nanoseconds<u64>::zero();
+      timing.timestamp = after;
+      ++timing.presents;
+
+      auto& stats = m_renderer.stats;
+      if (stats.enabled) {
+        stats.frame = stats.current;
+        stats.current = render_stats{};
+        stats.texture = nullptr;
+      }
+    }
+    else {
+      SDL_RenderPresent(get());
+    }
+  }
+
+  /**
+   * \brief Returns the timing of the latest call to `present()`.
+   *
+   * \details This can be used to implement latency reduction, e.g. by delaying input
+   * handling until just before the expected next present, or to detect missed refreshes
+   * when the interval exceeds the refresh period.
+   *
+   * \return the present timing; zero-initialized if nothing has been presented.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto get_present_timing() const noexcept -> const present_timing&
+  {
+    return m_renderer.timing;
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Changes whether or not presentation is synchronized with display refreshes.
+   *
+   * \details Adaptive VSync is only supported by the OpenGL-based renderers, where it
+   * depends on the `EXT_swap_control_tear` extension. If adaptive VSync is unavailable,
+   * VSync remains enabled and `failure` is returned.
+   *
+   * \note With older versions of SDL, VSync can only be chosen when a renderer is
+   * created, see `renderer_flags::vsync`.
+   *
+   * \param mode the VSync mode that will be used.
+   *
+   * \return `success` if the VSync mode was applied; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto set_vsync(const vsync_mode mode) noexcept -> result
+  {
+    if (SDL_RenderSetVSync(get(), (mode == vsync_mode::off) ? 0 : 1) != 0) {
+      return failure;
+    }
+
+    if (mode == vsync_mode::adaptive) {
+      // SDL2 only toggles VSync, but the OpenGL context of the renderer is now current
+      SDL_RendererInfo info{};
+      if (SDL_GetRendererInfo(get(), &info) != 0 || !info.name ||
+          std::string_view{info.name}.substr(0, 6) != "opengl") {
+        return failure;
+      }
+
+      return SDL_GL_SetSwapInterval(-1) == 0;
+    }
+
+    return success;
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Indicates whether or not presentation is synchronized with display refreshes.
+   *
+   * \return `true` if VSync is enabled, including adaptive VSync; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_vsync_enabled() const noexcept -> bool
+  {
+    SDL_RendererInfo info{};
+    if (SDL_GetRendererInfo(get(), &info) != 0) {
+      return false;
+    }
+
+    return info.flags & SDL_RENDERER_PRESENTVSYNC;
   }
 
   /**
@@ -245,6 +434,39 @@ class basic_renderer final
     return image;
   }
 
+  /**
+   * \brief Captures a snapshot of the current rendering target into an existing surface.
+   *
+   * \details Unlike the other overload, this function doesn't allocate a new surface,
+   * which makes it suitable for capturing frames repeatedly. The pixels are converted to
+   * the pixel format of the supplied surface.
+   *
+   * \tparam U the ownership semantics of the surface.
+   *
+   * \param target the surface that will receive the pixel data, must have the same size
+   * as the output of the renderer.
+   *
+   * \return `success` if the pixels were successfully captured; `failure` otherwise.
+   *
+   * \see `frame_recorder`
+   *
+   * \since 6.4.0
+   */
+  template <typename U>
+  auto capture(basic_surface<U>& target) const noexcept -> result
+  {
+    if (target.size() != output_size() || !target.lock()) {
+      return failure;
+    }
+
+    const auto format = target.get()->format->format;
+    const auto ok =
+        SDL_RenderReadPixels(get(), nullptr, format, target.pixels(), target.pitch()) == 0;
+
+    target.unlock();
+    return ok;
+  }
+
   /// \name Primitive rendering
   /// \{
 
@@ -294,6 +516,8 @@ class basic_renderer final
   template <typename U>
   auto draw_rect(const basic_rect<U>& rect) noexcept -> result
   {
+    count_draw(1);
+
     if constexpr (basic_rect<U>::isIntegral) {
       return SDL_RenderDrawRect(get(), rect.data()) == 0;
     }
@@ -316,6 +540,8 @@ class basic_renderer final
   template <typename U>
   auto fill_rect(const basic_rect<U>& rect) noexcept -> result
   {
+    count_draw(1);
+
     if constexpr (basic_rect<U>::isIntegral) {
       return SDL_RenderFillRect(get(), rect.data()) == 0;
     }
@@ -324,6 +550,88 @@ class basic_renderer final
     }
   }
 
+  /**
+   * \brief Renders the outlines of a collection of rectangles.
+   *
+   * \details All rectangles are submitted with a single call, which is considerably faster
+   * than calling `draw_rect()` for each rectangle.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store its elements contiguously, such as
+   * `std::vector` or `std::array`.
+   *
+   * \param container the container that holds the rectangles that will be rendered.
+   *
+   * \return `success` if the rectangles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto draw_rects(const Container& container) noexcept -> result
+  {
+    using rect_t = typename Container::value_type;  // a rectangle of int or float
+    using value_t = typename rect_t::value_type;    // either int or float
+
+    if (!container.empty()) {
+      const auto* first = container.front().data();
+
+      count_draw(container.size());
+
+      if constexpr (std::is_same_v<value_t, int>) {
+        return SDL_RenderDrawRects(get(), first, isize(container)) == 0;
+      }
+      else {
+        return SDL_RenderDrawRectsF(get(), first, isize(container)) == 0;
+      }
+    }
+    else {
+      return failure;
+    }
+  }
+
+  /**
+   * \brief Renders a collection of filled rectangles.
+   *
+   * \details All rectangles are submitted with a single call, which is considerably faster
+   * than calling `fill_rect()` for each rectangle.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store its elements contiguously, such as
+   * `std::vector` or `std::array`.
+   *
+   * \param container the container that holds the rectangles that will be rendered.
+   *
+   * \return `success` if the rectangles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto fill_rects(const Container& container) noexcept -> result
+  {
+    using rect_t = typename Container::value_type;  // a rectangle of int or float
+    using value_t = typename rect_t::value_type;    // either int or float
+
+    if (!container.empty()) {
+      const auto* first = container.front().data();
+
+      count_draw(container.size());
+
+      if constexpr (std::is_same_v<value_t, int>) {
+        return SDL_RenderFillRects(get(), first, isize(container)) == 0;
+      }
+      else {
+        return SDL_RenderFillRectsF(get(), first, isize(container)) == 0;
+      }
+    }
+    else {
+      return failure;
+    }
+  }
+
   /**
    * \brief Renders a line between the supplied points, in the currently selected color.
    *
@@ -339,6 +647,8 @@ class basic_renderer final
   template <typename U>
   auto draw_line(const basic_point<U>& start, const basic_point<U>& end) noexcept -> result
   {
+    count_draw(1);
+
     if constexpr (basic_point<U>::isIntegral) {
       return SDL_RenderDrawLine(get(), start.x(), start.y(), end.x(), end.y()) == 0;
     }
@@ -378,6 +688,8 @@ class basic_renderer final
       const auto& front = container.front();
       const auto* first = front.data();
 
+      count_draw(container.size() - 1);
+
       if constexpr (std::is_same_v<value_t, int>) {
         return SDL_RenderDrawLines(get(), first, isize(container)) == 0;
       }
@@ -404,6 +716,8 @@ class basic_renderer final
   template <typename U>
   auto draw_point(const basic_point<U>& point) noexcept -> result
   {
+    count_draw(1);
+
     if constexpr (basic_point<U>::isIntegral) {
       return SDL_RenderDrawPoint(get(), point.x(), point.y()) == 0;
     }
@@ -412,6 +726,47 @@ class basic_renderer final
     }
   }
 
+  /**
+   * \brief Renders a collection of points.
+   *
+   * \details All points are submitted with a single call, which is considerably faster
+   * than calling `draw_point()` for each point.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store its elements contiguously, such as
+   * `std::vector` or `std::array`.
+   *
+   * \param container the container that holds the points that will be rendered.
+   *
+   * \return `success` if the points were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  auto draw_points(const Container& container) noexcept -> result
+  {
+    using point_t = typename Container::value_type;  // a point of int or float
+    using value_t = typename point_t::value_type;    // either int or float
+
+    if (!container.empty()) {
+      const auto* first = container.front().data();
+
+      count_draw(container.size());
+
+      if constexpr (std::is_same_v<value_t, int>) {
+        return SDL_RenderDrawPoints(get(), first, isize(container)) == 0;
+      }
+      else {
+        return SDL_RenderDrawPointsF(get(), first, isize(container)) == 0;
+      }
+    }
+    else {
+      return failure;
+    }
+  }
+
   /**
    * \brief Renders a circle using the currently selected color.
    *
@@ -427,6 +782,21 @@ class basic_renderer final
   {
     using value_t = typename basic_point<U>::value_type;
 
+    // The points are collected in chunks, to avoid one SDL call for each point
+    std::array<SDL_FPoint, chunk_size> points;
+    usize count = 0;
+
+    const auto add = [&](const float px, const float py) noexcept {
+      // Preserves the truncation of the point coordinates for integral points
+      points[count] = {static_cast<float>(static_cast<value_t>(px)),
+                       static_cast<float>(static_cast<value_t>(py))};
+      if (++count == points.size()) {
+        count_draw(count);
+        SDL_RenderDrawPointsF(get(), points.data(), static_cast<int>(count));
+        count = 0;
+      }
+    };
+
     auto error = -radius;
     auto x = radius - 0.5f;
     auto y = 0.5f;
@@ -435,22 +805,22 @@ class basic_renderer final
     const auto cy = static_cast<float>(position.y()) - 0.5f;
 
     while (x >= y) {
-      draw_point<value_t>({static_cast<value_t>(cx + x), static_cast<value_t>(cy + y)});
-      draw_point<value_t>({static_cast<value_t>(cx + y), static_cast<value_t>(cy + x)});
+      add(cx + x, cy + y);
+      add(cx + y, cy + x);
 
       if (x != 0) {
-        draw_point<value_t>({static_cast<value_t>(cx - x), static_cast<value_t>(cy + y)});
-        draw_point<value_t>({static_cast<value_t>(cx + y), static_cast<value_t>(cy - x)});
+        add(cx - x, cy + y);
+        add(cx + y, cy - x);
       }
 
       if (y != 0) {
-        draw_point<value_t>({static_cast<value_t>(cx + x), static_cast<value_t>(cy - y)});
-        draw_point<value_t>({static_cast<value_t>(cx - y), static_cast<value_t>(cy + x)});
+        add(cx + x, cy - y);
+        add(cx - y, cy + x);
       }
 
       if (x != 0 && y != 0) {
-        draw_point<value_t>({static_cast<value_t>(cx - x), static_cast<value_t>(cy - y)});
-        draw_point<value_t>({static_cast<value_t>(cx - y), static_cast<value_t>(cy - x)});
+        add(cx - x, cy - y);
+        add(cx - y, cy - x);
       }
 
       error += y;
@@ -463,12 +833,20 @@ class basic_renderer final
         error -= x;
       }
     }
+
+    if (count != 0) {
+      count_draw(count);
+      SDL_RenderDrawPointsF(get(), points.data(), static_cast<int>(count));
+    }
   }
 
   /**
-   * \brief Renders a filled circle using the currently selected color.
+   * \brief Renders a filled circle with the currently selected color.
    *
-   * \param center the position of the rendered circle.
+   * \details The circle is rendered as a set of horizontal spans, that are submitted as
+   * filled rectangles in chunks, rather than with one SDL call per span.
+   *
+   * \param center the center of the rendered circle.
    * \param radius the radius of the rendered circle.
    *
    * \since 6.0.0
@@ -478,13 +856,264 @@ class basic_renderer final
     const auto cx = center.x();
     const auto cy = center.y();
 
+    std::array<SDL_FRect, chunk_size> spans;
+    usize count = 0;
+
     for (auto dy = 1.0f; dy <= radius; dy += 1.0f) {
       const auto dx = std::floor(std::sqrt((2.0f * radius * dy) - (dy * dy)));
-      draw_line<float>({cx - dx, cy + dy - radius}, {cx + dx, cy + dy - radius});
-      draw_line<float>({cx - dx, cy - dy + radius}, {cx + dx, cy - dy + radius});
+      const auto width = (2.0f * dx) + 1.0f;
+
+      spans[count++] = {cx - dx, cy + dy - radius, width, 1.0f};
+      spans[count++] = {cx - dx, cy - dy + radius, width, 1.0f};
+
+      if (count == spans.size()) {
+        count_draw(count);
+        SDL_RenderFillRectsF(get(), spans.data(), static_cast<int>(count));
+        count = 0;
+      }
+    }
+
+    if (count != 0) {
+      count_draw(count);
+      SDL_RenderFillRectsF(get(), spans.data(), static_cast<int>(count));
     }
   }
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Renders all shapes in a geometry batch.
+   *
+   * \details All triangles in the batch are submitted with a single `SDL_RenderGeometry`
+   * call. The batch isn't modified, so batches of static shapes can be rendered repeatedly.
+   *
+   * \param batch the geometry batch that will be rendered.
+   *
+   * \return `success` if the shapes were rendered; `failure` otherwise.
+   *
+   * \see `geometry_batch`
+   *
+   * \since 6.4.0
+   */
+  auto render_geometry(const geometry_batch& batch) noexcept -> result
+  {
+    CENTURION_PROFILE_ZONE("renderer::render_geometry");
+
+    if (batch.empty()) {
+      return success;
+    }
+
+    const auto& vertices = batch.vertices();
+    const auto& indices = batch.indices();
+
+    count_draw(batch.triangle_count());
+    return SDL_RenderGeometry(get(),
+                              nullptr,
+                              vertices.data(),
+                              isize(vertices),
+                              indices.data(),
+                              isize(indices)) == 0;
+  }
+
+  /**
+   * \brief Renders the colored triangles in a vertex buffer.
+   *
+   * \details All triangles are submitted with a single `SDL_RenderGeometry` call.
+   *
+   * \param buffer the vertex buffer that will be rendered.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \see `vertex_buffer`
+   *
+   * \since 6.4.0
+   */
+  auto render_geometry(const vertex_buffer& buffer) noexcept -> result
+  {
+    const auto& vertices = buffer.vertices();
+    const auto& indices = buffer.indices();
+    return submit_geometry(nullptr,
+                           vertices.data(),
+                           vertices.size(),
+                           indices.data(),
+                           indices.size());
+  }
+
+  /**
+   * \brief Renders the textured triangles in a vertex buffer.
+   *
+   * \details All triangles are submitted with a single `SDL_RenderGeometry` call.
+   *
+   * \tparam U the ownership semantics of the texture.
+   *
+   * \param texture the texture that is mapped onto the triangles.
+   * \param buffer the vertex buffer that will be rendered.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \see `vertex_buffer`
+   *
+   * \since 6.4.0
+   */
+  template <typename U>
+  auto render_geometry(const basic_texture<U>& texture, const vertex_buffer& buffer) noexcept
+      -> result
+  {
+    const auto& vertices = buffer.vertices();
+    const auto& indices = buffer.indices();
+    return submit_geometry(texture.get(),
+                           vertices.data(),
+                           vertices.size(),
+                           indices.data(),
+                           indices.size());
+  }
+
+  /**
+   * \brief Renders colored triangles.
+   *
+   * \param vertices the vertices of the triangles.
+   * \param vertexCount the amount of vertices.
+   * \param indices the vertex indices, three for each triangle; null if the triangles are
+   * described by consecutive triples of vertices.
+   * \param indexCount the amount of indices.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto render_geometry(const vertex* vertices,
+                       const usize vertexCount,
+                       const int* indices = nullptr,
+                       const usize indexCount = 0) noexcept -> result
+  {
+    return submit_geometry(nullptr, vertices, vertexCount, indices, indexCount);
+  }
+
+  /**
+   * \brief Renders textured triangles.
+   *
+   * \tparam U the ownership semantics of the texture.
+   *
+   * \param texture the texture that is mapped onto the triangles.
+   * \param vertices the vertices of the triangles.
+   * \param vertexCount the amount of vertices.
+   * \param indices the vertex indices, three for each triangle; null if the triangles are
+   * described by consecutive triples of vertices.
+   * \param indexCount the amount of indices.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename U>
+  auto render_geometry(const basic_texture<U>& texture,
+                       const vertex* vertices,
+                       const usize vertexCount,
+                       const int* indices = nullptr,
+                       const usize indexCount = 0) noexcept -> result
+  {
+    return submit_geometry(texture.get(), vertices, vertexCount, indices, indexCount);
+  }
+
+#if CENTURION_HAS_FEATURE_SPAN
+
+  /**
+   * \brief Renders colored triangles.
+   *
+   * \param vertices the vertices of the triangles.
+   * \param indices the vertex indices, three for each triangle; empty if the triangles are
+   * described by consecutive triples of vertices.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto render_geometry(const std::span<const vertex> vertices,
+                       const std::span<const int> indices = {}) noexcept -> result
+  {
+    return submit_geometry(nullptr,
+                           vertices.data(),
+                           vertices.size(),
+                           indices.data(),
+                           indices.size());
+  }
+
+  /**
+   * \brief Renders textured triangles.
+   *
+   * \tparam U the ownership semantics of the texture.
+   *
+   * \param texture the texture that is mapped onto the triangles.
+   * \param vertices the vertices of the triangles.
+   * \param indices the vertex indices, three for each triangle; empty if the triangles are
+   * described by consecutive triples of vertices.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename U>
+  auto render_geometry(const basic_texture<U>& texture,
+                       const std::span<const vertex> vertices,
+                       const std::span<const int> indices = {}) noexcept -> result
+  {
+    return submit_geometry(texture.get(),
+                           vertices.data(),
+                           vertices.size(),
+                           indices.data(),
+                           indices.size());
+  }
+
+#endif  // CENTURION_HAS_FEATURE_SPAN
+
+  /**
+   * \brief Renders colored triangles, whose vertex attributes are stored in separate
+   * arrays.
+   *
+   * \details The attributes are read directly from the arrays described by the geometry,
+   * with a single `SDL_RenderGeometryRaw` call.
+   *
+   * \param geometry the description of the vertices and indices.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \see `strided_geometry`
+   *
+   * \since 6.4.0
+   */
+  auto render_geometry_raw(const strided_geometry& geometry) noexcept -> result
+  {
+    return submit_geometry_raw(nullptr, geometry);
+  }
+
+  /**
+   * \brief Renders textured triangles, whose vertex attributes are stored in separate
+   * arrays.
+   *
+   * \details The attributes are read directly from the arrays described by the geometry,
+   * with a single `SDL_RenderGeometryRaw` call.
+   *
+   * \tparam U the ownership semantics of the texture.
+   *
+   * \param texture the texture that is mapped onto the triangles.
+   * \param geometry the description of the vertices and indices, which must provide
+   * texture coordinates.
+   *
+   * \return `success` if the triangles were rendered; `failure` otherwise.
+   *
+   * \see `strided_geometry`
+   *
+   * \since 6.4.0
+   */
+  template <typename U>
+  auto render_geometry_raw(const basic_texture<U>& texture,
+                           const strided_geometry& geometry) noexcept -> result
+  {
+    return submit_geometry_raw(texture.get(), geometry);
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
   /// \} End of primitive rendering
 
   /// \name Translated primitive rendering
@@ -586,6 +1215,123 @@ class basic_renderer final
     fill_circle(translate(center), radius);
   }
 
+  /**
+   * \brief Renders the outlines of a collection of rectangles.
+   *
+   * \details The rectangles are translated using the current translation viewport, which
+   * is only read once. The translated rectangles are submitted in chunks, with a single
+   * call for each chunk, and no dynamic allocations take place.
+   *
+   * \details If culling is enabled, rectangles that don't intersect the area covered by
+   * the translation viewport are discarded before being submitted. Note, culling uses the
+   * size of the translation viewport, so it should only be enabled if the translation
+   * viewport has been given a size that corresponds to the visible area.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store its elements contiguously, such as
+   * `std::vector` or `std::array`.
+   *
+   * \param container the container that holds the rectangles that will be rendered.
+   * \param cull `true` if rectangles outside of the translation viewport should be
+   * discarded; `false` otherwise.
+   *
+   * \return `success` if the rectangles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto draw_rects_t(const Container& container, const bool cull = false) noexcept -> result
+  {
+    using value_t = typename Container::value_type::value_type;  // either int or float
+
+    return submit_translated(container, cull, [this](const auto* first, const int count) {
+      count_draw(static_cast<usize>(count));
+
+      if constexpr (std::is_same_v<value_t, int>) {
+        return SDL_RenderDrawRects(get(), first, count) == 0;
+      }
+      else {
+        return SDL_RenderDrawRectsF(get(), first, count) == 0;
+      }
+    });
+  }
+
+  /**
+   * \brief Renders a collection of filled rectangles.
+   *
+   * \details The rectangles are translated using the current translation viewport, see
+   * `draw_rects_t()` for details about the translation and culling.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store its elements contiguously, such as
+   * `std::vector` or `std::array`.
+   *
+   * \param container the container that holds the rectangles that will be rendered.
+   * \param cull `true` if rectangles outside of the translation viewport should be
+   * discarded; `false` otherwise.
+   *
+   * \return `success` if the rectangles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto fill_rects_t(const Container& container, const bool cull = false) noexcept -> result
+  {
+    using value_t = typename Container::value_type::value_type;  // either int or float
+
+    return submit_translated(container, cull, [this](const auto* first, const int count) {
+      count_draw(static_cast<usize>(count));
+
+      if constexpr (std::is_same_v<value_t, int>) {
+        return SDL_RenderFillRects(get(), first, count) == 0;
+      }
+      else {
+        return SDL_RenderFillRectsF(get(), first, count) == 0;
+      }
+    });
+  }
+
+  /**
+   * \brief Renders a collection of points.
+   *
+   * \details The points are translated using the current translation viewport, see
+   * `draw_rects_t()` for details about the translation and culling.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store its elements contiguously, such as
+   * `std::vector` or `std::array`.
+   *
+   * \param container the container that holds the points that will be rendered.
+   * \param cull `true` if points outside of the translation viewport should be discarded;
+   * `false` otherwise.
+   *
+   * \return `success` if the points were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto draw_points_t(const Container& container, const bool cull = false) noexcept -> result
+  {
+    using value_t = typename Container::value_type::value_type;  // either int or float
+
+    return submit_translated(container, cull, [this](const auto* first, const int count) {
+      count_draw(static_cast<usize>(count));
+
+      if constexpr (std::is_same_v<value_t, int>) {
+        return SDL_RenderDrawPoints(get(), first, count) == 0;
+      }
+      else {
+        return SDL_RenderDrawPointsF(get(), first, count) == 0;
+      }
+    });
+  }
+
   /// \} End of translated primitive rendering
 
   /// \name Text rendering
@@ -1041,6 +1787,10 @@ class basic_renderer final
    *
    * \note This function has no effect if the glyph doesn't exist in the cache.
    *
+   * \details Glyphs that have been packed into the glyph atlas of the cache are rendered
+   * from the corresponding atlas page, which means that consecutive glyphs share the same
+   * texture and can be batched by the renderer.
+   *
    * \param cache the font cache that will be used.
    * \param glyph the glyph, in unicode, that will be rendered.
    * \param position the position of the rendered glyph.
@@ -1052,7 +1802,10 @@ class basic_renderer final
    */
   auto render_glyph(const font_cache& cache, const unicode glyph, const ipoint position) -> int
   {
-    if (const auto* data = cache.try_at(glyph)) {
+    if (const auto* atlasData = cache.try_at_atlas(glyph)) {
+      return render_atlas_glyph(cache, *atlasData, position);
+    }
+    else if (const auto* data = cache.try_at(glyph)) {
       const auto& [texture, metrics] = *data;
 
       const auto outline = cache.get_font().outline();
@@ -1083,7 +1836,7 @@ class basic_renderer final
    * contain such characters appropriately.
    *
    * \tparam String the type of the string, must be iterable and provide `unicode`
-   * characters.
+   * characters, e.g. `unicode_string` or `utf8_view`.
    *
    * \param cache the font cache that will be used.
    * \param str the string that will be rendered.
@@ -1092,25 +1845,209 @@ class basic_renderer final
    * \since 5.0.0
    */
   template <typename String>
-  void render_text(const font_cache& cache, const String& str, ipoint position)
+  void render_text(const font_cache& cache, const String& str, const ipoint position)
   {
-    const auto& font = cache.get_font();
+    CENTURION_PROFILE_ZONE("renderer::render_text");
+    render_cached_text(cache, str, position);
+  }
 
-    const auto originalX = position.x();
-    const auto lineSkip = font.line_skip();
+  /**
+   * \brief Renders a glyph at the specified position, rasterizing it if necessary.
+   *
+   * \details The glyph is obtained with `font_cache::request_glyph()`, which means that
+   * it's marked as recently used in the glyph atlas and that it's rendered into the atlas
+   * on first use if on-demand mode is enabled. Glyphs that aren't in the atlas are
+   * rendered in the same way as with the `const` overload.
+   *
+   * \param cache the font cache that will be used.
+   * \param glyph the glyph, in unicode, that will be rendered.
+   * \param position the position of the rendered glyph.
+   *
+   * \return the x-coordinate of the next glyph to be rendered after the current glyph, or
+   * the same x-coordinate if no glyph was rendered.
+   *
+   * \throws cen_error if the glyph doesn't fit in the atlas, even after evicting glyphs.
+   *
+   * \see `font_cache::set_on_demand()`
+   *
+   * \since 6.4.0
+   */
+  auto render_glyph(font_cache& cache, const unicode glyph, const ipoint position) -> int
+  {
+    if (const auto* atlasData = cache.request_glyph(*this, glyph)) {
+      return render_atlas_glyph(cache, *atlasData, position);
+    }
+    else {
+      return render_glyph(std::as_const(cache), glyph, position);
+    }
+  }
 
-    for (const unicode glyph : str) {
-      if (glyph == '\n') {
-        position.set_x(originalX);
-        position.set_y(position.y() + lineSkip);
+  /**
+   * \brief Renders a string, rasterizing missing glyphs if necessary.
+   *
+   * \details Every glyph is rendered with the non-`const` `render_glyph()` overload, see
+   * the `const` overload of this function for details.
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters, e.g. `unicode_string` or `utf8_view`.
+   *
+   * \param cache the font cache that will be used.
+   * \param str the string that will be rendered.
+   * \param position the position of the rendered text.
+   *
+   * \throws cen_error if a glyph doesn't fit in the atlas, even after evicting glyphs.
+   *
+   * \see `font_cache::set_on_demand()`
+   *
+   * \since 6.4.0
+   */
+  template <typename String>
+  void render_text(font_cache& cache, const String& str, const ipoint position)
+  {
+    CENTURION_PROFILE_ZONE("renderer::render_text");
+    render_cached_text(cache, str, position);
+  }
+
+  /**
+   * \brief Renders a text layout.
+   *
+   * \details The glyphs are rendered at the positions computed by the layout, which
+   * means that kerning and wrapping are applied. No allocations take place.
+   *
+   * \param layout the text layout that will be rendered.
+   * \param position the position of the rendered text.
+   *
+   * \see `text_layout`
+   *
+   * \since 6.4.0
+   */
+  void render_text(const text_layout& layout, const ipoint position)
+  {
+    CENTURION_PROFILE_ZONE("renderer::render_text");
+
+    const auto& cache = layout.get_cache();
+    for (const auto& [glyph, offset] : layout.glyphs()) {
+      render_glyph(cache, glyph, position + offset);
+    }
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Renders all glyphs in a text batch.
+   *
+   * \details The glyphs of each atlas page are submitted with a single
+   * `SDL_RenderGeometry` call, so a batch that only uses one atlas page is rendered with
+   * one call, regardless of the amount of glyphs.
+   *
+   * \param batch the text batch that will be rendered.
+   *
+   * \return `success` if all atlas pages were rendered; `failure` otherwise.
+   *
+   * \see `text_batch`
+   *
+   * \since 6.4.0
+   */
+  auto render_text(const text_batch& batch) -> result
+  {
+    CENTURION_PROFILE_ZONE("renderer::render_text");
+
+    const auto& cache = batch.get_cache();
+    const auto count = batch.page_count();
+
+    for (usize page = 0; page < count; ++page) {
+      const auto& vertices = batch.vertices(page);
+      const auto& indices = batch.indices(page);
+
+      if (vertices.empty()) {
+        continue;
       }
-      else {
-        const auto x = render_glyph(cache, glyph, position);
-        position.set_x(x);
+
+      count_draw(indices.size() / 3, cache.atlas_page(page).get());
+      if (SDL_RenderGeometry(get(),
+                             cache.atlas_page(page).get(),
+                             vertices.data(),
+                             isize(vertices),
+                             indices.data(),
+                             isize(indices)) != 0) {
+        return failure;
+      }
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Renders all glyphs in a signed distance field text batch.
+   *
+   * \details The glyphs of each atlas page are submitted with a single
+   * `SDL_RenderGeometry` call, and are scaled with the linear filtering of the atlas pages.
+   *
+   * \param batch the text batch that will be rendered.
+   *
+   * \return `success` if all atlas pages were rendered; `failure` otherwise.
+   *
+   * \see `sdf_text_batch`
+   * \see `sdf_glyph_atlas`
+   *
+   * \since 6.4.0
+   */
+  auto render_text(const sdf_text_batch& batch) -> result
+  {
+    CENTURION_PROFILE_ZONE("renderer::render_text");
+
+    const auto& atlas = batch.get_atlas();
+    const auto count = batch.page_count();
+
+    for (usize page = 0; page < count; ++page) {
+      const auto& vertices = batch.vertices(page);
+      const auto& indices = batch.indices(page);
+
+      if (vertices.empty()) {
+        continue;
+      }
+
+      count_draw(indices.size() / 3, atlas.page(page).get());
+      if (SDL_RenderGeometry(get(),
+                             atlas.page(page).get(),
+                             vertices.data(),
+                             isize(vertices),
+                             indices.data(),
+                             isize(indices)) != 0) {
+        return failure;
+      }
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Renders a rich text.
+   *
+   * \details Each text batch of the rich text is rendered with `render_text(const
+   * text_batch&)`, i.e. with one `SDL_RenderGeometry` call for each used atlas page.
+   *
+   * \param text the rich text that will be rendered.
+   *
+   * \return `success` if all text batches were rendered; `failure` otherwise.
+   *
+   * \see `rich_text`
+   *
+   * \since 6.4.0
+   */
+  auto render_text(const rich_text& text) -> result
+  {
+    for (const auto& batch : text.batches()) {
+      if (!render_text(batch)) {
+        return failure;
       }
     }
+
+    return success;
   }
 
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
 #endif  // CENTURION_NO_SDL_TTF
 
   /// \} End of text rendering
@@ -1135,6 +2072,10 @@ class basic_renderer final
   auto render(const basic_texture<U>& texture, const basic_point<P>& position) noexcept
       -> result
   {
+    CENTURION_PROFILE_ZONE("renderer::render");
+
+    count_draw(1, texture.get());
+
     if constexpr (basic_point<P>::isFloating) {
       const auto size = cast<cen::farea>(texture.size());
       const SDL_FRect dst{position.x(), position.y(), size.width, size.height};
@@ -1163,6 +2104,10 @@ class basic_renderer final
   auto render(const basic_texture<U>& texture, const basic_rect<P>& destination) noexcept
       -> result
   {
+    CENTURION_PROFILE_ZONE("renderer::render");
+
+    count_draw(1, texture.get());
+
     if constexpr (basic_rect<P>::isFloating) {
       return SDL_RenderCopyF(get(), texture.get(), nullptr, destination.data()) == 0;
     }
@@ -1193,6 +2138,10 @@ class basic_renderer final
               const irect& source,
               const basic_rect<P>& destination) noexcept -> result
   {
+    CENTURION_PROFILE_ZONE("renderer::render");
+
+    count_draw(1, texture.get());
+
     if constexpr (basic_rect<P>::isFloating) {
       return SDL_RenderCopyF(get(), texture.get(), source.data(), destination.data()) == 0;
     }
@@ -1223,6 +2172,10 @@ class basic_renderer final
               const basic_rect<P>& destination,
               const double angle) noexcept -> result
   {
+    CENTURION_PROFILE_ZONE("renderer::render");
+
+    count_draw(1, texture.get());
+
     if constexpr (basic_rect<P>::isFloating) {
       return SDL_RenderCopyExF(get(),
                                texture.get(),
@@ -1268,11 +2221,15 @@ class basic_renderer final
               const double angle,
               const basic_point<P>& center) noexcept -> result
   {
+    CENTURION_PROFILE_ZONE("renderer::render");
+
     static_assert(std::is_same_v<typename basic_rect<R>::value_type,
                                  typename basic_point<P>::value_type>,
                   "Destination rectangle and center point must have the same "
                   "value types (int or float)!");
 
+    count_draw(1, texture.get());
+
     if constexpr (basic_rect<R>::isFloating) {
       return SDL_RenderCopyExF(get(),
                                texture.get(),
@@ -1320,11 +2277,15 @@ class basic_renderer final
               const basic_point<P>& center,
               const SDL_RendererFlip flip) noexcept -> result
   {
+    CENTURION_PROFILE_ZONE("renderer::render");
+
     static_assert(std::is_same_v<typename basic_rect<R>::value_type,
                                  typename basic_point<P>::value_type>,
                   "Destination rectangle and center point must have the same "
                   "value types (int or float)!");
 
+    count_draw(1, texture.get());
+
     if constexpr (basic_rect<R>::isFloating) {
       return SDL_RenderCopyExF(get(),
                                texture.get(),
@@ -1546,6 +2507,206 @@ class basic_renderer final
 
   /// \} End of translation viewport
 
+  /// \name State caching
+  /// \{
+
+  /**
+   * \brief Sets whether or not redundant render state changes are elided.
+   *
+   * \details When state caching is enabled, the renderer keeps track of the last applied
+   * color, blend mode, render target, clip and viewport. Calls to `set_color()`,
+   * `set_blend_mode()`, `set_target()`, `reset_target()`, `set_clip()` and
+   * `set_viewport()` that wouldn't change the state are then not forwarded to SDL.
+   *
+   * \details State caching is disabled by default. The cached state is discarded
+   * whenever this function is called.
+   *
+   * \note The cache cannot detect state changes made through other means, e.g. by
+   * calling SDL functions directly or by using a `renderer_handle`. Call
+   * `invalidate_state_cache()` after any such changes.
+   *
+   * \param enabled `true` if redundant state changes should be elided; `false`
+   * otherwise.
+   *
+   * \see `render_state_stats`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void set_state_caching(const bool enabled) noexcept
+  {
+    invalidate_state_cache();
+    m_renderer.state.enabled = enabled;
+  }
+
+  /**
+   * \brief Indicates whether or not redundant render state changes are elided.
+   *
+   * \return `true` if state caching is enabled; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto is_state_caching() const noexcept -> bool
+  {
+    return m_renderer.state.enabled;
+  }
+
+  /**
+   * \brief Discards the cached render state.
+   *
+   * \details The next state change of each kind is always forwarded to SDL.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void invalidate_state_cache() noexcept
+  {
+    auto& state = m_renderer.state;
+    state.color.valid = false;
+    state.blendMode.valid = false;
+    state.target.valid = false;
+    state.clip.valid = false;
+    state.viewport.valid = false;
+  }
+
+  /**
+   * \brief Returns the amount of state changes that have been elided.
+   *
+   * \return the statistics of the state cache.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto state_cache_stats() const noexcept -> const render_state_stats&
+  {
+    return m_renderer.state.stats;
+  }
+
+  /**
+   * \brief Resets the statistics of the state cache.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void reset_state_cache_stats() noexcept
+  {
+    m_renderer.state.stats = render_state_stats{};
+  }
+
+  /// \} End of state caching
+
+  /// \name Statistics
+  /// \{
+
+  /**
+   * \brief Sets whether or not the renderer counts the work it forwards to SDL.
+   *
+   * \details When enabled, the renderer counts the draw calls, primitives, texture
+   * switches, state changes and texture uploads of every frame. The counters are moved to
+   * `frame_stats()` and reset whenever `present()` is called. Statistics collection is
+   * disabled by default, and the counters are reset whenever this function is called.
+   * \code{cpp}
+   *   renderer.set_stats_collection(true);
+   *
+   *   // Once per frame, after presenting
+   *   const auto& stats = renderer.frame_stats();
+   *   overlay.add_row("Draw calls", stats.drawCalls);
+   * \endcode
+   *
+   * \note Rendering through a `renderer_handle`, or with SDL functions directly, isn't
+   * counted. The latter can be reported with `record_draw()` and `record_upload()`.
+   *
+   * \param enabled `true` if statistics should be collected; `false` otherwise.
+   *
+   * \see `render_stats`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void set_stats_collection(const bool enabled) noexcept
+  {
+    m_renderer.stats = stats_data{};
+    m_renderer.stats.enabled = enabled;
+  }
+
+  /**
+   * \brief Indicates whether or not the renderer collects statistics.
+   *
+   * \return `true` if statistics are collected; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto is_collecting_stats() const noexcept -> bool
+  {
+    return m_renderer.stats.enabled;
+  }
+
+  /**
+   * \brief Returns the statistics of the last presented frame.
+   *
+   * \return the work that was forwarded to SDL between the two latest calls to
+   * `present()`.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto frame_stats() const noexcept -> const render_stats&
+  {
+    return m_renderer.stats.frame;
+  }
+
+  /**
+   * \brief Returns the statistics of the current frame.
+   *
+   * \return the work that has been forwarded to SDL since the last call to `present()`.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto current_stats() const noexcept -> const render_stats&
+  {
+    return m_renderer.stats.current;
+  }
+
+  /**
+   * \brief Counts a draw call that was submitted without going through the renderer.
+   *
+   * \details This is used by utilities such as `sprite_batch`, and has no effect unless
+   * statistics are collected by an owning renderer.
+   *
+   * \param primitives the amount of primitives that were submitted.
+   * \param texture the texture that was rendered, if any.
+   *
+   * \since 6.4.0
+   */
+  void record_draw(const usize primitives, SDL_Texture* texture = nullptr) noexcept
+  {
+    count_draw(primitives, texture);
+  }
+
+  /**
+   * \brief Counts pixel data that was uploaded to a texture.
+   *
+   * \details This is used by utilities such as `font_cache`, and has no effect unless
+   * statistics are collected by an owning renderer.
+   *
+   * \param bytes the amount of uploaded bytes.
+   *
+   * \since 6.4.0
+   */
+  void record_upload(const usize bytes) noexcept
+  {
+    if constexpr (detail::is_owning<T>()) {
+      if (m_renderer.stats.enabled) {
+        m_renderer.stats.current.uploadedBytes += bytes;
+      }
+    }
+  }
+
+  /// \} End of statistics
+
   /// \name Font handling
   /// \{
 
@@ -1572,6 +2733,31 @@ class basic_renderer final
     fonts.try_emplace(id, std::move(font));
   }
 
+  /**
+   * \brief Creates a font from a font pool and adds it to the renderer.
+   *
+   * \details The font shares the font data of the pool, so the font file isn't read again.
+   *
+   * \note This function overwrites any previously stored font associated with the
+   * specified ID.
+   *
+   * \param id the key that will be associated with the font.
+   * \param pool the font pool that provides the font data.
+   * \param size the font size, must be greater than zero.
+   *
+   * \throws cen_error if the supplied size is not greater than zero.
+   * \throws ttf_error if the font cannot be loaded.
+   *
+   * \see `font_pool`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void add_font(const usize id, const font_pool& pool, const int size)
+  {
+    add_font(id, pool.make_font(size));
+  }
+
   /**
    * \brief Creates a font and adds it to the renderer.
    *
@@ -1669,11 +2855,13 @@ class basic_renderer final
    */
   auto set_color(const color& color) noexcept -> result
   {
-    return SDL_SetRenderDrawColor(get(),
-                                  color.red(),
-                                  color.green(),
-                                  color.blue(),
-                                  color.alpha()) == 0;
+    return apply_state(&state_cache::color, &render_state_stats::colors, color, [&] {
+      return SDL_SetRenderDrawColor(get(),
+                                    color.red(),
+                                    color.green(),
+                                    color.blue(),
+                                    color.alpha()) == 0;
+    });
   }
 
   /**
@@ -1689,7 +2877,9 @@ class basic_renderer final
    */
   auto set_clip(const std::optional<irect> area) noexcept -> result
   {
-    return SDL_RenderSetClipRect(get(), area ? area->data() : nullptr) == 0;
+    return apply_state(&state_cache::clip, &render_state_stats::clips, area, [&] {
+      return SDL_RenderSetClipRect(get(), area ? area->data() : nullptr) == 0;
+    });
   }
 
   /**
@@ -1703,7 +2893,9 @@ class basic_renderer final
    */
   auto set_viewport(const irect viewport) noexcept -> result
   {
-    return SDL_RenderSetViewport(get(), viewport.data()) == 0;
+    return apply_state(&state_cache::viewport, &render_state_stats::viewports, viewport, [&] {
+      return SDL_RenderSetViewport(get(), viewport.data()) == 0;
+    });
   }
 
   /**
@@ -1717,7 +2909,9 @@ class basic_renderer final
    */
   auto set_blend_mode(const blend_mode mode) noexcept -> result
   {
-    return SDL_SetRenderDrawBlendMode(get(), static_cast<SDL_BlendMode>(mode)) == 0;
+    return apply_state(&state_cache::blendMode, &render_state_stats::blendModes, mode, [&] {
+      return SDL_SetRenderDrawBlendMode(get(), static_cast<SDL_BlendMode>(mode)) == 0;
+    });
   }
 
   /**
@@ -1735,7 +2929,7 @@ class basic_renderer final
   auto set_target(basic_texture<U>& target) noexcept -> result
   {
     assert(target.is_target());
-    return SDL_SetRenderTarget(get(), target.get()) == 0;
+    return apply_target(target.get());
   }
 
   /**
@@ -1748,7 +2942,7 @@ class basic_renderer final
    */
   auto reset_target() noexcept -> result
   {
-    return SDL_SetRenderTarget(get(), nullptr) == 0;
+    return apply_target(nullptr);
   }
 
   /**
@@ -1768,6 +2962,8 @@ class basic_renderer final
   {
     assert(xScale > 0);
     assert(yScale > 0);
+    invalidate_view_state();
+    count_state_change();
     return SDL_RenderSetScale(get(), xScale, yScale) == 0;
   }
 
@@ -1790,6 +2986,8 @@ class basic_renderer final
   {
     assert(size.width >= 0);
     assert(size.height >= 0);
+    invalidate_view_state();
+    count_state_change();
     return SDL_RenderSetLogicalSize(get(), size.width, size.height) == 0;
   }
 
@@ -1807,6 +3005,7 @@ class basic_renderer final
    */
   auto set_logical_integer_scaling(const bool enabled) noexcept -> result
   {
+    count_state_change();
     return SDL_RenderSetIntegerScale(get(), detail::convert_bool(enabled)) == 0;
   }
 
@@ -2128,6 +3327,39 @@ class basic_renderer final
     }
   };
 
+  [[nodiscard]] static auto create(SDL_Window* window, const u32 flags) noexcept
+      -> SDL_Renderer*
+  {
+    const startup_scope trace{"renderer"};
+    return SDL_CreateRenderer(window, -1, flags);
+  }
+
+  template <typename V>
+  struct shadow_value final
+  {
+    V value{};
+    bool valid{};
+  };
+
+  struct state_cache final
+  {
+    shadow_value<cen::color> color;
+    shadow_value<blend_mode> blendMode;
+    shadow_value<SDL_Texture*> target;
+    shadow_value<std::optional<irect>> clip;
+    shadow_value<irect> viewport;
+    render_state_stats stats;
+    bool enabled{};
+  };
+
+  struct stats_data final
+  {
+    render_stats current;
+    render_stats frame;
+    SDL_Texture* texture{};  ///< The last rendered texture.
+    bool enabled{};
+  };
+
   struct owning_data final
   {
     /*implicit*/ owning_data(SDL_Renderer* ptr) : ptr{ptr}  // NOLINT
@@ -2135,21 +3367,207 @@ class basic_renderer final
 
     std::unique_ptr<SDL_Renderer, deleter> ptr;
     frect translation{};
+    state_cache state;
+    stats_data stats;
+    present_timing timing;
 
 #ifndef CENTURION_NO_SDL_TTF
-    std::unordered_map<usize, font> fonts{};
+    detail::tracked_unordered_map<usize, font, alloc_subsystem::video> fonts{};
 #endif  // CENTURION_NO_SDL_TTF
   };
 
   std::conditional_t<T::value, owning_data, SDL_Renderer*> m_renderer;
 
+  /// The amount of primitives that are submitted at a time by the bulk rendering functions.
+  inline constexpr static usize chunk_size = 256;
+
   [[nodiscard]] auto render_text(owner<SDL_Surface*> s) -> texture
   {
     surface surface{s};
     texture texture{SDL_CreateTextureFromSurface(get(), surface.get())};
+
+    if (surface.get()) {
+      record_upload(static_cast<usize>(surface.pitch()) *
+                    static_cast<usize>(surface.height()));
+    }
+
     return texture;
   }
 
+#ifndef CENTURION_NO_SDL_TTF
+
+  auto render_atlas_glyph(const font_cache& cache,
+                          const font_cache::atlas_glyph& data,
+                          const ipoint position) -> int
+  {
+    const auto& [source, metrics, page] = data;
+
+    const auto outline = cache.get_font().outline();
+
+    // SDL_ttf handles the y-axis alignment
+    const auto x = position.x() + metrics.minX - outline;
+    const auto y = position.y() - outline;
+
+    render(cache.atlas_page(page), source, irect{{x, y}, source.size()});
+
+    return x + metrics.advance;
+  }
+
+  template <typename Cache, typename String>
+  void render_cached_text(Cache& cache, const String& str, ipoint position)
+  {
+    const auto& font = cache.get_font();
+
+    const auto originalX = position.x();
+    const auto lineSkip = font.line_skip();
+
+    for (const unicode glyph : str) {
+      if (glyph == '\n') {
+        position.set_x(originalX);
+        position.set_y(position.y() + lineSkip);
+      }
+      else {
+        const auto x = render_glyph(cache, glyph, position);
+        position.set_x(x);
+      }
+    }
+  }
+
+#endif  // CENTURION_NO_SDL_TTF
+
+  template <typename V, typename Apply>
+  auto apply_state(shadow_value<V> state_cache::*member,
+                   usize render_state_stats::*counter,
+                   const V& value,
+                   Apply apply) noexcept -> result
+  {
+    if constexpr (detail::is_owning<T>()) {
+      auto& state = m_renderer.state;
+      if (!state.enabled) {
+        count_state_change();
+        return apply();
+      }
+
+      auto& cached = state.*member;
+      if (cached.valid && cached.value == value) {
+        ++(state.stats.*counter);
+        return success;
+      }
+
+      count_state_change();
+
+      // A failed call leaves the state unknown
+      const result ok = apply();
+      cached.value = value;
+      cached.valid = static_cast<bool>(ok);
+
+      return ok;
+    }
+    else {
+      return apply();
+    }
+  }
+
+  auto apply_target(SDL_Texture* target) noexcept -> result
+  {
+    return apply_state(&state_cache::target, &render_state_stats::targets, target, [&] {
+      // The clip and viewport are stored for each render target
+      invalidate_view_state();
+
+      if constexpr (detail::is_owning<T>()) {
+        if (m_renderer.stats.enabled) {
+          ++m_renderer.stats.current.targetChanges;
+        }
+      }
+
+      return SDL_SetRenderTarget(get(), target) == 0;
+    });
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  auto submit_geometry(SDL_Texture* texture,
+                       const vertex* vertices,
+                       const usize vertexCount,
+                       const int* indices,
+                       const usize indexCount) noexcept -> result
+  {
+    CENTURION_PROFILE_ZONE("renderer::render_geometry");
+
+    const auto triangles = ((indices && indexCount != 0) ? indexCount : vertexCount) / 3u;
+    if (triangles == 0) {
+      return success;
+    }
+
+    count_draw(triangles, texture);
+    return SDL_RenderGeometry(get(),
+                              texture,
+                              vertices,
+                              static_cast<int>(vertexCount),
+                              (indexCount != 0) ? indices : nullptr,
+                              static_cast<int>(indexCount)) == 0;
+  }
+
+  auto submit_geometry_raw(SDL_Texture* texture, const strided_geometry& geometry) noexcept
+      -> result
+  {
+    CENTURION_PROFILE_ZONE("renderer::render_geometry_raw");
+
+    const auto triangles = geometry.triangle_count();
+    if (triangles == 0) {
+      return success;
+    }
+
+    count_draw(triangles, texture);
+    return SDL_RenderGeometryRaw(get(),
+                                 texture,
+                                 geometry.positions,
+                                 geometry.positionStride,
+                                 geometry.colors,
+                                 geometry.colorStride,
+                                 geometry.uvs,
+                                 geometry.uvStride,
+                                 geometry.vertexCount,
+                                 geometry.indices,
+                                 geometry.indices ? geometry.indexCount : 0,
+                                 geometry.indexSize) == 0;
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+  void count_draw(const usize primitives, SDL_Texture* texture = nullptr) noexcept
+  {
+    if constexpr (detail::is_owning<T>()) {
+      auto& stats = m_renderer.stats;
+      if (stats.enabled) {
+        ++stats.current.drawCalls;
+        stats.current.primitives += primitives;
+
+        if (texture && texture != stats.texture) {
+          ++stats.current.textureSwitches;
+          stats.texture = texture;
+        }
+      }
+    }
+  }
+
+  void count_state_change() noexcept
+  {
+    if constexpr (detail::is_owning<T>()) {
+      if (m_renderer.stats.enabled) {
+        ++m_renderer.stats.current.stateChanges;
+      }
+    }
+  }
+
+  void invalidate_view_state() noexcept
+  {
+    if constexpr (detail::is_owning<T>()) {
+      m_renderer.state.clip.valid = false;
+      m_renderer.state.viewport.valid = false;
+    }
+  }
+
   template <typename U, typename TT = T, detail::is_owner<TT> = 0>
   [[nodiscard]] auto translate(const basic_point<U>& point) const noexcept -> basic_point<U>
   {
@@ -2167,6 +3585,66 @@ class basic_renderer final
   {
     return basic_rect<U>{translate(rect.position()), rect.size()};
   }
+
+  template <typename U>
+  [[nodiscard]] constexpr static auto is_visible(const basic_rect<U>& rect,
+                                                 const U width,
+                                                 const U height) noexcept -> bool
+  {
+    return rect.x() < width && rect.y() < height && rect.max_x() > 0 && rect.max_y() > 0;
+  }
+
+  template <typename U>
+  [[nodiscard]] constexpr static auto is_visible(const basic_point<U>& point,
+                                                 const U width,
+                                                 const U height) noexcept -> bool
+  {
+    return point.x() >= 0 && point.y() >= 0 && point.x() < width && point.y() < height;
+  }
+
+  template <typename Container, typename Submit, typename TT = T, detail::is_owner<TT> = 0>
+  auto submit_translated(const Container& container, const bool cull, Submit submit) noexcept
+      -> result
+  {
+    using elem_t = typename Container::value_type;  // a rectangle or point of int or float
+    using value_t = typename elem_t::value_type;    // either int or float
+
+    if (container.empty()) {
+      return failure;
+    }
+
+    // The translation is read once, rather than once for each element
+    const auto& translation = m_renderer.translation;
+    const auto dx = static_cast<value_t>(translation.x());
+    const auto dy = static_cast<value_t>(translation.y());
+    const auto width = static_cast<value_t>(translation.width());
+    const auto height = static_cast<value_t>(translation.height());
+
+    std::array<elem_t, chunk_size> chunk;
+    usize count = 0;
+    bool ok = true;
+
+    for (const auto& elem : container) {
+      // Culled elements are overwritten by the next element, which avoids branching
+      auto& translated = chunk[count];
+      translated = elem;
+      translated.set_x(elem.x() - dx);
+      translated.set_y(elem.y() - dy);
+
+      count += (!cull || is_visible(translated, width, height)) ? 1u : 0u;
+
+      if (count == chunk_size) {
+        ok = submit(chunk.front().data(), static_cast<int>(count)) && ok;
+        count = 0;
+      }
+    }
+
+    if (count != 0) {
+      ok = submit(chunk.front().data(), static_cast<int>(count)) && ok;
+    }
+
+    return ok;
+  }
 };
 
 /// \name String conversions
@@ -2195,6 +3673,13 @@ auto operator<<(std::ostream& stream, const basic_renderer<T>& renderer) -> std:
 
 /// \} End of streaming
 
+#if CENTURION_EXTERN_TEMPLATES
+
+extern template class CENTURION_API basic_renderer<detail::owning_type>;
+extern template class CENTURION_API basic_renderer<detail::handle_type>;
+
+#endif  // CENTURION_EXTERN_TEMPLATES
+
 /// \} End of group video
 
 }  // namespace cen
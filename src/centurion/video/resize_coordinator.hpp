@@ -0,0 +1,548 @@
+#ifndef CENTURION_RESIZE_COORDINATOR_HEADER
+#define CENTURION_RESIZE_COORDINATOR_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>   // find_if, max, min
+#include <cassert>     // assert
+#include <cmath>       // lround
+#include <functional>  // function
+#include <optional>    // optional, nullopt
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../events/event_listeners.hpp"
+#include "../events/window_event.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/counter.hpp"
+#include "pixel_format.hpp"
+#include "renderer.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "texture_pool.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct resize_settled
+ *
+ * \brief Describes a window resize that has settled, published by a `resize_coordinator`.
+ *
+ * \since 6.4.0
+ */
+struct resize_settled final
+{
+  iarea size;         ///< The new output size of the renderer, in pixels.
+  iarea previous;     ///< The output size before the resize, in pixels.
+  iarea window_size;  ///< The new size of the window, in screen coordinates.
+};
+
+/**
+ * \struct resize_stats
+ *
+ * \brief Provides statistics about the resizes handled by a `resize_coordinator`.
+ *
+ * \since 6.4.0
+ */
+struct resize_stats final
+{
+  usize events{};         ///< The amount of handled resize events.
+  usize settles{};        ///< The amount of times the size settled on a new value.
+  usize reallocations{};  ///< The amount of textures that were reallocated.
+};
+
+/**
+ * \class resize_coordinator
+ *
+ * \brief Coalesces window resize events, and reallocates size dependent textures once the
+ * size has settled.
+ *
+ * \details Dragging the border of a window produces a resize event for almost every frame,
+ * and rebuilding render targets, post-processing textures, and DPI scaled font atlases in
+ * response to each of them causes hitching. A resize coordinator instead waits until no
+ * resize events have arrived for a short delay, after which the size is considered to be
+ * settled.
+ *
+ * \details Textures whose size depends on the output size, such as render targets, are
+ * registered with the coordinator, which obtains them from a texture pool. While the
+ * window is being resized, the textures keep their previous size, and `stretch()` can be
+ * used to present a target scaled to the current output size. Once the size settles, the
+ * textures are reallocated through the pool, so resizing back and forth reuses textures,
+ * and the listeners are notified with a `resize_settled` event.
+ * \code{cpp}
+ *   cen::texture_pool pool;
+ *   cen::resize_coordinator resizes{window, renderer, pool};
+ *
+ *   const auto scene = resizes.add_target(cen::pixel_format::rgba8888);
+ *   const auto bloom = resizes.add_target(cen::pixel_format::rgba8888, [](cen::iarea size) {
+ *     return cen::iarea{size.width / 2, size.height / 2};
+ *   });
+ *
+ *   auto rescale = [&](const cen::resize_settled&) { scaler.update(); };
+ *   resizes.listeners().connect(rescale);
+ *
+ *   dispatcher.bind<cen::window_event>().to([&](const cen::window_event& event) {
+ *     resizes.handle(event);
+ *   });
+ *
+ *   while (running) {
+ *     ...
+ *     resizes.update();
+ *
+ *     renderer.set_target(resizes.get(scene));
+ *     draw_scene();
+ *     renderer.reset_target();
+ *
+ *     resizes.stretch(scene);
+ *     renderer.present();
+ *   }
+ * \endcode
+ *
+ * \details The size of the textures is based on the window size, clamped to the minimum
+ * and maximum size of the window, and converted to pixels with the ratio between the
+ * output size of the renderer and the window size, so high-DPI displays are accounted
+ * for.
+ *
+ * \note The window, the renderer and the texture pool must outlive the coordinator.
+ *
+ * \see `texture_pool`
+ * \see `dpi_scaler`
+ *
+ * \since 6.4.0
+ */
+class resize_coordinator final
+{
+ public:
+  using id_type = usize;
+  using ms_type = milliseconds<u32>;
+  using size_function = std::function<iarea(iarea)>;
+  using listeners_type = event_listeners<resize_settled>;
+
+  /**
+   * \brief Creates a resize coordinator, based on the current size of the window.
+   *
+   * \tparam W the ownership semantics of the window.
+   * \tparam R the ownership semantics of the renderer.
+   *
+   * \param window the window that is resized.
+   * \param renderer the renderer associated with the window.
+   * \param pool the texture pool that provides the registered textures.
+   * \param delay the time without resize events after which the size has settled.
+   *
+   * \since 6.4.0
+   */
+  template <typename W, typename R>
+  resize_coordinator(const basic_window<W>& window,
+                     const basic_renderer<R>& renderer,
+                     texture_pool& pool,
+                     const ms_type delay = default_delay())
+      : m_window{window.get()}
+      , m_renderer{renderer.get()}
+      , m_pool{&pool}
+      , m_delay{delay}
+  {
+    assert(m_window.get());
+    assert(m_renderer.get());
+    m_size = settled_size();
+  }
+
+  resize_coordinator(const resize_coordinator&) = delete;
+
+  auto operator=(const resize_coordinator&) -> resize_coordinator& = delete;
+
+  /**
+   * \brief Registers a render target, whose size depends on the output size.
+   *
+   * \param format the pixel format of the target.
+   * \param size a function that computes the size of the target from the output size, the
+   * target has the same size as the output if the function is empty.
+   *
+   * \return the ID of the target.
+   *
+   * \throws sdl_error if the target cannot be created.
+   *
+   * \since 6.4.0
+   */
+  auto add_target(const pixel_format format, size_function size = {}) -> id_type
+  {
+    return add_texture(format, texture_access::target, std::move(size));
+  }
+
+  /**
+   * \brief Registers a texture, whose size depends on the output size.
+   *
+   * \details The texture is obtained from the pool immediately.
+   *
+   * \param format the pixel format of the texture.
+   * \param access the access of the texture.
+   * \param size a function that computes the size of the texture from the output size, the
+   * texture has the same size as the output if the function is empty.
+   *
+   * \return the ID of the texture.
+   *
+   * \throws sdl_error if the texture cannot be created.
+   *
+   * \since 6.4.0
+   */
+  auto add_texture(const pixel_format format,
+                   const texture_access access,
+                   size_function size = {}) -> id_type
+  {
+    entry created{m_nextId, format, access, std::move(size), std::nullopt};
+    reallocate(created);
+
+    m_entries.push_back(std::move(created));
+    return m_nextId++;
+  }
+
+  /**
+   * \brief Unregisters a texture, which is returned to the pool.
+   *
+   * \param id the ID of the texture.
+   *
+   * \return `true` if the texture was removed; `false` if the ID is unknown.
+   *
+   * \since 6.4.0
+   */
+  auto remove(const id_type id) -> bool
+  {
+    const auto iter = find(id);
+    if (iter != m_entries.end()) {
+      m_entries.erase(iter);
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Returns a registered texture.
+   *
+   * \details The texture keeps its previous size while the window is being resized.
+   *
+   * \pre The ID must be associated with a registered texture.
+   *
+   * \param id the ID of the texture.
+   *
+   * \return the texture.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get(const id_type id) noexcept -> texture&
+  {
+    const auto iter = find(id);
+    assert(iter != m_entries.end());
+    return iter->lease->get();
+  }
+
+  /**
+   * \brief Indicates whether or not a texture is registered.
+   *
+   * \param id the ID of the texture.
+   *
+   * \return `true` if the texture is registered; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto contains(const id_type id) const noexcept -> bool
+  {
+    return std::find_if(m_entries.begin(), m_entries.end(), [id](const entry& e) {
+             return e.id == id;
+           }) != m_entries.end();
+  }
+
+  /**
+   * \brief Renders a registered texture over the entire output of the renderer.
+   *
+   * \details This stretches the previous contents of a render target while the window is
+   * being resized, using the scale mode of the texture.
+   *
+   * \pre The ID must be associated with a registered texture.
+   *
+   * \param id the ID of the texture.
+   *
+   * \return `success` if the texture was rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto stretch(const id_type id) noexcept -> result
+  {
+    const auto output = m_renderer.output_size();
+    return m_renderer.render(get(id), irect{0, 0, output.width, output.height});
+  }
+
+  /**
+   * \brief Records a resize, in response to a window event.
+   *
+   * \details Resize events restart the settling delay. Events for other windows, and
+   * events that don't affect the size, are ignored.
+   *
+   * \param event the window event.
+   *
+   * \since 6.4.0
+   */
+  void handle(const window_event& event) noexcept
+  {
+    if (event.get().windowID != m_window.id()) {
+      return;
+    }
+
+    switch (event.event_id()) {
+      case window_event_id::size_changed:
+      case window_event_id::resized:
+      case window_event_id::maximized:
+      case window_event_id::restored:
+        m_resizing = true;
+        m_lastEvent = counter::ticks();
+        ++m_stats.events;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  /**
+   * \brief Settles the size if no resize events have arrived for the settling delay.
+   *
+   * \details This should be called once per frame, after the events have been handled.
+   *
+   * \return `true` if the size settled on a new value; `false` otherwise.
+   *
+   * \throws sdl_error if a texture cannot be reallocated.
+   *
+   * \since 6.4.0
+   */
+  auto update() -> bool
+  {
+    if (m_resizing && counter::ticks() - m_lastEvent >= m_delay) {
+      return settle();
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Settles the size immediately, and reallocates the textures if it changed.
+   *
+   * \details The listeners are notified if the size changed.
+   *
+   * \return `true` if the size settled on a new value; `false` otherwise.
+   *
+   * \throws sdl_error if a texture cannot be reallocated.
+   *
+   * \since 6.4.0
+   */
+  auto settle() -> bool
+  {
+    m_resizing = false;
+
+    const auto size = settled_size();
+    if (size.width <= 0 || size.height <= 0 || size == m_size) {
+      return false;  // E.g. minimized, or resized back to the previous size
+    }
+
+    const auto previous = m_size;
+    m_size = size;
+
+    for (auto& e : m_entries) {
+      reallocate(e);
+    }
+
+    ++m_stats.settles;
+    m_listeners.publish(resize_settled{m_size, previous, clamped_window_size()});
+
+    return true;
+  }
+
+  /**
+   * \brief Sets the time without resize events after which the size has settled.
+   *
+   * \param delay the settling delay, zero settles on the first update after an event.
+   *
+   * \since 6.4.0
+   */
+  void set_delay(const ms_type delay) noexcept
+  {
+    m_delay = delay;
+  }
+
+  /**
+   * \brief Returns the time without resize events after which the size has settled.
+   *
+   * \return the settling delay.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto delay() const noexcept -> ms_type
+  {
+    return m_delay;
+  }
+
+  /**
+   * \brief Indicates whether or not the window is being resized.
+   *
+   * \return `true` if there have been resize events since the size last settled; `false`
+   * otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_resizing() const noexcept -> bool
+  {
+    return m_resizing;
+  }
+
+  /**
+   * \brief Returns the settled output size, which the textures are based on.
+   *
+   * \return the settled size, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the amount of registered textures.
+   *
+   * \return the number of textures.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto texture_count() const noexcept -> usize
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * \brief Returns the listeners that are notified when the size settles.
+   *
+   * \return the resize listeners.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto listeners() noexcept -> listeners_type&
+  {
+    return m_listeners;
+  }
+
+  /**
+   * \brief Returns statistics about the handled resizes.
+   *
+   * \return the current statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto statistics() const noexcept -> const resize_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Returns the default settling delay.
+   *
+   * \return 150 milliseconds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_delay() noexcept -> ms_type
+  {
+    return ms_type{150};
+  }
+
+ private:
+  struct entry final
+  {
+    id_type id{};
+    pixel_format format{};
+    texture_access access{};
+    size_function size;
+    std::optional<texture_pool::lease> lease;
+  };
+
+  window_handle m_window;
+  renderer_handle m_renderer;
+  texture_pool* m_pool{};
+  std::vector<entry> m_entries;
+  listeners_type m_listeners;
+  resize_stats m_stats;
+  iarea m_size{};
+  ms_type m_delay{};
+  ms_type m_lastEvent{};
+  id_type m_nextId{};
+  bool m_resizing{};
+
+  [[nodiscard]] auto find(const id_type id) noexcept -> std::vector<entry>::iterator
+  {
+    return std::find_if(m_entries.begin(), m_entries.end(), [id](const entry& e) {
+      return e.id == id;
+    });
+  }
+
+  // The window size within its limits, where a maximum of zero means no limit
+  [[nodiscard]] auto clamped_window_size() const noexcept -> iarea
+  {
+    const auto size = m_window.size();
+    const auto min = m_window.min_size();
+    const auto max = m_window.max_size();
+
+    const auto clamp = [](const int value, const int low, const int high) noexcept {
+      const auto result = std::max(value, low);
+      return (high > 0) ? std::min(result, high) : result;
+    };
+
+    return {clamp(size.width, min.width, max.width),
+            clamp(size.height, min.height, max.height)};
+  }
+
+  // The output size that corresponds to the clamped window size
+  [[nodiscard]] auto settled_size() const noexcept -> iarea
+  {
+    const auto output = m_renderer.output_size();
+    const auto window = m_window.size();
+    const auto clamped = clamped_window_size();
+
+    if (window.width <= 0 || window.height <= 0 || clamped == window) {
+      return output;
+    }
+
+    const auto xRatio = static_cast<double>(output.width) / window.width;
+    const auto yRatio = static_cast<double>(output.height) / window.height;
+
+    return {static_cast<int>(std::lround(clamped.width * xRatio)),
+            static_cast<int>(std::lround(clamped.height * yRatio))};
+  }
+
+  void reallocate(entry& e)
+  {
+    auto size = e.size ? e.size(m_size) : m_size;
+    size.width = std::max(size.width, 1);
+    size.height = std::max(size.height, 1);
+
+    if (!e.lease) {
+      e.lease = m_pool->acquire(m_renderer, e.format, e.access, size);
+    }
+    else if ((*e.lease)->size() != size) {
+      // The new texture is acquired first, so the old one is kept if it can't be created
+      e.lease = m_pool->acquire(m_renderer, e.format, e.access, size);
+      ++m_stats.reallocations;
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RESIZE_COORDINATOR_HEADER
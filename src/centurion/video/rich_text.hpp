@@ -0,0 +1,591 @@
+#ifndef CENTURION_RICH_TEXT_HEADER
+#define CENTURION_RICH_TEXT_HEADER
+
+#include <SDL2/SDL.h>
+
+#ifndef CENTURION_NO_SDL_TTF
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <algorithm>         // max
+#include <cassert>           // assert
+#include <initializer_list>  // initializer_list
+#include <string>            // string
+#include <string_view>       // string_view
+#include <vector>            // vector
+
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "font_cache.hpp"
+#include "text_batch.hpp"
+#include "unicode_string.hpp"
+#include "utf8_view.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class rich_text
+ *
+ * \brief Represents a string with bold, italic and colored spans, rendered with glyph
+ * atlases.
+ *
+ * \details The markup is parsed once, and every span is mapped to the font cache of its
+ * style. The glyphs are then laid out and collected in one `text_batch` for each used font
+ * cache, so the complete string is rendered by `basic_renderer::render_text()` with a
+ * single `SDL_RenderGeometry` call for each used atlas page. The layout is only
+ * recomputed when the markup, wrap width, position or default color changes.
+ *
+ * \details The following tags are supported, and may be nested.
+ * - `[b]` and `[/b]` for bold text.
+ * - `[i]` and `[/i]` for italic text.
+ * - `[color=#RRGGBB]` (or `#RRGGBBAA`) and `[/color]` for colored text.
+ *
+ * \details Use `[[` for a literal `[`. Unrecognized tags are treated as text.
+ * \code{cpp}
+ *   cen::rich_text text{{&regular, &bold}, 300};
+ *   text.set_markup("[b]Player[/b]: [color=#FF0000]Watch out![/color]");
+ *
+ *   renderer.render_text(text);
+ * \endcode
+ *
+ * \details Kerning is applied between glyphs of the same font cache, if the font has
+ * kerning enabled. Lines are wrapped in the same way as with `text_layout`, and the line
+ * skip is the largest line skip of the used fonts.
+ *
+ * \note Only glyphs that are stored in the glyph atlases of the font caches are rendered,
+ * see `font_cache::use_atlas()`. Other glyphs are ignored.
+ *
+ * \note The font caches must outlive the rich text, and `update()` must be called if
+ * glyphs are added to the caches afterwards.
+ *
+ * \see `text_layout`
+ * \see `text_batch`
+ *
+ * \since 6.4.0
+ */
+class rich_text final
+{
+ public:
+  /**
+   * \struct font_set
+   *
+   * \brief Provides the font caches that are used for the different text styles.
+   *
+   * \details Only the regular font cache is required. Missing styles fall back to the
+   * closest available style, e.g. bold italic text uses the bold font cache if there is
+   * no bold italic font cache, and the regular font cache if there is no bold one either.
+   *
+   * \since 6.4.0
+   */
+  struct font_set final
+  {
+    const font_cache* regular{};     ///< The font cache used for regular text.
+    const font_cache* bold{};        ///< The font cache used for bold text.
+    const font_cache* italic{};      ///< The font cache used for italic text.
+    const font_cache* boldItalic{};  ///< The font cache used for bold italic text.
+  };
+
+  /**
+   * \struct span
+   *
+   * \brief Represents a range of glyphs that share the same style.
+   *
+   * \since 6.4.0
+   */
+  struct span final
+  {
+    usize begin{};  ///< The index of the first glyph in the span.
+    usize end{};    ///< The index one past the last glyph in the span.
+    bool bold{};    ///< Indicates whether or not the span is bold.
+    bool italic{};  ///< Indicates whether or not the span is italic.
+    color tint;     ///< The color of the span.
+  };
+
+  /**
+   * \brief Creates an empty rich text.
+   *
+   * \param fonts the font caches that will be used, the regular one must not be null.
+   * \param wrapWidth the maximum width of a line, in pixels, zero disables wrapping.
+   *
+   * \since 6.4.0
+   */
+  explicit rich_text(const font_set& fonts, const int wrapWidth = 0)
+      : m_fonts{fonts}
+      , m_wrapWidth{wrapWidth}
+  {
+    assert(fonts.regular);
+    assert(wrapWidth >= 0);
+
+    for (const auto* cache : {fonts.regular, fonts.bold, fonts.italic, fonts.boldItalic}) {
+      if (cache && batch_index(cache) == m_batches.size()) {
+        m_batches.emplace_back(*cache);
+      }
+    }
+  }
+
+  /**
+   * \brief Sets the markup of the text.
+   *
+   * \details The markup is only parsed, and the text laid out, if the markup differs from
+   * the current markup.
+   *
+   * \param markup the UTF-8 encoded markup.
+   *
+   * \since 6.4.0
+   */
+  void set_markup(const std::string_view markup)
+  {
+    if (m_markup != markup) {
+      m_markup.assign(markup);
+      parse();
+      update();
+    }
+  }
+
+  /**
+   * \brief Sets the maximum width of a line.
+   *
+   * \param width the wrap width, in pixels, zero disables wrapping.
+   *
+   * \since 6.4.0
+   */
+  void set_wrap_width(const int width)
+  {
+    assert(width >= 0);
+    if (m_wrapWidth != width) {
+      m_wrapWidth = width;
+      update();
+    }
+  }
+
+  /**
+   * \brief Sets the position of the text.
+   *
+   * \param position the position of the text.
+   *
+   * \since 6.4.0
+   */
+  void set_position(const ipoint position)
+  {
+    if (m_position != position) {
+      m_position = position;
+      update();
+    }
+  }
+
+  /**
+   * \brief Sets the color of text that isn't in a color span.
+   *
+   * \param tint the default text color.
+   *
+   * \since 6.4.0
+   */
+  void set_color(const color& tint)
+  {
+    if (m_color != tint) {
+      m_color = tint;
+      parse();
+      update();
+    }
+  }
+
+  /**
+   * \brief Recomputes the layout of the text.
+   *
+   * \details This function should be called if the font caches have changed, e.g. if new
+   * glyphs have been added to them.
+   *
+   * \since 6.4.0
+   */
+  void update()
+  {
+    for (auto& batch : m_batches) {
+      batch.clear();
+    }
+
+    m_glyphs.clear();
+    m_width = 0;
+    m_lines = m_text.empty() ? 0 : 1;
+    m_lineSkip = 0;
+    m_height = 0;
+
+    for (const auto& batch : m_batches) {
+      const auto& font = batch.get_cache().get_font();
+      m_lineSkip = std::max(m_lineSkip, font.line_skip());
+      m_height = std::max(m_height, font.height());
+    }
+
+    ipoint pen;
+    unicode previous{};
+    const font_cache* previousCache{};
+    usize lineStart = 0;
+    usize wordStart = 0;
+
+    for (const auto& [begin, end, bold, italic, tint] : m_spans) {
+      const auto* cache = select_cache(bold, italic);
+      const auto& font = cache->get_font();
+      const auto kerning = font.has_kerning();
+      const auto batch = batch_index(cache);
+
+      for (auto index = begin; index < end; ++index) {
+        const auto glyph = m_text[index];
+
+        if (glyph == '\n') {
+          pen.set_x(0);
+          pen.set_y(pen.y() + m_lineSkip);
+          previous = 0;
+          lineStart = wordStart = m_glyphs.size();
+          ++m_lines;
+          continue;
+        }
+
+        const auto* metrics = cache->try_metrics(glyph);
+        if (!metrics) {
+          continue;
+        }
+
+        if (kerning && previous != 0 && previousCache == cache) {
+          pen.set_x(pen.x() + font.kerning_amount(previous, glyph));
+        }
+
+        if (m_wrapWidth > 0 && glyph != ' ' && m_glyphs.size() > lineStart &&
+            pen.x() + metrics->advance > m_wrapWidth)
+        {
+          if (wordStart > lineStart && wordStart < m_glyphs.size()) {
+            // Move the current word to the next line
+            const auto offset = m_glyphs[wordStart].position.x();
+            for (auto moved = wordStart; moved < m_glyphs.size(); ++moved) {
+              auto& position = m_glyphs[moved].position;
+              position.set_x(position.x() - offset);
+              position.set_y(position.y() + m_lineSkip);
+            }
+
+            pen.set_x(pen.x() - offset);
+            lineStart = wordStart;
+          }
+          else {
+            pen.set_x(0);
+            previous = 0;
+            lineStart = wordStart = m_glyphs.size();
+          }
+
+          pen.set_y(pen.y() + m_lineSkip);
+          ++m_lines;
+        }
+
+        m_glyphs.push_back({glyph, pen, batch, tint});
+        pen.set_x(pen.x() + metrics->advance);
+
+        // Trailing spaces don't contribute to the width of a line
+        if (glyph == ' ') {
+          wordStart = m_glyphs.size();
+        }
+        else {
+          m_width = std::max(m_width, pen.x());
+        }
+
+        previous = glyph;
+        previousCache = cache;
+      }
+    }
+
+    for (const auto& [glyph, position, batch, tint] : m_glyphs) {
+      m_batches[batch].add_glyph(glyph, m_position + position, tint);
+    }
+  }
+
+  /**
+   * \brief Returns the text batches that contain the laid out glyphs.
+   *
+   * \return one text batch for each font cache, some of which might be empty.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto batches() const noexcept -> const std::vector<text_batch>&
+  {
+    return m_batches;
+  }
+
+  /**
+   * \brief Returns the text without any markup.
+   *
+   * \return the text, as Unicode glyphs.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto text() const noexcept -> const std::vector<unicode>&
+  {
+    return m_text;
+  }
+
+  /**
+   * \brief Returns the style spans of the text.
+   *
+   * \return the spans, ordered by their position in the text.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto spans() const noexcept -> const std::vector<span>&
+  {
+    return m_spans;
+  }
+
+  /**
+   * \brief Returns the current markup.
+   *
+   * \return the UTF-8 encoded markup.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto markup() const noexcept -> const std::string&
+  {
+    return m_markup;
+  }
+
+  /**
+   * \brief Returns the amount of glyphs that were laid out.
+   *
+   * \return the number of glyphs, excluding newlines and glyphs that aren't cached.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto glyph_count() const noexcept -> usize
+  {
+    return m_glyphs.size();
+  }
+
+  /**
+   * \brief Returns the amount of lines in the layout.
+   *
+   * \return the number of lines, including lines created by wrapping.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto line_count() const noexcept -> int
+  {
+    return m_lines;
+  }
+
+  /**
+   * \brief Returns the size of the area occupied by the laid out text.
+   *
+   * \return the size of the text, based on the glyph advances and the font line skips.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    if (m_lines == 0) {
+      return {0, 0};
+    }
+    else {
+      return {m_width, (m_lines - 1) * m_lineSkip + m_height};
+    }
+  }
+
+  /**
+   * \brief Returns the maximum width of a line.
+   *
+   * \return the wrap width, zero if wrapping is disabled.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto wrap_width() const noexcept -> int
+  {
+    return m_wrapWidth;
+  }
+
+  /**
+   * \brief Returns the position of the text.
+   *
+   * \return the position of the text.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto position() const noexcept -> ipoint
+  {
+    return m_position;
+  }
+
+ private:
+  struct positioned_glyph final
+  {
+    unicode glyph{};  ///< The glyph.
+    ipoint position;  ///< The pen position of the glyph, relative to the text position.
+    usize batch{};    ///< The index of the batch that the glyph is added to.
+    color tint;       ///< The color of the glyph.
+  };
+
+  font_set m_fonts;
+  std::string m_markup;
+  std::vector<unicode> m_text;
+  std::vector<span> m_spans;
+  std::vector<positioned_glyph> m_glyphs;
+  std::vector<text_batch> m_batches;
+  std::vector<color> m_colors;  ///< The stack of colors used when parsing.
+  ipoint m_position;
+  color m_color{colors::white};
+  int m_wrapWidth{};
+  int m_width{};
+  int m_height{};
+  int m_lines{};
+  int m_lineSkip{};
+
+  void parse()
+  {
+    m_text.clear();
+    m_spans.clear();
+    m_colors.assign(1, m_color);
+
+    int bold = 0;
+    int italic = 0;
+
+    const std::string_view markup{m_markup};
+    usize textBegin = 0;
+    usize index = 0;
+
+    const auto flush = [&](const usize textEnd) {
+      if (textEnd > textBegin) {
+        append(markup.substr(textBegin, textEnd - textBegin), bold > 0, italic > 0);
+      }
+    };
+
+    while (index < markup.size()) {
+      if (markup[index] != '[') {
+        ++index;
+        continue;
+      }
+
+      if (index + 1 < markup.size() && markup[index + 1] == '[') {
+        // Escaped bracket, the first one is kept as text
+        flush(index + 1);
+        index += 2;
+        textBegin = index;
+        continue;
+      }
+
+      const auto close = markup.find(']', index);
+      if (close == std::string_view::npos) {
+        break;
+      }
+
+      const auto tag = markup.substr(index + 1, close - index - 1);
+      auto recognized = true;
+
+      if (tag == "b") {
+        flush(index);
+        ++bold;
+      }
+      else if (tag == "/b") {
+        flush(index);
+        bold = std::max(0, bold - 1);
+      }
+      else if (tag == "i") {
+        flush(index);
+        ++italic;
+      }
+      else if (tag == "/i") {
+        flush(index);
+        italic = std::max(0, italic - 1);
+      }
+      else if (tag.substr(0, 6) == "color=") {
+        const auto value = tag.substr(6);
+        const auto tint = value.size() == 9 ? color::from_rgba(value) : color::from_rgb(value);
+        if (tint) {
+          flush(index);
+          m_colors.push_back(*tint);
+        }
+        else {
+          recognized = false;
+        }
+      }
+      else if (tag == "/color") {
+        flush(index);
+        if (m_colors.size() > 1) {
+          m_colors.pop_back();
+        }
+      }
+      else {
+        recognized = false;
+      }
+
+      if (recognized) {
+        index = close + 1;
+        textBegin = index;
+      }
+      else {
+        ++index;
+      }
+    }
+
+    flush(markup.size());
+  }
+
+  void append(const std::string_view str, const bool bold, const bool italic)
+  {
+    const auto begin = m_text.size();
+    for (const auto glyph : utf8_view{str}) {
+      m_text.push_back(glyph);
+    }
+
+    const auto end = m_text.size();
+    const auto& tint = m_colors.back();
+
+    if (!m_spans.empty()) {
+      auto& last = m_spans.back();
+      if (last.end == begin && last.bold == bold && last.italic == italic &&
+          last.tint == tint)
+      {
+        last.end = end;
+        return;
+      }
+    }
+
+    if (end > begin) {
+      m_spans.push_back({begin, end, bold, italic, tint});
+    }
+  }
+
+  [[nodiscard]] auto select_cache(const bool bold, const bool italic) const noexcept
+      -> const font_cache*
+  {
+    const font_cache* cache = nullptr;
+
+    if (bold && italic) {
+      cache = m_fonts.boldItalic ? m_fonts.boldItalic
+                                 : (m_fonts.bold ? m_fonts.bold : m_fonts.italic);
+    }
+    else if (bold) {
+      cache = m_fonts.bold;
+    }
+    else if (italic) {
+      cache = m_fonts.italic;
+    }
+
+    return cache ? cache : m_fonts.regular;
+  }
+
+  [[nodiscard]] auto batch_index(const font_cache* cache) const noexcept -> usize
+  {
+    for (usize index = 0; index < m_batches.size(); ++index) {
+      if (&m_batches[index].get_cache() == cache) {
+        return index;
+      }
+    }
+
+    return m_batches.size();
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_RICH_TEXT_HEADER
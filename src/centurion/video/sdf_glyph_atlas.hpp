@@ -0,0 +1,560 @@
+#ifndef CENTURION_SDF_GLYPH_ATLAS_HEADER
+#define CENTURION_SDF_GLYPH_ATLAS_HEADER
+
+#ifndef CENTURION_NO_SDL_TTF
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <algorithm>      // max
+#include <cassert>        // assert
+#include <optional>       // nullopt
+#include <unordered_map>  // unordered_map
+#include <utility>        // move, pair
+#include <vector>         // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/sdf_kernels.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "../thread/task_scheduler.hpp"
+#include "blend_mode.hpp"
+#include "colors.hpp"
+#include "font.hpp"
+#include "pixel_format.hpp"
+#include "scale_mode.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "unicode_string.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class sdf_glyph_atlas
+ *
+ * \brief A glyph atlas that stores signed distance fields, which can be rendered at any
+ * size.
+ *
+ * \details A `font_cache` stores glyphs rasterized at a single size, so text that is
+ * displayed at several sizes requires several caches. A signed distance field atlas instead
+ * stores, for every texel, the distance to the nearest glyph edge, which can be scaled
+ * with linear filtering while keeping the glyph shapes. One atlas, created with a fairly
+ * large font size, therefore serves all smaller (and moderately larger) sizes.
+ *
+ * \details The glyphs are rasterized with SDL_ttf, and the distance fields can be
+ * computed on the workers of a `task_scheduler`, since that is by far the most expensive
+ * part. The distance is stored in the alpha channel of white texels, where an alpha of
+ * 0.5 lies on the glyph edge, and the alpha reaches zero (or one) at `spread()` texels
+ * outside (or inside) of the glyph.
+ *
+ * \details Text is rendered with an `sdf_text_batch`, see
+ * `basic_renderer::render_text()`. The SDL renderer doesn't provide a way to threshold
+ * the alpha, so the edges get softer as the text is scaled up, in proportion to the spread.
+ * The atlas pages can also be drawn with custom shaders (e.g. with `SDL_GL_BindTexture()`)
+ * that apply `smoothstep()` around 0.5 for crisp edges at any size.
+ * \code{cpp}
+ *   cen::task_scheduler scheduler;
+ *
+ *   cen::sdf_glyph_atlas atlas{cen::font{"resources/fira_code.ttf", 48}};
+ *   atlas.add_basic_latin(renderer, scheduler);
+ *
+ *   cen::sdf_text_batch batch{atlas};
+ *   batch.add(cen::utf8_view{"Title"}, {10, 10}, 32);
+ *   batch.add(cen::utf8_view{"Caption"}, {10, 50}, 12);
+ *
+ *   renderer.render_text(batch);
+ * \endcode
+ *
+ * \note The atlas doesn't evict glyphs, pages are created as needed.
+ *
+ * \see `sdf_text_batch`
+ * \see `font_cache`
+ *
+ * \since 6.4.0
+ */
+class sdf_glyph_atlas final
+{
+ public:
+  /**
+   * \struct glyph_data
+   *
+   * \brief Describes a distance field glyph in the atlas.
+   *
+   * \details The source area includes the spread on every side of the rasterized glyph,
+   * and the metrics are those of the base font size.
+   *
+   * \since 6.4.0
+   */
+  struct glyph_data final
+  {
+    irect source;           ///< The area of the distance field in the atlas page.
+    glyph_metrics metrics;  ///< The metrics of the glyph at the base size.
+    usize page{};           ///< The index of the atlas page that contains the glyph.
+  };
+
+  /// The default distance, in texels, from a glyph edge to the extremes of the field.
+  inline constexpr static int default_spread = 6;
+
+  /**
+   * \brief Creates an empty atlas.
+   *
+   * \param font the font that provides the glyphs, its size is the base size.
+   * \param spread the distance, in texels, covered by the distance fields on each side of
+   * the glyph edges, must be greater than zero.
+   * \param pageSize the size of each atlas page, must be large enough to fit any glyph.
+   *
+   * \since 6.4.0
+   */
+  explicit sdf_glyph_atlas(font&& font,
+                           const int spread = default_spread,
+                           const iarea pageSize = default_page_size())
+      : m_font{std::move(font)}
+      , m_offsets{detail::make_sdf_offsets(spread)}
+      , m_pageSize{pageSize}
+      , m_spread{spread}
+  {
+    assert(pageSize.width > 0);
+    assert(pageSize.height > 0);
+  }
+
+  /// \name Glyph creation
+  /// \{
+
+  /**
+   * \brief Adds a glyph to the atlas.
+   *
+   * \details This function has no effect if the glyph isn't provided by the font, or if
+   * the glyph is already in the atlas.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the atlas pages.
+   * \param glyph the glyph that will be added.
+   *
+   * \throws cen_error if the glyph doesn't fit in an atlas page.
+   * \throws sdl_error if the glyph couldn't be rendered or uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_glyph(Renderer& renderer, const unicode glyph)
+  {
+    add_range(renderer, glyph, static_cast<unicode>(glyph + 1u));
+  }
+
+  /**
+   * \brief Adds the glyphs in the range [begin, end) to the atlas.
+   *
+   * \details Glyphs that aren't provided by the font, or that are already in the atlas,
+   * are skipped.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the atlas pages.
+   * \param begin the first glyph that will be included.
+   * \param end the "end" glyph in the range, will not be included.
+   *
+   * \throws cen_error if a glyph doesn't fit in an atlas page.
+   * \throws sdl_error if a glyph couldn't be rendered or uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_range(Renderer& renderer, const unicode begin, const unicode end)
+  {
+    add_glyphs(renderer, nullptr, begin, end);
+  }
+
+  /**
+   * \brief Adds the glyphs in the range [begin, end) to the atlas, and computes the
+   * distance fields on the worker threads of a task scheduler.
+   *
+   * \details The glyphs are rasterized and uploaded on the calling thread, which must be
+   * the thread that uses the renderer, only the distance fields are computed in parallel.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the atlas pages.
+   * \param scheduler the scheduler that computes the distance fields.
+   * \param begin the first glyph that will be included.
+   * \param end the "end" glyph in the range, will not be included.
+   *
+   * \throws cen_error if a glyph doesn't fit in an atlas page.
+   * \throws sdl_error if a glyph couldn't be rendered or uploaded.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_range(Renderer& renderer,
+                 task_scheduler& scheduler,
+                 const unicode begin,
+                 const unicode end)
+  {
+    add_glyphs(renderer, &scheduler, begin, end);
+  }
+
+  /**
+   * \brief Adds all printable basic latin characters to the atlas.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the atlas pages.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_basic_latin(Renderer& renderer)
+  {
+    add_range(renderer, 0x20, 0x7F);
+  }
+
+  /**
+   * \brief Adds all printable basic latin characters to the atlas, and computes the
+   * distance fields on the worker threads of a task scheduler.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the atlas pages.
+   * \param scheduler the scheduler that computes the distance fields.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void add_basic_latin(Renderer& renderer, task_scheduler& scheduler)
+  {
+    add_range(renderer, scheduler, 0x20, 0x7F);
+  }
+
+  /// \} End of glyph creation
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the data associated with a glyph, if it is in the atlas.
+   *
+   * \param glyph the glyph to look up.
+   *
+   * \return a pointer to the glyph data; a null pointer if the glyph isn't in the atlas.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto try_at(const unicode glyph) const -> const glyph_data*
+  {
+    if (const auto it = m_glyphs.find(glyph); it != m_glyphs.end()) {
+      return &it->second;
+    }
+    else {
+      return nullptr;
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not a glyph is in the atlas.
+   *
+   * \param glyph the glyph to check.
+   *
+   * \return `true` if the glyph is in the atlas; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto has(const unicode glyph) const -> bool
+  {
+    return m_glyphs.count(glyph) != 0;
+  }
+
+  /**
+   * \brief Returns the amount of glyphs in the atlas.
+   *
+   * \return the number of glyphs.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_glyphs.size();
+  }
+
+  /**
+   * \brief Returns the factor by which the glyphs are scaled for a font size.
+   *
+   * \param size the font size that is rendered.
+   *
+   * \return the ratio between the supplied size and the base size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto scale(const float size) const noexcept -> float
+  {
+    return size / static_cast<float>(m_font.size());
+  }
+
+  /**
+   * \brief Returns the font size that the glyphs were rasterized at.
+   *
+   * \return the size of the font.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto base_size() const noexcept -> int
+  {
+    return m_font.size();
+  }
+
+  /**
+   * \brief Returns the distance covered by the distance fields on each side of the edges.
+   *
+   * \return the spread, in texels at the base size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto spread() const noexcept -> int
+  {
+    return m_spread;
+  }
+
+  /**
+   * \brief Returns an atlas page texture.
+   *
+   * \param index the index of the page.
+   *
+   * \return the page texture.
+   *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page(const usize index) const -> const texture&
+  {
+    return m_pages.at(index).sheet;
+  }
+
+  /**
+   * \brief Returns the amount of atlas pages.
+   *
+   * \return the number of atlas pages.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page_count() const noexcept -> usize
+  {
+    return m_pages.size();
+  }
+
+  /**
+   * \brief Returns the font used by the atlas.
+   *
+   * \return the font at the base size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_font() const noexcept -> const font&
+  {
+    return m_font;
+  }
+
+  /**
+   * \brief Returns the default size of the atlas pages.
+   *
+   * \return the default page size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_page_size() noexcept -> iarea
+  {
+    return {1024, 1024};
+  }
+
+  /// \} End of queries
+
+ private:
+  struct page_data final
+  {
+    texture sheet;    ///< The texture that holds the distance fields.
+    int cursorX{};    ///< The x-coordinate of the next glyph in the current row.
+    int cursorY{};    ///< The y-coordinate of the current row.
+    int rowHeight{};  ///< The height of the tallest glyph in the current row.
+  };
+
+  struct pending_glyph final
+  {
+    unicode glyph{};
+    glyph_metrics metrics{};
+    iarea size{};              ///< The size of the rasterized glyph.
+    std::vector<u8> coverage;  ///< The alpha values of the rasterized glyph.
+    std::vector<u8> field;     ///< The padded distance field.
+  };
+
+  /// The amount of empty texels between glyphs, avoids bleeding when filtering.
+  inline constexpr static int padding = 1;
+
+  font m_font;
+  std::vector<detail::sdf_offset> m_offsets;
+  std::unordered_map<unicode, glyph_data> m_glyphs;
+  std::vector<page_data> m_pages;
+  std::vector<u32> m_scratch;
+  iarea m_pageSize;
+  int m_spread{};
+
+  template <typename Renderer>
+  void add_glyphs(Renderer& renderer,
+                  task_scheduler* scheduler,
+                  const unicode begin,
+                  const unicode end)
+  {
+    CENTURION_PROFILE_ZONE("sdf_glyph_atlas::add_glyphs");
+
+    // SDL_ttf isn't thread-safe, so the glyphs are rasterized on the calling thread
+    std::vector<pending_glyph> pending;
+    for (auto glyph = begin; glyph < end; ++glyph) {
+      if (!has(glyph) && m_font.is_glyph_provided(glyph)) {
+        pending.push_back(rasterize(glyph));
+      }
+    }
+
+    const auto compute = [&](const usize index) {
+      auto& entry = pending[index];
+      const auto fieldWidth = entry.size.width + 2 * m_spread;
+      const auto fieldHeight = entry.size.height + 2 * m_spread;
+
+      entry.field.resize(static_cast<usize>(fieldWidth) * static_cast<usize>(fieldHeight));
+      detail::make_distance_field(entry.coverage.data(),
+                                  entry.size.width,
+                                  entry.size.height,
+                                  m_spread,
+                                  m_offsets,
+                                  entry.field.data());
+    };
+
+    if (scheduler) {
+      scheduler->parallel_for(0, pending.size(), compute, 1);
+    }
+    else {
+      for (usize index = 0; index < pending.size(); ++index) {
+        compute(index);
+      }
+    }
+
+    for (const auto& entry : pending) {
+      upload(renderer, entry);
+    }
+  }
+
+  [[nodiscard]] auto rasterize(const unicode glyph) -> pending_glyph
+  {
+    const surface rendered{TTF_RenderGlyph_Blended(m_font.get(), glyph, colors::white.get())};
+    auto converted = rendered.convert(pixel_format::argb8888);
+
+    pending_glyph entry;
+    entry.glyph = glyph;
+    entry.metrics = m_font.get_metrics(glyph).value();
+    entry.size = converted.size();
+    entry.coverage.resize(static_cast<usize>(entry.size.width) *
+                          static_cast<usize>(entry.size.height));
+
+    if (!converted.lock()) {
+      throw sdl_error{};
+    }
+
+    const auto* pixels = static_cast<const u8*>(converted.pixels());
+    for (auto y = 0; y < entry.size.height; ++y) {
+      const auto* row = reinterpret_cast<const u32*>(pixels + y * converted.pitch());
+      for (auto x = 0; x < entry.size.width; ++x) {
+        entry.coverage[static_cast<usize>(y * entry.size.width + x)] =
+            static_cast<u8>(row[x] >> 24u);
+      }
+    }
+
+    converted.unlock();
+
+    return entry;
+  }
+
+  template <typename Renderer>
+  void upload(Renderer& renderer, const pending_glyph& entry)
+  {
+    const iarea size{entry.size.width + 2 * m_spread, entry.size.height + 2 * m_spread};
+    const auto [page, area] = allocate(renderer, size);
+
+    m_scratch.resize(entry.field.size());
+    for (usize index = 0; index < entry.field.size(); ++index) {
+      m_scratch[index] = (u32{entry.field[index]} << 24u) | 0x00FFFFFFu;
+    }
+
+    if (!m_pages[page].sheet.update(area, m_scratch.data(), size.width * 4)) {
+      throw sdl_error{};
+    }
+
+    renderer.record_upload(m_scratch.size() * 4);
+    m_glyphs.try_emplace(entry.glyph, glyph_data{area, entry.metrics, page});
+  }
+
+  template <typename Renderer>
+  [[nodiscard]] auto allocate(Renderer& renderer, const iarea size) -> std::pair<usize, irect>
+  {
+    if (size.width > m_pageSize.width || size.height > m_pageSize.height) {
+      throw cen_error{"Glyph does not fit in a glyph atlas page!"};
+    }
+
+    if (!m_pages.empty()) {
+      auto& page = m_pages.back();
+
+      if (page.cursorX + size.width > m_pageSize.width) {
+        page.cursorX = 0;
+        page.cursorY += page.rowHeight + padding;
+        page.rowHeight = 0;
+      }
+
+      if (page.cursorY + size.height <= m_pageSize.height) {
+        const irect area{{page.cursorX, page.cursorY}, size};
+
+        page.cursorX += size.width + padding;
+        page.rowHeight = std::max(page.rowHeight, size.height);
+
+        return {m_pages.size() - 1, area};
+      }
+    }
+
+    auto& page = m_pages.emplace_back(create_page(renderer));
+    page.cursorX = size.width + padding;
+    page.rowHeight = size.height;
+
+    return {m_pages.size() - 1, irect{{0, 0}, size}};
+  }
+
+  template <typename Renderer>
+  [[nodiscard]] auto create_page(Renderer& renderer) -> page_data
+  {
+    texture sheet{renderer, pixel_format::argb8888, texture_access::no_lock, m_pageSize};
+    sheet.set_blend_mode(blend_mode::blend);
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+    sheet.set_scale_mode(scale_mode::linear);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+    // Static textures have undefined contents, so we clear the page once up front
+    const std::vector<u32> blank(static_cast<usize>(m_pageSize.width) *
+                                     static_cast<usize>(m_pageSize.height),
+                                 0x00FFFFFFu);
+    if (!sheet.update(std::nullopt, blank.data(), m_pageSize.width * 4)) {
+      throw sdl_error{};
+    }
+
+    renderer.record_upload(blank.size() * 4);
+
+    return page_data{std::move(sheet)};
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_SDF_GLYPH_ATLAS_HEADER
@@ -0,0 +1,286 @@
+#ifndef CENTURION_SDF_TEXT_BATCH_HEADER
+#define CENTURION_SDF_TEXT_BATCH_HEADER
+
+#include <SDL2/SDL.h>
+
+#ifndef CENTURION_NO_SDL_TTF
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "sdf_glyph_atlas.hpp"
+#include "unicode_string.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class sdf_text_batch
+ *
+ * \brief Collects scaled glyph quads for strings that are rendered with a signed distance
+ * field atlas.
+ *
+ * \details Like `text_batch`, the glyphs are stored as vertex and index buffers for each
+ * atlas page, which are submitted with one `SDL_RenderGeometry` call for each used page by
+ * `basic_renderer::render_text()`. Unlike `text_batch`, every string can be added with a
+ * different font size.
+ *
+ * \details The buffers keep their capacity when the batch is cleared, so a batch that is
+ * rebuilt every frame will not allocate any memory once it has grown large enough.
+ *
+ * \note Glyphs that aren't in the atlas are ignored.
+ *
+ * \note The associated atlas must outlive the batch.
+ *
+ * \see `sdf_glyph_atlas`
+ * \see `basic_renderer::render_text()`
+ *
+ * \since 6.4.0
+ */
+class sdf_text_batch final
+{
+ public:
+  /**
+   * \brief Creates an empty batch.
+   *
+   * \param atlas the atlas that provides the distance field glyphs.
+   *
+   * \since 6.4.0
+   */
+  explicit sdf_text_batch(const sdf_glyph_atlas& atlas) noexcept : m_atlas{&atlas}
+  {}
+
+  /**
+   * \brief Adds the glyphs of a string to the batch.
+   *
+   * \details The glyphs are positioned in the same way as with `text_batch::add()`, but
+   * with all metrics scaled to the supplied font size.
+   *
+   * \note This function is sensitive to newline-characters.
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters, e.g. `unicode_string` or `utf8_view`.
+   *
+   * \param str the string that will be added.
+   * \param position the position of the text.
+   * \param size the font size that the text is rendered at, must be greater than zero.
+   * \param tint the color that is used to modulate the glyphs.
+   *
+   * \since 6.4.0
+   */
+  template <typename String>
+  void add(const String& str,
+           fpoint position,
+           const float size,
+           const color& tint = colors::white)
+  {
+    assert(size > 0);
+
+    const auto scale = m_atlas->scale(size);
+    const auto lineSkip = static_cast<float>(m_atlas->get_font().line_skip()) * scale;
+    const auto originalX = position.x();
+
+    for (const unicode glyph : str) {
+      if (glyph == '\n') {
+        position.set_x(originalX);
+        position.set_y(position.y() + lineSkip);
+      }
+      else {
+        position.set_x(add_glyph(glyph, position, scale, tint));
+      }
+    }
+  }
+
+  /**
+   * \brief Removes all glyphs from the batch.
+   *
+   * \details The capacity of the internal buffers is retained.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    for (auto& page : m_pages) {
+      page.vertices.clear();
+      page.indices.clear();
+    }
+  }
+
+  /**
+   * \brief Returns the amount of glyphs in the batch.
+   *
+   * \return the number of glyphs.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto glyph_count() const noexcept -> usize
+  {
+    usize count = 0;
+    for (const auto& page : m_pages) {
+      count += page.vertices.size() / 4u;
+    }
+    return count;
+  }
+
+  /**
+   * \brief Indicates whether or not the batch contains any glyphs.
+   *
+   * \return `true` if the batch is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return glyph_count() == 0;
+  }
+
+  /**
+   * \brief Returns the amount of atlas pages that the batch has buffers for.
+   *
+   * \return the number of atlas pages, some of which might have empty buffers.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page_count() const noexcept -> usize
+  {
+    return m_pages.size();
+  }
+
+  /**
+   * \brief Returns the vertices associated with an atlas page.
+   *
+   * \param page the index of the atlas page.
+   *
+   * \return the vertices of the glyph quads on the page.
+   *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto vertices(const usize page) const -> const std::vector<SDL_Vertex>&
+  {
+    return m_pages.at(page).vertices;
+  }
+
+  /**
+   * \brief Returns the indices associated with an atlas page.
+   *
+   * \param page the index of the atlas page.
+   *
+   * \return the indices of the glyph quads on the page, six for each glyph.
+   *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto indices(const usize page) const -> const std::vector<int>&
+  {
+    return m_pages.at(page).indices;
+  }
+
+  /**
+   * \brief Returns the atlas associated with the batch.
+   *
+   * \return the associated atlas.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_atlas() const noexcept -> const sdf_glyph_atlas&
+  {
+    return *m_atlas;
+  }
+
+ private:
+  struct page_buffers final
+  {
+    std::vector<SDL_Vertex> vertices;  ///< Four vertices for each glyph.
+    std::vector<int> indices;          ///< Six indices for each glyph.
+    farea size{};                      ///< The size of the atlas page texture.
+  };
+
+  const sdf_glyph_atlas* m_atlas{};
+  std::vector<page_buffers> m_pages;
+
+  auto add_glyph(const unicode glyph,
+                 const fpoint position,
+                 const float scale,
+                 const color& tint) -> float
+  {
+    if (const auto* data = m_atlas->try_at(glyph)) {
+      const auto& [source, metrics, page] = *data;
+
+      // The distance fields are padded by the spread on every side
+      const auto outline = m_atlas->get_font().outline();
+      const auto spread = m_atlas->spread();
+      const auto x = static_cast<float>(metrics.minX - outline - spread);
+      const auto y = static_cast<float>(-outline - spread);
+
+      const frect dst{position.x() + x * scale,
+                      position.y() + y * scale,
+                      static_cast<float>(source.width()) * scale,
+                      static_cast<float>(source.height()) * scale};
+      add_quad(page, source, dst, tint);
+
+      return position.x() + static_cast<float>(metrics.advance) * scale;
+    }
+    else {
+      return position.x();
+    }
+  }
+
+  void add_quad(const usize page, const irect& source, const frect& dst, const color& tint)
+  {
+    auto& buffers = get_buffers(page);
+
+    const auto u0 = static_cast<float>(source.x()) / buffers.size.width;
+    const auto v0 = static_cast<float>(source.y()) / buffers.size.height;
+    const auto u1 = static_cast<float>(source.max_x()) / buffers.size.width;
+    const auto v1 = static_cast<float>(source.max_y()) / buffers.size.height;
+
+    const auto x0 = dst.x();
+    const auto y0 = dst.y();
+    const auto x1 = dst.max_x();
+    const auto y1 = dst.max_y();
+
+    const auto& rgba = tint.get();
+    const auto first = static_cast<int>(buffers.vertices.size());
+
+    buffers.vertices.push_back({{x0, y0}, rgba, {u0, v0}});
+    buffers.vertices.push_back({{x1, y0}, rgba, {u1, v0}});
+    buffers.vertices.push_back({{x1, y1}, rgba, {u1, v1}});
+    buffers.vertices.push_back({{x0, y1}, rgba, {u0, v1}});
+
+    buffers.indices.push_back(first);
+    buffers.indices.push_back(first + 1);
+    buffers.indices.push_back(first + 2);
+    buffers.indices.push_back(first + 2);
+    buffers.indices.push_back(first + 3);
+    buffers.indices.push_back(first);
+  }
+
+  [[nodiscard]] auto get_buffers(const usize page) -> page_buffers&
+  {
+    while (m_pages.size() <= page) {
+      auto& buffers = m_pages.emplace_back();
+      buffers.size = cast<farea>(m_atlas->page(m_pages.size() - 1).size());
+    }
+
+    return m_pages[page];
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_SDF_TEXT_BATCH_HEADER
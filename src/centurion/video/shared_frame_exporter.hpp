@@ -0,0 +1,559 @@
+#ifndef CENTURION_SHARED_FRAME_EXPORTER_HEADER
+#define CENTURION_SHARED_FRAME_EXPORTER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <atomic>    // atomic, memory_order
+#include <cassert>   // assert
+#include <new>       // launder
+#include <optional>  // optional, nullopt
+#include <string>    // string
+#include <utility>   // move
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/to_underlying.hpp"
+#include "../math/area.hpp"
+#include "../system/counter.hpp"
+#include "../system/shared_memory.hpp"
+#include "pixel_format.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct shared_frame_slot
+ *
+ * \brief Describes a frame in the ring of a shared frame exporter.
+ *
+ * \since 6.4.0
+ */
+struct shared_frame_slot final
+{
+  u64 frame{};      ///< The index of the frame, including dropped frames.
+  u64 timestamp{};  ///< The value of the performance counter when the frame was captured.
+};
+
+/**
+ * \struct shared_frame_header
+ *
+ * \brief The header at the start of the shared memory used by a shared frame exporter.
+ *
+ * \details The header is followed by `capacity` slots, and the pixel data of the frames
+ * starts at `dataOffset`, with `frameStride` bytes between consecutive frames. The ring
+ * is a single-producer, single-consumer queue: the exporter increments `writeIndex`
+ * after a frame has been written, and the consumer increments `readIndex` once it's done
+ * with the oldest frame. The frame at ring index `i` is stored in slot `i % capacity`.
+ *
+ * \details Consumers written in other languages can use this layout directly, it only
+ * consists of 32-bit and 64-bit integers in the native byte order.
+ *
+ * \since 6.4.0
+ */
+struct shared_frame_header final
+{
+  u32 magic{};             ///< Identifies the memory, always `shared_frame_magic`.
+  u32 version{};           ///< The version of the layout.
+  u32 width{};             ///< The width of the frames, in pixels.
+  u32 height{};            ///< The height of the frames, in pixels.
+  u32 pitch{};             ///< The length of a row of pixels, in bytes.
+  u32 format{};            ///< The `SDL_PixelFormatEnum` value of the frames.
+  u32 capacity{};          ///< The amount of frames in the ring.
+  u32 reserved{};          ///< Unused, zero.
+  u64 frameStride{};       ///< The distance between the pixel data of two frames.
+  u64 dataOffset{};        ///< The offset of the pixel data of the first frame.
+  u64 counterFrequency{};  ///< The frequency of the performance counter, in Hz.
+
+  alignas(64) std::atomic<u64> writeIndex{};  ///< The amount of written frames.
+  alignas(64) std::atomic<u64> readIndex{};   ///< The amount of consumed frames.
+};
+
+static_assert(std::atomic<u64>::is_always_lock_free,
+              "Shared frame rings require address-free 64-bit atomics!");
+
+/// Identifies the shared memory of a frame exporter, spells "CENF" in little endian.
+inline constexpr u32 shared_frame_magic = 0x464E'4543;
+
+/// The current version of the shared frame layout.
+inline constexpr u32 shared_frame_version = 1;
+
+/**
+ * \struct shared_frame
+ *
+ * \brief A frame that has been read from a shared frame ring.
+ *
+ * \since 6.4.0
+ */
+struct shared_frame final
+{
+  const u8* pixels{};  ///< The pixel data, in the shared memory.
+  u64 frame{};         ///< The index of the frame, including dropped frames.
+  u64 timestamp{};     ///< The value of the performance counter when it was captured.
+};
+
+/**
+ * \class shared_frame_exporter
+ *
+ * \brief Exports rendered frames to another process through a ring in shared memory.
+ *
+ * \details Piping frames to an external encoder copies each frame several times, between
+ * the surface, the pipe buffers and the encoder. A frame exporter instead reads the
+ * pixels of the rendering target directly into a ring of frames in shared memory, from
+ * which the encoder process reads them in place. The ring doesn't use locks, the producer
+ * and consumer only communicate through two atomic indices in the header, see
+ * `shared_frame_header`.
+ * \code{cpp}
+ *   // In the game
+ *   cen::shared_frame_exporter exporter{"game-frames",
+ *                                       renderer.output_size(),
+ *                                       cen::pixel_format::bgra8888};
+ *   while (running) {
+ *     ...
+ *     exporter.capture(renderer);
+ *     renderer.present();
+ *   }
+ *
+ *   // In the encoder
+ *   cen::shared_frame_reader reader{"game-frames"};
+ *   while (reader) {
+ *     if (const auto frame = reader.acquire()) {
+ *       encode(frame->pixels, frame->timestamp);
+ *       reader.release();
+ *     }
+ *   }
+ * \endcode
+ *
+ * \details If the consumer can't keep up and the ring is full, frames are dropped
+ * instead of stalling the rendering thread, like with `frame_recorder`.
+ *
+ * \note The timestamps are performance counter values, which are comparable between
+ * processes on the same machine. The shared memory is removed when the exporter is
+ * destroyed.
+ *
+ * \see `shared_frame_reader`
+ * \see `frame_recorder`
+ * \see `shared_memory`
+ *
+ * \since 6.4.0
+ */
+class shared_frame_exporter final
+{
+ public:
+  /**
+   * \brief Creates a frame exporter and its shared memory.
+   *
+   * \param name the name of the shared memory, which the consumer uses to open it.
+   * \param size the size of the exported frames, i.e. the output size of the renderer.
+   * \param format the pixel format of the exported frames, must not be a FOURCC format.
+   * \param capacity the amount of frames in the ring, must be greater than zero.
+   *
+   * \throws cen_error if the size or format is invalid, or if the shared memory cannot be
+   * created.
+   *
+   * \since 6.4.0
+   */
+  shared_frame_exporter(std::string name,
+                        const iarea size,
+                        const pixel_format format,
+                        const u32 capacity = 3)
+      : m_memory{shared_memory::create(std::move(name), memory_size(size, format, capacity))}
+      , m_size{size}
+      , m_format{format}
+  {
+    if (!m_memory) {
+      throw cen_error{"Failed to create shared memory for frame exporter!"};
+    }
+
+    const auto pitch = row_pitch(size, format);
+
+    m_header = new (m_memory.data()) shared_frame_header{};
+    m_header->magic = shared_frame_magic;
+    m_header->version = shared_frame_version;
+    m_header->width = static_cast<u32>(size.width);
+    m_header->height = static_cast<u32>(size.height);
+    m_header->pitch = static_cast<u32>(pitch);
+    m_header->format = to_underlying(format);
+    m_header->capacity = capacity;
+    m_header->frameStride = align(pitch * static_cast<u64>(size.height));
+    m_header->dataOffset = slots_end(capacity);
+    m_header->counterFrequency = counter::frequency();
+
+    auto* slots = m_memory.data() + sizeof(shared_frame_header);
+    for (u32 index = 0; index < capacity; ++index) {
+      new (slots + index * sizeof(shared_frame_slot)) shared_frame_slot{};
+    }
+
+    m_slots = std::launder(reinterpret_cast<shared_frame_slot*>(slots));
+  }
+
+  shared_frame_exporter(const shared_frame_exporter&) = delete;
+
+  auto operator=(const shared_frame_exporter&) -> shared_frame_exporter& = delete;
+
+  /**
+   * \brief Reads the current rendering target into the next free frame of the ring.
+   *
+   * \details The frame is published to the consumer once the pixels have been read.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be captured, its output size must match the
+   * size of the exporter.
+   *
+   * \return `success` if the frame was exported; `failure` if the frame was dropped or the
+   * pixels couldn't be read.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto capture(const Renderer& renderer) noexcept -> result
+  {
+    const auto frame = m_frameIndex++;
+
+    const auto write = m_header->writeIndex.load(std::memory_order_relaxed);
+    const auto read = m_header->readIndex.load(std::memory_order_acquire);
+    if (write - read >= m_header->capacity || renderer.output_size() != m_size) {
+      ++m_dropped;
+      return failure;
+    }
+
+    const auto slot = static_cast<usize>(write % m_header->capacity);
+    auto* pixels = frame_data(slot);
+
+    if (SDL_RenderReadPixels(renderer.get(),
+                             nullptr,
+                             to_underlying(m_format),
+                             pixels,
+                             static_cast<int>(m_header->pitch)) != 0) {
+      ++m_dropped;
+      return failure;
+    }
+
+    m_slots[slot].frame = frame;
+    m_slots[slot].timestamp = counter::now();
+
+    // Publishes the pixels and the slot to the consumer
+    m_header->writeIndex.store(write + 1, std::memory_order_release);
+
+    ++m_exported;
+    return success;
+  }
+
+  /**
+   * \brief Returns the amount of exported frames that the consumer hasn't released yet.
+   *
+   * \return the number of pending frames.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> u64
+  {
+    const auto read = m_header->readIndex.load(std::memory_order_acquire);
+    return m_header->writeIndex.load(std::memory_order_relaxed) - read;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been exported.
+   *
+   * \return the number of frames that were written to the ring.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto exported() const noexcept -> u64
+  {
+    return m_exported;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been dropped.
+   *
+   * \return the number of frames that were dropped, either because the ring was full or
+   * because the pixels couldn't be read.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> u64
+  {
+    return m_dropped;
+  }
+
+  /**
+   * \brief Returns the amount of frames in the ring.
+   *
+   * \return the capacity of the exporter.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> u32
+  {
+    return m_header->capacity;
+  }
+
+  /**
+   * \brief Returns the size of the exported frames.
+   *
+   * \return the frame size, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the pixel format of the exported frames.
+   *
+   * \return the frame pixel format.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto format() const noexcept -> pixel_format
+  {
+    return m_format;
+  }
+
+  /**
+   * \brief Returns the name of the shared memory.
+   *
+   * \return the name of the shared memory, as used by the operating system.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto name() const noexcept -> const std::string&
+  {
+    return m_memory.name();
+  }
+
+ private:
+  shared_memory m_memory;
+  shared_frame_header* m_header{};
+  shared_frame_slot* m_slots{};
+  iarea m_size{};
+  pixel_format m_format{};
+  u64 m_frameIndex{};
+  u64 m_exported{};
+  u64 m_dropped{};
+
+  [[nodiscard]] static auto row_pitch(const iarea size, const pixel_format format) -> u64
+  {
+    const auto bytesPerPixel = SDL_BYTESPERPIXEL(to_underlying(format));
+    if (size.width <= 0 || size.height <= 0 || bytesPerPixel == 0 ||
+        SDL_ISPIXELFORMAT_FOURCC(to_underlying(format))) {
+      throw cen_error{"Invalid frame size or pixel format for shared frame exporter!"};
+    }
+
+    return static_cast<u64>(size.width) * static_cast<u64>(bytesPerPixel);
+  }
+
+  [[nodiscard]] static auto memory_size(const iarea size,
+                                        const pixel_format format,
+                                        const u32 capacity) -> usize
+  {
+    assert(capacity > 0);
+
+    const auto stride = align(row_pitch(size, format) * static_cast<u64>(size.height));
+    return static_cast<usize>(slots_end(capacity) + stride * capacity);
+  }
+
+  // The offset of the first frame, after the header and the slots
+  [[nodiscard]] constexpr static auto slots_end(const u32 capacity) noexcept -> u64
+  {
+    return align(sizeof(shared_frame_header) + capacity * sizeof(shared_frame_slot));
+  }
+
+  [[nodiscard]] auto frame_data(const usize slot) const noexcept -> u8*
+  {
+    return m_memory.data() + m_header->dataOffset + slot * m_header->frameStride;
+  }
+
+  // Cache line alignment, so that the frames don't share lines with the header
+  [[nodiscard]] constexpr static auto align(const u64 size) noexcept -> u64
+  {
+    return (size + 63u) & ~u64{63};
+  }
+};
+
+/**
+ * \class shared_frame_reader
+ *
+ * \brief Reads frames from the shared memory of a `shared_frame_exporter`.
+ *
+ * \details This is meant to be used by the consumer process, e.g. an encoder written with
+ * the library. Frames are read in the order they were exported, directly from the shared
+ * memory, and must be released once they have been consumed so that the exporter can
+ * reuse their memory.
+ *
+ * \note Like `shared_memory`, this class doesn't throw if the memory can't be opened,
+ * instead the reader is null.
+ *
+ * \see `shared_frame_exporter`
+ *
+ * \since 6.4.0
+ */
+class shared_frame_reader final
+{
+ public:
+  /**
+   * \brief Opens the shared memory of a frame exporter.
+   *
+   * \param name the name of the shared memory, as passed to the exporter.
+   *
+   * \since 6.4.0
+   */
+  explicit shared_frame_reader(std::string name) noexcept
+      : m_memory{shared_memory::open(std::move(name))}
+  {
+    if (!m_memory || m_memory.size() < sizeof(shared_frame_header)) {
+      return;
+    }
+
+    auto* header = std::launder(reinterpret_cast<shared_frame_header*>(m_memory.data()));
+    if (header->magic != shared_frame_magic || header->version != shared_frame_version ||
+        header->capacity == 0 ||
+        header->dataOffset + header->frameStride * header->capacity > m_memory.size()) {
+      return;
+    }
+
+    m_header = header;
+    const auto* slots = m_memory.data() + sizeof(shared_frame_header);
+    m_slots = std::launder(reinterpret_cast<const shared_frame_slot*>(slots));
+  }
+
+  /**
+   * \brief Returns the oldest frame that hasn't been released.
+   *
+   * \details The frame stays valid until it's released.
+   *
+   * \pre The reader must not be null.
+   *
+   * \return the oldest unreleased frame; an empty optional if no frame is available.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto acquire() const noexcept -> std::optional<shared_frame>
+  {
+    assert(m_header);
+
+    const auto read = m_header->readIndex.load(std::memory_order_relaxed);
+    if (m_header->writeIndex.load(std::memory_order_acquire) == read) {
+      return std::nullopt;
+    }
+
+    const auto slot = static_cast<usize>(read % m_header->capacity);
+    const auto* pixels =
+        m_memory.data() + m_header->dataOffset + slot * m_header->frameStride;
+
+    return shared_frame{pixels, m_slots[slot].frame, m_slots[slot].timestamp};
+  }
+
+  /**
+   * \brief Releases the oldest frame, so that the exporter can reuse its memory.
+   *
+   * \pre The reader must not be null.
+   *
+   * \return `success` if a frame was released; `failure` if no frame was available.
+   *
+   * \since 6.4.0
+   */
+  auto release() noexcept -> result
+  {
+    assert(m_header);
+
+    const auto read = m_header->readIndex.load(std::memory_order_relaxed);
+    if (m_header->writeIndex.load(std::memory_order_acquire) == read) {
+      return failure;
+    }
+
+    // Hands the memory of the frame back to the exporter
+    m_header->readIndex.store(read + 1, std::memory_order_release);
+    return success;
+  }
+
+  /**
+   * \brief Returns the amount of frames that are available.
+   *
+   * \pre The reader must not be null.
+   *
+   * \return the number of exported frames that haven't been released.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto available() const noexcept -> u64
+  {
+    assert(m_header);
+    const auto write = m_header->writeIndex.load(std::memory_order_acquire);
+    return write - m_header->readIndex.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the header of the shared memory, which describes the frames.
+   *
+   * \pre The reader must not be null.
+   *
+   * \return the shared frame header.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto header() const noexcept -> const shared_frame_header&
+  {
+    assert(m_header);
+    return *m_header;
+  }
+
+  /**
+   * \brief Returns the size of the frames.
+   *
+   * \pre The reader must not be null.
+   *
+   * \return the frame size, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    assert(m_header);
+    return {static_cast<int>(m_header->width), static_cast<int>(m_header->height)};
+  }
+
+  /**
+   * \brief Returns the pixel format of the frames.
+   *
+   * \pre The reader must not be null.
+   *
+   * \return the frame pixel format.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto format() const noexcept -> pixel_format
+  {
+    assert(m_header);
+    return static_cast<pixel_format>(m_header->format);
+  }
+
+  /**
+   * \brief Indicates whether or not the shared memory of an exporter was opened.
+   *
+   * \return `true` if the reader can read frames; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return m_header != nullptr;
+  }
+
+ private:
+  shared_memory m_memory;
+  shared_frame_header* m_header{};
+  const shared_frame_slot* m_slots{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_SHARED_FRAME_EXPORTER_HEADER
@@ -0,0 +1,376 @@
+#ifndef CENTURION_SPRITE_BATCH_HEADER
+#define CENTURION_SPRITE_BATCH_HEADER
+
+#include <SDL2/SDL.h>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <algorithm>  // stable_sort
+#include <cmath>      // sin, cos
+#include <tuple>      // tie
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/affine_transform.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct sprite_batch_stats
+ *
+ * \brief Provides statistics about the most recent flush of a sprite batch.
+ *
+ * \since 6.4.0
+ */
+struct sprite_batch_stats final
+{
+  usize sprites{};    ///< The amount of rendered sprites.
+  usize drawCalls{};  ///< The amount of `SDL_RenderGeometry` calls.
+  usize vertices{};   ///< The amount of submitted vertices.
+  usize indices{};    ///< The amount of submitted indices.
+};
+
+/**
+ * \class sprite_batch
+ *
+ * \brief Collects textured quads that are rendered with as few draw calls as possible.
+ *
+ * \details Sprites are accumulated with `add()` and rendered with `flush()`. When the batch
+ * is flushed, the sprites are (optionally) sorted by texture and blend mode, and each run
+ * of sprites that share a texture and blend mode is submitted with a single
+ * `SDL_RenderGeometry` call.
+ *
+ * \details The internal buffers keep their capacity between flushes, so a batch that is
+ * used every frame stops allocating once it has grown large enough.
+ *
+ * \note Sorting changes the order in which overlapping sprites are drawn. Disable sorting
+ * with `set_sorting()` if the submission order matters, in which case only consecutive
+ * sprites that share a texture are merged.
+ *
+ * \note The textures must outlive the flush of the batch.
+ *
+ * \see `sprite_batch_stats`
+ *
+ * \since 6.4.0
+ */
+class sprite_batch final
+{
+ public:
+  /**
+   * \brief Adds a sprite to the batch.
+   *
+   * \details The blend mode of the texture is captured when the sprite is added, and is
+   * applied to the texture when the batch is flushed.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param texture the texture that contains the sprite.
+   * \param source the area of the texture that will be rendered.
+   * \param destination the area of the rendering target that the sprite will cover.
+   * \param tint the color and alpha modulation of the sprite.
+   * \param angle the clockwise rotation of the sprite around its center, in degrees.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const irect& source,
+           const frect& destination,
+           const color& tint = colors::white,
+           const double angle = 0)
+  {
+    // Avoids querying the texture size for consecutive sprites from the same texture
+    const auto ptr = texture.get();
+    if (ptr != m_lastTexture) {
+      m_lastTexture = ptr;
+      m_lastSize = cast<farea>(texture.size());
+    }
+
+    const auto blend = texture.get_blend_mode();
+    m_sprites.push_back({ptr, blend, m_lastSize, source, destination, tint.get(), angle});
+  }
+
+  /**
+   * \brief Adds a sprite, that covers an entire texture, to the batch.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param destination the area of the rendering target that the sprite will cover.
+   * \param tint the color and alpha modulation of the sprite.
+   * \param angle the clockwise rotation of the sprite around its center, in degrees.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const frect& destination,
+           const color& tint = colors::white,
+           const double angle = 0)
+  {
+    add(texture, irect{{0, 0}, texture.size()}, destination, tint, angle);
+  }
+
+  /**
+   * \brief Renders all sprites in the batch and clears the batch.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if all sprites were rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto flush(Renderer& renderer) -> result
+  {
+    CENTURION_PROFILE_ZONE("sprite_batch::flush");
+
+    m_stats = sprite_batch_stats{};
+    m_stats.sprites = m_sprites.size();
+
+    if (m_sorting) {
+      std::stable_sort(m_sprites.begin(), m_sprites.end(), [](const auto& a, const auto& b) {
+        return std::tie(a.texture, a.blend) < std::tie(b.texture, b.blend);
+      });
+    }
+
+    bool ok = true;
+
+    usize first = 0;
+    while (first < m_sprites.size()) {
+      const auto& head = m_sprites[first];
+
+      auto last = first + 1;
+      while (last < m_sprites.size() && m_sprites[last].texture == head.texture &&
+             m_sprites[last].blend == head.blend)
+      {
+        ++last;
+      }
+
+      m_vertices.clear();
+      m_indices.clear();
+
+      for (auto index = first; index < last; ++index) {
+        add_quad(m_sprites[index]);
+      }
+
+      SDL_SetTextureBlendMode(head.texture, static_cast<SDL_BlendMode>(head.blend));
+      if (SDL_RenderGeometry(renderer.get(),
+                             head.texture,
+                             m_vertices.data(),
+                             isize(m_vertices),
+                             m_indices.data(),
+                             isize(m_indices)) != 0) {
+        ok = false;
+      }
+
+      renderer.record_draw(last - first, head.texture);
+
+      ++m_stats.drawCalls;
+      m_stats.vertices += m_vertices.size();
+      m_stats.indices += m_indices.size();
+
+      first = last;
+    }
+
+    clear();
+
+    return ok;
+  }
+
+  /**
+   * \brief Removes all sprites from the batch, without rendering them.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_sprites.clear();
+    m_lastTexture = nullptr;
+  }
+
+  /**
+   * \brief Sets whether or not sprites are sorted by texture and blend mode when flushed.
+   *
+   * \details Sorting is enabled by default.
+   *
+   * \param sorting `true` if sprites should be sorted; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  void set_sorting(const bool sorting) noexcept
+  {
+    m_sorting = sorting;
+  }
+
+  /**
+   * \brief Indicates whether or not sprites are sorted when the batch is flushed.
+   *
+   * \return `true` if sprites are sorted; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_sorting() const noexcept -> bool
+  {
+    return m_sorting;
+  }
+
+  /**
+   * \brief Sets the transform that is applied to all sprites when the batch is flushed.
+   *
+   * \details The transform is applied to the corners of each sprite, after the rotation
+   * of the individual sprite, e.g. to implement a camera without transforming the
+   * destination of every sprite before it is added. The transform is kept between flushes,
+   * and is the identity transform by default.
+   *
+   * \param transform the transform of the batch.
+   *
+   * \since 6.4.0
+   */
+  void set_transform(const affine_transform& transform) noexcept
+  {
+    m_transform = transform;
+    m_transformed = !transform.is_identity();
+  }
+
+  /**
+   * \brief Returns the transform that is applied to all sprites when the batch is flushed.
+   *
+   * \return the transform of the batch.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_transform() const noexcept -> const affine_transform&
+  {
+    return m_transform;
+  }
+
+  /**
+   * \brief Returns the amount of sprites in the batch.
+   *
+   * \return the number of sprites that haven't been flushed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_sprites.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the batch contains any sprites.
+   *
+   * \return `true` if the batch is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_sprites.empty();
+  }
+
+  /**
+   * \brief Returns statistics about the most recent flush.
+   *
+   * \return the statistics of the last flush.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> const sprite_batch_stats&
+  {
+    return m_stats;
+  }
+
+ private:
+  struct sprite final
+  {
+    SDL_Texture* texture{};
+    blend_mode blend{};
+    farea textureSize{};
+    irect source;
+    frect destination;
+    SDL_Color tint{};
+    double angle{};
+  };
+
+  std::vector<sprite> m_sprites;
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+  sprite_batch_stats m_stats;
+  SDL_Texture* m_lastTexture{};
+  farea m_lastSize{};
+  affine_transform m_transform;
+  bool m_sorting{true};
+  bool m_transformed{};
+
+  void add_quad(const sprite& sprite)
+  {
+    const auto& [width, height] = sprite.textureSize;
+    const auto& src = sprite.source;
+    const auto& dst = sprite.destination;
+
+    const auto u0 = static_cast<float>(src.x()) / width;
+    const auto v0 = static_cast<float>(src.y()) / height;
+    const auto u1 = static_cast<float>(src.max_x()) / width;
+    const auto v1 = static_cast<float>(src.max_y()) / height;
+
+    SDL_FPoint corners[4] = {{dst.x(), dst.y()},
+                             {dst.max_x(), dst.y()},
+                             {dst.max_x(), dst.max_y()},
+                             {dst.x(), dst.max_y()}};
+
+    if (sprite.angle != 0) {
+      constexpr double pi = 3.14159265358979323846;
+
+      const auto radians = sprite.angle * pi / 180.0;
+      const auto sin = static_cast<float>(std::sin(radians));
+      const auto cos = static_cast<float>(std::cos(radians));
+      const auto center = dst.center();
+
+      for (auto& corner : corners) {
+        const auto dx = corner.x - center.x();
+        const auto dy = corner.y - center.y();
+        corner.x = center.x() + (dx * cos) - (dy * sin);
+        corner.y = center.y() + (dx * sin) + (dy * cos);
+      }
+    }
+
+    if (m_transformed) {
+      detail::transform_points(m_transform.coefficients(), corners, 4);
+    }
+
+    const auto first = static_cast<int>(m_vertices.size());
+
+    m_vertices.push_back({corners[0], sprite.tint, {u0, v0}});
+    m_vertices.push_back({corners[1], sprite.tint, {u1, v0}});
+    m_vertices.push_back({corners[2], sprite.tint, {u1, v1}});
+    m_vertices.push_back({corners[3], sprite.tint, {u0, v1}});
+
+    m_indices.push_back(first);
+    m_indices.push_back(first + 1);
+    m_indices.push_back(first + 2);
+    m_indices.push_back(first + 2);
+    m_indices.push_back(first + 3);
+    m_indices.push_back(first);
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+#endif  // CENTURION_SPRITE_BATCH_HEADER
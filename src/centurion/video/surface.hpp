@@ -4,14 +4,18 @@
 #include <SDL2/SDL.h>
 
 #include "../compiler/features.hpp"
+#include "../compiler/linkage.hpp"
 
 #ifndef CENTURION_NO_SDL_IMAGE
 #include <SDL2/SDL_image.h>
 #endif  // CENTURION_NO_SDL_IMAGE
 
 #include <cassert>  // assert
+#include <cstddef>  // byte
+#include <memory>   // unique_ptr
 #include <ostream>  // ostream
 #include <string>   // string, to_string
+#include <vector>   // vector
 
 #if CENTURION_HAS_FEATURE_FORMAT
 
@@ -20,7 +24,9 @@
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
 #include "../core/exception.hpp"
+#include "../core/expected.hpp"
 #include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
@@ -28,11 +34,20 @@
 #include "../core/to_underlying.hpp"
 #include "../detail/address_of.hpp"
 #include "../detail/owner_handle_api.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../detail/qoi_codec.hpp"
+#include "../detail/row_bands.hpp"
+#include "../detail/sdl_deleter.hpp"
+#include "../filesystem/file.hpp"
 #include "../math/area.hpp"
 #include "../math/rect.hpp"
+#include "../system/cpu.hpp"
+#include "../thread/task_scheduler.hpp"
 #include "blend_mode.hpp"
 #include "color.hpp"
+#include "pixel_conversion.hpp"
 #include "pixel_format_info.hpp"
+#include "scale_mode.hpp"
 
 namespace cen {
 
@@ -127,8 +142,11 @@ class basic_surface final
    * \since 4.0.0
    */
   template <typename TT = T, detail::is_owner<TT> = 0>
-  explicit basic_surface(const not_null<str> file) : m_surface{IMG_Load(file)}
+  explicit basic_surface(const not_null<str> file)
   {
+    library::ensure(library_subsystem::image);
+
+    m_surface.reset(IMG_Load(file));
     if (!m_surface) {
       throw img_error{};
     }
@@ -149,6 +167,73 @@ class basic_surface final
   explicit basic_surface(const std::string& file) : basic_surface{file.c_str()}
   {}
 
+  /**
+   * \brief Creates a surface by decoding the image data of an open file.
+   *
+   * \details The image data is read from the current offset of the file, which makes it
+   * possible to load images from files in packed archives. The file is not closed, and
+   * can be used, or closed, right after the surface has been created.
+   *
+   * \tparam BB dummy parameter for SFINAE.
+   *
+   * \param source the file that the image data is read from, must be valid.
+   *
+   * \throws img_error if the surface cannot be created.
+   *
+   * \see `IMG_Load_RW`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  explicit basic_surface(file& source)
+  {
+    // QOI images are decoded by the library, which is faster than most SDL_image versions
+    if (source.detect_image_format() == image_format::qoi) {
+      *this = from_qoi(source);
+      return;
+    }
+
+    library::ensure(library_subsystem::image);
+
+    m_surface.reset(IMG_Load_RW(source.get(), 0));
+    if (!m_surface) {
+      throw img_error{};
+    }
+  }
+
+  /**
+   * \brief Attempts to load a surface based on an image file, without throwing.
+   *
+   * \param file the file path of the image, cannot be null.
+   *
+   * \return the loaded surface; an `error_code::img` error if the image couldn't be loaded.
+   *
+   * \see `expected`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto try_load(const not_null<str> file) noexcept
+      -> expected<basic_surface>
+  {
+    assert(file);
+
+    if (auto* loaded = IMG_Load(file)) {
+      return basic_surface{loaded};
+    }
+    else {
+      return error_info{error_code::img};
+    }
+  }
+
+  /// \copydoc try_load()
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto try_load(const std::string& file) noexcept
+      -> expected<basic_surface>
+  {
+    return try_load(file.c_str());
+  }
+
 #endif  // CENTURION_NO_SDL_IMAGE
 
   /**
@@ -242,6 +327,219 @@ class basic_surface final
     return from_bmp(file.c_str());
   }
 
+  /**
+   * \brief Creates a surface by decoding a QOI image in memory.
+   *
+   * \details QOI is a simple lossless image format, which decodes several times faster
+   * than PNG at a comparable size. This makes it well suited for assets that are
+   * converted offline, e.g. by a build pipeline using `save_as_qoi()`. The decoder is
+   * built into the library, so SDL_image is not required.
+   *
+   * \details The surface always uses the `rgba32` pixel format, images without an alpha
+   * channel are opaque.
+   *
+   * \param data the encoded image, cannot be null.
+   * \param size the size of the encoded image, in bytes.
+   *
+   * \return the decoded surface.
+   *
+   * \throws cen_error if the data isn't a valid QOI image.
+   * \throws sdl_error if the surface cannot be created.
+   *
+   * \see `save_as_qoi()`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_qoi(const not_null<const void*> data, const usize size)
+      -> basic_surface
+  {
+    assert(data);
+
+    const auto* bytes = static_cast<const u8*>(data);
+
+    const auto header = detail::qoi_read_header(bytes, size);
+    if (!header) {
+      throw cen_error{"Invalid QOI header!"};
+    }
+
+    basic_surface image{iarea{static_cast<int>(header->width),
+                              static_cast<int>(header->height)},
+                        pixel_format::rgba32};
+
+    auto* pixels = static_cast<u8*>(image.pixels());
+    const auto pitch = static_cast<usize>(image.pitch());
+
+    if (!detail::qoi_decode(bytes, size, *header, pixels, pitch)) {
+      throw cen_error{"QOI image data is truncated!"};
+    }
+
+    return image;
+  }
+
+  /**
+   * \brief Creates a surface by decoding a QOI image file.
+   *
+   * \param file the path of the QOI image, cannot be null.
+   *
+   * \return the decoded surface.
+   *
+   * \throws cen_error if the file couldn't be read or isn't a valid QOI image.
+   * \throws sdl_error if the surface cannot be created.
+   *
+   * \see `from_qoi(not_null<const void*>, usize)`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_qoi(const not_null<str> file) -> basic_surface
+  {
+    assert(file);
+
+    cen::file source{file, file_mode::read_existing_binary};
+    if (!source) {
+      throw cen_error{"Failed to open QOI image!"};
+    }
+
+    return from_qoi(source);
+  }
+
+  /// \copydoc from_qoi(not_null<str>)
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_qoi(const std::string& file) -> basic_surface
+  {
+    return from_qoi(file.c_str());
+  }
+
+  /**
+   * \brief Creates a surface by decoding a QOI image from an open file.
+   *
+   * \details The image is read from the current offset of the file until the end of the
+   * file.
+   *
+   * \param source the file that the image is read from, must be valid.
+   *
+   * \return the decoded surface.
+   *
+   * \throws cen_error if the file doesn't contain a valid QOI image.
+   * \throws sdl_error if the surface cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_qoi(file& source) -> basic_surface
+  {
+    const auto data = source.read_all();
+    if (data.empty()) {
+      throw cen_error{"Failed to read QOI image!"};
+    }
+
+    return from_qoi(data.data(), data.size());
+  }
+
+  /**
+   * \brief Creates a surface that uses existing pixel data, without copying it.
+   *
+   * \details The created surface references the supplied memory, which is neither copied
+   * nor freed by the surface. This makes it possible to wrap pixel buffers that are owned
+   * by something else, e.g. decoded video frames.
+   *
+   * \note The pixel memory must outlive the surface. Copies of the surface allocate and
+   * own their pixel data, i.e. only the returned surface references the supplied memory.
+   *
+   * \param pixels the pixel data, must hold at least `pitch * size.height` bytes.
+   * \param size the size of the surface.
+   * \param pitch the length of a row of pixels in the pixel data, in bytes.
+   * \param pixelFormat the pixel format of the pixel data.
+   *
+   * \return an owning surface that references the pixel data.
+   *
+   * \throws sdl_error if the surface cannot be created.
+   *
+   * \see `SDL_CreateRGBSurfaceWithFormatFrom()`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_pixels(void* pixels,
+                                        const iarea size,
+                                        const int pitch,
+                                        const pixel_format pixelFormat) -> basic_surface
+  {
+    assert(pixels);
+    assert(pitch >= 0);
+
+    const auto depth = static_cast<int>(SDL_BITSPERPIXEL(to_underlying(pixelFormat)));
+    if (auto* ptr = SDL_CreateRGBSurfaceWithFormatFrom(pixels,
+                                                       size.width,
+                                                       size.height,
+                                                       depth,
+                                                       pitch,
+                                                       to_underlying(pixelFormat)))
+    {
+      return basic_surface{ptr};
+    }
+    else {
+      throw sdl_error{};
+    }
+  }
+
+  /**
+   * \brief Creates a surface that uses a block of SIMD-friendly memory, without copying
+   * it.
+   *
+   * \details The rows of the surface use the pitch returned by `aligned_pitch()`, so the
+   * first pixel of every row is suitably aligned for SIMD instructions.
+   *
+   * \note The memory block must outlive the surface.
+   *
+   * \param block the memory block, must hold at least
+   * `aligned_pitch(size.width, pixelFormat) * size.height` bytes.
+   * \param size the size of the surface.
+   * \param pixelFormat the pixel format of the pixel data.
+   *
+   * \return an owning surface that references the memory block.
+   *
+   * \throws cen_error if the memory block is empty.
+   * \throws sdl_error if the surface cannot be created.
+   *
+   * \see `simd_block`
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_pixels(simd_block& block,
+                                        const iarea size,
+                                        const pixel_format pixelFormat) -> basic_surface
+  {
+    if (!block) {
+      throw cen_error{"Cannot create surface from empty memory block!"};
+    }
+
+    const auto pitch = aligned_pitch(size.width, pixelFormat);
+    return from_pixels(block.data(), size, pitch, pixelFormat);
+  }
+
+  /**
+   * \brief Returns the pitch of a row of pixels, padded for SIMD-friendly alignment.
+   *
+   * \param width the width of the row, in pixels.
+   * \param pixelFormat the pixel format of the pixels.
+   *
+   * \return the length of the padded row, in bytes.
+   *
+   * \see `cpu::simd_alignment()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto aligned_pitch(const int width,
+                                          const pixel_format pixelFormat) noexcept -> int
+  {
+    const auto alignment = static_cast<int>(cpu::simd_alignment());
+    const auto bytes = width * static_cast<int>(SDL_BYTESPERPIXEL(to_underlying(pixelFormat)));
+    return ((bytes + alignment - 1) / alignment) * alignment;
+  }
+
   /**
    * \brief Creates a copy of the supplied surface.
    *
@@ -331,6 +629,97 @@ class basic_surface final
     return save_as_bmp(file.c_str());
   }
 
+  /**
+   * \brief Encodes the surface as a QOI image.
+   *
+   * \details The surface is converted to `rgba32` first, if necessary. The alpha channel
+   * is only stored if the pixel format of the surface has one.
+   *
+   * \return the encoded image; an empty vector if the surface couldn't be converted.
+   *
+   * \see `from_qoi()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto encode_qoi() const -> std::vector<std::byte>
+  {
+    std::vector<std::byte> encoded;
+
+    const auto format = format_info().format();
+    const auto alpha = SDL_ISPIXELFORMAT_ALPHA(to_underlying(format));
+
+    std::unique_ptr<SDL_Surface, detail::sdl_deleter> converted;
+    SDL_Surface* source = m_surface;
+
+    if (format != pixel_format::rgba32) {
+      converted.reset(
+          SDL_ConvertSurfaceFormat(m_surface, to_underlying(pixel_format::rgba32), 0));
+      if (!converted) {
+        return encoded;
+      }
+
+      source = converted.get();
+    }
+
+    const bool locked = SDL_MUSTLOCK(source);
+    if (locked && SDL_LockSurface(source) != 0) {
+      return encoded;
+    }
+
+    detail::qoi_header header;
+    header.width = static_cast<u32>(source->w);
+    header.height = static_cast<u32>(source->h);
+    header.channels = static_cast<u8>(alpha ? 4 : 3);
+
+    encoded.resize(detail::qoi_max_size(header.width, header.height));
+    encoded.resize(detail::qoi_encode(static_cast<const u8*>(source->pixels),
+                                      static_cast<usize>(source->pitch),
+                                      header,
+                                      reinterpret_cast<u8*>(encoded.data())));
+
+    if (locked) {
+      SDL_UnlockSurface(source);
+    }
+
+    return encoded;
+  }
+
+  /**
+   * \brief Saves the surface as a QOI image.
+   *
+   * \details QOI images are lossless, and are decoded considerably faster than PNG images
+   * by `from_qoi()`. This function doesn't require SDL_image.
+   *
+   * \param file the file path that the surface data will be saved at.
+   *
+   * \return `success` if nothing went wrong; `failure` otherwise.
+   *
+   * \see `encode_qoi()`
+   *
+   * \since 6.4.0
+   */
+  auto save_as_qoi(const not_null<str> file) const -> result
+  {
+    assert(file);
+
+    const auto encoded = encode_qoi();
+    if (encoded.empty()) {
+      return failure;
+    }
+
+    cen::file target{file, file_mode::write_binary};
+    return target && target.write(encoded) == encoded.size();
+  }
+
+  /**
+   * \see save_as_qoi()
+   * \since 6.4.0
+   */
+  auto save_as_qoi(const std::string& file) const -> result  // NOLINT
+  {
+    return save_as_qoi(file.c_str());
+  }
+
 #ifndef CENTURION_NO_SDL_IMAGE
 
   /**
@@ -445,6 +834,136 @@ class basic_surface final
 
   /// \} End of locking
 
+  /// \name Alpha premultiplication
+  /// \{
+
+  /**
+   * \brief Multiplies the color components of all pixels with their alpha components.
+   *
+   * \details Premultiplied alpha enables cheaper blending and correct filtering of
+   * translucent pixels, see `premultiplied_blend_mode()`. The alpha components themselves
+   * are left unchanged.
+   *
+   * \details `SDL_PremultiplyAlpha()` is used for `argb8888` surfaces when it's
+   * available, otherwise a dedicated (SIMD, if available) kernel is used.
+   *
+   * \note Only 32-bit pixel formats with 8-bit channels are supported. This function has no
+   * effect for formats without an alpha channel.
+   *
+   * \return `success` if the pixels were premultiplied; `failure` otherwise.
+   *
+   * \see `unpremultiply_alpha()`
+   *
+   * \since 6.4.0
+   */
+  auto premultiply_alpha() noexcept -> result
+  {
+    return transform_alpha(false, nullptr);
+  }
+
+  /**
+   * \brief Multiplies the color components of all pixels with their alpha components,
+   * using the workers of a task scheduler.
+   *
+   * \details The surface is split into bands of rows, which are processed in parallel.
+   * Surfaces with fewer pixels than `parallel_pixel_threshold()` are processed on the
+   * calling thread.
+   *
+   * \param scheduler the task scheduler that will process the bands.
+   *
+   * \return `success` if the pixels were premultiplied; `failure` otherwise.
+   *
+   * \see `premultiply_alpha()`
+   *
+   * \since 6.4.0
+   */
+  auto premultiply_alpha(task_scheduler& scheduler) -> result
+  {
+    return transform_alpha(false, &scheduler);
+  }
+
+  /**
+   * \brief Divides the color components of all pixels by their alpha components.
+   *
+   * \details This function reverses the effect of `premultiply_alpha()`, although some
+   * precision is lost for pixels with low alpha values. Fully transparent pixels are left
+   * unchanged.
+   *
+   * \note Only 32-bit pixel formats with 8-bit channels are supported. This function has no
+   * effect for formats without an alpha channel.
+   *
+   * \return `success` if the pixels were unpremultiplied; `failure` otherwise.
+   *
+   * \see `premultiply_alpha()`
+   *
+   * \since 6.4.0
+   */
+  auto unpremultiply_alpha() noexcept -> result
+  {
+    return transform_alpha(true, nullptr);
+  }
+
+  /**
+   * \brief Divides the color components of all pixels by their alpha components, using the
+   * workers of a task scheduler.
+   *
+   * \param scheduler the task scheduler that will process the bands.
+   *
+   * \return `success` if the pixels were unpremultiplied; `failure` otherwise.
+   *
+   * \see `premultiply_alpha(task_scheduler&)`
+   *
+   * \since 6.4.0
+   */
+  auto unpremultiply_alpha(task_scheduler& scheduler) -> result
+  {
+    return transform_alpha(true, &scheduler);
+  }
+
+  /// \} End of alpha premultiplication
+
+  /// \name Modulation baking
+  /// \{
+
+  /**
+   * \brief Applies the color and alpha modulation to the pixels, and resets the modulation.
+   *
+   * \details Every pixel is multiplied with the color modulation, and its alpha component
+   * with the alpha modulation, after which the modulation is reset to white and fully
+   * opaque. Blitting the surface afterwards yields the same result, without the cost of
+   * modulating every blit. The alpha modulation is kept for formats without an alpha
+   * channel, since it can't be stored in the pixels.
+   *
+   * \note Only 32-bit pixel formats with 8-bit channels are supported.
+   *
+   * \return `success` if the modulation was applied; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto bake_color_mod() noexcept -> result
+  {
+    return bake_modulation(nullptr);
+  }
+
+  /**
+   * \brief Applies the color and alpha modulation to the pixels, using the workers of a
+   * task scheduler.
+   *
+   * \param scheduler the task scheduler that will process the bands of rows.
+   *
+   * \return `success` if the modulation was applied; `failure` otherwise.
+   *
+   * \see `bake_color_mod()`
+   *
+   * \since 6.4.0
+   */
+  auto bake_color_mod(task_scheduler& scheduler) -> result
+  {
+    return bake_modulation(&scheduler);
+  }
+
+  /// \} End of modulation baking
+
   /// \name Setters
   /// \{
 
@@ -605,6 +1124,211 @@ class basic_surface final
     }
   }
 
+  /**
+   * \brief Creates and returns a surface based on this surface with the specified pixel
+   * format, using the workers of a task scheduler.
+   *
+   * \details The pixels are converted with `convert_pixels()`, in bands of rows that are
+   * processed in parallel. Surfaces with fewer pixels than `parallel_pixel_threshold()`,
+   * surfaces that are RLE encoded or have a color key, and indexed or FourCC formats are
+   * converted with `convert(pixel_format)` instead.
+   *
+   * \param format the pixel format that will be used by the new surface.
+   * \param scheduler the task scheduler that will convert the bands.
+   *
+   * \return a surface based on this surface with the specified pixel format.
+   *
+   * \throws sdl_error if the surface cannot be created.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto convert(const pixel_format format, task_scheduler& scheduler) const
+      -> basic_surface
+  {
+    const auto current = format_info().format();
+    if (!is_band_convertible(current) || !is_band_convertible(format) || must_lock() ||
+        SDL_HasColorKey(m_surface) ||
+        static_cast<usize>(width()) * static_cast<usize>(height()) <
+            parallel_pixel_threshold())
+    {
+      return convert(format);
+    }
+
+    auto* converted =
+        SDL_CreateRGBSurfaceWithFormat(0, width(), height(), 0, to_underlying(format));
+    if (!converted) {
+      throw sdl_error{};
+    }
+
+    basic_surface result{converted};
+    if (!convert_pixels(size(),
+                        current,
+                        m_surface->pixels,
+                        pitch(),
+                        format,
+                        converted->pixels,
+                        converted->pitch,
+                        scheduler))
+    {
+      throw sdl_error{};
+    }
+
+    result.set_blend_mode(get_blend_mode());
+    result.set_alpha(alpha());
+    result.set_color_mod(color_mod());
+
+    return result;
+  }
+
+  /**
+   * \brief Converts the pixels of the surface to another pixel format, without allocating
+   * a new pixel buffer.
+   *
+   * \details This is a cheaper alternative to `convert()` when converting between 32-bit
+   * pixel formats with 8-bit channels, e.g. from `argb8888` to `rgba8888`. The pixels are
+   * converted in place, and only the underlying `SDL_Surface` header is replaced, which
+   * invalidates previously obtained raw pointers (but not the pixel data).
+   *
+   * \details The blend mode, alpha modulation, color modulation and clip rectangle are
+   * preserved.
+   *
+   * \note This function fails, and leaves the surface unchanged, if either pixel format
+   * isn't a 32-bit format with 8-bit channels, if the surface is RLE encoded, or if the
+   * surface has a color key. Use `convert()` in those cases.
+   *
+   * \param format the pixel format that the surface will use.
+   *
+   * \return `success` if the surface was converted; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  auto convert_in_place(const pixel_format format) noexcept -> result
+  {
+    const auto current = format_info().format();
+    if (current == format) {
+      return success;
+    }
+
+    const auto srcLayout = detail::packed_layout(current);
+    const auto dstLayout = detail::packed_layout(format);
+    if (!srcLayout || !dstLayout || must_lock() || SDL_HasColorKey(m_surface)) {
+      return failure;
+    }
+
+    auto* converted = SDL_CreateRGBSurfaceWithFormatFrom(m_surface->pixels,
+                                                         m_surface->w,
+                                                         m_surface->h,
+                                                         32,
+                                                         m_surface->pitch,
+                                                         to_underlying(format));
+    if (!converted) {
+      return failure;
+    }
+
+    auto* bytes = static_cast<u8*>(m_surface->pixels);
+    for (auto y = 0; y < m_surface->h; ++y) {
+      auto* row = reinterpret_cast<u32*>(bytes + y * m_surface->pitch);
+      detail::shuffle_row(row, row, m_surface->w, *srcLayout, *dstLayout);
+    }
+
+    // Transfers ownership of the pixel data to the new surface
+    constexpr u32 allocationFlags = SDL_PREALLOC | SDL_SIMD_ALIGNED;
+    converted->flags &= ~allocationFlags;
+    converted->flags |= m_surface->flags & allocationFlags;
+    m_surface->flags |= SDL_PREALLOC;
+
+    SDL_BlendMode mode{};
+    SDL_GetSurfaceBlendMode(m_surface, &mode);
+    SDL_SetSurfaceBlendMode(converted, mode);
+
+    u8 alpha{};
+    SDL_GetSurfaceAlphaMod(m_surface, &alpha);
+    SDL_SetSurfaceAlphaMod(converted, alpha);
+
+    u8 red{};
+    u8 green{};
+    u8 blue{};
+    SDL_GetSurfaceColorMod(m_surface, &red, &green, &blue);
+    SDL_SetSurfaceColorMod(converted, red, green, blue);
+
+    SDL_Rect clip{};
+    SDL_GetClipRect(m_surface, &clip);
+    SDL_SetClipRect(converted, &clip);
+
+    m_surface.reset(converted);
+    return success;
+  }
+
+  /**
+   * \brief Creates and returns a scaled copy of the surface.
+   *
+   * \details The pixels are copied with nearest-neighbour sampling, without any blending,
+   * i.e. the alpha channel is copied as-is. The new surface uses the same pixel format and
+   * blend mode as this surface.
+   *
+   * \param size the size of the new surface.
+   *
+   * \return a scaled copy of the surface.
+   *
+   * \throws sdl_error if the surface cannot be created or scaled.
+   *
+   * \see `SDL_SoftStretch()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto scaled(const iarea size) const -> surface
+  {
+    surface result{size, format_info().format()};
+    result.set_blend_mode(get_blend_mode());
+
+    if (SDL_SoftStretch(m_surface, nullptr, result.get(), nullptr) == 0) {
+      return result;
+    }
+    else {
+      throw sdl_error{};
+    }
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+
+  /**
+   * \brief Creates and returns a scaled copy of the surface, using the specified filter.
+   *
+   * \details Linear filtering is only supported for 32-bit pixel formats, other formats
+   * always use nearest-neighbour sampling. Both `scale_mode::linear` and
+   * `scale_mode::best` use linear filtering.
+   *
+   * \param size the size of the new surface.
+   * \param mode the filter used to sample the pixels.
+   *
+   * \return a scaled copy of the surface.
+   *
+   * \throws sdl_error if the surface cannot be created or scaled.
+   *
+   * \see `SDL_SoftStretchLinear()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto scaled(const iarea size, const scale_mode mode) const -> surface
+  {
+    if (mode == scale_mode::nearest || m_surface->format->BytesPerPixel != 4) {
+      return scaled(size);
+    }
+
+    surface result{size, format_info().format()};
+    result.set_blend_mode(get_blend_mode());
+
+    if (SDL_SoftStretchLinear(m_surface, nullptr, result.get(), nullptr) == 0) {
+      return result;
+    }
+    else {
+      throw sdl_error{};
+    }
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+
   /**
    * \brief Returns the width of the surface.
    *
@@ -863,6 +1587,121 @@ class basic_surface final
     }
   }
 
+  /**
+   * \brief Premultiplies or unpremultiplies the alpha of all pixels in the surface.
+   *
+   * \param inverse `true` if the pixels should be unpremultiplied; `false` otherwise.
+   *
+   * \return `success` if the pixels were transformed; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto transform_alpha(const bool inverse, task_scheduler* scheduler) -> result
+  {
+    const auto format = static_cast<pixel_format>(m_surface->format->format);
+
+    const auto layout = detail::packed_layout(format);
+    if (!layout) {
+      return failure;
+    }
+    else if (!layout->hasAlpha) {
+      return success;
+    }
+
+    if (!lock()) {
+      return failure;
+    }
+
+    auto* bytes = static_cast<u8*>(m_surface->pixels);
+    const auto rowPitch = pitch();
+    const auto rowWidth = width();
+
+    const auto transform = [&](int first, const int last) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+      if (!inverse && format == pixel_format::argb8888) {
+        auto* band = bytes + first * rowPitch;
+        return SDL_PremultiplyAlpha(rowWidth,
+                                    last - first,
+                                    SDL_PIXELFORMAT_ARGB8888,
+                                    band,
+                                    rowPitch,
+                                    SDL_PIXELFORMAT_ARGB8888,
+                                    band,
+                                    rowPitch) == 0;
+      }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+      for (; first < last; ++first) {
+        auto* row = reinterpret_cast<u32*>(bytes + first * rowPitch);
+        if (inverse) {
+          detail::unpremultiply_row(row, rowWidth, *layout);
+        }
+        else {
+          detail::premultiply_row(row, rowWidth, *layout);
+        }
+      }
+
+      return true;
+    };
+
+    const auto res = detail::for_each_row_band(scheduler, rowWidth, height(), transform);
+
+    unlock();
+    return res;
+  }
+
+  auto bake_modulation(task_scheduler* scheduler) -> result
+  {
+    const auto layout = detail::packed_layout(format_info().format());
+    if (!layout) {
+      return failure;
+    }
+
+    const auto mod = color_mod();
+    const auto alphaMod = layout->hasAlpha ? alpha() : u8{0xFF};
+    if (mod.red() == 0xFF && mod.green() == 0xFF && mod.blue() == 0xFF && alphaMod == 0xFF) {
+      return success;
+    }
+
+    if (!lock()) {
+      return failure;
+    }
+
+    // Formats without alpha have an unused byte in place of the alpha component
+    const auto modLayout = detail::blend_layout(*layout);
+    const auto tint = (u32{mod.red()} << modLayout.red) |
+                      (u32{mod.green()} << modLayout.green) |
+                      (u32{mod.blue()} << modLayout.blue) | (u32{alphaMod} << modLayout.alpha);
+
+    auto* bytes = static_cast<u8*>(m_surface->pixels);
+    const auto rowPitch = pitch();
+    const auto rowWidth = width();
+
+    detail::for_each_row_band(scheduler, rowWidth, height(), [&](int first, const int last) {
+      for (; first < last; ++first) {
+        auto* row = reinterpret_cast<u32*>(bytes + first * rowPitch);
+        detail::modulate_row(row, rowWidth, modLayout, tint);
+      }
+
+      return true;
+    });
+
+    unlock();
+
+    set_color_mod(color{0xFF, 0xFF, 0xFF});
+    if (layout->hasAlpha) {
+      set_alpha(0xFF);
+    }
+
+    return success;
+  }
+
+  [[nodiscard]] static auto is_band_convertible(const pixel_format format) noexcept -> bool
+  {
+    const auto raw = to_underlying(format);
+    return !SDL_ISPIXELFORMAT_FOURCC(raw) && !SDL_ISPIXELFORMAT_INDEXED(raw);
+  }
+
 #ifdef CENTURION_MOCK_FRIENDLY_MODE
 
  public:
@@ -920,6 +1759,13 @@ auto operator<<(std::ostream& stream, const basic_surface<T>& surface) -> std::o
 
 /// \} End of streaming
 
+#if CENTURION_EXTERN_TEMPLATES
+
+extern template class CENTURION_API basic_surface<detail::owning_type>;
+extern template class CENTURION_API basic_surface<detail::handle_type>;
+
+#endif  // CENTURION_EXTERN_TEMPLATES
+
 /// \} End of group video
 
 }  // namespace cen
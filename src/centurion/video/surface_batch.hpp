@@ -0,0 +1,520 @@
+#ifndef CENTURION_SURFACE_BATCH_HEADER
+#define CENTURION_SURFACE_BATCH_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>  // min, max
+#include <cmath>      // lround
+#include <optional>   // optional
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct surface_batch_stats
+ *
+ * \brief Provides statistics about the most recent flush of a surface batch.
+ *
+ * \since 6.4.0
+ */
+struct surface_batch_stats final
+{
+  usize sprites{};   ///< The amount of rendered sprites.
+  usize pixels{};    ///< The amount of written destination pixels.
+  usize fallback{};  ///< The amount of sprites that were blitted by SDL.
+  usize rects{};     ///< The amount of updated window surface rectangles.
+};
+
+/**
+ * \class surface_batch
+ *
+ * \brief Collects sprites that are blended into a surface, such as the window surface, in
+ * software.
+ *
+ * \details A surface batch has the same interface as `sprite_batch`, but works on surfaces
+ * instead of textures, for targets without a GPU where the window surface is updated
+ * directly instead of using a renderer. Sprites with the `blend_mode::none` and
+ * `blend_mode::blend` blend modes, and 32-bit source and target formats, are composited
+ * row by row with SIMD kernels, and are scaled with nearest neighbour sampling. Other
+ * sprites are blitted with `SDL_BlitScaled()`.
+ * \code{cpp}
+ *   cen::surface_batch batch;
+ *
+ *   // Every frame
+ *   batch.add(background, cen::frect{0, 0, 800, 600});
+ *   batch.add(sheet, cen::irect{32, 0, 32, 32}, cen::frect{x, y, 32, 32});
+ *   batch.flush(window);
+ * \endcode
+ *
+ * \details When flushed to a window, only the areas that were drawn to since the previous
+ * flush, and areas marked with `mark()`, are copied to the screen with
+ * `SDL_UpdateWindowSurfaceRects()`. Overlapping areas are merged, and if there are more
+ * than `max_rects` areas, they are merged into their bounding rectangle.
+ *
+ * \details Unlike with `sprite_batch`, sprites can't be rotated, and are always drawn in
+ * the order in which they were added.
+ *
+ * \note The surfaces must outlive the flush of the batch. A window surface is invalidated
+ * when the window is resized, which is why the surface is obtained by every flush.
+ *
+ * \see `sprite_batch`
+ * \see `surface_batch_stats`
+ *
+ * \since 6.4.0
+ */
+class surface_batch final
+{
+ public:
+  /// The maximum amount of rectangles that are supplied to a single window surface update.
+  inline constexpr static usize max_rects = 32;
+
+  /**
+   * \brief Adds a sprite to the batch.
+   *
+   * \details The blend mode and the color and alpha modulation of the surface are captured
+   * when the sprite is added. The modulation is combined with the tint.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param surface the surface that contains the sprite.
+   * \param source the area of the surface that will be rendered.
+   * \param destination the area of the target surface that the sprite will cover, which is
+   * rounded to whole pixels.
+   * \param tint the color and alpha modulation of the sprite.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void add(const basic_surface<T>& surface,
+           const irect& source,
+           const frect& destination,
+           const color& tint = colors::white)
+  {
+    const auto mod = surface.color_mod();
+    const auto multiply = [](const u8 a, const u8 b) noexcept {
+      return static_cast<u8>(detail::multiply_alpha(a, b));
+    };
+
+    const color combined{multiply(tint.red(), mod.red()),
+                         multiply(tint.green(), mod.green()),
+                         multiply(tint.blue(), mod.blue()),
+                         multiply(tint.alpha(), surface.alpha())};
+
+    const auto x = std::lround(destination.x());
+    const auto y = std::lround(destination.y());
+    const auto maxX = std::lround(destination.max_x());
+    const auto maxY = std::lround(destination.max_y());
+
+    m_sprites.push_back({surface.get(),
+                         surface.get_blend_mode(),
+                         source,
+                         irect{static_cast<int>(x),
+                               static_cast<int>(y),
+                               static_cast<int>(maxX - x),
+                               static_cast<int>(maxY - y)},
+                         combined});
+  }
+
+  /**
+   * \brief Adds a sprite, that covers an entire surface, to the batch.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param surface the surface that will be rendered.
+   * \param destination the area of the target surface that the sprite will cover.
+   * \param tint the color and alpha modulation of the sprite.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  void add(const basic_surface<T>& surface,
+           const frect& destination,
+           const color& tint = colors::white)
+  {
+    add(surface, irect{{0, 0}, surface.size()}, destination, tint);
+  }
+
+  /**
+   * \brief Renders all sprites in the batch to a surface and clears the batch.
+   *
+   * \details The drawn areas are accumulated as damaged areas, see `damage()`, which are
+   * cleared when the batch is flushed to a window.
+   *
+   * \tparam T the ownership semantics of the target surface.
+   *
+   * \param target the surface that the sprites are rendered to.
+   *
+   * \return `success` if all sprites were rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto flush(basic_surface<T>& target) -> result
+  {
+    return flush_to(target.get());
+  }
+
+  /**
+   * \brief Renders all sprites in the batch to the surface of a window, copies the damaged
+   * areas to the screen, and clears the batch.
+   *
+   * \details Nothing is copied to the screen if nothing was damaged.
+   *
+   * \tparam T the ownership semantics of the window.
+   *
+   * \param window the window that will be updated.
+   *
+   * \return `success` if all sprites were rendered, and the window was updated; `failure`
+   * otherwise.
+   *
+   * \see `basic_window::update_surface()`
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  auto flush(basic_window<T>& window) -> result
+  {
+    CENTURION_PROFILE_ZONE("surface_batch::flush");
+
+    auto* surface = SDL_GetWindowSurface(window.get());
+    if (!surface) {
+      clear();
+      return failure;
+    }
+
+    bool ok = flush_to(surface);
+
+    // Rectangles outside of the window surface make the whole update fail
+    const irect bounds{0, 0, surface->w, surface->h};
+    m_updates.clear();
+    for (const auto& rect : m_damage) {
+      if (const auto visible = clipped(rect, bounds); visible.has_area()) {
+        m_updates.push_back(visible.get());
+      }
+    }
+
+    if (!m_updates.empty()) {
+      const auto count = isize(m_updates);
+      ok = SDL_UpdateWindowSurfaceRects(window.get(), m_updates.data(), count) == 0 && ok;
+    }
+
+    m_stats.rects = m_updates.size();
+    m_damage.clear();
+
+    return ok;
+  }
+
+  /**
+   * \brief Marks an area as damaged, so that it is copied to the screen by the next flush
+   * to a window.
+   *
+   * \details This is useful for changes made to the window surface without the batch, e.g.
+   * when parts of the surface are cleared.
+   *
+   * \param area the area that has changed.
+   *
+   * \since 6.4.0
+   */
+  void mark(const irect& area)
+  {
+    if (area.has_area()) {
+      add_damage(area);
+    }
+  }
+
+  /**
+   * \brief Removes all sprites from the batch, without rendering them.
+   *
+   * \details The damaged areas are kept.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_sprites.clear();
+  }
+
+  /**
+   * \brief Returns the areas that were damaged since the batch was last flushed to a window.
+   *
+   * \return the damaged, non-overlapping areas.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto damage() const noexcept -> const std::vector<irect>&
+  {
+    return m_damage;
+  }
+
+  /**
+   * \brief Returns the amount of sprites in the batch.
+   *
+   * \return the number of sprites that haven't been flushed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_sprites.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the batch contains any sprites.
+   *
+   * \return `true` if the batch is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_sprites.empty();
+  }
+
+  /**
+   * \brief Returns statistics about the most recent flush.
+   *
+   * \return the statistics of the last flush.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> const surface_batch_stats&
+  {
+    return m_stats;
+  }
+
+ private:
+  struct sprite final
+  {
+    SDL_Surface* surface{};
+    blend_mode blend{};
+    irect source;
+    irect destination;
+    color tint;
+  };
+
+  std::vector<sprite> m_sprites;
+  std::vector<irect> m_damage;
+  std::vector<SDL_Rect> m_updates;
+  std::vector<u32> m_row;
+  surface_batch_stats m_stats;
+
+  [[nodiscard]] static auto layout_of(const SDL_Surface* surface) noexcept
+      -> std::optional<detail::channel_layout>
+  {
+    return detail::packed_layout(static_cast<pixel_format>(surface->format->format));
+  }
+
+  [[nodiscard]] static auto pack(const color& color, const detail::channel_layout& layout)
+      -> u32
+  {
+    return (u32{color.red()} << layout.red) | (u32{color.green()} << layout.green) |
+           (u32{color.blue()} << layout.blue) | (u32{color.alpha()} << layout.alpha);
+  }
+
+  [[nodiscard]] static auto clipped(const irect& area, const irect& bounds) noexcept
+      -> irect
+  {
+    const auto x = std::max(area.x(), bounds.x());
+    const auto y = std::max(area.y(), bounds.y());
+    const auto maxX = std::min(area.max_x(), bounds.max_x());
+    const auto maxY = std::min(area.max_y(), bounds.max_y());
+    return (x < maxX && y < maxY) ? irect{x, y, maxX - x, maxY - y} : irect{};
+  }
+
+  [[nodiscard]] static auto clip_of(const SDL_Surface* surface) noexcept -> irect
+  {
+    const auto& clip = surface->clip_rect;
+    return {clip.x, clip.y, clip.w, clip.h};
+  }
+
+  auto flush_to(SDL_Surface* target) -> bool
+  {
+    CENTURION_PROFILE_ZONE("surface_batch::flush_to");
+
+    m_stats = surface_batch_stats{};
+    m_stats.sprites = m_sprites.size();
+
+    if (!target || SDL_LockSurface(target) != 0) {
+      clear();
+      return false;
+    }
+
+    bool ok = true;
+
+    for (const auto& sprite : m_sprites) {
+      ok = draw(target, sprite) && ok;
+    }
+
+    SDL_UnlockSurface(target);
+    clear();
+
+    return ok;
+  }
+
+  auto draw(SDL_Surface* target, const sprite& sprite) -> bool
+  {
+    const auto& dst = sprite.destination;
+    const auto visible = clipped(dst, clip_of(target));
+
+    const irect bounds{0, 0, sprite.surface->w, sprite.surface->h};
+    const auto source = clipped(sprite.source, bounds);
+
+    if (!visible.has_area() || !source.has_area()) {
+      return true;
+    }
+
+    const auto from = layout_of(sprite.surface);
+    const auto to = layout_of(target);
+    const auto blended = sprite.blend == blend_mode::blend;
+
+    if (!from || !to || (!blended && sprite.blend != blend_mode::none)) {
+      return blit(target, sprite);
+    }
+
+    if (SDL_LockSurface(sprite.surface) != 0) {
+      return false;
+    }
+
+    // Formats without an alpha channel use their unused byte for alpha while blending
+    const auto layout = detail::blend_layout(*to);
+    const auto fromLayout = from->hasAlpha ? *from : detail::blend_layout(*from);
+    const auto tint = pack(sprite.tint, layout);
+    const auto opaque = from->hasAlpha ? 0u : (0xFFu << fromLayout.alpha);
+    const auto tinted = tint != 0xFFFFFFFFu;
+
+    // Nearest neighbour sampling in 16.16 fixed point, at the centers of the pixels
+    const auto stepX = (i64{source.width()} << 16) / dst.width();
+    const auto stepY = (i64{source.height()} << 16) / dst.height();
+
+    const auto width = visible.width();
+    m_row.resize(static_cast<usize>(width));
+
+    const auto* srcPixels = static_cast<const u8*>(sprite.surface->pixels);
+    auto* dstPixels = static_cast<u8*>(target->pixels);
+
+    for (auto y = visible.y(); y < visible.max_y(); ++y) {
+      const auto sy = source.y() + static_cast<int>(((y - dst.y()) * stepY + stepY / 2) >> 16);
+      const auto* srcRow =
+          reinterpret_cast<const u32*>(srcPixels + sy * sprite.surface->pitch);
+      auto* dstRow = reinterpret_cast<u32*>(dstPixels + y * target->pitch) + visible.x();
+
+      auto offset = i64{visible.x() - dst.x()} * stepX + stepX / 2;
+      for (auto& pixel : m_row) {
+        pixel = srcRow[source.x() + static_cast<int>(offset >> 16)] | opaque;
+        offset += stepX;
+      }
+
+      detail::shuffle_row(m_row.data(), m_row.data(), width, fromLayout, layout);
+
+      if (blended) {
+        detail::blend_row(m_row.data(), dstRow, width, layout, tint);
+      }
+      else {
+        if (tinted) {
+          detail::modulate_row(m_row.data(), width, layout, tint);
+        }
+
+        std::copy(m_row.begin(), m_row.end(), dstRow);
+      }
+    }
+
+    SDL_UnlockSurface(sprite.surface);
+
+    m_stats.pixels += static_cast<usize>(width) * static_cast<usize>(visible.height());
+    add_damage(visible);
+
+    return true;
+  }
+
+  auto blit(SDL_Surface* target, const sprite& sprite) -> bool
+  {
+    u8 red{};
+    u8 green{};
+    u8 blue{};
+    u8 alpha{};
+    SDL_BlendMode blend{};
+
+    // The modulation of the surface is already included in the tint
+    SDL_GetSurfaceColorMod(sprite.surface, &red, &green, &blue);
+    SDL_GetSurfaceAlphaMod(sprite.surface, &alpha);
+    SDL_GetSurfaceBlendMode(sprite.surface, &blend);
+
+    SDL_SetSurfaceColorMod(sprite.surface,
+                           sprite.tint.red(),
+                           sprite.tint.green(),
+                           sprite.tint.blue());
+    SDL_SetSurfaceAlphaMod(sprite.surface, sprite.tint.alpha());
+    SDL_SetSurfaceBlendMode(sprite.surface, static_cast<SDL_BlendMode>(sprite.blend));
+
+    // The target is locked during the flush, which SDL_BlitScaled doesn't allow
+    SDL_UnlockSurface(target);
+
+    auto source = sprite.source.get();
+    auto destination = sprite.destination.get();
+    const auto ok = SDL_BlitScaled(sprite.surface, &source, target, &destination) == 0;
+
+    SDL_LockSurface(target);
+
+    SDL_SetSurfaceColorMod(sprite.surface, red, green, blue);
+    SDL_SetSurfaceAlphaMod(sprite.surface, alpha);
+    SDL_SetSurfaceBlendMode(sprite.surface, blend);
+
+    ++m_stats.fallback;
+    if (ok) {
+      add_damage(clipped(sprite.destination, clip_of(target)));
+    }
+
+    return ok;
+  }
+
+  void add_damage(irect area)
+  {
+    // The union of two areas might overlap other areas, so keep merging until it doesn't
+    bool merged = true;
+    while (merged) {
+      merged = false;
+
+      for (auto iter = m_damage.begin(); iter != m_damage.end(); ++iter) {
+        if (intersects(*iter, area)) {
+          area = get_union(*iter, area);
+          m_damage.erase(iter);
+          merged = true;
+          break;
+        }
+      }
+    }
+
+    m_damage.push_back(area);
+
+    if (m_damage.size() > max_rects) {
+      auto bounds = m_damage.front();
+      for (const auto& rect : m_damage) {
+        bounds = get_union(bounds, rect);
+      }
+
+      m_damage.assign(1, bounds);
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_SURFACE_BATCH_HEADER
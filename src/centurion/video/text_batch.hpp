@@ -0,0 +1,355 @@
+#ifndef CENTURION_TEXT_BATCH_HEADER
+#define CENTURION_TEXT_BATCH_HEADER
+
+#include <SDL2/SDL.h>
+
+#ifndef CENTURION_NO_SDL_TTF
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "font_cache.hpp"
+#include "text_layout.hpp"
+#include "unicode_string.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class text_batch
+ *
+ * \brief Collects glyph quads for strings that are rendered with a glyph atlas.
+ *
+ * \details A text batch converts strings into vertex and index buffers, with one pair of
+ * buffers for each atlas page of the associated font cache. The batch can then be
+ * submitted to a renderer with `basic_renderer::render_text()`, which results in a single
+ * `SDL_RenderGeometry` call for each used atlas page (usually just one), rather than one
+ * render call for each glyph.
+ *
+ * \details The buffers keep their capacity when the batch is cleared, so a batch that is
+ * rebuilt every frame will not allocate any memory once it has grown large enough.
+ *
+ * \note Only glyphs that are stored in the glyph atlas of the font cache are added to the
+ * batch, other glyphs are ignored. See `font_cache::use_atlas()`.
+ *
+ * \note The associated font cache must outlive the batch.
+ *
+ * \see `font_cache`
+ * \see `basic_renderer::render_text()`
+ *
+ * \since 6.4.0
+ */
+class text_batch final
+{
+ public:
+  /**
+   * \brief Creates an empty text batch.
+   *
+   * \param cache the font cache that provides the glyph atlas.
+   *
+   * \since 6.4.0
+   */
+  explicit text_batch(const font_cache& cache) noexcept : m_cache{&cache}
+  {}
+
+  /**
+   * \brief Adds the glyphs of a string to the batch.
+   *
+   * \details The glyphs are positioned in the same way as with
+   * `basic_renderer::render_text()`, i.e. no kerning is applied.
+   *
+   * \note This function is sensitive to newline-characters.
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters, e.g. `unicode_string` or `utf8_view`.
+   *
+   * \param str the string that will be added.
+   * \param position the position of the text.
+   * \param tint the color that is used to modulate the glyphs.
+   *
+   * \since 6.4.0
+   */
+  template <typename String>
+  void add(const String& str, ipoint position, const color& tint = colors::white)
+  {
+    const auto& font = m_cache->get_font();
+
+    const auto originalX = position.x();
+    const auto lineSkip = font.line_skip();
+
+    for (const unicode glyph : str) {
+      if (glyph == '\n') {
+        position.set_x(originalX);
+        position.set_y(position.y() + lineSkip);
+      }
+      else {
+        position.set_x(place_glyph(glyph, position, tint));
+      }
+    }
+  }
+
+  /**
+   * \brief Adds the glyphs of a text layout to the batch.
+   *
+   * \details The glyphs are positioned according to the layout, i.e. with kerning and
+   * wrapping applied.
+   *
+   * \param layout the text layout that will be added, must use the same font cache as the
+   * batch.
+   * \param position the position of the text.
+   * \param tint the color that is used to modulate the glyphs.
+   *
+   * \since 6.4.0
+   */
+  void add(const text_layout& layout, const ipoint position, const color& tint = colors::white)
+  {
+    assert(&layout.get_cache() == m_cache);
+    for (const auto& [glyph, offset] : layout.glyphs()) {
+      place_glyph(glyph, position + offset, tint);
+    }
+  }
+
+  /**
+   * \brief Adds a single glyph to the batch.
+   *
+   * \details The glyph is positioned in the same way as the glyphs of a text layout, which
+   * makes it possible to add glyphs that have been positioned by other means, e.g. by a
+   * `rich_text`.
+   *
+   * \param glyph the glyph that will be added.
+   * \param position the position of the glyph.
+   * \param tint the color that is used to modulate the glyph.
+   *
+   * \return `true` if the glyph was added; `false` if it isn't in the glyph atlas.
+   *
+   * \since 6.4.0
+   */
+  auto add_glyph(const unicode glyph, const ipoint position, const color& tint = colors::white)
+      -> bool
+  {
+    if (m_cache->try_at_atlas(glyph)) {
+      place_glyph(glyph, position, tint);
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Adds a shaped run to the batch.
+   *
+   * \details The run is added as a single quad, and is counted as one glyph by
+   * `glyph_count()`. Runs are positioned like strings added with `add()`, so that shaped
+   * and unshaped text line up.
+   *
+   * \param id the identifier of a run stored with `font_cache::store_shaped_utf8()`.
+   * \param position the position of the text.
+   * \param tint the color that is used to modulate the run.
+   *
+   * \return `true` if the run was added; `false` if there is no run with the ID.
+   *
+   * \since 6.4.0
+   */
+  auto add_shaped(const font_cache::id_type id,
+                  const ipoint position,
+                  const color& tint = colors::white) -> bool
+  {
+    if (const auto* run = m_cache->try_get_shaped(id)) {
+      const auto outline = m_cache->get_font().outline();
+      const ipoint origin{position.x() - outline, position.y() - outline};
+
+      add_quad(run->page, run->source, irect{origin, run->source.size()}, tint);
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Removes all glyphs from the batch.
+   *
+   * \details The capacity of the internal buffers is retained.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    for (auto& page : m_pages) {
+      page.vertices.clear();
+      page.indices.clear();
+    }
+  }
+
+  /**
+   * \brief Returns the amount of glyphs in the batch.
+   *
+   * \return the number of glyphs.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto glyph_count() const noexcept -> usize
+  {
+    usize count = 0;
+    for (const auto& page : m_pages) {
+      count += page.vertices.size() / 4u;
+    }
+    return count;
+  }
+
+  /**
+   * \brief Indicates whether or not the batch contains any glyphs.
+   *
+   * \return `true` if the batch is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return glyph_count() == 0;
+  }
+
+  /**
+   * \brief Returns the amount of atlas pages that the batch has buffers for.
+   *
+   * \return the number of atlas pages, some of which might have empty buffers.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page_count() const noexcept -> usize
+  {
+    return m_pages.size();
+  }
+
+  /**
+   * \brief Returns the vertices associated with an atlas page.
+   *
+   * \param page the index of the atlas page.
+   *
+   * \return the vertices of the glyph quads on the page.
+   *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto vertices(const usize page) const -> const std::vector<SDL_Vertex>&
+  {
+    return m_pages.at(page).vertices;
+  }
+
+  /**
+   * \brief Returns the indices associated with an atlas page.
+   *
+   * \param page the index of the atlas page.
+   *
+   * \return the indices of the glyph quads on the page, six for each glyph.
+   *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto indices(const usize page) const -> const std::vector<int>&
+  {
+    return m_pages.at(page).indices;
+  }
+
+  /**
+   * \brief Returns the font cache associated with the batch.
+   *
+   * \return the associated font cache.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_cache() const noexcept -> const font_cache&
+  {
+    return *m_cache;
+  }
+
+ private:
+  struct page_buffers final
+  {
+    std::vector<SDL_Vertex> vertices;  ///< Four vertices for each glyph.
+    std::vector<int> indices;          ///< Six indices for each glyph.
+    farea size{};                      ///< The size of the atlas page texture.
+  };
+
+  const font_cache* m_cache{};
+  std::vector<page_buffers> m_pages;
+
+  auto place_glyph(const unicode glyph, const ipoint position, const color& tint) -> int
+  {
+    if (const auto* data = m_cache->try_at_atlas(glyph)) {
+      const auto& [source, metrics, page] = *data;
+
+      const auto outline = m_cache->get_font().outline();
+
+      // SDL_ttf handles the y-axis alignment
+      const auto x = position.x() + metrics.minX - outline;
+      const auto y = position.y() - outline;
+
+      add_quad(page, source, irect{{x, y}, source.size()}, tint);
+
+      return x + metrics.advance;
+    }
+    else {
+      return position.x();
+    }
+  }
+
+  void add_quad(const usize page, const irect& source, const irect& dst, const color& tint)
+  {
+    auto& buffers = get_buffers(page);
+
+    const auto u0 = static_cast<float>(source.x()) / buffers.size.width;
+    const auto v0 = static_cast<float>(source.y()) / buffers.size.height;
+    const auto u1 = static_cast<float>(source.max_x()) / buffers.size.width;
+    const auto v1 = static_cast<float>(source.max_y()) / buffers.size.height;
+
+    const auto x0 = static_cast<float>(dst.x());
+    const auto y0 = static_cast<float>(dst.y());
+    const auto x1 = static_cast<float>(dst.max_x());
+    const auto y1 = static_cast<float>(dst.max_y());
+
+    const auto& rgba = tint.get();
+    const auto first = static_cast<int>(buffers.vertices.size());
+
+    buffers.vertices.push_back({{x0, y0}, rgba, {u0, v0}});
+    buffers.vertices.push_back({{x1, y0}, rgba, {u1, v0}});
+    buffers.vertices.push_back({{x1, y1}, rgba, {u1, v1}});
+    buffers.vertices.push_back({{x0, y1}, rgba, {u0, v1}});
+
+    buffers.indices.push_back(first);
+    buffers.indices.push_back(first + 1);
+    buffers.indices.push_back(first + 2);
+    buffers.indices.push_back(first + 2);
+    buffers.indices.push_back(first + 3);
+    buffers.indices.push_back(first);
+  }
+
+  [[nodiscard]] auto get_buffers(const usize page) -> page_buffers&
+  {
+    while (m_pages.size() <= page) {
+      auto& buffers = m_pages.emplace_back();
+      buffers.size = cast<farea>(m_cache->atlas_page(m_pages.size() - 1).size());
+    }
+
+    return m_pages[page];
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_TEXT_BATCH_HEADER
@@ -0,0 +1,301 @@
+#ifndef CENTURION_TEXT_LAYOUT_HEADER
+#define CENTURION_TEXT_LAYOUT_HEADER
+
+#ifndef CENTURION_NO_SDL_TTF
+
+#include <SDL2/SDL_ttf.h>
+
+#include <algorithm>  // max, equal
+#include <cassert>    // assert
+#include <iterator>   // begin, end
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "font.hpp"
+#include "font_cache.hpp"
+#include "unicode_string.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class text_layout
+ *
+ * \brief Represents a cached layout of a string, based on the glyphs in a font cache.
+ *
+ * \details A text layout computes the positions of all glyphs in a string once, taking
+ * kerning, line breaks, line skip and an optional wrap width into account. The computed
+ * run can then be rendered every frame with `basic_renderer::render_text()` (or added to
+ * a `text_batch`), without any dynamic allocations, until the string changes.
+ *
+ * \details Kerning is applied if the font of the cache has kerning enabled, see
+ * `font::set_kerning()`. If a wrap width is set, lines are broken at the last space
+ * that precedes the glyph that would exceed the wrap width. Words that are wider than
+ * the wrap width are broken at the glyph that exceeds the width.
+ *
+ * \note Glyphs that aren't available in the font cache are ignored.
+ *
+ * \note The associated font cache must outlive the layout, and the layout must be
+ * recomputed (with `update()`) if glyphs are added to the cache afterwards.
+ *
+ * \see `font_cache`
+ * \see `basic_renderer::render_text()`
+ *
+ * \since 6.4.0
+ */
+class text_layout final
+{
+ public:
+  /**
+   * \struct glyph_position
+   *
+   * \brief Represents a glyph that has been positioned by a text layout.
+   *
+   * \since 6.4.0
+   */
+  struct glyph_position final
+  {
+    unicode glyph{};  ///< The glyph.
+    ipoint position;  ///< The pen position of the glyph, relative to the layout origin.
+  };
+
+  /**
+   * \brief Creates an empty text layout.
+   *
+   * \param cache the font cache that provides the glyphs.
+   * \param wrapWidth the maximum width of a line, in pixels, zero disables wrapping.
+   *
+   * \since 6.4.0
+   */
+  explicit text_layout(const font_cache& cache, const int wrapWidth = 0) noexcept
+      : m_cache{&cache}
+      , m_wrapWidth{wrapWidth}
+  {
+    assert(wrapWidth >= 0);
+  }
+
+  /**
+   * \brief Sets the string that is laid out.
+   *
+   * \details The layout is only recomputed if the string differs from the current string.
+   * The internal buffers are reused, so no allocations take place unless the string grows
+   * beyond any previous string.
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters, e.g. `unicode_string` or `utf8_view`.
+   *
+   * \param str the string that will be laid out.
+   *
+   * \since 6.4.0
+   */
+  template <typename String>
+  void set_text(const String& str)
+  {
+    using std::begin;
+    using std::end;
+
+    if (!std::equal(m_text.begin(), m_text.end(), begin(str), end(str))) {
+      m_text.assign(begin(str), end(str));
+      update();
+    }
+  }
+
+  /**
+   * \brief Sets the maximum width of a line.
+   *
+   * \param width the wrap width, in pixels, zero disables wrapping.
+   *
+   * \since 6.4.0
+   */
+  void set_wrap_width(const int width)
+  {
+    assert(width >= 0);
+    if (m_wrapWidth != width) {
+      m_wrapWidth = width;
+      update();
+    }
+  }
+
+  /**
+   * \brief Recomputes the layout of the current string.
+   *
+   * \details This function should be called if the font cache or font has changed, e.g.
+   * if new glyphs have been added to the cache or if the kerning setting has changed.
+   *
+   * \since 6.4.0
+   */
+  void update()
+  {
+    const auto& font = m_cache->get_font();
+    const auto lineSkip = font.line_skip();
+    const auto kerning = font.has_kerning();
+
+    m_glyphs.clear();
+    m_width = 0;
+    m_lines = m_text.empty() ? 0 : 1;
+
+    ipoint pen;
+    unicode previous{};
+    usize lineStart = 0;
+    usize wordStart = 0;
+    int lineWidth = 0;  // Width of the current line, excluding trailing spaces
+    int wordWidth = 0;  // Width of the current line up to the current word
+
+    for (const auto glyph : m_text) {
+      if (glyph == '\n') {
+        m_width = std::max(m_width, lineWidth);
+        lineWidth = wordWidth = 0;
+
+        pen.set_x(0);
+        pen.set_y(pen.y() + lineSkip);
+        previous = 0;
+        lineStart = wordStart = m_glyphs.size();
+        ++m_lines;
+        continue;
+      }
+
+      const auto* metrics = m_cache->try_metrics(glyph);
+      if (!metrics) {
+        continue;
+      }
+
+      if (kerning && previous != 0) {
+        pen.set_x(pen.x() + font.kerning_amount(previous, glyph));
+      }
+
+      if (m_wrapWidth > 0 && glyph != ' ' && m_glyphs.size() > lineStart &&
+          pen.x() + metrics->advance > m_wrapWidth)
+      {
+        if (wordStart > lineStart && wordStart < m_glyphs.size()) {
+          // Move the current word to the next line
+          const auto offset = m_glyphs[wordStart].position.x();
+          for (auto index = wordStart; index < m_glyphs.size(); ++index) {
+            auto& position = m_glyphs[index].position;
+            position.set_x(position.x() - offset);
+            position.set_y(position.y() + lineSkip);
+          }
+
+          pen.set_x(pen.x() - offset);
+          lineStart = wordStart;
+
+          // The previous line ends before the moved word
+          m_width = std::max(m_width, wordWidth);
+          lineWidth = pen.x();
+          wordWidth = 0;
+        }
+        else {
+          m_width = std::max(m_width, lineWidth);
+          lineWidth = wordWidth = 0;
+
+          pen.set_x(0);
+          previous = 0;
+          lineStart = wordStart = m_glyphs.size();
+        }
+
+        pen.set_y(pen.y() + lineSkip);
+        ++m_lines;
+      }
+
+      m_glyphs.push_back({glyph, pen});
+      pen.set_x(pen.x() + metrics->advance);
+
+      // Trailing spaces don't contribute to the width of a line
+      if (glyph == ' ') {
+        wordStart = m_glyphs.size();
+        wordWidth = lineWidth;
+      }
+      else {
+        lineWidth = pen.x();
+      }
+
+      previous = glyph;
+    }
+
+    m_width = std::max(m_width, lineWidth);
+  }
+
+  /**
+   * \brief Returns the positioned glyphs of the layout.
+   *
+   * \return the positioned glyphs, in the same order as in the string.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto glyphs() const noexcept -> const std::vector<glyph_position>&
+  {
+    return m_glyphs;
+  }
+
+  /**
+   * \brief Returns the amount of lines in the layout.
+   *
+   * \return the number of lines, including lines created by wrapping.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto line_count() const noexcept -> int
+  {
+    return m_lines;
+  }
+
+  /**
+   * \brief Returns the size of the area occupied by the laid out text.
+   *
+   * \return the size of the text, based on the glyph advances and the font line skip.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    if (m_lines == 0) {
+      return {0, 0};
+    }
+    else {
+      const auto& font = m_cache->get_font();
+      return {m_width, (m_lines - 1) * font.line_skip() + font.height()};
+    }
+  }
+
+  /**
+   * \brief Returns the maximum width of a line.
+   *
+   * \return the wrap width, zero if wrapping is disabled.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto wrap_width() const noexcept -> int
+  {
+    return m_wrapWidth;
+  }
+
+  /**
+   * \brief Returns the font cache associated with the layout.
+   *
+   * \return the associated font cache.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get_cache() const noexcept -> const font_cache&
+  {
+    return *m_cache;
+  }
+
+ private:
+  const font_cache* m_cache{};
+  std::vector<unicode> m_text;
+  std::vector<glyph_position> m_glyphs;
+  int m_wrapWidth{};
+  int m_width{};
+  int m_lines{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_TEXT_LAYOUT_HEADER
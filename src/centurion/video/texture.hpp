@@ -4,14 +4,16 @@
 #include <SDL2/SDL.h>
 
 #include "../compiler/features.hpp"
+#include "../compiler/linkage.hpp"
 
 #ifndef CENTURION_NO_SDL_IMAGE
 #include <SDL2/SDL_image.h>
 #endif  // CENTURION_NO_SDL_IMAGE
 
-#include <cassert>  // assert
-#include <ostream>  // ostream
-#include <string>   // string, to_string
+#include <cassert>   // assert
+#include <optional>  // optional
+#include <ostream>   // ostream
+#include <string>    // string, to_string
 
 #if CENTURION_HAS_FEATURE_FORMAT
 
@@ -20,21 +22,27 @@
 #endif  // CENTURION_HAS_FEATURE_FORMAT
 
 #include "../core/exception.hpp"
+#include "../core/expected.hpp"
 #include "../core/integers.hpp"
+#include "../core/library.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
 #include "../core/str.hpp"
 #include "../detail/address_of.hpp"
 #include "../detail/owner_handle_api.hpp"
+#include "../filesystem/file.hpp"
 #include "../math/area.hpp"
 #include "../math/point.hpp"
+#include "../math/rect.hpp"
 #include "blend_mode.hpp"
 #include "color.hpp"
+#include "dirty_region.hpp"
 #include "pixel_format_info.hpp"
 #include "scale_mode.hpp"
 #include "surface.hpp"
 #include "texture_access.hpp"
+#include "texture_memory.hpp"
 
 namespace cen {
 
@@ -87,6 +95,8 @@ class basic_texture final
       {
         throw cen_error{"Cannot create texture from null pointer!"};
       }
+
+      texture_memory::track(m_texture.get());
     }
   }
 
@@ -119,11 +129,15 @@ class basic_texture final
    */
   template <typename Renderer, typename TT = T, detail::is_owner<TT> = 0>
   basic_texture(const Renderer& renderer, const not_null<str> path)
-      : m_texture{IMG_LoadTexture(renderer.get(), path)}
   {
+    library::ensure(library_subsystem::image);
+
+    m_texture.reset(IMG_LoadTexture(renderer.get(), path));
     if (!m_texture) {
       throw img_error{};
     }
+
+    texture_memory::track(m_texture.get());
   }
 
   /**
@@ -143,6 +157,74 @@ class basic_texture final
       : basic_texture{renderer, path.c_str()}
   {}
 
+  /**
+   * \brief Creates a texture by decoding the image data of an open file.
+   *
+   * \details The image data is read from the current offset of the file, which makes it
+   * possible to load textures from files in packed archives. The file is not closed.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture.
+   * \param source the file that the image data is read from, must be valid.
+   *
+   * \throws img_error if the texture cannot be loaded.
+   *
+   * \see `IMG_LoadTexture_RW`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer, typename TT = T, detail::is_owner<TT> = 0>
+  basic_texture(const Renderer& renderer, file& source)
+  {
+    library::ensure(library_subsystem::image);
+
+    m_texture.reset(IMG_LoadTexture_RW(renderer.get(), source.get(), 0));
+    if (!m_texture) {
+      throw img_error{};
+    }
+
+    texture_memory::track(m_texture.get());
+  }
+
+  /**
+   * \brief Attempts to load a texture based on an image file, without throwing.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture.
+   * \param path the file path of the image, cannot be null.
+   *
+   * \return the loaded texture; an `error_code::img` error if the image couldn't be loaded.
+   *
+   * \see `expected`
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer, typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto try_load(const Renderer& renderer,
+                                     const not_null<str> path) noexcept
+      -> expected<basic_texture>
+  {
+    assert(path);
+
+    if (auto* loaded = IMG_LoadTexture(renderer.get(), path)) {
+      return basic_texture{loaded};
+    }
+    else {
+      return error_info{error_code::img};
+    }
+  }
+
+  /// \copydoc try_load()
+  template <typename Renderer, typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto try_load(const Renderer& renderer,
+                                     const std::string& path) noexcept
+      -> expected<basic_texture>
+  {
+    return try_load(renderer, path.c_str());
+  }
+
 #endif  // CENTURION_NO_SDL_IMAGE
 
   /**
@@ -164,6 +246,8 @@ class basic_texture final
     if (!m_texture) {
       throw sdl_error{};
     }
+
+    texture_memory::track(m_texture.get());
   }
 
   /**
@@ -194,6 +278,8 @@ class basic_texture final
     if (!m_texture) {
       throw sdl_error{};
     }
+
+    texture_memory::track(m_texture.get());
   }
 
   /**
@@ -264,6 +350,9 @@ class basic_texture final
    * \details This function has no effect if the texture access isn't `streaming` or if
    * the coordinate is out-of-bounds.
    *
+   * \note Use `texture_lock` when modifying many pixels, since this function locks the
+   * texture for each pixel.
+   *
    * \param pixel the pixel that will be changed.
    * \param color the new color of the pixel.
    *
@@ -277,21 +366,214 @@ class basic_texture final
       return;
     }
 
-    u32* pixels{};
+    // Only the affected pixel is locked, since the locked pixels are write-only
+    const irect area{pixel, {1, 1}};
+
+    void* pixels{};
     int pitch{};
-    if (!lock(&pixels, &pitch)) {
+    if (SDL_LockTexture(m_texture, area.data(), &pixels, &pitch) != 0) {
       return;
     }
 
-    const int nPixels = (pitch / 4) * height();
-    const int index = (pixel.y() * width()) + pixel.x();
+    const pixel_format_info info{format()};
+    *static_cast<u32*>(pixels) = info.rgba_to_pixel(color);
+
+    unlock();
+  }
+
+  /**
+   * \brief Replaces the pixel data in an area of the texture.
+   *
+   * \details This function can be used with textures of any access, and is the preferred
+   * way of modifying textures that change rather infrequently, such as static textures that
+   * are gradually filled with new content.
+   *
+   * \pre The supplied pixel data must be in the pixel format of the texture.
+   *
+   * \param area the area of the texture that will be updated; `std::nullopt` indicates
+   * that the entire texture will be updated.
+   * \param pixels the new pixel data, in the format of the texture.
+   * \param pitch the number of bytes in a row of the pixel data, including padding.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \see `SDL_UpdateTexture`
+   *
+   * \since 6.4.0
+   */
+  auto update(const std::optional<irect> area,
+              const not_null<const void*> pixels,
+              const int pitch) noexcept -> result
+  {
+    assert(pixels);
+    return SDL_UpdateTexture(m_texture, area ? area->data() : nullptr, pixels, pitch) == 0;
+  }
+
+  /**
+   * \brief Replaces the pixel data in an area of a planar YUV texture.
+   *
+   * \details This function uploads the separate Y, U and V planes of a decoded video frame
+   * directly, so the conversion to RGB is performed by the render driver, typically on
+   * the GPU, instead of on the CPU. The chroma planes are subsampled by a factor of two in
+   * both directions.
+   * \code{cpp}
+   *   cen::texture frame{renderer,
+   *                      cen::pixel_format::iyuv,
+   *                      cen::texture_access::streaming,
+   *                      videoSize};
+   *
+   *   frame.update_yuv(std::nullopt,
+   *                    decoded.y,
+   *                    decoded.yPitch,
+   *                    decoded.u,
+   *                    decoded.uPitch,
+   *                    decoded.v,
+   *                    decoded.vPitch);
+   * \endcode
+   *
+   * \pre The pixel format of the texture must be either `yv12` or `iyuv`.
+   * \pre The position and size of the area must be even.
+   *
+   * \param area the area of the texture that will be updated; `std::nullopt` indicates
+   * that the entire texture will be updated.
+   * \param yPlane the luminance plane.
+   * \param yPitch the number of bytes in a row of the luminance plane.
+   * \param uPlane the U (Cb) chroma plane.
+   * \param uPitch the number of bytes in a row of the U plane.
+   * \param vPlane the V (Cr) chroma plane.
+   * \param vPitch the number of bytes in a row of the V plane.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \see `SDL_UpdateYUVTexture`
+   *
+   * \since 6.4.0
+   */
+  auto update_yuv(const std::optional<irect> area,
+                  const not_null<const u8*> yPlane,
+                  const int yPitch,
+                  const not_null<const u8*> uPlane,
+                  const int uPitch,
+                  const not_null<const u8*> vPlane,
+                  const int vPitch) noexcept -> result
+  {
+    assert(yPlane);
+    assert(uPlane);
+    assert(vPlane);
+    assert(format() == pixel_format::yv12 || format() == pixel_format::iyuv);
+    return SDL_UpdateYUVTexture(m_texture,
+                                area ? area->data() : nullptr,
+                                yPlane,
+                                yPitch,
+                                uPlane,
+                                uPitch,
+                                vPlane,
+                                vPitch) == 0;
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+
+  /**
+   * \brief Replaces the pixel data in an area of a semi-planar YUV texture.
+   *
+   * \details This function uploads the luminance plane and the interleaved chroma plane
+   * of a decoded video frame directly, which is the layout produced by most hardware
+   * video decoders. The conversion to RGB is performed by the render driver.
+   *
+   * \pre The pixel format of the texture must be either `nv12` or `nv21`.
+   * \pre The position and size of the area must be even.
+   *
+   * \param area the area of the texture that will be updated; `std::nullopt` indicates
+   * that the entire texture will be updated.
+   * \param yPlane the luminance plane.
+   * \param yPitch the number of bytes in a row of the luminance plane.
+   * \param uvPlane the interleaved chroma plane, in the order given by the pixel format.
+   * \param uvPitch the number of bytes in a row of the chroma plane.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \see `SDL_UpdateNVTexture`
+   *
+   * \since 6.4.0
+   */
+  auto update_nv(const std::optional<irect> area,
+                 const not_null<const u8*> yPlane,
+                 const int yPitch,
+                 const not_null<const u8*> uvPlane,
+                 const int uvPitch) noexcept -> result
+  {
+    assert(yPlane);
+    assert(uvPlane);
+    assert(format() == pixel_format::nv12 || format() == pixel_format::nv21);
+    return SDL_UpdateNVTexture(m_texture,
+                               area ? area->data() : nullptr,
+                               yPlane,
+                               yPitch,
+                               uvPlane,
+                               uvPitch) == 0;
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+
+  /**
+   * \brief Uploads the modified area of a surface to the texture.
+   *
+   * \details Only the area marked as modified in the dirty region is locked and copied,
+   * which is considerably cheaper than uploading the entire texture when only a small
+   * part of it has changed. The dirty region is cleared if the upload is successful. This
+   * function does nothing if the dirty region isn't dirty.
+   *
+   * \pre The texture access must be `streaming`.
+   * \pre The surface must have the same size and pixel format as the texture.
+   *
+   * \param source the surface that holds the current pixel data of the texture.
+   * \param region the modified area of the surface.
+   *
+   * \return `success` if the modified area was uploaded; `failure` otherwise.
+   *
+   * \see `dirty_region`
+   *
+   * \since 6.4.0
+   */
+  template <typename U>
+  auto upload(const basic_surface<U>& source, dirty_region& region) noexcept -> result
+  {
+    assert(is_streaming());
+    assert(source.size() == size());
+    assert(source.format_info().format() == format());
+    assert(!source.must_lock());
+
+    if (!region.is_dirty()) {
+      return success;
+    }
+
+    const auto& area = region.area();
+
+    void* pixels{};
+    int pitch{};
+    if (SDL_LockTexture(m_texture, area.data(), &pixels, &pitch) != 0) {
+      return failure;
+    }
+
+    const auto bpp = static_cast<usize>(source.get()->format->BytesPerPixel);
+    const auto rowSize = static_cast<usize>(area.width()) * bpp;
+    const auto sourcePitch = static_cast<usize>(source.pitch());
 
-    if ((index >= 0) && (index < nPixels)) {
-      const pixel_format_info info{format()};
-      pixels[index] = info.rgba_to_pixel(color);
+    const auto* src = static_cast<const u8*>(source.pixels()) +
+                      static_cast<usize>(area.y()) * sourcePitch +
+                      static_cast<usize>(area.x()) * bpp;
+    auto* dst = static_cast<u8*>(pixels);
+
+    for (auto row = 0; row < area.height(); ++row) {
+      SDL_memcpy(dst, src, rowSize);
+      src += sourcePitch;
+      dst += pitch;
     }
 
     unlock();
+    region.clear();
+
+    return success;
   }
 
   /**
@@ -318,6 +600,26 @@ class basic_texture final
     SDL_SetTextureBlendMode(m_texture, static_cast<SDL_BlendMode>(mode));
   }
 
+  /**
+   * \brief Sets the blend mode of the texture to one suitable for premultiplied alpha.
+   *
+   * \details Use this function for textures whose color components have already been
+   * multiplied with their alpha components, e.g. textures created from surfaces that have
+   * been processed with `basic_surface::premultiply_alpha()`.
+   *
+   * \return `success` if the blend mode was set; `failure` if the renderer doesn't support
+   * custom blend modes.
+   *
+   * \see `premultiplied_blend_mode()`
+   *
+   * \since 6.4.0
+   */
+  auto set_premultiplied_blend_mode() noexcept -> result
+  {
+    const auto mode = static_cast<SDL_BlendMode>(premultiplied_blend_mode());
+    return SDL_SetTextureBlendMode(m_texture, mode) == 0;
+  }
+
   /**
    * \brief Sets the color modulation of the texture.
    *
@@ -534,6 +836,7 @@ class basic_texture final
   template <typename TT = T, detail::is_owner<TT> = 0>
   [[nodiscard]] auto release() noexcept -> owner<SDL_Texture*>
   {
+    texture_memory::untrack(m_texture.get());
     return m_texture.release();
   }
 
@@ -598,6 +901,7 @@ class basic_texture final
   {
     void operator()(SDL_Texture* texture) noexcept
     {
+      texture_memory::untrack(texture);
       SDL_DestroyTexture(texture);
     }
   };
@@ -692,6 +996,13 @@ auto operator<<(std::ostream& stream, const basic_texture<T>& texture) -> std::o
 
 /// \} End of streaming
 
+#if CENTURION_EXTERN_TEMPLATES
+
+extern template class CENTURION_API basic_texture<detail::owning_type>;
+extern template class CENTURION_API basic_texture<detail::handle_type>;
+
+#endif  // CENTURION_EXTERN_TEMPLATES
+
 /// \} End of group video
 
 }  // namespace cen
@@ -0,0 +1,573 @@
+#ifndef CENTURION_TEXTURE_ATLAS_HEADER
+#define CENTURION_TEXTURE_ATLAS_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>      // sort, max, copy_n
+#include <cassert>        // assert
+#include <cstddef>        // ptrdiff_t
+#include <limits>         // numeric_limits
+#include <optional>       // optional, nullopt
+#include <string>         // string
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "blend_mode.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class texture_atlas
+ *
+ * \brief Represents a set of textures that contain many packed images.
+ *
+ * \details Rendering sprites that share a texture avoids texture switches, which enables
+ * the renderer to batch the draw calls. A texture atlas holds one or several page
+ * textures, along with the named areas (regions) of the packed images. Texture atlases
+ * are created with `atlas_builder`.
+ *
+ * \see `atlas_builder`
+ *
+ * \since 6.4.0
+ */
+class texture_atlas final
+{
+ public:
+  /**
+   * \struct region
+   *
+   * \brief Describes the location of a packed image in a texture atlas.
+   *
+   * \since 6.4.0
+   */
+  struct region final
+  {
+    usize page{};  ///< The index of the page that contains the image.
+    irect source;  ///< The area of the image in the page.
+  };
+
+  /**
+   * \brief Renders a packed image.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   * \tparam T the representation type of the destination rectangle.
+   *
+   * \param renderer the renderer that will be used.
+   * \param name the name of the packed image.
+   * \param destination the position and size of the rendered image.
+   *
+   * \return `success` if the image was rendered; `failure` if the image doesn't exist or
+   * couldn't be rendered.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer, typename T>
+  auto render(Renderer& renderer, const std::string& name, const basic_rect<T>& destination)
+      const -> result
+  {
+    if (const auto it = m_regions.find(name); it != m_regions.end()) {
+      const auto& [page, source] = it->second;
+      return renderer.render(m_pages.at(page), source, destination);
+    }
+    else {
+      return failure;
+    }
+  }
+
+  /**
+   * \brief Returns the region of a packed image.
+   *
+   * \param name the name of the packed image.
+   *
+   * \return the region of the image; `std::nullopt` if there is no such image.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto find(const std::string& name) const -> std::optional<region>
+  {
+    if (const auto it = m_regions.find(name); it != m_regions.end()) {
+      return it->second;
+    }
+    else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Returns the region of a packed image.
+   *
+   * \param name the name of the packed image.
+   *
+   * \return the region of the image.
+   *
+   * \throws cen_error if there is no image with the specified name.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto at(const std::string& name) const -> const region&
+  {
+    if (const auto it = m_regions.find(name); it != m_regions.end()) {
+      return it->second;
+    }
+    else {
+      throw cen_error{"Invalid texture atlas region name!"};
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the atlas contains an image.
+   *
+   * \param name the name of the packed image.
+   *
+   * \return `true` if the atlas contains the image; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto contains(const std::string& name) const -> bool
+  {
+    return m_regions.find(name) != m_regions.end();
+  }
+
+  /**
+   * \brief Returns the texture of a page.
+   *
+   * \param index the index of the page.
+   *
+   * \return the page texture.
+   *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page(const usize index) -> texture&
+  {
+    return m_pages.at(index);
+  }
+
+  /// \copydoc page()
+  [[nodiscard]] auto page(const usize index) const -> const texture&
+  {
+    return m_pages.at(index);
+  }
+
+  /**
+   * \brief Returns the texture of the page that contains a region.
+   *
+   * \param region the region of a packed image.
+   *
+   * \return the page texture that contains the region.
+   *
+   * \throws std::out_of_range if the region doesn't belong to the atlas.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page_of(const region& region) const -> const texture&
+  {
+    return m_pages.at(region.page);
+  }
+
+  /**
+   * \brief Returns the amount of pages in the atlas.
+   *
+   * \return the number of page textures.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page_count() const noexcept -> usize
+  {
+    return m_pages.size();
+  }
+
+  /**
+   * \brief Returns the amount of images in the atlas.
+   *
+   * \return the number of packed images.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto region_count() const noexcept -> usize
+  {
+    return m_regions.size();
+  }
+
+ private:
+  friend class atlas_builder;
+
+  std::vector<texture> m_pages;
+  std::unordered_map<std::string, region> m_regions;
+
+  texture_atlas() = default;
+};
+
+/**
+ * \class atlas_builder
+ *
+ * \brief Packs images into texture atlases.
+ *
+ * \details Images are packed with the skyline bottom-left algorithm, in order of
+ * decreasing height, which results in tightly packed pages for typical sprite sets.
+ * Additional pages are created when the images don't fit in a single page, and each
+ * page is cropped to the area used by its images.
+ *
+ * \details The images are copied into `argb8888` pages without blending, so their alpha
+ * channels are preserved. The page textures use the `blend` blend mode.
+ *
+ * \see `texture_atlas`
+ *
+ * \since 6.4.0
+ */
+class atlas_builder final
+{
+ public:
+  /**
+   * \brief Creates an empty atlas builder.
+   *
+   * \param pageSize the maximum size of the atlas pages.
+   * \param padding the amount of empty pixels between packed images, avoids bleeding
+   * when the images are filtered.
+   *
+   * \since 6.4.0
+   */
+  explicit atlas_builder(const iarea pageSize = default_page_size(), const int padding = 1)
+      : m_pageSize{pageSize}
+      , m_padding{padding}
+  {
+    assert(pageSize.width > 0);
+    assert(pageSize.height > 0);
+    assert(padding >= 0);
+  }
+
+  /**
+   * \brief Adds an image that will be packed into the atlas.
+   *
+   * \param name the unique name of the image.
+   * \param image the image that will be packed, it is copied by this function.
+   *
+   * \throws cen_error if the name is already used, or if the image is larger than a page.
+   * \throws sdl_error if the image cannot be converted to the atlas pixel format.
+   *
+   * \since 6.4.0
+   */
+  void add(std::string name, const surface& image)
+  {
+    if (image.width() > m_pageSize.width || image.height() > m_pageSize.height) {
+      throw cen_error{"Image does not fit in a texture atlas page!"};
+    }
+
+    for (const auto& entry : m_images) {
+      if (entry.name == name) {
+        throw cen_error{"Duplicate texture atlas image name!"};
+      }
+    }
+
+    m_images.push_back(pending_image{std::move(name), image.convert(pixel_format::argb8888)});
+  }
+
+  /**
+   * \brief Packs the added images and uploads the pages as textures.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the page textures.
+   *
+   * \return the created texture atlas.
+   *
+   * \throws sdl_error if a page cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto build(const Renderer& renderer) const -> texture_atlas
+  {
+    texture_atlas atlas;
+
+    std::vector<usize> order(m_images.size());
+    for (usize index = 0; index < order.size(); ++index) {
+      order[index] = index;
+    }
+
+    std::sort(order.begin(), order.end(), [this](const usize a, const usize b) {
+      const auto& lhs = m_images[a].pixels;
+      const auto& rhs = m_images[b].pixels;
+      return (lhs.height() != rhs.height()) ? lhs.height() > rhs.height()
+                                            : lhs.width() > rhs.width();
+    });
+
+    std::vector<skyline> pages;
+    std::vector<iarea> used;
+
+    for (const auto index : order) {
+      const auto& image = m_images[index];
+      const auto size = image.pixels.size();
+
+      std::optional<region_type> placed;
+      for (usize page = 0; page < pages.size() && !placed; ++page) {
+        if (const auto position = pages[page].insert(size, m_padding)) {
+          placed = region_type{page, irect{*position, size}};
+        }
+      }
+
+      if (!placed) {
+        auto& page = pages.emplace_back(m_pageSize);
+        used.push_back(iarea{});
+
+        const auto position = page.insert(size, m_padding);
+        assert(position);
+
+        placed = region_type{pages.size() - 1, irect{*position, size}};
+      }
+
+      auto& bounds = used.at(placed->page);
+      bounds.width = std::max(bounds.width, placed->source.max_x());
+      bounds.height = std::max(bounds.height, placed->source.max_y());
+
+      atlas.m_regions.try_emplace(image.name, *placed);
+    }
+
+    std::vector<surface> sheets;
+    sheets.reserve(pages.size());
+    for (const auto bounds : used) {
+      sheets.emplace_back(iarea{std::max(bounds.width, 1), std::max(bounds.height, 1)},
+                          pixel_format::argb8888);
+    }
+
+    for (const auto& image : m_images) {
+      const auto& [page, source] = atlas.m_regions.at(image.name);
+      copy_image(image.pixels, sheets.at(page), source);
+    }
+
+    atlas.m_pages.reserve(sheets.size());
+    for (const auto& sheet : sheets) {
+      auto& page = atlas.m_pages.emplace_back(renderer, sheet);
+      page.set_blend_mode(blend_mode::blend);
+    }
+
+    return atlas;
+  }
+
+  /**
+   * \brief Removes all added images.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_images.clear();
+  }
+
+  /**
+   * \brief Returns the amount of added images.
+   *
+   * \return the number of images that will be packed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_images.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are no added images.
+   *
+   * \return `true` if no images have been added; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_images.empty();
+  }
+
+  /**
+   * \brief Returns the maximum size of the atlas pages.
+   *
+   * \return the maximum page size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto page_size() const noexcept -> iarea
+  {
+    return m_pageSize;
+  }
+
+  /**
+   * \brief Returns the default maximum size of atlas pages.
+   *
+   * \return the default page size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_page_size() noexcept -> iarea
+  {
+    return {2048, 2048};
+  }
+
+ private:
+  using region_type = texture_atlas::region;
+
+  struct pending_image final
+  {
+    std::string name;
+    surface pixels;  ///< The image, converted to the atlas pixel format.
+  };
+
+  /// Keeps track of the top edge of the packed images in a page.
+  class skyline final
+  {
+   public:
+    explicit skyline(const iarea size) : m_size{size}
+    {
+      m_nodes.push_back(node{0, 0, size.width});
+    }
+
+    /// Returns the top-left corner of the inserted area, if the area fits.
+    [[nodiscard]] auto insert(const iarea size, const int padding) -> std::optional<ipoint>
+    {
+      // The padding isn't needed at the right and bottom edges of the page
+      const auto width = std::min(size.width + padding, m_size.width);
+      const auto height = std::min(size.height + padding, m_size.height);
+
+      auto bestIndex = m_nodes.size();
+      auto bestBottom = std::numeric_limits<int>::max();
+      auto bestWidth = std::numeric_limits<int>::max();
+      auto bestY = 0;
+
+      for (usize index = 0; index < m_nodes.size(); ++index) {
+        if (const auto y = fit(index, width, height)) {
+          const auto bottom = *y + height;
+          if (bottom < bestBottom ||
+              (bottom == bestBottom && m_nodes[index].width < bestWidth))
+          {
+            bestIndex = index;
+            bestBottom = bottom;
+            bestWidth = m_nodes[index].width;
+            bestY = *y;
+          }
+        }
+      }
+
+      if (bestIndex == m_nodes.size()) {
+        return std::nullopt;
+      }
+
+      const auto x = m_nodes[bestIndex].x;
+      add(bestIndex, node{x, bestY + height, width});
+
+      return ipoint{x, bestY};
+    }
+
+   private:
+    struct node final
+    {
+      int x{};
+      int y{};  ///< The height of the skyline in this segment.
+      int width{};
+    };
+
+    iarea m_size;
+    std::vector<node> m_nodes;  ///< Ordered by x-coordinate, covering the entire width.
+
+    [[nodiscard]] auto fit(const usize index, const int width, const int height) const
+        -> std::optional<int>
+    {
+      const auto x = m_nodes[index].x;
+      if (x + width > m_size.width) {
+        return std::nullopt;
+      }
+
+      auto y = 0;
+      auto remaining = width;
+
+      for (auto i = index; remaining > 0; ++i) {
+        assert(i < m_nodes.size());
+
+        y = std::max(y, m_nodes[i].y);
+        if (y + height > m_size.height) {
+          return std::nullopt;
+        }
+
+        remaining -= m_nodes[i].width;
+      }
+
+      return y;
+    }
+
+    void add(const usize index, const node& inserted)
+    {
+      m_nodes.insert(m_nodes.begin() + static_cast<std::ptrdiff_t>(index), inserted);
+
+      // Shrink or remove the segments that are covered by the inserted segment
+      const auto right = inserted.x + inserted.width;
+      for (auto i = index + 1; i < m_nodes.size();) {
+        auto& current = m_nodes[i];
+        if (current.x >= right) {
+          break;
+        }
+
+        const auto overlap = right - current.x;
+        if (overlap >= current.width) {
+          m_nodes.erase(m_nodes.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        else {
+          current.x += overlap;
+          current.width -= overlap;
+          break;
+        }
+      }
+
+      // Merge adjacent segments of the same height
+      for (usize i = 0; i + 1 < m_nodes.size();) {
+        if (m_nodes[i].y == m_nodes[i + 1].y) {
+          m_nodes[i].width += m_nodes[i + 1].width;
+          m_nodes.erase(m_nodes.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else {
+          ++i;
+        }
+      }
+    }
+  };
+
+  std::vector<pending_image> m_images;
+  iarea m_pageSize;
+  int m_padding{};
+
+  static void copy_image(const surface& image, surface& sheet, const irect& area)
+  {
+    if (!sheet.lock()) {
+      throw sdl_error{};
+    }
+
+    const auto* src = static_cast<const u8*>(image.pixels());
+    auto* dst = static_cast<u8*>(sheet.pixels());
+
+    const auto rowSize = static_cast<usize>(area.width()) * 4u;
+    for (auto y = 0; y < area.height(); ++y) {
+      const auto* srcRow = src + y * image.pitch();
+      auto* dstRow = dst + (area.y() + y) * sheet.pitch() + area.x() * 4;
+      std::copy_n(srcRow, rowSize, dstRow);
+    }
+
+    sheet.unlock();
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_ATLAS_HEADER
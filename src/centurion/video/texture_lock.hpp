@@ -0,0 +1,346 @@
+#ifndef CENTURION_TEXTURE_LOCK_HEADER
+#define CENTURION_TEXTURE_LOCK_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>    // fill_n, copy_n, max, min
+#include <cassert>      // assert
+#include <optional>     // optional
+#include <type_traits>  // is_invocable_r_v, is_same_v
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "pixel_format.hpp"
+#include "pixel_format_info.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class texture_lock
+ *
+ * \brief Provides write access to the pixels of a streaming texture.
+ *
+ * \details A texture lock locks an area of a streaming texture for the lifetime of the
+ * lock, which makes it possible to update an entire region of the texture with a single
+ * lock. The pixel format information that is used to convert colors to pixel values is
+ * created once, when the texture is locked.
+ *
+ * \details All coordinates are relative to the locked area, and rows are addressed using
+ * the pitch reported by SDL.
+ *
+ * \note The locked pixels are write-only, i.e. their initial content is undefined, so
+ * every pixel in the locked area should be written. Lock a smaller area to only update
+ * part of a texture.
+ *
+ * \note Only streaming textures with 32-bit pixel formats are supported.
+ *
+ * \note The texture must outlive the lock.
+ *
+ * \see `pixel_view`
+ * \see `basic_texture::set_pixel()`
+ *
+ * \since 6.4.0
+ */
+class texture_lock final
+{
+ public:
+  /**
+   * \brief Locks an area of a streaming texture.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param texture the texture that will be locked.
+   * \param area the area of the texture that will be locked; `std::nullopt` indicates
+   * the entire texture.
+   *
+   * \throws cen_error if the texture isn't a streaming texture with a 32-bit pixel
+   * format, or if the area isn't within the bounds of the texture.
+   * \throws sdl_error if the texture cannot be locked.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  explicit texture_lock(basic_texture<T>& texture,
+                        const std::optional<irect> area = std::nullopt)
+      : m_texture{texture.get()}
+      , m_info{texture.format()}
+      , m_area{area.value_or(irect{{}, texture.size()})}
+  {
+    if (texture.access() != texture_access::streaming) {
+      throw cen_error{"Only streaming textures can be locked!"};
+    }
+
+    if (SDL_BYTESPERPIXEL(to_underlying(texture.format())) != sizeof(u32)) {
+      throw cen_error{"Texture locks require a 32-bit pixel format!"};
+    }
+
+    const auto size = texture.size();
+    if (m_area.x() < 0 || m_area.y() < 0 || m_area.max_x() > size.width ||
+        m_area.max_y() > size.height)
+    {
+      throw cen_error{"Cannot lock area outside of texture!"};
+    }
+
+    void* pixels{};
+    if (SDL_LockTexture(m_texture, m_area.data(), &pixels, &m_pitch) != 0) {
+      throw sdl_error{};
+    }
+
+    m_pixels = static_cast<u8*>(pixels);
+  }
+
+  texture_lock(const texture_lock&) = delete;
+
+  auto operator=(const texture_lock&) -> texture_lock& = delete;
+
+  /**
+   * \brief Unlocks the texture, which uploads the modified pixels.
+   *
+   * \since 6.4.0
+   */
+  ~texture_lock() noexcept
+  {
+    SDL_UnlockTexture(m_texture);
+  }
+
+  /// \name Pixel access
+  /// \{
+
+  /**
+   * \brief Returns a pointer to the first pixel in a row of the locked area.
+   *
+   * \pre `y` must be in the range [0, `height()`).
+   *
+   * \param y the index of the row, relative to the locked area.
+   *
+   * \return a pointer to the `width()` pixel values in the row.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto row(const int y) noexcept -> u32*
+  {
+    assert(y >= 0 && y < height());
+    return reinterpret_cast<u32*>(m_pixels + y * m_pitch);
+  }
+
+  /**
+   * \brief Sets the color of a pixel.
+   *
+   * \pre `pixel` must be within the locked area.
+   *
+   * \param pixel the position of the pixel, relative to the locked area.
+   * \param color the new color of the pixel.
+   *
+   * \since 6.4.0
+   */
+  void set_pixel(const ipoint pixel, const color& color) noexcept
+  {
+    assert(in_bounds(pixel));
+    row(pixel.y())[pixel.x()] = map(color);
+  }
+
+  /// \} End of pixel access
+
+  /// \name Bulk operations
+  /// \{
+
+  /**
+   * \brief Sets the color of all pixels in the locked area.
+   *
+   * \param color the new color of the pixels.
+   *
+   * \since 6.4.0
+   */
+  void fill(const color& color) noexcept
+  {
+    const auto value = map(color);
+    for (auto y = 0; y < height(); ++y) {
+      std::fill_n(row(y), width(), value);
+    }
+  }
+
+  /**
+   * \brief Copies raw pixel values into a row.
+   *
+   * \details Pixels that would be outside of the locked area are ignored.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type, must store `u32` values contiguously, such as
+   * `std::vector<u32>` or `std::array<u32, N>`.
+   *
+   * \pre `y` must be in the range [0, `height()`).
+   *
+   * \param y the index of the row, relative to the locked area.
+   * \param pixels the pixel values, encoded according to the pixel format of the texture.
+   * \param x the x-coordinate of the first pixel that will be written.
+   *
+   * \since 6.4.0
+   */
+  template <typename Container>
+  void blit_row(const int y, const Container& pixels, const int x = 0) noexcept
+  {
+    static_assert(std::is_same_v<typename Container::value_type, u32>,
+                  "Pixel values must be provided as u32 values!");
+    assert(y >= 0 && y < height());
+
+    // Skip the pixels that are to the left of the locked area
+    const auto skip = std::max(0, -x);
+    const auto count = std::min(isize(pixels) - skip, width() - (x + skip));
+
+    if (count > 0) {
+      std::copy_n(pixels.data() + skip, count, row(y) + x + skip);
+    }
+  }
+
+  /**
+   * \brief Invokes a function object for each pixel in the locked area, row by row.
+   *
+   * \details The function object can either return the new color of the pixel, i.e. have
+   * the signature `color(ipoint)`, or write the raw pixel value directly, i.e. have the
+   * signature `void(ipoint, u32&)`. The supplied points are relative to the locked area.
+   *
+   * \tparam Fn the type of the function object.
+   *
+   * \param fn the function object that will be invoked for each pixel.
+   *
+   * \since 6.4.0
+   */
+  template <typename Fn>
+  void for_each_pixel(Fn&& fn)
+  {
+    const auto w = width();
+    const auto h = height();
+
+    for (auto y = 0; y < h; ++y) {
+      auto* pixels = row(y);
+      for (auto x = 0; x < w; ++x) {
+        if constexpr (std::is_invocable_r_v<color, Fn, ipoint>) {
+          pixels[x] = map(fn(ipoint{x, y}));
+        }
+        else {
+          fn(ipoint{x, y}, pixels[x]);
+        }
+      }
+    }
+  }
+
+  /// \} End of bulk operations
+
+  /**
+   * \brief Converts a color to a pixel value.
+   *
+   * \param color the color that will be converted.
+   *
+   * \return the pixel value, encoded according to the pixel format of the texture.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto map(const color& color) const noexcept -> u32
+  {
+    return m_info.rgba_to_pixel(color);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not a point is within the locked area.
+   *
+   * \param pixel the point that will be checked, relative to the locked area.
+   *
+   * \return `true` if the point is within the locked area; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto in_bounds(const ipoint pixel) const noexcept -> bool
+  {
+    return pixel.x() >= 0 && pixel.y() >= 0 && pixel.x() < width() && pixel.y() < height();
+  }
+
+  /**
+   * \brief Returns the locked area of the texture.
+   *
+   * \return the locked area, in texture coordinates.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto area() const noexcept -> const irect&
+  {
+    return m_area;
+  }
+
+  /**
+   * \brief Returns the width of the locked area.
+   *
+   * \return the width of the locked area, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto width() const noexcept -> int
+  {
+    return m_area.width();
+  }
+
+  /**
+   * \brief Returns the height of the locked area.
+   *
+   * \return the height of the locked area, in pixels.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto height() const noexcept -> int
+  {
+    return m_area.height();
+  }
+
+  /**
+   * \brief Returns the pitch of the locked pixel data.
+   *
+   * \return the length of a row of pixels, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto pitch() const noexcept -> int
+  {
+    return m_pitch;
+  }
+
+  /**
+   * \brief Returns the pixel format information of the texture.
+   *
+   * \return the pixel format information.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto format_info() const noexcept -> const pixel_format_info&
+  {
+    return m_info;
+  }
+
+  /// \} End of queries
+
+ private:
+  SDL_Texture* m_texture{};
+  pixel_format_info m_info;
+  irect m_area;
+  u8* m_pixels{};
+  int m_pitch{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_LOCK_HEADER
@@ -0,0 +1,250 @@
+#ifndef CENTURION_TEXTURE_MEMORY_HEADER
+#define CENTURION_TEXTURE_MEMORY_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <atomic>  // atomic, memory_order
+
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../math/area.hpp"
+#include "pixel_format.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+struct texture_memory_data final
+{
+  std::atomic<usize> residentBytes{};
+  std::atomic<usize> textureCount{};
+  std::atomic<usize> budget{};
+};
+
+[[nodiscard]] inline auto get_texture_memory_data() noexcept -> texture_memory_data&
+{
+  static texture_memory_data data;
+  return data;
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class texture_memory
+ *
+ * \brief Keeps track of the estimated memory used by all owning textures.
+ *
+ * \details Every owning texture is accounted for when it's created, and when it's
+ * destroyed, based on its size and pixel format. The estimate doesn't include padding or
+ * mipmaps introduced by the render driver, but is sufficient to keep the memory usage of
+ * an application within a budget on devices with little video memory.
+ *
+ * \details The budget isn't enforced when textures are created, instead it's used by
+ * `texture_streamer` to decide which textures to evict. It can also be queried prior to
+ * creating textures, e.g. to fall back to lower resolution assets.
+ * \code{cpp}
+ *   cen::texture_memory::set_budget(256u * 1'024u * 1'024u);
+ *
+ *   if (cen::texture_memory::over_budget()) {
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \see `texture_streamer`
+ * \see `texture_pool`
+ *
+ * \since 6.4.0
+ */
+class texture_memory final
+{
+ public:
+  texture_memory() = delete;
+
+  /**
+   * \brief Returns the estimated amount of memory used by all owning textures.
+   *
+   * \return the memory used by textures, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto resident_bytes() noexcept -> usize
+  {
+    return detail::get_texture_memory_data().residentBytes.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the amount of owning textures.
+   *
+   * \return the number of existing owning textures.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto texture_count() noexcept -> usize
+  {
+    return detail::get_texture_memory_data().textureCount.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Sets the maximum amount of memory that textures should use.
+   *
+   * \param bytes the memory budget, in bytes, zero means no limit.
+   *
+   * \since 6.4.0
+   */
+  static void set_budget(const usize bytes) noexcept
+  {
+    detail::get_texture_memory_data().budget.store(bytes, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the maximum amount of memory that textures should use.
+   *
+   * \return the memory budget, in bytes, zero if there is no limit.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto budget() noexcept -> usize
+  {
+    return detail::get_texture_memory_data().budget.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Indicates whether or not the textures use more memory than the budget.
+   *
+   * \return `true` if there is a budget and it's exceeded; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto over_budget() noexcept -> bool
+  {
+    const auto limit = budget();
+    return limit != 0 && resident_bytes() > limit;
+  }
+
+  /**
+   * \brief Indicates whether or not additional textures fit within the budget.
+   *
+   * \param bytes the size of the additional textures, in bytes.
+   *
+   * \return `true` if there is no budget or if the textures fit; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto fits(const usize bytes) noexcept -> bool
+  {
+    const auto limit = budget();
+    const auto used = resident_bytes();
+    return limit == 0 || (used <= limit && bytes <= limit - used);
+  }
+
+  /**
+   * \brief Returns the estimated memory used by a texture with the specified format and
+   * size.
+   *
+   * \details Planar YUV formats use 12 bits per pixel, and packed YUV formats use 16 bits
+   * per pixel.
+   *
+   * \param format the pixel format of the texture.
+   * \param size the size of the texture.
+   *
+   * \return the size of the texture, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto bytes_of(const pixel_format format, const iarea size) noexcept
+      -> usize
+  {
+    if (size.width <= 0 || size.height <= 0) {
+      return 0;
+    }
+
+    const auto pixels = static_cast<usize>(size.width) * static_cast<usize>(size.height);
+
+    switch (format) {
+      case pixel_format::yv12:
+      case pixel_format::iyuv:
+      case pixel_format::nv12:
+      case pixel_format::nv21:
+        return pixels + pixels / 2;
+
+      case pixel_format::yuy2:
+      case pixel_format::uyvy:
+      case pixel_format::yvyu:
+        return pixels * 2;
+
+      default:
+        return pixels * static_cast<usize>(SDL_BYTESPERPIXEL(to_underlying(format)));
+    }
+  }
+
+  /**
+   * \brief Returns the estimated memory used by a texture.
+   *
+   * \param texture the texture that will be queried, can safely be null.
+   *
+   * \return the size of the texture, in bytes; zero if the texture is null.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto bytes_of(SDL_Texture* texture) noexcept -> usize
+  {
+    Uint32 format{};
+    int width{};
+    int height{};
+
+    if (!texture || SDL_QueryTexture(texture, &format, nullptr, &width, &height) != 0) {
+      return 0;
+    }
+
+    return bytes_of(static_cast<pixel_format>(format), {width, height});
+  }
+
+  /**
+   * \brief Accounts for a new owning texture.
+   *
+   * \details This is called by the constructors of owning textures, and only needs to be
+   * called for textures that aren't managed by `basic_texture`.
+   *
+   * \param texture the created texture, can safely be null.
+   *
+   * \since 6.4.0
+   */
+  static void track(SDL_Texture* texture) noexcept
+  {
+    if (texture) {
+      auto& data = detail::get_texture_memory_data();
+      data.residentBytes.fetch_add(bytes_of(texture), std::memory_order_relaxed);
+      data.textureCount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * \brief Stops accounting for an owning texture.
+   *
+   * \details This is called when owning textures are destroyed or released, and must be
+   * called before the texture is destroyed.
+   *
+   * \param texture the texture that will be destroyed, can safely be null.
+   *
+   * \since 6.4.0
+   */
+  static void untrack(SDL_Texture* texture) noexcept
+  {
+    if (texture) {
+      auto& data = detail::get_texture_memory_data();
+      data.residentBytes.fetch_sub(bytes_of(texture), std::memory_order_relaxed);
+      data.textureCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_MEMORY_HEADER
@@ -0,0 +1,537 @@
+#ifndef CENTURION_TEXTURE_POOL_HEADER
+#define CENTURION_TEXTURE_POOL_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>        // assert
+#include <optional>       // optional
+#include <unordered_map>  // unordered_map
+#include <utility>        // move, exchange
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../math/area.hpp"
+#include "pixel_format.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "texture_memory.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class texture_pool
+ *
+ * \brief Recycles textures in order to avoid repeatedly creating and destroying them.
+ *
+ * \details Creating textures can be expensive with some render drivers. A texture pool
+ * keeps textures that are no longer in use around, and hands them out again when a
+ * texture with the same pixel format, access and size is requested.
+ *
+ * \details Textures are obtained with `acquire()`, which returns a `lease` that returns
+ * the texture to the pool when it's destroyed. The total size of the idle textures in the
+ * pool is limited by a memory budget, and the least recently returned textures are
+ * destroyed when the budget is exceeded.
+ *
+ * \note Recycled textures keep their previous content and settings, such as the blend
+ * mode and the color and alpha modulation.
+ *
+ * \note A texture pool should only be used with a single renderer, and it must outlive
+ * all of its leases.
+ *
+ * \since 6.4.0
+ */
+class texture_pool final
+{
+  struct pool_key;
+
+ public:
+  /**
+   * \struct pool_stats
+   *
+   * \brief Provides statistics about the textures requested from a texture pool.
+   *
+   * \since 6.4.0
+   */
+  struct pool_stats final
+  {
+    usize hits{};       ///< The amount of requests that were served with an idle texture.
+    usize misses{};     ///< The amount of requests that required a new texture.
+    usize evictions{};  ///< The amount of idle textures that have been destroyed.
+
+    /**
+     * \brief Returns the ratio of requests that were served with an idle texture.
+     *
+     * \return the hit rate, in the range [0, 1]; zero if there have been no requests.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto hit_rate() const noexcept -> double
+    {
+      const auto total = hits + misses;
+      return (total != 0) ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+    }
+  };
+
+  /**
+   * \class lease
+   *
+   * \brief Provides access to a texture that is borrowed from a texture pool.
+   *
+   * \details The texture is returned to the pool when the lease is destroyed, unless it
+   * has been released from the pool with `release()`.
+   *
+   * \since 6.4.0
+   */
+  class lease final
+  {
+   public:
+    lease(const lease&) = delete;
+
+    lease(lease&& other) noexcept
+        : m_pool{std::exchange(other.m_pool, nullptr)}
+        , m_texture{std::move(other.m_texture)}
+    {
+      other.m_texture.reset();
+    }
+
+    auto operator=(const lease&) -> lease& = delete;
+
+    auto operator=(lease&& other) noexcept -> lease&
+    {
+      if (this != &other) {
+        reset();
+        m_pool = std::exchange(other.m_pool, nullptr);
+        m_texture = std::move(other.m_texture);
+        other.m_texture.reset();
+      }
+
+      return *this;
+    }
+
+    /**
+     * \brief Returns the texture to the pool.
+     *
+     * \since 6.4.0
+     */
+    ~lease() noexcept
+    {
+      reset();
+    }
+
+    /**
+     * \brief Returns the texture to the pool, which invalidates the lease.
+     *
+     * \details This function has no effect if the lease doesn't hold a texture.
+     *
+     * \since 6.4.0
+     */
+    void reset() noexcept
+    {
+      if (m_pool && m_texture) {
+        m_pool->recycle(std::move(*m_texture));
+      }
+
+      m_texture.reset();
+    }
+
+    /**
+     * \brief Takes ownership of the texture, which will not be returned to the pool.
+     *
+     * \pre The lease must hold a texture.
+     *
+     * \return the borrowed texture.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto release() noexcept -> texture
+    {
+      assert(m_texture);
+
+      auto released = std::move(*m_texture);
+      m_texture.reset();
+
+      return released;
+    }
+
+    /**
+     * \brief Returns the borrowed texture.
+     *
+     * \pre The lease must hold a texture.
+     *
+     * \return the borrowed texture.
+     *
+     * \since 6.4.0
+     */
+    [[nodiscard]] auto get() noexcept -> texture&
+    {
+      assert(m_texture);
+      return *m_texture;
+    }
+
+    /// \copydoc get()
+    [[nodiscard]] auto get() const noexcept -> const texture&
+    {
+      assert(m_texture);
+      return *m_texture;
+    }
+
+    /// \copydoc get()
+    [[nodiscard]] auto operator*() noexcept -> texture&
+    {
+      return get();
+    }
+
+    /// \copydoc get()
+    [[nodiscard]] auto operator*() const noexcept -> const texture&
+    {
+      return get();
+    }
+
+    /// \copydoc get()
+    [[nodiscard]] auto operator->() noexcept -> texture*
+    {
+      return &get();
+    }
+
+    /// \copydoc get()
+    [[nodiscard]] auto operator->() const noexcept -> const texture*
+    {
+      return &get();
+    }
+
+    /**
+     * \brief Indicates whether or not the lease holds a texture.
+     *
+     * \return `true` if the lease holds a texture; `false` otherwise.
+     *
+     * \since 6.4.0
+     */
+    explicit operator bool() const noexcept
+    {
+      return m_texture.has_value();
+    }
+
+   private:
+    friend class texture_pool;
+
+    texture_pool* m_pool{};
+    std::optional<texture> m_texture;
+
+    lease(texture_pool& pool, texture&& texture) noexcept
+        : m_pool{&pool}
+        , m_texture{std::move(texture)}
+    {}
+  };
+
+  /**
+   * \brief Creates an empty texture pool.
+   *
+   * \param budget the maximum size of all idle textures in the pool, in bytes, zero means
+   * no limit.
+   *
+   * \since 6.4.0
+   */
+  explicit texture_pool(const usize budget = default_budget()) noexcept : m_budget{budget}
+  {}
+
+  texture_pool(const texture_pool&) = delete;
+
+  auto operator=(const texture_pool&) -> texture_pool& = delete;
+
+  /**
+   * \brief Obtains a texture with the specified characteristics.
+   *
+   * \details An idle texture is reused if there is one that matches the requested pixel
+   * format, access and size, otherwise a new texture is created.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture, if necessary.
+   * \param format the pixel format of the texture.
+   * \param access the access of the texture.
+   * \param size the size of the texture.
+   *
+   * \return a lease that returns the texture to the pool when destroyed.
+   *
+   * \throws sdl_error if a new texture is needed but cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto acquire(const Renderer& renderer,
+                             const pixel_format format,
+                             const texture_access access,
+                             const iarea size) -> lease
+  {
+    const pool_key key{format, access, size};
+
+    if (const auto it = m_idle.find(key); it != m_idle.end()) {
+      auto& bucket = it->second;
+      assert(!bucket.empty());
+
+      auto reused = std::move(bucket.back().cached);
+      bucket.pop_back();
+
+      if (bucket.empty()) {
+        m_idle.erase(it);
+      }
+
+      m_residentBytes -= bytes_of(key);
+      --m_idleCount;
+      ++m_stats.hits;
+
+      return lease{*this, std::move(reused)};
+    }
+    else {
+      ++m_stats.misses;
+      return lease{*this, texture{renderer, format, access, size}};
+    }
+  }
+
+  /**
+   * \brief Adds a texture to the pool of idle textures.
+   *
+   * \details This is done automatically by leases, but this function can also be used
+   * to add textures that weren't obtained from the pool. The least recently added idle
+   * textures are destroyed if the memory budget is exceeded.
+   *
+   * \note The texture is simply destroyed if it cannot be added to the pool.
+   *
+   * \param texture the texture that will be added to the pool.
+   *
+   * \since 6.4.0
+   */
+  void recycle(texture&& texture) noexcept
+  {
+    const pool_key key{texture.format(), texture.access(), texture.size()};
+
+    try {
+      m_idle[key].push_back(idle_texture{std::move(texture), m_clock++});
+    }
+    catch (...) {
+      return;
+    }
+
+    m_residentBytes += bytes_of(key);
+    ++m_idleCount;
+
+    if (m_budget != 0) {
+      trim(m_budget);
+    }
+  }
+
+  /**
+   * \brief Destroys idle textures until their total size is within a limit.
+   *
+   * \details The least recently added idle textures are destroyed first.
+   *
+   * \param bytes the maximum size of all idle textures, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void trim(const usize bytes) noexcept
+  {
+    while (m_residentBytes > bytes) {
+      evict_oldest();
+    }
+  }
+
+  /**
+   * \brief Destroys idle textures until a certain amount of memory has been freed.
+   *
+   * \details The least recently added idle textures are destroyed first. This is used
+   * when the pool is registered with a `memory_budget`.
+   *
+   * \param bytes the amount of memory that should be freed, in bytes.
+   *
+   * \return the amount of freed memory, which is less than requested if there aren't
+   * enough idle textures.
+   *
+   * \since 6.4.0
+   */
+  auto free_memory(const usize bytes) noexcept -> usize
+  {
+    const auto before = m_residentBytes;
+    trim((before > bytes) ? before - bytes : 0u);
+    return before - m_residentBytes;
+  }
+
+  /**
+   * \brief Destroys all idle textures.
+   *
+   * \details Leased textures are not affected, and will still be returned to the pool.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_stats.evictions += m_idleCount;
+    m_idle.clear();
+    m_residentBytes = 0;
+    m_idleCount = 0;
+  }
+
+  /**
+   * \brief Sets the maximum size of all idle textures in the pool.
+   *
+   * \details Idle textures are destroyed immediately if the new budget is exceeded.
+   *
+   * \param bytes the memory budget, in bytes, zero means no limit.
+   *
+   * \since 6.4.0
+   */
+  void set_budget(const usize bytes) noexcept
+  {
+    m_budget = bytes;
+
+    if (m_budget != 0) {
+      trim(m_budget);
+    }
+  }
+
+  /**
+   * \brief Returns the maximum size of all idle textures in the pool.
+   *
+   * \return the memory budget, in bytes, zero if there is no limit.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto budget() const noexcept -> usize
+  {
+    return m_budget;
+  }
+
+  /**
+   * \brief Returns the estimated size of all idle textures in the pool.
+   *
+   * \return the size of the idle textures, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto resident_bytes() const noexcept -> usize
+  {
+    return m_residentBytes;
+  }
+
+  /**
+   * \brief Returns the amount of idle textures in the pool.
+   *
+   * \return the number of idle textures.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto idle_count() const noexcept -> usize
+  {
+    return m_idleCount;
+  }
+
+  /**
+   * \brief Returns statistics about the textures requested from the pool.
+   *
+   * \return the current pool statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto statistics() const noexcept -> const pool_stats&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Resets the pool statistics counters to zero.
+   *
+   * \since 6.4.0
+   */
+  void reset_statistics() noexcept
+  {
+    m_stats = pool_stats{};
+  }
+
+  /**
+   * \brief Returns the default memory budget of texture pools.
+   *
+   * \return the default budget, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr static auto default_budget() noexcept -> usize
+  {
+    return 64u * 1'024u * 1'024u;
+  }
+
+ private:
+  struct pool_key final
+  {
+    pixel_format format{};
+    texture_access access{};
+    iarea size{};
+
+    [[nodiscard]] auto operator==(const pool_key& other) const noexcept -> bool
+    {
+      return format == other.format && access == other.access && size == other.size;
+    }
+  };
+
+  struct key_hasher final
+  {
+    [[nodiscard]] auto operator()(const pool_key& key) const noexcept -> usize
+    {
+      auto hash = static_cast<usize>(to_underlying(key.format));
+      hash = hash * 31u + static_cast<usize>(to_underlying(key.access));
+      hash = hash * 31u + static_cast<usize>(key.size.width);
+      hash = hash * 31u + static_cast<usize>(key.size.height);
+      return hash;
+    }
+  };
+
+  struct idle_texture final
+  {
+    texture cached;
+    u64 stamp{};  ///< Used to find the least recently added texture.
+  };
+
+  // Idle textures in each bucket are ordered from least to most recently added
+  std::unordered_map<pool_key, std::vector<idle_texture>, key_hasher> m_idle;
+  pool_stats m_stats;
+  usize m_budget{};
+  usize m_residentBytes{};
+  usize m_idleCount{};
+  u64 m_clock{};
+
+  [[nodiscard]] static auto bytes_of(const pool_key& key) noexcept -> usize
+  {
+    return texture_memory::bytes_of(key.format, key.size);
+  }
+
+  void evict_oldest() noexcept
+  {
+    auto oldest = m_idle.end();
+    for (auto it = m_idle.begin(); it != m_idle.end(); ++it) {
+      if (oldest == m_idle.end() || it->second.front().stamp < oldest->second.front().stamp) {
+        oldest = it;
+      }
+    }
+
+    assert(oldest != m_idle.end());
+
+    auto& bucket = oldest->second;
+    m_residentBytes -= bytes_of(oldest->first);
+    --m_idleCount;
+    ++m_stats.evictions;
+
+    bucket.erase(bucket.begin());
+    if (bucket.empty()) {
+      m_idle.erase(oldest);
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_POOL_HEADER
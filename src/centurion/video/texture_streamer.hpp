@@ -0,0 +1,648 @@
+#ifndef CENTURION_TEXTURE_STREAMER_HEADER
+#define CENTURION_TEXTURE_STREAMER_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <algorithm>   // max, clamp
+#include <cassert>     // assert
+#include <functional>  // function
+#include <optional>    // optional
+#include <string>      // string
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/power_profile.hpp"
+#include "../system/profiler_macros.hpp"
+#include "pixel_format.hpp"
+#include "scale_mode.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_memory.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct texture_streamer_stats
+ *
+ * \brief Provides statistics about the textures managed by a texture streamer.
+ *
+ * \since 6.4.0
+ */
+struct texture_streamer_stats final
+{
+  usize loads{};       ///< The amount of textures loaded because they weren't resident.
+  usize promotions{};  ///< The amount of textures replaced with a higher resolution.
+  usize demotions{};   ///< The amount of textures replaced with a lower resolution.
+  usize evictions{};   ///< The amount of textures unloaded to stay within the budget.
+};
+
+/**
+ * \class texture_streamer
+ *
+ * \brief Loads textures on demand, at a resolution that depends on how recently they have
+ * been used and on the texture memory budget.
+ *
+ * \details Each texture is registered with a loader, that creates a surface with the
+ * full resolution image, and is identified by the returned ID. Textures are loaded when
+ * they are first acquired, where large textures are initially loaded at a quarter of
+ * their resolution. Textures that are in use are then promoted to the next level of
+ * detail in every `update()`, i.e. from quarter to half and from half to full
+ * resolution, as long as they fit in the budget of `texture_memory`.
+ *
+ * \details Large textures that haven't been acquired for a while are demoted to a lower
+ * resolution, and the least recently acquired textures are evicted whenever the texture
+ * memory budget is exceeded, except for textures acquired in the current frame.
+ * \code{cpp}
+ *   cen::texture_memory::set_budget(128u * 1'024u * 1'024u);
+ *
+ *   cen::texture_streamer streamer;
+ *   const auto background = streamer.add("background.png");
+ *
+ *   while (running) {
+ *     streamer.render(renderer, background, destination);
+ *     renderer.present();
+ *
+ *     streamer.update(renderer);
+ *   }
+ * \endcode
+ *
+ * \details Lower resolution textures cover the same destination when rendered, but
+ * source rectangles must be scaled with `scale()`, which `render()` does automatically.
+ *
+ * \details The finest level of detail can be limited with `set_finest_level()`, e.g. by
+ * subscribing `handle()` to the change notifications of a `power_profile`.
+ *
+ * \note Promotions and demotions call the loader of the texture again, and are limited
+ * to a configurable amount per update to avoid frame time spikes.
+ *
+ * \note A texture streamer should only be used with a single renderer, and references
+ * to acquired textures are invalidated by `update()`.
+ *
+ * \see `texture_memory`
+ * \see `texture_pool`
+ *
+ * \since 6.4.0
+ */
+class texture_streamer final
+{
+ public:
+  using id_type = usize;
+  using loader_type = std::function<surface()>;
+
+  /// The level of detail of full resolution textures.
+  inline constexpr static int full_level = 0;
+
+  /// The level of detail of quarter resolution textures, the lowest used level.
+  inline constexpr static int lowest_level = 2;
+
+  texture_streamer() = default;
+
+  texture_streamer(const texture_streamer&) = delete;
+
+  auto operator=(const texture_streamer&) -> texture_streamer& = delete;
+
+  /**
+   * \brief Registers a texture, without loading it.
+   *
+   * \param loader a function that returns the full resolution image of the texture, which
+   * may be called several times and is allowed to throw.
+   *
+   * \return the ID of the texture.
+   *
+   * \since 6.4.0
+   */
+  auto add(loader_type loader) -> id_type
+  {
+    assert(loader);
+    m_entries.push_back(entry{std::move(loader)});
+    return m_entries.size() - 1;
+  }
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+  /**
+   * \brief Registers a texture that is loaded from an image file, without loading it.
+   *
+   * \param path the file path of the image.
+   *
+   * \return the ID of the texture.
+   *
+   * \since 6.4.0
+   */
+  auto add(std::string path) -> id_type
+  {
+    return add([file = std::move(path)] { return surface{file}; });
+  }
+
+#endif  // CENTURION_NO_SDL_IMAGE
+
+  /**
+   * \brief Returns a texture, loading it if it isn't resident.
+   *
+   * \details The texture is marked as used in the current frame, which prevents it from
+   * being evicted until the next `update()`.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture, if necessary.
+   * \param id the ID of the texture.
+   *
+   * \return the resident texture, which may have a lower resolution than the image.
+   *
+   * \throws sdl_error if the texture cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto acquire(const Renderer& renderer, const id_type id) -> texture&
+  {
+    assert(id < m_entries.size());
+    auto& entry = m_entries[id];
+
+    entry.lastUsed = m_frame;
+
+    if (!entry.resident) {
+      load(renderer, entry, std::nullopt);
+      ++m_stats.loads;
+    }
+
+    return *entry.resident;
+  }
+
+  /**
+   * \brief Renders part of a texture, loading it if it isn't resident.
+   *
+   * \details The source rectangle is scaled to the resolution of the resident texture.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   * \param id the ID of the texture.
+   * \param source the area of the full resolution image that will be rendered.
+   * \param destination the area of the rendering target that the texture will cover.
+   *
+   * \return `success` if the texture was rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto render(Renderer& renderer,
+              const id_type id,
+              const irect& source,
+              const frect& destination) -> result
+  {
+    auto& resident = acquire(renderer, id);
+    const auto level = m_entries[id].level;
+
+    const irect scaled{{source.x() >> level, source.y() >> level},
+                       {std::max(source.width() >> level, 1),
+                        std::max(source.height() >> level, 1)}};
+
+    return renderer.render(resident, scaled, destination);
+  }
+
+  /**
+   * \brief Renders an entire texture, loading it if it isn't resident.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   * \param id the ID of the texture.
+   * \param destination the area of the rendering target that the texture will cover.
+   *
+   * \return `success` if the texture was rendered; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto render(Renderer& renderer, const id_type id, const frect& destination) -> result
+  {
+    return renderer.render(acquire(renderer, id), destination);
+  }
+
+  /**
+   * \brief Promotes, demotes and evicts textures, and starts a new frame.
+   *
+   * \details This should be called once per frame, after rendering. First, textures that
+   * are finer than the finest level of detail, and large textures that haven't been
+   * acquired for the idle amount of frames, are demoted, then the least
+   * recently acquired textures are evicted until the budget is no longer exceeded, and
+   * finally the textures acquired in the current frame are promoted if they fit.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create textures.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  void update(const Renderer& renderer)
+  {
+    CENTURION_PROFILE_ZONE("texture_streamer::update");
+
+    usize reloads = 0;
+
+    for (auto& entry : m_entries) {
+      if (reloads == m_reloadLimit) {
+        break;
+      }
+
+      if (!entry.resident) {
+        continue;
+      }
+
+      if (entry.level < m_finestLevel) {
+        if (try_load(renderer, entry, m_finestLevel)) {
+          ++m_stats.demotions;
+        }
+        ++reloads;
+      }
+      else if (entry.large && entry.level < lowest_level &&
+               m_frame - entry.lastUsed >= m_idleFrames)
+      {
+        if (try_load(renderer, entry, entry.level + 1)) {
+          ++m_stats.demotions;
+        }
+        ++reloads;
+      }
+    }
+
+    evict_until_within_budget();
+
+    for (auto& entry : m_entries) {
+      if (reloads == m_reloadLimit) {
+        break;
+      }
+
+      if (entry.resident && entry.level > m_finestLevel && entry.lastUsed == m_frame) {
+        const auto level = entry.level - 1;
+        const auto bytes = bytes_at(entry, level);
+
+        // The current texture is only destroyed after the new one has been created
+        if (texture_memory::fits(bytes)) {
+          if (try_load(renderer, entry, level)) {
+            ++m_stats.promotions;
+          }
+          ++reloads;
+        }
+      }
+    }
+
+    ++m_frame;
+  }
+
+  /**
+   * \brief Unloads a texture, which is loaded again when it's acquired.
+   *
+   * \param id the ID of the texture.
+   *
+   * \since 6.4.0
+   */
+  void unload(const id_type id) noexcept
+  {
+    assert(id < m_entries.size());
+    m_entries[id].resident.reset();
+  }
+
+  /**
+   * \brief Evicts textures until a certain amount of memory has been freed.
+   *
+   * \details The least recently acquired textures are evicted first, except for textures
+   * acquired in the current frame. This is used when the streamer is registered with a
+   * `memory_budget`.
+   *
+   * \param bytes the amount of memory that should be freed, in bytes.
+   *
+   * \return the estimated amount of freed memory.
+   *
+   * \since 6.4.0
+   */
+  auto free_memory(const usize bytes) noexcept -> usize
+  {
+    usize freed = 0;
+    while (freed < bytes) {
+      auto* oldest = find_oldest();
+      if (!oldest) {
+        break;
+      }
+
+      freed += oldest->bytes;
+      evict(*oldest);
+    }
+
+    return freed;
+  }
+
+  /**
+   * \brief Unloads all textures.
+   *
+   * \since 6.4.0
+   */
+  void unload_all() noexcept
+  {
+    for (auto& entry : m_entries) {
+      entry.resident.reset();
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not a texture is loaded.
+   *
+   * \param id the ID of the texture.
+   *
+   * \return `true` if the texture is resident; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_resident(const id_type id) const noexcept -> bool
+  {
+    assert(id < m_entries.size());
+    return m_entries[id].resident.has_value();
+  }
+
+  /**
+   * \brief Returns the level of detail of a resident texture.
+   *
+   * \param id the ID of the texture.
+   *
+   * \return zero for full resolution, one for half resolution and two for quarter
+   * resolution.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto level(const id_type id) const noexcept -> int
+  {
+    assert(id < m_entries.size());
+    return m_entries[id].level;
+  }
+
+  /**
+   * \brief Returns the ratio between the resolution of a resident texture and its image.
+   *
+   * \param id the ID of the texture.
+   *
+   * \return 1 for full resolution, 0.5 for half resolution and 0.25 for quarter resolution.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto scale(const id_type id) const noexcept -> float
+  {
+    return 1.0f / static_cast<float>(1 << level(id));
+  }
+
+  /**
+   * \brief Returns the estimated memory used by all resident textures.
+   *
+   * \return the size of the resident textures, in bytes.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto resident_bytes() const noexcept -> usize
+  {
+    usize bytes = 0;
+    for (const auto& entry : m_entries) {
+      if (entry.resident) {
+        bytes += entry.bytes;
+      }
+    }
+    return bytes;
+  }
+
+  /**
+   * \brief Sets the size from which textures are initially loaded at a quarter of their
+   * resolution.
+   *
+   * \details Only large textures are demoted when idle. The default threshold is 1 MiB,
+   * e.g. a 512x512 texture with 32-bit pixels.
+   *
+   * \param bytes the minimum size of large textures, at full resolution, in bytes.
+   *
+   * \since 6.4.0
+   */
+  void set_large_threshold(const usize bytes) noexcept
+  {
+    m_largeThreshold = bytes;
+  }
+
+  /**
+   * \brief Sets the amount of frames after which unused large textures are demoted.
+   *
+   * \details The default is 120 frames.
+   *
+   * \param frames the amount of frames.
+   *
+   * \since 6.4.0
+   */
+  void set_idle_frames(const u64 frames) noexcept
+  {
+    m_idleFrames = frames;
+  }
+
+  /**
+   * \brief Sets the maximum amount of promotions and demotions per update.
+   *
+   * \details The default limit is 2.
+   *
+   * \param count the maximum amount of reloaded textures per update.
+   *
+   * \since 6.4.0
+   */
+  void set_reload_limit(const usize count) noexcept
+  {
+    m_reloadLimit = count;
+  }
+
+  /**
+   * \brief Sets the finest level of detail that textures are loaded at.
+   *
+   * \details Resident textures that are finer than the level are demoted in the next
+   * updates, subject to the reload limit. The default is `full_level`.
+   *
+   * \param level the finest level of detail, in the range [`full_level`, `lowest_level`].
+   *
+   * \since 6.4.0
+   */
+  void set_finest_level(const int level) noexcept
+  {
+    assert(level >= full_level && level <= lowest_level);
+    m_finestLevel = level;
+  }
+
+  /**
+   * \brief Limits the level of detail according to the settings of a power mode.
+   *
+   * \param change the power change, with the texture level of the new power mode.
+   *
+   * \see `set_finest_level()`
+   *
+   * \since 6.4.0
+   */
+  void handle(const power_change& change) noexcept
+  {
+    set_finest_level(std::clamp(change.settings.texture_level, full_level, lowest_level));
+  }
+
+  /**
+   * \brief Returns the finest level of detail that textures are loaded at.
+   *
+   * \return the finest level of detail.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto finest_level() const noexcept -> int
+  {
+    return m_finestLevel;
+  }
+
+  /**
+   * \brief Returns the amount of registered textures.
+   *
+   * \return the number of textures, resident or not.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> usize
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * \brief Returns statistics about the managed textures.
+   *
+   * \return the current statistics.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto statistics() const noexcept -> const texture_streamer_stats&
+  {
+    return m_stats;
+  }
+
+ private:
+  struct entry final
+  {
+    loader_type loader;
+    std::optional<texture> resident;
+    iarea fullSize{};
+    pixel_format format{};
+    usize bytes{};
+    u64 lastUsed{};
+    int level{};
+    bool large{};
+  };
+
+  std::vector<entry> m_entries;
+  texture_streamer_stats m_stats;
+  usize m_largeThreshold{1'024u * 1'024u};
+  usize m_reloadLimit{2};
+  u64 m_idleFrames{120};
+  u64 m_frame{};
+  int m_finestLevel{full_level};
+
+  [[nodiscard]] static auto size_at(const iarea size, const int level) noexcept -> iarea
+  {
+    return {std::max(size.width >> level, 1), std::max(size.height >> level, 1)};
+  }
+
+  [[nodiscard]] static auto bytes_at(const entry& entry, const int level) noexcept
+      -> usize
+  {
+    return texture_memory::bytes_of(entry.format, size_at(entry.fullSize, level));
+  }
+
+  // Loads the texture at a level, or at the initial level if there is none
+  template <typename Renderer>
+  void load(const Renderer& renderer, entry& entry, std::optional<int> level)
+  {
+    const auto image = entry.loader();
+
+    entry.fullSize = image.size();
+    entry.format = image.format_info().format();
+    entry.large = texture_memory::bytes_of(entry.format, entry.fullSize) > m_largeThreshold;
+
+    const auto target =
+        level.value_or(std::max(entry.large ? lowest_level : full_level, m_finestLevel));
+    const auto size = size_at(entry.fullSize, target);
+
+    if (target == full_level) {
+      entry.resident.emplace(renderer, image);
+    }
+    else {
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+      entry.resident.emplace(renderer, image.scaled(size, scale_mode::linear));
+#else
+      entry.resident.emplace(renderer, image.scaled(size));
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+    }
+
+    entry.level = target;
+    entry.bytes = texture_memory::bytes_of(entry.resident->get());
+  }
+
+  // Reloads a resident texture, keeping the current texture if the reload fails
+  template <typename Renderer>
+  auto try_load(const Renderer& renderer, entry& entry, const int level) -> bool
+  {
+    auto previous = std::move(entry.resident);
+    const auto previousLevel = entry.level;
+    const auto previousBytes = entry.bytes;
+
+    try {
+      load(renderer, entry, level);
+      return true;
+    }
+    catch (...) {
+      entry.resident = std::move(previous);
+      entry.level = previousLevel;
+      entry.bytes = previousBytes;
+      return false;
+    }
+  }
+
+  void evict_until_within_budget() noexcept
+  {
+    while (texture_memory::over_budget()) {
+      auto* oldest = find_oldest();
+      if (!oldest) {
+        break;
+      }
+
+      evict(*oldest);
+    }
+  }
+
+  // Returns the least recently acquired texture that may be evicted, if there is one
+  [[nodiscard]] auto find_oldest() noexcept -> entry*
+  {
+    entry* oldest = nullptr;
+
+    for (auto& entry : m_entries) {
+      if (entry.resident && entry.lastUsed != m_frame &&
+          (!oldest || entry.lastUsed < oldest->lastUsed))
+      {
+        oldest = &entry;
+      }
+    }
+
+    return oldest;
+  }
+
+  void evict(entry& entry) noexcept
+  {
+    entry.resident.reset();
+    ++m_stats.evictions;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_STREAMER_HEADER
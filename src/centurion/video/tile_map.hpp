@@ -0,0 +1,567 @@
+#ifndef CENTURION_TILE_MAP_HEADER
+#define CENTURION_TILE_MAP_HEADER
+
+#include <SDL2/SDL.h>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <algorithm>  // min, clamp, fill
+#include <cassert>    // assert
+#include <cmath>      // floor, ceil
+#include <optional>   // optional
+#include <utility>    // pair
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/profiler_macros.hpp"
+#include "blend_mode.hpp"
+#include "colors.hpp"
+#include "pixel_format.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum tile_cache_mode
+ *
+ * \brief Represents the different ways in which a tile map can cache its chunks.
+ *
+ * \since 6.4.0
+ */
+enum class tile_cache_mode
+{
+  geometry,  ///< Chunks are cached as vertex buffers, all rendered with one call.
+  texture    ///< Chunks are baked into render target textures, one call per chunk.
+};
+
+/**
+ * \struct tile_map_stats
+ *
+ * \brief Provides statistics about the most recent rendering of a tile map.
+ *
+ * \since 6.4.0
+ */
+struct tile_map_stats final
+{
+  usize visibleChunks{};  ///< The amount of chunks that intersected the viewport.
+  usize rebuiltChunks{};  ///< The amount of chunks that had to be rebuilt.
+  usize tiles{};          ///< The amount of rendered tiles.
+  usize drawCalls{};      ///< The amount of draw calls, including chunk rebuilds.
+};
+
+/**
+ * \class tile_map
+ *
+ * \brief A grid of tiles, that is rendered using cached chunks of static geometry.
+ *
+ * \details The map is divided into square chunks of tiles. The geometry of a chunk is
+ * only rebuilt when one of its tiles has changed, and only the chunks that intersect the
+ * translation viewport of the renderer are rendered, see
+ * `basic_renderer::set_translation_viewport()`. This is considerably cheaper than
+ * rendering each visible tile with its own call.
+ * \code{cpp}
+ *   cen::tile_map map{tileset, {32, 32}, 256, 256};
+ *   map.set_tile(10, 20, 3);
+ *
+ *   renderer.set_translation_viewport({camera.x(), camera.y(), 800, 600});
+ *   map.render(renderer);
+ * \endcode
+ *
+ * \details Tiles are identified by their one-based index in the tileset, which is read row
+ * by row, so that `empty_tile` (zero) can be used for tiles that aren't rendered. This is
+ * the same convention as used by the Tiled editor.
+ *
+ * \details By default, the vertices of all visible chunks are rendered together with a
+ * single `SDL_RenderGeometry` call. Alternatively, chunks can be baked into render target
+ * textures, see `tile_cache_mode`, which is preferable if the tiles are small compared to
+ * the chunks.
+ *
+ * \note The translation viewport must have a size that corresponds to the visible area,
+ * nothing is rendered if it has no size.
+ *
+ * \note The tileset texture must outlive the tile map.
+ *
+ * \see `tile_map_stats`
+ * \see `tile_cache_mode`
+ *
+ * \since 6.4.0
+ */
+class tile_map final
+{
+ public:
+  using tile_id = u16;
+
+  /// The identifier used for tiles that aren't rendered.
+  inline constexpr static tile_id empty_tile = 0;
+
+  /**
+   * \brief Creates a tile map where all tiles are empty.
+   *
+   * \pre The tile size must be positive, and no larger than the tileset.
+   * \pre The chunk size must be greater than zero.
+   *
+   * \tparam T the ownership semantics of the tileset texture.
+   *
+   * \param tileset the texture that contains the tiles.
+   * \param tileSize the size of each tile, both in the tileset and when rendered.
+   * \param columns the amount of tile columns in the map.
+   * \param rows the amount of tile rows in the map.
+   * \param chunkSize the width and height of each chunk, in tiles.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  tile_map(const basic_texture<T>& tileset,
+           const iarea tileSize,
+           const usize columns,
+           const usize rows,
+           const usize chunkSize = 16)
+      : m_tileset{tileset.get()}
+      , m_tilesetSize{cast<farea>(tileset.size())}
+      , m_tileSize{tileSize}
+      , m_columns{columns}
+      , m_rows{rows}
+      , m_chunkSize{chunkSize}
+      , m_chunkColumns{(columns + chunkSize - 1) / chunkSize}
+      , m_chunkRows{(rows + chunkSize - 1) / chunkSize}
+      , m_tiles(columns * rows, empty_tile)
+      , m_chunks(m_chunkColumns * m_chunkRows)
+  {
+    assert(tileSize.width > 0 && tileSize.height > 0);
+    assert(tileSize.width <= tileset.width() && tileSize.height <= tileset.height());
+    assert(chunkSize > 0);
+
+    m_tilesetColumns = static_cast<usize>(tileset.width() / tileSize.width);
+  }
+
+  /**
+   * \brief Sets the tile at a position in the map.
+   *
+   * \details The chunk that contains the tile is only rebuilt if the tile is changed.
+   *
+   * \pre The position must be within the bounds of the map.
+   *
+   * \param column the column index of the tile.
+   * \param row the row index of the tile.
+   * \param id the new tile, may be `empty_tile`.
+   *
+   * \since 6.4.0
+   */
+  void set_tile(const usize column, const usize row, const tile_id id) noexcept
+  {
+    assert(column < m_columns);
+    assert(row < m_rows);
+
+    auto& tile = m_tiles[(row * m_columns) + column];
+    if (tile != id) {
+      tile = id;
+      m_chunks[chunk_index(column / m_chunkSize, row / m_chunkSize)].dirty = true;
+    }
+  }
+
+  /**
+   * \brief Returns the tile at a position in the map.
+   *
+   * \pre The position must be within the bounds of the map.
+   *
+   * \param column the column index of the tile.
+   * \param row the row index of the tile.
+   *
+   * \return the tile at the position, which might be `empty_tile`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto tile(const usize column, const usize row) const noexcept -> tile_id
+  {
+    assert(column < m_columns);
+    assert(row < m_rows);
+    return m_tiles[(row * m_columns) + column];
+  }
+
+  /**
+   * \brief Sets all tiles in the map.
+   *
+   * \param id the tile that will be used, may be `empty_tile`.
+   *
+   * \since 6.4.0
+   */
+  void fill(const tile_id id) noexcept
+  {
+    std::fill(m_tiles.begin(), m_tiles.end(), id);
+    invalidate();
+  }
+
+  /**
+   * \brief Forces all chunks to be rebuilt when they are rendered next.
+   *
+   * \details This is only needed if the contents of the tileset texture have changed, or
+   * if baked chunk textures have been lost, e.g. after the `SDL_RENDER_TARGETS_RESET`
+   * event.
+   *
+   * \since 6.4.0
+   */
+  void invalidate() noexcept
+  {
+    for (auto& chunk : m_chunks) {
+      chunk.dirty = true;
+    }
+  }
+
+  /**
+   * \brief Renders the chunks that intersect the translation viewport of a renderer.
+   *
+   * \details Chunks that have changed since they were last rendered are rebuilt first.
+   * Chunks outside of the viewport aren't rebuilt until they become visible.
+   *
+   * \details When chunks are baked into textures, the render target of the renderer is
+   * temporarily changed, and restored afterwards.
+   *
+   * \tparam Renderer the type of the renderer, must be an owning renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if the visible chunks were rendered; `failure` otherwise.
+   *
+   * \throws sdl_error if a chunk texture cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename Renderer>
+  auto render(Renderer& renderer) -> result
+  {
+    CENTURION_PROFILE_ZONE("tile_map::render");
+
+    m_stats = tile_map_stats{};
+
+    const auto& viewport = renderer.translation_viewport();
+    const auto chunkWidth = static_cast<float>(m_chunkSize) * m_tileSize.width;
+    const auto chunkHeight = static_cast<float>(m_chunkSize) * m_tileSize.height;
+
+    const auto [firstColumn, endColumn] =
+        visible_range(viewport.x(), viewport.width(), chunkWidth, m_chunkColumns);
+    const auto [firstRow, endRow] =
+        visible_range(viewport.y(), viewport.height(), chunkHeight, m_chunkRows);
+
+    m_vertices.clear();
+
+    bool ok = true;
+    for (auto row = firstRow; row < endRow; ++row) {
+      for (auto column = firstColumn; column < endColumn; ++column) {
+        auto& chunk = m_chunks[chunk_index(column, row)];
+        ++m_stats.visibleChunks;
+
+        if (chunk.dirty) {
+          ok = rebuild(renderer, chunk, column, row) && ok;
+        }
+
+        if (chunk.vertices.empty()) {
+          continue;
+        }
+
+        const auto x = (static_cast<float>(column) * chunkWidth) - viewport.x();
+        const auto y = (static_cast<float>(row) * chunkHeight) - viewport.y();
+        m_stats.tiles += chunk.vertices.size() / 4u;
+
+        if (m_mode == tile_cache_mode::texture) {
+          const auto& texture = *chunk.baked;
+          ok = renderer.render(texture, frect{{x, y}, cast<farea>(texture.size())}) && ok;
+          ++m_stats.drawCalls;
+        }
+        else {
+          for (const auto& vertex : chunk.vertices) {
+            auto& translated = m_vertices.emplace_back(vertex);
+            translated.position.x += x;
+            translated.position.y += y;
+          }
+        }
+      }
+    }
+
+    if (!m_vertices.empty()) {
+      ok = submit(renderer, m_vertices) && ok;
+    }
+
+    return ok;
+  }
+
+  /**
+   * \brief Sets how chunks are cached.
+   *
+   * \details All chunks are rebuilt when they are rendered next if the mode is changed.
+   *
+   * \param mode the new cache mode.
+   *
+   * \since 6.4.0
+   */
+  void set_cache_mode(const tile_cache_mode mode)
+  {
+    if (mode != m_mode) {
+      m_mode = mode;
+      for (auto& chunk : m_chunks) {
+        chunk.baked.reset();
+        chunk.dirty = true;
+      }
+    }
+  }
+
+  /**
+   * \brief Returns the way in which chunks are cached.
+   *
+   * \details The default mode is `tile_cache_mode::geometry`.
+   *
+   * \return the current cache mode.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto cache_mode() const noexcept -> tile_cache_mode
+  {
+    return m_mode;
+  }
+
+  /**
+   * \brief Returns the amount of tile columns in the map.
+   *
+   * \return the width of the map, in tiles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto columns() const noexcept -> usize
+  {
+    return m_columns;
+  }
+
+  /**
+   * \brief Returns the amount of tile rows in the map.
+   *
+   * \return the height of the map, in tiles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto rows() const noexcept -> usize
+  {
+    return m_rows;
+  }
+
+  /**
+   * \brief Returns the size of the tiles.
+   *
+   * \return the size of each tile.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto tile_size() const noexcept -> iarea
+  {
+    return m_tileSize;
+  }
+
+  /**
+   * \brief Returns the width and height of the chunks, in tiles.
+   *
+   * \return the chunk size.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto chunk_size() const noexcept -> usize
+  {
+    return m_chunkSize;
+  }
+
+  /**
+   * \brief Returns the total amount of chunks in the map.
+   *
+   * \return the number of chunks.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto chunk_count() const noexcept -> usize
+  {
+    return m_chunks.size();
+  }
+
+  /**
+   * \brief Returns statistics about the most recent call to `render()`.
+   *
+   * \return the statistics of the last rendering.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> const tile_map_stats&
+  {
+    return m_stats;
+  }
+
+ private:
+  struct chunk final
+  {
+    std::vector<SDL_Vertex> vertices;  // Relative to the chunk, four for each tile
+    std::optional<texture> baked;      // Only used in the texture cache mode
+    bool dirty{true};
+  };
+
+  SDL_Texture* m_tileset{};
+  farea m_tilesetSize{};
+  iarea m_tileSize{};
+  usize m_tilesetColumns{};
+  usize m_columns{};
+  usize m_rows{};
+  usize m_chunkSize{};
+  usize m_chunkColumns{};
+  usize m_chunkRows{};
+  std::vector<tile_id> m_tiles;
+  std::vector<chunk> m_chunks;
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+  tile_map_stats m_stats;
+  tile_cache_mode m_mode{tile_cache_mode::geometry};
+
+  [[nodiscard]] auto chunk_index(const usize column, const usize row) const noexcept
+      -> usize
+  {
+    return (row * m_chunkColumns) + column;
+  }
+
+  // Returns the half-open range of chunks that overlap [position, position + size)
+  [[nodiscard]] static auto visible_range(const float position,
+                                          const float size,
+                                          const float chunkSize,
+                                          const usize count) noexcept
+      -> std::pair<usize, usize>
+  {
+    if (size <= 0) {
+      return {0, 0};
+    }
+
+    const auto first = std::floor(position / chunkSize);
+    const auto end = std::ceil((position + size) / chunkSize);
+    const auto limit = static_cast<float>(count);
+
+    return {static_cast<usize>(std::clamp(first, 0.0f, limit)),
+            static_cast<usize>(std::clamp(end, 0.0f, limit))};
+  }
+
+  template <typename Renderer>
+  auto rebuild(Renderer& renderer, chunk& chunk, const usize column, const usize row)
+      -> result
+  {
+    ++m_stats.rebuiltChunks;
+    chunk.dirty = false;
+    chunk.vertices.clear();
+
+    const auto firstColumn = column * m_chunkSize;
+    const auto firstRow = row * m_chunkSize;
+    const auto columns = std::min(m_chunkSize, m_columns - firstColumn);
+    const auto rows = std::min(m_chunkSize, m_rows - firstRow);
+
+    const auto width = static_cast<float>(m_tileSize.width);
+    const auto height = static_cast<float>(m_tileSize.height);
+
+    for (usize y = 0; y < rows; ++y) {
+      for (usize x = 0; x < columns; ++x) {
+        const auto id = m_tiles[((firstRow + y) * m_columns) + firstColumn + x];
+        if (id == empty_tile) {
+          continue;
+        }
+
+        const auto index = static_cast<usize>(id - 1u);
+        const auto u0 = static_cast<float>(index % m_tilesetColumns) * width;
+        const auto v0 = static_cast<float>(index / m_tilesetColumns) * height;
+
+        const auto x0 = static_cast<float>(x) * width;
+        const auto y0 = static_cast<float>(y) * height;
+
+        add_quad(chunk.vertices, {{x0, y0}, {width, height}}, {{u0, v0}, {width, height}});
+      }
+    }
+
+    if (m_mode == tile_cache_mode::texture && !chunk.vertices.empty()) {
+      const iarea size{static_cast<int>(columns) * m_tileSize.width,
+                       static_cast<int>(rows) * m_tileSize.height};
+      return bake(renderer, chunk, size);
+    }
+
+    return success;
+  }
+
+  void add_quad(std::vector<SDL_Vertex>& vertices, const frect& dst, const frect& src) const
+  {
+    const auto& [width, height] = m_tilesetSize;
+
+    const auto u0 = src.x() / width;
+    const auto v0 = src.y() / height;
+    const auto u1 = src.max_x() / width;
+    const auto v1 = src.max_y() / height;
+
+    constexpr SDL_Color white{0xFF, 0xFF, 0xFF, 0xFF};
+    vertices.push_back({{dst.x(), dst.y()}, white, {u0, v0}});
+    vertices.push_back({{dst.max_x(), dst.y()}, white, {u1, v0}});
+    vertices.push_back({{dst.max_x(), dst.max_y()}, white, {u1, v1}});
+    vertices.push_back({{dst.x(), dst.max_y()}, white, {u0, v1}});
+  }
+
+  template <typename Renderer>
+  auto bake(Renderer& renderer, chunk& chunk, const iarea size) -> result
+  {
+    if (!chunk.baked) {
+      chunk.baked.emplace(renderer, pixel_format::rgba32, texture_access::target, size);
+      chunk.baked->set_blend_mode(blend_mode::blend);
+    }
+
+    auto previous = renderer.get_render_target();
+    if (!renderer.set_target(*chunk.baked)) {
+      return failure;
+    }
+
+    renderer.clear_with(colors::transparent);
+    const auto ok = submit(renderer, chunk.vertices);
+
+    if (previous) {
+      renderer.set_target(previous);
+    }
+    else {
+      renderer.reset_target();
+    }
+
+    return ok;
+  }
+
+  template <typename Renderer>
+  auto submit(Renderer& renderer, const std::vector<SDL_Vertex>& vertices) -> result
+  {
+    const auto quads = vertices.size() / 4u;
+
+    // The quads all share the same index pattern, so the indices are reused
+    for (auto quad = m_indices.size() / 6u; quad < quads; ++quad) {
+      const auto first = static_cast<int>(quad * 4u);
+      m_indices.push_back(first);
+      m_indices.push_back(first + 1);
+      m_indices.push_back(first + 2);
+      m_indices.push_back(first + 2);
+      m_indices.push_back(first + 3);
+      m_indices.push_back(first);
+    }
+
+    renderer.record_draw(quads, m_tileset);
+    ++m_stats.drawCalls;
+
+    return SDL_RenderGeometry(renderer.get(),
+                              m_tileset,
+                              vertices.data(),
+                              isize(vertices),
+                              m_indices.data(),
+                              static_cast<int>(quads * 6u)) == 0;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+#endif  // CENTURION_TILE_MAP_HEADER
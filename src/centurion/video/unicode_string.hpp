@@ -1,13 +1,23 @@
 #ifndef CENTURION_UNICODE_STRING_HEADER
 #define CENTURION_UNICODE_STRING_HEADER
 
+#include <algorithm>         // copy, equal, fill, min
+#include <array>             // array
 #include <cassert>           // assert
 #include <initializer_list>  // initializer_list
+#include <iterator>          // reverse_iterator
+#include <optional>          // optional, nullopt
+#include <stdexcept>         // out_of_range
+#include <string>            // string
+#include <string_view>       // string_view
 #include <type_traits>       // is_same_v, decay_t
+#include <utility>           // move
 #include <vector>            // vector
 
 #include "../compiler/compiler.hpp"
 #include "../core/integers.hpp"
+#include "../detail/utf_kernels.hpp"
+#include "../system/allocation_tracker.hpp"
 
 namespace cen {
 
@@ -30,29 +40,34 @@ using unicode = u16;
  *
  * \serializable
  *
- * \details This class is a wrapper around a `std::vector<unicode>`, that provides a
- * similar interface to that of `std::string`.
+ * \details This class provides a similar interface to that of `std::string`. Strings with
+ * fewer than `inline_capacity` glyphs are stored in an internal buffer, so creating,
+ * copying and appending to short strings, e.g. most UI labels, doesn't allocate memory.
+ * Longer strings are stored in a `std::vector<unicode>`.
  */
 class unicode_string final
 {
  public:
-  using value_type = std::vector<unicode>::value_type;
+  using value_type = unicode;
 
-  using pointer = std::vector<unicode>::pointer;
-  using const_pointer = std::vector<unicode>::const_pointer;
+  using pointer = unicode*;
+  using const_pointer = const unicode*;
 
-  using reference = std::vector<unicode>::reference;
-  using const_reference = std::vector<unicode>::const_reference;
+  using reference = unicode&;
+  using const_reference = const unicode&;
 
-  using iterator = std::vector<unicode>::iterator;
-  using const_iterator = std::vector<unicode>::const_iterator;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
 
-  using reverse_iterator = std::vector<unicode>::reverse_iterator;
-  using const_reverse_iterator = std::vector<unicode>::const_reverse_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   using size_type = std::vector<unicode>::size_type;
   using difference_type = std::vector<unicode>::difference_type;
 
+  /// The capacity of the internal buffer, including the null-terminator.
+  inline constexpr static size_type inline_capacity = 24;
+
   /// \name Construction
   /// \{
 
@@ -61,10 +76,7 @@ class unicode_string final
    *
    * \since 5.0.0
    */
-  unicode_string()
-  {
-    m_data.push_back(0);
-  }
+  unicode_string() noexcept = default;
 
   /**
    * \brief Creates a Unicode string based on the supplied values.
@@ -75,9 +87,66 @@ class unicode_string final
    */
   unicode_string(std::initializer_list<unicode> codes)
   {
-    reserve(codes.size() + 1);
-    m_data.insert(m_data.end(), codes.begin(), codes.end());
-    m_data.push_back(0);
+    assign(codes.begin(), codes.size());
+  }
+
+  /**
+   * \brief Creates a copy of a Unicode string.
+   *
+   * \details Short strings are stored in the internal buffer of the copy, even if the
+   * copied string uses a heap buffer.
+   *
+   * \param other the string that will be copied.
+   *
+   * \since 6.4.0
+   */
+  unicode_string(const unicode_string& other)
+  {
+    assign(other.data(), other.size());
+  }
+
+  /**
+   * \brief Creates a Unicode string by moving the contents of another string.
+   *
+   * \details The moved-from string is left empty.
+   *
+   * \param other the string that will be moved.
+   *
+   * \since 6.4.0
+   */
+  unicode_string(unicode_string&& other) noexcept
+  {
+    take(other);
+  }
+
+  /**
+   * \brief Copies the contents of a Unicode string.
+   *
+   * \details If this string uses a heap buffer, the buffer is reused.
+   *
+   * \param other the string that will be copied.
+   *
+   * \return the string itself.
+   *
+   * \since 6.4.0
+   */
+  auto operator=(const unicode_string& other) -> unicode_string&
+  {
+    if (this != &other) {
+      assign(other.data(), other.size());
+    }
+
+    return *this;
+  }
+
+  /// \copydoc unicode_string(unicode_string&&)
+  auto operator=(unicode_string&& other) noexcept -> unicode_string&
+  {
+    if (this != &other) {
+      take(other);
+    }
+
+    return *this;
   }
 
   /// \} End of construction
@@ -87,7 +156,8 @@ class unicode_string final
    *
    * \details Use this function to optimize additions to the string when you know or can
    * approximate the amount of elements that will be added. This can reduce the amount of
-   * unnecessary allocations and copies of the underlying array.
+   * unnecessary allocations and copies of the underlying array. Nothing happens if the
+   * capacity is already large enough, e.g. when the amount fits in the internal buffer.
    *
    * \param n the amount of elements to allocate memory for.
    *
@@ -95,7 +165,43 @@ class unicode_string final
    */
   void reserve(const size_type n)
   {
-    m_data.reserve(n);
+    if (n <= capacity()) {
+      return;
+    }
+
+    if (m_local) {
+      spill(n);
+    }
+    else {
+      m_heap.reserve(n);
+    }
+  }
+
+  /**
+   * \brief Changes the amount of elements in the string.
+   *
+   * \details Added elements are zero, and the null-terminator is moved to the new end of
+   * the string. This is useful to write glyphs directly to `data()`.
+   *
+   * \param n the new amount of elements, not including the null-terminator.
+   *
+   * \since 6.4.0
+   */
+  void resize(const size_type n)
+  {
+    reserve(n + 1);
+
+    if (m_local) {
+      std::fill(m_small.begin() + static_cast<difference_type>(std::min(m_size, n)),
+                m_small.begin() + static_cast<difference_type>(n + 1),
+                unicode{0});
+    }
+    else {
+      m_heap.resize(n + 1);
+      m_heap[n] = 0;
+    }
+
+    m_size = n;
   }
 
   /**
@@ -107,7 +213,19 @@ class unicode_string final
    */
   void append(const unicode ch)
   {
-    m_data.insert(m_data.end() - 1, ch);
+    if (m_local) {
+      if (m_size + 1 < inline_capacity) {
+        m_small[m_size] = ch;
+        m_small[++m_size] = 0;
+        return;
+      }
+
+      spill(inline_capacity * 2);
+    }
+
+    m_heap.back() = ch;
+    m_heap.push_back(0);
+    ++m_size;
   }
 
   /**
@@ -126,6 +244,7 @@ class unicode_string final
     static_assert(sizeof...(Character) != 0, "Function requires at least 1 argument!");
     static_assert((std::is_same_v<unicode, std::decay_t<Character>> && ...),
                   "Cannot append values that aren't of type \"unicode\"!");
+    reserve(m_size + sizeof...(Character) + 1);
     (append(code), ...);
   }
 
@@ -144,8 +263,17 @@ class unicode_string final
    */
   void pop_back()
   {
-    if (!empty()) {
-      m_data.erase(m_data.end() - 2);
+    if (empty()) {
+      return;
+    }
+
+    --m_size;
+    if (m_local) {
+      m_small[m_size] = 0;
+    }
+    else {
+      m_heap.pop_back();
+      m_heap.back() = 0;
     }
   }
 
@@ -160,20 +288,20 @@ class unicode_string final
    */
   [[nodiscard]] auto size() const noexcept -> size_type
   {
-    return m_data.size() - 1;
+    return m_size;
   }
 
   /**
    * \brief Returns the capacity of the string.
    *
-   * \return the capacity of the string (the amount of elements that can be stored before
-   * needing to allocate more memory).
+   * \return the capacity of the string (the amount of elements, including the
+   * null-terminator, that can be stored before needing to allocate more memory).
    *
    * \since 5.0.0
    */
   [[nodiscard]] auto capacity() const noexcept -> size_type
   {
-    return m_data.capacity();
+    return m_local ? inline_capacity : m_heap.capacity();
   }
 
   /**
@@ -187,7 +315,20 @@ class unicode_string final
    */
   [[nodiscard]] auto empty() const noexcept -> bool
   {
-    return m_data.size() == 1;
+    return m_size == 0;
+  }
+
+  /**
+   * \brief Indicates whether or not the string is stored in the internal buffer.
+   *
+   * \return `true` if the string doesn't use any dynamically allocated memory; `false`
+   * otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto is_inline() const noexcept -> bool
+  {
+    return m_local;
   }
 
   /**
@@ -199,13 +340,13 @@ class unicode_string final
    */
   [[nodiscard]] auto data() noexcept -> pointer
   {
-    return m_data.data();
+    return m_local ? m_small.data() : m_heap.data();
   }
 
   /// \copydoc data
   [[nodiscard]] auto data() const noexcept -> const_pointer
   {
-    return m_data.data();
+    return m_local ? m_small.data() : m_heap.data();
   }
 
   /**
@@ -219,13 +360,13 @@ class unicode_string final
    */
   [[nodiscard]] auto begin() noexcept -> iterator
   {
-    return m_data.begin();
+    return data();
   }
 
   /// \copydoc begin
   [[nodiscard]] auto begin() const noexcept -> const_iterator
   {
-    return m_data.begin();
+    return data();
   }
 
   /**
@@ -239,42 +380,46 @@ class unicode_string final
    */
   [[nodiscard]] auto end() noexcept -> iterator
   {
-    return m_data.end() - 1;
+    return data() + m_size;
   }
 
   /// \copydoc end
   [[nodiscard]] auto end() const noexcept -> const_iterator
   {
-    return m_data.end() - 1;
+    return data() + m_size;
   }
 
   /**
    * \brief Returns the element at the specified index.
    *
    * \details This function will throw an exception if the supplied index is
-   * out-of-bounds.
+   * out-of-bounds. The null-terminator can be accessed with the index `size()`.
    *
    * \param index the index of the desired element.
    *
    * \return the element at the specified index.
    *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
    * \since 5.0.0
    */
   [[nodiscard]] auto at(const size_type index) -> reference
   {
-    return m_data.at(index);
+    check_index(index);
+    return data()[index];
   }
 
   /// \copydoc at
   [[nodiscard]] auto at(const size_type index) const -> const_reference
   {
-    return m_data.at(index);
+    check_index(index);
+    return data()[index];
   }
 
   /**
    * \brief Returns the element at the specified index.
    *
-   * \pre `index` **must** be in the range [0, `size()`);
+   * \pre `index` **must** be in the range [0, `size()`];
    *
    * \details This function will does *not* perform bounds-checking. However, in
    * debug-mode, an assertion will abort the program if the supplied index is
@@ -288,23 +433,24 @@ class unicode_string final
    */
   [[nodiscard]] auto operator[](const size_type index) noexcept(on_msvc()) -> reference
   {
-    assert(index < m_data.size());
-    return m_data[index];
+    assert(index <= m_size);
+    return data()[index];
   }
 
   /// \copydoc operator[]
   [[nodiscard]] auto operator[](const size_type index) const noexcept(on_msvc())
       -> const_reference
   {
-    assert(index < m_data.size());
-    return m_data[index];
+    assert(index <= m_size);
+    return data()[index];
   }
 
   /**
    * \brief Serializes the string.
    *
    * \details This function expects that the archive provides an overloaded `operator()`,
-   * used for serializing data. This API is based on the Cereal serialization library.
+   * used for serializing data. This API is based on the Cereal serialization library. The
+   * glyphs are saved as a vector that includes the null-terminator.
    *
    * \tparam Archive the type of the archive.
    *
@@ -313,13 +459,95 @@ class unicode_string final
    * \since 5.3.0
    */
   template <typename Archive>
-  void serialize(Archive& archive)
+  void save(Archive& archive) const
+  {
+    archive(std::vector<unicode>(data(), data() + m_size + 1));
+  }
+
+  /**
+   * \brief Deserializes the string.
+   *
+   * \tparam Archive the type of the archive.
+   *
+   * \param archive the archive used to deserialize the string.
+   *
+   * \see `save()`
+   *
+   * \since 6.4.0
+   */
+  template <typename Archive>
+  void load(Archive& archive)
   {
-    archive(m_data);
+    std::vector<unicode> glyphs;
+    archive(glyphs);
+
+    // Drop the null-terminator, if there is one
+    if (!glyphs.empty() && glyphs.back() == 0) {
+      glyphs.pop_back();
+    }
+
+    assign(glyphs.data(), glyphs.size());
   }
 
  private:
-  std::vector<unicode> m_data;
+  detail::tracked_vector<unicode, alloc_subsystem::text> m_heap;
+  std::array<unicode, inline_capacity> m_small{};
+  size_type m_size{};
+  bool m_local{true};
+
+  void check_index(const size_type index) const
+  {
+    if (index > m_size) {
+      throw std::out_of_range{"Invalid unicode_string index!"};
+    }
+  }
+
+  // Moves the string, including the null-terminator, to a heap buffer
+  void spill(const size_type n)
+  {
+    decltype(m_heap) heap;
+    heap.reserve(n);
+    heap.assign(m_small.begin(), m_small.begin() + static_cast<difference_type>(m_size + 1));
+
+    m_heap = std::move(heap);
+    m_local = false;
+  }
+
+  void assign(const unicode* glyphs, const size_type count)
+  {
+    if (m_local && count < inline_capacity) {
+      std::copy(glyphs, glyphs + count, m_small.begin());
+      m_small[count] = 0;
+    }
+    else {
+      // Heap buffers are reused, like the capacity of a std::string
+      m_heap.reserve(count + 1);
+      m_heap.assign(glyphs, glyphs + count);
+      m_heap.push_back(0);
+      m_local = false;
+    }
+
+    m_size = count;
+  }
+
+  void take(unicode_string& other) noexcept
+  {
+    m_size = other.m_size;
+    m_local = other.m_local;
+
+    if (m_local) {
+      m_small = other.m_small;
+      m_heap = decltype(m_heap){};
+    }
+    else {
+      m_heap = std::move(other.m_heap);
+    }
+
+    other.m_heap = decltype(m_heap){};
+    other.m_small[0] = 0;
+    other.m_size = 0;
+    other.m_local = true;
+  }
 };
 
 /// \name Unicode string comparison operators
@@ -338,19 +566,7 @@ class unicode_string final
 [[nodiscard]] inline auto operator==(const unicode_string& lhs, const unicode_string& rhs)
     -> bool
 {
-  if (lhs.size() != rhs.size()) {
-    return false;
-  }
-
-  for (unicode_string::size_type index = 0; index < lhs.size(); ++index) {
-    const auto a = lhs.at(index);
-    const auto b = rhs.at(index);
-    if (a != b) {
-      return false;
-    }
-  }
-
-  return true;
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 /**
@@ -371,6 +587,80 @@ class unicode_string final
 
 /// \} End of unicode string comparison operators
 
+/// \name Unicode string conversions
+/// \{
+
+/**
+ * \brief Converts a UTF-8 string to a Unicode string.
+ *
+ * \details The input is validated, i.e. truncated sequences, overlong encodings, encoded
+ * surrogates and code points above U+10FFFF are rejected. Code points outside of the Basic
+ * Multilingual Plane, which don't fit in a single `unicode` value, are stored as UTF-16
+ * surrogate pairs. Runs of ASCII characters are converted with SIMD instructions, if
+ * available.
+ *
+ * \details The result is allocated once, with room for as many glyphs as there are bytes
+ * in the input, which is an upper bound of the amount of glyphs. Short strings fit in the
+ * internal buffer of the Unicode string, and don't allocate at all.
+ * \code{cpp}
+ *   if (const auto text = cen::to_unicode_string("Grüße")) {
+ *     renderer.render_text(cache, *text, {10, 10});
+ *   }
+ * \endcode
+ *
+ * \note Glyphs that are stored as surrogate pairs can't be rendered with `font_cache`,
+ * which caches single `unicode` values.
+ *
+ * \param utf8 the UTF-8 encoded string.
+ *
+ * \return the converted string; `std::nullopt` if the input isn't valid UTF-8.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto to_unicode_string(const std::string_view utf8)
+    -> std::optional<unicode_string>
+{
+  unicode_string result;
+  result.resize(utf8.size());
+
+  const auto* bytes = reinterpret_cast<const u8*>(utf8.data());
+  if (const auto count = detail::decode_utf8(bytes, utf8.size(), result.data())) {
+    result.resize(*count);
+    return result;
+  }
+
+  return std::nullopt;
+}
+
+/**
+ * \brief Converts a Unicode string to a UTF-8 string.
+ *
+ * \details The Unicode string is interpreted as UTF-16, i.e. surrogate pairs are combined
+ * into a single code point. Runs of ASCII characters are converted with SIMD instructions,
+ * if available.
+ *
+ * \param str the Unicode string.
+ *
+ * \return the UTF-8 encoded string; `std::nullopt` if the string has unpaired surrogates.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto to_utf8(const unicode_string& str) -> std::optional<std::string>
+{
+  // Every code unit is encoded as at most three bytes
+  std::string result(str.size() * 3, '\0');
+
+  auto* bytes = reinterpret_cast<u8*>(result.data());
+  if (const auto count = detail::encode_utf8(str.data(), str.size(), bytes)) {
+    result.resize(*count);
+    return result;
+  }
+
+  return std::nullopt;
+}
+
+/// \} End of unicode string conversions
+
 namespace literals {
 
 /**
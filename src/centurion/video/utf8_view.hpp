@@ -0,0 +1,233 @@
+#ifndef CENTURION_UTF8_VIEW_HEADER
+#define CENTURION_UTF8_VIEW_HEADER
+
+#include <cstddef>      // ptrdiff_t
+#include <iterator>     // forward_iterator_tag
+#include <string_view>  // string_view
+
+#include "../core/integers.hpp"
+#include "../detail/utf_kernels.hpp"
+#include "unicode_string.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class utf8_view
+ *
+ * \brief A non-owning view of a UTF-8 string, that is iterated as `unicode` glyphs.
+ *
+ * \details The glyphs are decoded while iterating, so UTF-8 text can be supplied directly
+ * to functions that accept any iterable of `unicode` glyphs, e.g.
+ * `basic_renderer::render_text()`, `text_layout::set_text()`, `text_batch::add()` and
+ * `font_cache::has_all()`, without converting it to a `unicode_string` first. Neither
+ * creating nor iterating a view allocates memory.
+ * \code{cpp}
+ *   for (const auto& message : chat.messages()) {
+ *     renderer.render_text(cache, cen::utf8_view{message.text}, position);
+ *     position.set_y(position.y() + lineSkip);
+ *   }
+ * \endcode
+ *
+ * \details The glyphs are the same as the glyphs of the `unicode_string` returned by
+ * `to_unicode_string()`, i.e. code points outside of the Basic Multilingual Plane are
+ * iterated as UTF-16 surrogate pairs. Unlike `to_unicode_string()`, invalid sequences
+ * don't make the whole string invalid, instead every invalid byte is iterated as the
+ * replacement character, U+FFFD.
+ *
+ * \note The viewed string must outlive the view and its iterators.
+ *
+ * \see `to_unicode_string()`
+ *
+ * \since 6.4.0
+ */
+class utf8_view final
+{
+ public:
+  /// The glyph that is iterated instead of invalid bytes.
+  inline constexpr static unicode replacement = 0xFFFD;
+
+  /**
+   * \class iterator
+   *
+   * \brief A forward iterator that decodes a glyph from the viewed string at a time.
+   *
+   * \since 6.4.0
+   */
+  class iterator final
+  {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = unicode;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const unicode*;
+    using reference = unicode;
+
+    constexpr iterator() noexcept = default;
+
+    iterator(const u8* position, const u8* end) noexcept : m_position{position}, m_end{end}
+    {
+      decode();
+    }
+
+    [[nodiscard]] constexpr auto operator*() const noexcept -> unicode
+    {
+      return m_value;
+    }
+
+    auto operator++() noexcept -> iterator&
+    {
+      // The low surrogate of a pair is iterated before moving on to the next sequence
+      if (m_code >= 0x10000u && !m_low) {
+        m_low = true;
+        m_value = detail::low_surrogate(m_code);
+        return *this;
+      }
+
+      m_position += m_length;
+      m_low = false;
+      decode();
+
+      return *this;
+    }
+
+    auto operator++(int) noexcept -> iterator
+    {
+      auto copy = *this;
+      ++(*this);
+      return copy;
+    }
+
+    [[nodiscard]] constexpr auto operator==(const iterator& other) const noexcept -> bool
+    {
+      return m_position == other.m_position && m_low == other.m_low;
+    }
+
+    [[nodiscard]] constexpr auto operator!=(const iterator& other) const noexcept -> bool
+    {
+      return !(*this == other);
+    }
+
+   private:
+    const u8* m_position{};
+    const u8* m_end{};
+    u32 m_code{};
+    usize m_length{};
+    unicode m_value{};
+    bool m_low{};
+
+    void decode() noexcept
+    {
+      if (m_position == m_end) {
+        m_code = 0;
+        m_length = 0;
+        m_value = 0;
+        return;
+      }
+
+      // ASCII characters are by far the most common, so they avoid the full decoder
+      if (*m_position < 0x80u) {
+        m_code = *m_position;
+        m_length = 1;
+        m_value = static_cast<unicode>(m_code);
+        return;
+      }
+
+      const auto [code, length] =
+          detail::decode_utf8_sequence(m_position, static_cast<usize>(m_end - m_position));
+
+      if (length == 0) {
+        m_code = replacement;
+        m_length = 1;
+        m_value = replacement;
+      }
+      else {
+        m_code = code;
+        m_length = length;
+        m_value = (code >= 0x10000u) ? detail::high_surrogate(code)
+                                     : static_cast<unicode>(code);
+      }
+    }
+  };
+
+  using const_iterator = iterator;
+
+  /**
+   * \brief Creates a view of a UTF-8 string.
+   *
+   * \param str the UTF-8 encoded string, which must outlive the view.
+   *
+   * \since 6.4.0
+   */
+  constexpr explicit utf8_view(const std::string_view str) noexcept : m_str{str}
+  {}
+
+  /**
+   * \brief Returns an iterator to the first glyph.
+   *
+   * \return an iterator that points to the first glyph.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto begin() const noexcept -> iterator
+  {
+    return iterator{first(), last()};
+  }
+
+  /**
+   * \brief Returns an iterator one past the last glyph.
+   *
+   * \return an iterator that points one past the last glyph.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto end() const noexcept -> iterator
+  {
+    return iterator{last(), last()};
+  }
+
+  /**
+   * \brief Indicates whether or not the viewed string is empty.
+   *
+   * \return `true` if there are no glyphs; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool
+  {
+    return m_str.empty();
+  }
+
+  /**
+   * \brief Returns the viewed string.
+   *
+   * \return the UTF-8 encoded string.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] constexpr auto str() const noexcept -> std::string_view
+  {
+    return m_str;
+  }
+
+ private:
+  std::string_view m_str;
+
+  [[nodiscard]] auto first() const noexcept -> const u8*
+  {
+    return reinterpret_cast<const u8*>(m_str.data());
+  }
+
+  [[nodiscard]] auto last() const noexcept -> const u8*
+  {
+    return first() + m_str.size();
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_UTF8_VIEW_HEADER
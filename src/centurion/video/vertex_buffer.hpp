@@ -0,0 +1,361 @@
+#ifndef CENTURION_VERTEX_BUFFER_HEADER
+#define CENTURION_VERTEX_BUFFER_HEADER
+
+#include <SDL2/SDL.h>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+#include <cassert>  // assert
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \typedef vertex
+ *
+ * \brief A vertex with a position, a color and texture coordinates.
+ *
+ * \details The texture coordinates are normalized, i.e. in the range [0, 1].
+ *
+ * \since 6.4.0
+ */
+using vertex = SDL_Vertex;
+
+/**
+ * \brief Creates a vertex.
+ *
+ * \param position the position of the vertex.
+ * \param tint the color of the vertex, which modulates the texture.
+ * \param uv the normalized texture coordinates of the vertex.
+ *
+ * \return the created vertex.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] inline auto make_vertex(const fpoint position,
+                                      const color& tint = colors::white,
+                                      const fpoint uv = {}) noexcept -> vertex
+{
+  return {position.get(), tint.get(), uv.get()};
+}
+
+/**
+ * \struct strided_geometry
+ *
+ * \brief Describes vertices that are stored in separate, possibly interleaved, arrays.
+ *
+ * \details This is used with `basic_renderer::render_geometry_raw()`, which reads the
+ * vertex attributes directly from the arrays, without repacking them into `vertex`
+ * instances. The strides are the distances between consecutive attributes in bytes, so
+ * both tightly packed arrays (structure of arrays) and members of larger structures can
+ * be used. A color stride of zero uses the same color for all vertices.
+ * \code{cpp}
+ *   std::vector<cen::fpoint> positions = ...;
+ *   std::vector<cen::fpoint> uvs = ...;
+ *   std::vector<cen::u16> indices = ...;
+ *   const cen::color tint = cen::colors::white;
+ *
+ *   const auto geometry = cen::strided_geometry::from(positions.data(), &tint, uvs.data(),
+ *                                                     positions.size(), 0)
+ *                             .with_indices(indices.data(), indices.size());
+ *   renderer.render_geometry_raw(texture, geometry);
+ * \endcode
+ *
+ * \since 6.4.0
+ */
+struct strided_geometry final
+{
+  const float* positions{};   ///< The x- and y-coordinates of the first vertex.
+  int positionStride{};       ///< The distance between two positions, in bytes.
+  const SDL_Color* colors{};  ///< The color of the first vertex.
+  int colorStride{};          ///< The distance between two colors, in bytes.
+  const float* uvs{};         ///< The texture coordinates of the first vertex, may be null.
+  int uvStride{};             ///< The distance between two texture coordinates, in bytes.
+  int vertexCount{};          ///< The amount of vertices.
+  const void* indices{};      ///< The vertex indices, or null for unindexed triangles.
+  int indexCount{};           ///< The amount of indices.
+  int indexSize{};            ///< The size of an index, in bytes, i.e. 1, 2 or 4.
+
+  /**
+   * \brief Creates a description of vertices stored in arrays of points and colors.
+   *
+   * \param positions the positions of the vertices.
+   * \param colors the colors of the vertices.
+   * \param uvs the normalized texture coordinates of the vertices, may be null when
+   * rendering without a texture.
+   * \param count the amount of vertices.
+   * \param colorStride the distance between two colors, in bytes, zero uses the first
+   * color for all vertices.
+   *
+   * \return the geometry, without indices.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] static auto from(const fpoint* positions,
+                                 const color* colors,
+                                 const fpoint* uvs,
+                                 const usize count,
+                                 const int colorStride = sizeof(color)) noexcept
+      -> strided_geometry
+  {
+    static_assert(sizeof(color) == sizeof(SDL_Color));
+    static_assert(sizeof(fpoint) == sizeof(SDL_FPoint));
+    assert(positions);
+    assert(colors);
+
+    strided_geometry geometry;
+    geometry.positions = &positions->data()->x;
+    geometry.positionStride = sizeof(fpoint);
+    geometry.colors = colors->data();
+    geometry.colorStride = colorStride;
+    geometry.uvs = uvs ? &uvs->data()->x : nullptr;
+    geometry.uvStride = sizeof(fpoint);
+    geometry.vertexCount = static_cast<int>(count);
+    return geometry;
+  }
+
+  /**
+   * \brief Returns a copy of the geometry that uses the specified indices.
+   *
+   * \tparam Index the type of the indices, i.e. `u8`, `u16`, `u32` or `int`.
+   *
+   * \param data the vertex indices, three for each triangle.
+   * \param count the amount of indices.
+   *
+   * \return the indexed geometry.
+   *
+   * \since 6.4.0
+   */
+  template <typename Index>
+  [[nodiscard]] auto with_indices(const Index* data, const usize count) const noexcept
+      -> strided_geometry
+  {
+    static_assert(sizeof(Index) == 1 || sizeof(Index) == 2 || sizeof(Index) == 4,
+                  "Indices must be 1, 2 or 4 bytes!");
+
+    auto geometry = *this;
+    geometry.indices = data;
+    geometry.indexCount = static_cast<int>(count);
+    geometry.indexSize = static_cast<int>(sizeof(Index));
+    return geometry;
+  }
+
+  /**
+   * \brief Returns the amount of triangles described by the geometry.
+   *
+   * \return the number of triangles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto triangle_count() const noexcept -> usize
+  {
+    const auto count = indices ? indexCount : vertexCount;
+    return static_cast<usize>(count) / 3u;
+  }
+};
+
+/**
+ * \class vertex_buffer
+ *
+ * \brief A reusable buffer of vertices and indices, for textured or colored triangles.
+ *
+ * \details Unlike `geometry_batch`, which tessellates shapes, a vertex buffer stores
+ * triangles as they are supplied, e.g. by a custom batching scheme. The buffer is
+ * rendered with `basic_renderer::render_geometry()`, with a single `SDL_RenderGeometry`
+ * call. Clearing the buffer retains the capacity, so a buffer that is refilled every frame
+ * stops allocating memory after the first few frames.
+ * \code{cpp}
+ *   cen::vertex_buffer buffer;
+ *
+ *   // Every frame
+ *   buffer.clear();
+ *   for (const auto& sprite : sprites) {
+ *     buffer.add_quad(sprite.destination, sprite.source, sprite.tint);
+ *   }
+ *
+ *   renderer.render_geometry(sheet, buffer);
+ * \endcode
+ *
+ * \details Triangles are either described by indices, or, if no indices have been added,
+ * by consecutive triples of vertices.
+ *
+ * \see `geometry_batch`
+ * \see `vertex`
+ *
+ * \since 6.4.0
+ */
+class vertex_buffer final
+{
+ public:
+  /**
+   * \brief Adds a vertex to the buffer.
+   *
+   * \param position the position of the vertex.
+   * \param tint the color of the vertex.
+   * \param uv the normalized texture coordinates of the vertex.
+   *
+   * \return the index of the vertex, for use with `add_triangle()`.
+   *
+   * \since 6.4.0
+   */
+  auto add_vertex(const fpoint position,
+                  const color& tint = colors::white,
+                  const fpoint uv = {}) -> int
+  {
+    m_vertices.push_back(make_vertex(position, tint, uv));
+    return static_cast<int>(m_vertices.size() - 1u);
+  }
+
+  /**
+   * \brief Adds an array of vertices to the buffer.
+   *
+   * \param data the vertices that will be added.
+   * \param count the amount of vertices.
+   *
+   * \return the index of the first added vertex.
+   *
+   * \since 6.4.0
+   */
+  auto add_vertices(const vertex* data, const usize count) -> int
+  {
+    assert(data || count == 0);
+
+    const auto first = static_cast<int>(m_vertices.size());
+    m_vertices.insert(m_vertices.end(), data, data + count);
+    return first;
+  }
+
+  /**
+   * \brief Adds a triangle, that refers to previously added vertices.
+   *
+   * \param a the index of the first vertex.
+   * \param b the index of the second vertex.
+   * \param c the index of the third vertex.
+   *
+   * \since 6.4.0
+   */
+  void add_triangle(const int a, const int b, const int c)
+  {
+    assert(a >= 0 && b >= 0 && c >= 0);
+    m_indices.insert(m_indices.end(), {a, b, c});
+  }
+
+  /**
+   * \brief Adds an indexed quad, with four vertices and two triangles.
+   *
+   * \param destination the area covered by the quad.
+   * \param uv the normalized texture coordinates of the quad.
+   * \param tint the color of the quad.
+   *
+   * \since 6.4.0
+   */
+  void add_quad(const frect& destination,
+                const frect& uv = {0, 0, 1, 1},
+                const color& tint = colors::white)
+  {
+    const auto first = add_vertex({destination.x(), destination.y()}, tint, {uv.x(), uv.y()});
+    add_vertex({destination.max_x(), destination.y()}, tint, {uv.max_x(), uv.y()});
+    add_vertex({destination.max_x(), destination.max_y()}, tint, {uv.max_x(), uv.max_y()});
+    add_vertex({destination.x(), destination.max_y()}, tint, {uv.x(), uv.max_y()});
+
+    add_triangle(first, first + 1, first + 2);
+    add_triangle(first, first + 2, first + 3);
+  }
+
+  /**
+   * \brief Reserves memory for vertices and indices.
+   *
+   * \param vertices the amount of vertices to reserve memory for.
+   * \param indices the amount of indices to reserve memory for.
+   *
+   * \since 6.4.0
+   */
+  void reserve(const usize vertices, const usize indices)
+  {
+    m_vertices.reserve(vertices);
+    m_indices.reserve(indices);
+  }
+
+  /**
+   * \brief Removes all vertices and indices from the buffer.
+   *
+   * \details The capacity of the internal buffers is retained.
+   *
+   * \since 6.4.0
+   */
+  void clear() noexcept
+  {
+    m_vertices.clear();
+    m_indices.clear();
+  }
+
+  /**
+   * \brief Indicates whether or not the buffer contains any triangles.
+   *
+   * \return `true` if the buffer is empty; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return triangle_count() == 0;
+  }
+
+  /**
+   * \brief Returns the amount of triangles in the buffer.
+   *
+   * \return the number of triangles.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto triangle_count() const noexcept -> usize
+  {
+    return (m_indices.empty() ? m_vertices.size() : m_indices.size()) / 3u;
+  }
+
+  /**
+   * \brief Returns the vertices in the buffer.
+   *
+   * \return the vertices.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto vertices() const noexcept -> const std::vector<vertex>&
+  {
+    return m_vertices;
+  }
+
+  /**
+   * \brief Returns the indices in the buffer.
+   *
+   * \return the vertex indices, three for each triangle; empty if the vertices aren't
+   * indexed.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto indices() const noexcept -> const std::vector<int>&
+  {
+    return m_indices;
+  }
+
+ private:
+  std::vector<vertex> m_vertices;
+  std::vector<int> m_indices;
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+#endif  // CENTURION_VERTEX_BUFFER_HEADER
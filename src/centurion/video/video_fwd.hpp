@@ -0,0 +1,70 @@
+#ifndef CENTURION_VIDEO_FWD_HEADER
+#define CENTURION_VIDEO_FWD_HEADER
+
+#include "../detail/ownership_tags.hpp"
+
+/**
+ * \file video_fwd.hpp
+ *
+ * \brief Provides forward declarations of the video components.
+ *
+ * \details Include this header instead of the full headers in headers that only refer
+ * to these types by reference or pointer, the renderer header alone pulls in most of the
+ * video module.
+ */
+
+namespace cen {
+
+class color;
+class font;
+class font_cache;
+class font_pool;
+class message_box;
+class palette;
+class renderer_info;
+class rich_text;
+class text_batch;
+class text_layout;
+class texture_atlas;
+class unicode_string;
+class utf8_view;
+
+template <typename T>
+class basic_window;
+
+template <typename T>
+class basic_renderer;
+
+template <typename T>
+class basic_texture;
+
+template <typename T>
+class basic_surface;
+
+template <typename T>
+class basic_cursor;
+
+template <typename B>
+class basic_pixel_format_info;
+
+using window = basic_window<detail::owning_type>;
+using window_handle = basic_window<detail::handle_type>;
+
+using renderer = basic_renderer<detail::owning_type>;
+using renderer_handle = basic_renderer<detail::handle_type>;
+
+using texture = basic_texture<detail::owning_type>;
+using texture_handle = basic_texture<detail::handle_type>;
+
+using surface = basic_surface<detail::owning_type>;
+using surface_handle = basic_surface<detail::handle_type>;
+
+using cursor = basic_cursor<detail::owning_type>;
+using cursor_handle = basic_cursor<detail::handle_type>;
+
+using pixel_format_info = basic_pixel_format_info<detail::owning_type>;
+using pixel_format_info_handle = basic_pixel_format_info<detail::handle_type>;
+
+}  // namespace cen
+
+#endif  // CENTURION_VIDEO_FWD_HEADER
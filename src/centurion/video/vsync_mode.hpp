@@ -0,0 +1,95 @@
+#ifndef CENTURION_VSYNC_MODE_HEADER
+#define CENTURION_VSYNC_MODE_HEADER
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "../core/exception.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum vsync_mode
+ *
+ * \brief Represents different ways of synchronizing presentation with display refreshes.
+ *
+ * \details The values mirror the corresponding OpenGL swap intervals.
+ *
+ * \see `basic_renderer::set_vsync()`
+ * \see `gl_swap_interval`
+ *
+ * \since 6.4.0
+ */
+enum class vsync_mode
+{
+  off = 0,       ///< Present immediately, lowest latency but may tear.
+  on = 1,        ///< Wait for the next display refresh.
+  adaptive = -1  ///< Wait for the next refresh, unless the frame is late.
+};
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied VSync mode.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(vsync_mode::adaptive) == "adaptive"`.
+ *
+ * \param mode the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const vsync_mode mode) -> std::string_view
+{
+  switch (mode) {
+    case vsync_mode::off:
+      return "off";
+
+    case vsync_mode::on:
+      return "on";
+
+    case vsync_mode::adaptive:
+      return "adaptive";
+
+    default:
+      throw cen_error{"Did not recognize VSync mode!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a VSync mode enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param mode the enumerator that will be printed.
+ *
+ * \see `to_string(vsync_mode)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const vsync_mode mode) -> std::ostream&
+{
+  return stream << to_string(mode);
+}
+
+/// \} End of streaming
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_VSYNC_MODE_HEADER
@@ -70,21 +70,45 @@ auto create_surface(basic_window<T>& window,
 }
 
 /**
- * \brief Returns the extensions required to create a Vulkan surface.
+ * \brief Obtains the extensions required to create a Vulkan surface, reusing a buffer.
  *
- * \return the required Vulkan extensions; `std::nullopt` if something goes wrong.
+ * \details Unlike the overload that returns a vector, this function doesn't allocate if
+ * the buffer is already large enough, e.g. when it's reused for several instances.
  *
- * \since 6.0.0
+ * \param[out] names the buffer that will hold the names of the required extensions.
+ *
+ * \return `success` if the extensions were obtained; `failure` otherwise.
+ *
+ * \since 6.4.0
  */
-inline auto required_extensions() -> std::optional<std::vector<str>>
+inline auto required_extensions(std::vector<str>& names) -> result
 {
   uint count{};
   if (!SDL_Vulkan_GetInstanceExtensions(nullptr, &count, nullptr)) {
-    return std::nullopt;
+    return failure;
   }
 
-  std::vector<str> names(count);
+  names.resize(count);
   if (!SDL_Vulkan_GetInstanceExtensions(nullptr, &count, names.data())) {
+    names.clear();
+    return failure;
+  }
+
+  names.resize(count);
+  return success;
+}
+
+/**
+ * \brief Returns the extensions required to create a Vulkan surface.
+ *
+ * \return the required Vulkan extensions; `std::nullopt` if something goes wrong.
+ *
+ * \since 6.0.0
+ */
+inline auto required_extensions() -> std::optional<std::vector<str>>
+{
+  std::vector<str> names;
+  if (!required_extensions(names)) {
     return std::nullopt;
   }
 
@@ -0,0 +1,100 @@
+#ifndef CENTURION_VK_PRESENT_MODE_HEADER
+#define CENTURION_VK_PRESENT_MODE_HEADER
+
+#ifndef CENTURION_NO_VULKAN
+
+#include <ostream>      // ostream
+#include <string_view>  // string_view
+
+#include "../../core/exception.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum vk_present_mode
+ *
+ * \brief Provides identifiers for the Vulkan present modes, i.e. how swapchain images are
+ * queued for presentation.
+ *
+ * \details The values match the corresponding `VkPresentModeKHR` values.
+ *
+ * \since 6.4.0
+ */
+enum class vk_present_mode
+{
+  immediate = 0,    ///< No synchronization, lowest latency but may tear.
+  mailbox = 1,      ///< Synchronized, the newest queued image replaces older ones.
+  fifo = 2,         ///< Synchronized with a queue of images (VSync), always supported.
+  fifo_relaxed = 3  ///< Like `fifo`, but late images are presented immediately.
+};
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Returns a textual version of the supplied present mode.
+ *
+ * \details This function returns a string that mirrors the name of the enumerator, e.g.
+ * `to_string(vk_present_mode::mailbox) == "mailbox"`.
+ *
+ * \param mode the enumerator that will be converted.
+ *
+ * \return a string that mirrors the name of the enumerator.
+ *
+ * \throws cen_error if the enumerator is not recognized.
+ *
+ * \since 6.4.0
+ */
+[[nodiscard]] constexpr auto to_string(const vk_present_mode mode) -> std::string_view
+{
+  switch (mode) {
+    case vk_present_mode::immediate:
+      return "immediate";
+
+    case vk_present_mode::mailbox:
+      return "mailbox";
+
+    case vk_present_mode::fifo:
+      return "fifo";
+
+    case vk_present_mode::fifo_relaxed:
+      return "fifo_relaxed";
+
+    default:
+      throw cen_error{"Did not recognize Vulkan present mode!"};
+  }
+}
+
+/// \} End of string conversions
+
+/// \name Streaming
+/// \{
+
+/**
+ * \brief Prints a textual representation of a present mode enumerator.
+ *
+ * \param stream the output stream that will be used.
+ * \param mode the enumerator that will be printed.
+ *
+ * \see `to_string(vk_present_mode)`
+ *
+ * \return the used stream.
+ *
+ * \since 6.4.0
+ */
+inline auto operator<<(std::ostream& stream, const vk_present_mode mode) -> std::ostream&
+{
+  return stream << to_string(mode);
+}
+
+/// \} End of streaming
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_VULKAN
+#endif  // CENTURION_VK_PRESENT_MODE_HEADER
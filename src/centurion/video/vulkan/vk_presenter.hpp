@@ -0,0 +1,754 @@
+#ifndef CENTURION_VK_PRESENTER_HEADER
+#define CENTURION_VK_PRESENTER_HEADER
+
+#ifndef CENTURION_NO_VULKAN
+#ifdef __has_include
+#if __has_include(<vulkan/vulkan.h>)
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_vulkan.h>
+#include <vulkan/vulkan.h>
+
+#include <algorithm>  // find, find_if, max, min, clamp
+#include <cassert>    // assert
+#include <limits>     // numeric_limits
+#include <optional>   // optional, nullopt
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../../core/exception.hpp"
+#include "../../core/integers.hpp"
+#include "../../core/result.hpp"
+#include "../../core/to_underlying.hpp"
+#include "../../events/window_event.hpp"
+#include "../window.hpp"
+#include "vk_core.hpp"
+#include "vk_present_mode.hpp"
+
+namespace cen::vk {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct presenter_config
+ *
+ * \brief The swapchain settings used by a `presenter`.
+ *
+ * \since 6.4.0
+ */
+struct presenter_config final
+{
+  /// The preferred present mode, `vk_present_mode::fifo` is used if it's unsupported.
+  vk_present_mode presentMode{vk_present_mode::mailbox};
+
+  /// The amount of frames that may be recorded while the GPU processes previous frames.
+  u32 framesInFlight{2};
+
+  /// The preferred amount of swapchain images, clamped to the limits of the surface.
+  u32 imageCount{3};
+
+  /// The preferred image format, the first supported format is used if it's unsupported.
+  VkFormat format{VK_FORMAT_B8G8R8A8_SRGB};
+
+  /// The preferred color space of the image format.
+  VkColorSpaceKHR colorSpace{VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
+
+  /// The usage of the swapchain images.
+  VkImageUsageFlags imageUsage{VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT};
+
+  /// The queue families that access the images, only needed if there are several.
+  std::vector<u32> queueFamilies;
+};
+
+/**
+ * \struct presenter_frame
+ *
+ * \brief Provides the swapchain image and synchronization objects of a frame.
+ *
+ * \since 6.4.0
+ */
+struct presenter_frame final
+{
+  u32 imageIndex{};              ///< The index of the swapchain image.
+  VkImage image{};               ///< The swapchain image to render to.
+  VkImageView view{};            ///< A color view of the swapchain image.
+  VkSemaphore imageAvailable{};  ///< Must be waited on before writing to the image.
+  VkSemaphore renderFinished{};  ///< Must be signaled when rendering has finished.
+  VkFence inFlight{};            ///< Must be signaled by the last submission of the frame.
+};
+
+/**
+ * \class presenter
+ *
+ * \brief Manages a swapchain and the synchronization of frames in flight for a window.
+ *
+ * \details A presenter creates a swapchain for a Vulkan surface, and recreates it when
+ * the window is resized or the swapchain becomes outdated. It owns a set of semaphores
+ * and fences for each frame in flight, so the CPU can record a frame while the GPU
+ * renders the previous ones, without reusing resources that are still in use.
+ * \code{cpp}
+ *   cen::vk::presenter presenter{window, instance, physicalDevice, device, queue, surface};
+ *
+ *   // In the event loop
+ *   presenter.handle(windowEvent);
+ *
+ *   // Each frame
+ *   if (const auto frame = presenter.begin_frame()) {
+ *     record(commands[frame->imageIndex], frame->view);
+ *
+ *     VkSubmitInfo submit{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+ *     // ... wait on frame->imageAvailable, signal frame->renderFinished
+ *     vkQueueSubmit(queue, 1, &submit, frame->inFlight);
+ *
+ *     presenter.present(*frame);
+ *   }
+ * \endcode
+ *
+ * \details The present mode is the main latency setting: `mailbox` and `immediate`
+ * minimize latency, `fifo` is VSync and always supported, and `fifo_relaxed` avoids
+ * stutter when a frame is late. Unsupported modes fall back to `fifo`.
+ *
+ * \note All Vulkan functions are loaded through `get_instance_proc_addr()`, so the
+ * application doesn't have to link against the Vulkan loader. The window, the device and
+ * the surface must outlive the presenter, which doesn't destroy the surface.
+ *
+ * \note This header is only available if the Vulkan headers can be found.
+ *
+ * \see `presenter_config`
+ * \see `vk_present_mode`
+ *
+ * \since 6.4.0
+ */
+class presenter final
+{
+ public:
+  /**
+   * \brief Creates a swapchain, and the synchronization objects for the frames in flight.
+   *
+   * \pre `window` must be a Vulkan window.
+   *
+   * \tparam T the ownership semantics of the window.
+   *
+   * \param window the window that the surface was created for.
+   * \param instance the Vulkan instance.
+   * \param physicalDevice the physical device of the logical device.
+   * \param device the logical device, with the `VK_KHR_swapchain` extension enabled.
+   * \param queue a queue that supports presentation to the surface.
+   * \param surface the surface, see `create_surface()`.
+   * \param config the swapchain settings.
+   *
+   * \throws cen_error if a Vulkan function cannot be loaded, or if the swapchain or the
+   * synchronization objects cannot be created.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  presenter(const basic_window<T>& window,
+            VkInstance instance,
+            VkPhysicalDevice physicalDevice,
+            VkDevice device,
+            VkQueue queue,
+            VkSurfaceKHR surface,
+            presenter_config config = {})
+      : m_window{window.get()}
+      , m_physicalDevice{physicalDevice}
+      , m_device{device}
+      , m_queue{queue}
+      , m_surface{surface}
+      , m_config{std::move(config)}
+  {
+    assert(window.is_vulkan());
+    assert(m_config.framesInFlight > 0);
+
+    load_functions(instance);
+
+    try {
+      create_frames();
+      m_outdated = !recreate();
+    }
+    catch (...) {
+      destroy();
+      throw;
+    }
+  }
+
+  presenter(const presenter&) = delete;
+  presenter(presenter&&) = delete;
+
+  auto operator=(const presenter&) -> presenter& = delete;
+  auto operator=(presenter&&) -> presenter& = delete;
+
+  /**
+   * \brief Waits until the device is idle, and destroys the swapchain.
+   *
+   * \since 6.4.0
+   */
+  ~presenter() noexcept
+  {
+    destroy();
+  }
+
+  /**
+   * \brief Acquires the swapchain image for the next frame.
+   *
+   * \details This function waits until the frame that previously used the same
+   * synchronization objects has finished, and recreates the swapchain first if it's
+   * outdated. The fence of the returned frame is reset, so it must be signaled by a queue
+   * submission before the frame is presented.
+   *
+   * \return the frame to render; an empty optional if the window is minimized, or the
+   * swapchain had to be recreated.
+   *
+   * \throws cen_error if the swapchain cannot be recreated.
+   *
+   * \since 6.4.0
+   */
+  auto begin_frame() -> std::optional<presenter_frame>
+  {
+    if (m_outdated && !recreate()) {
+      return std::nullopt;
+    }
+
+    const auto& sync = m_frames[m_frame];
+    m_api.waitForFences(m_device, 1, &sync.inFlight, VK_TRUE, no_timeout);
+
+    u32 index{};
+    const auto acquired = m_api.acquireNextImage(m_device,
+                                                 m_swapchain,
+                                                 no_timeout,
+                                                 sync.imageAvailable,
+                                                 VK_NULL_HANDLE,
+                                                 &index);
+    if (acquired == VK_ERROR_OUT_OF_DATE_KHR) {
+      m_outdated = true;
+      return std::nullopt;
+    }
+    else if (acquired == VK_SUBOPTIMAL_KHR) {
+      m_outdated = true;  // Still usable, recreated before the next frame
+    }
+    else if (acquired != VK_SUCCESS) {
+      return std::nullopt;
+    }
+
+    // The image may still be used by a frame that was acquired out of order
+    if (auto& previous = m_imagesInFlight[index]; previous != VK_NULL_HANDLE) {
+      m_api.waitForFences(m_device, 1, &previous, VK_TRUE, no_timeout);
+    }
+
+    m_imagesInFlight[index] = sync.inFlight;
+    m_api.resetFences(m_device, 1, &sync.inFlight);
+
+    return presenter_frame{index,
+                           m_images[index],
+                           m_views[index],
+                           sync.imageAvailable,
+                           m_renderFinished[index],
+                           sync.inFlight};
+  }
+
+  /**
+   * \brief Queues the image of a frame for presentation.
+   *
+   * \details The presentation waits for the `renderFinished` semaphore of the frame.
+   *
+   * \param frame the frame returned by the most recent `begin_frame()` call.
+   *
+   * \return `success` if the image was queued; `failure` otherwise.
+   *
+   * \since 6.4.0
+   */
+  auto present(const presenter_frame& frame) -> result
+  {
+    VkPresentInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    info.waitSemaphoreCount = 1;
+    info.pWaitSemaphores = &frame.renderFinished;
+    info.swapchainCount = 1;
+    info.pSwapchains = &m_swapchain;
+    info.pImageIndices = &frame.imageIndex;
+
+    const auto presented = m_api.queuePresent(m_queue, &info);
+    m_frame = (m_frame + 1) % static_cast<u32>(m_frames.size());
+
+    if (presented == VK_ERROR_OUT_OF_DATE_KHR || presented == VK_SUBOPTIMAL_KHR) {
+      m_outdated = true;
+    }
+
+    return presented == VK_SUCCESS || presented == VK_SUBOPTIMAL_KHR;
+  }
+
+  /**
+   * \brief Handles a window event, the swapchain is recreated if the window was resized.
+   *
+   * \param event the window event.
+   *
+   * \since 6.4.0
+   */
+  void handle(const window_event& event) noexcept
+  {
+    const auto id = event.event_id();
+    if (id == window_event_id::resized || id == window_event_id::size_changed) {
+      m_outdated = true;
+    }
+  }
+
+  /**
+   * \brief Forces the swapchain to be recreated before the next frame.
+   *
+   * \since 6.4.0
+   */
+  void invalidate() noexcept
+  {
+    m_outdated = true;
+  }
+
+  /**
+   * \brief Changes the preferred present mode, which recreates the swapchain.
+   *
+   * \param mode the preferred present mode.
+   *
+   * \since 6.4.0
+   */
+  void set_present_mode(const vk_present_mode mode) noexcept
+  {
+    if (mode != m_config.presentMode) {
+      m_config.presentMode = mode;
+      m_outdated = true;
+    }
+  }
+
+  /**
+   * \brief Returns the present mode that is used by the swapchain.
+   *
+   * \return the active present mode, which may differ from the preferred one.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto present_mode() const noexcept -> vk_present_mode
+  {
+    return m_presentMode;
+  }
+
+  /**
+   * \brief Returns the size of the swapchain images.
+   *
+   * \return the swapchain extent.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto extent() const noexcept -> VkExtent2D
+  {
+    return m_extent;
+  }
+
+  /**
+   * \brief Returns the format of the swapchain images.
+   *
+   * \return the surface format.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto format() const noexcept -> VkSurfaceFormatKHR
+  {
+    return m_format;
+  }
+
+  /**
+   * \brief Returns the swapchain images.
+   *
+   * \return the swapchain images, indexed by `presenter_frame::imageIndex`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto images() const noexcept -> const std::vector<VkImage>&
+  {
+    return m_images;
+  }
+
+  /**
+   * \brief Returns the views of the swapchain images.
+   *
+   * \return the image views, indexed by `presenter_frame::imageIndex`.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto views() const noexcept -> const std::vector<VkImageView>&
+  {
+    return m_views;
+  }
+
+  /**
+   * \brief Returns the amount of frames in flight.
+   *
+   * \return the amount of frames that may be processed concurrently.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto frames_in_flight() const noexcept -> u32
+  {
+    return static_cast<u32>(m_frames.size());
+  }
+
+  /**
+   * \brief Returns the amount of times that the swapchain has been (re)created.
+   *
+   * \details This can be used to detect when resources that depend on the swapchain, e.g.
+   * framebuffers, must be recreated.
+   *
+   * \return the swapchain generation.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto generation() const noexcept -> u64
+  {
+    return m_generation;
+  }
+
+  /**
+   * \brief Returns the swapchain.
+   *
+   * \return the swapchain handle; null if the window has been minimized since creation.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto get() const noexcept -> VkSwapchainKHR
+  {
+    return m_swapchain;
+  }
+
+ private:
+  struct functions final
+  {
+    PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR getSurfaceCapabilities{};
+    PFN_vkGetPhysicalDeviceSurfaceFormatsKHR getSurfaceFormats{};
+    PFN_vkGetPhysicalDeviceSurfacePresentModesKHR getPresentModes{};
+    PFN_vkCreateSwapchainKHR createSwapchain{};
+    PFN_vkDestroySwapchainKHR destroySwapchain{};
+    PFN_vkGetSwapchainImagesKHR getSwapchainImages{};
+    PFN_vkAcquireNextImageKHR acquireNextImage{};
+    PFN_vkQueuePresentKHR queuePresent{};
+    PFN_vkCreateImageView createImageView{};
+    PFN_vkDestroyImageView destroyImageView{};
+    PFN_vkCreateSemaphore createSemaphore{};
+    PFN_vkDestroySemaphore destroySemaphore{};
+    PFN_vkCreateFence createFence{};
+    PFN_vkDestroyFence destroyFence{};
+    PFN_vkWaitForFences waitForFences{};
+    PFN_vkResetFences resetFences{};
+    PFN_vkDeviceWaitIdle deviceWaitIdle{};
+  };
+
+  struct frame_sync final
+  {
+    VkSemaphore imageAvailable{};
+    VkFence inFlight{};
+  };
+
+  inline constexpr static u64 no_timeout = std::numeric_limits<u64>::max();
+
+  SDL_Window* m_window{};
+  VkPhysicalDevice m_physicalDevice{};
+  VkDevice m_device{};
+  VkQueue m_queue{};
+  VkSurfaceKHR m_surface{};
+  presenter_config m_config;
+  functions m_api;
+
+  VkSwapchainKHR m_swapchain{VK_NULL_HANDLE};
+  VkExtent2D m_extent{};
+  VkSurfaceFormatKHR m_format{};
+  vk_present_mode m_presentMode{vk_present_mode::fifo};
+  std::vector<VkImage> m_images;
+  std::vector<VkImageView> m_views;
+  std::vector<VkSemaphore> m_renderFinished;  ///< One per image, in use until presented.
+  std::vector<VkFence> m_imagesInFlight;      ///< Non-owning, the fence of each image.
+  std::vector<frame_sync> m_frames;
+  u32 m_frame{};
+  u64 m_generation{};
+  bool m_outdated{};
+
+  template <typename Function, typename Loader, typename Handle>
+  static void load(Function& function, Loader loader, Handle handle, const char* name)
+  {
+    function = reinterpret_cast<Function>(loader(handle, name));
+    if (!function) {
+      throw cen_error{"Failed to load Vulkan function!"};
+    }
+  }
+
+  void load_functions(VkInstance instance)
+  {
+    const auto getInstanceProc =
+        reinterpret_cast<PFN_vkGetInstanceProcAddr>(get_instance_proc_addr());
+    if (!getInstanceProc) {
+      throw cen_error{"Failed to load Vulkan function!"};
+    }
+
+    PFN_vkGetDeviceProcAddr getDeviceProc{};
+    load(getDeviceProc, getInstanceProc, instance, "vkGetDeviceProcAddr");
+
+    load(m_api.getSurfaceCapabilities,
+         getInstanceProc,
+         instance,
+         "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    load(m_api.getSurfaceFormats,
+         getInstanceProc,
+         instance,
+         "vkGetPhysicalDeviceSurfaceFormatsKHR");
+    load(m_api.getPresentModes,
+         getInstanceProc,
+         instance,
+         "vkGetPhysicalDeviceSurfacePresentModesKHR");
+
+    load(m_api.createSwapchain, getDeviceProc, m_device, "vkCreateSwapchainKHR");
+    load(m_api.destroySwapchain, getDeviceProc, m_device, "vkDestroySwapchainKHR");
+    load(m_api.getSwapchainImages, getDeviceProc, m_device, "vkGetSwapchainImagesKHR");
+    load(m_api.acquireNextImage, getDeviceProc, m_device, "vkAcquireNextImageKHR");
+    load(m_api.queuePresent, getDeviceProc, m_device, "vkQueuePresentKHR");
+    load(m_api.createImageView, getDeviceProc, m_device, "vkCreateImageView");
+    load(m_api.destroyImageView, getDeviceProc, m_device, "vkDestroyImageView");
+    load(m_api.createSemaphore, getDeviceProc, m_device, "vkCreateSemaphore");
+    load(m_api.destroySemaphore, getDeviceProc, m_device, "vkDestroySemaphore");
+    load(m_api.createFence, getDeviceProc, m_device, "vkCreateFence");
+    load(m_api.destroyFence, getDeviceProc, m_device, "vkDestroyFence");
+    load(m_api.waitForFences, getDeviceProc, m_device, "vkWaitForFences");
+    load(m_api.resetFences, getDeviceProc, m_device, "vkResetFences");
+    load(m_api.deviceWaitIdle, getDeviceProc, m_device, "vkDeviceWaitIdle");
+  }
+
+  [[nodiscard]] auto make_semaphore() const -> VkSemaphore
+  {
+    VkSemaphoreCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+    VkSemaphore semaphore{};
+    if (m_api.createSemaphore(m_device, &info, nullptr, &semaphore) != VK_SUCCESS) {
+      throw cen_error{"Failed to create Vulkan semaphore!"};
+    }
+
+    return semaphore;
+  }
+
+  void create_frames()
+  {
+    m_frames.reserve(m_config.framesInFlight);
+
+    for (u32 index = 0; index < m_config.framesInFlight; ++index) {
+      auto& sync = m_frames.emplace_back();
+      sync.imageAvailable = make_semaphore();
+
+      // Signaled, so that the first wait for each frame returns immediately
+      VkFenceCreateInfo info{};
+      info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+      info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+      if (m_api.createFence(m_device, &info, nullptr, &sync.inFlight) != VK_SUCCESS) {
+        throw cen_error{"Failed to create Vulkan fence!"};
+      }
+    }
+  }
+
+  [[nodiscard]] auto choose_format() const -> VkSurfaceFormatKHR
+  {
+    u32 count{};
+    m_api.getSurfaceFormats(m_physicalDevice, m_surface, &count, nullptr);
+
+    std::vector<VkSurfaceFormatKHR> formats(count);
+    m_api.getSurfaceFormats(m_physicalDevice, m_surface, &count, formats.data());
+
+    if (formats.empty()) {
+      throw cen_error{"Vulkan surface has no formats!"};
+    }
+
+    const auto match = std::find_if(formats.begin(), formats.end(), [this](const auto& f) {
+      return f.format == m_config.format && f.colorSpace == m_config.colorSpace;
+    });
+
+    return (match != formats.end()) ? *match : formats.front();
+  }
+
+  [[nodiscard]] auto choose_present_mode() const -> vk_present_mode
+  {
+    u32 count{};
+    m_api.getPresentModes(m_physicalDevice, m_surface, &count, nullptr);
+
+    std::vector<VkPresentModeKHR> modes(count);
+    m_api.getPresentModes(m_physicalDevice, m_surface, &count, modes.data());
+
+    const auto preferred = static_cast<VkPresentModeKHR>(to_underlying(m_config.presentMode));
+    if (std::find(modes.begin(), modes.end(), preferred) != modes.end()) {
+      return m_config.presentMode;
+    }
+
+    return vk_present_mode::fifo;  // Always supported
+  }
+
+  [[nodiscard]] auto choose_extent(const VkSurfaceCapabilitiesKHR& caps) const -> VkExtent2D
+  {
+    if (caps.currentExtent.width != std::numeric_limits<u32>::max()) {
+      return caps.currentExtent;
+    }
+
+    int width{};
+    int height{};
+    SDL_Vulkan_GetDrawableSize(m_window, &width, &height);
+
+    VkExtent2D extent;
+    extent.width = std::clamp(static_cast<u32>(width),
+                              caps.minImageExtent.width,
+                              caps.maxImageExtent.width);
+    extent.height = std::clamp(static_cast<u32>(height),
+                               caps.minImageExtent.height,
+                               caps.maxImageExtent.height);
+    return extent;
+  }
+
+  /// Returns false if the swapchain cannot be created, because the window is minimized.
+  auto recreate() -> bool
+  {
+    VkSurfaceCapabilitiesKHR caps{};
+    if (m_api.getSurfaceCapabilities(m_physicalDevice, m_surface, &caps) != VK_SUCCESS) {
+      throw cen_error{"Failed to query Vulkan surface capabilities!"};
+    }
+
+    const auto extent = choose_extent(caps);
+    if (extent.width == 0 || extent.height == 0) {
+      return false;
+    }
+
+    m_api.deviceWaitIdle(m_device);
+
+    m_format = choose_format();
+    m_presentMode = choose_present_mode();
+    m_extent = extent;
+
+    auto imageCount = std::max(m_config.imageCount, caps.minImageCount);
+    if (caps.maxImageCount != 0) {
+      imageCount = std::min(imageCount, caps.maxImageCount);
+    }
+
+    VkSwapchainCreateInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+    info.surface = m_surface;
+    info.minImageCount = imageCount;
+    info.imageFormat = m_format.format;
+    info.imageColorSpace = m_format.colorSpace;
+    info.imageExtent = m_extent;
+    info.imageArrayLayers = 1;
+    info.imageUsage = m_config.imageUsage;
+    info.preTransform = caps.currentTransform;
+    info.presentMode = static_cast<VkPresentModeKHR>(to_underlying(m_presentMode));
+    info.clipped = VK_TRUE;
+    info.oldSwapchain = m_swapchain;
+
+    if (m_config.queueFamilies.size() > 1) {
+      info.imageSharingMode = VK_SHARING_MODE_CONCURRENT;
+      info.queueFamilyIndexCount = static_cast<u32>(m_config.queueFamilies.size());
+      info.pQueueFamilyIndices = m_config.queueFamilies.data();
+    }
+    else {
+      info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    }
+
+    info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    if (!(caps.supportedCompositeAlpha & VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR)) {
+      // Use the lowest supported bit, e.g. inherit on some window systems
+      const auto supported = caps.supportedCompositeAlpha;
+      const auto lowest = supported & (~supported + 1u);
+      info.compositeAlpha = static_cast<VkCompositeAlphaFlagBitsKHR>(lowest);
+    }
+
+    VkSwapchainKHR swapchain{};
+    const auto created = m_api.createSwapchain(m_device, &info, nullptr, &swapchain);
+
+    destroy_swapchain();  // The old swapchain is retired either way
+    if (created != VK_SUCCESS) {
+      throw cen_error{"Failed to create Vulkan swapchain!"};
+    }
+
+    m_swapchain = swapchain;
+    create_images();
+
+    ++m_generation;
+    m_outdated = false;
+
+    return true;
+  }
+
+  void create_images()
+  {
+    u32 count{};
+    m_api.getSwapchainImages(m_device, m_swapchain, &count, nullptr);
+
+    m_images.resize(count);
+    m_api.getSwapchainImages(m_device, m_swapchain, &count, m_images.data());
+
+    m_views.reserve(count);
+    m_renderFinished.reserve(count);
+    m_imagesInFlight.assign(count, VK_NULL_HANDLE);
+
+    for (const auto image : m_images) {
+      VkImageViewCreateInfo info{};
+      info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+      info.image = image;
+      info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+      info.format = m_format.format;
+      info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+      info.subresourceRange.levelCount = 1;
+      info.subresourceRange.layerCount = 1;
+
+      VkImageView view{};
+      if (m_api.createImageView(m_device, &info, nullptr, &view) != VK_SUCCESS) {
+        throw cen_error{"Failed to create Vulkan image view!"};
+      }
+
+      m_views.push_back(view);
+      m_renderFinished.push_back(make_semaphore());
+    }
+  }
+
+  void destroy_swapchain() noexcept
+  {
+    for (const auto view : m_views) {
+      m_api.destroyImageView(m_device, view, nullptr);
+    }
+
+    for (const auto semaphore : m_renderFinished) {
+      m_api.destroySemaphore(m_device, semaphore, nullptr);
+    }
+
+    m_views.clear();
+    m_renderFinished.clear();
+    m_imagesInFlight.clear();
+    m_images.clear();
+
+    if (m_swapchain != VK_NULL_HANDLE) {
+      m_api.destroySwapchain(m_device, m_swapchain, nullptr);
+      m_swapchain = VK_NULL_HANDLE;
+    }
+  }
+
+  void destroy() noexcept
+  {
+    m_api.deviceWaitIdle(m_device);
+
+    destroy_swapchain();
+
+    for (const auto& sync : m_frames) {
+      m_api.destroySemaphore(m_device, sync.imageAvailable, nullptr);
+      m_api.destroyFence(m_device, sync.inFlight, nullptr);
+    }
+
+    m_frames.clear();
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen::vk
+
+#endif  // __has_include(<vulkan/vulkan.h>)
+#endif  // __has_include
+#endif  // CENTURION_NO_VULKAN
+#endif  // CENTURION_VK_PRESENTER_HEADER
@@ -9,6 +9,7 @@
 #include <string>    // string, to_string
 
 #include "../compiler/features.hpp"
+#include "../compiler/linkage.hpp"
 
 #if CENTURION_HAS_FEATURE_FORMAT
 
@@ -29,6 +30,7 @@
 #include "../detail/owner_handle_api.hpp"
 #include "../math/area.hpp"
 #include "../math/rect.hpp"
+#include "../system/startup_tracer.hpp"
 #include "flash_op.hpp"
 #include "pixel_format.hpp"
 #include "surface.hpp"
@@ -169,6 +171,12 @@ class basic_window final
                         const iarea size = default_size(),
                         const u32 flags = default_flags())
   {
+#if CENTURION_HAS_FEATURE_HEADLESS
+    static_assert(!detail::is_owning<TT>(), "Windows are not available in headless builds!");
+#endif  // CENTURION_HAS_FEATURE_HEADLESS
+
+    const startup_scope trace{"window"};
+
     assert(title);
 
     if (size.width < 1) {
@@ -1396,6 +1404,13 @@ auto operator<<(std::ostream& stream, const basic_window<T>& window) -> std::ost
 
 /// \} End of streaming
 
+#if CENTURION_EXTERN_TEMPLATES
+
+extern template class CENTURION_API basic_window<detail::owning_type>;
+extern template class CENTURION_API basic_window<detail::handle_type>;
+
+#endif  // CENTURION_EXTERN_TEMPLATES
+
 /// \} End of group video
 
 }  // namespace cen
@@ -0,0 +1,377 @@
+#ifndef CENTURION_WINDOW_STATE_HEADER
+#define CENTURION_WINDOW_STATE_HEADER
+
+#include <SDL2/SDL.h>
+
+#include <cassert>   // assert
+#include <optional>  // optional, nullopt
+
+#include "../core/integers.hpp"
+#include "../events/display_event.hpp"
+#include "../events/window_event.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "screen.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class window_state
+ *
+ * \brief A snapshot of the properties of a window and its display, which is kept up to
+ * date with window and display events.
+ *
+ * \details Functions such as `basic_window::size()` and `screen::dpi()` query SDL, and
+ * possibly the windowing system, on every call. A window state queries all properties
+ * once, and then only updates the properties that are affected by each event, so code
+ * that reads the properties many times per frame, e.g. layout code, only reads cached
+ * values.
+ * \code{cpp}
+ *   cen::window_state state{window};
+ *
+ *   dispatcher.bind<cen::window_event>().to([&](const cen::window_event& event) {
+ *     state.handle(event);
+ *   });
+ *
+ *   dispatcher.bind<cen::display_event>().to([&](const cen::display_event& event) {
+ *     state.handle(event);
+ *   });
+ *
+ *   // Every frame
+ *   layout.update(state.size(), state.dpi());
+ * \endcode
+ *
+ * \details Events for other windows are ignored. Changes that aren't reported with events,
+ * e.g. a new title or changes made by the application itself through the window, are not
+ * tracked, so call `refresh()` after such changes.
+ *
+ * \note The window must outlive the window state.
+ *
+ * \see `basic_window`
+ * \see `screen::dpi()`
+ * \see `screen::refresh_rate()`
+ *
+ * \since 6.4.0
+ */
+class window_state final
+{
+ public:
+  /**
+   * \brief Creates a snapshot of the current properties of a window.
+   *
+   * \tparam T the ownership semantics of the window.
+   *
+   * \param window the window that will be tracked.
+   *
+   * \since 6.4.0
+   */
+  template <typename T>
+  explicit window_state(const basic_window<T>& window) noexcept : m_window{window.get()}
+  {
+    assert(m_window);
+    refresh();
+  }
+
+  /**
+   * \brief Queries all properties of the window and its display again.
+   *
+   * \since 6.4.0
+   */
+  void refresh() noexcept
+  {
+    int x{};
+    int y{};
+    SDL_GetWindowPosition(m_window, &x, &y);
+    m_position = {x, y};
+
+    SDL_GetWindowSize(m_window, &m_size.width, &m_size.height);
+    m_flags = SDL_GetWindowFlags(m_window);
+    refresh_display();
+  }
+
+  /**
+   * \brief Updates the snapshot in response to a window event.
+   *
+   * \details Events for other windows are ignored.
+   *
+   * \param event the window event.
+   *
+   * \since 6.4.0
+   */
+  void handle(const window_event& event) noexcept
+  {
+    if (event.get().windowID != SDL_GetWindowID(m_window)) {
+      return;
+    }
+
+    switch (event.event_id()) {
+      case window_event_id::moved:
+        m_position = {event.data_1(), event.data_2()};
+
+        // The window might have moved to another display
+        if (SDL_GetWindowDisplayIndex(m_window) != m_displayIndex.value_or(-1)) {
+          refresh_display();
+        }
+
+        m_flags = SDL_GetWindowFlags(m_window);
+        break;
+
+      case window_event_id::size_changed:
+      case window_event_id::resized:
+        m_size = {event.data_1(), event.data_2()};
+
+        // Fullscreen toggles are only reported as size changes
+        m_flags = SDL_GetWindowFlags(m_window);
+        break;
+
+      case window_event_id::shown:
+      case window_event_id::hidden:
+      case window_event_id::minimized:
+      case window_event_id::maximized:
+      case window_event_id::restored:
+      case window_event_id::enter:
+      case window_event_id::leave:
+      case window_event_id::focus_gained:
+      case window_event_id::focus_lost:
+        m_flags = SDL_GetWindowFlags(m_window);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+  /**
+   * \brief Updates the display properties in response to a display event.
+   *
+   * \details The display properties are queried again if a display was connected or
+   * disconnected, or if the display of the window changed orientation.
+   *
+   * \param event the display event.
+   *
+   * \since 6.4.0
+   */
+  void handle(const display_event& event) noexcept
+  {
+    const auto& data = event.get();
+    const auto id = static_cast<display_event_id>(data.event);
+
+    if (id == display_event_id::connected || id == display_event_id::disconnected ||
+        static_cast<int>(data.display) == m_displayIndex.value_or(-1)) {
+      refresh_display();
+    }
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+  /**
+   * \brief Returns the cached position of the window.
+   *
+   * \return the window position.
+   *
+   * \see `basic_window::position()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto position() const noexcept -> ipoint
+  {
+    return m_position;
+  }
+
+  /**
+   * \brief Returns the cached size of the window.
+   *
+   * \return the window size.
+   *
+   * \see `basic_window::size()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the cached bounds of the window, in screen coordinates.
+   *
+   * \return the window bounds.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto bounds() const noexcept -> irect
+  {
+    return {m_position, m_size};
+  }
+
+  /**
+   * \brief Returns the cached window flags.
+   *
+   * \return a mask of `SDL_WindowFlags` values.
+   *
+   * \see `basic_window::flags()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto flags() const noexcept -> u32
+  {
+    return m_flags;
+  }
+
+  /**
+   * \brief Indicates whether or not a cached window flag is set.
+   *
+   * \param flag the flag that will be tested.
+   *
+   * \return `true` if the flag is set; `false` otherwise.
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto check_flag(const SDL_WindowFlags flag) const noexcept -> bool
+  {
+    return (m_flags & flag) == static_cast<u32>(flag);
+  }
+
+  /// \copydoc basic_window::is_fullscreen()
+  [[nodiscard]] auto is_fullscreen() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_FULLSCREEN);
+  }
+
+  /// \copydoc basic_window::is_fullscreen_desktop()
+  [[nodiscard]] auto is_fullscreen_desktop() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_FULLSCREEN_DESKTOP);
+  }
+
+  /// \copydoc basic_window::is_visible()
+  [[nodiscard]] auto is_visible() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_SHOWN);
+  }
+
+  /// \copydoc basic_window::is_hidden()
+  [[nodiscard]] auto is_hidden() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_HIDDEN);
+  }
+
+  /// \copydoc basic_window::is_minimized()
+  [[nodiscard]] auto is_minimized() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_MINIMIZED);
+  }
+
+  /// \copydoc basic_window::is_maximized()
+  [[nodiscard]] auto is_maximized() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_MAXIMIZED);
+  }
+
+  /// \copydoc basic_window::has_input_focus()
+  [[nodiscard]] auto has_input_focus() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_INPUT_FOCUS);
+  }
+
+  /// \copydoc basic_window::has_mouse_focus()
+  [[nodiscard]] auto has_mouse_focus() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_MOUSE_FOCUS);
+  }
+
+  /**
+   * \brief Returns the cached index of the display that the window is on.
+   *
+   * \return the display index; `std::nullopt` if it couldn't be obtained.
+   *
+   * \see `basic_window::display_index()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto display_index() const noexcept -> const std::optional<int>&
+  {
+    return m_displayIndex;
+  }
+
+  /**
+   * \brief Returns the cached DPI of the display that the window is on.
+   *
+   * \return the display DPI; `std::nullopt` if it couldn't be obtained.
+   *
+   * \see `screen::dpi()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto dpi() const noexcept -> const std::optional<dpi_info>&
+  {
+    return m_dpi;
+  }
+
+  /**
+   * \brief Returns the cached refresh rate of the display that the window is on.
+   *
+   * \return the refresh rate; `std::nullopt` if it couldn't be obtained.
+   *
+   * \see `screen::refresh_rate()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto refresh_rate() const noexcept -> const std::optional<int>&
+  {
+    return m_refreshRate;
+  }
+
+  /**
+   * \brief Returns the cached bounds of the display that the window is on.
+   *
+   * \return the display bounds; `std::nullopt` if they couldn't be obtained.
+   *
+   * \see `screen::bounds()`
+   *
+   * \since 6.4.0
+   */
+  [[nodiscard]] auto display_bounds() const noexcept -> const std::optional<irect>&
+  {
+    return m_displayBounds;
+  }
+
+ private:
+  SDL_Window* m_window{};
+  ipoint m_position;
+  iarea m_size;
+  u32 m_flags{};
+  std::optional<int> m_displayIndex;
+  std::optional<dpi_info> m_dpi;
+  std::optional<int> m_refreshRate;
+  std::optional<irect> m_displayBounds;
+
+  void refresh_display() noexcept
+  {
+    const auto index = SDL_GetWindowDisplayIndex(m_window);
+    if (index < 0) {
+      m_displayIndex.reset();
+      m_dpi.reset();
+      m_refreshRate.reset();
+      m_displayBounds.reset();
+      return;
+    }
+
+    m_displayIndex = index;
+    m_dpi = screen::dpi(index);
+    m_refreshRate = screen::refresh_rate(index);
+    m_displayBounds = screen::bounds(index);
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_WINDOW_STATE_HEADER
@@ -0,0 +1,47 @@
+#ifndef CENTURION_BENCHMARK_CONTEXT_HEADER
+#define CENTURION_BENCHMARK_CONTEXT_HEADER
+
+#include <memory>  // unique_ptr, make_unique
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+namespace cen::bench {
+
+// Lazily creates the window and software renderer shared by all benchmarks, so that the
+// benchmarks can run headless with the dummy or offscreen video drivers
+class benchmark_context final
+{
+ public:
+  [[nodiscard]] static auto get() -> benchmark_context&
+  {
+    static benchmark_context context;
+    return context;
+  }
+
+  [[nodiscard]] auto get_window() noexcept -> window&
+  {
+    return *m_window;
+  }
+
+  [[nodiscard]] auto get_renderer() noexcept -> renderer&
+  {
+    return *m_renderer;
+  }
+
+ private:
+  std::unique_ptr<window> m_window;
+  std::unique_ptr<renderer> m_renderer;
+
+  benchmark_context()
+      : m_window{std::make_unique<window>()}
+      , m_renderer{std::make_unique<renderer>(*m_window, renderer::software)}
+  {}
+};
+
+inline constexpr auto fontPath = "resources/daniel.ttf";
+inline constexpr auto imagePath = "resources/panda.png";
+
+}  // namespace cen::bench
+
+#endif  // CENTURION_BENCHMARK_CONTEXT_HEADER
@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+
+#include <SDL2/SDL.h>
+
+#include "core/library.hpp"
+
+int main(int argc, char* argv[])
+{
+  // Default to the dummy video driver so that the benchmarks can run headless, the
+  // SDL_VIDEODRIVER environment variable takes precedence, e.g. "offscreen"
+  SDL_SetHintWithPriority(SDL_HINT_VIDEODRIVER, "dummy", SDL_HINT_DEFAULT);
+
+  cen::config cfg;
+  cfg.coreFlags = SDL_INIT_EVERYTHING & ~SDL_INIT_AUDIO;
+  cfg.initMixer = false;
+
+  const cen::library lib{cfg};
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <SDL2/SDL.h>
+
+#include "core/integers.hpp"
+#include "events/event.hpp"
+#include "events/event_dispatcher.hpp"
+
+namespace {
+
+using dispatcher_type = cen::event_dispatcher<cen::quit_event,
+                                              cen::window_event,
+                                              cen::keyboard_event,
+                                              cen::mouse_motion_event,
+                                              cen::mouse_button_event>;
+
+[[nodiscard]] auto make_motion_event(const int x) noexcept -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_MOUSEMOTION;
+  event.motion.x = x;
+  event.motion.y = x / 2;
+  return event;
+}
+
+void Dispatch(benchmark::State& state)
+{
+  dispatcher_type dispatcher;
+
+  cen::i64 sum = 0;
+  dispatcher.bind<cen::mouse_motion_event>().to(
+      [&](const cen::mouse_motion_event& event) { sum += event.x(); });
+
+  const auto event = make_motion_event(42);
+  for (auto _ : state) {
+    dispatcher.dispatch(event);
+  }
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void DispatchListeners(benchmark::State& state)
+{
+  dispatcher_type dispatcher;
+
+  cen::i64 sum = 0;
+  auto listener = [&](const cen::mouse_motion_event& event) { sum += event.x(); };
+
+  auto& listeners = dispatcher.listen<cen::mouse_motion_event>();
+  for (auto index = 0; index < state.range(0); ++index) {
+    listeners.connect(listener);
+  }
+
+  const auto event = make_motion_event(42);
+  for (auto _ : state) {
+    dispatcher.dispatch(event);
+  }
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void DispatchUnhandled(benchmark::State& state)
+{
+  dispatcher_type dispatcher;
+  dispatcher.bind<cen::quit_event>().to([](const cen::quit_event&) {});
+
+  const auto event = make_motion_event(42);
+  for (auto _ : state) {
+    dispatcher.dispatch(event);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void Poll(benchmark::State& state)
+{
+  dispatcher_type dispatcher;
+
+  cen::i64 sum = 0;
+  dispatcher.bind<cen::mouse_motion_event>().to(
+      [&](const cen::mouse_motion_event& event) { sum += event.x(); });
+
+  const auto count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    cen::event::flush_all();
+    for (auto index = 0; index < count; ++index) {
+      auto event = make_motion_event(index);
+      SDL_PushEvent(&event);
+    }
+    state.ResumeTiming();
+
+    dispatcher.poll();
+  }
+
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+}  // namespace
+
+BENCHMARK(Dispatch);
+BENCHMARK(DispatchListeners)->Arg(1)->Arg(8);
+BENCHMARK(DispatchUnhandled);
+BENCHMARK(Poll)->Arg(16)->Arg(256);
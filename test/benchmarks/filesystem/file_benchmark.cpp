@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>  // vector
+
+#include "benchmark_context.hpp"
+#include "core/integers.hpp"
+#include "filesystem/file.hpp"
+#include "filesystem/mapped_file.hpp"
+
+namespace {
+
+void ReadFile(benchmark::State& state)
+{
+  std::vector<cen::u8> buffer;
+
+  for (auto _ : state) {
+    cen::file file{cen::bench::fontPath, cen::file_mode::read_existing_binary};
+    buffer.resize(file.size().value_or(0));
+
+    benchmark::DoNotOptimize(file.read_to(buffer));
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<cen::i64>(buffer.size()));
+}
+
+void ReadBytes(benchmark::State& state)
+{
+  cen::usize total = 0;
+
+  for (auto _ : state) {
+    cen::file file{cen::bench::fontPath, cen::file_mode::read_existing_binary};
+    const auto size = file.size().value_or(0);
+
+    cen::u32 sum = 0;
+    for (cen::usize index = 0; index < size; ++index) {
+      sum += file.read_byte();
+    }
+
+    benchmark::DoNotOptimize(sum);
+    total += size;
+  }
+
+  state.SetBytesProcessed(static_cast<cen::i64>(total));
+}
+
+void ReadMappedFile(benchmark::State& state)
+{
+  cen::usize total = 0;
+
+  for (auto _ : state) {
+    const cen::mapped_file file{cen::bench::fontPath};
+
+    cen::u32 sum = 0;
+    for (cen::usize index = 0; index < file.size(); ++index) {
+      sum += file.data()[index];
+    }
+
+    benchmark::DoNotOptimize(sum);
+    total += file.size();
+  }
+
+  state.SetBytesProcessed(static_cast<cen::i64>(total));
+}
+
+}  // namespace
+
+BENCHMARK(ReadFile);
+BENCHMARK(ReadBytes);
+BENCHMARK(ReadMappedFile);
@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include "hints/common_hints.hpp"
+#include "hints/hints.hpp"
+
+namespace {
+
+void GetEnumHint(benchmark::State& state)
+{
+  cen::set_hint<cen::hint::render_driver>(cen::hint::render_driver::value::software);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cen::get_hint<cen::hint::render_driver>());
+  }
+}
+
+void GetBoolHint(benchmark::State& state)
+{
+  cen::set_hint<cen::hint::double_buffer>(true);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cen::get_hint<cen::hint::double_buffer>());
+  }
+}
+
+void SetEnumHint(benchmark::State& state)
+{
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        cen::set_hint<cen::hint::render_driver>(cen::hint::render_driver::value::software));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(GetEnumHint);
+BENCHMARK(GetBoolHint);
+BENCHMARK(SetEnumHint);
@@ -0,0 +1,21 @@
+#include <benchmark/benchmark.h>
+
+#include <SDL.h>
+#undef main  // SDL is unhappy without this (it wants to use its own main)
+
+#include <fff.h>
+
+DEFINE_FFF_GLOBALS
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
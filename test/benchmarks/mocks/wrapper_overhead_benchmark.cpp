@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <fff.h>
+
+#include <array>  // array
+
+#include "core/result.hpp"
+#include "core_mocks.hpp"
+#include "video/window.hpp"
+
+// Each wrapper benchmark has a direct counterpart that calls the same fake, so any
+// difference between the two is the overhead of the wrapper, rather than of SDL.
+
+extern "C"
+{
+  FAKE_VOID_FUNC(SDL_SetWindowTitle, SDL_Window*, const char*)
+  FAKE_VALUE_FUNC(int, SDL_SetWindowOpacity, SDL_Window*, float)
+}  // extern "C"
+
+namespace {
+
+// The fakes never dereference the window, so any address will do
+std::array<char, 64> window_storage{};
+
+[[nodiscard]] auto dummy_window() noexcept -> SDL_Window*
+{
+  return reinterpret_cast<SDL_Window*>(window_storage.data());
+}
+
+// Resets the fakes before each benchmark, so that every run records the same history
+void reset_fakes() noexcept
+{
+  RESET_FAKE(SDL_GetWindowFlags)
+  RESET_FAKE(SDL_DestroyWindow)
+  RESET_FAKE(SDL_SetWindowTitle)
+  RESET_FAKE(SDL_SetWindowOpacity)
+  FFF_RESET_HISTORY()
+}
+
+void DirectWindowFlags(benchmark::State& state)
+{
+  reset_fakes();
+
+  auto* window = dummy_window();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SDL_GetWindowFlags(window));
+  }
+}
+
+void HandleWindowFlags(benchmark::State& state)
+{
+  reset_fakes();
+
+  const cen::window_handle handle{dummy_window()};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(handle.flags());
+  }
+}
+
+void DirectDestroyWindow(benchmark::State& state)
+{
+  reset_fakes();
+
+  for (auto _ : state) {
+    auto* window = dummy_window();
+    benchmark::DoNotOptimize(window);
+
+    if (window) {
+      SDL_DestroyWindow(window);
+    }
+  }
+}
+
+void OwnerDestroyWindow(benchmark::State& state)
+{
+  reset_fakes();
+
+  for (auto _ : state) {
+    auto* window = dummy_window();
+    benchmark::DoNotOptimize(window);
+
+    const cen::window owner{window};
+  }
+}
+
+void DirectSetTitle(benchmark::State& state)
+{
+  reset_fakes();
+
+  auto* window = dummy_window();
+  for (auto _ : state) {
+    SDL_SetWindowTitle(window, "Centurion");
+  }
+}
+
+void HandleSetTitle(benchmark::State& state)
+{
+  reset_fakes();
+
+  cen::window_handle handle{dummy_window()};
+  for (auto _ : state) {
+    handle.set_title("Centurion");
+  }
+}
+
+void DirectSetOpacity(benchmark::State& state)
+{
+  reset_fakes();
+
+  auto* window = dummy_window();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SDL_SetWindowOpacity(window, 0.5f) == 0);
+  }
+}
+
+void HandleSetOpacity(benchmark::State& state)
+{
+  reset_fakes();
+
+  cen::window_handle handle{dummy_window()};
+  for (auto _ : state) {
+    const cen::result result = handle.set_opacity(0.5f);
+    benchmark::DoNotOptimize(static_cast<bool>(result));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(DirectWindowFlags);
+BENCHMARK(HandleWindowFlags);
+BENCHMARK(DirectDestroyWindow);
+BENCHMARK(OwnerDestroyWindow);
+BENCHMARK(DirectSetTitle);
+BENCHMARK(HandleSetTitle);
+BENCHMARK(DirectSetOpacity);
+BENCHMARK(HandleSetOpacity);
@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>       // unique_ptr, make_unique
+#include <string>       // string
+#include <string_view>  // string_view
+
+#include "benchmark_context.hpp"
+#include "math/point.hpp"
+#include "math/rect.hpp"
+#include "scene/scene_harness.hpp"
+#include "video/color.hpp"
+#include "video/colors.hpp"
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/utf8_view.hpp"
+
+namespace {
+
+// Lots of small, rotated textured quads from a single texture
+class sprite_storm final : public cen::bench::scene
+{
+ public:
+  explicit sprite_storm(const int count) : m_count{count}
+  {}
+
+  [[nodiscard]] auto name() const -> std::string override
+  {
+    return "sprite_storm_" + std::to_string(m_count);
+  }
+
+  void setup(cen::renderer& renderer) override
+  {
+    if (!m_texture) {
+      m_texture = std::make_unique<cen::texture>(renderer, cen::bench::imagePath);
+    }
+  }
+
+  void draw(cen::renderer& renderer, const int frame) override
+  {
+    const auto size = cen::bench::scene_harness::frame_size;
+    const cen::irect source{cen::ipoint{}, m_texture->size()};
+
+    for (auto index = 0; index < m_count; ++index) {
+      const auto x = (index * 37 + frame * 3) % size.width;
+      const auto y = (index * 91 + frame * 2) % size.height;
+      const auto angle = static_cast<double>((index * 15 + frame * 4) % 360);
+
+      renderer.render(*m_texture, source, cen::irect{x - 16, y - 16, 32, 32}, angle);
+    }
+  }
+
+ private:
+  int m_count{};
+  std::unique_ptr<cen::texture> m_texture;
+};
+
+// A screen full of cached glyphs, scrolling horizontally
+class text_wall final : public cen::bench::scene
+{
+ public:
+  explicit text_wall(const bool useAtlas) : m_atlas{useAtlas}
+  {}
+
+  [[nodiscard]] auto name() const -> std::string override
+  {
+    return m_atlas ? "text_wall_atlas" : "text_wall";
+  }
+
+  void setup(cen::renderer& renderer) override
+  {
+    if (!m_cache) {
+      m_cache = std::make_unique<cen::font_cache>(cen::bench::fontPath, 16);
+      if (m_atlas) {
+        m_cache->use_atlas();
+      }
+
+      m_cache->add_basic_latin(renderer);
+    }
+  }
+
+  void draw(cen::renderer& renderer, const int frame) override
+  {
+    constexpr std::string_view line =
+        "The quick brown fox jumps over the lazy dog. Pack my box with five dozen jugs!";
+
+    const auto lineSkip = m_cache->get_font().line_skip();
+    const auto lines = cen::bench::scene_harness::frame_size.height / lineSkip;
+
+    for (auto index = 0; index < lines; ++index) {
+      renderer.render_text(*m_cache,
+                           cen::utf8_view{line},
+                           cen::ipoint{4 - (frame % 8), index * lineSkip});
+    }
+  }
+
+ private:
+  bool m_atlas{};
+  std::unique_ptr<cen::font_cache> m_cache;
+};
+
+// Untextured geometry, with frequent draw color changes
+class primitive_flood final : public cen::bench::scene
+{
+ public:
+  explicit primitive_flood(const int count) : m_count{count}
+  {}
+
+  [[nodiscard]] auto name() const -> std::string override
+  {
+    return "primitive_flood_" + std::to_string(m_count);
+  }
+
+  void setup(cen::renderer&) override
+  {}
+
+  void draw(cen::renderer& renderer, const int frame) override
+  {
+    const auto size = cen::bench::scene_harness::frame_size;
+
+    for (auto index = 0; index < m_count; ++index) {
+      const auto x = (index * 53 + frame * 5) % size.width;
+      const auto y = (index * 29 + frame * 3) % size.height;
+
+      renderer.set_color(cen::color{static_cast<cen::u8>(index * 7),
+                                    static_cast<cen::u8>(index * 13 + frame),
+                                    static_cast<cen::u8>(index * 3)});
+
+      switch (index % 3) {
+        case 0:
+          renderer.fill_rect(cen::irect{x, y, 12, 12});
+          break;
+
+        case 1:
+          renderer.draw_rect(cen::irect{x, y, 20, 10});
+          break;
+
+        default:
+          renderer.draw_line(cen::ipoint{x, y}, cen::ipoint{x + 24, y + (index % 17)});
+          break;
+      }
+    }
+  }
+
+ private:
+  int m_count{};
+};
+
+void SpriteStorm(benchmark::State& state)
+{
+  sprite_storm scene{static_cast<int>(state.range(0))};
+  cen::bench::scene_harness::get().run(state, scene);
+}
+
+void TextWall(benchmark::State& state)
+{
+  text_wall scene{state.range(0) != 0};
+  cen::bench::scene_harness::get().run(state, scene);
+}
+
+void PrimitiveFlood(benchmark::State& state)
+{
+  primitive_flood scene{static_cast<int>(state.range(0))};
+  cen::bench::scene_harness::get().run(state, scene);
+}
+
+}  // namespace
+
+BENCHMARK(SpriteStorm)->RangeMultiplier(4)->Range(256, 4096)->UseManualTime();
+BENCHMARK(TextWall)->Arg(0)->Arg(1)->UseManualTime();
+BENCHMARK(PrimitiveFlood)->RangeMultiplier(4)->Range(256, 4096)->UseManualTime();
@@ -0,0 +1,256 @@
+#ifndef CENTURION_SCENE_HARNESS_HEADER
+#define CENTURION_SCENE_HARNESS_HEADER
+
+#include <SDL2/SDL.h>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>   // max
+#include <cstdlib>     // getenv, abs
+#include <cstring>     // strcmp
+#include <filesystem>  // path, exists, create_directories
+#include <memory>      // unique_ptr, make_unique
+#include <string>      // string, to_string
+
+#include "core/integers.hpp"
+#include "math/area.hpp"
+#include "system/counter.hpp"
+#include "video/colors.hpp"
+#include "video/pixel_format.hpp"
+#include "video/renderer.hpp"
+#include "video/surface.hpp"
+#include "video/window.hpp"
+
+#ifndef CEN_GOLDEN_DIR
+#define CEN_GOLDEN_DIR "golden"
+#endif  // CEN_GOLDEN_DIR
+
+namespace cen::bench {
+
+// A scripted scene, the output of draw() must only depend on the frame index so that the
+// frames can be compared to golden images
+class scene
+{
+ public:
+  virtual ~scene() noexcept = default;
+
+  [[nodiscard]] virtual auto name() const -> std::string = 0;
+
+  virtual void setup(renderer& renderer) = 0;
+
+  virtual void draw(renderer& renderer, int frame) = 0;
+};
+
+// The outcome of comparing a frame to its golden image
+struct golden_result final
+{
+  bool ok{};            ///< Whether or not the frame matched the golden image.
+  bool recorded{};      ///< Whether or not the golden image was (re)written.
+  usize mismatched{};   ///< The amount of pixels that differed from the golden image.
+  std::string message;  ///< A description of the failure, if any.
+};
+
+// Replays scenes with an offscreen window and renderer, timing each frame with the
+// high-resolution counter and verifying a fixed frame against a golden image.
+//
+// The software renderer is used by default, which produces identical output across
+// runs. Set CEN_BENCHMARK_RENDERER=accelerated to use a GPU renderer instead, which gets
+// its own set of golden images and a small per-channel tolerance. Missing golden images
+// are recorded, and CEN_UPDATE_GOLDEN=1 rewrites all of them.
+class scene_harness final
+{
+ public:
+  inline constexpr static iarea frame_size{640, 480};
+  inline constexpr static int golden_frame = 60;
+
+  [[nodiscard]] static auto get() -> scene_harness&
+  {
+    static scene_harness harness;
+    return harness;
+  }
+
+  // Runs the scene as a benchmark, where each iteration renders one frame
+  void run(benchmark::State& state, scene& scene)
+  {
+    scene.setup(*m_renderer);
+
+    const auto golden = check_golden(scene);
+    if (!golden.ok) {
+      state.SkipWithError(golden.message.c_str());
+      return;
+    }
+
+    double total{};
+    double worst{};
+    int frame{};
+
+    for (auto _ : state) {
+      const auto time = render_frame(scene, frame++);
+      state.SetIterationTime(time);
+
+      total += time;
+      worst = (std::max)(worst, time);
+    }
+
+    const auto frames = (std::max)(frame, 1);
+    state.counters["frame_ms"] = 1'000.0 * total / frames;
+    state.counters["worst_frame_ms"] = 1'000.0 * worst;
+    state.counters["fps"] = benchmark::Counter{static_cast<double>(frame),
+                                               benchmark::Counter::kIsRate};
+
+    if (golden.recorded) {
+      state.SetLabel("recorded " + golden_path(scene).filename().string());
+    }
+  }
+
+  // Renders a single frame and returns the elapsed time in seconds, the frame is
+  // presented after the timing stops
+  [[nodiscard]] auto render_frame(scene& scene, const int frame) -> double
+  {
+    const auto start = counter::now();
+
+    m_renderer->clear_with(colors::black);
+    scene.draw(*m_renderer, frame);
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+    // Makes sure that batched commands are executed within the timed region
+    SDL_RenderFlush(m_renderer->get());
+#endif  // SDL_VERSION_ATLEAST(2, 0, 10)
+
+    const auto end = counter::now();
+    m_renderer->present();
+
+    return static_cast<double>(end - start) / static_cast<double>(counter::frequency());
+  }
+
+  // Renders the golden frame of the scene and compares it to the stored golden image
+  [[nodiscard]] auto check_golden(scene& scene) -> golden_result
+  {
+    m_renderer->clear_with(colors::black);
+    scene.draw(*m_renderer, golden_frame);
+
+    // The frame is read before presenting, since the back buffer is undefined afterwards
+    if (!m_renderer->capture(*m_frame)) {
+      return {false, false, 0, "failed to capture frame: " + std::string{SDL_GetError()}};
+    }
+
+    m_renderer->present();
+
+    const auto path = golden_path(scene);
+    if (should_update() || !std::filesystem::exists(path)) {
+      return record(path);
+    }
+
+    const auto golden = surface{path.string()}.convert(comparison_format);
+    if (golden.size() != m_frame->size()) {
+      return {false, false, 0, "golden image size mismatch: " + path.string()};
+    }
+
+    const auto mismatched = count_mismatched(golden, *m_frame, tolerance());
+    if (mismatched != 0) {
+      const auto actual = path.stem().string() + ".actual.png";
+      m_frame->save_as_png(actual);
+
+      return {false,
+              false,
+              mismatched,
+              std::to_string(mismatched) + " pixels differ from " + path.string() +
+                  ", see " + actual};
+    }
+
+    return {true, false, 0, {}};
+  }
+
+  [[nodiscard]] auto golden_path(const scene& scene) const -> std::filesystem::path
+  {
+    const auto* kind = m_accelerated ? "accelerated" : "software";
+    return std::filesystem::path{CEN_GOLDEN_DIR} / (scene.name() + "_" + kind + ".png");
+  }
+
+  [[nodiscard]] auto get_renderer() noexcept -> renderer&
+  {
+    return *m_renderer;
+  }
+
+  [[nodiscard]] auto is_accelerated() const noexcept -> bool
+  {
+    return m_accelerated;
+  }
+
+ private:
+  inline constexpr static auto comparison_format = pixel_format::rgba32;
+
+  bool m_accelerated{};
+  std::unique_ptr<window> m_window;
+  std::unique_ptr<renderer> m_renderer;
+  std::unique_ptr<surface> m_frame;
+
+  scene_harness()
+      : m_accelerated{use_accelerated()}
+      , m_window{std::make_unique<window>("Centurion scene harness", frame_size)}
+      , m_renderer{std::make_unique<renderer>(*m_window,
+                                              m_accelerated ? renderer::accelerated
+                                                            : renderer::software)}
+      , m_frame{std::make_unique<surface>(m_renderer->output_size(), comparison_format)}
+  {}
+
+  [[nodiscard]] static auto use_accelerated() -> bool
+  {
+    const auto* kind = std::getenv("CEN_BENCHMARK_RENDERER");
+    return kind && std::strcmp(kind, "accelerated") == 0;
+  }
+
+  [[nodiscard]] static auto should_update() -> bool
+  {
+    const auto* update = std::getenv("CEN_UPDATE_GOLDEN");
+    return update && std::strcmp(update, "1") == 0;
+  }
+
+  // GPU renderers may differ slightly between drivers, e.g. due to filtering and blending
+  // precision, the software renderer is expected to be exact
+  [[nodiscard]] auto tolerance() const noexcept -> int
+  {
+    return m_accelerated ? 8 : 0;
+  }
+
+  [[nodiscard]] auto record(const std::filesystem::path& path) -> golden_result
+  {
+    std::filesystem::create_directories(path.parent_path());
+
+    if (m_frame->save_as_png(path.string())) {
+      return {true, true, 0, {}};
+    }
+    else {
+      return {false, false, 0, "failed to record golden image: " + path.string()};
+    }
+  }
+
+  [[nodiscard]] static auto count_mismatched(const surface& expected,
+                                             const surface& actual,
+                                             const int tolerance) -> usize
+  {
+    const auto* expectedPixels = static_cast<const u8*>(expected.pixels());
+    const auto* actualPixels = static_cast<const u8*>(actual.pixels());
+    const auto rowBytes = static_cast<usize>(expected.width()) * 4u;
+
+    usize mismatched = 0;
+    for (auto y = 0; y < expected.height(); ++y) {
+      const auto* a = expectedPixels + static_cast<usize>(y * expected.pitch());
+      const auto* b = actualPixels + static_cast<usize>(y * actual.pitch());
+
+      for (usize x = 0; x < rowBytes; x += 4u) {
+        for (usize channel = 0; channel < 4u; ++channel) {
+          if (std::abs(a[x + channel] - b[x + channel]) > tolerance) {
+            ++mismatched;
+            break;
+          }
+        }
+      }
+    }
+
+    return mismatched;
+  }
+};
+
+}  // namespace cen::bench
+
+#endif  // CENTURION_SCENE_HARNESS_HEADER
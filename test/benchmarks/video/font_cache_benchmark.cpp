@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <string_view>  // string_view
+
+#include "benchmark_context.hpp"
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/text_batch.hpp"
+#include "video/text_layout.hpp"
+#include "video/utf8_view.hpp"
+
+namespace {
+
+inline constexpr std::string_view text =
+    "The quick brown fox jumps over the lazy dog. Pack my box with five dozen jugs!";
+
+[[nodiscard]] auto make_cache(const bool useAtlas) -> cen::font_cache
+{
+  auto& renderer = cen::bench::benchmark_context::get().get_renderer();
+
+  cen::font_cache cache{cen::bench::fontPath, 16};
+  if (useAtlas) {
+    cache.use_atlas();
+  }
+
+  cache.add_basic_latin(renderer);
+  return cache;
+}
+
+void AddBasicLatin(benchmark::State& state)
+{
+  auto& renderer = cen::bench::benchmark_context::get().get_renderer();
+
+  for (auto _ : state) {
+    cen::font_cache cache{cen::bench::fontPath, 16};
+    if (state.range(0) != 0) {
+      cache.use_atlas();
+    }
+
+    cache.add_basic_latin(renderer);
+    benchmark::DoNotOptimize(cache.atlas_page_count());
+  }
+}
+
+void RenderText(benchmark::State& state)
+{
+  auto& renderer = cen::bench::benchmark_context::get().get_renderer();
+  const auto cache = make_cache(state.range(0) != 0);
+
+  for (auto _ : state) {
+    renderer.clear();
+    renderer.render_text(cache, cen::utf8_view{text}, {10, 10});
+    renderer.present();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<cen::i64>(text.size()));
+}
+
+void LayoutText(benchmark::State& state)
+{
+  const auto cache = make_cache(true);
+  cen::text_layout layout{cache, 200};
+  layout.set_text(cen::utf8_view{text});
+
+  for (auto _ : state) {
+    layout.update();
+    benchmark::DoNotOptimize(layout.glyphs().data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<cen::i64>(text.size()));
+}
+
+void MeasureText(benchmark::State& state)
+{
+  const auto cache = make_cache(true);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache.measure(cen::utf8_view{text}));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<cen::i64>(text.size()));
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+void RenderTextBatch(benchmark::State& state)
+{
+  auto& renderer = cen::bench::benchmark_context::get().get_renderer();
+  const auto cache = make_cache(true);
+  cen::text_batch batch{cache};
+
+  for (auto _ : state) {
+    batch.clear();
+    for (auto line = 0; line < 10; ++line) {
+      batch.add(cen::utf8_view{text}, {10, 10 + line * 20});
+    }
+
+    renderer.clear();
+    renderer.render_text(batch);
+    renderer.present();
+  }
+
+  state.SetItemsProcessed(state.iterations() * 10 * static_cast<cen::i64>(text.size()));
+}
+
+BENCHMARK(RenderTextBatch);
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+}  // namespace
+
+BENCHMARK(AddBasicLatin)->Arg(0)->Arg(1);
+BENCHMARK(RenderText)->Arg(0)->Arg(1);
+BENCHMARK(LayoutText);
+BENCHMARK(MeasureText);
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include "core/integers.hpp"
+#include "video/color.hpp"
+#include "video/pixel_format.hpp"
+#include "video/pixel_format_info.hpp"
+
+namespace {
+
+void RGBAToPixel(benchmark::State& state)
+{
+  const cen::pixel_format_info info{cen::pixel_format::rgba8888};
+
+  cen::u8 value = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(info.rgba_to_pixel(cen::color{value, 0x20, 0x40, 0xFF}));
+    ++value;
+  }
+}
+
+void PixelToRGBA(benchmark::State& state)
+{
+  const cen::pixel_format_info info{cen::pixel_format::rgba8888};
+
+  cen::u32 pixel = 0x102040FF;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(info.pixel_to_rgba(pixel));
+    ++pixel;
+  }
+}
+
+void CreateInfo(benchmark::State& state)
+{
+  for (auto _ : state) {
+    const cen::pixel_format_info info{cen::pixel_format::argb8888};
+    benchmark::DoNotOptimize(info.get());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(RGBAToPixel);
+BENCHMARK(PixelToRGBA);
+BENCHMARK(CreateInfo);
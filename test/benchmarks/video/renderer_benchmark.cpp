@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>  // vector
+
+#include "benchmark_context.hpp"
+#include "math/rect.hpp"
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_rects(const int count) -> std::vector<cen::irect>
+{
+  std::vector<cen::irect> rects;
+  rects.reserve(static_cast<cen::usize>(count));
+
+  for (auto index = 0; index < count; ++index) {
+    rects.emplace_back((index * 7) % 760, (index * 13) % 560, 16, 16);
+  }
+
+  return rects;
+}
+
+void FillRect(benchmark::State& state)
+{
+  auto& renderer = cen::bench::benchmark_context::get().get_renderer();
+  const auto rects = make_rects(static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    renderer.clear_with(cen::colors::black);
+    renderer.set_color(cen::colors::pink);
+
+    for (const auto& rect : rects) {
+      renderer.fill_rect(rect);
+    }
+
+    renderer.present();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void FillRects(benchmark::State& state)
+{
+  auto& renderer = cen::bench::benchmark_context::get().get_renderer();
+  const auto rects = make_rects(static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    renderer.clear_with(cen::colors::black);
+    renderer.set_color(cen::colors::pink);
+    renderer.fill_rects(rects);
+    renderer.present();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void RenderTexture(benchmark::State& state)
+{
+  auto& renderer = cen::bench::benchmark_context::get().get_renderer();
+  const cen::texture texture{renderer, cen::bench::imagePath};
+  const auto rects = make_rects(static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    renderer.clear_with(cen::colors::black);
+
+    for (const auto& rect : rects) {
+      renderer.render(texture, rect);
+    }
+
+    renderer.present();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(FillRect)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK(FillRects)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK(RenderTexture)->RangeMultiplier(4)->Range(64, 4096);
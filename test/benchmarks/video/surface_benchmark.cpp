@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include "math/area.hpp"
+#include "math/rect.hpp"
+#include "video/colors.hpp"
+#include "video/pixel_format.hpp"
+#include "video/pixel_view.hpp"
+#include "video/surface.hpp"
+
+namespace {
+
+void SetPixel(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+  cen::surface surface{{size, size}, cen::pixel_format::rgba8888};
+
+  for (auto _ : state) {
+    for (auto y = 0; y < size; ++y) {
+      for (auto x = 0; x < size; ++x) {
+        surface.set_pixel({x, y}, cen::colors::coral);
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+void PixelViewSetPixel(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+  cen::surface surface{{size, size}, cen::pixel_format::rgba8888};
+
+  for (auto _ : state) {
+    cen::pixel_view view{surface};
+    for (auto y = 0; y < size; ++y) {
+      for (auto x = 0; x < size; ++x) {
+        view.set_pixel({x, y}, cen::colors::coral);
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+void PixelViewFill(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+  cen::surface surface{{size, size}, cen::pixel_format::rgba8888};
+
+  for (auto _ : state) {
+    cen::pixel_view view{surface};
+    view.fill(cen::colors::coral);
+  }
+
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+void Convert(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+  const cen::surface surface{{size, size}, cen::pixel_format::rgba8888};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(surface.convert(cen::pixel_format::argb8888).get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+}  // namespace
+
+BENCHMARK(SetPixel)->Arg(64)->Arg(256);
+BENCHMARK(PixelViewSetPixel)->Arg(64)->Arg(256);
+BENCHMARK(PixelViewFill)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(Convert)->Arg(64)->Arg(256)->Arg(1024);
@@ -0,0 +1,56 @@
+# Checks that every "wrapped_<name>" function in an assembly listing consists of at most as
+# many instructions as the corresponding "direct_<name>" function.
+#
+# Usage: cmake -DASSEMBLY=<listing> -P check_codegen.cmake
+
+if (NOT EXISTS "${ASSEMBLY}")
+  message(FATAL_ERROR "Could not find assembly listing: ${ASSEMBLY}")
+endif ()
+
+file(STRINGS "${ASSEMBLY}" lines)
+
+set(current "")
+set(functions "")
+
+foreach (line IN LISTS lines)
+  if (line MATCHES "^([A-Za-z_][A-Za-z0-9_]*):")
+    set(current ${CMAKE_MATCH_1})
+    set(count_${current} 0)
+    list(APPEND functions ${current})
+  elseif (line MATCHES "^\t\\.size\t" OR line MATCHES "^\t\\.cfi_endproc")
+    set(current "")
+  elseif (current AND line MATCHES "^\t[a-z]")
+    math(EXPR count_${current} "${count_${current}} + 1")
+  endif ()
+endforeach ()
+
+set(failed FALSE)
+set(checked 0)
+
+foreach (function IN LISTS functions)
+  if (NOT function MATCHES "^direct_(.+)$")
+    continue()
+  endif ()
+
+  set(name ${CMAKE_MATCH_1})
+  set(direct ${count_direct_${name}})
+  set(wrapped ${count_wrapped_${name}})
+
+  if ("${wrapped}" STREQUAL "")
+    message(SEND_ERROR "${name}: missing wrapped_${name}")
+    set(failed TRUE)
+  elseif (wrapped GREATER direct)
+    message(SEND_ERROR "${name}: ${wrapped} instructions, expected at most ${direct}")
+    set(failed TRUE)
+  else ()
+    message(STATUS "${name}: ${wrapped} instructions (direct: ${direct})")
+  endif ()
+
+  math(EXPR checked "${checked} + 1")
+endforeach ()
+
+if (checked EQUAL 0)
+  message(FATAL_ERROR "Found no functions to compare in ${ASSEMBLY}")
+elseif (failed)
+  message(FATAL_ERROR "The wrappers weren't fully inlined")
+endif ()
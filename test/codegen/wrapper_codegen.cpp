@@ -0,0 +1,76 @@
+// Pairs of functions that perform the same work, directly with SDL and through the
+// wrappers. The listing of this file is checked by check_codegen.cmake, which requires
+// that every "wrapped_" function compiles to at most as many instructions as its "direct_"
+// counterpart, i.e. that the wrappers are completely inlined.
+
+#include <SDL2/SDL.h>
+
+#include "centurion/detail/owner_handle_api.hpp"
+#include "centurion/detail/ownership_tags.hpp"
+#include "centurion/video/window.hpp"
+
+namespace {
+
+struct window_deleter final
+{
+  void operator()(SDL_Window* window) noexcept
+  {
+    SDL_DestroyWindow(window);
+  }
+};
+
+using window_owner = cen::detail::pointer_manager<cen::detail::owning_type,
+                                                  SDL_Window,
+                                                  window_deleter>;
+
+}  // namespace
+
+extern "C" {
+
+// Handles
+auto direct_window_flags(SDL_Window* window) noexcept -> Uint32
+{
+  return SDL_GetWindowFlags(window);
+}
+
+auto wrapped_window_flags(SDL_Window* window) noexcept -> Uint32
+{
+  return cen::window_handle{window}.flags();
+}
+
+// Owners
+void direct_destroy_window(SDL_Window* window) noexcept
+{
+  if (window) {
+    SDL_DestroyWindow(window);
+  }
+}
+
+void wrapped_destroy_window(SDL_Window* window) noexcept
+{
+  const window_owner owner{window};
+}
+
+// Non-null parameters
+void direct_set_title(SDL_Window* window, const char* title) noexcept
+{
+  SDL_SetWindowTitle(window, title);
+}
+
+void wrapped_set_title(SDL_Window* window, const char* title) noexcept
+{
+  cen::window_handle{window}.set_title(title);
+}
+
+// Results
+auto direct_set_opacity(SDL_Window* window, const float opacity) noexcept -> bool
+{
+  return SDL_SetWindowOpacity(window, opacity) == 0;
+}
+
+auto wrapped_set_opacity(SDL_Window* window, const float opacity) noexcept -> bool
+{
+  return static_cast<bool>(cen::window_handle{window}.set_opacity(opacity));
+}
+
+}  // extern "C"
@@ -22,6 +22,10 @@ extern "C"
   FAKE_VALUE_FUNC(int, Mix_GroupAvailable, int)
   FAKE_VALUE_FUNC(int, Mix_GroupNewer, int)
   FAKE_VALUE_FUNC(int, Mix_GroupOldest, int)
+
+  // Defined in audio/mixer_latency_test.cpp
+  DECLARE_FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceCounter)
+  DECLARE_FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceFrequency)
 }
 
 class ChannelsTest : public testing::Test
@@ -40,6 +44,8 @@ class ChannelsTest : public testing::Test
     RESET_FAKE(Mix_GroupAvailable)
     RESET_FAKE(Mix_GroupNewer)
     RESET_FAKE(Mix_GroupOldest)
+    RESET_FAKE(SDL_GetPerformanceCounter)
+    RESET_FAKE(SDL_GetPerformanceFrequency)
   }
 };
 
@@ -50,6 +56,29 @@ TEST_F(ChannelsTest, OnFinished)
   ASSERT_EQ(1u, Mix_ChannelFinished_fake.call_count);
 }
 
+TEST_F(ChannelsTest, OnFinishedMonitored)
+{
+  static cen::channel_index finished = -1;
+
+  std::array<Uint64, 2> counters{100, 350};
+  SET_RETURN_SEQ(SDL_GetPerformanceCounter, counters.data(), cen::isize(counters));
+  SDL_GetPerformanceFrequency_fake.return_val = 1'000'000'000;
+
+  cen::audio_monitor monitor;
+  cen::channels::on_finished(
+      [](const cen::channel_index channel) noexcept { finished = channel; },
+      monitor);
+
+  ASSERT_EQ(1u, Mix_ChannelFinished_fake.call_count);
+
+  Mix_ChannelFinished_fake.arg0_val(7);
+  ASSERT_EQ(7, finished);
+
+  const auto stats = monitor.stats();
+  ASSERT_EQ(1u, stats.finished);
+  ASSERT_EQ(250u, stats.finishedTime.count());
+}
+
 TEST_F(ChannelsTest, Allocate)
 {
   cen::channels::allocate(42);
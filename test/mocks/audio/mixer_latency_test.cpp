@@ -0,0 +1,99 @@
+#include "audio/mixer_latency.hpp"
+
+#include <fff.h>
+#include <gtest/gtest.h>
+
+#include <array>  // array
+
+#include "core_mocks.hpp"
+
+using post_mix_callback = void(SDLCALL*)(void*, Uint8*, int);
+
+// clang-format off
+extern "C" {
+FAKE_VALUE_FUNC(int, Mix_QuerySpec, int*, Uint16*, int*)
+FAKE_VOID_FUNC(Mix_SetPostMix, post_mix_callback, void*)
+FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceCounter)
+FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceFrequency)
+}
+// clang-format on
+
+namespace {
+
+auto query_spec(int* frequency, Uint16* format, int* channels) -> int
+{
+  *frequency = 48'000;
+  *format = AUDIO_S16SYS;
+  *channels = 2;
+  return 1;
+}
+
+}  // namespace
+
+class MixerLatencyTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    mocks::reset_core();
+
+    RESET_FAKE(Mix_QuerySpec)
+    RESET_FAKE(Mix_SetPostMix)
+    RESET_FAKE(SDL_GetPerformanceCounter)
+    RESET_FAKE(SDL_GetPerformanceFrequency)
+
+    Mix_QuerySpec_fake.custom_fake = query_spec;
+    SDL_GetPerformanceFrequency_fake.return_val = 1'000;
+  }
+};
+
+TEST_F(MixerLatencyTest, QueryMixerSpec)
+{
+  const auto spec = cen::query_mixer_spec();
+  ASSERT_TRUE(spec);
+  ASSERT_EQ(48'000, spec->frequency);
+  ASSERT_EQ(AUDIO_S16SYS, spec->format);
+  ASSERT_EQ(2, spec->channels);
+  ASSERT_EQ(4, spec->frame_size());
+
+  Mix_QuerySpec_fake.custom_fake = nullptr;
+  Mix_QuerySpec_fake.return_val = 0;
+  ASSERT_FALSE(cen::query_mixer_spec());
+}
+
+TEST_F(MixerLatencyTest, Probe)
+{
+  {
+    cen::mixer_latency_probe probe;
+    ASSERT_EQ(1u, Mix_SetPostMix_fake.call_count);
+    ASSERT_EQ(&probe, Mix_SetPostMix_fake.arg1_val);
+
+    ASSERT_EQ(0u, probe.callback_count());
+    ASSERT_EQ(0u, probe.buffer_frames());
+    ASSERT_EQ(0.0, probe.buffer_latency().count());
+    ASSERT_EQ(0.0, probe.callback_interval().count());
+
+    std::array<Uint64, 3> counters{100, 110, 122};
+    SET_RETURN_SEQ(SDL_GetPerformanceCounter, counters.data(), cen::isize(counters));
+
+    auto* callback = Mix_SetPostMix_fake.arg0_val;
+    std::array<Uint8, 2'048> buffer{};
+
+    // 512 frames of 16-bit stereo audio
+    callback(&probe, buffer.data(), static_cast<int>(buffer.size()));
+    ASSERT_EQ(1u, probe.callback_count());
+    ASSERT_EQ(512u, probe.buffer_frames());
+    ASSERT_NEAR(10.667, probe.buffer_latency().count(), 0.001);
+    ASSERT_EQ(0.0, probe.callback_interval().count());
+
+    callback(&probe, buffer.data(), static_cast<int>(buffer.size()));
+    ASSERT_EQ(10.0, probe.callback_interval().count());
+
+    callback(&probe, buffer.data(), static_cast<int>(buffer.size()));
+    ASSERT_EQ(3u, probe.callback_count());
+    ASSERT_EQ(10.0, probe.callback_interval().count());  // 10 + (12 - 10) / 8
+  }
+
+  ASSERT_EQ(2u, Mix_SetPostMix_fake.call_count);
+  ASSERT_EQ(nullptr, Mix_SetPostMix_fake.arg0_val);
+}
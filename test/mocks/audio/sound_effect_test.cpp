@@ -14,10 +14,8 @@ using ms = cen::milliseconds<int>;
 extern "C" {
 FAKE_VOID_FUNC(Mix_FreeChunk, Mix_Chunk*)
 FAKE_VOID_FUNC(Mix_Pause, int)
-FAKE_VALUE_FUNC(int, Mix_PlayChannelTimed, int, Mix_Chunk*, int, int)
 FAKE_VALUE_FUNC(int, Mix_FadeInChannelTimed, int, Mix_Chunk*, int, int, int)
 FAKE_VALUE_FUNC(int, Mix_FadeOutChannel, int, int)
-FAKE_VALUE_FUNC(int, Mix_Playing, int)
 FAKE_VALUE_FUNC(int, Mix_VolumeChunk, Mix_Chunk*, int)
 }
 // clang-format on
@@ -32,10 +30,8 @@ class SoundEffectTest : public testing::Test
 
     RESET_FAKE(Mix_FreeChunk)
     RESET_FAKE(Mix_Pause)
-    RESET_FAKE(Mix_PlayChannelTimed)
     RESET_FAKE(Mix_FadeInChannelTimed)
     RESET_FAKE(Mix_FadeOutChannel)
-    RESET_FAKE(Mix_Playing)
     RESET_FAKE(Mix_VolumeChunk)
   }
 
@@ -0,0 +1,136 @@
+#include "audio/spatial_audio.hpp"
+
+#include <fff.h>
+#include <gtest/gtest.h>
+
+#include "core_mocks.hpp"
+
+extern "C"
+{
+  FAKE_VALUE_FUNC(int, Mix_SetPosition, int, Sint16, Uint8)
+}
+
+class SpatialAudioTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    mocks::reset_core();
+
+    RESET_FAKE(Mix_SetPosition)
+    Mix_SetPosition_fake.return_val = 1;
+
+    m_spatial.set_range(0, 255);
+    m_spatial.set_listener(cen::fpoint{100, 100});
+  }
+
+  cen::spatial_audio m_spatial{4};
+};
+
+TEST_F(SpatialAudioTest, Emitters)
+{
+  ASSERT_EQ(4u, m_spatial.channel_count());
+  ASSERT_FALSE(m_spatial.has_emitter(1));
+  ASSERT_FALSE(m_spatial.has_emitter(-1));
+  ASSERT_FALSE(m_spatial.has_emitter(4));
+
+  m_spatial.set_emitter(1, cen::fpoint{0, 0});
+  ASSERT_TRUE(m_spatial.has_emitter(1));
+
+  // The position effect hasn't been registered, so it isn't unregistered
+  m_spatial.remove_emitter(1);
+  ASSERT_FALSE(m_spatial.has_emitter(1));
+  ASSERT_EQ(0u, Mix_SetPosition_fake.call_count);
+}
+
+TEST_F(SpatialAudioTest, Update)
+{
+  ASSERT_EQ(0u, m_spatial.update());
+
+  m_spatial.set_emitter(0, cen::fpoint{150, 100});  // Right
+  m_spatial.set_emitter(2, cen::fpoint{100, 40});   // Front
+  m_spatial.set_emitter(3, cen::fpoint{40, 100});   // Left
+
+  ASSERT_EQ(3u, m_spatial.update());
+  ASSERT_EQ(3u, Mix_SetPosition_fake.call_count);
+
+  ASSERT_EQ(0, Mix_SetPosition_fake.arg0_history[0]);
+  ASSERT_EQ(90, Mix_SetPosition_fake.arg1_history[0]);
+  ASSERT_EQ(50, Mix_SetPosition_fake.arg2_history[0]);
+
+  ASSERT_EQ(2, Mix_SetPosition_fake.arg0_history[1]);
+  ASSERT_EQ(0, Mix_SetPosition_fake.arg1_history[1]);
+  ASSERT_EQ(60, Mix_SetPosition_fake.arg2_history[1]);
+
+  ASSERT_EQ(3, Mix_SetPosition_fake.arg0_history[2]);
+  ASSERT_EQ(270, Mix_SetPosition_fake.arg1_history[2]);
+  ASSERT_EQ(60, Mix_SetPosition_fake.arg2_history[2]);
+}
+
+TEST_F(SpatialAudioTest, Thresholds)
+{
+  m_spatial.set_emitter(0, cen::fpoint{150, 100});
+  ASSERT_EQ(1u, m_spatial.update());
+
+  // Nothing changed enough, so the mixer isn't touched
+  m_spatial.set_emitter(0, cen::fpoint{151, 100});
+  ASSERT_EQ(0u, m_spatial.update());
+  ASSERT_EQ(1u, Mix_SetPosition_fake.call_count);
+
+  m_spatial.set_emitter(0, cen::fpoint{160, 100});
+  ASSERT_EQ(1u, m_spatial.update());
+  ASSERT_EQ(60, Mix_SetPosition_fake.arg2_val);
+
+  m_spatial.set_thresholds(1, 1);
+  m_spatial.set_emitter(0, cen::fpoint{161, 100});
+  ASSERT_EQ(1u, m_spatial.update());
+}
+
+TEST_F(SpatialAudioTest, DefaultListener)
+{
+  // Without a listener, the screen space basis is used at the origin
+  cen::spatial_audio spatial{1};
+  spatial.set_range(0, 255);
+  spatial.set_emitter(0, cen::fpoint{0, -10});
+
+  ASSERT_EQ(1u, spatial.update());
+  ASSERT_EQ(0, Mix_SetPosition_fake.arg1_val);
+  ASSERT_EQ(10, Mix_SetPosition_fake.arg2_val);
+}
+
+TEST_F(SpatialAudioTest, ListenerOrientation)
+{
+  using vector = cen::spatial_audio::vector_type;
+
+  // The listener looks along the positive x-axis, with the negative z-axis to the right
+  m_spatial.set_listener(vector{}, vector{1, 0, 0}, vector{0, 0, -1});
+  m_spatial.set_emitter(0, vector{0, 0, 10});
+
+  ASSERT_EQ(1u, m_spatial.update());
+  ASSERT_EQ(270, Mix_SetPosition_fake.arg1_val);
+  ASSERT_EQ(10, Mix_SetPosition_fake.arg2_val);
+}
+
+TEST_F(SpatialAudioTest, RemoveAppliedEmitter)
+{
+  m_spatial.set_emitter(0, cen::fpoint{150, 100});
+  ASSERT_EQ(1u, m_spatial.update());
+
+  m_spatial.remove_emitter(0);
+  ASSERT_EQ(2u, Mix_SetPosition_fake.call_count);
+  ASSERT_EQ(0, Mix_SetPosition_fake.arg1_val);
+  ASSERT_EQ(0, Mix_SetPosition_fake.arg2_val);
+
+  ASSERT_EQ(0u, m_spatial.update());
+}
+
+TEST_F(SpatialAudioTest, FailedUpdateIsRetried)
+{
+  Mix_SetPosition_fake.return_val = 0;
+
+  m_spatial.set_emitter(0, cen::fpoint{150, 100});
+  ASSERT_EQ(0u, m_spatial.update());
+
+  Mix_SetPosition_fake.return_val = 1;
+  ASSERT_EQ(1u, m_spatial.update());
+}
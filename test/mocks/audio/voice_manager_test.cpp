@@ -0,0 +1,193 @@
+#include "audio/voice_manager.hpp"
+
+#include <fff.h>
+#include <gtest/gtest.h>
+
+#include <array>  // array
+
+#include "core_mocks.hpp"
+#include "mixer_mocks.hpp"
+
+// clang-format off
+extern "C" {
+FAKE_VALUE_FUNC(int, Mix_HaltChannel, int)
+FAKE_VALUE_FUNC(int, Mix_HaltGroup, int)
+
+// Defined in audio/channels_test.cpp
+DECLARE_FAKE_VALUE_FUNC(int, Mix_GroupChannel, int, int)
+DECLARE_FAKE_VALUE_FUNC(int, Mix_GroupAvailable, int)
+}
+// clang-format on
+
+namespace {
+
+auto play_on_requested_channel(const int channel, Mix_Chunk*, int, int) -> int
+{
+  return channel;
+}
+
+}  // namespace
+
+class VoiceManagerTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    mocks::reset_core();
+    mocks::reset_mixer();
+
+    RESET_FAKE(Mix_HaltChannel)
+    RESET_FAKE(Mix_HaltGroup)
+    RESET_FAKE(Mix_GroupChannel)
+    RESET_FAKE(Mix_GroupAvailable)
+
+    Mix_PlayChannelTimed_fake.custom_fake = play_on_requested_channel;
+    Mix_Playing_fake.return_val = 1;
+  }
+
+  Mix_Chunk m_chunkA{};
+  Mix_Chunk m_chunkB{};
+  cen::sound_effect_handle m_soundA{&m_chunkA};
+  cen::sound_effect_handle m_soundB{&m_chunkB};
+};
+
+TEST_F(VoiceManagerTest, Construction)
+{
+  cen::voice_manager voices{4, 2, 7};
+
+  ASSERT_EQ(2u, Mix_GroupChannel_fake.call_count);
+  ASSERT_EQ(5, Mix_GroupChannel_fake.arg0_history[1]);
+  ASSERT_EQ(7, Mix_GroupChannel_fake.arg1_history[1]);
+
+  ASSERT_EQ(7, voices.group());
+  ASSERT_EQ(2u, voices.channel_count());
+}
+
+TEST_F(VoiceManagerTest, PlayOnAvailableChannel)
+{
+  cen::voice_manager voices{0, 2, 1};
+
+  Mix_GroupAvailable_fake.return_val = 1;
+  ASSERT_EQ(1, voices.play(m_soundA));
+
+  ASSERT_EQ(1, Mix_GroupAvailable_fake.arg0_val);
+  ASSERT_EQ(1u, Mix_PlayChannelTimed_fake.call_count);
+  ASSERT_EQ(&m_chunkA, Mix_PlayChannelTimed_fake.arg1_val);
+  ASSERT_EQ(0u, Mix_HaltChannel_fake.call_count);
+
+  ASSERT_EQ(1u, voices.voice_count());
+  ASSERT_EQ(0u, voices.steal_count());
+  ASSERT_EQ(0u, voices.rejection_count());
+}
+
+TEST_F(VoiceManagerTest, StealLowestPriority)
+{
+  cen::voice_manager voices{0, 2, 1};
+
+  std::array available{0, 1, -1};
+  SET_RETURN_SEQ(Mix_GroupAvailable, available.data(), cen::isize(available));
+
+  ASSERT_EQ(0, voices.play(m_soundA, 5));
+  ASSERT_EQ(1, voices.play(m_soundA, 2));
+
+  // Channel 1 has the lowest priority
+  ASSERT_EQ(1, voices.play(m_soundB, 3));
+  ASSERT_EQ(1u, Mix_HaltChannel_fake.call_count);
+  ASSERT_EQ(1, Mix_HaltChannel_fake.arg0_val);
+  ASSERT_EQ(1u, voices.steal_count());
+
+  // Both voices have a higher priority
+  ASSERT_FALSE(voices.play(m_soundB, 1));
+  ASSERT_EQ(1u, voices.rejection_count());
+  ASSERT_EQ(1u, Mix_HaltChannel_fake.call_count);
+}
+
+TEST_F(VoiceManagerTest, StealOldestOnEqualPriority)
+{
+  cen::voice_manager voices{0, 2, 1};
+
+  std::array available{1, 0, -1};
+  SET_RETURN_SEQ(Mix_GroupAvailable, available.data(), cen::isize(available));
+
+  ASSERT_EQ(1, voices.play(m_soundA));
+  ASSERT_EQ(0, voices.play(m_soundA));
+
+  ASSERT_EQ(1, voices.play(m_soundB));
+  ASSERT_EQ(1, Mix_HaltChannel_fake.arg0_val);
+}
+
+TEST_F(VoiceManagerTest, InstanceLimit)
+{
+  cen::voice_manager voices{0, 4, 1};
+  voices.set_instance_limit(m_soundA, 1);
+
+  ASSERT_EQ(1u, voices.instance_limit(m_soundA));
+
+  std::array available{2, 3};
+  SET_RETURN_SEQ(Mix_GroupAvailable, available.data(), cen::isize(available));
+
+  ASSERT_EQ(2, voices.play(m_soundA));
+
+  // The instance on channel 2 is replaced, even though channels are available
+  ASSERT_EQ(2, voices.play(m_soundA));
+  ASSERT_EQ(1u, Mix_GroupAvailable_fake.call_count);
+  ASSERT_EQ(1u, voices.steal_count());
+
+  // A less important instance is rejected
+  ASSERT_FALSE(voices.play(m_soundA, -1));
+  ASSERT_EQ(1u, voices.rejection_count());
+
+  voices.reset_instance_limit(m_soundA);
+  ASSERT_EQ(3, voices.play(m_soundA));
+}
+
+TEST_F(VoiceManagerTest, FinishedVoicesAreReused)
+{
+  cen::voice_manager voices{0, 1, 1};
+  ASSERT_EQ(0, voices.play(m_soundA, 10));
+
+  // The voice has finished, so it isn't stolen
+  Mix_Playing_fake.return_val = 0;
+  ASSERT_EQ(0u, voices.voice_count());
+  ASSERT_EQ(0, voices.play(m_soundB));
+
+  ASSERT_EQ(0u, voices.steal_count());
+  ASSERT_EQ(0u, voices.rejection_count());
+  ASSERT_EQ(0u, Mix_HaltChannel_fake.call_count);
+}
+
+TEST_F(VoiceManagerTest, PlayFailure)
+{
+  cen::voice_manager voices{0, 1, 1};
+
+  Mix_PlayChannelTimed_fake.custom_fake = nullptr;
+  Mix_PlayChannelTimed_fake.return_val = -1;
+
+  ASSERT_FALSE(voices.play(m_soundA));
+  ASSERT_EQ(1u, voices.rejection_count());
+  ASSERT_EQ(0u, voices.voice_count());
+}
+
+TEST_F(VoiceManagerTest, StopAll)
+{
+  cen::voice_manager voices{0, 1, 3};
+  ASSERT_EQ(0, voices.play(m_soundA));
+
+  voices.stop_all();
+  ASSERT_EQ(1u, Mix_HaltGroup_fake.call_count);
+  ASSERT_EQ(3, Mix_HaltGroup_fake.arg0_val);
+  ASSERT_EQ(0u, voices.voice_count());
+}
+
+TEST_F(VoiceManagerTest, ResetCounters)
+{
+  cen::voice_manager voices{0, 1, 1};
+
+  Mix_GroupAvailable_fake.return_val = -1;
+  ASSERT_FALSE(voices.play(m_soundA));
+  ASSERT_EQ(1u, voices.rejection_count());
+
+  voices.reset_counters();
+  ASSERT_EQ(0u, voices.rejection_count());
+  ASSERT_EQ(0u, voices.steal_count());
+}
@@ -2,7 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <array>    // array
+#include <cstddef>  // byte
+#include <string>   // string
+
 #include "core_mocks.hpp"
+#include "thread_mocks.hpp"
 
 class LibraryTest : public testing::Test
 {
@@ -10,6 +15,7 @@ class LibraryTest : public testing::Test
   void SetUp() override
   {
     mocks::reset_core();
+    mocks::reset_thread();
 
     // Sets up expected return values for OK initialization
     constexpr cen::config cfg;
@@ -75,3 +81,138 @@ TEST_F(LibraryTest, SDLMixOpenFailure)
   Mix_OpenAudio_fake.return_val = -1;
   ASSERT_THROW(cen::library{}, cen::mix_error);
 }
+
+TEST_F(LibraryTest, MixerDevice)
+{
+  cen::config cfg;
+  cfg.mixerFreq = 48'000;
+  cfg.mixerChunkSize = 256;
+  cfg.mixerDevice = "foo";
+
+  {
+    const cen::library library{cfg};
+
+    ASSERT_EQ(0u, Mix_OpenAudio_fake.call_count);
+    ASSERT_EQ(1u, Mix_OpenAudioDevice_fake.call_count);
+
+    ASSERT_EQ(48'000, Mix_OpenAudioDevice_fake.arg0_val);
+    ASSERT_EQ(cfg.mixerFormat, Mix_OpenAudioDevice_fake.arg1_val);
+    ASSERT_EQ(cfg.mixerChannels, Mix_OpenAudioDevice_fake.arg2_val);
+    ASSERT_EQ(256, Mix_OpenAudioDevice_fake.arg3_val);
+    ASSERT_STREQ("foo", Mix_OpenAudioDevice_fake.arg4_val);
+  }
+
+  Mix_OpenAudioDevice_fake.return_val = -1;
+  ASSERT_THROW(cen::library{cfg}, cen::mix_error);
+}
+
+TEST_F(LibraryTest, LazyInitialization)
+{
+  std::array<std::byte, 8> dummy{};
+  SDL_CreateMutex_fake.return_val = reinterpret_cast<SDL_mutex*>(dummy.data());
+
+  cen::config cfg;
+  cfg.coreFlags = SDL_INIT_VIDEO | SDL_INIT_EVENTS;
+  cfg.lazy = true;
+
+  const cen::library library{cfg};
+
+  ASSERT_EQ(1u, SDL_Init_fake.call_count);
+  ASSERT_EQ(cfg.coreFlags, SDL_Init_fake.arg0_val);
+
+  ASSERT_EQ(0u, TTF_Init_fake.call_count);
+  ASSERT_EQ(0u, IMG_Init_fake.call_count);
+  ASSERT_EQ(0u, Mix_Init_fake.call_count);
+
+  ASSERT_TRUE(library.is_initialized(cen::library_subsystem::core));
+  ASSERT_FALSE(library.is_initialized(cen::library_subsystem::ttf));
+
+  cen::library::ensure(cen::library_subsystem::ttf);
+  cen::library::ensure(cen::library_subsystem::ttf);
+  ASSERT_EQ(1u, TTF_Init_fake.call_count);
+  ASSERT_TRUE(library.is_initialized(cen::library_subsystem::ttf));
+
+  cen::library::ensure(cen::library_subsystem::mixer);
+  ASSERT_EQ(1u, Mix_Init_fake.call_count);
+  ASSERT_EQ(1u, Mix_OpenAudio_fake.call_count);
+
+  // The audio subsystem isn't enabled by the core flags
+  ASSERT_FALSE(library.is_initialized(cen::library_subsystem::audio));
+
+  const auto timings = library.timings();
+  ASSERT_EQ(3u, timings.size());
+  ASSERT_EQ(cen::library_subsystem::core, timings.at(0).subsystem);
+  ASSERT_EQ(cen::library_subsystem::ttf, timings.at(1).subsystem);
+  ASSERT_EQ(cen::library_subsystem::mixer, timings.at(2).subsystem);
+
+  ASSERT_FALSE(timings.at(0).deferred);
+  ASSERT_TRUE(timings.at(1).deferred);
+  ASSERT_FALSE(timings.at(1).async);
+}
+
+TEST_F(LibraryTest, LazyInitializationFailure)
+{
+  std::array<std::byte, 8> dummy{};
+  SDL_CreateMutex_fake.return_val = reinterpret_cast<SDL_mutex*>(dummy.data());
+
+  cen::config cfg;
+  cfg.lazy = true;
+
+  const cen::library library{cfg};
+
+  TTF_Init_fake.return_val = -1;
+  ASSERT_THROW(cen::library::ensure(cen::library_subsystem::ttf), cen::ttf_error);
+  ASSERT_FALSE(library.is_initialized(cen::library_subsystem::ttf));
+
+  TTF_Init_fake.return_val = 0;
+  ASSERT_NO_THROW(cen::library::ensure(cen::library_subsystem::ttf));
+  ASSERT_TRUE(library.is_initialized(cen::library_subsystem::ttf));
+}
+
+TEST_F(LibraryTest, TimingReport)
+{
+  const cen::library library;
+
+  const auto timings = library.timings();
+  ASSERT_EQ(4u, timings.size());
+  ASSERT_EQ(cen::library_subsystem::core, timings.at(0).subsystem);
+  ASSERT_EQ(cen::library_subsystem::image, timings.at(1).subsystem);
+  ASSERT_EQ(cen::library_subsystem::ttf, timings.at(2).subsystem);
+  ASSERT_EQ(cen::library_subsystem::mixer, timings.at(3).subsystem);
+
+  const auto report = library.timing_report();
+  ASSERT_NE(std::string::npos, report.find("core: "));
+  ASSERT_NE(std::string::npos, report.find("mixer: "));
+  ASSERT_NE(std::string::npos, report.find("total: "));
+  ASSERT_EQ(std::string::npos, report.find("deferred"));
+}
+
+TEST_F(LibraryTest, HeadlessConfiguration)
+{
+  const auto cfg = cen::headless_config();
+  ASSERT_EQ(static_cast<cen::u32>(SDL_INIT_TIMER | SDL_INIT_EVENTS), cfg.coreFlags);
+
+  const cen::library library{cfg};
+
+  ASSERT_EQ(1u, SDL_Init_fake.call_count);
+  ASSERT_EQ(cfg.coreFlags, SDL_Init_fake.arg0_val);
+
+  ASSERT_EQ(0u, TTF_Init_fake.call_count);
+  ASSERT_EQ(0u, IMG_Init_fake.call_count);
+  ASSERT_EQ(0u, Mix_Init_fake.call_count);
+  ASSERT_EQ(0u, Mix_OpenAudio_fake.call_count);
+
+  ASSERT_TRUE(library.is_initialized(cen::library_subsystem::core));
+  ASSERT_FALSE(library.is_initialized(cen::library_subsystem::audio));
+  ASSERT_FALSE(library.is_initialized(cen::library_subsystem::controller));
+  ASSERT_FALSE(library.is_initialized(cen::library_subsystem::mixer));
+
+  const auto timings = library.timings();
+  ASSERT_EQ(1u, timings.size());
+  ASSERT_EQ(cen::library_subsystem::core, timings.at(0).subsystem);
+
+  const auto report = library.timing_report();
+  ASSERT_NE(std::string::npos, report.find("core: "));
+  ASSERT_NE(std::string::npos, report.find(" MB"));
+  ASSERT_EQ(std::string::npos, report.find("mixer: "));
+}
@@ -11,6 +11,7 @@ DEFINE_FAKE_VALUE_FUNC(int, TTF_Init)
 DEFINE_FAKE_VALUE_FUNC(int, IMG_Init, int)
 DEFINE_FAKE_VALUE_FUNC(int, Mix_Init, int)
 DEFINE_FAKE_VALUE_FUNC(int, Mix_OpenAudio, int, Uint16, int, int)
+DEFINE_FAKE_VALUE_FUNC(int, Mix_OpenAudioDevice, int, Uint16, int, int, const char*, int)
 DEFINE_FAKE_VALUE_FUNC(SDL_Window*, SDL_CreateWindow, const char*, int, int, int, int, Uint32)
 
 DEFINE_FAKE_VOID_FUNC(SDL_Quit)
@@ -37,6 +38,7 @@ void reset_core()
   RESET_FAKE(TTF_Init)
   RESET_FAKE(IMG_Init)
   RESET_FAKE(Mix_OpenAudio)
+  RESET_FAKE(Mix_OpenAudioDevice)
   RESET_FAKE(SDL_CreateWindow)
 
   RESET_FAKE(SDL_Quit)
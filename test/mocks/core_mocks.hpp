@@ -11,6 +11,7 @@ DECLARE_FAKE_VALUE_FUNC(int, TTF_Init)
 DECLARE_FAKE_VALUE_FUNC(int, IMG_Init, int)
 DECLARE_FAKE_VALUE_FUNC(int, Mix_Init, int)
 DECLARE_FAKE_VALUE_FUNC(int, Mix_OpenAudio, int, Uint16, int, int)
+DECLARE_FAKE_VALUE_FUNC(int, Mix_OpenAudioDevice, int, Uint16, int, int, const char*, int)
 DECLARE_FAKE_VALUE_FUNC(SDL_Window*, SDL_CreateWindow, const char*, int, int, int, int, Uint32)
 
 // Cleanup
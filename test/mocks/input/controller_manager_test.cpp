@@ -0,0 +1,209 @@
+#include "input/controller_manager.hpp"
+
+#include <fff.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>  // uintptr_t
+
+#include "core_mocks.hpp"
+
+// clang-format off
+extern "C" {
+FAKE_VALUE_FUNC(SDL_GameController*, SDL_GameControllerOpen, int)
+FAKE_VOID_FUNC(SDL_GameControllerClose, SDL_GameController*)
+
+// Defined in input/joystick_test.cpp
+DECLARE_FAKE_VALUE_FUNC(int, SDL_NumJoysticks)
+DECLARE_FAKE_VALUE_FUNC(SDL_JoystickID, SDL_JoystickInstanceID, SDL_Joystick*)
+DECLARE_FAKE_VALUE_FUNC(SDL_JoystickID, SDL_JoystickGetDeviceInstanceID, int)
+
+// Defined in input/controller_test.cpp
+DECLARE_FAKE_VOID_FUNC(SDL_GameControllerSetPlayerIndex, SDL_GameController*, int)
+DECLARE_FAKE_VALUE_FUNC(SDL_bool, SDL_IsGameController, int)
+DECLARE_FAKE_VALUE_FUNC(SDL_Joystick*, SDL_GameControllerGetJoystick, SDL_GameController*)
+DECLARE_FAKE_VALUE_FUNC(const char*, SDL_GameControllerName, SDL_GameController*)
+DECLARE_FAKE_VALUE_FUNC(const char*, SDL_GameControllerGetSerial, SDL_GameController*)
+DECLARE_FAKE_VALUE_FUNC(Uint16, SDL_GameControllerGetProduct, SDL_GameController*)
+DECLARE_FAKE_VALUE_FUNC(Uint16, SDL_GameControllerGetVendor, SDL_GameController*)
+DECLARE_FAKE_VALUE_FUNC(Uint8, SDL_GameControllerGetButton, SDL_GameController*, SDL_GameControllerButton)
+DECLARE_FAKE_VALUE_FUNC(Sint16, SDL_GameControllerGetAxis, SDL_GameController*, SDL_GameControllerAxis)
+DECLARE_FAKE_VALUE_FUNC(int, SDL_GameControllerGetNumTouchpads, SDL_GameController*)
+DECLARE_FAKE_VALUE_FUNC(SDL_bool, SDL_GameControllerHasSensor, SDL_GameController*, SDL_SensorType)
+DECLARE_FAKE_VALUE_FUNC(SDL_bool, SDL_GameControllerHasLED, SDL_GameController*)
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+DECLARE_FAKE_VALUE_FUNC(SDL_GameControllerType, SDL_GameControllerGetType, SDL_GameController*)
+#endif // SDL_VERSION_ATLEAST(2, 0, 12)
+}
+// clang-format on
+
+namespace {
+
+// Each fake device index maps to a fake controller, joystick and instance ID
+inline constexpr int device_count = 2;
+
+[[nodiscard]] auto fake_controller(const int index) -> SDL_GameController*
+{
+  return reinterpret_cast<SDL_GameController*>(static_cast<std::uintptr_t>(index + 1));
+}
+
+[[nodiscard]] auto make_device_event(const cen::event_type type, const int which)
+    -> cen::controller_device_event
+{
+  cen::controller_device_event event;
+  event.set_type(type);
+  event.set_which(which);
+  return event;
+}
+
+}  // namespace
+
+class ControllerManagerTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    mocks::reset_core();
+
+    RESET_FAKE(SDL_GameControllerOpen)
+    RESET_FAKE(SDL_GameControllerClose)
+    RESET_FAKE(SDL_NumJoysticks)
+    RESET_FAKE(SDL_JoystickInstanceID)
+    RESET_FAKE(SDL_JoystickGetDeviceInstanceID)
+    RESET_FAKE(SDL_GameControllerSetPlayerIndex)
+    RESET_FAKE(SDL_IsGameController)
+    RESET_FAKE(SDL_GameControllerGetJoystick)
+    RESET_FAKE(SDL_GameControllerName)
+    RESET_FAKE(SDL_GameControllerGetSerial)
+    RESET_FAKE(SDL_GameControllerGetProduct)
+    RESET_FAKE(SDL_GameControllerGetVendor)
+    RESET_FAKE(SDL_GameControllerGetButton)
+    RESET_FAKE(SDL_GameControllerGetAxis)
+    RESET_FAKE(SDL_GameControllerGetNumTouchpads)
+    RESET_FAKE(SDL_GameControllerHasSensor)
+    RESET_FAKE(SDL_GameControllerHasLED)
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+    RESET_FAKE(SDL_GameControllerGetType)
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+    SDL_NumJoysticks_fake.return_val = device_count;
+    SDL_IsGameController_fake.return_val = SDL_TRUE;
+    SDL_GameControllerName_fake.return_val = "Pad";
+    SDL_GameControllerGetVendor_fake.return_val = 42;
+
+    // Instance IDs are the device index plus 10
+    SDL_JoystickGetDeviceInstanceID_fake.custom_fake = [](const int index) {
+      return index < device_count ? index + 10 : -1;
+    };
+
+    SDL_GameControllerOpen_fake.custom_fake = [](const int index) {
+      return fake_controller(index);
+    };
+
+    SDL_GameControllerGetJoystick_fake.custom_fake = [](SDL_GameController* controller) {
+      return reinterpret_cast<SDL_Joystick*>(controller);
+    };
+
+    SDL_JoystickInstanceID_fake.custom_fake = [](SDL_Joystick* joystick) {
+      return static_cast<SDL_JoystickID>(reinterpret_cast<std::uintptr_t>(joystick) - 1 + 10);
+    };
+  }
+};
+
+TEST_F(ControllerManagerTest, OpenAll)
+{
+  cen::controller_manager manager;
+  ASSERT_EQ(2u, manager.open_all());
+  ASSERT_EQ(2u, manager.count());
+  ASSERT_EQ(2u, SDL_GameControllerOpen_fake.call_count);
+
+  ASSERT_TRUE(manager.is_connected(0));
+  ASSERT_TRUE(manager.is_connected(1));
+  ASSERT_FALSE(manager.is_connected(2));
+
+  ASSERT_EQ(0u, manager.slot_of(10));
+  ASSERT_EQ(1u, manager.slot_of(11));
+
+  const auto* info = manager.info(1);
+  ASSERT_TRUE(info);
+  ASSERT_EQ(11, info->id);
+  ASSERT_EQ("Pad", info->name);
+  ASSERT_EQ(42, info->vendor);
+  ASSERT_FALSE(info->product);
+
+  // Controllers that are already managed are not opened again
+  ASSERT_EQ(0u, manager.open_all());
+  ASSERT_EQ(2u, SDL_GameControllerOpen_fake.call_count);
+}
+
+TEST_F(ControllerManagerTest, HotPlug)
+{
+  cen::controller_manager manager;
+
+  const auto added = make_device_event(cen::event_type::controller_device_added, 1);
+  ASSERT_EQ(0u, manager.feed(added));
+  ASSERT_EQ(0u, manager.slot_of(11));
+  ASSERT_FALSE(manager.feed(added));
+
+  const auto removed = make_device_event(cen::event_type::controller_device_removed, 11);
+  ASSERT_EQ(0u, manager.feed(removed));
+  ASSERT_EQ(0u, manager.count());
+  ASSERT_FALSE(manager.info(0));
+  ASSERT_EQ(1u, SDL_GameControllerClose_fake.call_count);
+  ASSERT_FALSE(manager.feed(removed));
+
+  const auto invalid = make_device_event(cen::event_type::controller_device_added, 7);
+  ASSERT_FALSE(manager.feed(invalid));
+}
+
+TEST_F(ControllerManagerTest, Remap)
+{
+  cen::controller_manager manager;
+  manager.open_all();
+
+  SDL_GameControllerName_fake.return_val = "Remapped";
+
+  const auto remapped = make_device_event(cen::event_type::controller_device_remapped, 10);
+  ASSERT_EQ(0u, manager.feed(remapped));
+  ASSERT_EQ("Remapped", manager.info(0)->name);
+  ASSERT_EQ("Pad", manager.info(1)->name);
+}
+
+TEST_F(ControllerManagerTest, Update)
+{
+  cen::controller_manager manager;
+  manager.open_all();
+
+  SDL_GameControllerGetButton_fake.custom_fake = [](SDL_GameController* controller,
+                                                    const SDL_GameControllerButton button) {
+    const auto pressed = controller == fake_controller(1) && button == SDL_CONTROLLER_BUTTON_A;
+    return static_cast<Uint8>(pressed ? SDL_PRESSED : SDL_RELEASED);
+  };
+
+  SDL_GameControllerGetAxis_fake.return_val = 1'000;
+
+  manager.update();
+
+  const auto& snapshot = manager.snapshot();
+  ASSERT_FALSE(snapshot.is_pressed(0, cen::controller_button::a));
+  ASSERT_TRUE(snapshot.is_pressed(1, cen::controller_button::a));
+  ASSERT_TRUE(snapshot.just_pressed(1, cen::controller_button::a));
+  ASSERT_FALSE(snapshot.is_pressed(1, cen::controller_button::b));
+
+  ASSERT_EQ(1'000, snapshot.axis(0, cen::controller_axis::left_x));
+  ASSERT_EQ(1'000, snapshot.axis(cen::controller_axis::right_y)[1]);
+  ASSERT_EQ(0, snapshot.axis(cen::controller_axis::right_y)[2]);
+
+  manager.update();
+  ASSERT_TRUE(snapshot.is_pressed(1, cen::controller_button::a));
+  ASSERT_FALSE(snapshot.just_pressed(1, cen::controller_button::a));
+
+  manager.close(1);
+  ASSERT_FALSE(snapshot.is_pressed(1, cen::controller_button::a));
+  ASSERT_EQ(0, snapshot.axis(1, cen::controller_axis::left_x));
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+  ASSERT_EQ(2u, SDL_GameControllerSetPlayerIndex_fake.call_count);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+}
@@ -76,6 +76,10 @@ FAKE_VALUE_FUNC(float, SDL_GameControllerGetSensorDataRate, SDL_GameController*,
 FAKE_VALUE_FUNC(int, SDL_GameControllerSendEffect, SDL_GameController*, const void*, int)
 #endif // SDL_VERSION_ATLEAST(2, 0, 16)
 
+// Defined in input/joystick_test.cpp
+DECLARE_FAKE_VOID_FUNC(SDL_LockJoysticks)
+DECLARE_FAKE_VOID_FUNC(SDL_UnlockJoysticks)
+
 } // extern "C"
 // clang-format on
 
@@ -86,6 +90,8 @@ class ControllerTest : public testing::Test
   {
     mocks::reset_core();
 
+    RESET_FAKE(SDL_LockJoysticks)
+    RESET_FAKE(SDL_UnlockJoysticks)
     RESET_FAKE(SDL_GameControllerUpdate)
     RESET_FAKE(SDL_GameControllerSetPlayerIndex)
     RESET_FAKE(SDL_GameControllerGetProduct)
@@ -263,6 +269,26 @@ TEST_F(ControllerTest, GetAxis)
   ASSERT_EQ(321, m_controller.get_axis(cen::controller_axis::left_x));
 }
 
+TEST_F(ControllerTest, Snapshot)
+{
+  SDL_GameControllerGetAxis_fake.return_val = 42;
+  SDL_GameControllerGetButton_fake.custom_fake = [](SDL_GameController*,
+                                                    const SDL_GameControllerButton button) {
+    const auto pressed = button == SDL_CONTROLLER_BUTTON_B;
+    return static_cast<Uint8>(pressed ? SDL_PRESSED : SDL_RELEASED);
+  };
+
+  const auto state = m_controller.snapshot();
+  ASSERT_EQ(1u, SDL_LockJoysticks_fake.call_count);
+  ASSERT_EQ(1u, SDL_UnlockJoysticks_fake.call_count);
+  ASSERT_EQ(cen::controller_state::button_count, SDL_GameControllerGetButton_fake.call_count);
+  ASSERT_EQ(cen::controller_state::axis_count, SDL_GameControllerGetAxis_fake.call_count);
+
+  ASSERT_TRUE(state.is_pressed(cen::controller_button::b));
+  ASSERT_FALSE(state.is_pressed(cen::controller_button::a));
+  ASSERT_EQ(42, state.axis(cen::controller_axis::trigger_left));
+}
+
 TEST_F(ControllerTest, GetJoystick)
 {
   ASSERT_NO_THROW(m_controller.get_joystick());
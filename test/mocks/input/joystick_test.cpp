@@ -387,6 +387,42 @@ TEST_F(JoystickTest, Unlock)
   ASSERT_EQ(1u, SDL_UnlockJoysticks_fake.call_count);
 }
 
+TEST_F(JoystickTest, Snapshot)
+{
+  SDL_JoystickNumAxes_fake.return_val = 3;
+  SDL_JoystickNumButtons_fake.return_val = 70;
+  SDL_JoystickNumHats_fake.return_val = 1;
+  SDL_JoystickNumBalls_fake.return_val = 0;
+
+  SDL_JoystickGetAxis_fake.return_val = 7;
+  SDL_JoystickGetHat_fake.return_val = SDL_HAT_UP;
+  SDL_JoystickGetButton_fake.custom_fake = [](SDL_Joystick*, const int button) {
+    return static_cast<Uint8>(button == 2 || button == 63 ? SDL_PRESSED : SDL_RELEASED);
+  };
+
+  const auto state = m_joystick.snapshot();
+  ASSERT_EQ(1u, SDL_LockJoysticks_fake.call_count);
+  ASSERT_EQ(1u, SDL_UnlockJoysticks_fake.call_count);
+
+  ASSERT_EQ(3, state.axisCount);
+  ASSERT_EQ(cen::joystick_state::max_buttons, state.buttonCount);
+  ASSERT_EQ(1, state.hatCount);
+  ASSERT_EQ(0, state.ballCount);
+
+  ASSERT_EQ(3u, SDL_JoystickGetAxis_fake.call_count);
+  ASSERT_EQ(64u, SDL_JoystickGetButton_fake.call_count);
+  ASSERT_EQ(0u, SDL_JoystickGetBall_fake.call_count);
+
+  ASSERT_EQ(7, state.axes[2]);
+  ASSERT_EQ(0, state.axes[3]);
+  ASSERT_EQ(cen::hat_state::up, state.hats[0]);
+
+  ASSERT_TRUE(state.is_pressed(2));
+  ASSERT_TRUE(state.is_pressed(63));
+  ASSERT_FALSE(state.is_pressed(0));
+  ASSERT_FALSE(state.is_pressed(64));
+}
+
 TEST_F(JoystickTest, SetPolling)
 {
   cen::joystick::set_polling(true);
@@ -0,0 +1,68 @@
+#include "input/sensor_stream.hpp"
+
+#include <fff.h>
+#include <gtest/gtest.h>
+
+#include "core_mocks.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+extern "C"
+{
+  FAKE_VOID_FUNC(SDL_AddEventWatch, SDL_EventFilter, void*)
+  FAKE_VOID_FUNC(SDL_DelEventWatch, SDL_EventFilter, void*)
+}
+
+class SensorStreamTest : public testing::Test
+{
+ public:
+  void SetUp() override
+  {
+    mocks::reset_core();
+
+    RESET_FAKE(SDL_AddEventWatch)
+    RESET_FAKE(SDL_DelEventWatch)
+  }
+};
+
+TEST_F(SensorStreamTest, EventWatch)
+{
+  {
+    cen::sensor_stream stream{42};
+    ASSERT_EQ(1u, SDL_AddEventWatch_fake.call_count);
+    ASSERT_EQ(&stream, SDL_AddEventWatch_fake.arg1_val);
+
+    const auto watch = SDL_AddEventWatch_fake.arg0_val;
+
+    SDL_Event event{};
+    event.csensor.type = SDL_CONTROLLERSENSORUPDATE;
+    event.csensor.timestamp = 5;
+    event.csensor.sensor = SDL_SENSOR_GYRO;
+    event.csensor.which = 42;
+    event.csensor.data[0] = 0.5f;
+    watch(&stream, &event);
+
+    // Sensor events of other controllers are ignored
+    event.csensor.which = 43;
+    watch(&stream, &event);
+
+    // Other event types are ignored
+    event.type = SDL_CONTROLLERAXISMOTION;
+    watch(&stream, &event);
+
+    ASSERT_EQ(1u, stream.size());
+
+    cen::sensor_sample sample;
+    ASSERT_EQ(1u, stream.read(&sample, 1));
+    ASSERT_EQ(cen::sensor_type::gyroscope, sample.type);
+    ASSERT_EQ(5'000u, sample.timestamp);
+    ASSERT_EQ(0.5f, sample.data[0]);
+
+    ASSERT_EQ(0u, SDL_DelEventWatch_fake.call_count);
+  }
+
+  ASSERT_EQ(1u, SDL_DelEventWatch_fake.call_count);
+  ASSERT_EQ(SDL_AddEventWatch_fake.arg0_val, SDL_DelEventWatch_fake.arg0_val);
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
@@ -5,6 +5,8 @@ extern "C"
   DEFINE_FAKE_VALUE_FUNC(const char*, Mix_GetChunkDecoder, int)
   DEFINE_FAKE_VALUE_FUNC(SDL_bool, Mix_HasChunkDecoder, const char*)
   DEFINE_FAKE_VALUE_FUNC(int, Mix_GetNumChunkDecoders)
+  DEFINE_FAKE_VALUE_FUNC(int, Mix_PlayChannelTimed, int, Mix_Chunk*, int, int)
+  DEFINE_FAKE_VALUE_FUNC(int, Mix_Playing, int)
 }
 
 namespace mocks {
@@ -14,6 +16,8 @@ void reset_mixer()
   RESET_FAKE(Mix_GetChunkDecoder)
   RESET_FAKE(Mix_HasChunkDecoder)
   RESET_FAKE(Mix_GetNumChunkDecoders)
+  RESET_FAKE(Mix_PlayChannelTimed)
+  RESET_FAKE(Mix_Playing)
 }
 
 }  // namespace mocks
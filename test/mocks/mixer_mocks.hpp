@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SDL.h>
+#include <SDL_mixer.h>
 #include <fff.h>
 
 extern "C"
@@ -8,6 +9,8 @@ extern "C"
   DECLARE_FAKE_VALUE_FUNC(const char*, Mix_GetChunkDecoder, int)
   DECLARE_FAKE_VALUE_FUNC(SDL_bool, Mix_HasChunkDecoder, const char*)
   DECLARE_FAKE_VALUE_FUNC(int, Mix_GetNumChunkDecoders)
+  DECLARE_FAKE_VALUE_FUNC(int, Mix_PlayChannelTimed, int, Mix_Chunk*, int, int)
+  DECLARE_FAKE_VALUE_FUNC(int, Mix_Playing, int)
 }
 
 namespace mocks {
@@ -0,0 +1,109 @@
+#include "video/opengl/gl_loader.hpp"
+
+#include <fff.h>
+#include <gtest/gtest.h>
+
+#include <array>  // array
+
+#include "core/integers.hpp"
+#include "core_mocks.hpp"
+
+extern "C"
+{
+  // Defined in video/gl/gl_library_test.cpp and video/gl/gl_core_test.cpp
+  DECLARE_FAKE_VALUE_FUNC(void*, SDL_GL_GetProcAddress, const char*)
+  DECLARE_FAKE_VALUE_FUNC(SDL_bool, SDL_GL_ExtensionSupported, const char*)
+}
+
+namespace {
+
+void fake_clear(unsigned)
+{}
+
+struct clear final
+{
+  using type = void (*)(unsigned);
+  inline constexpr static cen::str name = "glClear";
+};
+
+struct flush final
+{
+  using type = void (*)();
+  inline constexpr static cen::str name = "glFlush";
+};
+
+}  // namespace
+
+class OpenGLLoaderTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    mocks::reset_core();
+
+    RESET_FAKE(SDL_GL_GetProcAddress)
+    RESET_FAKE(SDL_GL_ExtensionSupported)
+  }
+};
+
+TEST_F(OpenGLLoaderTest, FunctionTable)
+{
+  std::array<void*, 2> values{reinterpret_cast<void*>(&fake_clear), nullptr};
+  SET_RETURN_SEQ(SDL_GL_GetProcAddress, values.data(), cen::isize(values));
+
+  const cen::gl::function_table<clear, flush> functions;
+  ASSERT_EQ(2u, SDL_GL_GetProcAddress_fake.call_count);
+  ASSERT_STREQ("glClear", SDL_GL_GetProcAddress_fake.arg0_history[0]);
+  ASSERT_STREQ("glFlush", SDL_GL_GetProcAddress_fake.arg0_history[1]);
+
+  ASSERT_EQ(&fake_clear, functions.get<clear>());
+  ASSERT_EQ(nullptr, functions.get<flush>());
+
+  ASSERT_TRUE(functions.is_loaded<clear>());
+  ASSERT_FALSE(functions.is_loaded<flush>());
+  ASSERT_EQ(1u, functions.loaded_count());
+  ASSERT_FALSE(functions.is_complete());
+
+  // Lookups don't resolve the functions again
+  ASSERT_EQ(2u, SDL_GL_GetProcAddress_fake.call_count);
+}
+
+TEST_F(OpenGLLoaderTest, FunctionTableReload)
+{
+  std::array<void*, 4> values{nullptr,
+                              nullptr,
+                              reinterpret_cast<void*>(&fake_clear),
+                              reinterpret_cast<void*>(&fake_clear)};
+  SET_RETURN_SEQ(SDL_GL_GetProcAddress, values.data(), cen::isize(values));
+
+  cen::gl::function_table<clear, flush> functions;
+  ASSERT_EQ(0u, functions.loaded_count());
+
+  functions.reload();
+  ASSERT_TRUE(functions.is_complete());
+  ASSERT_EQ(4u, SDL_GL_GetProcAddress_fake.call_count);
+}
+
+TEST_F(OpenGLLoaderTest, ExtensionSet)
+{
+  std::array values{SDL_TRUE, SDL_FALSE, SDL_TRUE};
+  SET_RETURN_SEQ(SDL_GL_ExtensionSupported, values.data(), cen::isize(values));
+
+  const cen::gl::extension_set extensions{
+      std::array<cen::str, 3>{"GL_KHR_debug", "GL_ARB_foo", "GL_ARB_bar"}};
+  ASSERT_EQ(3u, SDL_GL_ExtensionSupported_fake.call_count);
+
+  ASSERT_TRUE(extensions.supports(0));
+  ASSERT_FALSE(extensions.supports(1));
+  ASSERT_TRUE(extensions.supports(2));
+
+  ASSERT_TRUE(extensions.supports("GL_KHR_debug"));
+  ASSERT_FALSE(extensions.supports("GL_ARB_foo"));
+  ASSERT_FALSE(extensions.supports("GL_ARB_unknown"));
+
+  ASSERT_EQ(2u, extensions.supported_count());
+  ASSERT_EQ(0b101u, extensions.bits().to_ulong());
+
+  // Queries are cached
+  ASSERT_EQ(3u, SDL_GL_ExtensionSupported_fake.call_count);
+}
@@ -25,6 +25,12 @@ FAKE_VALUE_FUNC(int, SDL_RenderDrawLine, SDL_Renderer*, int, int, int, int)
 FAKE_VALUE_FUNC(int, SDL_RenderDrawLineF, SDL_Renderer*, float, float, float, float)
 FAKE_VALUE_FUNC(int, SDL_RenderDrawLines, SDL_Renderer*, const SDL_Point*, int)
 FAKE_VALUE_FUNC(int, SDL_RenderDrawLinesF, SDL_Renderer*, const SDL_FPoint*, int)
+FAKE_VALUE_FUNC(int, SDL_RenderDrawPoints, SDL_Renderer*, const SDL_Point*, int)
+FAKE_VALUE_FUNC(int, SDL_RenderDrawPointsF, SDL_Renderer*, const SDL_FPoint*, int)
+FAKE_VALUE_FUNC(int, SDL_RenderDrawRects, SDL_Renderer*, const SDL_Rect*, int)
+FAKE_VALUE_FUNC(int, SDL_RenderDrawRectsF, SDL_Renderer*, const SDL_FRect*, int)
+FAKE_VALUE_FUNC(int, SDL_RenderFillRects, SDL_Renderer*, const SDL_Rect*, int)
+FAKE_VALUE_FUNC(int, SDL_RenderFillRectsF, SDL_Renderer*, const SDL_FRect*, int)
 FAKE_VALUE_FUNC(int, SDL_RenderCopy, SDL_Renderer*, SDL_Texture*, const SDL_Rect*, const SDL_Rect*)
 FAKE_VALUE_FUNC(int, SDL_RenderCopyF, SDL_Renderer*, SDL_Texture*, const SDL_Rect*, const SDL_FRect*)
 FAKE_VALUE_FUNC(int, SDL_RenderCopyEx, SDL_Renderer*, SDL_Texture*, const SDL_Rect*, const SDL_Rect*, double, const SDL_Point*, SDL_RendererFlip)
@@ -62,6 +68,12 @@ class RendererTest : public testing::Test
     RESET_FAKE(SDL_RenderDrawLineF)
     RESET_FAKE(SDL_RenderDrawLines)
     RESET_FAKE(SDL_RenderDrawLinesF)
+    RESET_FAKE(SDL_RenderDrawPoints)
+    RESET_FAKE(SDL_RenderDrawPointsF)
+    RESET_FAKE(SDL_RenderDrawRects)
+    RESET_FAKE(SDL_RenderDrawRectsF)
+    RESET_FAKE(SDL_RenderFillRects)
+    RESET_FAKE(SDL_RenderFillRectsF)
     RESET_FAKE(SDL_RenderCopy)
     RESET_FAKE(SDL_RenderCopyF)
     RESET_FAKE(SDL_RenderCopyEx)
@@ -275,6 +287,103 @@ TEST_F(RendererTest, DrawLines)
   }
 }
 
+TEST_F(RendererTest, DrawPoints)
+{
+  {
+    std::array<cen::ipoint, 3> points{{{11, 22}, {33, 44}, {55, 66}}};
+    m_renderer.draw_points(points);
+    ASSERT_EQ(1u, SDL_RenderDrawPoints_fake.call_count);
+    ASSERT_EQ(0u, SDL_RenderDrawPointsF_fake.call_count);
+    ASSERT_EQ(3, SDL_RenderDrawPoints_fake.arg2_val);
+
+    for (auto i = 0u; i < points.size(); ++i) {
+      ASSERT_EQ(points.at(i).x(), SDL_RenderDrawPoints_fake.arg1_val[i].x);
+      ASSERT_EQ(points.at(i).y(), SDL_RenderDrawPoints_fake.arg1_val[i].y);
+    }
+  }
+
+  {
+    std::array<cen::fpoint, 2> points{{{11, 22}, {33, 44}}};
+    m_renderer.draw_points(points);
+    ASSERT_EQ(1u, SDL_RenderDrawPoints_fake.call_count);
+    ASSERT_EQ(1u, SDL_RenderDrawPointsF_fake.call_count);
+    ASSERT_EQ(2, SDL_RenderDrawPointsF_fake.arg2_val);
+  }
+
+  {
+    const std::array<cen::fpoint, 0> points{};
+    ASSERT_FALSE(m_renderer.draw_points(points));
+    ASSERT_EQ(1u, SDL_RenderDrawPointsF_fake.call_count);
+  }
+}
+
+TEST_F(RendererTest, DrawRects)
+{
+  {
+    std::array<cen::irect, 2> rects{{{{1, 2}, {3, 4}}, {{5, 6}, {7, 8}}}};
+    m_renderer.draw_rects(rects);
+    ASSERT_EQ(1u, SDL_RenderDrawRects_fake.call_count);
+    ASSERT_EQ(0u, SDL_RenderDrawRectsF_fake.call_count);
+    ASSERT_EQ(2, SDL_RenderDrawRects_fake.arg2_val);
+
+    for (auto i = 0u; i < rects.size(); ++i) {
+      ASSERT_EQ(rects.at(i).x(), SDL_RenderDrawRects_fake.arg1_val[i].x);
+      ASSERT_EQ(rects.at(i).height(), SDL_RenderDrawRects_fake.arg1_val[i].h);
+    }
+  }
+
+  {
+    std::array<cen::frect, 1> rects{{{{1, 2}, {3, 4}}}};
+    m_renderer.draw_rects(rects);
+    ASSERT_EQ(1u, SDL_RenderDrawRectsF_fake.call_count);
+    ASSERT_EQ(1, SDL_RenderDrawRectsF_fake.arg2_val);
+  }
+}
+
+TEST_F(RendererTest, FillRects)
+{
+  {
+    std::array<cen::irect, 2> rects{{{{1, 2}, {3, 4}}, {{5, 6}, {7, 8}}}};
+    m_renderer.fill_rects(rects);
+    ASSERT_EQ(1u, SDL_RenderFillRects_fake.call_count);
+    ASSERT_EQ(0u, SDL_RenderFillRectsF_fake.call_count);
+    ASSERT_EQ(2, SDL_RenderFillRects_fake.arg2_val);
+
+    for (auto i = 0u; i < rects.size(); ++i) {
+      ASSERT_EQ(rects.at(i).y(), SDL_RenderFillRects_fake.arg1_val[i].y);
+      ASSERT_EQ(rects.at(i).width(), SDL_RenderFillRects_fake.arg1_val[i].w);
+    }
+  }
+
+  {
+    std::array<cen::frect, 1> rects{{{{1, 2}, {3, 4}}}};
+    m_renderer.fill_rects(rects);
+    ASSERT_EQ(1u, SDL_RenderFillRectsF_fake.call_count);
+    ASSERT_EQ(1, SDL_RenderFillRectsF_fake.arg2_val);
+  }
+}
+
+TEST_F(RendererTest, DrawCircle)
+{
+  m_renderer.draw_circle(cen::fpoint{100, 100}, 10);
+  ASSERT_EQ(0u, SDL_RenderDrawPoint_fake.call_count);
+  ASSERT_EQ(0u, SDL_RenderDrawPointF_fake.call_count);
+  ASSERT_EQ(1u, SDL_RenderDrawPointsF_fake.call_count);
+
+  // Large circles are submitted in a few chunks
+  m_renderer.draw_circle(cen::ipoint{100, 100}, 500);
+  ASSERT_GT(SDL_RenderDrawPointsF_fake.call_count, 2u);
+  ASSERT_LT(SDL_RenderDrawPointsF_fake.call_count, 30u);
+}
+
+TEST_F(RendererTest, FillCircle)
+{
+  m_renderer.fill_circle({100, 100}, 10);
+  ASSERT_EQ(0u, SDL_RenderDrawLineF_fake.call_count);
+  ASSERT_EQ(1u, SDL_RenderFillRectsF_fake.call_count);
+  ASSERT_EQ(20, SDL_RenderFillRectsF_fake.arg2_val);
+}
+
 TEST_F(RendererTest, RenderWithPoint)
 {
   {
@@ -3,7 +3,8 @@
 #include <fff.h>
 #include <gtest/gtest.h>
 
-#include <array>  // array
+#include <array>   // array
+#include <vector>  // vector
 
 #include "core_mocks.hpp"
 
@@ -65,6 +66,18 @@ TEST_F(VulkanCoreTest, RequiredExtensions)
   ASSERT_TRUE(cen::vk::required_extensions());
 }
 
+TEST_F(VulkanCoreTest, RequiredExtensionsBuffer)
+{
+  std::array values{SDL_TRUE, SDL_TRUE, SDL_FALSE};
+  SET_RETURN_SEQ(SDL_Vulkan_GetInstanceExtensions, values.data(), cen::isize(values));
+
+  std::vector<cen::str> names;
+  ASSERT_EQ(cen::success, cen::vk::required_extensions(names));
+  ASSERT_EQ(cen::failure, cen::vk::required_extensions(names));
+  ASSERT_TRUE(names.empty());
+  ASSERT_EQ(3u, SDL_Vulkan_GetInstanceExtensions_fake.call_count);
+}
+
 TEST_F(VulkanCoreTest, DrawableSize)
 {
   std::array flags{cen::u32{cen::window::vulkan}};
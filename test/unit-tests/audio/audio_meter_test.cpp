@@ -0,0 +1,115 @@
+#include "audio/audio_meter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>        // sqrt
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+static_assert(!std::is_copy_constructible_v<cen::audio_meter>);
+static_assert(!std::is_copy_assignable_v<cen::audio_meter>);
+
+namespace {
+
+// Creates a buffer with a constant sample value, in the format of the audio device
+[[nodiscard]] auto make_buffer(const cen::mixer_spec& spec,
+                               const cen::usize frames,
+                               const float value) -> std::vector<cen::u8>
+{
+  const auto samples = frames * static_cast<cen::usize>(spec.channels);
+  std::vector<cen::u8> buffer(frames * static_cast<cen::usize>(spec.frame_size()));
+
+  if (spec.format == AUDIO_S16SYS) {
+    auto* data = reinterpret_cast<cen::i16*>(buffer.data());
+    for (cen::usize index = 0; index < samples; ++index) {
+      data[index] = static_cast<cen::i16>(value * 32'768.0f);
+    }
+  }
+  else if (spec.format == AUDIO_F32SYS) {
+    auto* data = reinterpret_cast<float*>(buffer.data());
+    for (cen::usize index = 0; index < samples; ++index) {
+      data[index] = value;
+    }
+  }
+
+  return buffer;
+}
+
+}  // namespace
+
+TEST(AudioMeter, ToDecibels)
+{
+  ASSERT_FLOAT_EQ(0.0f, cen::to_decibels(1.0f));
+  ASSERT_NEAR(-6.0206f, cen::to_decibels(0.5f), 1e-4);
+  ASSERT_FLOAT_EQ(-100.0f, cen::to_decibels(0.0f));
+}
+
+TEST(AudioMeter, Defaults)
+{
+  const cen::audio_meter meter{2};
+
+  ASSERT_EQ(2u, meter.bus_count());
+  ASSERT_EQ(0u, meter.attached());
+  ASSERT_EQ(0u, meter.buffers());
+  ASSERT_FALSE(meter.is_installed());
+
+  const auto levels = meter.levels(1);
+  ASSERT_EQ(meter.spec().channels, levels.channels);
+  ASSERT_EQ(0.0f, levels.max_peak());
+  ASSERT_EQ(0.0f, levels.max_rms());
+}
+
+TEST(AudioMeter, Measure)
+{
+  cen::audio_meter meter{2};
+
+  const auto& spec = meter.spec();
+  if (spec.format != AUDIO_S16SYS && spec.format != AUDIO_F32SYS) {
+    GTEST_SKIP() << "Unsupported mixer format";
+  }
+
+  const auto loud = make_buffer(spec, 256, 0.5f);
+  const auto quiet = make_buffer(spec, 256, 0.25f);
+
+  // Two channels on the first bus, at full and half volume
+  meter.measure(0, loud.data(), loud.size());
+  meter.measure(0, quiet.data(), quiet.size(), 0.5f);
+  meter.process(loud.data(), loud.size());
+
+  ASSERT_EQ(1u, meter.buffers());
+
+  const auto first = meter.levels(0);
+  ASSERT_FLOAT_EQ(0.5f, first.max_peak());
+  ASSERT_NEAR(std::sqrt(0.25f + 0.015625f), first.max_rms(), 1e-4);
+  ASSERT_FLOAT_EQ(0.5f, first.held[0]);
+
+  ASSERT_EQ(0.0f, meter.levels(1).max_peak());
+  ASSERT_FLOAT_EQ(0.5f, meter.output_levels().max_rms());
+
+  // Silent buses keep their held peaks until they are reset
+  meter.process(quiet.data(), quiet.size());
+
+  const auto second = meter.levels(0);
+  ASSERT_EQ(0.0f, second.max_peak());
+  ASSERT_EQ(0.0f, second.max_rms());
+  ASSERT_FLOAT_EQ(0.5f, second.held[0]);
+  ASSERT_FLOAT_EQ(0.25f, meter.output_levels().max_peak());
+
+  meter.reset_held();
+  ASSERT_EQ(0.0f, meter.levels(0).held[0]);
+}
+
+TEST(AudioMeter, Install)
+{
+  cen::audio_meter meter;
+
+  ASSERT_TRUE(meter.install());
+  ASSERT_TRUE(meter.is_installed());
+  ASSERT_TRUE(meter.install());
+
+  ASSERT_FALSE(meter.attach(-1));
+  ASSERT_FALSE(meter.detach(0));
+
+  meter.uninstall();
+  ASSERT_FALSE(meter.is_installed());
+}
@@ -0,0 +1,82 @@
+#include "audio/audio_monitor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+static_assert(std::is_final_v<cen::audio_monitor>);
+static_assert(std::is_final_v<cen::audio_stats>);
+
+static_assert(!std::is_copy_constructible_v<cen::audio_monitor>);
+static_assert(!std::is_copy_assignable_v<cen::audio_monitor>);
+
+TEST(AudioMonitor, Defaults)
+{
+  const cen::audio_monitor monitor;
+  const auto stats = monitor.stats();
+
+  ASSERT_EQ(0u, stats.callbacks);
+  ASSERT_EQ(0u, stats.underruns);
+  ASSERT_EQ(0u, stats.minFill);
+  ASSERT_EQ(0u, stats.finished);
+  ASSERT_EQ(0u, stats.mean_time().count());
+  ASSERT_EQ(0.0, stats.fill_ratio());
+}
+
+TEST(AudioMonitor, Scope)
+{
+  cen::audio_monitor monitor;
+
+  {
+    const cen::audio_monitor::scope scope{&monitor};
+    SDL_Delay(2);
+  }
+
+  {
+    const cen::audio_monitor::scope scope{nullptr};  // Does nothing
+  }
+
+  const auto stats = monitor.stats();
+  ASSERT_EQ(1u, stats.callbacks);
+  ASSERT_GE(stats.maxTime, cen::nanoseconds<cen::u64>{1'000'000});
+  ASSERT_EQ(stats.maxTime, stats.lastTime);
+  ASSERT_EQ(stats.totalTime, stats.mean_time());
+}
+
+TEST(AudioMonitor, Fill)
+{
+  cen::audio_monitor monitor;
+
+  monitor.record_fill(40, 100);
+  monitor.record_fill(10, 100);
+  monitor.record_fill(25, 100);
+  monitor.record_underrun();
+
+  const auto stats = monitor.stats();
+  ASSERT_EQ(25u, stats.lastFill);
+  ASSERT_EQ(10u, stats.minFill);
+  ASSERT_EQ(100u, stats.capacity);
+  ASSERT_EQ(1u, stats.underruns);
+  ASSERT_DOUBLE_EQ(0.25, stats.fill_ratio());
+}
+
+TEST(AudioMonitor, Reset)
+{
+  cen::audio_monitor monitor;
+
+  {
+    const cen::audio_monitor::scope scope{&monitor};
+  }
+
+  monitor.record_fill(10, 100);
+  monitor.record_underrun();
+  monitor.record_finished(42);
+  monitor.reset();
+
+  const auto stats = monitor.stats();
+  ASSERT_EQ(0u, stats.callbacks);
+  ASSERT_EQ(0u, stats.underruns);
+  ASSERT_EQ(0u, stats.minFill);
+  ASSERT_EQ(0u, stats.capacity);
+  ASSERT_EQ(0u, stats.finished);
+}
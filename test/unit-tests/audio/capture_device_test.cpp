@@ -0,0 +1,66 @@
+#include "audio/capture_device.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_final_v, is_copy_constructible_v
+
+static_assert(std::is_final_v<cen::capture_device>);
+static_assert(!std::is_copy_constructible_v<cen::capture_device>);
+static_assert(!std::is_copy_assignable_v<cen::capture_device>);
+
+TEST(CaptureDevice, DeviceQueries)
+{
+  const auto count = cen::capture_device::device_count();
+  ASSERT_TRUE(count);
+  ASSERT_GE(*count, 0);
+
+  ASSERT_FALSE(cen::capture_device::device_name(*count));
+}
+
+TEST(CaptureDevice, InvalidDevice)
+{
+  ASSERT_THROW(cen::capture_device{"foobar"}, cen::sdl_error);
+}
+
+TEST(CaptureDevice, Usage)
+{
+  const auto count = cen::capture_device::device_count();
+  if (!count || *count == 0) {
+    GTEST_SKIP() << "No capture devices";
+  }
+
+  cen::capture_spec spec;
+  spec.channels = 2;
+
+  cen::capture_device device{{}, spec, 1'000};
+  ASSERT_TRUE(device.is_connected());
+  ASSERT_TRUE(device.is_paused());
+  ASSERT_EQ(8u, device.frame_size());
+  ASSERT_EQ(1'024u, device.capacity());
+  ASSERT_EQ(0u, device.available());
+  ASSERT_EQ(0u, device.dropped());
+
+  float buffer[64]{};
+  ASSERT_EQ(0u, device.read(buffer, 32));
+
+  // Output device events are ignored
+  cen::audio_device_event event;
+  event.set_type(cen::event_type::audio_device_removed);
+  event.set_which(device.id());
+  event.set_capture(false);
+  ASSERT_FALSE(device.handle(event));
+  ASSERT_TRUE(device.is_connected());
+
+  event.set_capture(true);
+  ASSERT_TRUE(device.handle(event));
+  ASSERT_FALSE(device.is_connected());
+  ASSERT_EQ(0u, device.id());
+
+  device.resume();
+  ASSERT_FALSE(device.is_paused());
+
+  event.set_type(cen::event_type::audio_device_added);
+  event.set_which(0);
+  ASSERT_TRUE(device.handle(event));
+  ASSERT_TRUE(device.is_connected());
+}
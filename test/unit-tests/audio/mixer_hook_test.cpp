@@ -0,0 +1,143 @@
+#include "audio/mixer_hook.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>        // array
+#include <cstdlib>      // abs
+#include <random>       // mt19937, uniform_int_distribution, uniform_real_distribution
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+namespace {
+
+struct recording_mixer final
+{
+  using command_type = int;
+
+  std::vector<int> applied;
+  cen::usize mixed{};
+
+  void apply(const int command) noexcept
+  {
+    applied.push_back(command);
+  }
+
+  void mix(cen::u8*, const cen::usize size) noexcept
+  {
+    mixed += size;
+  }
+};
+
+}  // namespace
+
+static_assert(!std::is_copy_constructible_v<cen::mixer_hook<recording_mixer>>);
+static_assert(!std::is_copy_assignable_v<cen::mixer_hook<recording_mixer>>);
+
+TEST(MixerHook, Defaults)
+{
+  recording_mixer mixer;
+  cen::mixer_hook hook{mixer};
+
+  ASSERT_EQ(cen::mixer_hook<recording_mixer>::default_capacity(), hook.capacity());
+  ASSERT_EQ(0u, hook.pending());
+  ASSERT_EQ(0u, hook.dropped());
+  ASSERT_FALSE(hook.is_installed());
+}
+
+TEST(MixerHook, Process)
+{
+  recording_mixer mixer;
+  cen::mixer_hook hook{mixer, 3};
+  ASSERT_EQ(4u, hook.capacity());
+
+  ASSERT_TRUE(hook.send(1));
+  ASSERT_TRUE(hook.send(2));
+  ASSERT_EQ(2u, hook.pending());
+
+  std::array<cen::u8, 64> stream{};
+  hook.process(stream.data(), stream.size());
+
+  ASSERT_EQ((std::vector{1, 2}), mixer.applied);
+  ASSERT_EQ(64u, mixer.mixed);
+  ASSERT_EQ(0u, hook.pending());
+
+  for (auto command = 3; command < 8; ++command) {
+    hook.send(command);
+  }
+
+  ASSERT_EQ(1u, hook.dropped());
+
+  hook.process(stream.data(), stream.size());
+  ASSERT_EQ((std::vector{1, 2, 3, 4, 5, 6}), mixer.applied);
+}
+
+TEST(MixerHook, SampleFunctions)
+{
+  std::array<cen::i16, 3> samples{1'000, -1'000, 30'000};
+  cen::apply_gain(samples.data(), samples.size(), 2.0f);
+  ASSERT_EQ((std::array<cen::i16, 3>{2'000, -2'000, 32'767}), samples);
+
+  const std::array<cen::i16, 3> source{-32'000, 100, 2'000};
+  cen::mix_samples(samples.data(), source.data(), source.size(), 0.5f);
+  ASSERT_EQ((std::array<cen::i16, 3>{-14'000, -1'950, 32'767}), samples);
+
+  std::array values{0.5f, -0.75f, 0.25f};
+  const std::array more{1.0f, -1.0f, 0.5f};
+
+  cen::mix_samples(values.data(), more.data(), values.size());
+  ASSERT_EQ((std::array{1.5f, -1.75f, 0.75f}), values);
+
+  cen::clamp_samples(values.data(), values.size());
+  ASSERT_EQ((std::array{1.0f, -1.0f, 0.75f}), values);
+
+  cen::apply_gain(values.data(), values.size(), 0.5f);
+  ASSERT_EQ((std::array{0.5f, -0.5f, 0.375f}), values);
+}
+
+TEST(MixerHook, KernelsMatchScalar)
+{
+  constexpr int count = 21;
+
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<int> integers{-32'768, 32'767};
+  std::uniform_real_distribution<float> reals{-1.5f, 1.5f};
+
+  std::array<cen::i16, count> target{};
+  std::array<cen::i16, count> source{};
+  std::array<float, count> targetF{};
+  std::array<float, count> sourceF{};
+
+  for (cen::usize i = 0; i < count; ++i) {
+    target[i] = static_cast<cen::i16>(integers(engine));
+    source[i] = static_cast<cen::i16>(integers(engine));
+    targetF[i] = reals(engine);
+    sourceF[i] = reals(engine);
+  }
+
+  auto expected = target;
+  auto actual = target;
+  cen::detail::mix_s16_scalar(expected.data(), source.data(), count, 0.7f);
+  cen::detail::mix_s16(actual.data(), source.data(), count, 0.7f);
+
+  cen::detail::gain_s16_scalar(expected.data(), count, 1.3f);
+  cen::detail::gain_s16(actual.data(), count, 1.3f);
+
+  for (cen::usize i = 0; i < count; ++i) {
+    ASSERT_LE(std::abs(expected[i] - actual[i]), 1);
+  }
+
+  auto expectedF = targetF;
+  auto actualF = targetF;
+  cen::detail::mix_f32_scalar(expectedF.data(), sourceF.data(), count, 0.7f);
+  cen::detail::mix_f32(actualF.data(), sourceF.data(), count, 0.7f);
+
+  cen::detail::gain_f32_scalar(expectedF.data(), count, 0.9f);
+  cen::detail::gain_f32(actualF.data(), count, 0.9f);
+
+  cen::detail::clamp_f32_scalar(expectedF.data(), count);
+  cen::detail::clamp_f32(actualF.data(), count);
+
+  for (cen::usize i = 0; i < count; ++i) {
+    ASSERT_NEAR(expectedF[i], actualF[i], 1e-6f);
+  }
+}
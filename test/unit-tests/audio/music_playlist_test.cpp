@@ -0,0 +1,157 @@
+#include "audio/music_playlist.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>  // vector
+
+static_assert(std::is_final_v<cen::music_playlist>);
+
+static_assert(!std::is_copy_constructible_v<cen::music_playlist>);
+static_assert(!std::is_move_constructible_v<cen::music_playlist>);
+
+using ms = cen::music_playlist::ms_type;
+
+inline constexpr auto path = "resources/click.wav";
+
+namespace {
+
+[[nodiscard]] auto read_contents() -> std::vector<cen::u8>
+{
+  cen::file source{path, cen::file_mode::read_existing_binary};
+  std::vector<cen::u8> contents(source.size().value());
+  source.read_to(contents.data(), contents.size());
+  return contents;
+}
+
+// Gives the worker enough time to open and decode the upcoming track
+void wait_for_worker()
+{
+  SDL_Delay(100);
+}
+
+}  // namespace
+
+TEST(MusicPlaylist, Defaults)
+{
+  const cen::music_playlist playlist;
+
+  ASSERT_EQ(0u, playlist.size());
+  ASSERT_FALSE(playlist.is_playing());
+  ASSERT_FALSE(playlist.is_looping());
+  ASSERT_FALSE(playlist.is_crossfading());
+  ASSERT_FALSE(playlist.current_track());
+  ASSERT_EQ(0u, playlist.transitions());
+  ASSERT_EQ(0u, playlist.failures());
+}
+
+TEST(MusicPlaylist, UnsupportedFormat)
+{
+  // The mixer isn't opened, so the sample format is unknown
+  cen::music_playlist playlist;
+  ASSERT_FALSE(playlist.play());
+  ASSERT_FALSE(playlist.is_playing());
+}
+
+TEST(MusicPlaylist, Gapless)
+{
+  const auto contents = read_contents();
+
+  cen::music_playlist playlist;
+  playlist.add(path);
+  playlist.add(path);
+  ASSERT_EQ(2u, playlist.size());
+
+  std::vector<cen::u8> result(2 * contents.size() + 64);
+
+  wait_for_worker();
+  playlist.process(result.data(), 64);
+  ASSERT_EQ(0u, playlist.current_track());
+
+  // The second track starts in the same buffer as the end of the first track
+  wait_for_worker();
+  playlist.process(result.data() + 64, result.size() - 64);
+  ASSERT_EQ(1u, playlist.current_track());
+  ASSERT_EQ(2u, playlist.transitions());
+
+  for (cen::usize index = 0; index < 2 * contents.size(); ++index) {
+    ASSERT_EQ(contents[index % contents.size()], result[index]);
+  }
+}
+
+TEST(MusicPlaylist, Skip)
+{
+  cen::music_playlist playlist{{}, ms::zero()};
+  playlist.add(path);
+  playlist.add(path);
+
+  std::vector<cen::u8> buffer(64);
+
+  wait_for_worker();
+  playlist.process(buffer.data(), buffer.size());
+  ASSERT_EQ(0u, playlist.current_track());
+
+  wait_for_worker();
+  playlist.skip();
+  playlist.process(buffer.data(), buffer.size());
+
+  ASSERT_EQ(1u, playlist.current_track());
+  ASSERT_FALSE(playlist.is_crossfading());
+}
+
+TEST(MusicPlaylist, Crossfade)
+{
+  cen::music_playlist playlist{{}, ms{1}};
+  playlist.add(path);
+  playlist.add(path);
+
+  std::vector<cen::u8> buffer(16);
+
+  wait_for_worker();
+  playlist.process(buffer.data(), buffer.size());
+
+  wait_for_worker();
+  playlist.skip();
+  playlist.process(buffer.data(), buffer.size());
+
+  // A millisecond of audio is larger than the buffer
+  ASSERT_TRUE(playlist.is_crossfading());
+  ASSERT_EQ(0u, playlist.current_track());
+
+  std::vector<cen::u8> remainder(4'096);
+  playlist.process(remainder.data(), remainder.size());
+
+  ASSERT_FALSE(playlist.is_crossfading());
+  ASSERT_EQ(1u, playlist.current_track());
+}
+
+TEST(MusicPlaylist, Looping)
+{
+  const auto contents = read_contents();
+
+  cen::music_playlist playlist;
+  playlist.set_looping(true);
+  playlist.add(path);
+  ASSERT_TRUE(playlist.is_looping());
+
+  std::vector<cen::u8> buffer(contents.size());
+
+  wait_for_worker();
+  playlist.process(buffer.data(), buffer.size());
+
+  wait_for_worker();
+  playlist.process(buffer.data(), buffer.size());
+
+  ASSERT_EQ(0u, playlist.current_track());
+  ASSERT_EQ(2u, playlist.transitions());
+}
+
+TEST(MusicPlaylist, MissingTrack)
+{
+  cen::music_playlist playlist;
+  playlist.add("foobar.pcm");
+
+  wait_for_worker();
+  ASSERT_EQ(1u, playlist.failures());
+  ASSERT_FALSE(playlist.current_track());
+}
@@ -0,0 +1,116 @@
+#include "audio/music_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>  // vector
+
+static_assert(std::is_final_v<cen::music_stream>);
+
+static_assert(!std::is_copy_constructible_v<cen::music_stream>);
+static_assert(!std::is_move_constructible_v<cen::music_stream>);
+
+inline constexpr auto path = "resources/click.wav";
+
+namespace {
+
+[[nodiscard]] auto open_source() -> cen::file
+{
+  return cen::file{path, cen::file_mode::read_existing_binary};
+}
+
+[[nodiscard]] auto read_contents() -> std::vector<cen::u8>
+{
+  auto source = open_source();
+  std::vector<cen::u8> contents(source.size().value());
+  source.read_to(contents.data(), contents.size());
+  return contents;
+}
+
+void wait_for(cen::music_stream& stream, const cen::usize amount)
+{
+  for (int attempt = 0; attempt < 1'000 && stream.buffered() < amount; ++attempt) {
+    SDL_Delay(1);
+  }
+}
+
+}  // namespace
+
+TEST(MusicStream, Defaults)
+{
+  cen::music_stream stream{open_source()};
+
+  ASSERT_EQ(cen::music_stream::default_capacity(), stream.capacity());
+  ASSERT_FALSE(stream.is_playing());
+  ASSERT_FALSE(stream.is_looping());
+  ASSERT_EQ(0u, stream.underruns());
+}
+
+TEST(MusicStream, Read)
+{
+  const auto contents = read_contents();
+
+  // The ring buffer is smaller than the file, so it wraps around
+  cen::music_stream stream{open_source(), {}, 4'096, 1'024};
+  ASSERT_EQ(4'096u, stream.capacity());
+
+  std::vector<cen::u8> result;
+  std::vector<cen::u8> block(512);
+
+  while (result.size() < contents.size()) {
+    wait_for(stream, std::min(block.size(), contents.size() - result.size()));
+
+    const auto amount = stream.read(block.data(), block.size());
+    ASSERT_GT(amount, 0u);
+
+    result.insert(result.end(), block.begin(), block.begin() + amount);
+  }
+
+  ASSERT_EQ(contents, result);
+
+  // The stream is exhausted, so a partial read isn't an underrun
+  for (int attempt = 0; attempt < 1'000 && !stream.is_finished(); ++attempt) {
+    SDL_Delay(1);
+  }
+
+  ASSERT_TRUE(stream.is_finished());
+  ASSERT_EQ(0u, stream.read(block.data(), block.size()));
+  ASSERT_EQ(0u, stream.underruns());
+}
+
+TEST(MusicStream, Looping)
+{
+  const auto contents = read_contents();
+
+  cen::music_stream stream{open_source(), {}, 64 * 1'024, 1'024};
+  stream.set_looping(true);
+  ASSERT_TRUE(stream.is_looping());
+
+  const auto total = contents.size() + 100;
+  wait_for(stream, total);
+
+  std::vector<cen::u8> result(total);
+  ASSERT_EQ(total, stream.read(result.data(), result.size()));
+
+  for (cen::usize index = 0; index < 100; ++index) {
+    ASSERT_EQ(contents[index], result[contents.size() + index]);
+  }
+}
+
+TEST(MusicStream, CustomDecoder)
+{
+  auto decoder = [](cen::file&, cen::u8* buffer, const cen::usize size) -> cen::usize {
+    for (cen::usize index = 0; index < size; ++index) {
+      buffer[index] = 42;
+    }
+
+    return size;
+  };
+
+  cen::music_stream stream{open_source(), decoder, 1'024, 256};
+  wait_for(stream, 1'024);
+
+  std::vector<cen::u8> result(1'024);
+  ASSERT_EQ(1'024u, stream.read(result.data(), result.size()));
+  ASSERT_EQ(std::vector<cen::u8>(1'024, 42), result);
+}
@@ -5,8 +5,11 @@
 #include <iostream>  // clog
 #include <memory>    // unique_ptr
 #include <type_traits>
+#include <utility>  // move
+#include <vector>   // vector
 
 #include "core/log.hpp"
+#include "filesystem/file.hpp"
 
 static_assert(std::is_final_v<cen::music>);
 
@@ -44,6 +47,29 @@ TEST_F(MusicTest, Constructor)
   ASSERT_THROW(cen::music{"foobar"s}, cen::mix_error);
 }
 
+TEST_F(MusicTest, FromFile)
+{
+  cen::file source{"resources/hiddenPond.mp3", cen::file_mode::read_existing_binary};
+  ASSERT_NO_THROW(cen::music{std::move(source)});
+  ASSERT_FALSE(source);
+
+  ASSERT_THROW(cen::music{cen::file{nullptr}}, cen::mix_error);
+}
+
+TEST_F(MusicTest, FromMemory)
+{
+  cen::file source{"resources/hiddenPond.mp3", cen::file_mode::read_existing_binary};
+
+  std::vector<cen::u8> data(source.size().value());
+  ASSERT_EQ(data.size(), source.read_to(data));
+
+  const cen::music music{data.data(), data.size()};
+  ASSERT_EQ(cen::music_type::mp3, music.type());
+
+  const std::vector<cen::u8> garbage(16, 0xAB);
+  ASSERT_THROW(cen::music(garbage.data(), garbage.size()), cen::mix_error);
+}
+
 TEST_F(MusicTest, Play)
 {
   m_music->play();
@@ -0,0 +1,22 @@
+#include "audio/resample_quality.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+TEST(ResampleQuality, Values)
+{
+  ASSERT_EQ(4, cen::resample_quality_count());
+}
+
+TEST(ResampleQuality, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::resample_quality>(5)), cen::cen_error);
+
+  ASSERT_EQ("none", cen::to_string(cen::resample_quality::none));
+  ASSERT_EQ("fast", cen::to_string(cen::resample_quality::fast));
+  ASSERT_EQ("balanced", cen::to_string(cen::resample_quality::balanced));
+  ASSERT_EQ("best", cen::to_string(cen::resample_quality::best));
+
+  std::clog << "Resample quality example: " << cen::resample_quality::best << '\n';
+}
@@ -0,0 +1,149 @@
+#include "audio/sound_bank.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+static_assert(std::is_final_v<cen::sound_bank>);
+
+static_assert(!std::is_copy_constructible_v<cen::sound_bank>);
+static_assert(!std::is_copy_assignable_v<cen::sound_bank>);
+
+using status = cen::sound_bank::load_status;
+
+inline constexpr auto path = "resources/click.wav";
+
+TEST(SoundBank, Defaults)
+{
+  cen::sound_bank bank;
+  ASSERT_EQ(2u, bank.worker_count());
+  ASSERT_EQ(0u, bank.size());
+  ASSERT_EQ(0u, bank.resident_bytes());
+
+  ASSERT_EQ(status::unknown, bank.status(0));
+  ASSERT_FALSE(bank.get(0).get());
+  ASSERT_FALSE(bank.find(path));
+  ASSERT_FALSE(bank.release(0));
+}
+
+TEST(SoundBank, Enqueue)
+{
+  cen::sound_bank bank{1};
+
+  const auto id = bank.enqueue(path);
+  ASSERT_EQ(id, bank.enqueue(path));
+  ASSERT_EQ(id, bank.find(path));
+
+  bank.wait();
+  ASSERT_EQ(status::ready, bank.status(id));
+  ASSERT_EQ(1u, bank.size());
+  ASSERT_GT(bank.resident_bytes(), 0u);
+
+  const auto a = bank.get(id);
+  const auto b = bank.get(id);
+  ASSERT_TRUE(a.get());
+  ASSERT_EQ(a.get(), b.get());
+}
+
+TEST(SoundBank, Release)
+{
+  cen::sound_bank bank;
+
+  const auto id = bank.enqueue(path);
+  bank.wait();
+
+  ASSERT_TRUE(bank.release(id));
+  ASSERT_FALSE(bank.release(id));
+
+  ASSERT_EQ(status::unknown, bank.status(id));
+  ASSERT_FALSE(bank.get(id).get());
+  ASSERT_FALSE(bank.find(path));
+  ASSERT_EQ(0u, bank.size());
+  ASSERT_EQ(0u, bank.resident_bytes());
+
+  const auto other = bank.enqueue(path);
+  ASSERT_NE(id, other);
+
+  bank.wait();
+  ASSERT_EQ(status::ready, bank.status(other));
+}
+
+TEST(SoundBank, Failure)
+{
+  cen::sound_bank bank;
+
+  const auto id = bank.enqueue("foobar");
+  bank.wait();
+
+  ASSERT_EQ(status::failed, bank.status(id));
+  ASSERT_FALSE(bank.get(id).get());
+  ASSERT_EQ(0u, bank.resident_bytes());
+}
+
+TEST(SoundBank, Quality)
+{
+  ASSERT_EQ(cen::resample_quality::balanced, cen::sound_bank{}.quality());
+
+  // Without explicit conversion, all files are loaded by SDL_mixer
+  cen::sound_bank unconverted{1, cen::resample_quality::none};
+  const auto reference = unconverted.enqueue(path);
+  unconverted.wait();
+
+  ASSERT_EQ(status::ready, unconverted.status(reference));
+  ASSERT_EQ(0u, unconverted.converted_count());
+
+  for (const auto quality : {cen::resample_quality::fast,
+                             cen::resample_quality::balanced,
+                             cen::resample_quality::best})
+  {
+    cen::sound_bank bank{1, quality};
+
+    const auto id = bank.enqueue(path);
+    bank.wait();
+
+    ASSERT_EQ(status::ready, bank.status(id));
+    ASSERT_EQ(1u, bank.converted_count());
+
+    // Both conversions produce the same amount of frames, give or take one frame
+    const auto expected = static_cast<double>(unconverted.resident_bytes());
+    ASSERT_NEAR(expected, static_cast<double>(bank.resident_bytes()), 8.0);
+  }
+}
+
+TEST(SoundBank, SetQuality)
+{
+  cen::sound_bank bank{1};
+
+  bank.set_quality(cen::resample_quality::best);
+  ASSERT_EQ(cen::resample_quality::best, bank.quality());
+
+  cen::power_change change;
+  change.settings.audio_quality = cen::resample_quality::none;
+  bank.handle(change);
+  ASSERT_EQ(cen::resample_quality::none, bank.quality());
+
+  // Files decoded after the change use the new quality
+  const auto id = bank.enqueue(path);
+  bank.wait();
+
+  ASSERT_EQ(status::ready, bank.status(id));
+  ASSERT_EQ(0u, bank.converted_count());
+}
+
+TEST(SoundBank, FreeMemory)
+{
+  cen::sound_bank bank{1};
+  ASSERT_EQ(0u, bank.free_memory(1));
+
+  const auto id = bank.enqueue(path);
+  bank.wait();
+
+  const auto bytes = bank.resident_bytes();
+  ASSERT_GT(bytes, 0u);
+
+  // Sound effects that aren't playing are released
+  ASSERT_EQ(bytes, bank.free_memory(1));
+  ASSERT_EQ(status::unknown, bank.status(id));
+  ASSERT_EQ(0u, bank.resident_bytes());
+  ASSERT_FALSE(bank.find(path));
+}
@@ -0,0 +1,81 @@
+#include "audio/sound_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>      // memcmp
+#include <type_traits>  // is_final_v
+
+#include "filesystem/file.hpp"
+
+static_assert(std::is_final_v<cen::sound_cache>);
+
+inline constexpr auto path = "resources/click.wav";
+
+class SoundCacheTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    m_cache.remove(path);
+  }
+
+  void TearDown() override
+  {
+    m_cache.remove(path);
+  }
+
+  cen::sound_cache m_cache{""};
+};
+
+TEST_F(SoundCacheTest, EntryPath)
+{
+  ASSERT_EQ(m_cache.entry_path(path), m_cache.entry_path(path));
+  ASSERT_NE(m_cache.entry_path(path), m_cache.entry_path("resources/hiddenB.wav"));
+
+  const cen::sound_cache other{"cache/"};
+  ASSERT_EQ("cache/", other.directory());
+  ASSERT_EQ(0u, other.entry_path(path).find("cache/sound_"));
+}
+
+TEST_F(SoundCacheTest, Load)
+{
+  const auto decoded = m_cache.load(path);
+  ASSERT_TRUE(decoded);
+  ASSERT_EQ(0u, m_cache.hits());
+  ASSERT_EQ(1u, m_cache.misses());
+
+  const auto cached = m_cache.load(path);
+  ASSERT_TRUE(cached);
+  ASSERT_EQ(1u, m_cache.hits());
+  ASSERT_EQ(1u, m_cache.misses());
+
+  const auto* a = decoded->get();
+  const auto* b = cached->get();
+  ASSERT_EQ(a->alen, b->alen);
+  ASSERT_EQ(0, std::memcmp(a->abuf, b->abuf, a->alen));
+}
+
+TEST_F(SoundCacheTest, InvalidEntry)
+{
+  {
+    cen::file entry{m_cache.entry_path(path), cen::file_mode::write_binary};
+    ASSERT_TRUE(entry);
+    ASSERT_TRUE(entry.write_as_little_endian(cen::u32{42}));
+  }
+
+  ASSERT_TRUE(m_cache.load(path));
+  ASSERT_EQ(0u, m_cache.hits());
+  ASSERT_EQ(1u, m_cache.misses());
+
+  // The invalid entry should have been replaced
+  ASSERT_TRUE(m_cache.load(path));
+  ASSERT_EQ(1u, m_cache.hits());
+}
+
+TEST_F(SoundCacheTest, MissingSource)
+{
+  ASSERT_FALSE(m_cache.load("foobar.wav"));
+  ASSERT_EQ(0u, m_cache.hits());
+  ASSERT_EQ(0u, m_cache.misses());
+  ASSERT_FALSE(m_cache.remove("foobar.wav"));
+}
@@ -5,9 +5,11 @@
 #include <iostream>  // clog
 #include <memory>    // unique_ptr
 #include <type_traits>
+#include <vector>  // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
+#include "filesystem/file.hpp"
 
 static_assert(std::is_final_v<cen::sound_effect>);
 static_assert(!std::is_default_constructible_v<cen::sound_effect>);
@@ -46,6 +48,50 @@ TEST_F(SoundEffect, Constructor)
   ASSERT_THROW(cen::sound_effect("foobar"s), cen::mix_error);
 }
 
+TEST_F(SoundEffect, FromFile)
+{
+  cen::file source{path, cen::file_mode::read_existing_binary};
+
+  const cen::sound_effect sound{source};
+  ASSERT_TRUE(source);
+  ASSERT_EQ(m_sound->get()->alen, sound.get()->alen);
+}
+
+TEST_F(SoundEffect, TryLoad)
+{
+  const auto missing = cen::sound_effect::try_load("foobar");
+  ASSERT_FALSE(missing);
+  ASSERT_EQ(cen::error_code::mix, missing.error().code());
+
+  const auto sound = cen::sound_effect::try_load(std::string{path});
+  ASSERT_TRUE(sound);
+  ASSERT_EQ(m_sound->get()->alen, sound->get()->alen);
+}
+
+TEST_F(SoundEffect, FromMemory)
+{
+  cen::file source{path, cen::file_mode::read_existing_binary};
+
+  std::vector<cen::u8> data(source.size().value());
+  ASSERT_EQ(data.size(), source.read_to(data));
+
+  const cen::sound_effect sound{data.data(), data.size()};
+  ASSERT_EQ(m_sound->get()->alen, sound.get()->alen);
+
+  const std::vector<cen::u8> garbage(16, 0xAB);
+  ASSERT_THROW(cen::sound_effect(garbage.data(), garbage.size()), cen::mix_error);
+}
+
+TEST_F(SoundEffect, FromRaw)
+{
+  std::vector<cen::u8> samples(1'024);
+
+  const auto sound =
+      cen::sound_effect::from_raw(samples.data(), static_cast<cen::u32>(samples.size()));
+  ASSERT_EQ(samples.data(), sound.get()->abuf);
+  ASSERT_EQ(samples.size(), sound.get()->alen);
+}
+
 TEST_F(SoundEffect, PlayAndStop)
 {
   ASSERT_FALSE(m_sound->is_playing());
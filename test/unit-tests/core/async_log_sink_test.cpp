@@ -0,0 +1,173 @@
+#include "core/async_log_sink.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>       // atomic
+#include <string>       // string
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+#include "core/log.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::async_log_sink>);
+
+TEST(AsyncLogSink, Write)
+{
+  std::vector<std::string> messages;  // Only modified by the writer thread
+
+  {
+    cen::async_log_sink sink{16, cen::log_overflow::drop, [&](const cen::log_record& record) {
+                               messages.emplace_back(record.message());
+                             }};
+
+    ASSERT_EQ(16u, sink.capacity());
+
+    cen::log::info("Hello %s", "world");
+    ASSERT_TRUE(sink.write(cen::log_category::render, cen::log_priority::warn, "Direct"));
+
+    sink.flush();
+    ASSERT_EQ(2u, sink.written());
+    ASSERT_EQ(0u, sink.dropped());
+  }
+
+  ASSERT_EQ((std::vector<std::string>{"Hello world", "Direct"}), messages);
+}
+
+TEST(AsyncLogSink, RestoresOutputFunction)
+{
+  SDL_LogOutputFunction before{};
+  SDL_LogGetOutputFunction(&before, nullptr);
+
+  {
+    cen::async_log_sink sink;
+
+    SDL_LogOutputFunction installed{};
+    SDL_LogGetOutputFunction(&installed, nullptr);
+    ASSERT_NE(before, installed);
+  }
+
+  SDL_LogOutputFunction after{};
+  SDL_LogGetOutputFunction(&after, nullptr);
+  ASSERT_EQ(before, after);
+}
+
+TEST(AsyncLogSink, Drop)
+{
+  std::atomic<bool> blocked{true};
+  std::atomic<int> count{0};
+
+  cen::async_log_sink sink{2, cen::log_overflow::drop, [&](const cen::log_record&) {
+                             while (blocked) {
+                               std::this_thread::yield();
+                             }
+                             ++count;
+                           }};
+
+  for (auto index = 0; index < 10; ++index) {
+    sink.write(cen::log_category::app, cen::log_priority::info, "Message");
+  }
+
+  blocked = false;
+  sink.flush();
+
+  // The writer holds at most one record while the buffer is full
+  ASSERT_GE(sink.dropped(), 7u);
+  ASSERT_EQ(10u, sink.dropped() + sink.written());
+  ASSERT_EQ(static_cast<int>(sink.written()), count.load());
+}
+
+TEST(AsyncLogSink, Block)
+{
+  std::atomic<int> count{0};
+
+  cen::async_log_sink sink{2, cen::log_overflow::block, [&](const cen::log_record& record) {
+                             ASSERT_EQ("Message", record.message());
+                             cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+                             ++count;
+                           }};
+
+  for (auto index = 0; index < 20; ++index) {
+    ASSERT_TRUE(sink.write(cen::log_category::app, cen::log_priority::info, "Message"));
+  }
+
+  sink.flush();
+  ASSERT_EQ(0u, sink.dropped());
+  ASSERT_EQ(20, count.load());
+}
+
+TEST(AsyncLogSink, Truncate)
+{
+  std::string written;
+
+  {
+    cen::async_log_sink sink{4, cen::log_overflow::drop, [&](const cen::log_record& record) {
+                               written = record.message();
+                             }};
+
+    const std::string message(cen::log_record::text_capacity + 10, 'x');
+    sink.write(cen::log_category::app, cen::log_priority::info, message);
+
+    sink.flush();
+    ASSERT_EQ(1u, sink.truncated());
+  }
+
+  ASSERT_EQ(cen::log_record::text_capacity, written.size());
+}
+
+#if CENTURION_HAS_FEATURE_FORMAT
+
+TEST(AsyncLogSink, Submit)
+{
+  std::vector<std::string> messages;  // Only modified by the writer thread
+
+  {
+    cen::async_log_sink sink{16, cen::log_overflow::drop, [&](const cen::log_record& record) {
+                               ASSERT_EQ(nullptr, record.formatter);
+                               messages.emplace_back(record.message());
+                             }};
+
+    cen::log::set_priority(cen::log_category::app, cen::log_priority::info);
+
+    const std::string name{"player"};
+    ASSERT_TRUE(sink.submit(cen::log_priority::info,
+                            cen::log_category::app,
+                            "{} at {:.1f}, {} ({})",
+                            name,
+                            1.5f,
+                            -2,
+                            "ok"));
+
+    // Filtered out before anything is copied
+    ASSERT_FALSE(sink.submit(cen::log_priority::debug, cen::log_category::app, "{}", 42));
+
+    sink.flush();
+    ASSERT_EQ(1u, sink.written());
+
+    cen::log::reset_priorities();
+  }
+
+  ASSERT_EQ(std::vector<std::string>{"player at 1.5, -2 (ok)"}, messages);
+}
+
+TEST(AsyncLogSink, SubmitLargeArguments)
+{
+  std::string written;
+
+  {
+    cen::async_log_sink sink{4, cen::log_overflow::drop, [&](const cen::log_record& record) {
+                               written = record.message();
+                             }};
+
+    // Doesn't fit in a record, so it's formatted immediately and truncated
+    const std::string large(cen::log_record::text_capacity, 'x');
+    ASSERT_TRUE(
+        sink.submit(cen::log_priority::critical, cen::log_category::app, "{}!", large));
+
+    sink.flush();
+    ASSERT_EQ(1u, sink.truncated());
+  }
+
+  ASSERT_EQ(std::string(cen::log_record::text_capacity, 'x'), written);
+}
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
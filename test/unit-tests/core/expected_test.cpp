@@ -0,0 +1,79 @@
+#include "core/expected.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>     // clog
+#include <memory>       // unique_ptr, make_unique
+#include <type_traits>  // is_nothrow_move_constructible_v
+
+static_assert(std::is_nothrow_move_constructible_v<cen::error_info>);
+static_assert(std::is_nothrow_move_constructible_v<cen::expected<int>>);
+
+TEST(ErrorCode, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::error_code>(5)), cen::cen_error);
+
+  ASSERT_EQ("sdl", cen::to_string(cen::error_code::sdl));
+  ASSERT_EQ("img", cen::to_string(cen::error_code::img));
+  ASSERT_EQ("ttf", cen::to_string(cen::error_code::ttf));
+  ASSERT_EQ("mix", cen::to_string(cen::error_code::mix));
+  ASSERT_EQ("bad_argument", cen::to_string(cen::error_code::bad_argument));
+
+  std::clog << "Error code example: " << cen::error_code::bad_argument << '\n';
+}
+
+TEST(ErrorInfo, Message)
+{
+  const cen::error_info info{cen::error_code::bad_argument, "Foo"};
+  ASSERT_EQ(cen::error_code::bad_argument, info.code());
+  ASSERT_STREQ("Foo", info.message());
+
+  const cen::error_info none{cen::error_code::bad_argument, nullptr};
+  ASSERT_STREQ("n/a", none.message());
+}
+
+TEST(ErrorInfo, LazyMessage)
+{
+  SDL_SetError("Foo");
+  const cen::error_info info{cen::error_code::sdl};
+
+  // The message is fetched once, and is not affected by later errors
+  ASSERT_STREQ("Foo", info.message());
+  SDL_SetError("Bar");
+  ASSERT_STREQ("Foo", info.message());
+}
+
+TEST(ErrorInfo, CopyFetchedMessage)
+{
+  SDL_SetError("Foo");
+
+  auto source = std::make_unique<cen::error_info>(cen::error_code::sdl);
+  ASSERT_STREQ("Foo", source->message());
+
+  const auto copy = *source;
+  auto moved = std::move(*source);
+  source.reset();
+
+  ASSERT_STREQ("Foo", copy.message());
+  ASSERT_STREQ("Foo", moved.message());
+}
+
+TEST(Expected, Value)
+{
+  cen::expected<std::unique_ptr<int>> value{std::make_unique<int>(42)};
+  ASSERT_TRUE(value);
+  ASSERT_TRUE(value.has_value());
+  ASSERT_EQ(42, **value);
+
+  const auto moved = std::move(value).value();
+  ASSERT_EQ(42, *moved);
+}
+
+TEST(Expected, Error)
+{
+  const cen::expected<int> value{cen::error_info{cen::error_code::ttf, "Foo"}};
+  ASSERT_FALSE(value);
+  ASSERT_FALSE(value.has_value());
+  ASSERT_EQ(cen::error_code::ttf, value.error().code());
+  ASSERT_STREQ("Foo", value.error().message());
+}
@@ -0,0 +1,47 @@
+#define CENTURION_LOG_MIN_PRIORITY SDL_LOG_PRIORITY_WARN
+#define CENTURION_LOG_MIN_PRIORITY_RENDER cen::log_priority::verbose
+
+#include "core/log_macros.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(LogMacros, MinPriority)
+{
+  int evaluated = 0;
+
+  // Compiled out, so the arguments aren't evaluated
+  CENTURION_LOG_INFO("%i", ++evaluated);
+  CENTURION_LOG_DEBUG("%i", ++evaluated);
+  CENTURION_LOG_VERBOSE("%i", ++evaluated);
+  ASSERT_EQ(0, evaluated);
+
+  CENTURION_LOG_WARN("%i", ++evaluated);
+  CENTURION_LOG_ERROR("%i", ++evaluated);
+  CENTURION_LOG_CRITICAL("%i", ++evaluated);
+  ASSERT_EQ(3, evaluated);
+}
+
+TEST(LogMacros, CategoryOverride)
+{
+  int evaluated = 0;
+
+  CENTURION_LOG(cen::log_priority::debug, cen::log_category::audio, "%i", ++evaluated);
+  ASSERT_EQ(0, evaluated);
+
+  CENTURION_LOG(cen::log_priority::verbose, cen::log_category::render, "%i", ++evaluated);
+  CENTURION_LOG(cen::log_priority::warn, cen::log_category::audio, "%i", ++evaluated);
+  ASSERT_EQ(2, evaluated);
+}
+
+TEST(LogMacros, IsCompiledIn)
+{
+  static_assert(cen::log::detail::is_compiled_in(cen::log_priority::error,
+                                                 cen::log_category::app,
+                                                 CENTURION_DETAIL_LOG_THRESHOLDS));
+  static_assert(!cen::log::detail::is_compiled_in(cen::log_priority::info,
+                                                  cen::log_category::input,
+                                                  CENTURION_DETAIL_LOG_THRESHOLDS));
+  static_assert(cen::log::detail::is_compiled_in(cen::log_priority::debug,
+                                                 cen::log_category::render,
+                                                 CENTURION_DETAIL_LOG_THRESHOLDS));
+}
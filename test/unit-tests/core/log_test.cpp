@@ -40,6 +40,17 @@ TEST(Log, GetPriority)
   ASSERT_EQ(sdlPrio, cen::log::get_priority(cen::log_category::app));
 }
 
+TEST(Log, Enabled)
+{
+  cen::log::set_priority(cen::log_category::app, cen::log_priority::warn);
+
+  ASSERT_FALSE(cen::log::enabled(cen::log_category::app, cen::log_priority::info));
+  ASSERT_TRUE(cen::log::enabled(cen::log_category::app, cen::log_priority::warn));
+  ASSERT_TRUE(cen::log::enabled(cen::log_category::app, cen::log_priority::critical));
+
+  cen::log::reset_priorities();
+}
+
 TEST(Log, MaxMessageSize)
 {
   ASSERT_EQ(SDL_MAX_LOG_MESSAGE, cen::log::max_message_size());
@@ -59,6 +70,20 @@ TEST(Log, Priority)
   cen::log::reset_priorities();
 }
 
+#if CENTURION_HAS_FEATURE_FORMAT
+
+TEST(Log, Print)
+{
+  cen::log::set_priority(cen::log_priority::verbose);
+
+  cen::log::print("Info message {}", 1);
+  cen::log::print(cen::log_priority::warn, cen::log_category::render, "Warning {:.1f}", 2.5);
+
+  cen::log::reset_priorities();
+}
+
+#endif  // CENTURION_HAS_FEATURE_FORMAT
+
 TEST(Log, Macros)
 {
   CENTURION_LOG_INFO("%s", "This is for debug only...");
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>       // string
+#include <string_view>  // string_view
+
 TEST(FromString, IntegerBase10)
 {
   ASSERT_FALSE(cen::detail::from_string<int>("foo"));
@@ -27,4 +30,33 @@ TEST(FromString, Base16)
   ASSERT_EQ(0xB7, cen::detail::from_string<int>("B7", 16));
   ASSERT_EQ(0x123, cen::detail::from_string<int>("123", 16));
   ASSERT_EQ(0xE9A, cen::detail::from_string<int>("E9A", 16));
-}
\ No newline at end of file
+}
+
+TEST(FromString, Strict)
+{
+  ASSERT_FALSE(cen::detail::from_string<int>(""));
+  ASSERT_FALSE(cen::detail::from_string<int>("12abc"));
+  ASSERT_FALSE(cen::detail::from_string<float>(""));
+  ASSERT_FALSE(cen::detail::from_string<float>("1.5abc"));
+  ASSERT_FALSE(cen::detail::from_string<float>(" 1.5"));
+}
+
+TEST(FromString, ParseFloat)
+{
+  ASSERT_FALSE(cen::detail::parse_float<float>(""));
+  ASSERT_FALSE(cen::detail::parse_float<float>("foo"));
+  ASSERT_FALSE(cen::detail::parse_float<float>("+1"));
+  ASSERT_FALSE(cen::detail::parse_float<float>(" 1"));
+  ASSERT_FALSE(cen::detail::parse_float<float>("1.5abc"));
+  ASSERT_FALSE(cen::detail::parse_float<float>("1e999"));
+
+  // Only the supplied characters are parsed
+  const std::string_view digits{"12.5678", 4};
+  ASSERT_FLOAT_EQ(12.5f, cen::detail::parse_float<float>(digits).value());
+
+  ASSERT_FLOAT_EQ(4.2f, cen::detail::parse_float<float>("4.2").value());
+  ASSERT_DOUBLE_EQ(-834.5, cen::detail::parse_float<double>("-834.5").value());
+
+  const std::string tooLong(cen::detail::max_float_string_length + 1, '1');
+  ASSERT_FALSE(cen::detail::parse_float<float>(tooLong));
+}
@@ -0,0 +1,78 @@
+#include "detail/meter_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <random>  // mt19937, uniform_int_distribution
+#include <vector>  // vector
+
+#include "core/integers.hpp"
+
+TEST(MeterKernels, Values)
+{
+  // Stereo, with a tail that isn't processed by the vector kernels
+  const std::vector<float> samples{0.5f, -0.25f, -1.0f, 0.25f, 0.0f,  //
+                                   0.0f, 0.5f,   0.0f,  -0.5f, 0.125f};
+
+  std::array<float, 2> peaks{};
+  std::array<float, 2> power{};
+  cen::detail::measure_f32(samples.data(), 5, 2, peaks.data(), power.data());
+
+  ASSERT_FLOAT_EQ(1.0f, peaks[0]);
+  ASSERT_FLOAT_EQ(0.25f, peaks[1]);
+  ASSERT_FLOAT_EQ(1.75f, power[0]);
+  ASSERT_FLOAT_EQ(0.140625f, power[1]);
+
+  const std::vector<cen::i16> pcm{-32'768, 16'384, 8'192};
+
+  std::array<float, 1> pcmPeak{};
+  std::array<float, 1> pcmPower{};
+  cen::detail::measure_s16(pcm.data(), pcm.size(), 1, pcmPeak.data(), pcmPower.data());
+
+  ASSERT_FLOAT_EQ(1.0f, pcmPeak[0]);
+  ASSERT_FLOAT_EQ(1.0f + 0.25f + 0.0625f, pcmPower[0]);
+}
+
+TEST(MeterKernels, MatchesScalar)
+{
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<int> distribution{-32'768, 32'767};
+
+  std::vector<cen::i16> pcm(1'003 * 6);
+  std::vector<float> samples(pcm.size());
+
+  for (cen::usize index = 0; index < pcm.size(); ++index) {
+    pcm[index] = static_cast<cen::i16>(distribution(engine));
+    samples[index] = static_cast<float>(pcm[index]) / 32'768.0f;
+  }
+
+  for (const cen::usize channels : {1u, 2u, 4u, 6u}) {
+    const auto frames = pcm.size() / channels;
+
+    std::array<float, 8> peaks{};
+    std::array<float, 8> power{};
+    std::array<float, 8> expectedPeaks{};
+    std::array<float, 8> expectedPower{};
+
+    cen::detail::measure_s16(pcm.data(), frames, channels, peaks.data(), power.data());
+    cen::detail::measure_s16_scalar(pcm.data(),
+                                    frames,
+                                    channels,
+                                    expectedPeaks.data(),
+                                    expectedPower.data());
+
+    for (cen::usize channel = 0; channel < channels; ++channel) {
+      ASSERT_FLOAT_EQ(expectedPeaks[channel], peaks[channel]);
+      ASSERT_NEAR(expectedPower[channel], power[channel], expectedPower[channel] * 1e-4);
+    }
+
+    peaks = {};
+    power = {};
+    cen::detail::measure_f32(samples.data(), frames, channels, peaks.data(), power.data());
+
+    for (cen::usize channel = 0; channel < channels; ++channel) {
+      ASSERT_FLOAT_EQ(expectedPeaks[channel], peaks[channel]);
+      ASSERT_NEAR(expectedPower[channel], power[channel], expectedPower[channel] * 1e-4);
+    }
+  }
+}
@@ -0,0 +1,120 @@
+#include "detail/pcm_conversion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>   // sin, fabs
+#include <vector>  // vector
+
+#include "core/integers.hpp"
+
+namespace {
+
+constexpr cen::detail::pcm_format stereo_s16{44'100, AUDIO_S16SYS, 2};
+constexpr cen::detail::pcm_format mono_f32{22'050, AUDIO_F32SYS, 1};
+
+}  // namespace
+
+TEST(PcmConversion, Kernels)
+{
+  std::vector<cen::i16> samples(19);
+  for (cen::usize index = 0; index < samples.size(); ++index) {
+    samples[index] = static_cast<cen::i16>(static_cast<int>(index) * 3'000 - 27'000);
+  }
+
+  std::vector<float> decoded(samples.size());
+  cen::detail::s16_to_f32(samples.data(), decoded.data(), samples.size());
+  ASSERT_FLOAT_EQ(-27'000.0f / 32'768.0f, decoded.front());
+
+  // Out of range samples saturate
+  decoded.back() = 2.0f;
+  decoded.at(1) = -2.0f;
+
+  std::vector<cen::i16> encoded(samples.size());
+  cen::detail::f32_to_s16(decoded.data(), encoded.data(), decoded.size());
+
+  ASSERT_EQ(samples.front(), encoded.front());
+  ASSERT_EQ(32'767, encoded.back());
+  ASSERT_EQ(-32'768, encoded.at(1));
+  ASSERT_EQ(samples.at(9), encoded.at(9));
+
+  std::vector<float> ones(13, 1.0f);
+  ASSERT_FLOAT_EQ(13.0f, cen::detail::dot_f32(ones.data(), ones.data(), ones.size()));
+}
+
+TEST(PcmConversion, Formats)
+{
+  const std::vector<float> samples{-1.0f, -0.5f, 0.0f, 0.5f};
+
+  for (const auto format : {AUDIO_U8, AUDIO_S8, AUDIO_U16MSB, AUDIO_S16MSB, AUDIO_S32LSB}) {
+    std::vector<cen::u8> encoded(samples.size() * SDL_AUDIO_BITSIZE(format) / 8);
+    cen::detail::encode_pcm(samples.data(), format, encoded.data(), samples.size());
+
+    std::vector<float> decoded(samples.size());
+    cen::detail::decode_pcm(encoded.data(), format, decoded.data(), samples.size());
+
+    for (cen::usize index = 0; index < samples.size(); ++index) {
+      ASSERT_NEAR(samples[index], decoded[index], 1e-6);
+    }
+  }
+
+  ASSERT_TRUE(cen::detail::is_convertible(stereo_s16));
+  ASSERT_FALSE(cen::detail::is_convertible({44'100, AUDIO_S16SYS, 0}));
+}
+
+TEST(PcmConversion, Channels)
+{
+  // Stereo to mono averages the channels, at the same sample rate
+  const std::vector<cen::i16> stereo{1'000, 3'000, -2'000, -4'000};
+  const cen::detail::pcm_format mono{44'100, AUDIO_S16SYS, 1};
+
+  std::vector<cen::i16> output(2);
+  cen::detail::convert_pcm(reinterpret_cast<const cen::u8*>(stereo.data()),
+                           2,
+                           stereo_s16,
+                           reinterpret_cast<cen::u8*>(output.data()),
+                           2,
+                           mono,
+                           nullptr);
+
+  ASSERT_EQ(2'000, output.at(0));
+  ASSERT_EQ(-3'000, output.at(1));
+}
+
+TEST(PcmConversion, Resample)
+{
+  ASSERT_EQ(88'200u, cen::detail::resampled_frames(44'100, 22'050, 44'100));
+
+  // A 1 kHz sine, upsampled from 22050 Hz to 44100 Hz, and converted to stereo S16
+  constexpr auto pi = 3.14159265358979323846;
+  constexpr cen::usize frames = 2'205;
+
+  std::vector<float> sine(frames);
+  for (cen::usize index = 0; index < frames; ++index) {
+    sine[index] = 0.5f * static_cast<float>(std::sin(2.0 * pi * 1'000.0 * index / 22'050.0));
+  }
+
+  const auto targetFrames = cen::detail::resampled_frames(frames, 22'050, 44'100);
+  ASSERT_EQ(2 * frames, targetFrames);
+
+  const cen::detail::sinc_filter filter{16, 128, 0.9};
+
+  for (const auto* kernel : {static_cast<const cen::detail::sinc_filter*>(nullptr), &filter}) {
+    std::vector<cen::i16> output(targetFrames * 2);
+    cen::detail::convert_pcm(reinterpret_cast<const cen::u8*>(sine.data()),
+                             frames,
+                             mono_f32,
+                             reinterpret_cast<cen::u8*>(output.data()),
+                             targetFrames,
+                             stereo_s16,
+                             kernel);
+
+    // Ignore the edges, where the filter sees the zero padding
+    for (cen::usize frame = 32; frame < targetFrames - 32; ++frame) {
+      const auto expected = 0.5 * std::sin(2.0 * pi * 1'000.0 * frame / 44'100.0);
+      const auto left = output[frame * 2] / 32'768.0;
+
+      ASSERT_NEAR(expected, left, kernel ? 0.005 : 0.02);
+      ASSERT_EQ(output[frame * 2], output[frame * 2 + 1]);
+    }
+  }
+}
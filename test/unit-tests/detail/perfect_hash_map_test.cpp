@@ -0,0 +1,50 @@
+#include "detail/perfect_hash_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>  // make_pair
+
+namespace {
+
+enum class sparse
+{
+  low = -1,
+  mid = 7,
+  high = 100
+};
+
+inline constexpr cen::detail::perfect_hash_map<sparse, 3> sparse_map{
+    std::make_pair(sparse::high, "High"),
+    std::make_pair(sparse::low, "Low"),
+    std::make_pair(sparse::mid, "Left Shift")};
+
+}  // namespace
+
+// The map is usable in constant expressions
+static_assert(*sparse_map.find("high") == sparse::high);
+static_assert(sparse_map.find("foo") == nullptr);
+static_assert(sparse_map.name_of(sparse::mid) == "Left Shift");
+
+TEST(PerfectHashMap, Find)
+{
+  ASSERT_EQ(sparse::low, *sparse_map.find("Low"));
+  ASSERT_EQ(sparse::mid, *sparse_map.find("Left Shift"));
+  ASSERT_EQ(sparse::high, *sparse_map.find("High"));
+
+  // Names are case-insensitive
+  ASSERT_EQ(sparse::high, *sparse_map.find("HIGH"));
+  ASSERT_EQ(sparse::mid, *sparse_map.find("left shift"));
+
+  ASSERT_FALSE(sparse_map.find(""));
+  ASSERT_FALSE(sparse_map.find("Hig"));
+  ASSERT_FALSE(sparse_map.find("Highs"));
+  ASSERT_FALSE(sparse_map.find("LeftShift"));
+}
+
+TEST(PerfectHashMap, NameOf)
+{
+  ASSERT_EQ("Low", sparse_map.name_of(sparse::low));
+  ASSERT_EQ("Left Shift", sparse_map.name_of(sparse::mid));
+  ASSERT_EQ("High", sparse_map.name_of(sparse::high));
+  ASSERT_TRUE(sparse_map.name_of(static_cast<sparse>(0)).empty());
+}
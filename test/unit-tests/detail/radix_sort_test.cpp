@@ -0,0 +1,45 @@
+#include "detail/radix_sort.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // is_sorted, stable_sort
+#include <utility>    // pair
+#include <vector>     // vector
+
+#include "core/integers.hpp"
+
+TEST(RadixSort, Sort)
+{
+  using item = std::pair<cen::u64, int>;
+
+  std::vector<item> values;
+  cen::u64 state = 42;
+  for (int index = 0; index < 1'000; ++index) {
+    state = state * 6'364'136'223'846'793'005u + 1'442'695'040'888'963'407u;
+    values.emplace_back(state >> (index % 3 == 0 ? 60u : 20u), index);
+  }
+
+  auto expected = values;
+  std::stable_sort(expected.begin(), expected.end(), [](const item& a, const item& b) {
+    return a.first < b.first;
+  });
+
+  std::vector<item> scratch;
+  cen::detail::radix_sort(values, scratch, [](const item& value) { return value.first; });
+
+  // The sort is stable, so the result is identical to std::stable_sort
+  ASSERT_EQ(expected, values);
+}
+
+TEST(RadixSort, SharedDigits)
+{
+  std::vector<cen::u32> values{0xAB00'0003, 0xAB00'0001, 0xAB00'0002};
+  std::vector<cen::u32> scratch;
+
+  cen::detail::radix_sort(values, scratch, [](const cen::u32 value) { return value; });
+  ASSERT_EQ((std::vector<cen::u32>{0xAB00'0001, 0xAB00'0002, 0xAB00'0003}), values);
+
+  std::vector<cen::u32> empty;
+  ASSERT_NO_THROW(cen::detail::radix_sort(empty, scratch, [](const cen::u32 v) { return v; }));
+  ASSERT_TRUE(empty.empty());
+}
@@ -0,0 +1,81 @@
+#include "detail/spsc_byte_ring.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <thread>  // thread, yield
+#include <vector>  // vector
+
+#include "core/integers.hpp"
+
+TEST(SpscByteRing, ReadWrite)
+{
+  cen::detail::spsc_byte_ring ring{6};
+  ASSERT_EQ(8u, ring.capacity());
+  ASSERT_EQ(0u, ring.size());
+
+  const std::array<cen::u8, 5> input{1, 2, 3, 4, 5};
+  ASSERT_EQ(5u, ring.write(input.data(), input.size()));
+
+  // Only three bytes fit
+  ASSERT_EQ(3u, ring.write(input.data(), input.size()));
+  ASSERT_EQ(8u, ring.size());
+  ASSERT_EQ(0u, ring.write(input.data(), input.size()));
+
+  std::array<cen::u8, 6> output{};
+  ASSERT_EQ(6u, ring.read(output.data(), output.size()));
+  ASSERT_EQ((std::array<cen::u8, 6>{1, 2, 3, 4, 5, 1}), output);
+
+  // Wraps around the end of the buffer
+  ASSERT_EQ(5u, ring.write(input.data(), input.size()));
+  ASSERT_EQ(1u, ring.skip(1));
+
+  ASSERT_EQ(6u, ring.read(output.data(), output.size()));
+  ASSERT_EQ((std::array<cen::u8, 6>{3, 1, 2, 3, 4, 5}), output);
+
+  ASSERT_EQ(0u, ring.read(output.data(), output.size()));
+  ASSERT_EQ(0u, ring.skip(1));
+}
+
+TEST(SpscByteRing, Threads)
+{
+  constexpr cen::usize total = 10'000;
+  cen::detail::spsc_byte_ring ring{64};
+
+  std::thread producer{[&] {
+    cen::usize written = 0;
+    while (written < total) {
+      std::array<cen::u8, 7> block{};
+      for (cen::usize index = 0; index < block.size(); ++index) {
+        block[index] = static_cast<cen::u8>(written + index);
+      }
+
+      const auto size = (total - written < block.size()) ? total - written : block.size();
+      if (const auto count = ring.write(block.data(), size); count != 0) {
+        written += count;
+      }
+      else {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  std::vector<cen::u8> received;
+  received.reserve(total);
+
+  while (received.size() < total) {
+    std::array<cen::u8, 13> block{};
+    const auto count = ring.read(block.data(), block.size());
+    if (count == 0) {
+      std::this_thread::yield();
+    }
+
+    received.insert(received.end(), block.begin(), block.begin() + count);
+  }
+
+  producer.join();
+
+  for (cen::usize index = 0; index < total; ++index) {
+    ASSERT_EQ(static_cast<cen::u8>(index), received[index]);
+  }
+}
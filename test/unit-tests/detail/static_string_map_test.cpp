@@ -0,0 +1,63 @@
+#include "detail/static_string_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>  // make_pair
+
+namespace {
+
+enum class dense
+{
+  one,
+  two,
+  three
+};
+
+enum class sparse
+{
+  low = -1,
+  high = 100
+};
+
+inline constexpr cen::detail::static_string_map<dense, 3> dense_map{
+    std::make_pair(dense::one, "one"),
+    std::make_pair(dense::two, "two"),
+    std::make_pair(dense::three, "three")};
+
+inline constexpr cen::detail::static_string_map<sparse, 2> sparse_map{
+    std::make_pair(sparse::low, "low"),
+    std::make_pair(sparse::high, "high")};
+
+}  // namespace
+
+// The maps are usable in constant expressions
+static_assert(dense_map.key_from("three") == dense::three);
+static_assert(cen::detail::compare_czstrings(dense_map.find(dense::two), "two") == 0);
+static_assert(sparse_map.key_from("high") == sparse::high);
+
+TEST(StaticStringMap, Find)
+{
+  ASSERT_STREQ("one", dense_map.find(dense::one));
+  ASSERT_STREQ("two", dense_map.find(dense::two));
+  ASSERT_STREQ("three", dense_map.find(dense::three));
+  ASSERT_THROW(dense_map.find(static_cast<dense>(3)), cen::cen_error);
+
+  ASSERT_STREQ("low", sparse_map.find(sparse::low));
+  ASSERT_STREQ("high", sparse_map.find(sparse::high));
+  ASSERT_THROW(sparse_map.find(static_cast<sparse>(0)), cen::cen_error);
+}
+
+TEST(StaticStringMap, KeyFrom)
+{
+  ASSERT_EQ(dense::one, dense_map.key_from("one"));
+  ASSERT_EQ(dense::two, dense_map.key_from("two"));
+  ASSERT_EQ(dense::three, dense_map.key_from("three"));
+
+  ASSERT_THROW(dense_map.key_from(""), cen::cen_error);
+  ASSERT_THROW(dense_map.key_from("thre"), cen::cen_error);
+  ASSERT_THROW(dense_map.key_from("threes"), cen::cen_error);
+  ASSERT_THROW(dense_map.key_from(nullptr), cen::cen_error);
+
+  ASSERT_EQ(sparse::low, sparse_map.key_from("low"));
+  ASSERT_EQ(sparse::high, sparse_map.key_from("high"));
+}
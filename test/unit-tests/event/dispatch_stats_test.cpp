@@ -0,0 +1,57 @@
+#include "events/dispatch_stats.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cen::literals;
+
+TEST(LatencyHistogram, Record)
+{
+  cen::latency_histogram histogram;
+  ASSERT_EQ(0u, histogram.count);
+  ASSERT_EQ(0_ns, histogram.mean());
+
+  histogram.record(cen::nanoseconds<cen::u64>{100});
+  histogram.record(cen::nanoseconds<cen::u64>{256});
+  histogram.record(cen::nanoseconds<cen::u64>{600});
+
+  ASSERT_EQ(3u, histogram.count);
+  ASSERT_EQ(1u, histogram.buckets.at(0));
+  ASSERT_EQ(1u, histogram.buckets.at(1));
+  ASSERT_EQ(1u, histogram.buckets.at(2));
+
+  ASSERT_EQ(956u, histogram.total.count());
+  ASSERT_EQ(600u, histogram.max.count());
+  ASSERT_EQ(318u, histogram.mean().count());
+}
+
+TEST(LatencyHistogram, LastBucket)
+{
+  cen::latency_histogram histogram;
+  histogram.record(cen::nanoseconds<cen::u64>{~cen::u64{}});
+
+  ASSERT_EQ(1u, histogram.buckets.back());
+}
+
+TEST(LatencyHistogram, UpperBound)
+{
+  ASSERT_EQ(256u, cen::latency_histogram::upper_bound(0));
+  ASSERT_EQ(512u, cen::latency_histogram::upper_bound(1));
+  ASSERT_EQ(1'024u, cen::latency_histogram::upper_bound(2));
+}
+
+TEST(DispatchStats, Defaults)
+{
+  const cen::dispatch_stats stats;
+  ASSERT_TRUE(stats.types.empty());
+  ASSERT_EQ(0u, stats.total_events());
+  ASSERT_EQ(0.0, stats.mean_queue_depth());
+}
+
+TEST(DispatchStats, TotalEvents)
+{
+  cen::dispatch_stats stats;
+  stats.types[cen::event_type::quit].count = 3;
+  stats.types[cen::event_type::window].count = 4;
+
+  ASSERT_EQ(7u, stats.total_events());
+}
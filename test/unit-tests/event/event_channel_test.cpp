@@ -0,0 +1,137 @@
+#include "events/event_channel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>        // array
+#include <memory>       // unique_ptr, make_unique
+#include <string>       // string
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+#include "thread/thread.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::event_channel<int>>);
+static_assert(!std::is_copy_assignable_v<cen::event_channel<int>>);
+
+namespace {
+
+struct completion_event final
+{
+  int producer{};
+  int value{};
+};
+
+inline constexpr int producerCount = 4;
+inline constexpr int eventsPerProducer = 1'000;
+
+struct producer_data final
+{
+  cen::event_channel<completion_event>* channel{};
+  int producer{};
+};
+
+}  // namespace
+
+TEST(EventChannel, Defaults)
+{
+  const cen::event_channel<int> channel;
+  ASSERT_EQ(cen::event_channel<int>::default_capacity(), channel.capacity());
+  ASSERT_TRUE(channel.empty());
+  ASSERT_EQ(0u, channel.size());
+}
+
+TEST(EventChannel, Capacity)
+{
+  // The capacity is rounded up to the nearest power of two
+  const cen::event_channel<int> channel{5};
+  ASSERT_EQ(8u, channel.capacity());
+}
+
+TEST(EventChannel, PushAndPop)
+{
+  cen::event_channel<std::string> channel{4};
+
+  ASSERT_FALSE(channel.try_pop());
+
+  ASSERT_TRUE(channel.try_push("foo"));
+  ASSERT_TRUE(channel.try_emplace(3u, 'a'));
+  ASSERT_EQ(2u, channel.size());
+
+  ASSERT_EQ("foo", channel.try_pop());
+  ASSERT_EQ("aaa", channel.try_pop());
+  ASSERT_FALSE(channel.try_pop());
+}
+
+TEST(EventChannel, Full)
+{
+  cen::event_channel<int> channel{2};
+
+  ASSERT_TRUE(channel.try_push(1));
+  ASSERT_TRUE(channel.try_push(2));
+  ASSERT_FALSE(channel.try_push(3));
+
+  ASSERT_EQ(1, channel.try_pop());
+  ASSERT_TRUE(channel.try_push(3));
+
+  ASSERT_EQ(2, channel.try_pop());
+  ASSERT_EQ(3, channel.try_pop());
+}
+
+TEST(EventChannel, Drain)
+{
+  cen::event_channel<int> channel{8};
+  for (auto i = 0; i < 5; ++i) {
+    ASSERT_TRUE(channel.try_push(i));
+  }
+
+  std::vector<int> values;
+  ASSERT_EQ(3u, channel.drain([&](const int value) { values.push_back(value); }, 3));
+  ASSERT_EQ(2u, channel.drain([&](const int value) { values.push_back(value); }));
+
+  ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), values);
+  ASSERT_TRUE(channel.empty());
+}
+
+TEST(EventChannel, MultipleProducers)
+{
+  cen::event_channel<completion_event> channel{256};
+
+  std::array<producer_data, producerCount> data{};
+  std::vector<std::unique_ptr<cen::thread>> producers;
+
+  for (auto producer = 0; producer < producerCount; ++producer) {
+    data.at(producer) = producer_data{&channel, producer};
+    producers.push_back(std::make_unique<cen::thread>(
+        [](void* ptr) {
+          auto* data = static_cast<producer_data*>(ptr);
+          for (auto value = 0; value < eventsPerProducer;) {
+            if (data->channel->try_push(completion_event{data->producer, value})) {
+              ++value;
+            }
+          }
+
+          return 0;
+        },
+        "producer",
+        &data.at(producer)));
+  }
+
+  // Events from each producer must be received in order, and exactly once
+  std::array<int, producerCount> expected{};
+  int received{};
+
+  while (received < producerCount * eventsPerProducer) {
+    received += static_cast<int>(channel.drain([&](const completion_event& event) {
+      ASSERT_EQ(expected.at(event.producer), event.value);
+      ++expected.at(event.producer);
+    }));
+  }
+
+  producers.clear();
+
+  for (const auto count : expected) {
+    ASSERT_EQ(eventsPerProducer, count);
+  }
+
+  ASSERT_TRUE(channel.empty());
+}
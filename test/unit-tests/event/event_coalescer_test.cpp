@@ -0,0 +1,104 @@
+#include "events/event_coalescer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+namespace {
+
+[[nodiscard]] auto make_motion(const int x, const int y, const int dx, const int dy)
+    -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_MOUSEMOTION;
+  event.motion.x = x;
+  event.motion.y = y;
+  event.motion.xrel = dx;
+  event.motion.yrel = dy;
+  return event;
+}
+
+[[nodiscard]] auto make_axis(const SDL_JoystickID id, const cen::u8 axis, const cen::i16 value)
+    -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_CONTROLLERAXISMOTION;
+  event.caxis.which = id;
+  event.caxis.axis = axis;
+  event.caxis.value = value;
+  return event;
+}
+
+}  // namespace
+
+TEST(EventCoalescer, Defaults)
+{
+  const cen::event_coalescer coalescer;
+  ASSERT_EQ(0u, coalescer.statistics().total());
+}
+
+TEST(EventCoalescer, MouseMotion)
+{
+  cen::event_coalescer coalescer;
+
+  std::vector<SDL_Event> events;
+  events.push_back(make_motion(10, 10, 1, 2));
+  events.push_back(make_motion(12, 15, 2, 5));
+  events.push_back(make_motion(20, 16, 8, 1));
+
+  ASSERT_EQ(1u, coalescer.coalesce(events.data(), events.size()));
+
+  // The latest position is kept, along with the accumulated relative motion
+  const auto& motion = events.at(0).motion;
+  ASSERT_EQ(20, motion.x);
+  ASSERT_EQ(16, motion.y);
+  ASSERT_EQ(11, motion.xrel);
+  ASSERT_EQ(8, motion.yrel);
+
+  ASSERT_EQ(2u, coalescer.statistics().mouse_motion);
+  ASSERT_EQ(2u, coalescer.statistics().total());
+
+  coalescer.reset_statistics();
+  ASSERT_EQ(0u, coalescer.statistics().total());
+}
+
+TEST(EventCoalescer, Axes)
+{
+  cen::event_coalescer coalescer;
+
+  std::vector<SDL_Event> events;
+  events.push_back(make_axis(0, 0, 100));
+  events.push_back(make_axis(0, 1, 200));
+  events.push_back(make_axis(1, 0, 300));
+  events.push_back(make_axis(0, 0, 400));
+  events.push_back(make_axis(0, 1, 500));
+
+  // Axes of different controllers, and different axes, are coalesced separately
+  ASSERT_EQ(3u, coalescer.coalesce(events.data(), events.size()));
+  ASSERT_EQ(400, events.at(0).caxis.value);
+  ASSERT_EQ(500, events.at(1).caxis.value);
+  ASSERT_EQ(300, events.at(2).caxis.value);
+  ASSERT_EQ(2u, coalescer.statistics().controller_axis);
+}
+
+TEST(EventCoalescer, PreservesOrder)
+{
+  cen::event_coalescer coalescer;
+
+  SDL_Event button{};
+  button.type = SDL_MOUSEBUTTONDOWN;
+
+  std::vector<SDL_Event> events;
+  events.push_back(make_motion(1, 1, 1, 1));
+  events.push_back(make_motion(2, 2, 1, 1));
+  events.push_back(button);
+  events.push_back(make_motion(3, 3, 1, 1));
+
+  // Motion events are never merged across other events
+  ASSERT_EQ(3u, coalescer.coalesce(events.data(), events.size()));
+  ASSERT_EQ(SDL_MOUSEMOTION, events.at(0).type);
+  ASSERT_EQ(2, events.at(0).motion.x);
+  ASSERT_EQ(SDL_MOUSEBUTTONDOWN, events.at(1).type);
+  ASSERT_EQ(SDL_MOUSEMOTION, events.at(2).type);
+  ASSERT_EQ(3, events.at(2).motion.x);
+}
@@ -66,6 +66,248 @@ TEST(EventDispatcher, Bind)
   ASSERT_TRUE(visitedLambda);
 }
 
+TEST(EventDispatcher, Dispatch)
+{
+  cen::event::flush_all();
+
+  cen::event_dispatcher<cen::mouse_motion_event, cen::keyboard_event, cen::quit_event>
+      dispatcher;
+
+  int x{};
+  dispatcher.bind<cen::mouse_motion_event>().to(
+      [&](const cen::mouse_motion_event& event) { x = event.x(); });
+
+  cen::mouse_motion_event motionEvent;
+  motionEvent.set_x(123);
+  ASSERT_TRUE(cen::event::push(motionEvent));
+
+  // Subscribed events without a bound handler, and unsubscribed events, are ignored
+  ASSERT_TRUE(cen::event::push(cen::keyboard_event{}));
+  ASSERT_TRUE(cen::event::push(cen::window_event{}));
+
+  dispatcher.poll();
+  ASSERT_EQ(123, x);
+  ASSERT_EQ(0, cen::event::queue_count());
+}
+
+TEST(EventDispatcher, Listen)
+{
+  cen::event::flush_all();
+
+  event_dispatcher dispatcher;
+
+  int sinkCount{};
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++sinkCount; });
+
+  int listenerCount{};
+  auto listener = [&](const cen::quit_event&) { ++listenerCount; };
+
+  auto& listeners = dispatcher.listen<cen::quit_event>();
+  listeners.connect(listener);
+  const auto connection = listeners.connect(listener);
+  ASSERT_EQ(3u, dispatcher.active_count());
+
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  dispatcher.poll();
+
+  ASSERT_EQ(1, sinkCount);
+  ASSERT_EQ(2, listenerCount);
+
+  ASSERT_TRUE(listeners.disconnect(connection));
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  dispatcher.poll();
+
+  ASSERT_EQ(2, sinkCount);
+  ASSERT_EQ(3, listenerCount);
+
+  dispatcher.reset();
+  ASSERT_EQ(0u, dispatcher.active_count());
+}
+
+TEST(EventDispatcher, PollBatch)
+{
+  cen::event::flush_all();
+
+  event_dispatcher dispatcher;
+  ASSERT_EQ(event_dispatcher::default_batch_size(), dispatcher.batch_size());
+
+  int count{};
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++count; });
+
+  for (auto index = 0; index < 5; ++index) {
+    ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  }
+
+  dispatcher.set_batch_size(3);
+  ASSERT_EQ(3u, dispatcher.batch_size());
+
+  // Events that don't fit in the batch are left in the event queue
+  ASSERT_EQ(3u, dispatcher.poll_batch());
+  ASSERT_EQ(3, count);
+
+  ASSERT_EQ(2u, dispatcher.poll_batch());
+  ASSERT_EQ(5, count);
+
+  ASSERT_EQ(0u, dispatcher.poll_batch());
+}
+
+TEST(EventDispatcher, WaitFor)
+{
+  cen::event::flush_all();
+
+  event_dispatcher dispatcher;
+
+  int count{};
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++count; });
+
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+
+  // All pending events are handled once the first event arrives
+  ASSERT_TRUE(dispatcher.wait_for(cen::milliseconds<int>{10}));
+  ASSERT_EQ(2, count);
+
+  ASSERT_FALSE(dispatcher.wait_for(cen::milliseconds<int>{1}));
+  ASSERT_EQ(2, count);
+
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  ASSERT_TRUE(dispatcher.wait());
+  ASSERT_EQ(3, count);
+}
+
+TEST(EventDispatcher, Instrumentation)
+{
+  cen::event::flush_all();
+
+  event_dispatcher dispatcher;
+  ASSERT_FALSE(dispatcher.is_instrumented());
+
+  dispatcher.bind<cen::quit_event>().to([](const cen::quit_event&) {});
+
+  // Nothing is recorded unless the dispatcher is instrumented
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  dispatcher.poll();
+  ASSERT_EQ(0u, dispatcher.statistics().total_events());
+
+  dispatcher.set_instrumented(true);
+  ASSERT_TRUE(dispatcher.is_instrumented());
+
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  ASSERT_TRUE(cen::event::push(cen::window_event{}));
+  dispatcher.poll();
+
+  const auto& stats = dispatcher.statistics();
+  ASSERT_EQ(3u, stats.total_events());
+  ASSERT_EQ(1u, stats.polls);
+  ASSERT_EQ(3u, stats.maxQueueDepth);
+  ASSERT_EQ(3.0, stats.mean_queue_depth());
+
+  const auto& quit = stats.types.at(cen::event_type::quit);
+  ASSERT_EQ(2u, quit.count);
+  ASSERT_EQ(2u, quit.handled);
+  ASSERT_EQ(2u, quit.handlerTime.count);
+
+  // Window events are subscribed, but don't have any handlers
+  const auto& window = stats.types.at(cen::event_type::window);
+  ASSERT_EQ(1u, window.count);
+  ASSERT_EQ(0u, window.handled);
+
+  dispatcher.reset_statistics();
+  ASSERT_EQ(0u, dispatcher.statistics().total_events());
+  ASSERT_EQ(0u, dispatcher.statistics().polls);
+}
+
+TEST(EventDispatcher, Coalescing)
+{
+  cen::event::flush_all();
+
+  cen::event_dispatcher<cen::mouse_motion_event> dispatcher;
+  ASSERT_FALSE(dispatcher.is_coalescing());
+
+  int count{};
+  dispatcher.bind<cen::mouse_motion_event>().to(
+      [&](const cen::mouse_motion_event&) { ++count; });
+
+  dispatcher.set_coalescing(true);
+  ASSERT_TRUE(dispatcher.is_coalescing());
+
+  for (auto index = 0; index < 4; ++index) {
+    ASSERT_TRUE(cen::event::push(cen::mouse_motion_event{}));
+  }
+
+  ASSERT_EQ(1u, dispatcher.poll_batch());
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(3u, dispatcher.coalescer().statistics().mouse_motion);
+}
+
+TEST(EventDispatcher, Channel)
+{
+  cen::event::flush_all();
+
+  struct completion_event final
+  {
+    int value{};
+  };
+
+  cen::event_dispatcher<cen::quit_event, completion_event> dispatcher;
+  cen::event_channel<completion_event> channel;
+
+  int sum{};
+  dispatcher.bind<completion_event>().to([&](const completion_event& e) { sum += e.value; });
+
+  int listenerCount{};
+  auto listener = [&](const completion_event&) { ++listenerCount; };
+  dispatcher.listen<completion_event>().connect(listener);
+
+  dispatcher.attach(channel);
+
+  ASSERT_TRUE(channel.try_push(completion_event{1}));
+  ASSERT_TRUE(channel.try_push(completion_event{2}));
+
+  dispatcher.poll();
+  ASSERT_EQ(3, sum);
+  ASSERT_EQ(2, listenerCount);
+  ASSERT_TRUE(channel.empty());
+
+  ASSERT_TRUE(channel.try_push(completion_event{4}));
+  ASSERT_EQ(1u, dispatcher.poll_batch());
+  ASSERT_EQ(7, sum);
+
+  dispatcher.detach(channel);
+
+  ASSERT_TRUE(channel.try_push(completion_event{8}));
+  dispatcher.poll();
+  ASSERT_EQ(7, sum);
+  ASSERT_EQ(1u, channel.size());
+}
+
+TEST(EventDispatcher, MainThreadQueue)
+{
+  cen::event::flush_all();
+
+  cen::event_dispatcher<cen::quit_event> dispatcher;
+  cen::main_thread_queue queue;
+
+  int executed{};
+  dispatcher.attach(queue);
+
+  queue.submit([&] { ++executed; });
+  dispatcher.poll();
+  ASSERT_EQ(1, executed);
+
+  queue.submit([&] { ++executed; });
+  ASSERT_EQ(1u, dispatcher.poll_batch());
+  ASSERT_EQ(2, executed);
+
+  dispatcher.detach(queue);
+
+  queue.submit([&] { ++executed; });
+  dispatcher.poll();
+  ASSERT_EQ(2, executed);
+  ASSERT_EQ(1u, queue.pending());
+}
+
 TEST(EventDispatcher, Reset)
 {
   event_dispatcher dispatcher;
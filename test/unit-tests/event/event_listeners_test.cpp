@@ -0,0 +1,135 @@
+#include "events/event_listeners.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_trivially_copyable_v
+#include <vector>       // vector
+
+#include "events/quit_event.hpp"
+
+using listeners_type = cen::event_listeners<cen::quit_event, 2>;
+
+static_assert(std::is_trivially_copyable_v<cen::event_delegate<cen::quit_event>>);
+static_assert(sizeof(cen::event_delegate<cen::quit_event>) == 2 * sizeof(void*));
+
+namespace {
+
+inline int freeFunctionCount{};
+
+void on_quit(const cen::quit_event&)
+{
+  ++freeFunctionCount;
+}
+
+struct quit_handler final
+{
+  void on_event(const cen::quit_event&)
+  {
+    ++count;
+  }
+
+  int count{};
+};
+
+}  // namespace
+
+TEST(EventDelegate, Defaults)
+{
+  const cen::event_delegate<cen::quit_event> delegate;
+  ASSERT_FALSE(delegate);
+}
+
+TEST(EventDelegate, Bind)
+{
+  freeFunctionCount = 0;
+
+  const auto function = cen::event_delegate<cen::quit_event>::bind<&on_quit>();
+  ASSERT_TRUE(function);
+
+  function(cen::quit_event{});
+  ASSERT_EQ(1, freeFunctionCount);
+
+  quit_handler handler;
+  const auto member =
+      cen::event_delegate<cen::quit_event>::bind<&quit_handler::on_event>(&handler);
+
+  member(cen::quit_event{});
+  ASSERT_EQ(1, handler.count);
+
+  int lambdaCount{};
+  auto lambda = [&](const cen::quit_event&) { ++lambdaCount; };
+  const auto callable = cen::event_delegate<cen::quit_event>::bind(lambda);
+
+  callable(cen::quit_event{});
+  ASSERT_EQ(1, lambdaCount);
+}
+
+TEST(EventListeners, Defaults)
+{
+  const listeners_type listeners;
+  ASSERT_TRUE(listeners.empty());
+  ASSERT_EQ(0u, listeners.size());
+  ASSERT_EQ(2u, listeners_type::inline_capacity());
+}
+
+TEST(EventListeners, Publish)
+{
+  freeFunctionCount = 0;
+
+  listeners_type listeners;
+  quit_handler handler;
+
+  std::vector<int> order;
+  auto first = [&](const cen::quit_event&) { order.push_back(1); };
+  auto second = [&](const cen::quit_event&) { order.push_back(2); };
+
+  listeners.connect(first);
+  listeners.connect<&on_quit>();
+  listeners.connect<&quit_handler::on_event>(&handler);
+  listeners.connect(second);
+
+  // The listeners exceed the inline capacity at this point
+  ASSERT_EQ(4u, listeners.size());
+
+  listeners.publish(cen::quit_event{});
+  ASSERT_EQ(1, freeFunctionCount);
+  ASSERT_EQ(1, handler.count);
+  ASSERT_EQ((std::vector<int>{1, 2}), order);
+}
+
+TEST(EventListeners, Disconnect)
+{
+  listeners_type listeners;
+
+  int firstCount{};
+  int secondCount{};
+  auto first = [&](const cen::quit_event&) { ++firstCount; };
+  auto second = [&](const cen::quit_event&) { ++secondCount; };
+
+  const auto a = listeners.connect(first);
+  const auto b = listeners.connect(second);
+  const auto c = listeners.connect(first);
+
+  ASSERT_NE(a, b);
+  ASSERT_NE(b, c);
+
+  ASSERT_TRUE(listeners.disconnect(b));
+  ASSERT_FALSE(listeners.disconnect(b));
+  ASSERT_EQ(2u, listeners.size());
+
+  listeners.publish(cen::quit_event{});
+  ASSERT_EQ(2, firstCount);
+  ASSERT_EQ(0, secondCount);
+
+  ASSERT_TRUE(listeners.disconnect(a));
+  ASSERT_TRUE(listeners.disconnect(c));
+  ASSERT_TRUE(listeners.empty());
+
+  // Falls back to the inline storage when all heap-allocated listeners are removed
+  listeners.connect(second);
+  listeners.publish(cen::quit_event{});
+  ASSERT_EQ(1, secondCount);
+
+  listeners.clear();
+  ASSERT_TRUE(listeners.empty());
+}
@@ -0,0 +1,48 @@
+#include "events/event_prefilter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // find
+
+TEST(EventPrefilter, IgnoresUnsubscribedEvents)
+{
+  const cen::event_dispatcher<cen::quit_event, cen::keyboard_event> dispatcher;
+
+  {
+    const cen::event_prefilter prefilter{dispatcher};
+    ASSERT_FALSE(prefilter.ignored().empty());
+
+    // Subscribed events are left as is
+    ASSERT_EQ(SDL_ENABLE, SDL_EventState(SDL_QUIT, SDL_QUERY));
+    ASSERT_EQ(SDL_ENABLE, SDL_EventState(SDL_KEYDOWN, SDL_QUERY));
+    ASSERT_EQ(SDL_ENABLE, SDL_EventState(SDL_KEYUP, SDL_QUERY));
+
+    ASSERT_EQ(SDL_IGNORE, SDL_EventState(SDL_MOUSEMOTION, SDL_QUERY));
+    ASSERT_EQ(SDL_IGNORE, SDL_EventState(SDL_WINDOWEVENT, SDL_QUERY));
+
+    // Events without dedicated event types are not affected
+    ASSERT_EQ(SDL_ENABLE, SDL_EventState(SDL_KEYMAPCHANGED, SDL_QUERY));
+
+    const auto& ignored = prefilter.ignored();
+    ASSERT_NE(ignored.end(), std::find(ignored.begin(), ignored.end(), SDL_MOUSEMOTION));
+    ASSERT_EQ(ignored.end(), std::find(ignored.begin(), ignored.end(), SDL_QUIT));
+  }
+
+  ASSERT_EQ(SDL_ENABLE, SDL_EventState(SDL_MOUSEMOTION, SDL_QUERY));
+  ASSERT_EQ(SDL_ENABLE, SDL_EventState(SDL_WINDOWEVENT, SDL_QUERY));
+}
+
+TEST(EventPrefilter, PreservesDisabledEvents)
+{
+  SDL_EventState(SDL_MOUSEWHEEL, SDL_IGNORE);
+
+  {
+    const cen::event_dispatcher<cen::quit_event> dispatcher;
+    const cen::event_prefilter prefilter{dispatcher};
+    ASSERT_EQ(SDL_IGNORE, SDL_EventState(SDL_MOUSEWHEEL, SDL_QUERY));
+  }
+
+  // Events that were already disabled stay disabled
+  ASSERT_EQ(SDL_IGNORE, SDL_EventState(SDL_MOUSEWHEEL, SDL_QUERY));
+  SDL_EventState(SDL_MOUSEWHEEL, SDL_ENABLE);
+}
@@ -0,0 +1,109 @@
+#include "events/event_recording.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>  // string
+
+#include "events/mouse_motion_event.hpp"
+#include "events/quit_event.hpp"
+#include "filesystem/preferred_path.hpp"
+
+using namespace cen::literals;
+
+class EventRecordingTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "events";
+
+ protected:
+  static void record_motion(cen::event_recorder& recorder, const cen::u32 timestamp)
+  {
+    SDL_Event event{};
+    event.motion.type = SDL_MOUSEMOTION;
+    event.motion.timestamp = timestamp;
+    event.motion.x = static_cast<cen::i32>(timestamp);
+    ASSERT_TRUE(recorder.record(event));
+  }
+};
+
+TEST_F(EventRecordingTest, RecordAndReplay)
+{
+  {
+    cen::event_recorder recorder{path};
+    ASSERT_EQ(0u, recorder.count());
+
+    record_motion(recorder, 100);
+    record_motion(recorder, 110);
+
+    SDL_Event drop{};
+    drop.type = SDL_DROPFILE;
+    ASSERT_TRUE(recorder.record(drop));
+
+    SDL_Event quit{};
+    quit.type = SDL_QUIT;
+    quit.quit.timestamp = 150;
+    ASSERT_TRUE(recorder.record(quit));
+
+    ASSERT_EQ(3u, recorder.count());
+    ASSERT_EQ(1u, recorder.skipped());
+  }
+
+  cen::event_dispatcher<cen::mouse_motion_event, cen::quit_event> dispatcher;
+
+  int motionCount = 0;
+  int quitCount = 0;
+
+  dispatcher.bind<cen::mouse_motion_event>().to([&](const cen::mouse_motion_event& event) {
+    ASSERT_EQ(100 + 10 * motionCount, event.x());
+    ++motionCount;
+  });
+
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++quitCount; });
+
+  cen::event_replayer replayer{path};
+  ASSERT_FALSE(replayer.is_done());
+  ASSERT_EQ(0_ms, replayer.next_time());
+
+  ASSERT_EQ(1u, replayer.replay_until(dispatcher, 5_ms));
+  ASSERT_EQ(1, motionCount);
+  ASSERT_EQ(10_ms, replayer.next_time());
+
+  ASSERT_EQ(2u, replayer.replay(dispatcher));
+  ASSERT_EQ(2, motionCount);
+  ASSERT_EQ(1, quitCount);
+
+  ASSERT_TRUE(replayer.is_done());
+  ASSERT_FALSE(replayer.next_time());
+  ASSERT_FALSE(replayer.next());
+}
+
+TEST_F(EventRecordingTest, Next)
+{
+  {
+    cen::event_recorder recorder{path};
+    record_motion(recorder, 42);
+  }
+
+  cen::event_replayer replayer{path};
+
+  const auto event = replayer.next();
+  ASSERT_TRUE(event);
+  ASSERT_EQ(SDL_MOUSEMOTION, event->type);
+  ASSERT_EQ(42u, event->motion.timestamp);
+  ASSERT_EQ(42, event->motion.x);
+
+  ASSERT_TRUE(replayer.is_done());
+}
+
+TEST_F(EventRecordingTest, InvalidRecording)
+{
+  ASSERT_THROW(cen::event_replayer{prefs + "foo"}, cen::cen_error);
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_TRUE(file.write_as_little_endian(cen::u32{0xDEADBEEF}));
+  }
+
+  ASSERT_THROW(cen::event_replayer{path}, cen::cen_error);
+}
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>  // array
 #include <type_traits>
 
 namespace {
@@ -138,6 +139,46 @@ TEST(Event, Poll)
   cen::event::flush_all();
 }
 
+TEST(Event, PollBatch)
+{
+  cen::event::flush_all();
+
+  for (auto index = 0; index < 4; ++index) {
+    ASSERT_TRUE(cen::event::push(cen::window_event{}));
+  }
+
+  std::array<SDL_Event, 3> buffer{};
+  ASSERT_EQ(3u, cen::event::poll_batch(buffer.data(), buffer.size()));
+  ASSERT_EQ(SDL_WINDOWEVENT, buffer.at(0).type);
+  ASSERT_EQ(1, cen::event::queue_count());
+
+  ASSERT_EQ(1u, cen::event::poll_batch(buffer.data(), buffer.size()));
+  ASSERT_EQ(0u, cen::event::poll_batch(buffer.data(), buffer.size()));
+}
+
+TEST(Event, WaitFor)
+{
+  cen::event::flush_all();
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+
+  cen::event event;
+  ASSERT_TRUE(event.wait_for(cen::milliseconds<int>{10}));
+  ASSERT_TRUE(event.is<cen::quit_event>());
+
+  ASSERT_FALSE(event.wait_for(cen::milliseconds<int>{1}));
+  ASSERT_TRUE(event.is_empty());
+}
+
+TEST(Event, Wait)
+{
+  cen::event::flush_all();
+  ASSERT_TRUE(cen::event::push(cen::window_event{}));
+
+  cen::event event;
+  ASSERT_TRUE(event.wait());
+  ASSERT_TRUE(event.is<cen::window_event>());
+}
+
 TEST(Event, QueueCount)
 {
   cen::event::flush_all();
@@ -0,0 +1,88 @@
+#include "events/event_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_trivially_copyable_v, is_same_v, decay_t
+#include <variant>      // monostate
+
+static_assert(std::is_trivially_copyable_v<cen::event_view>);
+static_assert(sizeof(cen::event_view) == sizeof(SDL_Event*));
+
+TEST(EventView, Is)
+{
+  SDL_Event event{};
+  event.type = SDL_MOUSEMOTION;
+
+  const cen::event_view view{event};
+  ASSERT_TRUE(view.is<cen::mouse_motion_event>());
+  ASSERT_FALSE(view.is<cen::mouse_button_event>());
+  ASSERT_FALSE(view.is<std::monostate>());
+
+  // The view follows modifications of the viewed event
+  event.type = SDL_QUIT;
+  ASSERT_TRUE(view.is<cen::quit_event>());
+  ASSERT_FALSE(view.is<cen::mouse_motion_event>());
+
+  event.type = SDL_LASTEVENT;
+  ASSERT_TRUE(view.is<std::monostate>());
+}
+
+TEST(EventView, Get)
+{
+  SDL_Event event{};
+  event.motion.type = SDL_MOUSEMOTION;
+  event.motion.x = 12;
+  event.motion.y = 34;
+
+  const cen::event_view view{event};
+
+  const auto motion = view.get<cen::mouse_motion_event>();
+  ASSERT_EQ(12, motion.x());
+  ASSERT_EQ(34, motion.y());
+
+  ASSERT_THROW(view.get<cen::window_event>(), cen::cen_error);
+}
+
+TEST(EventView, TryGet)
+{
+  SDL_Event event{};
+  event.key.type = SDL_KEYDOWN;
+  event.key.keysym.scancode = SDL_SCANCODE_A;
+
+  const cen::event_view view{event};
+  ASSERT_TRUE(view.try_get<cen::keyboard_event>());
+  ASSERT_FALSE(view.try_get<cen::quit_event>());
+  ASSERT_FALSE(view.try_get<std::monostate>());
+}
+
+TEST(EventView, Visit)
+{
+  SDL_Event event{};
+  event.wheel.type = SDL_MOUSEWHEEL;
+  event.wheel.y = 3;
+
+  int count = 0;
+  cen::event_view{event}.visit([&](const auto& wrapper) {
+    using event_t = std::decay_t<decltype(wrapper)>;
+    if constexpr (std::is_same_v<event_t, cen::mouse_wheel_event>) {
+      ASSERT_EQ(3, wrapper.y_scroll());
+      ++count;
+    }
+  });
+  ASSERT_EQ(1, count);
+
+  event.type = SDL_KEYMAPCHANGED;
+  cen::event_view{event}.visit([&](const auto&) { ++count; });
+  ASSERT_EQ(1, count);
+}
+
+TEST(EventView, FromEvent)
+{
+  const cen::event event{cen::quit_event{}};
+
+  const cen::event_view view{event};
+  ASSERT_EQ(event.data(), view.data());
+  ASSERT_EQ(cen::event_type::quit, view.type());
+  ASSERT_EQ(event.data()->common.timestamp, view.time());
+  ASSERT_TRUE(view.is<cen::quit_event>());
+}
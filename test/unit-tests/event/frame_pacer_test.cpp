@@ -0,0 +1,73 @@
+#include "events/frame_pacer.hpp"
+
+#include <gtest/gtest.h>
+
+#include "events/quit_event.hpp"
+
+using namespace cen::literals;
+
+TEST(FramePacer, Interval)
+{
+  const cen::frame_pacer pacer{16_ms};
+  ASSERT_EQ(16_ms, pacer.interval());
+}
+
+TEST(FramePacer, SetInterval)
+{
+  cen::frame_pacer pacer{16_ms};
+  pacer.set_interval(8_ms);
+  ASSERT_EQ(8_ms, pacer.interval());
+}
+
+TEST(FramePacer, PowerChange)
+{
+  cen::frame_pacer pacer{16_ms};
+
+  cen::power_change change;
+  change.settings.frame_rate = 30;
+
+  pacer.handle(change);
+  ASSERT_EQ(33_ms, pacer.interval());
+
+  // The limit never shortens the configured interval
+  pacer.set_interval(50_ms);
+  ASSERT_EQ(50_ms, pacer.interval());
+
+  pacer.set_interval(16_ms);
+  ASSERT_EQ(33_ms, pacer.interval());
+
+  change.settings.frame_rate = 0;
+  pacer.handle(change);
+  ASSERT_EQ(16_ms, pacer.interval());
+}
+
+TEST(FramePacer, ForDisplay)
+{
+  const auto pacer = cen::frame_pacer::for_display();
+  ASSERT_GT(pacer.interval(), 0_ms);
+  ASSERT_LE(pacer.interval(), 1'000_ms);
+}
+
+TEST(FramePacer, Wait)
+{
+  cen::event::flush_all();
+
+  cen::event_dispatcher<cen::quit_event> dispatcher;
+
+  int count = 0;
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++count; });
+
+  cen::frame_pacer pacer{5_ms};
+
+  const auto before = cen::counter::ticks();
+  ASSERT_FALSE(pacer.wait(dispatcher));
+  ASSERT_GE(cen::counter::ticks() - before, 5_ms);
+
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  ASSERT_TRUE(pacer.wait(dispatcher));
+  ASSERT_EQ(1, count);
+
+  pacer.reset();
+  ASSERT_FALSE(pacer.wait(dispatcher));
+  ASSERT_EQ(1, count);
+}
@@ -0,0 +1,217 @@
+#include "filesystem/binary_archive.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>  // string
+#include <vector>  // vector
+
+#include "filesystem/preferred_path.hpp"
+
+static_assert(cen::is_bulk_serializable_v<int>);
+static_assert(cen::is_bulk_serializable_v<cen::irect>);
+static_assert(cen::is_bulk_serializable_v<cen::fpoint>);
+static_assert(cen::is_bulk_serializable_v<cen::iarea>);
+static_assert(cen::is_bulk_serializable_v<cen::vector3<float>>);
+static_assert(cen::is_bulk_serializable_v<cen::color>);
+static_assert(cen::is_bulk_serializable_v<cen::scan_code>);
+static_assert(cen::is_bulk_serializable_v<cen::key_code>);
+static_assert(!cen::is_bulk_serializable_v<bool>);
+static_assert(!cen::is_bulk_serializable_v<std::string>);
+
+namespace {
+
+struct entity final
+{
+  std::string name;
+  cen::fpoint position;
+  std::vector<cen::irect> hitboxes;
+  bool visible{};
+
+  template <typename Archive>
+  void serialize(Archive& archive)
+  {
+    archive(name, position, hitboxes, visible);
+  }
+};
+
+struct counter final
+{
+  cen::u16 value{};
+};
+
+template <typename Archive>
+void serialize(Archive& archive, counter& c)
+{
+  archive(c.value);
+}
+
+}  // namespace
+
+class BinaryArchiveTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "binary_archive";
+};
+
+TEST_F(BinaryArchiveTest, Values)
+{
+  const cen::irect rect{1, -2, 3, 4};
+  const cen::vector3<float> vector{1.5f, -2, 3};
+  const cen::iarea area{640, 480};
+  const cen::color color{0x12, 0x34, 0x56, 0x78};
+  const cen::scan_code scan{SDL_SCANCODE_W};
+  const cen::key_code key{SDLK_ESCAPE};
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::binary_output_archive archive{file};
+
+    archive(rect, vector, area, color, scan, key, true, 42.0);
+    ASSERT_TRUE(archive);
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_EQ(16u + 12u + 8u + 4u + 4u + 4u + 1u + 8u, file.size());
+
+  cen::irect rect2;
+  cen::vector3<float> vector2;
+  cen::iarea area2;
+  cen::color color2;
+  cen::scan_code scan2;
+  cen::key_code key2;
+  bool flag{};
+  double number{};
+
+  cen::binary_input_archive archive{file};
+  archive(rect2, vector2, area2, color2, scan2, key2, flag, number);
+  ASSERT_TRUE(archive);
+
+  ASSERT_EQ(rect, rect2);
+  ASSERT_EQ(vector, vector2);
+  ASSERT_EQ(area, area2);
+  ASSERT_EQ(color, color2);
+  ASSERT_EQ(scan, scan2);
+  ASSERT_EQ(key, key2);
+  ASSERT_TRUE(flag);
+  ASSERT_EQ(42.0, number);
+}
+
+TEST_F(BinaryArchiveTest, LittleEndian)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::binary_output_archive archive{file};
+    archive(cen::u32{0x01020304});
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_EQ(0x01020304u, file.read_little_endian_u32());
+}
+
+TEST_F(BinaryArchiveTest, Bulk)
+{
+  std::vector<cen::frect> rects;
+  std::vector<cen::color> colors;
+  for (int i = 0; i < 5'000; ++i) {
+    const auto value = static_cast<float>(i);
+    rects.emplace_back(value, -value, value * 2, 0.5f);
+    colors.emplace_back(static_cast<cen::u8>(i), 0, static_cast<cen::u8>(i / 2));
+  }
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::binary_output_archive archive{file};
+
+    archive(rects, colors);
+    ASSERT_EQ(rects.size(), archive.write_bulk(rects.data(), rects.size()));
+    ASSERT_TRUE(archive);
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::binary_input_archive archive{file};
+
+  std::vector<cen::frect> rects2;
+  std::vector<cen::color> colors2;
+  archive(rects2, colors2);
+  ASSERT_EQ(rects, rects2);
+  ASSERT_EQ(colors, colors2);
+
+  std::vector<cen::frect> raw(rects.size());
+  ASSERT_EQ(raw.size(), archive.read_bulk(raw.data(), raw.size()));
+  ASSERT_EQ(rects, raw);
+  ASSERT_TRUE(archive);
+}
+
+TEST_F(BinaryArchiveTest, UserTypes)
+{
+  std::vector<entity> entities(3);
+  entities[0] = {"player", {1, 2}, {{0, 0, 10, 20}}, true};
+  entities[1] = {"enemy", {3, 4}, {{1, 1, 5, 5}, {2, 2, 6, 6}}, false};
+
+  const counter c{1'234};
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::binary_output_archive archive{file};
+
+    archive(entities, c);
+    ASSERT_TRUE(archive);
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::binary_input_archive archive{file};
+
+  std::vector<entity> entities2;
+  counter c2;
+  archive(entities2, c2);
+  ASSERT_TRUE(archive);
+
+  ASSERT_EQ(entities.size(), entities2.size());
+  for (cen::usize i = 0; i < entities.size(); ++i) {
+    ASSERT_EQ(entities[i].name, entities2[i].name);
+    ASSERT_EQ(entities[i].position, entities2[i].position);
+    ASSERT_EQ(entities[i].hitboxes, entities2[i].hitboxes);
+    ASSERT_EQ(entities[i].visible, entities2[i].visible);
+  }
+
+  ASSERT_EQ(c.value, c2.value);
+}
+
+TEST_F(BinaryArchiveTest, Truncated)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::binary_output_archive archive{file};
+    archive(cen::u16{7});
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::binary_input_archive archive{file};
+
+  cen::u64 value{};
+  archive(value);
+  ASSERT_FALSE(archive);
+
+  // Subsequent reads are ignored
+  int other = 5;
+  archive(other);
+  ASSERT_EQ(5, other);
+}
+
+TEST_F(BinaryArchiveTest, CorruptSize)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::binary_output_archive archive{file};
+    archive(cen::u64{1'000'000'000'000}, 1, 2, 3);
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::binary_input_archive archive{file};
+
+  std::vector<cen::irect> rects;
+  archive(rects);
+  ASSERT_FALSE(archive);
+  ASSERT_TRUE(rects.empty());
+}
@@ -0,0 +1,99 @@
+#include "filesystem/buffered_reader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_final_v
+#include <vector>       // vector
+
+#include "filesystem/preferred_path.hpp"
+
+using namespace cen::literals;
+
+static_assert(std::is_final_v<cen::buffered_reader>);
+
+class BufferedReaderTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "buffered_reader";
+
+ protected:
+  static void SetUpTestSuite()
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    file.write_byte(42u);
+    file.write_as_little_endian(0x1234_u16);
+    file.write_as_big_endian(0x12345678_u32);
+    file.write_as_little_endian(0x0102030405060708_u64);
+    file.write_as_big_endian(0x0102030405060708_u64);
+
+    const std::vector<int> values(32, 7);
+    file.write(values);
+  }
+};
+
+TEST_F(BufferedReaderTest, Defaults)
+{
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  const cen::buffered_reader reader{file};
+
+  ASSERT_EQ(cen::buffered_reader::default_buffer_size(), reader.buffer_size());
+  ASSERT_EQ(0u, reader.available());
+  ASSERT_EQ(0, reader.offset());
+  ASSERT_TRUE(reader.good());
+}
+
+TEST_F(BufferedReaderTest, ReadValues)
+{
+  cen::file file{path, cen::file_mode::read_existing_binary};
+
+  // The small buffer forces values to straddle refills
+  cen::buffered_reader reader{file, 8};
+
+  ASSERT_EQ(42u, reader.read_byte());
+  ASSERT_EQ(1, reader.offset());
+  ASSERT_EQ(7u, reader.available());
+
+  ASSERT_EQ(0x1234u, reader.read_little_endian_u16());
+  ASSERT_EQ(0x12345678u, reader.read_big_endian_u32());
+  ASSERT_EQ(0x0102030405060708u, reader.read_little_endian_u64());
+  ASSERT_EQ(0x0102030405060708u, reader.read_big_endian_u64());
+  ASSERT_EQ(23, reader.offset());
+
+  std::vector<int> values(32);
+  ASSERT_EQ(values.size(), reader.read_to(values));
+  ASSERT_EQ(7, values.front());
+  ASSERT_EQ(7, values.back());
+  ASSERT_TRUE(reader.good());
+
+  ASSERT_EQ(0u, reader.read_little_endian_u32());
+  ASSERT_FALSE(reader.good());
+}
+
+TEST_F(BufferedReaderTest, Read)
+{
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::buffered_reader reader{file};
+
+  ASSERT_EQ(42u, reader.read<cen::u8>());
+
+  cen::u8 bytes[2]{};
+  ASSERT_EQ(2u, reader.read_to(bytes));
+  ASSERT_EQ(0x34u, bytes[0]);
+  ASSERT_EQ(0x12u, bytes[1]);
+}
+
+TEST_F(BufferedReaderTest, Seek)
+{
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::buffered_reader reader{file};
+
+  ASSERT_EQ(42u, reader.read_byte());
+
+  ASSERT_EQ(3, reader.seek(2, cen::seek_mode::relative_to_current));
+  ASSERT_EQ(3, reader.offset());
+  ASSERT_EQ(0x12345678u, reader.read_big_endian_u32());
+
+  ASSERT_EQ(1, reader.seek(1, cen::seek_mode::from_beginning));
+  ASSERT_EQ(0x1234u, reader.read_little_endian_u16());
+}
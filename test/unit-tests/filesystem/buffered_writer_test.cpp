@@ -0,0 +1,91 @@
+#include "filesystem/buffered_writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>        // array
+#include <type_traits>  // is_final_v
+#include <vector>       // vector
+
+#include "filesystem/preferred_path.hpp"
+
+using namespace cen::literals;
+
+static_assert(std::is_final_v<cen::buffered_writer>);
+
+static_assert(!std::is_copy_constructible_v<cen::buffered_writer>);
+static_assert(!std::is_copy_assignable_v<cen::buffered_writer>);
+
+class BufferedWriterTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "buffered_writer";
+};
+
+TEST_F(BufferedWriterTest, Defaults)
+{
+  cen::file file{path, cen::file_mode::write_binary};
+  const cen::buffered_writer writer{file};
+
+  ASSERT_EQ(cen::buffered_writer::default_buffer_size(), writer.buffer_size());
+  ASSERT_EQ(0u, writer.buffered());
+}
+
+TEST_F(BufferedWriterTest, WriteAndFlush)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::buffered_writer writer{file, 16};
+
+    ASSERT_TRUE(writer.write_byte(42u));
+    ASSERT_TRUE(writer.write_as_little_endian(0x1234_u16));
+    ASSERT_TRUE(writer.write_as_big_endian(0x1234_u16));
+    ASSERT_TRUE(writer.write_as_little_endian(0x12345678_u32));
+    ASSERT_EQ(9u, writer.buffered());
+
+    // Exceeds the buffer, which flushes the buffered data
+    ASSERT_TRUE(writer.write_as_big_endian(0x0102030405060708_u64));
+    ASSERT_EQ(8u, writer.buffered());
+
+    ASSERT_TRUE(writer.flush());
+    ASSERT_EQ(0u, writer.buffered());
+    ASSERT_EQ(17, file.offset());
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_EQ(42u, file.read_byte());
+  ASSERT_EQ(0x1234u, file.read_little_endian_u16());
+  ASSERT_EQ(0x1234u, file.read_big_endian_u16());
+  ASSERT_EQ(0x12345678u, file.read_little_endian_u32());
+  ASSERT_EQ(0x0102030405060708u, file.read_big_endian_u64());
+}
+
+TEST_F(BufferedWriterTest, WriteObjects)
+{
+  const std::vector<int> large(64, 7);
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::buffered_writer writer{file, 16};
+
+    const int array[] = {1, 2, 3};
+    ASSERT_EQ(3u, writer.write(array));
+
+    // Larger than the buffer, so it is written directly
+    ASSERT_EQ(large.size(), writer.write(large));
+    ASSERT_EQ(0u, writer.buffered());
+
+    const std::array<int, 2> small{4, 5};
+    ASSERT_EQ(2u, writer.write(small));
+    ASSERT_EQ(8u, writer.buffered());
+  }  // The destructor flushes the remaining data
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_EQ((3 + large.size() + 2) * sizeof(int), file.size());
+
+  std::vector<int> contents(3 + large.size() + 2);
+  ASSERT_EQ(contents.size(), file.read_to(contents));
+  ASSERT_EQ(1, contents.front());
+  ASSERT_EQ(7, contents.at(3));
+  ASSERT_EQ(5, contents.back());
+}
@@ -2,8 +2,10 @@
 
 #include <gtest/gtest.h>
 
-#include <array>   // array
-#include <vector>  // vector
+#include <array>    // array
+#include <cstddef>  // byte
+#include <string>   // string
+#include <vector>   // vector
 
 #include "filesystem/preferred_path.hpp"
 
@@ -97,6 +99,94 @@ TEST_F(FileTest, WriteAndRead)
   }
 }
 
+TEST_F(FileTest, ReadAll)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_EQ(11u, file.write("hello world", 11));
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  const auto data = file.read_all();
+  ASSERT_EQ(11u, data.size());
+  ASSERT_EQ(std::byte{'h'}, data.front());
+  ASSERT_EQ(std::byte{'d'}, data.back());
+
+  // Everything has already been read
+  ASSERT_TRUE(file.read_all().empty());
+
+  // Only the data after the current offset is read
+  ASSERT_TRUE(file.seek(6, cen::seek_mode::from_beginning).has_value());
+  ASSERT_EQ("world", file.read_all_as_string());
+}
+
+TEST_F(FileTest, ReadAllTo)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_EQ(3u, file.write("abc", 3));
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  // The previous contents of the container are replaced
+  std::string buffer = "previous contents";
+  ASSERT_EQ(3u, file.read_all_to(buffer));
+  ASSERT_EQ("abc", buffer);
+}
+
+TEST_F(FileTest, BulkEndianness)
+{
+  std::vector<cen::u16> u16s(1'000);
+  std::vector<cen::u32> u32s(3'000);  // Larger than the internal swap block
+  std::vector<cen::u64> u64s(7);
+
+  for (cen::usize index = 0; index < u16s.size(); ++index) {
+    u16s[index] = static_cast<cen::u16>(index * 7);
+  }
+
+  for (cen::usize index = 0; index < u32s.size(); ++index) {
+    u32s[index] = static_cast<cen::u32>(index * 100'003);
+  }
+
+  for (cen::usize index = 0; index < u64s.size(); ++index) {
+    u64s[index] = index * 0x0102'0304'0506;
+  }
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_EQ(u16s.size(), file.write_as_little_endian(u16s.data(), u16s.size()));
+    ASSERT_EQ(u32s.size(), file.write_as_big_endian(u32s.data(), u32s.size()));
+    ASSERT_EQ(u64s.size(), file.write_as_big_endian(u64s.data(), u64s.size()));
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+
+  // The values must be compatible with the single value functions
+  ASSERT_EQ(u16s[0], file.read_little_endian_u16());
+  ASSERT_EQ(u16s[1], file.read_little_endian_u16());
+
+  std::vector<cen::u16> readU16s(u16s.size() - 2);
+  std::vector<cen::u32> readU32s(u32s.size());
+  std::vector<cen::u64> readU64s(u64s.size() + 1);
+
+  ASSERT_EQ(readU16s.size(), file.read_little_endian_to(readU16s.data(), readU16s.size()));
+  ASSERT_EQ(readU32s.size(), file.read_big_endian_to(readU32s.data(), readU32s.size()));
+  ASSERT_EQ(u64s.size(), file.read_big_endian_to(readU64s.data(), readU64s.size()));
+
+  for (cen::usize index = 0; index < readU16s.size(); ++index) {
+    ASSERT_EQ(u16s[index + 2], readU16s[index]);
+  }
+
+  ASSERT_EQ(u32s, readU32s);
+
+  readU64s.pop_back();
+  ASSERT_EQ(u64s, readU64s);
+}
+
 TEST_F(FileTest, Queries)
 {
   const cen::file file{path, cen::file_mode::read_existing_binary};
@@ -0,0 +1,112 @@
+#include "filesystem/file_watcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>       // remove
+#include <iostream>     // clog
+#include <optional>     // optional
+#include <string>       // string
+#include <type_traits>  // is_final_v
+
+#include "filesystem/file.hpp"
+#include "filesystem/preferred_path.hpp"
+
+static_assert(std::is_final_v<cen::file_watcher>);
+
+static_assert(!std::is_copy_constructible_v<cen::file_watcher>);
+static_assert(!std::is_copy_assignable_v<cen::file_watcher>);
+
+class FileWatcherTest : public testing::Test
+{
+ public:
+  inline static const auto root = cen::preferred_path("centurion", "file_watcher").copy();
+
+  // Waits for the next change, or gives up after a second
+  [[nodiscard]] static auto next(cen::event_channel<cen::file_change>& changes)
+      -> std::optional<cen::file_change>
+  {
+    for (auto attempt = 0; attempt < 100; ++attempt) {
+      if (auto change = changes.try_pop()) {
+        return change;
+      }
+
+      cen::thread::sleep(cen::milliseconds<cen::u32>{10});
+    }
+
+    return std::nullopt;
+  }
+};
+
+TEST_F(FileWatcherTest, Changes)
+{
+  const auto path = root + "asset.txt";
+  std::remove(path.c_str());
+
+  cen::event_channel<cen::file_change> changes;
+  cen::file_watcher watcher{changes, root, cen::milliseconds<cen::u32>{20}};
+  ASSERT_TRUE(watcher);
+  ASSERT_EQ(root, watcher.root());
+  ASSERT_EQ(20u, watcher.debounce().count());
+
+  {
+    // Both the creation and the write are reported as one change
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_TRUE(file.write_byte(42u));
+  }
+
+  const auto added = next(changes);
+  ASSERT_TRUE(added.has_value());
+  ASSERT_EQ("asset.txt", added->path);
+  ASSERT_EQ(cen::file_action::added, added->action);
+
+  {
+    cen::file file{path, cen::file_mode::append_or_create_binary};
+    ASSERT_TRUE(file.write_byte(7u));
+  }
+
+  const auto modified = next(changes);
+  ASSERT_TRUE(modified.has_value());
+  ASSERT_EQ(cen::file_action::modified, modified->action);
+
+  ASSERT_EQ(0, std::remove(path.c_str()));
+
+  const auto removed = next(changes);
+  ASSERT_TRUE(removed.has_value());
+  ASSERT_EQ(cen::file_action::removed, removed->action);
+}
+
+TEST_F(FileWatcherTest, TemporaryFiles)
+{
+  const auto path = root + "temporary.txt";
+
+  cen::event_channel<cen::file_change> changes;
+  cen::file_watcher watcher{changes, root, cen::milliseconds<cen::u32>{50}};
+  ASSERT_TRUE(watcher);
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_TRUE(file.write_byte(42u));
+  }
+
+  // Files that are removed before the debounce interval has elapsed are not reported
+  ASSERT_EQ(0, std::remove(path.c_str()));
+  ASSERT_FALSE(next(changes).has_value());
+}
+
+TEST_F(FileWatcherTest, MissingDirectory)
+{
+  cen::event_channel<cen::file_change> changes;
+  const cen::file_watcher watcher{changes, root + "missing/"};
+  ASSERT_FALSE(watcher);
+}
+
+TEST(FileAction, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::file_action>(3)), cen::cen_error);
+
+  ASSERT_EQ("added", cen::to_string(cen::file_action::added));
+  ASSERT_EQ("modified", cen::to_string(cen::file_action::modified));
+  ASSERT_EQ("removed", cen::to_string(cen::file_action::removed));
+
+  std::clog << "File action example: " << cen::file_action::modified << '\n';
+}
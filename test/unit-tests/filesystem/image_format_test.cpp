@@ -0,0 +1,83 @@
+#include "filesystem/image_format.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>     // clog
+#include <string_view>  // string_view
+
+#include "filesystem/file.hpp"
+
+namespace {
+
+[[nodiscard]] auto detect(const std::string_view header) -> cen::image_format
+{
+  return cen::detect_image_format(header.data(), header.size());
+}
+
+}  // namespace
+
+TEST(ImageFormat, Detect)
+{
+  using namespace std::string_view_literals;
+
+  ASSERT_EQ(cen::image_format::png, detect("\x89PNG\r\n\x1A\n"sv));
+  ASSERT_EQ(cen::image_format::jpg, detect("\xFF\xD8\xFF\xE0"sv));
+  ASSERT_EQ(cen::image_format::gif, detect("GIF89a"sv));
+  ASSERT_EQ(cen::image_format::bmp, detect("BM"sv));
+  ASSERT_EQ(cen::image_format::ico, detect("\0\0\1\0\1\0"sv));
+  ASSERT_EQ(cen::image_format::cur, detect("\0\0\2\0\1\0"sv));
+  ASSERT_EQ(cen::image_format::webp, detect("RIFF\0\0\0\0WEBPVP8 "sv));
+  ASSERT_EQ(cen::image_format::tif, detect("II*\0"sv));
+  ASSERT_EQ(cen::image_format::tif, detect("MM\0*"sv));
+  ASSERT_EQ(cen::image_format::pnm, detect("P6\n"sv));
+  ASSERT_EQ(cen::image_format::pcx, detect("\x0A\x05\x01"sv));
+  ASSERT_EQ(cen::image_format::lbm, detect("FORM\0\0\0\0ILBM"sv));
+  ASSERT_EQ(cen::image_format::xcf, detect("gimp xcf v011"sv));
+  ASSERT_EQ(cen::image_format::xpm, detect("/* XPM */"sv));
+  ASSERT_EQ(cen::image_format::xv, detect("P7 332"sv));
+  ASSERT_EQ(cen::image_format::svg, detect("<?xml version=\"1.0\"?>\n<svg>"sv));
+  ASSERT_EQ(cen::image_format::qoi, detect("qoif\0\0\0\1\0\0\0\1\4\0"sv));
+
+  ASSERT_EQ(cen::image_format::unknown, detect(""sv));
+  ASSERT_EQ(cen::image_format::unknown, detect("\0\0\1\0\0\0"sv));  // No images
+  ASSERT_EQ(cen::image_format::unknown, detect("RIFF\0\0\0\0WAVEfmt "sv));
+  ASSERT_EQ(cen::image_format::unknown, cen::detect_image_format(nullptr, 0));
+}
+
+TEST(ImageFormat, DetectFile)
+{
+  cen::file image{"resources/panda.png", cen::file_mode::read_existing_binary};
+  ASSERT_EQ(cen::image_format::png, image.detect_image_format());
+
+  // The offset is restored after the detection
+  ASSERT_EQ(0, image.offset());
+
+  cen::file sound{"resources/click.wav", cen::file_mode::read_existing_binary};
+  ASSERT_EQ(cen::image_format::unknown, sound.detect_image_format());
+  ASSERT_EQ(0, sound.offset());
+}
+
+TEST(ImageFormat, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::image_format>(17)), cen::cen_error);
+
+  ASSERT_EQ("unknown", cen::to_string(cen::image_format::unknown));
+  ASSERT_EQ("png", cen::to_string(cen::image_format::png));
+  ASSERT_EQ("jpg", cen::to_string(cen::image_format::jpg));
+  ASSERT_EQ("gif", cen::to_string(cen::image_format::gif));
+  ASSERT_EQ("bmp", cen::to_string(cen::image_format::bmp));
+  ASSERT_EQ("ico", cen::to_string(cen::image_format::ico));
+  ASSERT_EQ("cur", cen::to_string(cen::image_format::cur));
+  ASSERT_EQ("webp", cen::to_string(cen::image_format::webp));
+  ASSERT_EQ("tif", cen::to_string(cen::image_format::tif));
+  ASSERT_EQ("pnm", cen::to_string(cen::image_format::pnm));
+  ASSERT_EQ("pcx", cen::to_string(cen::image_format::pcx));
+  ASSERT_EQ("lbm", cen::to_string(cen::image_format::lbm));
+  ASSERT_EQ("xcf", cen::to_string(cen::image_format::xcf));
+  ASSERT_EQ("xpm", cen::to_string(cen::image_format::xpm));
+  ASSERT_EQ("xv", cen::to_string(cen::image_format::xv));
+  ASSERT_EQ("svg", cen::to_string(cen::image_format::svg));
+  ASSERT_EQ("qoi", cen::to_string(cen::image_format::qoi));
+
+  std::clog << "Image format example: " << cen::image_format::png << '\n';
+}
@@ -0,0 +1,132 @@
+#include "filesystem/io_service.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>      // byte
+#include <optional>     // optional
+#include <string>       // string
+#include <type_traits>  // is_final_v
+#include <vector>       // vector
+
+#include "filesystem/preferred_path.hpp"
+
+static_assert(std::is_final_v<cen::io_service>);
+
+static_assert(!std::is_copy_constructible_v<cen::io_service>);
+static_assert(!std::is_copy_assignable_v<cen::io_service>);
+
+class IOServiceTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "io_service";
+
+  [[nodiscard]] static auto make_data(const std::string& text) -> std::vector<std::byte>
+  {
+    std::vector<std::byte> data;
+    for (const auto ch : text) {
+      data.push_back(static_cast<std::byte>(ch));
+    }
+
+    return data;
+  }
+};
+
+TEST_F(IOServiceTest, WriteAndRead)
+{
+  cen::io_service io;
+  ASSERT_EQ(2u, io.worker_count());
+
+  std::optional<cen::io_completion> written;
+  io.write(path, make_data("hello"), [&](cen::io_completion& completion) {
+    written = std::move(completion);
+  });
+
+  io.wait();
+  ASSERT_EQ(1u, io.pending());
+  ASSERT_EQ(1u, io.poll());
+  ASSERT_EQ(0u, io.pending());
+
+  ASSERT_TRUE(written);
+  ASSERT_TRUE(written->succeeded);
+  ASSERT_EQ(cen::io_operation::write, written->operation);
+  ASSERT_EQ(5u, written->transferred);
+
+  io.append(path, make_data(" world"));
+
+  io.wait();
+  io.poll();
+
+  std::optional<cen::io_completion> whole;
+  std::optional<cen::io_completion> range;
+
+  const auto wholeId = io.read(path, [&](cen::io_completion& completion) {
+    whole = std::move(completion);
+  });
+
+  const auto rangeId = io.read(path, 6, 64, [&](cen::io_completion& completion) {
+    range = std::move(completion);
+  });
+
+  io.wait();
+  ASSERT_EQ(2u, io.poll());
+
+  ASSERT_TRUE(whole);
+  ASSERT_EQ(wholeId, whole->id);
+  ASSERT_TRUE(whole->succeeded);
+  ASSERT_EQ(make_data("hello world"), whole->data);
+
+  // The range is truncated at the end of the file
+  ASSERT_TRUE(range);
+  ASSERT_EQ(rangeId, range->id);
+  ASSERT_TRUE(range->succeeded);
+  ASSERT_EQ(make_data("world"), range->data);
+}
+
+TEST_F(IOServiceTest, Channel)
+{
+  cen::event_channel<cen::io_completion> channel;
+  cen::io_service io{channel, 1};
+
+  io.write(path, make_data("abc"));
+  const auto id = io.read("foobar");
+
+  io.wait();
+  ASSERT_EQ(0u, io.pending());
+  ASSERT_EQ(2u, channel.size());
+
+  channel.try_pop();
+
+  const auto failed = channel.try_pop();
+  ASSERT_TRUE(failed);
+  ASSERT_EQ(id, failed->id);
+  ASSERT_FALSE(failed->succeeded);
+  ASSERT_FALSE(failed->error.empty());
+}
+
+#if CENTURION_HAS_FEATURE_COROUTINES
+
+TEST_F(IOServiceTest, ReadFileCoroutine)
+{
+  cen::io_service io{1};
+  cen::coroutine_scheduler scheduler;
+
+  std::optional<cen::io_completion> result;
+  scheduler.spawn([](cen::io_service& io,
+                     std::optional<cen::io_completion>& result) -> cen::coroutine {
+    co_await cen::write_file(io, path, make_data("coroutine"));
+    result = co_await cen::read_file(io, path);
+  }(io, result));
+
+  while (!scheduler.empty()) {
+    io.wait();
+    io.poll();
+    scheduler.update();
+  }
+
+  ASSERT_TRUE(result);
+  ASSERT_TRUE(result->succeeded);
+  ASSERT_EQ(make_data("coroutine"), result->data);
+}
+
+#endif  // CENTURION_HAS_FEATURE_COROUTINES
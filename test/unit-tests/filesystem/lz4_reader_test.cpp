@@ -0,0 +1,73 @@
+#include "filesystem/lz4_reader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>       // string, to_string
+#include <type_traits>  // is_final_v
+#include <vector>       // vector
+
+#include "filesystem/lz4_writer.hpp"
+#include "filesystem/preferred_path.hpp"
+
+static_assert(std::is_final_v<cen::lz4_reader>);
+
+static_assert(!std::is_copy_constructible_v<cen::lz4_reader>);
+static_assert(!std::is_copy_assignable_v<cen::lz4_reader>);
+
+class LZ4ReaderTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "lz4_reader";
+};
+
+TEST_F(LZ4ReaderTest, ReadExternalFrame)
+{
+  std::string expected;
+  for (auto index = 0; index < 8'000; ++index) {
+    expected += "line " + std::to_string(index) + '\n';
+  }
+
+  // Compressed with linked 64 KiB blocks, and block and content checksums
+  cen::file file{"resources/lines.lz4", cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  cen::lz4_reader reader{file};
+
+  std::string read(expected.size(), '\0');
+  ASSERT_EQ(expected.size(), reader.read_to(read.data(), read.size()));
+  ASSERT_EQ(expected, read);
+  ASSERT_TRUE(reader.good());
+
+  char ch{};
+  ASSERT_EQ(0u, reader.read_to(&ch, 1));
+  ASSERT_FALSE(reader.good());
+}
+
+TEST_F(LZ4ReaderTest, CorruptedData)
+{
+  const std::vector<cen::u8> data(1'000, 42);
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::lz4_writer writer{file};
+    ASSERT_EQ(data.size(), writer.write(data));
+  }
+
+  {
+    // Invalidates the content checksum, which is stored last
+    cen::file file{path, cen::file_mode::read_write_existing_binary};
+    ASSERT_TRUE(file.seek(-1, cen::seek_mode::relative_to_end).has_value());
+
+    const auto last = file.read_byte();
+    ASSERT_TRUE(file.seek(-1, cen::seek_mode::relative_to_end).has_value());
+    ASSERT_TRUE(file.write_byte(static_cast<cen::u8>(~last)));
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::lz4_reader reader{file};
+
+  std::vector<cen::u8> read(data.size() + 1);
+  ASSERT_EQ(data.size(), reader.read_to(read));
+  ASSERT_FALSE(reader.good());
+}
@@ -0,0 +1,92 @@
+#include "filesystem/lz4_writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_final_v
+#include <vector>       // vector
+
+#include "filesystem/lz4_reader.hpp"
+#include "filesystem/preferred_path.hpp"
+
+using namespace cen::literals;
+
+static_assert(std::is_final_v<cen::lz4_writer>);
+
+static_assert(!std::is_copy_constructible_v<cen::lz4_writer>);
+static_assert(!std::is_copy_assignable_v<cen::lz4_writer>);
+
+class LZ4WriterTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "lz4_writer";
+};
+
+TEST_F(LZ4WriterTest, WriteAndRead)
+{
+  std::vector<cen::u32> values(100'000);
+  for (std::size_t index = 0; index < values.size(); ++index) {
+    values[index] = static_cast<cen::u32>(index % 1'000);
+  }
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::lz4_writer writer{file};
+
+    ASSERT_TRUE(writer.write_byte(42u));
+    ASSERT_TRUE(writer.write_as_little_endian(0x1234_u16));
+    ASSERT_TRUE(writer.write_as_big_endian(0x12345678_u32));
+    ASSERT_EQ(7u, writer.buffered());
+
+    // Spans several blocks
+    ASSERT_EQ(values.size(), writer.write(values));
+    ASSERT_TRUE(writer.write_as_little_endian(0x0102030405060708_u64));
+
+    ASSERT_TRUE(writer.finish());
+    ASSERT_EQ(0u, writer.buffered());
+    ASSERT_EQ(static_cast<cen::u64>(file.offset()), writer.compressed_size());
+    ASSERT_LT(writer.compressed_size(), values.size() * sizeof(cen::u32) / 2);
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::lz4_reader reader{file};
+
+  ASSERT_EQ(42u, reader.read_byte());
+  ASSERT_EQ(0x1234u, reader.read_little_endian_u16());
+  ASSERT_EQ(0x12345678u, reader.read_big_endian_u32());
+
+  std::vector<cen::u32> read(values.size());
+  ASSERT_EQ(values.size(), reader.read_to(read));
+  ASSERT_EQ(values, read);
+
+  ASSERT_EQ(0x0102030405060708u, reader.read_little_endian_u64());
+  ASSERT_TRUE(reader.good());
+
+  ASSERT_EQ(0u, reader.read_byte());
+  ASSERT_FALSE(reader.good());
+}
+
+TEST_F(LZ4WriterTest, ConcatenatedFrames)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    cen::lz4_writer writer{file};
+
+    // Incompressible data is stored as uncompressed blocks
+    ASSERT_TRUE(writer.write_as_big_endian(0xDEADBEEF_u32));
+    ASSERT_TRUE(writer.flush());
+    ASSERT_TRUE(writer.finish());
+
+    // An empty frame
+    ASSERT_TRUE(writer.finish());
+
+    ASSERT_TRUE(writer.write_byte(7u));
+  }
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  cen::lz4_reader reader{file};
+
+  ASSERT_EQ(0xDEADBEEFu, reader.read_big_endian_u32());
+  ASSERT_EQ(7u, reader.read_byte());
+  ASSERT_TRUE(reader.good());
+}
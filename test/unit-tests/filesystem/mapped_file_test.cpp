@@ -0,0 +1,88 @@
+#include "filesystem/mapped_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>      // memcmp
+#include <type_traits>  // is_final_v
+#include <utility>      // move
+#include <vector>       // vector
+
+static_assert(std::is_final_v<cen::mapped_file>);
+
+static_assert(std::is_nothrow_move_constructible_v<cen::mapped_file>);
+static_assert(std::is_nothrow_move_assignable_v<cen::mapped_file>);
+
+static_assert(!std::is_copy_constructible_v<cen::mapped_file>);
+static_assert(!std::is_copy_assignable_v<cen::mapped_file>);
+
+inline constexpr auto path = "resources/click.wav";
+
+namespace {
+
+[[nodiscard]] auto read_contents() -> std::vector<cen::u8>
+{
+  cen::file source{path, cen::file_mode::read_existing_binary};
+  std::vector<cen::u8> contents(source.size().value());
+  source.read_to(contents);
+  return contents;
+}
+
+}  // namespace
+
+TEST(MappedFile, Map)
+{
+  const auto contents = read_contents();
+
+  const cen::mapped_file mapped{path};
+  ASSERT_TRUE(mapped);
+  ASSERT_EQ(contents.size(), mapped.size());
+  ASSERT_EQ(0, std::memcmp(contents.data(), mapped.data(), contents.size()));
+
+#if CENTURION_HAS_FEATURE_SPAN
+  ASSERT_EQ(contents.size(), mapped.bytes().size());
+#endif  // CENTURION_HAS_FEATURE_SPAN
+}
+
+TEST(MappedFile, MissingFile)
+{
+  const cen::mapped_file mapped{"foobar"};
+  ASSERT_FALSE(mapped);
+  ASSERT_FALSE(mapped.data());
+  ASSERT_EQ(0u, mapped.size());
+  ASSERT_FALSE(mapped.open());
+}
+
+TEST(MappedFile, Open)
+{
+  const auto contents = read_contents();
+  const cen::mapped_file mapped{path};
+
+  auto whole = mapped.open();
+  ASSERT_TRUE(whole);
+  ASSERT_EQ(contents.size(), whole.size());
+
+  auto range = mapped.open(4, 8);
+  ASSERT_TRUE(range);
+  ASSERT_EQ(8u, range.size());
+  ASSERT_EQ(contents[4], range.read_byte());
+
+  // The size is clamped to the end of the file
+  auto tail = mapped.open(contents.size() - 2);
+  ASSERT_EQ(2u, tail.size());
+
+  ASSERT_FALSE(mapped.open(contents.size() + 1));
+}
+
+TEST(MappedFile, Move)
+{
+  cen::mapped_file mapped{path};
+  const auto* data = mapped.data();
+
+  cen::mapped_file other{std::move(mapped)};
+  ASSERT_FALSE(mapped);  // NOLINT
+  ASSERT_EQ(data, other.data());
+
+  mapped = std::move(other);
+  ASSERT_TRUE(mapped);
+  ASSERT_FALSE(other);  // NOLINT
+}
@@ -0,0 +1,78 @@
+#include "filesystem/save_writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>       // string
+#include <type_traits>  // is_final_v
+
+#include "filesystem/file.hpp"
+#include "filesystem/preferred_path.hpp"
+
+static_assert(std::is_final_v<cen::save_writer>);
+
+static_assert(!std::is_copy_constructible_v<cen::save_writer>);
+static_assert(!std::is_copy_assignable_v<cen::save_writer>);
+
+class SaveWriterTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+
+  [[nodiscard]] static auto read(const std::string& name) -> std::string
+  {
+    cen::file file{prefs + name, cen::file_mode::read_existing_binary};
+    return file ? file.read_all_as_string() : std::string{};
+  }
+};
+
+TEST_F(SaveWriterTest, Save)
+{
+  cen::save_writer saves{prefs};
+  ASSERT_EQ(prefs, saves.directory());
+
+  const std::string first{"first"};
+  saves.save("save_writer.sav", first.data(), first.size());
+
+  ASSERT_TRUE(saves.wait());
+  ASSERT_EQ(0u, saves.pending());
+  ASSERT_EQ(first, read("save_writer.sav"));
+
+  // The temporary file is renamed over the save file
+  ASSERT_FALSE(cen::file(prefs + "save_writer.sav.tmp", cen::file_mode::read_existing));
+
+  // Snapshots of the same file that are still queued are replaced
+  for (const auto* text : {"a", "bb", "ccc", "dddd"}) {
+    const std::string data{text};
+    saves.save("save_writer.sav", data.data(), data.size());
+  }
+
+  ASSERT_LE(saves.pending(), 2u);
+  ASSERT_TRUE(saves.wait());
+  ASSERT_EQ("dddd", read("save_writer.sav"));
+  ASSERT_TRUE(saves.last_error().empty());
+}
+
+TEST_F(SaveWriterTest, SaveOnDestruction)
+{
+  {
+    cen::save_writer saves{prefs};
+
+    const std::string data{"queued"};
+    saves.save("save_writer_queued.sav", data.data(), data.size());
+  }
+
+  ASSERT_EQ("queued", read("save_writer_queued.sav"));
+}
+
+TEST_F(SaveWriterTest, Failure)
+{
+  cen::save_writer saves{prefs + "missing/"};
+
+  saves.save("save_writer.sav", {});
+
+  ASSERT_FALSE(saves.wait());
+  ASSERT_FALSE(saves.last_error().empty());
+
+  // The failure is reset by waiting
+  ASSERT_TRUE(saves.wait());
+}
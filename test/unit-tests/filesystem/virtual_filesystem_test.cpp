@@ -0,0 +1,95 @@
+#include "filesystem/virtual_filesystem.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>       // string
+#include <type_traits>  // is_final_v
+
+static_assert(std::is_final_v<cen::virtual_filesystem>);
+
+static_assert(std::is_nothrow_move_constructible_v<cen::virtual_filesystem>);
+static_assert(std::is_nothrow_move_assignable_v<cen::virtual_filesystem>);
+
+static_assert(!std::is_copy_constructible_v<cen::virtual_filesystem>);
+static_assert(!std::is_copy_assignable_v<cen::virtual_filesystem>);
+
+namespace {
+
+[[nodiscard]] auto read_text(cen::file source) -> std::string
+{
+  return source ? source.read_all_as_string() : std::string{};
+}
+
+}  // namespace
+
+TEST(VirtualFilesystem, Zip)
+{
+  cen::virtual_filesystem vfs;
+  ASSERT_TRUE(vfs.mount_archive("resources/assets.zip"));
+
+  // Directories and compressed entries are not indexed
+  ASSERT_EQ(2u, vfs.indexed_count());
+  ASSERT_TRUE(vfs.contains("sprites/player.txt"));
+  ASSERT_FALSE(vfs.contains("sprites/"));
+  ASSERT_FALSE(vfs.contains("packed.txt"));
+
+  ASSERT_EQ("hello", read_text(vfs.open("a.txt")));
+  ASSERT_EQ("player", read_text(vfs.open("/sprites\\player.txt")));
+  ASSERT_FALSE(vfs.open("missing.txt"));
+}
+
+TEST(VirtualFilesystem, Pak)
+{
+  cen::virtual_filesystem vfs;
+  ASSERT_TRUE(vfs.mount_archive("resources/assets.pak", "data"));
+
+  ASSERT_EQ(2u, vfs.indexed_count());
+  ASSERT_EQ("patched", read_text(vfs.open("data/a.txt")));
+  ASSERT_EQ("enemy", read_text(vfs.open("data/sprites/enemy.txt")));
+  ASSERT_FALSE(vfs.open("a.txt"));
+}
+
+TEST(VirtualFilesystem, InvalidArchive)
+{
+  cen::virtual_filesystem vfs;
+  ASSERT_FALSE(vfs.mount_archive("foobar.zip"));
+  ASSERT_FALSE(vfs.mount_archive("resources/click.wav"));
+  ASSERT_EQ(0u, vfs.indexed_count());
+}
+
+TEST(VirtualFilesystem, Precedence)
+{
+  cen::virtual_filesystem vfs;
+  ASSERT_TRUE(vfs.mount_archive("resources/assets.zip"));
+  ASSERT_TRUE(vfs.mount_archive("resources/assets.pak"));
+
+  // The PAK file was mounted last, so it overrides the ZIP file
+  ASSERT_EQ("patched", read_text(vfs.open("a.txt")));
+  ASSERT_EQ("player", read_text(vfs.open("sprites/player.txt")));
+
+  constexpr char memory[] = "memory";
+  vfs.mount_memory("a.txt", memory, sizeof memory - 1);
+  ASSERT_EQ("memory", read_text(vfs.open("a.txt")));
+
+  vfs.clear();
+  ASSERT_EQ(0u, vfs.indexed_count());
+  ASSERT_FALSE(vfs.open("a.txt"));
+}
+
+TEST(VirtualFilesystem, Directory)
+{
+  cen::virtual_filesystem vfs;
+  vfs.mount_directory("resources", "res");
+
+  ASSERT_TRUE(vfs.open("res/click.wav"));
+  ASSERT_FALSE(vfs.open("click.wav"));
+  ASSERT_FALSE(vfs.contains("res/click.wav"));
+
+  // Indexed files that are mounted later take precedence over directories
+  constexpr char memory[] = "memory";
+  vfs.mount_memory("res/CREDITS.txt", memory, sizeof memory - 1);
+  ASSERT_EQ("memory", read_text(vfs.open("res/CREDITS.txt")));
+
+  vfs.mount_directory("resources", "res");
+  ASSERT_NE("memory", read_text(vfs.open("res/CREDITS.txt")));
+}
@@ -0,0 +1,74 @@
+#include "hints/hint_profile.hpp"
+
+#include <gtest/gtest.h>
+
+#include "hints/common_hints.hpp"
+#include "hints/hints.hpp"
+#include "hints/mouse_hints.hpp"
+
+using cen::hint::double_buffer;
+using cen::hint::render_driver;
+using cen::hint::mouse::double_click_time;
+using cen::hint::mouse::normal_speed_scale;
+
+namespace {
+
+inline constexpr auto profile =
+    cen::make_hint_profile(cen::hint_value<render_driver>(render_driver::value::software),
+                           cen::hint_value<double_buffer>(true),
+                           cen::hint_value<double_click_time>(250),
+                           cen::hint_value<normal_speed_scale>(1.5f));
+
+}  // namespace
+
+static_assert(profile.size() == 4);
+static_assert(cen::detail::are_unique_v<render_driver, double_buffer>);
+static_assert(!cen::detail::are_unique_v<render_driver, double_buffer, render_driver>);
+
+TEST(HintProfile, Apply)
+{
+  const auto report = profile.apply(cen::hint_priority::override);
+  ASSERT_TRUE(report.ok());
+  ASSERT_EQ(4u, report.applied);
+
+  ASSERT_EQ(render_driver::value::software, cen::get_hint<render_driver>());
+  ASSERT_EQ(true, cen::get_hint<double_buffer>());
+  ASSERT_EQ(250, cen::get_hint<double_click_time>());
+  ASSERT_FLOAT_EQ(1.5f, cen::get_hint<normal_speed_scale>().value());
+
+  // The values are passed to SDL as null-terminated strings
+  ASSERT_STREQ("250", SDL_GetHint(SDL_HINT_MOUSE_DOUBLE_CLICK_TIME));
+
+  // Hints that are set with a higher priority are rejected
+  const auto rejected =
+      cen::make_hint_profile(cen::hint_value<render_driver>(render_driver::value::opengl))
+          .apply(cen::hint_priority::low);
+  ASSERT_FALSE(rejected.ok());
+  ASSERT_EQ(0u, rejected.applied);
+  ASSERT_EQ(1u, rejected.rejected.size());
+  ASSERT_EQ(SDL_HINT_RENDER_DRIVER, rejected.rejected.front());
+}
+
+TEST(HintProfile, ApplyConfig)
+{
+  const auto report = cen::apply_hint_config(
+      "# Performance settings\n"
+      "\n"
+      "SDL_RENDER_DRIVER = opengl\r\n"
+      "  SDL_MOUSE_DOUBLE_CLICK_TIME=300  \n"
+      "malformed line\n"
+      " = 1\n"
+      "SDL_MOUSE_NORMAL_SPEED_SCALE = 2",
+      cen::hint_priority::override);
+
+  ASSERT_EQ(3u, report.applied);
+  ASSERT_EQ(2u, report.rejected.size());
+  ASSERT_EQ("malformed line", report.rejected.at(0));
+  ASSERT_EQ("= 1", report.rejected.at(1));
+
+  ASSERT_EQ(render_driver::value::opengl, cen::get_hint<render_driver>());
+  ASSERT_EQ(300, cen::get_hint<double_click_time>());
+  ASSERT_FLOAT_EQ(2.0f, cen::get_hint<normal_speed_scale>().value());
+
+  ASSERT_FALSE(cen::apply_hint_file("foo/bar/hints.cfg"));
+}
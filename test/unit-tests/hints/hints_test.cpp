@@ -531,3 +531,37 @@ TEST_F(BasicHintTest, HintPriority)
   ASSERT_EQ(SDL_HINT_NORMAL, cen::to_underlying(cen::hint_priority::normal));
   ASSERT_EQ(SDL_HINT_OVERRIDE, cen::to_underlying(cen::hint_priority::override));
 }
+
+TEST_F(BasicHintTest, CachedHint)
+{
+  using cen::hint::mouse::normal_speed_scale;
+  using cen::hint::render_driver;
+
+  cen::set_hint<normal_speed_scale, cen::hint_priority::override>(2.5f);
+  cen::set_hint<render_driver, cen::hint_priority::override>(render_driver::value::metal);
+
+  {
+    const cen::cached_hint<normal_speed_scale> speed;
+    const cen::cached_hint<render_driver> driver;
+    ASSERT_EQ(1u, speed.updates());
+    ASSERT_FLOAT_EQ(2.5f, speed.value().value());
+    ASSERT_EQ(render_driver::value::metal, driver.value());
+
+    // Reading the value doesn't parse the hint again
+    ASSERT_FLOAT_EQ(2.5f, speed.value().value());
+    ASSERT_EQ(1u, speed.updates());
+
+    cen::set_hint<normal_speed_scale, cen::hint_priority::override>(0.5f);
+    cen::set_hint<render_driver, cen::hint_priority::override>(render_driver::value::opengl);
+    ASSERT_EQ(2u, speed.updates());
+    ASSERT_FLOAT_EQ(0.5f, speed.value().value());
+    ASSERT_EQ(render_driver::value::opengl, driver.value());
+
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_DRIVER, "foo", SDL_HINT_OVERRIDE);
+    ASSERT_FALSE(driver.value());
+  }
+
+  // The callbacks are removed when the caches are destroyed
+  cen::set_hint<normal_speed_scale, cen::hint_priority::override>(1.0f);
+  cen::set_hint<render_driver, cen::hint_priority::override>(render_driver::value::software);
+}
@@ -0,0 +1,141 @@
+#include "input/action_map.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(ActionMap, Add)
+{
+  cen::action_map actions;
+  ASSERT_EQ(0u, actions.size());
+
+  const auto jump = actions.add("jump");
+  const auto fire = actions.add("fire");
+  ASSERT_NE(jump, fire);
+  ASSERT_EQ(2u, actions.size());
+
+  // Adding an existing action returns the existing identifier
+  ASSERT_EQ(jump, actions.add("jump"));
+  ASSERT_EQ(2u, actions.size());
+
+  ASSERT_EQ(fire, actions.find("fire"));
+  ASSERT_FALSE(actions.find("crouch"));
+
+  ASSERT_TRUE(actions.contains(jump));
+  ASSERT_FALSE(actions.contains(static_cast<cen::action_id>(2)));
+}
+
+TEST(ActionMap, Keys)
+{
+  cen::action_map actions;
+
+  const auto jump = actions.add("jump");
+  actions.bind(jump, SDL_SCANCODE_SPACE);
+  actions.bind(jump, SDL_SCANCODE_W);
+  ASSERT_EQ(2u, actions.binding_count());
+
+  cen::input_snapshot input;
+  actions.update(input);
+  ASSERT_FALSE(actions.state(jump).is_active());
+  ASSERT_FALSE(actions.state(jump).just_activated());
+
+  input.keys.insert(SDL_SCANCODE_W);
+  actions.update(input);
+  ASSERT_TRUE(actions.state(jump).is_active());
+  ASSERT_TRUE(actions.state(jump).just_activated());
+
+  input.keys.insert(SDL_SCANCODE_SPACE);
+  actions.update(input);
+  ASSERT_TRUE(actions.state(jump).is_active());
+  ASSERT_FALSE(actions.state(jump).just_activated());
+
+  input.keys.clear();
+  actions.update(input);
+  ASSERT_FALSE(actions.state(jump).is_active());
+  ASSERT_TRUE(actions.state(jump).just_deactivated());
+
+  actions.update(input);
+  ASSERT_FALSE(actions.state(jump).just_deactivated());
+}
+
+TEST(ActionMap, Buttons)
+{
+  cen::action_map actions;
+
+  const auto fire = actions.add("fire");
+  const auto pause = actions.add("pause");
+  actions.bind(fire, cen::mouse_button::left);
+  actions.bind(pause, cen::controller_button::start);
+
+  cen::input_snapshot input;
+  input.mouseButtons = SDL_BUTTON(SDL_BUTTON_LEFT);
+  actions.update(input);
+  ASSERT_TRUE(actions.state(fire).is_active());
+  ASSERT_FALSE(actions.state(pause).is_active());
+
+  input.mouseButtons = 0;
+  input.controllerButtons = 1u << static_cast<cen::u32>(SDL_CONTROLLER_BUTTON_START);
+  actions.update(input);
+  ASSERT_FALSE(actions.state(fire).is_active());
+  ASSERT_TRUE(actions.state(pause).is_active());
+}
+
+TEST(ActionMap, Axes)
+{
+  cen::action_map actions;
+
+  const auto left = actions.add("left");
+  const auto right = actions.add("right");
+  actions.bind(left, cen::controller_axis::left_x, -8'000);
+  actions.bind(right, cen::controller_axis::left_x, 8'000);
+
+  cen::input_snapshot input;
+  auto& axis = input.controllerAxes.at(SDL_CONTROLLER_AXIS_LEFTX);
+
+  axis = 100;
+  actions.update(input);
+  ASSERT_FALSE(actions.state(left).is_active());
+  ASSERT_FALSE(actions.state(right).is_active());
+
+  axis = -8'000;
+  actions.update(input);
+  ASSERT_TRUE(actions.state(left).is_active());
+  ASSERT_FALSE(actions.state(right).is_active());
+
+  axis = 20'000;
+  actions.update(input);
+  ASSERT_FALSE(actions.state(left).is_active());
+  ASSERT_TRUE(actions.state(right).is_active());
+}
+
+TEST(ActionMap, States)
+{
+  cen::action_map actions;
+  const auto a = actions.add("a");
+  const auto b = actions.add("b");
+  actions.bind(b, SDL_SCANCODE_B);
+
+  cen::input_snapshot input;
+  input.keys.insert(SDL_SCANCODE_B);
+  actions.update(input);
+
+  const auto& states = actions.states();
+  ASSERT_EQ(2u, states.size());
+  ASSERT_FALSE(states.at(static_cast<cen::usize>(a)).is_active());
+  ASSERT_TRUE(states.at(static_cast<cen::usize>(b)).is_active());
+
+  actions.clear_bindings();
+  ASSERT_EQ(0u, actions.binding_count());
+
+  actions.update(input);
+  ASSERT_TRUE(actions.state(b).just_deactivated());
+}
+
+TEST(ActionMap, UpdateFromDevices)
+{
+  cen::action_map actions;
+  const auto jump = actions.add("jump");
+  actions.bind(jump, SDL_SCANCODE_SPACE);
+
+  const cen::keyboard keyboard;
+  const cen::mouse mouse;
+  ASSERT_NO_THROW(actions.update(keyboard, mouse));
+}
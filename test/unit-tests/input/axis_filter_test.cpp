@@ -0,0 +1,197 @@
+#include "input/axis_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <random>  // mt19937, uniform_int_distribution
+
+namespace {
+
+[[nodiscard]] auto make_snapshot(const cen::i16 x, const cen::i16 y)
+    -> cen::controller_snapshot
+{
+  cen::controller_snapshot snapshot;
+  snapshot.connected[0] = true;
+  snapshot.axes[SDL_CONTROLLER_AXIS_LEFTX][0] = x;
+  snapshot.axes[SDL_CONTROLLER_AXIS_LEFTY][0] = y;
+  return snapshot;
+}
+
+}  // namespace
+
+TEST(AxisFilter, Defaults)
+{
+  const cen::axis_filter filter;
+
+  for (const auto& values : filter.values()) {
+    for (const auto value : values) {
+      ASSERT_EQ(0, value);
+    }
+  }
+
+  ASSERT_EQ(cen::dead_zone_shape::radial, filter.stick_settings().shape);
+  ASSERT_EQ(cen::response_curve::linear, filter.stick_settings().curve);
+}
+
+TEST(AxisFilter, DeadZone)
+{
+  cen::axis_filter filter;
+
+  filter.process(make_snapshot(2'000, 0));
+  ASSERT_EQ(0, filter.value(0, cen::controller_axis::left_x));
+
+  filter.process(make_snapshot(32'767, 0));
+  ASSERT_FLOAT_EQ(1, filter.value(0, cen::controller_axis::left_x));
+
+  filter.process(make_snapshot(-32'768, 0));
+  ASSERT_FLOAT_EQ(-1, filter.value(0, cen::controller_axis::left_x));
+
+  filter.process(make_snapshot(16'384, 0));
+  ASSERT_NEAR((16'384 / 32'767.0f - 0.1f) / 0.9f,
+              filter.value(0, cen::controller_axis::left_x),
+              1e-4f);
+}
+
+TEST(AxisFilter, Shapes)
+{
+  // Each axis is within the dead zone, but the distance from the center isn't
+  const auto snapshot = make_snapshot(3'000, 3'000);
+
+  cen::axis_filter filter;
+  filter.process(snapshot);
+
+  const auto radial = filter.left_stick(0);
+  ASSERT_GT(radial.x(), 0);
+  ASSERT_FLOAT_EQ(radial.x(), radial.y());
+
+  cen::axis_filter_settings settings;
+  settings.shape = cen::dead_zone_shape::axial;
+  filter.set_stick_settings(settings);
+  filter.process(snapshot);
+
+  ASSERT_EQ(cen::fpoint{}, filter.left_stick(0));
+}
+
+TEST(AxisFilter, Curves)
+{
+  cen::axis_filter_settings settings;
+  settings.dead_zone = 0;
+  settings.curve = cen::response_curve::quadratic;
+
+  cen::axis_filter filter{settings, settings};
+  filter.process(make_snapshot(-16'384, 0));
+  ASSERT_NEAR(-0.25f, filter.value(0, cen::controller_axis::left_x), 1e-4f);
+
+  settings.curve = cen::response_curve::cubic;
+  filter.set_stick_settings(settings);
+  filter.process(make_snapshot(-16'384, 0));
+  ASSERT_NEAR(-0.125f, filter.value(0, cen::controller_axis::left_x), 1e-4f);
+}
+
+TEST(AxisFilter, Saturation)
+{
+  cen::axis_filter_settings settings;
+  settings.dead_zone = 0;
+  settings.saturation = 0.5f;
+
+  cen::axis_filter filter{settings, settings};
+  filter.process(make_snapshot(0, 24'000));
+  ASSERT_FLOAT_EQ(1, filter.value(0, cen::controller_axis::left_y));
+
+  // The saturation point is adjusted to be above the dead zone
+  settings.dead_zone = 0.5f;
+  settings.saturation = 0.25f;
+  filter.set_stick_settings(settings);
+  filter.process(make_snapshot(0, 32'767));
+  ASSERT_FLOAT_EQ(1, filter.value(0, cen::controller_axis::left_y));
+}
+
+TEST(AxisFilter, Smoothing)
+{
+  cen::axis_filter_settings settings;
+  settings.dead_zone = 0;
+  settings.smoothing = 0.5f;
+
+  cen::axis_filter filter{settings, settings};
+
+  filter.process(make_snapshot(32'767, 0));
+  ASSERT_FLOAT_EQ(0.5f, filter.value(0, cen::controller_axis::left_x));
+
+  filter.process(make_snapshot(32'767, 0));
+  ASSERT_FLOAT_EQ(0.75f, filter.value(0, cen::controller_axis::left_x));
+
+  filter.reset();
+  ASSERT_EQ(0, filter.value(0, cen::controller_axis::left_x));
+}
+
+TEST(AxisFilter, Triggers)
+{
+  auto snapshot = make_snapshot(0, 0);
+  snapshot.axes[SDL_CONTROLLER_AXIS_TRIGGERLEFT][0] = 32'767;
+  snapshot.axes[SDL_CONTROLLER_AXIS_TRIGGERRIGHT][0] = 1'000;
+
+  cen::axis_filter filter;
+  filter.process(snapshot);
+
+  ASSERT_FLOAT_EQ(1, filter.value(0, cen::controller_axis::trigger_left));
+  ASSERT_EQ(0, filter.value(0, cen::controller_axis::trigger_right));
+}
+
+TEST(AxisFilter, DisconnectedSlots)
+{
+  auto snapshot = make_snapshot(32'767, 32'767);
+  snapshot.axes[SDL_CONTROLLER_AXIS_LEFTX][1] = 32'767;
+
+  cen::axis_filter filter;
+  filter.process(snapshot);
+
+  ASSERT_GT(filter.value(0, cen::controller_axis::left_x), 0);
+  ASSERT_EQ(0, filter.value(1, cen::controller_axis::left_x));
+}
+
+TEST(AxisFilter, KernelsMatchScalar)
+{
+  constexpr int count = 13;
+
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<int> distribution{-32'768, 32'767};
+
+  std::array<cen::i16, count> x{};
+  std::array<cen::i16, count> y{};
+  for (auto i = 0; i < count; ++i) {
+    x[static_cast<cen::usize>(i)] = static_cast<cen::i16>(distribution(engine));
+    y[static_cast<cen::usize>(i)] = static_cast<cen::i16>(distribution(engine));
+  }
+
+  const cen::detail::axis_params params{0.15f, 1.0f / 0.8f, 0.7f, 2};
+
+  std::array<float, count> expectedX{};
+  std::array<float, count> expectedY{};
+  std::array<float, count> actualX{};
+  std::array<float, count> actualY{};
+
+  cen::detail::filter_radial_scalar(x.data(),
+                                    y.data(),
+                                    expectedX.data(),
+                                    expectedY.data(),
+                                    count,
+                                    params);
+  cen::detail::filter_radial(x.data(),
+                             y.data(),
+                             actualX.data(),
+                             actualY.data(),
+                             count,
+                             params);
+
+  for (cen::usize i = 0; i < count; ++i) {
+    ASSERT_NEAR(expectedX[i], actualX[i], 1e-5f);
+    ASSERT_NEAR(expectedY[i], actualY[i], 1e-5f);
+  }
+
+  cen::detail::filter_axial_scalar(x.data(), expectedX.data(), count, params);
+  cen::detail::filter_axial(x.data(), actualX.data(), count, params);
+
+  for (cen::usize i = 0; i < count; ++i) {
+    ASSERT_NEAR(expectedX[i], actualX[i], 1e-5f);
+  }
+}
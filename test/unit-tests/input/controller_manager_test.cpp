@@ -0,0 +1,53 @@
+#include "input/controller_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+static_assert(std::is_final_v<cen::controller_manager>);
+static_assert(!std::is_copy_constructible_v<cen::controller_manager>);
+static_assert(!std::is_copy_assignable_v<cen::controller_manager>);
+
+static_assert(cen::controller_manager::capacity == 8);
+static_assert(cen::controller_snapshot::mask_of(cen::controller_button::a) == 1u);
+
+TEST(ControllerManager, Defaults)
+{
+  const cen::controller_manager manager;
+  ASSERT_EQ(0u, manager.count());
+
+  for (cen::usize slot = 0; slot < cen::controller_manager::capacity; ++slot) {
+    ASSERT_FALSE(manager.is_connected(slot));
+    ASSERT_FALSE(manager.info(slot));
+    ASSERT_FALSE(manager.get(slot));
+  }
+
+  ASSERT_FALSE(manager.is_connected(cen::controller_manager::capacity));
+  ASSERT_FALSE(manager.slot_of(0));
+}
+
+TEST(ControllerManager, Snapshot)
+{
+  const cen::controller_manager manager;
+  const auto& snapshot = manager.snapshot();
+
+  ASSERT_FALSE(snapshot.is_pressed(0, cen::controller_button::a));
+  ASSERT_FALSE(snapshot.just_pressed(0, cen::controller_button::a));
+  ASSERT_FALSE(snapshot.just_released(0, cen::controller_button::a));
+  ASSERT_EQ(0, snapshot.axis(0, cen::controller_axis::left_x));
+}
+
+TEST(ControllerManager, Feed)
+{
+  cen::controller_manager manager;
+
+  cen::controller_device_event event;
+  event.set_type(cen::event_type::controller_device_removed);
+  event.set_which(0);
+  ASSERT_FALSE(manager.feed(event));
+
+  event.set_type(cen::event_type::controller_device_remapped);
+  ASSERT_FALSE(manager.feed(event));
+
+  ASSERT_EQ(0u, manager.count());
+}
@@ -0,0 +1,84 @@
+#include "input/controller_mapping_loader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>       // string
+#include <string_view>  // string_view
+#include <vector>       // vector
+
+namespace {
+
+[[nodiscard]] auto make_database() -> std::string
+{
+  const std::string platform = SDL_GetPlatform();
+
+  std::string database;
+  database += "# Game controller mappings\r\n";
+  database += "\n";
+  database += "03000000ab1200000000000000000000,First,a:b0,platform:" + platform + ",\r\n";
+  database += "03000000cd3400000000000000000000,Second,a:b0,platform:Other,\n";
+  database += "03000000ef5600000000000000000000,Third,a:b0,\n";
+  database += "03000000ab7800000000000000000000,Fourth,a:b0,platform:" + platform + ",";
+  return database;
+}
+
+}  // namespace
+
+TEST(ControllerMappingLoader, ForEachMapping)
+{
+  constexpr std::string_view database =
+      "# Comment, platform:Linux,\n"
+      "guid1,First,a:b0,platform:Linux,\n"
+      "guid2,Second,a:b0,platform:Windows,\r\n"
+      "guid3,Third,a:b0,platform:linux,\r\n"
+      "guid4,Fourth,a:b0,platform:Linux\n"
+      "guid5,Fifth,a:b0,\n"
+      "guid6,Sixth,a:b0,platform:Linux,";
+
+  std::vector<std::string_view> mappings;
+  cen::controller_mapping_loader::for_each_mapping(
+      database,
+      "Linux",
+      [&](const std::string_view mapping) { mappings.push_back(mapping); });
+
+  ASSERT_EQ(3u, mappings.size());
+  ASSERT_EQ("guid1,First,a:b0,platform:Linux,", mappings.at(0));
+  ASSERT_EQ("guid3,Third,a:b0,platform:linux,", mappings.at(1));
+  ASSERT_EQ("guid6,Sixth,a:b0,platform:Linux,", mappings.at(2));
+}
+
+TEST(ControllerMappingLoader, FromFile)
+{
+  ASSERT_FALSE(cen::controller_mapping_loader::from_file("foobar.txt"));
+}
+
+TEST(ControllerMappingLoader, Load)
+{
+  const auto database = make_database();
+  auto loader = cen::controller_mapping_loader::from_memory(database);
+  ASSERT_FALSE(loader.is_loaded());
+
+  ASSERT_EQ(2u, loader.load());
+  ASSERT_TRUE(loader.is_loaded());
+
+  // The database is only loaded once
+  ASSERT_EQ(0u, loader.load());
+}
+
+TEST(ControllerMappingLoader, Deferred)
+{
+  const auto database = make_database();
+  auto loader = cen::controller_mapping_loader::from_memory(database);
+
+  cen::joy_device_event removed;
+  removed.set_type(cen::event_type::joystick_device_removed);
+  ASSERT_FALSE(loader.feed(removed));
+  ASSERT_FALSE(loader.is_loaded());
+
+  cen::controller_device_event added;
+  added.set_type(cen::event_type::controller_device_added);
+  ASSERT_TRUE(loader.feed(added));
+  ASSERT_TRUE(loader.is_loaded());
+
+  ASSERT_FALSE(loader.feed(added));
+}
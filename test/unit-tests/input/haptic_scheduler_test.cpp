@@ -0,0 +1,74 @@
+#include "input/haptic_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_copy_constructible_v
+
+#include "input/haptic_constant.hpp"
+#include "input/haptic_periodic.hpp"
+
+using namespace cen::literals;
+
+static_assert(!std::is_copy_constructible_v<cen::haptic_scheduler>);
+static_assert(!std::is_copy_assignable_v<cen::haptic_scheduler>);
+
+using effect_status = cen::haptic_scheduler::effect_status;
+
+TEST(HapticScheduler, Defaults)
+{
+  cen::haptic_scheduler scheduler{cen::haptic_handle{nullptr}};
+
+  ASSERT_EQ(0u, scheduler.effect_count());
+  ASSERT_EQ(effect_status::unknown, scheduler.status(0));
+
+  scheduler.wait();
+}
+
+TEST(HapticScheduler, Preload)
+{
+  cen::haptic_scheduler scheduler{cen::haptic_handle{nullptr}};
+
+  cen::haptic_constant first;
+  first.set_duration(100_ms);
+
+  cen::haptic_constant second;
+  second.set_duration(100_ms);
+
+  cen::haptic_periodic third;
+  third.set_duration(100_ms);
+
+  const auto a = scheduler.preload(first);
+  const auto b = scheduler.preload(second);
+  const auto c = scheduler.preload(third);
+
+  ASSERT_TRUE(a);
+  ASSERT_TRUE(b);
+  ASSERT_TRUE(c);
+
+  // Effects with equal properties share the same cached effect
+  ASSERT_EQ(*a, *b);
+  ASSERT_NE(*a, *c);
+  ASSERT_EQ(2u, scheduler.effect_count());
+
+  // Uploads fail without a device
+  scheduler.wait();
+  ASSERT_EQ(effect_status::failed, scheduler.status(*a));
+  ASSERT_EQ(effect_status::failed, scheduler.status(*c));
+}
+
+TEST(HapticScheduler, Commands)
+{
+  cen::haptic_scheduler scheduler{cen::haptic_handle{nullptr}};
+
+  cen::haptic_constant effect;
+  const auto handle = scheduler.preload(effect);
+  ASSERT_TRUE(handle);
+
+  // Commands for effects that failed to upload, or unknown handles, are ignored
+  scheduler.play(*handle, 3);
+  scheduler.play(42);
+  scheduler.stop(*handle);
+  scheduler.stop_all();
+
+  scheduler.wait();
+}
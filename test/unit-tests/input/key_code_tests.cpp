@@ -65,6 +65,41 @@ TEST(KeyCode, StdStringConstructor)
   }
 }
 
+static_assert(cen::key_code::from_name("Space") == cen::keycodes::space);
+static_assert(cen::key_code::from_name("left ctrl") == cen::keycodes::left_ctrl);
+
+TEST(KeyCode, FromName)
+{
+  ASSERT_EQ(cen::keycodes::a, cen::key_code::from_name("A"));
+  ASSERT_EQ(cen::keycodes::a, cen::key_code::from_name("a"));
+  ASSERT_EQ(cen::keycodes::five, cen::key_code::from_name("5"));
+  ASSERT_EQ(cen::keycodes::f1, cen::key_code::from_name("F1"));
+  ASSERT_EQ(cen::keycodes::enter, cen::key_code::from_name("Return"));
+  ASSERT_EQ(cen::keycodes::caps_lock, cen::key_code::from_name("CapsLock"));
+
+  // Names that don't belong to any of the constants aren't recognized
+  ASSERT_TRUE(cen::key_code::from_name("Keypad 5").unknown());
+  ASSERT_TRUE(cen::key_code::from_name("").unknown());
+
+  // These are still looked up through SDL by the constructor
+  ASSERT_EQ(SDLK_KP_5, cen::key_code{"Keypad 5"}.get());
+}
+
+TEST(KeyCode, NameTableMatchesSDL)
+{
+  for (auto index = 0; index < SDL_NUM_SCANCODES; ++index) {
+    const auto key = static_cast<SDL_KeyCode>(
+        SDL_GetKeyFromScancode(static_cast<SDL_Scancode>(index)));
+    const auto name = cen::detail::key_code_names.name_of(key);
+
+    if (!name.empty()) {
+      ASSERT_EQ(SDL_GetKeyName(key), name);
+      ASSERT_EQ(key, SDL_GetKeyFromName(name.data()));
+      ASSERT_EQ(key, cen::key_code::from_name(name).get());
+    }
+  }
+}
+
 TEST(KeyCode, SDLKeycodeAssignmentOperator)
 {
   cen::key_code code;
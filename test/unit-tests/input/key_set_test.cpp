@@ -0,0 +1,106 @@
+#include "input/key_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <vector>  // vector
+
+TEST(KeySet, Defaults)
+{
+  const cen::key_set set;
+  ASSERT_TRUE(set.empty());
+  ASSERT_EQ(0u, set.size());
+  ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST(KeySet, InsertAndErase)
+{
+  cen::key_set set;
+
+  set.insert(SDL_SCANCODE_A);
+  set.insert(SDL_SCANCODE_RETURN);
+  ASSERT_TRUE(set.contains(SDL_SCANCODE_A));
+  ASSERT_TRUE(set.contains(SDL_SCANCODE_RETURN));
+  ASSERT_FALSE(set.contains(SDL_SCANCODE_B));
+  ASSERT_EQ(2u, set.size());
+
+  set.erase(SDL_SCANCODE_A);
+  ASSERT_FALSE(set.contains(SDL_SCANCODE_A));
+  ASSERT_EQ(1u, set.size());
+
+  set.clear();
+  ASSERT_TRUE(set.empty());
+}
+
+TEST(KeySet, ContainsInvalidScanCode)
+{
+  const cen::key_set set;
+  ASSERT_FALSE(set.contains(static_cast<SDL_Scancode>(-1)));
+  ASSERT_FALSE(set.contains(static_cast<SDL_Scancode>(cen::key_set::capacity)));
+}
+
+TEST(KeySet, FromStates)
+{
+  std::array<cen::u8, cen::key_set::capacity> states{};
+  states.at(0) = 1;
+  states.at(17) = 1;
+  states.at(63) = 1;
+  states.at(64) = 1;
+  states.at(cen::key_set::capacity - 1) = 1;
+
+  const auto set = cen::key_set::from_states(states.data(), cen::key_set::capacity);
+  ASSERT_EQ(5u, set.size());
+
+  for (auto index = 0; index < cen::key_set::capacity; ++index) {
+    ASSERT_EQ(states[index] != 0, set.contains(static_cast<SDL_Scancode>(index)));
+  }
+
+  // Only the specified amount of states is considered
+  const auto partial = cen::key_set::from_states(states.data(), 20);
+  ASSERT_EQ(2u, partial.size());
+}
+
+TEST(KeySet, Iteration)
+{
+  cen::key_set set;
+  set.insert(SDL_SCANCODE_Z);
+  set.insert(SDL_SCANCODE_A);
+  set.insert(static_cast<SDL_Scancode>(cen::key_set::capacity - 1));
+
+  std::vector<SDL_Scancode> codes;
+  for (const auto code : set) {
+    codes.push_back(code.get());
+  }
+
+  ASSERT_EQ(3u, codes.size());
+  ASSERT_EQ(SDL_SCANCODE_A, codes.at(0));
+  ASSERT_EQ(SDL_SCANCODE_Z, codes.at(1));
+  ASSERT_EQ(cen::key_set::capacity - 1, codes.at(2));
+}
+
+TEST(KeySet, Operators)
+{
+  cen::key_set previous;
+  previous.insert(SDL_SCANCODE_A);
+  previous.insert(SDL_SCANCODE_B);
+
+  cen::key_set current;
+  current.insert(SDL_SCANCODE_B);
+  current.insert(SDL_SCANCODE_C);
+
+  const auto pressed = current - previous;
+  ASSERT_EQ(1u, pressed.size());
+  ASSERT_TRUE(pressed.contains(SDL_SCANCODE_C));
+
+  const auto released = previous - current;
+  ASSERT_EQ(1u, released.size());
+  ASSERT_TRUE(released.contains(SDL_SCANCODE_A));
+
+  const auto held = current & previous;
+  ASSERT_EQ(1u, held.size());
+  ASSERT_TRUE(held.contains(SDL_SCANCODE_B));
+
+  ASSERT_EQ(3u, (current | previous).size());
+  ASSERT_EQ(pressed | released, current ^ previous);
+  ASSERT_NE(current, previous);
+}
@@ -95,3 +95,14 @@ TEST(Keyboard, ToString)
 
   std::clog << keyboard << '\n';
 }
+
+TEST(Keyboard, KeySets)
+{
+  cen::keyboard keyboard;
+  keyboard.update();
+
+  ASSERT_EQ(keyboard.pressed_keys(), keyboard.previous_keys());
+  ASSERT_TRUE(keyboard.just_pressed_keys().empty());
+  ASSERT_TRUE(keyboard.just_released_keys().empty());
+  ASSERT_TRUE(keyboard.changed_keys().empty());
+}
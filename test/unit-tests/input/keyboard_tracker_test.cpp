@@ -0,0 +1,95 @@
+#include "input/keyboard_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "input/scancodes.hpp"
+
+static_assert(std::is_final_v<cen::keyboard_tracker>);
+static_assert(std::is_nothrow_copy_constructible_v<cen::keyboard_tracker>);
+static_assert(std::is_nothrow_copy_assignable_v<cen::keyboard_tracker>);
+
+namespace {
+
+[[nodiscard]] auto make_event(const cen::scan_code& code,
+                              const cen::button_state state,
+                              const bool repeated = false) -> cen::keyboard_event
+{
+  cen::keyboard_event event;
+  event.set_scan_code(code);
+  event.set_button_state(state);
+  event.set_repeated(repeated);
+  return event;
+}
+
+}  // namespace
+
+TEST(KeyboardTracker, Defaults)
+{
+  const cen::keyboard_tracker tracker;
+  ASSERT_TRUE(tracker.pressed_keys().empty());
+  ASSERT_TRUE(tracker.just_pressed_keys().empty());
+  ASSERT_TRUE(tracker.just_released_keys().empty());
+  ASSERT_FALSE(tracker.is_pressed(cen::scancodes::a));
+}
+
+TEST(KeyboardTracker, PressAndRelease)
+{
+  cen::keyboard_tracker tracker;
+
+  tracker.feed(make_event(cen::scancodes::a, cen::button_state::pressed));
+  ASSERT_TRUE(tracker.is_pressed(cen::scancodes::a));
+  ASSERT_TRUE(tracker.was_pressed(cen::scancodes::a));
+  ASSERT_FALSE(tracker.was_released(cen::scancodes::a));
+
+  tracker.update();
+  ASSERT_TRUE(tracker.is_pressed(cen::scancodes::a));
+  ASSERT_FALSE(tracker.was_pressed(cen::scancodes::a));
+
+  tracker.feed(make_event(cen::scancodes::a, cen::button_state::released));
+  ASSERT_FALSE(tracker.is_pressed(cen::scancodes::a));
+  ASSERT_TRUE(tracker.was_released(cen::scancodes::a));
+  ASSERT_TRUE(tracker.pressed_keys().empty());
+}
+
+TEST(KeyboardTracker, SubFrameTap)
+{
+  cen::keyboard_tracker tracker;
+
+  tracker.update();
+  tracker.feed(make_event(cen::scancodes::space, cen::button_state::pressed));
+  tracker.feed(make_event(cen::scancodes::space, cen::button_state::released));
+
+  ASSERT_FALSE(tracker.is_pressed(cen::scancodes::space));
+  ASSERT_TRUE(tracker.was_pressed(cen::scancodes::space));
+  ASSERT_TRUE(tracker.was_released(cen::scancodes::space));
+  ASSERT_EQ(1u, tracker.just_pressed_keys().size());
+
+  tracker.update();
+  ASSERT_FALSE(tracker.was_pressed(cen::scancodes::space));
+  ASSERT_FALSE(tracker.was_released(cen::scancodes::space));
+}
+
+TEST(KeyboardTracker, IgnoresRepeats)
+{
+  cen::keyboard_tracker tracker;
+
+  tracker.feed(make_event(cen::scancodes::a, cen::button_state::pressed));
+  tracker.update();
+  tracker.feed(make_event(cen::scancodes::a, cen::button_state::pressed, true));
+
+  ASSERT_TRUE(tracker.is_pressed(cen::scancodes::a));
+  ASSERT_FALSE(tracker.was_pressed(cen::scancodes::a));
+}
+
+TEST(KeyboardTracker, Reset)
+{
+  cen::keyboard_tracker tracker;
+
+  tracker.feed(make_event(cen::scancodes::a, cen::button_state::pressed));
+  tracker.reset();
+
+  ASSERT_FALSE(tracker.is_pressed(cen::scancodes::a));
+  ASSERT_FALSE(tracker.was_pressed(cen::scancodes::a));
+}
@@ -0,0 +1,109 @@
+#include "input/mouse_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+static_assert(std::is_final_v<cen::mouse_tracker>);
+static_assert(std::is_nothrow_copy_constructible_v<cen::mouse_tracker>);
+static_assert(std::is_nothrow_copy_assignable_v<cen::mouse_tracker>);
+
+namespace {
+
+[[nodiscard]] auto make_event(const cen::mouse_button button,
+                              const cen::button_state state) -> cen::mouse_button_event
+{
+  cen::mouse_button_event event;
+  event.set_button(button);
+  event.set_state(state);
+  event.set_x(10);
+  event.set_y(20);
+  return event;
+}
+
+[[nodiscard]] auto make_motion(const int x, const int y, const int dx, const int dy)
+    -> cen::mouse_motion_event
+{
+  cen::mouse_motion_event event;
+  event.set_x(x);
+  event.set_y(y);
+  event.set_dx(dx);
+  event.set_dy(dy);
+  return event;
+}
+
+}  // namespace
+
+TEST(MouseTracker, Defaults)
+{
+  const cen::mouse_tracker tracker;
+  ASSERT_EQ(cen::ipoint{}, tracker.position());
+  ASSERT_EQ(cen::ipoint{}, tracker.motion());
+  ASSERT_EQ(cen::ipoint{}, tracker.wheel());
+  ASSERT_FALSE(tracker.was_moved());
+  ASSERT_FALSE(tracker.is_pressed(cen::mouse_button::left));
+}
+
+TEST(MouseTracker, Buttons)
+{
+  cen::mouse_tracker tracker;
+
+  tracker.feed(make_event(cen::mouse_button::left, cen::button_state::pressed));
+  ASSERT_TRUE(tracker.is_pressed(cen::mouse_button::left));
+  ASSERT_TRUE(tracker.was_pressed(cen::mouse_button::left));
+  ASSERT_FALSE(tracker.is_pressed(cen::mouse_button::right));
+  ASSERT_EQ(cen::ipoint(10, 20), tracker.position());
+
+  tracker.update();
+  ASSERT_TRUE(tracker.is_pressed(cen::mouse_button::left));
+  ASSERT_FALSE(tracker.was_pressed(cen::mouse_button::left));
+
+  tracker.feed(make_event(cen::mouse_button::left, cen::button_state::released));
+  ASSERT_FALSE(tracker.is_pressed(cen::mouse_button::left));
+  ASSERT_TRUE(tracker.was_released(cen::mouse_button::left));
+}
+
+TEST(MouseTracker, SubFrameClick)
+{
+  cen::mouse_tracker tracker;
+
+  tracker.feed(make_event(cen::mouse_button::right, cen::button_state::pressed));
+  tracker.feed(make_event(cen::mouse_button::right, cen::button_state::released));
+
+  ASSERT_FALSE(tracker.is_pressed(cen::mouse_button::right));
+  ASSERT_TRUE(tracker.was_pressed(cen::mouse_button::right));
+  ASSERT_TRUE(tracker.was_released(cen::mouse_button::right));
+}
+
+TEST(MouseTracker, Motion)
+{
+  cen::mouse_tracker tracker;
+
+  tracker.feed(make_motion(5, 5, 5, 5));
+  tracker.feed(make_motion(8, 3, 3, -2));
+
+  ASSERT_TRUE(tracker.was_moved());
+  ASSERT_EQ(cen::ipoint(8, 3), tracker.position());
+  ASSERT_EQ(cen::ipoint(8, 3), tracker.motion());
+
+  cen::mouse_wheel_event wheel;
+  wheel.set_y_scroll(2);
+  tracker.feed(wheel);
+  tracker.feed(wheel);
+  ASSERT_EQ(cen::ipoint(0, 4), tracker.wheel());
+
+  tracker.update();
+  ASSERT_FALSE(tracker.was_moved());
+  ASSERT_EQ(cen::ipoint{}, tracker.motion());
+  ASSERT_EQ(cen::ipoint{}, tracker.wheel());
+  ASSERT_EQ(cen::ipoint(8, 3), tracker.position());
+}
+
+TEST(MouseTracker, LogicalPosition)
+{
+  cen::mouse_tracker tracker;
+  tracker.feed(make_motion(50, 100, 0, 0));
+
+  ASSERT_EQ(cen::ipoint(25, 25), tracker.logical_position({200, 400}, {100, 100}));
+  ASSERT_EQ(cen::ipoint(50, 100), tracker.logical_position({0, 0}, {0, 0}));
+}
@@ -47,6 +47,40 @@ TEST(ScanCode, StringConstructor)
   }
 }
 
+static_assert(cen::scan_code::from_name("Space") == cen::scancodes::space);
+static_assert(cen::scan_code::from_name("left shift") == cen::scancodes::left_shift);
+
+TEST(ScanCode, FromName)
+{
+  ASSERT_EQ(cen::scancodes::a, cen::scan_code::from_name("A"));
+  ASSERT_EQ(cen::scancodes::a, cen::scan_code::from_name("a"));
+  ASSERT_EQ(cen::scancodes::zero, cen::scan_code::from_name("0"));
+  ASSERT_EQ(cen::scancodes::f12, cen::scan_code::from_name("F12"));
+  ASSERT_EQ(cen::scancodes::enter, cen::scan_code::from_name("Return"));
+  ASSERT_EQ(cen::scancodes::right_gui, cen::scan_code::from_name("Right GUI"));
+
+  // Names that don't belong to any of the constants aren't recognized
+  ASSERT_TRUE(cen::scan_code::from_name("Keypad 5").unknown());
+  ASSERT_TRUE(cen::scan_code::from_name("").unknown());
+
+  // These are still looked up through SDL by the constructor
+  ASSERT_EQ(SDL_SCANCODE_KP_5, cen::scan_code{"Keypad 5"}.get());
+}
+
+TEST(ScanCode, NameTableMatchesSDL)
+{
+  for (auto index = 0; index < cen::scan_code::count(); ++index) {
+    const auto scancode = static_cast<SDL_Scancode>(index);
+    const auto name = cen::detail::scan_code_names.name_of(scancode);
+
+    if (!name.empty()) {
+      ASSERT_EQ(SDL_GetScancodeName(scancode), name);
+      ASSERT_EQ(scancode, SDL_GetScancodeFromName(name.data()));
+      ASSERT_EQ(scancode, cen::scan_code::from_name(name).get());
+    }
+  }
+}
+
 TEST(ScanCode, SDLScancodeAssignmentOperator)
 {
   cen::scan_code code;
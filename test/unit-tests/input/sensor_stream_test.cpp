@@ -0,0 +1,131 @@
+#include "input/sensor_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>  // array
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+namespace {
+
+[[nodiscard]] auto make_sample(const cen::u64 timestamp, const float value = 0)
+    -> cen::sensor_sample
+{
+  cen::sensor_sample sample;
+  sample.type = cen::sensor_type::gyroscope;
+  sample.timestamp = timestamp;
+  sample.data = {value, -value, 0};
+  return sample;
+}
+
+}  // namespace
+
+TEST(SensorStream, Defaults)
+{
+  const cen::sensor_stream stream{7, 100};
+
+  ASSERT_EQ(7, stream.id());
+  ASSERT_EQ(128u, stream.capacity());
+  ASSERT_EQ(0u, stream.size());
+  ASSERT_EQ(0u, stream.dropped());
+  ASSERT_TRUE(stream.empty());
+}
+
+TEST(SensorStream, PushAndRead)
+{
+  cen::sensor_stream stream{0, 4};
+
+  // Wrap around the end of the buffer a few times
+  for (cen::u64 round = 0; round < 3; ++round) {
+    ASSERT_TRUE(stream.push(make_sample(round * 10 + 1)));
+    ASSERT_TRUE(stream.push(make_sample(round * 10 + 2)));
+    ASSERT_TRUE(stream.push(make_sample(round * 10 + 3)));
+    ASSERT_EQ(3u, stream.size());
+
+    std::array<cen::sensor_sample, 2> samples{};
+    ASSERT_EQ(2u, stream.read(samples.data(), samples.size()));
+    ASSERT_EQ(round * 10 + 1, samples[0].timestamp);
+    ASSERT_EQ(round * 10 + 2, samples[1].timestamp);
+
+    ASSERT_EQ(1u, stream.read(samples.data(), samples.size()));
+    ASSERT_EQ(round * 10 + 3, samples[0].timestamp);
+    ASSERT_TRUE(stream.empty());
+  }
+}
+
+TEST(SensorStream, Overflow)
+{
+  cen::sensor_stream stream{0, 2};
+
+  ASSERT_TRUE(stream.push(make_sample(1)));
+  ASSERT_TRUE(stream.push(make_sample(2)));
+  ASSERT_FALSE(stream.push(make_sample(3)));
+  ASSERT_EQ(1u, stream.dropped());
+
+  cen::u64 sum = 0;
+  ASSERT_EQ(2u, stream.drain([&](const cen::sensor_sample& sample) {
+    sum += sample.timestamp;
+  }));
+
+  ASSERT_EQ(3u, sum);
+  ASSERT_TRUE(stream.empty());
+
+  ASSERT_TRUE(stream.push(make_sample(4)));
+  stream.clear();
+  ASSERT_TRUE(stream.empty());
+}
+
+TEST(SensorStream, ToSample)
+{
+  SDL_ControllerSensorEvent event{};
+  event.timestamp = 12;
+  event.sensor = SDL_SENSOR_ACCEL;
+  event.data[0] = 1;
+  event.data[1] = 2;
+  event.data[2] = 3;
+
+  const auto sample = cen::sensor_stream::to_sample(event);
+  ASSERT_EQ(cen::sensor_type::accelerometer, sample.type);
+  ASSERT_EQ(12'000u, sample.timestamp);
+  ASSERT_EQ(1, sample.data[0]);
+  ASSERT_EQ(2, sample.data[1]);
+  ASSERT_EQ(3, sample.data[2]);
+}
+
+TEST(GyroIntegrator, DataRate)
+{
+  cen::gyro_integrator integrator{100};
+
+  integrator.add(make_sample(0, 2));
+  integrator.add(make_sample(0, 2));
+
+  auto accel = make_sample(0, 100);
+  accel.type = cen::sensor_type::accelerometer;
+  integrator.add(accel);
+
+  const auto rotation = integrator.take();
+  ASSERT_FLOAT_EQ(0.04f, rotation[0]);
+  ASSERT_FLOAT_EQ(-0.04f, rotation[1]);
+  ASSERT_EQ(0, rotation[2]);
+
+  ASSERT_EQ(0, integrator.rotation()[0]);
+}
+
+TEST(GyroIntegrator, Timestamps)
+{
+  cen::gyro_integrator integrator;
+
+  const std::array samples{make_sample(1'000, 1),
+                           make_sample(3'000, 1),
+                           make_sample(4'000, 2)};
+  integrator.add(samples.data(), samples.size());
+
+  // The first sample only provides the reference timestamp
+  ASSERT_FLOAT_EQ(0.004f, integrator.rotation()[0]);
+
+  integrator.reset();
+  integrator.add(make_sample(10'000, 1));
+  ASSERT_EQ(0, integrator.rotation()[0]);
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
@@ -0,0 +1,187 @@
+#include "input/text_input_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>  // strcpy
+#include <string>   // string
+
+namespace {
+
+[[nodiscard]] auto make_input(const char* text) -> cen::text_input_event
+{
+  SDL_TextInputEvent event{};
+  std::strcpy(event.text, text);
+  return cen::text_input_event{event};
+}
+
+[[nodiscard]] auto make_editing(const char* text, const int start, const int length)
+    -> cen::text_editing_event
+{
+  SDL_TextEditingEvent event{};
+  std::strcpy(event.text, text);
+  event.start = start;
+  event.length = length;
+  return cen::text_editing_event{event};
+}
+
+}  // namespace
+
+TEST(TextInputBuffer, Defaults)
+{
+  cen::text_input_buffer buffer;
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(0u, buffer.size());
+  ASSERT_EQ(0u, buffer.cursor());
+  ASSERT_EQ(1u, buffer.line_count());
+  ASSERT_EQ(cen::text_input_buffer::default_capacity(), buffer.capacity());
+  ASSERT_FALSE(buffer.is_dirty());
+  ASSERT_FALSE(buffer.is_composing());
+  ASSERT_EQ("", buffer.text());
+}
+
+TEST(TextInputBuffer, Insert)
+{
+  cen::text_input_buffer buffer;
+
+  buffer.feed(make_input("Hello"));
+  buffer.feed(make_input(" World"));
+  ASSERT_EQ("Hello World", buffer.text());
+  ASSERT_EQ(11u, buffer.cursor());
+  ASSERT_EQ('\0', buffer.text().data()[buffer.size()]);
+
+  buffer.set_cursor(5);
+  buffer.insert(",");
+  ASSERT_EQ("Hello, World", buffer.text());
+  ASSERT_EQ(6u, buffer.cursor());
+}
+
+TEST(TextInputBuffer, Erase)
+{
+  cen::text_input_buffer buffer;
+  buffer.insert("a\xC3\xA5"  // a, å
+                "b");
+
+  buffer.move_left();
+  ASSERT_TRUE(buffer.erase_before());
+  ASSERT_EQ("ab", buffer.text());
+  ASSERT_EQ(1u, buffer.cursor());
+
+  ASSERT_TRUE(buffer.erase_after());
+  ASSERT_EQ("a", buffer.text());
+  ASSERT_FALSE(buffer.erase_after());
+
+  buffer.set_cursor(0);
+  ASSERT_FALSE(buffer.erase_before());
+}
+
+TEST(TextInputBuffer, Composition)
+{
+  cen::text_input_buffer buffer;
+  buffer.insert("ab");
+  buffer.set_cursor(1);
+
+  buffer.feed(make_editing("\xE3\x81\x8B", 1, 0));  // か
+  ASSERT_TRUE(buffer.is_composing());
+  ASSERT_EQ("a\xE3\x81\x8B"
+            "b",
+            buffer.text());
+  ASSERT_EQ(1u, buffer.composition().offset);
+  ASSERT_EQ(3u, buffer.composition().length);
+  ASSERT_EQ(4u, buffer.cursor());
+
+  buffer.feed(make_editing("\xE3\x81\x8B\xE3\x82\x93", 1, 1));  // かん
+  ASSERT_EQ(6u, buffer.composition().length);
+  ASSERT_EQ(4u, buffer.composition_selection().offset);
+  ASSERT_EQ(3u, buffer.composition_selection().length);
+
+  buffer.feed(make_input("\xE6\xBC\xA2"));  // 漢
+  ASSERT_FALSE(buffer.is_composing());
+  ASSERT_EQ("a\xE6\xBC\xA2"
+            "b",
+            buffer.text());
+  ASSERT_EQ(4u, buffer.cursor());
+
+  // An empty composition is removed
+  buffer.feed(make_editing("x", 1, 0));
+  buffer.feed(make_editing("", 0, 0));
+  ASSERT_FALSE(buffer.is_composing());
+  ASSERT_EQ("a\xE6\xBC\xA2"
+            "b",
+            buffer.text());
+}
+
+TEST(TextInputBuffer, DirtyRange)
+{
+  cen::text_input_buffer buffer;
+  buffer.insert("first\nsecond\nthird");
+  ASSERT_EQ(3u, buffer.line_count());
+
+  buffer.mark_clean();
+  ASSERT_FALSE(buffer.is_dirty());
+  ASSERT_EQ(0u, buffer.dirty_lines().count);
+
+  buffer.set_cursor(9);
+  buffer.insert("X");
+  buffer.insert("Y");
+
+  ASSERT_TRUE(buffer.is_dirty());
+  ASSERT_EQ(9u, buffer.dirty_range().offset);
+  ASSERT_EQ(2u, buffer.dirty_range().length);
+  ASSERT_EQ(1u, buffer.dirty_lines().first);
+  ASSERT_EQ(1u, buffer.dirty_lines().count);
+  ASSERT_EQ("secXYond", buffer.line(1));
+
+  buffer.erase_before();
+  ASSERT_EQ(9u, buffer.dirty_range().offset);
+  ASSERT_EQ(1u, buffer.dirty_range().length);
+
+  // Removing a line break merges two lines
+  buffer.mark_clean();
+  buffer.set_cursor(6);
+  buffer.erase_before();
+  ASSERT_EQ(0u, buffer.dirty_lines().first);
+  ASSERT_EQ(1u, buffer.dirty_lines().count);
+  ASSERT_EQ(2u, buffer.line_count());
+  ASSERT_EQ("firstsecXond", buffer.line(0));
+  ASSERT_EQ("third", buffer.line(1));
+  ASSERT_EQ("", buffer.line(2));
+}
+
+TEST(TextInputBuffer, Lines)
+{
+  cen::text_input_buffer buffer;
+  buffer.insert("one\ntwo\n\nfour");
+  buffer.set_cursor(5);
+
+  // The gap is inside of the second line
+  ASSERT_EQ("one", buffer.line(0));
+  ASSERT_EQ("two", buffer.line(1));
+  ASSERT_EQ("", buffer.line(2));
+  ASSERT_EQ("four", buffer.line(3));
+  ASSERT_EQ(1u, buffer.line_of(5));
+  ASSERT_EQ(3u, buffer.line_of(100));
+
+  const auto [before, after] = buffer.segments();
+  ASSERT_EQ("one\ntwo\n\nfour", std::string{before} + std::string{after});
+}
+
+TEST(TextInputBuffer, Growth)
+{
+  cen::text_input_buffer buffer{4};
+  ASSERT_EQ(4u, buffer.capacity());
+
+  buffer.insert("abc");
+  buffer.set_cursor(1);
+  buffer.insert("0123456789");
+  ASSERT_EQ("a0123456789bc", buffer.text());
+  ASSERT_GE(buffer.capacity(), buffer.size());
+
+  buffer.reserve(1'000);
+  ASSERT_EQ(1'000u, buffer.capacity());
+  ASSERT_EQ("a0123456789bc", buffer.text());
+
+  buffer.clear();
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(1'000u, buffer.capacity());
+  ASSERT_TRUE(buffer.is_dirty());
+}
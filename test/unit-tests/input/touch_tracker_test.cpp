@@ -0,0 +1,135 @@
+#include "input/touch_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+inline constexpr SDL_TouchID device = 3;
+
+[[nodiscard]] auto make_event(const cen::event_type type,
+                              const SDL_FingerID finger,
+                              const float x,
+                              const float y) -> cen::touch_finger_event
+{
+  cen::touch_finger_event event;
+  event.set_type(type);
+  event.set_touch_id(device);
+  event.set_finger_id(finger);
+  event.set_x(x);
+  event.set_y(y);
+  event.set_pressure(0.5f);
+  return event;
+}
+
+}  // namespace
+
+TEST(TouchTracker, Defaults)
+{
+  const cen::touch_tracker tracker;
+
+  ASSERT_EQ(0u, tracker.finger_count(device));
+  ASSERT_FALSE(tracker.find(device, 0));
+  ASSERT_FALSE(tracker.recognized_gesture());
+
+  const auto gesture = tracker.gesture(device);
+  ASSERT_EQ(0u, gesture.fingers);
+  ASSERT_EQ(1, gesture.scale);
+  ASSERT_EQ(0, gesture.rotation);
+}
+
+TEST(TouchTracker, Fingers)
+{
+  cen::touch_tracker tracker;
+
+  tracker.feed(make_event(cen::event_type::touch_down, 1, 0.1f, 0.2f));
+  tracker.feed(make_event(cen::event_type::touch_down, 2, 0.3f, 0.4f));
+  tracker.feed(make_event(cen::event_type::touch_motion, 1, 0.5f, 0.6f));
+  ASSERT_EQ(2u, tracker.finger_count(device));
+
+  const auto finger = tracker.find(device, 1);
+  ASSERT_TRUE(finger);
+  ASSERT_EQ(cen::button_state::pressed, finger->state);
+  ASSERT_FLOAT_EQ(0.5f, finger->x);
+  ASSERT_FLOAT_EQ(0.6f, finger->y);
+  ASSERT_FLOAT_EQ(0.5f, finger->pressure);
+
+  tracker.feed(make_event(cen::event_type::touch_up, 1, 0.5f, 0.6f));
+  ASSERT_EQ(1u, tracker.finger_count(device));
+  ASSERT_FALSE(tracker.find(device, 1));
+  ASSERT_TRUE(tracker.find(device, 2));
+
+  int count = 0;
+  tracker.each_finger(device, [&](const SDL_FingerID id, const cen::touch_finger_state&) {
+    ASSERT_EQ(2, id);
+    ++count;
+  });
+  ASSERT_EQ(1, count);
+
+  tracker.reset();
+  ASSERT_EQ(0u, tracker.finger_count(device));
+}
+
+TEST(TouchTracker, Capacity)
+{
+  cen::touch_tracker tracker;
+
+  for (SDL_FingerID id = 0; id < 12; ++id) {
+    tracker.feed(make_event(cen::event_type::touch_down, id, 0, 0));
+  }
+
+  ASSERT_EQ(cen::touch_tracker::max_fingers, tracker.finger_count(device));
+}
+
+TEST(TouchTracker, Pan)
+{
+  cen::touch_tracker tracker;
+
+  tracker.feed(make_event(cen::event_type::touch_down, 1, 0.5f, 0.5f));
+  tracker.update();
+
+  // Fingers that are added during the frame don't contribute
+  tracker.feed(make_event(cen::event_type::touch_motion, 1, 0.6f, 0.4f));
+  tracker.feed(make_event(cen::event_type::touch_down, 2, 0.9f, 0.9f));
+
+  const auto gesture = tracker.gesture(device);
+  ASSERT_EQ(1u, gesture.fingers);
+  ASSERT_NEAR(0.1f, gesture.pan.x(), 1e-6f);
+  ASSERT_NEAR(-0.1f, gesture.pan.y(), 1e-6f);
+  ASSERT_EQ(1, gesture.scale);
+
+  tracker.update();
+  ASSERT_EQ(cen::fpoint{}, tracker.gesture(device).pan);
+}
+
+TEST(TouchTracker, PinchAndRotate)
+{
+  cen::touch_tracker tracker;
+
+  tracker.feed(make_event(cen::event_type::touch_down, 1, 0.4f, 0.5f));
+  tracker.feed(make_event(cen::event_type::touch_down, 2, 0.6f, 0.5f));
+  tracker.update();
+
+  // Spread the fingers twice as far apart, and rotate them by 90 degrees
+  tracker.feed(make_event(cen::event_type::touch_motion, 1, 0.5f, 0.3f));
+  tracker.feed(make_event(cen::event_type::touch_motion, 2, 0.5f, 0.7f));
+
+  const auto gesture = tracker.gesture(device);
+  ASSERT_EQ(2u, gesture.fingers);
+  ASSERT_NEAR(0, gesture.pan.x(), 1e-6f);
+  ASSERT_NEAR(0, gesture.pan.y(), 1e-6f);
+  ASSERT_NEAR(2, gesture.scale, 1e-4f);
+  ASSERT_NEAR(3.14159265f / 2, gesture.rotation, 1e-4f);
+}
+
+TEST(TouchTracker, DollarGesture)
+{
+  cen::touch_tracker tracker;
+
+  cen::dollar_gesture_event event;
+  event.set_gesture_id(7);
+  tracker.feed(event);
+  ASSERT_EQ(7, tracker.recognized_gesture());
+
+  tracker.update();
+  ASSERT_FALSE(tracker.recognized_gesture());
+}
@@ -0,0 +1,82 @@
+#include "input/virtual_joystick_swarm.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>       // milliseconds
+#include <type_traits>  // is_final_v, is_copy_constructible_v
+
+#include "events/event_dispatcher.hpp"
+#include "events/joy_axis_event.hpp"
+#include "events/joy_button_event.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+static_assert(std::is_final_v<cen::virtual_joystick_swarm>);
+static_assert(!std::is_copy_constructible_v<cen::virtual_joystick_swarm>);
+
+TEST(VirtualJoystickSwarm, Construction)
+{
+  const auto before = SDL_NumJoysticks();
+
+  {
+    cen::swarm_config config;
+    config.count = 3;
+
+    const cen::virtual_joystick_swarm swarm{config};
+    ASSERT_EQ(3u, swarm.size());
+    ASSERT_EQ(before + 3, SDL_NumJoysticks());
+    ASSERT_EQ(config.axes, swarm.get(0).axis_count());
+  }
+
+  // The devices are detached when the swarm is destroyed
+  ASSERT_EQ(before, SDL_NumJoysticks());
+}
+
+TEST(VirtualJoystickSwarm, Drive)
+{
+  cen::swarm_config config;
+  config.count = 2;
+  config.type = cen::joystick_type::arcade_stick;
+  config.axes = 2;
+  config.buttons = 4;
+  config.axis_rate = 100;
+  config.button_rate = 10;
+
+  cen::virtual_joystick_swarm swarm{config};
+  ASSERT_EQ(0u, swarm.drive(std::chrono::milliseconds{5}));
+
+  // 100 ms corresponds to 10 axis updates and a single button toggle per device
+  ASSERT_EQ(2u * (10u * 2u + 1u), swarm.drive(std::chrono::milliseconds{95}));
+  ASSERT_EQ(std::chrono::milliseconds{100}, swarm.elapsed());
+}
+
+TEST(VirtualJoystickSwarm, Run)
+{
+  cen::swarm_config config;
+  config.count = 2;
+  config.type = cen::joystick_type::arcade_stick;
+  config.axes = 2;
+  config.buttons = 2;
+
+  cen::virtual_joystick_swarm swarm{config};
+  SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+  cen::event_dispatcher<cen::joy_axis_event, cen::joy_button_event> dispatcher;
+
+  cen::usize axisEvents = 0;
+  dispatcher.bind<cen::joy_axis_event>().to([&](const cen::joy_axis_event&) {
+    ++axisEvents;
+  });
+
+  const auto report = swarm.run(dispatcher, nullptr, std::chrono::milliseconds{500}, 50);
+  ASSERT_EQ(25u, report.frames);
+  ASSERT_EQ(std::chrono::milliseconds{500}, report.simulated);
+  ASSERT_EQ(25u, report.frame_cost.count());
+
+  ASSERT_GT(report.inputs, 0u);
+  ASSERT_GE(report.events, axisEvents);
+  ASSERT_GT(axisEvents, 0u);
+  ASSERT_EQ(report.total(), report.pump + report.dispatch + report.update);
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
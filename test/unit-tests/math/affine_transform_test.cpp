@@ -0,0 +1,174 @@
+#include "math/affine_transform.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+#include <vector>    // vector
+
+namespace {
+
+// An odd amount, so that both the vectorized and scalar paths are used
+[[nodiscard]] auto make_points() -> std::vector<cen::fpoint>
+{
+  std::vector<cen::fpoint> points;
+  for (auto index = 0; index < 11; ++index) {
+    const auto value = static_cast<float>(index);
+    points.emplace_back(value * 3 - 10, 20 - value * 2);
+  }
+
+  return points;
+}
+
+[[nodiscard]] auto make_rects() -> std::vector<cen::frect>
+{
+  std::vector<cen::frect> rects;
+  for (auto index = 0; index < 11; ++index) {
+    const auto value = static_cast<float>(index);
+    rects.emplace_back(value * 5 - 20, 10 - value, value + 1, 2 * value + 3);
+  }
+
+  return rects;
+}
+
+void expect_near(const cen::fpoint expected, const cen::fpoint actual)
+{
+  EXPECT_NEAR(expected.x(), actual.x(), 0.001f);
+  EXPECT_NEAR(expected.y(), actual.y(), 0.001f);
+}
+
+void expect_near(const cen::frect& expected, const cen::frect& actual)
+{
+  EXPECT_NEAR(expected.x(), actual.x(), 0.001f);
+  EXPECT_NEAR(expected.y(), actual.y(), 0.001f);
+  EXPECT_NEAR(expected.width(), actual.width(), 0.001f);
+  EXPECT_NEAR(expected.height(), actual.height(), 0.001f);
+}
+
+}  // namespace
+
+TEST(AffineTransform, Defaults)
+{
+  constexpr cen::affine_transform transform;
+  static_assert(transform.is_identity());
+  static_assert(transform == cen::affine_transform::identity());
+
+  ASSERT_EQ(1, transform.determinant());
+  ASSERT_EQ(cen::fpoint(12, -7), transform.apply(cen::fpoint{12, -7}));
+}
+
+TEST(AffineTransform, Translation)
+{
+  constexpr auto transform = cen::affine_transform::translation({10, -5});
+  static_assert(transform.apply(cen::fpoint{1, 2}) == cen::fpoint{11, -3});
+
+  ASSERT_FALSE(transform.is_identity());
+  ASSERT_EQ(cen::frect(11, -3, 4, 5), transform.apply(cen::frect{1, 2, 4, 5}));
+}
+
+TEST(AffineTransform, Scaling)
+{
+  constexpr auto transform = cen::affine_transform::scaling(2, -3);
+  ASSERT_EQ(cen::fpoint(4, -15), transform.apply(cen::fpoint{2, 5}));
+  ASSERT_EQ(-6, transform.determinant());
+
+  // The bounding box of a mirrored rectangle still has a positive size
+  ASSERT_EQ(cen::frect(2, -21, 8, 15), transform.apply(cen::frect{1, 2, 4, 5}));
+}
+
+TEST(AffineTransform, Rotation)
+{
+  // Clockwise on the screen, i.e. from the positive x-axis towards the positive y-axis
+  const auto transform = cen::affine_transform::rotation(90);
+  expect_near({0, 1}, transform.apply(cen::fpoint{1, 0}));
+  expect_near({-1, 0}, transform.apply(cen::fpoint{0, 1}));
+  expect_near({-3, 0, 2, 4}, transform.apply(cen::frect{0, 1, 4, 2}));
+
+  const auto pivoted = cen::affine_transform::rotation(180, {10, 10});
+  expect_near({10, 10}, pivoted.apply(cen::fpoint{10, 10}));
+  expect_near({8, 15}, pivoted.apply(cen::fpoint{12, 5}));
+}
+
+TEST(AffineTransform, Composition)
+{
+  constexpr auto translate = cen::affine_transform::translation({3, 4});
+  constexpr auto scale = cen::affine_transform::scaling(2, 2);
+
+  constexpr auto composed = translate.then(scale);
+  static_assert(composed == scale * translate);
+  static_assert(composed.apply(cen::fpoint{1, 1}) == cen::fpoint{8, 10});
+
+  ASSERT_NE(composed, translate * scale);
+  ASSERT_EQ(cen::fpoint(5, 6), (translate * scale).apply(cen::fpoint{1, 1}));
+}
+
+TEST(AffineTransform, Inverse)
+{
+  ASSERT_FALSE(cen::affine_transform::scaling(0, 1).inverse());
+
+  const auto transform = cen::affine_transform::rotation(30, {5, 5})
+                             .then(cen::affine_transform::scaling(2, 4))
+                             .then(cen::affine_transform::translation({-7, 3}));
+
+  const auto inverse = transform.inverse();
+  ASSERT_TRUE(inverse);
+
+  for (const auto point : make_points()) {
+    expect_near(point, inverse->apply(transform.apply(point)));
+  }
+}
+
+TEST(AffineTransform, TransformPoints)
+{
+  const auto transform = cen::affine_transform::rotation(45).then(
+      cen::affine_transform{1, 0.5f, -2, 3, 4, -5});
+
+  const auto expected = make_points();
+
+  auto points = make_points();
+  transform.transform(points);
+
+  ASSERT_EQ(expected.size(), points.size());
+  for (std::size_t index = 0; index < points.size(); ++index) {
+    expect_near(transform.apply(expected[index]), points[index]);
+  }
+
+  std::vector<cen::fpoint> empty;
+  transform.transform(empty);
+  ASSERT_TRUE(empty.empty());
+}
+
+TEST(AffineTransform, TransformRects)
+{
+  const auto transform = cen::affine_transform::rotation(-120).then(
+      cen::affine_transform{-1, 0.5f, -2, 3, 4, -5});
+
+  const auto expected = make_rects();
+
+  auto rects = make_rects();
+  transform.transform(rects);
+
+  ASSERT_EQ(expected.size(), rects.size());
+  for (std::size_t index = 0; index < rects.size(); ++index) {
+    const auto& rect = expected[index];
+    const auto bounds = transform.apply(rect);
+    expect_near(bounds, rects[index]);
+
+    // The bounding box must contain all transformed corners
+    for (const auto corner : {rect.position(),
+                              cen::fpoint{rect.max_x(), rect.y()},
+                              cen::fpoint{rect.x(), rect.max_y()},
+                              cen::fpoint{rect.max_x(), rect.max_y()}})
+    {
+      const auto point = transform.apply(corner);
+      EXPECT_GE(point.x(), bounds.x() - 0.001f);
+      EXPECT_GE(point.y(), bounds.y() - 0.001f);
+      EXPECT_LE(point.x(), bounds.max_x() + 0.001f);
+      EXPECT_LE(point.y(), bounds.max_y() + 0.001f);
+    }
+  }
+}
+
+TEST(AffineTransform, ToString)
+{
+  std::clog << cen::affine_transform::translation({1, 2}) << '\n';
+}
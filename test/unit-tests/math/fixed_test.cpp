@@ -0,0 +1,94 @@
+#include "math/fixed.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+TEST(Fixed, Defaults)
+{
+  constexpr cen::fixed16_16 value;
+  static_assert(value.raw() == 0);
+  static_assert(cen::fixed16_16::one == 0x10000);
+  static_assert(sizeof(cen::fixed16_16) == sizeof(cen::i32));
+  static_assert(sizeof(cen::fixed48_16) == sizeof(cen::i64));
+}
+
+TEST(Fixed, Construction)
+{
+  static_assert(cen::fixed16_16{3}.raw() == 3 * 0x10000);
+  static_assert(cen::fixed16_16{-2}.raw() == -2 * 0x10000);
+  static_assert(cen::fixed16_16{0.5f}.raw() == 0x8000);
+  static_assert(cen::fixed16_16{-0.25}.raw() == -0x4000);
+  static_assert(cen::fixed16_16::from_raw(42).raw() == 42);
+
+  ASSERT_EQ(1.5f, static_cast<float>(cen::fixed16_16{1.5f}));
+  ASSERT_EQ(-1.25, static_cast<double>(cen::fixed16_16{-1.25}));
+}
+
+TEST(Fixed, Floor)
+{
+  ASSERT_EQ(1, cen::fixed16_16{1.75f}.floor());
+  ASSERT_EQ(-2, cen::fixed16_16{-1.25f}.floor());
+  ASSERT_EQ(-2, static_cast<int>(cen::fixed16_16{-1.25f}));
+}
+
+TEST(Fixed, Arithmetic)
+{
+  using fixed = cen::fixed16_16;
+
+  static_assert(fixed{1.5} + fixed{2.25} == fixed{3.75});
+  static_assert(fixed{1.5} - fixed{2.25} == fixed{-0.75});
+  static_assert(fixed{1.5} * fixed{-2.5} == fixed{-3.75});
+  static_assert(fixed{7.5} / fixed{2.5} == fixed{3});
+  static_assert(-fixed{2} == fixed{-2});
+
+  auto value = fixed{10};
+  value += fixed{2};
+  value -= fixed{4};
+  value *= fixed{0.5};
+  value /= fixed{-2};
+  ASSERT_EQ(fixed{-2}, value);
+}
+
+TEST(Fixed, WideArithmetic)
+{
+  using fixed = cen::fixed48_16;
+
+  // Far beyond the range where a float can represent a quarter
+  const auto large = fixed::from_raw(cen::i64{1'000'000'000} * fixed::one);
+  const auto moved = large + fixed{0.25};
+  ASSERT_EQ(fixed{0.25}, moved - large);
+
+  ASSERT_EQ(fixed{-3.75}, fixed{1.5} * fixed{-2.5});
+  ASSERT_EQ(fixed{-3.75}, fixed{-2.5} * fixed{1.5});
+  ASSERT_EQ(fixed{3}, fixed{7.5} / fixed{2.5});
+  ASSERT_EQ(fixed{-0.5}, fixed{1} / fixed{-2});
+
+  const auto product = fixed{1'000'000} * fixed{1'000};
+  ASSERT_EQ(1'000'000'000, product.floor());
+
+  // The intermediate results of these don't fit in 64 bits
+  const auto huge = fixed::from_raw(cen::i64{1} << 60);
+  ASSERT_EQ(fixed::from_raw(cen::i64{1} << 59), fixed{0.5} * huge);
+  ASSERT_EQ(fixed::from_raw(-(cen::i64{1} << 59)), huge * fixed{-0.5});
+
+  const auto dividend = fixed::from_raw(cen::i64{5} << 58);
+  ASSERT_EQ(fixed{2.5}, dividend / fixed::from_raw(cen::i64{2} << 58));
+  ASSERT_EQ(fixed{-0.5}, dividend / fixed::from_raw(-(cen::i64{10} << 58)));
+}
+
+TEST(Fixed, Comparison)
+{
+  using fixed = cen::fixed16_16;
+
+  static_assert(fixed{1} < fixed{1.5});
+  static_assert(fixed{1} <= fixed{1});
+  static_assert(fixed{-1} > fixed{-1.5});
+  static_assert(fixed{2} >= fixed{2});
+  static_assert(fixed{2} != fixed{2.5});
+}
+
+TEST(Fixed, StreamOperator)
+{
+  std::clog << cen::fixed16_16{1.5} << '\n';
+}
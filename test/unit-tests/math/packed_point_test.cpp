@@ -0,0 +1,45 @@
+#include "math/packed_point.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(PackedPoint, Defaults)
+{
+  constexpr cen::spoint point;
+  static_assert(point.x == 0);
+  static_assert(point.y == 0);
+  static_assert(sizeof(cen::spoint) == 4);
+}
+
+TEST(PackedPoint, Arithmetic)
+{
+  constexpr cen::spoint a{10, -20};
+  constexpr cen::spoint b{-3, 7};
+
+  static_assert(a + b == cen::spoint{7, -13});
+  static_assert(a - b == cen::spoint{13, -27});
+  static_assert(a != b);
+}
+
+TEST(PackedPoint, Cast)
+{
+  constexpr cen::spoint point{-123, 456};
+  static_assert(cen::cast<cen::ipoint>(point) == cen::ipoint{-123, 456});
+  static_assert(cen::cast<cen::fpoint>(point) == cen::fpoint{-123, 456});
+  static_assert(cen::cast<cen::spoint>(cen::ipoint{-123, 456}) == point);
+}
+
+TEST(PackedPoint, FixedPoint)
+{
+  using fixed = cen::fixed48_16;
+
+  const auto origin = fixed::from_raw(cen::i64{5'000'000'000} * fixed::one);
+  const cen::xpoint camera{origin, origin};
+  const cen::xpoint player{origin + fixed{12.25}, origin - fixed{0.5}};
+
+  // Relative coordinates are exact, even though the absolute ones don't fit in a float
+  ASSERT_EQ(cen::fpoint(12.25f, -0.5f), cen::cast<cen::fpoint>(player - camera));
+  ASSERT_EQ(player, (player - camera) + camera);
+
+  const auto converted = cen::cast<cen::xpoint>(cen::fpoint{1.5f, -2.75f});
+  ASSERT_EQ((cen::xpoint{fixed{1.5}, fixed{-2.75}}), converted);
+}
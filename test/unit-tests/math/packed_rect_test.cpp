@@ -0,0 +1,56 @@
+#include "math/packed_rect.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(PackedRect, Defaults)
+{
+  constexpr cen::srect rect;
+  static_assert(rect.x == 0);
+  static_assert(rect.y == 0);
+  static_assert(rect.width == 0);
+  static_assert(rect.height == 0);
+  static_assert(sizeof(cen::srect) == 8);
+}
+
+TEST(PackedRect, Contains)
+{
+  constexpr cen::srect rect{10, 20, 30, 40};
+  static_assert(rect.position() == cen::spoint{10, 20});
+
+  ASSERT_TRUE(rect.contains({10, 20}));
+  ASSERT_TRUE(rect.contains({40, 60}));
+  ASSERT_TRUE(rect.contains({25, 30}));
+  ASSERT_FALSE(rect.contains({9, 30}));
+  ASSERT_FALSE(rect.contains({25, 61}));
+}
+
+TEST(PackedRect, Offset)
+{
+  constexpr cen::srect rect{10, 20, 30, 40};
+
+  static_assert(rect + cen::spoint{5, -5} == cen::srect{15, 15, 30, 40});
+  static_assert(rect - cen::spoint{5, -5} == cen::srect{5, 25, 30, 40});
+}
+
+TEST(PackedRect, Cast)
+{
+  constexpr cen::srect rect{-10, 20, 30, 40};
+  static_assert(cen::cast<cen::irect>(rect) == cen::irect{-10, 20, 30, 40});
+  static_assert(cen::cast<cen::frect>(rect) == cen::frect{-10, 20, 30, 40});
+  static_assert(cen::cast<cen::srect>(cen::irect{-10, 20, 30, 40}) == rect);
+}
+
+TEST(PackedRect, FixedPoint)
+{
+  using fixed = cen::fixed48_16;
+
+  const auto origin = fixed::from_raw(cen::i64{5'000'000'000} * fixed::one);
+  const cen::xpoint camera{origin, origin};
+  const cen::xrect rect{origin + fixed{0.5}, origin - fixed{8}, fixed{16}, fixed{32}};
+
+  const auto relative = cen::cast<cen::frect>(rect - camera);
+  ASSERT_EQ(cen::frect(0.5f, -8, 16, 32), relative);
+
+  ASSERT_EQ((cen::xrect{fixed{1}, fixed{2}, fixed{3}, fixed{4}}),
+            cen::cast<cen::xrect>(cen::frect{1, 2, 3, 4}));
+}
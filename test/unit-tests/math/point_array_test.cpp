@@ -0,0 +1,121 @@
+#include "math/point_array.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+namespace {
+
+// An odd amount, so that both the vectorized and scalar paths are used
+[[nodiscard]] auto make_points() -> std::vector<cen::fpoint>
+{
+  std::vector<cen::fpoint> points;
+  for (auto index = 0; index < 11; ++index) {
+    const auto value = static_cast<float>(index);
+    points.emplace_back(value * 3 - 10, 20 - value * 2);
+  }
+
+  return points;
+}
+
+}  // namespace
+
+TEST(PointArray, Defaults)
+{
+  const cen::point_array array;
+  ASSERT_TRUE(array.empty());
+  ASSERT_EQ(cen::frect{}, array.bounds());
+}
+
+TEST(PointArray, TranslateAndScale)
+{
+  const auto points = make_points();
+
+  cen::point_array array;
+  for (const auto point : points) {
+    array.push_back(point);
+  }
+
+  array.translate({1, 2});
+  array.scale(2, 3);
+
+  ASSERT_EQ(points.size(), array.size());
+  for (cen::usize index = 0; index < points.size(); ++index) {
+    const auto& point = points[index];
+    ASSERT_EQ(cen::fpoint((point.x() + 1) * 2, (point.y() + 2) * 3), array[index]);
+  }
+
+  array.set(0, {42, 24});
+  ASSERT_EQ(cen::fpoint(42, 24), array[0]);
+}
+
+TEST(PointArray, Transform)
+{
+  const auto points = make_points();
+  const auto transform = cen::affine_transform::rotation(-60).then(
+      cen::affine_transform::translation({3, -4}));
+
+  cen::point_array array;
+  for (const auto point : points) {
+    array.push_back(point);
+  }
+
+  array.transform(transform);
+
+  for (cen::usize index = 0; index < points.size(); ++index) {
+    const auto expected = transform.apply(points[index]);
+    ASSERT_FLOAT_EQ(expected.x(), array[index].x());
+    ASSERT_FLOAT_EQ(expected.y(), array[index].y());
+  }
+}
+
+TEST(PointArray, Within)
+{
+  const auto points = make_points();
+
+  cen::point_array array;
+  for (const auto point : points) {
+    array.push_back(point);
+  }
+
+  const cen::frect area{-4, 4, 14, 10};
+
+  std::vector<cen::u8> mask;
+  const auto hits = array.within(area, mask);
+  ASSERT_EQ(points.size(), mask.size());
+
+  cen::usize expected = 0;
+  for (cen::usize index = 0; index < points.size(); ++index) {
+    const auto hit = area.contains(points[index]);
+    ASSERT_EQ(hit ? 1 : 0, mask[index]);
+    expected += hit ? 1 : 0;
+  }
+
+  ASSERT_EQ(expected, hits);
+}
+
+TEST(PointArray, Bounds)
+{
+  cen::point_array array;
+  for (const auto point : make_points()) {
+    array.push_back(point);
+  }
+
+  ASSERT_EQ(cen::frect(-10, 0, 30, 20), array.bounds());
+}
+
+TEST(PointArray, Conversions)
+{
+  const auto points = make_points();
+
+  std::vector<SDL_FPoint> source;
+  for (const auto point : points) {
+    source.push_back(point.get());
+  }
+
+  const cen::point_array array{source.data(), source.size()};
+
+  std::vector<cen::fpoint> copy;
+  array.copy_to(copy);
+  ASSERT_EQ(points, copy);
+}
@@ -0,0 +1,193 @@
+#include "math/rect_array.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>  // mt19937, uniform_real_distribution
+#include <vector>  // vector
+
+namespace {
+
+// An odd amount, so that both the vectorized and scalar paths are used
+[[nodiscard]] auto make_rects() -> std::vector<cen::frect>
+{
+  std::mt19937 engine{7};  // NOLINT
+  std::uniform_real_distribution<float> position{-100, 100};
+  std::uniform_real_distribution<float> size{0, 50};
+
+  std::vector<cen::frect> rects;
+  for (auto index = 0; index < 23; ++index) {
+    rects.emplace_back(position(engine), position(engine), size(engine), size(engine));
+  }
+
+  rects.emplace_back(10, 10, 0, 20);  // Without an area
+
+  return rects;
+}
+
+}  // namespace
+
+TEST(RectArray, Defaults)
+{
+  const cen::rect_array array;
+  ASSERT_TRUE(array.empty());
+  ASSERT_EQ(0u, array.size());
+  ASSERT_EQ(cen::frect{}, array.get_union());
+
+  std::vector<cen::u8> mask;
+  ASSERT_EQ(0u, array.intersects({0, 0, 10, 10}, mask));
+  ASSERT_TRUE(mask.empty());
+}
+
+TEST(RectArray, PushBackAndSet)
+{
+  cen::rect_array array;
+  array.push_back({1, 2, 3, 4});
+  array.push_back({5, 6, 7, 8});
+
+  ASSERT_EQ(2u, array.size());
+  ASSERT_EQ(cen::frect(1, 2, 3, 4), array[0]);
+  ASSERT_EQ(cen::frect(5, 6, 7, 8), array[1]);
+
+  array.set(0, {9, 10, 11, 12});
+  ASSERT_EQ(cen::frect(9, 10, 11, 12), array[0]);
+  ASSERT_EQ(9, array.x_data()[0]);
+  ASSERT_EQ(12, array.height_data()[0]);
+
+  array.clear();
+  ASSERT_TRUE(array.empty());
+}
+
+TEST(RectArray, TranslateAndScale)
+{
+  const auto rects = make_rects();
+
+  cen::rect_array array;
+  for (const auto& rect : rects) {
+    array.push_back(rect);
+  }
+
+  array.translate({10, -5});
+  array.scale(2, 0.5f);
+
+  for (cen::usize index = 0; index < rects.size(); ++index) {
+    const auto& rect = rects[index];
+    const cen::frect expected{(rect.x() + 10) * 2,
+                              (rect.y() - 5) * 0.5f,
+                              rect.width() * 2,
+                              rect.height() * 0.5f};
+    ASSERT_EQ(expected, array[index]);
+  }
+}
+
+TEST(RectArray, Transform)
+{
+  const auto rects = make_rects();
+  const auto transform = cen::affine_transform::rotation(30, {5, 5})
+                             .then(cen::affine_transform::scaling(2, -1));
+
+  cen::rect_array array;
+  for (const auto& rect : rects) {
+    array.push_back(rect);
+  }
+
+  array.transform(transform);
+
+  for (cen::usize index = 0; index < rects.size(); ++index) {
+    const auto expected = transform.apply(rects[index]);
+    const auto actual = array[index];
+    ASSERT_FLOAT_EQ(expected.x(), actual.x());
+    ASSERT_FLOAT_EQ(expected.y(), actual.y());
+    ASSERT_FLOAT_EQ(expected.width(), actual.width());
+    ASSERT_FLOAT_EQ(expected.height(), actual.height());
+  }
+}
+
+TEST(RectArray, Intersects)
+{
+  const auto rects = make_rects();
+
+  cen::rect_array array;
+  for (const auto& rect : rects) {
+    array.push_back(rect);
+  }
+
+  const cen::frect area{-20, -30, 60, 40};
+
+  std::vector<cen::u8> mask;
+  const auto hits = array.intersects(area, mask);
+  ASSERT_EQ(rects.size(), mask.size());
+
+  cen::usize expected = 0;
+  for (cen::usize index = 0; index < rects.size(); ++index) {
+    const auto hit = cen::intersects(rects[index], area);
+    ASSERT_EQ(hit ? 1 : 0, mask[index]);
+    expected += hit ? 1 : 0;
+  }
+
+  ASSERT_EQ(expected, hits);
+}
+
+TEST(RectArray, Contains)
+{
+  const auto rects = make_rects();
+
+  cen::rect_array array;
+  for (const auto& rect : rects) {
+    array.push_back(rect);
+  }
+
+  const cen::fpoint point{5, 12};
+
+  std::vector<cen::u8> mask;
+  const auto hits = array.contains(point, mask);
+
+  cen::usize expected = 0;
+  for (cen::usize index = 0; index < rects.size(); ++index) {
+    const auto hit = rects[index].contains(point);
+    ASSERT_EQ(hit ? 1 : 0, mask[index]);
+    expected += hit ? 1 : 0;
+  }
+
+  ASSERT_EQ(expected, hits);
+}
+
+TEST(RectArray, GetUnion)
+{
+  const auto rects = make_rects();
+
+  cen::rect_array array;
+  cen::frect expected;
+
+  for (const auto& rect : rects) {
+    array.push_back(rect);
+    expected = cen::get_union(expected, rect);
+  }
+
+  // The union is computed from the extremes, so the sizes may be rounded differently
+  const auto actual = array.get_union();
+  ASSERT_EQ(expected.x(), actual.x());
+  ASSERT_EQ(expected.y(), actual.y());
+  ASSERT_FLOAT_EQ(expected.width(), actual.width());
+  ASSERT_FLOAT_EQ(expected.height(), actual.height());
+}
+
+TEST(RectArray, Conversions)
+{
+  const auto rects = make_rects();
+
+  std::vector<SDL_FRect> source;
+  for (const auto& rect : rects) {
+    source.push_back(rect.get());
+  }
+
+  const cen::rect_array array{source.data(), source.size()};
+  ASSERT_EQ(rects.size(), array.size());
+
+  for (cen::usize index = 0; index < rects.size(); ++index) {
+    ASSERT_EQ(rects[index], array[index]);
+  }
+
+  std::vector<cen::frect> copy;
+  array.copy_to(copy);
+  ASSERT_EQ(rects, copy);
+}
@@ -0,0 +1,152 @@
+#include "math/spatial_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // sort
+#include <random>     // mt19937, uniform_real_distribution
+#include <utility>    // pair, minmax
+#include <vector>     // vector
+
+namespace {
+
+using id_pair = std::pair<cen::fspatial_grid::id_type, cen::fspatial_grid::id_type>;
+
+[[nodiscard]] auto sorted_query(const cen::fspatial_grid& grid, const cen::frect& area)
+    -> std::vector<cen::fspatial_grid::id_type>
+{
+  std::vector<cen::fspatial_grid::id_type> ids;
+  grid.query(area, ids);
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+[[nodiscard]] auto sorted_pairs(const cen::fspatial_grid& grid) -> std::vector<id_pair>
+{
+  std::vector<id_pair> pairs;
+  grid.for_each_pair([&](const auto fst, const auto snd) {
+    pairs.push_back(std::minmax(fst, snd));
+  });
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+}  // namespace
+
+TEST(SpatialGrid, InsertAndErase)
+{
+  cen::fspatial_grid grid{32};
+  ASSERT_TRUE(grid.empty());
+  ASSERT_EQ(32, grid.cell_size());
+
+  ASSERT_TRUE(grid.insert(1, {10, 10, 5, 5}));
+  ASSERT_TRUE(grid.insert(2, {-100, -100, 200, 200}));
+  ASSERT_FALSE(grid.insert(1, {0, 0, 1, 1}));
+  ASSERT_EQ(2u, grid.size());
+
+  ASSERT_TRUE(grid.contains(1));
+  ASSERT_EQ(cen::frect(10, 10, 5, 5), *grid.bounds(1));
+
+  ASSERT_TRUE(grid.erase(1));
+  ASSERT_FALSE(grid.erase(1));
+  ASSERT_FALSE(grid.contains(1));
+  ASSERT_FALSE(grid.bounds(1));
+  ASSERT_EQ(1u, grid.size());
+
+  grid.clear();
+  ASSERT_TRUE(grid.empty());
+}
+
+TEST(SpatialGrid, Query)
+{
+  cen::fspatial_grid grid{32};
+
+  grid.insert(1, {10, 10, 5, 5});
+  grid.insert(2, {-100, -100, 200, 200});  // Spans many cells, reported once
+  grid.insert(3, {500, 500, 10, 10});
+  grid.insert(4, {-40, 20, 10, 10});
+
+  using ids = std::vector<cen::fspatial_grid::id_type>;
+  ASSERT_EQ((ids{1, 2, 4}), sorted_query(grid, {-50, 0, 100, 100}));
+  ASSERT_EQ((ids{2, 3}), sorted_query(grid, {90, 90, 500, 500}));
+  ASSERT_EQ((ids{}), sorted_query(grid, {1'000, 1'000, 10, 10}));
+}
+
+TEST(SpatialGrid, Update)
+{
+  cen::fspatial_grid grid{32};
+  grid.insert(1, {0, 0, 10, 10});
+
+  // Stays in the same cell
+  ASSERT_TRUE(grid.update(1, {5, 5, 10, 10}));
+  ASSERT_EQ(cen::frect(5, 5, 10, 10), *grid.bounds(1));
+
+  // Moves to other cells
+  ASSERT_TRUE(grid.update(1, {300, 300, 10, 10}));
+  ASSERT_TRUE(sorted_query(grid, {0, 0, 20, 20}).empty());
+  ASSERT_EQ(1u, sorted_query(grid, {290, 290, 20, 20}).size());
+
+  ASSERT_FALSE(grid.update(2, {0, 0, 1, 1}));
+}
+
+TEST(SpatialGrid, Pairs)
+{
+  cen::fspatial_grid grid{16};
+
+  grid.insert(1, {0, 0, 40, 40});
+  grid.insert(2, {30, 30, 40, 40});
+  grid.insert(3, {35, 0, 5, 5});
+  grid.insert(4, {200, 200, 5, 5});
+
+  ASSERT_EQ((std::vector<id_pair>{{1, 2}, {1, 3}}), sorted_pairs(grid));
+}
+
+TEST(SpatialGrid, IntegerGrid)
+{
+  cen::ispatial_grid grid{10};
+
+  grid.insert(1, {-15, -15, 5, 5});
+  grid.insert(2, {-1, -1, 2, 2});
+
+  std::vector<cen::ispatial_grid::id_type> ids;
+  grid.query({-20, -20, 10, 10}, ids);
+  ASSERT_EQ((std::vector<cen::ispatial_grid::id_type>{1}), ids);
+}
+
+TEST(SpatialGrid, MatchesBruteForce)
+{
+  std::mt19937 engine{42};  // NOLINT
+  std::uniform_real_distribution<float> position{-500, 500};
+  std::uniform_real_distribution<float> size{1, 60};
+
+  cen::fspatial_grid grid{32};
+  std::vector<cen::frect> rects;
+
+  for (cen::fspatial_grid::id_type id = 0; id < 300; ++id) {
+    rects.emplace_back(position(engine), position(engine), size(engine), size(engine));
+    grid.insert(id, rects.back());
+  }
+
+  for (cen::fspatial_grid::id_type id = 0; id < 300; id += 3) {
+    rects[id].set_position({position(engine), position(engine)});
+    grid.update(id, rects[id]);
+  }
+
+  const cen::frect area{-100, -50, 300, 200};
+  std::vector<cen::fspatial_grid::id_type> expectedIds;
+  std::vector<id_pair> expectedPairs;
+
+  for (cen::fspatial_grid::id_type i = 0; i < rects.size(); ++i) {
+    if (cen::collides(rects[i], area)) {
+      expectedIds.push_back(i);
+    }
+
+    for (auto j = i + 1; j < rects.size(); ++j) {
+      if (cen::collides(rects[i], rects[j])) {
+        expectedPairs.emplace_back(i, j);
+      }
+    }
+  }
+
+  ASSERT_EQ(expectedIds, sorted_query(grid, area));
+  ASSERT_EQ(expectedPairs, sorted_pairs(grid));
+}
@@ -37,6 +37,43 @@ TEST(Vector3, CastOperator)
   }
 }
 
+TEST(Vector3, Arithmetic)
+{
+  constexpr int3 a{1, 2, 3};
+  constexpr int3 b{4, 5, 6};
+
+  static_assert(a + b == int3{5, 7, 9});
+  static_assert(b - a == int3{3, 3, 3});
+  static_assert(-a == int3{-1, -2, -3});
+  static_assert(a * 3 == int3{3, 6, 9});
+  static_assert(3 * a == a * 3);
+  static_assert(b / 2 == int3{2, 2, 3});
+}
+
+TEST(Vector3, DotAndCross)
+{
+  constexpr int3 a{1, 2, 3};
+  constexpr int3 b{4, 5, 6};
+
+  static_assert(cen::dot(a, b) == 32);
+  static_assert(cen::cross(a, b) == int3{-3, 6, -3});
+  static_assert(cen::cross(int3{1, 0, 0}, int3{0, 1, 0}) == int3{0, 0, 1});
+  static_assert(cen::dot(cen::cross(a, b), a) == 0);
+}
+
+TEST(Vector3, LengthAndNormalize)
+{
+  const float3 vec{2, 3, 6};
+  ASSERT_EQ(7, cen::length(vec));
+
+  const auto normalized = cen::normalize(vec);
+  ASSERT_FLOAT_EQ(2.0f / 7.0f, normalized.x);
+  ASSERT_FLOAT_EQ(3.0f / 7.0f, normalized.y);
+  ASSERT_FLOAT_EQ(6.0f / 7.0f, normalized.z);
+
+  ASSERT_EQ(float3{}, cen::normalize(float3{}));
+}
+
 TEST(Vector3, StreamOperator)
 {
   const float3 vec{12.3f, 45.6f};
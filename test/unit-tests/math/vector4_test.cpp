@@ -0,0 +1,55 @@
+#include "math/vector4.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+using float4 = cen::vector4<float>;
+using int4 = cen::vector4<int>;
+
+TEST(Vector4, Defaults)
+{
+  const float4 vec;
+  ASSERT_EQ(0, vec.x);
+  ASSERT_EQ(0, vec.y);
+  ASSERT_EQ(0, vec.z);
+  ASSERT_EQ(0, vec.w);
+}
+
+TEST(Vector4, CastOperator)
+{
+  const float4 src{12.3f, 45.6f, 7.89f, -1.5f};
+  const auto result = static_cast<int4>(src);
+  ASSERT_EQ(12, result.x);
+  ASSERT_EQ(45, result.y);
+  ASSERT_EQ(7, result.z);
+  ASSERT_EQ(-1, result.w);
+}
+
+TEST(Vector4, Arithmetic)
+{
+  constexpr int4 a{1, 2, 3, 4};
+  constexpr int4 b{5, 6, 7, 8};
+
+  static_assert(a + b == int4{6, 8, 10, 12});
+  static_assert(b - a == int4{4, 4, 4, 4});
+  static_assert(-a == int4{-1, -2, -3, -4});
+  static_assert(a * 2 == int4{2, 4, 6, 8});
+  static_assert(2 * a == a * 2);
+  static_assert(b / 2 == int4{2, 3, 3, 4});
+  static_assert(cen::dot(a, b) == 70);
+}
+
+TEST(Vector4, LengthAndNormalize)
+{
+  const float4 vec{1, 2, 2, 4};
+  ASSERT_EQ(5, cen::length(vec));
+  ASSERT_EQ((float4{0.2f, 0.4f, 0.4f, 0.8f}), cen::normalize(vec));
+  ASSERT_EQ(float4{}, cen::normalize(float4{}));
+}
+
+TEST(Vector4, StreamOperator)
+{
+  const float4 vec{12.3f, 45.6f, 7.8f, 9.0f};
+  std::clog << vec << '\n';
+}
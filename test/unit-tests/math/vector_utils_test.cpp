@@ -0,0 +1,164 @@
+#include "math/vector_utils.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>  // mt19937, uniform_real_distribution
+#include <vector>  // vector
+
+using float3 = cen::vector3<float>;
+using float4 = cen::vector4<float>;
+
+namespace {
+
+// An odd amount, so that both the vectorized and scalar paths are used
+constexpr cen::usize count = 23;
+
+template <typename Vector>
+[[nodiscard]] auto make_vectors(const unsigned seed) -> std::vector<Vector>
+{
+  std::mt19937 engine{seed};
+  std::uniform_real_distribution<float> dist{-100, 100};
+
+  std::vector<Vector> vectors(count);
+  for (auto& vector : vectors) {
+    vector.x = dist(engine);
+    vector.y = dist(engine);
+    vector.z = dist(engine);
+    if constexpr (std::is_same_v<Vector, float4>) {
+      vector.w = dist(engine);
+    }
+  }
+
+  vectors.at(5) = Vector{};  // A zero vector, which can't be normalized
+  return vectors;
+}
+
+}  // namespace
+
+TEST(VectorUtils, DotProducts)
+{
+  const auto a3 = make_vectors<float3>(1);
+  const auto b3 = make_vectors<float3>(2);
+  const auto a4 = make_vectors<float4>(3);
+  const auto b4 = make_vectors<float4>(4);
+
+  std::vector<float> dots3(count);
+  std::vector<float> dots4(count);
+  cen::dot_products(a3, b3, dots3);
+  cen::dot_products(a4, b4, dots4);
+
+  for (cen::usize index = 0; index < count; ++index) {
+    ASSERT_EQ(cen::dot(a3[index], b3[index]), dots3[index]);
+    ASSERT_EQ(cen::dot(a4[index], b4[index]), dots4[index]);
+  }
+}
+
+TEST(VectorUtils, CrossProducts)
+{
+  const auto a = make_vectors<float3>(5);
+  auto b = make_vectors<float3>(6);
+
+  std::vector<float3> result(count);
+  cen::cross_products(a, b, result);
+
+  for (cen::usize index = 0; index < count; ++index) {
+    ASSERT_EQ(cen::cross(a[index], b[index]), result[index]);
+  }
+
+  // The destination may be one of the sources
+  cen::cross_products(a, b, b);
+  ASSERT_EQ(result, b);
+}
+
+TEST(VectorUtils, Lengths)
+{
+  const auto vectors3 = make_vectors<float3>(7);
+  const auto vectors4 = make_vectors<float4>(8);
+
+  std::vector<float> lengths3(count);
+  std::vector<float> lengths4(count);
+  cen::lengths(vectors3, lengths3);
+  cen::lengths(vectors4, lengths4);
+
+  for (cen::usize index = 0; index < count; ++index) {
+    ASSERT_EQ(cen::length(vectors3[index]), lengths3[index]);
+    ASSERT_EQ(cen::length(vectors4[index]), lengths4[index]);
+  }
+
+  ASSERT_EQ(0, lengths3.at(5));
+}
+
+TEST(VectorUtils, NormalizeAll)
+{
+  const auto original3 = make_vectors<float3>(9);
+  const auto original4 = make_vectors<float4>(10);
+
+  auto vectors3 = original3;
+  auto vectors4 = original4;
+  cen::normalize_all(vectors3);
+  cen::normalize_all(vectors4);
+
+  for (cen::usize index = 0; index < count; ++index) {
+    ASSERT_EQ(cen::normalize(original3[index]), vectors3[index]);
+    ASSERT_EQ(cen::normalize(original4[index]), vectors4[index]);
+  }
+
+  ASSERT_EQ(float3{}, vectors3.at(5));
+  ASSERT_NEAR(1.0f, cen::length(vectors3.at(0)), 0.0001f);
+}
+
+TEST(VectorUtils, MultiplyAdd)
+{
+  const auto velocities = make_vectors<float3>(11);
+  auto positions = make_vectors<float3>(12);
+  const auto expected = positions;
+
+  cen::multiply_add(positions, velocities, 0.016f);
+
+  for (cen::usize index = 0; index < count; ++index) {
+    ASSERT_EQ(expected[index] + velocities[index] * 0.016f, positions[index]);
+  }
+}
+
+TEST(VectorUtils, ScalarParity)
+{
+  const auto a = make_vectors<float3>(13);
+  const auto b = make_vectors<float3>(14);
+  const auto* pa = &a.front().x;
+  const auto* pb = &b.front().x;
+
+  std::vector<float> reference(count);
+  std::vector<float> actual(count);
+
+  cen::detail::dot3_scalar(pa, pb, reference.data(), count);
+  cen::detail::dot3(pa, pb, actual.data(), count);
+  ASSERT_EQ(reference, actual);
+
+  cen::detail::lengths_scalar<3>(pa, reference.data(), count);
+  cen::detail::lengths3(pa, actual.data(), count);
+  ASSERT_EQ(reference, actual);
+
+  auto expected = a;
+  auto normalized = a;
+  cen::detail::normalize_scalar<3>(&expected.front().x, count);
+  cen::detail::normalize3(&normalized.front().x, count);
+  ASSERT_EQ(expected, normalized);
+
+  std::vector<float3> crossed(count);
+  cen::detail::cross3_scalar(pa, pb, &expected.front().x, count);
+  cen::detail::cross3(pa, pb, &crossed.front().x, count);
+  ASSERT_EQ(expected, crossed);
+}
+
+TEST(VectorUtils, EmptyContainers)
+{
+  std::vector<float3> vectors;
+  std::vector<float> values;
+
+  cen::dot_products(vectors, vectors, values);
+  cen::lengths(vectors, values);
+  cen::normalize_all(vectors);
+  cen::multiply_add(vectors, vectors, 1.0f);
+
+  ASSERT_TRUE(vectors.empty());
+}
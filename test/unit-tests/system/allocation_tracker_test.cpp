@@ -0,0 +1,126 @@
+#include "system/allocation_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <list>    // list
+#include <vector>  // vector
+
+#include "video/unicode_string.hpp"
+
+namespace {
+
+template <typename T>
+using text_vector = std::vector<T, cen::tracking_allocator<T, cen::alloc_subsystem::text>>;
+
+}  // namespace
+
+TEST(AllocationTracker, AllocateAndDeallocate)
+{
+  cen::allocation_tracker::reset();
+
+  {
+    text_vector<int> values;
+    values.reserve(10);
+
+    const auto stats = cen::allocation_tracker::stats(cen::alloc_subsystem::text);
+    ASSERT_EQ(1u, stats.allocations);
+    ASSERT_EQ(0u, stats.deallocations);
+    ASSERT_EQ(10u * sizeof(int), stats.allocatedBytes);
+    ASSERT_EQ(10u * sizeof(int), stats.liveBytes);
+  }
+
+  const auto stats = cen::allocation_tracker::stats(cen::alloc_subsystem::text);
+  ASSERT_EQ(1u, stats.allocations);
+  ASSERT_EQ(1u, stats.deallocations);
+  ASSERT_EQ(0u, stats.liveBytes);
+  ASSERT_EQ(10u * sizeof(int), stats.peakBytes);
+
+  // Other subsystems are unaffected
+  ASSERT_EQ(0u, cen::allocation_tracker::stats(cen::alloc_subsystem::audio).allocations);
+}
+
+TEST(AllocationTracker, Reset)
+{
+  text_vector<int> values;
+  values.reserve(4);
+
+  cen::allocation_tracker::reset();
+
+  const auto stats = cen::allocation_tracker::stats(cen::alloc_subsystem::text);
+  ASSERT_EQ(0u, stats.allocations);
+  ASSERT_EQ(0u, stats.allocatedBytes);
+  ASSERT_EQ(4u * sizeof(int), stats.liveBytes);
+  ASSERT_EQ(4u * sizeof(int), stats.peakBytes);
+}
+
+TEST(AllocationTracker, Total)
+{
+  cen::allocation_tracker::reset();
+
+  cen::allocation_tracker::record_allocation(cen::alloc_subsystem::video, 8);
+  cen::allocation_tracker::record_allocation(cen::alloc_subsystem::events, 24);
+
+  const auto total = cen::allocation_tracker::total();
+  ASSERT_EQ(2u, total.allocations);
+  ASSERT_EQ(32u, total.allocatedBytes);
+
+  cen::allocation_tracker::record_deallocation(cen::alloc_subsystem::video, 8);
+  cen::allocation_tracker::record_deallocation(cen::alloc_subsystem::events, 24);
+  ASSERT_EQ(0u, cen::allocation_tracker::total().liveBytes);
+}
+
+TEST(AllocationTracker, Rebind)
+{
+  cen::allocation_tracker::reset();
+
+  {
+    std::list<int, cen::tracking_allocator<int, cen::alloc_subsystem::input>> values;
+    values.push_back(42);
+  }
+
+  const auto stats = cen::allocation_tracker::stats(cen::alloc_subsystem::input);
+  ASSERT_GE(stats.allocations, 1u);
+  ASSERT_EQ(stats.allocations, stats.deallocations);
+  ASSERT_EQ(0u, stats.liveBytes);
+}
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+TEST(AllocationTracker, Upstream)
+{
+  std::pmr::monotonic_buffer_resource resource;
+  cen::allocation_tracker::set_upstream(&resource);
+  ASSERT_EQ(&resource, cen::allocation_tracker::upstream());
+
+  text_vector<int> values;
+  cen::allocation_tracker::set_upstream(nullptr);
+
+  ASSERT_EQ(&resource, values.get_allocator().resource());
+  ASSERT_FALSE(cen::allocation_tracker::upstream());
+
+  values.push_back(1);
+  ASSERT_EQ(1, values.front());
+}
+
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+TEST(AllocationTracker, UnicodeString)
+{
+  cen::allocation_tracker::reset();
+
+  {
+    cen::unicode_string str;
+    for (auto index = 0; index < 64; ++index) {
+      str += 'a';
+    }
+  }
+
+  const auto stats = cen::allocation_tracker::stats(cen::alloc_subsystem::text);
+  if constexpr (cen::allocation_tracker::enabled()) {
+    ASSERT_GE(stats.allocations, 1u);
+    ASSERT_EQ(0u, stats.liveBytes);
+  }
+  else {
+    ASSERT_EQ(0u, stats.allocations);
+  }
+}
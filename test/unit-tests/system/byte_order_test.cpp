@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>  // vector
+
 using namespace cen::literals;
 
 TEST(SwapByteOrder, U16)
@@ -28,6 +30,66 @@ TEST(SwapByteOrder, Float)
   ASSERT_EQ(SDL_SwapFloat(source), cen::swap_byte_order(source));
 }
 
+TEST(SwapByteOrder, Arrays)
+{
+  // The sizes aren't multiples of the SIMD widths, to cover the scalar tails
+  std::vector<cen::u16> u16s(19);
+  std::vector<cen::u32> u32s(11);
+  std::vector<cen::u64> u64s(5);
+
+  for (cen::usize index = 0; index < u16s.size(); ++index) {
+    u16s[index] = static_cast<cen::u16>(0x0102 * (index + 1));
+  }
+
+  for (cen::usize index = 0; index < u32s.size(); ++index) {
+    u32s[index] = static_cast<cen::u32>(0x0102'0304 * (index + 1));
+  }
+
+  for (cen::usize index = 0; index < u64s.size(); ++index) {
+    u64s[index] = 0x0102'0304'0506'0708 * (index + 1);
+  }
+
+  const auto expected16 = u16s;
+  const auto expected32 = u32s;
+  const auto expected64 = u64s;
+
+  cen::swap_byte_order(u16s.data(), u16s.size());
+  cen::swap_byte_order(u32s.data(), u32s.size());
+  cen::swap_byte_order(u64s.data(), u64s.size());
+
+  for (cen::usize index = 0; index < u16s.size(); ++index) {
+    ASSERT_EQ(SDL_Swap16(expected16[index]), u16s[index]);
+  }
+
+  for (cen::usize index = 0; index < u32s.size(); ++index) {
+    ASSERT_EQ(SDL_Swap32(expected32[index]), u32s[index]);
+  }
+
+  for (cen::usize index = 0; index < u64s.size(); ++index) {
+    ASSERT_EQ(SDL_Swap64(expected64[index]), u64s[index]);
+  }
+}
+
+TEST(SwapBigEndian, Array)
+{
+  std::vector<cen::u32> values{1, 2, 3, 4, 5};
+  cen::swap_big_endian(values.data(), values.size());
+
+  for (cen::usize index = 0; index < values.size(); ++index) {
+    ASSERT_EQ(SDL_SwapBE32(static_cast<cen::u32>(index + 1)), values[index]);
+  }
+}
+
+TEST(SwapLittleEndian, Array)
+{
+  std::vector<cen::u32> values{1, 2, 3, 4, 5};
+  cen::swap_little_endian(values.data(), values.size());
+
+  for (cen::usize index = 0; index < values.size(); ++index) {
+    ASSERT_EQ(SDL_SwapLE32(static_cast<cen::u32>(index + 1)), values[index]);
+  }
+}
+
 TEST(SwapBigEndian, U16)
 {
   const auto source = 1234_u16;
@@ -0,0 +1,127 @@
+#include "system/cpu_dispatch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "detail/mix_kernels.hpp"
+
+namespace {
+
+auto scalar_kernel(const int value) -> int
+{
+  return value;
+}
+
+auto vector_kernel(const int value) -> int
+{
+  return value * 2;
+}
+
+// Restores an instruction set when going out of scope, so that failed tests don't leak
+class simd_guard final
+{
+ public:
+  explicit simd_guard(const cen::simd_level level) : m_level{level}
+  {
+    cen::cpu::set_simd_enabled(m_level, false);
+  }
+
+  ~simd_guard()
+  {
+    cen::cpu::set_simd_enabled(m_level, true);
+  }
+
+ private:
+  cen::simd_level m_level;
+};
+
+}  // namespace
+
+TEST(CpuDispatch, Features)
+{
+  const auto& features = cen::cpu::features();
+  ASSERT_EQ(&features, &cen::cpu::features());
+
+  ASSERT_EQ(cen::cpu::has_sse2(), features.sse2);
+  ASSERT_EQ(cen::cpu::has_sse41(), features.sse41);
+  ASSERT_EQ(cen::cpu::has_avx(), features.avx);
+  ASSERT_EQ(cen::cpu::has_avx2(), features.avx2);
+  ASSERT_EQ(cen::cpu::has_avx512f(), features.avx512f);
+  ASSERT_EQ(cen::cpu::has_neon(), features.neon);
+}
+
+TEST(CpuDispatch, SimdAvailability)
+{
+  ASSERT_TRUE(cen::cpu::is_simd_available(cen::simd_level::scalar));
+
+  const auto best = cen::cpu::best_simd_level();
+  ASSERT_TRUE(cen::cpu::is_simd_available(best));
+
+  if (best != cen::simd_level::scalar) {
+    const simd_guard guard{best};
+    ASSERT_FALSE(cen::cpu::is_simd_available(best));
+    ASSERT_NE(best, cen::cpu::best_simd_level());
+  }
+
+  ASSERT_EQ(best, cen::cpu::best_simd_level());
+
+  // Scalar code can't be disabled
+  cen::cpu::set_simd_enabled(cen::simd_level::scalar, false);
+  ASSERT_TRUE(cen::cpu::is_simd_available(cen::simd_level::scalar));
+}
+
+TEST(CpuDispatch, KernelTable)
+{
+  const auto best = cen::cpu::best_simd_level();
+  const cen::kernel_table<int(int)> table{scalar_kernel,
+                                          vector_kernel,
+                                          vector_kernel,
+                                          vector_kernel};
+
+  ASSERT_TRUE(table.has_variant(cen::simd_level::avx2));
+  ASSERT_EQ(&scalar_kernel, table.variant(cen::simd_level::scalar));
+  ASSERT_EQ(best, table.selected_level());
+  ASSERT_EQ(best == cen::simd_level::scalar ? 21 : 42, table(21));
+
+  {
+    const simd_guard sse2{cen::simd_level::sse2};
+    const simd_guard neon{cen::simd_level::neon};
+    const simd_guard avx2{cen::simd_level::avx2};
+
+    ASSERT_EQ(cen::simd_level::scalar, table.selected_level());
+    ASSERT_EQ(21, table(21));
+  }
+
+  ASSERT_EQ(best == cen::simd_level::scalar ? 21 : 42, table(21));
+
+  const cen::kernel_table<int(int)> scalarOnly{scalar_kernel};
+  ASSERT_FALSE(scalarOnly.has_variant(cen::simd_level::sse2));
+  ASSERT_EQ(cen::simd_level::scalar, scalarOnly.selected_level());
+  ASSERT_EQ(21, scalarOnly(21));
+}
+
+TEST(CpuDispatch, MixKernelVariants)
+{
+  const auto& table = cen::detail::mix_f32_kernels;
+
+  std::vector<float> source(37);
+  for (cen::usize index = 0; index < source.size(); ++index) {
+    source[index] = static_cast<float>(index) * 0.05f - 0.9f;
+  }
+
+  std::vector<float> expected(source.size(), 0.25f);
+  table.variant(cen::simd_level::scalar)(expected.data(), source.data(), 37, 1.5f);
+
+  for (auto index = 1; index < cen::simd_level_count(); ++index) {
+    const auto level = static_cast<cen::simd_level>(index);
+    if (!table.has_variant(level) || !cen::cpu::is_simd_available(level)) {
+      continue;
+    }
+
+    std::vector<float> target(source.size(), 0.25f);
+    table.variant(level)(target.data(), source.data(), 37, 1.5f);
+
+    ASSERT_EQ(expected, target) << "Mismatch for " << level;
+  }
+}
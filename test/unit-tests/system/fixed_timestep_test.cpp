@@ -0,0 +1,80 @@
+#include "system/fixed_timestep.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using ns = cen::fixed_timestep::duration_type;
+
+}  // namespace
+
+TEST(FixedTimestep, Defaults)
+{
+  const cen::fixed_timestep timestep{ns{10'000'000}};
+
+  ASSERT_EQ(ns{10'000'000}, timestep.step());
+  ASSERT_EQ(8u, timestep.max_steps());
+  ASSERT_EQ(0u, timestep.total_steps());
+  ASSERT_EQ(0u, timestep.dropped_steps());
+  ASSERT_EQ(0.0, timestep.alpha());
+  ASSERT_DOUBLE_EQ(0.01, timestep.delta());
+}
+
+TEST(FixedTimestep, FromRate)
+{
+  const auto timestep = cen::fixed_timestep::from_rate(100, 4);
+
+  ASSERT_EQ(ns{10'000'000}, timestep.step());
+  ASSERT_EQ(4u, timestep.max_steps());
+}
+
+TEST(FixedTimestep, Advance)
+{
+  cen::fixed_timestep timestep{ns{10'000'000}};
+
+  ASSERT_EQ(0u, timestep.advance(ns{4'000'000}));
+  ASSERT_DOUBLE_EQ(0.4, timestep.alpha());
+
+  ASSERT_EQ(1u, timestep.advance(ns{8'000'000}));
+  ASSERT_DOUBLE_EQ(0.2, timestep.alpha());
+
+  ASSERT_EQ(3u, timestep.advance(ns{28'000'000}));
+  ASSERT_DOUBLE_EQ(0.0, timestep.alpha());
+
+  ASSERT_EQ(4u, timestep.total_steps());
+  ASSERT_EQ(0u, timestep.dropped_steps());
+}
+
+TEST(FixedTimestep, NoDrift)
+{
+  // 1/60 s doesn't divide evenly into nanoseconds, but the remainder is kept exactly
+  auto timestep = cen::fixed_timestep::from_rate(60);
+
+  cen::u64 steps = 0;
+  for (int frame = 0; frame < 6'000; ++frame) {
+    steps += timestep.advance(timestep.step());
+  }
+
+  ASSERT_EQ(6'000u, steps);
+  ASSERT_EQ(0.0, timestep.alpha());
+}
+
+TEST(FixedTimestep, MaxSteps)
+{
+  cen::fixed_timestep timestep{ns{10'000'000}, 2};
+
+  ASSERT_EQ(2u, timestep.advance(ns{55'000'000}));
+  ASSERT_EQ(3u, timestep.dropped_steps());
+  ASSERT_DOUBLE_EQ(0.5, timestep.alpha());
+}
+
+TEST(FixedTimestep, Reset)
+{
+  cen::fixed_timestep timestep{ns{10'000'000}};
+
+  ASSERT_EQ(0u, timestep.advance(ns{9'000'000}));
+  timestep.reset();
+
+  ASSERT_EQ(0.0, timestep.alpha());
+  ASSERT_EQ(0u, timestep.advance(ns{9'000'000}));
+}
@@ -0,0 +1,86 @@
+#include "system/frame_histogram.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using ns = cen::frame_histogram::duration_type;
+
+inline constexpr cen::u64 ms = 1'000'000;
+
+}  // namespace
+
+TEST(FrameHistogram, Defaults)
+{
+  const cen::frame_histogram histogram;
+
+  ASSERT_EQ(cen::frame_histogram::default_bucket_width(), histogram.bucket_width());
+  ASSERT_EQ(0u, histogram.count());
+  ASSERT_EQ(ns::zero(), histogram.min());
+  ASSERT_EQ(ns::zero(), histogram.max());
+  ASSERT_EQ(ns::zero(), histogram.mean());
+  ASSERT_EQ(ns::zero(), histogram.percentile(0.5));
+}
+
+TEST(FrameHistogram, Record)
+{
+  cen::frame_histogram histogram;
+
+  histogram.record(ns{16 * ms + 500});
+  histogram.record(ns{16 * ms + 100});
+  histogram.record(ns{33 * ms});
+
+  ASSERT_EQ(3u, histogram.count());
+  ASSERT_EQ(2u, histogram.buckets().at(16));
+  ASSERT_EQ(1u, histogram.buckets().at(33));
+
+  ASSERT_EQ(ns{16 * ms + 100}, histogram.min());
+  ASSERT_EQ(ns{33 * ms}, histogram.max());
+  ASSERT_EQ(ns{(49 * ms + 600 + 16 * ms) / 3}, histogram.mean());
+}
+
+TEST(FrameHistogram, Overflow)
+{
+  cen::frame_histogram histogram;
+  histogram.record(ns{500 * ms});
+
+  const auto last = cen::frame_histogram::bucket_count - 1u;
+  ASSERT_EQ(1u, histogram.buckets().at(last));
+  ASSERT_EQ(ns{500 * ms}, histogram.percentile(1.0));
+}
+
+TEST(FrameHistogram, Percentile)
+{
+  cen::frame_histogram histogram;
+
+  for (int frame = 0; frame < 99; ++frame) {
+    histogram.record(ns{16 * ms + 600'000});
+  }
+
+  histogram.record(ns{40 * ms + 200'000});
+
+  ASSERT_EQ(ns{17 * ms}, histogram.percentile(0.0));
+  ASSERT_EQ(ns{17 * ms}, histogram.percentile(0.5));
+  ASSERT_EQ(ns{17 * ms}, histogram.percentile(0.99));
+  ASSERT_EQ(ns{40 * ms + 200'000}, histogram.percentile(1.0));
+}
+
+TEST(FrameHistogram, BucketWidth)
+{
+  cen::frame_histogram histogram{ns{250'000}};
+  histogram.record(ns{600'000});
+
+  ASSERT_EQ(ns{250'000}, histogram.bucket_width());
+  ASSERT_EQ(1u, histogram.buckets().at(2));
+}
+
+TEST(FrameHistogram, Reset)
+{
+  cen::frame_histogram histogram;
+  histogram.record(ns{5 * ms});
+  histogram.reset();
+
+  ASSERT_EQ(0u, histogram.count());
+  ASSERT_EQ(0u, histogram.buckets().at(5));
+  ASSERT_EQ(ns::zero(), histogram.max());
+}
@@ -0,0 +1,116 @@
+#include "system/game_loop.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using ns = cen::game_loop::duration_type;
+
+inline constexpr cen::u64 ms = 1'000'000;
+
+}  // namespace
+
+TEST(GameLoop, Defaults)
+{
+  const cen::game_loop loop{ns{16 * ms}, cen::fixed_timestep::from_rate(100)};
+
+  ASSERT_EQ(ns{16 * ms}, loop.interval());
+  ASSERT_EQ(ns::zero(), loop.frame_time());
+  ASSERT_EQ(0u, loop.frame_count());
+  ASSERT_EQ(0u, loop.missed_deadlines());
+  ASSERT_EQ(0u, loop.histogram().count());
+  ASSERT_EQ(ns{10 * ms}, loop.timestep().step());
+  ASSERT_TRUE(loop.is_pacing());
+}
+
+TEST(GameLoop, FirstFrame)
+{
+  cen::game_loop loop{ns{5 * ms}, cen::fixed_timestep::from_rate(100)};
+
+  ASSERT_EQ(0u, loop.begin_frame());
+  ASSERT_EQ(0u, loop.frame_count());
+  ASSERT_EQ(0u, loop.histogram().count());
+}
+
+TEST(GameLoop, Pacing)
+{
+  cen::game_loop loop{ns{5 * ms}, cen::fixed_timestep::from_rate(1'000)};
+
+  for (int frame = 0; frame < 5; ++frame) {
+    loop.begin_frame();
+    loop.end_frame();
+  }
+
+  ASSERT_EQ(4u, loop.frame_count());
+  ASSERT_EQ(4u, loop.histogram().count());
+  ASSERT_GE(loop.histogram().min(), ns{4 * ms});
+  ASSERT_GE(loop.timestep().total_steps(), 16u);
+  ASSERT_EQ(0u, loop.missed_deadlines());
+}
+
+TEST(GameLoop, MissedDeadline)
+{
+  cen::game_loop loop{ns{1 * ms}, cen::fixed_timestep::from_rate(100)};
+
+  loop.end_frame();
+  cen::sleep_until(cen::deadline::after(std::chrono::milliseconds{5}));
+  loop.end_frame();
+
+  ASSERT_EQ(1u, loop.missed_deadlines());
+
+  loop.reset_stats();
+  ASSERT_EQ(0u, loop.missed_deadlines());
+}
+
+TEST(GameLoop, NoPacing)
+{
+  cen::game_loop loop{ns{1'000 * ms}, cen::fixed_timestep::from_rate(100)};
+  loop.set_pacing(false);
+
+  const auto before = cen::counter::now();
+  loop.end_frame();
+  loop.end_frame();
+
+  ASSERT_FALSE(loop.is_pacing());
+  ASSERT_LT(cen::counter::now() - before, cen::counter::frequency());
+  ASSERT_EQ(0u, loop.missed_deadlines());
+}
+
+TEST(GameLoop, RunFrame)
+{
+  cen::game_loop loop{ns{5 * ms}, cen::fixed_timestep::from_rate(1'000)};
+
+  int updates = 0;
+  int renders = 0;
+
+  for (int frame = 0; frame < 3; ++frame) {
+    loop.run_frame(
+        [&](const double dt) {
+          ASSERT_DOUBLE_EQ(0.001, dt);
+          ++updates;
+        },
+        [&](const double alpha) {
+          ASSERT_GE(alpha, 0.0);
+          ASSERT_LT(alpha, 1.0);
+          ++renders;
+        });
+  }
+
+  ASSERT_EQ(3, renders);
+  ASSERT_EQ(loop.timestep().total_steps(), static_cast<cen::u64>(updates));
+  ASSERT_GE(updates, 8);
+}
+
+TEST(GameLoop, Reset)
+{
+  cen::game_loop loop{ns{1 * ms}, cen::fixed_timestep::from_rate(100)};
+
+  loop.begin_frame();
+  loop.end_frame();
+  loop.begin_frame();
+  loop.reset();
+
+  ASSERT_EQ(0u, loop.begin_frame());
+  ASSERT_EQ(1u, loop.frame_count());
+  ASSERT_EQ(0.0, loop.alpha());
+}
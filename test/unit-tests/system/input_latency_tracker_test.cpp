@@ -0,0 +1,104 @@
+#include "system/input_latency_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>  // milliseconds
+
+#include "events/event_dispatcher.hpp"
+#include "events/keyboard_event.hpp"
+#include "system/counter.hpp"
+
+TEST(InputLatencyTracker, Inactive)
+{
+  cen::input_latency_tracker::reset();
+  ASSERT_FALSE(cen::input_latency_tracker::active());
+
+  cen::input_latency_tracker::record_input(cen::counter::now());
+  ASSERT_EQ(0u, cen::input_latency_tracker::pending());
+
+  cen::input_latency_tracker::record_present(cen::counter::now());
+  ASSERT_EQ(0u, cen::input_latency_tracker::histogram().count());
+  ASSERT_EQ(0u, cen::input_latency_tracker::presents());
+}
+
+TEST(InputLatencyTracker, RecordPresent)
+{
+  cen::input_latency_tracker::start();
+  ASSERT_TRUE(cen::input_latency_tracker::active());
+
+  const auto frequency = cen::counter::frequency();
+  const auto now = cen::counter::now();
+
+  // Inputs that occurred 5 ms and 21 ms before the present
+  cen::input_latency_tracker::record_input(now - frequency * 5 / 1'000);
+  cen::input_latency_tracker::record_input(now - frequency * 21 / 1'000);
+  ASSERT_EQ(2u, cen::input_latency_tracker::pending());
+
+  cen::input_latency_tracker::record_present(now);
+  ASSERT_EQ(0u, cen::input_latency_tracker::pending());
+  ASSERT_EQ(1u, cen::input_latency_tracker::presents());
+
+  const auto& histogram = cen::input_latency_tracker::histogram();
+  ASSERT_EQ(2u, histogram.count());
+  ASSERT_EQ(std::chrono::milliseconds{5}, histogram.min());
+  ASSERT_EQ(std::chrono::milliseconds{21}, histogram.max());
+  ASSERT_LE(cen::input_latency_tracker::percentile(0.5), std::chrono::milliseconds{6});
+
+  // Presents without pending inputs are not counted
+  cen::input_latency_tracker::record_present(now + frequency);
+  ASSERT_EQ(1u, cen::input_latency_tracker::presents());
+  ASSERT_EQ(2u, histogram.count());
+
+  cen::input_latency_tracker::reset();
+  ASSERT_EQ(0u, histogram.count());
+}
+
+TEST(InputLatencyTracker, Lost)
+{
+  cen::input_latency_tracker::start();
+
+  const auto now = cen::counter::now();
+  for (auto index = 0; index < 100; ++index) {
+    cen::input_latency_tracker::record_input(now);
+  }
+
+  ASSERT_EQ(64u, cen::input_latency_tracker::pending());
+  ASSERT_EQ(36u, cen::input_latency_tracker::lost());
+
+  cen::input_latency_tracker::reset();
+}
+
+TEST(InputLatencyTracker, Dispatch)
+{
+  cen::input_latency_tracker::start();
+
+  cen::event_dispatcher<cen::keyboard_event> dispatcher;
+
+  SDL_Event key{};
+  key.type = SDL_KEYDOWN;
+  key.key.timestamp = SDL_GetTicks();
+  dispatcher.dispatch(key);
+
+  // Window events are not input events
+  SDL_Event window{};
+  window.type = SDL_WINDOWEVENT;
+  dispatcher.dispatch(window);
+
+  ASSERT_EQ(1u, cen::input_latency_tracker::pending());
+
+  // Motion events are only tracked on request
+  SDL_Event motion{};
+  motion.type = SDL_MOUSEMOTION;
+  cen::input_latency_tracker::record_input(motion);
+  ASSERT_EQ(1u, cen::input_latency_tracker::pending());
+
+  cen::input_latency_tracker::set_motion_tracked(true);
+  cen::input_latency_tracker::record_input(motion);
+  ASSERT_EQ(2u, cen::input_latency_tracker::pending());
+  cen::input_latency_tracker::set_motion_tracked(false);
+
+  cen::input_latency_tracker::record_present(cen::counter::now());
+  ASSERT_EQ(2u, cen::input_latency_tracker::histogram().count());
+
+  cen::input_latency_tracker::reset();
+}
@@ -0,0 +1,135 @@
+#include "system/memory_budget.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+static_assert(!std::is_copy_constructible_v<cen::memory_budget>);
+static_assert(!std::is_copy_assignable_v<cen::memory_budget>);
+
+namespace {
+
+// Frees memory in fixed-size blocks, recording the order in which it was trimmed
+class fake_cache final
+{
+ public:
+  fake_cache(const int id, const cen::usize bytes, std::vector<int>& order)
+      : m_order{&order}
+      , m_bytes{bytes}
+      , m_id{id}
+  {}
+
+  [[nodiscard]] auto resident_bytes() const noexcept -> cen::usize
+  {
+    return m_bytes;
+  }
+
+  auto free_memory(const cen::usize bytes) -> cen::usize
+  {
+    m_order->push_back(m_id);
+
+    cen::usize freed = 0;
+    while (m_bytes != 0 && freed < bytes) {
+      m_bytes -= 100;
+      freed += 100;
+    }
+
+    return freed;
+  }
+
+ private:
+  std::vector<int>* m_order{};
+  cen::usize m_bytes{};
+  int m_id{};
+};
+
+}  // namespace
+
+TEST(MemoryBudget, Defaults)
+{
+  const cen::memory_budget budget;
+  ASSERT_EQ(cen::memory_budget::default_budget(), budget.budget());
+  ASSERT_EQ(0u, budget.size());
+  ASSERT_EQ(0u, budget.usage());
+  ASSERT_FALSE(budget.is_low_memory_pending());
+
+  const auto megabytes = cen::ram::amount_mb();
+  if (megabytes > 0) {
+    const auto expected = static_cast<cen::u64>(megabytes) / 4u * 1'024u * 1'024u;
+    ASSERT_EQ(expected, static_cast<cen::u64>(cen::memory_budget::default_budget()));
+  }
+}
+
+TEST(MemoryBudget, OverBudget)
+{
+  std::vector<int> order;
+  fake_cache low{0, 1'000, order};
+  fake_cache high{1, 1'000, order};
+
+  cen::memory_budget budget{1'500};
+  budget.add(high, 1);
+  budget.add(low, 0);
+  ASSERT_EQ(2u, budget.size());
+  ASSERT_EQ(2'000u, budget.usage());
+
+  // The lowest priority is trimmed first, and trimming stops once enough is freed
+  ASSERT_EQ(500u, budget.update());
+  ASSERT_EQ(500u, low.resident_bytes());
+  ASSERT_EQ(1'000u, high.resident_bytes());
+  ASSERT_EQ((std::vector<int>{0}), order);
+
+  ASSERT_EQ(0u, budget.update());
+  ASSERT_EQ(1u, budget.statistics().trims);
+  ASSERT_EQ(500u, budget.statistics().freed_bytes);
+
+  // Caches continue to be trimmed in order when the first doesn't free enough
+  budget.set_budget(200);
+  ASSERT_EQ(1'300u, budget.update());
+  ASSERT_EQ(0u, low.resident_bytes());
+  ASSERT_EQ(200u, high.resident_bytes());
+  ASSERT_EQ((std::vector<int>{0, 0, 1}), order);
+}
+
+TEST(MemoryBudget, LowMemory)
+{
+  std::vector<int> order;
+  fake_cache first{0, 300, order};
+  fake_cache second{1, 400, order};
+
+  cen::memory_budget budget{0};
+  const auto id = budget.add(first);
+  budget.add(2,
+             [&] { return second.resident_bytes(); },
+             [&](const cen::usize bytes) { return second.free_memory(bytes); });
+
+  // Without a budget, the caches are only trimmed when the system is low on memory
+  ASSERT_EQ(0u, budget.update());
+
+  budget.notify_low_memory();
+  ASSERT_TRUE(budget.is_low_memory_pending());
+
+  ASSERT_EQ(700u, budget.update());
+  ASSERT_FALSE(budget.is_low_memory_pending());
+  ASSERT_EQ(0u, budget.usage());
+  ASSERT_EQ(1u, budget.statistics().low_memory);
+
+  ASSERT_TRUE(budget.remove(id));
+  ASSERT_FALSE(budget.remove(id));
+  ASSERT_EQ(1u, budget.size());
+}
+
+TEST(MemoryBudget, LowMemoryEvent)
+{
+  cen::memory_budget budget{0};
+
+  SDL_Event event{};
+  event.type = SDL_APP_LOWMEMORY;
+  ASSERT_EQ(1, SDL_PushEvent(&event));
+
+  ASSERT_TRUE(budget.is_low_memory_pending());
+  budget.update();
+  ASSERT_EQ(1u, budget.statistics().low_memory);
+
+  SDL_FlushEvent(SDL_APP_LOWMEMORY);
+}
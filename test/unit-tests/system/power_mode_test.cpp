@@ -0,0 +1,21 @@
+#include "system/power_mode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+TEST(PowerMode, Values)
+{
+  ASSERT_EQ(3, cen::power_mode_count());
+}
+
+TEST(PowerMode, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::power_mode>(4)), cen::cen_error);
+
+  ASSERT_EQ("performance", cen::to_string(cen::power_mode::performance));
+  ASSERT_EQ("balanced", cen::to_string(cen::power_mode::balanced));
+  ASSERT_EQ("power_saving", cen::to_string(cen::power_mode::power_saving));
+
+  std::clog << "Power mode example: " << cen::power_mode::balanced << '\n';
+}
@@ -0,0 +1,139 @@
+#include "system/power_profile.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_copy_constructible_v
+
+#include "thread/thread.hpp"
+
+using namespace cen::literals;
+
+static_assert(!std::is_copy_constructible_v<cen::power_profile>);
+static_assert(!std::is_copy_assignable_v<cen::power_profile>);
+
+TEST(PowerProfile, Defaults)
+{
+  const cen::power_profile profile;
+  ASSERT_EQ(cen::power_profile::default_interval(), profile.interval());
+  ASSERT_EQ(20, profile.low_battery_threshold());
+  ASSERT_EQ(1u, profile.sample_count());
+  ASSERT_FALSE(profile.get_override());
+
+  const auto& saving = profile.settings(cen::power_mode::power_saving);
+  ASSERT_EQ(20, saving.frame_rate);
+  ASSERT_EQ(2, saving.texture_level);
+  ASSERT_EQ(cen::resample_quality::fast, saving.audio_quality);
+
+  ASSERT_EQ(0, profile.settings(cen::power_mode::performance).frame_rate);
+  ASSERT_EQ(30, profile.settings(cen::power_mode::balanced).frame_rate);
+}
+
+TEST(PowerProfile, Current)
+{
+  const cen::power_profile profile;
+  const auto current = profile.current();
+
+  ASSERT_EQ(profile.mode(), current.mode);
+  ASSERT_EQ(profile.mode(), current.previous);
+  ASSERT_EQ(profile.state(), current.state);
+  ASSERT_EQ(profile.percentage(), current.percentage);
+  ASSERT_EQ(profile.seconds_left(), current.seconds_left);
+  ASSERT_EQ(profile.settings(profile.mode()).frame_rate, current.settings.frame_rate);
+
+  const auto expected = cen::power_profile::mode_for(profile.state(),
+                                                     profile.percentage(),
+                                                     profile.low_battery_threshold());
+  ASSERT_EQ(expected, profile.mode());
+}
+
+TEST(PowerProfile, ModeFor)
+{
+  using cen::power_mode;
+  using cen::power_profile;
+  using cen::power_state;
+
+  ASSERT_EQ(power_mode::performance, power_profile::mode_for(power_state::charging, 5, 20));
+  ASSERT_EQ(power_mode::performance, power_profile::mode_for(power_state::charged, {}, 20));
+  ASSERT_EQ(power_mode::performance,
+            power_profile::mode_for(power_state::no_battery, {}, 20));
+  ASSERT_EQ(power_mode::performance, power_profile::mode_for(power_state::unknown, {}, 20));
+
+  ASSERT_EQ(power_mode::balanced, power_profile::mode_for(power_state::on_battery, {}, 20));
+  ASSERT_EQ(power_mode::balanced, power_profile::mode_for(power_state::on_battery, 21, 20));
+  ASSERT_EQ(power_mode::power_saving,
+            power_profile::mode_for(power_state::on_battery, 20, 20));
+}
+
+TEST(PowerProfile, Override)
+{
+  cen::power_profile profile;
+
+  int count = 0;
+  cen::power_change last;
+
+  auto handler = [&](const cen::power_change& change) {
+    ++count;
+    last = change;
+  };
+
+  profile.listeners().connect(handler);
+
+  const auto initial = profile.mode();
+  const auto forced = (initial == cen::power_mode::power_saving)
+                          ? cen::power_mode::performance
+                          : cen::power_mode::power_saving;
+
+  profile.set_override(forced);
+  ASSERT_EQ(forced, profile.mode());
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(forced, last.mode);
+  ASSERT_EQ(initial, last.previous);
+  ASSERT_EQ(profile.settings(forced).frame_rate, last.settings.frame_rate);
+
+  // Unchanged modes aren't published again
+  profile.set_override(forced);
+  ASSERT_EQ(1, count);
+
+  profile.set_override(std::nullopt);
+  ASSERT_EQ(initial, profile.mode());
+  ASSERT_EQ(2, count);
+  ASSERT_EQ(forced, last.previous);
+}
+
+TEST(PowerProfile, SetSettings)
+{
+  cen::power_profile profile;
+  profile.set_override(cen::power_mode::balanced);
+
+  int count = 0;
+  auto handler = [&](const cen::power_change&) { ++count; };
+  profile.listeners().connect(handler);
+
+  // Only the settings of the current mode are published
+  profile.set_settings(cen::power_mode::power_saving, {15, 2, cen::resample_quality::none});
+  ASSERT_EQ(0, count);
+  ASSERT_EQ(15, profile.settings(cen::power_mode::power_saving).frame_rate);
+
+  profile.set_settings(cen::power_mode::balanced, {40, 0, cen::resample_quality::best});
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(40, profile.current().settings.frame_rate);
+}
+
+TEST(PowerProfile, Update)
+{
+  cen::power_profile profile{1'000_ms};
+  ASSERT_EQ(1'000_ms, profile.interval());
+
+  // The power state isn't sampled again before the interval has elapsed
+  profile.update();
+  ASSERT_EQ(1u, profile.sample_count());
+
+  profile.refresh();
+  ASSERT_EQ(2u, profile.sample_count());
+
+  profile.set_interval(1_ms);
+  cen::thread::sleep(2_ms);
+
+  profile.update();
+  ASSERT_EQ(3u, profile.sample_count());
+}
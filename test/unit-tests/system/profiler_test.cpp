@@ -0,0 +1,125 @@
+#define CENTURION_ENABLE_PROFILER
+
+#include "system/profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>      // stringstream
+#include <string>       // string
+#include <type_traits>  // is_copy_constructible_v
+
+#include "system/profiler_macros.hpp"
+#include "thread/thread.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::profile_zone>);
+
+namespace {
+
+void busy_wait(const cen::u64 ns)
+{
+  const auto end = cen::counter::now() + ns * cen::counter::frequency() / 1'000'000'000;
+  while (cen::counter::now() < end) {
+  }
+}
+
+void profiled_function()
+{
+  CENTURION_PROFILE_ZONE("profiled_function");
+  busy_wait(100'000);
+}
+
+}  // namespace
+
+TEST(Profiler, Zones)
+{
+  cen::profiler::reset();
+
+  profiled_function();
+  profiled_function();
+  cen::profiler::end_frame();
+
+  auto stats = cen::profiler::find("profiled_function");
+  ASSERT_TRUE(stats);
+  ASSERT_EQ(2u, stats->calls);
+  ASSERT_EQ(1u, stats->frames);
+  ASSERT_GE(stats->last.count(), 200'000u);
+  ASSERT_EQ(stats->last, stats->min);
+  ASSERT_EQ(stats->last, stats->max);
+
+  profiled_function();
+  cen::profiler::end_frame();
+
+  stats = cen::profiler::find("profiled_function");
+  ASSERT_TRUE(stats);
+  ASSERT_EQ(1u, stats->calls);
+  ASSERT_EQ(2u, stats->frames);
+  ASSERT_LT(stats->min, stats->max);
+  ASSERT_LE(stats->min, stats->average);
+  ASSERT_LE(stats->average, stats->max);
+
+  // Zones that aren't entered keep their statistics, but report no calls
+  cen::profiler::end_frame();
+
+  stats = cen::profiler::find("profiled_function");
+  ASSERT_TRUE(stats);
+  ASSERT_EQ(0u, stats->calls);
+  ASSERT_EQ(2u, stats->frames);
+  ASSERT_EQ(3u, cen::profiler::frame_count());
+  ASSERT_GT(cen::profiler::frame_time().count(), 0u);
+
+  cen::profiler::reset();
+  ASSERT_TRUE(cen::profiler::zones().empty());
+  ASSERT_EQ(0u, cen::profiler::frame_count());
+}
+
+TEST(Profiler, Threads)
+{
+  cen::profiler::reset();
+
+  for (auto index = 0; index < 2; ++index) {
+    cen::thread thread{[](void*) {
+                         profiled_function();
+                         return 0;
+                       },
+                       "profiled"};
+  }
+
+  cen::profiler::end_frame();
+
+  const auto stats = cen::profiler::find("profiled_function");
+  ASSERT_TRUE(stats);
+  ASSERT_EQ(2u, stats->calls);
+  ASSERT_EQ(0u, cen::profiler::lost());
+
+  cen::profiler::reset();
+}
+
+TEST(Profiler, ChromeTrace)
+{
+  cen::profiler::reset();
+  cen::profiler::start_capture();
+
+  {
+    CENTURION_PROFILE_ZONE("outer");
+    profiled_function();
+  }
+
+  cen::profiler::end_frame();
+  cen::profiler::stop_capture();
+
+  profiled_function();
+  cen::profiler::end_frame();
+
+  ASSERT_EQ(2u, cen::profiler::captured());
+
+  std::stringstream stream;
+  cen::profiler::write_chrome_trace(stream);
+
+  const auto json = stream.str();
+  ASSERT_EQ(0u, json.find(R"({"displayTimeUnit":"ms","traceEvents":[{"name":)"));
+  ASSERT_NE(std::string::npos, json.find(R"("name":"outer","ph":"X")"));
+  ASSERT_NE(std::string::npos, json.find(R"("name":"profiled_function","ph":"X")"));
+  ASSERT_EQ("]}", json.substr(json.size() - 2));
+
+  cen::profiler::reset();
+}
@@ -11,3 +11,12 @@ TEST(RAM, AmountGB)
 {
   ASSERT_EQ(SDL_GetSystemRAM() / 1'000, cen::ram::amount_gb());
 }
+
+TEST(RAM, ProcessResidentBytes)
+{
+#if defined(_WIN32) || defined(__APPLE__) || defined(__linux__)
+  ASSERT_GT(cen::ram::process_resident_bytes(), 0u);
+#else
+  ASSERT_EQ(0u, cen::ram::process_resident_bytes());
+#endif  // defined(_WIN32) || defined(__APPLE__) || defined(__linux__)
+}
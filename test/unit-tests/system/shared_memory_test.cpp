@@ -0,0 +1,74 @@
+#include "system/shared_memory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>      // memcpy, memcmp
+#include <string>       // string
+#include <type_traits>  // is_copy_constructible_v
+#include <utility>      // move
+
+static_assert(!std::is_copy_constructible_v<cen::shared_memory>);
+static_assert(std::is_nothrow_move_constructible_v<cen::shared_memory>);
+
+TEST(SharedMemory, Create)
+{
+  const auto memory = cen::shared_memory::create("centurion-shared-memory-test", 4'096);
+  ASSERT_TRUE(memory);
+  ASSERT_TRUE(memory.is_owner());
+  ASSERT_EQ(4'096u, memory.size());
+  ASSERT_NE(nullptr, memory.data());
+
+  // The memory is zero-initialized
+  for (cen::usize index = 0; index < memory.size(); ++index) {
+    ASSERT_EQ(0u, memory.data()[index]);
+  }
+}
+
+TEST(SharedMemory, Open)
+{
+  auto created = cen::shared_memory::create("centurion-shared-memory-test", 128);
+  ASSERT_TRUE(created);
+
+  const auto opened = cen::shared_memory::open(created.name());
+  ASSERT_TRUE(opened);
+  ASSERT_FALSE(opened.is_owner());
+  ASSERT_EQ(created.name(), opened.name());
+  ASSERT_NE(created.data(), opened.data());
+
+  // Both views refer to the same memory
+  std::memcpy(created.data(), "centurion", 10);
+  ASSERT_EQ(0, std::memcmp(opened.data(), "centurion", 10));
+}
+
+TEST(SharedMemory, OpenMissing)
+{
+  const auto memory = cen::shared_memory::open("centurion-shared-memory-missing");
+  ASSERT_FALSE(memory);
+  ASSERT_EQ(nullptr, memory.data());
+  ASSERT_EQ(0u, memory.size());
+}
+
+TEST(SharedMemory, RemovedByOwner)
+{
+  std::string name;
+
+  {
+    const auto memory = cen::shared_memory::create("centurion-shared-memory-test", 64);
+    ASSERT_TRUE(memory);
+    name = memory.name();
+  }
+
+  ASSERT_FALSE(cen::shared_memory::open(name));
+}
+
+TEST(SharedMemory, Move)
+{
+  auto memory = cen::shared_memory::create("centurion-shared-memory-test", 64);
+  auto* data = memory.data();
+
+  auto other = std::move(memory);
+  ASSERT_TRUE(other);
+  ASSERT_TRUE(other.is_owner());
+  ASSERT_EQ(data, other.data());
+  ASSERT_EQ(64u, other.size());
+}
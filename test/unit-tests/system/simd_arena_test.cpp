@@ -0,0 +1,125 @@
+#include "system/simd_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>      // uintptr_t
+#include <type_traits>  // is_copy_constructible_v
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+#include <vector>  // vector
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+static_assert(std::is_final_v<cen::simd_arena>);
+static_assert(!std::is_copy_constructible_v<cen::simd_arena>);
+static_assert(std::is_nothrow_move_constructible_v<cen::simd_arena>);
+
+namespace {
+
+[[nodiscard]] auto is_aligned(const void* ptr, const cen::usize alignment) noexcept -> bool
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(SIMDArena, Allocate)
+{
+  cen::simd_arena arena{256};
+  ASSERT_EQ(256u, arena.capacity());
+  ASSERT_EQ(0u, arena.used());
+  ASSERT_GE(arena.alignment(), cen::cpu::simd_alignment());
+
+  auto* first = arena.allocate(10);
+  auto* second = arena.allocate_array<float>(4);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  ASSERT_TRUE(is_aligned(first, arena.alignment()));
+  ASSERT_TRUE(is_aligned(second, arena.alignment()));
+  ASSERT_NE(first, static_cast<void*>(second));
+
+  ASSERT_TRUE(arena.owns(first));
+  ASSERT_TRUE(arena.owns(second));
+
+  int local{};
+  ASSERT_FALSE(arena.owns(&local));
+}
+
+TEST(SIMDArena, OverAlignedAllocate)
+{
+  cen::simd_arena arena{1'024};
+
+  // Alignments above the alignment of the block are applied to the address
+  ASSERT_TRUE(arena.allocate(1));
+  auto* data = arena.allocate(16, 256);
+  ASSERT_TRUE(data);
+  ASSERT_TRUE(is_aligned(data, 256));
+}
+
+TEST(SIMDArena, MarkAndRewind)
+{
+  cen::simd_arena arena{256};
+
+  ASSERT_TRUE(arena.allocate(16));
+  const auto marker = arena.mark();
+
+  auto* scratch = arena.allocate(32);
+  ASSERT_TRUE(scratch);
+  ASSERT_GT(arena.used(), marker);
+
+  arena.rewind(marker);
+  ASSERT_EQ(marker, arena.used());
+  ASSERT_EQ(scratch, arena.allocate(32));
+}
+
+TEST(SIMDArena, GrowsOnReset)
+{
+  cen::simd_arena arena{64};
+
+  ASSERT_TRUE(arena.allocate(32));
+  ASSERT_FALSE(arena.allocate(1'000));
+  ASSERT_EQ(1u, arena.failures());
+  ASSERT_EQ(64u, arena.capacity());
+
+  arena.reset();
+  ASSERT_EQ(0u, arena.used());
+  ASSERT_GE(arena.capacity(), 1'000u);
+
+  ASSERT_TRUE(arena.allocate(32));
+  ASSERT_TRUE(arena.allocate(1'000 - 2 * arena.alignment()));
+
+  // Resetting without failures keeps the memory block
+  const auto capacity = arena.capacity();
+  arena.reset();
+  ASSERT_EQ(capacity, arena.capacity());
+}
+
+#if CENTURION_HAS_FEATURE_MEMORY_RESOURCE
+
+TEST(SIMDArenaResource, Usage)
+{
+  cen::simd_arena arena{1'024};
+  cen::simd_arena_resource resource{arena};
+  ASSERT_EQ(&arena, &resource.arena());
+
+  {
+    std::pmr::vector<int> values{&resource};
+    values.reserve(16);
+    ASSERT_TRUE(arena.owns(values.data()));
+
+    // Doesn't fit in the arena, so it's allocated by the upstream resource
+    values.reserve(1'000);
+    ASSERT_FALSE(arena.owns(values.data()));
+    ASSERT_EQ(1u, arena.failures());
+
+    values.assign(1'000, 42);
+  }
+
+  arena.reset();
+  ASSERT_GE(arena.capacity(), 4'000u);
+
+  std::pmr::vector<int> values{&resource};
+  values.reserve(1'000);
+  ASSERT_TRUE(arena.owns(values.data()));
+}
+
+#endif  // CENTURION_HAS_FEATURE_MEMORY_RESOURCE
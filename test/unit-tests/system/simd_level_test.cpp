@@ -0,0 +1,22 @@
+#include "system/simd_level.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+TEST(SimdLevel, Values)
+{
+  ASSERT_EQ(4, cen::simd_level_count());
+}
+
+TEST(SimdLevel, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::simd_level>(5)), cen::cen_error);
+
+  ASSERT_EQ("scalar", cen::to_string(cen::simd_level::scalar));
+  ASSERT_EQ("sse2", cen::to_string(cen::simd_level::sse2));
+  ASSERT_EQ("neon", cen::to_string(cen::simd_level::neon));
+  ASSERT_EQ("avx2", cen::to_string(cen::simd_level::avx2));
+
+  std::clog << "SIMD level example: " << cen::simd_level::avx2 << '\n';
+}
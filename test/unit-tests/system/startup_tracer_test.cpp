@@ -0,0 +1,110 @@
+#include "system/startup_tracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>    // find_if
+#include <cstring>      // strcmp
+#include <sstream>      // stringstream
+#include <string>       // string
+#include <type_traits>  // is_copy_constructible_v
+
+static_assert(!std::is_copy_constructible_v<cen::startup_scope>);
+
+TEST(StartupTracer, Inactive)
+{
+  cen::startup_tracer::reset();
+  ASSERT_FALSE(cen::startup_tracer::active());
+
+  {
+    const cen::startup_scope scope{"ignored"};
+  }
+
+  cen::startup_tracer::record("ignored", 1, 2);
+  ASSERT_TRUE(cen::startup_tracer::events().empty());
+  ASSERT_FALSE(cen::startup_tracer::time_to_first_present());
+}
+
+TEST(StartupTracer, Phases)
+{
+  cen::startup_tracer::start();
+  ASSERT_TRUE(cen::startup_tracer::active());
+
+  const auto now = cen::counter::now();
+  cen::startup_tracer::record("second", now - 5, now - 4);
+  cen::startup_tracer::record("first", now - 10, now);
+
+  {
+    const cen::startup_scope scope{"scope"};
+  }
+
+  cen::startup_tracer::record_present(now + 20, now + 21);
+  ASSERT_FALSE(cen::startup_tracer::active());
+
+  // Nothing is recorded after the first present
+  cen::startup_tracer::record_present(now + 30, now + 31);
+
+  const auto events = cen::startup_tracer::events();
+  ASSERT_EQ(4u, events.size());
+  ASSERT_EQ(0, std::strcmp("first", events.at(0).name));
+  ASSERT_EQ(0, std::strcmp("second", events.at(1).name));
+
+  ASSERT_EQ(now - 5, events.at(1).start);
+  ASSERT_EQ(now - 4, events.at(1).end);
+
+  const auto present = std::find_if(events.begin(), events.end(), [](const auto& event) {
+    return std::strcmp("present", event.name) == 0;
+  });
+  ASSERT_NE(events.end(), present);
+  ASSERT_EQ(now + 20, present->start);
+
+  ASSERT_TRUE(cen::startup_tracer::time_to_first_present());
+  ASSERT_EQ(0u, cen::startup_tracer::lost());
+}
+
+TEST(StartupTracer, Summary)
+{
+  cen::startup_tracer::start();
+  cen::startup_tracer::record("window", cen::counter::now(), cen::counter::now());
+
+  auto summary = cen::startup_tracer::summary();
+  ASSERT_NE(std::string::npos, summary.find(" ms  window"));
+  ASSERT_NE(std::string::npos, summary.find("first present: none"));
+
+  const auto now = cen::counter::now();
+  cen::startup_tracer::record_present(now, now);
+
+  summary = cen::startup_tracer::summary();
+  ASSERT_NE(std::string::npos, summary.find("present\n"));
+  ASSERT_EQ(std::string::npos, summary.find("first present: none"));
+}
+
+TEST(StartupTracer, ChromeTrace)
+{
+  cen::startup_tracer::start();
+  cen::startup_tracer::record("quote\"d", cen::counter::now(), cen::counter::now());
+  cen::startup_tracer::stop();
+
+  std::stringstream stream;
+  cen::startup_tracer::write_chrome_trace(stream);
+
+  const auto json = stream.str();
+  ASSERT_EQ(0u, json.find(R"({"displayTimeUnit":"ms","traceEvents":[{"name":"quote\"d")"));
+  ASSERT_NE(std::string::npos, json.find(R"("cat":"startup","ph":"X")"));
+  ASSERT_EQ(json.size() - 2, json.rfind("]}"));
+}
+
+TEST(StartupTracer, Capacity)
+{
+  cen::startup_tracer::start();
+
+  for (auto index = 0; index < 300; ++index) {
+    cen::startup_tracer::record("phase", 1, 2);
+  }
+
+  ASSERT_EQ(256u, cen::startup_tracer::events().size());
+  ASSERT_EQ(44u, cen::startup_tracer::lost());
+
+  cen::startup_tracer::reset();
+  ASSERT_TRUE(cen::startup_tracer::events().empty());
+  ASSERT_EQ(0u, cen::startup_tracer::lost());
+}
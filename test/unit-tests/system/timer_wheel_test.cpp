@@ -0,0 +1,249 @@
+#include "system/timer_wheel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+using namespace cen::literals;
+
+static_assert(!std::is_copy_constructible_v<cen::timer_wheel>);
+static_assert(!std::is_copy_assignable_v<cen::timer_wheel>);
+
+TEST(TimerWheel, Defaults)
+{
+  const cen::timer_wheel timers;
+  ASSERT_EQ(cen::timer_wheel::default_resolution(), timers.resolution());
+  ASSERT_EQ(0u, timers.size());
+  ASSERT_TRUE(timers.empty());
+  ASSERT_EQ(0u, timers.elapsed().count());
+  ASSERT_FALSE(timers.is_pending(cen::timer_wheel::timer_id{}));
+}
+
+TEST(TimerWheel, Schedule)
+{
+  cen::timer_wheel timers;
+  std::vector<int> order;
+
+  timers.schedule(30_ms, [&] { order.push_back(3); });
+  timers.schedule(10_ms, [&] { order.push_back(1); });
+  const auto id = timers.schedule(20_ms, [&] { order.push_back(2); });
+
+  ASSERT_EQ(3u, timers.size());
+  ASSERT_TRUE(timers.is_pending(id));
+  ASSERT_EQ(20_ms, timers.remaining(id));
+
+  ASSERT_EQ(0u, timers.advance_by(9_ms));
+  ASSERT_TRUE(order.empty());
+
+  ASSERT_EQ(2u, timers.advance_by(11_ms));
+  ASSERT_EQ((std::vector<int>{1, 2}), order);
+  ASSERT_FALSE(timers.is_pending(id));
+  ASSERT_FALSE(timers.remaining(id));
+
+  ASSERT_EQ(1u, timers.advance_by(100_ms));
+  ASSERT_EQ((std::vector<int>{1, 2, 3}), order);
+  ASSERT_TRUE(timers.empty());
+}
+
+TEST(TimerWheel, ScheduleRoundsUp)
+{
+  cen::timer_wheel timers;
+  int count = 0;
+
+  timers.schedule(1'500_us, [&] { ++count; });
+  timers.schedule(0_ms, [&] { ++count; });
+
+  ASSERT_EQ(1u, timers.advance_by(1_ms));
+  ASSERT_EQ(1, count);
+
+  ASSERT_EQ(1u, timers.advance_by(1_ms));
+  ASSERT_EQ(2, count);
+}
+
+TEST(TimerWheel, AdvanceByKeepsRemainder)
+{
+  cen::timer_wheel timers;
+  int count = 0;
+
+  timers.schedule(2_ms, [&] { ++count; });
+
+  for (int i = 0; i < 3; ++i) {
+    timers.advance_by(500_us);
+  }
+
+  ASSERT_EQ(0, count);
+  ASSERT_EQ(1_ms, timers.elapsed());
+
+  timers.advance_by(500_us);
+  ASSERT_EQ(1, count);
+}
+
+TEST(TimerWheel, Cancel)
+{
+  cen::timer_wheel timers;
+  int count = 0;
+
+  const auto a = timers.schedule(5_ms, [&] { ++count; });
+  const auto b = timers.schedule(5_ms, [&] { count += 10; });
+
+  ASSERT_TRUE(timers.cancel(a));
+  ASSERT_FALSE(timers.cancel(a));
+  ASSERT_FALSE(timers.is_pending(a));
+  ASSERT_EQ(1u, timers.size());
+
+  timers.advance_by(5_ms);
+  ASSERT_EQ(10, count);
+  ASSERT_FALSE(timers.cancel(b));
+
+  // The node is reused, but the old IDs remain invalid
+  const auto c = timers.schedule(5_ms, [] {});
+  ASSERT_NE(a, c);
+  ASSERT_NE(b, c);
+  ASSERT_FALSE(timers.cancel(a));
+  ASSERT_TRUE(timers.is_pending(c));
+}
+
+TEST(TimerWheel, ScheduleEvery)
+{
+  cen::timer_wheel timers;
+  int count = 0;
+
+  const auto id = timers.schedule_every(10_ms, [&] { ++count; });
+
+  ASSERT_EQ(1u, timers.advance_by(10_ms));
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(10_ms, timers.remaining(id));
+
+  ASSERT_EQ(3u, timers.advance_by(35_ms));
+  ASSERT_EQ(4, count);
+  ASSERT_EQ(5_ms, timers.remaining(id));
+
+  ASSERT_TRUE(timers.cancel(id));
+  timers.advance_by(100_ms);
+  ASSERT_EQ(4, count);
+}
+
+TEST(TimerWheel, CancelFromCallback)
+{
+  cen::timer_wheel timers;
+  int count = 0;
+
+  cen::timer_wheel::timer_id id{};
+  id = timers.schedule_every(1_ms, [&] {
+    if (++count == 3) {
+      ASSERT_TRUE(timers.cancel(id));
+    }
+  });
+
+  timers.advance_by(10_ms);
+  ASSERT_EQ(3, count);
+  ASSERT_FALSE(timers.is_pending(id));
+  ASSERT_TRUE(timers.empty());
+}
+
+TEST(TimerWheel, ScheduleFromCallback)
+{
+  cen::timer_wheel timers;
+  std::vector<int> order;
+
+  timers.schedule(1_ms, [&] {
+    order.push_back(1);
+
+    // Enough timers to reallocate the nodes while the callback runs
+    for (int i = 0; i < 100; ++i) {
+      timers.schedule(1_ms, [&order] { order.push_back(2); });
+    }
+  });
+
+  ASSERT_EQ(1u, timers.advance_by(1_ms));
+  ASSERT_EQ(100u, timers.size());
+
+  ASSERT_EQ(100u, timers.advance_by(1_ms));
+  ASSERT_EQ(101u, order.size());
+  ASSERT_TRUE(timers.empty());
+}
+
+TEST(TimerWheel, LongDelays)
+{
+  cen::timer_wheel timers;
+  std::vector<cen::u64> fired;
+
+  // Delays that end up in each of the wheels, including beyond their range
+  const cen::u64 delays[] = {63, 64, 65, 4'095, 4'096, 300'000, 17'000'000, 20'000'000};
+  for (const auto delay : delays) {
+    timers.schedule(cen::milliseconds<cen::u64>{delay}, [&, delay] {
+      ASSERT_EQ(delay * 1'000'000u, timers.elapsed().count());
+      fired.push_back(delay);
+    });
+  }
+
+  // Keep a timer pending, so that no ticks are skipped
+  timers.schedule_every(1'000_ms, [] {});
+
+  for (int step = 0; step < 21'000; ++step) {
+    timers.advance_by(1'000_ms);
+  }
+
+  ASSERT_EQ((std::vector<cen::u64>{std::begin(delays), std::end(delays)}), fired);
+}
+
+TEST(TimerWheel, SkipsIdleTicks)
+{
+  cen::timer_wheel timers;
+
+  timers.advance_by(std::chrono::hours{24});
+  ASSERT_EQ(std::chrono::hours{24}, timers.elapsed());
+
+  bool fired = false;
+  timers.schedule(100_ms, [&] { fired = true; });
+
+  timers.advance_by(100_ms);
+  ASSERT_TRUE(fired);
+}
+
+TEST(TimerWheel, Resolution)
+{
+  cen::timer_wheel timers{10_ms};
+  ASSERT_EQ(10_ms, timers.resolution());
+
+  int count = 0;
+  const auto id = timers.schedule(15_ms, [&] { ++count; });
+  ASSERT_EQ(20_ms, timers.remaining(id));
+
+  timers.advance_by(19_ms);
+  ASSERT_EQ(0, count);
+
+  timers.advance_by(1_ms);
+  ASSERT_EQ(1, count);
+}
+
+TEST(TimerWheel, Clear)
+{
+  cen::timer_wheel timers;
+  int count = 0;
+
+  const auto id = timers.schedule(1_ms, [&] { ++count; });
+  timers.schedule_every(1_ms, [&] { ++count; });
+
+  timers.clear();
+  ASSERT_TRUE(timers.empty());
+  ASSERT_FALSE(timers.is_pending(id));
+
+  timers.advance_by(10_ms);
+  ASSERT_EQ(0, count);
+}
+
+TEST(TimerWheel, Advance)
+{
+  cen::timer_wheel timers;
+  bool fired = false;
+
+  timers.schedule(1_ms, [&] { fired = true; });
+
+  SDL_Delay(5);
+  timers.advance();
+
+  ASSERT_TRUE(fired);
+  ASSERT_GE(timers.elapsed(), 1_ms);
+}
@@ -0,0 +1,70 @@
+#include "thread/adaptive_mutex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>       // thread
+#include <type_traits>  // is_copy_constructible_v, is_copy_assignable_v
+#include <vector>       // vector
+
+#include "thread/scoped_lock.hpp"
+#include "thread/try_lock.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::adaptive_mutex>);
+static_assert(!std::is_copy_assignable_v<cen::adaptive_mutex>);
+
+TEST(AdaptiveMutex, LockAndUnlock)
+{
+  cen::adaptive_mutex mutex;
+
+  ASSERT_TRUE(mutex.lock());
+  ASSERT_TRUE(mutex.unlock());
+}
+
+TEST(AdaptiveMutex, TryLock)
+{
+  cen::adaptive_mutex mutex;
+
+  ASSERT_EQ(cen::lock_status::success, mutex.try_lock());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+
+  ASSERT_TRUE(mutex.unlock());
+  ASSERT_EQ(cen::lock_status::success, mutex.try_lock());
+  ASSERT_TRUE(mutex.unlock());
+}
+
+TEST(AdaptiveMutex, Locks)
+{
+  cen::adaptive_mutex mutex;
+
+  {
+    cen::scoped_lock lock{mutex};
+
+    cen::try_lock other{mutex};
+    ASSERT_TRUE(other.timed_out());
+  }
+
+  cen::try_lock lock{mutex};
+  ASSERT_TRUE(lock.success());
+}
+
+TEST(AdaptiveMutex, Contention)
+{
+  cen::adaptive_mutex mutex;
+  int counter = 0;
+
+  std::vector<std::thread> threads;
+  for (auto index = 0; index < 4; ++index) {
+    threads.emplace_back([&] {
+      for (auto iteration = 0; iteration < 20'000; ++iteration) {
+        cen::scoped_lock lock{mutex};
+        ++counter;
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(80'000, counter);
+}
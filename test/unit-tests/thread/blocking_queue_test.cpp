@@ -0,0 +1,71 @@
+#include "thread/blocking_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>       // string
+#include <thread>       // thread
+#include <type_traits>  // is_copy_constructible_v, is_copy_assignable_v
+#include <vector>       // vector
+
+static_assert(!std::is_copy_constructible_v<cen::blocking_queue<int>>);
+static_assert(!std::is_copy_assignable_v<cen::blocking_queue<int>>);
+
+TEST(BlockingQueue, TryPushAndTryPop)
+{
+  cen::blocking_queue<std::string> queue{2};
+  ASSERT_EQ(2u, queue.capacity());
+  ASSERT_FALSE(queue.try_pop());
+
+  ASSERT_TRUE(queue.try_push("foo"));
+  ASSERT_TRUE(queue.emplace(3u, 'a'));
+  ASSERT_FALSE(queue.try_push("bar"));
+  ASSERT_EQ(2u, queue.size());
+
+  ASSERT_EQ("foo", queue.try_pop());
+  ASSERT_EQ("aaa", queue.pop());
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(BlockingQueue, PopTimeout)
+{
+  using ms = cen::milliseconds<cen::u32>;
+
+  cen::blocking_queue<int> queue{4};
+  ASSERT_FALSE(queue.pop(ms{1}));
+
+  ASSERT_TRUE(queue.push(12));
+  ASSERT_EQ(12, queue.pop(ms{1}));
+}
+
+TEST(BlockingQueue, ProducersAndConsumers)
+{
+  constexpr int count = 10'000;
+
+  // The small capacity makes the producers block
+  cen::blocking_queue<int> queue{4};
+  std::vector<std::thread> threads;
+  std::vector<long long> sums(2);
+
+  for (auto index = 0; index < 2; ++index) {
+    threads.emplace_back([&] {
+      for (auto value = 1; value <= count; ++value) {
+        ASSERT_TRUE(queue.push(value));
+      }
+    });
+  }
+
+  for (auto index = 0; index < 2; ++index) {
+    threads.emplace_back([&, index] {
+      for (auto popped = 0; popped < count; ++popped) {
+        sums[index] += queue.pop().value();
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(count * (count + 1LL), sums[0] + sums[1]);
+  ASSERT_TRUE(queue.empty());
+}
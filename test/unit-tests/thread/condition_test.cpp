@@ -39,3 +39,21 @@ TEST(Condition, Wait)
   ASSERT_TRUE(cond.wait(mutex));
   ASSERT_TRUE(mutex.unlock());
 }
+
+TEST(Condition, WaitDeadline)
+{
+  cen::mutex mutex;
+  cen::condition cond;
+
+  ASSERT_TRUE(mutex.lock());
+
+  // Without a signal, the wait loop only ends once the deadline has expired
+  const auto until = cen::deadline::after(cen::microseconds<cen::u32>{3'000});
+  while (cond.wait(mutex, until) == cen::lock_status::success) {
+  }
+
+  ASSERT_TRUE(until.expired());
+  ASSERT_EQ(cond.wait(mutex, cen::microseconds<cen::u32>{0}), cen::lock_status::timed_out);
+
+  ASSERT_TRUE(mutex.unlock());
+}
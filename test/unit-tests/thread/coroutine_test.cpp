@@ -0,0 +1,162 @@
+#include "thread/coroutine.hpp"
+
+#if CENTURION_HAS_FEATURE_COROUTINES
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>    // runtime_error
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+static_assert(!std::is_copy_constructible_v<cen::coroutine>);
+static_assert(!std::is_copy_constructible_v<cen::coroutine_scheduler>);
+
+namespace {
+
+auto count_frames(int& frames, const int total) -> cen::coroutine
+{
+  for (auto i = 0; i < total; ++i) {
+    ++frames;
+    co_await cen::next_frame();
+  }
+}
+
+auto wait_ms(std::vector<int>& order, const int id, const cen::u32 ms) -> cen::coroutine
+{
+  co_await cen::delay(cen::milliseconds<cen::u32>{ms});
+  order.push_back(id);
+}
+
+auto sequence(std::vector<int>& order) -> cen::coroutine
+{
+  order.push_back(0);
+  co_await wait_ms(order, 1, 10);
+  co_await wait_ms(order, 2, 0);
+  order.push_back(3);
+}
+
+auto fail_later() -> cen::coroutine
+{
+  co_await cen::next_frame();
+  throw std::runtime_error{"Oops"};
+}
+
+auto catch_child(bool& caught) -> cen::coroutine
+{
+  try {
+    co_await fail_later();
+  }
+  catch (const std::runtime_error&) {
+    caught = true;
+  }
+}
+
+}  // namespace
+
+TEST(Coroutine, NextFrame)
+{
+  cen::coroutine_scheduler scheduler;
+  ASSERT_TRUE(scheduler.empty());
+
+  int frames = 0;
+  scheduler.spawn(count_frames(frames, 3));
+
+  // The coroutine runs until its first suspension when it is spawned
+  ASSERT_EQ(1, frames);
+  ASSERT_EQ(1u, scheduler.size());
+
+  scheduler.update();
+  ASSERT_EQ(2, frames);
+
+  scheduler.update();
+  scheduler.update();
+  ASSERT_EQ(3, frames);
+  ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Delay)
+{
+  cen::coroutine_scheduler scheduler;
+
+  std::vector<int> order;
+  scheduler.spawn(wait_ms(order, 2, 30));
+  scheduler.spawn(wait_ms(order, 1, 10));
+
+  scheduler.update(cen::milliseconds<cen::u32>{5});
+  ASSERT_TRUE(order.empty());
+
+  scheduler.update(cen::milliseconds<cen::u32>{5});
+  ASSERT_EQ(std::vector<int>{1}, order);
+
+  scheduler.update(cen::milliseconds<cen::u32>{25});
+  ASSERT_EQ((std::vector<int>{1, 2}), order);
+  ASSERT_EQ(35u, scheduler.now().count());
+}
+
+TEST(Coroutine, WaitUntil)
+{
+  cen::coroutine_scheduler scheduler;
+
+  bool loaded = false;
+  bool resumed = false;
+  scheduler.spawn([](bool& loaded, bool& resumed) -> cen::coroutine {
+    co_await cen::wait_until([&] { return loaded; });
+    resumed = true;
+  }(loaded, resumed));
+
+  scheduler.update();
+  ASSERT_FALSE(resumed);
+
+  loaded = true;
+  scheduler.update();
+  ASSERT_TRUE(resumed);
+  ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Nested)
+{
+  cen::coroutine_scheduler scheduler;
+
+  std::vector<int> order;
+  scheduler.spawn(sequence(order));
+  ASSERT_EQ(std::vector<int>{0}, order);
+
+  scheduler.update(cen::milliseconds<cen::u32>{10});
+  ASSERT_EQ((std::vector<int>{0, 1}), order);
+
+  scheduler.update();
+  ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), order);
+  ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Exceptions)
+{
+  cen::coroutine_scheduler scheduler;
+
+  bool caught = false;
+  scheduler.spawn(catch_child(caught));
+  scheduler.update();
+  ASSERT_TRUE(caught);
+
+  scheduler.spawn(fail_later());
+  ASSERT_THROW(scheduler.update(), std::runtime_error);
+  ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Clear)
+{
+  cen::coroutine_scheduler scheduler;
+
+  int frames = 0;
+  scheduler.spawn(count_frames(frames, 10));
+  scheduler.spawn(count_frames(frames, 10));
+  ASSERT_EQ(2u, scheduler.size());
+
+  scheduler.clear();
+  ASSERT_TRUE(scheduler.empty());
+
+  scheduler.update();
+  ASSERT_EQ(2, frames);
+}
+
+#endif  // CENTURION_HAS_FEATURE_COROUTINES
@@ -0,0 +1,55 @@
+#include "thread/deadline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>  // milliseconds, seconds
+
+TEST(Deadline, After)
+{
+  const auto now = cen::counter::now();
+  const auto until = cen::deadline::after(std::chrono::milliseconds{50});
+
+  ASSERT_GE(until.ticks(), now + cen::counter::frequency() / 20);
+  ASSERT_FALSE(until.expired());
+
+  const auto remaining = until.remaining();
+  ASSERT_GT(remaining.count(), 0u);
+  ASSERT_LE(remaining.count(), 50'000'000u);
+}
+
+TEST(Deadline, Negative)
+{
+  const auto until = cen::deadline::after(std::chrono::seconds{-1});
+  ASSERT_TRUE(until.expired());
+  ASSERT_EQ(0u, until.remaining().count());
+}
+
+TEST(Deadline, Ticks)
+{
+  const cen::deadline until{42};
+  ASSERT_EQ(42u, until.ticks());
+  ASSERT_TRUE(until.expired());
+}
+
+TEST(Deadline, CounterTicks)
+{
+  using ns = cen::deadline::duration_type;
+  const auto frequency = cen::counter::frequency();
+
+  ASSERT_EQ(frequency, cen::deadline::to_counter_ticks(ns{1'000'000'000}));
+  ASSERT_EQ(frequency / 2, cen::deadline::to_counter_ticks(ns{500'000'000}));
+
+  ASSERT_EQ(1'000'000'000u, cen::deadline::from_counter_ticks(frequency).count());
+  ASSERT_EQ(0u, cen::deadline::from_counter_ticks(0).count());
+}
+
+TEST(Deadline, SleepUntil)
+{
+  const auto until = cen::deadline::after(std::chrono::milliseconds{5});
+
+  cen::sleep_until(until);
+  ASSERT_TRUE(until.expired());
+
+  // Expired deadlines return immediately
+  cen::sleep_until(cen::deadline{0});
+}
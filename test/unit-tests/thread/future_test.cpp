@@ -0,0 +1,149 @@
+#include "thread/future.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>       // atomic
+#include <exception>    // make_exception_ptr
+#include <memory>       // unique_ptr, make_unique
+#include <stdexcept>    // runtime_error
+#include <string>       // string
+#include <type_traits>  // is_copy_constructible_v, is_same_v
+#include <utility>      // move
+#include <vector>       // vector
+
+static_assert(!std::is_copy_constructible_v<cen::future<int>>);
+static_assert(!std::is_copy_constructible_v<cen::promise<int>>);
+
+TEST(Future, Async)
+{
+  cen::task_scheduler scheduler{2};
+
+  auto answer = cen::async(scheduler, [] { return 42; });
+  ASSERT_TRUE(answer.valid());
+  ASSERT_EQ(42, answer.get());
+  ASSERT_FALSE(answer.valid());
+
+  std::atomic<bool> ran{false};
+  auto done = cen::async(scheduler, [&ran] { ran = true; });
+  static_assert(std::is_same_v<decltype(done), cen::future<void>>);
+
+  done.get();
+  ASSERT_TRUE(ran.load());
+
+  // Move-only results are moved out of the future
+  auto owned = cen::async(scheduler, [] { return std::make_unique<int>(7); });
+  ASSERT_EQ(7, *owned.get());
+}
+
+TEST(Future, ManyTasks)
+{
+  cen::task_scheduler scheduler{3};
+
+  std::vector<cen::future<int>> futures;
+  for (auto index = 0; index < 1'000; ++index) {
+    futures.push_back(cen::async(scheduler, [index] { return index * 2; }));
+  }
+
+  long long sum = 0;
+  for (auto& future : futures) {
+    sum += future.get();
+  }
+
+  ASSERT_EQ(999'000, sum);
+}
+
+TEST(Future, ThenOnScheduler)
+{
+  cen::task_scheduler scheduler{2};
+
+  auto text = cen::async(scheduler, [] { return 21; })
+                  .then(scheduler, [](const int value) { return value * 2; })
+                  .then(scheduler, [](const int value) { return std::to_string(value); });
+
+  ASSERT_EQ("42", text.get());
+
+  // A continuation attached after the result is available runs as well
+  auto ready = cen::async(scheduler, [] { return 1; });
+  ready.wait();
+  ASSERT_TRUE(ready.ready());
+
+  ASSERT_EQ(2, ready.then(scheduler, [](const int value) { return value + 1; }).get());
+}
+
+TEST(Future, ThenOnMainThread)
+{
+  cen::task_scheduler scheduler{2};
+  cen::main_thread_queue queue;
+
+  const auto mainThread = cen::thread::current_id();
+  std::atomic<bool> onMainThread{false};
+
+  auto result = cen::async(scheduler, [] { return std::string{"level"}; })
+                    .then(queue, [&](std::string name) {
+                      onMainThread = cen::thread::current_id() == mainThread;
+                      return name + ".tmx";
+                    });
+
+  while (!result.ready()) {
+    queue.drain();
+  }
+
+  ASSERT_TRUE(onMainThread.load());
+  ASSERT_EQ("level.tmx", result.get());
+  ASSERT_EQ(0u, queue.pending());
+}
+
+TEST(Future, Promise)
+{
+  cen::main_thread_queue queue;
+
+  cen::promise<int> promise;
+  auto future = promise.get_future();
+  ASSERT_FALSE(future.ready());
+
+  int seen = 0;
+  auto next = std::move(future).then(queue, [&seen](const int value) { seen = value; });
+
+  promise.set_value(99);
+  ASSERT_EQ(1u, queue.drain());
+
+  ASSERT_EQ(99, seen);
+  ASSERT_TRUE(next.ready());
+  next.get();
+}
+
+TEST(Future, BrokenPromise)
+{
+  cen::main_thread_queue queue;
+  cen::future<int> future;
+  cen::future<void> next;
+
+  {
+    cen::promise<int> promise;
+    future = promise.get_future();
+
+    cen::promise<int> other;
+    next = other.get_future().then(queue, [](int) {});
+  }
+
+  ASSERT_TRUE(future.ready());
+  ASSERT_THROW(future.get(), cen::cen_error);
+
+  queue.drain();
+  ASSERT_TRUE(next.ready());
+  ASSERT_THROW(next.get(), cen::cen_error);
+}
+
+TEST(Future, PromiseException)
+{
+  cen::main_thread_queue queue;
+
+  cen::promise<int> promise;
+  auto next = promise.get_future().then(queue, [](int) {});
+
+  promise.set_exception(std::make_exception_ptr(std::runtime_error{"upload failed"}));
+
+  queue.drain();
+  ASSERT_TRUE(next.ready());
+  ASSERT_THROW(next.get(), std::runtime_error);
+}
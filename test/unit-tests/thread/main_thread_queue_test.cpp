@@ -0,0 +1,97 @@
+#include "thread/main_thread_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>       // milliseconds
+#include <memory>       // shared_ptr, make_shared
+#include <thread>       // thread, sleep_for
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+static_assert(!std::is_copy_constructible_v<cen::main_thread_queue>);
+
+TEST(MainThreadQueue, Drain)
+{
+  cen::main_thread_queue queue;
+  ASSERT_EQ(0u, queue.drain());
+
+  std::vector<int> order;
+  queue.submit([&] { order.push_back(1); });
+  queue.submit([&] {
+    order.push_back(2);
+    queue.submit([&] { order.push_back(3); });  // Deferred to the next drain
+  });
+
+  ASSERT_EQ(2u, queue.pending());
+  ASSERT_EQ(2u, queue.drain());
+  ASSERT_EQ((std::vector<int>{1, 2}), order);
+
+  ASSERT_EQ(1u, queue.drain());
+  ASSERT_EQ((std::vector<int>{1, 2, 3}), order);
+}
+
+TEST(MainThreadQueue, SubmitFromOtherThreads)
+{
+  cen::main_thread_queue queue;
+  int sum = 0;
+
+  std::vector<std::thread> threads;
+  for (auto index = 0; index < 4; ++index) {
+    threads.emplace_back([&] {
+      for (auto task = 0; task < 100; ++task) {
+        queue.submit([&sum] { ++sum; });  // Only the draining thread modifies the sum
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(400u, queue.drain());
+  ASSERT_EQ(400, sum);
+}
+
+TEST(MainThreadQueue, RunPendingWithBudget)
+{
+  cen::main_thread_queue queue;
+  ASSERT_EQ(cen::main_thread_queue::budget_type::zero(), queue.budget());
+
+  std::vector<int> order;
+  for (auto index = 0; index < 3; ++index) {
+    queue.submit([&order, index] {
+      order.push_back(index);
+      std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    });
+  }
+
+  // At least one task is executed, even if it exceeds the budget
+  const cen::main_thread_queue::budget_type budget{500};
+  ASSERT_EQ(1u, queue.run_pending(budget));
+  ASSERT_EQ(2u, queue.pending());
+
+  // Remaining tasks are executed before tasks that were submitted later
+  queue.submit([&order] { order.push_back(3); });
+  ASSERT_EQ(1u, queue.run_pending(budget));
+  ASSERT_EQ(2u, queue.run_pending());
+  ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), order);
+  ASSERT_EQ(0u, queue.pending());
+
+  queue.set_budget(budget);
+  ASSERT_EQ(budget, queue.budget());
+}
+
+TEST(MainThreadQueue, DestroysPendingTasks)
+{
+  auto counter = std::make_shared<int>(0);
+
+  {
+    cen::main_thread_queue queue;
+    queue.submit([counter] { ++*counter; });
+    queue.submit([counter] { ++*counter; });
+    ASSERT_EQ(3, counter.use_count());
+  }
+
+  ASSERT_EQ(1, counter.use_count());
+  ASSERT_EQ(0, *counter);
+}
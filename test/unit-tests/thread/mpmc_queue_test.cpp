@@ -0,0 +1,90 @@
+#include "thread/mpmc_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>       // atomic
+#include <memory>       // shared_ptr, make_shared
+#include <thread>       // thread
+#include <type_traits>  // is_copy_constructible_v, is_copy_assignable_v
+#include <vector>       // vector
+
+static_assert(!std::is_copy_constructible_v<cen::mpmc_queue<int>>);
+static_assert(!std::is_copy_assignable_v<cen::mpmc_queue<int>>);
+
+TEST(MPMCQueue, PushAndPop)
+{
+  cen::mpmc_queue<int> queue{3};
+  ASSERT_EQ(4u, queue.capacity());
+  ASSERT_TRUE(queue.empty());
+  ASSERT_FALSE(queue.try_pop());
+
+  for (auto lap = 0; lap < 3; ++lap) {
+    for (auto value = 0; value < 4; ++value) {
+      ASSERT_TRUE(queue.try_push(value));
+    }
+
+    ASSERT_FALSE(queue.try_push(4));
+    ASSERT_EQ(4u, queue.size());
+
+    for (auto value = 0; value < 4; ++value) {
+      ASSERT_EQ(value, queue.try_pop());
+    }
+
+    ASSERT_FALSE(queue.try_pop());
+  }
+}
+
+TEST(MPMCQueue, DestroysRemainingElements)
+{
+  auto element = std::make_shared<int>(7);
+
+  {
+    cen::mpmc_queue<std::shared_ptr<int>> queue{4};
+    ASSERT_TRUE(queue.try_emplace(element));
+    ASSERT_EQ(2, element.use_count());
+  }
+
+  ASSERT_EQ(1, element.use_count());
+}
+
+TEST(MPMCQueue, ProducersAndConsumers)
+{
+  constexpr int producers = 3;
+  constexpr int consumers = 3;
+  constexpr int count = 20'000;
+
+  cen::mpmc_queue<int> queue{128};
+  std::atomic<long long> sum{0};
+  std::atomic<int> consumed{0};
+
+  std::vector<std::thread> threads;
+
+  for (auto index = 0; index < producers; ++index) {
+    threads.emplace_back([&] {
+      for (auto value = 1; value <= count; ++value) {
+        while (!queue.try_push(value)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (auto index = 0; index < consumers; ++index) {
+    threads.emplace_back([&] {
+      while (consumed.load() < producers * count) {
+        if (const auto value = queue.try_pop()) {
+          sum += *value;
+          ++consumed;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(producers * count, consumed.load());
+  ASSERT_EQ(producers * (count * (count + 1LL) / 2), sum.load());
+  ASSERT_TRUE(queue.empty());
+}
@@ -25,6 +25,38 @@ TEST(Semaphore, AcquireMilliseconds)
   ASSERT_EQ(semaphore.acquire(ms{1}), cen::lock_status::success);
 }
 
+TEST(Semaphore, AcquireMicroseconds)
+{
+  using us = cen::microseconds<cen::u32>;
+
+  cen::semaphore semaphore{0u};
+
+  const auto start = cen::counter::now();
+  ASSERT_EQ(semaphore.acquire(us{2'500}), cen::lock_status::timed_out);
+
+  // The wait lasts at least as long as the timeout
+  const auto elapsed = cen::counter::now() - start;
+  ASSERT_GE(elapsed * 1'000'000 / cen::counter::frequency(), 2'500u);
+
+  ASSERT_TRUE(semaphore.release());
+  ASSERT_EQ(semaphore.acquire(us{100}), cen::lock_status::success);
+}
+
+TEST(Semaphore, AcquireDeadline)
+{
+  cen::semaphore semaphore{0u};
+
+  const cen::deadline expired{cen::counter::now()};
+  ASSERT_EQ(semaphore.acquire(expired), cen::lock_status::timed_out);
+
+  ASSERT_TRUE(semaphore.release());
+  ASSERT_EQ(semaphore.acquire(expired), cen::lock_status::success);
+
+  const auto later = cen::deadline::after(cen::milliseconds<cen::u32>{5});
+  ASSERT_EQ(semaphore.acquire(later), cen::lock_status::timed_out);
+  ASSERT_TRUE(later.expired());
+}
+
 TEST(Semaphore, TryAcquire)
 {
   cen::semaphore semaphore{0u};
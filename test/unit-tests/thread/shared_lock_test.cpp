@@ -0,0 +1,23 @@
+#include "thread/shared_lock.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+static_assert(!std::is_copy_constructible_v<cen::shared_lock>);
+static_assert(!std::is_copy_assignable_v<cen::shared_lock>);
+
+TEST(SharedLock, Construction)
+{
+  cen::shared_mutex mutex;
+
+  {
+    cen::shared_lock first{mutex};
+    cen::shared_lock second{mutex};
+
+    ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+  }
+
+  ASSERT_EQ(cen::lock_status::success, mutex.try_lock());
+  ASSERT_TRUE(mutex.unlock());
+}
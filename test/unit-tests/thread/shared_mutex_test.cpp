@@ -0,0 +1,81 @@
+#include "thread/shared_mutex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>       // atomic
+#include <thread>       // thread
+#include <type_traits>  // is_copy_constructible_v, is_copy_assignable_v
+#include <vector>       // vector
+
+#include "thread/scoped_lock.hpp"
+#include "thread/shared_lock.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::shared_mutex>);
+static_assert(!std::is_copy_assignable_v<cen::shared_mutex>);
+
+TEST(SharedMutex, ExclusiveLocking)
+{
+  cen::shared_mutex mutex;
+
+  ASSERT_TRUE(mutex.lock());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock_shared());
+  ASSERT_TRUE(mutex.unlock());
+
+  ASSERT_EQ(cen::lock_status::success, mutex.try_lock());
+  ASSERT_TRUE(mutex.unlock());
+}
+
+TEST(SharedMutex, SharedLocking)
+{
+  cen::shared_mutex mutex;
+
+  ASSERT_TRUE(mutex.lock_shared());
+  ASSERT_EQ(cen::lock_status::success, mutex.try_lock_shared());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+
+  ASSERT_TRUE(mutex.unlock_shared());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+
+  ASSERT_TRUE(mutex.unlock_shared());
+  ASSERT_EQ(cen::lock_status::success, mutex.try_lock());
+  ASSERT_TRUE(mutex.unlock());
+}
+
+TEST(SharedMutex, ReadersAndWriters)
+{
+  cen::shared_mutex mutex;
+  int first = 0;
+  int second = 0;
+  std::atomic<int> torn{0};
+
+  std::vector<std::thread> threads;
+  for (auto index = 0; index < 2; ++index) {
+    threads.emplace_back([&] {
+      for (auto iteration = 0; iteration < 10'000; ++iteration) {
+        cen::scoped_lock lock{mutex};
+        ++first;
+        ++second;
+      }
+    });
+  }
+
+  for (auto index = 0; index < 4; ++index) {
+    threads.emplace_back([&] {
+      for (auto iteration = 0; iteration < 10'000; ++iteration) {
+        cen::shared_lock lock{mutex};
+        if (first != second) {
+          ++torn;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(20'000, first);
+  ASSERT_EQ(20'000, second);
+  ASSERT_EQ(0, torn.load());
+}
@@ -0,0 +1,81 @@
+#include "thread/spsc_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr, make_unique
+#include <thread>       // thread
+#include <type_traits>  // is_copy_constructible_v, is_copy_assignable_v
+
+static_assert(!std::is_copy_constructible_v<cen::spsc_queue<int>>);
+static_assert(!std::is_copy_assignable_v<cen::spsc_queue<int>>);
+
+TEST(SPSCQueue, Capacity)
+{
+  ASSERT_EQ(2u, cen::spsc_queue<int>{0}.capacity());
+  ASSERT_EQ(8u, cen::spsc_queue<int>{8}.capacity());
+  ASSERT_EQ(16u, cen::spsc_queue<int>{9}.capacity());
+}
+
+TEST(SPSCQueue, PushAndPop)
+{
+  cen::spsc_queue<int> queue{4};
+  ASSERT_TRUE(queue.empty());
+  ASSERT_FALSE(queue.try_pop());
+
+  for (auto value = 0; value < 4; ++value) {
+    ASSERT_TRUE(queue.try_push(value));
+  }
+
+  ASSERT_FALSE(queue.try_push(4));
+  ASSERT_EQ(4u, queue.size());
+
+  for (auto value = 0; value < 4; ++value) {
+    ASSERT_EQ(value, queue.try_pop());
+  }
+
+  ASSERT_TRUE(queue.empty());
+
+  // Wraps around the ring
+  ASSERT_TRUE(queue.try_emplace(42));
+  ASSERT_EQ(42, queue.try_pop());
+}
+
+TEST(SPSCQueue, DestroysRemainingElements)
+{
+  auto element = std::make_shared<int>(7);
+
+  {
+    cen::spsc_queue<std::shared_ptr<int>> queue{4};
+    ASSERT_TRUE(queue.try_push(element));
+    ASSERT_TRUE(queue.try_push(element));
+    ASSERT_EQ(3, element.use_count());
+  }
+
+  ASSERT_EQ(1, element.use_count());
+}
+
+TEST(SPSCQueue, ProducerAndConsumer)
+{
+  constexpr int count = 100'000;
+  cen::spsc_queue<std::unique_ptr<int>> queue{64};
+
+  std::thread producer{[&] {
+    for (auto value = 0; value < count; ++value) {
+      auto element = std::make_unique<int>(value);
+      while (!queue.try_push(std::move(element))) {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  auto expected = 0;
+  while (expected < count) {
+    if (auto element = queue.try_pop()) {
+      ASSERT_EQ(expected, **element);
+      ++expected;
+    }
+  }
+
+  producer.join();
+  ASSERT_TRUE(queue.empty());
+}
@@ -0,0 +1,106 @@
+#include "thread/task_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>       // atomic
+#include <numeric>      // iota
+#include <type_traits>  // is_final_v
+#include <vector>       // vector
+
+static_assert(std::is_final_v<cen::task_scheduler>);
+static_assert(std::is_final_v<cen::task_group>);
+
+static_assert(!std::is_copy_constructible_v<cen::task_scheduler>);
+static_assert(!std::is_copy_assignable_v<cen::task_scheduler>);
+
+static_assert(!std::is_copy_constructible_v<cen::task_group>);
+static_assert(!std::is_copy_assignable_v<cen::task_group>);
+
+TEST(TaskScheduler, Defaults)
+{
+  const cen::task_scheduler scheduler;
+  ASSERT_EQ(cen::task_scheduler::default_worker_count(), scheduler.worker_count());
+  ASSERT_GE(scheduler.worker_count(), 1u);
+  ASSERT_EQ(0u, scheduler.pending());
+}
+
+TEST(TaskScheduler, Submit)
+{
+  std::atomic<int> count{};
+
+  {
+    cen::task_scheduler scheduler{3};
+    for (auto index = 0; index < 1'000; ++index) {
+      scheduler.submit([&count] { ++count; });
+    }
+
+    scheduler.wait();
+    ASSERT_EQ(1'000, count.load());
+    ASSERT_EQ(0u, scheduler.pending());
+
+    // Remaining tasks are executed before the scheduler is destroyed
+    scheduler.submit([&count] { ++count; });
+  }
+
+  ASSERT_EQ(1'001, count.load());
+}
+
+TEST(TaskScheduler, GroupsAndContinuations)
+{
+  cen::task_scheduler scheduler{2};
+
+  std::atomic<int> count{};
+  std::atomic<int> seen{};
+
+  cen::task_group group;
+  ASSERT_TRUE(group.done());
+
+  for (auto index = 0; index < 100; ++index) {
+    scheduler.submit(group, [&] {
+      // Nested tasks are added to the group from a worker
+      scheduler.submit(group, [&count] { ++count; });
+      ++count;
+    });
+  }
+
+  scheduler.then(group, [&] { seen = count.load(); });
+
+  scheduler.wait(group);
+  ASSERT_TRUE(group.done());
+  ASSERT_EQ(200, count.load());
+
+  scheduler.wait();
+  ASSERT_EQ(200, seen.load());
+
+  // Continuations of finished groups are submitted immediately
+  scheduler.then(group, [&seen] { seen = -1; });
+  scheduler.wait();
+  ASSERT_EQ(-1, seen.load());
+}
+
+TEST(TaskScheduler, ParallelFor)
+{
+  cen::task_scheduler scheduler{4};
+
+  std::vector<int> values(10'007);
+  std::iota(values.begin(), values.end(), 0);
+
+  scheduler.parallel_for(0, values.size(), [&](const cen::usize index) {
+    values[index] *= 2;
+  });
+
+  for (cen::usize index = 0; index < values.size(); ++index) {
+    ASSERT_EQ(static_cast<int>(index) * 2, values[index]);
+  }
+
+  // Nested loops execute on the workers without deadlocking
+  std::atomic<int> count{};
+  scheduler.parallel_for(0, 8, [&](cen::usize) {
+    scheduler.parallel_for(0, 100, [&](cen::usize) { ++count; }, 10);
+  });
+
+  ASSERT_EQ(800, count.load());
+
+  scheduler.parallel_for(5, 5, [&](cen::usize) { ++count; });
+  ASSERT_EQ(800, count.load());
+}
@@ -0,0 +1,171 @@
+#include "thread/thread_registry.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>  // atomic
+#include <string>  // string
+
+#include "thread/task_scheduler.hpp"
+#include "thread/thread.hpp"
+
+namespace {
+
+inline std::atomic<bool> release{false};
+inline std::atomic<int> hooked{0};
+
+auto wait_for_release(void*) -> int
+{
+  cen::thread::set_priority(cen::thread_priority::low);
+
+  while (!release) {
+    cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+  }
+
+  return 0;
+}
+
+}  // namespace
+
+TEST(ThreadRegistry, RegistersThreads)
+{
+  release = false;
+  cen::thread thread{wait_for_release, "registered"};
+
+  // The thread has registered itself once the constructor returns
+  const auto info = cen::thread_registry::find(thread.get_id());
+  ASSERT_TRUE(info);
+  ASSERT_EQ("registered", info->name);
+  ASSERT_EQ(thread.get_id(), info->id);
+
+  const auto id = thread.get_id();
+  release = true;
+  thread.join();
+
+  ASSERT_FALSE(cen::thread_registry::find(id));
+}
+
+TEST(ThreadRegistry, AddAndRemoveCurrent)
+{
+  const auto before = cen::thread_registry::count();
+
+  cen::thread_registry::add_current("main");
+  cen::thread_registry::add_current("renamed");  // Only updates the name
+  ASSERT_EQ(before + 1, cen::thread_registry::count());
+
+  ASSERT_TRUE(cen::thread::set_priority(cen::thread_priority::high));
+
+  const auto info = cen::thread_registry::find(cen::thread::current_id());
+  ASSERT_TRUE(info);
+  ASSERT_EQ("renamed", info->name);
+  ASSERT_EQ(cen::thread_priority::high, info->priority);
+
+  const auto snapshot = cen::thread_registry::snapshot();
+  ASSERT_EQ(before + 1, snapshot.size());
+  ASSERT_EQ("renamed", snapshot.back().name);
+
+  cen::thread_registry::remove_current();
+  cen::thread_registry::remove_current();  // Has no effect
+  ASSERT_EQ(before, cen::thread_registry::count());
+}
+
+TEST(ThreadRegistry, LongNames)
+{
+  const std::string name(cen::thread_registry::max_name_length + 10, 'x');
+  cen::thread_registry::add_current(name.c_str());
+
+  const auto info = cen::thread_registry::find(cen::thread::current_id());
+  ASSERT_TRUE(info);
+  ASSERT_EQ(name.substr(0, cen::thread_registry::max_name_length), info->name);
+
+  cen::thread_registry::remove_current();
+}
+
+TEST(ThreadRegistry, RemovedOnExit)
+{
+  const auto before = cen::thread_registry::count();
+
+  // Threads that exit while registered are removed automatically
+  auto* thread = SDL_CreateThread(
+      [](void*) {
+        cen::thread_registry::add_current("forgetful");
+        return 0;
+      },
+      "forgetful",
+      nullptr);
+  ASSERT_TRUE(thread);
+
+  SDL_WaitThread(thread, nullptr);
+  ASSERT_EQ(before, cen::thread_registry::count());
+}
+
+TEST(ThreadRegistry, Sample)
+{
+  cen::thread_registry::add_current("main");
+  cen::thread_registry::sample();
+
+  volatile cen::u64 sum = 0;
+  for (cen::u64 index = 0; index < 20'000'000; ++index) {
+    sum = sum + index;
+  }
+
+  cen::thread_registry::sample();
+
+  const auto info = cen::thread_registry::find(cen::thread::current_id());
+  ASSERT_TRUE(info);
+
+#if defined(__linux__) || defined(_WIN32)
+  ASSERT_GT(info->cpuTime.count(), 0u);
+  ASSERT_GT(info->usage, 0.0);
+#endif  // defined(__linux__) || defined(_WIN32)
+
+  cen::thread_registry::remove_current();
+}
+
+TEST(ThreadRegistry, StartHook)
+{
+  hooked = 0;
+  cen::thread_registry::set_start_hook([](const cen::thread_info& info) {
+    if (info.name == "hooked") {
+      ++hooked;
+    }
+  });
+
+  {
+    cen::thread thread{[](void*) { return 0; }, "hooked"};
+  }
+
+  cen::thread_registry::set_start_hook(nullptr);
+  ASSERT_EQ(1, hooked.load());
+}
+
+TEST(ThreadRegistry, TaskSchedulerWorkers)
+{
+  cen::task_scheduler scheduler{2};
+
+  cen::task_group group;
+  for (auto index = 0; index < 64; ++index) {
+    scheduler.submit(group, [] {});
+  }
+
+  scheduler.wait(group);
+
+  cen::u64 tasks = 0;
+  int workers = 0;
+
+  // The workers register themselves once they start
+  while (workers != 2) {
+    cen::thread_registry::sample();
+
+    tasks = 0;
+    workers = 0;
+
+    for (const auto& info : cen::thread_registry::snapshot()) {
+      if (info.name.rfind("task ", 0) == 0) {
+        tasks += info.tasks;
+        ++workers;
+      }
+    }
+  }
+
+  ASSERT_LE(tasks, 64u);  // The waiting thread may have executed some of the tasks
+}
@@ -2,7 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <iostream>
+#include <string>
 #include <type_traits>
 
 #include "core/log.hpp"
@@ -23,6 +25,19 @@ static_assert(std::is_same_v<cen::thread::task_type, SDL_ThreadFunction>);
 static_assert(!std::is_copy_constructible_v<cen::thread>);
 static_assert(!std::is_copy_assignable_v<cen::thread>);
 
+TEST(Thread, AttributesConstructor)
+{
+  cen::thread_attributes attributes;
+  attributes.stackSize = 256 * 1'024;
+  attributes.priority = cen::thread_priority::low;
+  attributes.affinity = 0b1;
+
+  cen::thread thread{dummy, attributes, "attributed"};
+  ASSERT_TRUE(thread.joinable());
+  ASSERT_EQ(thread.name(), "attributed");
+  ASSERT_EQ(thread.join(), 0);
+}
+
 TEST(Thread, Detach)
 {
   cen::thread thread{dummy};
@@ -125,6 +140,11 @@ TEST(Thread, SetPriority)
   ASSERT_TRUE(cen::thread::set_priority(cen::thread_priority::low));
 }
 
+TEST(Thread, SetAffinity)
+{
+  ASSERT_FALSE(cen::thread::set_affinity(0));
+}
+
 TEST(Thread, CurrentId)
 {
   ASSERT_EQ(cen::thread::current_id(), SDL_ThreadID());
@@ -164,6 +184,58 @@ TEST(Thread, Init)
     ASSERT_TRUE(thread.joinable());
     ASSERT_EQ(123, thread.join());
   }
+
+  {  // With attributes
+    cen::thread_attributes attributes;
+    attributes.priority = cen::thread_priority::low;
+
+    auto thread = cen::thread::init([] { return 7; }, attributes);
+    ASSERT_EQ(7, thread.join());
+
+    int i = 321;
+    auto other = cen::thread::init([](int* data) { return *data; }, attributes, &i);
+    ASSERT_EQ(321, other.join());
+  }
+}
+
+TEST(Thread, InitStateful)
+{
+  {  // Captured state and returns integer
+    const int base = 40;
+    const std::string text = "stateful";
+
+    auto thread = cen::thread::init([base, text] { return base + text.size() - 6; });
+    ASSERT_TRUE(thread.joinable());
+    ASSERT_EQ(42, thread.join());
+  }
+
+  {  // Lvalue callable
+    int result = 0;
+    const auto task = [&result] { result = 123; };
+
+    auto thread = cen::thread::init(task, "stateful");
+    ASSERT_EQ("stateful", thread.name());
+    ASSERT_EQ(0, thread.join());
+    ASSERT_EQ(123, result);
+  }
+
+  {  // Detached before the callable finishes
+    std::atomic<int> counter{0};
+
+    {
+      auto thread = cen::thread::init([&counter, value = std::string(100, 'x')] {
+        cen::thread::sleep(cen::milliseconds<cen::u32>{5});
+        counter += static_cast<int>(value.size());
+      });
+      thread.detach();
+    }
+
+    while (counter.load() == 0) {
+      cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+    }
+
+    ASSERT_EQ(100, counter.load());
+  }
 }
 
 #endif  // CENTURION_HAS_FEATURE_CONCEPTS
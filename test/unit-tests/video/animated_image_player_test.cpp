@@ -0,0 +1,85 @@
+#include "video/animated_image_player.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_final_v
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+#if (SDL_IMAGE_MAJOR_VERSION > 2) || \
+    ((SDL_IMAGE_MAJOR_VERSION == 2) && (SDL_IMAGE_MINOR_VERSION >= 6))
+
+static_assert(std::is_final_v<cen::animated_image_player>);
+
+static_assert(!std::is_copy_constructible_v<cen::animated_image_player>);
+static_assert(!std::is_copy_assignable_v<cen::animated_image_player>);
+
+class AnimatedImagePlayerTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(AnimatedImagePlayerTest, StillImage)
+{
+  using namespace cen::literals;
+
+  cen::task_scheduler scheduler{2};
+  cen::animated_image_player player{scheduler, "resources/panda.png"};
+  ASSERT_EQ(3u, player.ring_size());
+  ASSERT_FALSE(player.current());
+
+  // Still images are loaded as animations with a single frame
+  scheduler.wait();
+  ASSERT_TRUE(player.is_loaded());
+  ASSERT_FALSE(player.has_failed());
+  ASSERT_EQ(1u, player.frame_count());
+  ASSERT_LT(0u, player.compressed_bytes());
+
+  // The first update creates the texture ring and starts decoding
+  player.update(*m_renderer, 0_ms);
+  scheduler.wait();
+  player.update(*m_renderer, 0_ms);
+
+  ASSERT_TRUE(player.current());
+  ASSERT_EQ(0u, player.current_index().value());
+  ASSERT_EQ(player.size(), player.current()->size());
+
+  // The frame isn't replaced until its delay has passed
+  scheduler.wait();
+  ASSERT_FALSE(player.update(*m_renderer, 10_ms));
+  ASSERT_TRUE(player.update(*m_renderer, cen::animated_image_player::default_delay));
+}
+
+TEST_F(AnimatedImagePlayerTest, MissingFile)
+{
+  using namespace cen::literals;
+
+  cen::task_scheduler scheduler{1};
+  cen::animated_image_player player{scheduler, "no/such/animation.gif"};
+
+  scheduler.wait();
+  ASSERT_TRUE(player.has_failed());
+  ASSERT_FALSE(player.is_loaded());
+  ASSERT_EQ(0u, player.frame_count());
+
+  ASSERT_FALSE(player.update(*m_renderer, 100_ms));
+  ASSERT_FALSE(player.current());
+}
+
+#endif  // SDL_IMAGE_VERSION >= 2.6.0
@@ -34,6 +34,17 @@ TEST(BlendMode, InequalityOperator)
   ASSERT_NE(SDL_BLENDMODE_MOD, cen::blend_mode::add);
 }
 
+TEST(BlendMode, PremultipliedBlendMode)
+{
+  const auto expected = SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE,
+                                                   SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                                                   SDL_BLENDOPERATION_ADD,
+                                                   SDL_BLENDFACTOR_ONE,
+                                                   SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                                                   SDL_BLENDOPERATION_ADD);
+  ASSERT_EQ(cen::premultiplied_blend_mode(), expected);
+}
+
 TEST(BlendMode, ToString)
 {
   ASSERT_THROW(cen::to_string(static_cast<cen::blend_mode>(SDL_BLENDMODE_INVALID - 1)),
@@ -0,0 +1,82 @@
+#include "video/color_gradient.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>  // abs
+#include <vector>   // vector
+
+#include "video/colors.hpp"
+
+namespace {
+
+[[nodiscard]] auto is_near(const cen::color& a, const cen::color& b) -> bool
+{
+  return std::abs(a.red() - b.red()) <= 1 && std::abs(a.green() - b.green()) <= 1 &&
+         std::abs(a.blue() - b.blue()) <= 1 && std::abs(a.alpha() - b.alpha()) <= 1;
+}
+
+}  // namespace
+
+TEST(ColorGradient, Validation)
+{
+  ASSERT_THROW(cen::color_gradient({}), cen::cen_error);
+  ASSERT_THROW(cen::color_gradient(cen::colors::red, cen::colors::blue, 1), cen::cen_error);
+}
+
+TEST(ColorGradient, TwoColors)
+{
+  const cen::color_gradient gradient{cen::colors::red, cen::colors::blue, 11};
+  ASSERT_EQ(11u, gradient.resolution());
+
+  ASSERT_EQ(cen::colors::red, gradient.sample(0));
+  ASSERT_EQ(cen::colors::blue, gradient.sample(1));
+
+  // Out of range positions are clamped
+  ASSERT_EQ(cen::colors::red, gradient.sample(-5));
+  ASSERT_EQ(cen::colors::blue, gradient.sample(5));
+
+  const auto middle = cen::blend(cen::colors::red, cen::colors::blue, 0.5f);
+  ASSERT_TRUE(is_near(middle, gradient.sample(0.5f)));
+  ASSERT_TRUE(is_near(middle, gradient.sample(0.52f)));
+}
+
+TEST(ColorGradient, Stops)
+{
+  // The stops are sorted, and positions outside of the stops use the nearest stop
+  const cen::color_gradient gradient{{{0.75f, cen::colors::blue},
+                                      {0.25f, cen::colors::red},
+                                      {0.5f, cen::colors::lime}},
+                                     101};
+
+  ASSERT_EQ(cen::colors::red, gradient.sample(0));
+  ASSERT_EQ(cen::colors::red, gradient.sample(0.25f));
+  ASSERT_EQ(cen::colors::lime, gradient.sample(0.5f));
+  ASSERT_EQ(cen::colors::blue, gradient.sample(0.75f));
+  ASSERT_EQ(cen::colors::blue, gradient.sample(1));
+
+  const auto between = cen::blend(cen::colors::lime, cen::colors::blue, 0.4f);
+  ASSERT_TRUE(is_near(between, gradient.sample(0.6f)));
+}
+
+TEST(ColorGradient, SingleStop)
+{
+  const cen::color_gradient gradient{{{0.5f, cen::colors::pink}}};
+  ASSERT_EQ(256u, gradient.resolution());
+
+  for (const auto& color : gradient.table()) {
+    ASSERT_EQ(cen::colors::pink, color);
+  }
+}
+
+TEST(ColorGradient, BulkSample)
+{
+  const cen::color_gradient gradient{cen::colors::black, cen::colors::white};
+
+  const std::vector<float> positions{0.0f, 0.3f, 0.6f, 1.0f};
+  std::vector<cen::color> colors(positions.size());
+  gradient.sample(positions, colors);
+
+  for (cen::usize index = 0; index < positions.size(); ++index) {
+    ASSERT_EQ(gradient.sample(positions[index]), colors[index]);
+  }
+}
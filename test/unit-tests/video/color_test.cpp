@@ -187,6 +187,41 @@ TEST(Color, FromARGB)
   ASSERT_EQ(0xA7, color->blue());
 }
 
+TEST(Color, ConstexprParsing)
+{
+  static_assert(cen::color::from_rgb("#2AEB9C").has_value());
+  static_assert(!cen::color::from_rgb("#XY0000").has_value());
+  static_assert(cen::color::from_rgba("#7BCF39EA")->alpha() == 0xEA);
+  static_assert(cen::color::from_argb("#B281CDA7")->alpha() == 0xB2);
+
+  ASSERT_TRUE(cen::color::from_rgb("#aBcDeF"));
+  ASSERT_EQ(0xAB, cen::color::from_rgb("#aBcDeF")->red());
+}
+
+TEST(Color, FromHex)
+{
+  static_assert(cen::color::from_hex("#2AEB9C") == cen::color{0x2A, 0xEB, 0x9C});
+
+  ASSERT_EQ(cen::color::from_rgb("#0189af"), cen::color::from_hex("#0189af"));
+  ASSERT_EQ(cen::color::from_rgba("#7BCF39EA"), cen::color::from_hex("#7BCF39EA"));
+  ASSERT_EQ(cen::color::from_rgba("#FEDCBA00"), cen::color::from_hex("#FEDCBA00"));
+}
+
+TEST(Color, ColorLiteral)
+{
+  using namespace cen::literals;
+
+  constexpr auto orange = "#FF8800"_color;
+  static_assert(orange == cen::color{0xFF, 0x88, 0x00});
+
+  constexpr auto translucent = "#FF880080"_color;
+  static_assert(translucent == cen::color{0xFF, 0x88, 0x00, 0x80});
+
+  ASSERT_THROW("FF8800"_color, cen::cen_error);
+  ASSERT_THROW("#FF88"_color, cen::cen_error);
+  ASSERT_THROW("#GG8800"_color, cen::cen_error);
+}
+
 TEST(Color, FromNorm)
 {
   {
@@ -0,0 +1,104 @@
+#include "video/color_utils.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>  // abs
+#include <vector>   // vector
+
+#include "video/colors.hpp"
+
+namespace {
+
+void expect_near(const cen::color& expected, const cen::color& actual)
+{
+  EXPECT_LE(std::abs(expected.red() - actual.red()), 1) << expected << " vs " << actual;
+  EXPECT_LE(std::abs(expected.green() - actual.green()), 1) << expected << " vs " << actual;
+  EXPECT_LE(std::abs(expected.blue() - actual.blue()), 1) << expected << " vs " << actual;
+  EXPECT_LE(std::abs(expected.alpha() - actual.alpha()), 1) << expected << " vs " << actual;
+}
+
+// An odd amount, so that both the vectorized and scalar paths are used
+[[nodiscard]] auto make_colors(const int seed) -> std::vector<cen::color>
+{
+  std::vector<cen::color> colors;
+  for (auto index = 0; index < 13; ++index) {
+    const auto value = index * 37 + seed;
+    colors.emplace_back(static_cast<cen::u8>(value),
+                        static_cast<cen::u8>(value * 3),
+                        static_cast<cen::u8>(255 - value),
+                        static_cast<cen::u8>(value * 7));
+  }
+
+  return colors;
+}
+
+}  // namespace
+
+TEST(ColorUtils, Blend)
+{
+  const auto from = make_colors(0);
+  const auto to = make_colors(101);
+
+  for (const auto bias : {0.0f, 0.25f, 0.5f, 0.8f, 1.0f}) {
+    std::vector<cen::color> result(from.size());
+    cen::blend(from, to, bias, result);
+
+    for (cen::usize index = 0; index < from.size(); ++index) {
+      expect_near(cen::blend(from[index], to[index], bias), result[index]);
+    }
+  }
+
+  std::vector<cen::color> edges(from.size());
+  cen::blend(from, to, 0.0f, edges);
+  ASSERT_EQ(from, edges);
+
+  cen::blend(from, to, 1.0f, edges);
+  ASSERT_EQ(to, edges);
+}
+
+TEST(ColorUtils, BlendInPlace)
+{
+  auto colors = make_colors(0);
+  const auto target = make_colors(50);
+  const auto expected = colors;
+
+  cen::blend(colors, target, 0.0f, colors);
+  ASSERT_EQ(expected, colors);
+}
+
+TEST(ColorUtils, SampleGradient)
+{
+  const std::vector<float> biases{0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 1.0f};
+  std::vector<cen::color> result(biases.size());
+
+  cen::sample_gradient(cen::colors::red, cen::colors::blue, biases, result);
+
+  for (cen::usize index = 0; index < biases.size(); ++index) {
+    expect_near(cen::blend(cen::colors::red, cen::colors::blue, biases[index]),
+                result[index]);
+  }
+
+  ASSERT_EQ(cen::colors::red, result.front());
+  ASSERT_EQ(cen::colors::blue, result.back());
+}
+
+TEST(ColorUtils, HSVToRGB)
+{
+  std::vector<float> hues;
+  std::vector<float> saturations;
+  std::vector<float> values;
+
+  for (auto hue = -30; hue <= 390; hue += 15) {
+    hues.push_back(static_cast<float>(hue));
+    saturations.push_back(static_cast<float>((hue * 7) % 120));
+    values.push_back(static_cast<float>(100 - (hue * 3) % 110));
+  }
+
+  std::vector<cen::color> result(hues.size());
+  cen::hsv_to_rgb(hues, saturations, values, result);
+
+  for (cen::usize index = 0; index < hues.size(); ++index) {
+    expect_near(cen::color::from_hsv(hues[index], saturations[index], values[index]),
+                result[index]);
+  }
+}
@@ -0,0 +1,78 @@
+#include "video/converted_texture_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr
+#include <string>       // string
+#include <type_traits>  // is_final_v
+
+#include "filesystem/preferred_path.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::converted_texture_cache>);
+
+class ConvertedTextureCacheTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline constexpr static auto path = "resources/panda.png";
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(ConvertedTextureCacheTest, Load)
+{
+  cen::converted_texture_cache cache{prefs};
+  ASSERT_EQ(prefs, cache.directory());
+
+  const auto first = cache.load(*m_renderer, path);
+  const auto second = cache.load(*m_renderer, path);
+
+  const cen::surface image{path};
+  ASSERT_EQ(image.size(), first.size());
+  ASSERT_EQ(image.size(), second.size());
+  ASSERT_EQ(first.format(), second.format());
+
+  // The first load may have been served by an entry stored by a previous run
+  const auto& stats = cache.stats();
+  ASSERT_EQ(2u, stats.hits + stats.misses);
+  ASSERT_LE(1u, stats.hits);
+  ASSERT_LT(0.0, stats.hit_rate());
+
+  cache.reset_stats();
+  ASSERT_EQ(0u, cache.stats().hits);
+  ASSERT_EQ(0.0, cache.stats().hit_rate());
+}
+
+TEST_F(ConvertedTextureCacheTest, MissingFile)
+{
+  cen::converted_texture_cache cache{prefs};
+  ASSERT_THROW(cache.load(*m_renderer, "no/such/image.png"), cen::cen_error);
+  ASSERT_EQ(0u, cache.stats().misses);
+}
+
+TEST_F(ConvertedTextureCacheTest, PreferredFormat)
+{
+  const auto info = cen::get_info(*m_renderer);
+  ASSERT_TRUE(info);
+
+  const auto opaque = cen::converted_texture_cache::preferred_format(*info, false);
+  const auto alpha = cen::converted_texture_cache::preferred_format(*info, true);
+
+  ASSERT_FALSE(SDL_ISPIXELFORMAT_FOURCC(cen::to_underlying(opaque)));
+  ASSERT_TRUE(SDL_ISPIXELFORMAT_ALPHA(cen::to_underlying(alpha)));
+}
@@ -0,0 +1,102 @@
+#include "video/damage_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+class DamageTrackerTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(DamageTrackerTest, Defaults)
+{
+  const cen::damage_tracker damage{*m_renderer, {200, 100}};
+  ASSERT_EQ((cen::iarea{200, 100}), damage.size());
+  ASSERT_EQ((cen::iarea{200, 100}), damage.canvas().size());
+  ASSERT_EQ(cen::colors::black, damage.background());
+
+  // Everything is damaged initially
+  ASSERT_TRUE(damage.is_damaged());
+  ASSERT_EQ((cen::irect{0, 0, 200, 100}), damage.damaged_area());
+  ASSERT_FALSE(damage.redrawn_area().has_area());
+}
+
+TEST_F(DamageTrackerTest, Render)
+{
+  cen::damage_tracker damage{*m_renderer, {200, 100}};
+
+  int calls = 0;
+  cen::irect drawn;
+  const auto draw = [&](const cen::irect& area) {
+    ++calls;
+    drawn = area;
+  };
+
+  ASSERT_TRUE(damage.render(*m_renderer, draw));
+  ASSERT_EQ(1, calls);
+  ASSERT_EQ((cen::irect{0, 0, 200, 100}), drawn);
+  ASSERT_EQ(drawn, damage.redrawn_area());
+  ASSERT_FALSE(damage.is_damaged());
+
+  // Nothing is redrawn if nothing changed, but the canvas is still copied
+  ASSERT_TRUE(damage.render(*m_renderer, draw));
+  ASSERT_EQ(1, calls);
+  ASSERT_FALSE(damage.redrawn_area().has_area());
+
+  // Damaged areas are merged, and clipped to the canvas
+  damage.mark({10, 10, 20, 20});
+  damage.mark({50, 5, 10, 10});
+  damage.mark({190, 90, 50, 50});
+  ASSERT_EQ((cen::irect{10, 5, 190, 95}), damage.damaged_area());
+
+  ASSERT_TRUE(damage.render(*m_renderer, draw));
+  ASSERT_EQ(2, calls);
+  ASSERT_EQ((cen::irect{10, 5, 190, 95}), drawn);
+
+  // The clip and render target are restored
+  ASSERT_FALSE(m_renderer->clip().has_value());
+  ASSERT_EQ(nullptr, SDL_GetRenderTarget(m_renderer->get()));
+}
+
+TEST_F(DamageTrackerTest, Resize)
+{
+  cen::damage_tracker damage{*m_renderer, {200, 100}};
+  ASSERT_TRUE(damage.render(*m_renderer, [](const cen::irect&) {}));
+  ASSERT_FALSE(damage.is_damaged());
+
+  damage.resize(*m_renderer, {200, 100});
+  ASSERT_FALSE(damage.is_damaged());
+
+  damage.resize(*m_renderer, {300, 150});
+  ASSERT_TRUE(damage.is_damaged());
+  ASSERT_EQ((cen::iarea{300, 150}), damage.size());
+  ASSERT_EQ((cen::iarea{300, 150}), damage.canvas().size());
+  ASSERT_EQ((cen::irect{0, 0, 300, 150}), damage.damaged_area());
+}
+
+TEST_F(DamageTrackerTest, SetBackground)
+{
+  cen::damage_tracker damage{*m_renderer, {200, 100}};
+
+  damage.set_background(cen::colors::white);
+  ASSERT_EQ(cen::colors::white, damage.background());
+}
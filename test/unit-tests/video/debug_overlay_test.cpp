@@ -0,0 +1,131 @@
+#include "video/debug_overlay.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class DebugOverlayTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+
+    m_cache = std::make_unique<cen::font_cache>("resources/daniel.ttf", 12);
+    m_cache->use_atlas();
+    m_cache->add_basic_latin(*m_renderer);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_cache.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::font_cache> m_cache;
+};
+
+TEST_F(DebugOverlayTest, Defaults)
+{
+  const cen::debug_overlay overlay{*m_cache};
+  ASSERT_EQ(cen::fpoint(8, 8), overlay.position());
+  ASSERT_EQ(4u, overlay.zone_count());
+  ASSERT_EQ(4u, overlay.refresh_interval());
+  ASSERT_EQ(cen::nanoseconds<cen::u64>{16'666'667}, overlay.budget());
+  ASSERT_EQ(cen::nanoseconds<cen::u64>::zero(), overlay.cost());
+  ASSERT_EQ(cen::nanoseconds<cen::u64>::zero(), overlay.last_frame_time());
+  ASSERT_EQ(0u, overlay.histogram().count());
+  ASSERT_TRUE(overlay.shapes().empty());
+  ASSERT_TRUE(overlay.text().empty());
+}
+
+TEST_F(DebugOverlayTest, Update)
+{
+  cen::debug_overlay overlay{*m_cache};
+  overlay.update(*m_renderer);
+
+  // The background and the budget line
+  ASSERT_EQ(2u, overlay.shapes().vertices().size() / 4u);
+  ASSERT_FALSE(overlay.text().empty());
+
+  m_renderer->present();
+  m_renderer->present();
+  overlay.update(*m_renderer);
+
+  ASSERT_EQ(1u, overlay.histogram().count());
+  ASSERT_EQ(m_renderer->get_present_timing().interval, overlay.last_frame_time());
+  ASSERT_EQ(3u, overlay.shapes().vertices().size() / 4u);
+
+  // Without a new present, no frame is recorded
+  overlay.update(*m_renderer);
+  ASSERT_EQ(1u, overlay.histogram().count());
+}
+
+TEST_F(DebugOverlayTest, HistoryIsBounded)
+{
+  cen::debug_overlay overlay{*m_cache};
+
+  for (cen::usize i = 0; i < cen::debug_overlay::history_size + 10u; ++i) {
+    m_renderer->present();
+    overlay.update(*m_renderer);
+  }
+
+  const auto bars = overlay.shapes().vertices().size() / 4u - 2u;
+  ASSERT_LE(bars, cen::debug_overlay::history_size);
+}
+
+TEST_F(DebugOverlayTest, RenderExcludesOwnWork)
+{
+  m_renderer->set_stats_collection(true);
+
+  cen::debug_overlay overlay{*m_cache};
+  overlay.update(*m_renderer);
+
+  ASSERT_TRUE(overlay.render(*m_renderer));
+  ASSERT_EQ(2u, overlay.own_stats().drawCalls);
+  ASSERT_EQ(overlay.own_stats().drawCalls, m_renderer->current_stats().drawCalls);
+  ASSERT_NE(cen::nanoseconds<cen::u64>::zero(), overlay.cost());
+
+  m_renderer->present();
+  ASSERT_EQ(2u, m_renderer->frame_stats().drawCalls);
+
+  m_renderer->set_stats_collection(false);
+}
+
+TEST_F(DebugOverlayTest, Configuration)
+{
+  cen::debug_overlay overlay{*m_cache};
+
+  overlay.set_budget(cen::nanoseconds<cen::u64>{8'333'333});
+  ASSERT_EQ(cen::nanoseconds<cen::u64>{8'333'333}, overlay.budget());
+
+  overlay.set_zone_count(0);
+  ASSERT_EQ(0u, overlay.zone_count());
+
+  overlay.set_refresh_interval(1);
+  ASSERT_EQ(1u, overlay.refresh_interval());
+
+  overlay.set_position({100, 50});
+  ASSERT_EQ(cen::fpoint(100, 50), overlay.position());
+
+  overlay.set_graph_size({120, 30});
+  ASSERT_EQ((cen::farea{120, 30}), overlay.graph_size());
+
+  overlay.update(*m_renderer);
+
+  const auto& background = overlay.shapes().vertices().front();
+  ASSERT_EQ(100, background.position.x);
+  ASSERT_EQ(50, background.position.y);
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
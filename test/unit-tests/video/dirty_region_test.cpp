@@ -0,0 +1,49 @@
+#include "video/dirty_region.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(DirtyRegion, Defaults)
+{
+  const cen::dirty_region region{{64, 32}};
+  ASSERT_FALSE(region.is_dirty());
+  ASSERT_EQ((cen::iarea{64, 32}), region.bounds());
+  ASSERT_EQ(0u, region.pixel_count());
+}
+
+TEST(DirtyRegion, Mark)
+{
+  cen::dirty_region region{{64, 32}};
+
+  region.mark(cen::irect{10, 10, 4, 4});
+  ASSERT_TRUE(region.is_dirty());
+  ASSERT_EQ((cen::irect{10, 10, 4, 4}), region.area());
+
+  // Marked areas are merged into a single bounding rectangle
+  region.mark(cen::ipoint{20, 5});
+  ASSERT_EQ((cen::irect{10, 5, 11, 9}), region.area());
+  ASSERT_EQ(11u * 9u, region.pixel_count());
+}
+
+TEST(DirtyRegion, MarkOutOfBounds)
+{
+  cen::dirty_region region{{64, 32}};
+
+  region.mark(cen::irect{-10, -10, 5, 5});
+  region.mark(cen::irect{64, 0, 10, 10});
+  ASSERT_FALSE(region.is_dirty());
+
+  // Partially visible areas are clipped to the bounds
+  region.mark(cen::irect{60, -2, 10, 4});
+  ASSERT_EQ((cen::irect{60, 0, 4, 2}), region.area());
+}
+
+TEST(DirtyRegion, MarkAll)
+{
+  cen::dirty_region region{{64, 32}};
+
+  region.mark_all();
+  ASSERT_EQ((cen::irect{0, 0, 64, 32}), region.area());
+
+  region.clear();
+  ASSERT_FALSE(region.is_dirty());
+}
@@ -0,0 +1,15 @@
+#include "video/dpi_scale_mode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+TEST(DPIScaleMode, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::dpi_scale_mode>(2)), cen::cen_error);
+
+  ASSERT_EQ("integer", cen::to_string(cen::dpi_scale_mode::integer));
+  ASSERT_EQ("fractional", cen::to_string(cen::dpi_scale_mode::fractional));
+
+  std::clog << "DPI scale mode example: " << cen::dpi_scale_mode::fractional << '\n';
+}
@@ -0,0 +1,94 @@
+#include "video/dpi_scaler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>   // round
+#include <memory>  // unique_ptr
+
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+class DPIScalerTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(DPIScalerTest, IntegerMode)
+{
+  const auto output = m_renderer->output_size();
+
+  const cen::dpi_scaler scaler{*m_window, *m_renderer, {output.width / 2, output.height / 2}};
+  ASSERT_EQ(cen::dpi_scale_mode::integer, scaler.mode());
+  ASSERT_EQ(2.0f, scaler.scale());
+  ASSERT_EQ(1.0f, scaler.font_scale());
+  ASSERT_EQ(12, scaler.font_size(12));
+
+  // The renderer scales the logical size
+  ASSERT_EQ(scaler.logical_size(), m_renderer->logical_size());
+  ASSERT_TRUE(m_renderer->is_using_integer_logical_scaling());
+  ASSERT_EQ((cen::fpoint{10, 20}), scaler.to_output(cen::fpoint{10, 20}));
+}
+
+TEST_F(DPIScalerTest, FractionalMode)
+{
+  const auto output = m_renderer->output_size();
+
+  const cen::iarea logical{output.width * 2 / 3, output.height * 2 / 3};
+  const cen::dpi_scaler scaler{*m_window, *m_renderer, logical};
+  ASSERT_EQ(cen::dpi_scale_mode::fractional, scaler.mode());
+  ASSERT_GT(scaler.scale(), 1.4f);
+  ASSERT_LT(scaler.scale(), 1.6f);
+  ASSERT_EQ(scaler.scale(), scaler.font_scale());
+  ASSERT_EQ(static_cast<int>(std::round(12 * scaler.scale())), scaler.font_size(12));
+
+  // Content is rendered at output size
+  ASSERT_EQ((cen::iarea{0, 0}), m_renderer->logical_size());
+  ASSERT_FALSE(m_renderer->is_using_integer_logical_scaling());
+
+  const auto origin = scaler.to_output(cen::fpoint{0, 0});
+  const auto point = scaler.to_output(cen::fpoint{10, 20});
+  ASSERT_FLOAT_EQ(origin.x() + 10 * scaler.scale(), point.x());
+  ASSERT_FLOAT_EQ(origin.y() + 20 * scaler.scale(), point.y());
+
+  const auto rect = scaler.to_output(cen::frect{10, 20, 30, 40});
+  ASSERT_EQ(point, rect.position());
+  ASSERT_FLOAT_EQ(30 * scaler.scale(), rect.width());
+  ASSERT_FLOAT_EQ(40 * scaler.scale(), rect.height());
+}
+
+TEST_F(DPIScalerTest, AddFont)
+{
+  const auto output = m_renderer->output_size();
+
+  cen::dpi_scaler scaler{*m_window, *m_renderer, {output.width / 2, output.height / 2}};
+
+  cen::font_cache cache{"resources/daniel.ttf", 12};
+  cache.get_font().set_bold(true);
+  cache.add_basic_latin(*m_renderer);
+
+  // The font size is unchanged in the integer mode
+  scaler.add_font(cache, "resources/daniel.ttf", 12);
+  ASSERT_EQ(12, cache.get_font().size());
+
+  scaler.add_font(cache, "resources/daniel.ttf", 10);
+  ASSERT_EQ(10, cache.get_font().size());
+  ASSERT_TRUE(cache.get_font().is_bold());
+  ASSERT_TRUE(cache.has('a'));
+
+  scaler.remove_font(cache);
+}
@@ -2,12 +2,18 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>       // remove
 #include <functional>   // function
 #include <memory>       // unique_ptr
+#include <string>       // string
 #include <string_view>  // string_view
 
+#include "thread/task_scheduler.hpp"
 #include "video/font.hpp"
+#include "video/font_pool.hpp"
 #include "video/renderer.hpp"
+#include "video/text_layout.hpp"
+#include "video/utf8_view.hpp"
 #include "video/window.hpp"
 
 namespace {
@@ -171,6 +177,39 @@ TEST_F(FontCacheTest, StoreShadedLatin1)
   });
 }
 
+TEST_F(FontCacheTest, ParallelAddRange)
+{
+  const cen::font_pool pool{fontPath};
+  cen::task_scheduler scheduler{3};
+
+  cen::font font = pool.make_font(12);
+  font.set_bold(true);
+
+  cen::font_cache parallel{std::move(font)};
+  parallel.add_range(*m_renderer, scheduler, pool, 0x20, 0x7F);
+
+  m_cache.get_font().set_bold(true);
+  m_cache.add_basic_latin(*m_renderer);
+
+  for (cen::unicode glyph = 0x20; glyph < 0x7F; ++glyph) {
+    ASSERT_EQ(m_cache.has(glyph), parallel.has(glyph));
+    if (m_cache.has(glyph)) {
+      ASSERT_EQ(m_cache.at(glyph).cached.size(), parallel.at(glyph).cached.size());
+    }
+  }
+
+  // The worker fonts are destroyed once the glyphs have been rendered
+  ASSERT_EQ(1u, pool.use_count());
+
+  cen::font_cache atlas{pool.make_font(12)};
+  atlas.use_atlas();
+  atlas.add_range(*m_renderer, scheduler, pool, 'a', 'z' + 1);
+
+  ASSERT_TRUE(atlas.try_at_atlas('a'));
+  ASSERT_TRUE(atlas.try_at_atlas('z'));
+  ASSERT_EQ(1u, atlas.atlas_page_count());
+}
+
 TEST_F(FontCacheTest, Has)
 {
   m_cache.add_basic_latin(*m_renderer);
@@ -281,6 +320,51 @@ TEST_F(FontCacheTest, Has)
   }
 }
 
+TEST_F(FontCacheTest, HasAll)
+{
+  m_cache.add_basic_latin(*m_renderer);
+
+  ASSERT_TRUE(m_cache.has_all(cen::utf8_view{"Hello\nworld!"}));
+  ASSERT_TRUE(m_cache.has_all(cen::unicode_string{'a', 'b', 'c'}));
+  ASSERT_TRUE(m_cache.has_all(cen::utf8_view{""}));
+
+  ASSERT_FALSE(m_cache.has_all(cen::utf8_view{"Gr\xC3\xBC\xC3\x9F" "e"}));
+}
+
+TEST_F(FontCacheTest, TryMetrics)
+{
+  ASSERT_FALSE(m_cache.try_metrics('a'));
+
+  m_cache.add_basic_latin(*m_renderer);
+
+  const auto* metrics = m_cache.try_metrics('a');
+  ASSERT_TRUE(metrics);
+  ASSERT_EQ(m_cache.at('a').metrics.advance, metrics->advance);
+}
+
+TEST_F(FontCacheTest, Measure)
+{
+  ASSERT_FALSE(m_cache.measure(cen::utf8_view{"abc"}));
+
+  m_cache.add_basic_latin(*m_renderer);
+
+  const auto& font = m_cache.get_font();
+  ASSERT_EQ((cen::iarea{0, 0}), m_cache.measure(cen::utf8_view{""}));
+  ASSERT_EQ(font.height(), m_cache.measure(cen::utf8_view{"abc"})->height);
+  ASSERT_EQ(font.line_skip() + font.height(),
+            m_cache.measure(cen::utf8_view{"abc\nd"})->height);
+
+  // The size matches the layout of the same text
+  for (const auto* text : {"Hello, world!", "AV To\nWAVE  ", " x\n\ny "}) {
+    cen::text_layout layout{m_cache};
+    layout.set_text(cen::utf8_view{text});
+
+    ASSERT_EQ(layout.size(), m_cache.measure(cen::utf8_view{text}));
+  }
+
+  ASSERT_FALSE(m_cache.measure(cen::utf8_view{"Gr\xC3\xBC\xC3\x9F" "e"}));
+}
+
 TEST_F(FontCacheTest, At)
 {
   m_cache.add_basic_latin(*m_renderer);
@@ -338,3 +422,279 @@ TEST_F(FontCacheTest, GetFont)
   const auto& font = m_cache.get_font();
   ASSERT_EQ(font.family_name(), std::string("Daniel"));
 }
+
+TEST_F(FontCacheTest, UseAtlas)
+{
+  ASSERT_FALSE(m_cache.is_using_atlas());
+  ASSERT_EQ(0u, m_cache.atlas_page_count());
+
+  m_cache.use_atlas();
+  ASSERT_TRUE(m_cache.is_using_atlas());
+
+  m_cache.add_basic_latin(*m_renderer);
+  ASSERT_EQ(1u, m_cache.atlas_page_count());
+
+  ASSERT_TRUE(m_cache.has('a'));
+  ASSERT_TRUE(m_cache.try_at_atlas('a'));
+  ASSERT_FALSE(m_cache.try_at('a'));
+  ASSERT_FALSE(m_cache.try_at_atlas(0x7F));
+
+  const auto& [source, metrics, page] = *m_cache.try_at_atlas('a');
+  ASSERT_EQ(0u, page);
+  ASSERT_TRUE(source.has_area());
+  ASSERT_TRUE(m_cache.atlas_page(page).get());
+  ASSERT_ANY_THROW(m_cache.atlas_page(1));
+
+  // Glyphs must not overlap
+  const auto& other = *m_cache.try_at_atlas('b');
+  ASSERT_FALSE(cen::intersects(source, other.source));
+}
+
+TEST_F(FontCacheTest, AtlasPages)
+{
+  m_cache.use_atlas({32, 32});
+  m_cache.add_basic_latin(*m_renderer);
+  ASSERT_GT(m_cache.atlas_page_count(), 1u);
+
+  for (cen::unicode glyph = 0x20; glyph < 0x7F; ++glyph) {
+    const auto* data = m_cache.try_at_atlas(glyph);
+    ASSERT_TRUE(data);
+    ASSERT_LE(data->source.max_x(), 32);
+    ASSERT_LE(data->source.max_y(), 32);
+  }
+
+  cen::font_cache tiny{fontPath, 12};
+  tiny.use_atlas({1, 1});
+  ASSERT_THROW(tiny.add_glyph(*m_renderer, 'A'), cen::cen_error);
+}
+
+TEST_F(FontCacheTest, OnDemand)
+{
+  ASSERT_FALSE(m_cache.is_on_demand());
+
+  m_cache.use_atlas();
+
+  // Missing glyphs are not rasterized unless on-demand mode is enabled
+  ASSERT_FALSE(m_cache.request_glyph(*m_renderer, 'a'));
+  ASSERT_FALSE(m_cache.has('a'));
+
+  m_cache.set_on_demand(true);
+  ASSERT_TRUE(m_cache.is_on_demand());
+
+  const auto* data = m_cache.request_glyph(*m_renderer, 'a');
+  ASSERT_TRUE(data);
+  ASSERT_TRUE(m_cache.has('a'));
+  ASSERT_EQ(data, m_cache.try_at_atlas('a'));
+  ASSERT_EQ(data, m_cache.request_glyph(*m_renderer, 'a'));
+
+  const auto& stats = m_cache.atlas_statistics();
+  ASSERT_EQ(1u, stats.hits);
+  ASSERT_EQ(2u, stats.misses);
+  ASSERT_EQ(0u, stats.evictions);
+
+  m_cache.reset_atlas_statistics();
+  ASSERT_EQ(0u, m_cache.atlas_statistics().hits);
+  ASSERT_EQ(0u, m_cache.atlas_statistics().misses);
+
+  ASSERT_NO_THROW(m_renderer->render_text(m_cache, std::string{"Hello!"}, {10, 10}));
+  ASSERT_TRUE(m_cache.has('H'));
+  ASSERT_EQ(6u, m_cache.atlas_statistics().hits + m_cache.atlas_statistics().misses);
+
+  ASSERT_NE(10, m_renderer->render_glyph(m_cache, 'z', {10, 10}));
+  ASSERT_TRUE(m_cache.try_at_atlas('z'));
+}
+
+TEST_F(FontCacheTest, AtlasBudget)
+{
+  ASSERT_EQ(0u, m_cache.atlas_budget());
+  ASSERT_EQ(0u, m_cache.atlas_memory_usage());
+
+  constexpr cen::iarea pageSize{32, 32};
+  constexpr auto pageBytes = 32u * 32u * 4u;
+
+  m_cache.use_atlas(pageSize);
+  m_cache.set_on_demand(true);
+  m_cache.set_atlas_budget(pageBytes);
+  ASSERT_EQ(pageBytes, m_cache.atlas_budget());
+
+  for (cen::unicode glyph = 0x20; glyph < 0x7F; ++glyph) {
+    ASSERT_TRUE(m_cache.request_glyph(*m_renderer, glyph));
+  }
+
+  ASSERT_EQ(1u, m_cache.atlas_page_count());
+  ASSERT_EQ(pageBytes, m_cache.atlas_memory_usage());
+  ASSERT_GT(m_cache.atlas_statistics().evictions, 0u);
+
+  // The most recently used glyph survives, the least recently used one is evicted
+  ASSERT_TRUE(m_cache.try_at_atlas(0x7E));
+  ASSERT_FALSE(m_cache.try_at_atlas(0x20));
+}
+
+TEST_F(FontCacheTest, FreeMemory)
+{
+  m_cache.use_atlas();
+  m_cache.add_glyph(*m_renderer, 'a');
+
+  // Glyphs that can't be rasterized again aren't discarded
+  ASSERT_EQ(0u, m_cache.free_memory(1));
+  ASSERT_TRUE(m_cache.try_at_atlas('a'));
+
+  m_cache.set_on_demand(true);
+
+  const auto bytes = m_cache.atlas_memory_usage();
+  ASSERT_EQ(bytes, m_cache.free_memory(1));
+  ASSERT_EQ(0u, m_cache.atlas_page_count());
+  ASSERT_FALSE(m_cache.try_at_atlas('a'));
+
+  ASSERT_TRUE(m_cache.request_glyph(*m_renderer, 'a'));
+  ASSERT_EQ(1u, m_cache.atlas_page_count());
+}
+
+TEST_F(FontCacheTest, StoreShaped)
+{
+  ASSERT_FALSE(m_cache.has_shaped(1));
+  ASSERT_FALSE(m_cache.try_get_shaped(1));
+
+  m_cache.store_shaped_utf8(1, "Hello, world!", *m_renderer);
+  ASSERT_TRUE(m_cache.has_shaped(1));
+  ASSERT_EQ(1u, m_cache.atlas_page_count());
+
+  // The run is the size of the rendered string
+  const auto* run = m_cache.try_get_shaped(1);
+  ASSERT_TRUE(run);
+  ASSERT_EQ(0u, run->page);
+  ASSERT_EQ(m_cache.get_font().string_size("Hello, world!"), run->source.size());
+
+  // Runs are replaced, and are unaffected by glyphs
+  m_cache.store_shaped_utf8(1, std::string{"Hi"}, *m_renderer);
+  ASSERT_EQ(m_cache.get_font().string_size("Hi"), m_cache.try_get_shaped(1)->source.size());
+
+  m_cache.use_atlas();
+  m_cache.add_basic_latin(*m_renderer);
+  ASSERT_TRUE(m_cache.has_shaped(1));
+
+  // Runs are shaped again when the cache is rebuilt
+  m_cache.rebuild(*m_renderer, cen::font{fontPath, 24});
+  ASSERT_EQ(m_cache.get_font().string_size("Hi"), m_cache.try_get_shaped(1)->source.size());
+
+  m_cache.remove_shaped(1);
+  ASSERT_FALSE(m_cache.has_shaped(1));
+}
+
+TEST_F(FontCacheTest, AtlasName)
+{
+  const auto name = m_cache.atlas_name();
+  ASSERT_NE(std::string::npos, name.find("_12_"));
+  ASSERT_EQ(".atlas", name.substr(name.size() - 6));
+
+  // Different font settings produce different names
+  const cen::font_cache other{fontPath, 13};
+  ASSERT_NE(name, other.atlas_name());
+}
+
+TEST_F(FontCacheTest, SerializeAtlas)
+{
+  // Nothing is serialized unless the pixels are retained
+  m_cache.use_atlas({64, 64});
+  m_cache.add_basic_latin(*m_renderer);
+  ASSERT_TRUE(m_cache.serialize_atlas().empty());
+
+  cen::font_cache cache{fontPath, 12};
+  ASSERT_FALSE(cache.is_retaining_atlas());
+
+  cache.set_atlas_retention(true);
+  ASSERT_TRUE(cache.is_retaining_atlas());
+  ASSERT_TRUE(cache.serialize_atlas().empty());
+
+  cache.use_atlas({64, 64});
+  cache.add_basic_latin(*m_renderer);
+
+  const auto data = cache.serialize_atlas();
+  ASSERT_FALSE(data.empty());
+
+  cen::font_cache loaded{fontPath, 12};
+  ASSERT_TRUE(loaded.load_atlas(*m_renderer, data.data(), data.size()));
+  ASSERT_TRUE(loaded.is_using_atlas());
+  ASSERT_EQ(cache.atlas_page_count(), loaded.atlas_page_count());
+
+  for (auto glyph = 0x20; glyph < 0x7F; ++glyph) {
+    const auto* a = cache.try_at_atlas(static_cast<cen::unicode>(glyph));
+    const auto* b = loaded.try_at_atlas(static_cast<cen::unicode>(glyph));
+    ASSERT_EQ(a != nullptr, b != nullptr);
+
+    if (a) {
+      ASSERT_EQ(a->source, b->source);
+      ASSERT_EQ(a->page, b->page);
+      ASSERT_EQ(a->metrics.advance, b->metrics.advance);
+    }
+  }
+
+  // Atlases of other fonts and malformed data are rejected
+  cen::font_cache other{fontPath, 13};
+  ASSERT_FALSE(other.load_atlas(*m_renderer, data.data(), data.size()));
+  ASSERT_FALSE(other.is_using_atlas());
+
+  ASSERT_FALSE(loaded.load_atlas(*m_renderer, data.data(), data.size() - 1));
+  ASSERT_EQ(cache.atlas_page_count(), loaded.atlas_page_count());
+}
+
+TEST_F(FontCacheTest, SaveAtlas)
+{
+  const std::string path = "font_cache_test.atlas";
+
+  ASSERT_FALSE(m_cache.save_atlas(path));
+  ASSERT_FALSE(m_cache.load_atlas(*m_renderer, path));
+
+  m_cache.set_atlas_retention(true);
+  m_cache.use_atlas();
+  m_cache.add_range(*m_renderer, 'a', 'z' + 1);
+  ASSERT_TRUE(m_cache.save_atlas(path));
+
+  cen::font_cache loaded{fontPath, 12};
+  ASSERT_TRUE(loaded.load_atlas(*m_renderer, path));
+  ASSERT_TRUE(loaded.try_at_atlas('a'));
+  ASSERT_TRUE(loaded.try_at_atlas('z'));
+  ASSERT_FALSE(loaded.try_at_atlas('A'));
+
+  // Glyphs can still be added to a loaded atlas
+  loaded.add_glyph(*m_renderer, 'A');
+  ASSERT_TRUE(loaded.try_at_atlas('A'));
+  ASSERT_EQ(1u, loaded.atlas_page_count());
+
+  std::remove(path.c_str());
+}
+
+TEST_F(FontCacheTest, UpdateBlended)
+{
+  m_cache.update_blended_utf8(1, "foobar", *m_renderer);
+  ASSERT_TRUE(m_cache.has_stored(1));
+
+  const auto* texture = m_cache.get_stored(1).get();
+  const auto textureSize = m_cache.get_stored(1).size();
+  ASSERT_TRUE(m_cache.get_stored(1).is_streaming());
+  ASSERT_EQ(textureSize, m_cache.get_stored_size(1));
+
+  // Shorter strings reuse the texture
+  m_cache.update_blended_utf8(1, std::string{"foo"}, *m_renderer);
+  ASSERT_EQ(texture, m_cache.get_stored(1).get());
+  ASSERT_EQ(textureSize, m_cache.get_stored(1).size());
+  ASSERT_LT(m_cache.get_stored_size(1).width, textureSize.width);
+
+  m_cache.update_blended_latin1(1, "bar", *m_renderer);
+  ASSERT_EQ(texture, m_cache.get_stored(1).get());
+
+  m_cache.update_blended_unicode(1, cen::unicode_string{'a', 'b'}, *m_renderer);
+  ASSERT_EQ(texture, m_cache.get_stored(1).get());
+
+  // Longer strings make the texture grow
+  m_cache.update_blended_utf8(1, "foobar foobar", *m_renderer);
+  ASSERT_GT(m_cache.get_stored(1).width(), textureSize.width);
+  ASSERT_EQ(m_cache.get_stored(1).size(), m_cache.get_stored_size(1));
+
+  // Textures created by the store functions are replaced
+  m_cache.store_blended_utf8(2, "foobar", *m_renderer);
+  ASSERT_EQ(m_cache.get_stored(2).size(), m_cache.get_stored_size(2));
+
+  m_cache.update_blended_utf8(2, "foo", *m_renderer);
+  ASSERT_TRUE(m_cache.get_stored(2).is_streaming());
+}
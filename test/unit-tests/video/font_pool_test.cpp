@@ -0,0 +1,72 @@
+#include "video/font_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>       // string
+#include <type_traits>  // is_final_v
+
+namespace {
+
+inline constexpr auto danielPath = "resources/daniel.ttf";
+
+}  // namespace
+
+static_assert(std::is_final_v<cen::font_pool>);
+
+TEST(FontPool, Constructor)
+{
+  ASSERT_THROW(cen::font_pool{""}, cen::sdl_error);
+  ASSERT_THROW(cen::font_pool{std::string{"foo.ttf"}}, cen::sdl_error);
+  ASSERT_NO_THROW(cen::font_pool{std::string{danielPath}});
+
+  const cen::font_pool pool{cen::file{danielPath, cen::file_mode::read_existing_binary}};
+  ASSERT_TRUE(pool.data());
+  ASSERT_LT(0u, pool.size());
+  ASSERT_EQ(pool.size(), pool.data()->size());
+}
+
+TEST(FontPool, MakeFont)
+{
+  const cen::font_pool pool{danielPath};
+  ASSERT_EQ(0u, pool.use_count());
+
+  ASSERT_THROW((void) pool.make_font(0), cen::cen_error);
+
+  {
+    auto small = pool.make_font(12);
+    auto large = pool.make_font(24);
+    ASSERT_EQ(2u, pool.use_count());
+
+    ASSERT_EQ(12, small.size());
+    ASSERT_EQ(24, large.size());
+    ASSERT_LT(small.height(), large.height());
+
+    // The fonts have separate styles
+    large.set_bold(true);
+    ASSERT_TRUE(large.is_bold());
+    ASSERT_FALSE(small.is_bold());
+  }
+
+  ASSERT_EQ(0u, pool.use_count());
+}
+
+TEST(FontPool, FontOutlivesPool)
+{
+  auto font = cen::font_pool{danielPath}.make_font(16);
+
+  ASSERT_EQ(16, font.size());
+  ASSERT_TRUE(font.get_metrics('A'));
+  ASSERT_TRUE(font.string_size("Hello"));
+}
+
+TEST(FontPool, MatchesFontFromFile)
+{
+  const cen::font_pool pool{danielPath};
+
+  const auto pooled = pool.make_font(14);
+  const cen::font loaded{danielPath, 14};
+
+  ASSERT_EQ(loaded.height(), pooled.height());
+  ASSERT_EQ(loaded.line_skip(), pooled.line_skip());
+  ASSERT_STREQ(loaded.family_name(), pooled.family_name());
+}
@@ -35,6 +35,28 @@ TEST(Font, Constructor)
   ASSERT_THROW(cen::font(std::string{danielPath}, 0), cen::cen_error);
 }
 
+TEST(Font, FileConstructor)
+{
+  ASSERT_NO_THROW(cen::font(cen::file{danielPath, cen::file_mode::read_existing_binary}, 12));
+  ASSERT_THROW(cen::font(cen::file{danielPath, cen::file_mode::read_existing_binary}, 0),
+               cen::cen_error);
+}
+
+TEST(Font, TryLoad)
+{
+  const auto missing = cen::font::try_load("", 1);
+  ASSERT_FALSE(missing);
+  ASSERT_EQ(cen::error_code::ttf, missing.error().code());
+
+  const auto badSize = cen::font::try_load(danielPath, 0);
+  ASSERT_FALSE(badSize);
+  ASSERT_EQ(cen::error_code::bad_argument, badSize.error().code());
+
+  const auto font = cen::font::try_load(std::string{danielPath}, 12);
+  ASSERT_TRUE(font);
+  ASSERT_EQ(12, font->size());
+}
+
 TEST(Font, Reset)
 {
   // We use the std::string constructor here to make sure it works
@@ -147,6 +169,20 @@ TEST(Font, SetKerning)
   ASSERT_FALSE(font.has_kerning());
 }
 
+#if CENTURION_HAS_FEATURE_TTF_SHAPING
+
+TEST(Font, SetDirectionAndScript)
+{
+  cen::font font{danielPath, 12};
+
+  // Both depend on whether or not SDL_ttf was built with HarfBuzz
+  const auto shaping = font.set_direction(cen::text_direction::right_to_left);
+  ASSERT_EQ(shaping, font.set_script("Arab"));
+  ASSERT_EQ(shaping, font.set_script(std::string{"Latn"}));
+}
+
+#endif  // CENTURION_HAS_FEATURE_TTF_SHAPING
+
 TEST(Font, Size)
 {
   constexpr auto size = 12;
@@ -0,0 +1,107 @@
+#include "video/frame_recorder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>       // atomic
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_copy_constructible_v
+
+#include "core/exception.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::frame_recorder>);
+static_assert(!std::is_copy_assignable_v<cen::frame_recorder>);
+
+class FrameRecorderTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(FrameRecorderTest, Construction)
+{
+  const auto size = m_renderer->output_size();
+  const auto format = cen::pixel_format::rgba8888;
+
+  ASSERT_THROW(cen::frame_recorder(size, format, {}), cen::cen_error);
+
+  const cen::frame_recorder recorder{size, format, [](const cen::surface&, cen::u64) {}, 4};
+  ASSERT_EQ(4u, recorder.capacity());
+}
+
+TEST_F(FrameRecorderTest, Capture)
+{
+  std::atomic<cen::u64> frames{};
+  std::atomic<bool> sizesMatch{true};
+
+  const auto size = m_renderer->output_size();
+  cen::frame_recorder recorder{size,
+                               cen::pixel_format::rgba8888,
+                               [&](const cen::surface& frame, const cen::u64 index) {
+                                 sizesMatch = sizesMatch && frame.size() == size;
+                                 frames = index + 1;
+                               }};
+
+  for (auto i = 0; i < 10; ++i) {
+    m_renderer->clear_with(cen::colors::pink);
+    recorder.capture(*m_renderer);
+    m_renderer->present();
+  }
+
+  recorder.wait();
+
+  ASSERT_EQ(10u, recorder.consumed() + recorder.dropped());
+  ASSERT_GT(recorder.consumed(), 0u);
+  ASSERT_TRUE(sizesMatch);
+  ASSERT_GT(frames.load(), 0u);
+}
+
+TEST_F(FrameRecorderTest, DropsFramesWhenFull)
+{
+  std::atomic<bool> release{false};
+
+  cen::frame_recorder recorder{m_renderer->output_size(),
+                               cen::pixel_format::rgba8888,
+                               [&](const cen::surface&, cen::u64) {
+                                 while (!release) {
+                                   cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+                                 }
+                               },
+                               1};
+
+  ASSERT_TRUE(recorder.capture(*m_renderer));
+
+  // The only surface is either queued or being consumed
+  ASSERT_FALSE(recorder.capture(*m_renderer));
+  ASSERT_EQ(1u, recorder.dropped());
+
+  release = true;
+  recorder.wait();
+
+  ASSERT_EQ(1u, recorder.consumed());
+  ASSERT_TRUE(recorder.capture(*m_renderer));
+}
+
+TEST_F(FrameRecorderTest, SizeMismatch)
+{
+  cen::frame_recorder recorder{{10, 10},
+                               cen::pixel_format::rgba8888,
+                               [](const cen::surface&, cen::u64) {}};
+
+  ASSERT_FALSE(recorder.capture(*m_renderer));
+  ASSERT_EQ(1u, recorder.dropped());
+}
@@ -0,0 +1,168 @@
+#include "video/geometry_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // reverse
+#include <cmath>      // abs
+#include <vector>     // vector
+
+#include "video/colors.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+namespace {
+
+// Returns the total area covered by the triangles in the batch
+[[nodiscard]] auto triangle_area(const cen::geometry_batch& batch) -> float
+{
+  const auto& vertices = batch.vertices();
+  const auto& indices = batch.indices();
+
+  float area = 0;
+  for (cen::usize index = 0; index < indices.size(); index += 3) {
+    const auto& a = vertices.at(static_cast<cen::usize>(indices.at(index))).position;
+    const auto& b = vertices.at(static_cast<cen::usize>(indices.at(index + 1))).position;
+    const auto& c = vertices.at(static_cast<cen::usize>(indices.at(index + 2))).position;
+    area += std::abs(((b.x - a.x) * (c.y - a.y)) - ((b.y - a.y) * (c.x - a.x))) / 2.0f;
+  }
+
+  return area;
+}
+
+}  // namespace
+
+TEST(GeometryBatch, Defaults)
+{
+  const cen::geometry_batch batch;
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.triangle_count());
+  ASSERT_TRUE(batch.vertices().empty());
+  ASSERT_TRUE(batch.indices().empty());
+}
+
+TEST(GeometryBatch, AddLine)
+{
+  cen::geometry_batch batch;
+  batch.add_line({10, 10}, {30, 10}, 4, cen::colors::red);
+
+  ASSERT_EQ(4u, batch.vertices().size());
+  ASSERT_EQ(2u, batch.triangle_count());
+  ASSERT_FLOAT_EQ(20 * 4, triangle_area(batch));
+
+  for (const auto& vertex : batch.vertices()) {
+    ASSERT_FLOAT_EQ(2, std::abs(vertex.position.y - 10));
+    ASSERT_EQ(cen::colors::red, cen::color{vertex.color});
+  }
+}
+
+TEST(GeometryBatch, AddPolyline)
+{
+  cen::geometry_batch batch;
+
+  // Fewer than two points are ignored
+  batch.add_polyline(std::vector<cen::fpoint>{{10, 10}}, 2);
+  ASSERT_TRUE(batch.empty());
+
+  const std::vector<cen::fpoint> points{{0, 0}, {10, 0}, {10, 10}};
+  batch.add_polyline(points, 2);
+  ASSERT_EQ(6u, batch.vertices().size());
+  ASSERT_EQ(4u, batch.triangle_count());
+
+  // The outer corner of the mitered joint
+  const auto& outer = batch.vertices().at(3).position;
+  ASSERT_FLOAT_EQ(11, outer.x);
+  ASSERT_FLOAT_EQ(-1, outer.y);
+
+  batch.clear();
+  batch.add_polyline(points, 2, cen::colors::white, true);
+  ASSERT_EQ(6u, batch.vertices().size());
+  ASSERT_EQ(6u, batch.triangle_count());
+}
+
+TEST(GeometryBatch, AddConvexPolygon)
+{
+  cen::geometry_batch batch;
+
+  const std::vector<cen::fpoint> square{{0, 0}, {10, 0}, {10, 10}, {0, 10}};
+  batch.add_polygon(square);
+
+  ASSERT_EQ(4u, batch.vertices().size());
+  ASSERT_EQ(2u, batch.triangle_count());
+  ASSERT_FLOAT_EQ(100, triangle_area(batch));
+}
+
+TEST(GeometryBatch, AddConcavePolygon)
+{
+  cen::geometry_batch batch;
+
+  // An L-shape, in both orientations
+  std::vector<cen::fpoint> shape{{0, 0}, {20, 0}, {20, 10}, {10, 10}, {10, 20}, {0, 20}};
+  batch.add_polygon(shape);
+  ASSERT_EQ(4u, batch.triangle_count());
+  ASSERT_FLOAT_EQ(300, triangle_area(batch));
+
+  batch.clear();
+  std::reverse(shape.begin(), shape.end());
+  batch.add_polygon(shape);
+  ASSERT_EQ(4u, batch.triangle_count());
+  ASSERT_FLOAT_EQ(300, triangle_area(batch));
+}
+
+TEST(GeometryBatch, AddCircle)
+{
+  cen::geometry_batch batch;
+
+  batch.add_circle({50, 50}, 10, cen::colors::white, 16);
+  ASSERT_EQ(17u, batch.vertices().size());
+  ASSERT_EQ(16u, batch.triangle_count());
+
+  // The amount of segments is based on the radius by default
+  batch.clear();
+  batch.add_circle({50, 50}, 100);
+  ASSERT_GT(batch.triangle_count(), 16u);
+  ASSERT_NEAR(3.14159f * 100 * 100, triangle_area(batch), 200);
+}
+
+TEST(GeometryBatch, AddArc)
+{
+  cen::geometry_batch batch;
+
+  batch.add_arc({0, 0}, 10, 0, 90, 2, cen::colors::white, 8);
+  ASSERT_EQ(18u, batch.vertices().size());
+  ASSERT_EQ(16u, batch.triangle_count());
+
+  // The arc starts on the positive x-axis, and ends on the positive y-axis
+  ASSERT_FLOAT_EQ(11, batch.vertices().front().position.x);
+  ASSERT_NEAR(11, batch.vertices().at(16).position.y, 0.0001f);
+}
+
+TEST(GeometryBatch, AddRoundedRect)
+{
+  cen::geometry_batch batch;
+
+  batch.add_rounded_rect({0, 0, 100, 50}, 10, cen::colors::white, 4);
+  ASSERT_EQ(1u + (4u * 5u), batch.vertices().size());
+  ASSERT_EQ(20u, batch.triangle_count());
+
+  // The area of the rectangle, minus the corners outside of the rounded corners
+  const auto expected = (100.0f * 50.0f) - ((4.0f - 3.14159f) * 10 * 10);
+  ASSERT_NEAR(expected, triangle_area(batch), 10);
+
+  // A radius of zero results in a regular rectangle
+  batch.clear();
+  batch.add_rounded_rect({0, 0, 100, 50}, 0);
+  ASSERT_FLOAT_EQ(100 * 50, triangle_area(batch));
+}
+
+TEST(GeometryBatch, Clear)
+{
+  cen::geometry_batch batch;
+  batch.add_circle({50, 50}, 10);
+  ASSERT_FALSE(batch.empty());
+
+  batch.clear();
+  ASSERT_TRUE(batch.empty());
+  ASSERT_TRUE(batch.vertices().empty());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
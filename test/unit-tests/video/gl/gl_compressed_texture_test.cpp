@@ -0,0 +1,286 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>  // max
+#include <cstring>    // memcpy
+#include <iostream>   // clog
+#include <memory>     // make_unique
+#include <vector>     // vector
+
+#include "core/integers.hpp"
+#include "video/opengl/gl_compressed_texture.hpp"
+
+namespace {
+
+void put_u32(std::vector<std::byte>& data, const cen::usize offset, const cen::u32 value)
+{
+  if (data.size() < offset + 4) {
+    data.resize(offset + 4);
+  }
+
+  for (cen::usize index = 0; index < 4; ++index) {
+    data[offset + index] = static_cast<std::byte>((value >> (8u * index)) & 0xFFu);
+  }
+}
+
+void put_u64(std::vector<std::byte>& data, const cen::usize offset, const cen::u64 value)
+{
+  put_u32(data, offset, static_cast<cen::u32>(value));
+  put_u32(data, offset + 4, static_cast<cen::u32>(value >> 32u));
+}
+
+[[nodiscard]] auto make_ktx(const cen::u32 format,
+                            const cen::u32 width,
+                            const cen::u32 height,
+                            const cen::u32 levels) -> std::vector<std::byte>
+{
+  constexpr cen::u8 identifier[12] =
+      {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+  std::vector<std::byte> data(64);
+  std::memcpy(data.data(), identifier, sizeof identifier);
+
+  put_u32(data, 12, 0x04030201);
+  put_u32(data, 28, format);
+  put_u32(data, 36, width);
+  put_u32(data, 40, height);
+  put_u32(data, 52, 1);  // Faces
+  put_u32(data, 56, levels);
+  put_u32(data, 60, 4);  // Key/value data
+
+  put_u32(data, 64, 0);
+
+  for (cen::u32 level = 0; level < levels; ++level) {
+    const cen::iarea size{std::max(static_cast<int>(width >> level), 1),
+                          std::max(static_cast<int>(height >> level), 1)};
+    const auto bytes =
+        cen::gl::image_bytes(static_cast<cen::gl::compressed_format>(format), size);
+
+    const auto offset = data.size();
+    put_u32(data, offset, static_cast<cen::u32>(bytes));
+    data.resize(offset + 4 + ((bytes + 3u) & ~cen::usize{3}), std::byte{0x5A});
+  }
+
+  return data;
+}
+
+[[nodiscard]] auto make_ktx2(const cen::u32 vkFormat,
+                             const cen::u32 width,
+                             const cen::u32 height,
+                             const cen::u32 levels) -> std::vector<std::byte>
+{
+  constexpr cen::u8 identifier[12] =
+      {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+  std::vector<std::byte> data(80 + (24 * levels));
+  std::memcpy(data.data(), identifier, sizeof identifier);
+
+  put_u32(data, 12, vkFormat);
+  put_u32(data, 20, width);
+  put_u32(data, 24, height);
+  put_u32(data, 36, 1);  // Faces
+  put_u32(data, 40, levels);
+
+  return data;
+}
+
+[[nodiscard]] auto make_dds(const char (&fourCC)[5],
+                            const cen::u32 width,
+                            const cen::u32 height,
+                            const cen::usize bytes) -> std::vector<std::byte>
+{
+  std::vector<std::byte> data(128);
+  std::memcpy(data.data(), "DDS ", 4);
+
+  put_u32(data, 4, 124);
+  put_u32(data, 8, 0x1007);  // Caps, height, width, and pixel format
+  put_u32(data, 12, height);
+  put_u32(data, 16, width);
+  put_u32(data, 76, 32);
+  put_u32(data, 80, 0x4);  // Four character code
+  std::memcpy(data.data() + 84, fourCC, 4);
+
+  data.resize(data.size() + bytes, std::byte{0x11});
+  return data;
+}
+
+}  // namespace
+
+TEST(CompressedTexture, BlockSizes)
+{
+  using cen::gl::compressed_format;
+
+  ASSERT_EQ((cen::iarea{4, 4}), cen::gl::block_size(compressed_format::bc7));
+  ASSERT_EQ((cen::iarea{4, 4}), cen::gl::block_size(compressed_format::etc2_rgb8));
+  ASSERT_EQ((cen::iarea{6, 6}), cen::gl::block_size(compressed_format::astc_6x6));
+  ASSERT_EQ((cen::iarea{12, 10}), cen::gl::block_size(compressed_format::astc_12x10_srgb));
+
+  ASSERT_EQ(8u, cen::gl::block_bytes(compressed_format::bc1_rgb));
+  ASSERT_EQ(8u, cen::gl::block_bytes(compressed_format::etc2_rgb8_alpha1));
+  ASSERT_EQ(16u, cen::gl::block_bytes(compressed_format::bc3));
+  ASSERT_EQ(16u, cen::gl::block_bytes(compressed_format::astc_8x8));
+
+  // Partial blocks are rounded up
+  ASSERT_EQ(8u, cen::gl::image_bytes(compressed_format::bc1_rgb, {1, 1}));
+  ASSERT_EQ(4u * 8u, cen::gl::image_bytes(compressed_format::bc1_rgb, {5, 5}));
+  ASSERT_EQ(4u * 16u, cen::gl::image_bytes(compressed_format::astc_6x6, {7, 12}));
+  ASSERT_EQ(0u, cen::gl::image_bytes(compressed_format::bc7, {0, 4}));
+
+  ASSERT_TRUE(cen::gl::is_compressed_format(0x8E8C));
+  ASSERT_TRUE(cen::gl::is_compressed_format(0x93DD));
+  ASSERT_FALSE(cen::gl::is_compressed_format(0x8058));  // GL_RGBA8
+}
+
+TEST(CompressedTexture, Extensions)
+{
+  using cen::gl::compressed_format;
+
+  const auto s3tc = cen::gl::extensions_of(compressed_format::bc3);
+  ASSERT_STREQ("GL_EXT_texture_compression_s3tc", s3tc[0]);
+  ASSERT_EQ(nullptr, s3tc[1]);
+
+  const auto bptc = cen::gl::extensions_of(compressed_format::bc7_srgb);
+  ASSERT_STREQ("GL_ARB_texture_compression_bptc", bptc[0]);
+  ASSERT_STREQ("GL_EXT_texture_compression_bptc", bptc[1]);
+
+  const auto astc = cen::gl::extensions_of(compressed_format::astc_4x4);
+  ASSERT_STREQ("GL_KHR_texture_compression_astc_ldr", astc[0]);
+}
+
+TEST(CompressedTexture, ParseKTX)
+{
+  constexpr cen::u32 bc3 = 0x83F3;
+
+  const auto image = cen::gl::compressed_image::try_parse(make_ktx(bc3, 64, 32, 7));
+  ASSERT_TRUE(image);
+
+  ASSERT_EQ(cen::gl::compressed_container::ktx, image->container());
+  ASSERT_EQ(cen::gl::compressed_format::bc3, image->format());
+  ASSERT_EQ((cen::iarea{64, 32}), image->size());
+  ASSERT_EQ(7u, image->level_count());
+
+  ASSERT_EQ((cen::iarea{32, 16}), image->level(1).size);
+  ASSERT_EQ((cen::iarea{1, 1}), image->level(6).size);
+  ASSERT_EQ(128u * 16u, image->level(0).bytes);
+  ASSERT_EQ(16u, image->level(6).bytes);
+  ASSERT_EQ(std::byte{0x5A}, *image->level(3).data);
+
+  cen::usize total = 0;
+  for (cen::usize level = 0; level < image->level_count(); ++level) {
+    total += image->level(level).bytes;
+  }
+
+  ASSERT_EQ(total, image->total_bytes());
+
+  // Copies refer to their own data
+  auto source = std::make_unique<cen::gl::compressed_image>(*image);
+  const auto copy = *source;
+  source.reset();
+  ASSERT_NE(image->level(3).data, copy.level(3).data);
+  ASSERT_EQ(std::byte{0x5A}, *copy.level(3).data);
+}
+
+TEST(CompressedTexture, ParseKTXErrors)
+{
+  constexpr cen::u32 bc1 = 0x83F0;
+
+  // Truncated level data
+  auto truncated = make_ktx(bc1, 16, 16, 1);
+  truncated.resize(truncated.size() - 1);
+  ASSERT_FALSE(cen::gl::compressed_image::try_parse(truncated));
+
+  // Uncompressed formats are rejected
+  ASSERT_FALSE(cen::gl::compressed_image::try_parse(make_ktx(0x8058, 16, 16, 1)));
+
+  // Cube maps are rejected
+  auto cube = make_ktx(bc1, 16, 16, 1);
+  put_u32(cube, 52, 6);
+
+  const auto error = cen::gl::compressed_image::try_parse(cube);
+  ASSERT_FALSE(error);
+  ASSERT_EQ(cen::error_code::bad_argument, error.error().code());
+  std::clog << "Cube map KTX error: " << error.error().message() << '\n';
+}
+
+TEST(CompressedTexture, ParseKTX2)
+{
+  constexpr cen::u32 astc_6x6_srgb = 166;  // VK_FORMAT_ASTC_6x6_SRGB_BLOCK
+
+  auto data = make_ktx2(astc_6x6_srgb, 30, 12, 2);
+
+  const auto first = cen::gl::image_bytes(cen::gl::compressed_format::astc_6x6, {30, 12});
+  const auto second = cen::gl::image_bytes(cen::gl::compressed_format::astc_6x6, {15, 6});
+
+  // The smallest level is stored first, as recommended by the specification
+  const auto secondOffset = data.size();
+  const auto firstOffset = secondOffset + second;
+  data.resize(firstOffset + first, std::byte{0x22});
+
+  put_u64(data, 80, firstOffset);
+  put_u64(data, 88, first);
+  put_u64(data, 104, secondOffset);
+  put_u64(data, 112, second);
+
+  const auto image = cen::gl::compressed_image::try_parse(data.data(), data.size());
+  ASSERT_TRUE(image);
+
+  ASSERT_EQ(cen::gl::compressed_container::ktx2, image->container());
+  ASSERT_EQ(cen::gl::compressed_format::astc_6x6_srgb, image->format());
+  ASSERT_EQ(2u, image->level_count());
+  ASSERT_EQ((cen::iarea{15, 6}), image->level(1).size);
+  ASSERT_EQ(5u * 2u * 16u, image->level(0).bytes);
+  ASSERT_EQ(first + second, image->total_bytes());
+
+  // Supercompressed files are rejected
+  put_u32(data, 44, 1);
+  ASSERT_FALSE(cen::gl::compressed_image::try_parse(data));
+}
+
+TEST(CompressedTexture, ParseDDS)
+{
+  const auto dxt5 = cen::gl::compressed_image::try_parse(make_dds("DXT5", 8, 8, 4 * 16));
+  ASSERT_TRUE(dxt5);
+  ASSERT_EQ(cen::gl::compressed_container::dds, dxt5->container());
+  ASSERT_EQ(cen::gl::compressed_format::bc3, dxt5->format());
+  ASSERT_EQ(1u, dxt5->level_count());
+
+  // Mipmapped BC7 with the DX10 header extension
+  auto bc7 = make_dds("DX10", 8, 4, 0);
+  put_u32(bc7, 8, 0x1007 | 0x20000);
+  put_u32(bc7, 28, 4);
+  put_u32(bc7, 128, 98);  // DXGI_FORMAT_BC7_UNORM
+  put_u32(bc7, 132, 3);   // Two-dimensional texture
+  put_u32(bc7, 140, 1);   // Array size
+  put_u32(bc7, 144, 0);
+  bc7.resize(148 + ((2 + 1 + 1 + 1) * 16), std::byte{0x33});
+
+  const auto image = cen::gl::compressed_image::try_parse(bc7);
+  ASSERT_TRUE(image);
+  ASSERT_EQ(cen::gl::compressed_format::bc7, image->format());
+  ASSERT_EQ(4u, image->level_count());
+  ASSERT_EQ((cen::iarea{1, 1}), image->level(3).size);
+  ASSERT_EQ(16u, image->level(3).bytes);
+
+  // Unknown formats and truncated data are rejected
+  ASSERT_FALSE(cen::gl::compressed_image::try_parse(make_dds("RGBG", 8, 8, 256)));
+  ASSERT_FALSE(cen::gl::compressed_image::try_parse(make_dds("DXT1", 8, 8, 31)));
+}
+
+TEST(CompressedTexture, UnknownContainer)
+{
+  const std::vector<std::byte> data(256, std::byte{0x42});
+  ASSERT_FALSE(cen::gl::compressed_image::try_parse(data));
+  ASSERT_FALSE(cen::gl::compressed_image::try_load("foo.ktx"));
+}
+
+TEST(CompressedTexture, ContainerToString)
+{
+  ASSERT_THROW(cen::gl::to_string(static_cast<cen::gl::compressed_container>(3)),
+               cen::cen_error);
+
+  ASSERT_EQ("ktx", cen::gl::to_string(cen::gl::compressed_container::ktx));
+  ASSERT_EQ("ktx2", cen::gl::to_string(cen::gl::compressed_container::ktx2));
+  ASSERT_EQ("dds", cen::gl::to_string(cen::gl::compressed_container::dds));
+
+  std::clog << "Compressed container example: " << cen::gl::compressed_container::ktx2
+            << '\n';
+}
@@ -0,0 +1,44 @@
+#include "video/opengl/gl_gpu_profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_final_v
+
+static_assert(std::is_final_v<cen::gl::gpu_profiler>);
+static_assert(std::is_final_v<cen::gl::gpu_zone>);
+
+static_assert(!std::is_copy_constructible_v<cen::gl::gpu_profiler>);
+static_assert(!std::is_copy_assignable_v<cen::gl::gpu_profiler>);
+
+static_assert(!std::is_copy_constructible_v<cen::gl::gpu_zone>);
+static_assert(!std::is_copy_assignable_v<cen::gl::gpu_zone>);
+
+TEST(GPUProfiler, Defaults)
+{
+  const cen::gl::gpu_profiler gpu;
+  ASSERT_EQ(3u, gpu.latency());
+  ASSERT_EQ(0u, gpu.dropped());
+  ASSERT_EQ(0u, gpu.frame_time().count());
+  ASSERT_TRUE(gpu.passes().empty());
+  ASSERT_FALSE(gpu.find("pass"));
+
+  const cen::gl::gpu_profiler custom{5};
+  ASSERT_EQ(5u, custom.latency());
+}
+
+TEST(GPUProfiler, WithoutTimerQueries)
+{
+  cen::gl::gpu_profiler gpu;
+
+  // There is no current context, so the passes can only be measured if the driver
+  // resolves functions without one, which isn't tested here
+  if (!gpu.is_complete()) {
+    {
+      cen::gl::gpu_zone zone{gpu, "pass"};
+    }
+
+    gpu.end_frame();
+    ASSERT_TRUE(gpu.passes().empty());
+    ASSERT_EQ(0u, gpu.dropped());
+  }
+}
@@ -0,0 +1,102 @@
+#include "video/image_loader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::image_loader>);
+static_assert(!std::is_copy_assignable_v<cen::image_loader>);
+
+class ImageLoaderTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+
+  inline constexpr static auto m_path = "resources/panda.png";
+};
+
+TEST_F(ImageLoaderTest, Defaults)
+{
+  cen::image_loader loader{3};
+  ASSERT_EQ(3u, loader.worker_count());
+  ASSERT_EQ(0u, loader.remaining());
+  ASSERT_TRUE(loader.is_done());
+  ASSERT_EQ(0u, loader.upload(*m_renderer));
+  ASSERT_EQ(cen::image_loader::load_status::unknown, loader.status(42));
+}
+
+TEST_F(ImageLoaderTest, Load)
+{
+  cen::image_loader loader;
+
+  std::vector<cen::image_loader::id_type> ids;
+  for (auto i = 0; i < 8; ++i) {
+    ids.push_back(loader.enqueue(m_path));
+  }
+
+  ASSERT_EQ(8u, loader.remaining());
+
+  while (!loader.is_done()) {
+    loader.wait();
+    loader.upload(*m_renderer);
+  }
+
+  for (const auto id : ids) {
+    ASSERT_EQ(cen::image_loader::load_status::ready, loader.status(id));
+
+    const auto texture = loader.take(id);
+    ASSERT_TRUE(texture);
+    ASSERT_EQ(200, texture->width());
+    ASSERT_EQ(150, texture->height());
+
+    ASSERT_EQ(cen::image_loader::load_status::unknown, loader.status(id));
+    ASSERT_FALSE(loader.take(id));
+  }
+}
+
+TEST_F(ImageLoaderTest, UploadBudget)
+{
+  cen::image_loader loader;
+
+  loader.enqueue(m_path);
+  loader.enqueue(m_path);
+  loader.wait();
+
+  // At least one image is uploaded per call, regardless of the budget
+  ASSERT_EQ(1u, loader.upload(*m_renderer, 1));
+  ASSERT_EQ(1u, loader.remaining());
+
+  ASSERT_EQ(1u, loader.upload(*m_renderer, 1));
+  ASSERT_TRUE(loader.is_done());
+}
+
+TEST_F(ImageLoaderTest, Failure)
+{
+  cen::image_loader loader;
+
+  const auto id = loader.enqueue("foo.png");
+  loader.wait();
+
+  ASSERT_TRUE(loader.is_done());
+  ASSERT_EQ(cen::image_loader::load_status::failed, loader.status(id));
+  ASSERT_TRUE(loader.error(id));
+  ASSERT_FALSE(loader.take(id));
+}
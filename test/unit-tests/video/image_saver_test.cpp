@@ -0,0 +1,129 @@
+#include "video/image_saver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>     // optional
+#include <string>       // string
+#include <type_traits>  // is_final_v
+#include <utility>      // move
+
+#include "filesystem/file.hpp"
+#include "filesystem/preferred_path.hpp"
+#include "video/colors.hpp"
+
+static_assert(std::is_final_v<cen::image_saver>);
+
+static_assert(!std::is_copy_constructible_v<cen::image_saver>);
+static_assert(!std::is_copy_assignable_v<cen::image_saver>);
+
+class ImageSaverTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+
+  [[nodiscard]] static auto make_image() -> cen::surface
+  {
+    cen::surface image{{32, 16}, cen::pixel_format::rgba32};
+    image.set_pixel({4, 4}, cen::colors::orange);
+    return image;
+  }
+
+  // Polls until every save has been delivered
+  static void finish(cen::task_scheduler& scheduler,
+                     cen::io_service& io,
+                     cen::image_saver& saver)
+  {
+    while (saver.in_flight() != 0) {
+      scheduler.wait();
+      saver.poll();
+      io.wait();
+      io.poll();
+    }
+  }
+};
+
+TEST_F(ImageSaverTest, SavePNG)
+{
+  cen::task_scheduler scheduler{2};
+  cen::io_service io{1};
+  cen::image_saver saver{scheduler, io};
+
+  const auto path = prefs + "image_saver.png";
+
+  std::optional<cen::image_save_result> saved;
+  const auto id = saver.save_png(make_image(), path, [&](const cen::image_save_result& r) {
+    saved = r;
+  });
+
+  ASSERT_TRUE(id);
+  ASSERT_EQ(1u, saver.in_flight());
+
+  finish(scheduler, io, saver);
+
+  ASSERT_TRUE(saved);
+  ASSERT_TRUE(saved->succeeded);
+  ASSERT_EQ(*id, saved->id);
+  ASSERT_EQ(path, saved->path);
+  ASSERT_LT(0u, saved->bytes);
+
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+  ASSERT_EQ(cen::image_format::png, file.detect_image_format());
+}
+
+TEST_F(ImageSaverTest, SaveJPG)
+{
+  cen::task_scheduler scheduler{2};
+  cen::io_service io{1};
+  cen::image_saver saver{scheduler, io};
+
+  const auto path = prefs + "image_saver.jpg";
+  const auto image = make_image();
+
+  std::optional<cen::image_save_result> saved;
+  ASSERT_TRUE(saver.save_jpg(image, path, 80, [&](const cen::image_save_result& r) {
+    saved = r;
+  }));
+
+  finish(scheduler, io, saver);
+
+  ASSERT_TRUE(saved);
+  ASSERT_TRUE(saved->succeeded);
+
+  // The original surface is left untouched
+  ASSERT_TRUE(image.get());
+}
+
+TEST_F(ImageSaverTest, Capacity)
+{
+  cen::task_scheduler scheduler{1};
+  cen::io_service io{1};
+  cen::image_saver saver{scheduler, io, 2};
+  ASSERT_EQ(2u, saver.capacity());
+
+  ASSERT_TRUE(saver.save_png(make_image(), prefs + "image_saver_a.png"));
+  ASSERT_TRUE(saver.save_png(make_image(), prefs + "image_saver_b.png"));
+  ASSERT_FALSE(saver.save_png(make_image(), prefs + "image_saver_c.png"));
+
+  finish(scheduler, io, saver);
+  ASSERT_EQ(0u, saver.in_flight());
+
+  ASSERT_TRUE(saver.save_png(make_image(), prefs + "image_saver_c.png"));
+  finish(scheduler, io, saver);
+}
+
+TEST_F(ImageSaverTest, InvalidPath)
+{
+  cen::task_scheduler scheduler{1};
+  cen::io_service io{1};
+  cen::image_saver saver{scheduler, io};
+
+  std::optional<cen::image_save_result> saved;
+  saver.save_png(make_image(), "no/such/directory/image.png",
+                 [&](const cen::image_save_result& result) { saved = result; });
+
+  finish(scheduler, io, saver);
+
+  ASSERT_TRUE(saved);
+  ASSERT_FALSE(saved->succeeded);
+}
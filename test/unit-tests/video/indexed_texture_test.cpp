@@ -0,0 +1,126 @@
+#include "video/indexed_texture.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_final_v
+#include <vector>       // vector
+
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::indexed_texture>);
+
+class IndexedTextureTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  // Row y uses index y, except for the last row, which uses index 0
+  [[nodiscard]] static auto make_texture() -> cen::indexed_texture
+  {
+    std::vector<cen::u8> indices(8 * 4);
+    for (auto y = 0; y < 3; ++y) {
+      for (auto x = 0; x < 8; ++x) {
+        indices[static_cast<std::size_t>(y * 8 + x)] = static_cast<cen::u8>(y);
+      }
+    }
+
+    cen::palette palette{4};
+    palette.set_color(0, cen::colors::black);
+    palette.set_color(1, cen::colors::red);
+    palette.set_color(2, cen::colors::lime);
+    palette.set_color(3, cen::colors::blue);
+
+    return cen::indexed_texture{*m_renderer, {8, 4}, indices.data(), 8, palette};
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(IndexedTextureTest, Construction)
+{
+  auto texture = make_texture();
+  ASSERT_EQ(8, texture.size().width);
+  ASSERT_EQ(4, texture.size().height);
+  ASSERT_EQ(cen::texture_access::streaming, texture.get().access());
+
+  ASSERT_EQ(cen::colors::red, texture.get_color(1));
+  ASSERT_EQ(1, texture.get_index({3, 1}));
+
+  // Nothing has changed since the texture was created
+  ASSERT_EQ(0u, texture.update());
+
+  cen::surface rgba{{4, 4}, cen::pixel_format::rgba32};
+  ASSERT_THROW(cen::indexed_texture(*m_renderer, rgba), cen::cen_error);
+
+  const cen::surface indexed = rgba.convert(cen::pixel_format::index8);
+  ASSERT_NO_THROW(cen::indexed_texture(*m_renderer, indexed));
+}
+
+TEST_F(IndexedTextureTest, SetColor)
+{
+  auto texture = make_texture();
+
+  // Setting a color to its current value doesn't cause an upload
+  texture.set_color(1, cen::colors::red);
+  ASSERT_EQ(0u, texture.update());
+
+  texture.set_color(1, cen::colors::orange);
+  ASSERT_EQ(cen::colors::orange, texture.get_color(1));
+  ASSERT_EQ(1u, texture.update());
+
+  // Index 0 is used by the first and last rows
+  texture.set_color(0, cen::colors::white);
+  texture.set_color(2, cen::colors::white);
+  ASSERT_EQ(3u, texture.update());
+
+  // Index 3 isn't used by any row
+  texture.set_color(3, cen::colors::white);
+  ASSERT_EQ(0u, texture.update());
+}
+
+TEST_F(IndexedTextureTest, Cycle)
+{
+  auto texture = make_texture();
+
+  texture.cycle(1, 3);
+  ASSERT_EQ(cen::colors::blue, texture.get_color(1));
+  ASSERT_EQ(cen::colors::red, texture.get_color(2));
+  ASSERT_EQ(cen::colors::lime, texture.get_color(3));
+  ASSERT_EQ(2u, texture.update());
+
+  // A full rotation leaves the colors unchanged
+  texture.cycle(1, 3, 3);
+  ASSERT_EQ(0u, texture.update());
+}
+
+TEST_F(IndexedTextureTest, SetIndex)
+{
+  auto texture = make_texture();
+
+  texture.set_index({2, 2}, 3);
+  ASSERT_EQ(3, texture.get_index({2, 2}));
+  ASSERT_EQ(1u, texture.update());
+
+  // Out of bounds pixels are ignored
+  texture.set_index({-1, 0}, 1);
+  texture.set_index({8, 0}, 1);
+  ASSERT_EQ(0u, texture.update());
+
+  // The row now uses index 3
+  texture.set_color(3, cen::colors::white);
+  ASSERT_EQ(1u, texture.update());
+}
@@ -0,0 +1,127 @@
+#include "video/multi_window_presenter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+class MultiWindowPresenterTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_first = std::make_unique<cen::window>();
+    m_second = std::make_unique<cen::window>();
+    m_firstRenderer = std::make_unique<cen::renderer>(*m_first);
+    m_secondRenderer = std::make_unique<cen::renderer>(*m_second);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_secondRenderer.reset();
+    m_firstRenderer.reset();
+    m_second.reset();
+    m_first.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_first;
+  inline static std::unique_ptr<cen::window> m_second;
+  inline static std::unique_ptr<cen::renderer> m_firstRenderer;
+  inline static std::unique_ptr<cen::renderer> m_secondRenderer;
+};
+
+TEST_F(MultiWindowPresenterTest, AddAndRemove)
+{
+  cen::multi_window_presenter presenter;
+  ASSERT_EQ(0u, presenter.size());
+  ASSERT_EQ(0u, presenter.sync_window());
+
+  const auto noop = [](cen::renderer_handle&, const cen::irect&) {};
+  const auto id = presenter.add(*m_first, *m_firstRenderer, noop);
+  ASSERT_EQ(m_first->id(), id);
+  ASSERT_TRUE(presenter.contains(id));
+  ASSERT_TRUE(presenter.is_damaged(id));
+
+  // Windows are only added once
+  presenter.add(*m_first, *m_firstRenderer, noop);
+  ASSERT_EQ(1u, presenter.size());
+
+  ASSERT_TRUE(presenter.remove(id));
+  ASSERT_FALSE(presenter.remove(id));
+  ASSERT_FALSE(presenter.contains(id));
+  ASSERT_EQ(0u, presenter.size());
+}
+
+TEST_F(MultiWindowPresenterTest, Present)
+{
+  cen::multi_window_presenter presenter;
+
+  int firstCalls = 0;
+  int secondCalls = 0;
+  cen::irect damaged;
+
+  const auto first = presenter.add(*m_first,
+                                   *m_firstRenderer,
+                                   [&](cen::renderer_handle&, const cen::irect& area) {
+                                     ++firstCalls;
+                                     damaged = area;
+                                   });
+  const auto second = presenter.add(*m_second,
+                                    *m_secondRenderer,
+                                    [&](cen::renderer_handle&, const cen::irect&) {
+                                      ++secondCalls;
+                                    });
+
+  // Hidden windows are skipped, and keep their damage
+  m_first->show();
+  ASSERT_EQ(1u, presenter.present());
+  ASSERT_EQ(1, firstCalls);
+  ASSERT_EQ(0, secondCalls);
+  ASSERT_FALSE(presenter.is_damaged(first));
+  ASSERT_TRUE(presenter.is_damaged(second));
+  ASSERT_FALSE(presenter.was_synchronized());
+
+  // Windows without damage are skipped
+  ASSERT_EQ(0u, presenter.present());
+  ASSERT_EQ(1, firstCalls);
+
+  presenter.mark(first, {10, 20, 30, 40});
+  ASSERT_EQ(1u, presenter.present());
+  ASSERT_EQ(2, firstCalls);
+  ASSERT_EQ((cen::irect{10, 20, 30, 40}), damaged);
+
+  m_first->hide();
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST_F(MultiWindowPresenterTest, SetSyncWindow)
+{
+  cen::multi_window_presenter presenter;
+
+  const auto noop = [](cen::renderer_handle&, const cen::irect&) {};
+  const auto first = presenter.add(*m_first, *m_firstRenderer, noop);
+  const auto second = presenter.add(*m_second, *m_secondRenderer, noop);
+
+  ASSERT_FALSE(presenter.set_sync_window(first + second + 1));
+
+  ASSERT_TRUE(presenter.set_sync_window(second));
+  ASSERT_EQ(second, presenter.sync_window());
+  ASSERT_FALSE(m_firstRenderer->is_vsync_enabled());
+  ASSERT_TRUE(m_secondRenderer->is_vsync_enabled());
+
+  m_second->show();
+  ASSERT_EQ(1u, presenter.present());
+  ASSERT_TRUE(presenter.was_synchronized());
+  m_second->hide();
+
+  ASSERT_TRUE(presenter.remove(second));
+  ASSERT_EQ(0u, presenter.sync_window());
+
+  ASSERT_TRUE(presenter.set_sync_window(0));
+  ASSERT_FALSE(m_firstRenderer->is_vsync_enabled());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,158 @@
+#include "video/particle_system.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "detail/particle_kernels.hpp"
+#include "video/color.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+TEST(ParticleSystem, Defaults)
+{
+  const cen::particle_system particles{16};
+  ASSERT_TRUE(particles.empty());
+  ASSERT_EQ(0u, particles.size());
+  ASSERT_EQ(16u, particles.capacity());
+}
+
+TEST(ParticleSystem, Emit)
+{
+  cen::particle_system particles{2};
+
+  ASSERT_TRUE(particles.emit({10, 20}, {1, 2}, 1.0f));
+  ASSERT_FALSE(particles.emit({0, 0}, {0, 0}, 0.0f));
+  ASSERT_TRUE(particles.emit({30, 40}, {0, 0}, 1.0f));
+  ASSERT_FALSE(particles.emit({0, 0}, {0, 0}, 1.0f));
+  ASSERT_EQ(2u, particles.size());
+
+  ASSERT_EQ(cen::fpoint(10, 20), particles.position(0));
+  ASSERT_EQ(cen::fpoint(1, 2), particles.velocity(0));
+  ASSERT_EQ(8.0f, particles.size_of(0));
+
+  particles.clear();
+  ASSERT_TRUE(particles.empty());
+}
+
+TEST(ParticleSystem, Update)
+{
+  cen::particle_system particles{8};
+  particles.set_gravity({0, 10});
+  particles.set_damping(0.5f);
+  particles.set_colors(cen::color{255, 255, 255, 255}, cen::color{0, 0, 0, 0});
+  particles.set_sizes(10, 20);
+
+  ASSERT_TRUE(particles.emit({0, 0}, {8, 0}, 1.0f));
+  particles.update(0.5f);
+
+  // v = v * damping + g * dt, x = x + v * dt
+  ASSERT_FLOAT_EQ(4.0f, particles.velocity(0).x());
+  ASSERT_FLOAT_EQ(5.0f, particles.velocity(0).y());
+  ASSERT_FLOAT_EQ(2.0f, particles.position(0).x());
+  ASSERT_FLOAT_EQ(2.5f, particles.position(0).y());
+
+  ASSERT_EQ(128, particles.color_of(0).red());
+  ASSERT_EQ(128, particles.color_of(0).alpha());
+  ASSERT_FLOAT_EQ(15.0f, particles.size_of(0));
+}
+
+TEST(ParticleSystem, Compaction)
+{
+  cen::particle_system particles{8};
+
+  for (int index = 0; index < 8; ++index) {
+    const auto lifetime = (index % 2 == 0) ? 0.5f : 2.0f;
+    ASSERT_TRUE(particles.emit({static_cast<float>(index), 0}, {0, 0}, lifetime));
+  }
+
+  // The particles with even indices die, and the order of the others is preserved
+  particles.update(1.0f);
+  ASSERT_EQ(4u, particles.size());
+
+  for (cen::usize index = 0; index < particles.size(); ++index) {
+    ASSERT_EQ(static_cast<float>(index * 2 + 1), particles.position(index).x());
+  }
+
+  // Dead particles free up space for new particles
+  ASSERT_TRUE(particles.emit({0, 0}, {0, 0}, 1.0f));
+  ASSERT_EQ(5u, particles.size());
+
+  particles.update(2.0f);
+  ASSERT_TRUE(particles.empty());
+}
+
+TEST(ParticleSystem, KernelsMatchScalar)
+{
+  // An odd amount of values, so that the scalar tails of the vectorized kernels are used
+  constexpr cen::usize count = 13;
+
+  std::vector<float> positions(count);
+  std::vector<float> velocities(count);
+  std::vector<float> ages(count);
+  std::vector<float> inverseLifetimes(count);
+
+  for (cen::usize index = 0; index < count; ++index) {
+    positions[index] = static_cast<float>(index) * 0.3f;
+    velocities[index] = static_cast<float>(index) * -0.7f;
+    inverseLifetimes[index] = 1.0f / (static_cast<float>(index) + 0.5f);
+  }
+
+  auto expectedPositions = positions;
+  auto expectedVelocities = velocities;
+  auto expectedAges = ages;
+  std::vector<float> progress(count);
+  std::vector<float> expectedProgress(count);
+
+  cen::detail::integrate_particles(positions.data(),
+                                   velocities.data(),
+                                   count,
+                                   9.8f,
+                                   0.9f,
+                                   0.1f);
+  cen::detail::integrate_particles_scalar(expectedPositions.data(),
+                                          expectedVelocities.data(),
+                                          count,
+                                          9.8f,
+                                          0.9f,
+                                          0.1f);
+  ASSERT_EQ(expectedPositions, positions);
+  ASSERT_EQ(expectedVelocities, velocities);
+
+  cen::detail::age_particles(ages.data(), inverseLifetimes.data(), progress.data(), count, 2);
+  cen::detail::age_particles_scalar(expectedAges.data(),
+                                    inverseLifetimes.data(),
+                                    expectedProgress.data(),
+                                    count,
+                                    2);
+  ASSERT_EQ(expectedAges, ages);
+  ASSERT_EQ(expectedProgress, progress);
+
+  std::vector<float> values(count);
+  std::vector<float> expectedValues(count);
+  cen::detail::lerp_particles(values.data(), progress.data(), count, 255, 0);
+  cen::detail::lerp_particles_scalar(expectedValues.data(), progress.data(), count, 255, 0);
+  ASSERT_EQ(expectedValues, values);
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST(ParticleSystem, Render)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+  const cen::texture texture{renderer, "resources/panda.png"};
+
+  cen::particle_system particles{64};
+  ASSERT_TRUE(particles.render(renderer, texture));
+
+  for (int index = 0; index < 64; ++index) {
+    ASSERT_TRUE(particles.emit({static_cast<float>(index), 10}, {0, 0}, 1.0f));
+  }
+
+  ASSERT_TRUE(particles.render(renderer, texture));
+  ASSERT_TRUE(particles.render(renderer, texture, {{0, 0}, {10, 10}}));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,150 @@
+#include "video/pixel_conversion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <vector>  // vector
+
+#include "core/integers.hpp"
+#include "thread/task_scheduler.hpp"
+
+namespace {
+
+inline constexpr int width = 37;  // Not a multiple of the SIMD width
+inline constexpr int height = 3;
+
+[[nodiscard]] auto make_pixels(const int bytesPerPixel) -> std::vector<cen::u8>
+{
+  std::vector<cen::u8> pixels(static_cast<cen::usize>(width * height * bytesPerPixel));
+  for (cen::usize index = 0; index < pixels.size(); ++index) {
+    pixels[index] = static_cast<cen::u8>(index * 7 + 3);
+  }
+
+  return pixels;
+}
+
+void compare_with_sdl(const cen::pixel_format src,
+                      const int srcBytes,
+                      const cen::pixel_format dst,
+                      const int dstBytes)
+{
+  const auto input = make_pixels(srcBytes);
+  std::vector<cen::u8> expected(static_cast<cen::usize>(width * height * dstBytes));
+  std::vector<cen::u8> actual(expected.size());
+
+  ASSERT_EQ(0,
+            SDL_ConvertPixels(width,
+                              height,
+                              cen::to_underlying(src),
+                              input.data(),
+                              width * srcBytes,
+                              cen::to_underlying(dst),
+                              expected.data(),
+                              width * dstBytes));
+
+  ASSERT_TRUE(cen::convert_pixels({width, height},
+                                  src,
+                                  input.data(),
+                                  width * srcBytes,
+                                  dst,
+                                  actual.data(),
+                                  width * dstBytes));
+
+  ASSERT_EQ(expected, actual);
+}
+
+}  // namespace
+
+TEST(PixelConversion, SameFormat)
+{
+  compare_with_sdl(cen::pixel_format::rgba8888, 4, cen::pixel_format::rgba8888, 4);
+  compare_with_sdl(cen::pixel_format::bgr24, 3, cen::pixel_format::bgr24, 3);
+}
+
+TEST(PixelConversion, PackedToPacked)
+{
+  compare_with_sdl(cen::pixel_format::rgba8888, 4, cen::pixel_format::argb8888, 4);
+  compare_with_sdl(cen::pixel_format::argb8888, 4, cen::pixel_format::abgr8888, 4);
+  compare_with_sdl(cen::pixel_format::abgr8888, 4, cen::pixel_format::bgra8888, 4);
+  compare_with_sdl(cen::pixel_format::rgb888, 4, cen::pixel_format::rgba8888, 4);
+}
+
+TEST(PixelConversion, ArrayToPacked)
+{
+  compare_with_sdl(cen::pixel_format::rgb24, 3, cen::pixel_format::argb8888, 4);
+  compare_with_sdl(cen::pixel_format::bgr24, 3, cen::pixel_format::rgba8888, 4);
+}
+
+TEST(PixelConversion, PackedToArray)
+{
+  compare_with_sdl(cen::pixel_format::argb8888, 4, cen::pixel_format::rgb24, 3);
+  compare_with_sdl(cen::pixel_format::rgba8888, 4, cen::pixel_format::bgr24, 3);
+}
+
+TEST(PixelConversion, Fallback)
+{
+  compare_with_sdl(cen::pixel_format::rgba8888, 4, cen::pixel_format::rgb565, 2);
+}
+
+TEST(PixelConversion, Containers)
+{
+  const std::array<cen::u32, 3> src{0x11223344u, 0xAABBCCDDu, 0x000000FFu};
+  std::vector<cen::u32> dst(src.size());
+
+  ASSERT_TRUE(cen::convert_pixels(cen::pixel_format::rgba8888,
+                                  src,
+                                  cen::pixel_format::argb8888,
+                                  dst));
+
+  ASSERT_EQ(0x44112233u, dst.at(0));
+  ASSERT_EQ(0xDDAABBCCu, dst.at(1));
+  ASSERT_EQ(0xFF000000u, dst.at(2));
+}
+
+TEST(PixelConversion, Parallel)
+{
+  cen::task_scheduler scheduler{3};
+
+  // Large enough to be split into bands of rows
+  constexpr cen::iarea size{640, 480};
+  static_assert(cen::usize{640 * 480} >= cen::parallel_pixel_threshold());
+
+  std::vector<cen::u32> src(static_cast<cen::usize>(size.width * size.height));
+  for (cen::usize index = 0; index < src.size(); ++index) {
+    src[index] = static_cast<cen::u32>(index) * 2'654'435'761u;
+  }
+
+  std::vector<cen::u32> expected(src.size());
+  std::vector<cen::u32> actual(src.size());
+
+  ASSERT_TRUE(cen::convert_pixels(size,
+                                  cen::pixel_format::rgba8888,
+                                  src.data(),
+                                  size.width * 4,
+                                  cen::pixel_format::bgra8888,
+                                  expected.data(),
+                                  size.width * 4));
+
+  ASSERT_TRUE(cen::convert_pixels(size,
+                                  cen::pixel_format::rgba8888,
+                                  src.data(),
+                                  size.width * 4,
+                                  cen::pixel_format::bgra8888,
+                                  actual.data(),
+                                  size.width * 4,
+                                  scheduler));
+
+  ASSERT_EQ(expected, actual);
+
+  // Converting in place is fine as well, since the bands don't overlap
+  ASSERT_TRUE(cen::convert_pixels(size,
+                                  cen::pixel_format::rgba8888,
+                                  src.data(),
+                                  size.width * 4,
+                                  cen::pixel_format::bgra8888,
+                                  src.data(),
+                                  size.width * 4,
+                                  scheduler));
+
+  ASSERT_EQ(expected, src);
+}
@@ -0,0 +1,109 @@
+#include "video/pixel_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>        // array
+#include <type_traits>  // is_copy_constructible_v
+#include <vector>       // vector
+
+#include "core/exception.hpp"
+#include "video/colors.hpp"
+#include "video/surface.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::pixel_view>);
+static_assert(!std::is_copy_assignable_v<cen::pixel_view>);
+
+TEST(PixelView, Construction)
+{
+  cen::surface surface{{16, 8}, cen::pixel_format::rgba8888};
+  ASSERT_NO_THROW(cen::pixel_view{surface});
+
+  cen::surface invalid{{16, 8}, cen::pixel_format::rgb565};
+  ASSERT_THROW(cen::pixel_view{invalid}, cen::cen_error);
+}
+
+TEST(PixelView, Defaults)
+{
+  cen::surface surface{{16, 8}, cen::pixel_format::rgba8888};
+  const cen::pixel_view view{surface};
+
+  ASSERT_EQ(16, view.width());
+  ASSERT_EQ(8, view.height());
+  ASSERT_EQ(surface.size(), view.size());
+  ASSERT_EQ(surface.pitch(), view.pitch());
+  ASSERT_EQ(cen::pixel_format::rgba8888, view.format_info().format());
+
+  ASSERT_TRUE(view.in_bounds({0, 0}));
+  ASSERT_TRUE(view.in_bounds({15, 7}));
+  ASSERT_FALSE(view.in_bounds({16, 7}));
+  ASSERT_FALSE(view.in_bounds({-1, 0}));
+}
+
+TEST(PixelView, SetPixel)
+{
+  cen::surface surface{{16, 8}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  view.set_pixel({3, 5}, cen::colors::red);
+  ASSERT_EQ(cen::colors::red, view.get_pixel({3, 5}));
+  ASSERT_EQ(view.map(cen::colors::red), view.at({3, 5}));
+  ASSERT_EQ(view.map(cen::colors::red), view.row(5)[3]);
+  ASSERT_EQ(cen::colors::red, view.unmap(view.map(cen::colors::red)));
+}
+
+TEST(PixelView, Fill)
+{
+  cen::surface surface{{16, 8}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  view.fill(cen::colors::blue);
+  ASSERT_EQ(cen::colors::blue, view.get_pixel({0, 0}));
+  ASSERT_EQ(cen::colors::blue, view.get_pixel({15, 7}));
+
+  // The area is clamped to the surface
+  view.fill({{-4, 6}, {8, 10}}, cen::colors::green);
+  ASSERT_EQ(cen::colors::green, view.get_pixel({0, 7}));
+  ASSERT_EQ(cen::colors::green, view.get_pixel({3, 6}));
+  ASSERT_EQ(cen::colors::blue, view.get_pixel({4, 6}));
+  ASSERT_EQ(cen::colors::blue, view.get_pixel({0, 5}));
+}
+
+TEST(PixelView, BlitRow)
+{
+  cen::surface surface{{4, 2}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  view.fill(cen::colors::black);
+
+  const auto white = view.map(cen::colors::white);
+  const std::array<cen::u32, 3> pixels{white, white, white};
+
+  view.blit_row(1, pixels, 2);
+  ASSERT_EQ(cen::colors::black, view.get_pixel({1, 1}));
+  ASSERT_EQ(cen::colors::white, view.get_pixel({2, 1}));
+  ASSERT_EQ(cen::colors::white, view.get_pixel({3, 1}));
+
+  view.blit_row(0, pixels, -2);
+  ASSERT_EQ(cen::colors::white, view.get_pixel({0, 0}));
+  ASSERT_EQ(cen::colors::black, view.get_pixel({1, 0}));
+
+  ASSERT_NO_THROW(view.blit_row(0, std::vector<cen::u32>{}, 10));
+}
+
+TEST(PixelView, ForEachPixel)
+{
+  cen::surface surface{{16, 8}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  view.for_each_pixel([](const cen::ipoint pos) {
+    return (pos.x() + pos.y()) % 2 == 0 ? cen::colors::white : cen::colors::black;
+  });
+
+  ASSERT_EQ(cen::colors::white, view.get_pixel({0, 0}));
+  ASSERT_EQ(cen::colors::black, view.get_pixel({1, 0}));
+  ASSERT_EQ(cen::colors::white, view.get_pixel({1, 1}));
+
+  const auto red = view.map(cen::colors::red);
+  view.for_each_pixel([red](const cen::ipoint, cen::u32& pixel) { pixel = red; });
+  ASSERT_EQ(cen::colors::red, view.get_pixel({7, 3}));
+}
@@ -0,0 +1,198 @@
+#include "video/render_command_list.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>  // optional
+#include <string>    // string, to_string
+#include <vector>    // vector
+
+#include "video/colors.hpp"
+
+namespace {
+
+// Records the calls made by the command lists, rather than rendering anything
+struct call_recorder final
+{
+  std::vector<std::string> calls;
+
+  auto set_color(const cen::color& color) -> cen::result
+  {
+    calls.push_back("set_color " + std::to_string(color.red()));
+    return cen::success;
+  }
+
+  auto set_blend_mode(const cen::blend_mode mode) -> cen::result
+  {
+    calls.push_back("set_blend_mode " + std::to_string(static_cast<int>(mode)));
+    return cen::success;
+  }
+
+  template <typename T>
+  auto set_target(cen::basic_texture<T>&) -> cen::result
+  {
+    calls.emplace_back("set_target");
+    return cen::success;
+  }
+
+  auto reset_target() -> cen::result
+  {
+    calls.emplace_back("reset_target");
+    return cen::success;
+  }
+
+  auto set_clip(const std::optional<cen::irect> area) -> cen::result
+  {
+    calls.emplace_back(area ? "set_clip" : "reset_clip");
+    return cen::success;
+  }
+
+  void clear_with(const cen::color&)
+  {
+    calls.emplace_back("clear_with");
+  }
+
+  auto draw_rect(const cen::frect& rect) -> cen::result
+  {
+    calls.push_back("draw_rect " + std::to_string(static_cast<int>(rect.x())));
+    return cen::success;
+  }
+
+  auto fill_rect(const cen::frect& rect) -> cen::result
+  {
+    calls.push_back("fill_rect " + std::to_string(static_cast<int>(rect.x())));
+    return cen::failure;
+  }
+
+  auto draw_line(const cen::fpoint&, const cen::fpoint&) -> cen::result
+  {
+    calls.emplace_back("draw_line");
+    return cen::success;
+  }
+
+  template <typename T>
+  auto render(const cen::basic_texture<T>&, const cen::frect&) -> cen::result
+  {
+    calls.emplace_back("render");
+    return cen::success;
+  }
+
+  template <typename T>
+  auto render(const cen::basic_texture<T>&, const cen::irect&, const cen::frect&)
+      -> cen::result
+  {
+    calls.emplace_back("render_region");
+    return cen::success;
+  }
+
+  template <typename T>
+  auto render(const cen::basic_texture<T>&,
+              const cen::irect&,
+              const cen::frect&,
+              const double angle,
+              const cen::fpoint&,
+              const SDL_RendererFlip) -> cen::result
+  {
+    calls.push_back("render_ex " + std::to_string(static_cast<int>(angle)));
+    return cen::success;
+  }
+};
+
+}  // namespace
+
+TEST(RenderCommandList, Defaults)
+{
+  const cen::render_command_list list;
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(0u, list.size());
+}
+
+TEST(RenderCommandList, Replay)
+{
+  const cen::texture_handle texture{nullptr};
+
+  cen::render_command_list list;
+  list.set_color(cen::colors::red);
+  list.set_blend_mode(cen::blend_mode::add);
+  list.set_target(texture);
+  list.set_clip(cen::irect{0, 0, 10, 10});
+  list.clear_with(cen::colors::black);
+  list.draw_rect(cen::frect{1, 2, 3, 4});
+  list.draw_line(cen::fpoint{0, 0}, cen::fpoint{5, 5});
+  list.render(texture, cen::frect{0, 0, 8, 8});
+  list.render(texture, cen::irect{0, 0, 4, 4}, cen::frect{0, 0, 8, 8});
+  list.render(texture, cen::irect{0, 0, 4, 4}, cen::frect{0, 0, 8, 8}, 90, cen::fpoint{});
+  list.reset_clip();
+  list.reset_target();
+  ASSERT_EQ(12u, list.size());
+
+  call_recorder renderer;
+  ASSERT_TRUE(list.replay(renderer));
+
+  const std::vector<std::string> expected{
+      "set_color 255",
+      "set_blend_mode " + std::to_string(static_cast<int>(cen::blend_mode::add)),
+      "set_target",
+      "set_clip",
+      "clear_with",
+      "draw_rect 1",
+      "draw_line",
+      "render",
+      "render_region",
+      "render_ex 90",
+      "reset_clip",
+      "reset_target"};
+  ASSERT_EQ(expected, renderer.calls);
+
+  // The list is kept after a replay
+  ASSERT_EQ(12u, list.size());
+
+  list.clear();
+  ASSERT_TRUE(list.empty());
+}
+
+TEST(RenderCommandList, ReplayFailure)
+{
+  cen::render_command_list list;
+  list.fill_rect(cen::frect{1, 1, 1, 1});
+  list.draw_rect(cen::frect{2, 2, 2, 2});
+
+  call_recorder renderer;
+  ASSERT_FALSE(list.replay(renderer));
+
+  // The remaining commands are still executed
+  ASSERT_EQ(2u, renderer.calls.size());
+}
+
+TEST(ParallelRenderRecorder, RecordInOrder)
+{
+  cen::task_scheduler scheduler{3};
+  cen::parallel_render_recorder recorder{scheduler};
+
+  constexpr cen::usize count = 100;
+  recorder.record(count, [](cen::render_command_list& list, const cen::usize index) {
+    list.draw_rect(cen::frect{static_cast<float>(index), 0, 1, 1});
+  });
+
+  ASSERT_EQ(count, recorder.size());
+  ASSERT_EQ(4u, recorder.list_count());
+
+  // Subsequent passes are appended
+  recorder.record(2, [](cen::render_command_list& list, const cen::usize index) {
+    list.draw_rect(cen::frect{static_cast<float>(count + index), 0, 1, 1});
+  });
+
+  ASSERT_EQ(count + 2, recorder.size());
+  ASSERT_EQ(6u, recorder.list_count());
+
+  call_recorder renderer;
+  ASSERT_TRUE(recorder.replay(renderer));
+  ASSERT_EQ(count + 2, renderer.calls.size());
+
+  for (cen::usize index = 0; index < renderer.calls.size(); ++index) {
+    ASSERT_EQ("draw_rect " + std::to_string(index), renderer.calls[index]);
+  }
+
+  recorder.clear();
+  ASSERT_EQ(0u, recorder.size());
+  ASSERT_EQ(0u, recorder.list_count());
+}
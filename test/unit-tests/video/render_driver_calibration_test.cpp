@@ -0,0 +1,110 @@
+#include "video/render_driver_calibration.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>       // remove
+#include <string>       // string
+#include <type_traits>  // is_final_v
+
+#include "filesystem/preferred_path.hpp"
+
+static_assert(std::is_final_v<cen::render_driver_calibration>);
+
+class RenderDriverCalibrationTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    std::remove(m_calibration.path().c_str());
+    m_calibration.set_frame_count(5);
+  }
+
+  void TearDown() override
+  {
+    std::remove(m_calibration.path().c_str());
+  }
+
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+
+  cen::render_driver_calibration m_calibration{prefs};
+};
+
+TEST_F(RenderDriverCalibrationTest, Defaults)
+{
+  const cen::render_driver_calibration calibration{prefs};
+  ASSERT_EQ(60u, calibration.frame_count());
+  ASSERT_EQ(prefs + cen::render_driver_calibration::file_name(), calibration.path());
+  ASSERT_FALSE(calibration.load());
+}
+
+TEST_F(RenderDriverCalibrationTest, SetFrameCount)
+{
+  m_calibration.set_frame_count(0);
+  ASSERT_EQ(1u, m_calibration.frame_count());
+
+  m_calibration.set_frame_count(42);
+  ASSERT_EQ(42u, m_calibration.frame_count());
+}
+
+TEST_F(RenderDriverCalibrationTest, Calibrate)
+{
+  const auto scores = m_calibration.calibrate();
+  ASSERT_FALSE(scores.empty());
+  ASSERT_LE(scores.size(), static_cast<cen::usize>(cen::render_driver_count()));
+
+  for (const auto& score : scores) {
+    ASSERT_FALSE(score.name.empty());
+    ASSERT_LE(0.0, score.frame_time_ms);
+  }
+
+  // Calibrating doesn't store anything
+  ASSERT_FALSE(m_calibration.load());
+}
+
+TEST_F(RenderDriverCalibrationTest, Apply)
+{
+  const auto first = m_calibration.apply();
+  ASSERT_FALSE(first.driver.empty());
+  ASSERT_FALSE(first.scores.empty());
+  ASSERT_FALSE(first.cached);
+  ASSERT_TRUE(first.applied);
+  ASSERT_STREQ(first.driver.c_str(), SDL_GetHint(SDL_HINT_RENDER_DRIVER));
+
+  ASSERT_EQ(first.driver, m_calibration.load());
+
+  const auto second = m_calibration.apply();
+  ASSERT_EQ(first.driver, second.driver);
+  ASSERT_TRUE(second.scores.empty());
+  ASSERT_TRUE(second.cached);
+  ASSERT_TRUE(second.applied);
+
+  // The stored file is a regular hint configuration
+  const auto report = cen::apply_hint_file(m_calibration.path());
+  ASSERT_TRUE(report);
+  ASSERT_EQ(1u, report->applied);
+  ASSERT_TRUE(report->ok());
+}
+
+TEST_F(RenderDriverCalibrationTest, Recalibrate)
+{
+  ASSERT_TRUE(m_calibration.store("software", {}));
+  ASSERT_EQ("software", m_calibration.load());
+
+  const auto report = m_calibration.recalibrate();
+  ASSERT_FALSE(report.cached);
+  ASSERT_FALSE(report.scores.empty());
+  ASSERT_EQ(report.driver, m_calibration.load());
+}
+
+TEST_F(RenderDriverCalibrationTest, LoadRejectsChangedDrivers)
+{
+  {
+    cen::file target{m_calibration.path(), cen::file_mode::write};
+    ASSERT_TRUE(target);
+
+    const std::string text = "# drivers = imaginary\nSDL_RENDER_DRIVER = imaginary\n";
+    ASSERT_EQ(text.size(), target.write(text));
+  }
+
+  ASSERT_FALSE(m_calibration.load());
+}
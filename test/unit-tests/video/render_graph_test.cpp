@@ -0,0 +1,154 @@
+#include "video/render_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <vector>  // vector
+
+#include "core/exception.hpp"
+#include "video/renderer.hpp"
+#include "video/texture_pool.hpp"
+#include "video/window.hpp"
+
+class RenderGraphTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(RenderGraphTest, Order)
+{
+  cen::texture_pool pool;
+  cen::render_graph graph{pool};
+
+  const auto first = graph.create_target({64, 64});
+  const auto second = graph.create_target({64, 64});
+
+  std::vector<int> runs;
+  const auto record = [&](const int pass) {
+    return [&runs, pass](const cen::render_graph::pass_inputs&) { runs.push_back(pass); };
+  };
+
+  // Added in reverse order of their dependencies
+  graph.add_pass({second}, cen::render_graph::backbuffer, record(2));
+  graph.add_pass({first}, second, record(1));
+  graph.add_pass({}, first, record(0));
+
+  ASSERT_FALSE(graph.is_compiled());
+  ASSERT_EQ(3u, graph.execute(*m_renderer));
+  ASSERT_TRUE(graph.is_compiled());
+
+  ASSERT_EQ((std::vector<int>{0, 1, 2}), runs);
+  ASSERT_EQ((std::vector<cen::usize>{2, 1, 0}), graph.order());
+  ASSERT_EQ(3u, graph.pass_count());
+
+  // The render target is restored
+  ASSERT_FALSE(m_renderer->get_render_target());
+}
+
+TEST_F(RenderGraphTest, Aliasing)
+{
+  cen::texture_pool pool;
+  cen::render_graph graph{pool};
+
+  const auto a = graph.create_target({64, 64});
+  const auto b = graph.create_target({64, 64});
+  const auto c = graph.create_target({64, 64});
+  const auto other = graph.create_target({32, 32});
+
+  const auto noop = [](const cen::render_graph::pass_inputs&) {};
+  graph.add_pass({}, a, noop);
+  graph.add_pass({a}, b, noop);
+  graph.add_pass({b}, c, noop);  // A is no longer in use, so C can reuse its texture
+  graph.add_pass({c}, other, noop);
+  graph.add_pass({other}, cen::render_graph::backbuffer, noop);
+
+  graph.compile(*m_renderer);
+  ASSERT_EQ(3u, graph.texture_count());
+}
+
+TEST_F(RenderGraphTest, SkipUnchangedPasses)
+{
+  cen::texture_pool pool;
+  cen::render_graph graph{pool};
+
+  cen::texture scene{*m_renderer,
+                     cen::pixel_format::rgba32,
+                     cen::texture_access::target,
+                     {64, 64}};
+
+  const auto input = graph.import_texture(scene);
+  const auto blurred = graph.create_target({32, 32});
+
+  int blurs = 0;
+  int composites = 0;
+  graph.add_pass({input}, blurred, [&](const cen::render_graph::pass_inputs& inputs) {
+    ASSERT_EQ(1u, inputs.size());
+    ASSERT_EQ(scene.get(), inputs[0].get());
+    ++blurs;
+  });
+
+  graph.add_pass({blurred},
+                 cen::render_graph::backbuffer,
+                 [&](const cen::render_graph::pass_inputs&) { ++composites; });
+
+  ASSERT_EQ(2u, graph.execute(*m_renderer));
+
+  // Nothing changed, so only the backbuffer pass runs
+  ASSERT_EQ(1u, graph.execute(*m_renderer));
+  ASSERT_EQ(1, blurs);
+  ASSERT_EQ(2, composites);
+  ASSERT_EQ(1u, graph.statistics().executed);
+  ASSERT_EQ(1u, graph.statistics().skipped);
+
+  graph.invalidate(input);
+  ASSERT_EQ(2u, graph.execute(*m_renderer));
+  ASSERT_EQ(2, blurs);
+
+  graph.invalidate(blurred);
+  ASSERT_EQ(2u, graph.execute(*m_renderer));
+  ASSERT_EQ(3, blurs);
+}
+
+TEST_F(RenderGraphTest, InvalidGraphs)
+{
+  cen::texture_pool pool;
+  const auto noop = [](const cen::render_graph::pass_inputs&) {};
+
+  {
+    cen::render_graph graph{pool};
+    const auto a = graph.create_target({16, 16});
+    const auto b = graph.create_target({16, 16});
+    graph.add_pass({a}, b, noop);
+    graph.add_pass({b}, a, noop);
+    ASSERT_THROW(graph.compile(*m_renderer), cen::cen_error);
+  }
+
+  {
+    cen::render_graph graph{pool};
+    const auto a = graph.create_target({16, 16});
+    graph.add_pass({}, a, noop);
+    graph.add_pass({}, a, noop);
+    ASSERT_THROW(graph.compile(*m_renderer), cen::cen_error);
+  }
+
+  {
+    cen::render_graph graph{pool};
+    const auto a = graph.create_target({16, 16});
+    graph.add_pass({a}, cen::render_graph::backbuffer, noop);
+    ASSERT_THROW(graph.compile(*m_renderer), cen::cen_error);
+  }
+}
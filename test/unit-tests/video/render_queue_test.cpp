@@ -0,0 +1,137 @@
+#include "video/render_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/blend_mode.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+class RenderQueueTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_first = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+    m_second = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_second.reset();
+    m_first.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_first;
+  inline static std::unique_ptr<cen::texture> m_second;
+};
+
+TEST_F(RenderQueueTest, Defaults)
+{
+  const cen::render_queue queue;
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(0u, queue.size());
+
+  const auto& stats = queue.stats();
+  ASSERT_EQ(0u, stats.submitted);
+  ASSERT_EQ(0u, stats.culled);
+  ASSERT_EQ(0u, stats.drawn);
+  ASSERT_EQ(0u, stats.textureChanges);
+  ASSERT_EQ(0u, stats.blendChanges);
+}
+
+TEST_F(RenderQueueTest, Submit)
+{
+  cen::render_queue queue;
+
+  queue.submit(0, 0, *m_first, {{0, 0}, {10, 10}}, cen::frect{{10, 10}, {20, 20}});
+  queue.submit(1, 0, *m_second, cen::frect{{10, 10}, {20, 20}});
+  ASSERT_FALSE(queue.empty());
+  ASSERT_EQ(2u, queue.size());
+
+  queue.clear();
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(RenderQueueTest, FlushSorted)
+{
+  cen::render_queue queue;
+
+  // Interleaved textures within a layer are grouped, but layers are never mixed
+  for (int i = 0; i < 10; ++i) {
+    const auto& texture = (i % 2 == 0) ? *m_first : *m_second;
+    const auto layer = static_cast<cen::render_queue::layer_type>(i / 5);
+    queue.submit(layer, 0, texture, cen::frect{{10.0f * static_cast<float>(i), 10}, {10, 10}});
+  }
+
+  ASSERT_TRUE(queue.flush(*m_renderer));
+  ASSERT_TRUE(queue.empty());
+
+  const auto& stats = queue.stats();
+  ASSERT_EQ(10u, stats.submitted);
+  ASSERT_EQ(0u, stats.culled);
+  ASSERT_EQ(10u, stats.drawn);
+  ASSERT_EQ(4u, stats.textureChanges);
+  ASSERT_EQ(1u, stats.blendChanges);
+}
+
+TEST_F(RenderQueueTest, FlushBlendModes)
+{
+  cen::render_queue queue;
+
+  const cen::frect dst{{0, 0}, {10, 10}};
+  const cen::irect src{{0, 0}, {10, 10}};
+
+  queue.submit(0, 0, *m_first, src, dst, cen::blend_mode::blend);
+  queue.submit(0, 0, *m_first, src, dst, cen::blend_mode::add);
+  queue.submit(0, 0, *m_first, src, dst, cen::blend_mode::blend);
+  queue.submit(0, 0, *m_first, src, dst, cen::blend_mode::add);
+
+  const auto original = m_first->get_blend_mode();
+  m_first->set_blend_mode(cen::blend_mode::mod);
+
+  ASSERT_TRUE(queue.flush(*m_renderer));
+  ASSERT_EQ(1u, queue.stats().textureChanges);
+  ASSERT_EQ(2u, queue.stats().blendChanges);
+
+  // The previous blend mode of the texture is restored
+  ASSERT_EQ(cen::blend_mode::mod, m_first->get_blend_mode());
+  m_first->set_blend_mode(original);
+}
+
+TEST_F(RenderQueueTest, Culling)
+{
+  cen::render_queue queue;
+
+  const auto viewport = m_renderer->viewport();
+  const auto width = static_cast<float>(viewport.width());
+
+  queue.submit(0, 0, *m_first, cen::frect{{-20, 0}, {10, 10}});
+  queue.submit(0, 0, *m_first, cen::frect{{width, 0}, {10, 10}});
+  queue.submit(0, 0, *m_first, cen::frect{{-5, -5}, {10, 10}});
+
+  ASSERT_TRUE(queue.flush(*m_renderer));
+  ASSERT_EQ(3u, queue.stats().submitted);
+  ASSERT_EQ(2u, queue.stats().culled);
+  ASSERT_EQ(1u, queue.stats().drawn);
+
+  // The destinations are translated by the translation viewport
+  m_renderer->set_translation_viewport({{width, 0}, {10, 10}});
+
+  queue.submit(0, 0, *m_first, cen::frect{{0, 0}, {10, 10}});
+  queue.submit(0, 0, *m_first, cen::frect{{width, 0}, {10, 10}});
+
+  ASSERT_TRUE(queue.flush_t(*m_renderer));
+  ASSERT_EQ(1u, queue.stats().culled);
+  ASSERT_EQ(1u, queue.stats().drawn);
+
+  m_renderer->set_translation_viewport({});
+}
@@ -4,13 +4,18 @@
 
 #include <iostream>  // clog
 #include <memory>    // unique_ptr
+#include <vector>    // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
 #include "math/rect.hpp"
 #include "video/colors.hpp"
 #include "video/font.hpp"
+#include "video/font_cache.hpp"
+#include "video/font_pool.hpp"
+#include "video/geometry_batch.hpp"
 #include "video/graphics_drivers.hpp"
+#include "video/vertex_buffer.hpp"
 #include "video/window.hpp"
 
 using namespace std::string_literals;
@@ -86,6 +91,54 @@ TEST_F(RendererTest, TranslatedFillRect)
   ASSERT_NO_THROW(m_renderer->fill_rect_t<float>({{12, 34}, {56, 78}}));
 }
 
+TEST_F(RendererTest, TranslatedDrawRects)
+{
+  const auto old = m_renderer->translation_viewport();
+  m_renderer->set_translation_viewport({{100, 100}, {200, 150}});
+
+  const std::vector<cen::irect> rects(1'000, cen::irect{{120, 110}, {10, 10}});
+  ASSERT_TRUE(m_renderer->draw_rects_t(rects));
+  ASSERT_TRUE(m_renderer->draw_rects_t(rects, true));
+
+  // Everything is culled, which isn't considered a failure
+  const std::vector<cen::frect> hidden(10, cen::frect{{0, 0}, {50, 50}});
+  ASSERT_TRUE(m_renderer->draw_rects_t(hidden, true));
+
+  ASSERT_FALSE(m_renderer->draw_rects_t(std::vector<cen::frect>{}));
+
+  m_renderer->set_translation_viewport(old);
+}
+
+TEST_F(RendererTest, TranslatedFillRects)
+{
+  const auto old = m_renderer->translation_viewport();
+  m_renderer->set_translation_viewport({{100, 100}, {200, 150}});
+
+  const std::vector<cen::frect> rects(300, cen::frect{{120, 110}, {10, 10}});
+  ASSERT_TRUE(m_renderer->fill_rects_t(rects));
+  ASSERT_TRUE(m_renderer->fill_rects_t(rects, true));
+
+  const std::vector<cen::irect> hidden(10, cen::irect{{400, 400}, {50, 50}});
+  ASSERT_TRUE(m_renderer->fill_rects_t(hidden, true));
+
+  m_renderer->set_translation_viewport(old);
+}
+
+TEST_F(RendererTest, TranslatedDrawPoints)
+{
+  const auto old = m_renderer->translation_viewport();
+  m_renderer->set_translation_viewport({{100, 100}, {200, 150}});
+
+  const std::vector<cen::ipoint> points(600, cen::ipoint{150, 150});
+  ASSERT_TRUE(m_renderer->draw_points_t(points));
+  ASSERT_TRUE(m_renderer->draw_points_t(points, true));
+
+  const std::vector<cen::fpoint> hidden(10, cen::fpoint{50, 50});
+  ASSERT_TRUE(m_renderer->draw_points_t(hidden, true));
+
+  m_renderer->set_translation_viewport(old);
+}
+
 TEST_F(RendererTest, TranslatedRenderWithPoint)
 {
   {
@@ -220,6 +273,22 @@ TEST_F(RendererTest, EmplaceFont)
   m_renderer->remove_font(id);
 }
 
+TEST_F(RendererTest, AddFontFromPool)
+{
+  const cen::font_pool pool{"resources/daniel.ttf"};
+
+  m_renderer->add_font(7, pool, 12);
+  m_renderer->emplace_font(8, pool.data(), 16);
+
+  ASSERT_EQ(12, m_renderer->get_font(7).size());
+  ASSERT_EQ(16, m_renderer->get_font(8).size());
+  ASSERT_EQ(2u, pool.use_count());
+
+  m_renderer->remove_font(7);
+  m_renderer->remove_font(8);
+  ASSERT_EQ(0u, pool.use_count());
+}
+
 TEST_F(RendererTest, RemoveFont)
 {
   ASSERT_NO_THROW(m_renderer->remove_font(0));
@@ -301,6 +370,93 @@ TEST_F(RendererTest, SetLogicalIntegerScaling)
   ASSERT_FALSE(m_renderer->is_using_integer_logical_scaling());
 }
 
+TEST_F(RendererTest, StateCaching)
+{
+  ASSERT_FALSE(m_renderer->is_state_caching());
+
+  m_renderer->set_state_caching(true);
+  ASSERT_TRUE(m_renderer->is_state_caching());
+
+  ASSERT_TRUE(m_renderer->set_color(cen::colors::red));
+  ASSERT_TRUE(m_renderer->set_color(cen::colors::red));
+  ASSERT_TRUE(m_renderer->set_color(cen::colors::blue));
+  ASSERT_EQ(cen::colors::blue, m_renderer->get_color());
+
+  ASSERT_TRUE(m_renderer->set_blend_mode(cen::blend_mode::add));
+  ASSERT_TRUE(m_renderer->set_blend_mode(cen::blend_mode::add));
+
+  ASSERT_TRUE(m_renderer->reset_target());
+  ASSERT_TRUE(m_renderer->reset_target());
+
+  constexpr cen::irect area{{10, 20}, {30, 40}};
+  ASSERT_TRUE(m_renderer->set_viewport(area));
+  ASSERT_TRUE(m_renderer->set_viewport(area));
+  ASSERT_TRUE(m_renderer->set_clip(area));
+  ASSERT_TRUE(m_renderer->set_clip(area));
+  ASSERT_TRUE(m_renderer->set_clip(std::nullopt));
+  ASSERT_TRUE(m_renderer->set_clip(std::nullopt));
+  ASSERT_FALSE(m_renderer->clip().has_value());
+
+  const auto& stats = m_renderer->state_cache_stats();
+  ASSERT_EQ(1u, stats.colors);
+  ASSERT_EQ(1u, stats.blendModes);
+  ASSERT_EQ(1u, stats.targets);
+  ASSERT_EQ(1u, stats.viewports);
+  ASSERT_EQ(2u, stats.clips);
+
+  // The cached state must not be trusted after an external change
+  SDL_SetRenderDrawColor(m_renderer->get(), 0, 0, 0, 0xFF);
+  m_renderer->invalidate_state_cache();
+  ASSERT_TRUE(m_renderer->set_color(cen::colors::blue));
+  ASSERT_EQ(cen::colors::blue, m_renderer->get_color());
+  ASSERT_EQ(1u, stats.colors);
+
+  m_renderer->reset_state_cache_stats();
+  ASSERT_EQ(0u, m_renderer->state_cache_stats().colors);
+
+  m_renderer->set_state_caching(false);
+  ASSERT_TRUE(m_renderer->set_color(cen::colors::blue));
+  ASSERT_EQ(0u, m_renderer->state_cache_stats().colors);
+
+  m_renderer->set_viewport({{}, m_renderer->output_size()});
+  m_renderer->set_blend_mode(cen::blend_mode::blend);
+}
+
+TEST_F(RendererTest, Statistics)
+{
+  ASSERT_FALSE(m_renderer->is_collecting_stats());
+
+  m_renderer->set_stats_collection(true);
+  ASSERT_TRUE(m_renderer->is_collecting_stats());
+
+  m_renderer->fill_rect(cen::irect{{10, 20}, {30, 40}});
+  m_renderer->draw_line(cen::ipoint{0, 0}, cen::ipoint{10, 10});
+  m_renderer->render(*m_texture, cen::ipoint{0, 0});
+  m_renderer->render(*m_texture, cen::ipoint{50, 50});
+  m_renderer->record_upload(64);
+
+  const auto& current = m_renderer->current_stats();
+  ASSERT_EQ(4u, current.drawCalls);
+  ASSERT_EQ(4u, current.primitives);
+  ASSERT_EQ(1u, current.textureSwitches);
+  ASSERT_EQ(64u, current.uploadedBytes);
+
+  m_renderer->present();
+
+  const auto& frame = m_renderer->frame_stats();
+  ASSERT_EQ(4u, frame.drawCalls);
+  ASSERT_EQ(1u, frame.textureSwitches);
+  ASSERT_EQ(0u, m_renderer->current_stats().drawCalls);
+
+  // The texture is counted again in each frame
+  m_renderer->render(*m_texture, cen::ipoint{0, 0});
+  ASSERT_EQ(1u, m_renderer->current_stats().textureSwitches);
+
+  m_renderer->set_stats_collection(false);
+  m_renderer->fill_rect(cen::irect{{10, 20}, {30, 40}});
+  ASSERT_EQ(0u, m_renderer->current_stats().drawCalls);
+}
+
 TEST_F(RendererTest, GetRenderTarget)
 {
   ASSERT_EQ(nullptr, m_renderer->get_render_target().get());
@@ -373,6 +529,133 @@ TEST_F(RendererTest, Capture)
   m_window->hide();
 }
 
+TEST_F(RendererTest, CaptureIntoSurface)
+{
+  m_renderer->clear_with(cen::colors::pink);
+
+  cen::surface snapshot{m_renderer->output_size(), cen::pixel_format::rgba8888};
+  ASSERT_TRUE(m_renderer->capture(snapshot));
+
+  cen::surface invalid{{10, 10}, cen::pixel_format::rgba8888};
+  ASSERT_FALSE(m_renderer->capture(invalid));
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST_F(RendererTest, RenderGeometry)
+{
+  cen::geometry_batch batch;
+  ASSERT_TRUE(m_renderer->render_geometry(batch));
+
+  batch.add_rounded_rect({10, 10, 100, 50}, 8, cen::colors::red);
+  batch.add_line({0, 0}, {100, 100}, 3, cen::colors::blue);
+
+  // All shapes are rendered with a single call
+  m_renderer->set_stats_collection(true);
+  ASSERT_TRUE(m_renderer->render_geometry(batch));
+  ASSERT_EQ(1u, m_renderer->current_stats().drawCalls);
+  ASSERT_EQ(batch.triangle_count(), m_renderer->current_stats().primitives);
+  m_renderer->set_stats_collection(false);
+}
+
+TEST_F(RendererTest, RenderGeometryWithVertexBuffer)
+{
+  cen::vertex_buffer buffer;
+  ASSERT_TRUE(m_renderer->render_geometry(buffer));
+  ASSERT_TRUE(m_renderer->render_geometry(*m_texture, buffer));
+
+  buffer.add_quad({10, 10, 100, 50});
+  buffer.add_quad({20, 80, 40, 40}, {0.5f, 0.5f, 0.5f, 0.5f}, cen::colors::red);
+
+  m_renderer->set_stats_collection(true);
+  ASSERT_TRUE(m_renderer->render_geometry(buffer));
+  ASSERT_TRUE(m_renderer->render_geometry(*m_texture, buffer));
+  ASSERT_EQ(2u, m_renderer->current_stats().drawCalls);
+  ASSERT_EQ(8u, m_renderer->current_stats().primitives);
+  m_renderer->set_stats_collection(false);
+
+  // Unindexed triangles
+  const cen::vertex vertices[] = {cen::make_vertex({0, 0}),
+                                  cen::make_vertex({10, 0}),
+                                  cen::make_vertex({0, 10})};
+  ASSERT_TRUE(m_renderer->render_geometry(vertices, 3));
+  ASSERT_TRUE(m_renderer->render_geometry(*m_texture, vertices, 3));
+}
+
+TEST_F(RendererTest, RenderGeometryRaw)
+{
+  // Positions and texture coordinates in separate arrays, with a single color
+  const std::vector<cen::fpoint> positions = {{0, 0}, {50, 0}, {50, 50}, {0, 50}};
+  const std::vector<cen::fpoint> uvs = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+  const std::vector<cen::u16> indices = {0, 1, 2, 0, 2, 3};
+  const cen::color tint = cen::colors::white;
+
+  const auto geometry =
+      cen::strided_geometry::from(positions.data(), &tint, uvs.data(), positions.size(), 0)
+          .with_indices(indices.data(), indices.size());
+  ASSERT_EQ(2u, geometry.triangle_count());
+
+  m_renderer->set_stats_collection(true);
+  ASSERT_TRUE(m_renderer->render_geometry_raw(*m_texture, geometry));
+  ASSERT_TRUE(m_renderer->render_geometry_raw(geometry));
+  ASSERT_EQ(2u, m_renderer->current_stats().drawCalls);
+  ASSERT_EQ(4u, m_renderer->current_stats().primitives);
+  m_renderer->set_stats_collection(false);
+
+  ASSERT_TRUE(m_renderer->render_geometry_raw(cen::strided_geometry{}));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST_F(RendererTest, RenderTextWithAtlas)
+{
+  cen::font_cache cache{"resources/daniel.ttf", 12};
+  cache.use_atlas();
+  cache.add_basic_latin(*m_renderer);
+
+  const auto next = m_renderer->render_glyph(cache, 'a', {10, 10});
+  ASSERT_GT(next, 10);
+
+  // Glyphs that are not cached are skipped
+  ASSERT_EQ(10, m_renderer->render_glyph(cache, 0x7F, {10, 10}));
+
+  ASSERT_NO_THROW(m_renderer->render_text(cache, "Hello\nWorld!"s, {10, 10}));
+}
+
+TEST_F(RendererTest, PresentTiming)
+{
+  const auto presents = m_renderer->get_present_timing().presents;
+
+  m_renderer->present();
+  m_renderer->present();
+
+  const auto& timing = m_renderer->get_present_timing();
+  ASSERT_EQ(presents + 2, timing.presents);
+  ASSERT_NE(0u, timing.timestamp);
+  ASSERT_LE(timing.blocked.count(), timing.interval.count());
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST_F(RendererTest, SetVSync)
+{
+  const auto enabled = m_renderer->is_vsync_enabled();
+
+  ASSERT_TRUE(m_renderer->set_vsync(cen::vsync_mode::off));
+  ASSERT_FALSE(m_renderer->is_vsync_enabled());
+
+  ASSERT_TRUE(m_renderer->set_vsync(cen::vsync_mode::on));
+  ASSERT_TRUE(m_renderer->is_vsync_enabled());
+
+  // Adaptive VSync depends on the backend, but VSync must remain enabled
+  m_renderer->set_vsync(cen::vsync_mode::adaptive);
+  ASSERT_TRUE(m_renderer->is_vsync_enabled());
+
+  ASSERT_TRUE(m_renderer->set_vsync(enabled ? cen::vsync_mode::on : cen::vsync_mode::off));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
 TEST_F(RendererTest, ToString)
 {
   cen::log::put(cen::to_string(*m_renderer));
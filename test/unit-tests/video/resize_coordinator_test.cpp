@@ -0,0 +1,210 @@
+#include "video/resize_coordinator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_copy_constructible_v
+
+#include "video/renderer.hpp"
+#include "video/texture_pool.hpp"
+#include "video/window.hpp"
+
+using namespace cen::literals;
+
+static_assert(!std::is_copy_constructible_v<cen::resize_coordinator>);
+static_assert(!std::is_copy_assignable_v<cen::resize_coordinator>);
+
+class ResizeCoordinatorTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  void SetUp() override
+  {
+    m_window->set_min_size({1, 1});
+    m_window->set_max_size({0, 0});
+    m_window->set_size(cen::window::default_size());
+  }
+
+  [[nodiscard]] static auto make_event(
+      const Uint32 windowID,
+      const SDL_WindowEventID id = SDL_WINDOWEVENT_SIZE_CHANGED) -> cen::window_event
+  {
+    SDL_WindowEvent e{};
+    e.type = SDL_WINDOWEVENT;
+    e.windowID = windowID;
+    e.event = static_cast<Uint8>(id);
+    return cen::window_event{e};
+  }
+
+  [[nodiscard]] static auto resize_event() -> cen::window_event
+  {
+    return make_event(m_window->id());
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+
+  cen::texture_pool m_pool;
+};
+
+TEST_F(ResizeCoordinatorTest, Defaults)
+{
+  const cen::resize_coordinator resizes{*m_window, *m_renderer, m_pool};
+  ASSERT_EQ(cen::resize_coordinator::default_delay(), resizes.delay());
+  ASSERT_EQ(m_renderer->output_size(), resizes.size());
+  ASSERT_FALSE(resizes.is_resizing());
+  ASSERT_EQ(0u, resizes.texture_count());
+  ASSERT_EQ(0u, resizes.statistics().events);
+}
+
+TEST_F(ResizeCoordinatorTest, AddTarget)
+{
+  cen::resize_coordinator resizes{*m_window, *m_renderer, m_pool};
+
+  const auto full = resizes.add_target(cen::pixel_format::rgba8888);
+  const auto half = resizes.add_target(cen::pixel_format::rgba8888, [](const cen::iarea size) {
+    return cen::iarea{size.width / 2, size.height / 2};
+  });
+
+  ASSERT_NE(full, half);
+  ASSERT_EQ(2u, resizes.texture_count());
+  ASSERT_TRUE(resizes.contains(full));
+  ASSERT_TRUE(resizes.contains(half));
+
+  const auto output = m_renderer->output_size();
+  ASSERT_EQ(output, resizes.get(full).size());
+  ASSERT_EQ((cen::iarea{output.width / 2, output.height / 2}), resizes.get(half).size());
+  ASSERT_EQ(cen::texture_access::target, resizes.get(full).access());
+
+  ASSERT_TRUE(resizes.stretch(full));
+
+  ASSERT_TRUE(resizes.remove(full));
+  ASSERT_FALSE(resizes.remove(full));
+  ASSERT_FALSE(resizes.contains(full));
+  ASSERT_EQ(1u, resizes.texture_count());
+}
+
+TEST_F(ResizeCoordinatorTest, IgnoresUnrelatedEvents)
+{
+  cen::resize_coordinator resizes{*m_window, *m_renderer, m_pool};
+
+  resizes.handle(make_event(m_window->id() + 1));
+  ASSERT_FALSE(resizes.is_resizing());
+
+  resizes.handle(make_event(m_window->id(), SDL_WINDOWEVENT_FOCUS_GAINED));
+  ASSERT_FALSE(resizes.is_resizing());
+  ASSERT_EQ(0u, resizes.statistics().events);
+
+  resizes.handle(make_event(m_window->id(), SDL_WINDOWEVENT_RESIZED));
+  ASSERT_TRUE(resizes.is_resizing());
+  ASSERT_EQ(1u, resizes.statistics().events);
+}
+
+TEST_F(ResizeCoordinatorTest, Debounce)
+{
+  cen::resize_coordinator resizes{*m_window, *m_renderer, m_pool, 10'000_ms};
+  const auto target = resizes.add_target(cen::pixel_format::rgba8888);
+  const auto before = resizes.size();
+
+  m_window->set_width(m_window->width() + 20);
+  for (int i = 0; i < 10; ++i) {
+    resizes.handle(resize_event());
+  }
+
+  // The size hasn't settled, so the target keeps its previous size
+  ASSERT_FALSE(resizes.update());
+  ASSERT_TRUE(resizes.is_resizing());
+  ASSERT_EQ(before, resizes.size());
+  ASSERT_EQ(before, resizes.get(target).size());
+  ASSERT_EQ(10u, resizes.statistics().events);
+  ASSERT_EQ(0u, resizes.statistics().reallocations);
+}
+
+TEST_F(ResizeCoordinatorTest, Update)
+{
+  cen::resize_coordinator resizes{*m_window, *m_renderer, m_pool, 0_ms};
+  const auto target = resizes.add_target(cen::pixel_format::rgba8888);
+
+  cen::usize count = 0;
+  cen::resize_settled settled{};
+  auto listener = [&](const cen::resize_settled& event) {
+    settled = event;
+    ++count;
+  };
+  resizes.listeners().connect(listener);
+
+  ASSERT_FALSE(resizes.update());  // No resize events
+
+  const auto before = resizes.size();
+  m_window->set_width(m_window->width() + 20);
+  resizes.handle(resize_event());
+  resizes.handle(resize_event());
+
+  ASSERT_TRUE(resizes.update());
+  ASSERT_FALSE(resizes.is_resizing());
+  ASSERT_EQ(m_renderer->output_size(), resizes.size());
+  ASSERT_EQ(resizes.size(), resizes.get(target).size());
+
+  ASSERT_EQ(1u, count);
+  ASSERT_EQ(resizes.size(), settled.size);
+  ASSERT_EQ(before, settled.previous);
+  ASSERT_EQ(m_window->size(), settled.window_size);
+
+  const auto& stats = resizes.statistics();
+  ASSERT_EQ(2u, stats.events);
+  ASSERT_EQ(1u, stats.settles);
+  ASSERT_EQ(1u, stats.reallocations);
+
+  // Settling on the same size again does nothing
+  resizes.handle(resize_event());
+  ASSERT_FALSE(resizes.update());
+  ASSERT_EQ(1u, count);
+}
+
+TEST_F(ResizeCoordinatorTest, ResizeBackReusesTextures)
+{
+  cen::resize_coordinator resizes{*m_window, *m_renderer, m_pool, 0_ms};
+  resizes.add_target(cen::pixel_format::rgba8888);
+
+  const auto width = m_window->width();
+
+  m_window->set_width(width + 20);
+  ASSERT_TRUE(resizes.settle());
+
+  m_window->set_width(width);
+  ASSERT_TRUE(resizes.settle());
+
+  // The texture of the original size was recycled by the pool
+  ASSERT_EQ(2u, resizes.statistics().reallocations);
+  ASSERT_EQ(1u, m_pool.idle_count());
+}
+
+TEST_F(ResizeCoordinatorTest, ClampsToWindowLimits)
+{
+  cen::resize_coordinator resizes{*m_window, *m_renderer, m_pool, 0_ms};
+
+  const auto output = m_renderer->output_size();
+  const auto window = m_window->size();
+
+  // The maximum size is smaller than the actual size, e.g. in an intermediate state
+  m_window->set_max_size({window.width / 2, window.height / 2});
+  m_window->set_size(window);
+
+  resizes.settle();
+
+  const auto expected = cen::iarea{output.width * (window.width / 2) / window.width,
+                                   output.height * (window.height / 2) / window.height};
+  ASSERT_NEAR(expected.width, resizes.size().width, 1);
+  ASSERT_NEAR(expected.height, resizes.size().height, 1);
+}
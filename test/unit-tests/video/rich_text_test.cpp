@@ -0,0 +1,147 @@
+#include "video/rich_text.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/colors.hpp"
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class RichTextTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+
+    m_regular = std::make_unique<cen::font_cache>("resources/daniel.ttf", 12);
+    m_regular->use_atlas();
+    m_regular->add_basic_latin(*m_renderer);
+
+    cen::font bold{"resources/daniel.ttf", 12};
+    bold.set_bold(true);
+
+    m_bold = std::make_unique<cen::font_cache>(std::move(bold));
+    m_bold->use_atlas();
+    m_bold->add_basic_latin(*m_renderer);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_bold.reset();
+    m_regular.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::font_cache> m_regular;
+  inline static std::unique_ptr<cen::font_cache> m_bold;
+};
+
+TEST_F(RichTextTest, Defaults)
+{
+  const cen::rich_text text{{m_regular.get()}};
+  ASSERT_TRUE(text.text().empty());
+  ASSERT_TRUE(text.spans().empty());
+  ASSERT_EQ(1u, text.batches().size());
+  ASSERT_EQ(0u, text.glyph_count());
+  ASSERT_EQ(0, text.line_count());
+  ASSERT_EQ(0, text.wrap_width());
+  ASSERT_EQ((cen::iarea{0, 0}), text.size());
+}
+
+TEST_F(RichTextTest, Spans)
+{
+  cen::rich_text text{{m_regular.get(), m_bold.get()}};
+  text.set_markup("a[b]b[/b][color=#FF0000]c[i]d[/i][/color]e[[f");
+
+  ASSERT_EQ(7u, text.text().size());
+  ASSERT_EQ('[', text.text()[5]);
+
+  const auto& spans = text.spans();
+  ASSERT_EQ(5u, spans.size());
+
+  ASSERT_FALSE(spans[0].bold);
+  ASSERT_EQ(cen::colors::white, spans[0].tint);
+
+  ASSERT_TRUE(spans[1].bold);
+  ASSERT_EQ(1u, spans[1].begin);
+  ASSERT_EQ(2u, spans[1].end);
+
+  ASSERT_EQ(cen::colors::red, spans[2].tint);
+  ASSERT_FALSE(spans[2].italic);
+  ASSERT_TRUE(spans[3].italic);
+  ASSERT_EQ(cen::colors::red, spans[3].tint);
+
+  // The escaped bracket and the following text share the last span
+  ASSERT_EQ(4u, spans[4].begin);
+  ASSERT_EQ(7u, spans[4].end);
+  ASSERT_EQ(cen::colors::white, spans[4].tint);
+}
+
+TEST_F(RichTextTest, UnrecognizedTags)
+{
+  cen::rich_text text{{m_regular.get()}};
+  text.set_markup("[x]a[color=oops]");
+  ASSERT_EQ(16u, text.text().size());
+  ASSERT_EQ(1u, text.spans().size());
+}
+
+TEST_F(RichTextTest, Batches)
+{
+  cen::rich_text text{{m_regular.get(), m_bold.get()}};
+  ASSERT_EQ(2u, text.batches().size());
+
+  text.set_markup("ab [b]cd[/b]");
+  ASSERT_EQ(5u, text.glyph_count());
+  ASSERT_EQ(3u, text.batches()[0].glyph_count());
+  ASSERT_EQ(2u, text.batches()[1].glyph_count());
+
+  // Italic text falls back to the regular font cache
+  text.set_markup("ab [i]cd[/i]");
+  ASSERT_EQ(5u, text.batches()[0].glyph_count());
+  ASSERT_TRUE(text.batches()[1].empty());
+}
+
+TEST_F(RichTextTest, Wrapping)
+{
+  cen::rich_text text{{m_regular.get(), m_bold.get()}};
+  text.set_markup("foo [b]bar[/b] foo [b]bar[/b]");
+  ASSERT_EQ(1, text.line_count());
+
+  const auto width = text.size().width;
+  text.set_wrap_width(width / 2);
+  ASSERT_LT(1, text.line_count());
+  ASSERT_GE(width / 2, text.size().width);
+
+  text.set_markup("foo\nbar");
+  ASSERT_EQ(2, text.line_count());
+}
+
+TEST_F(RichTextTest, Position)
+{
+  cen::rich_text text{{m_regular.get()}};
+  text.set_markup("a");
+
+  const auto x = text.batches()[0].vertices(0)[0].position.x;
+
+  text.set_position({10, 20});
+  ASSERT_EQ((cen::ipoint{10, 20}), text.position());
+  ASSERT_FLOAT_EQ(x + 10.0f, text.batches()[0].vertices(0)[0].position.x);
+}
+
+TEST_F(RichTextTest, Render)
+{
+  cen::rich_text text{{m_regular.get(), m_bold.get()}};
+  text.set_markup("[color=#00FF00]Hello[/color], [b]world[/b]!");
+  ASSERT_TRUE(m_renderer->render_text(text));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
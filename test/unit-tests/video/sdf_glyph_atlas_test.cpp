@@ -0,0 +1,163 @@
+#include "video/sdf_glyph_atlas.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>     // unique_ptr
+#include <stdexcept>  // out_of_range
+#include <vector>     // vector
+
+#include "detail/sdf_kernels.hpp"
+#include "thread/task_scheduler.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+namespace {
+
+inline constexpr auto atlasFontPath = "resources/daniel.ttf";
+
+}  // namespace
+
+TEST(SDFKernels, Offsets)
+{
+  const auto offsets = cen::detail::make_sdf_offsets(2);
+  ASSERT_FALSE(offsets.empty());
+  ASSERT_EQ(1, offsets.front().distance);
+  ASSERT_EQ(4, offsets.back().distance);
+
+  for (const auto& offset : offsets) {
+    ASSERT_LE(offset.dx * offset.dx + offset.dy * offset.dy, 4);
+  }
+}
+
+TEST(SDFKernels, DistanceField)
+{
+  // A 4x4 square in the middle of an 8x8 mask
+  const auto width = 8;
+  const auto height = 8;
+  const auto spread = 3;
+
+  std::vector<cen::u8> coverage(width * height, 0);
+  for (auto y = 2; y < 6; ++y) {
+    for (auto x = 2; x < 6; ++x) {
+      coverage[y * width + x] = 0xFF;
+    }
+  }
+
+  const auto fieldWidth = width + 2 * spread;
+  std::vector<cen::u8> field(fieldWidth * (height + 2 * spread));
+
+  const auto offsets = cen::detail::make_sdf_offsets(spread);
+  cen::detail::make_distance_field(coverage.data(),
+                                   width,
+                                   height,
+                                   spread,
+                                   offsets,
+                                   field.data());
+
+  const auto at = [&](const int x, const int y) {
+    return field[(y + spread) * fieldWidth + (x + spread)];
+  };
+
+  // Texels next to the edge are close to the middle value
+  ASSERT_GT(at(2, 3), 127);
+  ASSERT_LT(at(1, 3), 128);
+  ASSERT_EQ(255 - at(2, 3), at(1, 3));
+
+  // The distance increases away from the edge
+  ASSERT_GT(at(3, 3), at(2, 3));
+  ASSERT_LT(at(0, 3), at(1, 3));
+
+  // Distances beyond the spread are clamped
+  ASSERT_EQ(0, field.front());
+  ASSERT_EQ(0, field.back());
+}
+
+class SDFGlyphAtlasTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(SDFGlyphAtlasTest, Defaults)
+{
+  const cen::sdf_glyph_atlas atlas{cen::font{atlasFontPath, 32}};
+  ASSERT_EQ(0u, atlas.size());
+  ASSERT_EQ(0u, atlas.page_count());
+  ASSERT_EQ(32, atlas.base_size());
+  ASSERT_EQ(cen::sdf_glyph_atlas::default_spread, atlas.spread());
+  ASSERT_FALSE(atlas.has('a'));
+  ASSERT_FALSE(atlas.try_at('a'));
+  ASSERT_THROW((void) atlas.page(0), std::out_of_range);
+}
+
+TEST_F(SDFGlyphAtlasTest, AddGlyph)
+{
+  cen::sdf_glyph_atlas atlas{cen::font{atlasFontPath, 32}, 4};
+
+  atlas.add_glyph(*m_renderer, 'A');
+  ASSERT_TRUE(atlas.has('A'));
+  ASSERT_EQ(1u, atlas.size());
+  ASSERT_EQ(1u, atlas.page_count());
+
+  // The distance field is padded by the spread on every side
+  const auto* data = atlas.try_at('A');
+  ASSERT_TRUE(data);
+  ASSERT_EQ(0u, data->page);
+  ASSERT_EQ(atlas.get_font().get_metrics('A')->advance, data->metrics.advance);
+  ASSERT_LE(2 * atlas.spread(), data->source.width());
+
+  // Adding a glyph again has no effect
+  atlas.add_glyph(*m_renderer, 'A');
+  ASSERT_EQ(1u, atlas.size());
+}
+
+TEST_F(SDFGlyphAtlasTest, AddBasicLatin)
+{
+  cen::task_scheduler scheduler{2};
+
+  cen::sdf_glyph_atlas parallel{cen::font{atlasFontPath, 24}};
+  parallel.add_basic_latin(*m_renderer, scheduler);
+
+  cen::sdf_glyph_atlas serial{cen::font{atlasFontPath, 24}};
+  serial.add_basic_latin(*m_renderer);
+
+  ASSERT_EQ(serial.size(), parallel.size());
+  ASSERT_LT(0u, parallel.size());
+
+  for (auto glyph = 0x20; glyph < 0x7F; ++glyph) {
+    const auto* a = serial.try_at(static_cast<cen::unicode>(glyph));
+    const auto* b = parallel.try_at(static_cast<cen::unicode>(glyph));
+    ASSERT_EQ(a != nullptr, b != nullptr);
+
+    if (a) {
+      ASSERT_EQ(a->source, b->source);
+    }
+  }
+}
+
+TEST_F(SDFGlyphAtlasTest, Scale)
+{
+  const cen::sdf_glyph_atlas atlas{cen::font{atlasFontPath, 32}};
+  ASSERT_FLOAT_EQ(1.0f, atlas.scale(32));
+  ASSERT_FLOAT_EQ(0.5f, atlas.scale(16));
+  ASSERT_FLOAT_EQ(2.0f, atlas.scale(64));
+}
+
+TEST_F(SDFGlyphAtlasTest, PageOverflow)
+{
+  cen::sdf_glyph_atlas atlas{cen::font{atlasFontPath, 32}, 4, {8, 8}};
+  ASSERT_THROW(atlas.add_glyph(*m_renderer, 'W'), cen::cen_error);
+}
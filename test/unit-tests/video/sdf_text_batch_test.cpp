@@ -0,0 +1,95 @@
+#include "video/sdf_text_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>     // unique_ptr
+#include <stdexcept>  // out_of_range
+#include <string>     // string
+
+#include "video/renderer.hpp"
+#include "video/sdf_glyph_atlas.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+using namespace std::string_literals;
+
+class SDFTextBatchTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+
+    m_atlas = std::make_unique<cen::sdf_glyph_atlas>(cen::font{"resources/daniel.ttf", 32});
+    m_atlas->add_basic_latin(*m_renderer);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_atlas.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::sdf_glyph_atlas> m_atlas;
+};
+
+TEST_F(SDFTextBatchTest, Defaults)
+{
+  const cen::sdf_text_batch batch{*m_atlas};
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.glyph_count());
+  ASSERT_EQ(0u, batch.page_count());
+  ASSERT_EQ(m_atlas.get(), &batch.get_atlas());
+  ASSERT_THROW(batch.vertices(0), std::out_of_range);
+}
+
+TEST_F(SDFTextBatchTest, Add)
+{
+  cen::sdf_text_batch batch{*m_atlas};
+
+  batch.add("Hello\nWorld!"s, {10, 10}, 16);
+  ASSERT_EQ(11u, batch.glyph_count());
+  ASSERT_EQ(1u, batch.page_count());
+  ASSERT_EQ(44u, batch.vertices(0).size());
+  ASSERT_EQ(66u, batch.indices(0).size());
+
+  batch.clear();
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(1u, batch.page_count());
+}
+
+TEST_F(SDFTextBatchTest, Scaling)
+{
+  cen::sdf_text_batch small{*m_atlas};
+  cen::sdf_text_batch large{*m_atlas};
+
+  small.add("A"s, {0, 0}, 16);
+  large.add("A"s, {0, 0}, 32);
+
+  // The quads are scaled by the ratio of the font size to the base size
+  const auto& a = small.vertices(0);
+  const auto& b = large.vertices(0);
+  ASSERT_FLOAT_EQ(2.0f * (a[1].position.x - a[0].position.x),
+                  b[1].position.x - b[0].position.x);
+  ASSERT_FLOAT_EQ(a[0].tex_coord.x, b[0].tex_coord.x);
+
+  const auto* data = m_atlas->try_at('A');
+  ASSERT_FLOAT_EQ(static_cast<float>(data->source.width()),
+                  b[1].position.x - b[0].position.x);
+}
+
+TEST_F(SDFTextBatchTest, Render)
+{
+  cen::sdf_text_batch batch{*m_atlas};
+  batch.add("Hello"s, {10, 10}, 12, cen::colors::red);
+  batch.add("Hello"s, {10, 40}, 48);
+
+  ASSERT_TRUE(m_renderer->render_text(batch));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,127 @@
+#include "video/shared_frame_exporter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>      // memcpy
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_copy_constructible_v
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::shared_frame_exporter>);
+static_assert(!std::is_copy_assignable_v<cen::shared_frame_exporter>);
+
+class SharedFrameExporterTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  [[nodiscard]] static auto make_exporter(const cen::u32 capacity = 3)
+      -> cen::shared_frame_exporter
+  {
+    return {name, m_renderer->output_size(), cen::pixel_format::rgba8888, capacity};
+  }
+
+  inline static constexpr auto name = "centurion-shared-frame-exporter-test";
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(SharedFrameExporterTest, Defaults)
+{
+  const auto exporter = make_exporter();
+  ASSERT_EQ(3u, exporter.capacity());
+  ASSERT_EQ(m_renderer->output_size(), exporter.size());
+  ASSERT_EQ(cen::pixel_format::rgba8888, exporter.format());
+  ASSERT_EQ(0u, exporter.pending());
+  ASSERT_EQ(0u, exporter.exported());
+  ASSERT_EQ(0u, exporter.dropped());
+}
+
+TEST_F(SharedFrameExporterTest, InvalidArguments)
+{
+  using cen::pixel_format;
+  ASSERT_THROW(cen::shared_frame_exporter(name, {0, 10}, pixel_format::rgba8888),
+               cen::cen_error);
+  ASSERT_THROW(cen::shared_frame_exporter(name, {10, 10}, pixel_format::yv12), cen::cen_error);
+}
+
+TEST_F(SharedFrameExporterTest, Reader)
+{
+  ASSERT_FALSE(cen::shared_frame_reader{name});
+
+  auto exporter = make_exporter();
+  const cen::shared_frame_reader reader{exporter.name()};
+  ASSERT_TRUE(reader);
+
+  const auto& header = reader.header();
+  ASSERT_EQ(cen::shared_frame_magic, header.magic);
+  ASSERT_EQ(cen::shared_frame_version, header.version);
+  ASSERT_EQ(3u, header.capacity);
+  ASSERT_EQ(cen::counter::frequency(), header.counterFrequency);
+  ASSERT_EQ(exporter.size(), reader.size());
+  ASSERT_EQ(exporter.format(), reader.format());
+  ASSERT_EQ(0u, header.dataOffset % 64u);
+  ASSERT_EQ(0u, header.frameStride % 64u);
+  ASSERT_LE(static_cast<cen::u64>(header.pitch) * header.height, header.frameStride);
+}
+
+TEST_F(SharedFrameExporterTest, Capture)
+{
+  auto exporter = make_exporter();
+  cen::shared_frame_reader reader{exporter.name()};
+  ASSERT_FALSE(reader.acquire());
+  ASSERT_FALSE(reader.release());
+
+  m_renderer->clear_with(cen::color{0x11, 0x22, 0x33, 0xFF});
+  ASSERT_TRUE(exporter.capture(*m_renderer));
+  ASSERT_EQ(1u, exporter.pending());
+  ASSERT_EQ(1u, reader.available());
+
+  const auto frame = reader.acquire();
+  ASSERT_TRUE(frame);
+  ASSERT_EQ(0u, frame->frame);
+  ASSERT_NE(0u, frame->timestamp);
+
+  // RGBA8888 is packed, with the red component in the most significant byte
+  cen::u32 pixel{};
+  std::memcpy(&pixel, frame->pixels, sizeof pixel);
+  ASSERT_EQ(0x112233FFu, pixel);
+
+  ASSERT_TRUE(reader.release());
+  ASSERT_EQ(0u, exporter.pending());
+  ASSERT_EQ(1u, exporter.exported());
+}
+
+TEST_F(SharedFrameExporterTest, DropsWhenFull)
+{
+  auto exporter = make_exporter(2);
+  cen::shared_frame_reader reader{exporter.name()};
+
+  ASSERT_TRUE(exporter.capture(*m_renderer));
+  ASSERT_TRUE(exporter.capture(*m_renderer));
+  ASSERT_FALSE(exporter.capture(*m_renderer));
+  ASSERT_EQ(1u, exporter.dropped());
+
+  ASSERT_EQ(0u, reader.acquire()->frame);
+  ASSERT_TRUE(reader.release());
+  ASSERT_EQ(1u, reader.acquire()->frame);
+  ASSERT_TRUE(reader.release());
+
+  // The frame indices include the dropped frame
+  ASSERT_TRUE(exporter.capture(*m_renderer));
+  ASSERT_EQ(3u, reader.acquire()->frame);
+  ASSERT_EQ(3u, exporter.exported());
+}
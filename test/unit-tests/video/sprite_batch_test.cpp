@@ -0,0 +1,124 @@
+#include "video/sprite_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class SpriteBatchTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_first = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+    m_second = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_second.reset();
+    m_first.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_first;
+  inline static std::unique_ptr<cen::texture> m_second;
+};
+
+TEST_F(SpriteBatchTest, Defaults)
+{
+  const cen::sprite_batch batch;
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.size());
+  ASSERT_TRUE(batch.is_sorting());
+  ASSERT_TRUE(batch.get_transform().is_identity());
+
+  const auto& stats = batch.stats();
+  ASSERT_EQ(0u, stats.sprites);
+  ASSERT_EQ(0u, stats.drawCalls);
+  ASSERT_EQ(0u, stats.vertices);
+  ASSERT_EQ(0u, stats.indices);
+}
+
+TEST_F(SpriteBatchTest, Add)
+{
+  cen::sprite_batch batch;
+
+  batch.add(*m_first, {{0, 0}, {10, 10}}, {{10, 10}, {20, 20}});
+  batch.add(*m_first, {{10, 10}, {50, 50}}, cen::colors::red, 45);
+  ASSERT_FALSE(batch.empty());
+  ASSERT_EQ(2u, batch.size());
+
+  batch.clear();
+  ASSERT_TRUE(batch.empty());
+}
+
+TEST_F(SpriteBatchTest, Transform)
+{
+  cen::sprite_batch batch;
+
+  const auto camera = cen::affine_transform::translation({-50, -50})
+                          .then(cen::affine_transform::scaling(2, 2));
+  batch.set_transform(camera);
+  ASSERT_EQ(camera, batch.get_transform());
+
+  batch.add(*m_first, {{0, 0}, {10, 10}}, {{10, 10}, {20, 20}});
+  batch.add(*m_first, {{10, 10}, {50, 50}}, cen::colors::red, 45);
+  ASSERT_TRUE(batch.flush(*m_renderer));
+  ASSERT_EQ(camera, batch.get_transform());
+
+  batch.set_transform(cen::affine_transform::identity());
+  ASSERT_TRUE(batch.get_transform().is_identity());
+}
+
+TEST_F(SpriteBatchTest, FlushSorted)
+{
+  cen::sprite_batch batch;
+
+  for (int i = 0; i < 10; ++i) {
+    const auto& texture = (i % 2 == 0) ? *m_first : *m_second;
+    batch.add(texture, cen::frect{{10.0f * static_cast<float>(i), 10}, {10, 10}});
+  }
+
+  ASSERT_TRUE(batch.flush(*m_renderer));
+  ASSERT_TRUE(batch.empty());
+
+  const auto& stats = batch.stats();
+  ASSERT_EQ(10u, stats.sprites);
+  ASSERT_EQ(2u, stats.drawCalls);
+  ASSERT_EQ(40u, stats.vertices);
+  ASSERT_EQ(60u, stats.indices);
+}
+
+TEST_F(SpriteBatchTest, FlushUnsorted)
+{
+  cen::sprite_batch batch;
+  batch.set_sorting(false);
+  ASSERT_FALSE(batch.is_sorting());
+
+  batch.add(*m_first, cen::frect{{0, 0}, {10, 10}});
+  batch.add(*m_first, cen::frect{{10, 0}, {10, 10}});
+  batch.add(*m_second, cen::frect{{20, 0}, {10, 10}});
+  batch.add(*m_first, cen::frect{{30, 0}, {10, 10}}, cen::colors::white, 90);
+
+  ASSERT_TRUE(batch.flush(*m_renderer));
+  ASSERT_EQ(4u, batch.stats().sprites);
+  ASSERT_EQ(3u, batch.stats().drawCalls);
+
+  // Flushing an empty batch doesn't submit anything
+  ASSERT_TRUE(batch.flush(*m_renderer));
+  ASSERT_EQ(0u, batch.stats().drawCalls);
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,255 @@
+#include "video/surface_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>  // mt19937, uniform_int_distribution
+#include <vector>  // vector
+
+#include "detail/pixel_kernels.hpp"
+#include "video/blend_mode.hpp"
+#include "video/colors.hpp"
+#include "video/pixel_format.hpp"
+#include "video/surface.hpp"
+#include "video/window.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_surface(const cen::iarea size,
+                                const cen::pixel_format format,
+                                const cen::color& color) -> cen::surface
+{
+  cen::surface surface{size, format};
+
+  const auto* info = surface.get()->format;
+  SDL_FillRect(surface.get(),
+               nullptr,
+               SDL_MapRGBA(info, color.red(), color.green(), color.blue(), color.alpha()));
+
+  return surface;
+}
+
+[[nodiscard]] auto pixel_at(const cen::surface& surface, const int x, const int y)
+    -> cen::color
+{
+  const auto* pixels = static_cast<const cen::u8*>(surface.pixels());
+  const auto pixel = reinterpret_cast<const cen::u32*>(pixels + y * surface.pitch())[x];
+
+  cen::u8 red{};
+  cen::u8 green{};
+  cen::u8 blue{};
+  cen::u8 alpha{};
+  SDL_GetRGBA(pixel, surface.get()->format, &red, &green, &blue, &alpha);
+
+  return {red, green, blue, alpha};
+}
+
+}  // namespace
+
+TEST(SurfaceBatch, Defaults)
+{
+  const cen::surface_batch batch;
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.size());
+  ASSERT_TRUE(batch.damage().empty());
+  ASSERT_EQ(0u, batch.stats().sprites);
+}
+
+TEST(SurfaceBatch, BlendRowMatchesScalar)
+{
+  const cen::detail::channel_layout layout{16, 8, 0, 24, true};
+
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<cen::u32> dist;
+
+  std::vector<cen::u32> src(37);
+  std::vector<cen::u32> dst(37);
+  for (auto index = 0u; index < src.size(); ++index) {
+    src[index] = dist(engine);
+    dst[index] = dist(engine);
+  }
+
+  // Include runs of fully opaque and fully transparent pixels
+  for (auto index = 8u; index < 12u; ++index) {
+    src[index] |= 0xFF000000u;
+    src[index + 4u] &= 0x00FFFFFFu;
+  }
+
+  for (const auto tint : {0xFFFFFFFFu, 0x80FF4020u}) {
+    auto expected = dst;
+    auto actual = dst;
+
+    cen::detail::blend_row_scalar(src.data(), expected.data(), 37, layout, tint);
+    cen::detail::blend_row(src.data(), actual.data(), 37, layout, tint);
+
+    ASSERT_EQ(expected, actual);
+  }
+}
+
+TEST(SurfaceBatch, BlendRowValues)
+{
+  const cen::detail::channel_layout layout{16, 8, 0, 24, true};
+
+  const cen::u32 src[] = {0xFFFF0000u, 0x00FF0000u, 0x80FF0000u};
+  cen::u32 dst[] = {0xFF0000FFu, 0xFF0000FFu, 0xFF0000FFu};
+
+  cen::detail::blend_row(src, dst, 3, layout, 0xFFFFFFFFu);
+
+  ASSERT_EQ(0xFFFF0000u, dst[0]);
+  ASSERT_EQ(0xFF0000FFu, dst[1]);
+  ASSERT_EQ(0xFF80007Fu, dst[2]);
+}
+
+TEST(SurfaceBatch, BlendLayout)
+{
+  const cen::detail::channel_layout rgb{16, 8, 0, 0, false};
+  const auto layout = cen::detail::blend_layout(rgb);
+
+  ASSERT_TRUE(layout.hasAlpha);
+  ASSERT_EQ(24, layout.alpha);
+  ASSERT_EQ(16, layout.red);
+}
+
+TEST(SurfaceBatch, FlushOpaque)
+{
+  auto target = make_surface({8, 8}, cen::pixel_format::rgb888, cen::colors::blue);
+  const auto source = make_surface({2, 2}, cen::pixel_format::rgba32, cen::colors::red);
+
+  cen::surface_batch batch;
+  batch.add(source, cen::frect{1, 1, 2, 2});
+  ASSERT_EQ(1u, batch.size());
+
+  ASSERT_TRUE(batch.flush(target));
+  ASSERT_TRUE(batch.empty());
+
+  ASSERT_EQ(cen::colors::blue, pixel_at(target, 0, 0));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, 1, 1));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, 2, 2));
+  ASSERT_EQ(cen::colors::blue, pixel_at(target, 3, 3));
+
+  const auto& stats = batch.stats();
+  ASSERT_EQ(1u, stats.sprites);
+  ASSERT_EQ(4u, stats.pixels);
+  ASSERT_EQ(0u, stats.fallback);
+
+  ASSERT_EQ(1u, batch.damage().size());
+  ASSERT_EQ(cen::irect(1, 1, 2, 2), batch.damage().front());
+}
+
+TEST(SurfaceBatch, FlushBlendedAndTinted)
+{
+  auto target = make_surface({4, 4}, cen::pixel_format::argb8888, cen::colors::black);
+
+  auto source = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::white);
+  source.set_blend_mode(cen::blend_mode::blend);
+
+  cen::surface_batch batch;
+  batch.add(source, cen::frect{0, 0, 4, 4}, cen::color{0xFF, 0, 0, 0x80});
+  ASSERT_TRUE(batch.flush(target));
+
+  ASSERT_EQ(cen::color(0x80, 0, 0, 0xFF), pixel_at(target, 2, 2));
+
+  // The blend mode is captured when the sprite is added
+  source.set_blend_mode(cen::blend_mode::none);
+  batch.add(source, cen::frect{0, 0, 1, 1}, cen::color{0, 0xFF, 0, 0x80});
+  ASSERT_TRUE(batch.flush(target));
+
+  ASSERT_EQ(cen::color(0, 0xFF, 0, 0x80), pixel_at(target, 0, 0));
+}
+
+TEST(SurfaceBatch, FlushScaled)
+{
+  auto target = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::black);
+  auto source = make_surface({2, 2}, cen::pixel_format::rgba32, cen::colors::red);
+  source.set_pixel({1, 1}, cen::colors::lime);
+
+  cen::surface_batch batch;
+  batch.add(source, cen::frect{0, 0, 4, 4});
+  ASSERT_TRUE(batch.flush(target));
+
+  ASSERT_EQ(cen::colors::red, pixel_at(target, 0, 0));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, 1, 1));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, 3, 0));
+  ASSERT_EQ(cen::colors::lime, pixel_at(target, 2, 2));
+  ASSERT_EQ(cen::colors::lime, pixel_at(target, 3, 3));
+  ASSERT_EQ(16u, batch.stats().pixels);
+}
+
+TEST(SurfaceBatch, FlushClipped)
+{
+  auto target = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::black);
+  const auto source = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::red);
+
+  cen::surface_batch batch;
+  batch.add(source, cen::frect{2, -2, 4, 4});
+  batch.add(source, cen::frect{10, 10, 4, 4});
+  ASSERT_TRUE(batch.flush(target));
+
+  ASSERT_EQ(cen::colors::red, pixel_at(target, 3, 0));
+  ASSERT_EQ(cen::colors::black, pixel_at(target, 3, 2));
+  ASSERT_EQ(4u, batch.stats().pixels);
+
+  ASSERT_EQ(1u, batch.damage().size());
+  ASSERT_EQ(cen::irect(2, 0, 2, 2), batch.damage().front());
+}
+
+TEST(SurfaceBatch, DamageMerging)
+{
+  auto target = make_surface({64, 64}, cen::pixel_format::rgba32, cen::colors::black);
+  const auto source = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::red);
+
+  cen::surface_batch batch;
+  batch.add(source, cen::frect{0, 0, 4, 4});
+  batch.add(source, cen::frect{20, 20, 4, 4});
+  batch.add(source, cen::frect{2, 2, 4, 4});
+  ASSERT_TRUE(batch.flush(target));
+
+  ASSERT_EQ(2u, batch.damage().size());
+
+  // Damage accumulates until the batch is flushed to a window
+  batch.mark(cen::irect{4, 4, 18, 18});
+  ASSERT_EQ(1u, batch.damage().size());
+  ASSERT_EQ(cen::irect(0, 0, 24, 24), batch.damage().front());
+
+  for (auto index = 0; index <= static_cast<int>(cen::surface_batch::max_rects); ++index) {
+    batch.mark(cen::irect{index * 2, 30, 1, 1});
+  }
+
+  ASSERT_LE(batch.damage().size(), cen::surface_batch::max_rects);
+}
+
+TEST(SurfaceBatch, FlushFallback)
+{
+  auto target = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::black);
+
+  auto source = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::red);
+  source.set_blend_mode(cen::blend_mode::add);
+
+  cen::surface_batch batch;
+  batch.add(source, cen::frect{0, 0, 4, 4}, cen::colors::white);
+  ASSERT_TRUE(batch.flush(target));
+
+  ASSERT_EQ(1u, batch.stats().fallback);
+  ASSERT_EQ(cen::colors::red.red(), pixel_at(target, 1, 1).red());
+
+  // The modulation of the surface is restored
+  ASSERT_EQ(cen::blend_mode::add, source.get_blend_mode());
+  ASSERT_EQ(cen::colors::white, source.color_mod());
+}
+
+TEST(SurfaceBatch, FlushWindow)
+{
+  cen::window window{"SurfaceBatch", {64, 64}};
+  const auto source = make_surface({4, 4}, cen::pixel_format::rgba32, cen::colors::red);
+
+  cen::surface_batch batch;
+  batch.add(source, cen::frect{0, 0, 4, 4});
+  batch.add(source, cen::frect{32, 32, 4, 4});
+
+  ASSERT_TRUE(batch.flush(window));
+  ASSERT_EQ(2u, batch.stats().rects);
+  ASSERT_TRUE(batch.damage().empty());
+
+  // Nothing is copied to the screen when nothing changed
+  ASSERT_TRUE(batch.flush(window));
+  ASSERT_EQ(0u, batch.stats().rects);
+}
@@ -3,13 +3,17 @@
 #include <SDL2/SDL_image.h>
 #include <gtest/gtest.h>
 
+#include <cstring>   // memcmp
 #include <iostream>  // clog
 #include <memory>    // unique_ptr
 #include <type_traits>
 #include <utility>  // move
+#include <vector>   // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
+#include "filesystem/file.hpp"
+#include "thread/task_scheduler.hpp"
 #include "video/colors.hpp"
 #include "video/window.hpp"
 
@@ -51,6 +55,26 @@ TEST_F(SurfaceTest, PathConstructor)
   ASSERT_NO_THROW(cen::surface{m_path});
 }
 
+TEST_F(SurfaceTest, FileConstructor)
+{
+  cen::file image{m_path, cen::file_mode::read_existing_binary};
+  ASSERT_NO_THROW(cen::surface{image});
+
+  cen::file text{"resources/CREDITS.txt", cen::file_mode::read_existing_binary};
+  ASSERT_THROW(cen::surface{text}, cen::img_error);
+}
+
+TEST_F(SurfaceTest, TryLoad)
+{
+  const auto missing = cen::surface::try_load("");
+  ASSERT_FALSE(missing);
+  ASSERT_EQ(cen::error_code::img, missing.error().code());
+
+  const auto surface = cen::surface::try_load(std::string{m_path});
+  ASSERT_TRUE(surface);
+  ASSERT_EQ(m_surface->size(), surface->size());
+}
+
 TEST_F(SurfaceTest, FromSDLSurfaceConstructor)
 {
   ASSERT_NO_THROW(cen::surface(IMG_Load(m_path)));
@@ -68,6 +92,47 @@ TEST_F(SurfaceTest, SizePixelFormatConstructor)
   ASSERT_EQ(window.get_pixel_format(), surface.format_info().format());
 }
 
+TEST_F(SurfaceTest, FromPixels)
+{
+  std::vector<cen::u32> pixels(16 * 8, 0xFF0000FF);
+
+  {
+    auto surface = cen::surface::from_pixels(pixels.data(),
+                                             {16, 8},
+                                             16 * 4,
+                                             cen::pixel_format::rgba8888);
+    ASSERT_EQ(pixels.data(), surface.pixels());
+    ASSERT_EQ((cen::iarea{16, 8}), surface.size());
+    ASSERT_EQ(16 * 4, surface.pitch());
+    ASSERT_EQ(cen::pixel_format::rgba8888, surface.format_info().format());
+
+    surface.set_pixel({0, 0}, cen::colors::lime);
+
+    // Copies own their pixel data
+    const auto copy = surface;
+    ASSERT_NE(copy.pixels(), surface.pixels());
+  }
+
+  // The caller-owned memory is modified in place, and isn't freed with the surface
+  ASSERT_EQ(0x00FF00FFu, pixels.at(0));
+  ASSERT_EQ(0xFF0000FFu, pixels.at(1));
+}
+
+TEST_F(SurfaceTest, FromSIMDBlock)
+{
+  const auto format = cen::pixel_format::rgba8888;
+  const auto pitch = cen::surface::aligned_pitch(13, format);
+
+  ASSERT_GE(pitch, 13 * 4);
+  ASSERT_EQ(0u, static_cast<cen::usize>(pitch) % cen::cpu::simd_alignment());
+
+  cen::simd_block block{static_cast<cen::usize>(pitch) * 5u};
+  const auto surface = cen::surface::from_pixels(block, {13, 5}, format);
+
+  ASSERT_EQ(block.data(), surface.pixels());
+  ASSERT_EQ(pitch, surface.pitch());
+}
+
 TEST_F(SurfaceTest, CopyConstructor)
 {
   const cen::surface copy{*m_surface};
@@ -125,6 +190,39 @@ TEST_F(SurfaceTest, SaveAsJPG)
   ASSERT_TRUE(m_surface->save_as_jpg("surface_as_jpg.jpg"s, 25));
 }
 
+TEST_F(SurfaceTest, SaveAsQOI)
+{
+  ASSERT_TRUE(m_surface->save_as_qoi("surface_as_qoi.qoi"s));
+
+  const auto image = cen::surface::from_qoi("surface_as_qoi.qoi"s);
+  ASSERT_EQ(m_surface->size(), image.size());
+  ASSERT_EQ(cen::pixel_format::rgba32, image.format_info().format());
+
+  cen::file file{"surface_as_qoi.qoi", cen::file_mode::read_existing_binary};
+  ASSERT_EQ(cen::image_format::qoi, file.detect_image_format());
+
+  const cen::surface loaded{file};
+  ASSERT_EQ(m_surface->size(), loaded.size());
+}
+
+TEST_F(SurfaceTest, FromQOI)
+{
+  cen::surface source{{16, 8}, cen::pixel_format::rgba32};
+  source.set_pixel({3, 2}, cen::colors::orange);
+  source.set_pixel({15, 7}, cen::colors::dark_cyan);
+
+  const auto data = source.encode_qoi();
+  ASSERT_FALSE(data.empty());
+
+  const auto image = cen::surface::from_qoi(data.data(), data.size());
+  ASSERT_EQ(source.size(), image.size());
+  ASSERT_EQ(0, std::memcmp(source.pixels(), image.pixels(), 16 * 8 * 4));
+
+  // Truncated data and other formats are rejected
+  ASSERT_THROW(cen::surface::from_qoi(data.data(), data.size() / 2), cen::cen_error);
+  ASSERT_THROW(cen::surface::from_qoi(data.data() + 1, data.size() - 1), cen::cen_error);
+}
+
 TEST_F(SurfaceTest, SetPixel)
 {
   constexpr auto color = cen::colors::red;
@@ -173,6 +271,137 @@ TEST_F(SurfaceTest, SetBlendMode)
   m_surface->set_blend_mode(previous);
 }
 
+TEST_F(SurfaceTest, PremultiplyAlpha)
+{
+  // Odd width to make sure that both the vectorized and scalar code paths are used
+  for (const auto format : {cen::pixel_format::rgba8888, cen::pixel_format::argb8888}) {
+    cen::surface surface{{37, 2}, format};
+    for (auto x = 0; x < surface.width(); ++x) {
+      surface.set_pixel({x, 0}, cen::color{200, 100, 50, 128});
+      surface.set_pixel({x, 1}, cen::color{200, 100, 50, 0xFF});
+    }
+
+    ASSERT_TRUE(surface.premultiply_alpha());
+
+    const auto info = surface.format_info();
+    const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+    const auto stride = surface.pitch() / 4;
+
+    for (auto x = 0; x < surface.width(); ++x) {
+      ASSERT_EQ((cen::color{100, 50, 25, 128}), info.pixel_to_rgba(pixels[x]));
+      ASSERT_EQ((cen::color{200, 100, 50, 0xFF}), info.pixel_to_rgba(pixels[stride + x]));
+    }
+  }
+
+  cen::surface opaque{{4, 4}, cen::pixel_format::rgb888};
+  ASSERT_TRUE(opaque.premultiply_alpha());
+
+  cen::surface unsupported{{4, 4}, cen::pixel_format::rgb565};
+  ASSERT_FALSE(unsupported.premultiply_alpha());
+}
+
+TEST_F(SurfaceTest, UnpremultiplyAlpha)
+{
+  cen::surface surface{{9, 1}, cen::pixel_format::rgba8888};
+  surface.set_pixel({0, 0}, cen::color{64, 32, 16, 128});
+  surface.set_pixel({1, 0}, cen::color{200, 100, 50, 128});
+  surface.set_pixel({2, 0}, cen::color{10, 20, 30, 0});
+
+  ASSERT_TRUE(surface.unpremultiply_alpha());
+
+  const auto info = surface.format_info();
+  const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+
+  ASSERT_EQ((cen::color{128, 64, 32, 128}), info.pixel_to_rgba(pixels[0]));
+  ASSERT_EQ((cen::color{255, 199, 100, 128}), info.pixel_to_rgba(pixels[1]));
+  ASSERT_EQ((cen::color{10, 20, 30, 0}), info.pixel_to_rgba(pixels[2]));
+
+  cen::surface unsupported{{4, 4}, cen::pixel_format::rgb565};
+  ASSERT_FALSE(unsupported.unpremultiply_alpha());
+}
+
+TEST_F(SurfaceTest, PremultiplyAlphaParallel)
+{
+  cen::task_scheduler scheduler{3};
+
+  // Large enough to be split into bands
+  for (const auto format : {cen::pixel_format::rgba8888, cen::pixel_format::argb8888}) {
+    cen::surface serial{{1'023, 517}, format};
+    auto* pixels = static_cast<cen::u32*>(serial.pixels());
+    for (auto index = 0; index < serial.pitch() / 4 * serial.height(); ++index) {
+      pixels[index] = static_cast<cen::u32>(index) * 2'654'435'761u;
+    }
+
+    cen::surface parallel{serial};
+    ASSERT_TRUE(serial.premultiply_alpha());
+    ASSERT_TRUE(parallel.premultiply_alpha(scheduler));
+
+    const auto bytes = static_cast<std::size_t>(serial.pitch() * serial.height());
+    ASSERT_EQ(0, std::memcmp(serial.pixels(), parallel.pixels(), bytes));
+
+    ASSERT_TRUE(serial.unpremultiply_alpha());
+    ASSERT_TRUE(parallel.unpremultiply_alpha(scheduler));
+    ASSERT_EQ(0, std::memcmp(serial.pixels(), parallel.pixels(), bytes));
+  }
+
+  cen::surface unsupported{{1'024, 1'024}, cen::pixel_format::rgb565};
+  ASSERT_FALSE(unsupported.premultiply_alpha(scheduler));
+}
+
+TEST_F(SurfaceTest, BakeColorMod)
+{
+  cen::surface surface{{3, 1}, cen::pixel_format::rgba8888};
+  surface.set_pixel({0, 0}, cen::color{200, 100, 50, 0xFF});
+  surface.set_pixel({1, 0}, cen::color{0xFF, 0xFF, 0xFF, 128});
+  surface.set_color_mod(cen::color{128, 0xFF, 0});
+  surface.set_alpha(128);
+
+  ASSERT_TRUE(surface.bake_color_mod());
+  ASSERT_EQ(cen::colors::white, surface.color_mod());
+  ASSERT_EQ(0xFF, surface.alpha());
+
+  const auto info = surface.format_info();
+  const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+  ASSERT_EQ((cen::color{100, 100, 0, 128}), info.pixel_to_rgba(pixels[0]));
+  ASSERT_EQ((cen::color{128, 0xFF, 0, 64}), info.pixel_to_rgba(pixels[1]));
+
+  // The alpha modulation can't be baked into formats without an alpha channel
+  cen::surface opaque{{3, 1}, cen::pixel_format::rgb888};
+  opaque.set_color_mod(cen::color{128, 128, 128});
+  opaque.set_alpha(100);
+
+  ASSERT_TRUE(opaque.bake_color_mod());
+  ASSERT_EQ(cen::colors::white, opaque.color_mod());
+  ASSERT_EQ(100, opaque.alpha());
+
+  cen::surface unsupported{{4, 4}, cen::pixel_format::rgb565};
+  unsupported.set_color_mod(cen::colors::red);
+  ASSERT_FALSE(unsupported.bake_color_mod());
+}
+
+TEST_F(SurfaceTest, BakeColorModParallel)
+{
+  cen::task_scheduler scheduler{3};
+
+  cen::surface serial{{1'023, 517}, cen::pixel_format::argb8888};
+  auto* pixels = static_cast<cen::u32*>(serial.pixels());
+  for (auto index = 0; index < serial.pitch() / 4 * serial.height(); ++index) {
+    pixels[index] = static_cast<cen::u32>(index) * 2'654'435'761u;
+  }
+
+  serial.set_color_mod(cen::color{10, 128, 250});
+  serial.set_alpha(200);
+
+  cen::surface parallel{serial};
+  ASSERT_TRUE(serial.bake_color_mod());
+  ASSERT_TRUE(parallel.bake_color_mod(scheduler));
+
+  const auto bytes = static_cast<std::size_t>(serial.pitch() * serial.height());
+  ASSERT_EQ(0, std::memcmp(serial.pixels(), parallel.pixels(), bytes));
+  ASSERT_EQ(cen::colors::white, parallel.color_mod());
+  ASSERT_EQ(0xFF, parallel.alpha());
+}
+
 TEST_F(SurfaceTest, Width)
 {
   ASSERT_EQ(200, m_surface->width());
@@ -234,6 +463,81 @@ TEST_F(SurfaceTest, Convert)
   ASSERT_EQ(source.color_mod(), converted.color_mod());
 }
 
+TEST_F(SurfaceTest, ConvertParallel)
+{
+  cen::task_scheduler scheduler{3};
+
+  cen::surface source{{1'023, 517}, cen::pixel_format::rgba8888};
+  auto* pixels = static_cast<cen::u32*>(source.pixels());
+  for (auto index = 0; index < source.pitch() / 4 * source.height(); ++index) {
+    pixels[index] = static_cast<cen::u32>(index) * 2'654'435'761u;
+  }
+
+  source.set_blend_mode(cen::blend_mode::blend);
+  source.set_alpha(0xAE);
+  source.set_color_mod(cen::colors::red);
+
+  for (const auto format : {cen::pixel_format::argb8888, cen::pixel_format::rgb24}) {
+    const auto expected = source.convert(format);
+    const auto converted = source.convert(format, scheduler);
+
+    ASSERT_EQ(format, converted.format_info().format());
+    ASSERT_EQ(source.size(), converted.size());
+    ASSERT_EQ(source.get_blend_mode(), converted.get_blend_mode());
+    ASSERT_EQ(source.alpha(), converted.alpha());
+    ASSERT_EQ(source.color_mod(), converted.color_mod());
+
+    const auto bytesPerPixel = (format == cen::pixel_format::rgb24) ? 3 : 4;
+    const auto rowSize = static_cast<std::size_t>(source.width() * bytesPerPixel);
+    for (auto y = 0; y < source.height(); ++y) {
+      const auto* a = static_cast<const cen::u8*>(expected.pixels()) + y * expected.pitch();
+      const auto* b = static_cast<const cen::u8*>(converted.pixels()) + y * converted.pitch();
+      ASSERT_EQ(0, std::memcmp(a, b, rowSize));
+    }
+  }
+
+  // Small surfaces are converted on the calling thread
+  const cen::surface small{{8, 8}, cen::pixel_format::rgba8888};
+  ASSERT_EQ(cen::pixel_format::argb8888,
+            small.convert(cen::pixel_format::argb8888, scheduler).format_info().format());
+}
+
+TEST_F(SurfaceTest, ConvertInPlace)
+{
+  cen::surface surface{{4, 4}, cen::pixel_format::argb8888};
+  surface.set_blend_mode(cen::blend_mode::add);
+  surface.set_alpha(0x7F);
+  surface.set_pixel({1, 2}, cen::colors::red);
+
+  const auto* pixels = surface.pixels();
+
+  ASSERT_TRUE(surface.convert_in_place(cen::pixel_format::rgba8888));
+  ASSERT_EQ(cen::pixel_format::rgba8888, surface.format_info().format());
+  ASSERT_EQ(pixels, surface.pixels());
+  ASSERT_EQ(cen::blend_mode::add, surface.get_blend_mode());
+  ASSERT_EQ(0x7F, surface.alpha());
+
+  const auto* converted = static_cast<const cen::u32*>(surface.pixels());
+  ASSERT_EQ(0xFF0000FFu, converted[2 * 4 + 1]);
+
+  // Only 32-bit formats with 8-bit channels can be converted in place
+  ASSERT_FALSE(surface.convert_in_place(cen::pixel_format::rgb565));
+  ASSERT_EQ(cen::pixel_format::rgba8888, surface.format_info().format());
+}
+
+TEST_F(SurfaceTest, Scaled)
+{
+  const auto scaled = m_surface->scaled({100, 300});
+  ASSERT_EQ((cen::iarea{100, 300}), scaled.size());
+  ASSERT_EQ(m_surface->format_info().format(), scaled.format_info().format());
+  ASSERT_EQ(m_surface->get_blend_mode(), scaled.get_blend_mode());
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+  const auto linear = m_surface->scaled({50, 50}, cen::scale_mode::linear);
+  ASSERT_EQ((cen::iarea{50, 50}), linear.size());
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+}
+
 TEST_F(SurfaceTest, Get)
 {
   ASSERT_TRUE(m_surface->get());
@@ -0,0 +1,139 @@
+#include "video/text_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>     // unique_ptr
+#include <stdexcept>  // out_of_range
+#include <string>     // string
+
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/text_layout.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+using namespace std::string_literals;
+
+class TextBatchTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+
+    m_cache = std::make_unique<cen::font_cache>("resources/daniel.ttf", 12);
+    m_cache->use_atlas();
+    m_cache->add_basic_latin(*m_renderer);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_cache.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::font_cache> m_cache;
+};
+
+TEST_F(TextBatchTest, Defaults)
+{
+  const cen::text_batch batch{*m_cache};
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.glyph_count());
+  ASSERT_EQ(0u, batch.page_count());
+  ASSERT_EQ(m_cache.get(), &batch.get_cache());
+  ASSERT_THROW(batch.vertices(0), std::out_of_range);
+}
+
+TEST_F(TextBatchTest, Add)
+{
+  cen::text_batch batch{*m_cache};
+
+  batch.add("Hello\nWorld!"s, {10, 10});
+  ASSERT_FALSE(batch.empty());
+  ASSERT_EQ(11u, batch.glyph_count());
+  ASSERT_EQ(1u, batch.page_count());
+
+  const auto& vertices = batch.vertices(0);
+  const auto& indices = batch.indices(0);
+  ASSERT_EQ(44u, vertices.size());
+  ASSERT_EQ(66u, indices.size());
+
+  for (const auto& vertex : vertices) {
+    ASSERT_GE(vertex.tex_coord.x, 0.0f);
+    ASSERT_LE(vertex.tex_coord.x, 1.0f);
+    ASSERT_GE(vertex.tex_coord.y, 0.0f);
+    ASSERT_LE(vertex.tex_coord.y, 1.0f);
+  }
+
+  // The second line starts below the first one
+  ASSERT_GT(vertices.at(20).position.y, vertices.at(0).position.y);
+
+  batch.add("!"s, {0, 0}, cen::colors::red);
+  ASSERT_EQ(12u, batch.glyph_count());
+  ASSERT_EQ(cen::colors::red.red(), batch.vertices(0).back().color.r);
+
+  // Glyphs that are not in the atlas are skipped
+  batch.add(cen::unicode_string{0x7F}, {0, 0});
+  ASSERT_EQ(12u, batch.glyph_count());
+}
+
+TEST_F(TextBatchTest, AddLayout)
+{
+  cen::text_layout layout{*m_cache};
+  layout.set_text("foo bar"s);
+
+  cen::text_batch batch{*m_cache};
+  batch.add(layout, {10, 10});
+  ASSERT_EQ(layout.glyphs().size(), batch.glyph_count());
+}
+
+TEST_F(TextBatchTest, AddShaped)
+{
+  m_cache->store_shaped_utf8(7, "Shaped"s, *m_renderer);
+
+  cen::text_batch batch{*m_cache};
+  ASSERT_FALSE(batch.add_shaped(8, {0, 0}));
+  ASSERT_TRUE(batch.empty());
+
+  ASSERT_TRUE(batch.add_shaped(7, {10, 10}));
+  ASSERT_EQ(1u, batch.glyph_count());
+
+  const auto* run = m_cache->try_get_shaped(7);
+  const auto& vertices = batch.vertices(run->page);
+  ASSERT_EQ(4u, vertices.size());
+  ASSERT_FLOAT_EQ(static_cast<float>(run->source.width()),
+                  vertices[1].position.x - vertices[0].position.x);
+
+  m_cache->remove_shaped(7);
+}
+
+TEST_F(TextBatchTest, Clear)
+{
+  cen::text_batch batch{*m_cache};
+  batch.add("foobar"s, {0, 0});
+
+  const auto capacity = batch.vertices(0).capacity();
+
+  batch.clear();
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(1u, batch.page_count());
+  ASSERT_EQ(capacity, batch.vertices(0).capacity());
+}
+
+TEST_F(TextBatchTest, Render)
+{
+  cen::text_batch batch{*m_cache};
+  ASSERT_TRUE(m_renderer->render_text(batch));
+
+  batch.add("Hello\nWorld!"s, {10, 10});
+  batch.add("foobar"s, {10, 100});
+  ASSERT_TRUE(m_renderer->render_text(batch));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
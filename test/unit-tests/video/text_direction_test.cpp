@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+#include "core/to_underlying.hpp"
+#include "video/font.hpp"
+
+#if CENTURION_HAS_FEATURE_TTF_SHAPING
+
+TEST(TextDirection, Values)
+{
+  ASSERT_EQ(TTF_DIRECTION_LTR, cen::to_underlying(cen::text_direction::left_to_right));
+  ASSERT_EQ(TTF_DIRECTION_RTL, cen::to_underlying(cen::text_direction::right_to_left));
+  ASSERT_EQ(TTF_DIRECTION_TTB, cen::to_underlying(cen::text_direction::top_to_bottom));
+  ASSERT_EQ(TTF_DIRECTION_BTT, cen::to_underlying(cen::text_direction::bottom_to_top));
+}
+
+TEST(TextDirection, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::text_direction>(42)), cen::cen_error);
+
+  ASSERT_EQ("left_to_right", cen::to_string(cen::text_direction::left_to_right));
+  ASSERT_EQ("right_to_left", cen::to_string(cen::text_direction::right_to_left));
+  ASSERT_EQ("top_to_bottom", cen::to_string(cen::text_direction::top_to_bottom));
+  ASSERT_EQ("bottom_to_top", cen::to_string(cen::text_direction::bottom_to_top));
+
+  std::clog << "Text direction example: " << cen::text_direction::right_to_left << '\n';
+}
+
+#endif  // CENTURION_HAS_FEATURE_TTF_SHAPING
@@ -0,0 +1,146 @@
+#include "video/text_layout.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <string>  // string
+
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+using namespace std::string_literals;
+
+class TextLayoutTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+
+    m_cache = std::make_unique<cen::font_cache>("resources/daniel.ttf", 12);
+    m_cache->add_basic_latin(*m_renderer);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_cache.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::font_cache> m_cache;
+};
+
+TEST_F(TextLayoutTest, Defaults)
+{
+  const cen::text_layout layout{*m_cache};
+  ASSERT_TRUE(layout.glyphs().empty());
+  ASSERT_EQ(0, layout.line_count());
+  ASSERT_EQ(0, layout.wrap_width());
+  ASSERT_EQ(0, layout.size().width);
+  ASSERT_EQ(0, layout.size().height);
+  ASSERT_EQ(m_cache.get(), &layout.get_cache());
+}
+
+TEST_F(TextLayoutTest, SetText)
+{
+  cen::text_layout layout{*m_cache};
+
+  layout.set_text("foo\nbar"s);
+  ASSERT_EQ(6u, layout.glyphs().size());
+  ASSERT_EQ(2, layout.line_count());
+
+  const auto& glyphs = layout.glyphs();
+  ASSERT_EQ('f', glyphs.at(0).glyph);
+  ASSERT_EQ(0, glyphs.at(0).position.x());
+  ASSERT_EQ(0, glyphs.at(0).position.y());
+  ASSERT_GT(glyphs.at(1).position.x(), 0);
+
+  ASSERT_EQ('b', glyphs.at(3).glyph);
+  ASSERT_EQ(0, glyphs.at(3).position.x());
+  ASSERT_EQ(m_cache->get_font().line_skip(), glyphs.at(3).position.y());
+
+  const auto size = layout.size();
+  ASSERT_GT(size.width, 0);
+  ASSERT_EQ(m_cache->get_font().line_skip() + m_cache->get_font().height(), size.height);
+
+  // Setting the same text again doesn't reallocate the run
+  const auto* data = glyphs.data();
+  layout.set_text("foo\nbar"s);
+  ASSERT_EQ(data, layout.glyphs().data());
+
+  layout.set_text(cen::unicode_string{'a', 'b'});
+  ASSERT_EQ(2u, layout.glyphs().size());
+  ASSERT_EQ(1, layout.line_count());
+}
+
+TEST_F(TextLayoutTest, WrapWidth)
+{
+  cen::text_layout layout{*m_cache};
+  layout.set_text("foo bar foo bar"s);
+  ASSERT_EQ(1, layout.line_count());
+
+  const auto width = layout.size().width;
+
+  layout.set_wrap_width(width / 2);
+  ASSERT_EQ(width / 2, layout.wrap_width());
+  ASSERT_GT(layout.line_count(), 1);
+  ASSERT_LE(layout.size().width, width / 2);
+
+  // Wrapped words start at the beginning of a line
+  for (const auto& [glyph, position] : layout.glyphs()) {
+    if (position.y() > 0 && glyph != ' ' && position.x() == 0) {
+      ASSERT_TRUE(glyph == 'f' || glyph == 'b');
+    }
+  }
+
+  // The width of a line doesn't include words that were moved to the next line
+  layout.set_text("foo foo"s);
+  const auto sentence = layout.size().width;
+
+  layout.set_text("foo"s);
+  const auto word = layout.size().width;
+
+  layout.set_text("foo foo"s);
+  layout.set_wrap_width(sentence - 1);
+  ASSERT_EQ(2, layout.line_count());
+  ASSERT_EQ(word, layout.size().width);
+
+  layout.set_text("foo bar foo bar"s);
+
+  // Words that are wider than the wrap width are broken
+  layout.set_wrap_width(1);
+  ASSERT_EQ(15 - 3, layout.line_count());
+
+  layout.set_wrap_width(0);
+  ASSERT_EQ(1, layout.line_count());
+}
+
+TEST_F(TextLayoutTest, Kerning)
+{
+  auto& font = m_cache->get_font();
+
+  font.set_kerning(true);
+  cen::text_layout kerned{*m_cache};
+  kerned.set_text("AVAVAV"s);
+
+  font.set_kerning(false);
+  cen::text_layout plain{*m_cache};
+  plain.set_text("AVAVAV"s);
+
+  const auto amount = font.kerning_amount('A', 'V');
+  ASSERT_EQ(plain.glyphs().at(1).position.x() + amount, kerned.glyphs().at(1).position.x());
+
+  font.set_kerning(true);
+}
+
+TEST_F(TextLayoutTest, Render)
+{
+  cen::text_layout layout{*m_cache, 100};
+  layout.set_text("Hello world, this is a longer string!"s);
+  ASSERT_NO_THROW(m_renderer->render_text(layout, {10, 10}));
+}
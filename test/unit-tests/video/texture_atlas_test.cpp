@@ -0,0 +1,106 @@
+#include "video/texture_atlas.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <string>  // string, to_string
+#include <vector>  // vector
+
+#include "core/exception.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+class TextureAtlasTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(TextureAtlasTest, Add)
+{
+  cen::atlas_builder builder{{64, 64}};
+  ASSERT_TRUE(builder.empty());
+  ASSERT_EQ((cen::iarea{64, 64}), builder.page_size());
+
+  builder.add("a", cen::surface{{16, 16}, cen::pixel_format::rgba8888});
+  ASSERT_EQ(1u, builder.size());
+
+  // Names must be unique
+  ASSERT_THROW(builder.add("a", cen::surface{{8, 8}, cen::pixel_format::rgba8888}),
+               cen::cen_error);
+
+  // Images must fit in a page
+  ASSERT_THROW(builder.add("b", cen::surface{{65, 8}, cen::pixel_format::rgba8888}),
+               cen::cen_error);
+
+  builder.clear();
+  ASSERT_TRUE(builder.empty());
+}
+
+TEST_F(TextureAtlasTest, Build)
+{
+  cen::atlas_builder builder{{128, 128}};
+
+  std::vector<cen::iarea> sizes;
+  for (auto i = 0; i < 20; ++i) {
+    const cen::iarea size{8 + (i * 7) % 25, 8 + (i * 11) % 19};
+    builder.add("sprite" + std::to_string(i), cen::surface{size, cen::pixel_format::rgba8888});
+    sizes.push_back(size);
+  }
+
+  const auto atlas = builder.build(*m_renderer);
+  ASSERT_EQ(20u, atlas.region_count());
+  ASSERT_EQ(1u, atlas.page_count());
+  ASSERT_FALSE(atlas.contains("foo"));
+  ASSERT_FALSE(atlas.find("foo"));
+  ASSERT_THROW(atlas.at("foo"), cen::cen_error);
+
+  std::vector<cen::irect> areas;
+  for (auto i = 0; i < 20; ++i) {
+    const auto& region = atlas.at("sprite" + std::to_string(i));
+    const auto& page = atlas.page_of(region);
+
+    ASSERT_EQ(sizes.at(i), region.source.size());
+    ASSERT_GE(region.source.x(), 0);
+    ASSERT_GE(region.source.y(), 0);
+    ASSERT_LE(region.source.max_x(), page.width());
+    ASSERT_LE(region.source.max_y(), page.height());
+
+    for (const auto& other : areas) {
+      ASSERT_FALSE(cen::intersects(region.source, other));
+    }
+
+    areas.push_back(region.source);
+  }
+
+  ASSERT_TRUE(atlas.render(*m_renderer, "sprite0", cen::irect{0, 0, 10, 10}));
+  ASSERT_FALSE(atlas.render(*m_renderer, "foo", cen::irect{0, 0, 10, 10}));
+}
+
+TEST_F(TextureAtlasTest, MultiplePages)
+{
+  cen::atlas_builder builder{{32, 32}, 0};
+  for (auto i = 0; i < 5; ++i) {
+    builder.add(std::to_string(i), cen::surface{{32, 16}, cen::pixel_format::rgba8888});
+  }
+
+  const auto atlas = builder.build(*m_renderer);
+  ASSERT_EQ(5u, atlas.region_count());
+  ASSERT_EQ(3u, atlas.page_count());
+
+  // The last page is cropped to the area used by its image
+  ASSERT_EQ((cen::iarea{32, 16}), atlas.page(2).size());
+}
@@ -0,0 +1,95 @@
+#include "video/texture_lock.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>        // array
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_copy_constructible_v
+
+#include "core/exception.hpp"
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::texture_lock>);
+static_assert(!std::is_copy_assignable_v<cen::texture_lock>);
+
+class TextureLockTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  [[nodiscard]] static auto make_texture(const cen::texture_access access) -> cen::texture
+  {
+    return cen::texture{*m_renderer, cen::pixel_format::rgba8888, access, {32, 16}};
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(TextureLockTest, Construction)
+{
+  auto streaming = make_texture(cen::texture_access::streaming);
+  ASSERT_NO_THROW(cen::texture_lock{streaming});
+  ASSERT_NO_THROW(cen::texture_lock(streaming, cen::irect{{4, 4}, {8, 8}}));
+  ASSERT_THROW(cen::texture_lock(streaming, cen::irect{{30, 0}, {8, 8}}), cen::cen_error);
+
+  auto target = make_texture(cen::texture_access::target);
+  ASSERT_THROW(cen::texture_lock{target}, cen::cen_error);
+}
+
+TEST_F(TextureLockTest, Defaults)
+{
+  auto texture = make_texture(cen::texture_access::streaming);
+
+  {
+    const cen::texture_lock lock{texture};
+    ASSERT_EQ(32, lock.width());
+    ASSERT_EQ(16, lock.height());
+    ASSERT_EQ((cen::irect{{0, 0}, {32, 16}}), lock.area());
+    ASSERT_GE(lock.pitch(), 32 * 4);
+    ASSERT_EQ(cen::pixel_format::rgba8888, lock.format_info().format());
+  }
+
+  {
+    const cen::texture_lock lock{texture, cen::irect{{4, 2}, {8, 6}}};
+    ASSERT_EQ(8, lock.width());
+    ASSERT_EQ(6, lock.height());
+    ASSERT_TRUE(lock.in_bounds({7, 5}));
+    ASSERT_FALSE(lock.in_bounds({8, 5}));
+  }
+}
+
+TEST_F(TextureLockTest, Write)
+{
+  auto texture = make_texture(cen::texture_access::streaming);
+  cen::texture_lock lock{texture, cen::irect{{8, 8}, {4, 4}}};
+
+  lock.fill(cen::colors::black);
+  lock.set_pixel({1, 2}, cen::colors::red);
+  ASSERT_EQ(lock.map(cen::colors::red), lock.row(2)[1]);
+
+  const auto white = lock.map(cen::colors::white);
+  const std::array<cen::u32, 6> pixels{white, white, white, white, white, white};
+
+  lock.blit_row(0, pixels, -1);
+  ASSERT_EQ(white, lock.row(0)[0]);
+  ASSERT_EQ(white, lock.row(0)[3]);
+
+  lock.for_each_pixel([](const cen::ipoint pos) {
+    return pos.x() == pos.y() ? cen::colors::white : cen::colors::black;
+  });
+  ASSERT_EQ(white, lock.row(3)[3]);
+  ASSERT_EQ(lock.map(cen::colors::black), lock.row(3)[2]);
+}
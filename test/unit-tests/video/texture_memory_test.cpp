@@ -0,0 +1,93 @@
+#include "video/texture_memory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+class TextureMemoryTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(TextureMemoryTest, BytesOf)
+{
+  using cen::pixel_format;
+
+  ASSERT_EQ(400u, cen::texture_memory::bytes_of(pixel_format::rgba8888, {10, 10}));
+  ASSERT_EQ(300u, cen::texture_memory::bytes_of(pixel_format::rgb24, {10, 10}));
+  ASSERT_EQ(150u, cen::texture_memory::bytes_of(pixel_format::iyuv, {10, 10}));
+  ASSERT_EQ(200u, cen::texture_memory::bytes_of(pixel_format::yuy2, {10, 10}));
+  ASSERT_EQ(0u, cen::texture_memory::bytes_of(pixel_format::rgba8888, {0, 10}));
+  ASSERT_EQ(0u, cen::texture_memory::bytes_of(nullptr));
+}
+
+TEST_F(TextureMemoryTest, Tracking)
+{
+  const auto bytes = cen::texture_memory::resident_bytes();
+  const auto count = cen::texture_memory::texture_count();
+
+  {
+    const cen::texture texture{*m_renderer,
+                               cen::pixel_format::rgba8888,
+                               cen::texture_access::target,
+                               {10, 20}};
+    ASSERT_EQ(bytes + 800u, cen::texture_memory::resident_bytes());
+    ASSERT_EQ(count + 1, cen::texture_memory::texture_count());
+
+    // Handles aren't accounted for
+    const cen::texture_handle handle{texture};
+    ASSERT_EQ(count + 1, cen::texture_memory::texture_count());
+  }
+
+  ASSERT_EQ(bytes, cen::texture_memory::resident_bytes());
+  ASSERT_EQ(count, cen::texture_memory::texture_count());
+
+  cen::texture texture{*m_renderer,
+                       cen::pixel_format::rgba8888,
+                       cen::texture_access::target,
+                       {10, 10}};
+  auto* released = texture.release();
+  ASSERT_EQ(bytes, cen::texture_memory::resident_bytes());
+  SDL_DestroyTexture(released);
+}
+
+TEST_F(TextureMemoryTest, Budget)
+{
+  ASSERT_EQ(0u, cen::texture_memory::budget());
+  ASSERT_FALSE(cen::texture_memory::over_budget());
+  ASSERT_TRUE(cen::texture_memory::fits(1'000'000));
+
+  const cen::texture texture{*m_renderer,
+                             cen::pixel_format::rgba8888,
+                             cen::texture_access::target,
+                             {10, 10}};
+
+  cen::texture_memory::set_budget(cen::texture_memory::resident_bytes() + 100);
+  ASSERT_FALSE(cen::texture_memory::over_budget());
+  ASSERT_TRUE(cen::texture_memory::fits(100));
+  ASSERT_FALSE(cen::texture_memory::fits(101));
+
+  cen::texture_memory::set_budget(1);
+  ASSERT_TRUE(cen::texture_memory::over_budget());
+  ASSERT_FALSE(cen::texture_memory::fits(0));
+
+  cen::texture_memory::set_budget(0);
+}
@@ -0,0 +1,185 @@
+#include "video/texture_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_copy_constructible_v
+#include <utility>      // move
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::texture_pool>);
+static_assert(!std::is_copy_assignable_v<cen::texture_pool>);
+
+static_assert(!std::is_copy_constructible_v<cen::texture_pool::lease>);
+static_assert(std::is_nothrow_move_constructible_v<cen::texture_pool::lease>);
+static_assert(std::is_nothrow_move_assignable_v<cen::texture_pool::lease>);
+
+class TexturePoolTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  [[nodiscard]] static auto acquire(cen::texture_pool& pool, const cen::iarea size)
+      -> cen::texture_pool::lease
+  {
+    return pool.acquire(*m_renderer,
+                        cen::pixel_format::rgba8888,
+                        cen::texture_access::target,
+                        size);
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(TexturePoolTest, Defaults)
+{
+  const cen::texture_pool pool;
+  ASSERT_EQ(cen::texture_pool::default_budget(), pool.budget());
+  ASSERT_EQ(0u, pool.resident_bytes());
+  ASSERT_EQ(0u, pool.idle_count());
+  ASSERT_EQ(0.0, pool.statistics().hit_rate());
+}
+
+TEST_F(TexturePoolTest, Acquire)
+{
+  cen::texture_pool pool;
+
+  SDL_Texture* first{};
+
+  {
+    auto lease = acquire(pool, {32, 16});
+    ASSERT_TRUE(lease);
+    ASSERT_EQ((cen::iarea{32, 16}), lease->size());
+    ASSERT_EQ(cen::texture_access::target, lease->access());
+
+    first = lease.get().get();
+    ASSERT_EQ(1u, pool.statistics().misses);
+    ASSERT_EQ(0u, pool.idle_count());
+  }
+
+  // The texture should have been returned to the pool
+  ASSERT_EQ(1u, pool.idle_count());
+  ASSERT_EQ(32u * 16u * 4u, pool.resident_bytes());
+
+  {
+    auto lease = acquire(pool, {32, 16});
+    ASSERT_EQ(first, lease.get().get());
+    ASSERT_EQ(1u, pool.statistics().hits);
+    ASSERT_EQ(0u, pool.resident_bytes());
+
+    // A different size cannot reuse the leased texture
+    auto other = acquire(pool, {16, 16});
+    ASSERT_EQ(2u, pool.statistics().misses);
+  }
+
+  ASSERT_EQ(2u, pool.idle_count());
+  ASSERT_DOUBLE_EQ(1.0 / 3.0, pool.statistics().hit_rate());
+
+  pool.reset_statistics();
+  ASSERT_EQ(0u, pool.statistics().hits);
+  ASSERT_EQ(0u, pool.statistics().misses);
+}
+
+TEST_F(TexturePoolTest, Release)
+{
+  cen::texture_pool pool;
+
+  auto lease = acquire(pool, {8, 8});
+  const auto texture = lease.release();
+
+  ASSERT_FALSE(lease);
+  ASSERT_TRUE(texture.get());
+
+  lease.reset();
+  ASSERT_EQ(0u, pool.idle_count());
+}
+
+TEST_F(TexturePoolTest, MoveLease)
+{
+  cen::texture_pool pool;
+
+  auto lease = acquire(pool, {8, 8});
+  auto moved = std::move(lease);
+
+  ASSERT_FALSE(lease);
+  ASSERT_TRUE(moved);
+
+  moved.reset();
+  ASSERT_FALSE(moved);
+  ASSERT_EQ(1u, pool.idle_count());
+}
+
+TEST_F(TexturePoolTest, Budget)
+{
+  constexpr auto bytes = 16u * 16u * 4u;
+  cen::texture_pool pool{2 * bytes};
+
+  {
+    auto a = acquire(pool, {16, 16});
+    auto b = acquire(pool, {16, 16});
+    auto c = acquire(pool, {16, 16});
+  }
+
+  // Only two of the three textures fit in the budget
+  ASSERT_EQ(2u, pool.idle_count());
+  ASSERT_EQ(2 * bytes, pool.resident_bytes());
+  ASSERT_EQ(1u, pool.statistics().evictions);
+
+  pool.set_budget(bytes);
+  ASSERT_EQ(1u, pool.idle_count());
+  ASSERT_EQ(bytes, pool.resident_bytes());
+
+  pool.trim(0);
+  ASSERT_EQ(0u, pool.idle_count());
+  ASSERT_EQ(0u, pool.resident_bytes());
+}
+
+TEST_F(TexturePoolTest, Clear)
+{
+  cen::texture_pool pool{0};
+
+  {
+    auto a = acquire(pool, {16, 16});
+    auto b = acquire(pool, {8, 8});
+  }
+
+  ASSERT_EQ(2u, pool.idle_count());
+
+  pool.clear();
+  ASSERT_EQ(0u, pool.idle_count());
+  ASSERT_EQ(0u, pool.resident_bytes());
+  ASSERT_EQ(2u, pool.statistics().evictions);
+}
+
+TEST_F(TexturePoolTest, FreeMemory)
+{
+  constexpr auto bytes = 16u * 16u * 4u;
+  cen::texture_pool pool{0};
+
+  {
+    auto a = acquire(pool, {16, 16});
+    auto b = acquire(pool, {16, 16});
+    auto c = acquire(pool, {16, 16});
+  }
+
+  // Whole textures are destroyed, so slightly more than requested may be freed
+  ASSERT_EQ(bytes, pool.free_memory(1));
+  ASSERT_EQ(2u, pool.idle_count());
+
+  ASSERT_EQ(2 * bytes, pool.free_memory(10 * bytes));
+  ASSERT_EQ(0u, pool.idle_count());
+  ASSERT_EQ(0u, pool.free_memory(bytes));
+}
@@ -0,0 +1,203 @@
+#include "video/texture_streamer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_copy_constructible_v
+
+#include "video/renderer.hpp"
+#include "video/surface.hpp"
+#include "video/texture_memory.hpp"
+#include "video/window.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::texture_streamer>);
+static_assert(!std::is_copy_assignable_v<cen::texture_streamer>);
+
+class TextureStreamerTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  void TearDown() override
+  {
+    cen::texture_memory::set_budget(0);
+  }
+
+  // A 256x256 image, which is 256 KiB at full resolution
+  [[nodiscard]] static auto add_image(cen::texture_streamer& streamer)
+      -> cen::texture_streamer::id_type
+  {
+    return streamer.add([] { return cen::surface{{256, 256}, cen::pixel_format::rgba32}; });
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(TextureStreamerTest, Defaults)
+{
+  const cen::texture_streamer streamer;
+  ASSERT_EQ(0u, streamer.size());
+  ASSERT_EQ(0u, streamer.resident_bytes());
+  ASSERT_EQ(0u, streamer.statistics().loads);
+}
+
+TEST_F(TextureStreamerTest, SmallTexture)
+{
+  cen::texture_streamer streamer;
+
+  const auto id = add_image(streamer);
+  ASSERT_EQ(1u, streamer.size());
+  ASSERT_FALSE(streamer.is_resident(id));
+
+  const auto& texture = streamer.acquire(*m_renderer, id);
+  ASSERT_TRUE(streamer.is_resident(id));
+  ASSERT_EQ(cen::texture_streamer::full_level, streamer.level(id));
+  ASSERT_EQ(1.0f, streamer.scale(id));
+  ASSERT_EQ(256, texture.width());
+  ASSERT_EQ(1u, streamer.statistics().loads);
+
+  streamer.unload(id);
+  ASSERT_FALSE(streamer.is_resident(id));
+  ASSERT_EQ(0u, streamer.resident_bytes());
+}
+
+TEST_F(TextureStreamerTest, Promotion)
+{
+  cen::texture_streamer streamer;
+  streamer.set_large_threshold(64u * 1'024u);
+
+  // Large textures are loaded at a quarter of their resolution first
+  const auto id = add_image(streamer);
+  ASSERT_EQ(64, streamer.acquire(*m_renderer, id).width());
+  ASSERT_EQ(cen::texture_streamer::lowest_level, streamer.level(id));
+  ASSERT_EQ(0.25f, streamer.scale(id));
+
+  streamer.update(*m_renderer);
+  ASSERT_EQ(1, streamer.level(id));
+  ASSERT_TRUE(streamer.render(*m_renderer, id, {{0, 0}, {128, 128}}, {{0, 0}, {10, 10}}));
+
+  streamer.update(*m_renderer);
+  ASSERT_EQ(cen::texture_streamer::full_level, streamer.level(id));
+  ASSERT_EQ(256, streamer.acquire(*m_renderer, id).width());
+  ASSERT_EQ(2u, streamer.statistics().promotions);
+
+  // Textures that aren't in use aren't promoted
+  const auto other = add_image(streamer);
+  ASSERT_TRUE(streamer.render(*m_renderer, other, {{0, 0}, {10, 10}}));
+  streamer.update(*m_renderer);
+  streamer.update(*m_renderer);
+  ASSERT_EQ(1, streamer.level(other));
+}
+
+TEST_F(TextureStreamerTest, Demotion)
+{
+  cen::texture_streamer streamer;
+  streamer.set_large_threshold(64u * 1'024u);
+  streamer.set_idle_frames(2);
+
+  const auto id = add_image(streamer);
+  streamer.acquire(*m_renderer, id);
+  streamer.update(*m_renderer);
+  ASSERT_EQ(1, streamer.level(id));
+
+  streamer.update(*m_renderer);
+  ASSERT_EQ(1, streamer.level(id));
+
+  streamer.update(*m_renderer);
+  ASSERT_EQ(cen::texture_streamer::lowest_level, streamer.level(id));
+  ASSERT_EQ(1u, streamer.statistics().demotions);
+}
+
+TEST_F(TextureStreamerTest, FinestLevel)
+{
+  cen::texture_streamer streamer;
+  ASSERT_EQ(cen::texture_streamer::full_level, streamer.finest_level());
+
+  const auto id = add_image(streamer);
+  streamer.acquire(*m_renderer, id);
+  ASSERT_EQ(cen::texture_streamer::full_level, streamer.level(id));
+
+  cen::power_change change;
+  change.settings.texture_level = 1;
+  streamer.handle(change);
+  ASSERT_EQ(1, streamer.finest_level());
+
+  // Resident textures are demoted, and aren't promoted beyond the finest level
+  streamer.update(*m_renderer);
+  ASSERT_EQ(1, streamer.level(id));
+  ASSERT_EQ(1u, streamer.statistics().demotions);
+
+  streamer.acquire(*m_renderer, id);
+  streamer.update(*m_renderer);
+  ASSERT_EQ(1, streamer.level(id));
+
+  // New textures are loaded at the finest level
+  const auto other = add_image(streamer);
+  ASSERT_EQ(128, streamer.acquire(*m_renderer, other).width());
+
+  streamer.set_finest_level(cen::texture_streamer::full_level);
+  streamer.acquire(*m_renderer, id);
+  streamer.update(*m_renderer);
+  ASSERT_EQ(cen::texture_streamer::full_level, streamer.level(id));
+}
+
+TEST_F(TextureStreamerTest, FreeMemory)
+{
+  cen::texture_streamer streamer;
+
+  const auto first = add_image(streamer);
+  const auto second = add_image(streamer);
+
+  streamer.acquire(*m_renderer, first);
+  streamer.update(*m_renderer);
+  streamer.acquire(*m_renderer, second);
+
+  // Textures that have been used in the current frame are never evicted
+  const auto bytes = streamer.resident_bytes() / 2;
+  ASSERT_EQ(bytes, streamer.free_memory(1));
+  ASSERT_FALSE(streamer.is_resident(first));
+  ASSERT_TRUE(streamer.is_resident(second));
+
+  ASSERT_EQ(0u, streamer.free_memory(bytes));
+  ASSERT_EQ(1u, streamer.statistics().evictions);
+}
+
+TEST_F(TextureStreamerTest, Eviction)
+{
+  cen::texture_streamer streamer;
+
+  const auto first = add_image(streamer);
+  const auto second = add_image(streamer);
+
+  streamer.acquire(*m_renderer, first);
+  streamer.update(*m_renderer);
+  streamer.acquire(*m_renderer, second);
+
+  // Textures that have been used in the current frame are never evicted
+  cen::texture_memory::set_budget(1);
+  streamer.update(*m_renderer);
+
+  ASSERT_FALSE(streamer.is_resident(first));
+  ASSERT_TRUE(streamer.is_resident(second));
+  ASSERT_EQ(1u, streamer.statistics().evictions);
+
+  streamer.update(*m_renderer);
+  ASSERT_FALSE(streamer.is_resident(second));
+  ASSERT_EQ(2u, streamer.statistics().evictions);
+
+  // Evicted textures are loaded again when acquired
+  streamer.acquire(*m_renderer, first);
+  ASSERT_TRUE(streamer.is_resident(first));
+  ASSERT_EQ(3u, streamer.statistics().loads);
+}
@@ -6,6 +6,7 @@
 #include <iostream>  // clog
 #include <memory>    // unique_ptr
 #include <type_traits>
+#include <vector>    // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
@@ -118,6 +119,87 @@ TEST_F(TextureTest, SetPixel)
   ASSERT_NO_THROW(texture.set_pixel({45, 23}, color));
 }
 
+TEST_F(TextureTest, Update)
+{
+  constexpr auto format = cen::pixel_format::argb8888;
+  constexpr cen::iarea size{8, 8};
+
+  cen::texture texture{*m_renderer, format, cen::texture_access::no_lock, size};
+
+  const std::vector<cen::u32> pixels(64, 0xFF00FF00);
+  ASSERT_TRUE(texture.update(std::nullopt, pixels.data(), size.width * 4));
+  ASSERT_TRUE(texture.update(cen::irect{2, 2, 4, 4}, pixels.data(), 4 * 4));
+}
+
+TEST_F(TextureTest, UpdateYUV)
+{
+  constexpr cen::iarea size{16, 8};
+
+  cen::texture texture{*m_renderer,
+                       cen::pixel_format::iyuv,
+                       cen::texture_access::streaming,
+                       size};
+
+  const std::vector<cen::u8> luma(16 * 8, 0x80);
+  const std::vector<cen::u8> chroma(8 * 4, 0x40);
+
+  ASSERT_TRUE(texture.update_yuv(std::nullopt,
+                                 luma.data(),
+                                 size.width,
+                                 chroma.data(),
+                                 size.width / 2,
+                                 chroma.data(),
+                                 size.width / 2));
+  ASSERT_TRUE(texture.update_yuv(cen::irect{2, 2, 4, 4},
+                                 luma.data(),
+                                 size.width,
+                                 chroma.data(),
+                                 size.width / 2,
+                                 chroma.data(),
+                                 size.width / 2));
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+
+TEST_F(TextureTest, UpdateNV)
+{
+  constexpr cen::iarea size{16, 8};
+
+  cen::texture texture{*m_renderer,
+                       cen::pixel_format::nv12,
+                       cen::texture_access::streaming,
+                       size};
+
+  const std::vector<cen::u8> luma(16 * 8, 0x80);
+  const std::vector<cen::u8> chroma(16 * 4, 0x40);
+
+  ASSERT_TRUE(texture.update_nv(std::nullopt, luma.data(), size.width, chroma.data(), 16));
+  ASSERT_TRUE(
+      texture.update_nv(cen::irect{4, 2, 8, 4}, luma.data(), size.width, chroma.data(), 16));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+
+TEST_F(TextureTest, Upload)
+{
+  constexpr auto format = cen::pixel_format::argb8888;
+  constexpr cen::iarea size{32, 16};
+
+  cen::texture texture{*m_renderer, format, cen::texture_access::streaming, size};
+  cen::surface source{size, format};
+  cen::dirty_region region{size};
+
+  // Nothing to upload
+  ASSERT_TRUE(texture.upload(source, region));
+
+  source.set_pixel({5, 4}, cen::colors::red);
+  region.mark(cen::irect{4, 4, 8, 2});
+  region.mark(cen::irect{20, 10, 4, 4});
+
+  ASSERT_TRUE(texture.upload(source, region));
+  ASSERT_FALSE(region.is_dirty());
+}
+
 TEST_F(TextureTest, SetBlendMode)
 {
   const auto previous = m_texture->get_blend_mode();
@@ -130,6 +212,16 @@ TEST_F(TextureTest, SetBlendMode)
   m_texture->set_blend_mode(previous);
 }
 
+TEST_F(TextureTest, SetPremultipliedBlendMode)
+{
+  const auto previous = m_texture->get_blend_mode();
+
+  ASSERT_TRUE(m_texture->set_premultiplied_blend_mode());
+  ASSERT_EQ(cen::premultiplied_blend_mode(), m_texture->get_blend_mode());
+
+  m_texture->set_blend_mode(previous);
+}
+
 TEST_F(TextureTest, SetAlpha)
 {
   const auto previous = m_texture->alpha();
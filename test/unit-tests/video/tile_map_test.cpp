@@ -0,0 +1,141 @@
+#include "video/tile_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class TileMapTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_tileset = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_tileset.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_tileset;
+};
+
+TEST_F(TileMapTest, Defaults)
+{
+  const cen::tile_map map{*m_tileset, {16, 16}, 40, 20, 8};
+  ASSERT_EQ(40u, map.columns());
+  ASSERT_EQ(20u, map.rows());
+  ASSERT_EQ(8u, map.chunk_size());
+  ASSERT_EQ((cen::iarea{16, 16}), map.tile_size());
+  ASSERT_EQ(15u, map.chunk_count());  // 5 x 3, the last row is partially used
+  ASSERT_EQ(cen::tile_cache_mode::geometry, map.cache_mode());
+  ASSERT_EQ(cen::tile_map::empty_tile, map.tile(39, 19));
+}
+
+TEST_F(TileMapTest, SetTile)
+{
+  cen::tile_map map{*m_tileset, {16, 16}, 40, 20, 8};
+
+  map.set_tile(3, 7, 12);
+  ASSERT_EQ(12u, map.tile(3, 7));
+  ASSERT_EQ(cen::tile_map::empty_tile, map.tile(7, 3));
+
+  map.fill(2);
+  ASSERT_EQ(2u, map.tile(0, 0));
+  ASSERT_EQ(2u, map.tile(39, 19));
+}
+
+TEST_F(TileMapTest, Render)
+{
+  cen::tile_map map{*m_tileset, {16, 16}, 40, 20, 8};
+  map.fill(1);
+
+  // Covers the 2x2 chunks in the upper-left corner
+  m_renderer->set_translation_viewport({8, 8, 200, 200});
+  ASSERT_TRUE(map.render(*m_renderer));
+
+  const auto& stats = map.stats();
+  ASSERT_EQ(4u, stats.visibleChunks);
+  ASSERT_EQ(4u, stats.rebuiltChunks);
+  ASSERT_EQ(4u * 64u, stats.tiles);
+  ASSERT_EQ(1u, stats.drawCalls);
+
+  // Nothing changed, so no chunks are rebuilt
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(0u, map.stats().rebuiltChunks);
+
+  // Only the chunk that contains the changed tile is rebuilt
+  map.set_tile(9, 1, cen::tile_map::empty_tile);
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(1u, map.stats().rebuiltChunks);
+  ASSERT_EQ((4u * 64u) - 1u, map.stats().tiles);
+
+  // Setting a tile to its current value doesn't invalidate the chunk
+  map.set_tile(9, 1, cen::tile_map::empty_tile);
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(0u, map.stats().rebuiltChunks);
+
+  map.invalidate();
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(4u, map.stats().rebuiltChunks);
+
+  m_renderer->set_translation_viewport({});
+}
+
+TEST_F(TileMapTest, Culling)
+{
+  cen::tile_map map{*m_tileset, {16, 16}, 40, 20, 8};
+  map.fill(1);
+
+  m_renderer->set_translation_viewport({});
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(0u, map.stats().visibleChunks);
+  ASSERT_EQ(0u, map.stats().drawCalls);
+
+  // Outside of the map
+  m_renderer->set_translation_viewport({-500, -500, 100, 100});
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(0u, map.stats().visibleChunks);
+
+  // The bottom-right chunk, which is only half used
+  m_renderer->set_translation_viewport({600, 300, 100, 100});
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(1u, map.stats().visibleChunks);
+  ASSERT_EQ(32u, map.stats().tiles);
+
+  m_renderer->set_translation_viewport({});
+}
+
+TEST_F(TileMapTest, TextureCacheMode)
+{
+  cen::tile_map map{*m_tileset, {16, 16}, 40, 20, 8};
+  map.fill(1);
+
+  map.set_cache_mode(cen::tile_cache_mode::texture);
+  ASSERT_EQ(cen::tile_cache_mode::texture, map.cache_mode());
+
+  m_renderer->set_translation_viewport({8, 8, 200, 200});
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(4u, map.stats().rebuiltChunks);
+  ASSERT_EQ(8u, map.stats().drawCalls);  // One bake and one copy for each chunk
+
+  ASSERT_TRUE(map.render(*m_renderer));
+  ASSERT_EQ(0u, map.stats().rebuiltChunks);
+  ASSERT_EQ(4u, map.stats().drawCalls);
+
+  m_renderer->set_translation_viewport({});
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 
 #include <cereal/types/vector.hpp>
+#include <stdexcept>  // out_of_range
+#include <string>     // string
+#include <utility>    // move
 
 #include "serialization_utils.hpp"
 
@@ -150,8 +153,71 @@ TEST(UnicodeString, Reserve)
 {
   cen::unicode_string str;
 
+  // Small amounts fit in the internal buffer
   str.reserve(10u);
-  ASSERT_EQ(10u, str.capacity());
+  ASSERT_EQ(cen::unicode_string::inline_capacity, str.capacity());
+  ASSERT_TRUE(str.is_inline());
+
+  str.reserve(100u);
+  ASSERT_EQ(100u, str.capacity());
+  ASSERT_FALSE(str.is_inline());
+}
+
+TEST(UnicodeString, InlineStorage)
+{
+  cen::unicode_string str;
+  ASSERT_TRUE(str.is_inline());
+
+  for (cen::unicode_string::size_type index = 1; index < str.inline_capacity; ++index) {
+    str += 'a'_uni;
+  }
+
+  ASSERT_TRUE(str.is_inline());
+  ASSERT_EQ(cen::unicode_string::inline_capacity - 1, str.size());
+  ASSERT_EQ(0, str.at(str.size()));  // null-terminator
+
+  // The null-terminator no longer fits in the internal buffer
+  str += 'b'_uni;
+  ASSERT_FALSE(str.is_inline());
+  ASSERT_EQ(cen::unicode_string::inline_capacity, str.size());
+  ASSERT_EQ('a'_uni, str.at(0));
+  ASSERT_EQ('b'_uni, str.at(str.size() - 1));
+  ASSERT_EQ(0, str.at(str.size()));
+
+  str.pop_back();
+  ASSERT_EQ(cen::unicode_string::inline_capacity - 1, str.size());
+  ASSERT_EQ(0, str.data()[str.size()]);
+
+  ASSERT_THROW((void) str.at(str.size() + 1), std::out_of_range);
+}
+
+TEST(UnicodeString, CopyAndMove)
+{
+  cen::unicode_string str;
+  str.reserve(100u);
+  str.append('a'_uni, 'b'_uni);
+  ASSERT_FALSE(str.is_inline());
+
+  // Short copies use the internal buffer
+  const auto copy = str;
+  ASSERT_TRUE(copy.is_inline());
+  ASSERT_EQ(str, copy);
+
+  auto moved = std::move(str);
+  ASSERT_FALSE(moved.is_inline());
+  ASSERT_EQ(copy, moved);
+
+  ASSERT_TRUE(str.empty());  // NOLINT
+  ASSERT_TRUE(str.is_inline());
+  ASSERT_EQ(0, str.at(0));
+
+  cen::unicode_string other{'x'};
+  other = copy;
+  ASSERT_EQ(copy, other);
+
+  other = std::move(moved);
+  ASSERT_EQ(copy, other);
+  ASSERT_EQ(0, *other.end());
 }
 
 TEST(UnicodeString, EqualityOperator)
@@ -239,4 +305,90 @@ TEST(UnicodeString, Serialize)
 
   const auto other = serialize_create<cen::unicode_string>("unicode_string.binary");
   ASSERT_EQ(string, other);
+
+  cen::unicode_string longString;
+  for (auto index = 0; index < 100; ++index) {
+    longString += static_cast<cen::unicode>('a' + (index % 26));
+  }
+
+  serialize_save("unicode_string_long.binary", longString);
+
+  const auto loaded = serialize_create<cen::unicode_string>("unicode_string_long.binary");
+  ASSERT_EQ(longString, loaded);
+  ASSERT_EQ(0, *loaded.end());
+}
+
+TEST(UnicodeString, Resize)
+{
+  cen::unicode_string str{'a', 'b', 'c'};
+
+  str.resize(5);
+  ASSERT_EQ(5u, str.size());
+  ASSERT_EQ('c'_uni, str.at(2));
+  ASSERT_EQ(0, str.at(3));
+  ASSERT_EQ(0, str.at(5));  // null-terminator
+
+  str.resize(1);
+  ASSERT_EQ(1u, str.size());
+  ASSERT_EQ(0, str.at(1));
+
+  str.resize(100);
+  ASSERT_FALSE(str.is_inline());
+  ASSERT_EQ('a'_uni, str.at(0));
+  ASSERT_EQ(0, str.at(100));
+
+  str.resize(2);
+  ASSERT_EQ(2u, str.size());
+  ASSERT_EQ(0, str.at(2));
+}
+
+TEST(UnicodeString, ToUnicodeString)
+{
+  {  // ASCII, long enough to use SIMD instructions
+    const std::string ascii = "The quick brown fox jumps over the lazy dog";
+    const auto str = cen::to_unicode_string(ascii);
+    ASSERT_TRUE(str);
+    ASSERT_EQ(ascii.size(), str->size());
+    ASSERT_EQ('T'_uni, str->at(0));
+    ASSERT_EQ('g'_uni, str->at(ascii.size() - 1));
+    ASSERT_EQ(0, str->at(ascii.size()));
+  }
+
+  {  // Two, three and four byte sequences
+    const auto str = cen::to_unicode_string("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x8C\x88");
+    ASSERT_TRUE(str);
+
+    const cen::unicode_string expected{'a'_uni, 0xE9_uni, 0x20AC_uni, 0xD83C_uni, 0xDF08_uni};
+    ASSERT_EQ(expected, *str);
+  }
+
+  ASSERT_TRUE(cen::to_unicode_string(""));
+  ASSERT_TRUE(cen::to_unicode_string("")->empty());
+
+  ASSERT_FALSE(cen::to_unicode_string("\x80"));              // Lone continuation byte
+  ASSERT_FALSE(cen::to_unicode_string("\xC3"));              // Truncated sequence
+  ASSERT_FALSE(cen::to_unicode_string("\xC0\xAF"));          // Overlong encoding
+  ASSERT_FALSE(cen::to_unicode_string("\xE0\x80\xAF"));      // Overlong encoding
+  ASSERT_FALSE(cen::to_unicode_string("\xED\xA0\x80"));      // Encoded surrogate
+  ASSERT_FALSE(cen::to_unicode_string("\xF4\x90\x80\x80"));  // Above U+10FFFF
+  ASSERT_FALSE(cen::to_unicode_string("abcdefghijklmnopqrstuvwxyz\xFF"));
+}
+
+TEST(UnicodeString, ToUtf8)
+{
+  const std::string text = "Gr\xC3\xBC\xC3\x9F" "e, \xE2\x82\xAC and \xF0\x9F\x8C\x88 "
+                           "followed by a long run of ASCII characters";
+
+  const auto str = cen::to_unicode_string(text);
+  ASSERT_TRUE(str);
+
+  const auto utf8 = cen::to_utf8(*str);
+  ASSERT_TRUE(utf8);
+  ASSERT_EQ(text, *utf8);
+
+  ASSERT_EQ("", cen::to_utf8(cen::unicode_string{}));
+
+  ASSERT_FALSE(cen::to_utf8(cen::unicode_string{'a'_uni, 0xD83C_uni}));
+  ASSERT_FALSE(cen::to_utf8(cen::unicode_string{0xDF08_uni, 'a'_uni}));
+  ASSERT_FALSE(cen::to_utf8(cen::unicode_string{0xD83C_uni, 'a'_uni}));
 }
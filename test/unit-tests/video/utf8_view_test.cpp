@@ -0,0 +1,68 @@
+#include "video/utf8_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iterator>  // distance
+#include <vector>    // vector
+
+#include "video/unicode_string.hpp"
+
+using namespace cen::literals;
+
+TEST(UTF8View, Empty)
+{
+  const cen::utf8_view view{""};
+  ASSERT_TRUE(view.empty());
+  ASSERT_EQ(view.begin(), view.end());
+  ASSERT_EQ(0, std::distance(view.begin(), view.end()));
+}
+
+TEST(UTF8View, ASCII)
+{
+  const cen::utf8_view view{"abc"};
+  ASSERT_FALSE(view.empty());
+  ASSERT_EQ("abc", view.str());
+
+  const std::vector<cen::unicode> glyphs(view.begin(), view.end());
+  ASSERT_EQ((std::vector<cen::unicode>{'a'_uni, 'b'_uni, 'c'_uni}), glyphs);
+}
+
+TEST(UTF8View, MatchesUnicodeString)
+{
+  const auto* text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x8C\x88z";
+  const cen::utf8_view view{text};
+
+  const auto expected = cen::to_unicode_string(text);
+  ASSERT_TRUE(expected);
+
+  // Code points outside of the BMP are iterated as surrogate pairs
+  const std::vector<cen::unicode> glyphs(view.begin(), view.end());
+  ASSERT_EQ(std::vector<cen::unicode>(expected->begin(), expected->end()), glyphs);
+  ASSERT_EQ(0xD83C_uni, glyphs.at(3));
+  ASSERT_EQ(0xDF08_uni, glyphs.at(4));
+}
+
+TEST(UTF8View, InvalidSequences)
+{
+  const cen::utf8_view view{"a\x80\xC3z\xF0\x9F"};
+
+  const std::vector<cen::unicode> glyphs(view.begin(), view.end());
+  const std::vector<cen::unicode> expected{'a'_uni,
+                                           cen::utf8_view::replacement,
+                                           cen::utf8_view::replacement,
+                                           'z'_uni,
+                                           cen::utf8_view::replacement,
+                                           cen::utf8_view::replacement};
+  ASSERT_EQ(expected, glyphs);
+}
+
+TEST(UTF8View, RangeBasedFor)
+{
+  int count = 0;
+  for (const cen::unicode glyph : cen::utf8_view{"\xE2\x82\xAC\xE2\x82\xAC"}) {
+    ASSERT_EQ(0x20AC_uni, glyph);
+    ++count;
+  }
+
+  ASSERT_EQ(2, count);
+}
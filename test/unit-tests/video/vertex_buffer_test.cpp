@@ -0,0 +1,117 @@
+#include "video/vertex_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include "video/colors.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST(VertexBuffer, Defaults)
+{
+  const cen::vertex_buffer buffer;
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(0u, buffer.triangle_count());
+  ASSERT_TRUE(buffer.vertices().empty());
+  ASSERT_TRUE(buffer.indices().empty());
+}
+
+TEST(VertexBuffer, MakeVertex)
+{
+  const auto vertex = cen::make_vertex({1, 2}, cen::colors::red, {0.25f, 0.75f});
+  ASSERT_EQ(1, vertex.position.x);
+  ASSERT_EQ(2, vertex.position.y);
+  ASSERT_EQ(cen::colors::red, cen::color{vertex.color});
+  ASSERT_EQ(0.25f, vertex.tex_coord.x);
+  ASSERT_EQ(0.75f, vertex.tex_coord.y);
+}
+
+TEST(VertexBuffer, AddTriangle)
+{
+  cen::vertex_buffer buffer;
+
+  const auto a = buffer.add_vertex({0, 0});
+  const auto b = buffer.add_vertex({10, 0});
+  const auto c = buffer.add_vertex({0, 10}, cen::colors::blue, {0, 1});
+  ASSERT_EQ(0, a);
+  ASSERT_EQ(1, b);
+  ASSERT_EQ(2, c);
+
+  // Unindexed vertices form triangles of their own
+  ASSERT_EQ(1u, buffer.triangle_count());
+  ASSERT_FALSE(buffer.empty());
+
+  buffer.add_triangle(a, b, c);
+  buffer.add_triangle(c, b, a);
+  ASSERT_EQ(2u, buffer.triangle_count());
+  ASSERT_EQ(6u, buffer.indices().size());
+  ASSERT_EQ(cen::colors::blue, cen::color{buffer.vertices().at(2).color});
+}
+
+TEST(VertexBuffer, AddVertices)
+{
+  cen::vertex_buffer buffer;
+  buffer.add_vertex({0, 0});
+
+  const cen::vertex vertices[] = {cen::make_vertex({1, 1}), cen::make_vertex({2, 2})};
+  ASSERT_EQ(1, buffer.add_vertices(vertices, 2));
+  ASSERT_EQ(3u, buffer.vertices().size());
+  ASSERT_EQ(2, buffer.vertices().at(2).position.x);
+}
+
+TEST(VertexBuffer, AddQuad)
+{
+  cen::vertex_buffer buffer;
+  buffer.add_quad({10, 20, 30, 40}, {0, 0, 0.5f, 0.25f}, cen::colors::red);
+
+  ASSERT_EQ(2u, buffer.triangle_count());
+  ASSERT_EQ(4u, buffer.vertices().size());
+
+  const auto& corner = buffer.vertices().at(2);  // The lower-right corner
+  ASSERT_EQ(40, corner.position.x);
+  ASSERT_EQ(60, corner.position.y);
+  ASSERT_EQ(0.5f, corner.tex_coord.x);
+  ASSERT_EQ(0.25f, corner.tex_coord.y);
+  ASSERT_EQ(cen::colors::red, cen::color{corner.color});
+}
+
+TEST(VertexBuffer, ClearRetainsCapacity)
+{
+  cen::vertex_buffer buffer;
+  buffer.reserve(100, 150);
+
+  for (int i = 0; i < 10; ++i) {
+    buffer.add_quad({0, 0, 10, 10});
+  }
+
+  const auto capacity = buffer.vertices().capacity();
+  buffer.clear();
+
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(capacity, buffer.vertices().capacity());
+  ASSERT_GE(buffer.indices().capacity(), 150u);
+}
+
+TEST(StridedGeometry, From)
+{
+  const cen::fpoint positions[] = {{0, 0}, {1, 0}, {0, 1}};
+  const cen::color colors[] = {cen::colors::red, cen::colors::green, cen::colors::blue};
+
+  const auto geometry = cen::strided_geometry::from(positions, colors, nullptr, 3);
+  ASSERT_EQ(&positions[0].data()->x, geometry.positions);
+  ASSERT_EQ(static_cast<int>(sizeof(cen::fpoint)), geometry.positionStride);
+  ASSERT_EQ(colors[0].data(), geometry.colors);
+  ASSERT_EQ(static_cast<int>(sizeof(cen::color)), geometry.colorStride);
+  ASSERT_EQ(nullptr, geometry.uvs);
+  ASSERT_EQ(3, geometry.vertexCount);
+  ASSERT_EQ(nullptr, geometry.indices);
+  ASSERT_EQ(1u, geometry.triangle_count());
+
+  const cen::u8 indices[] = {0, 1, 2, 2, 1, 0};
+  const auto indexed = geometry.with_indices(indices, 6);
+  ASSERT_EQ(indices, indexed.indices);
+  ASSERT_EQ(6, indexed.indexCount);
+  ASSERT_EQ(1, indexed.indexSize);
+  ASSERT_EQ(2u, indexed.triangle_count());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
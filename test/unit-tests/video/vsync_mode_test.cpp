@@ -0,0 +1,25 @@
+#include "video/vsync_mode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+#include "core/to_underlying.hpp"
+
+TEST(VSyncMode, Values)
+{
+  ASSERT_EQ(0, cen::to_underlying(cen::vsync_mode::off));
+  ASSERT_EQ(1, cen::to_underlying(cen::vsync_mode::on));
+  ASSERT_EQ(-1, cen::to_underlying(cen::vsync_mode::adaptive));
+}
+
+TEST(VSyncMode, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::vsync_mode>(2)), cen::cen_error);
+
+  ASSERT_EQ("off", cen::to_string(cen::vsync_mode::off));
+  ASSERT_EQ("on", cen::to_string(cen::vsync_mode::on));
+  ASSERT_EQ("adaptive", cen::to_string(cen::vsync_mode::adaptive));
+
+  std::clog << "VSync mode example: " << cen::vsync_mode::adaptive << '\n';
+}
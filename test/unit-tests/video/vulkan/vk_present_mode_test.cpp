@@ -0,0 +1,28 @@
+#include "video/vulkan/vk_present_mode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // clog
+
+#include "core/to_underlying.hpp"
+
+TEST(VulkanPresentMode, Values)
+{
+  // These match the values of VkPresentModeKHR
+  ASSERT_EQ(0, cen::to_underlying(cen::vk_present_mode::immediate));
+  ASSERT_EQ(1, cen::to_underlying(cen::vk_present_mode::mailbox));
+  ASSERT_EQ(2, cen::to_underlying(cen::vk_present_mode::fifo));
+  ASSERT_EQ(3, cen::to_underlying(cen::vk_present_mode::fifo_relaxed));
+}
+
+TEST(VulkanPresentMode, ToString)
+{
+  ASSERT_THROW(cen::to_string(static_cast<cen::vk_present_mode>(4)), cen::cen_error);
+
+  ASSERT_EQ("immediate", cen::to_string(cen::vk_present_mode::immediate));
+  ASSERT_EQ("mailbox", cen::to_string(cen::vk_present_mode::mailbox));
+  ASSERT_EQ("fifo", cen::to_string(cen::vk_present_mode::fifo));
+  ASSERT_EQ("fifo_relaxed", cen::to_string(cen::vk_present_mode::fifo_relaxed));
+
+  std::clog << "Vulkan present mode example: " << cen::vk_present_mode::mailbox << '\n';
+}
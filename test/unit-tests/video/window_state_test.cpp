@@ -0,0 +1,79 @@
+#include "video/window_state.hpp"
+
+#include <gtest/gtest.h>
+
+#include "video/window.hpp"
+
+TEST(WindowState, Defaults)
+{
+  const cen::window window;
+  const cen::window_state state{window};
+
+  ASSERT_EQ(window.size(), state.size());
+  ASSERT_EQ(window.position(), state.position());
+  ASSERT_EQ(window.flags(), state.flags());
+  ASSERT_EQ(window.display_index(), state.display_index());
+  ASSERT_EQ(window.is_hidden(), state.is_hidden());
+  ASSERT_EQ(cen::screen::refresh_rate(state.display_index().value_or(0)),
+            state.refresh_rate());
+}
+
+TEST(WindowState, HandleWindowEvent)
+{
+  cen::window window;
+  cen::window_state state{window};
+
+  const auto make_event =
+      [&](const cen::window_event_id id, const cen::i32 data1, const cen::i32 data2) {
+        SDL_WindowEvent event{};
+        event.type = SDL_WINDOWEVENT;
+        event.windowID = window.id();
+        event.event = static_cast<cen::u8>(id);
+        event.data1 = data1;
+        event.data2 = data2;
+        return cen::window_event{event};
+      };
+
+  // The cached size is updated from the event, without querying the window
+  state.handle(make_event(cen::window_event_id::size_changed, 123, 456));
+  ASSERT_EQ((cen::iarea{123, 456}), state.size());
+
+  state.handle(make_event(cen::window_event_id::moved, 12, 34));
+  ASSERT_EQ((cen::ipoint{12, 34}), state.position());
+
+  window.show();
+  ASSERT_TRUE(state.is_hidden());
+
+  state.handle(make_event(cen::window_event_id::shown, 0, 0));
+  ASSERT_FALSE(state.is_hidden());
+  ASSERT_TRUE(state.is_visible());
+
+  // Events for other windows are ignored
+  auto other = make_event(cen::window_event_id::size_changed, 1, 2).get();
+  other.windowID = window.id() + 1;
+  state.handle(cen::window_event{other});
+  ASSERT_EQ((cen::iarea{123, 456}), state.size());
+
+  // Fullscreen toggles are only reported as size changes
+  window.set_fullscreen_desktop(true);
+  state.handle(make_event(cen::window_event_id::size_changed, 123, 456));
+  ASSERT_EQ(window.is_fullscreen_desktop(), state.is_fullscreen_desktop());
+
+  window.set_fullscreen_desktop(false);
+  state.handle(make_event(cen::window_event_id::resized, 123, 456));
+  ASSERT_FALSE(state.is_fullscreen_desktop());
+
+  window.hide();
+}
+
+TEST(WindowState, Refresh)
+{
+  cen::window window;
+  cen::window_state state{window};
+
+  window.set_size({321, 123});
+  ASSERT_NE((cen::iarea{321, 123}), state.size());
+
+  state.refresh();
+  ASSERT_EQ((cen::iarea{321, 123}), state.size());
+}